@@ -0,0 +1,117 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/additive_utils.h"
+#include "acl/core/error_result.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/compression/compression_settings.h"
+#include "acl/compression/track_array.h"
+#include "acl/compression/impl/clip_context.h"
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// An additive base prepared once and shared by every additive clip compressed against it.
+	//
+	// Compressing an additive clip samples its base and converts every base pose with
+	// the error metric each time it is needed. Many clips (aim offsets, hit reactions)
+	// often share a single base. An additive base context initializes the base clip
+	// data once and converts the base pose of every sample with the error metric up front.
+	// Compressing with it skips that redundant work, see 'compress_track_list(..)'.
+	//
+	// The base track list samples are referenced, not copied, and the base track list
+	// must outlive the context. Clips compressed with it must use the same error metric.
+	// The additive base context is read only once initialized and can be used by many
+	// compression jobs concurrently. It must outlive compression.
+	//////////////////////////////////////////////////////////////////////////
+	class additive_base_context
+	{
+	public:
+		//////////////////////////////////////////////////////////////////////////
+		// Constructs an empty additive base context.
+		additive_base_context();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Destructs the additive base context and releases its memory.
+		~additive_base_context();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Initializes the additive base context from the provided base track list.
+		// The error metric from the compression settings converts the base pose.
+		error_result initialize(iallocator& allocator, const track_array_qvvf& base_track_list, const compression_settings& settings, additive_clip_format8 additive_format);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Releases the memory held and resets the additive base context to its default constructed state.
+		void reset();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if this additive base context has been initialized, false otherwise.
+		bool is_initialized() const { return m_allocator != nullptr; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the base track list.
+		const track_array_qvvf* get_track_list() const { return m_track_list; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the additive format clips are compressed with.
+		additive_clip_format8 get_additive_format() const { return m_additive_format; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the error metric the base pose was converted with.
+		const itransform_error_metric* get_error_metric() const { return m_error_metric; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Internal use only, returns the base clip data.
+		const acl_impl::clip_context& get_clip_context() const { return m_clip_context; }
+
+	private:
+		additive_base_context(const additive_base_context& other) = delete;
+		additive_base_context& operator=(const additive_base_context& other) = delete;
+
+		iallocator*						m_allocator;
+		const track_array_qvvf*			m_track_list;
+		const itransform_error_metric*	m_error_metric;
+		additive_clip_format8			m_additive_format;
+
+		uint8_t*						m_converted_base_transforms[2];			// Indexed by whether the lossy clip has scale
+		size_t							m_converted_base_transforms_size[2];	// Size in bytes of each array above
+		acl_impl::clip_context			m_clip_context;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+#include "acl/compression/impl/additive_base_context.impl.h"
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,101 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/error.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <cstdint>
+#include <cstring>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	////////////////////////////////////////////////////////////////////////////////
+	// bit_rate_search_strategy8 represents how the bit rates of transform tracks are
+	// searched once the local space bit rates have been found.
+	enum class bit_rate_search_strategy8 : uint8_t
+	{
+		// Every transform is processed from the root and the permutations of bit rate
+		// increments along its chain are searched exhaustively. The compression level
+		// determines how many increments are searched at once.
+		permutations	= 0,
+
+		// Every transform that misses its error threshold proposes the single bit rate
+		// increment along its chain that lowers its error the most per bit added. The best
+		// increment across the whole segment is applied first until every transform meets
+		// its threshold. Much faster than the permutation search with a slightly larger
+		// memory footprint. The compression level is ignored.
+		greedy			= 1,
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Returns a string representing the bit rate search strategy.
+	// TODO: constexpr
+	inline const char* get_bit_rate_search_strategy_name(bit_rate_search_strategy8 strategy)
+	{
+		switch (strategy)
+		{
+		case bit_rate_search_strategy8::permutations:	return "permutations";
+		case bit_rate_search_strategy8::greedy:			return "greedy";
+		default:										return "<Invalid>";
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the bit rate search strategy from its string representation.
+	inline bool get_bit_rate_search_strategy(const char* strategy_name, bit_rate_search_strategy8& out_strategy)
+	{
+		ACL_ASSERT(strategy_name != nullptr, "Strategy name cannot be null");
+		if (strategy_name == nullptr)
+			return false;
+
+		const char* strategy_permutations = "permutations";
+		if (std::strncmp(strategy_name, strategy_permutations, std::strlen(strategy_permutations)) == 0)
+		{
+			out_strategy = bit_rate_search_strategy8::permutations;
+			return true;
+		}
+
+		const char* strategy_greedy = "greedy";
+		if (std::strncmp(strategy_name, strategy_greedy, std::strlen(strategy_greedy)) == 0)
+		{
+			out_strategy = bit_rate_search_strategy8::greedy;
+			return true;
+		}
+
+		return false;
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -25,13 +25,20 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "acl/version.h"
+#include "acl/core/compressed_bundle.h"
 #include "acl/core/compressed_database.h"
+#include "acl/core/compressed_mixed_tracks.h"
+#include "acl/core/compressed_pack.h"
+#include "acl/core/compressed_parts.h"
 #include "acl/core/compressed_tracks.h"
 #include "acl/core/error_result.h"
 #include "acl/core/iallocator.h"
 #include "acl/core/impl/compiler_utils.h"
+#include "acl/compression/additive_base_context.h"
 #include "acl/compression/compression_settings.h"
+#include "acl/compression/database_build_stream.h"
 #include "acl/compression/output_stats.h"
+#include "acl/compression/prepared_clip_context.h"
 #include "acl/compression/track_array.h"
 
 #include <cstdint>
@@ -83,6 +90,188 @@ namespace acl
 		const track_array_qvvf& additive_base_track_list, additive_clip_format8 additive_format,
 		compressed_tracks*& out_compressed_tracks, output_stats& out_stats);
 
+	//////////////////////////////////////////////////////////////////////////
+	// Compresses a transform track array using a prepared additive base with uniform sampling.
+	// See above and 'additive_base_context' for details. The compressed output matches
+	// compressing with the base track list directly for the error metrics provided.
+	// The compression settings must use the error metric the additive base was prepared with.
+	//
+	//    allocator:				The allocator instance to use to allocate and free memory.
+	//    track_list:				The track list to compress.
+	//    settings:					The compression settings to use.
+	//    additive_base:			The prepared additive base, shared by every clip compressed against it.
+	//    out_compressed_tracks:	The resulting compressed tracks. The caller owns the returned memory and must free it.
+	//    out_stats:				Stat output structure.
+	//////////////////////////////////////////////////////////////////////////
+	error_result compress_track_list(iallocator& allocator, const track_array_qvvf& track_list, const compression_settings& settings,
+		const additive_base_context& additive_base, compressed_tracks*& out_compressed_tracks, output_stats& out_stats);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Compresses a prepared transform track array with uniform sampling.
+	// See above and 'prepared_clip_context' for details. The compressed output matches
+	// compressing the track list the clip was prepared from directly, with its additive base if any.
+	// The compression settings must use the error metric and the sample rate reduction setting
+	// the clip was prepared with, everything else can change between calls.
+	//
+	//    allocator:				The allocator instance to use to allocate and free memory.
+	//    prepared_clip:			The prepared clip, shared by every compression of the same track list.
+	//    settings:					The compression settings to use.
+	//    out_compressed_tracks:	The resulting compressed tracks. The caller owns the returned memory and must free it.
+	//    out_stats:				Stat output structure.
+	//////////////////////////////////////////////////////////////////////////
+	error_result compress_track_list(iallocator& allocator, const prepared_clip_context& prepared_clip, const compression_settings& settings,
+		compressed_tracks*& out_compressed_tracks, output_stats& out_stats);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Memory provided by the caller to receive compressed tracks.
+	//
+	// Once every compression stage has run, the exact size of the compressed tracks
+	// is known and the request callback is called with it. It returns where the
+	// compressed tracks are written in place. The caller owns that memory.
+	struct compressed_tracks_output_buffer
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Returns a buffer of at least 'size' bytes aligned to 'k_compressed_tracks_preferred_alignment'.
+		// Returning null (e.g. when not enough space remains) fails compression.
+		using request_buffer_function = void* (*)(void* user_data, uint32_t size);
+
+		//////////////////////////////////////////////////////////////////////////
+		// The request callback, it must be provided.
+		request_buffer_function request_buffer = nullptr;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Optional user data passed along to the callback above.
+		// Defaults to 'null'
+		void* user_data = nullptr;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Compresses a track array with uniform sampling directly into memory provided
+	// by the caller, see above for details. This avoids an allocation and a copy when
+	// the compressed tracks end up in a larger buffer (e.g. a pack of many clips).
+	// The output buffer is requested at most once on success. It can be requested
+	// more than once if a cached entry turns out to be corrupted, in which case only
+	// the last buffer holds the compressed tracks.
+	//
+	//    allocator:				The allocator instance to use to allocate and free transient memory.
+	//    track_list:				The track list to compress.
+	//    settings:					The compression settings to use.
+	//    output_buffer:			Provides the memory that receives the compressed tracks.
+	//    out_compressed_tracks:	The resulting compressed tracks, they live in the memory provided.
+	//    out_stats:				Stat output structure.
+	//////////////////////////////////////////////////////////////////////////
+	error_result compress_track_list(iallocator& allocator, const track_array& track_list, const compression_settings& settings,
+		const compressed_tracks_output_buffer& output_buffer, compressed_tracks*& out_compressed_tracks, output_stats& out_stats);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Compresses a transform track array using its additive base with uniform sampling
+	// directly into memory provided by the caller, see above for details.
+	//////////////////////////////////////////////////////////////////////////
+	error_result compress_track_list(iallocator& allocator, const track_array_qvvf& track_list, const compression_settings& settings,
+		const track_array_qvvf& additive_base_track_list, additive_clip_format8 additive_format,
+		const compressed_tracks_output_buffer& output_buffer, compressed_tracks*& out_compressed_tracks, output_stats& out_stats);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Provides the raw samples of a clip too long to hold in memory at once.
+	struct track_array_source
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Fills 'out_track_list' with every track of the clip holding only the samples
+		// [first_sample_index, first_sample_index + num_samples). The track array must be
+		// allocated with the allocator provided and it is released once it has been compressed.
+		// Every call must return the same tracks with the same descriptions and sample rate.
+		using read_samples_function = error_result (*)(void* user_data, iallocator& allocator, uint32_t first_sample_index, uint32_t num_samples, track_array& out_track_list);
+
+		//////////////////////////////////////////////////////////////////////////
+		// The read callback, it must be provided.
+		read_samples_function read_samples = nullptr;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Optional user data passed along to the callback above.
+		// Defaults to 'null'
+		void* user_data = nullptr;
+
+		//////////////////////////////////////////////////////////////////////////
+		// The total number of samples per track in the clip.
+		uint32_t num_samples = 0;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Compresses a clip too long to hold in memory (e.g. a long motion capture take) in
+	// consecutive parts with uniform sampling. The raw samples of each part are read through
+	// the source callback, compressed, and released before the next part is read. Peak memory
+	// depends on the part size instead of the clip length.
+	//
+	// Each part is a regular compressed tracks instance. Consecutive parts share one sample
+	// which allows playback to interpolate seamlessly between them. See acl/core/compressed_parts.h
+	// to find the part and the sample time to seek with. Additive clips and looping are not supported.
+	//
+	//    allocator:					The allocator instance to use to allocate and free memory.
+	//    source:						Provides the raw samples of every part.
+	//    max_num_samples_per_part:		The maximum number of samples held by each part, at least 2.
+	//    settings:						The compression settings to use for every part.
+	//    out_compressed_parts:			The resulting compressed tracks (array allocated by the caller with 'calculate_num_compressed_parts(..)' entries). The caller owns the returned memory and must free it.
+	//    out_stats:					Stat output structure, holds the stats of the last part compressed.
+	//////////////////////////////////////////////////////////////////////////
+	error_result compress_track_list_in_parts(iallocator& allocator, const track_array_source& source, uint32_t max_num_samples_per_part, const compression_settings& settings,
+		compressed_tracks** out_compressed_parts, output_stats& out_stats);
+
+	//////////////////////////////////////////////////////////////////////////
+	// The predicted outcome of compressing a track list, see estimate_compressed_size(..)
+	struct compressed_size_estimate
+	{
+		// The predicted size in bytes of the compressed tracks, without optional metadata.
+		uint32_t compressed_size = 0;
+
+		// The largest error predicted on the rigid shell of any transform.
+		float max_error = 0.0F;
+
+		// The number of segments the compressed tracks will contain.
+		uint32_t num_segments = 0;
+
+		// The number of animated sub-tracks summed over every segment.
+		uint32_t num_animated_sub_tracks = 0;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Predicts the compressed size of a transform track list without compressing it.
+	// Only the cheap early stages run: constant track detection, range extraction, and segmenting.
+	// The expensive bit rate search is replaced by picking, for each animated sub-track, the lowest
+	// bit rate whose quantization error over its segment range fits within the track precision.
+	// This is intended for budget planning: estimating many clips is far cheaper than compressing them.
+	// The estimate ignores sample rate reduction, keyframe stripping, and the error accumulated
+	// through the hierarchy; the actual compressed size is typically within a small factor of it.
+	//
+	//    allocator:				The allocator instance to use to allocate and free memory.
+	//    track_list:				The track list to estimate.
+	//    settings:					The compression settings to use.
+	//    out_estimate:				The resulting estimate.
+	//////////////////////////////////////////////////////////////////////////
+	error_result estimate_compressed_size(iallocator& allocator, const track_array& track_list, const compression_settings& settings, compressed_size_estimate& out_estimate);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Compresses many track arrays with uniform sampling, see above for details.
+	//
+	// When a job scheduler is provided, track arrays are compressed concurrently
+	// with each job compressing one track array at a time. Every job retains its
+	// transient memory from one track array to the next to avoid allocating it
+	// over and over. The allocator provided must be thread safe when a job scheduler
+	// is used. The job scheduler from the compression settings is ignored.
+	// Progress is reported as the fraction of track arrays compressed.
+	//
+	// Each output entry is null if its track array failed to compress in which case
+	// the first error in list order is returned.
+	//
+	//    allocator:				The allocator instance to use to allocate and free memory.
+	//    track_lists:				The track lists to compress.
+	//    num_track_lists:			The number of track lists to compress.
+	//    settings:					The compression settings to use for every track list.
+	//    job_scheduler:			The job scheduler to use to compress in parallel.
+	//    out_compressed_tracks:	The resulting compressed tracks (array allocated by the caller, one entry per track list). The caller owns the returned memory and must free it.
+	//////////////////////////////////////////////////////////////////////////
+	error_result compress_track_lists(iallocator& allocator, const track_array* const* track_lists, uint32_t num_track_lists, const compression_settings& settings,
+		const compression_job_scheduler& job_scheduler, compressed_tracks** out_compressed_tracks);
+
 	//////////////////////////////////////////////////////////////////////////
 	// Takes a list of compressed track instances that contain the contributing error metadata and uses their data to build
 	// a new database instance. Each compressed track instance will be duplicated and split between a new instance and the
@@ -99,6 +288,97 @@ namespace acl
 		const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks,
 		compressed_tracks** out_compressed_tracks, compressed_database*& out_database);
 
+	//////////////////////////////////////////////////////////////////////////
+	// Builds a database, see above for details.
+	//
+	// When a job scheduler is provided, the compressed track instances are rewritten concurrently
+	// and the lowest importance tier chunks are entropy coded concurrently. The output is identical
+	// whether or not a job scheduler is used. The allocator provided must be thread safe when a job
+	// scheduler is used.
+	//
+	//    job_scheduler:					The job scheduler to use to build the database in parallel
+	//////////////////////////////////////////////////////////////////////////
+	error_result build_database(iallocator& allocator, const compression_database_settings& settings,
+		const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks,
+		const compression_job_scheduler& job_scheduler, compressed_tracks** out_compressed_tracks, compressed_database*& out_database);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Builds a database, see above for details.
+	//
+	// Chunks are filled with the clips in the order provided. Clips that play together (e.g. a locomotion set)
+	// should share their chunks to reduce how many chunks must be streamed in for a given situation.
+	// When affinity groups are provided, the clips of a group are packed next to one another, in the order
+	// provided, and groups are packed in increasing group value. The output compressed track instances
+	// retain the order provided.
+	//
+	//    clip_affinity_groups:				The affinity group of every compressed track instance in the list (optional, may be nullptr)
+	//    job_scheduler:					The job scheduler to use to build the database in parallel
+	//////////////////////////////////////////////////////////////////////////
+	error_result build_database(iallocator& allocator, const compression_database_settings& settings,
+		const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks, const uint32_t* clip_affinity_groups,
+		const compression_job_scheduler& job_scheduler, compressed_tracks** out_compressed_tracks, compressed_database*& out_database);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Builds a database, see above for details, without requiring every compressed track instance to be resident.
+	//
+	// Building proceeds in two passes over the source. The first acquires every compressed track instance
+	// to gather its contributing error and assigns every frame to its tier. The second acquires them again,
+	// in order, to write the new compressed track instances and the database chunks to the sink as they
+	// are completed. Memory usage is bounded by the largest compressed track instance, a few chunks, and
+	// the contributing error of every frame instead of the total size of the inputs and outputs.
+	// The output is identical to 'build_database(..)' followed by 'split_database_bulk_data(..)'.
+	//
+	//    allocator:						The allocator instance to use
+	//    settings:							The settings to use when building the database
+	//    source:							The source of the compressed track instances (must have contributing error metadata)
+	//    sink:								The sink that receives the new compressed track instances and the bulk data of every tier
+	//    out_database:						The output database without inline bulk data (allocated by the function)
+	//////////////////////////////////////////////////////////////////////////
+	error_result build_database(iallocator& allocator, const compression_database_settings& settings,
+		database_build_source& source, database_build_sink& sink, compressed_database*& out_database);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Takes an existing database and updates it incrementally: the removed compressed track instances
+	// leave it and the added ones join it. To change a clip, remove its previous version and add the new one.
+	// The compressed track instances that remain bound to the source database remain valid with the
+	// output database and do not need to be built again. Their chunks retain their data and their entropy
+	// coding as is unless one of their segments was removed. The added clips are split like they would be
+	// with 'build_database' and their data is appended in new chunks. Added clips reuse the runtime headers
+	// of the removed clips when they fit, the runtime memory of the output database includes any that remain unused.
+	// The source database must have its bulk data inline and must have been built with the same max chunk size.
+	//
+	//    allocator:						The allocator instance to use
+	//    settings:							The settings to use when adding clips to the database
+	//    database:							The source database to update
+	//    removed_tracks_list:				The list of compressed tracks bound to the source database to remove
+	//    num_removed_tracks:				The number of compressed track instances in the above list
+	//    added_tracks_list:				The list of compressed tracks to add to the database (must have contributing error metadata)
+	//    num_added_tracks:					The number of compressed track instances in the above list
+	//    out_added_compressed_tracks:		The output list of added compressed tracks bound to the output database (array allocated by the caller (must be large enough); compressed_tracks instances allocated by the function)
+	//    out_database:						The output database (allocated by the function)
+	//////////////////////////////////////////////////////////////////////////
+	error_result update_database(iallocator& allocator, const compression_database_settings& settings, const compressed_database& database,
+		const compressed_tracks* const* removed_tracks_list, uint32_t num_removed_tracks,
+		const compressed_tracks* const* added_tracks_list, uint32_t num_added_tracks,
+		compressed_tracks** out_added_compressed_tracks, compressed_database*& out_database);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Takes a list of compressed track instances that contain the contributing error metadata and strips
+	// keyframes across all of them until their total size fits within a memory budget. Much like
+	// 'build_database', the keyframes that contribute the least error are stripped first regardless of
+	// which instance they belong to. The first and last keyframes of each segment are always retained.
+	// The savings are estimated from the animated pose sizes and the budget might not be met exactly.
+	//
+	//    allocator:						The allocator instance to use
+	//    target_size:						The total size in bytes to fit the compressed tracks within
+	//    compressed_tracks_list:			The list of compressed tracks to strip (must have contributing error metadata)
+	//    num_compressed_tracks:			The number of compressed track instances in the above list
+	//    out_compressed_tracks:			The output list of compressed tracks (array allocated by the caller (must be large enough); compressed_tracks instances allocated by the function)
+	//////////////////////////////////////////////////////////////////////////
+	error_result strip_keyframes_to_budget(iallocator& allocator, uint32_t target_size,
+		const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks,
+		compressed_tracks** out_compressed_tracks);
+
 	//////////////////////////////////////////////////////////////////////////
 	// Takes a compressed database with inline bulk data and duplicates it into
 	// a new database instance where the bulk data lives in separate buffers.
@@ -108,13 +388,27 @@ namespace acl
 	//    out_split_database:				The new database without inline bulk data.
 	//    out_bulk_data_medium:				The new database's bulk data for the medium importance tier.
 	//    out_bulk_data_low:				The new database's bulk data for the low importance tier.
+	//
+	// When the database contains intermediate tiers (see ACL_NUM_DATABASE_TIERS), they must be empty
+	// or the overload below must be used.
 	//////////////////////////////////////////////////////////////////////////
 	error_result split_database_bulk_data(iallocator& allocator, const compressed_database& database, compressed_database*& out_split_database, uint8_t*& out_bulk_data_medium, uint8_t*& out_bulk_data_low);
 
+	//////////////////////////////////////////////////////////////////////////
+	// Takes a compressed database with inline bulk data and duplicates it into
+	// a new database instance where the bulk data lives in separate buffers.
+	//
+	//    allocator:						The allocator instance to use to allocate the new database and its bulk data.
+	//    database:							The source database to split with inline bulk data.
+	//    out_split_database:				The new database without inline bulk data.
+	//    out_bulk_data:					The new database's bulk data, one buffer per database tier in order of decreasing importance.
+	//////////////////////////////////////////////////////////////////////////
+	error_result split_database_bulk_data(iallocator& allocator, const compressed_database& database, compressed_database*& out_split_database, uint8_t* (&out_bulk_data)[k_num_database_tiers]);
+
 	//////////////////////////////////////////////////////////////////////////
 	// Takes a compressed database and strips the specified quality tier from it.
 	// The database is duplicated including its remaining bulk data (if inline).
-	// Only the medium/lowest tiers can be stripped.
+	// Only the tiers that live in the database can be stripped.
 	//
 	//    allocator:						The allocator instance to use to allocate the new database.
 	//    database:							The source database to strip.
@@ -123,12 +417,111 @@ namespace acl
 	//////////////////////////////////////////////////////////////////////////
 	error_result strip_database_quality_tier(iallocator& allocator, const compressed_database& database, quality_tier tier, compressed_database*& out_stripped_database);
 
+	//////////////////////////////////////////////////////////////////////////
+	// Takes a compressed tracks instance and packs it losslessly into a smaller buffer meant for storage.
+	// The headers, the constant and range values split into byte planes, the segment metadata, the transposed
+	// animated samples, and the trailing data are each entropy coded on their own. Packed tracks
+	// must be unpacked with 'unpack_compressed_tracks(..)' before they can be used.
+	//
+	//    allocator:						The allocator instance to use to allocate the packed buffer and temporary memory.
+	//    tracks:							The compressed tracks to pack.
+	//    out_packed_tracks:				The packed buffer. The caller owns the returned memory and must free it.
+	//    out_packed_tracks_size:			The size in bytes of the packed buffer.
+	//////////////////////////////////////////////////////////////////////////
+	error_result pack_compressed_tracks(iallocator& allocator, const compressed_tracks& tracks, uint8_t*& out_packed_tracks, uint32_t& out_packed_tracks_size);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Takes a list of compressed tracks instances and an optional database and bundles them into a single
+	// compressed pack meant to be written to disk and loaded as a whole (e.g. memory mapped).
+	// Once loaded, 'make_compressed_pack(..)' returns the pack and its content can be used in place.
+	// Each compressed tracks instance is aligned to 'k_compressed_tracks_preferred_alignment' and the bulk data
+	// of each tier is aligned to 'k_compressed_pack_bulk_data_alignment'.
+	// Identical compressed tracks instances (byte for byte) are stored once and their entries share
+	// the same data.
+	//
+	//    allocator:						The allocator instance to use to allocate the pack.
+	//    compressed_tracks_list:			The list of compressed tracks to store in the pack.
+	//    num_compressed_tracks:			The number of compressed track instances in the above list.
+	//    database:							The database the compressed tracks are bound to (optional).
+	//    bulk_data_medium:					The database's bulk data for the medium importance tier, required unless inline or empty.
+	//    bulk_data_low:					The database's bulk data for the low importance tier, required unless inline or empty.
+	//    out_pack:							The resulting compressed pack. The caller owns the returned memory and must free it.
+	//
+	// When the database contains intermediate tiers (see ACL_NUM_DATABASE_TIERS), they must be empty
+	// or their bulk data provided with the overload below.
+	//////////////////////////////////////////////////////////////////////////
+	error_result build_compressed_pack(iallocator& allocator, const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks,
+		const compressed_database* database, const uint8_t* bulk_data_medium, const uint8_t* bulk_data_low, compressed_pack*& out_pack);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Same as above but the database's bulk data is provided for every database tier in order of decreasing
+	// importance. Each entry is required unless the bulk data is inline or the tier is empty.
+	//////////////////////////////////////////////////////////////////////////
+	error_result build_compressed_pack(iallocator& allocator, const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks,
+		const compressed_database* database, const uint8_t* const (&bulk_data)[k_num_database_tiers], compressed_pack*& out_pack);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Takes the list of clips of a skeleton (or any other track list) and bundles them into a single
+	// compressed bundle meant to be written to disk and loaded as a whole (e.g. memory mapped).
+	// Once loaded, 'make_compressed_bundle(..)' returns the bundle and its clips can be used in place.
+	// The track names and descriptions are stored once, with the first clip, and stripped from the others.
+	// Each clip retains its name, its parent track indices, and everything needed to decompress it.
+	// Each compressed tracks instance is aligned to 'k_compressed_tracks_preferred_alignment'.
+	//
+	// Every clip must have the same track type and number of tracks, and the same track names and
+	// descriptions when they are present. Clips bound to a database cannot be bundled, use a pack instead.
+	//
+	//    allocator:						The allocator instance to use to allocate the bundle.
+	//    compressed_tracks_list:			The list of clips to store in the bundle.
+	//    num_compressed_tracks:			The number of clips in the above list, at least one.
+	//    out_bundle:						The resulting compressed bundle. The caller owns the returned memory and must free it.
+	//////////////////////////////////////////////////////////////////////////
+	error_result build_compressed_bundle(iallocator& allocator, const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks, compressed_bundle*& out_bundle);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Stores a transform track list and a scalar track list that play back together (e.g. a character's
+	// skeleton along with its facial curves) in a single compressed mixed tracks buffer.
+	// Once loaded, 'make_compressed_mixed_tracks(..)' returns it and a 'mixed_decompression_context'
+	// seeks and decompresses both with a single call.
+	// Each compressed tracks instance is aligned to 'k_compressed_tracks_preferred_alignment'.
+	//
+	// Both must have the same number of samples, sample rate, and looping policy.
+	// Compressed tracks bound to a database are not supported.
+	//
+	//    allocator:						The allocator instance to use to allocate the mixed tracks.
+	//    transform_tracks:					The compressed transform tracks.
+	//    scalar_tracks:					The compressed scalar tracks.
+	//    out_mixed_tracks:					The resulting compressed mixed tracks. The caller owns the returned memory and must free it.
+	//////////////////////////////////////////////////////////////////////////
+	error_result build_compressed_mixed_tracks(iallocator& allocator, const compressed_tracks& transform_tracks, const compressed_tracks& scalar_tracks, compressed_mixed_tracks*& out_mixed_tracks);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Compresses a transform track array and a scalar track array that play back together
+	// into a single compressed mixed tracks buffer, see 'build_compressed_mixed_tracks(..)'.
+	// Both track arrays are compressed with the same settings, the error metric only applies to transforms.
+	// Both must have the same number of samples and sample rate.
+	//
+	//    allocator:				The allocator instance to use to allocate and free memory.
+	//    transform_track_list:		The transform track list to compress.
+	//    scalar_track_list:		The scalar track list to compress.
+	//    settings:					The compression settings to use.
+	//    out_mixed_tracks:			The resulting compressed mixed tracks. The caller owns the returned memory and must free it.
+	//    out_stats:				Stat output structure, holds the stats of the transform tracks.
+	//////////////////////////////////////////////////////////////////////////
+	error_result compress_track_list(iallocator& allocator, const track_array_qvvf& transform_track_list, const track_array& scalar_track_list, const compression_settings& settings,
+		compressed_mixed_tracks*& out_mixed_tracks, output_stats& out_stats);
+
 	ACL_IMPL_VERSION_NAMESPACE_END
 }
 
 #include "acl/compression/impl/compress.database.impl.h"
 #include "acl/compression/impl/compress.scalar.impl.h"
 #include "acl/compression/impl/compress.transform.impl.h"
+#include "acl/compression/impl/compress.estimate.impl.h"
 #include "acl/compression/impl/compress.impl.h"
+#include "acl/compression/impl/compress.packed_tracks.impl.h"
+#include "acl/compression/impl/compress.pack.impl.h"
+#include "acl/compression/impl/compress.bundle.impl.h"
+#include "acl/compression/impl/compress.mixed.impl.h"
 
 ACL_IMPL_FILE_PRAGMA_POP
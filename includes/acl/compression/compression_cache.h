@@ -0,0 +1,86 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/compression/compression_settings.h"
+#include "acl/compression/track_array.h"
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// An optional cache consulted by 'compress_track_list(..)' before any work is
+	// performed. When a compressed version of the same inputs is found, it is returned
+	// as is and compression is skipped entirely. Otherwise, the track list is compressed
+	// and the result stored in the cache.
+	//
+	// Entries are keyed by a 64 bit hash of the raw tracks, the additive base, the
+	// compression settings, and the compressed format version. See 'get_compression_cache_key(..)'.
+	// The storage (memory, disk, network) is up to the implementation. When a job
+	// scheduler is used with 'compress_track_lists(..)', the cache must be thread safe.
+	//////////////////////////////////////////////////////////////////////////
+	class compression_cache
+	{
+	public:
+		virtual ~compression_cache() = default;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Looks up the compressed tracks associated with the provided key.
+		// When found, a copy must be allocated with the provided allocator (16 bytes aligned)
+		// and returned, the caller takes ownership of it. Returns null otherwise.
+		virtual compressed_tracks* find(iallocator& allocator, uint64_t key) = 0;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Stores the compressed tracks associated with the provided key.
+		// The compressed tracks remain owned by the caller and must be copied.
+		virtual void store(uint64_t key, const compressed_tracks& tracks) = 0;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the cache key that uniquely identifies the compressed output of the provided inputs.
+	// The job scheduler and the cache itself do not impact the compressed output and are not part of the key.
+	uint64_t get_compression_cache_key(const track_array& track_list, const compression_settings& settings);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the cache key that uniquely identifies the compressed output of the provided
+	// inputs when compressing with an additive base.
+	uint64_t get_compression_cache_key(const track_array_qvvf& track_list, const compression_settings& settings,
+		const track_array_qvvf& additive_base_track_list, additive_clip_format8 additive_format);
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+#include "acl/compression/impl/compression_cache.impl.h"
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -43,8 +43,8 @@ namespace acl
 	// the level, the slower the compression but the smaller the memory footprint.
 	enum class compression_level8 : uint8_t
 	{
-		lowest		= 0,	// Same as medium for now
-		low			= 1,	// Same as medium for now
+		lowest		= 0,	// Bit rates are estimated from the range extents and only refined, no permutation search
+		low			= 1,	// Bit rates are searched in local space and only refined, no permutation search
 		medium		= 2,
 		high		= 3,
 		highest		= 4,
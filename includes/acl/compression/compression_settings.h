@@ -26,11 +26,14 @@
 
 #include "acl/version.h"
 #include "acl/core/impl/compiler_utils.h"
+#include "acl/core/compressed_tracks.h"
 #include "acl/core/error_result.h"
 #include "acl/core/hash.h"
 #include "acl/core/track_formats.h"
 #include "acl/core/track_types.h"
 #include "acl/core/range_reduction_types.h"
+#include "acl/core/quality_tiers.h"
+#include "acl/compression/bit_rate_search_strategy.h"
 #include "acl/compression/compression_level.h"
 #include "acl/compression/transform_error_metrics.h"
 
@@ -44,6 +47,9 @@ namespace acl
 {
 	ACL_IMPL_VERSION_NAMESPACE_BEGIN
 
+	class compression_cache;
+	class skeleton_context;
+
 	//////////////////////////////////////////////////////////////////////////
 	// Encapsulates all the compression settings related to database usage.
 	struct compression_database_settings
@@ -68,6 +74,14 @@ namespace acl
 		// Defaults to '0.5' (the least important 50% of frames are moved to the database)
 		float low_importance_tier_proportion = 0.5F;
 
+		//////////////////////////////////////////////////////////////////////////
+		// When the database contains more than 2 tiers (see ACL_NUM_DATABASE_TIERS), the proportions
+		// of the tiers that sit between the medium and low importance tiers, in order of decreasing
+		// importance. See above for details, the sum of every proportion must be between 0.0 and 1.0.
+		// Unused with the default 2 tiers.
+		// Defaults to '0.0' (the intermediate tiers are empty)
+		float intermediate_importance_tier_proportions[k_num_intermediate_database_tiers != 0 ? k_num_intermediate_database_tiers : 1] = {};
+
 		//////////////////////////////////////////////////////////////////////////
 		// How large should each chunk be, in bytes.
 		// This value must be at least 4 KB and ideally it should be a multiple of
@@ -76,6 +90,19 @@ namespace acl
 		// Defaults to '1 MB'
 		uint32_t max_chunk_size = 1 * 1024 * 1024;
 
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not to entropy code the chunks of the low importance tier.
+		// That data is cold: it streams in rarely and it is seldom sampled. Entropy coding
+		// reduces its disk footprint and the IO bandwidth needed to stream it at the cost of
+		// decoding every chunk once as it streams in. An entropy coded tier must be streamed
+		// with a streamer that decodes it (e.g. 'file_database_streamer').
+		// Defaults to 'false'
+		bool entropy_code_low_importance_tier = false;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the proportion of frames that go into the specified database tier.
+		float get_tier_proportion(quality_tier tier) const;
+
 		//////////////////////////////////////////////////////////////////////////
 		// Calculates a hash from the internal state to uniquely identify a configuration.
 		uint32_t get_hash() const;
@@ -100,6 +127,14 @@ namespace acl
 		// Defaults to 'false'
 		bool include_track_names = false;
 
+		//////////////////////////////////////////////////////////////////////////
+		// Whether to include a hash table of the track names alongside them.
+		// It allows compressed_tracks::find_track_index(..) to look up a track
+		// by name in constant time, without allocating.
+		// Requires 'include_track_names'
+		// Defaults to 'false'
+		bool include_track_name_table = false;
+
 		//////////////////////////////////////////////////////////////////////////
 		// Whether to include the optional metadata for parent track indices
 		// Transform tracks only
@@ -117,7 +152,8 @@ namespace acl
 		// of each frame. These are sorted from lowest to largest error.
 		// This is required when the compressed tracks will later be merged into
 		// a database.
-		// Transform tracks only
+		// Scalar tracks measure the error in the units of their precision, it
+		// cannot be compared with the error of transform tracks.
 		// Defaults to 'false'
 		bool include_contributing_error = false;
 
@@ -181,6 +217,121 @@ namespace acl
 		error_result is_valid() const;
 	};
 
+	//////////////////////////////////////////////////////////////////////////
+	// Encapsulates an optional user supplied job scheduler used to parallelize
+	// parts of the compression process. Segments are independent once a clip
+	// has been split and their quantization can execute concurrently. When a
+	// clip has fewer segments than jobs and the compression level is 'high' or
+	// above, the bone chain permutation search within each segment is executed
+	// concurrently instead. When exhaustive statistics are requested, the error
+	// of every sample is also calculated concurrently. Scalar tracks are
+	// independent and their bit rates are searched concurrently. The constant
+	// sub-track detection, rotation conversion, range extraction, and
+	// normalization passes split their bones between jobs.
+	//
+	// When set, the allocator provided to compression must be thread safe as
+	// jobs will allocate and free their scratch memory concurrently. The error
+	// metric used must also be safe to call from multiple threads (the built-in
+	// metrics are).
+	//
+	// The compressed output is identical whether or not a scheduler is used.
+	//
+	// A built-in std::thread pool is provided in compression_thread_pool.h along
+	// with adapters for TBB (tbb_job_scheduler.h) and enkiTS (enkits_job_scheduler.h).
+	struct compression_job_scheduler
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// A job entry point, called with the job data provided on submission.
+		using job_function = void (*)(void* job_data);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Submits a job for execution. The job can execute on any thread, including
+		// the calling thread, either immediately or later during the wait.
+		using submit_job_function = void (*)(void* user_data, job_function job, void* job_data);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Waits for every job previously submitted to complete.
+		using wait_for_jobs_function = void (*)(void* user_data);
+
+		//////////////////////////////////////////////////////////////////////////
+		// The job submission callback.
+		// Defaults to 'null', jobs execute serially on the calling thread
+		submit_job_function submit_job = nullptr;
+
+		//////////////////////////////////////////////////////////////////////////
+		// The wait callback. Must be set if the submission callback is set.
+		// Defaults to 'null'
+		wait_for_jobs_function wait_for_jobs = nullptr;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Optional user data passed along to the callbacks above.
+		// Defaults to 'null'
+		void* user_data = nullptr;
+
+		//////////////////////////////////////////////////////////////////////////
+		// The maximum number of jobs to submit at once, each job requiring its own
+		// scratch memory. Typically set to the number of worker threads available.
+		// The permutation search is only parallelized when this value is set.
+		// Defaults to '0' (one job per segment)
+		uint32_t max_num_jobs = 0;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns whether or not a job scheduler has been provided.
+		bool is_enabled() const { return submit_job != nullptr; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Checks if everything is valid and if it isn't, returns an error string.
+		// Returns nullptr if the settings are valid.
+		error_result is_valid() const;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Allows compression progress to be observed and compression to be cancelled
+	// while it is in progress (e.g. when an artist edits a clip again before it
+	// finishes compressing in the editor).
+	//
+	// Cancellation is checked between compression stages, between segments, and
+	// between transforms while searching for the optimal bit rates. Once cancelled,
+	// compression stops as soon as possible and returns an error without output.
+	//
+	// When a job scheduler is used, the callbacks can be called concurrently from
+	// any job thread and they must be thread safe.
+	struct compression_progress
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Returns whether or not compression should stop.
+		// Once it returns true, it must keep returning true.
+		using should_cancel_function = bool (*)(void* user_data);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Reports the fraction of the work done, between 0.0 and 1.0.
+		// When called concurrently, reports can arrive out of order.
+		using report_progress_function = void (*)(void* user_data, float progress);
+
+		//////////////////////////////////////////////////////////////////////////
+		// The cancellation callback.
+		// Defaults to 'null', compression cannot be cancelled
+		should_cancel_function should_cancel = nullptr;
+
+		//////////////////////////////////////////////////////////////////////////
+		// The progress callback.
+		// Defaults to 'null', progress isn't reported
+		report_progress_function report_progress = nullptr;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Optional user data passed along to the callbacks above.
+		// Defaults to 'null'
+		void* user_data = nullptr;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns whether or not compression has been cancelled.
+		bool is_cancelled() const { return should_cancel != nullptr && should_cancel(user_data); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Reports our progress if we have a callback.
+		void report(float progress) const { if (report_progress != nullptr) report_progress(user_data, progress); }
+	};
+
 	//////////////////////////////////////////////////////////////////////////
 	// Encapsulates all the compression settings.
 	struct compression_settings
@@ -192,6 +343,36 @@ namespace acl
 		// Transform tracks only.
 		compression_level8 level = compression_level8::low;
 
+		//////////////////////////////////////////////////////////////////////////
+		// The maximum number of bone chain bit rate permutations to evaluate per segment.
+		// Higher compression levels evaluate many permutations and some clips with long
+		// transform chains can take a long time to compress. Once the budget is spent,
+		// the search stops refining and the remaining transforms have their bit rates
+		// increased until they meet their error threshold. This caps compression time
+		// at the expense of a larger memory footprint. The output remains deterministic.
+		// Defaults to '0' (unlimited)
+		// Transform tracks only.
+		uint32_t bit_rate_search_budget = 0;
+
+		//////////////////////////////////////////////////////////////////////////
+		// How the bit rates are searched. See [bit_rate_search_strategy8].
+		// The greedy search evaluates far fewer bit rates than the permutation search
+		// and ignores the compression level. The search budget applies to both.
+		// Defaults to 'permutations'
+		// Transform tracks only.
+		bit_rate_search_strategy8 bit_rate_search_strategy = bit_rate_search_strategy8::permutations;
+
+		//////////////////////////////////////////////////////////////////////////
+		// The maximum size in bytes of the cache of quantized samples used while searching
+		// for bit rates. Clips with many transforms and samples in a segment can require a
+		// large cache, each compression job and permutation worker has its own. When set,
+		// fewer bit rates are cached per track which lowers the peak memory usage at the
+		// expense of compression speed. At least one bit rate per track is always cached
+		// which means very small values can be exceeded. The output is not impacted.
+		// Defaults to '0' (unlimited)
+		// Transform tracks only.
+		uint32_t bit_rate_database_max_size = 0;
+
 		//////////////////////////////////////////////////////////////////////////
 		// The rotation, translation, and scale formats to use. See functions get_rotation_format(..) and get_vector_format(..)
 		// Defaults to raw: 'quatf_full' and 'vector3f_full'
@@ -210,7 +391,6 @@ namespace acl
 		// Whether or not to enable database support on the output compressed clip.
 		// This enables the required metadata which will later be stripped once
 		// the database is built.
-		// Transform tracks only.
 		bool enable_database_support = false;
 
 		//////////////////////////////////////////////////////////////////////////
@@ -220,6 +400,78 @@ namespace acl
 		// See `sample_looping_policy` for details.
 		bool optimize_loops = false;
 
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not to pick the segment boundaries based on the motion.
+		// By default, long clips are split into segments of roughly equal length
+		// regardless of their content. When enabled, segment boundaries are moved
+		// to minimize the estimated size of the animated samples: segments that
+		// straddle a motion change have larger ranges and require higher bit rates.
+		// Boundaries remain close to their uniform position to retain the constant
+		// time segment lookup when seeking. The number of segments is unchanged.
+		// Compression is slower with this enabled.
+		// Defaults to 'false'
+		// Transform tracks only.
+		bool enable_adaptive_segmenting = false;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not to try and lower the sample rate of the clip before compressing it.
+		// Clips are often authored at 60 or 120 Hz even when their motion is smooth enough
+		// for a lower rate. When enabled, the sample rate is divided by the largest integer
+		// factor (up to 8) whose interpolated samples remain within half the precision of
+		// every track, as measured by the error metric. The other half is left for quantization.
+		// The factor must retain the clip duration: the number of sample intervals must be
+		// a multiple of it. Halving the sample rate roughly halves the compressed size.
+		// Defaults to 'false'
+		// Transform tracks only.
+		bool enable_sample_rate_reduction = false;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not to store constant rotations with 16 bits per component.
+		// Constant rotations are stored in groups of 4 and a group is quantized only
+		// when every rotation within it remains within the precision of its track,
+		// as measured by the error metric. This roughly halves the size of constant
+		// rotations. Only used with 'rotation_format8::quatf_drop_w_variable'.
+		// Defaults to 'false'
+		// Transform tracks only.
+		bool enable_constant_rotation_quantization = false;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not to store the clip range of animated rotations with 16 bits per component.
+		// Each range is padded to contain every sample once quantized and samples are normalized
+		// within the padded range. This halves the size of the rotation clip range data, a fixed
+		// cost per clip, at the expense of slightly wider ranges which can require higher bit rates.
+		// Only used with 'rotation_format8::quatf_drop_w_variable' and 'rotation_format8::quatf_drop_largest_variable'
+		// when rotations are range reduced.
+		// Defaults to 'false'
+		// Transform tracks only.
+		bool enable_rotation_clip_range_quantization = false;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not to reject bit rate permutations with a cheaper error estimate first.
+		// Most bone chain permutations evaluated during the bit rate search fail to meet the
+		// precision. When enabled, the error of one in every 4 samples is measured first: it is
+		// a lower bound of the exact error and permutations it finds too inaccurate are rejected
+		// without measuring every sample. Permutations that pass are measured exactly, the
+		// precision of the compressed output is always validated with the error metric.
+		// Rejected permutations report a different error which can change which one is retained
+		// when none meet the precision, the output can thus differ slightly.
+		// Only used with 'compression_level8::medium' and higher.
+		// Defaults to 'false'
+		// Transform tracks only.
+		bool enable_proxy_error_rejection = false;
+
+		//////////////////////////////////////////////////////////////////////////
+		// The number of samples per segment for scalar tracks.
+		// When non-zero, scalar track lists with more samples are split into segments
+		// of this many samples (the last one might have fewer). Each segment stores its
+		// own range for every animated track, which lowers the bit rates of long tracks
+		// whose values change range over time at the expense of 2 bytes per component
+		// per segment. Bit rates remain chosen for the whole track.
+		// Must be 0 or at least 2.
+		// Defaults to '0' (no segmenting)
+		// Scalar tracks only.
+		uint32_t num_samples_per_scalar_segment = 0;
+
 		//////////////////////////////////////////////////////////////////////////
 		// Keyframe stripping related settings. See [compression_keyframe_stripping_settings].
 		// Transform tracks only.
@@ -229,6 +481,43 @@ namespace acl
 		// These are optional metadata that can be added to compressed clips.
 		compression_metadata_settings metadata;
 
+		//////////////////////////////////////////////////////////////////////////
+		// An optional job scheduler used to parallelize compression. See [compression_job_scheduler].
+		// It does not impact the compressed output and is not part of the settings hash.
+		compression_job_scheduler job_scheduler;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Optional progress reporting and cancellation. See [compression_progress].
+		// It does not impact the compressed output and is not part of the settings hash.
+		compression_progress progress;
+
+		//////////////////////////////////////////////////////////////////////////
+		// An optional previous compressed version of the same track list used as a
+		// warm start for the bit rate search. When the track layout, formats, and
+		// segmenting match, each segment starts from its previous bit rates instead
+		// of the lowest ones and only transforms that no longer meet their error
+		// threshold are searched again. This considerably speeds up recompression
+		// after small edits at the expense of a possibly larger memory footprint since
+		// bit rates are never lowered. A hint that doesn't match is silently ignored.
+		// The hint must remain valid for the duration of compression.
+		// Defaults to 'null'
+		// Transform tracks only.
+		const compressed_tracks* bit_rate_hint = nullptr;
+
+		//////////////////////////////////////////////////////////////////////////
+		// An optional cache consulted before compressing. See [compression_cache].
+		// It does not impact the compressed output and is not part of the settings hash.
+		// Defaults to 'null'
+		compression_cache* cache = nullptr;
+
+		//////////////////////////////////////////////////////////////////////////
+		// An optional skeleton context that holds the hierarchy data shared by every
+		// clip of a skeleton. See [skeleton_context].
+		// It does not impact the compressed output and is not part of the settings hash.
+		// Defaults to 'null'
+		// Transform tracks only.
+		const skeleton_context* skeleton = nullptr;
+
 		//////////////////////////////////////////////////////////////////////////
 		// Calculates a hash from the internal state to uniquely identify a configuration.
 		uint32_t get_hash() const;
@@ -0,0 +1,195 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/error.h"
+#include "acl/core/error_result.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/compression/compress.h"
+#include "acl/compression/compression_settings.h"
+#include "acl/compression/output_stats.h"
+#include "acl/compression/track_array.h"
+
+#include <atomic>
+#include <thread>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Compresses a track list asynchronously on a dedicated thread.
+	// The task handle can be polled for progress and cancelled at any time, for example
+	// when the track list is edited again before it finishes compressing. Cancellation
+	// is cooperative, see [compression_progress] for where compression checks for it.
+	//
+	// The track list, the allocator, and everything the settings point to (error metric,
+	// cache, bit rate hint) must remain valid until the task completes. The allocator must
+	// be thread safe if it is used by other threads in the meantime. The progress callbacks
+	// of the settings are still called, from the compression thread, and cancelling either
+	// through them or through the task stops compression.
+	//
+	// Destroying a task that is still running cancels it and waits for it to stop.
+	////////////////////////////////////////////////////////////////////////////////
+	class compression_task final
+	{
+	public:
+		compression_task()
+			: m_allocator(nullptr)
+			, m_track_list(nullptr)
+			, m_settings()
+			, m_compressed_tracks(nullptr)
+			, m_result()
+			, m_worker()
+			, m_progress(0.0F)
+			, m_is_cancelled(false)
+			, m_is_done(false)
+		{
+		}
+
+		~compression_task()
+		{
+			cancel();
+			wait();
+
+			if (m_compressed_tracks != nullptr)
+				m_allocator->deallocate(m_compressed_tracks, m_compressed_tracks->get_size());
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Starts compressing the provided track list in the background.
+		// Returns an error if the task has already been started.
+		error_result start(iallocator& allocator, const track_array& track_list, const compression_settings& settings)
+		{
+			if (m_worker.joinable() || m_is_done.load(std::memory_order_acquire))
+				return error_result("Compression task already started");
+
+			m_allocator = &allocator;
+			m_track_list = &track_list;
+			m_settings = settings;
+
+			// Our own callbacks forward to the ones provided in the settings
+			m_settings.progress.should_cancel = &should_cancel;
+			m_settings.progress.report_progress = &report_progress;
+			m_settings.progress.user_data = this;
+			m_user_progress = settings.progress;
+
+			m_worker = std::thread([this]() { execute(); });
+			return error_result();
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Requests compression to stop as soon as possible, it does not wait for it.
+		void cancel() { m_is_cancelled.store(true, std::memory_order_relaxed); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns whether or not the task has been cancelled.
+		bool is_cancelled() const { return m_is_cancelled.load(std::memory_order_relaxed); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns whether or not compression has completed, successfully or not.
+		bool is_done() const { return m_is_done.load(std::memory_order_acquire); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the fraction of the work done, between 0.0 and 1.0.
+		float get_progress() const { return m_progress.load(std::memory_order_relaxed); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Waits for compression to complete and returns its result.
+		// Once complete, the compressed tracks can be retrieved with 'release_compressed_tracks()'.
+		error_result wait()
+		{
+			if (m_worker.joinable())
+				m_worker.join();
+
+			return m_result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Waits for compression to complete and transfers ownership of the compressed tracks
+		// to the caller who must free them with the allocator provided to 'start(..)'.
+		// Returns null if compression failed or was cancelled.
+		compressed_tracks* release_compressed_tracks()
+		{
+			wait();
+
+			compressed_tracks* result = m_compressed_tracks;
+			m_compressed_tracks = nullptr;
+			return result;
+		}
+
+	private:
+		compression_task(const compression_task&) = delete;
+		compression_task& operator=(const compression_task&) = delete;
+
+		static bool should_cancel(void* user_data)
+		{
+			const compression_task& task = *static_cast<const compression_task*>(user_data);
+			return task.is_cancelled() || task.m_user_progress.is_cancelled();
+		}
+
+		static void report_progress(void* user_data, float progress)
+		{
+			compression_task& task = *static_cast<compression_task*>(user_data);
+			task.m_progress.store(progress, std::memory_order_relaxed);
+			task.m_user_progress.report(progress);
+		}
+
+		void execute()
+		{
+			output_stats stats;
+
+			compressed_tracks* out_compressed_tracks = nullptr;
+			const error_result result = compress_track_list(*m_allocator, *m_track_list, m_settings, out_compressed_tracks, stats);
+
+			m_compressed_tracks = result.empty() ? out_compressed_tracks : nullptr;
+			m_result = result;
+			m_is_done.store(true, std::memory_order_release);
+		}
+
+		iallocator* m_allocator;
+		const track_array* m_track_list;
+		compression_settings m_settings;
+		compression_progress m_user_progress;
+
+		compressed_tracks* m_compressed_tracks;
+		error_result m_result;
+
+		std::thread m_worker;
+
+		std::atomic<float> m_progress;
+		std::atomic<bool> m_is_cancelled;
+		std::atomic<bool> m_is_done;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,131 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/compression/compression_settings.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// A small work stealing pool of std::thread workers that implements the
+	// compression job scheduler interface.
+	//
+	// Every worker owns a queue. Submitted jobs are spread over the queues
+	// round robin and a worker that runs out of jobs steals from the others.
+	// The thread waiting for the jobs executes some of them as well.
+	// Jobs must not submit new jobs to the same pool and wait on them.
+	//
+	// Usage:
+	//    compression_thread_pool pool;
+	//    settings.job_scheduler = pool.get_job_scheduler();
+	//
+	// The pool must outlive every compression that uses its scheduler.
+	// Integrations that already have a job system should prefer the adapters
+	// (tbb_job_scheduler.h and enkits_job_scheduler.h) or their own.
+	//////////////////////////////////////////////////////////////////////////
+	class compression_thread_pool
+	{
+	public:
+		using job_function = compression_job_scheduler::job_function;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Creates the requested number of worker threads, zero means one per hardware thread.
+		explicit compression_thread_pool(uint32_t num_threads = 0);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Waits for the pending jobs to complete and joins every worker thread.
+		~compression_thread_pool();
+
+		compression_thread_pool(const compression_thread_pool&) = delete;
+		compression_thread_pool& operator=(const compression_thread_pool&) = delete;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of worker threads.
+		uint32_t get_num_threads() const { return m_num_threads; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Submits a job for execution on any worker thread. Safe to call from any thread.
+		void submit_job(job_function job, void* job_data);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Waits for every submitted job to complete, executing some of them in the meantime.
+		void wait_for_jobs();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns a job scheduler that submits to this pool for use with compression.
+		compression_job_scheduler get_job_scheduler();
+
+	private:
+		struct pending_job
+		{
+			job_function	job;
+			void*			job_data;
+		};
+
+		// Each queue has its own lock to keep contention low when stealing
+		struct worker_queue
+		{
+			std::mutex					lock;
+			std::deque<pending_job>		jobs;
+		};
+
+		void execute_jobs(uint32_t worker_index);
+		bool try_execute_job(uint32_t queue_index);
+
+		std::vector<std::thread>		m_threads;
+		std::unique_ptr<worker_queue[]>	m_queues;
+		uint32_t						m_num_threads;			// Set before the workers start, they read it
+
+		std::mutex						m_lock;				// Only guards sleeping and waking up
+		std::condition_variable			m_job_available;
+		std::condition_variable			m_jobs_done;
+
+		std::atomic<uint32_t>			m_next_queue_index;
+		std::atomic<uint32_t>			m_num_queued_jobs;		// Submitted but not yet started
+		std::atomic<uint32_t>			m_num_unfinished_jobs;	// Submitted but not yet completed
+		bool							m_is_shutting_down;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+#include "acl/compression/impl/compression_thread_pool.impl.h"
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -25,6 +25,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "acl/version.h"
+#include "acl/compression/compression_settings.h"
 #include "acl/compression/track_array.h"
 #include "acl/core/compressed_tracks.h"
 #include "acl/core/error_result.h"
@@ -51,6 +52,14 @@ namespace acl
 	//////////////////////////////////////////////////////////////////////////
 	error_result convert_track_list(iallocator& allocator, const compressed_tracks& tracks, track_array& out_track_list);
 
+	//////////////////////////////////////////////////////////////////////////
+	// Convert a compressed tracks instance into a track array instance.
+	// Samples are decompressed in contiguous ranges that execute concurrently when the job scheduler is set.
+	// Every job writes its samples directly into the output tracks.
+	// This is a lossless process if all the metadata is present.
+	//////////////////////////////////////////////////////////////////////////
+	error_result convert_track_list(iallocator& allocator, const compressed_tracks& tracks, const compression_job_scheduler& job_scheduler, track_array& out_track_list);
+
 	ACL_IMPL_VERSION_NAMESPACE_END
 }
 
@@ -0,0 +1,94 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "acl/version.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/quality_tiers.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Provides the compressed track instances to build a database from, one at a time.
+	// See 'build_database(..)' with a source and a sink.
+	//
+	// Every instance is acquired twice: once to gather its contributing error and once
+	// to write its data. Only a single instance is acquired at any given time and it is
+	// released before the next one is acquired. Instances can thus be loaded from disk
+	// on demand.
+	//////////////////////////////////////////////////////////////////////////
+	class database_build_source
+	{
+	public:
+		virtual ~database_build_source() = default;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of compressed track instances to build the database from.
+		virtual uint32_t get_num_compressed_tracks() const = 0;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the compressed track instance at the provided index, null on failure.
+		// It must contain the contributing error metadata, remain valid until it is released,
+		// and be identical every time it is acquired.
+		virtual const compressed_tracks* acquire(uint32_t list_index) = 0;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Releases a compressed track instance returned by 'acquire(..)'.
+		virtual void release(uint32_t list_index, const compressed_tracks* tracks) = 0;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Receives the output of a database built from a source, as it is written.
+	// See 'build_database(..)' with a source and a sink.
+	//////////////////////////////////////////////////////////////////////////
+	class database_build_sink
+	{
+	public:
+		virtual ~database_build_sink() = default;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Called once per compressed track instance, in order, with the new instance bound to the output database.
+		// The sink takes ownership of it, it was allocated with the allocator provided to 'build_database(..)'.
+		virtual void write_compressed_tracks(uint32_t list_index, compressed_tracks* tracks) = 0;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Called with the next part of the bulk data of a quality tier, parts are provided in order.
+		// Once concatenated, the parts form the bulk data of that tier as returned by 'split_database_bulk_data(..)'.
+		// The data must be copied, it is no longer valid once this function returns.
+		virtual void write_bulk_data(quality_tier tier, const uint8_t* data, uint32_t size) = 0;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
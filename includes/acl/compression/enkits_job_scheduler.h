@@ -0,0 +1,128 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/compression/compression_settings.h"
+
+#include <TaskScheduler.h>
+
+#include <cstdint>
+#include <deque>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Adapts enkiTS to the compression job scheduler interface.
+	// Every job is a task set of size one added to the provided task scheduler.
+	// enkiTS is not a dependency of ACL, include this header only if your project uses it.
+	//
+	// Usage:
+	//    enki::TaskScheduler task_scheduler;
+	//    task_scheduler.Initialize();
+	//
+	//    enkits_job_scheduler scheduler(task_scheduler);
+	//    settings.job_scheduler = scheduler.get_job_scheduler();
+	//
+	// Jobs must be submitted and waited on from a single thread at a time.
+	// The adapter must outlive every compression that uses its scheduler.
+	//////////////////////////////////////////////////////////////////////////
+	class enkits_job_scheduler
+	{
+	public:
+		explicit enkits_job_scheduler(enki::TaskScheduler& task_scheduler)
+			: m_task_scheduler(task_scheduler)
+			, m_tasks()
+			, m_num_pending_tasks(0)
+		{
+		}
+
+		~enkits_job_scheduler() { wait_for_jobs(); }
+
+		enkits_job_scheduler(const enkits_job_scheduler&) = delete;
+		enkits_job_scheduler& operator=(const enkits_job_scheduler&) = delete;
+
+		void submit_job(compression_job_scheduler::job_function job, void* job_data)
+		{
+			// Tasks are reused once complete, a deque keeps their address stable as it grows
+			if (m_num_pending_tasks == m_tasks.size())
+				m_tasks.emplace_back();
+
+			job_task& task = m_tasks[m_num_pending_tasks++];
+			task.job = job;
+			task.job_data = job_data;
+
+			m_task_scheduler.AddTaskSetToPipe(&task);
+		}
+
+		void wait_for_jobs()
+		{
+			// The calling thread executes tasks while it waits
+			for (size_t task_index = 0; task_index < m_num_pending_tasks; ++task_index)
+				m_task_scheduler.WaitforTask(&m_tasks[task_index]);
+
+			m_num_pending_tasks = 0;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns a job scheduler that submits to enkiTS for use with compression.
+		compression_job_scheduler get_job_scheduler()
+		{
+			compression_job_scheduler job_scheduler;
+			job_scheduler.submit_job = [](void* user_data, compression_job_scheduler::job_function job, void* job_data) { static_cast<enkits_job_scheduler*>(user_data)->submit_job(job, job_data); };
+			job_scheduler.wait_for_jobs = [](void* user_data) { static_cast<enkits_job_scheduler*>(user_data)->wait_for_jobs(); };
+			job_scheduler.user_data = this;
+			job_scheduler.max_num_jobs = m_task_scheduler.GetNumTaskThreads();
+			return job_scheduler;
+		}
+
+	private:
+		struct job_task final : public enki::ITaskSet
+		{
+			compression_job_scheduler::job_function job = nullptr;
+			void* job_data = nullptr;
+
+			virtual void ExecuteRange(enki::TaskSetPartition range, uint32_t thread_index) override
+			{
+				(void)range;
+				(void)thread_index;
+				job(job_data);
+			}
+		};
+
+		enki::TaskScheduler&	m_task_scheduler;
+		std::deque<job_task>	m_tasks;
+		size_t					m_num_pending_tasks;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
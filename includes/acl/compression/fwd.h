@@ -42,11 +42,15 @@ namespace acl
 {
     ACL_IMPL_VERSION_NAMESPACE_BEGIN
 
+    class compression_cache;
     enum class compression_level8 : uint8_t;
 
     struct compression_database_settings;
+    struct compression_memory_stats;
     struct compression_metadata_settings;
+    struct compression_progress;
     struct compression_settings;
+    class compression_task;
 
     enum class stat_logging;
     struct output_stats;
@@ -0,0 +1,146 @@
+// Included only once from additive_base_context.h
+
+#include "acl/version.h"
+#include "acl/core/additive_utils.h"
+#include "acl/core/error_result.h"
+#include "acl/core/iallocator.h"
+#include "acl/compression/compression_settings.h"
+#include "acl/compression/track_array.h"
+#include "acl/compression/transform_error_metrics.h"
+#include "acl/compression/impl/clip_context.h"
+#include "acl/compression/impl/sample_streams.h"
+
+#include <rtm/qvvf.h>
+#include <rtm/scalarf.h>
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	inline additive_base_context::additive_base_context()
+		: m_allocator(nullptr)
+		, m_track_list(nullptr)
+		, m_error_metric(nullptr)
+		, m_additive_format(additive_clip_format8::none)
+		, m_converted_base_transforms{ nullptr, nullptr }
+		, m_converted_base_transforms_size{ 0, 0 }
+		, m_clip_context()
+	{
+	}
+
+	inline additive_base_context::~additive_base_context()
+	{
+		reset();
+	}
+
+	inline error_result additive_base_context::initialize(iallocator& allocator, const track_array_qvvf& base_track_list, const compression_settings& settings, additive_clip_format8 additive_format)
+	{
+		reset();
+
+		error_result result = base_track_list.is_valid();
+		if (result.any())
+			return result;
+
+		if (base_track_list.is_empty())
+			return error_result("Additive base has no transforms");
+
+		if (additive_format == additive_clip_format8::none)
+			return error_result("An additive format is required");
+
+		if (settings.error_metric == nullptr)
+			return error_result("An error metric is required");
+
+		if (!acl_impl::initialize_clip_context(allocator, base_track_list, settings, additive_format, m_clip_context, true))
+		{
+			acl_impl::destroy_clip_context(m_clip_context);
+			m_clip_context = acl_impl::clip_context();
+			return error_result("Some base samples are not finite");
+		}
+
+		m_allocator = &allocator;
+		m_track_list = &base_track_list;
+		m_error_metric = settings.error_metric;
+		m_additive_format = additive_format;
+
+		const uint32_t num_transforms = m_clip_context.num_bones;
+		const uint32_t num_samples = m_clip_context.num_samples;
+		const acl_impl::transform_streams* base_bone_streams = m_clip_context.segments[0].bone_streams;
+
+		rtm::qvvf* base_local_pose = allocate_type_array<rtm::qvvf>(allocator, num_transforms);
+		uint32_t* self_transform_indices = allocate_type_array<uint32_t>(allocator, num_transforms);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+			self_transform_indices[transform_index] = transform_index;
+
+		itransform_error_metric::convert_transforms_args convert_transforms_args_base;
+		convert_transforms_args_base.dirty_transform_indices = self_transform_indices;
+		convert_transforms_args_base.num_dirty_transforms = num_transforms;
+		convert_transforms_args_base.transforms = base_local_pose;
+		convert_transforms_args_base.num_transforms = num_transforms;
+		convert_transforms_args_base.sample_index = 0;
+		convert_transforms_args_base.is_lossy = false;
+		convert_transforms_args_base.is_additive_base = true;
+
+		// Whether the lossy clip has scale is only known once its constant sub-tracks are compacted, we convert for both
+		for (uint32_t scale_index = 0; scale_index < 2; ++scale_index)
+		{
+			const bool has_scale = scale_index != 0;
+			const bool needs_conversion = m_error_metric->needs_conversion(has_scale);
+			const size_t sample_transform_size = m_error_metric->get_transform_size(has_scale) * num_transforms;
+			const auto convert_transforms_impl = std::mem_fn(has_scale ? &itransform_error_metric::convert_transforms : &itransform_error_metric::convert_transforms_no_scale);
+
+			m_converted_base_transforms_size[scale_index] = sample_transform_size * num_samples;
+			m_converted_base_transforms[scale_index] = allocate_type_array_aligned<uint8_t>(allocator, m_converted_base_transforms_size[scale_index], 64);
+
+			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			{
+				const float sample_time = rtm::scalar_min(float(sample_index) / m_clip_context.sample_rate, m_clip_context.duration);
+				acl_impl::sample_streams(base_bone_streams, num_transforms, sample_time, base_local_pose);
+
+				uint8_t* sample_base_local_transforms = m_converted_base_transforms[scale_index] + (sample_index * sample_transform_size);
+
+				if (needs_conversion)
+				{
+					convert_transforms_args_base.sample_index = sample_index;
+					convert_transforms_impl(m_error_metric, convert_transforms_args_base, sample_base_local_transforms);
+				}
+				else
+					std::memcpy(sample_base_local_transforms, base_local_pose, sample_transform_size);
+			}
+
+			m_clip_context.converted_base_transforms[scale_index] = m_converted_base_transforms[scale_index];
+		}
+
+		deallocate_type_array(allocator, self_transform_indices, num_transforms);
+		deallocate_type_array(allocator, base_local_pose, num_transforms);
+
+		return error_result();
+	}
+
+	inline void additive_base_context::reset()
+	{
+		if (m_allocator == nullptr)
+			return;	// Not initialized
+
+		for (uint32_t scale_index = 0; scale_index < 2; ++scale_index)
+			deallocate_type_array(*m_allocator, m_converted_base_transforms[scale_index], m_converted_base_transforms_size[scale_index]);
+
+		acl_impl::destroy_clip_context(m_clip_context);
+
+		m_allocator = nullptr;
+		m_track_list = nullptr;
+		m_error_metric = nullptr;
+		m_additive_format = additive_clip_format8::none;
+		m_converted_base_transforms[0] = nullptr;
+		m_converted_base_transforms[1] = nullptr;
+		m_converted_base_transforms_size[0] = 0;
+		m_converted_base_transforms_size[1] = 0;
+		m_clip_context = acl_impl::clip_context();
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
@@ -0,0 +1,226 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/error.h"
+#include "acl/core/hash.h"
+#include "acl/core/impl/variable_bit_rates.h"
+#include "acl/compression/impl/clip_context.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// This class memoizes the object space error of a transform for a set of bit rates.
+		// The object space error of a transform only depends on its own bit rates and those of
+		// its parents. While searching for the optimal bit rates, the same permutations are
+		// evaluated over and over and this allows us to skip the error scans when nothing
+		// changed along the transform chain.
+		// Entries are direct mapped, a colliding entry replaces the previous one.
+		// The cache must be reset whenever the segment changes.
+		//////////////////////////////////////////////////////////////////////////
+		class bit_rate_error_cache
+		{
+		public:
+			bit_rate_error_cache(iallocator& allocator, const clip_context& clip);
+			~bit_rate_error_cache();
+
+			//////////////////////////////////////////////////////////////////////////
+			// Invalidates every cached entry.
+			void reset();
+
+			//////////////////////////////////////////////////////////////////////////
+			// Looks up the error for the specified transform with the provided bit rates.
+			// The scan mode identifies how the error was measured (e.g. until the error is too high).
+			// Returns true and the cached error if found. If it isn't found, the key is retained
+			// and the error can be inserted once it has been measured.
+			bool find(uint32_t transform_index, uint32_t scan_mode, const transform_bit_rates* bit_rates, float& out_error);
+
+			//////////////////////////////////////////////////////////////////////////
+			// Inserts the error measured for the last key that wasn't found.
+			void insert(float error);
+
+			size_t get_allocated_size() const;
+
+		private:
+			bit_rate_error_cache(const bit_rate_error_cache&) = delete;
+			bit_rate_error_cache& operator=(const bit_rate_error_cache&) = delete;
+
+			// Must be a power of two
+			static constexpr uint32_t k_num_entries = 4096;
+
+			struct cache_entry
+			{
+				uint32_t	generation_id;
+				uint32_t	transform_index;
+				uint32_t	scan_mode;
+				float		error;
+			};
+
+			iallocator&				m_allocator;
+			const transform_metadata* m_metadata;
+
+			cache_entry*			m_entries;			// k_num_entries
+			transform_bit_rates*	m_entry_keys;		// m_max_chain_length per entry
+
+			transform_bit_rates*	m_key;				// m_max_chain_length, the key of the last lookup
+			uint32_t				m_key_length;
+			uint32_t				m_key_entry_index;
+			uint32_t				m_key_transform_index;
+			uint32_t				m_key_scan_mode;
+
+			uint32_t				m_max_chain_length;
+			uint32_t				m_generation_id;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Implementation
+
+		inline bit_rate_error_cache::bit_rate_error_cache(iallocator& allocator, const clip_context& clip)
+			: m_allocator(allocator)
+			, m_metadata(clip.metadata)
+			, m_key_length(0)
+			, m_key_entry_index(0)
+			, m_key_transform_index(k_invalid_track_index)
+			, m_key_scan_mode(0)
+			, m_generation_id(1)
+		{
+			// Our keys contain the bit rates of every transform from the root, find the longest chain
+			uint32_t max_chain_length = 1;
+			for (uint32_t transform_index = 0; transform_index < clip.num_bones; ++transform_index)
+			{
+				uint32_t chain_length = 0;
+				for (uint32_t chain_transform_index = transform_index; chain_transform_index != k_invalid_track_index; chain_transform_index = clip.metadata[chain_transform_index].parent_index)
+					chain_length++;
+
+				max_chain_length = std::max<uint32_t>(max_chain_length, chain_length);
+			}
+
+			m_max_chain_length = max_chain_length;
+
+			m_entries = allocate_type_array<cache_entry>(allocator, k_num_entries);
+			m_entry_keys = allocate_type_array<transform_bit_rates>(allocator, size_t(k_num_entries) * max_chain_length);
+			m_key = allocate_type_array<transform_bit_rates>(allocator, max_chain_length);
+
+			// Generation 0 is never used, every entry starts invalid
+			std::memset(m_entries, 0, sizeof(cache_entry) * k_num_entries);
+		}
+
+		inline bit_rate_error_cache::~bit_rate_error_cache()
+		{
+			deallocate_type_array(m_allocator, m_entries, k_num_entries);
+			deallocate_type_array(m_allocator, m_entry_keys, size_t(k_num_entries) * m_max_chain_length);
+			deallocate_type_array(m_allocator, m_key, m_max_chain_length);
+		}
+
+		inline void bit_rate_error_cache::reset()
+		{
+			m_generation_id++;
+			if (m_generation_id == 0)
+			{
+				// Our generation wrapped around, clear everything
+				std::memset(m_entries, 0, sizeof(cache_entry) * k_num_entries);
+				m_generation_id = 1;
+			}
+
+			m_key_transform_index = k_invalid_track_index;
+		}
+
+		inline bool bit_rate_error_cache::find(uint32_t transform_index, uint32_t scan_mode, const transform_bit_rates* bit_rates, float& out_error)
+		{
+			// Build our key from the transform up to its root
+			uint32_t key_length = 0;
+			for (uint32_t chain_transform_index = transform_index; chain_transform_index != k_invalid_track_index; chain_transform_index = m_metadata[chain_transform_index].parent_index)
+				m_key[key_length++] = bit_rates[chain_transform_index];
+
+			const size_t key_size = sizeof(transform_bit_rates) * key_length;
+
+			fnv1a_32 hashfn = fnv1a_32();
+			hashfn.update(&transform_index, sizeof(transform_index));
+			hashfn.update(&scan_mode, sizeof(scan_mode));
+			hashfn.update(m_key, key_size);
+
+			const uint32_t entry_index = hashfn.digest() & (k_num_entries - 1);
+
+			m_key_length = key_length;
+			m_key_entry_index = entry_index;
+			m_key_transform_index = transform_index;
+			m_key_scan_mode = scan_mode;
+
+			const cache_entry& entry = m_entries[entry_index];
+			if (entry.generation_id != m_generation_id || entry.transform_index != transform_index || entry.scan_mode != scan_mode)
+				return false;	// Empty, stale, or another transform
+
+			// The transform index determines the key length, compare the bit rates
+			const transform_bit_rates* entry_key = m_entry_keys + (size_t(entry_index) * m_max_chain_length);
+			if (std::memcmp(entry_key, m_key, key_size) != 0)
+				return false;	// Collision
+
+			out_error = entry.error;
+			return true;
+		}
+
+		inline void bit_rate_error_cache::insert(float error)
+		{
+			ACL_ASSERT(m_key_transform_index != k_invalid_track_index, "No key to insert");
+
+			cache_entry& entry = m_entries[m_key_entry_index];
+			entry.generation_id = m_generation_id;
+			entry.transform_index = m_key_transform_index;
+			entry.scan_mode = m_key_scan_mode;
+			entry.error = error;
+
+			transform_bit_rates* entry_key = m_entry_keys + (size_t(m_key_entry_index) * m_max_chain_length);
+			std::memcpy(entry_key, m_key, sizeof(transform_bit_rates) * m_key_length);
+
+			m_key_transform_index = k_invalid_track_index;
+		}
+
+		inline size_t bit_rate_error_cache::get_allocated_size() const
+		{
+			size_t cache_size = 0;
+			cache_size += sizeof(cache_entry) * k_num_entries;
+			cache_size += sizeof(transform_bit_rates) * k_num_entries * m_max_chain_length;
+			cache_size += sizeof(transform_bit_rates) * m_max_chain_length;
+			return cache_size;
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,255 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/algorithm_types.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/compressed_tracks_version.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/track_formats.h"
+#include "acl/core/track_types.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/impl/compressed_headers.h"
+#include "acl/core/impl/variable_bit_rates.h"
+#include "acl/compression/compression_settings.h"
+#include "acl/compression/impl/animated_track_utils.h"
+#include "acl/compression/impl/clip_context.h"
+#include "acl/compression/impl/segment_context.h"
+#include "acl/compression/impl/write_stream_data.h"
+
+#include <algorithm>
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Holds a previous compressed version of a clip used to warm start the
+		// bit rate search of each segment.
+		// The bit rates are read back from the per sub-track format metadata of
+		// each segment. See write_format_per_track_data(..) for details.
+		//////////////////////////////////////////////////////////////////////////
+		class bit_rate_hint
+		{
+		public:
+			bit_rate_hint(iallocator& allocator, const clip_context& clip, const compression_settings& settings)
+				: m_allocator(allocator)
+				, m_tracks(nullptr)
+				, m_output_bone_mapping(nullptr)
+				, m_num_bones(clip.num_bones)
+				, m_num_output_bones(0)
+				, m_is_rotation_variable(is_rotation_format_variable(settings.rotation_format))
+				, m_is_translation_variable(is_vector_format_variable(settings.translation_format))
+				, m_is_scale_variable(clip.has_scale && is_vector_format_variable(settings.scale_format))
+			{
+				if (settings.bit_rate_hint == nullptr || clip.num_bones == 0)
+					return;
+
+				// Our output mapping determines in which order the sub-tracks have been written
+				m_output_bone_mapping = allocate_type_array<uint32_t>(allocator, m_num_bones);
+
+				const segment_context& segment = clip.segments[0];
+				for (uint32_t bone_index = 0; bone_index < m_num_bones; ++bone_index)
+				{
+					const uint32_t output_index = segment.bone_streams[bone_index].output_index;
+					if (output_index == k_invalid_track_index)
+						continue;	// Stripped
+
+					m_output_bone_mapping[output_index] = bone_index;
+					m_num_output_bones++;
+				}
+
+				if (is_compatible(clip, settings, *settings.bit_rate_hint))
+					m_tracks = settings.bit_rate_hint;
+			}
+
+			~bit_rate_hint()
+			{
+				deallocate_type_array(m_allocator, m_output_bone_mapping, m_num_bones);
+			}
+
+			bit_rate_hint(const bit_rate_hint&) = delete;
+			bit_rate_hint& operator=(const bit_rate_hint&) = delete;
+
+			//////////////////////////////////////////////////////////////////////////
+			// Returns whether or not we have a usable hint.
+			bool is_enabled() const { return m_tracks != nullptr; }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Overwrites the variable bit rates of the provided segment with the ones from our hint.
+			// The bit rates must have been initialized first, constant and non-variable sub-tracks are left untouched.
+			void apply(const segment_context& segment, transform_bit_rates* bit_rate_per_bone) const
+			{
+				ACL_ASSERT(is_enabled(), "No bit rate hint to apply");
+
+				const transform_tracks_header& transforms_header = get_transform_tracks_header(*m_tracks);
+				const bool has_stripped_keyframes = get_tracks_header(*m_tracks).get_has_stripped_keyframes();
+
+				const uint8_t* format_per_track_data;
+				const uint8_t* range_data;
+				const uint8_t* animated_data;
+				if (has_stripped_keyframes)
+					transforms_header.get_segment_data(transforms_header.get_stripped_segment_headers()[segment.segment_index], format_per_track_data, range_data, animated_data);
+				else
+					transforms_header.get_segment_data(transforms_header.get_segment_headers()[segment.segment_index], format_per_track_data, range_data, animated_data);
+
+				uint32_t num_rotations = 0;
+
+				// Rotations come first, followed by translations and scales
+				if (m_is_rotation_variable)
+				{
+					for (uint32_t output_index = 0; output_index < m_num_output_bones; ++output_index)
+					{
+						const uint32_t bone_index = m_output_bone_mapping[output_index];
+						if (segment.bone_streams[bone_index].is_rotation_constant)
+							continue;
+
+						transform_bit_rates& bone_bit_rate = bit_rate_per_bone[bone_index];
+						bone_bit_rate.rotation = get_hint_bit_rate(*format_per_track_data++, bone_bit_rate.rotation);
+						num_rotations++;
+					}
+
+					// Rotations are padded to full groups of 4
+					const uint32_t num_partial_rotations = num_rotations % 4;
+					if (num_partial_rotations != 0)
+						format_per_track_data += 4 - num_partial_rotations;
+				}
+
+				if (m_is_translation_variable)
+				{
+					for (uint32_t output_index = 0; output_index < m_num_output_bones; ++output_index)
+					{
+						const uint32_t bone_index = m_output_bone_mapping[output_index];
+						if (segment.bone_streams[bone_index].is_translation_constant)
+							continue;
+
+						transform_bit_rates& bone_bit_rate = bit_rate_per_bone[bone_index];
+						bone_bit_rate.translation = get_hint_bit_rate(*format_per_track_data++, bone_bit_rate.translation);
+					}
+				}
+
+				if (m_is_scale_variable)
+				{
+					for (uint32_t output_index = 0; output_index < m_num_output_bones; ++output_index)
+					{
+						const uint32_t bone_index = m_output_bone_mapping[output_index];
+						if (segment.bone_streams[bone_index].is_scale_constant)
+							continue;
+
+						transform_bit_rates& bone_bit_rate = bit_rate_per_bone[bone_index];
+						bone_bit_rate.scale = get_hint_bit_rate(*format_per_track_data++, bone_bit_rate.scale);
+					}
+				}
+			}
+
+		private:
+			// The hint is only usable if it was compressed with the same layout
+			bool is_compatible(const clip_context& clip, const compression_settings& settings, const compressed_tracks& tracks) const
+			{
+				if (tracks.get_algorithm_type() != algorithm_type8::uniformly_sampled || tracks.get_track_type() != track_type8::qvvf)
+					return false;
+
+				if (tracks.get_version() < compressed_tracks_version16::v02_01_99_1 || tracks.get_version() > compressed_tracks_version16::latest)
+					return false;	// The metadata layout might differ, later versions only changed the buffer hash
+
+				const tracks_header& header = get_tracks_header(tracks);
+				if (header.num_tracks != m_num_output_bones || header.num_samples != clip.num_samples)
+					return false;
+
+				if (header.get_has_scale() != clip.has_scale)
+					return false;
+
+				if (header.get_rotation_format() != settings.rotation_format || header.get_translation_format() != settings.translation_format)
+					return false;
+
+				if (clip.has_scale && header.get_scale_format() != settings.scale_format)
+					return false;
+
+				const transform_tracks_header& transforms_header = get_transform_tracks_header(tracks);
+				if (transforms_header.num_segments != clip.num_segments)
+					return false;
+
+				if (transforms_header.has_multiple_segments())
+				{
+					const uint32_t* segment_start_indices = transforms_header.get_segment_start_indices();
+					for (const segment_context& segment : clip.segment_iterator())
+					{
+						if (segment_start_indices[segment.segment_index] != segment.clip_sample_offset)
+							return false;
+					}
+				}
+
+				// Every segment shares the same animated sub-tracks
+				uint32_t num_animated_rotation_sub_tracks;
+				uint32_t num_animated_translation_sub_tracks;
+				uint32_t num_animated_scale_sub_tracks;
+				get_num_animated_sub_tracks(clip.segments[0], num_animated_rotation_sub_tracks, num_animated_translation_sub_tracks, num_animated_scale_sub_tracks);
+
+				if (transforms_header.num_animated_rotation_sub_tracks != num_animated_rotation_sub_tracks
+					|| transforms_header.num_animated_translation_sub_tracks != num_animated_translation_sub_tracks
+					|| transforms_header.num_animated_scale_sub_tracks != num_animated_scale_sub_tracks)
+					return false;
+
+				uint32_t num_animated_variable_sub_tracks_padded = 0;
+				get_format_per_track_data_size(clip, settings.rotation_format, settings.translation_format, settings.scale_format, &num_animated_variable_sub_tracks_padded);
+				return transforms_header.num_animated_variable_sub_tracks == num_animated_variable_sub_tracks_padded;
+			}
+
+			// Converts the number of bits stored in the metadata back into a bit rate
+			// The initial bit rate tells us if constant bit rates are supported
+			static uint8_t get_hint_bit_rate(uint8_t metadata, uint8_t initial_bit_rate)
+			{
+				if (initial_bit_rate == k_invalid_bit_rate)
+					return initial_bit_rate;	// Shouldn't happen with a compatible hint but be safe
+
+				// Rotations might store their dropped component in the upper bits, ignore it
+				const uint8_t num_bits = metadata & k_num_bits_metadata_mask;
+
+				// The highest bit rate is stored as 31, see write_format_per_track_data(..)
+				const uint8_t bit_rate = num_bits >= 31 ? k_highest_bit_rate : std::min<uint8_t>(num_bits, k_highest_bit_rate - 1);
+				return std::max<uint8_t>(bit_rate, initial_bit_rate);
+			}
+
+			iallocator&					m_allocator;
+			const compressed_tracks*	m_tracks;
+			uint32_t*					m_output_bone_mapping;	// 1 per transform, only the first num output bones are used
+			uint32_t					m_num_bones;
+			uint32_t					m_num_output_bones;
+			bool						m_is_rotation_variable;
+			bool						m_is_translation_variable;
+			bool						m_is_scale_variable;
+		};
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
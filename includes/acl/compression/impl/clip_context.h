@@ -34,12 +34,15 @@
 #include "acl/core/track_formats.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/compression/compression_settings.h"
+#include "acl/compression/skeleton_context.h"
 #include "acl/compression/track_array.h"
 #include "acl/compression/impl/segment_context.h"
+#include "acl/compression/impl/transform_hierarchy.h"
 
 #include <rtm/quatf.h>
 #include <rtm/vector4f.h>
 
+#include <cstddef>
 #include <cstdint>
 
 ACL_IMPL_FILE_PRAGMA_PUSH
@@ -130,7 +133,7 @@ namespace acl
 		// Metadata per transform
 		struct transform_metadata
 		{
-			// The transform chain this transform belongs to (points into leaf_transform_chains in owner context)
+			// The transform chain this transform belongs to (points into the leaf transform chains of the owner context hierarchy)
 			const uint32_t* transform_chain				= nullptr;
 
 			// Parent transform index of this transform, invalid if at the root
@@ -141,6 +144,9 @@ namespace acl
 
 			// The local space shell distance from the track description for this transform
 			float shell_distance						= 0.0F;
+
+			// The importance from the track description, scales the contributing error of this transform
+			float importance							= 1.0F;
 		};
 
 		// Rigid shell information per transform
@@ -170,19 +176,24 @@ namespace acl
 			// TODO: Same for raw/lossy/additive clip context, can we share?
 			transform_metadata* metadata				= nullptr;
 
-			// List of bit sets for each leaf transform to track transform chains (num_leaf_transforms present)
-			// TODO: Same for raw/lossy/additive clip context, can we share?
-			uint32_t* leaf_transform_chains				= nullptr;
+			// The transform hierarchy, either owned below or shared from the skeleton context provided with the settings
+			const transform_hierarchy* hierarchy		= nullptr;
+			transform_hierarchy owned_hierarchy;
 
 			// List of transform indices sorted by parent first then sibling transforms are sorted by their transform index (num_bones present)
-			// TODO: Same for raw/lossy/additive clip context, can we share?
-			uint32_t* sorted_transforms_parent_first	= nullptr;
+			// Points into the hierarchy
+			const uint32_t* sorted_transforms_parent_first	= nullptr;
 
 			// List of shell metadata for each transform (num_bones present)
 			// Data is aggregate of whole clip
 			// Shared between all clip contexts, not owned
 			const rigid_shell_metadata_t* clip_shell_metadata	= nullptr;
 
+			// Only set on a prepared additive base, see additive_base_context
+			// Local transforms of every sample already converted by the error metric, indexed by whether the lossy clip has scale
+			// Not owned
+			const uint8_t* converted_base_transforms[2]			= { nullptr, nullptr };
+
 			uint32_t num_segments						= 0;
 			uint32_t num_bones							= 0;	// TODO: Rename num_transforms
 			uint32_t num_samples_allocated				= 0;
@@ -200,8 +211,8 @@ namespace acl
 			bool has_scale								= false;
 			bool has_additive_base						= false;
 			bool has_stripped_keyframes					= false;
-
-			uint32_t num_leaf_transforms				= 0;
+			bool has_quantized_constant_rotations		= false;
+			bool has_quantized_rotation_clip_ranges		= false;
 
 			iallocator* allocator						= nullptr;	// Never null if the context is initialized
 
@@ -223,7 +234,10 @@ namespace acl
 			}
 		};
 
-		inline bool initialize_clip_context(iallocator& allocator, const track_array_qvvf& track_list, const compression_settings& settings, additive_clip_format8 additive_format, clip_context& out_clip_context)
+		// When samples can be referenced, the streams of every transform whose samples are retained as is read them
+		// in place from the track list instead of copying them. The track list must then outlive the clip context.
+		// Referenced streams are copied the first time they are written to, only read only clip contexts benefit from this.
+		inline bool initialize_clip_context(iallocator& allocator, const track_array_qvvf& track_list, const compression_settings& settings, additive_clip_format8 additive_format, clip_context& out_clip_context, bool can_reference_samples = false)
 		{
 			const uint32_t num_transforms = track_list.get_num_tracks();
 			const uint32_t num_samples = track_list.get_num_samples_per_track();
@@ -234,8 +248,8 @@ namespace acl
 			out_clip_context.segments = allocate_type_array<segment_context>(allocator, 1);
 			out_clip_context.ranges = nullptr;
 			out_clip_context.metadata = allocate_type_array<transform_metadata>(allocator, num_transforms);
-			out_clip_context.leaf_transform_chains = nullptr;
-			out_clip_context.sorted_transforms_parent_first = allocate_type_array<uint32_t>(allocator, num_transforms);
+			out_clip_context.hierarchy = nullptr;
+			out_clip_context.sorted_transforms_parent_first = nullptr;
 			out_clip_context.clip_shell_metadata = nullptr;
 			out_clip_context.num_segments = 1;
 			out_clip_context.num_bones = num_transforms;
@@ -249,7 +263,6 @@ namespace acl
 			out_clip_context.are_translations_normalized = false;
 			out_clip_context.are_scales_normalized = false;
 			out_clip_context.has_additive_base = additive_format != additive_clip_format8::none;
-			out_clip_context.num_leaf_transforms = 0;
 			out_clip_context.allocator = &allocator;
 
 			bool are_samples_valid = true;
@@ -271,10 +284,6 @@ namespace acl
 				bone_stream.output_index = desc.output_index;
 				bone_stream.default_value = desc.default_value;
 
-				bone_stream.rotations = rotation_track_stream(allocator, num_samples, sizeof(rtm::quatf), sample_rate, rotation_format8::quatf_full);
-				bone_stream.translations = translation_track_stream(allocator, num_samples, sizeof(rtm::vector4f), sample_rate, vector_format8::vector3f_full);
-				bone_stream.scales = scale_track_stream(allocator, num_samples, sizeof(rtm::vector4f), sample_rate, vector_format8::vector3f_full);
-
 				// Constant and default detection is handled during sub-track compacting
 				bone_stream.is_rotation_constant = false;
 				bone_stream.is_rotation_default = false;
@@ -282,26 +291,68 @@ namespace acl
 				bone_stream.is_translation_default = false;
 				bone_stream.is_scale_constant = false;
 				bone_stream.is_scale_default = false;
+				bone_stream.is_rotation_quantized = false;
 
-				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+				// We can only reference our samples if they remain unchanged and suitably aligned
+				const uint32_t sample_stride = track.get_stride();
+				bool reference_samples = can_reference_samples && num_samples != 0 && (sample_stride % 16) == 0;
+				if (reference_samples)
+				{
+					for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+					{
+						const rtm::qvvf& transform = track[sample_index];
+
+						rtm::quatf rotation;
+						if (settings.rotation_format != rotation_format8::quatf_full || !rtm::quat_is_normalized(transform.rotation))
+							rotation = rtm::quat_normalize(transform.rotation);
+						else
+							rotation = transform.rotation;
+
+						if (!rtm::vector_all_equal(rtm::quat_to_vector(rotation), rtm::quat_to_vector(transform.rotation)))
+						{
+							reference_samples = false;	// Normalizing changed our rotation, we need a copy
+							break;
+						}
+
+						are_samples_valid &= rtm::quat_is_finite(rotation);
+						are_samples_valid &= rtm::vector_is_finite3(transform.translation);
+						are_samples_valid &= rtm::vector_is_finite3(transform.scale);
+					}
+				}
+
+				if (reference_samples)
 				{
-					const rtm::qvvf& transform = track[sample_index];
-
-					// If we request raw data and we are already normalized, retain the original value
-					// otherwise we normalize for safety
-					rtm::quatf rotation;
-					if (settings.rotation_format != rotation_format8::quatf_full || !rtm::quat_is_normalized(transform.rotation))
-						rotation = rtm::quat_normalize(transform.rotation);
-					else
-						rotation = transform.rotation;
-
-					are_samples_valid &= rtm::quat_is_finite(rotation);
-					are_samples_valid &= rtm::vector_is_finite3(transform.translation);
-					are_samples_valid &= rtm::vector_is_finite3(transform.scale);
-
-					bone_stream.rotations.set_raw_sample(sample_index, rotation);
-					bone_stream.translations.set_raw_sample(sample_index, transform.translation);
-					bone_stream.scales.set_raw_sample(sample_index, transform.scale);
+					const uint8_t* samples = reinterpret_cast<const uint8_t*>(&track[0]);
+					bone_stream.rotations = rotation_track_stream(allocator, samples + offsetof(rtm::qvvf, rotation), num_samples, sizeof(rtm::quatf), sample_stride, sample_rate, rotation_format8::quatf_full);
+					bone_stream.translations = translation_track_stream(allocator, samples + offsetof(rtm::qvvf, translation), num_samples, sizeof(rtm::vector4f), sample_stride, sample_rate, vector_format8::vector3f_full);
+					bone_stream.scales = scale_track_stream(allocator, samples + offsetof(rtm::qvvf, scale), num_samples, sizeof(rtm::vector4f), sample_stride, sample_rate, vector_format8::vector3f_full);
+				}
+				else
+				{
+					bone_stream.rotations = rotation_track_stream(allocator, num_samples, sizeof(rtm::quatf), sample_rate, rotation_format8::quatf_full);
+					bone_stream.translations = translation_track_stream(allocator, num_samples, sizeof(rtm::vector4f), sample_rate, vector_format8::vector3f_full);
+					bone_stream.scales = scale_track_stream(allocator, num_samples, sizeof(rtm::vector4f), sample_rate, vector_format8::vector3f_full);
+
+					for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+					{
+						const rtm::qvvf& transform = track[sample_index];
+
+						// If we request raw data and we are already normalized, retain the original value
+						// otherwise we normalize for safety
+						rtm::quatf rotation;
+						if (settings.rotation_format != rotation_format8::quatf_full || !rtm::quat_is_normalized(transform.rotation))
+							rotation = rtm::quat_normalize(transform.rotation);
+						else
+							rotation = transform.rotation;
+
+						are_samples_valid &= rtm::quat_is_finite(rotation);
+						are_samples_valid &= rtm::vector_is_finite3(transform.translation);
+						are_samples_valid &= rtm::vector_is_finite3(transform.scale);
+
+						bone_stream.rotations.set_raw_sample(sample_index, rotation);
+						bone_stream.translations.set_raw_sample(sample_index, transform.translation);
+						bone_stream.scales.set_raw_sample(sample_index, transform.scale);
+					}
 				}
 
 				transform_metadata& metadata = out_clip_context.metadata[transform_index];
@@ -309,8 +360,7 @@ namespace acl
 				metadata.parent_index = desc.parent_index;
 				metadata.precision = desc.precision;
 				metadata.shell_distance = desc.shell_distance;
-
-				out_clip_context.sorted_transforms_parent_first[transform_index] = transform_index;
+				metadata.importance = desc.importance;
 			}
 
 			out_clip_context.has_scale = true;	// Scale detection is handled during sub-track compacting
@@ -338,96 +388,111 @@ namespace acl
 			segment.range_data_size = 0;
 			segment.total_header_size = 0;
 
-			// Initialize our hierarchy information
-			if (num_transforms != 0)
+			// Initialize our hierarchy information, clips that share a skeleton share it
+			if (settings.skeleton != nullptr && settings.skeleton->is_compatible(track_list))
+				out_clip_context.hierarchy = &settings.skeleton->get_hierarchy();
+			else
 			{
-				// Calculate which bones are leaf bones that have no children
-				bitset_description bone_bitset_desc = bitset_description::make_from_num_bits(num_transforms);
-				const size_t bitset_size = bone_bitset_desc.get_size();
-				uint32_t* is_leaf_bitset = allocate_type_array<uint32_t>(allocator, bitset_size);
-				bitset_reset(is_leaf_bitset, bone_bitset_desc, false);
-
-				// By default  and if we find a child, we'll mark it as non-leaf
-				bitset_set_range(is_leaf_bitset, bone_bitset_desc, 0, num_transforms, true);
+				const transform_metadata* metadata = out_clip_context.metadata;
+				const auto get_parent_index = [metadata](uint32_t transform_index) { return metadata[transform_index].parent_index; };
 
-#if defined(ACL_HAS_ASSERT_CHECKS)
-				uint32_t num_root_bones = 0;
-#endif
-
-				// Move and validate the input data
-				for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
-				{
-					const transform_metadata& metadata = out_clip_context.metadata[transform_index];
-
-					const bool is_root = metadata.parent_index == k_invalid_track_index;
-
-					// If we have a parent, mark it as not being a leaf bone (it has at least one child)
-					if (!is_root)
-						bitset_set(is_leaf_bitset, bone_bitset_desc, metadata.parent_index, false);
+				initialize_transform_hierarchy(allocator, num_transforms, get_parent_index, false, out_clip_context.owned_hierarchy);
+				out_clip_context.hierarchy = &out_clip_context.owned_hierarchy;
+			}
 
-#if defined(ACL_HAS_ASSERT_CHECKS)
-					if (is_root)
-						num_root_bones++;
-#endif
-				}
+			out_clip_context.sorted_transforms_parent_first = out_clip_context.hierarchy->sorted_transforms_parent_first;
 
-				const uint32_t num_leaf_transforms = bitset_count_set_bits(is_leaf_bitset, bone_bitset_desc);
-				out_clip_context.num_leaf_transforms = num_leaf_transforms;
+			for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+				out_clip_context.metadata[transform_index].transform_chain = out_clip_context.hierarchy->get_transform_chain(transform_index);
 
-				uint32_t* leaf_transform_chains = allocate_type_array<uint32_t>(allocator, num_leaf_transforms * bitset_size);
-				out_clip_context.leaf_transform_chains = leaf_transform_chains;
+			return are_samples_valid;
+		}
 
-				uint32_t leaf_index = 0;
-				for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
-				{
-					if (!bitset_test(is_leaf_bitset, bone_bitset_desc, transform_index))
-						continue;	// Skip non-leaf bones
+		// Initializes a clip context with a copy of the samples of a single segment clip context initialized above.
+		// This lets a clip context prepared once (e.g. by a prepared_clip_context) be reused by many compression runs.
+		// The transform hierarchy and the shell metadata are shared, the source clip context must outlive the copy.
+		inline void initialize_clip_context(iallocator& allocator, const clip_context& source_clip_context, clip_context& out_clip_context)
+		{
+			ACL_ASSERT(source_clip_context.num_segments == 1, "Only single segment clip contexts can be copied");
 
-					uint32_t* bone_chain = leaf_transform_chains + (leaf_index * bitset_size);
-					bitset_reset(bone_chain, bone_bitset_desc, false);
+			const uint32_t num_transforms = source_clip_context.num_bones;
+			const uint32_t num_samples = source_clip_context.num_samples;
+			const float sample_rate = source_clip_context.sample_rate;
+			const segment_context& source_segment = source_clip_context.segments[0];
 
-					uint32_t chain_bone_index = transform_index;
-					while (chain_bone_index != k_invalid_track_index)
-					{
-						bitset_set(bone_chain, bone_bitset_desc, chain_bone_index, true);
+			out_clip_context.segments = allocate_type_array<segment_context>(allocator, 1);
+			out_clip_context.ranges = nullptr;
+			out_clip_context.metadata = allocate_type_array<transform_metadata>(allocator, num_transforms);
+			out_clip_context.hierarchy = source_clip_context.hierarchy;
+			out_clip_context.sorted_transforms_parent_first = source_clip_context.sorted_transforms_parent_first;
+			out_clip_context.clip_shell_metadata = source_clip_context.clip_shell_metadata;
+			out_clip_context.num_segments = 1;
+			out_clip_context.num_bones = num_transforms;
+			out_clip_context.num_samples_allocated = num_samples;
+			out_clip_context.num_samples = num_samples;
+			out_clip_context.sample_rate = sample_rate;
+			out_clip_context.duration = source_clip_context.duration;
+			out_clip_context.looping_policy = source_clip_context.looping_policy;
+			out_clip_context.additive_format = source_clip_context.additive_format;
+			out_clip_context.are_rotations_normalized = false;
+			out_clip_context.are_translations_normalized = false;
+			out_clip_context.are_scales_normalized = false;
+			out_clip_context.has_scale = true;	// Scale detection is handled during sub-track compacting
+			out_clip_context.has_additive_base = source_clip_context.has_additive_base;
+			out_clip_context.allocator = &allocator;
+			out_clip_context.decomp_touched_bytes = 0;
+			out_clip_context.decomp_touched_cache_lines = 0;
 
-						transform_metadata& metadata = out_clip_context.metadata[chain_bone_index];
+			segment_context& segment = out_clip_context.segments[0];
 
-						// We assign a bone chain the first time we find a bone that isn't part of one already
-						if (metadata.transform_chain == nullptr)
-							metadata.transform_chain = bone_chain;
+			transform_streams* bone_streams = allocate_type_array<transform_streams>(allocator, num_transforms);
 
-						chain_bone_index = metadata.parent_index;
-					}
+			for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+			{
+				const transform_streams& source_bone_stream = source_segment.bone_streams[transform_index];
+				transform_streams& bone_stream = bone_streams[transform_index];
 
-					leaf_index++;
-				}
+				bone_stream.segment = &segment;
+				bone_stream.bone_index = transform_index;
+				bone_stream.parent_bone_index = source_bone_stream.parent_bone_index;
+				bone_stream.output_index = source_bone_stream.output_index;
+				bone_stream.default_value = source_bone_stream.default_value;
 
-				ACL_ASSERT(num_root_bones > 0, "No root bone found. The root bones must have a parent index = 0xFFFF");
-				ACL_ASSERT(leaf_index == num_leaf_transforms, "Invalid number of leaf bone found");
-				deallocate_type_array(allocator, is_leaf_bitset, bitset_size);
+				// The copy owns its samples, allocated with our allocator even if the source references a track list
+				bone_stream.rotations = rotation_track_stream(allocator, num_samples, sizeof(rtm::quatf), sample_rate, rotation_format8::quatf_full);
+				bone_stream.translations = translation_track_stream(allocator, num_samples, sizeof(rtm::vector4f), sample_rate, vector_format8::vector3f_full);
+				bone_stream.scales = scale_track_stream(allocator, num_samples, sizeof(rtm::vector4f), sample_rate, vector_format8::vector3f_full);
 
-				// We sort our transform indices by parent first
-				// If two transforms have the same parent index, we sort them by their transform index
-				auto sort_predicate = [&out_clip_context](const uint32_t& lhs_transform_index, const uint32_t& rhs_transform_index)
+				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
 				{
-					const uint32_t lhs_parent_index = out_clip_context.metadata[lhs_transform_index].parent_index;
-					const uint32_t rhs_parent_index = out_clip_context.metadata[rhs_transform_index].parent_index;
-
-					// If the transforms don't have the same parent, sort by the parent index
-					// We add 1 to parent indices to cause the invalid index to wrap around to 0
-					// since parents come first, they'll have the lowest value
-					if (lhs_parent_index != rhs_parent_index)
-						return (lhs_parent_index + 1) < (rhs_parent_index + 1);
-
-					// Both transforms have the same parent, sort by their index
-					return lhs_transform_index < rhs_transform_index;
-				};
+					bone_stream.rotations.set_raw_sample(sample_index, source_bone_stream.rotations.get_raw_sample<rtm::quatf>(sample_index));
+					bone_stream.translations.set_raw_sample(sample_index, source_bone_stream.translations.get_raw_sample<rtm::vector4f>(sample_index));
+					bone_stream.scales.set_raw_sample(sample_index, source_bone_stream.scales.get_raw_sample<rtm::vector4f>(sample_index));
+				}
 
-				std::sort(out_clip_context.sorted_transforms_parent_first, out_clip_context.sorted_transforms_parent_first + num_transforms, sort_predicate);
+				out_clip_context.metadata[transform_index] = source_clip_context.metadata[transform_index];
 			}
 
-			return are_samples_valid;
+			segment.bone_streams = bone_streams;
+			segment.clip = &out_clip_context;
+			segment.ranges = nullptr;
+			segment.contributing_error = nullptr;
+			segment.num_samples_allocated = num_samples;
+			segment.num_samples = num_samples;
+			segment.num_bones = num_transforms;
+			segment.clip_sample_offset = 0;
+			segment.segment_index = 0;
+			segment.are_rotations_normalized = false;
+			segment.are_translations_normalized = false;
+			segment.are_scales_normalized = false;
+
+			segment.animated_rotation_bit_size = 0;
+			segment.animated_translation_bit_size = 0;
+			segment.animated_scale_bit_size = 0;
+			segment.animated_pose_bit_size = 0;
+			segment.animated_data_size = 0;
+			segment.range_data_size = 0;
+			segment.total_header_size = 0;
 		}
 
 		inline void destroy_clip_context(clip_context& context)
@@ -444,10 +509,7 @@ namespace acl
 			deallocate_type_array(allocator, context.ranges, context.num_bones);
 			deallocate_type_array(allocator, context.metadata, context.num_bones);
 
-			bitset_description bone_bitset_desc = bitset_description::make_from_num_bits(context.num_bones);
-			deallocate_type_array(allocator, context.leaf_transform_chains, size_t(context.num_leaf_transforms) * bone_bitset_desc.get_size());
-
-			deallocate_type_array(allocator, context.sorted_transforms_parent_first, context.num_bones);
+			destroy_transform_hierarchy(allocator, context.owned_hierarchy);
 		}
 
 		constexpr bool segment_context_has_scale(const segment_context& segment) { return segment.clip->has_scale; }
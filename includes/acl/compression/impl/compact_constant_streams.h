@@ -30,12 +30,16 @@
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/error.h"
 #include "acl/compression/impl/clip_context.h"
+#include "acl/compression/impl/compression_jobs.h"
 #include "acl/compression/impl/rigid_shell_utils.h"
 #include "acl/compression/transform_error_metrics.h"
+#include "acl/math/vector4_packing.h"
 
 #include <rtm/qvvf.h>
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 
 //////////////////////////////////////////////////////////////////////////
 // Apply error correction after constant and default tracks are processed.
@@ -66,6 +70,10 @@ namespace acl
 		// dominant shell distance. If the error remains within our dominant precision
 		// then the sub-track is constant. We perform the same test using the default
 		// sub-track value to determine if it is a default sub-track.
+		// Samples are converted in small batches and their error is measured with a single call.
+
+		// The number of samples we measure the error of at once
+		constexpr uint32_t k_num_constant_check_batch_samples = 8;
 
 		inline bool RTM_SIMD_CALL are_samples_constant(const compression_settings& settings,
 			const clip_context& lossy_clip_context, const clip_context& additive_base_clip_context,
@@ -84,11 +92,15 @@ namespace acl
 			const uint32_t dirty_transform_indices[2] = { 0, 1 };
 			rtm::qvvf local_transforms[2];
 			rtm::qvvf base_transforms[2];
-			alignas(16) uint8_t local_transforms_converted[1024];	// Big enough for 2 transforms for sure
+			alignas(16) uint8_t local_transforms_converted[1024 * k_num_constant_check_batch_samples];	// Big enough for 2 transforms per sample for sure
 			alignas(16) uint8_t base_transforms_converted[1024];	// Big enough for 2 transforms for sure
+			float batch_errors[k_num_constant_check_batch_samples];
 
 			const size_t metric_transform_size = error_metric.get_transform_size(lossy_clip_context.has_scale);
-			ACL_ASSERT(metric_transform_size * 2 <= sizeof(local_transforms_converted), "Transform size is too large");
+			ACL_ASSERT(metric_transform_size * 2 <= sizeof(base_transforms_converted), "Transform size is too large");
+
+			// The raw and lossy transforms of a sample are stored next to each other
+			const size_t metric_transform_pair_size = metric_transform_size * 2;
 
 			itransform_error_metric::convert_transforms_args convert_transforms_args_local;
 			convert_transforms_args_local.dirty_transform_indices = &dirty_transform_indices[0];
@@ -108,100 +120,114 @@ namespace acl
 			apply_additive_to_base_args.dirty_transform_indices = &dirty_transform_indices[0];
 			apply_additive_to_base_args.num_dirty_transforms = 2;
 			apply_additive_to_base_args.base_transforms = needs_conversion ? (const void*)&base_transforms_converted[0] : (const void*)&base_transforms[0];
-			apply_additive_to_base_args.local_transforms = needs_conversion ? (const void*)&local_transforms_converted[0] : (const void*)&local_transforms[0];
 			apply_additive_to_base_args.num_transforms = 2;
 
-			qvvf_transform_error_metric::calculate_error_args calculate_error_args;
+			itransform_error_metric::calculate_error_batch_args calculate_error_args;
 			calculate_error_args.construct_sphere_shell(shell.local_shell_distance);
-			calculate_error_args.transform0 = &local_transforms_converted[metric_transform_size * 0];
-			calculate_error_args.transform1 = &local_transforms_converted[metric_transform_size * 1];
+			calculate_error_args.transforms0 = &local_transforms_converted[0];
+			calculate_error_args.transforms1 = &local_transforms_converted[metric_transform_size];
+			calculate_error_args.transforms0_stride = metric_transform_pair_size;
+			calculate_error_args.transforms1_stride = metric_transform_pair_size;
 
-			const rtm::scalarf precision = rtm::scalar_set(shell.precision);
+			const float precision = shell.precision;
 
 			const uint32_t num_samples = lossy_clip_context.num_samples;
-			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			for (uint32_t batch_start_index = 0; batch_start_index < num_samples; batch_start_index += k_num_constant_check_batch_samples)
 			{
-				const rtm::quatf raw_rotation = raw_transform_stream.rotations.get_sample_clamped(sample_index);
-				const rtm::vector4f raw_translation = raw_transform_stream.translations.get_sample_clamped(sample_index);
-				const rtm::vector4f raw_scale = raw_transform_stream.scales.get_sample_clamped(sample_index);
+				const uint32_t num_batch_samples = std::min<uint32_t>(num_samples - batch_start_index, k_num_constant_check_batch_samples);
 
-				rtm::qvvf raw_transform = rtm::qvv_set(raw_rotation, raw_translation, raw_scale);
-				rtm::qvvf lossy_transform = raw_transform;	// Copy the raw transform
-
-				// Fix up our lossy transform with the reference value
-				switch (sub_track_type)
+				for (uint32_t batch_sample_index = 0; batch_sample_index < num_batch_samples; ++batch_sample_index)
 				{
-				case animation_track_type8::rotation:
-				default:
-					lossy_transform.rotation = rtm::vector_to_quat(reference);
-					break;
-				case animation_track_type8::translation:
-					lossy_transform.translation = reference;
-					break;
-				case animation_track_type8::scale:
-					lossy_transform.scale = reference;
-					break;
-				}
+					const uint32_t sample_index = batch_start_index + batch_sample_index;
+					uint8_t* sample_transforms_converted = &local_transforms_converted[metric_transform_pair_size * batch_sample_index];
 
-				local_transforms[0] = raw_transform;
-				local_transforms[1] = lossy_transform;
+					const rtm::quatf raw_rotation = raw_transform_stream.rotations.get_sample_clamped(sample_index);
+					const rtm::vector4f raw_translation = raw_transform_stream.translations.get_sample_clamped(sample_index);
+					const rtm::vector4f raw_scale = raw_transform_stream.scales.get_sample_clamped(sample_index);
 
-				if (needs_conversion)
-				{
-					convert_transforms_args_local.sample_index = sample_index;
+					rtm::qvvf raw_transform = rtm::qvv_set(raw_rotation, raw_translation, raw_scale);
+					rtm::qvvf lossy_transform = raw_transform;	// Copy the raw transform
 
-					convert_transforms_args_local.transforms = &local_transforms[0];
-					convert_transforms_args_local.is_lossy = false;
+					// Fix up our lossy transform with the reference value
+					switch (sub_track_type)
+					{
+					case animation_track_type8::rotation:
+					default:
+						lossy_transform.rotation = rtm::vector_to_quat(reference);
+						break;
+					case animation_track_type8::translation:
+						lossy_transform.translation = reference;
+						break;
+					case animation_track_type8::scale:
+						lossy_transform.scale = reference;
+						break;
+					}
 
-					error_metric.convert_transforms(convert_transforms_args_local, &local_transforms_converted[metric_transform_size * 0]);
+					local_transforms[0] = raw_transform;
+					local_transforms[1] = lossy_transform;
 
-					convert_transforms_args_local.transforms = &local_transforms[1];
-					convert_transforms_args_local.is_lossy = true;
+					if (needs_conversion)
+					{
+						convert_transforms_args_local.sample_index = sample_index;
 
-					error_metric.convert_transforms(convert_transforms_args_local, &local_transforms_converted[metric_transform_size * 1]);
-				}
-				else
-					std::memcpy(&local_transforms_converted[0], &local_transforms[0], metric_transform_size * 2);
+						convert_transforms_args_local.transforms = &local_transforms[0];
+						convert_transforms_args_local.is_lossy = false;
 
-				if (has_additive_base)
-				{
-					const segment_context& additive_base_segment = additive_base_clip_context.segments[0];
-					const transform_streams& additive_base_bone_stream = additive_base_segment.bone_streams[transform_index];
+						error_metric.convert_transforms(convert_transforms_args_local, sample_transforms_converted);
 
-					// The sample time is calculated from the full clip duration to be consistent with decompression
-					const float sample_time = rtm::scalar_min(float(sample_index) / lossy_clip_context.sample_rate, lossy_clip_context.duration);
+						convert_transforms_args_local.transforms = &local_transforms[1];
+						convert_transforms_args_local.is_lossy = true;
 
-					const float normalized_sample_time = additive_base_segment.num_samples > 1 ? (sample_time / lossy_clip_context.duration) : 0.0F;
-					const float additive_sample_time = additive_base_segment.num_samples > 1 ? (normalized_sample_time * additive_base_clip_context.duration) : 0.0F;
+						error_metric.convert_transforms(convert_transforms_args_local, sample_transforms_converted + metric_transform_size);
+					}
+					else
+						std::memcpy(sample_transforms_converted, &local_transforms[0], metric_transform_pair_size);
 
-					// With uniform sample distributions, we do not interpolate.
-					const uint32_t base_sample_index = get_uniform_sample_key(additive_base_segment, additive_sample_time);
+					if (has_additive_base)
+					{
+						const segment_context& additive_base_segment = additive_base_clip_context.segments[0];
+						const transform_streams& additive_base_bone_stream = additive_base_segment.bone_streams[transform_index];
 
-					const rtm::quatf base_rotation = additive_base_bone_stream.rotations.get_sample_clamped(base_sample_index);
-					const rtm::vector4f base_translation = additive_base_bone_stream.translations.get_sample_clamped(base_sample_index);
-					const rtm::vector4f base_scale = additive_base_bone_stream.scales.get_sample_clamped(base_sample_index);
+						// The sample time is calculated from the full clip duration to be consistent with decompression
+						const float sample_time = rtm::scalar_min(float(sample_index) / lossy_clip_context.sample_rate, lossy_clip_context.duration);
 
-					const rtm::qvvf base_transform = rtm::qvv_set(base_rotation, base_translation, base_scale);
+						const float normalized_sample_time = additive_base_segment.num_samples > 1 ? (sample_time / lossy_clip_context.duration) : 0.0F;
+						const float additive_sample_time = additive_base_segment.num_samples > 1 ? (normalized_sample_time * additive_base_clip_context.duration) : 0.0F;
 
-					base_transforms[0] = base_transform;
-					base_transforms[1] = base_transform;
+						// With uniform sample distributions, we do not interpolate.
+						const uint32_t base_sample_index = get_uniform_sample_key(additive_base_segment, additive_sample_time);
 
-					if (needs_conversion)
-					{
-						convert_transforms_args_base.sample_index = base_sample_index;
-						error_metric.convert_transforms(convert_transforms_args_base, &base_transforms_converted[0]);
-					}
-					else
-						std::memcpy(&base_transforms_converted[0], &base_transforms[0], metric_transform_size * 2);
+						const rtm::quatf base_rotation = additive_base_bone_stream.rotations.get_sample_clamped(base_sample_index);
+						const rtm::vector4f base_translation = additive_base_bone_stream.translations.get_sample_clamped(base_sample_index);
+						const rtm::vector4f base_scale = additive_base_bone_stream.scales.get_sample_clamped(base_sample_index);
+
+						const rtm::qvvf base_transform = rtm::qvv_set(base_rotation, base_translation, base_scale);
+
+						base_transforms[0] = base_transform;
+						base_transforms[1] = base_transform;
+
+						if (needs_conversion)
+						{
+							convert_transforms_args_base.sample_index = base_sample_index;
+							error_metric.convert_transforms(convert_transforms_args_base, &base_transforms_converted[0]);
+						}
+						else
+							std::memcpy(&base_transforms_converted[0], &base_transforms[0], metric_transform_pair_size);
 
-					error_metric.apply_additive_to_base(apply_additive_to_base_args, &local_transforms_converted[0]);
+						// The additive is applied in place over the converted pair of this sample
+						apply_additive_to_base_args.local_transforms = needs_conversion ? (const void*)sample_transforms_converted : (const void*)&local_transforms[0];
+						error_metric.apply_additive_to_base(apply_additive_to_base_args, sample_transforms_converted);
+					}
 				}
 
-				const rtm::scalarf vtx_error = error_metric.calculate_error(calculate_error_args);
+				error_metric.calculate_error_batch(calculate_error_args, num_batch_samples, &batch_errors[0]);
 
 				// If our error exceeds the desired precision, we are not constant
-				if (rtm::scalar_greater_than(vtx_error, precision))
-					return false;
+				for (uint32_t batch_sample_index = 0; batch_sample_index < num_batch_samples; ++batch_sample_index)
+				{
+					if (batch_errors[batch_sample_index] > precision)
+						return false;
+				}
 			}
 
 			// All samples were tested against the reference value and the error remained within tolerance
@@ -251,6 +277,23 @@ namespace acl
 			return are_samples_constant(settings, lossy_clip_context, additive_base_clip_context, default_bind_rotation, transform_index, animation_track_type8::rotation);
 		}
 
+		// Constant rotations can be stored with 16 bits per component if the error metric allows it, see get_constant_rotation_group_size(..)
+		// Returns whether or not the quantized rotation remains within our precision for every sample
+		inline bool can_quantize_constant_rotation(const compression_settings& settings, const clip_context& lossy_clip_context, const clip_context& additive_base_clip_context, rtm::vector4f_arg0 rotation, uint32_t transform_index, rtm::vector4f& out_quantized_rotation)
+		{
+			if (!settings.enable_constant_rotation_quantization || settings.rotation_format != rotation_format8::quatf_drop_w_variable)
+				return false;
+
+			// Our rotation has a positive W component, it is reconstructed when we decompress
+			const rtm::vector4f quantized_rotation = rtm::quat_to_vector(rtm::quat_from_positive_w(decay_vector3_s48(rotation)));
+
+			if (!are_samples_constant(settings, lossy_clip_context, additive_base_clip_context, quantized_rotation, transform_index, animation_track_type8::rotation))
+				return false;
+
+			out_quantized_rotation = quantized_rotation;
+			return true;
+		}
+
 		inline bool are_translations_constant(const compression_settings& settings, const clip_context& lossy_clip_context, const clip_context& additive_base_clip_context, uint32_t transform_index)
 		{
 			if (lossy_clip_context.num_samples == 0)
@@ -368,16 +411,9 @@ namespace acl
 			const uint32_t num_samples = context.num_samples;
 			const uint32_t raw_num_samples = raw_clip_context.num_samples;
 
-			uint32_t num_default_bone_scales = 0;
-
-#ifdef ACL_IMPL_ENABLE_CONSTANT_ERROR_CORRECTION
-			bool has_constant_bone_rotations = false;
-			bool has_constant_bone_translations = false;
-			bool has_constant_bone_scales = false;
-#endif
-
-			// Iterate in any order, doesn't matter
-			for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+			// Bones are independent and can be processed in any order, the sub-tracks of a bone are processed in order
+			// since the constant rotation is used when testing the translation and scale
+			auto compact_bone_streams = [&](uint32_t transform_index)
 			{
 				const track_desc_transformf& desc = track_list[transform_index].get_description();
 
@@ -410,6 +446,8 @@ namespace acl
 						bone_stream.is_rotation_default = true;
 						rotation = default_bind_rotation;
 					}
+					else if (can_quantize_constant_rotation(settings, context, additive_base_clip_context, rotation, transform_index, rotation))
+						bone_stream.is_rotation_quantized = true;
 
 					constant_stream.set_raw_sample(0, rotation);
 					bone_stream.rotations = std::move(constant_stream);
@@ -419,10 +457,6 @@ namespace acl
 					// We also update the raw data to match in case the values differ
 					for (uint32_t sample_index = 0; sample_index < raw_num_samples; ++sample_index)
 						raw_bone_stream.rotations.set_raw_sample(sample_index, rotation);
-
-#ifdef ACL_IMPL_ENABLE_CONSTANT_ERROR_CORRECTION
-					has_constant_bone_rotations = true;
-#endif
 				}
 
 				if (are_translations_constant(settings, context, additive_base_clip_context, transform_index))
@@ -450,10 +484,6 @@ namespace acl
 					// We also update the raw data to match in case the values differ
 					for (uint32_t sample_index = 0; sample_index < raw_num_samples; ++sample_index)
 						raw_bone_stream.translations.set_raw_sample(sample_index, translation);
-
-#ifdef ACL_IMPL_ENABLE_CONSTANT_ERROR_CORRECTION
-					has_constant_bone_translations = true;
-#endif
 				}
 
 				if (are_scales_constant(settings, context, additive_base_clip_context, transform_index))
@@ -478,20 +508,39 @@ namespace acl
 					// Zero out W, could be garbage
 					bone_range.scale = track_stream_range::from_min_extent(rtm::vector_set_w(scale, 0.0F), rtm::vector_zero());
 
-					num_default_bone_scales += bone_stream.is_scale_default ? 1 : 0;
-
 					// We also update the raw data to match in case the values differ
 					for (uint32_t sample_index = 0; sample_index < raw_num_samples; ++sample_index)
 						raw_bone_stream.scales.set_raw_sample(sample_index, scale);
+				}
+			};
+
+			execute_compression_jobs(settings.job_scheduler, num_transforms, compact_bone_streams);
+
+			uint32_t num_default_bone_scales = 0;
 
 #ifdef ACL_IMPL_ENABLE_CONSTANT_ERROR_CORRECTION
-					has_constant_bone_scales = true;
+			bool has_constant_bone_rotations = false;
+			bool has_constant_bone_translations = false;
+			bool has_constant_bone_scales = false;
+#endif
+
+			bool has_quantized_constant_rotations = false;
+
+			for (const transform_streams& bone_stream : segment.const_bone_iterator())
+			{
+				num_default_bone_scales += bone_stream.is_scale_default ? 1 : 0;
+				has_quantized_constant_rotations |= bone_stream.is_rotation_quantized;
+
+#ifdef ACL_IMPL_ENABLE_CONSTANT_ERROR_CORRECTION
+				has_constant_bone_rotations |= bone_stream.is_rotation_constant;
+				has_constant_bone_translations |= bone_stream.is_translation_constant;
+				has_constant_bone_scales |= bone_stream.is_scale_constant;
 #endif
-				}
 			}
 
 			const bool has_scale = num_default_bone_scales != num_transforms;
 			context.has_scale = has_scale;
+			context.has_quantized_constant_rotations = has_quantized_constant_rotations;
 
 #ifdef ACL_IMPL_ENABLE_CONSTANT_ERROR_CORRECTION
 
@@ -668,13 +717,13 @@ namespace acl
 				// We need to do these again, to account for error correction.
 				if(any_constant_changed.rotation)
 				{
-					convert_rotation_streams(allocator, context, settings.rotation_format);
+					convert_rotation_streams(context, settings.rotation_format, settings.job_scheduler);
 				}
 
 				if (any_constant_changed.rotation || any_constant_changed.translation || any_constant_changed.scale)
 				{
 					deallocate_type_array(allocator, context.ranges, num_transforms);
-					extract_clip_bone_ranges(allocator, context);
+					extract_clip_bone_ranges(allocator, context, settings.job_scheduler);
 				}
 			}
 #endif
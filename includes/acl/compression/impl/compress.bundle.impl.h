@@ -0,0 +1,324 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Included only once from compress.h
+
+#include "acl/version.h"
+#include "acl/core/buffer_tag.h"
+#include "acl/core/compressed_bundle.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/compressed_tracks_version.h"
+#include "acl/core/error_result.h"
+#include "acl/core/hash.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/memory_utils.h"
+#include "acl/core/impl/compressed_headers.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		// Returns the size of the metadata block that starts at the provided offset, including its padding.
+		// Blocks are contiguous and the last one ends where the optional metadata header starts.
+		inline uint32_t get_bundle_metadata_block_size(const compressed_tracks& tracks, uint32_t block_offset)
+		{
+			const optional_metadata_header& header = get_optional_metadata_header(tracks);
+			const uint32_t block_offsets[] =
+			{
+				uint32_t(header.track_list_name),
+				uint32_t(header.track_name_offsets),
+				uint32_t(header.parent_track_indices),
+				uint32_t(header.track_descriptions),
+				uint32_t(header.contributing_error),
+			};
+
+			// Invalid offsets are larger than any valid offset
+			uint32_t block_end_offset = tracks.get_size() - uint32_t(sizeof(optional_metadata_header));
+			for (const uint32_t offset : block_offsets)
+			{
+				if (offset > block_offset)
+					block_end_offset = std::min(block_end_offset, offset);
+			}
+
+			return block_end_offset - block_offset;
+		}
+
+		// Returns the offset where the metadata starts, relative to the start of the compressed tracks
+		inline uint32_t get_bundle_metadata_start_offset(const compressed_tracks& tracks)
+		{
+			const optional_metadata_header& header = get_optional_metadata_header(tracks);
+			const uint32_t block_offsets[] =
+			{
+				uint32_t(header.track_list_name),
+				uint32_t(header.track_name_offsets),
+				uint32_t(header.parent_track_indices),
+				uint32_t(header.track_descriptions),
+				uint32_t(header.contributing_error),
+			};
+
+			uint32_t start_offset = tracks.get_size() - uint32_t(sizeof(optional_metadata_header));
+			for (const uint32_t offset : block_offsets)
+				start_offset = std::min(start_offset, offset);
+
+			return start_offset;
+		}
+
+		template<typename data_type>
+		inline ptr_offset32<data_type> get_bundle_metadata_block_offset(const compressed_tracks& tracks, ptr_offset32<data_type> optional_metadata_header::*block)
+		{
+			if (!get_tracks_header(tracks).get_has_metadata())
+				return invalid_ptr_offset();
+
+			return get_optional_metadata_header(tracks).*block;
+		}
+
+		// Returns true if both clips have the same metadata block, byte for byte, or if neither has it
+		template<typename data_type>
+		inline bool is_bundle_metadata_block_shared(const compressed_tracks& tracks_a, const compressed_tracks& tracks_b, ptr_offset32<data_type> optional_metadata_header::*block)
+		{
+			const ptr_offset32<data_type> offset_a = get_bundle_metadata_block_offset(tracks_a, block);
+			const ptr_offset32<data_type> offset_b = get_bundle_metadata_block_offset(tracks_b, block);
+			if (offset_a.is_valid() != offset_b.is_valid())
+				return false;
+
+			if (!offset_a.is_valid())
+				return true;	// Neither has it
+
+			const uint32_t size_a = get_bundle_metadata_block_size(tracks_a, uint32_t(offset_a));
+			const uint32_t size_b = get_bundle_metadata_block_size(tracks_b, uint32_t(offset_b));
+			if (size_a != size_b)
+				return false;
+
+			return std::memcmp(offset_a.add_to(&tracks_a), offset_b.add_to(&tracks_b), size_a) == 0;
+		}
+
+		// Returns true if the clip has track names or descriptions that can be shared with the first clip of the bundle
+		inline bool has_bundle_shared_metadata(const compressed_tracks& tracks)
+		{
+			return get_bundle_metadata_block_offset(tracks, &optional_metadata_header::track_name_offsets).is_valid()
+				|| get_bundle_metadata_block_offset(tracks, &optional_metadata_header::track_descriptions).is_valid();
+		}
+
+		// Returns the size of the clip once its shared metadata is stripped
+		inline uint32_t get_bundle_stripped_tracks_size(const compressed_tracks& tracks)
+		{
+			if (!has_bundle_shared_metadata(tracks))
+				return tracks.get_size();	// Nothing to strip, stored as is
+
+			const optional_metadata_header& header = get_optional_metadata_header(tracks);
+
+			// The track list name, the parent track indices, and the contributing error are retained
+			uint32_t size = get_bundle_metadata_start_offset(tracks);
+			if (header.track_list_name.is_valid())
+				size += get_bundle_metadata_block_size(tracks, uint32_t(header.track_list_name));
+			if (header.parent_track_indices.is_valid())
+				size += get_bundle_metadata_block_size(tracks, uint32_t(header.parent_track_indices));
+			if (header.contributing_error.is_valid())
+				size += get_bundle_metadata_block_size(tracks, uint32_t(header.contributing_error));
+
+			size += sizeof(optional_metadata_header);
+			return size;
+		}
+
+		// Writes the clip without its shared metadata, the output buffer must be 'get_bundle_stripped_tracks_size(..)' bytes large
+		inline void write_bundle_stripped_tracks(const compressed_tracks& tracks, uint8_t* out_buffer)
+		{
+			if (!has_bundle_shared_metadata(tracks))
+			{
+				std::memcpy(out_buffer, &tracks, tracks.get_size());
+				return;
+			}
+
+			const optional_metadata_header& input_metadata_header = get_optional_metadata_header(tracks);
+			const uint8_t* input_buffer = reinterpret_cast<const uint8_t*>(&tracks);
+
+			// Everything that precedes the metadata is copied as is, it is needed to decompress
+			uint32_t offset = get_bundle_metadata_start_offset(tracks);
+			std::memcpy(out_buffer, input_buffer, offset);
+
+			optional_metadata_header output_metadata_header;
+			output_metadata_header.track_list_name = invalid_ptr_offset();
+			output_metadata_header.track_name_offsets = invalid_ptr_offset();
+			output_metadata_header.parent_track_indices = invalid_ptr_offset();
+			output_metadata_header.track_descriptions = invalid_ptr_offset();
+			output_metadata_header.contributing_error = invalid_ptr_offset();
+
+			// Retained blocks are multiples of 4 bytes and remain aligned
+			if (input_metadata_header.track_list_name.is_valid())
+			{
+				const uint32_t block_size = get_bundle_metadata_block_size(tracks, uint32_t(input_metadata_header.track_list_name));
+				std::memcpy(out_buffer + offset, input_buffer + uint32_t(input_metadata_header.track_list_name), block_size);
+				output_metadata_header.track_list_name = offset;
+				offset += block_size;
+			}
+
+			if (input_metadata_header.parent_track_indices.is_valid())
+			{
+				const uint32_t block_size = get_bundle_metadata_block_size(tracks, uint32_t(input_metadata_header.parent_track_indices));
+				std::memcpy(out_buffer + offset, input_buffer + uint32_t(input_metadata_header.parent_track_indices), block_size);
+				output_metadata_header.parent_track_indices = offset;
+				offset += block_size;
+			}
+
+			if (input_metadata_header.contributing_error.is_valid())
+			{
+				const uint32_t block_size = get_bundle_metadata_block_size(tracks, uint32_t(input_metadata_header.contributing_error));
+				std::memcpy(out_buffer + offset, input_buffer + uint32_t(input_metadata_header.contributing_error), block_size);
+				output_metadata_header.contributing_error = offset;
+				offset += block_size;
+			}
+
+			const bool has_metadata = offset != get_bundle_metadata_start_offset(tracks);
+
+			// The header is always written, it also serves as the trailing padding when no metadata remains
+			std::memcpy(out_buffer + offset, &output_metadata_header, sizeof(optional_metadata_header));
+			offset += sizeof(optional_metadata_header);
+
+			tracks_header* header = safe_ptr_cast<tracks_header>(out_buffer + sizeof(raw_buffer_header));
+			header->set_has_metadata(has_metadata);
+			header->set_has_track_name_table(false);
+
+			raw_buffer_header* buffer_header = safe_ptr_cast<raw_buffer_header>(out_buffer);
+			buffer_header->size = offset;
+			buffer_header->hash = hash_raw_buffer(header->version, out_buffer + sizeof(raw_buffer_header), offset - sizeof(raw_buffer_header));	// Hash everything but the raw buffer header
+		}
+	}
+
+	inline error_result build_compressed_bundle(iallocator& allocator, const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks, compressed_bundle*& out_bundle)
+	{
+		using namespace acl_impl;
+
+		out_bundle = nullptr;
+
+		if (num_compressed_tracks == 0 || compressed_tracks_list == nullptr)
+			return error_result("A bundle must contain at least one clip");
+
+		for (uint32_t tracks_index = 0; tracks_index < num_compressed_tracks; ++tracks_index)
+		{
+			const compressed_tracks* tracks = compressed_tracks_list[tracks_index];
+			if (tracks == nullptr)
+				return error_result("Compressed tracks cannot be null");
+
+			const error_result result = tracks->is_valid(false);
+			if (result.any())
+				return result;
+
+			// Stripping the shared metadata changes the hash the database references
+			if (tracks->has_database())
+				return error_result("Compressed tracks bound to a database cannot be bundled");
+		}
+
+		// Every clip must share the metadata of the first clip
+		const compressed_tracks& first_tracks = *compressed_tracks_list[0];
+		for (uint32_t tracks_index = 1; tracks_index < num_compressed_tracks; ++tracks_index)
+		{
+			const compressed_tracks& tracks = *compressed_tracks_list[tracks_index];
+			if (tracks.get_track_type() != first_tracks.get_track_type() || tracks.get_num_tracks() != first_tracks.get_num_tracks())
+				return error_result("Clips must contain the same tracks");
+
+			if (tracks.get_version() != first_tracks.get_version())
+				return error_result("Clips must have the same version");
+
+			if (!is_bundle_metadata_block_shared(tracks, first_tracks, &optional_metadata_header::track_name_offsets)
+				|| !is_bundle_metadata_block_shared(tracks, first_tracks, &optional_metadata_header::track_descriptions))
+				return error_result("Clips must share the same track metadata");
+		}
+
+		// Compute our layout
+		uint64_t buffer_size = 0;
+		buffer_size += sizeof(raw_buffer_header);									// Header
+		buffer_size += sizeof(bundle_header);										// Header
+
+		buffer_size = align_to(buffer_size, 4);										// Align table of contents
+		const uint64_t entries_offset = buffer_size;
+		buffer_size += uint64_t(num_compressed_tracks) * sizeof(pack_entry);		// Table of contents
+
+		const uint64_t tracks_start_offset = buffer_size;
+		for (uint32_t tracks_index = 0; tracks_index < num_compressed_tracks; ++tracks_index)
+		{
+			const compressed_tracks* tracks = compressed_tracks_list[tracks_index];
+
+			buffer_size = align_to(buffer_size, k_compressed_tracks_preferred_alignment);	// Align compressed tracks
+			buffer_size += tracks_index == 0 ? tracks->get_size() : get_bundle_stripped_tracks_size(*tracks);	// Compressed tracks
+		}
+
+		if (buffer_size > std::numeric_limits<uint32_t>::max())
+			return error_result("Compressed bundle is too large");
+
+		const uint32_t bundle_size = uint32_t(buffer_size);
+
+		uint8_t* buffer = allocate_type_array_aligned<uint8_t>(allocator, bundle_size, k_compressed_tracks_preferred_alignment);
+		std::memset(buffer, 0, bundle_size);	// Zero our padding to keep our output deterministic
+
+		raw_buffer_header* buffer_header = safe_ptr_cast<raw_buffer_header>(buffer);
+		bundle_header* header = safe_ptr_cast<bundle_header>(buffer + sizeof(raw_buffer_header));
+
+		header->tag = static_cast<uint32_t>(buffer_tag32::compressed_bundle);
+		header->version = compressed_tracks_version16::latest;
+		header->padding = 0;
+		header->num_clips = num_compressed_tracks;
+		header->num_tracks = first_tracks.get_num_tracks();
+		header->entries_offset = entries_offset;
+
+		pack_entry* entries = safe_ptr_cast<pack_entry>(buffer + entries_offset);
+
+		uint64_t tracks_offset = tracks_start_offset;
+		for (uint32_t tracks_index = 0; tracks_index < num_compressed_tracks; ++tracks_index)
+		{
+			const compressed_tracks* tracks = compressed_tracks_list[tracks_index];
+
+			tracks_offset = align_to(tracks_offset, k_compressed_tracks_preferred_alignment);
+
+			// The first clip retains its metadata for everyone else
+			if (tracks_index == 0)
+				std::memcpy(buffer + tracks_offset, tracks, tracks->get_size());
+			else
+				write_bundle_stripped_tracks(*tracks, buffer + tracks_offset);
+
+			const uint32_t tracks_size = reinterpret_cast<const compressed_tracks*>(buffer + tracks_offset)->get_size();
+
+			entries[tracks_index].tracks_offset = tracks_offset;
+			entries[tracks_index].tracks_size = tracks_size;
+
+			tracks_offset += tracks_size;
+		}
+
+		buffer_header->size = bundle_size;
+		buffer_header->hash = hash_raw_buffer(header->version, buffer + sizeof(raw_buffer_header), bundle_size - sizeof(raw_buffer_header));	// Hash everything but the raw buffer header
+
+		out_bundle = reinterpret_cast<compressed_bundle*>(buffer);
+		ACL_ASSERT(out_bundle->is_valid(true).empty(), "Failed to build compressed bundle");
+
+		return error_result();
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
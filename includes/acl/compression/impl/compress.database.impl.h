@@ -32,8 +32,14 @@
 #include "acl/core/error_result.h"
 #include "acl/core/hash.h"
 #include "acl/core/iallocator.h"
+#include "acl/core/impl/database_chunk_coding.h"
+#include "acl/compression/compression_settings.h"
+#include "acl/compression/database_build_stream.h"
+#include "acl/compression/impl/compression_jobs.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 
 namespace acl
 {
@@ -41,6 +47,32 @@ namespace acl
 
 	namespace acl_impl
 	{
+		// Returns the animated data of a database segment, the size in bits of its frames, and the offset in bits of its first frame
+		// Transform segments own their animated data while scalar tracks share theirs between every segment
+		inline void get_database_segment_animated_data(const compressed_tracks& tracks, uint32_t segment_index, const uint8_t*& out_animated_data, uint32_t& out_frame_bit_size, uint32_t& out_first_frame_bit_offset)
+		{
+			if (tracks.get_track_type() == track_type8::qvvf)
+			{
+				const transform_tracks_header& transforms_header = get_transform_tracks_header(tracks);
+				const segment_header& header = transforms_header.get_segment_headers()[segment_index];
+
+				const uint8_t* format_per_track_data;
+				const uint8_t* range_data;
+				transforms_header.get_segment_data(header, format_per_track_data, range_data, out_animated_data);
+
+				out_frame_bit_size = header.animated_pose_bit_size;
+				out_first_frame_bit_offset = 0;
+			}
+			else
+			{
+				const scalar_tracks_header& scalars_header = get_scalar_tracks_header(tracks);
+
+				out_animated_data = scalars_header.get_track_animated_values();
+				out_frame_bit_size = scalars_header.num_bits_per_frame;
+				out_first_frame_bit_offset = get_database_segment_start_index(tracks, segment_index) * scalars_header.num_bits_per_frame;
+			}
+		}
+
 		struct frame_tier_mapping
 		{
 			const uint8_t* animated_data;			// Pointer to the segment's animated data which contains this frame
@@ -50,6 +82,7 @@ namespace acl
 			uint32_t clip_frame_index;
 			uint32_t segment_frame_index;
 			uint32_t frame_bit_size;				// Size in bits of this frame
+			uint32_t frame_bit_offset;				// Offset in bits of this frame within the animated data
 
 			float contributing_error;
 		};
@@ -67,6 +100,10 @@ namespace acl
 		struct segment_contriguting_error
 		{
 			const frame_contributing_error* errors;	// List of frame contributing errors for this segment, sorted lowest first
+			const uint8_t* animated_data;			// Animated data of this segment, null while its clip isn't resident
+			uint32_t start_frame_index;				// Clip frame index of the first frame in this segment
+			uint32_t frame_bit_size;				// Size in bits of every frame in this segment
+			uint32_t first_frame_bit_offset;		// Offset in bits of the first frame within the animated data
 			uint32_t num_frames;					// Total number of frames in this segment
 			uint32_t num_movable;					// Number of frames that can be moved
 			uint32_t num_assigned;					// Number of frames already assigned
@@ -75,6 +112,7 @@ namespace acl
 		struct clip_contributing_error
 		{
 			segment_contriguting_error* segments;
+			frame_contributing_error* owned_errors;	// Copy of the clip contributing errors when the clip doesn't remain resident, otherwise null
 			uint32_t num_segments;
 			uint32_t num_frames;					// Number of frames
 			uint32_t num_assigned;					// Number of frames already assigned
@@ -87,7 +125,7 @@ namespace acl
 			const compressed_tracks* const* compressed_tracks_list;
 			uint32_t num_compressed_tracks;
 
-			database_tier_mapping mappings[k_num_quality_tiers];		// 0 = high importance, 1 = medium importance, 2 = low importance
+			database_tier_mapping mappings[k_num_quality_tiers];		// 0 = high importance, 1 = medium importance, k_num_database_tiers = low importance
 			uint32_t num_movable_frames;
 
 			clip_contributing_error* contributing_error_per_clip;
@@ -99,51 +137,18 @@ namespace acl
 				, num_movable_frames(num_movable_frames_)
 				, contributing_error_per_clip(allocate_type_array<clip_contributing_error>(allocator_, num_compressed_tracks_))
 			{
-				mappings[0].tier = quality_tier::highest_importance;
-				mappings[1].tier = quality_tier::medium_importance;
-				mappings[2].tier = quality_tier::lowest_importance;
+				for (uint32_t tier_index = 0; tier_index < k_num_quality_tiers; ++tier_index)
+					mappings[tier_index].tier = quality_tier(tier_index);
 
 				// Setup our error metadata to make iterating on it easier and track what has been assigned
+				// Clips that aren't provided up front are setup later with initialize_clip(..)
 				for (uint32_t list_index = 0; list_index < num_compressed_tracks_; ++list_index)
 				{
 					const compressed_tracks* tracks = compressed_tracks_list_[list_index];
-					const tracks_header& header = get_tracks_header(*tracks);
-					const transform_tracks_header& transform_header = get_transform_tracks_header(*tracks);
-					const bool has_multiple_segments = transform_header.has_multiple_segments();
-					const uint32_t* segment_start_indices = has_multiple_segments ? transform_header.get_segment_start_indices() : nullptr;
-					const optional_metadata_header& metadata_header = get_optional_metadata_header(*tracks);
-					const frame_contributing_error* contributing_errors = metadata_header.get_contributing_error(*tracks);
-
-					const uint32_t num_segments = has_multiple_segments ? transform_header.num_segments : 1;	// HACK to avoid static analysis warning
-
-					clip_contributing_error& clip_error = contributing_error_per_clip[list_index];
-					clip_error.segments = allocate_type_array<segment_contriguting_error>(allocator_, num_segments);
-					clip_error.num_segments = num_segments;
-					clip_error.num_frames = 0;
-					clip_error.num_assigned = 0;
-
-					for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
-					{
-						const uint32_t segment_start_frame_index = has_multiple_segments ? segment_start_indices[segment_index] : 0;
-
-						uint32_t num_segment_frames;
-						if (num_segments == 1)
-							num_segment_frames = header.num_samples;	// Only one segment, it has every frame
-						else if (segment_index + 1 == num_segments)
-							num_segment_frames = header.num_samples - segment_start_indices[segment_index];	// Last segment has the remaining frames
-						else
-							num_segment_frames = segment_start_indices[segment_index + 1] - segment_start_indices[segment_index];
-
-						const uint32_t num_movable = num_segment_frames >= 2 ? (num_segment_frames - 2) : 0;
-
-						segment_contriguting_error& segment_error = clip_error.segments[segment_index];
-						segment_error.errors = contributing_errors + segment_start_frame_index;
-						segment_error.num_frames = num_segment_frames;
-						segment_error.num_movable = num_movable;
-						segment_error.num_assigned = 0;
-
-						clip_error.num_frames += num_segment_frames;
-					}
+					if (tracks != nullptr)
+						initialize_clip(list_index, *tracks, false);
+					else
+						contributing_error_per_clip[list_index] = clip_contributing_error{};
 				}
 			}
 
@@ -153,13 +158,87 @@ namespace acl
 					deallocate_type_array(allocator, mappings[tier_index].frames, mappings[tier_index].num_frames);
 
 				for (uint32_t list_index = 0; list_index < num_compressed_tracks; ++list_index)
-					deallocate_type_array(allocator, contributing_error_per_clip[list_index].segments, contributing_error_per_clip[list_index].num_segments);
+				{
+					clip_contributing_error& clip_error = contributing_error_per_clip[list_index];
+					deallocate_type_array(allocator, clip_error.owned_errors, clip_error.num_frames);
+					deallocate_type_array(allocator, clip_error.segments, clip_error.num_segments);
+				}
 				deallocate_type_array(allocator, contributing_error_per_clip, num_compressed_tracks);
 			}
 
 			frame_assignment_context(const frame_assignment_context&) = delete;
 			frame_assignment_context& operator=(const frame_assignment_context&) = delete;
 
+			// Sets up the error metadata of a clip
+			// When the clip doesn't remain resident, its contributing errors are copied and its animated data
+			// must be resolved with resolve_clip_animated_data(..) once it is resident again
+			void initialize_clip(uint32_t list_index, const compressed_tracks& tracks, bool copy_contributing_errors)
+			{
+				const optional_metadata_header& metadata_header = get_optional_metadata_header(tracks);
+				const frame_contributing_error* contributing_errors = metadata_header.get_contributing_error(tracks);
+
+				const uint32_t num_segments = get_num_database_segments(tracks);
+				const uint32_t num_frames = get_tracks_header(tracks).num_samples;
+
+				clip_contributing_error& clip_error = contributing_error_per_clip[list_index];
+				clip_error.segments = allocate_type_array<segment_contriguting_error>(allocator, num_segments);
+				clip_error.owned_errors = nullptr;
+				clip_error.num_segments = num_segments;
+				clip_error.num_frames = 0;
+				clip_error.num_assigned = 0;
+
+				if (copy_contributing_errors)
+				{
+					clip_error.owned_errors = allocate_type_array<frame_contributing_error>(allocator, num_frames);
+					std::memcpy(clip_error.owned_errors, contributing_errors, sizeof(frame_contributing_error) * num_frames);
+					contributing_errors = clip_error.owned_errors;
+				}
+
+				for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+				{
+					const uint32_t segment_start_frame_index = get_database_segment_start_index(tracks, segment_index);
+					const uint32_t num_segment_frames = get_database_segment_num_samples(tracks, segment_index);
+					const uint32_t num_movable = num_segment_frames >= 2 ? (num_segment_frames - 2) : 0;
+
+					segment_contriguting_error& segment_error = clip_error.segments[segment_index];
+					segment_error.errors = contributing_errors + segment_start_frame_index;
+					get_database_segment_animated_data(tracks, segment_index, segment_error.animated_data, segment_error.frame_bit_size, segment_error.first_frame_bit_offset);
+					segment_error.start_frame_index = segment_start_frame_index;
+					segment_error.num_frames = num_segment_frames;
+					segment_error.num_movable = num_movable;
+					segment_error.num_assigned = 0;
+
+					if (copy_contributing_errors)
+						segment_error.animated_data = nullptr;	// The clip won't remain resident
+
+					clip_error.num_frames += num_segment_frames;
+				}
+
+				ACL_ASSERT(clip_error.num_frames == num_frames, "Unexpected number of frames");
+			}
+
+			// Updates the animated data of the frames of a clip that is resident again, see initialize_clip(..)
+			void resolve_clip_animated_data(uint32_t list_index, const compressed_tracks& tracks)
+			{
+				clip_contributing_error& clip_error = contributing_error_per_clip[list_index];
+				for (uint32_t segment_index = 0; segment_index < clip_error.num_segments; ++segment_index)
+				{
+					uint32_t frame_bit_size;
+					uint32_t first_frame_bit_offset;
+					get_database_segment_animated_data(tracks, segment_index, clip_error.segments[segment_index].animated_data, frame_bit_size, first_frame_bit_offset);
+				}
+
+				// Frames are sorted by clip, ours are contiguous
+				const auto is_before_clip = [list_index](const frame_tier_mapping& frame) { return frame.tracks_index < list_index; };
+
+				for (database_tier_mapping& tier_mapping : mappings)
+				{
+					frame_tier_mapping* frames_end = tier_mapping.frames + tier_mapping.num_frames;
+					for (frame_tier_mapping* frame = std::partition_point(tier_mapping.frames, frames_end, is_before_clip); frame < frames_end && frame->tracks_index == list_index; ++frame)
+						frame->animated_data = clip_error.segments[frame->segment_index].animated_data;
+				}
+			}
+
 			database_tier_mapping& get_tier_mapping(quality_tier tier) { return mappings[(uint32_t)tier]; }
 			const database_tier_mapping& get_tier_mapping(quality_tier tier) const { return mappings[(uint32_t)tier]; }
 
@@ -196,17 +275,16 @@ namespace acl
 			for (uint32_t list_index = 0; list_index < num_compressed_tracks; ++list_index)
 			{
 				const compressed_tracks* tracks = compressed_tracks_list[list_index];
-
-				const tracks_header& header = get_tracks_header(*tracks);
-				const transform_tracks_header& transform_header = get_transform_tracks_header(*tracks);
+				const uint32_t num_segments = get_num_database_segments(*tracks);
 
 				// A frame is movable if it isn't the first or last frame of a segment
-				// If we have more than 1 frame, we can remove 2 frames per segment
-				// We know that the only way to get a segment with 1 frame is if the whole clip contains
-				// a single frame and thus has one segment
-				// If we have 0 or 1 frame, none are movable
-				if (header.num_samples >= 2)
-					num_movable_frames += header.num_samples - (transform_header.num_segments * 2);
+				// If a segment has 0 or 1 frame, none are movable
+				for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+				{
+					const uint32_t num_segment_frames = get_database_segment_num_samples(*tracks, segment_index);
+					if (num_segment_frames >= 2)
+						num_movable_frames += num_segment_frames - 2;
+				}
 			}
 
 			return num_movable_frames;
@@ -217,12 +295,7 @@ namespace acl
 			uint32_t num_segments = 0;
 
 			for (uint32_t list_index = 0; list_index < num_compressed_tracks; ++list_index)
-			{
-				const compressed_tracks* tracks = compressed_tracks_list[list_index];
-				const transform_tracks_header& transform_header = get_transform_tracks_header(*tracks);
-
-				num_segments += transform_header.num_segments;
-			}
+				num_segments += get_num_database_segments(*compressed_tracks_list[list_index]);
 
 			return num_segments;
 		}
@@ -238,15 +311,9 @@ namespace acl
 				// Iterate over every segment and find the one with the frame that has the lowest contributing error to assign to this tier
 				for (uint32_t list_index = 0; list_index < context.num_compressed_tracks; ++list_index)
 				{
-					const compressed_tracks* tracks = context.compressed_tracks_list[list_index];
-					const transform_tracks_header& transforms_header = get_transform_tracks_header(*tracks);
-					const bool has_multiple_segments = transforms_header.has_multiple_segments();
-					const uint32_t* segment_start_indices = has_multiple_segments ? transforms_header.get_segment_start_indices() : nullptr;
-					const segment_header* segment_headers = transforms_header.get_segment_headers();
-
 					const clip_contributing_error& clip_error = context.contributing_error_per_clip[list_index];
 
-					for (uint32_t segment_index = 0; segment_index < transforms_header.num_segments; ++segment_index)
+					for (uint32_t segment_index = 0; segment_index < clip_error.num_segments; ++segment_index)
 					{
 						const segment_contriguting_error& segment_error = clip_error.segments[segment_index];
 
@@ -261,18 +328,12 @@ namespace acl
 						if (contributing_error.error <= best_mapping.contributing_error)
 						{
 							// This frame has a lower error, use it
-							const uint8_t* format_per_track_data;
-							const uint8_t* range_data;
-							const uint8_t* animated_data;
-							transforms_header.get_segment_data(segment_headers[segment_index], format_per_track_data, range_data, animated_data);
-
-							const uint32_t segment_start_frame_index = has_multiple_segments ? segment_start_indices[segment_index] : 0;
-
-							best_mapping.animated_data = animated_data;
+							best_mapping.animated_data = segment_error.animated_data;
 							best_mapping.tracks_index = list_index;
 							best_mapping.segment_index = segment_index;
-							best_mapping.frame_bit_size = segment_headers[segment_index].animated_pose_bit_size;
-							best_mapping.clip_frame_index = segment_start_frame_index + contributing_error.index;
+							best_mapping.frame_bit_size = segment_error.frame_bit_size;
+							best_mapping.frame_bit_offset = segment_error.first_frame_bit_offset + (contributing_error.index * segment_error.frame_bit_size);
+							best_mapping.clip_frame_index = segment_error.start_frame_index + contributing_error.index;
 							best_mapping.segment_frame_index = contributing_error.index;
 							best_mapping.contributing_error = contributing_error.error;
 						}
@@ -316,11 +377,9 @@ namespace acl
 
 		inline void assign_frames_to_tiers(frame_assignment_context& context)
 		{
-			// Assign frames to our lowest importance tier first
-			assign_frames_to_tier(context, context.get_tier_mapping(quality_tier::lowest_importance));
-
-			// Assign frames to our medium importance tier next
-			assign_frames_to_tier(context, context.get_tier_mapping(quality_tier::medium_importance));
+			// Assign frames to our lowest importance tier first, then to every database tier in order of increasing importance
+			for (uint32_t tier_index = k_num_database_tiers; tier_index >= 1; --tier_index)
+				assign_frames_to_tier(context, context.get_tier_mapping(quality_tier(tier_index)));
 
 			// Then our high importance tier
 			assign_frames_to_tier(context, context.get_tier_mapping(quality_tier::highest_importance));
@@ -335,6 +394,32 @@ namespace acl
 #endif
 		}
 
+		// Splits the frames between the quality tiers following our settings and assigns every frame to its tier
+		inline void assign_frames_to_tiers(frame_assignment_context& context, const compression_database_settings& settings, uint32_t num_frames)
+		{
+			const uint32_t num_movable_frames = context.num_movable_frames;
+
+			// Calculate how many frames we'll move to every tier, starting with the lowest importance tier
+			uint32_t num_database_frames = 0;
+			for (uint32_t tier_index = k_num_database_tiers; tier_index >= 1; --tier_index)
+			{
+				const quality_tier tier = quality_tier(tier_index);
+				const uint32_t num_tier_frames = std::min<uint32_t>(num_movable_frames - num_database_frames, uint32_t(settings.get_tier_proportion(tier) * float(num_frames)));
+				context.set_tier_num_frames(tier, num_tier_frames);
+				num_database_frames += num_tier_frames;
+			}
+
+			ACL_ASSERT(num_database_frames <= num_movable_frames, "Cannot move out more frames than we have");
+
+			// Non-movable frames end up being high importance and remain in the compressed clip
+			const uint32_t num_high_importance_frames = num_frames - num_database_frames;
+
+			context.set_tier_num_frames(quality_tier::highest_importance, num_high_importance_frames);
+
+			// Assign every frame to its tier
+			assign_frames_to_tiers(context);
+		}
+
 		inline uint32_t find_first_metadata_offset(const optional_metadata_header& header)
 		{
 			if (header.track_list_name.is_valid())
@@ -422,21 +507,126 @@ namespace acl
 			return ~0U;
 		}
 
-		inline uint32_t build_sample_indices(const database_tier_mapping& tier_mapping, uint32_t tracks_index, uint32_t segment_index)
+		// The metadata retained when frames are moved or stripped, the contributing error is no longer needed
+		struct stripped_metadata_layout
+		{
+			uint32_t track_list_name_size;
+			uint32_t track_names_size;
+			uint32_t parent_track_indices_size;
+			uint32_t track_descriptions_size;
+			uint32_t size;							// Total size, 0 when nothing is retained
+		};
+
+		inline stripped_metadata_layout calculate_stripped_metadata_layout(const optional_metadata_header& input_metadata_header)
+		{
+			stripped_metadata_layout layout;
+			layout.track_list_name_size = get_metadata_track_list_name_size(input_metadata_header);
+			layout.track_names_size = get_metadata_track_names_size(input_metadata_header);
+			layout.parent_track_indices_size = get_metadata_parent_track_indices_size(input_metadata_header);
+			layout.track_descriptions_size = get_metadata_track_descriptions_size(input_metadata_header);
+
+			uint32_t metadata_size = 0;
+			metadata_size += layout.track_list_name_size;
+			metadata_size = align_to(metadata_size, 4);
+			metadata_size += layout.track_names_size;
+			metadata_size = align_to(metadata_size, 4);
+			metadata_size += layout.parent_track_indices_size;
+			metadata_size = align_to(metadata_size, 4);
+			metadata_size += layout.track_descriptions_size;
+
+			layout.size = metadata_size;
+			return layout;
+		}
+
+		// Writes the retained metadata starting at the provided offset, relative to the start of the output compressed tracks
+		inline void write_stripped_metadata(const stripped_metadata_layout& layout, uint32_t metadata_start_offset, const compressed_tracks& input_tracks, optional_metadata_header& metadata_header, compressed_tracks& output_tracks)
+		{
+			const optional_metadata_header& input_metadata_header = get_optional_metadata_header(input_tracks);
+			uint32_t metadata_offset = metadata_start_offset;	// Relative to the start of our compressed_tracks
+
+			// Setup our metadata offsets
+			if (layout.track_list_name_size != 0)
+			{
+				metadata_header.track_list_name = metadata_offset;
+				metadata_offset += layout.track_list_name_size;
+			}
+			else
+				metadata_header.track_list_name = invalid_ptr_offset();
+
+			if (layout.track_names_size != 0)
+			{
+				metadata_header.track_name_offsets = metadata_offset;
+				metadata_offset += layout.track_names_size;
+			}
+			else
+				metadata_header.track_name_offsets = invalid_ptr_offset();
+
+			if (layout.parent_track_indices_size != 0)
+			{
+				metadata_header.parent_track_indices = metadata_offset;
+				metadata_offset += layout.parent_track_indices_size;
+			}
+			else
+				metadata_header.parent_track_indices = invalid_ptr_offset();
+
+			if (layout.track_descriptions_size != 0)
+			{
+				metadata_header.track_descriptions = metadata_offset;
+				metadata_offset += layout.track_descriptions_size;
+			}
+			else
+				metadata_header.track_descriptions = invalid_ptr_offset();
+
+			// Strip the contributing error data, no longer needed
+			metadata_header.contributing_error = invalid_ptr_offset();
+
+			ACL_ASSERT((metadata_offset - metadata_start_offset) == layout.size, "Unexpected metadata size"); (void)metadata_offset;
+
+			// Copy our metadata, it does not change
+			std::memcpy(metadata_header.get_track_list_name(output_tracks), input_metadata_header.get_track_list_name(input_tracks), layout.track_list_name_size);
+			std::memcpy(metadata_header.get_track_name_offsets(output_tracks), input_metadata_header.get_track_name_offsets(input_tracks), layout.track_names_size);
+			std::memcpy(metadata_header.get_parent_track_indices(output_tracks), input_metadata_header.get_parent_track_indices(input_tracks), layout.parent_track_indices_size);
+			std::memcpy(metadata_header.get_track_descriptions(output_tracks), input_metadata_header.get_track_descriptions(input_tracks), layout.track_descriptions_size);
+		}
+
+		// Returns a pointer to the first frame of the given segment and the number of frames contained
+		// Frames are sorted by clip, by segment, then by segment frame index which allows us to binary search them
+		inline const frame_tier_mapping* find_segment_frames(const database_tier_mapping& tier_mapping, uint32_t tracks_index, uint32_t segment_index, uint32_t& out_num_frames)
 		{
-			// TODO: Binary search our first entry and bail out once done?
+			const auto is_before_segment = [tracks_index, segment_index](const frame_tier_mapping& frame)
+			{
+				return frame.tracks_index < tracks_index || (frame.tracks_index == tracks_index && frame.segment_index < segment_index);
+			};
+
+			const auto is_segment_frame = [tracks_index, segment_index](const frame_tier_mapping& frame)
+			{
+				return frame.tracks_index == tracks_index && frame.segment_index == segment_index;
+			};
+
+			const frame_tier_mapping* frames_end = tier_mapping.frames + tier_mapping.num_frames;
+			const frame_tier_mapping* first_frame = std::partition_point(static_cast<const frame_tier_mapping*>(tier_mapping.frames), frames_end, is_before_segment);
+			const frame_tier_mapping* last_frame = std::find_if_not(first_frame, frames_end, is_segment_frame);
+
+			if (first_frame == last_frame)
+			{
+				// This segment doesn't contain any frames
+				out_num_frames = 0;
+				return nullptr;
+			}
+
+			out_num_frames = uint32_t(last_frame - first_frame);
+			return first_frame;
+		}
 
+		// Returns a bitset with the which frames are present in this segment
+		inline uint32_t build_sample_indices(const frame_tier_mapping* frames, uint32_t num_frames)
+		{
 			const bitset_description desc = bitset_description::make_from_num_bits<32>();
 
 			uint32_t sample_indices = 0;
-			for (uint32_t frame_index = 0; frame_index < tier_mapping.num_frames; ++frame_index)
+			for (uint32_t frame_index = 0; frame_index < num_frames; ++frame_index)
 			{
-				const frame_tier_mapping& frame = tier_mapping.frames[frame_index];
-				if (frame.tracks_index != tracks_index)
-					continue;	// This is not the tracks instance we care about
-
-				if (frame.segment_index != segment_index)
-					continue;	// This is not the segment we care about
+				const frame_tier_mapping& frame = frames[frame_index];
 
 				bitset_set(&sample_indices, desc, frame.segment_frame_index, true);
 			}
@@ -444,6 +634,14 @@ namespace acl
 			return sample_indices;
 		}
 
+		inline uint32_t build_sample_indices(const database_tier_mapping& tier_mapping, uint32_t tracks_index, uint32_t segment_index)
+		{
+			uint32_t num_segment_frames;
+			const frame_tier_mapping* segment_frames = find_segment_frames(tier_mapping, tracks_index, segment_index, num_segment_frames);
+
+			return build_sample_indices(segment_frames, num_segment_frames);
+		}
+
 		inline void rewrite_segment_headers(const database_tier_mapping& tier_mapping, uint32_t tracks_index, const transform_tracks_header& input_transforms_header, const segment_header* headers, uint32_t segment_data_base_offset, stripped_segment_header_t* out_headers)
 		{
 			const bitset_description desc = bitset_description::make_from_num_bits<32>();
@@ -515,356 +713,577 @@ namespace acl
 				std::memcpy(output_range_data, input_range_data, range_data_size);
 
 				// Populate our new animated data from our sorted frame mapping data
+				uint32_t num_segment_frames;
+				const frame_tier_mapping* segment_frames = find_segment_frames(tier_mapping, tracks_index, segment_index, num_segment_frames);
+
 				uint64_t output_animated_bit_offset = 0;
-				for (uint32_t frame_index = 0; frame_index < tier_mapping.num_frames; ++frame_index)
+				for (uint32_t frame_index = 0; frame_index < num_segment_frames; ++frame_index)
 				{
-					const frame_tier_mapping& frame = tier_mapping.frames[frame_index];
-					if (frame.tracks_index != tracks_index)
-						continue;	// This is not the tracks instance we care about
-
-					if (frame.segment_index != segment_index)
-						continue;	// This is not the segment we care about
+					const frame_tier_mapping& frame = segment_frames[frame_index];
 
 					// Append this frame
-					const uint32_t input_animated_bit_offset = frame.segment_frame_index * frame.frame_bit_size;
-					memcpy_bits(output_animated_data, output_animated_bit_offset, input_animated_data, input_animated_bit_offset, frame.frame_bit_size);
+					memcpy_bits(output_animated_data, output_animated_bit_offset, frame.animated_data, frame.frame_bit_offset, frame.frame_bit_size);
 					output_animated_bit_offset += frame.frame_bit_size;
 				}
 			}
 		}
 
-		inline void build_compressed_tracks(const frame_assignment_context& context, compressed_tracks** out_compressed_tracks)
+		// Validates that the compressed track instances can have their frames moved or stripped with their contributing error
+		inline error_result validate_contributing_error_tracks(const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks)
 		{
-			const bitset_description desc = bitset_description::make_from_num_bits<32>();
-
-			const database_tier_mapping& tier_mapping = context.get_tier_mapping(quality_tier::highest_importance);
-			uint32_t clip_header_offset = 0;
+			if (compressed_tracks_list == nullptr || num_compressed_tracks == 0)
+				return error_result("No compressed track list provided");
 
-			for (uint32_t list_index = 0; list_index < context.num_compressed_tracks; ++list_index)
+			for (uint32_t list_index = 0; list_index < num_compressed_tracks; ++list_index)
 			{
-				const compressed_tracks* input_tracks = context.compressed_tracks_list[list_index];
-				const clip_contributing_error& clip_error = context.contributing_error_per_clip[list_index];
-
-				const tracks_header& input_header = get_tracks_header(*input_tracks);
-				const transform_tracks_header& input_transforms_header = get_transform_tracks_header(*input_tracks);
-				const segment_header* input_segment_headers = input_transforms_header.get_segment_headers();
-				const optional_metadata_header& input_metadata_header = get_optional_metadata_header(*input_tracks);
+				const compressed_tracks* tracks = compressed_tracks_list[list_index];
+				if (tracks == nullptr)
+					return error_result("Compressed track list contains a null entry");
 
-				const uint32_t num_sub_tracks_per_bone = input_header.get_has_scale() ? 3 : 2;
+				const error_result tracks_result = tracks->is_valid(false);
+				if (tracks_result.any())
+					return error_result("Compressed track instance is invalid");
 
-				// Calculate how many sub-track packed entries we have
-				// Each sub-track is 2 bits packed within a 32 bit entry
-				// For each sub-track type, we round up to simplify bookkeeping
-				// For example, if we have 3 tracks made up of rotation/translation we'll have one entry for each with unused padding
-				// All rotation types come first, followed by all translation types, and with scale types at the end when present
-				const uint32_t num_sub_track_entries = ((input_header.num_tracks + k_num_sub_tracks_per_packed_entry - 1) / k_num_sub_tracks_per_packed_entry) * num_sub_tracks_per_bone;
-				const uint32_t packed_sub_track_buffer_size = num_sub_track_entries * sizeof(packed_sub_track_types);
+				if (tracks->has_database())
+					return error_result("Compressed track instance is already bound to a database");
 
-				// Adding an extra index at the end to delimit things, the index is always invalid: 0xFFFFFFFF
-				const uint32_t segment_start_indices_size = clip_error.num_segments > 1 ? (uint32_t(sizeof(uint32_t)) * (clip_error.num_segments + 1)) : 0;
-				const uint32_t segment_headers_size = sizeof(stripped_segment_header_t) * clip_error.num_segments;
+				if (tracks->has_stripped_keyframes())
+					return error_result("Compressed track instance has keyframes stripped");
 
-				// Range data follows constant data, use that to calculate our size
-				const uint32_t constant_data_size = (uint32_t)input_transforms_header.clip_range_data_offset - (uint32_t)input_transforms_header.constant_track_data_offset;
+				const tracks_header& header = get_tracks_header(*tracks);
+				if (!header.get_has_metadata())
+					return error_result("Compressed track instance does not contain any metadata");
 
-				// The data from our first segment follows the clip range data, use that to calculate our size
-				const uint32_t clip_range_data_size = (uint32_t)input_segment_headers[0].segment_data - (uint32_t)input_transforms_header.clip_range_data_offset;
+				const optional_metadata_header& metadata_header = get_optional_metadata_header(*tracks);
+				if (!metadata_header.contributing_error.is_valid())
+					return error_result("Compressed track instance does not contain contributing error metadata");
+			}
 
-				// Calculate the new size of our clip
-				uint32_t buffer_size = 0;
+			return error_result();
+		}
 
-				// Per clip data
-				buffer_size += sizeof(raw_buffer_header);							// Header
-				buffer_size += sizeof(tracks_header);								// Header
-				buffer_size += sizeof(transform_tracks_header);						// Header
+		struct movable_frame_cost
+		{
+			float contributing_error;
+			uint32_t frame_bit_size;
+		};
 
-				buffer_size = align_to(buffer_size, 4);								// Align segment start indices
-				buffer_size += segment_start_indices_size;							// Segment start indices
-				buffer_size = align_to(buffer_size, 4);								// Align segment headers
-				buffer_size += segment_headers_size;								// Segment headers
+		// Finds how many of the movable frames with the lowest contributing error we need to strip to fit within the target size
+		// Every movable frame is stripped if that isn't enough
+		inline uint32_t calculate_num_frames_to_strip(const frame_assignment_context& context, uint64_t target_size)
+		{
+			uint64_t current_size = 0;
+			for (uint32_t list_index = 0; list_index < context.num_compressed_tracks; ++list_index)
+				current_size += context.compressed_tracks_list[list_index]->get_size();
 
-				buffer_size = align_to(buffer_size, 4);								// Align database header
-				buffer_size += sizeof(tracks_database_header);						// Database header
+			if (current_size <= target_size || context.num_movable_frames == 0)
+				return 0;	// Already fits
 
-				buffer_size = align_to(buffer_size, 4);								// Align sub-track types
-				buffer_size += packed_sub_track_buffer_size;						// Packed sub-track types sorted by type
-				buffer_size = align_to(buffer_size, 4);								// Align constant track data
-				buffer_size += constant_data_size;									// Constant track data
-				buffer_size = align_to(buffer_size, 4);								// Align range data
-				buffer_size += clip_range_data_size;								// Range data
+			movable_frame_cost* movable_frames = allocate_type_array<movable_frame_cost>(context.allocator, context.num_movable_frames);
+			uint32_t num_movable_frames = 0;
 
-				uint32_t num_remaining_keyframes = 0;
+			for (uint32_t list_index = 0; list_index < context.num_compressed_tracks; ++list_index)
+			{
+				const compressed_tracks& tracks = *context.compressed_tracks_list[list_index];
+				const clip_contributing_error& clip_error = context.contributing_error_per_clip[list_index];
 
-				// Per segment data
-				for (uint32_t segment_index = 0; segment_index < input_transforms_header.num_segments; ++segment_index)
+				for (uint32_t segment_index = 0; segment_index < clip_error.num_segments; ++segment_index)
 				{
-					const uint8_t* format_per_track_data;
-					const uint8_t* range_data;
 					const uint8_t* animated_data;
-					input_transforms_header.get_segment_data(input_segment_headers[segment_index], format_per_track_data, range_data, animated_data);
+					uint32_t frame_bit_size;
+					uint32_t first_frame_bit_offset;
+					get_database_segment_animated_data(tracks, segment_index, animated_data, frame_bit_size, first_frame_bit_offset);
+
+					// Errors are sorted lowest first and the first and last frames of a segment come last with an infinite error
+					const segment_contriguting_error& segment_error = clip_error.segments[segment_index];
+					for (uint32_t frame_index = 0; frame_index < segment_error.num_movable; ++frame_index)
+						movable_frames[num_movable_frames++] = { segment_error.errors[frame_index].error, frame_bit_size };
+				}
+			}
 
-					// Range data, whether present or not, follows the per track metadata, use it to calculate our size
-					const uint32_t format_per_track_data_size = uint32_t(range_data - format_per_track_data);
+			ACL_ASSERT(num_movable_frames == context.num_movable_frames, "Unexpected number of movable frames");
 
-					// Animated data follows the range data (present or not), use it to calculate our size
-					const uint32_t range_data_size = uint32_t(animated_data - range_data);
+			// We usually strip a fraction of our movable frames, pop them from a min-heap instead of sorting them all
+			const auto heap_predicate = [](const movable_frame_cost& lhs, const movable_frame_cost& rhs) { return lhs.contributing_error > rhs.contributing_error; };
+			std::make_heap(movable_frames, movable_frames + num_movable_frames, heap_predicate);
 
-					buffer_size += format_per_track_data_size;				// Format per track data
+			// Strip the cheapest frames first until we fit
+			uint64_t num_stripped_bits = 0;
+			uint32_t num_frames_to_strip = 0;
+			while (num_frames_to_strip < num_movable_frames && (current_size - (num_stripped_bits / 8)) > target_size)
+			{
+				std::pop_heap(movable_frames, movable_frames + (num_movable_frames - num_frames_to_strip), heap_predicate);
+				num_stripped_bits += movable_frames[num_movable_frames - num_frames_to_strip - 1].frame_bit_size;
+				num_frames_to_strip++;
+			}
 
-					// TODO: Alignment only necessary with 16bit per component (segment constant tracks), need to fix scalar decoding path
-					buffer_size = align_to(buffer_size, 2);					// Align range data
-					buffer_size += range_data_size;							// Range data
+			deallocate_type_array(context.allocator, movable_frames, context.num_movable_frames);
 
-					// Check our data mapping to find our how many frames we'll retain
-					const uint32_t sample_indices = build_sample_indices(tier_mapping, list_index, segment_index);
-					const uint32_t num_animated_frames = bitset_count_set_bits(&sample_indices, desc);
-					const uint32_t animated_data_size = ((num_animated_frames * input_segment_headers[segment_index].animated_pose_bit_size) + 7) / 8;
+			return num_frames_to_strip;
+		}
 
-					num_remaining_keyframes += num_animated_frames;
+		// Builds a new compressed transform track instance with the high importance tier data, see build_compressed_tracks_entry(..)
+		inline void build_transform_compressed_tracks_entry(const frame_assignment_context& context, bool bind_to_database, uint32_t list_index, uint32_t clip_header_offset, compressed_tracks** out_compressed_tracks)
+		{
+			const bitset_description desc = bitset_description::make_from_num_bits<32>();
 
-					// TODO: Variable bit rate doesn't need alignment
-					buffer_size = align_to(buffer_size, 4);					// Align animated data
-					buffer_size += animated_data_size;						// Animated track data
-				}
+			const database_tier_mapping& tier_mapping = context.get_tier_mapping(quality_tier::highest_importance);
 
-				const uint32_t num_stripped_keyframes = input_header.num_samples - num_remaining_keyframes;
-
-				// Optional metadata
-				const uint32_t metadata_start_offset = align_to(buffer_size, 4);
-				const uint32_t metadata_track_list_name_size = get_metadata_track_list_name_size(input_metadata_header);
-				const uint32_t metadata_track_names_size = get_metadata_track_names_size(input_metadata_header);
-				const uint32_t metadata_parent_track_indices_size = get_metadata_parent_track_indices_size(input_metadata_header);
-				const uint32_t metadata_track_descriptions_size = get_metadata_track_descriptions_size(input_metadata_header);
-				const uint32_t metadata_contributing_error_size = 0;	// We'll strip it!
-
-				uint32_t metadata_size = 0;
-				metadata_size += metadata_track_list_name_size;
-				metadata_size = align_to(metadata_size, 4);
-				metadata_size += metadata_track_names_size;
-				metadata_size = align_to(metadata_size, 4);
-				metadata_size += metadata_parent_track_indices_size;
-				metadata_size = align_to(metadata_size, 4);
-				metadata_size += metadata_track_descriptions_size;
-				metadata_size = align_to(metadata_size, 4);
-				metadata_size += metadata_contributing_error_size;
-
-				if (metadata_size != 0)
-				{
-					buffer_size = align_to(buffer_size, 4);
-					buffer_size += metadata_size;
+			const compressed_tracks* input_tracks = context.compressed_tracks_list[list_index];
+			const clip_contributing_error& clip_error = context.contributing_error_per_clip[list_index];
 
-					buffer_size = align_to(buffer_size, 4);
-					buffer_size += sizeof(optional_metadata_header);
-				}
-				else
-					buffer_size += 15;	// Ensure we have sufficient padding for unaligned 16 byte loads
+			const tracks_header& input_header = get_tracks_header(*input_tracks);
+			const transform_tracks_header& input_transforms_header = get_transform_tracks_header(*input_tracks);
+			const segment_header* input_segment_headers = input_transforms_header.get_segment_headers();
+			const optional_metadata_header& input_metadata_header = get_optional_metadata_header(*input_tracks);
 
-				// Allocate our new buffer
-				uint8_t* buffer = allocate_type_array_aligned<uint8_t>(context.allocator, buffer_size, alignof(compressed_tracks));
-				std::memset(buffer, 0, buffer_size);
+			const uint32_t num_sub_tracks_per_bone = input_header.get_has_scale() ? 3 : 2;
 
-				uint8_t* buffer_start = buffer;
-				out_compressed_tracks[list_index] = reinterpret_cast<compressed_tracks*>(buffer);
+			// Calculate how many sub-track packed entries we have
+			// Each sub-track is 2 bits packed within a 32 bit entry
+			// For each sub-track type, we round up to simplify bookkeeping
+			// For example, if we have 3 tracks made up of rotation/translation we'll have one entry for each with unused padding
+			// All rotation types come first, followed by all translation types, and with scale types at the end when present
+			const uint32_t num_sub_track_entries = ((input_header.num_tracks + k_num_sub_tracks_per_packed_entry - 1) / k_num_sub_tracks_per_packed_entry) * num_sub_tracks_per_bone;
+			const uint32_t packed_sub_track_buffer_size = num_sub_track_entries * sizeof(packed_sub_track_types);
 
-				raw_buffer_header* buffer_header = safe_ptr_cast<raw_buffer_header>(buffer);
-				buffer += sizeof(raw_buffer_header);
+			// Adding an extra index at the end to delimit things, the index is always invalid: 0xFFFFFFFF
+			const uint32_t segment_start_indices_size = clip_error.num_segments > 1 ? (uint32_t(sizeof(uint32_t)) * (clip_error.num_segments + 1)) : 0;
+			const uint32_t segment_headers_size = sizeof(stripped_segment_header_t) * clip_error.num_segments;
 
-				tracks_header* header = safe_ptr_cast<tracks_header>(buffer);
-				buffer += sizeof(tracks_header);
+			// Range data follows constant data, use that to calculate our size
+			const uint32_t constant_data_size = (uint32_t)input_transforms_header.clip_range_data_offset - (uint32_t)input_transforms_header.constant_track_data_offset;
 
-				// Copy our header and update the parts that change
-				std::memcpy(header, &input_header, sizeof(tracks_header));
+			// The data from our first segment follows the clip range data, use that to calculate our size
+			const uint32_t clip_range_data_size = (uint32_t)input_segment_headers[0].segment_data - (uint32_t)input_transforms_header.clip_range_data_offset;
 
-				header->set_has_database(true);
-				header->set_has_stripped_keyframes(num_stripped_keyframes != 0);
-				header->set_has_metadata(metadata_size != 0);
+			// Calculate the new size of our clip
+			uint32_t buffer_size = 0;
 
-				transform_tracks_header* transforms_header = safe_ptr_cast<transform_tracks_header>(buffer);
-				buffer += sizeof(transform_tracks_header);
+			// Per clip data
+			buffer_size += sizeof(raw_buffer_header);							// Header
+			buffer_size += sizeof(tracks_header);								// Header
+			buffer_size += sizeof(transform_tracks_header);						// Header
 
-				// Copy our header and update the parts that change
-				std::memcpy(transforms_header, &input_transforms_header, sizeof(transform_tracks_header));
+			buffer_size = align_to(buffer_size, 4);								// Align segment start indices
+			buffer_size += segment_start_indices_size;							// Segment start indices
+			buffer_size = align_to(buffer_size, 4);								// Align segment headers
+			buffer_size += segment_headers_size;								// Segment headers
 
-				const uint32_t segment_start_indices_offset = align_to<uint32_t>(sizeof(transform_tracks_header), 4);	// Relative to the start of our transform_tracks_header
-				transforms_header->database_header_offset = align_to(segment_start_indices_offset + segment_start_indices_size, 4);
-				transforms_header->segment_headers_offset = align_to(transforms_header->database_header_offset + uint32_t(sizeof(tracks_database_header)), 4);
-				transforms_header->sub_track_types_offset = align_to(transforms_header->segment_headers_offset + segment_headers_size, 4);
-				transforms_header->constant_track_data_offset = align_to(transforms_header->sub_track_types_offset + packed_sub_track_buffer_size, 4);
-				transforms_header->clip_range_data_offset = align_to(transforms_header->constant_track_data_offset + constant_data_size, 4);
+			if (bind_to_database)
+			{
+				buffer_size = align_to(buffer_size, 4);							// Align database header
+				buffer_size += sizeof(tracks_database_header);					// Database header
+			}
 
-				// Copy our segment start indices, they do not change
-				if (input_transforms_header.has_multiple_segments())
-					std::memcpy(transforms_header->get_segment_start_indices(), input_transforms_header.get_segment_start_indices(), segment_start_indices_size);
+			buffer_size = align_to(buffer_size, 4);								// Align sub-track types
+			buffer_size += packed_sub_track_buffer_size;						// Packed sub-track types sorted by type
+			buffer_size = align_to(buffer_size, 4);								// Align constant track data
+			buffer_size += constant_data_size;									// Constant track data
+			buffer_size = align_to(buffer_size, 4);								// Align range data
+			buffer_size += clip_range_data_size;								// Range data
 
-				// Setup our database header
-				tracks_database_header* tracks_db_header = transforms_header->get_database_header();
-				tracks_db_header->clip_header_offset = clip_header_offset;
+			uint32_t num_remaining_keyframes = 0;
 
-				// Update our clip header offset
-				clip_header_offset += sizeof(database_runtime_clip_header);
-				clip_header_offset += sizeof(database_runtime_segment_header) * input_transforms_header.num_segments;
+			// Per segment data
+			for (uint32_t segment_index = 0; segment_index < input_transforms_header.num_segments; ++segment_index)
+			{
+				const uint8_t* format_per_track_data;
+				const uint8_t* range_data;
+				const uint8_t* animated_data;
+				input_transforms_header.get_segment_data(input_segment_headers[segment_index], format_per_track_data, range_data, animated_data);
 
-				// Write our new segment headers
-				const uint32_t segment_data_base_offset = transforms_header->clip_range_data_offset + clip_range_data_size;
-				rewrite_segment_headers(tier_mapping, list_index, input_transforms_header, input_segment_headers, segment_data_base_offset, transforms_header->get_stripped_segment_headers());
+				// Range data, whether present or not, follows the per track metadata, use it to calculate our size
+				const uint32_t format_per_track_data_size = uint32_t(range_data - format_per_track_data);
 
-				// Copy our sub-track types, they do not change
-				std::memcpy(transforms_header->get_sub_track_types(), input_transforms_header.get_sub_track_types(), packed_sub_track_buffer_size);
+				// Animated data follows the range data (present or not), use it to calculate our size
+				const uint32_t range_data_size = uint32_t(animated_data - range_data);
 
-				// Copy our constant track data, it does not change
-				std::memcpy(transforms_header->get_constant_track_data(), input_transforms_header.get_constant_track_data(), constant_data_size);
+				buffer_size += format_per_track_data_size;				// Format per track data
 
-				// Copy our clip range data, it does not change
-				std::memcpy(transforms_header->get_clip_range_data(), input_transforms_header.get_clip_range_data(), clip_range_data_size);
+				// TODO: Alignment only necessary with 16bit per component (segment constant tracks), need to fix scalar decoding path
+				buffer_size = align_to(buffer_size, 2);					// Align range data
+				buffer_size += range_data_size;							// Range data
 
-				// Write our new segment data
-				rewrite_segment_data(tier_mapping, list_index, input_transforms_header, input_segment_headers, *transforms_header, transforms_header->get_stripped_segment_headers());
+				// Check our data mapping to find our how many frames we'll retain
+				const uint32_t sample_indices = build_sample_indices(tier_mapping, list_index, segment_index);
+				const uint32_t num_animated_frames = bitset_count_set_bits(&sample_indices, desc);
+				const uint32_t animated_data_size = ((num_animated_frames * input_segment_headers[segment_index].animated_pose_bit_size) + 7) / 8;
 
-				if (metadata_size != 0)
-				{
-					optional_metadata_header* metadata_header = reinterpret_cast<optional_metadata_header*>(buffer_start + buffer_size - sizeof(optional_metadata_header));
-					uint32_t metadata_offset = metadata_start_offset;	// Relative to the start of our compressed_tracks
+				num_remaining_keyframes += num_animated_frames;
 
-					// Setup our metadata offsets
-					if (metadata_track_list_name_size != 0)
-					{
-						metadata_header->track_list_name = metadata_offset;
-						metadata_offset += metadata_track_list_name_size;
-					}
-					else
-						metadata_header->track_list_name = invalid_ptr_offset();
+				// TODO: Variable bit rate doesn't need alignment
+				buffer_size = align_to(buffer_size, 4);					// Align animated data
+				buffer_size += animated_data_size;						// Animated track data
+			}
 
-					if (metadata_track_names_size != 0)
-					{
-						metadata_header->track_name_offsets = metadata_offset;
-						metadata_offset += metadata_track_names_size;
-					}
-					else
-						metadata_header->track_name_offsets = invalid_ptr_offset();
+			const uint32_t num_stripped_keyframes = input_header.num_samples - num_remaining_keyframes;
 
-					if (metadata_parent_track_indices_size != 0)
-					{
-						metadata_header->parent_track_indices = metadata_offset;
-						metadata_offset += metadata_parent_track_indices_size;
-					}
-					else
-						metadata_header->parent_track_indices = invalid_ptr_offset();
+			if (!bind_to_database && num_stripped_keyframes == 0)
+			{
+				// Nothing to strip, our stripped segment headers would be needless
+				const uint32_t input_size = input_tracks->get_size();
+				uint8_t* buffer = allocate_type_array_aligned<uint8_t>(context.allocator, input_size, k_compressed_tracks_preferred_alignment);
+				std::memcpy(buffer, input_tracks, input_size);
 
-					if (metadata_track_descriptions_size != 0)
-					{
-						metadata_header->track_descriptions = metadata_offset;
-						metadata_offset += metadata_track_descriptions_size;
-					}
-					else
-						metadata_header->track_descriptions = invalid_ptr_offset();
+				out_compressed_tracks[list_index] = reinterpret_cast<compressed_tracks*>(buffer);
+				return;
+			}
 
-					// Strip the contributing error data, no longer needed
-					metadata_header->contributing_error = invalid_ptr_offset();
+			// Optional metadata
+			const uint32_t metadata_start_offset = align_to(buffer_size, 4);
+			const stripped_metadata_layout metadata_layout = calculate_stripped_metadata_layout(input_metadata_header);
+			const uint32_t metadata_size = metadata_layout.size;
 
-					ACL_ASSERT((metadata_offset - metadata_start_offset) == metadata_size, "Unexpected metadata size");
+			if (metadata_size != 0)
+			{
+				buffer_size = align_to(buffer_size, 4);
+				buffer_size += metadata_size;
 
-					// Copy our metadata, it does not change
-					std::memcpy(metadata_header->get_track_list_name(*out_compressed_tracks[list_index]), input_metadata_header.get_track_list_name(*input_tracks), metadata_track_list_name_size);
-					std::memcpy(metadata_header->get_track_name_offsets(*out_compressed_tracks[list_index]), input_metadata_header.get_track_name_offsets(*input_tracks), metadata_track_names_size);
-					std::memcpy(metadata_header->get_parent_track_indices(*out_compressed_tracks[list_index]), input_metadata_header.get_parent_track_indices(*input_tracks), metadata_parent_track_indices_size);
-					std::memcpy(metadata_header->get_track_descriptions(*out_compressed_tracks[list_index]), input_metadata_header.get_track_descriptions(*input_tracks), metadata_track_descriptions_size);
-				}
+				buffer_size = align_to(buffer_size, 4);
+				buffer_size += sizeof(optional_metadata_header);
+			}
+			else
+				buffer_size += 15;	// Ensure we have sufficient padding for unaligned 16 byte loads
 
-				// Finish the compressed tracks raw buffer header
-				buffer_header->size = buffer_size;
-				buffer_header->hash = hash32(safe_ptr_cast<const uint8_t>(header), buffer_size - sizeof(raw_buffer_header));	// Hash everything but the raw buffer header
+			// Allocate our new buffer
+			uint8_t* buffer = allocate_type_array_aligned<uint8_t>(context.allocator, buffer_size, k_compressed_tracks_preferred_alignment);
+			std::memset(buffer, 0, buffer_size);
 
-				ACL_ASSERT(out_compressed_tracks[list_index]->is_valid(true).empty(), "Failed to build compressed tracks");
-			}
-		}
+			uint8_t* buffer_start = buffer;
+			out_compressed_tracks[list_index] = reinterpret_cast<compressed_tracks*>(buffer);
 
-		// Returns the number of clips written
-		inline uint32_t write_database_clip_metadata(const compressed_tracks* const* db_compressed_tracks_list, uint32_t num_tracks, database_clip_metadata* clip_metadatas)
-		{
-			if (clip_metadatas == nullptr)
-				return num_tracks;	// Nothing to write
+			raw_buffer_header* buffer_header = safe_ptr_cast<raw_buffer_header>(buffer);
+			buffer += sizeof(raw_buffer_header);
 
-			uint32_t clip_header_offset = 0;
+			tracks_header* header = safe_ptr_cast<tracks_header>(buffer);
+			buffer += sizeof(tracks_header);
 
-			for (uint32_t tracks_index = 0; tracks_index < num_tracks; ++tracks_index)
-			{
-				const compressed_tracks* tracks = db_compressed_tracks_list[tracks_index];
+			// Copy our header and update the parts that change
+			std::memcpy(header, &input_header, sizeof(tracks_header));
 
-				database_clip_metadata& clip_metadata = clip_metadatas[tracks_index];
-				clip_metadata.clip_hash = tracks->get_hash();
-				clip_metadata.clip_header_offset = clip_header_offset;
+			header->set_has_database(bind_to_database);
+			header->set_has_stripped_keyframes(num_stripped_keyframes != 0);
+			header->set_has_metadata(metadata_size != 0);
 
-				const transform_tracks_header& transforms_header = get_transform_tracks_header(*tracks);
-				clip_header_offset += sizeof(database_runtime_clip_header) + sizeof(database_runtime_segment_header) * transforms_header.num_segments;
+			transform_tracks_header* transforms_header = safe_ptr_cast<transform_tracks_header>(buffer);
+			buffer += sizeof(transform_tracks_header);
+
+			// Copy our header and update the parts that change
+			std::memcpy(transforms_header, &input_transforms_header, sizeof(transform_tracks_header));
+
+			const uint32_t segment_start_indices_offset = align_to<uint32_t>(sizeof(transform_tracks_header), 4);	// Relative to the start of our transform_tracks_header
+			if (bind_to_database)
+			{
+				transforms_header->database_header_offset = align_to(segment_start_indices_offset + segment_start_indices_size, 4);
+				transforms_header->segment_headers_offset = align_to(transforms_header->database_header_offset + uint32_t(sizeof(tracks_database_header)), 4);
+			}
+			else
+			{
+				transforms_header->database_header_offset = invalid_ptr_offset();
+				transforms_header->segment_headers_offset = align_to(segment_start_indices_offset + segment_start_indices_size, 4);
 			}
 
-			return num_tracks;
-		}
+			transforms_header->sub_track_types_offset = align_to(transforms_header->segment_headers_offset + segment_headers_size, 4);
+			transforms_header->constant_track_data_offset = align_to(transforms_header->sub_track_types_offset + packed_sub_track_buffer_size, 4);
+			transforms_header->clip_range_data_offset = align_to(transforms_header->constant_track_data_offset + constant_data_size, 4);
 
-		// Returns a pointer to the first frame of the given segment and the number of frames contained
-		inline const frame_tier_mapping* find_segment_frames(const database_tier_mapping& tier_mapping, uint32_t tracks_index, uint32_t segment_index, uint32_t& out_num_frames)
-		{
-			for (uint32_t frame_index = 0; frame_index < tier_mapping.num_frames; ++frame_index)
+			// Copy our segment start indices, they do not change
+			if (input_transforms_header.has_multiple_segments())
+				std::memcpy(transforms_header->get_segment_start_indices(), input_transforms_header.get_segment_start_indices(), segment_start_indices_size);
+
+			if (bind_to_database)
 			{
-				const frame_tier_mapping& frame = tier_mapping.frames[frame_index];
-				if (frame.tracks_index != tracks_index)
-					continue;	// This is not the tracks instance we care about
+				// Setup our database header
+				tracks_database_header* tracks_db_header = transforms_header->get_database_header();
+				tracks_db_header->clip_header_offset = clip_header_offset;
+			}
 
-				if (frame.segment_index != segment_index)
-					continue;	// This is not the segment we care about
+			// Write our new segment headers
+			const uint32_t segment_data_base_offset = transforms_header->clip_range_data_offset + clip_range_data_size;
+			rewrite_segment_headers(tier_mapping, list_index, input_transforms_header, input_segment_headers, segment_data_base_offset, transforms_header->get_stripped_segment_headers());
 
-				// Found our first frame, count how many we have
-				uint32_t num_segment_frames = 0;
-				for (uint32_t frame_index2 = frame_index; frame_index2 < tier_mapping.num_frames; ++frame_index2)
-				{
-					const frame_tier_mapping& frame2 = tier_mapping.frames[frame_index2];
-					if (frame2.tracks_index != tracks_index)
-						break;	// This is not the tracks instance we care about
+			// Copy our sub-track types, they do not change
+			std::memcpy(transforms_header->get_sub_track_types(), input_transforms_header.get_sub_track_types(), packed_sub_track_buffer_size);
 
-					if (frame2.segment_index != segment_index)
-						break;	// This is not the segment we care about
+			// Copy our constant track data, it does not change
+			std::memcpy(transforms_header->get_constant_track_data(), input_transforms_header.get_constant_track_data(), constant_data_size);
 
-					num_segment_frames++;
-				}
+			// Copy our clip range data, it does not change
+			std::memcpy(transforms_header->get_clip_range_data(), input_transforms_header.get_clip_range_data(), clip_range_data_size);
 
-				// Done
-				out_num_frames = num_segment_frames;
-				return &frame;
-			}
+			// Write our new segment data
+			rewrite_segment_data(tier_mapping, list_index, input_transforms_header, input_segment_headers, *transforms_header, transforms_header->get_stripped_segment_headers());
 
-			// This segment doesn't contain any frames
-			out_num_frames = 0;
-			return nullptr;
-		}
+			if (metadata_size != 0)
+			{
+				optional_metadata_header* metadata_header = reinterpret_cast<optional_metadata_header*>(buffer_start + buffer_size - sizeof(optional_metadata_header));
+				write_stripped_metadata(metadata_layout, metadata_start_offset, *input_tracks, *metadata_header, *out_compressed_tracks[list_index]);
+			}
 
-		// Returns the number of bits contained in the segment animated data
-		inline uint32_t calculate_segment_animated_data_bit_size(const frame_tier_mapping* frames, uint32_t num_frames)
-		{
-			if (num_frames == 0)
-				return 0;	// Empty segment
+			// Finish the compressed tracks raw buffer header
+			buffer_header->size = buffer_size;
+			buffer_header->hash = hash_raw_buffer(header->version, safe_ptr_cast<const uint8_t>(header), buffer_size - sizeof(raw_buffer_header));	// Hash everything but the raw buffer header
 
-			// Every frame in a segment has the same size
-			return frames->frame_bit_size * num_frames;
+			ACL_ASSERT(out_compressed_tracks[list_index]->is_valid(true).empty(), "Failed to build compressed tracks");
 		}
 
-		// Returns a bitset with the which frames are present in this segment
-		inline uint32_t build_sample_indices(const frame_tier_mapping* frames, uint32_t num_frames)
+		// Builds a new compressed scalar track instance with the high importance tier data, see build_compressed_tracks_entry(..)
+		// Our database headers are inserted after the scalar headers, the data that follows is unchanged
+		// except for the animated values where only the retained frames remain
+		inline void build_scalar_compressed_tracks_entry(const frame_assignment_context& context, bool bind_to_database, uint32_t list_index, uint32_t clip_header_offset, compressed_tracks** out_compressed_tracks)
 		{
 			const bitset_description desc = bitset_description::make_from_num_bits<32>();
 
-			uint32_t sample_indices = 0;
-			for (uint32_t frame_index = 0; frame_index < num_frames; ++frame_index)
-			{
-				const frame_tier_mapping& frame = frames[frame_index];
+			const database_tier_mapping& tier_mapping = context.get_tier_mapping(quality_tier::highest_importance);
 
-				bitset_set(&sample_indices, desc, frame.segment_frame_index, true);
-			}
+			const compressed_tracks* input_tracks = context.compressed_tracks_list[list_index];
+			const clip_contributing_error& clip_error = context.contributing_error_per_clip[list_index];
 
-			return sample_indices;
-		}
+			const tracks_header& input_header = get_tracks_header(*input_tracks);
+			const scalar_tracks_header& input_scalars_header = get_scalar_tracks_header(*input_tracks);
+			const optional_metadata_header& input_metadata_header = get_optional_metadata_header(*input_tracks);
 
-		// Returns the number of bytes written
-		inline uint32_t write_tier_segment_data(const frame_tier_mapping* frames, uint32_t num_frames, uint8_t* out_segment_data)
+			const uint32_t num_segments = clip_error.num_segments;
+			const uint32_t num_bits_per_frame = input_scalars_header.num_bits_per_frame;
+
+			// Our headers are followed by the per track metadata and everything up to the animated values, it does not change
+			const uint32_t scalar_headers_size = uint32_t(input_scalars_header.metadata_per_track);
+			const uint32_t packed_data_size = uint32_t(input_scalars_header.track_animated_values) - uint32_t(input_scalars_header.metadata_per_track);
+
+			// Our database headers are inserted in between, everything that follows moves by the same amount
+			// Every header is a multiple of 4 bytes which retains the alignment of the data that follows
+			const uint32_t segment_headers_size = uint32_t(sizeof(scalar_database_segment_header)) * num_segments;
+			const uint32_t database_headers_size = uint32_t(sizeof(scalar_database_header)) + segment_headers_size + (bind_to_database ? uint32_t(sizeof(tracks_database_header)) : 0);
+
+			// Check our data mapping to find our how many frames we'll retain
+			uint32_t num_remaining_keyframes = 0;
+			for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+			{
+				const uint32_t sample_indices = build_sample_indices(tier_mapping, list_index, segment_index);
+				num_remaining_keyframes += bitset_count_set_bits(&sample_indices, desc);
+			}
+
+			const uint32_t num_stripped_keyframes = input_header.num_samples - num_remaining_keyframes;
+
+			if (!bind_to_database && num_stripped_keyframes == 0)
+			{
+				// Nothing to strip, our database headers would be needless
+				const uint32_t input_size = input_tracks->get_size();
+				uint8_t* buffer = allocate_type_array_aligned<uint8_t>(context.allocator, input_size, k_compressed_tracks_preferred_alignment);
+				std::memcpy(buffer, input_tracks, input_size);
+
+				out_compressed_tracks[list_index] = reinterpret_cast<compressed_tracks*>(buffer);
+				return;
+			}
+
+			const uint32_t animated_values_size = ((num_remaining_keyframes * num_bits_per_frame) + 7) / 8;
+
+			// Calculate the new size of our clip
+			uint32_t buffer_size = 0;
+			buffer_size += sizeof(raw_buffer_header);							// Header
+			buffer_size += sizeof(tracks_header);								// Header
+			buffer_size += scalar_headers_size;									// Scalar and segments headers
+			buffer_size += database_headers_size;								// Database headers
+			buffer_size += packed_data_size;									// Per track metadata, constant, and range values
+			buffer_size += animated_values_size;								// Animated values
+
+			// Optional metadata
+			const uint32_t metadata_start_offset = align_to(buffer_size, 4);
+			const stripped_metadata_layout metadata_layout = calculate_stripped_metadata_layout(input_metadata_header);
+			const uint32_t metadata_size = metadata_layout.size;
+
+			if (metadata_size != 0)
+			{
+				buffer_size = align_to(buffer_size, 4);
+				buffer_size += metadata_size;
+
+				buffer_size = align_to(buffer_size, 4);
+				buffer_size += sizeof(optional_metadata_header);
+			}
+			else
+				buffer_size += 15;	// Ensure we have sufficient padding for unaligned 16 byte loads
+
+			// Allocate our new buffer
+			uint8_t* buffer = allocate_type_array_aligned<uint8_t>(context.allocator, buffer_size, k_compressed_tracks_preferred_alignment);
+			std::memset(buffer, 0, buffer_size);
+
+			uint8_t* buffer_start = buffer;
+			out_compressed_tracks[list_index] = reinterpret_cast<compressed_tracks*>(buffer);
+
+			raw_buffer_header* buffer_header = safe_ptr_cast<raw_buffer_header>(buffer);
+			buffer += sizeof(raw_buffer_header);
+
+			tracks_header* header = safe_ptr_cast<tracks_header>(buffer);
+			buffer += sizeof(tracks_header);
+
+			// Copy our header and update the parts that change
+			std::memcpy(header, &input_header, sizeof(tracks_header));
+
+			header->set_has_database(bind_to_database);
+			header->set_has_stripped_keyframes(num_stripped_keyframes != 0);
+			header->set_has_metadata(metadata_size != 0);
+
+			// Copy our scalar and segments headers and update the offsets that move
+			scalar_tracks_header* scalars_header = safe_ptr_cast<scalar_tracks_header>(buffer);
+			std::memcpy(scalars_header, &input_scalars_header, scalar_headers_size);
+
+			scalars_header->metadata_per_track = uint32_t(input_scalars_header.metadata_per_track) + database_headers_size;
+			scalars_header->track_constant_values = uint32_t(input_scalars_header.track_constant_values) + database_headers_size;
+			scalars_header->track_range_values = uint32_t(input_scalars_header.track_range_values) + database_headers_size;
+			scalars_header->track_animated_values = uint32_t(input_scalars_header.track_animated_values) + database_headers_size;
+
+			if (header->get_has_scalar_segments())
+			{
+				scalar_segments_header& segments_header = *reinterpret_cast<scalar_segments_header*>(scalars_header + 1);
+				segments_header.segment_range_values = uint32_t(segments_header.segment_range_values) + database_headers_size;
+			}
+
+			// Setup our database headers
+			scalar_database_header& database_header = get_scalar_database_header(*out_compressed_tracks[list_index]);
+			database_header.segment_headers_offset = scalar_headers_size + uint32_t(sizeof(scalar_database_header));
+
+			if (bind_to_database)
+			{
+				database_header.database_header_offset = uint32_t(database_header.segment_headers_offset) + segment_headers_size;
+
+				tracks_database_header* tracks_db_header = database_header.get_database_header(*scalars_header);
+				tracks_db_header->clip_header_offset = clip_header_offset;
+			}
+			else
+				database_header.database_header_offset = invalid_ptr_offset();
+
+			// Copy our per track metadata, constant values, and range values, they do not change
+			std::memcpy(scalars_header->get_track_metadata(), input_scalars_header.get_track_metadata(), packed_data_size);
+
+			// Write our segment headers and the retained frames, every frame has the same size
+			scalar_database_segment_header* segment_headers = database_header.get_segment_headers(*scalars_header);
+			uint8_t* animated_values = scalars_header->get_track_animated_values();
+			uint32_t sample_offset = 0;
+
+			for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+			{
+				uint32_t num_segment_frames;
+				const frame_tier_mapping* segment_frames = find_segment_frames(tier_mapping, list_index, segment_index, num_segment_frames);
+
+				segment_headers[segment_index].sample_indices = build_sample_indices(segment_frames, num_segment_frames);
+				segment_headers[segment_index].sample_offset = sample_offset;
+
+				for (uint32_t frame_index = 0; frame_index < num_segment_frames; ++frame_index)
+				{
+					const frame_tier_mapping& frame = segment_frames[frame_index];
+					memcpy_bits(animated_values, uint64_t(sample_offset) * num_bits_per_frame, frame.animated_data, frame.frame_bit_offset, frame.frame_bit_size);
+					sample_offset++;
+				}
+			}
+
+			ACL_ASSERT(sample_offset == num_remaining_keyframes, "Unexpected number of frames written");
+
+			if (metadata_size != 0)
+			{
+				optional_metadata_header* metadata_header = reinterpret_cast<optional_metadata_header*>(buffer_start + buffer_size - sizeof(optional_metadata_header));
+				write_stripped_metadata(metadata_layout, metadata_start_offset, *input_tracks, *metadata_header, *out_compressed_tracks[list_index]);
+			}
+
+			// Finish the compressed tracks raw buffer header
+			buffer_header->size = buffer_size;
+			buffer_header->hash = hash_raw_buffer(header->version, safe_ptr_cast<const uint8_t>(header), buffer_size - sizeof(raw_buffer_header));	// Hash everything but the raw buffer header
+
+			ACL_ASSERT(out_compressed_tracks[list_index]->is_valid(true).empty(), "Failed to build compressed tracks");
+		}
+
+		// Builds a new compressed track instance with the high importance tier data
+		// When it is not bound to a database, the remaining frames are stripped and a compressed track instance
+		// without stripped frames is duplicated as is
+		inline void build_compressed_tracks_entry(const frame_assignment_context& context, bool bind_to_database, uint32_t list_index, uint32_t clip_header_offset, compressed_tracks** out_compressed_tracks)
+		{
+			if (context.compressed_tracks_list[list_index]->get_track_type() == track_type8::qvvf)
+				build_transform_compressed_tracks_entry(context, bind_to_database, list_index, clip_header_offset, out_compressed_tracks);
+			else
+				build_scalar_compressed_tracks_entry(context, bind_to_database, list_index, clip_header_offset, out_compressed_tracks);
+		}
+
+		// Returns the size of the runtime headers of a clip within a database
+		inline uint32_t get_database_runtime_clip_headers_size(uint32_t num_segments)
+		{
+			return uint32_t(sizeof(database_runtime_clip_header) + sizeof(database_runtime_segment_header) * num_segments);
+		}
+
+		// Writes the runtime clip header offset of every compressed track instance, they are laid out in clip order
+		inline void calculate_clip_header_offsets(const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks, uint32_t* out_clip_header_offsets)
+		{
+			uint32_t clip_header_offset = 0;
+			for (uint32_t list_index = 0; list_index < num_compressed_tracks; ++list_index)
+			{
+				out_clip_header_offsets[list_index] = clip_header_offset;
+
+				clip_header_offset += get_database_runtime_clip_headers_size(get_num_database_segments(*compressed_tracks_list[list_index]));
+			}
+		}
+
+		// Builds our new compressed track instances with the high importance tier data, see above
+		// Every instance is independent and they are built concurrently when a job scheduler is provided
+		// When bound to a database, each instance uses the provided runtime clip header offset
+		inline void build_compressed_tracks(const frame_assignment_context& context, bool bind_to_database, const uint32_t* clip_header_offsets, const compression_job_scheduler& job_scheduler, compressed_tracks** out_compressed_tracks)
+		{
+			const auto build_entry = [&context, bind_to_database, clip_header_offsets, out_compressed_tracks](uint32_t list_index)
+			{
+				build_compressed_tracks_entry(context, bind_to_database, list_index, clip_header_offsets[list_index], out_compressed_tracks);
+			};
+
+			execute_compression_jobs(job_scheduler, context.num_compressed_tracks, build_entry);
+		}
+
+		// Builds our new compressed track instances with the high importance tier data
+		// When they are not bound to a database, the remaining frames are stripped and compressed track instances
+		// without stripped frames are duplicated as is
+		inline void build_compressed_tracks(const frame_assignment_context& context, bool bind_to_database, const compression_job_scheduler& job_scheduler, compressed_tracks** out_compressed_tracks)
+		{
+			const uint32_t num_compressed_tracks = context.num_compressed_tracks;
+
+			// The runtime clip headers are laid out in clip order, find where each clip's header lives up front
+			uint32_t* clip_header_offsets = allocate_type_array<uint32_t>(context.allocator, num_compressed_tracks);
+			calculate_clip_header_offsets(context.compressed_tracks_list, num_compressed_tracks, clip_header_offsets);
+
+			build_compressed_tracks(context, bind_to_database, clip_header_offsets, job_scheduler, out_compressed_tracks);
+
+			deallocate_type_array(context.allocator, clip_header_offsets, num_compressed_tracks);
+		}
+
+		// Returns the number of clips written
+		inline uint32_t write_database_clip_metadata(const compressed_tracks* const* db_compressed_tracks_list, uint32_t num_tracks, database_clip_metadata* clip_metadatas)
+		{
+			if (clip_metadatas == nullptr)
+				return num_tracks;	// Nothing to write
+
+			uint32_t clip_header_offset = 0;
+
+			for (uint32_t tracks_index = 0; tracks_index < num_tracks; ++tracks_index)
+			{
+				const compressed_tracks* tracks = db_compressed_tracks_list[tracks_index];
+
+				database_clip_metadata& clip_metadata = clip_metadatas[tracks_index];
+				clip_metadata.clip_hash = tracks->get_hash();
+				clip_metadata.clip_header_offset = clip_header_offset;
+
+				clip_header_offset += get_database_runtime_clip_headers_size(get_num_database_segments(*tracks));
+			}
+
+			return num_tracks;
+		}
+
+		// Returns the number of bits contained in the segment animated data
+		inline uint32_t calculate_segment_animated_data_bit_size(const frame_tier_mapping* frames, uint32_t num_frames)
+		{
+			if (num_frames == 0)
+				return 0;	// Empty segment
+
+			// Every frame in a segment has the same size
+			return frames->frame_bit_size * num_frames;
+		}
+
+		// Returns the number of bytes written
+		inline uint32_t write_tier_segment_data(const frame_tier_mapping* frames, uint32_t num_frames, uint8_t* out_segment_data)
 		{
 			uint64_t num_bits_written = 0;
 
@@ -872,8 +1291,7 @@ namespace acl
 			{
 				const frame_tier_mapping& frame = frames[frame_index];
 
-				const uint32_t frame_bit_offset = frame.segment_frame_index * frame.frame_bit_size;
-				memcpy_bits(out_segment_data, num_bits_written, frame.animated_data, frame_bit_offset, frame.frame_bit_size);
+				memcpy_bits(out_segment_data, num_bits_written, frame.animated_data, frame.frame_bit_offset, frame.frame_bit_size);
 				num_bits_written += frame.frame_bit_size;
 			}
 
@@ -897,10 +1315,9 @@ namespace acl
 
 			for (uint32_t tracks_index = 0; tracks_index < context.num_compressed_tracks; ++tracks_index)
 			{
-				const compressed_tracks* tracks = context.compressed_tracks_list[tracks_index];
-				const transform_tracks_header& transforms_header = get_transform_tracks_header(*tracks);
+				const uint32_t num_segments = context.contributing_error_per_clip[tracks_index].num_segments;
 
-				for (uint32_t segment_index = 0; segment_index < transforms_header.num_segments; ++segment_index)
+				for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
 				{
 					uint32_t num_segment_frames;
 					const frame_tier_mapping* segment_frames = find_segment_frames(tier_mapping, tracks_index, segment_index, num_segment_frames);
@@ -946,6 +1363,66 @@ namespace acl
 			return num_chunks;
 		}
 
+		// Writes the range of chunks used by every clip for the provided tier
+		inline void write_database_clip_chunk_ranges(const frame_assignment_context& context, const compression_database_settings& settings, quality_tier tier, database_clip_chunk_range* clip_chunk_ranges)
+		{
+			ACL_ASSERT(tier != quality_tier::highest_importance, "No chunks for the high importance tier");
+			const uint32_t tier_index = uint32_t(tier) - 1;
+
+			const database_tier_mapping& tier_mapping = context.get_tier_mapping(tier);
+			if (tier_mapping.is_empty())
+			{
+				// No data
+				for (uint32_t tracks_index = 0; tracks_index < context.num_compressed_tracks; ++tracks_index)
+				{
+					clip_chunk_ranges[tracks_index].first_chunk_index[tier_index] = 0;
+					clip_chunk_ranges[tracks_index].num_chunks[tier_index] = 0;
+				}
+
+				return;
+			}
+
+			const uint32_t max_chunk_size = settings.max_chunk_size;
+			const uint32_t simd_padding = 15;
+
+			// Must match the chunk delimitations of 'write_database_chunk_descriptions'
+			uint32_t chunk_size = sizeof(database_chunk_header);
+			uint32_t chunk_index = 0;
+
+			for (uint32_t tracks_index = 0; tracks_index < context.num_compressed_tracks; ++tracks_index)
+			{
+				const uint32_t num_segments = context.contributing_error_per_clip[tracks_index].num_segments;
+
+				uint32_t first_chunk_index = ~0U;
+
+				for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+				{
+					uint32_t num_segment_frames;
+					const frame_tier_mapping* segment_frames = find_segment_frames(tier_mapping, tracks_index, segment_index, num_segment_frames);
+
+					const uint32_t segment_data_bit_size = calculate_segment_animated_data_bit_size(segment_frames, num_segment_frames);
+					const uint32_t segment_data_size = (segment_data_bit_size + 7) / 8;
+
+					const uint32_t new_chunk_size = chunk_size + segment_data_size + simd_padding + sizeof(database_chunk_segment_header);
+					if (new_chunk_size >= max_chunk_size)
+					{
+						// Chunk is full, start a new one
+						chunk_size = sizeof(database_chunk_header);
+						chunk_index++;
+					}
+
+					if (first_chunk_index == ~0U)
+						first_chunk_index = chunk_index;
+
+					chunk_size += segment_data_size + sizeof(database_chunk_segment_header);
+				}
+
+				database_clip_chunk_range& clip_chunk_range = clip_chunk_ranges[tracks_index];
+				clip_chunk_range.first_chunk_index[tier_index] = first_chunk_index != ~0U ? first_chunk_index : chunk_index;
+				clip_chunk_range.num_chunks[tier_index] = first_chunk_index != ~0U ? (chunk_index - first_chunk_index + 1) : 0;
+			}
+		}
+
 		// Returns the size of the bulk data
 		inline uint32_t write_database_bulk_data(const frame_assignment_context& context, const compression_database_settings& settings, quality_tier tier, const compressed_tracks* const* db_compressed_tracks_list, uint8_t* bulk_data)
 		{
@@ -982,11 +1459,11 @@ namespace acl
 			for (uint32_t tracks_index = 0; tracks_index < context.num_compressed_tracks; ++tracks_index)
 			{
 				const compressed_tracks* tracks = db_compressed_tracks_list[tracks_index];
-				const transform_tracks_header& transforms_header = get_transform_tracks_header(*tracks);
+				const uint32_t num_segments = get_num_database_segments(*tracks);
 
 				uint32_t segment_header_offset = clip_header_offset + sizeof(database_runtime_clip_header);
 
-				for (uint32_t segment_index = 0; segment_index < transforms_header.num_segments; ++segment_index)
+				for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
 				{
 					uint32_t num_segment_frames;
 					const frame_tier_mapping* segment_frames = find_segment_frames(tier_mapping, tracks_index, segment_index, num_segment_frames);
@@ -1071,9 +1548,9 @@ namespace acl
 				for (uint32_t tracks_index = 0; tracks_index < context.num_compressed_tracks; ++tracks_index)
 				{
 					const compressed_tracks* tracks = db_compressed_tracks_list[tracks_index];
-					const transform_tracks_header& transforms_header = get_transform_tracks_header(*tracks);
+					const uint32_t num_segments = get_num_database_segments(*tracks);
 
-					for (uint32_t segment_index = 0; segment_index < transforms_header.num_segments; ++segment_index)
+					for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
 					{
 						uint32_t num_segment_frames;
 						const frame_tier_mapping* segment_frames = find_segment_frames(tier_mapping, tracks_index, segment_index, num_segment_frames);
@@ -1104,42 +1581,141 @@ namespace acl
 						chunk_segment_index++;
 					}
 				}
+
+				// Our chunks are complete, checksum them
+				for (uint32_t chunk_offset = 0; chunk_offset < bulk_data_offset; chunk_offset += chunk_header->size)
+				{
+					chunk_header = safe_ptr_cast<database_chunk_header>(bulk_data + chunk_offset);
+					chunk_header->checksum = calculate_database_chunk_checksum(*chunk_header);
+				}
 			}
 
 			return bulk_data_offset;
 		}
 
-		inline compressed_database* build_compressed_database(const frame_assignment_context& context, const compression_database_settings& settings, const compressed_tracks* const* db_compressed_tracks_list)
+		// Entropy codes every chunk of the provided bulk data and writes them back to back along with their descriptions
+		// The encoded bulk data must be large enough to hold every chunk and its encoded chunk header
+		// Chunks are encoded independently, concurrently when a job scheduler is provided, within their worst case
+		// location before being compacted in order
+		// Returns the size of the encoded bulk data
+		inline uint32_t write_encoded_database_bulk_data(const uint8_t* bulk_data, const database_chunk_description* chunk_descriptions, uint32_t num_chunks, const compression_job_scheduler& job_scheduler, uint8_t* encoded_bulk_data, database_chunk_description* encoded_chunk_descriptions)
+		{
+			// Chunks are stored back to back, in the worst case every chunk is stored as is with its header
+			const auto get_worst_case_chunk_offset = [chunk_descriptions](uint32_t chunk_index)
+			{
+				return uint32_t(chunk_descriptions[chunk_index].offset) + chunk_index * uint32_t(sizeof(database_encoded_chunk_header));
+			};
+
+			const auto encode_chunk = [bulk_data, chunk_descriptions, encoded_bulk_data, encoded_chunk_descriptions, &get_worst_case_chunk_offset](uint32_t chunk_index)
+			{
+				const database_chunk_description& chunk_description = chunk_descriptions[chunk_index];
+				const uint8_t* chunk_data = bulk_data + uint32_t(chunk_description.offset);
+				const uint32_t chunk_size = chunk_description.size;
+
+				uint8_t* encoded_chunk = encoded_bulk_data + get_worst_case_chunk_offset(chunk_index);
+				encoded_chunk_descriptions[chunk_index].size = encode_database_chunk(chunk_data, chunk_size, encoded_chunk);
+			};
+
+			execute_compression_jobs(job_scheduler, num_chunks, encode_chunk);
+
+			// Compact our chunks, each one moves towards the start of the buffer and never overlaps the chunks that follow
+			uint32_t encoded_bulk_data_offset = 0;
+
+			for (uint32_t chunk_index = 0; chunk_index < num_chunks; ++chunk_index)
+			{
+				const uint32_t encoded_chunk_size = encoded_chunk_descriptions[chunk_index].size;
+				std::memmove(encoded_bulk_data + encoded_bulk_data_offset, encoded_bulk_data + get_worst_case_chunk_offset(chunk_index), encoded_chunk_size);
+
+				encoded_chunk_descriptions[chunk_index].offset = encoded_bulk_data_offset;
+
+				encoded_bulk_data_offset += encoded_chunk_size;
+			}
+
+			return encoded_bulk_data_offset;
+		}
+
+		inline compressed_database* build_compressed_database(const frame_assignment_context& context, const compression_database_settings& settings, const compression_job_scheduler& job_scheduler, const compressed_tracks* const* db_compressed_tracks_list)
 		{
 			// Find our chunk limits and calculate our database size
 			const uint32_t num_tracks = write_database_clip_metadata(db_compressed_tracks_list, context.num_compressed_tracks, nullptr);
 			const uint32_t num_segments = calculate_num_segments(db_compressed_tracks_list, context.num_compressed_tracks);
-			const uint32_t num_medium_chunks = write_database_chunk_descriptions(context, settings, quality_tier::medium_importance, nullptr);
-			const uint32_t num_low_chunks = write_database_chunk_descriptions(context, settings, quality_tier::lowest_importance, nullptr);
 
-			// Pad medium tier bulk data to ensure alignment since the lowest tier follows
-			const uint32_t bulk_data_medium_size = write_database_bulk_data(context, settings, quality_tier::medium_importance, db_compressed_tracks_list, nullptr);
-			const uint32_t aligned_bulk_data_medium_size = align_to(bulk_data_medium_size, k_database_bulk_data_alignment);
+			uint32_t num_chunks[k_num_database_tiers];
+			uint32_t bulk_data_size[k_num_database_tiers];
+			uint32_t stored_bulk_data_size[k_num_database_tiers];
+			bool is_bulk_data_entropy_coded[k_num_database_tiers];
+			uint8_t* encoded_bulk_data[k_num_database_tiers];
+			uint32_t encoded_bulk_data_buffer_size[k_num_database_tiers];
+			database_chunk_description* encoded_chunk_descriptions[k_num_database_tiers];
+
+			uint32_t num_encoded_chunks = 0;
+			uint32_t total_stored_bulk_data_size = 0;
+
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				const quality_tier tier = get_database_quality_tier(tier_index);
+				const bool is_lowest_tier = tier == quality_tier::lowest_importance;
+
+				const uint32_t num_tier_chunks = write_database_chunk_descriptions(context, settings, tier, nullptr);
+				const uint32_t tier_bulk_data_size = write_database_bulk_data(context, settings, tier, db_compressed_tracks_list, nullptr);
+
+				num_chunks[tier_index] = num_tier_chunks;
+				bulk_data_size[tier_index] = tier_bulk_data_size;
+
+				// Pad every tier but the lowest to ensure alignment since the next tier follows
+				stored_bulk_data_size[tier_index] = is_lowest_tier ? tier_bulk_data_size : align_to(tier_bulk_data_size, k_database_bulk_data_alignment);
+
+				// When the lowest tier is entropy coded, we encode it up front since we need its final size
+				is_bulk_data_entropy_coded[tier_index] = is_lowest_tier && settings.entropy_code_low_importance_tier && tier_bulk_data_size != 0;
+				encoded_bulk_data[tier_index] = nullptr;
+				encoded_bulk_data_buffer_size[tier_index] = 0;
+				encoded_chunk_descriptions[tier_index] = nullptr;
+
+				if (is_bulk_data_entropy_coded[tier_index])
+				{
+					uint8_t* decoded_bulk_data = allocate_type_array<uint8_t>(context.allocator, tier_bulk_data_size);
+					std::memset(decoded_bulk_data, 0, tier_bulk_data_size);
+
+					const uint32_t written_decoded_bulk_data_size = write_database_bulk_data(context, settings, tier, db_compressed_tracks_list, decoded_bulk_data);
+					ACL_ASSERT(written_decoded_bulk_data_size == tier_bulk_data_size, "Unexpected amount of data written"); (void)written_decoded_bulk_data_size;
+
+					database_chunk_description* chunk_descriptions = allocate_type_array<database_chunk_description>(context.allocator, num_tier_chunks);
+					write_database_chunk_descriptions(context, settings, tier, chunk_descriptions);
+
+					// In the worst case, every chunk is stored as is with its header
+					encoded_bulk_data_buffer_size[tier_index] = tier_bulk_data_size + num_tier_chunks * uint32_t(sizeof(database_encoded_chunk_header));
+					encoded_bulk_data[tier_index] = allocate_type_array<uint8_t>(context.allocator, encoded_bulk_data_buffer_size[tier_index]);
+					encoded_chunk_descriptions[tier_index] = allocate_type_array<database_chunk_description>(context.allocator, num_tier_chunks);
+
+					stored_bulk_data_size[tier_index] = write_encoded_database_bulk_data(decoded_bulk_data, chunk_descriptions, num_tier_chunks, job_scheduler, encoded_bulk_data[tier_index], encoded_chunk_descriptions[tier_index]);
+					ACL_ASSERT(stored_bulk_data_size[tier_index] <= encoded_bulk_data_buffer_size[tier_index], "Encoded bulk data overflow");
 
-			// No need to pad lowest tier since it is last
-			const uint32_t bulk_data_low_size = write_database_bulk_data(context, settings, quality_tier::lowest_importance, db_compressed_tracks_list, nullptr);
+					deallocate_type_array(context.allocator, chunk_descriptions, num_tier_chunks);
+					deallocate_type_array(context.allocator, decoded_bulk_data, tier_bulk_data_size);
+
+					num_encoded_chunks += num_tier_chunks;
+				}
+
+				total_stored_bulk_data_size += stored_bulk_data_size[tier_index];
+			}
 
 			uint32_t database_buffer_size = 0;
 			database_buffer_size += sizeof(raw_buffer_header);										// Header
 			database_buffer_size += sizeof(database_header);										// Header
 
-			database_buffer_size = align_to(database_buffer_size, 4);								// Align chunk descriptions
-			database_buffer_size += num_medium_chunks * sizeof(database_chunk_description);			// Chunk descriptions
-
-			database_buffer_size = align_to(database_buffer_size, 4);								// Align chunk descriptions
-			database_buffer_size += num_low_chunks * sizeof(database_chunk_description);			// Chunk descriptions
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				database_buffer_size = align_to(database_buffer_size, 4);							// Align chunk descriptions
+				database_buffer_size += num_chunks[tier_index] * sizeof(database_chunk_description);	// Chunk descriptions
+			}
 
 			database_buffer_size = align_to(database_buffer_size, 4);								// Align clip hashes
 			database_buffer_size += num_tracks * sizeof(database_clip_metadata);					// Clip metadata
+			database_buffer_size += num_tracks * sizeof(database_clip_chunk_range);					// Clip chunk ranges
+			database_buffer_size += num_encoded_chunks * sizeof(database_chunk_description);		// Encoded chunk descriptions
 
 			database_buffer_size = align_to(database_buffer_size, k_database_bulk_data_alignment);	// Align bulk data
-			database_buffer_size += aligned_bulk_data_medium_size;									// Bulk data
-			database_buffer_size += bulk_data_low_size;												// Bulk data
+			database_buffer_size += total_stored_bulk_data_size;									// Bulk data
 
 			uint8_t* database_buffer = allocate_type_array_aligned<uint8_t>(context.allocator, database_buffer_size, alignof(compressed_database));
 			std::memset(database_buffer, 0, database_buffer_size);
@@ -1158,63 +1734,84 @@ namespace acl
 			// Write our header
 			db_header->tag = static_cast<uint32_t>(buffer_tag32::compressed_database);
 			db_header->version = compressed_tracks_version16::latest;
-			db_header->num_chunks[0] = num_medium_chunks;
-			db_header->num_chunks[1] = num_low_chunks;
 			db_header->max_chunk_size = settings.max_chunk_size;
 			db_header->num_clips = num_tracks;
 			db_header->num_segments = num_segments;
-			db_header->bulk_data_size[0] = aligned_bulk_data_medium_size;
-			db_header->bulk_data_size[1] = bulk_data_low_size;
 			db_header->set_is_bulk_data_inline(true);	// Data is always inline when compressing
+			db_header->set_has_clip_chunk_ranges(true);
+			db_header->set_num_tiers(k_num_database_tiers);
 
-			database_buffer = align_to(database_buffer, 4);										// Align chunk descriptions
-			database_buffer += num_medium_chunks * sizeof(database_chunk_description);			// Chunk descriptions
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				db_header->num_chunks[tier_index] = num_chunks[tier_index];
+				db_header->bulk_data_size[tier_index] = stored_bulk_data_size[tier_index];
+				db_header->set_is_bulk_data_entropy_coded(tier_index, is_bulk_data_entropy_coded[tier_index]);
+			}
 
-			database_buffer = align_to(database_buffer, 4);										// Align chunk descriptions
-			database_buffer += num_low_chunks * sizeof(database_chunk_description);				// Chunk descriptions
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				database_buffer = align_to(database_buffer, 4);									// Align chunk descriptions
+				database_buffer += num_chunks[tier_index] * sizeof(database_chunk_description);	// Chunk descriptions
+			}
 
 			database_buffer = align_to(database_buffer, 4);										// Align clip hashes
 			db_header->clip_metadata_offset = uint32_t(database_buffer - db_header_start);		// Clip metadata
 			database_buffer += num_tracks * sizeof(database_clip_metadata);						// Clip metadata
+			database_buffer += num_tracks * sizeof(database_clip_chunk_range);					// Clip chunk ranges
+			database_buffer += num_encoded_chunks * sizeof(database_chunk_description);			// Encoded chunk descriptions
 
 			database_buffer = align_to(database_buffer, k_database_bulk_data_alignment);		// Align bulk data
-			if (aligned_bulk_data_medium_size != 0)
-				db_header->bulk_data_offset[0] = uint32_t(database_buffer - db_header_start);	// Bulk data
-			else
-				db_header->bulk_data_offset[0] = invalid_ptr_offset();
-			database_buffer += aligned_bulk_data_medium_size;									// Bulk data
-
-			if (bulk_data_low_size != 0)
-				db_header->bulk_data_offset[1] = uint32_t(database_buffer - db_header_start);	// Bulk data
-			else
-				db_header->bulk_data_offset[1] = invalid_ptr_offset();
-			database_buffer += bulk_data_low_size;												// Bulk data
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				if (stored_bulk_data_size[tier_index] != 0)
+					db_header->bulk_data_offset[tier_index] = uint32_t(database_buffer - db_header_start);	// Bulk data
+				else
+					db_header->bulk_data_offset[tier_index] = invalid_ptr_offset();
+				database_buffer += stored_bulk_data_size[tier_index];							// Bulk data
+			}
 
 			// Write our chunk descriptions
-			const uint32_t num_written_medium_chunks = write_database_chunk_descriptions(context, settings, quality_tier::medium_importance, db_header->get_chunk_descriptions_medium());
-			ACL_ASSERT(num_written_medium_chunks == num_medium_chunks, "Unexpected amount of data written"); (void)num_written_medium_chunks;
-
-			const uint32_t num_written_low_chunks = write_database_chunk_descriptions(context, settings, quality_tier::lowest_importance, db_header->get_chunk_descriptions_low());
-			ACL_ASSERT(num_written_low_chunks == num_low_chunks, "Unexpected amount of data written"); (void)num_written_low_chunks;
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				const uint32_t num_written_chunks = write_database_chunk_descriptions(context, settings, get_database_quality_tier(tier_index), db_header->get_chunk_descriptions(tier_index));
+				ACL_ASSERT(num_written_chunks == num_chunks[tier_index], "Unexpected amount of data written"); (void)num_written_chunks;
+			}
 
 			// Write our clip metadata
 			const uint32_t num_written_tracks = write_database_clip_metadata(db_compressed_tracks_list, context.num_compressed_tracks, db_header->get_clip_metadatas());
 			ACL_ASSERT(num_written_tracks == num_tracks, "Unexpected amount of data written"); (void)num_written_tracks;
 
+			// Write our clip chunk ranges
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+				write_database_clip_chunk_ranges(context, settings, get_database_quality_tier(tier_index), db_header->get_clip_chunk_ranges());
+
 			// Write our bulk data
-			const uint32_t written_bulk_data_medium_size = write_database_bulk_data(context, settings, quality_tier::medium_importance, db_compressed_tracks_list, db_header->get_bulk_data_medium());
-			ACL_ASSERT(written_bulk_data_medium_size == bulk_data_medium_size, "Unexpected amount of data written"); (void)written_bulk_data_medium_size;
-			db_header->bulk_data_hash[0] = hash32(db_header->get_bulk_data_medium(), aligned_bulk_data_medium_size);
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				if (is_bulk_data_entropy_coded[tier_index])
+				{
+					std::memcpy(db_header->get_encoded_chunk_descriptions(tier_index), encoded_chunk_descriptions[tier_index], num_chunks[tier_index] * sizeof(database_chunk_description));
+					std::memcpy(db_header->get_bulk_data(tier_index), encoded_bulk_data[tier_index], stored_bulk_data_size[tier_index]);
+
+					deallocate_type_array(context.allocator, encoded_chunk_descriptions[tier_index], num_chunks[tier_index]);
+					deallocate_type_array(context.allocator, encoded_bulk_data[tier_index], encoded_bulk_data_buffer_size[tier_index]);
+				}
+				else
+				{
+					const uint32_t written_bulk_data_size = write_database_bulk_data(context, settings, get_database_quality_tier(tier_index), db_compressed_tracks_list, db_header->get_bulk_data(tier_index));
+					ACL_ASSERT(written_bulk_data_size == bulk_data_size[tier_index], "Unexpected amount of data written"); (void)written_bulk_data_size;
+				}
 
-			const uint32_t written_bulk_data_low_size = write_database_bulk_data(context, settings, quality_tier::lowest_importance, db_compressed_tracks_list, db_header->get_bulk_data_low());
-			ACL_ASSERT(written_bulk_data_low_size == bulk_data_low_size, "Unexpected amount of data written"); (void)written_bulk_data_low_size;
-			db_header->bulk_data_hash[1] = hash32(db_header->get_bulk_data_low(), bulk_data_low_size);
+				db_header->bulk_data_hash[tier_index] = hash_raw_buffer(db_header->version, db_header->get_bulk_data(tier_index), stored_bulk_data_size[tier_index]);
+			}
 
 			ACL_ASSERT(uint32_t(database_buffer - database_buffer_start) == database_buffer_size, "Unexpected amount of data written"); (void)database_buffer_start;
 
 #if defined(ACL_HAS_ASSERT_CHECKS)
 			// Make sure nobody overwrote our padding (contained in last chunk if we have data)
-			if (bulk_data_low_size != 0)
+			// Entropy coded chunks do not retain it, it is restored when they are decoded
+			const uint32_t lowest_tier_index = k_num_database_tiers - 1;
+			if (bulk_data_size[lowest_tier_index] != 0 && !is_bulk_data_entropy_coded[lowest_tier_index])
 			{
 				for (const uint8_t* padding = database_buffer - 15; padding < database_buffer; ++padding)
 					ACL_ASSERT(*padding == 0, "Padding was overwritten");
@@ -1223,93 +1820,1208 @@ namespace acl
 
 			// Finish the raw buffer header
 			database_buffer_header->size = database_buffer_size;
-			database_buffer_header->hash = hash32(safe_ptr_cast<const uint8_t>(db_header), database_buffer_size - sizeof(raw_buffer_header));	// Hash everything but the raw buffer header
+			database_buffer_header->hash = hash_raw_buffer(db_header->version, safe_ptr_cast<const uint8_t>(db_header), database_buffer_size - sizeof(raw_buffer_header));	// Hash everything but the raw buffer header
 
 			ACL_ASSERT(database->is_valid(true).empty(), "Failed to build compressed database");
 
 			return database;
 		}
-	}
 
-	inline error_result build_database(iallocator& allocator, const compression_database_settings& settings,
-		const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks,
-		compressed_tracks** out_compressed_tracks, compressed_database*& out_database)
-	{
-		using namespace acl_impl;
+		// Returns the number of clips written, uses the hashes of compressed track instances no longer resident
+		inline uint32_t write_database_clip_metadata(const frame_assignment_context& context, const uint32_t* clip_hashes, database_clip_metadata* clip_metadatas)
+		{
+			const uint32_t num_tracks = context.num_compressed_tracks;
+			if (clip_metadatas == nullptr)
+				return num_tracks;	// Nothing to write
 
-		// Reset everything just to be safe
-		for (uint32_t list_index = 0; list_index < num_compressed_tracks; ++list_index)
-			out_compressed_tracks[list_index] = nullptr;
-		out_database = nullptr;
+			uint32_t clip_header_offset = 0;
 
-		// Validate everything and early out if something isn't right
-		const error_result settings_result = settings.is_valid();
-		if (settings_result.any())
-			return error_result("Compression database settings are invalid");
+			for (uint32_t tracks_index = 0; tracks_index < num_tracks; ++tracks_index)
+			{
+				database_clip_metadata& clip_metadata = clip_metadatas[tracks_index];
+				clip_metadata.clip_hash = clip_hashes[tracks_index];
+				clip_metadata.clip_header_offset = clip_header_offset;
 
-		if (compressed_tracks_list == nullptr || num_compressed_tracks == 0)
-			return error_result("No compressed track list provided");
+				clip_header_offset += get_database_runtime_clip_headers_size(context.contributing_error_per_clip[tracks_index].num_segments);
+			}
 
-		for (uint32_t list_index = 0; list_index < num_compressed_tracks; ++list_index)
+			return num_tracks;
+		}
+
+		// Writes the bulk data of a tier one segment at a time and provides it to a sink as every chunk is completed
+		// Chunks are delimited and laid out exactly like write_database_bulk_data(..) and write_encoded_database_bulk_data(..)
+		// Only a single chunk is held in memory at a time
+		struct database_tier_chunk_writer
 		{
-			const compressed_tracks* tracks = compressed_tracks_list[list_index];
-			if (tracks == nullptr)
-				return error_result("Compressed track list contains a null entry");
+			iallocator& allocator;
+			database_build_sink& sink;
 
-			const error_result tracks_result = tracks->is_valid(false);
-			if (tracks_result.any())
-				return error_result("Compressed track instance is invalid");
+			quality_tier tier;
+			uint32_t max_chunk_size;
+			uint32_t num_chunks;
+			bool is_entropy_coded;
 
-			if (tracks->has_database())
-				return error_result("Compressed track instance is already bound to a database");
+			database_chunk_segment_header* segment_headers;			// Headers of the segments in the current chunk, sample offsets are relative to its sample data
+			uint32_t max_num_segment_headers;
+			uint8_t* sample_data;									// Sample data of the current chunk
+			uint8_t* chunk_data;									// Current chunk once assembled
+			uint8_t* encoded_chunk_data;							// Current chunk once entropy coded
+			database_chunk_description* encoded_chunk_descriptions;	// Description of every chunk once entropy coded
 
-			if (tracks->has_stripped_keyframes())
-				return error_result("Compressed track instance has keyframes stripped");
+			uint32_t chunk_index;
+			uint32_t chunk_size;
+			uint32_t chunk_sample_data_offset;
+			uint32_t num_chunk_segments;
 
-			const tracks_header& header = get_tracks_header(*tracks);
-			if (!header.get_has_metadata())
-				return error_result("Compressed track instance does not contain any metadata");
+			uint32_t bulk_data_size;								// Size of the bulk data written so far, before it is entropy coded
+			uint32_t stored_bulk_data_size;							// Size of the bulk data provided to the sink so far
+			hash64_fast_stream bulk_data_hash;
 
-			const optional_metadata_header& metadata_header = get_optional_metadata_header(*tracks);
-			if (!metadata_header.contributing_error.is_valid())
-				return error_result("Compressed track instance does not contain contributing error metadata");
-		}
+			static constexpr uint32_t k_simd_padding = 15;
 
-		// Calculate how many frames are movable to the database
-		// A frame is movable if it isn't the first or last frame of a segment
-		const uint32_t num_frames = calculate_num_frames(compressed_tracks_list, num_compressed_tracks);
-		if (num_frames == 0)
-			return error_result("All compressed track lists are empty");
+			database_tier_chunk_writer(iallocator& allocator_, database_build_sink& sink_, const compression_database_settings& settings, quality_tier tier_, uint32_t num_chunks_)
+				: allocator(allocator_)
+				, sink(sink_)
+				, tier(tier_)
+				, max_chunk_size(settings.max_chunk_size)
+				, num_chunks(num_chunks_)
+				, is_entropy_coded(tier_ == quality_tier::lowest_importance && settings.entropy_code_low_importance_tier && num_chunks_ != 0)
+				, segment_headers(nullptr)
+				, max_num_segment_headers(0)
+				, sample_data(nullptr)
+				, chunk_data(nullptr)
+				, encoded_chunk_data(nullptr)
+				, encoded_chunk_descriptions(nullptr)
+				, chunk_index(0)
+				, chunk_size(sizeof(database_chunk_header))
+				, chunk_sample_data_offset(0)
+				, num_chunk_segments(0)
+				, bulk_data_size(0)
+				, stored_bulk_data_size(0)
+				, bulk_data_hash()
+			{
+				if (num_chunks == 0)
+					return;	// No data
+
+				// The last chunk can be larger than the max chunk size by its padding
+				max_num_segment_headers = max_chunk_size / sizeof(database_chunk_segment_header);
+				segment_headers = allocate_type_array<database_chunk_segment_header>(allocator, max_num_segment_headers);
+				sample_data = allocate_type_array<uint8_t>(allocator, max_chunk_size);
+				chunk_data = allocate_type_array_aligned<uint8_t>(allocator, max_chunk_size + k_simd_padding, alignof(database_chunk_header));
+
+				std::memset(sample_data, 0, max_chunk_size);
+
+				if (is_entropy_coded)
+				{
+					encoded_chunk_data = allocate_type_array<uint8_t>(allocator, max_chunk_size + k_simd_padding + sizeof(database_encoded_chunk_header));
+					encoded_chunk_descriptions = allocate_type_array<database_chunk_description>(allocator, num_chunks);
+				}
+			}
+
+			~database_tier_chunk_writer()
+			{
+				deallocate_type_array(allocator, segment_headers, max_num_segment_headers);
+				deallocate_type_array(allocator, sample_data, max_chunk_size);
+				deallocate_type_array(allocator, chunk_data, max_chunk_size + k_simd_padding);
+				deallocate_type_array(allocator, encoded_chunk_data, max_chunk_size + k_simd_padding + sizeof(database_encoded_chunk_header));
+				deallocate_type_array(allocator, encoded_chunk_descriptions, num_chunks);
+			}
+
+			database_tier_chunk_writer(const database_tier_chunk_writer&) = delete;
+			database_tier_chunk_writer& operator=(const database_tier_chunk_writer&) = delete;
+
+			// Segments must be provided in clip order and every segment must be provided, even when it has no data in this tier
+			void write_segment(uint32_t clip_hash, uint32_t clip_header_offset, uint32_t segment_header_offset, const frame_tier_mapping* segment_frames, uint32_t num_segment_frames)
+			{
+				if (num_chunks == 0)
+					return;	// No data
+
+				const uint32_t segment_data_bit_size = calculate_segment_animated_data_bit_size(segment_frames, num_segment_frames);
+				const uint32_t segment_data_size = (segment_data_bit_size + 7) / 8;
+				ACL_ASSERT(segment_data_size + k_simd_padding + uint32_t(sizeof(database_chunk_segment_header)) <= max_chunk_size, "Segment is larger than our max chunk size");
+
+				const uint32_t new_chunk_size = chunk_size + segment_data_size + k_simd_padding + sizeof(database_chunk_segment_header);
+				if (new_chunk_size >= max_chunk_size)
+					write_chunk(max_chunk_size);	// Chunk is full, start a new one
+
+				ACL_ASSERT(num_chunk_segments < max_num_segment_headers, "Too many segments in our chunk");
+
+				database_chunk_segment_header& segment_chunk_header = segment_headers[num_chunk_segments];
+				segment_chunk_header.clip_hash = clip_hash;
+				segment_chunk_header.sample_indices = build_sample_indices(segment_frames, num_segment_frames);
+				segment_chunk_header.samples_offset = chunk_sample_data_offset;	// Relative to start of sample data for now
+				segment_chunk_header.clip_header_offset = clip_header_offset;
+				segment_chunk_header.segment_header_offset = segment_header_offset;
+
+				const uint32_t size = write_tier_segment_data(segment_frames, num_segment_frames, sample_data + chunk_sample_data_offset);
+				ACL_ASSERT(size == segment_data_size, "Unexpected segment data size"); (void)size;
+
+				num_chunk_segments++;
+				chunk_size += segment_data_size + sizeof(database_chunk_segment_header);
+				chunk_sample_data_offset += segment_data_size;
+
+				ACL_ASSERT(chunk_size <= max_chunk_size, "Expected a valid chunk size, segment is larger than max chunk size?");
+			}
+
+			// Writes our last chunk and our padding, returns the bulk data hash
+			uint32_t finalize()
+			{
+				// If we have leftover data, finalize our last chunk
+				// Because of this, it might end up being larger than the max chunk size which is fine since we can't split a segment over two chunks
+				if (chunk_size != sizeof(database_chunk_header))
+					write_chunk(chunk_size + k_simd_padding);	// Last chunk needs padding
+
+				ACL_ASSERT(chunk_index == num_chunks, "Unexpected number of chunks written");
+
+				// Pad every tier but the lowest to ensure alignment since the next tier follows
+				if (tier != quality_tier::lowest_importance)
+				{
+					const uint8_t padding[k_database_bulk_data_alignment] = { 0 };
+					write_stored_data(padding, align_to(stored_bulk_data_size, k_database_bulk_data_alignment) - stored_bulk_data_size);
+				}
+
+				// Matches hash_raw_buffer(..) with the latest version
+				const uint64_t hash_value = bulk_data_hash.digest();
+				return uint32_t(hash_value ^ (hash_value >> 32));
+			}
+
+			void write_chunk(uint32_t size)
+			{
+				const uint32_t chunk_header_size = sizeof(database_chunk_header) + num_chunk_segments * sizeof(database_chunk_segment_header);
+				ACL_ASSERT(chunk_header_size + chunk_sample_data_offset <= size, "Chunk overflow");
+
+				std::memset(chunk_data, 0, size);
+
+				database_chunk_header* chunk_header = safe_ptr_cast<database_chunk_header>(chunk_data);
+				chunk_header->index = chunk_index;
+				chunk_header->size = size;
+				chunk_header->num_segments = num_chunk_segments;
+
+				// Update the sample offset from being relative to the start of the sample data to the start of the bulk data
+				database_chunk_segment_header* segment_chunk_headers = chunk_header->get_segment_headers();
+				for (uint32_t segment_index = 0; segment_index < num_chunk_segments; ++segment_index)
+				{
+					segment_chunk_headers[segment_index] = segment_headers[segment_index];
+					segment_chunk_headers[segment_index].samples_offset = bulk_data_size + chunk_header_size + uint32_t(segment_headers[segment_index].samples_offset);
+				}
+
+				std::memcpy(chunk_data + chunk_header_size, sample_data, chunk_sample_data_offset);
+
+				// Checksummed before it is entropy coded
+				chunk_header->checksum = calculate_database_chunk_checksum(*chunk_header);
+
+				if (is_entropy_coded)
+				{
+					const uint32_t encoded_chunk_size = encode_database_chunk(chunk_data, size, encoded_chunk_data);
+
+					encoded_chunk_descriptions[chunk_index].offset = stored_bulk_data_size;
+					encoded_chunk_descriptions[chunk_index].size = encoded_chunk_size;
+
+					write_stored_data(encoded_chunk_data, encoded_chunk_size);
+				}
+				else
+					write_stored_data(chunk_data, size);
+
+				// Start a new chunk, segment data is written bit by bit and expects zeroes
+				std::memset(sample_data, 0, chunk_sample_data_offset);
+
+				bulk_data_size += size;
+				chunk_sample_data_offset = 0;
+				chunk_size = sizeof(database_chunk_header);
+				num_chunk_segments = 0;
+				chunk_index++;
+			}
+
+			void write_stored_data(const uint8_t* data, uint32_t size)
+			{
+				if (size == 0)
+					return;
+
+				sink.write_bulk_data(tier, data, size);
+				bulk_data_hash.update(data, size);
+				stored_bulk_data_size += size;
+			}
+		};
+
+		// Builds a database whose bulk data has already been provided to a sink by our tier writers, it isn't inline
+		// The result is identical to build_compressed_database(..) followed by split_database_bulk_data(..)
+		inline compressed_database* build_compressed_database(const frame_assignment_context& context, const compression_database_settings& settings, const uint32_t* clip_hashes,
+			database_tier_chunk_writer* const (&tier_writers)[k_num_database_tiers], const uint32_t (&bulk_data_hashes)[k_num_database_tiers])
+		{
+			const uint32_t num_tracks = write_database_clip_metadata(context, clip_hashes, nullptr);
+
+			uint32_t num_segments = 0;
+			for (uint32_t tracks_index = 0; tracks_index < num_tracks; ++tracks_index)
+				num_segments += context.contributing_error_per_clip[tracks_index].num_segments;
+
+			uint32_t num_encoded_chunks = 0;
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				if (tier_writers[tier_index]->is_entropy_coded)
+					num_encoded_chunks += tier_writers[tier_index]->num_chunks;
+			}
+
+			uint32_t database_buffer_size = 0;
+			database_buffer_size += sizeof(raw_buffer_header);										// Header
+			database_buffer_size += sizeof(database_header);										// Header
+
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				database_buffer_size = align_to(database_buffer_size, 4);							// Align chunk descriptions
+				database_buffer_size += tier_writers[tier_index]->num_chunks * sizeof(database_chunk_description);	// Chunk descriptions
+			}
+
+			database_buffer_size = align_to(database_buffer_size, 4);								// Align clip hashes
+			database_buffer_size += num_tracks * sizeof(database_clip_metadata);					// Clip metadata
+			database_buffer_size += num_tracks * sizeof(database_clip_chunk_range);					// Clip chunk ranges
+			database_buffer_size += num_encoded_chunks * sizeof(database_chunk_description);		// Encoded chunk descriptions
+
+			database_buffer_size = align_to(database_buffer_size, k_database_bulk_data_alignment);	// Align bulk data, it isn't inline
+
+			uint8_t* database_buffer = allocate_type_array_aligned<uint8_t>(context.allocator, database_buffer_size, alignof(compressed_database));
+			std::memset(database_buffer, 0, database_buffer_size);
+
+			compressed_database* database = reinterpret_cast<compressed_database*>(database_buffer);
+
+			raw_buffer_header* database_buffer_header = safe_ptr_cast<raw_buffer_header>(database_buffer);
+			database_buffer += sizeof(raw_buffer_header);
+
+			const uint8_t* db_header_start = database_buffer;
+			database_header* db_header = safe_ptr_cast<database_header>(database_buffer);
+			database_buffer += sizeof(database_header);
+
+			// Write our header
+			db_header->tag = static_cast<uint32_t>(buffer_tag32::compressed_database);
+			db_header->version = compressed_tracks_version16::latest;
+			db_header->max_chunk_size = settings.max_chunk_size;
+			db_header->num_clips = num_tracks;
+			db_header->num_segments = num_segments;
+			db_header->set_is_bulk_data_inline(false);	// Our bulk data was provided to the sink
+			db_header->set_has_clip_chunk_ranges(true);
+			db_header->set_num_tiers(k_num_database_tiers);
+
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				const database_tier_chunk_writer& tier_writer = *tier_writers[tier_index];
+
+				db_header->num_chunks[tier_index] = tier_writer.num_chunks;
+				db_header->bulk_data_size[tier_index] = tier_writer.stored_bulk_data_size;
+				db_header->set_is_bulk_data_entropy_coded(tier_index, tier_writer.is_entropy_coded);
+				db_header->bulk_data_offset[tier_index] = invalid_ptr_offset();
+				db_header->bulk_data_hash[tier_index] = bulk_data_hashes[tier_index];
+			}
+
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				database_buffer = align_to(database_buffer, 4);									// Align chunk descriptions
+				database_buffer += tier_writers[tier_index]->num_chunks * sizeof(database_chunk_description);	// Chunk descriptions
+			}
+
+			database_buffer = align_to(database_buffer, 4);										// Align clip hashes
+			db_header->clip_metadata_offset = uint32_t(database_buffer - db_header_start);		// Clip metadata
+
+			// Write our chunk descriptions
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				const uint32_t num_written_chunks = write_database_chunk_descriptions(context, settings, get_database_quality_tier(tier_index), db_header->get_chunk_descriptions(tier_index));
+				ACL_ASSERT(num_written_chunks == tier_writers[tier_index]->num_chunks, "Unexpected amount of data written"); (void)num_written_chunks;
+			}
+
+			// Write our clip metadata
+			const uint32_t num_written_tracks = write_database_clip_metadata(context, clip_hashes, db_header->get_clip_metadatas());
+			ACL_ASSERT(num_written_tracks == num_tracks, "Unexpected amount of data written"); (void)num_written_tracks;
+
+			// Write our clip chunk ranges
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+				write_database_clip_chunk_ranges(context, settings, get_database_quality_tier(tier_index), db_header->get_clip_chunk_ranges());
+
+			// Write our encoded chunk descriptions
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				const database_tier_chunk_writer& tier_writer = *tier_writers[tier_index];
+				if (tier_writer.is_entropy_coded)
+					std::memcpy(db_header->get_encoded_chunk_descriptions(tier_index), tier_writer.encoded_chunk_descriptions, tier_writer.num_chunks * sizeof(database_chunk_description));
+			}
+
+			// Finish the raw buffer header
+			database_buffer_header->size = database_buffer_size;
+			database_buffer_header->hash = hash_raw_buffer(db_header->version, safe_ptr_cast<const uint8_t>(db_header), database_buffer_size - sizeof(raw_buffer_header));	// Hash everything but the raw buffer header
+
+			ACL_ASSERT(database->is_valid(true).empty(), "Failed to build compressed database");
+
+			return database;
+		}
+	}
+
+	inline error_result build_database(iallocator& allocator, const compression_database_settings& settings,
+		const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks,
+		compressed_tracks** out_compressed_tracks, compressed_database*& out_database)
+	{
+		return build_database(allocator, settings, compressed_tracks_list, num_compressed_tracks, compression_job_scheduler(), out_compressed_tracks, out_database);
+	}
+
+	inline error_result build_database(iallocator& allocator, const compression_database_settings& settings,
+		const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks,
+		const compression_job_scheduler& job_scheduler, compressed_tracks** out_compressed_tracks, compressed_database*& out_database)
+	{
+		using namespace acl_impl;
+
+		// Reset everything just to be safe
+		for (uint32_t list_index = 0; list_index < num_compressed_tracks; ++list_index)
+			out_compressed_tracks[list_index] = nullptr;
+		out_database = nullptr;
+
+		// Validate everything and early out if something isn't right
+		const error_result settings_result = settings.is_valid();
+		if (settings_result.any())
+			return error_result("Compression database settings are invalid");
+
+		const error_result scheduler_result = job_scheduler.is_valid();
+		if (scheduler_result.any())
+			return scheduler_result;
+
+		const error_result tracks_list_result = validate_contributing_error_tracks(compressed_tracks_list, num_compressed_tracks);
+		if (tracks_list_result.any())
+			return tracks_list_result;
+
+		// Calculate how many frames are movable to the database
+		// A frame is movable if it isn't the first or last frame of a segment
+		const uint32_t num_frames = calculate_num_frames(compressed_tracks_list, num_compressed_tracks);
+		if (num_frames == 0)
+			return error_result("All compressed track lists are empty");
+
+		const uint32_t num_movable_frames = calculate_num_movable_frames(compressed_tracks_list, num_compressed_tracks);
+		ACL_ASSERT(num_movable_frames < num_frames, "Cannot move out more frames than we have");
+
+		// Assign every frame to its tier
+		frame_assignment_context context(allocator, compressed_tracks_list, num_compressed_tracks, num_movable_frames);
+		assign_frames_to_tiers(context, settings, num_frames);
+
+		// Build our new compressed track instances with the high importance tier data
+		build_compressed_tracks(context, true, job_scheduler, out_compressed_tracks);
+
+		// Build our database with the lower tier data
+		out_database = build_compressed_database(context, settings, job_scheduler, out_compressed_tracks);
+
+		return error_result();
+	}
+
+	inline error_result build_database(iallocator& allocator, const compression_database_settings& settings,
+		const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks, const uint32_t* clip_affinity_groups,
+		const compression_job_scheduler& job_scheduler, compressed_tracks** out_compressed_tracks, compressed_database*& out_database)
+	{
+		using namespace acl_impl;
+
+		if (clip_affinity_groups == nullptr || compressed_tracks_list == nullptr)
+			return build_database(allocator, settings, compressed_tracks_list, num_compressed_tracks, job_scheduler, out_compressed_tracks, out_database);
+
+		// Reset everything just to be safe
+		for (uint32_t list_index = 0; list_index < num_compressed_tracks; ++list_index)
+			out_compressed_tracks[list_index] = nullptr;
+		out_database = nullptr;
+
+		// Chunks are filled in clip order, sort our clips by group to pack the clips of a group together
+		// The sort is stable, clips of the same group retain their order
+		uint32_t* sorted_clip_indices = allocate_type_array<uint32_t>(allocator, num_compressed_tracks);
+		for (uint32_t list_index = 0; list_index < num_compressed_tracks; ++list_index)
+			sorted_clip_indices[list_index] = list_index;
+
+		std::stable_sort(sorted_clip_indices, sorted_clip_indices + num_compressed_tracks,
+			[clip_affinity_groups](uint32_t lhs, uint32_t rhs) { return clip_affinity_groups[lhs] < clip_affinity_groups[rhs]; });
+
+		const compressed_tracks** sorted_compressed_tracks_list = allocate_type_array<const compressed_tracks*>(allocator, num_compressed_tracks);
+		compressed_tracks** sorted_out_compressed_tracks = allocate_type_array<compressed_tracks*>(allocator, num_compressed_tracks);
+		for (uint32_t list_index = 0; list_index < num_compressed_tracks; ++list_index)
+			sorted_compressed_tracks_list[list_index] = compressed_tracks_list[sorted_clip_indices[list_index]];
+
+		const error_result result = build_database(allocator, settings, sorted_compressed_tracks_list, num_compressed_tracks, job_scheduler, sorted_out_compressed_tracks, out_database);
+
+		// Our output compressed track instances follow the input order
+		if (result.empty())
+		{
+			for (uint32_t list_index = 0; list_index < num_compressed_tracks; ++list_index)
+				out_compressed_tracks[sorted_clip_indices[list_index]] = sorted_out_compressed_tracks[list_index];
+		}
+
+		deallocate_type_array(allocator, sorted_out_compressed_tracks, num_compressed_tracks);
+		deallocate_type_array(allocator, sorted_compressed_tracks_list, num_compressed_tracks);
+		deallocate_type_array(allocator, sorted_clip_indices, num_compressed_tracks);
+
+		return result;
+	}
+
+	inline error_result build_database(iallocator& allocator, const compression_database_settings& settings,
+		database_build_source& source, database_build_sink& sink, compressed_database*& out_database)
+	{
+		using namespace acl_impl;
+
+		// Reset everything just to be safe
+		out_database = nullptr;
+
+		// Validate everything and early out if something isn't right
+		const error_result settings_result = settings.is_valid();
+		if (settings_result.any())
+			return error_result("Compression database settings are invalid");
+
+		const uint32_t num_compressed_tracks = source.get_num_compressed_tracks();
+		if (num_compressed_tracks == 0)
+			return error_result("No compressed track list provided");
+
+		// Only the clip being written is ever resident
+		const compressed_tracks** resident_tracks_list = allocate_type_array<const compressed_tracks*>(allocator, num_compressed_tracks);
+		std::fill(resident_tracks_list, resident_tracks_list + num_compressed_tracks, nullptr);
+
+		compressed_tracks** out_compressed_tracks = allocate_type_array<compressed_tracks*>(allocator, num_compressed_tracks);
+		std::fill(out_compressed_tracks, out_compressed_tracks + num_compressed_tracks, nullptr);
+
+		uint32_t* clip_hashes = allocate_type_array<uint32_t>(allocator, num_compressed_tracks);
+
+		error_result result;
+
+		{
+			frame_assignment_context context(allocator, resident_tracks_list, num_compressed_tracks, 0);
+
+			// First pass, gather the contributing error of every frame
+			// A frame is movable if it isn't the first or last frame of a segment
+			uint32_t num_frames = 0;
+			uint32_t num_movable_frames = 0;
+
+			for (uint32_t list_index = 0; list_index < num_compressed_tracks && result.empty(); ++list_index)
+			{
+				const compressed_tracks* tracks = source.acquire(list_index);
+
+				result = validate_contributing_error_tracks(&tracks, 1);
+				if (result.empty())
+				{
+					context.initialize_clip(list_index, *tracks, true);
+
+					num_frames += calculate_num_frames(&tracks, 1);
+					num_movable_frames += calculate_num_movable_frames(&tracks, 1);
+				}
+
+				if (tracks != nullptr)
+					source.release(list_index, tracks);
+			}
+
+			if (result.empty() && num_frames == 0)
+				result = error_result("All compressed track lists are empty");
+
+			if (result.empty())
+			{
+				ACL_ASSERT(num_movable_frames < num_frames, "Cannot move out more frames than we have");
+
+				// Assign every frame to its tier
+				context.num_movable_frames = num_movable_frames;
+				assign_frames_to_tiers(context, settings, num_frames);
+
+				database_tier_chunk_writer* tier_writers[k_num_database_tiers];
+				for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+				{
+					const quality_tier tier = get_database_quality_tier(tier_index);
+					const uint32_t num_tier_chunks = write_database_chunk_descriptions(context, settings, tier, nullptr);
+					tier_writers[tier_index] = allocate_type<database_tier_chunk_writer>(allocator, allocator, sink, settings, tier, num_tier_chunks);
+				}
+
+				// Second pass, build our new compressed track instances and write our bulk data one clip at a time
+				uint32_t clip_header_offset = 0;
+
+				for (uint32_t list_index = 0; list_index < num_compressed_tracks; ++list_index)
+				{
+					const compressed_tracks* tracks = source.acquire(list_index);
+					if (tracks == nullptr)
+					{
+						result = error_result("Failed to acquire a compressed track instance");
+						break;
+					}
+
+					resident_tracks_list[list_index] = tracks;
+					context.resolve_clip_animated_data(list_index, *tracks);
+
+					build_compressed_tracks_entry(context, true, list_index, clip_header_offset, out_compressed_tracks);
+
+					const uint32_t clip_hash = out_compressed_tracks[list_index]->get_hash();
+					clip_hashes[list_index] = clip_hash;
+
+					const uint32_t num_segments = context.contributing_error_per_clip[list_index].num_segments;
+					for (database_tier_chunk_writer* tier_writer : tier_writers)
+					{
+						const database_tier_mapping& tier_mapping = context.get_tier_mapping(tier_writer->tier);
+
+						uint32_t segment_header_offset = clip_header_offset + sizeof(database_runtime_clip_header);
+						for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+						{
+							uint32_t num_segment_frames;
+							const frame_tier_mapping* segment_frames = find_segment_frames(tier_mapping, list_index, segment_index, num_segment_frames);
+
+							tier_writer->write_segment(clip_hash, clip_header_offset, segment_header_offset, segment_frames, num_segment_frames);
+
+							segment_header_offset += sizeof(database_runtime_segment_header);
+						}
+					}
+
+					clip_header_offset += get_database_runtime_clip_headers_size(num_segments);
+
+					// Our new instance is no longer needed, hand it over
+					sink.write_compressed_tracks(list_index, out_compressed_tracks[list_index]);
+					out_compressed_tracks[list_index] = nullptr;
+
+					resident_tracks_list[list_index] = nullptr;
+					source.release(list_index, tracks);
+				}
+
+				if (result.empty())
+				{
+					uint32_t bulk_data_hashes[k_num_database_tiers];
+					for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+						bulk_data_hashes[tier_index] = tier_writers[tier_index]->finalize();
+
+					// Build our database with the lower tier data
+					out_database = build_compressed_database(context, settings, clip_hashes, tier_writers, bulk_data_hashes);
+				}
+
+				for (database_tier_chunk_writer* tier_writer : tier_writers)
+					deallocate_type(allocator, tier_writer);
+			}
+		}
+
+		deallocate_type_array(allocator, clip_hashes, num_compressed_tracks);
+		deallocate_type_array(allocator, out_compressed_tracks, num_compressed_tracks);
+		deallocate_type_array(allocator, resident_tracks_list, num_compressed_tracks);
+
+		return result;
+	}
+
+	namespace acl_impl
+	{
+		// Runtime header memory a clip occupies within a database or that is free for new clips
+		struct database_runtime_headers_range
+		{
+			uint32_t offset;
+			uint32_t size;
+		};
+
+		// A clip entry of an updated database
+		struct database_clip_entry
+		{
+			database_clip_metadata metadata;
+			database_clip_chunk_range chunk_range;
+		};
+
+		// The decoded chunks of a database tier being updated
+		struct database_tier_update
+		{
+			uint8_t* bulk_data = nullptr;							// Decoded bulk data
+			uint32_t bulk_data_size = 0;							// Decoded bulk data size
+			database_chunk_description* chunk_descriptions = nullptr;
+			bool* is_chunk_modified = nullptr;						// Unmodified chunks retain their encoded data as is
+			uint32_t num_chunks = 0;
+			uint32_t num_source_chunks = 0;							// Chunks from the source database come first
+
+			uint8_t* stored_bulk_data = nullptr;					// Stored bulk data, points to the decoded bulk data when not entropy coded
+			uint32_t stored_bulk_data_buffer_size = 0;
+			uint32_t stored_bulk_data_size = 0;
+			database_chunk_description* encoded_chunk_descriptions = nullptr;
+			bool is_entropy_coded = false;
+		};
+
+		inline void deallocate_tier_update(iallocator& allocator, database_tier_update& tier_update)
+		{
+			if (tier_update.is_entropy_coded)
+			{
+				deallocate_type_array(allocator, tier_update.stored_bulk_data, tier_update.stored_bulk_data_buffer_size);
+				deallocate_type_array(allocator, tier_update.encoded_chunk_descriptions, tier_update.num_chunks);
+			}
+
+			deallocate_type_array(allocator, tier_update.bulk_data, tier_update.bulk_data_size);
+			deallocate_type_array(allocator, tier_update.chunk_descriptions, tier_update.num_chunks);
+			deallocate_type_array(allocator, tier_update.is_chunk_modified, tier_update.num_chunks);
+		}
+
+		// Copies the chunks of a source database tier and appends the new chunks built for the added clips
+		// Returns false if a source chunk failed to decode
+		inline bool initialize_tier_update(iallocator& allocator, const database_header& header, uint32_t tier_index,
+			const database_chunk_description* new_chunk_descriptions, uint32_t num_new_chunks, const uint8_t* new_bulk_data, uint32_t new_bulk_data_size,
+			database_tier_update& out_tier_update)
+		{
+			const uint32_t num_source_chunks = header.num_chunks[tier_index];
+			const database_chunk_description* source_chunk_descriptions = header.get_chunk_descriptions(tier_index);
+			const uint32_t source_bulk_data_size = num_source_chunks != 0 ? (uint32_t(source_chunk_descriptions[num_source_chunks - 1].offset) + source_chunk_descriptions[num_source_chunks - 1].size) : 0;
+
+			// Chunks are located by their index, every chunk but the last one spans the max chunk size
+			// New chunks thus start where a full last source chunk would end
+			const uint32_t max_chunk_size = header.max_chunk_size;
+			const uint32_t new_bulk_data_offset = num_source_chunks * max_chunk_size;
+
+			const uint32_t num_chunks = num_source_chunks + num_new_chunks;
+			const uint32_t bulk_data_size = num_new_chunks != 0 ? (new_bulk_data_offset + new_bulk_data_size) : source_bulk_data_size;
+
+			out_tier_update.bulk_data = allocate_type_array<uint8_t>(allocator, bulk_data_size);
+			out_tier_update.bulk_data_size = bulk_data_size;
+			out_tier_update.chunk_descriptions = allocate_type_array<database_chunk_description>(allocator, num_chunks);
+			out_tier_update.is_chunk_modified = allocate_type_array<bool>(allocator, num_chunks);
+			out_tier_update.num_chunks = num_chunks;
+			out_tier_update.num_source_chunks = num_source_chunks;
+
+			std::memset(out_tier_update.bulk_data, 0, bulk_data_size);
+
+			// Source chunks
+			const uint8_t* source_bulk_data = header.get_bulk_data(tier_index);
+			if (header.get_is_bulk_data_entropy_coded(tier_index))
+			{
+				const database_chunk_description* source_encoded_chunk_descriptions = header.get_encoded_chunk_descriptions(tier_index);
+
+				for (uint32_t chunk_index = 0; chunk_index < num_source_chunks; ++chunk_index)
+				{
+					const database_chunk_description& chunk_description = source_chunk_descriptions[chunk_index];
+					const database_chunk_description& encoded_chunk_description = source_encoded_chunk_descriptions[chunk_index];
+
+					if (!decode_database_chunk(source_bulk_data + uint32_t(encoded_chunk_description.offset), encoded_chunk_description.size, out_tier_update.bulk_data + uint32_t(chunk_description.offset), chunk_description.size))
+						return false;
+				}
+			}
+			else if (source_bulk_data_size != 0)
+				std::memcpy(out_tier_update.bulk_data, source_bulk_data, source_bulk_data_size);
+
+			for (uint32_t chunk_index = 0; chunk_index < num_source_chunks; ++chunk_index)
+			{
+				out_tier_update.chunk_descriptions[chunk_index] = source_chunk_descriptions[chunk_index];
+				out_tier_update.is_chunk_modified[chunk_index] = false;
+			}
+
+			if (num_new_chunks == 0)
+				return true;
+
+			// Our last source chunk is no longer last, it now spans the max chunk size
+			if (num_source_chunks != 0)
+			{
+				const uint32_t last_chunk_index = num_source_chunks - 1;
+				database_chunk_description& last_chunk_description = out_tier_update.chunk_descriptions[last_chunk_index];
+				ACL_ASSERT(last_chunk_description.size <= max_chunk_size, "Last chunk is larger than the max chunk size");
+
+				last_chunk_description.size = max_chunk_size;
+				last_chunk_description.get_chunk_header(out_tier_update.bulk_data)->size = max_chunk_size;
+				out_tier_update.is_chunk_modified[last_chunk_index] = true;
+			}
+
+			// New chunks
+			std::memcpy(out_tier_update.bulk_data + new_bulk_data_offset, new_bulk_data, new_bulk_data_size);
+
+			for (uint32_t new_chunk_index = 0; new_chunk_index < num_new_chunks; ++new_chunk_index)
+			{
+				const uint32_t chunk_index = num_source_chunks + new_chunk_index;
+
+				database_chunk_description& chunk_description = out_tier_update.chunk_descriptions[chunk_index];
+				chunk_description.size = new_chunk_descriptions[new_chunk_index].size;
+				chunk_description.offset = new_bulk_data_offset + uint32_t(new_chunk_descriptions[new_chunk_index].offset);
+				out_tier_update.is_chunk_modified[chunk_index] = true;
+
+				// Chunk indices and sample offsets are relative to the new chunks, offset them
+				database_chunk_header* chunk_header = chunk_description.get_chunk_header(out_tier_update.bulk_data);
+				chunk_header->index = chunk_index;
+
+				database_chunk_segment_header* segment_chunk_headers = chunk_header->get_segment_headers();
+				for (uint32_t segment_index = 0; segment_index < chunk_header->num_segments; ++segment_index)
+					segment_chunk_headers[segment_index].samples_offset = uint32_t(segment_chunk_headers[segment_index].samples_offset) + new_bulk_data_offset;
+			}
+
+			return true;
+		}
+
+		// Remaps the runtime header offsets of the new chunks from where the added clips were built to where they live
+		inline void remap_tier_update_clip_headers(database_tier_update& tier_update, const uint32_t* built_clip_header_offsets, const uint32_t* clip_header_offsets, uint32_t num_clips)
+		{
+			for (uint32_t chunk_index = tier_update.num_source_chunks; chunk_index < tier_update.num_chunks; ++chunk_index)
+			{
+				database_chunk_header* chunk_header = tier_update.chunk_descriptions[chunk_index].get_chunk_header(tier_update.bulk_data);
+				database_chunk_segment_header* segment_chunk_headers = chunk_header->get_segment_headers();
+
+				for (uint32_t segment_index = 0; segment_index < chunk_header->num_segments; ++segment_index)
+				{
+					database_chunk_segment_header& segment_chunk_header = segment_chunk_headers[segment_index];
+
+					// Built offsets are sorted, find the clip that owns this segment
+					const uint32_t built_clip_header_offset = uint32_t(segment_chunk_header.clip_header_offset);
+					const uint32_t* clip_offset = std::upper_bound(built_clip_header_offsets, built_clip_header_offsets + num_clips, built_clip_header_offset) - 1;
+					const uint32_t clip_index = uint32_t(clip_offset - built_clip_header_offsets);
+					ACL_ASSERT(built_clip_header_offsets[clip_index] == built_clip_header_offset, "Unexpected clip header offset");
+
+					// Segment headers follow their clip header, they move along with it
+					const uint32_t segment_header_offset = uint32_t(segment_chunk_header.segment_header_offset) - built_clip_header_offset;
+					segment_chunk_header.clip_header_offset = clip_header_offsets[clip_index];
+					segment_chunk_header.segment_header_offset = clip_header_offsets[clip_index] + segment_header_offset;
+				}
+			}
+		}
+
+		// Removes the segments of the removed clips from the source chunks, their sample data is left as is
+		inline void remove_tier_update_clips(database_tier_update& tier_update, const uint32_t* removed_clip_header_offsets, uint32_t num_removed_clips)
+		{
+			for (uint32_t chunk_index = 0; chunk_index < tier_update.num_source_chunks; ++chunk_index)
+			{
+				database_chunk_header* chunk_header = tier_update.chunk_descriptions[chunk_index].get_chunk_header(tier_update.bulk_data);
+				database_chunk_segment_header* segment_chunk_headers = chunk_header->get_segment_headers();
+
+				const uint32_t num_segments = chunk_header->num_segments;
+				uint32_t num_retained_segments = 0;
+				for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+				{
+					const uint32_t clip_header_offset = uint32_t(segment_chunk_headers[segment_index].clip_header_offset);
+					if (std::binary_search(removed_clip_header_offsets, removed_clip_header_offsets + num_removed_clips, clip_header_offset))
+						continue;	// This segment belongs to a removed clip, drop it
+
+					segment_chunk_headers[num_retained_segments++] = segment_chunk_headers[segment_index];
+				}
+
+				if (num_retained_segments == num_segments)
+					continue;	// Nothing removed, this chunk is unchanged
+
+				// Sample offsets are relative to the start of the bulk data, the sample data doesn't move
+				std::memset(segment_chunk_headers + num_retained_segments, 0, (num_segments - num_retained_segments) * sizeof(database_chunk_segment_header));
+				chunk_header->num_segments = num_retained_segments;
+				tier_update.is_chunk_modified[chunk_index] = true;
+			}
+		}
+
+		// Checksums and entropy codes the modified chunks, the others retain their source checksum and encoded data
+		inline void encode_tier_update(iallocator& allocator, const database_header& header, uint32_t tier_index, database_tier_update& tier_update)
+		{
+			for (uint32_t chunk_index = 0; chunk_index < tier_update.num_chunks; ++chunk_index)
+			{
+				if (!tier_update.is_chunk_modified[chunk_index])
+					continue;
+
+				database_chunk_header* chunk_header = tier_update.chunk_descriptions[chunk_index].get_chunk_header(tier_update.bulk_data);
+				chunk_header->checksum = calculate_database_chunk_checksum(*chunk_header);
+			}
+
+			if (!tier_update.is_entropy_coded)
+			{
+				tier_update.stored_bulk_data = tier_update.bulk_data;
+				tier_update.stored_bulk_data_size = tier_update.bulk_data_size;
+				return;
+			}
+
+			const uint8_t* source_bulk_data = header.get_bulk_data(tier_index);
+			const database_chunk_description* source_encoded_chunk_descriptions = header.get_encoded_chunk_descriptions(tier_index);
+			const bool is_source_entropy_coded = header.get_is_bulk_data_entropy_coded(tier_index);
+
+			// In the worst case, every chunk is stored as is with its header
+			tier_update.stored_bulk_data_buffer_size = tier_update.bulk_data_size + tier_update.num_chunks * uint32_t(sizeof(database_encoded_chunk_header));
+			tier_update.stored_bulk_data = allocate_type_array<uint8_t>(allocator, tier_update.stored_bulk_data_buffer_size);
+			tier_update.encoded_chunk_descriptions = allocate_type_array<database_chunk_description>(allocator, tier_update.num_chunks);
 
-		const uint32_t num_movable_frames = calculate_num_movable_frames(compressed_tracks_list, num_compressed_tracks);
-		ACL_ASSERT(num_movable_frames < num_frames, "Cannot move out more frames than we have");
+			uint32_t stored_bulk_data_offset = 0;
+			for (uint32_t chunk_index = 0; chunk_index < tier_update.num_chunks; ++chunk_index)
+			{
+				uint8_t* encoded_chunk = tier_update.stored_bulk_data + stored_bulk_data_offset;
 
-		// Calculate how many frames we'll move to every tier
-		const uint32_t num_low_importance_frames = std::min<uint32_t>(num_movable_frames, uint32_t(settings.low_importance_tier_proportion * float(num_frames)));
-		const uint32_t num_medium_importance_frames = std::min<uint32_t>(num_movable_frames - num_low_importance_frames, uint32_t(settings.medium_importance_tier_proportion * float(num_frames)));
-		ACL_ASSERT(num_low_importance_frames + num_medium_importance_frames <= num_movable_frames, "Cannot move out more frames than we have");
+				uint32_t encoded_chunk_size;
+				if (is_source_entropy_coded && !tier_update.is_chunk_modified[chunk_index])
+				{
+					// Unchanged, retain our encoded data as is
+					const database_chunk_description& source_encoded_chunk_description = source_encoded_chunk_descriptions[chunk_index];
+					encoded_chunk_size = source_encoded_chunk_description.size;
+					std::memcpy(encoded_chunk, source_bulk_data + uint32_t(source_encoded_chunk_description.offset), encoded_chunk_size);
+				}
+				else
+				{
+					const database_chunk_description& chunk_description = tier_update.chunk_descriptions[chunk_index];
+					encoded_chunk_size = encode_database_chunk(tier_update.bulk_data + uint32_t(chunk_description.offset), chunk_description.size, encoded_chunk);
+				}
 
-		// Non-movable frames end up being high importance and remain in the compressed clip
-		const uint32_t num_high_importance_frames = num_frames - num_medium_importance_frames - num_low_importance_frames;
+				tier_update.encoded_chunk_descriptions[chunk_index].size = encoded_chunk_size;
+				tier_update.encoded_chunk_descriptions[chunk_index].offset = stored_bulk_data_offset;
 
-		frame_assignment_context context(allocator, compressed_tracks_list, num_compressed_tracks, num_movable_frames);
-		context.set_tier_num_frames(quality_tier::highest_importance, num_high_importance_frames);
-		context.set_tier_num_frames(quality_tier::medium_importance, num_medium_importance_frames);
-		context.set_tier_num_frames(quality_tier::lowest_importance, num_low_importance_frames);
+				stored_bulk_data_offset += encoded_chunk_size;
+			}
 
-		// Assign every frame to its tier
-		assign_frames_to_tiers(context);
+			ACL_ASSERT(stored_bulk_data_offset <= tier_update.stored_bulk_data_buffer_size, "Encoded bulk data overflow");
+			tier_update.stored_bulk_data_size = stored_bulk_data_offset;
+		}
+	}
 
-		// Build our new compressed track instances with the high importance tier data
-		build_compressed_tracks(context, out_compressed_tracks);
+	inline error_result update_database(iallocator& allocator, const compression_database_settings& settings, const compressed_database& database,
+		const compressed_tracks* const* removed_tracks_list, uint32_t num_removed_tracks,
+		const compressed_tracks* const* added_tracks_list, uint32_t num_added_tracks,
+		compressed_tracks** out_added_compressed_tracks, compressed_database*& out_database)
+	{
+		using namespace acl_impl;
 
-		// Build our database with the lower tier data
-		out_database = build_compressed_database(context, settings, out_compressed_tracks);
+		// Reset everything just to be safe
+		for (uint32_t list_index = 0; list_index < num_added_tracks; ++list_index)
+			out_added_compressed_tracks[list_index] = nullptr;
+		out_database = nullptr;
 
-		return error_result();
+		// Validate everything and early out if something isn't right
+		const error_result settings_result = settings.is_valid();
+		if (settings_result.any())
+			return error_result("Compression database settings are invalid");
+
+		const error_result database_result = database.is_valid(true);
+		if (database_result.any())
+			return database_result;
+
+		const database_header& header = get_database_header(database);
+		if (!header.get_is_bulk_data_inline())
+			return error_result("Bulk data is not inline in source database");
+
+		if (!header.get_has_clip_chunk_ranges())
+			return error_result("Source database does not contain clip chunk ranges, it must be built again");
+
+		if (header.max_chunk_size != settings.max_chunk_size)
+			return error_result("The max chunk size must match the source database");
+
+		if (num_removed_tracks != 0 && removed_tracks_list == nullptr)
+			return error_result("No removed compressed track list provided");
+
+		if (num_added_tracks != 0)
+		{
+			const error_result tracks_list_result = validate_contributing_error_tracks(added_tracks_list, num_added_tracks);
+			if (tracks_list_result.any())
+				return tracks_list_result;
+
+			if (calculate_num_frames(added_tracks_list, num_added_tracks) == 0)
+				return error_result("All added compressed track lists are empty");
+		}
+
+		const uint32_t num_source_clips = header.num_clips;
+		const database_clip_metadata* source_clip_metadatas = header.get_clip_metadatas();
+		const database_clip_chunk_range* source_clip_chunk_ranges = header.get_clip_chunk_ranges();
+		const uint32_t source_runtime_headers_size = num_source_clips * uint32_t(sizeof(database_runtime_clip_header)) + header.num_segments * uint32_t(sizeof(database_runtime_segment_header));
+
+		// Find the clips we remove, clip metadata is sorted by clip header offset
+		bool* is_source_clip_removed = allocate_type_array<bool>(allocator, num_source_clips);
+		std::fill(is_source_clip_removed, is_source_clip_removed + num_source_clips, false);
+
+		error_result result;
+		for (uint32_t list_index = 0; list_index < num_removed_tracks && result.empty(); ++list_index)
+		{
+			const compressed_tracks* tracks = removed_tracks_list[list_index];
+			if (tracks == nullptr || !tracks->has_database())
+			{
+				result = error_result("Removed compressed track instance is not bound to a database");
+				break;
+			}
+
+			const uint32_t clip_header_offset = get_tracks_database_header(*tracks)->clip_header_offset;
+			const database_clip_metadata* clip_metadata = std::lower_bound(source_clip_metadatas, source_clip_metadatas + num_source_clips, clip_header_offset,
+				[](const database_clip_metadata& metadata, uint32_t offset) { return uint32_t(metadata.clip_header_offset) < offset; });
+
+			const uint32_t clip_index = uint32_t(clip_metadata - source_clip_metadatas);
+			if (clip_index == num_source_clips || uint32_t(clip_metadata->clip_header_offset) != clip_header_offset || clip_metadata->clip_hash != tracks->get_hash())
+				result = error_result("Removed compressed track instance is not bound to the source database");
+			else
+				is_source_clip_removed[clip_index] = true;
+		}
+
+		if (result.any())
+		{
+			deallocate_type_array(allocator, is_source_clip_removed, num_source_clips);
+			return result;
+		}
+
+		uint32_t num_removed_clips = 0;
+		for (uint32_t clip_index = 0; clip_index < num_source_clips; ++clip_index)
+			num_removed_clips += is_source_clip_removed[clip_index] ? 1 : 0;
+
+		const uint32_t num_clips = num_source_clips - num_removed_clips + num_added_tracks;
+		if (num_clips == 0)
+		{
+			deallocate_type_array(allocator, is_source_clip_removed, num_source_clips);
+			return error_result("The updated database would not contain any clips");
+		}
+
+		// Removed clips free their runtime headers, adjacent ones merge and the space past the end is always free
+		uint32_t* removed_clip_header_offsets = allocate_type_array<uint32_t>(allocator, num_removed_clips);
+		database_runtime_headers_range* free_ranges = allocate_type_array<database_runtime_headers_range>(allocator, num_removed_clips + 1);
+		uint32_t num_free_ranges = 0;
+		uint32_t runtime_headers_end = 0;	// End of the runtime headers in use
+
+		for (uint32_t clip_index = 0, removed_clip_index = 0; clip_index < num_source_clips; ++clip_index)
+		{
+			// Clips own the runtime header memory up to the next clip
+			const uint32_t clip_header_offset = uint32_t(source_clip_metadatas[clip_index].clip_header_offset);
+			const uint32_t clip_headers_end = clip_index + 1 < num_source_clips ? uint32_t(source_clip_metadatas[clip_index + 1].clip_header_offset) : source_runtime_headers_size;
+
+			if (!is_source_clip_removed[clip_index])
+			{
+				runtime_headers_end = std::max<uint32_t>(runtime_headers_end, clip_headers_end);
+				continue;
+			}
+
+			removed_clip_header_offsets[removed_clip_index++] = clip_header_offset;
+
+			if (num_free_ranges != 0 && free_ranges[num_free_ranges - 1].offset + free_ranges[num_free_ranges - 1].size == clip_header_offset)
+				free_ranges[num_free_ranges - 1].size += clip_headers_end - clip_header_offset;
+			else
+				free_ranges[num_free_ranges++] = database_runtime_headers_range{ clip_header_offset, clip_headers_end - clip_header_offset };
+		}
+
+		if (num_free_ranges != 0 && free_ranges[num_free_ranges - 1].offset + free_ranges[num_free_ranges - 1].size == source_runtime_headers_size)
+			free_ranges[num_free_ranges - 1].size = ~0U - free_ranges[num_free_ranges - 1].offset;
+		else
+			free_ranges[num_free_ranges++] = database_runtime_headers_range{ source_runtime_headers_size, ~0U - source_runtime_headers_size };
+
+		// Added clips reuse the first free range large enough, a changed clip typically reuses the runtime headers of its previous version
+		uint32_t* clip_header_offsets = allocate_type_array<uint32_t>(allocator, num_added_tracks);
+		uint32_t* built_clip_header_offsets = allocate_type_array<uint32_t>(allocator, num_added_tracks);
+
+		for (uint32_t list_index = 0; list_index < num_added_tracks; ++list_index)
+		{
+			const uint32_t num_segments = get_num_database_segments(*added_tracks_list[list_index]);
+			const uint32_t clip_headers_size = get_database_runtime_clip_headers_size(num_segments);
+
+			database_runtime_headers_range* free_range = std::find_if(free_ranges, free_ranges + num_free_ranges,
+				[clip_headers_size](const database_runtime_headers_range& range) { return range.size >= clip_headers_size; });
+			ACL_ASSERT(free_range != free_ranges + num_free_ranges, "The last free range is unbounded");
+
+			clip_header_offsets[list_index] = free_range->offset;
+			free_range->offset += clip_headers_size;
+			free_range->size -= clip_headers_size;
+
+			runtime_headers_end = std::max<uint32_t>(runtime_headers_end, free_range->offset);
+		}
+
+		// Our segment count sizes the runtime headers, it includes the free runtime headers left by removed clips
+		const uint32_t runtime_clip_headers_size = num_clips * uint32_t(sizeof(database_runtime_clip_header));
+		const uint32_t num_segments = (runtime_headers_end - runtime_clip_headers_size + uint32_t(sizeof(database_runtime_segment_header)) - 1) / uint32_t(sizeof(database_runtime_segment_header));
+
+		// Build our added clips and their chunks as if they were alone in a database
+		database_tier_update tier_updates[k_num_database_tiers];
+		database_clip_entry* clip_entries = allocate_type_array<database_clip_entry>(allocator, num_clips);
+		uint32_t num_clip_entries = 0;
+
+		{
+			frame_assignment_context context(allocator, added_tracks_list, num_added_tracks, num_added_tracks != 0 ? calculate_num_movable_frames(added_tracks_list, num_added_tracks) : 0);
+
+			if (num_added_tracks != 0)
+			{
+				// Assign every frame to its tier and build our added compressed track instances with their runtime clip header offsets
+				assign_frames_to_tiers(context, settings, calculate_num_frames(added_tracks_list, num_added_tracks));
+				build_compressed_tracks(context, true, clip_header_offsets, compression_job_scheduler(), out_added_compressed_tracks);
+			}
+
+			calculate_clip_header_offsets(added_tracks_list, num_added_tracks, built_clip_header_offsets);
+
+			database_clip_chunk_range* added_clip_chunk_ranges = allocate_type_array<database_clip_chunk_range>(allocator, num_added_tracks);
+
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers && result.empty(); ++tier_index)
+			{
+				const quality_tier tier = get_database_quality_tier(tier_index);
+
+				const uint32_t num_new_chunks = num_added_tracks != 0 ? write_database_chunk_descriptions(context, settings, tier, nullptr) : 0;
+				const uint32_t new_bulk_data_size = num_added_tracks != 0 ? write_database_bulk_data(context, settings, tier, out_added_compressed_tracks, nullptr) : 0;
+
+				database_chunk_description* new_chunk_descriptions = allocate_type_array<database_chunk_description>(allocator, num_new_chunks);
+				uint8_t* new_bulk_data = allocate_type_array<uint8_t>(allocator, new_bulk_data_size);
+				std::memset(new_bulk_data, 0, new_bulk_data_size);
+
+				if (num_new_chunks != 0)
+				{
+					write_database_chunk_descriptions(context, settings, tier, new_chunk_descriptions);
+					write_database_bulk_data(context, settings, tier, out_added_compressed_tracks, new_bulk_data);
+				}
+
+				if (num_added_tracks != 0)
+					write_database_clip_chunk_ranges(context, settings, tier, added_clip_chunk_ranges);
+
+				database_tier_update& tier_update = tier_updates[tier_index];
+				if (initialize_tier_update(allocator, header, tier_index, new_chunk_descriptions, num_new_chunks, new_bulk_data, new_bulk_data_size, tier_update))
+				{
+					remap_tier_update_clip_headers(tier_update, built_clip_header_offsets, clip_header_offsets, num_added_tracks);
+					remove_tier_update_clips(tier_update, removed_clip_header_offsets, num_removed_clips);
+
+					// A tier retains its encoding, new tiers follow our settings
+					if (tier_update.num_source_chunks != 0)
+						tier_update.is_entropy_coded = header.get_is_bulk_data_entropy_coded(tier_index);
+					else
+						tier_update.is_entropy_coded = tier == quality_tier::lowest_importance && settings.entropy_code_low_importance_tier && tier_update.num_chunks != 0;
+
+					encode_tier_update(allocator, header, tier_index, tier_update);
+				}
+				else
+					result = error_result("Failed to decode the source database bulk data");
+
+				deallocate_type_array(allocator, new_bulk_data, new_bulk_data_size);
+				deallocate_type_array(allocator, new_chunk_descriptions, num_new_chunks);
+			}
+
+			// Retained clips keep their runtime headers and chunk ranges, added clips follow the source chunks
+			for (uint32_t clip_index = 0; clip_index < num_source_clips; ++clip_index)
+			{
+				if (is_source_clip_removed[clip_index])
+					continue;
+
+				clip_entries[num_clip_entries].metadata = source_clip_metadatas[clip_index];
+				clip_entries[num_clip_entries].chunk_range = source_clip_chunk_ranges[clip_index];
+				num_clip_entries++;
+			}
+
+			for (uint32_t list_index = 0; list_index < num_added_tracks && result.empty(); ++list_index)
+			{
+				database_clip_entry& clip_entry = clip_entries[num_clip_entries++];
+				clip_entry.metadata.clip_hash = out_added_compressed_tracks[list_index]->get_hash();
+				clip_entry.metadata.clip_header_offset = clip_header_offsets[list_index];
+				clip_entry.chunk_range = added_clip_chunk_ranges[list_index];
+
+				for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+					clip_entry.chunk_range.first_chunk_index[tier_index] += tier_updates[tier_index].num_source_chunks;
+			}
+
+			deallocate_type_array(allocator, added_clip_chunk_ranges, num_added_tracks);
+		}
+
+		if (result.empty())
+		{
+			// Clip metadata is sorted by clip header offset
+			std::sort(clip_entries, clip_entries + num_clip_entries,
+				[](const database_clip_entry& lhs, const database_clip_entry& rhs) { return uint32_t(lhs.metadata.clip_header_offset) < uint32_t(rhs.metadata.clip_header_offset); });
+
+			// Pad every tier but the lowest to ensure alignment since the next tier follows
+			uint32_t stored_bulk_data_size[k_num_database_tiers];
+			uint32_t num_encoded_chunks = 0;
+			uint32_t total_stored_bulk_data_size = 0;
+
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				const database_tier_update& tier_update = tier_updates[tier_index];
+				const bool is_lowest_tier = get_database_quality_tier(tier_index) == quality_tier::lowest_importance;
+
+				stored_bulk_data_size[tier_index] = is_lowest_tier ? tier_update.stored_bulk_data_size : align_to(tier_update.stored_bulk_data_size, k_database_bulk_data_alignment);
+				num_encoded_chunks += tier_update.is_entropy_coded ? tier_update.num_chunks : 0;
+				total_stored_bulk_data_size += stored_bulk_data_size[tier_index];
+			}
+
+			uint32_t database_buffer_size = 0;
+			database_buffer_size += sizeof(raw_buffer_header);										// Header
+			database_buffer_size += sizeof(database_header);										// Header
+
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				database_buffer_size = align_to(database_buffer_size, 4);							// Align chunk descriptions
+				database_buffer_size += tier_updates[tier_index].num_chunks * sizeof(database_chunk_description);	// Chunk descriptions
+			}
+
+			database_buffer_size = align_to(database_buffer_size, 4);								// Align clip hashes
+			database_buffer_size += num_clips * sizeof(database_clip_metadata);						// Clip metadata
+			database_buffer_size += num_clips * sizeof(database_clip_chunk_range);					// Clip chunk ranges
+			database_buffer_size += num_encoded_chunks * sizeof(database_chunk_description);		// Encoded chunk descriptions
+
+			database_buffer_size = align_to(database_buffer_size, k_database_bulk_data_alignment);	// Align bulk data
+			database_buffer_size += total_stored_bulk_data_size;									// Bulk data
+
+			uint8_t* database_buffer = allocate_type_array_aligned<uint8_t>(allocator, database_buffer_size, alignof(compressed_database));
+			std::memset(database_buffer, 0, database_buffer_size);
+
+			out_database = reinterpret_cast<compressed_database*>(database_buffer);
+
+			raw_buffer_header* database_buffer_header = safe_ptr_cast<raw_buffer_header>(database_buffer);
+			database_buffer += sizeof(raw_buffer_header);
+
+			const uint8_t* db_header_start = database_buffer;
+			database_header* db_header = safe_ptr_cast<database_header>(database_buffer);
+			database_buffer += sizeof(database_header);
+
+			// Write our header
+			db_header->tag = static_cast<uint32_t>(buffer_tag32::compressed_database);
+			db_header->version = compressed_tracks_version16::latest;
+			db_header->max_chunk_size = settings.max_chunk_size;
+			db_header->num_clips = num_clips;
+			db_header->num_segments = num_segments;
+			db_header->set_is_bulk_data_inline(true);	// Data is always inline when compressing
+			db_header->set_has_clip_chunk_ranges(true);
+			db_header->set_num_tiers(k_num_database_tiers);
+
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				db_header->num_chunks[tier_index] = tier_updates[tier_index].num_chunks;
+				db_header->bulk_data_size[tier_index] = stored_bulk_data_size[tier_index];
+				db_header->set_is_bulk_data_entropy_coded(tier_index, tier_updates[tier_index].is_entropy_coded);
+			}
+
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				database_buffer = align_to(database_buffer, 4);									// Align chunk descriptions
+				database_buffer += tier_updates[tier_index].num_chunks * sizeof(database_chunk_description);	// Chunk descriptions
+			}
+
+			database_buffer = align_to(database_buffer, 4);										// Align clip hashes
+			db_header->clip_metadata_offset = uint32_t(database_buffer - db_header_start);		// Clip metadata
+			database_buffer += num_clips * sizeof(database_clip_metadata);						// Clip metadata
+			database_buffer += num_clips * sizeof(database_clip_chunk_range);					// Clip chunk ranges
+			database_buffer += num_encoded_chunks * sizeof(database_chunk_description);			// Encoded chunk descriptions
+
+			database_buffer = align_to(database_buffer, k_database_bulk_data_alignment);		// Align bulk data
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				if (stored_bulk_data_size[tier_index] != 0)
+					db_header->bulk_data_offset[tier_index] = uint32_t(database_buffer - db_header_start);	// Bulk data
+				else
+					db_header->bulk_data_offset[tier_index] = invalid_ptr_offset();
+				database_buffer += stored_bulk_data_size[tier_index];							// Bulk data
+			}
+
+			ACL_ASSERT(uint32_t(database_buffer - reinterpret_cast<uint8_t*>(out_database)) == database_buffer_size, "Unexpected amount of data written");
+
+			// Write our chunk descriptions, clip metadata, and clip chunk ranges
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+				std::memcpy(db_header->get_chunk_descriptions(tier_index), tier_updates[tier_index].chunk_descriptions, tier_updates[tier_index].num_chunks * sizeof(database_chunk_description));
+
+			database_clip_metadata* clip_metadatas = db_header->get_clip_metadatas();
+			database_clip_chunk_range* clip_chunk_ranges = db_header->get_clip_chunk_ranges();
+			for (uint32_t clip_index = 0; clip_index < num_clips; ++clip_index)
+			{
+				clip_metadatas[clip_index] = clip_entries[clip_index].metadata;
+				clip_chunk_ranges[clip_index] = clip_entries[clip_index].chunk_range;
+			}
+
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				const database_tier_update& tier_update = tier_updates[tier_index];
+
+				if (tier_update.is_entropy_coded)
+					std::memcpy(db_header->get_encoded_chunk_descriptions(tier_index), tier_update.encoded_chunk_descriptions, tier_update.num_chunks * sizeof(database_chunk_description));
+
+				// Write our bulk data
+				if (tier_update.stored_bulk_data_size != 0)
+					std::memcpy(db_header->get_bulk_data(tier_index), tier_update.stored_bulk_data, tier_update.stored_bulk_data_size);
+
+				db_header->bulk_data_hash[tier_index] = hash_raw_buffer(db_header->version, db_header->get_bulk_data(tier_index), stored_bulk_data_size[tier_index]);
+			}
+
+			// Finish the raw buffer header
+			database_buffer_header->size = database_buffer_size;
+			database_buffer_header->hash = hash_raw_buffer(db_header->version, safe_ptr_cast<const uint8_t>(db_header), database_buffer_size - sizeof(raw_buffer_header));	// Hash everything but the raw buffer header
+
+			ACL_ASSERT(out_database->is_valid(true).empty(), "Failed to update compressed database");
+		}
+		else
+		{
+			// Something went wrong, release what we built
+			for (uint32_t list_index = 0; list_index < num_added_tracks; ++list_index)
+			{
+				if (out_added_compressed_tracks[list_index] != nullptr)
+				{
+					deallocate_type_array(allocator, reinterpret_cast<uint8_t*>(out_added_compressed_tracks[list_index]), out_added_compressed_tracks[list_index]->get_size());
+					out_added_compressed_tracks[list_index] = nullptr;
+				}
+			}
+		}
+
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			deallocate_tier_update(allocator, tier_updates[tier_index]);
+
+		deallocate_type_array(allocator, clip_entries, num_clips);
+		deallocate_type_array(allocator, built_clip_header_offsets, num_added_tracks);
+		deallocate_type_array(allocator, clip_header_offsets, num_added_tracks);
+		deallocate_type_array(allocator, free_ranges, num_removed_clips + 1);
+		deallocate_type_array(allocator, removed_clip_header_offsets, num_removed_clips);
+		deallocate_type_array(allocator, is_source_clip_removed, num_source_clips);
+
+		return result;
 	}
 
-	inline error_result split_database_bulk_data(iallocator& allocator, const compressed_database& database, compressed_database*& out_split_database, uint8_t*& out_bulk_data_medium, uint8_t*& out_bulk_data_low)
+	inline error_result split_database_bulk_data(iallocator& allocator, const compressed_database& database, compressed_database*& out_split_database, uint8_t* (&out_bulk_data)[k_num_database_tiers])
 	{
 		using namespace acl_impl;
 
@@ -1320,10 +3032,16 @@ namespace acl
 		if (!database.is_bulk_data_inline())
 			return error_result("Bulk data is not inline in source database");
 
+		uint32_t bulk_data_size[k_num_database_tiers];
+		uint32_t total_bulk_data_size = 0;
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			bulk_data_size[tier_index] = database.get_bulk_data_size(get_database_quality_tier(tier_index));
+			total_bulk_data_size += bulk_data_size[tier_index];
+		}
+
 		const uint32_t total_size = database.get_total_size();
-		const uint32_t bulk_data_medium_size = database.get_bulk_data_size(quality_tier::medium_importance);
-		const uint32_t bulk_data_low_size = database.get_bulk_data_size(quality_tier::lowest_importance);
-		const uint32_t db_size = total_size - bulk_data_medium_size - bulk_data_low_size;
+		const uint32_t db_size = total_size - total_bulk_data_size;
 
 		// Allocate and setup our new database
 		uint8_t* database_buffer = allocate_type_array_aligned<uint8_t>(allocator, db_size, alignof(compressed_database));
@@ -1337,36 +3055,51 @@ namespace acl
 		database_header* db_header = safe_ptr_cast<database_header>(database_buffer);
 		database_buffer += sizeof(database_header);
 
-		db_header->bulk_data_offset[0] = invalid_ptr_offset();
-		db_header->bulk_data_offset[1] = invalid_ptr_offset();
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			db_header->bulk_data_offset[tier_index] = invalid_ptr_offset();
 		db_header->set_is_bulk_data_inline(false);
 
 		database_buffer_header->size = db_size;
-		database_buffer_header->hash = hash32(safe_ptr_cast<const uint8_t>(db_header), db_size - sizeof(raw_buffer_header));	// Hash everything but the raw buffer header
+		database_buffer_header->hash = hash_raw_buffer(db_header->version, safe_ptr_cast<const uint8_t>(db_header), db_size - sizeof(raw_buffer_header));	// Hash everything but the raw buffer header
 		ACL_ASSERT(out_split_database->is_valid(true).empty(), "Failed to split database");
 
 		// Allocate and setup our new bulk data
-		uint8_t* bulk_data_medium_buffer = bulk_data_medium_size != 0 ? allocate_type_array_aligned<uint8_t>(allocator, bulk_data_medium_size, k_database_bulk_data_alignment) : nullptr;
-		out_bulk_data_medium = bulk_data_medium_buffer;
-
-		std::memcpy(bulk_data_medium_buffer, database.get_bulk_data(quality_tier::medium_importance), bulk_data_medium_size);
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			const quality_tier tier = get_database_quality_tier(tier_index);
 
-		uint8_t* bulk_data_low_buffer = bulk_data_low_size != 0 ? allocate_type_array_aligned<uint8_t>(allocator, bulk_data_low_size, k_database_bulk_data_alignment) : nullptr;
-		out_bulk_data_low = bulk_data_low_buffer;
+			uint8_t* bulk_data_buffer = bulk_data_size[tier_index] != 0 ? allocate_type_array_aligned<uint8_t>(allocator, bulk_data_size[tier_index], k_database_bulk_data_alignment) : nullptr;
+			out_bulk_data[tier_index] = bulk_data_buffer;
 
-		std::memcpy(bulk_data_low_buffer, database.get_bulk_data(quality_tier::lowest_importance), bulk_data_low_size);
+			std::memcpy(bulk_data_buffer, database.get_bulk_data(tier), bulk_data_size[tier_index]);
 
 #if defined(ACL_HAS_ASSERT_CHECKS)
-		const uint32_t bulk_data_medium_hash = hash32(bulk_data_medium_buffer, bulk_data_medium_size);
-		ACL_ASSERT(bulk_data_medium_hash == database.get_bulk_data_hash(quality_tier::medium_importance), "Bulk data hash mismatch");
-
-		const uint32_t bulk_data_low_hash = hash32(bulk_data_low_buffer, bulk_data_low_size);
-		ACL_ASSERT(bulk_data_low_hash == database.get_bulk_data_hash(quality_tier::lowest_importance), "Bulk data hash mismatch");
+			const uint32_t bulk_data_hash = hash_raw_buffer(db_header->version, bulk_data_buffer, bulk_data_size[tier_index]);
+			ACL_ASSERT(bulk_data_hash == database.get_bulk_data_hash(tier), "Bulk data hash mismatch");
 #endif
+		}
 
 		return error_result();
 	}
 
+	inline error_result split_database_bulk_data(iallocator& allocator, const compressed_database& database, compressed_database*& out_split_database, uint8_t*& out_bulk_data_medium, uint8_t*& out_bulk_data_low)
+	{
+		// Intermediate tiers, if any, have no output buffer and must be empty
+		for (uint32_t tier_index = 1; tier_index < k_num_database_tiers - 1; ++tier_index)
+		{
+			if (database.get_bulk_data_size(get_database_quality_tier(tier_index)) != 0)
+				return error_result("Intermediate tiers contain bulk data, use the overload that outputs one bulk data buffer per tier");
+		}
+
+		uint8_t* bulk_data[k_num_database_tiers] = {};
+		const error_result result = split_database_bulk_data(allocator, database, out_split_database, bulk_data);
+
+		out_bulk_data_medium = bulk_data[0];
+		out_bulk_data_low = bulk_data[k_num_database_tiers - 1];
+
+		return result;
+	}
+
 	inline error_result strip_database_quality_tier(iallocator& allocator, const compressed_database& database, quality_tier tier, compressed_database*& out_stripped_database)
 	{
 		using namespace acl_impl;
@@ -1378,36 +3111,51 @@ namespace acl
 		if (tier == quality_tier::highest_importance)
 			return error_result("The database does not contain data for the high importance tier, it lives inside compressed_tracks");
 
+		if (!is_database_quality_tier(tier))
+			return error_result("Invalid quality tier");
+
 		if (!database.has_bulk_data(tier))
 			return error_result("Cannot strip an empty quality tier");
 
-		const uint32_t tier_index = uint32_t(tier) - 1;
+		const uint32_t stripped_tier_index = uint32_t(tier) - 1;
 		const bool is_bulk_data_inline = database.is_bulk_data_inline();
 		const database_header& ref_header = get_database_header(database);
-		const uint32_t num_medium_chunks = tier != quality_tier::medium_importance ? database.get_num_chunks(quality_tier::medium_importance) : 0;
-		const uint32_t num_low_chunks = tier != quality_tier::lowest_importance ? database.get_num_chunks(quality_tier::lowest_importance) : 0;
 		const uint32_t num_tracks = ref_header.num_clips;
 
 		// Bulk data sizes are already padded for alignment
-		const uint32_t bulk_data_medium_size = tier != quality_tier::medium_importance ? database.get_bulk_data_size(quality_tier::medium_importance) : 0;
-		const uint32_t bulk_data_low_size = tier != quality_tier::lowest_importance ? database.get_bulk_data_size(quality_tier::lowest_importance) : 0;
+		uint32_t num_chunks[k_num_database_tiers];
+		uint32_t num_encoded_chunks[k_num_database_tiers];
+		uint32_t bulk_data_size[k_num_database_tiers];
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			const bool is_stripped = tier_index == stripped_tier_index;
+			num_chunks[tier_index] = is_stripped ? 0 : database.get_num_chunks(get_database_quality_tier(tier_index));
+			num_encoded_chunks[tier_index] = is_stripped ? 0 : ref_header.get_num_encoded_chunks(tier_index);
+			bulk_data_size[tier_index] = is_stripped ? 0 : database.get_bulk_data_size(get_database_quality_tier(tier_index));
+		}
 
 		uint32_t database_buffer_size = 0;
 		database_buffer_size += sizeof(raw_buffer_header);										// Header
 		database_buffer_size += sizeof(database_header);										// Header
 
-		database_buffer_size = align_to(database_buffer_size, 4);								// Align chunk descriptions
-		database_buffer_size += num_medium_chunks * sizeof(database_chunk_description);			// Chunk descriptions
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			database_buffer_size = align_to(database_buffer_size, 4);							// Align chunk descriptions
+			database_buffer_size += num_chunks[tier_index] * sizeof(database_chunk_description);	// Chunk descriptions
+		}
 
-		database_buffer_size = align_to(database_buffer_size, 4);								// Align chunk descriptions
-		database_buffer_size += num_low_chunks * sizeof(database_chunk_description);			// Chunk descriptions
+		const bool has_clip_chunk_ranges = ref_header.get_has_clip_chunk_ranges();
 
 		database_buffer_size = align_to(database_buffer_size, 4);								// Align clip hashes
 		database_buffer_size += num_tracks * sizeof(database_clip_metadata);					// Clip metadata
+		if (has_clip_chunk_ranges)
+			database_buffer_size += num_tracks * sizeof(database_clip_chunk_range);				// Clip chunk ranges
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			database_buffer_size += num_encoded_chunks[tier_index] * sizeof(database_chunk_description);	// Encoded chunk descriptions
 
 		database_buffer_size = align_to(database_buffer_size, k_database_bulk_data_alignment);	// Align bulk data
-		database_buffer_size += bulk_data_medium_size;											// Bulk data
-		database_buffer_size += bulk_data_low_size;												// Bulk data
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			database_buffer_size += bulk_data_size[tier_index];									// Bulk data
 
 		// Allocate and setup our new database
 		uint8_t* database_buffer = allocate_type_array_aligned<uint8_t>(allocator, database_buffer_size, alignof(compressed_database));
@@ -1424,82 +3172,97 @@ namespace acl
 		// Copy our header
 		std::memcpy(db_header, &get_database_header(database), sizeof(database_header));
 
-		database_buffer = align_to(database_buffer, 4);										// Align chunk descriptions
-		database_buffer += num_medium_chunks * sizeof(database_chunk_description);			// Chunk descriptions
-
-		database_buffer = align_to(database_buffer, 4);										// Align chunk descriptions
-		database_buffer += num_low_chunks * sizeof(database_chunk_description);				// Chunk descriptions
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			database_buffer = align_to(database_buffer, 4);									// Align chunk descriptions
+			database_buffer += num_chunks[tier_index] * sizeof(database_chunk_description);	// Chunk descriptions
+		}
 
 		database_buffer = align_to(database_buffer, 4);										// Align clip hashes
 		db_header->clip_metadata_offset = uint32_t(database_buffer - db_header_start);		// Clip metadata
 		database_buffer += num_tracks * sizeof(database_clip_metadata);						// Clip metadata
+		if (has_clip_chunk_ranges)
+			database_buffer += num_tracks * sizeof(database_clip_chunk_range);				// Clip chunk ranges
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			database_buffer += num_encoded_chunks[tier_index] * sizeof(database_chunk_description);	// Encoded chunk descriptions
 
 		database_buffer = align_to(database_buffer, k_database_bulk_data_alignment);		// Align bulk data
-		if (bulk_data_medium_size != 0)
-			db_header->bulk_data_offset[0] = uint32_t(database_buffer - db_header_start);	// Bulk data
-		else
-			db_header->bulk_data_offset[0] = invalid_ptr_offset();
-		database_buffer += bulk_data_medium_size;											// Bulk data
-
-		if (bulk_data_low_size != 0)
-			db_header->bulk_data_offset[1] = uint32_t(database_buffer - db_header_start);	// Bulk data
-		else
-			db_header->bulk_data_offset[1] = invalid_ptr_offset();
-		database_buffer += bulk_data_low_size;												// Bulk data
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			if (bulk_data_size[tier_index] != 0)
+				db_header->bulk_data_offset[tier_index] = uint32_t(database_buffer - db_header_start);	// Bulk data
+			else
+				db_header->bulk_data_offset[tier_index] = invalid_ptr_offset();
+			database_buffer += bulk_data_size[tier_index];									// Bulk data
+		}
 
 		// Zero out our stripped tier
-		db_header->num_chunks[tier_index] = 0;
-		db_header->bulk_data_size[tier_index] = 0;
-		db_header->bulk_data_offset[tier_index] = invalid_ptr_offset();
-		db_header->bulk_data_hash[tier_index] = hash32(nullptr, 0);
+		db_header->num_chunks[stripped_tier_index] = 0;
+		db_header->bulk_data_size[stripped_tier_index] = 0;
+		db_header->bulk_data_offset[stripped_tier_index] = invalid_ptr_offset();
+		db_header->bulk_data_hash[stripped_tier_index] = hash_raw_buffer(db_header->version, nullptr, 0);
+		db_header->set_is_bulk_data_entropy_coded(stripped_tier_index, false);
+
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			if (tier_index == stripped_tier_index)
+				continue;
+
+			// Copy our chunk descriptions
+			std::memcpy(db_header->get_chunk_descriptions(tier_index), ref_header.get_chunk_descriptions(tier_index), num_chunks[tier_index] * sizeof(database_chunk_description));
 
-		// Copy our chunk descriptions
-		if (tier != quality_tier::medium_importance)
-			std::memcpy(db_header->get_chunk_descriptions_medium(), ref_header.get_chunk_descriptions_medium(), num_medium_chunks * sizeof(database_chunk_description));
-		else if (tier != quality_tier::lowest_importance)
-			std::memcpy(db_header->get_chunk_descriptions_low(), ref_header.get_chunk_descriptions_low(), num_low_chunks * sizeof(database_chunk_description));
+			// Copy our encoded chunk descriptions, if any
+			if (num_encoded_chunks[tier_index] != 0)
+				std::memcpy(db_header->get_encoded_chunk_descriptions(tier_index), ref_header.get_encoded_chunk_descriptions(tier_index), num_encoded_chunks[tier_index] * sizeof(database_chunk_description));
+		}
 
 		// Copy our clip metadata
 		std::memcpy(db_header->get_clip_metadatas(), ref_header.get_clip_metadatas(), num_tracks * sizeof(database_clip_metadata));
 
-		// Copy our bulk data
-		if (is_bulk_data_inline)
+		// Copy our clip chunk ranges, the stripped tier no longer has any chunks
+		if (has_clip_chunk_ranges)
 		{
-			// Copy the remaining bulk data
-			if (tier != quality_tier::medium_importance)
+			database_clip_chunk_range* clip_chunk_ranges = db_header->get_clip_chunk_ranges();
+			std::memcpy(clip_chunk_ranges, ref_header.get_clip_chunk_ranges(), num_tracks * sizeof(database_clip_chunk_range));
+
+			for (uint32_t tracks_index = 0; tracks_index < num_tracks; ++tracks_index)
 			{
-				const uint8_t* src_bulk_data = database.get_bulk_data(quality_tier::medium_importance);
-				uint8_t* dst_bulk_data = db_header->get_bulk_data_medium();
-				std::memcpy(dst_bulk_data, src_bulk_data, bulk_data_medium_size);
+				clip_chunk_ranges[tracks_index].first_chunk_index[stripped_tier_index] = 0;
+				clip_chunk_ranges[tracks_index].num_chunks[stripped_tier_index] = 0;
 			}
-			else if (tier != quality_tier::lowest_importance)
+		}
+
+		// Copy the remaining bulk data
+		if (is_bulk_data_inline)
+		{
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
 			{
-				const uint8_t* src_bulk_data = database.get_bulk_data(quality_tier::lowest_importance);
-				uint8_t* dst_bulk_data = db_header->get_bulk_data_low();
-				std::memcpy(dst_bulk_data, src_bulk_data, bulk_data_low_size);
+				if (tier_index == stripped_tier_index)
+					continue;
+
+				const uint8_t* src_bulk_data = database.get_bulk_data(get_database_quality_tier(tier_index));
+				uint8_t* dst_bulk_data = db_header->get_bulk_data(tier_index);
+				std::memcpy(dst_bulk_data, src_bulk_data, bulk_data_size[tier_index]);
 			}
 		}
 
 		database_buffer_header->size = database_buffer_size;
-		database_buffer_header->hash = hash32(safe_ptr_cast<const uint8_t>(db_header), database_buffer_size - sizeof(raw_buffer_header));	// Hash everything but the raw buffer header
+		database_buffer_header->hash = hash_raw_buffer(db_header->version, safe_ptr_cast<const uint8_t>(db_header), database_buffer_size - sizeof(raw_buffer_header));	// Hash everything but the raw buffer header
 		ACL_ASSERT(out_stripped_database->is_valid(true).empty(), "Failed to strip database");
 
 #if defined(ACL_HAS_ASSERT_CHECKS)
 		if (is_bulk_data_inline)
 		{
-			if (tier != quality_tier::medium_importance)
-			{
-				const uint32_t bulk_data_size = out_stripped_database->get_bulk_data_size(quality_tier::medium_importance);
-				const uint8_t* bulk_data = out_stripped_database->get_bulk_data(quality_tier::medium_importance);
-				const uint32_t bulk_data_hash = hash32(bulk_data, bulk_data_size);
-				ACL_ASSERT(bulk_data_hash == database.get_bulk_data_hash(quality_tier::medium_importance), "Bulk data hash mismatch");
-			}
-			else if (tier != quality_tier::lowest_importance)
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
 			{
-				const uint32_t bulk_data_size = out_stripped_database->get_bulk_data_size(quality_tier::lowest_importance);
-				const uint8_t* bulk_data = out_stripped_database->get_bulk_data(quality_tier::lowest_importance);
-				const uint32_t bulk_data_hash = hash32(bulk_data, bulk_data_size);
-				ACL_ASSERT(bulk_data_hash == database.get_bulk_data_hash(quality_tier::lowest_importance), "Bulk data hash mismatch");
+				if (tier_index == stripped_tier_index)
+					continue;
+
+				const quality_tier remaining_tier = get_database_quality_tier(tier_index);
+				const uint32_t stripped_bulk_data_size = out_stripped_database->get_bulk_data_size(remaining_tier);
+				const uint8_t* bulk_data = out_stripped_database->get_bulk_data(remaining_tier);
+				const uint32_t bulk_data_hash = hash_raw_buffer(db_header->version, bulk_data, stripped_bulk_data_size);
+				ACL_ASSERT(bulk_data_hash == database.get_bulk_data_hash(remaining_tier), "Bulk data hash mismatch");
 			}
 		}
 #endif
@@ -1507,5 +3270,46 @@ namespace acl
 		return error_result();
 	}
 
+	inline error_result strip_keyframes_to_budget(iallocator& allocator, uint32_t target_size,
+		const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks,
+		compressed_tracks** out_compressed_tracks)
+	{
+		using namespace acl_impl;
+
+		// Reset everything just to be safe
+		for (uint32_t list_index = 0; list_index < num_compressed_tracks; ++list_index)
+			out_compressed_tracks[list_index] = nullptr;
+
+		// Validate everything and early out if something isn't right
+		const error_result tracks_list_result = validate_contributing_error_tracks(compressed_tracks_list, num_compressed_tracks);
+		if (tracks_list_result.any())
+			return tracks_list_result;
+
+		const uint32_t num_frames = calculate_num_frames(compressed_tracks_list, num_compressed_tracks);
+		if (num_frames == 0)
+			return error_result("All compressed track lists are empty");
+
+		// A frame is movable if it isn't the first or last frame of a segment
+		const uint32_t num_movable_frames = calculate_num_movable_frames(compressed_tracks_list, num_compressed_tracks);
+		ACL_ASSERT(num_movable_frames < num_frames, "Cannot strip more frames than we have");
+
+		frame_assignment_context context(allocator, compressed_tracks_list, num_compressed_tracks, num_movable_frames);
+
+		// Stripped frames are assigned to the lowest importance tier and discarded, like the database does across clips
+		const uint32_t num_stripped_frames = calculate_num_frames_to_strip(context, target_size);
+		context.set_tier_num_frames(quality_tier::highest_importance, num_frames - num_stripped_frames);
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers - 1; ++tier_index)
+			context.set_tier_num_frames(get_database_quality_tier(tier_index), 0);
+		context.set_tier_num_frames(quality_tier::lowest_importance, num_stripped_frames);
+
+		// Assign every frame to its tier
+		assign_frames_to_tiers(context);
+
+		// Build our new compressed track instances with the remaining frames
+		build_compressed_tracks(context, false, compression_job_scheduler(), out_compressed_tracks);
+
+		return error_result();
+	}
+
 	ACL_IMPL_VERSION_NAMESPACE_END
 }
@@ -0,0 +1,297 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Included only once from compress.h
+
+#include "acl/version.h"
+#include "acl/core/error_result.h"
+#include "acl/core/floating_point_exceptions.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/linear_arena_allocator.h"
+#include "acl/core/impl/variable_bit_rates.h"
+#include "acl/compression/compression_settings.h"
+#include "acl/compression/track_array.h"
+#include "acl/compression/impl/clip_context.h"
+#include "acl/compression/impl/compact_constant_streams.h"
+#include "acl/compression/impl/convert_rotation_streams.h"
+#include "acl/compression/impl/normalize_streams.h"
+#include "acl/compression/impl/optimize_looping.h"
+#include "acl/compression/impl/segment_streams.h"
+#include "acl/compression/impl/write_stream_data.h"
+#include "acl/compression/impl/write_sub_track_types.h"
+
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the lowest variable bit rate that quantizes a range with the provided extent
+		// within the tolerance, along with the error it yields.
+		inline uint8_t estimate_bit_rate(rtm::vector4f_arg0 extent, float tolerance, float& out_error)
+		{
+			const float max_extent = rtm::scalar_max(rtm::scalar_max(rtm::vector_get_x(extent), rtm::vector_get_y(extent)), rtm::vector_get_z(extent));
+
+			// Quantizing with N bits has an error of at most half a step: extent / ((2^N - 1) * 2)
+			for (uint8_t bit_rate = k_lowest_bit_rate; bit_rate < k_highest_bit_rate; ++bit_rate)
+			{
+				const float num_steps = float((1U << get_num_bits_at_bit_rate(bit_rate)) - 1);
+				const float error = max_extent / (num_steps * 2.0F);
+				if (error <= tolerance)
+				{
+					out_error = error;
+					return bit_rate;
+				}
+			}
+
+			// Raw samples are lossless
+			out_error = 0.0F;
+			return k_highest_bit_rate;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the extent of a sub-track within a segment, in the space of its raw samples.
+		// Segment ranges are normalized within the clip range when present.
+		inline rtm::vector4f RTM_SIMD_CALL get_segment_extent(const track_stream_range& clip_range, const track_stream_range* segment_range)
+		{
+			const rtm::vector4f clip_extent = clip_range.get_extent();
+			return segment_range != nullptr ? rtm::vector_mul(clip_extent, segment_range->get_extent()) : clip_extent;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Estimates how many bits a sub-track needs per sample and accumulates its estimated error.
+		template<class track_stream_type>
+		inline uint32_t estimate_animated_num_bits(const track_stream_type& stream, rtm::vector4f_arg0 extent, float tolerance, float error_scale, const uint8_t bit_rate_reductions[3], float& max_error)
+		{
+			if (!stream.is_bit_rate_variable())
+				return stream.get_packed_sample_size() * 8;	// Full precision formats have a fixed size
+
+			float error;
+			const uint8_t bit_rate = estimate_bit_rate(extent, tolerance, error);
+			max_error = std::max<float>(max_error, error * error_scale);
+
+			return get_animated_variable_bit_rate_num_bits(bit_rate, bit_rate_reductions);
+		}
+
+		inline error_result estimate_compressed_transform_size(iallocator& allocator, const track_array_qvvf& track_list, compression_settings settings, compressed_size_estimate& out_estimate)
+		{
+			error_result result = settings.is_valid();
+			if (result.any())
+				return result;
+
+			// Segmenting settings are an implementation detail
+			compression_segmenting_settings segmenting_settings;
+			segmenting_settings.enable_adaptive_segmenting = settings.enable_adaptive_segmenting;
+
+			const bool is_rotation_variable = is_rotation_format_variable(settings.rotation_format);
+			const bool is_translation_variable = is_vector_format_variable(settings.translation_format);
+			const bool is_scale_variable = is_vector_format_variable(settings.scale_format);
+
+			// If every track retains full precision, we disable segmenting since it provides no benefit
+			if (!is_rotation_variable && !is_translation_variable && !is_scale_variable)
+			{
+				segmenting_settings.ideal_num_samples = 0xFFFFFFFF;
+				segmenting_settings.max_num_samples = 0xFFFFFFFF;
+			}
+
+			range_reduction_flags8 range_reduction = range_reduction_flags8::none;
+			if (is_rotation_variable)
+				range_reduction |= range_reduction_flags8::rotations;
+
+			if (is_translation_variable)
+				range_reduction |= range_reduction_flags8::translations;
+
+			if (is_scale_variable)
+				range_reduction |= range_reduction_flags8::scales;
+
+			// Transient data lives in an arena, it is all released once we return
+			// The arena isn't thread safe, when jobs are used we allocate directly from the provided allocator
+			linear_arena_allocator arena_allocator(allocator);
+			iallocator& scratch_allocator = settings.job_scheduler.is_enabled() ? allocator : static_cast<iallocator&>(arena_allocator);
+
+			// Only the early stages run: they are linear in the number of samples
+			clip_context raw_clip_context;
+			if (!initialize_clip_context(scratch_allocator, track_list, settings, additive_clip_format8::none, raw_clip_context, true))
+				return error_result("Some samples are not finite");
+
+			clip_context lossy_clip_context;
+			initialize_clip_context(scratch_allocator, track_list, settings, additive_clip_format8::none, lossy_clip_context);
+
+			clip_context additive_base_clip_context;
+
+			const uint32_t num_input_transforms = raw_clip_context.num_bones;
+			rigid_shell_metadata_t* clip_shell_metadata = compute_clip_shell_distances(scratch_allocator, raw_clip_context, additive_base_clip_context);
+
+			raw_clip_context.clip_shell_metadata = clip_shell_metadata;
+			lossy_clip_context.clip_shell_metadata = clip_shell_metadata;
+
+			optimize_looping(lossy_clip_context, additive_base_clip_context, settings);
+			convert_rotation_streams(lossy_clip_context, settings.rotation_format, settings.job_scheduler);
+			extract_clip_bone_ranges(scratch_allocator, lossy_clip_context, settings.job_scheduler);
+			compact_constant_streams(scratch_allocator, lossy_clip_context, raw_clip_context, additive_base_clip_context, track_list, settings);
+			drop_largest_rotation_components(lossy_clip_context, settings.rotation_format);
+			convert_rotation_streams_to_log(lossy_clip_context, settings.rotation_format);
+
+			uint32_t clip_range_data_size = 0;
+			if (range_reduction != range_reduction_flags8::none)
+			{
+				if (settings.enable_rotation_clip_range_quantization)
+					quantize_rotation_clip_ranges(lossy_clip_context, settings.rotation_format, range_reduction);
+
+				normalize_clip_streams(lossy_clip_context, range_reduction, settings.job_scheduler);
+				clip_range_data_size = get_clip_range_data_size(lossy_clip_context, range_reduction, settings.rotation_format, settings.translation_format, settings.scale_format);
+				calculate_component_bit_rate_reductions(lossy_clip_context, settings.translation_format, settings.scale_format);
+			}
+
+			segment_streams(scratch_allocator, lossy_clip_context, segmenting_settings);
+
+			if (range_reduction != range_reduction_flags8::none && lossy_clip_context.num_segments > 1)
+			{
+				extract_segment_bone_ranges(scratch_allocator, lossy_clip_context, settings.job_scheduler);
+				normalize_segment_streams(lossy_clip_context, range_reduction, settings.job_scheduler);
+			}
+
+			uint32_t num_output_bones = 0;
+			uint32_t* output_bone_mapping = create_output_track_mapping(scratch_allocator, track_list, num_output_bones);
+
+			const bool has_quantized_constant_rotations = has_quantized_constant_rotation_groups(lossy_clip_context, output_bone_mapping, num_output_bones);
+			const uint32_t constant_data_size = get_constant_data_size(lossy_clip_context, output_bone_mapping, num_output_bones, has_quantized_constant_rotations);
+			const uint32_t format_per_track_data_size = get_format_per_track_data_size(lossy_clip_context, settings.rotation_format, settings.translation_format, settings.scale_format);
+
+			const uint32_t num_sub_tracks_per_bone = lossy_clip_context.has_scale ? 3 : 2;
+			const uint32_t num_sub_track_entries = ((num_output_bones + k_num_sub_tracks_per_packed_entry - 1) / k_num_sub_tracks_per_packed_entry) * num_sub_tracks_per_bone;
+
+			// Same layout as the compressed tracks, see compress_transform_track_list(..)
+			// Optional metadata isn't included
+			uint32_t buffer_size = 0;
+			buffer_size += sizeof(raw_buffer_header);
+			buffer_size += sizeof(tracks_header);
+			buffer_size += sizeof(transform_tracks_header);
+			buffer_size = align_to(buffer_size, 4);
+			buffer_size += lossy_clip_context.num_segments > 1 ? (uint32_t(sizeof(uint32_t)) * (lossy_clip_context.num_segments + 1)) : 0;
+			buffer_size = align_to(buffer_size, 4);
+			buffer_size += uint32_t(sizeof(segment_header)) * lossy_clip_context.num_segments;
+			buffer_size = align_to(buffer_size, 4);
+			buffer_size += num_sub_track_entries * uint32_t(sizeof(packed_sub_track_types));
+			buffer_size = align_to(buffer_size, 4);
+			buffer_size += constant_data_size;
+			buffer_size = align_to(buffer_size, 4);
+			buffer_size += clip_range_data_size;
+
+			// The bit rate search picks the lowest bit rate that meets the precision of every transform on its rigid shell
+			// Instead, we estimate it from the range of each sub-track: a quaternion component error of E moves the
+			// shell by roughly 2 * E * shell distance
+			float max_error = 0.0F;
+			uint32_t num_animated_sub_tracks = 0;
+
+			for (const segment_context& segment : lossy_clip_context.segment_iterator())
+			{
+				uint32_t num_animated_pose_bits = 0;
+
+				for (uint32_t output_index = 0; output_index < num_output_bones; ++output_index)
+				{
+					const uint32_t bone_index = output_bone_mapping[output_index];
+					const transform_streams& bone_stream = segment.bone_streams[bone_index];
+					const transform_range& clip_range = lossy_clip_context.ranges[bone_index];
+					const transform_range* segment_range = segment.ranges != nullptr ? &segment.ranges[bone_index] : nullptr;
+
+					const rigid_shell_metadata_t& shell = clip_shell_metadata[bone_index];
+					const float shell_distance = rtm::scalar_max(shell.local_shell_distance, 1.0E-6F);
+
+					if (!bone_stream.is_rotation_constant)
+					{
+						const rtm::vector4f extent = get_segment_extent(clip_range.rotation, segment_range != nullptr ? &segment_range->rotation : nullptr);
+						num_animated_pose_bits += estimate_animated_num_bits(bone_stream.rotations, extent, shell.precision / (2.0F * shell_distance), 2.0F * shell_distance, k_no_bit_rate_reductions, max_error);
+						num_animated_sub_tracks++;
+					}
+
+					if (!bone_stream.is_translation_constant)
+					{
+						const rtm::vector4f extent = get_segment_extent(clip_range.translation, segment_range != nullptr ? &segment_range->translation : nullptr);
+						num_animated_pose_bits += estimate_animated_num_bits(bone_stream.translations, extent, shell.precision, 1.0F, bone_stream.translation_bit_rate_reductions, max_error);
+						num_animated_sub_tracks++;
+					}
+
+					if (!bone_stream.is_scale_constant)
+					{
+						const rtm::vector4f extent = get_segment_extent(clip_range.scale, segment_range != nullptr ? &segment_range->scale : nullptr);
+						num_animated_pose_bits += estimate_animated_num_bits(bone_stream.scales, extent, shell.precision / shell_distance, shell_distance, bone_stream.scale_bit_rate_reductions, max_error);
+						num_animated_sub_tracks++;
+					}
+				}
+
+				buffer_size += format_per_track_data_size;
+				buffer_size = align_to(buffer_size, 2);
+				buffer_size += segment.range_data_size;
+				buffer_size = align_to(buffer_size, 4);
+				buffer_size += align_to(num_animated_pose_bits * segment.num_samples, 8) / 8;
+			}
+
+			buffer_size += 15;	// Padding for unaligned 16 byte loads
+
+			out_estimate.compressed_size = buffer_size;
+			out_estimate.max_error = max_error;
+			out_estimate.num_segments = lossy_clip_context.num_segments;
+			out_estimate.num_animated_sub_tracks = num_animated_sub_tracks;
+
+			deallocate_type_array(scratch_allocator, output_bone_mapping, num_output_bones);
+			deallocate_type_array(scratch_allocator, clip_shell_metadata, num_input_transforms);
+			destroy_clip_context(lossy_clip_context);
+			destroy_clip_context(raw_clip_context);
+
+			return error_result();
+		}
+	}
+
+	inline error_result estimate_compressed_size(iallocator& allocator, const track_array& track_list, const compression_settings& settings, compressed_size_estimate& out_estimate)
+	{
+		using namespace acl_impl;
+
+		out_estimate = compressed_size_estimate();
+
+		error_result result = track_list.is_valid();
+		if (result.any())
+			return result;
+
+		if (track_list.get_track_category() != track_category8::transformf)
+			return error_result("Only transform tracks can be estimated");
+
+		// Disable floating point exceptions during compression because we leverage all SIMD lanes
+		scope_disable_fp_exceptions fp_off;
+
+		return estimate_compressed_transform_size(allocator, track_array_cast<track_array_qvvf>(track_list), settings, out_estimate);
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
@@ -33,56 +33,509 @@
 #include "acl/core/error_result.h"
 #include "acl/core/floating_point_exceptions.h"
 #include "acl/core/iallocator.h"
+#include "acl/core/linear_arena_allocator.h"
+#include "acl/core/memory_utils.h"
+#include "acl/core/tracking_allocator.h"
+#include "acl/compression/compression_cache.h"
 #include "acl/compression/compression_settings.h"
 #include "acl/compression/output_stats.h"
 #include "acl/compression/track_array.h"
+#include "acl/compression/impl/write_compression_stats_impl.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 
 namespace acl
 {
 	ACL_IMPL_VERSION_NAMESPACE_BEGIN
 
+	namespace acl_impl
+	{
+		// Returns true and the cached compressed tracks if they are found and valid
+		inline bool find_cached_compressed_tracks(iallocator& allocator, compression_cache& cache, uint64_t cache_key, compressed_tracks*& out_compressed_tracks)
+		{
+			compressed_tracks* cached_tracks = cache.find(allocator, cache_key);
+			if (cached_tracks == nullptr)
+				return false;
+
+			if (cached_tracks->is_valid(true).any())
+			{
+				// Corrupted entry, ignore it and compress again
+				allocator.deallocate(cached_tracks, cached_tracks->get_size());
+				return false;
+			}
+
+			out_compressed_tracks = cached_tracks;
+			return true;
+		}
+
+		// Compressed tracks allocate their buffer once its exact size is known, we forward that request
+		// to the caller to write them in place. When the caller cannot provide a suitable buffer, we allocate
+		// one to complete compression and its output is discarded.
+		class output_buffer_allocator final : public iallocator
+		{
+		public:
+			output_buffer_allocator(iallocator& allocator, const compressed_tracks_output_buffer& output_buffer)
+				: m_allocator(allocator)
+				, m_output_buffer(output_buffer)
+				, m_fallback_buffer(nullptr)
+				, m_fallback_buffer_size(0)
+				, m_is_output_buffer_invalid(false)
+			{
+			}
+
+			~output_buffer_allocator() override
+			{
+				if (m_fallback_buffer != nullptr)
+					m_allocator.deallocate(m_fallback_buffer, m_fallback_buffer_size);
+			}
+
+			void* allocate(size_t size, size_t alignment) override
+			{
+				void* buffer = size <= size_t(~0U) ? m_output_buffer.request_buffer(m_output_buffer.user_data, uint32_t(size)) : nullptr;
+				if (buffer != nullptr && is_aligned_to(buffer, alignment))
+				{
+					m_is_output_buffer_invalid = false;
+					return buffer;
+				}
+
+				ACL_ASSERT(m_fallback_buffer == nullptr, "Only a single fallback buffer is supported");
+				m_fallback_buffer = m_allocator.allocate(size, alignment);
+				m_fallback_buffer_size = size;
+				m_is_output_buffer_invalid = true;
+				return m_fallback_buffer;
+			}
+
+			void deallocate(void* ptr, size_t size) override
+			{
+				// The caller owns its buffers, only our own is freed
+				if (ptr != nullptr && ptr == m_fallback_buffer)
+				{
+					m_allocator.deallocate(ptr, size);
+					m_fallback_buffer = nullptr;
+					m_fallback_buffer_size = 0;
+				}
+			}
+
+			bool is_output_buffer_invalid() const { return m_is_output_buffer_invalid; }
+
+		private:
+			output_buffer_allocator(const output_buffer_allocator&) = delete;
+			output_buffer_allocator& operator=(const output_buffer_allocator&) = delete;
+
+			iallocator&								m_allocator;
+			const compressed_tracks_output_buffer&	m_output_buffer;
+
+			void*									m_fallback_buffer;
+			size_t									m_fallback_buffer_size;
+			bool									m_is_output_buffer_invalid;
+		};
+
+		// Records the memory measured once compression succeeds
+		inline void finalize_memory_stats(const tracking_allocator& memory_tracker, output_stats& out_stats)
+		{
+			out_stats.memory.peak_size = memory_tracker.get_peak_size();
+			out_stats.memory.num_allocations = memory_tracker.get_num_allocations();
+
+#if defined(ACL_USE_SJSON)
+			if (out_stats.writer != nullptr && are_all_enum_flags_set(out_stats.logging, stat_logging::summary))
+				write_memory_stats(out_stats.memory, *out_stats.writer);
+#endif
+		}
+
+		// The compressed tracks are allocated with the output allocator, everything else with the provided allocator
+		inline error_result compress_track_list_impl(iallocator& output_allocator, iallocator& allocator, const track_array& track_list, const compression_settings& settings, compressed_tracks*& out_compressed_tracks, output_stats& out_stats)
+		{
+			error_result result = track_list.is_valid();
+			if (result.any())
+				return result;
+
+			uint64_t cache_key = 0;
+			if (settings.cache != nullptr)
+			{
+				cache_key = get_compression_cache_key(track_list, settings);
+				if (find_cached_compressed_tracks(output_allocator, *settings.cache, cache_key, out_compressed_tracks))
+				{
+					settings.progress.report(1.0F);
+					return error_result();
+				}
+			}
+
+			{
+				// Disable floating point exceptions during compression because we leverage all SIMD lanes
+				// and we might intentionally divide by zero, etc.
+				scope_disable_fp_exceptions fp_off;
+
+				// When requested, every allocation goes through a tracker to measure the memory used
+				const bool track_memory = are_any_enum_flags_set(out_stats.logging, stat_logging::memory);
+				tracking_allocator memory_tracker(allocator);
+				iallocator& tracked_allocator = track_memory ? static_cast<iallocator&>(memory_tracker) : allocator;
+				iallocator& tracked_output_allocator = track_memory && &output_allocator == &allocator ? static_cast<iallocator&>(memory_tracker) : output_allocator;
+
+				// Transient data lives in an arena, only the compressed tracks come from the output allocator
+				// The arena isn't thread safe, when jobs are used we allocate directly from the provided allocator
+				linear_arena_allocator arena_allocator(tracked_allocator);
+				iallocator& scratch_allocator = settings.job_scheduler.is_enabled() ? tracked_allocator : static_cast<iallocator&>(arena_allocator);
+
+				if (track_list.get_track_category() == track_category8::transformf)
+					result = compress_transform_track_list(tracked_output_allocator, scratch_allocator, track_array_cast<track_array_qvvf>(track_list), settings, nullptr, additive_clip_format8::none, out_compressed_tracks, out_stats, nullptr, nullptr, track_memory ? &memory_tracker : nullptr);
+				else
+					result = compress_scalar_track_list(tracked_output_allocator, scratch_allocator, track_list, settings, out_compressed_tracks, out_stats);
+
+				if (track_memory && result.empty())
+					finalize_memory_stats(memory_tracker, out_stats);
+			}
+
+			if (settings.cache != nullptr && result.empty())
+				settings.cache->store(cache_key, *out_compressed_tracks);
+
+			return result;
+		}
+
+		inline error_result compress_track_list_impl(iallocator& output_allocator, iallocator& allocator, const track_array_qvvf& track_list, const compression_settings& settings, const track_array_qvvf& additive_base_track_list, additive_clip_format8 additive_format, compressed_tracks*& out_compressed_tracks, output_stats& out_stats,
+			const additive_base_context* prepared_additive_base = nullptr, const prepared_clip_context* prepared_clip = nullptr)
+		{
+			error_result result = track_list.is_valid();
+			if (result.any())
+				return result;
+
+			if (additive_format != additive_clip_format8::none)
+			{
+				result = additive_base_track_list.is_valid();
+				if (result.any())
+					return result;
+			}
+
+			uint64_t cache_key = 0;
+			if (settings.cache != nullptr)
+			{
+				cache_key = get_compression_cache_key(track_list, settings, additive_base_track_list, additive_format);
+				if (find_cached_compressed_tracks(output_allocator, *settings.cache, cache_key, out_compressed_tracks))
+				{
+					settings.progress.report(1.0F);
+					return error_result();
+				}
+			}
+
+			{
+				// Disable floating point exceptions during compression because we leverage all SIMD lanes
+				// and we might intentionally divide by zero, etc.
+				scope_disable_fp_exceptions fp_off;
+
+				// When requested, every allocation goes through a tracker to measure the memory used
+				const bool track_memory = are_any_enum_flags_set(out_stats.logging, stat_logging::memory);
+				tracking_allocator memory_tracker(allocator);
+				iallocator& tracked_allocator = track_memory ? static_cast<iallocator&>(memory_tracker) : allocator;
+				iallocator& tracked_output_allocator = track_memory && &output_allocator == &allocator ? static_cast<iallocator&>(memory_tracker) : output_allocator;
+
+				// Transient data lives in an arena, only the compressed tracks come from the output allocator
+				// The arena isn't thread safe, when jobs are used we allocate directly from the provided allocator
+				linear_arena_allocator arena_allocator(tracked_allocator);
+				iallocator& scratch_allocator = settings.job_scheduler.is_enabled() ? tracked_allocator : static_cast<iallocator&>(arena_allocator);
+
+				result = compress_transform_track_list(tracked_output_allocator, scratch_allocator, track_list, settings, &additive_base_track_list, additive_format, out_compressed_tracks, out_stats, prepared_additive_base, prepared_clip, track_memory ? &memory_tracker : nullptr);
+
+				if (track_memory && result.empty())
+					finalize_memory_stats(memory_tracker, out_stats);
+			}
+
+			if (settings.cache != nullptr && result.empty())
+				settings.cache->store(cache_key, *out_compressed_tracks);
+
+			return result;
+		}
+	}
+
 	inline error_result compress_track_list(iallocator& allocator, const track_array& track_list, const compression_settings& settings, compressed_tracks*& out_compressed_tracks, output_stats& out_stats)
+	{
+		return acl_impl::compress_track_list_impl(allocator, allocator, track_list, settings, out_compressed_tracks, out_stats);
+	}
+
+	inline error_result compress_track_list(iallocator& allocator, const track_array_qvvf& track_list, const compression_settings& settings, const track_array_qvvf& additive_base_track_list, additive_clip_format8 additive_format, compressed_tracks*& out_compressed_tracks, output_stats& out_stats)
+	{
+		return acl_impl::compress_track_list_impl(allocator, allocator, track_list, settings, additive_base_track_list, additive_format, out_compressed_tracks, out_stats);
+	}
+
+	inline error_result compress_track_list(iallocator& allocator, const track_array_qvvf& track_list, const compression_settings& settings, const additive_base_context& additive_base, compressed_tracks*& out_compressed_tracks, output_stats& out_stats)
+	{
+		if (!additive_base.is_initialized())
+			return error_result("Additive base context isn't initialized");
+
+		if (additive_base.get_error_metric() != settings.error_metric)
+			return error_result("Additive base context was prepared with a different error metric");
+
+		if (additive_base.get_track_list()->get_num_tracks() != track_list.get_num_tracks())
+			return error_result("Additive base doesn't have the same number of transforms");
+
+		return acl_impl::compress_track_list_impl(allocator, allocator, track_list, settings, *additive_base.get_track_list(), additive_base.get_additive_format(), out_compressed_tracks, out_stats, &additive_base);
+	}
+
+	inline error_result compress_track_list(iallocator& allocator, const prepared_clip_context& prepared_clip, const compression_settings& settings, compressed_tracks*& out_compressed_tracks, output_stats& out_stats)
+	{
+		if (!prepared_clip.is_initialized())
+			return error_result("Prepared clip context isn't initialized");
+
+		if (prepared_clip.get_error_metric() != settings.error_metric)
+			return error_result("Prepared clip context was prepared with a different error metric");
+
+		if (prepared_clip.is_sample_rate_reduction_enabled() != settings.enable_sample_rate_reduction)
+			return error_result("Prepared clip context was prepared with a different sample rate reduction setting");
+
+		const track_array_qvvf& track_list = *prepared_clip.get_track_list();
+		const additive_base_context* additive_base = prepared_clip.get_additive_base();
+		if (additive_base != nullptr)
+			return acl_impl::compress_track_list_impl(allocator, allocator, track_list, settings, *additive_base->get_track_list(), additive_base->get_additive_format(), out_compressed_tracks, out_stats, additive_base, &prepared_clip);
+
+		return acl_impl::compress_track_list_impl(allocator, allocator, track_list, settings, track_array_qvvf(), additive_clip_format8::none, out_compressed_tracks, out_stats, nullptr, &prepared_clip);
+	}
+
+	inline error_result compress_track_list(iallocator& allocator, const track_array& track_list, const compression_settings& settings, const compressed_tracks_output_buffer& output_buffer, compressed_tracks*& out_compressed_tracks, output_stats& out_stats)
 	{
 		using namespace acl_impl;
 
-		error_result result = track_list.is_valid();
+		ACL_ASSERT(output_buffer.request_buffer != nullptr, "An output buffer request callback is required");
+		if (output_buffer.request_buffer == nullptr)
+			return error_result("An output buffer request callback is required");
+
+		output_buffer_allocator output_allocator(allocator, output_buffer);
+
+		compressed_tracks* compressed_tracks_ = nullptr;
+		const error_result result = compress_track_list_impl(output_allocator, allocator, track_list, settings, compressed_tracks_, out_stats);
 		if (result.any())
 			return result;
 
-		// Disable floating point exceptions during compression because we leverage all SIMD lanes
-		// and we might intentionally divide by zero, etc.
-		scope_disable_fp_exceptions fp_off;
-
-		if (track_list.get_track_category() == track_category8::transformf)
-			result = compress_transform_track_list(allocator, track_array_cast<track_array_qvvf>(track_list), settings, nullptr, additive_clip_format8::none, out_compressed_tracks, out_stats);
-		else
-			result = compress_scalar_track_list(allocator, track_list, settings, out_compressed_tracks, out_stats);
+		if (output_allocator.is_output_buffer_invalid())
+			return error_result("The output buffer provided is null or not aligned");
 
-		return result;
+		out_compressed_tracks = compressed_tracks_;
+		return error_result();
 	}
 
-	inline error_result compress_track_list(iallocator& allocator, const track_array_qvvf& track_list, const compression_settings& settings, const track_array_qvvf& additive_base_track_list, additive_clip_format8 additive_format, compressed_tracks*& out_compressed_tracks, output_stats& out_stats)
+	inline error_result compress_track_list(iallocator& allocator, const track_array_qvvf& track_list, const compression_settings& settings, const track_array_qvvf& additive_base_track_list, additive_clip_format8 additive_format, const compressed_tracks_output_buffer& output_buffer, compressed_tracks*& out_compressed_tracks, output_stats& out_stats)
 	{
 		using namespace acl_impl;
 
-		error_result result = track_list.is_valid();
+		ACL_ASSERT(output_buffer.request_buffer != nullptr, "An output buffer request callback is required");
+		if (output_buffer.request_buffer == nullptr)
+			return error_result("An output buffer request callback is required");
+
+		output_buffer_allocator output_allocator(allocator, output_buffer);
+
+		compressed_tracks* compressed_tracks_ = nullptr;
+		const error_result result = compress_track_list_impl(output_allocator, allocator, track_list, settings, additive_base_track_list, additive_format, compressed_tracks_, out_stats);
 		if (result.any())
 			return result;
 
-		if (additive_format != additive_clip_format8::none)
+		if (output_allocator.is_output_buffer_invalid())
+			return error_result("The output buffer provided is null or not aligned");
+
+		out_compressed_tracks = compressed_tracks_;
+		return error_result();
+	}
+
+	inline error_result compress_track_list_in_parts(iallocator& allocator, const track_array_source& source, uint32_t max_num_samples_per_part, const compression_settings& settings,
+		compressed_tracks** out_compressed_parts, output_stats& out_stats)
+	{
+		ACL_ASSERT(source.read_samples != nullptr, "A read samples callback is required");
+		if (source.read_samples == nullptr)
+			return error_result("A read samples callback is required");
+
+		if (out_compressed_parts == nullptr)
+			return error_result("Output compressed parts cannot be NULL");
+
+		if (source.num_samples == 0)
+			return error_result("The source must contain samples");
+
+		if (max_num_samples_per_part < 2)
+			return error_result("Parts must hold at least 2 samples");
+
+		const uint32_t num_parts = calculate_num_compressed_parts(source.num_samples, max_num_samples_per_part);
+		for (uint32_t part_index = 0; part_index < num_parts; ++part_index)
+			out_compressed_parts[part_index] = nullptr;
+
+		// Progress is reported as the fraction of parts compressed
+		compression_settings part_settings = settings;
+		part_settings.progress.report_progress = nullptr;
+
+		uint32_t num_tracks = 0;
+		track_category8 track_category = track_category8::scalarf;
+		float sample_rate = 0.0F;
+
+		for (uint32_t part_index = 0; part_index < num_parts; ++part_index)
 		{
-			result = additive_base_track_list.is_valid();
+			const uint32_t first_sample_index = get_compressed_part_first_sample_index(part_index, max_num_samples_per_part);
+			const uint32_t num_part_samples = get_compressed_part_num_samples(part_index, source.num_samples, max_num_samples_per_part);
+
+			error_result result;
+			if (settings.progress.is_cancelled())
+				result = error_result("Compression was cancelled");
+
+			{
+				// The raw samples of this part only live until it is compressed
+				track_array track_list;
+				if (result.empty())
+					result = source.read_samples(source.user_data, allocator, first_sample_index, num_part_samples, track_list);
+
+				if (result.empty() && track_list.get_num_samples_per_track() != num_part_samples)
+					result = error_result("The source provided the wrong number of samples");
+
+				if (result.empty() && part_index == 0)
+				{
+					num_tracks = track_list.get_num_tracks();
+					track_category = track_list.get_track_category();
+					sample_rate = track_list.get_sample_rate();
+				}
+				else if (result.empty() && (track_list.get_num_tracks() != num_tracks || track_list.get_track_category() != track_category || track_list.get_sample_rate() != sample_rate))
+					result = error_result("Every part must contain the same tracks with the same sample rate");
+
+				if (result.empty())
+					result = compress_track_list(allocator, track_list, part_settings, out_compressed_parts[part_index], out_stats);
+			}
+
 			if (result.any())
+			{
+				// Release every part compressed so far
+				for (uint32_t compressed_part_index = 0; compressed_part_index < part_index; ++compressed_part_index)
+				{
+					compressed_tracks* compressed_part = out_compressed_parts[compressed_part_index];
+					allocator.deallocate(compressed_part, compressed_part->get_size());
+					out_compressed_parts[compressed_part_index] = nullptr;
+				}
+
 				return result;
+			}
+
+			settings.progress.report(float(part_index + 1) / float(num_parts));
 		}
 
-		// Disable floating point exceptions during compression because we leverage all SIMD lanes
-		// and we might intentionally divide by zero, etc.
-		scope_disable_fp_exceptions fp_off;
+		return error_result();
+	}
+
+	namespace acl_impl
+	{
+		// State shared by every job compressing track lists in parallel
+		struct compress_track_lists_context
+		{
+			iallocator* allocator;
+			const track_array* const* track_lists;
+			const compression_settings* settings;
+			const compression_progress* progress;	// Reports how many track lists completed
+			compressed_tracks** out_compressed_tracks;
+			error_result* results;					// 1 per track list
+
+			uint32_t num_track_lists;
+			std::atomic<uint32_t> next_track_list_index;
+			std::atomic<uint32_t> num_compressed_track_lists;
+		};
+
+		inline void compress_track_lists_job(compress_track_lists_context& context)
+		{
+			// Floating point exception state is per thread
+			scope_disable_fp_exceptions fp_off;
 
-		return compress_transform_track_list(allocator, track_list, settings, &additive_base_track_list, additive_format, out_compressed_tracks, out_stats);
+			// Our scratch memory is retained from clip to clip
+			linear_arena_allocator scratch_allocator(*context.allocator);
+
+			while (true)
+			{
+				const uint32_t track_list_index = context.next_track_list_index.fetch_add(1, std::memory_order_relaxed);
+				if (track_list_index >= context.num_track_lists)
+					break;
+
+				const track_array& track_list = *context.track_lists[track_list_index];
+				compressed_tracks*& out_compressed_tracks = context.out_compressed_tracks[track_list_index];
+				out_compressed_tracks = nullptr;
+
+				error_result result = track_list.is_valid();
+				if (result.empty())
+				{
+					compression_cache* cache = context.settings->cache;
+					const uint64_t cache_key = cache != nullptr ? get_compression_cache_key(track_list, *context.settings) : 0;
+
+					if (cache == nullptr || !find_cached_compressed_tracks(*context.allocator, *cache, cache_key, out_compressed_tracks))
+					{
+						output_stats stats;
+
+						if (track_list.get_track_category() == track_category8::transformf)
+							result = compress_transform_track_list(*context.allocator, scratch_allocator, track_array_cast<track_array_qvvf>(track_list), *context.settings, nullptr, additive_clip_format8::none, out_compressed_tracks, stats);
+						else
+							result = compress_scalar_track_list(*context.allocator, scratch_allocator, track_list, *context.settings, out_compressed_tracks, stats);
+
+						if (cache != nullptr && result.empty())
+							cache->store(cache_key, *out_compressed_tracks);
+					}
+				}
+
+				context.results[track_list_index] = result;
+				scratch_allocator.reset();
+
+				const uint32_t num_compressed_track_lists = context.num_compressed_track_lists.fetch_add(1, std::memory_order_relaxed) + 1;
+				context.progress->report(float(num_compressed_track_lists) / float(context.num_track_lists));
+			}
+		}
+
+		inline void execute_compress_track_lists_job(void* job_data)
+		{
+			compress_track_lists_job(*static_cast<compress_track_lists_context*>(job_data));
+		}
+	}
+
+	inline error_result compress_track_lists(iallocator& allocator, const track_array* const* track_lists, uint32_t num_track_lists, const compression_settings& settings,
+		const compression_job_scheduler& job_scheduler, compressed_tracks** out_compressed_tracks)
+	{
+		using namespace acl_impl;
+
+		if (num_track_lists != 0 && (track_lists == nullptr || out_compressed_tracks == nullptr))
+			return error_result("Track lists and output compressed tracks cannot be NULL");
+
+		error_result result = job_scheduler.is_valid();
+		if (result.any())
+			return result;
+
+		// Each track list is compressed on a single job
+		// Cancellation applies to every track list but progress is reported as a whole
+		compression_settings clip_settings = settings;
+		clip_settings.job_scheduler = compression_job_scheduler();
+		clip_settings.progress.report_progress = nullptr;
+
+		compress_track_lists_context context;
+		context.allocator = &allocator;
+		context.track_lists = track_lists;
+		context.settings = &clip_settings;
+		context.progress = &settings.progress;
+		context.out_compressed_tracks = out_compressed_tracks;
+		context.results = allocate_type_array<error_result>(allocator, num_track_lists);
+		context.num_track_lists = num_track_lists;
+		context.next_track_list_index.store(0, std::memory_order_relaxed);
+		context.num_compressed_track_lists.store(0, std::memory_order_relaxed);
+
+		if (job_scheduler.is_enabled() && num_track_lists > 1)
+		{
+			const uint32_t max_num_jobs = job_scheduler.max_num_jobs != 0 ? job_scheduler.max_num_jobs : num_track_lists;
+			const uint32_t num_jobs = std::min<uint32_t>(max_num_jobs, num_track_lists);
+
+			for (uint32_t job_index = 0; job_index < num_jobs; ++job_index)
+				job_scheduler.submit_job(job_scheduler.user_data, &execute_compress_track_lists_job, &context);
+
+			job_scheduler.wait_for_jobs(job_scheduler.user_data);
+		}
+		else
+			compress_track_lists_job(context);
+
+		// Report the first failure in list order to remain deterministic
+		for (uint32_t track_list_index = 0; track_list_index < num_track_lists; ++track_list_index)
+		{
+			if (context.results[track_list_index].any())
+			{
+				result = context.results[track_list_index];
+				break;
+			}
+		}
+
+		deallocate_type_array(allocator, context.results, num_track_lists);
+
+		return result;
 	}
 
 	ACL_IMPL_VERSION_NAMESPACE_END
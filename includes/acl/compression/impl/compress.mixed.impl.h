@@ -0,0 +1,166 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Included only once from compress.h
+
+#include "acl/version.h"
+#include "acl/core/buffer_tag.h"
+#include "acl/core/compressed_mixed_tracks.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/compressed_tracks_version.h"
+#include "acl/core/error_result.h"
+#include "acl/core/hash.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/memory_utils.h"
+#include "acl/core/impl/compressed_headers.h"
+#include "acl/compression/compression_settings.h"
+#include "acl/compression/output_stats.h"
+#include "acl/compression/track_array.h"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	inline error_result build_compressed_mixed_tracks(iallocator& allocator, const compressed_tracks& transform_tracks, const compressed_tracks& scalar_tracks, compressed_mixed_tracks*& out_mixed_tracks)
+	{
+		using namespace acl_impl;
+
+		out_mixed_tracks = nullptr;
+
+		error_result result = transform_tracks.is_valid(false);
+		if (result.any())
+			return result;
+
+		result = scalar_tracks.is_valid(false);
+		if (result.any())
+			return result;
+
+		if (transform_tracks.get_track_type() != track_type8::qvvf)
+			return error_result("Transform tracks must contain qvvf tracks");
+
+		if (scalar_tracks.get_track_type() == track_type8::qvvf)
+			return error_result("Scalar tracks cannot contain qvvf tracks");
+
+		if (transform_tracks.has_database() || scalar_tracks.has_database())
+			return error_result("Compressed tracks bound to a database cannot be mixed");
+
+		if (transform_tracks.get_num_samples_per_track() != scalar_tracks.get_num_samples_per_track()
+			|| transform_tracks.get_sample_rate() != scalar_tracks.get_sample_rate()
+			|| transform_tracks.get_looping_policy() != scalar_tracks.get_looping_policy())
+			return error_result("Transform and scalar tracks must have the same number of samples, sample rate, and looping policy");
+
+		// Compute our layout
+		uint64_t buffer_size = 0;
+		buffer_size += sizeof(raw_buffer_header);									// Header
+		buffer_size += sizeof(mixed_tracks_header);									// Header
+
+		buffer_size = align_to(buffer_size, k_compressed_tracks_preferred_alignment);	// Align transform tracks
+		const uint64_t transform_tracks_offset = buffer_size;
+		buffer_size += transform_tracks.get_size();									// Transform tracks
+
+		buffer_size = align_to(buffer_size, k_compressed_tracks_preferred_alignment);	// Align scalar tracks
+		const uint64_t scalar_tracks_offset = buffer_size;
+		buffer_size += scalar_tracks.get_size();									// Scalar tracks
+
+		if (buffer_size > std::numeric_limits<uint32_t>::max())
+			return error_result("Compressed mixed tracks are too large");
+
+		const uint32_t mixed_tracks_size = uint32_t(buffer_size);
+
+		uint8_t* buffer = allocate_type_array_aligned<uint8_t>(allocator, mixed_tracks_size, k_compressed_tracks_preferred_alignment);
+		std::memset(buffer, 0, mixed_tracks_size);	// Zero our padding to keep our output deterministic
+
+		raw_buffer_header* buffer_header = safe_ptr_cast<raw_buffer_header>(buffer);
+		mixed_tracks_header* header = safe_ptr_cast<mixed_tracks_header>(buffer + sizeof(raw_buffer_header));
+
+		header->tag = static_cast<uint32_t>(buffer_tag32::compressed_mixed_tracks);
+		header->version = compressed_tracks_version16::latest;
+		header->padding = 0;
+		header->transform_tracks.tracks_offset = uint32_t(transform_tracks_offset);
+		header->transform_tracks.tracks_size = transform_tracks.get_size();
+		header->scalar_tracks.tracks_offset = uint32_t(scalar_tracks_offset);
+		header->scalar_tracks.tracks_size = scalar_tracks.get_size();
+
+		std::memcpy(buffer + transform_tracks_offset, &transform_tracks, transform_tracks.get_size());
+		std::memcpy(buffer + scalar_tracks_offset, &scalar_tracks, scalar_tracks.get_size());
+
+		buffer_header->size = mixed_tracks_size;
+		buffer_header->hash = hash_raw_buffer(header->version, buffer + sizeof(raw_buffer_header), mixed_tracks_size - sizeof(raw_buffer_header));	// Hash everything but the raw buffer header
+
+		out_mixed_tracks = reinterpret_cast<compressed_mixed_tracks*>(buffer);
+		ACL_ASSERT(out_mixed_tracks->is_valid(true).empty(), "Failed to build compressed mixed tracks");
+
+		return error_result();
+	}
+
+	inline error_result compress_track_list(iallocator& allocator, const track_array_qvvf& transform_track_list, const track_array& scalar_track_list, const compression_settings& settings,
+		compressed_mixed_tracks*& out_mixed_tracks, output_stats& out_stats)
+	{
+		out_mixed_tracks = nullptr;
+
+		if (transform_track_list.get_num_samples_per_track() != scalar_track_list.get_num_samples_per_track()
+			|| transform_track_list.get_sample_rate() != scalar_track_list.get_sample_rate())
+			return error_result("Transform and scalar tracks must have the same number of samples and sample rate");
+
+		compression_settings mixed_settings = settings;
+
+		for (uint32_t attempt_index = 0; attempt_index < 2; ++attempt_index)
+		{
+			compressed_tracks* transform_tracks = nullptr;
+			error_result result = compress_track_list(allocator, transform_track_list, mixed_settings, transform_tracks, out_stats);
+			if (result.any())
+				return result;
+
+			output_stats scalar_stats;
+			compressed_tracks* scalar_tracks = nullptr;
+			result = compress_track_list(allocator, scalar_track_list, mixed_settings, scalar_tracks, scalar_stats);
+			if (result.any())
+			{
+				allocator.deallocate(transform_tracks, transform_tracks->get_size());
+				return result;
+			}
+
+			// Loops are optimized independently, if only one of them was we have to retry without it
+			const bool has_same_looping_policy = transform_tracks->get_looping_policy() == scalar_tracks->get_looping_policy();
+			if (has_same_looping_policy)
+				result = build_compressed_mixed_tracks(allocator, *transform_tracks, *scalar_tracks, out_mixed_tracks);
+
+			allocator.deallocate(transform_tracks, transform_tracks->get_size());
+			allocator.deallocate(scalar_tracks, scalar_tracks->get_size());
+
+			if (has_same_looping_policy || !mixed_settings.optimize_loops)
+				return has_same_looping_policy ? result : error_result("Transform and scalar tracks must have the same looping policy");
+
+			mixed_settings.optimize_loops = false;
+		}
+
+		return error_result("Failed to compress mixed tracks");
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
@@ -0,0 +1,250 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Included only once from compress.h
+
+#include "acl/version.h"
+#include "acl/core/buffer_tag.h"
+#include "acl/core/compressed_database.h"
+#include "acl/core/compressed_pack.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/compressed_tracks_version.h"
+#include "acl/core/error_result.h"
+#include "acl/core/hash.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/memory_utils.h"
+#include "acl/core/quality_tiers.h"
+#include "acl/core/impl/compressed_headers.h"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	inline error_result build_compressed_pack(iallocator& allocator, const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks,
+		const compressed_database* database, const uint8_t* const (&bulk_data)[k_num_database_tiers], compressed_pack*& out_pack)
+	{
+		using namespace acl_impl;
+
+		out_pack = nullptr;
+
+		if (num_compressed_tracks != 0 && compressed_tracks_list == nullptr)
+			return error_result("Compressed tracks list cannot be null");
+
+		if (database != nullptr)
+		{
+			const error_result result = database->is_valid(false);
+			if (result.any())
+				return result;
+		}
+
+		for (uint32_t tracks_index = 0; tracks_index < num_compressed_tracks; ++tracks_index)
+		{
+			const compressed_tracks* tracks = compressed_tracks_list[tracks_index];
+			if (tracks == nullptr)
+				return error_result("Compressed tracks cannot be null");
+
+			const error_result result = tracks->is_valid(false);
+			if (result.any())
+				return result;
+
+			if (tracks->has_database() && (database == nullptr || !database->contains(*tracks)))
+				return error_result("Compressed tracks are bound to a database that isn't part of the pack");
+		}
+
+		// Bulk data is only stored separately when the database doesn't contain it inline
+		uint32_t bulk_data_size[k_num_database_tiers] = {};
+
+		if (database != nullptr && !database->is_bulk_data_inline())
+		{
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				bulk_data_size[tier_index] = database->get_bulk_data_size(get_database_quality_tier(tier_index));
+				if (bulk_data_size[tier_index] != 0 && bulk_data[tier_index] == nullptr)
+					return error_result("Database bulk data must be provided when it isn't inline");
+			}
+		}
+		else
+		{
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				if (bulk_data[tier_index] != nullptr)
+					return error_result("Bulk data can only be provided with a database that doesn't contain it inline");
+			}
+		}
+
+		// Identical compressed tracks (e.g. variants that compress to the same data) are only stored once
+		// and their entries share the same offset
+		uint32_t* unique_tracks_indices = num_compressed_tracks != 0 ? allocate_type_array<uint32_t>(allocator, num_compressed_tracks) : nullptr;
+		for (uint32_t tracks_index = 0; tracks_index < num_compressed_tracks; ++tracks_index)
+		{
+			const compressed_tracks* tracks = compressed_tracks_list[tracks_index];
+
+			unique_tracks_indices[tracks_index] = tracks_index;
+			for (uint32_t other_tracks_index = 0; other_tracks_index < tracks_index; ++other_tracks_index)
+			{
+				if (unique_tracks_indices[other_tracks_index] != other_tracks_index)
+					continue;	// Already a duplicate
+
+				const compressed_tracks* other_tracks = compressed_tracks_list[other_tracks_index];
+				if (other_tracks->get_hash() != tracks->get_hash() || other_tracks->get_size() != tracks->get_size())
+					continue;	// Different
+
+				if (std::memcmp(other_tracks, tracks, tracks->get_size()) == 0)
+				{
+					unique_tracks_indices[tracks_index] = other_tracks_index;
+					break;
+				}
+			}
+		}
+
+		// Compute our layout
+		uint64_t buffer_size = 0;
+		buffer_size += sizeof(raw_buffer_header);									// Header
+		buffer_size += sizeof(pack_header);											// Header
+
+		buffer_size = align_to(buffer_size, 4);										// Align table of contents
+		const uint64_t entries_offset = buffer_size;
+		buffer_size += uint64_t(num_compressed_tracks) * sizeof(pack_entry);		// Table of contents
+
+		const uint64_t tracks_start_offset = buffer_size;
+		for (uint32_t tracks_index = 0; tracks_index < num_compressed_tracks; ++tracks_index)
+		{
+			if (unique_tracks_indices[tracks_index] != tracks_index)
+				continue;	// Duplicate
+
+			buffer_size = align_to(buffer_size, k_compressed_tracks_preferred_alignment);	// Align compressed tracks
+			buffer_size += compressed_tracks_list[tracks_index]->get_size();				// Compressed tracks
+		}
+
+		uint64_t database_offset = 0;
+		if (database != nullptr)
+		{
+			buffer_size = align_to(buffer_size, k_compressed_tracks_preferred_alignment);	// Align database
+			database_offset = buffer_size;
+			buffer_size += database->get_size();											// Database (and inline bulk data)
+		}
+
+		uint64_t bulk_data_offset[k_num_database_tiers] = {};
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			if (bulk_data_size[tier_index] == 0)
+				continue;	// No bulk data for this tier
+
+			buffer_size = align_to(buffer_size, k_compressed_pack_bulk_data_alignment);	// Align bulk data on a page boundary
+			bulk_data_offset[tier_index] = buffer_size;
+			buffer_size += bulk_data_size[tier_index];									// Bulk data
+		}
+
+		if (buffer_size > std::numeric_limits<uint32_t>::max())
+		{
+			deallocate_type_array(allocator, unique_tracks_indices, num_compressed_tracks);
+			return error_result("Compressed pack is too large");
+		}
+
+		const uint32_t pack_size = uint32_t(buffer_size);
+
+		uint8_t* buffer = allocate_type_array_aligned<uint8_t>(allocator, pack_size, k_compressed_pack_bulk_data_alignment);
+		std::memset(buffer, 0, pack_size);	// Zero our padding to keep our output deterministic
+
+		raw_buffer_header* buffer_header = safe_ptr_cast<raw_buffer_header>(buffer);
+		pack_header* header = safe_ptr_cast<pack_header>(buffer + sizeof(raw_buffer_header));
+
+		header->tag = static_cast<uint32_t>(buffer_tag32::compressed_pack);
+		header->version = compressed_tracks_version16::latest;
+		header->padding = 0;
+		header->num_entries = num_compressed_tracks;
+		header->entries_offset = entries_offset;
+		header->database_offset = database != nullptr ? ptr_offset32<compressed_database>(database_offset) : ptr_offset32<compressed_database>(invalid_ptr_offset());
+
+		pack_entry* entries = safe_ptr_cast<pack_entry>(buffer + entries_offset);
+
+		uint64_t tracks_offset = tracks_start_offset;
+		for (uint32_t tracks_index = 0; tracks_index < num_compressed_tracks; ++tracks_index)
+		{
+			const compressed_tracks* tracks = compressed_tracks_list[tracks_index];
+			const uint32_t tracks_size = tracks->get_size();
+
+			const uint32_t unique_tracks_index = unique_tracks_indices[tracks_index];
+			if (unique_tracks_index != tracks_index)
+			{
+				// Duplicate, reference the data of the first identical entry
+				entries[tracks_index] = entries[unique_tracks_index];
+				continue;
+			}
+
+			tracks_offset = align_to(tracks_offset, k_compressed_tracks_preferred_alignment);
+			std::memcpy(buffer + tracks_offset, tracks, tracks_size);
+
+			entries[tracks_index].tracks_offset = tracks_offset;
+			entries[tracks_index].tracks_size = tracks_size;
+
+			tracks_offset += tracks_size;
+		}
+
+		deallocate_type_array(allocator, unique_tracks_indices, num_compressed_tracks);
+
+		if (database != nullptr)
+			std::memcpy(buffer + database_offset, database, database->get_size());
+
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			if (bulk_data_size[tier_index] == 0)
+			{
+				header->bulk_data_offset[tier_index] = invalid_ptr_offset();
+				header->bulk_data_size[tier_index] = 0;
+				continue;
+			}
+
+			std::memcpy(buffer + bulk_data_offset[tier_index], bulk_data[tier_index], bulk_data_size[tier_index]);
+
+			header->bulk_data_offset[tier_index] = bulk_data_offset[tier_index];
+			header->bulk_data_size[tier_index] = bulk_data_size[tier_index];
+		}
+
+		buffer_header->size = pack_size;
+		buffer_header->hash = hash_raw_buffer(header->version, buffer + sizeof(raw_buffer_header), pack_size - sizeof(raw_buffer_header));	// Hash everything but the raw buffer header
+
+		out_pack = reinterpret_cast<compressed_pack*>(buffer);
+		ACL_ASSERT(out_pack->is_valid(true).empty(), "Failed to build compressed pack");
+
+		return error_result();
+	}
+
+	inline error_result build_compressed_pack(iallocator& allocator, const compressed_tracks* const* compressed_tracks_list, uint32_t num_compressed_tracks,
+		const compressed_database* database, const uint8_t* bulk_data_medium, const uint8_t* bulk_data_low, compressed_pack*& out_pack)
+	{
+		// Intermediate tiers, if any, have no bulk data provided
+		const uint8_t* bulk_data[k_num_database_tiers] = {};
+		bulk_data[0] = bulk_data_medium;
+		bulk_data[k_num_database_tiers - 1] = bulk_data_low;
+
+		return build_compressed_pack(allocator, compressed_tracks_list, num_compressed_tracks, database, bulk_data, out_pack);
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
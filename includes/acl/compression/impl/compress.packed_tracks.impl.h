@@ -0,0 +1,165 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Included only once from compress.h
+
+#include "acl/version.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/error_result.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/impl/compressed_headers.h"
+#include "acl/core/impl/entropy_coding.h"
+#include "acl/core/impl/packed_tracks_utils.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		struct packed_stream_writer
+		{
+			const uint8_t* tracks_buffer;
+			uint8_t* stream_cursors[k_num_packed_streams];
+
+			void operator()(const packed_region& region)
+			{
+				const uint8_t* region_data = tracks_buffer + region.offset;
+
+				if (region.type == packed_region_type::value_planes)
+				{
+					uint8_t** plane_cursors = &stream_cursors[static_cast<uint32_t>(packed_stream::value_plane0)];
+					split_value_planes(region_data, region.size, plane_cursors);
+
+					for (uint32_t plane_index = 0; plane_index < 4; ++plane_index)
+						plane_cursors[plane_index] += get_value_plane_size(region.size, plane_index);
+				}
+				else
+				{
+					uint8_t*& stream_cursor = stream_cursors[static_cast<uint32_t>(region.stream)];
+
+					if (region.type == packed_region_type::bit_matrix)
+						transpose_bit_matrix(region_data, region.size, region.num_rows, region.num_row_bits, stream_cursor);
+					else
+						std::memcpy(stream_cursor, region_data, region.size);
+
+					stream_cursor += region.size;
+				}
+			}
+		};
+	}
+
+	inline error_result pack_compressed_tracks(iallocator& allocator, const compressed_tracks& tracks, uint8_t*& out_packed_tracks, uint32_t& out_packed_tracks_size)
+	{
+		using namespace acl_impl;
+
+		const error_result result = tracks.is_valid(false);
+		if (result.any())
+			return result;
+
+		const uint8_t* tracks_buffer = reinterpret_cast<const uint8_t*>(&tracks);
+		const uint32_t tracks_size = tracks.get_size();
+
+		const uint32_t headers_size = get_packed_headers_size(tracks_buffer, tracks_size);
+
+		packed_stream_size_counter size_counter;
+		std::memset(&size_counter, 0, sizeof(size_counter));
+		size_counter.stream_sizes[static_cast<uint32_t>(packed_stream::headers)] = headers_size;
+
+		if (!visit_packed_regions(tracks_buffer, headers_size, tracks_size, size_counter))
+			return error_result("Failed to find the compressed tracks regions");
+
+		// Gather the data of every stream back to back
+		uint8_t* streams = allocate_type_array<uint8_t>(allocator, tracks_size);
+
+		packed_stream_writer stream_writer;
+		stream_writer.tracks_buffer = tracks_buffer;
+
+		uint32_t stream_offset = 0;
+		for (uint32_t stream_index = 0; stream_index < k_num_packed_streams; ++stream_index)
+		{
+			stream_writer.stream_cursors[stream_index] = streams + stream_offset;
+			stream_offset += size_counter.stream_sizes[stream_index];
+		}
+
+		ACL_ASSERT(stream_offset == tracks_size, "Streams must cover the whole compressed tracks");
+
+		std::memcpy(stream_writer.stream_cursors[static_cast<uint32_t>(packed_stream::headers)], tracks_buffer, headers_size);
+		stream_writer.stream_cursors[static_cast<uint32_t>(packed_stream::headers)] += headers_size;
+
+		visit_packed_regions(tracks_buffer, headers_size, tracks_size, stream_writer);
+
+		// Entropy code every stream, we keep them as is if they do not get smaller
+		uint8_t* encoded_streams = allocate_type_array<uint8_t>(allocator, tracks_size);
+
+		packed_tracks_header header;
+		std::memset(&header, 0, sizeof(header));
+		header.tag = static_cast<uint32_t>(buffer_tag32::packed_compressed_tracks);
+		header.unpacked_size = tracks_size;
+		header.headers_size = headers_size;
+
+		const uint8_t* stream = streams;
+		uint8_t* encoded_stream = encoded_streams;
+		for (uint32_t stream_index = 0; stream_index < k_num_packed_streams; ++stream_index)
+		{
+			const uint32_t stream_size = size_counter.stream_sizes[stream_index];
+
+			uint32_t encoded_size = stream_size > 1 ? rans_encode_compact(stream, stream_size, encoded_stream, stream_size - 1) : 0;
+			if (encoded_size != 0)
+				header.stream_encodings[stream_index] = packed_stream_encoding::rans;
+			else
+			{
+				std::memcpy(encoded_stream, stream, stream_size);
+				encoded_size = stream_size;
+				header.stream_encodings[stream_index] = packed_stream_encoding::stored;
+			}
+
+			header.stream_sizes[stream_index] = encoded_size;
+
+			stream += stream_size;
+			encoded_stream += encoded_size;
+		}
+
+		const uint32_t encoded_streams_size = uint32_t(encoded_stream - encoded_streams);
+		const uint32_t packed_tracks_size = uint32_t(sizeof(packed_tracks_header)) + encoded_streams_size;
+
+		uint8_t* packed_tracks = allocate_type_array_aligned<uint8_t>(allocator, packed_tracks_size, alignof(packed_tracks_header));
+		std::memcpy(packed_tracks, &header, sizeof(packed_tracks_header));
+		std::memcpy(packed_tracks + sizeof(packed_tracks_header), encoded_streams, encoded_streams_size);
+
+		deallocate_type_array(allocator, encoded_streams, tracks_size);
+		deallocate_type_array(allocator, streams, tracks_size);
+
+		out_packed_tracks = packed_tracks;
+		out_packed_tracks_size = packed_tracks_size;
+		return error_result();
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
@@ -38,10 +38,12 @@
 #include "acl/compression/output_stats.h"
 #include "acl/compression/track_array.h"
 #include "acl/compression/impl/track_list_context.h"
+#include "acl/compression/impl/compression_progress.h"
 #include "acl/compression/impl/constant_track_impl.h"
 #include "acl/compression/impl/normalize_track_impl.h"
 #include "acl/compression/impl/optimize_looping.h"
 #include "acl/compression/impl/quantize_track_impl.h"
+#include "acl/compression/impl/track_contributing_error_impl.h"
 #include "acl/compression/impl/track_range_impl.h"
 #include "acl/compression/impl/write_compression_stats_impl.h"
 #include "acl/compression/impl/write_track_data_impl.h"
@@ -59,7 +61,7 @@ namespace acl
 
 	namespace acl_impl
 	{
-		inline error_result compress_scalar_track_list(iallocator& allocator, const track_array& track_list, const compression_settings& settings, compressed_tracks*& out_compressed_tracks, output_stats& out_stats)
+		inline error_result compress_scalar_track_list(iallocator& allocator, iallocator& scratch_allocator, const track_array& track_list, const compression_settings& settings, compressed_tracks*& out_compressed_tracks, output_stats& out_stats)
 		{
 			(void)out_stats;
 
@@ -68,7 +70,7 @@ namespace acl
 #endif
 
 			track_list_context context;
-			if (!initialize_context(allocator, track_list, context))
+			if (!initialize_context(scratch_allocator, track_list, context))
 				return error_result("Some samples are not finite");
 
 			// Wrap instead of clamp if we loop
@@ -83,13 +85,34 @@ namespace acl
 			// Normalize our samples into the track wide ranges per track
 			normalize_tracks(context);
 
+			// Split long tracks into segments and normalize them again within their segment ranges
+			normalize_track_segments(context, settings.num_samples_per_scalar_segment);
+
+			if (settings.progress.is_cancelled())
+				return make_compression_cancelled_error();
+
+			settings.progress.report(k_progress_streams_normalized);
+
 			// Find how many bits we need per track and quantize everything
-			quantize_tracks(context);
+			quantize_tracks(context, settings.job_scheduler);
+
+			if (settings.progress.is_cancelled())
+				return make_compression_cancelled_error();
+
+			settings.progress.report(k_progress_streams_quantized);
+
+			// Databases need the contributing error of every frame to split them into tiers
+			const bool include_contributing_error = (settings.enable_database_support || settings.metadata.include_contributing_error) && context.num_output_tracks != 0;
+			if (include_contributing_error)
+				find_contributing_error(context, settings.job_scheduler);
 
 			// Done transforming our input tracks, time to pack them into their final form
 			const uint32_t per_track_metadata_size = write_track_metadata(context, nullptr);
 			const uint32_t constant_values_size = write_track_constant_values(context, nullptr);
 			const uint32_t range_values_size = write_track_range_values(context, nullptr);
+			const bool is_segmented = context.is_segmented();
+			const uint32_t segment_range_size = is_segmented ? write_track_segment_range_values(context, 0, nullptr) : 0;
+			const uint32_t segment_range_values_size = align_to(segment_range_size * context.num_segments, 4);
 			const uint32_t animated_num_bits = write_track_animated_values(context, nullptr);
 			const uint32_t animated_values_size = (animated_num_bits + 7) / 8;		// Round up to nearest byte
 			const uint32_t num_bits_per_frame = context.num_samples != 0 ? (animated_num_bits / context.num_samples) : 0;
@@ -98,6 +121,8 @@ namespace acl
 			buffer_size += sizeof(raw_buffer_header);								// Header
 			buffer_size += sizeof(tracks_header);									// Header
 			buffer_size += sizeof(scalar_tracks_header);							// Header
+			if (is_segmented)
+				buffer_size += sizeof(scalar_segments_header);						// Header
 			ACL_ASSERT(is_aligned_to(buffer_size, alignof(track_metadata)), "Invalid alignment");
 			buffer_size += per_track_metadata_size;									// Per track metadata
 			buffer_size = align_to(buffer_size, 4);									// Align constant values
@@ -105,13 +130,17 @@ namespace acl
 			ACL_ASSERT(is_aligned_to(buffer_size, 4), "Invalid alignment");
 			buffer_size += range_values_size;										// Range values
 			ACL_ASSERT(is_aligned_to(buffer_size, 4), "Invalid alignment");
+			buffer_size += segment_range_values_size;								// Segment range values
+			ACL_ASSERT(is_aligned_to(buffer_size, 4), "Invalid alignment");
 			buffer_size += animated_values_size;									// Animated values
 
 			// Optional metadata
 			const uint32_t metadata_start_offset = align_to(buffer_size, 4);
+			const bool include_track_name_table = settings.metadata.include_track_names && settings.metadata.include_track_name_table;
 			const uint32_t metadata_track_list_name_size = settings.metadata.include_track_list_name ? write_track_list_name(track_list, nullptr) : 0;
-			const uint32_t metadata_track_names_size = settings.metadata.include_track_names ? write_track_names(track_list, context.track_output_indices, context.num_output_tracks, nullptr) : 0;
+			const uint32_t metadata_track_names_size = settings.metadata.include_track_names ? write_track_names(track_list, context.track_output_indices, context.num_output_tracks, include_track_name_table, nullptr) : 0;
 			const uint32_t metadata_track_descriptions_size = settings.metadata.include_track_descriptions ? write_track_descriptions(track_list, context.track_output_indices, context.num_output_tracks, nullptr) : 0;
+			const uint32_t metadata_contributing_error_size = include_contributing_error ? write_contributing_error(context, nullptr) : 0;
 
 			uint32_t metadata_size = 0;
 			metadata_size += metadata_track_list_name_size;
@@ -119,6 +148,8 @@ namespace acl
 			metadata_size += metadata_track_names_size;
 			metadata_size = align_to(metadata_size, 4);
 			metadata_size += metadata_track_descriptions_size;
+			metadata_size = align_to(metadata_size, 4);
+			metadata_size += metadata_contributing_error_size;
 
 			if (metadata_size != 0)
 			{
@@ -131,7 +162,7 @@ namespace acl
 			else
 				buffer_size += 15;	// Ensure we have sufficient padding for unaligned 16 byte loads
 
-			uint8_t* buffer = allocate_type_array_aligned<uint8_t>(allocator, buffer_size, alignof(compressed_tracks));
+			uint8_t* buffer = allocate_type_array_aligned<uint8_t>(allocator, buffer_size, k_compressed_tracks_preferred_alignment);
 			std::memset(buffer, 0, buffer_size);
 
 			uint8_t* buffer_start = buffer;
@@ -153,6 +184,8 @@ namespace acl
 			header->sample_rate = context.num_output_tracks != 0 ? context.sample_rate : 0.0F;
 			header->set_is_wrap_optimized(context.looping_policy == sample_looping_policy::wrap);
 			header->set_has_metadata(metadata_size != 0);
+			header->set_has_track_name_table(include_track_name_table);
+			header->set_has_scalar_segments(is_segmented);
 
 			// Write our scalar tracks header
 			scalar_tracks_header* scalars_header = safe_ptr_cast<scalar_tracks_header>(buffer);
@@ -161,6 +194,17 @@ namespace acl
 			scalars_header->num_bits_per_frame = num_bits_per_frame;
 
 			const uint8_t* packed_data_start_offset = buffer - sizeof(scalar_tracks_header);	// Relative to our header
+
+			scalar_segments_header* segments_header = nullptr;
+			if (is_segmented)
+			{
+				segments_header = safe_ptr_cast<scalar_segments_header>(buffer);
+				buffer += sizeof(scalar_segments_header);
+
+				segments_header->num_samples_per_segment = context.num_samples_per_segment;
+				segments_header->segment_range_size = segment_range_size;
+			}
+
 			scalars_header->metadata_per_track = uint32_t(buffer - packed_data_start_offset);
 			buffer += per_track_metadata_size;
 			buffer = align_to(buffer, 4);
@@ -168,6 +212,9 @@ namespace acl
 			buffer += constant_values_size;
 			scalars_header->track_range_values = uint32_t(buffer - packed_data_start_offset);
 			buffer += range_values_size;
+			if (is_segmented)
+				segments_header->segment_range_values = uint32_t(buffer - packed_data_start_offset);
+			buffer += segment_range_values_size;
 			scalars_header->track_animated_values = uint32_t(buffer - packed_data_start_offset);
 			buffer += animated_values_size;
 
@@ -195,6 +242,13 @@ namespace acl
 			float* range_values = scalars_header->get_track_range_values();
 			write_track_range_values(context, range_values);
 
+			if (is_segmented)
+			{
+				uint8_t* segment_range_values = segments_header->get_segment_range_values(*scalars_header);
+				for (uint32_t segment_index = 0; segment_index < context.num_segments; ++segment_index)
+					segment_range_values += write_track_segment_range_values(context, segment_index, segment_range_values);
+			}
+
 			uint8_t* animated_values = scalars_header->get_track_animated_values();
 			write_track_animated_values(context, animated_values);
 
@@ -202,6 +256,7 @@ namespace acl
 			uint32_t writter_metadata_track_list_name_size = 0;
 			uint32_t written_metadata_track_names_size = 0;
 			uint32_t written_metadata_track_descriptions_size = 0;
+			uint32_t written_metadata_contributing_error_size = 0;
 			if (metadata_size != 0)
 			{
 				optional_metadata_header* metadada_header = reinterpret_cast<optional_metadata_header*>(buffer_start + buffer_size - sizeof(optional_metadata_header));
@@ -220,7 +275,7 @@ namespace acl
 				{
 					metadata_offset = align_to(metadata_offset, 4);
 					metadada_header->track_name_offsets = metadata_offset;
-					written_metadata_track_names_size = write_track_names(track_list, context.track_output_indices, context.num_output_tracks, metadada_header->get_track_name_offsets(*out_compressed_tracks));
+					written_metadata_track_names_size = write_track_names(track_list, context.track_output_indices, context.num_output_tracks, include_track_name_table, metadada_header->get_track_name_offsets(*out_compressed_tracks));
 					metadata_offset += written_metadata_track_names_size;
 				}
 				else
@@ -237,15 +292,26 @@ namespace acl
 				}
 				else
 					metadada_header->track_descriptions = invalid_ptr_offset();
+
+				if (include_contributing_error)
+				{
+					metadata_offset = align_to(metadata_offset, 4);
+					metadada_header->contributing_error = metadata_offset;
+					written_metadata_contributing_error_size = write_contributing_error(context, metadada_header->get_contributing_error(*out_compressed_tracks));
+					metadata_offset += written_metadata_contributing_error_size;
+				}
+				else
+					metadada_header->contributing_error = invalid_ptr_offset();
 			}
 
 			ACL_ASSERT(writter_metadata_track_list_name_size == metadata_track_list_name_size, "Wrote too little or too much data");
 			ACL_ASSERT(written_metadata_track_names_size == metadata_track_names_size, "Wrote too little or too much data");
 			ACL_ASSERT(written_metadata_track_descriptions_size == metadata_track_descriptions_size, "Wrote too little or too much data");
+			ACL_ASSERT(written_metadata_contributing_error_size == metadata_contributing_error_size, "Wrote too little or too much data");
 
 			// Finish the raw buffer header
 			buffer_header->size = buffer_size;
-			buffer_header->hash = hash32(safe_ptr_cast<const uint8_t>(header), buffer_size - sizeof(raw_buffer_header));	// Hash everything but the raw buffer header
+			buffer_header->hash = hash_raw_buffer(header->version, safe_ptr_cast<const uint8_t>(header), buffer_size - sizeof(raw_buffer_header));	// Hash everything but the raw buffer header
 
 #if defined(ACL_HAS_ASSERT_CHECKS)
 			if (metadata_size == 0)
@@ -258,10 +324,12 @@ namespace acl
 #if defined(ACL_USE_SJSON)
 			compression_time.stop();
 
-			if (out_stats.logging != stat_logging::none)
+			if (are_all_enum_flags_set(out_stats.logging, stat_logging::summary))
 				write_compression_stats(context, *out_compressed_tracks, compression_time, out_stats);
 #endif
 
+			settings.progress.report(1.0F);
+
 			return error_result();
 		}
 	}
@@ -35,17 +35,23 @@
 #include "acl/core/floating_point_exceptions.h"
 #include "acl/core/iallocator.h"
 #include "acl/core/scope_profiler.h"
+#include "acl/core/tracking_allocator.h"
+#include "acl/compression/additive_base_context.h"
 #include "acl/compression/compression_settings.h"
 #include "acl/compression/output_stats.h"
+#include "acl/compression/prepared_clip_context.h"
 #include "acl/compression/track_array.h"
 #include "acl/compression/impl/clip_context.h"
 #include "acl/compression/impl/track_stream.h"
 #include "acl/compression/impl/convert_rotation_streams.h"
 #include "acl/compression/impl/compact_constant_streams.h"
+#include "acl/compression/impl/compression_profiler.h"
+#include "acl/compression/impl/compression_progress.h"
 #include "acl/compression/impl/keyframe_stripping.h"
 #include "acl/compression/impl/normalize_streams.h"
 #include "acl/compression/impl/optimize_looping.h"
 #include "acl/compression/impl/quantize_streams.h"
+#include "acl/compression/impl/reduce_sample_rate.h"
 #include "acl/compression/impl/segment_streams.h"
 #include "acl/compression/impl/write_segment_data.h"
 #include "acl/compression/impl/write_stats.h"
@@ -105,9 +111,10 @@ namespace acl
 			return true;
 		}
 
-		inline error_result compress_transform_track_list(iallocator& allocator, const track_array_qvvf& track_list, compression_settings settings,
+		inline error_result compress_transform_track_list(iallocator& allocator, iallocator& scratch_allocator, const track_array_qvvf& input_track_list, compression_settings settings,
 			const track_array_qvvf* additive_base_track_list, additive_clip_format8 additive_format,
-			compressed_tracks*& out_compressed_tracks, output_stats& out_stats)
+			compressed_tracks*& out_compressed_tracks, output_stats& out_stats, const additive_base_context* prepared_additive_base = nullptr,
+			const prepared_clip_context* prepared_clip = nullptr, tracking_allocator* memory_tracker = nullptr)
 		{
 			error_result result = settings.is_valid();
 			if (result.any())
@@ -119,6 +126,7 @@ namespace acl
 
 			// Segmenting settings are an implementation detail
 			compression_segmenting_settings segmenting_settings;
+			segmenting_settings.enable_adaptive_segmenting = settings.enable_adaptive_segmenting;
 
 			// If we enable database support or keyframe stripping, include the metadata we need
 			bool remove_contributing_error = false;
@@ -167,66 +175,229 @@ namespace acl
 			if (additive_base_track_list == nullptr || additive_base_track_list->is_empty())
 				additive_format = additive_clip_format8::none;
 
-			clip_context raw_clip_context;
-			if (!initialize_clip_context(allocator, track_list, settings, additive_format, raw_clip_context))
-				return error_result("Some samples are not finite");
+			// We only profile our stages when we output detailed stats
+			compression_profiler clip_profiler;
+			compression_profiler* profiler = are_all_enum_flags_set(out_stats.logging, stat_logging::detailed) ? &clip_profiler : nullptr;
+			compression_profiler* segment_profilers = nullptr;
+
+			// When requested, we measure the peak memory held by each group of stages
+			if (memory_tracker != nullptr)
+				memory_tracker->reset_scope_peak();
+
+			const compression_progress& progress = settings.progress;
+
+			// Lower the sample rate if the motion allows it, every later stage uses the reduced track list
+			// A prepared clip already did
+			track_array_qvvf reduced_track_list;
+			if (settings.enable_sample_rate_reduction && prepared_clip == nullptr)
+			{
+				scope_compression_stage stage(profiler, compression_stage::reduce_sample_rate);
+
+				const track_array_qvvf* error_base_track_list = additive_format != additive_clip_format8::none ? additive_base_track_list : nullptr;
+				const uint32_t sample_rate_reduction_factor = find_sample_rate_reduction_factor(scratch_allocator, input_track_list, settings, error_base_track_list);
+				if (sample_rate_reduction_factor > 1)
+					reduced_track_list = make_reduced_sample_rate_track_list(scratch_allocator, input_track_list, sample_rate_reduction_factor);
+			}
+
+			const track_array_qvvf& track_list = prepared_clip != nullptr ? prepared_clip->get_prepared_track_list() : (reduced_track_list.is_empty() ? input_track_list : reduced_track_list);
+
+			if (progress.is_cancelled())
+				return make_compression_cancelled_error();
+
+			scope_compression_stage initialize_stage(profiler, compression_stage::initialize_clip_contexts);
 
+			// The raw and additive base clip contexts are read only, they read their samples in place from the track lists
+			// when they do not need to be normalized which avoids holding a second copy of the input in memory
+			clip_context raw_clip_context;
 			clip_context lossy_clip_context;
-			initialize_clip_context(allocator, track_list, settings, additive_format, lossy_clip_context);
+			if (prepared_clip != nullptr)
+			{
+				// A prepared clip was validated once, we start from a copy of its samples since both contexts get modified
+				const clip_context& prepared_clip_data = prepared_clip->get_clip_context(settings.rotation_format);
+				initialize_clip_context(scratch_allocator, prepared_clip_data, raw_clip_context);
+				initialize_clip_context(scratch_allocator, prepared_clip_data, lossy_clip_context);
+			}
+			else
+			{
+				if (!initialize_clip_context(scratch_allocator, track_list, settings, additive_format, raw_clip_context, true))
+					return error_result("Some samples are not finite");
 
+				initialize_clip_context(scratch_allocator, track_list, settings, additive_format, lossy_clip_context);
+			}
+
+			// A prepared additive base is shared between clips, it was initialized and converted once
 			const bool is_additive = additive_format != additive_clip_format8::none;
-			clip_context additive_base_clip_context;
-			if (is_additive && !initialize_clip_context(allocator, *additive_base_track_list, settings, additive_format, additive_base_clip_context))
+			const bool is_additive_base_prepared = is_additive && prepared_additive_base != nullptr;
+			clip_context owned_additive_base_clip_context;
+			if (is_additive && !is_additive_base_prepared && !initialize_clip_context(scratch_allocator, *additive_base_track_list, settings, additive_format, owned_additive_base_clip_context, true))
 				return error_result("Some base samples are not finite");
 
+			const clip_context& additive_base_clip_context = is_additive_base_prepared ? prepared_additive_base->get_clip_context() : owned_additive_base_clip_context;
+
 			// Topology dependent data, not specific to clip context
+			// A prepared clip owns its shell metadata, ours remains null
 			const uint32_t num_input_transforms = raw_clip_context.num_bones;
-			rigid_shell_metadata_t* clip_shell_metadata = compute_clip_shell_distances(allocator, raw_clip_context, additive_base_clip_context);
+			rigid_shell_metadata_t* owned_clip_shell_metadata = prepared_clip == nullptr ? compute_clip_shell_distances(scratch_allocator, raw_clip_context, additive_base_clip_context) : nullptr;
+			const rigid_shell_metadata_t* clip_shell_metadata = prepared_clip != nullptr ? raw_clip_context.clip_shell_metadata : owned_clip_shell_metadata;
 
 			raw_clip_context.clip_shell_metadata = clip_shell_metadata;
 			lossy_clip_context.clip_shell_metadata = clip_shell_metadata;
-			if (is_additive)
-				additive_base_clip_context.clip_shell_metadata = clip_shell_metadata;
+			if (is_additive && !is_additive_base_prepared)
+				owned_additive_base_clip_context.clip_shell_metadata = clip_shell_metadata;
+
+			initialize_stage.stop();
+
+			// Releases everything we allocated when compression is cancelled
+			const auto cancel_compression = [&]() -> error_result
+			{
+				deallocate_type_array(scratch_allocator, segment_profilers, profiler != nullptr ? lossy_clip_context.num_segments : 0);
+				deallocate_type_array(scratch_allocator, owned_clip_shell_metadata, num_input_transforms);
+				destroy_clip_context(lossy_clip_context);
+				destroy_clip_context(raw_clip_context);
+				destroy_clip_context(owned_additive_base_clip_context);
+
+				return make_compression_cancelled_error();
+			};
+
+			progress.report(k_progress_clip_contexts_initialized);
 
 			// Wrap instead of clamp if we loop
-			optimize_looping(lossy_clip_context, additive_base_clip_context, settings);
+			{
+				scope_compression_stage stage(profiler, compression_stage::optimize_looping);
+				optimize_looping(lossy_clip_context, additive_base_clip_context, settings);
+			}
 
 			// Convert our rotations if we need to
-			convert_rotation_streams(allocator, lossy_clip_context, settings.rotation_format);
+			{
+				scope_compression_stage stage(profiler, compression_stage::convert_rotation_streams);
+				convert_rotation_streams(lossy_clip_context, settings.rotation_format, settings.job_scheduler);
+			}
 
 			// Extract our clip ranges now, we need it for compacting the constant streams
-			extract_clip_bone_ranges(allocator, lossy_clip_context);
+			{
+				scope_compression_stage stage(profiler, compression_stage::extract_clip_bone_ranges);
+				extract_clip_bone_ranges(scratch_allocator, lossy_clip_context, settings.job_scheduler);
+			}
 
 			// Compact and collapse the constant streams
-			compact_constant_streams(allocator, lossy_clip_context, raw_clip_context, additive_base_clip_context, track_list, settings);
+			{
+				scope_compression_stage stage(profiler, compression_stage::compact_constant_streams);
+				compact_constant_streams(scratch_allocator, lossy_clip_context, raw_clip_context, additive_base_clip_context, track_list, settings);
+			}
+
+			if (progress.is_cancelled())
+				return cancel_compression();
+
+			progress.report(k_progress_constant_streams_compacted);
+
+			// Pick which rotation component to drop if we need to
+			{
+				scope_compression_stage stage(profiler, compression_stage::drop_largest_rotation_components);
+				drop_largest_rotation_components(lossy_clip_context, settings.rotation_format);
+			}
+
+			// Convert our animated rotations into their logarithm if we need to
+			{
+				scope_compression_stage stage(profiler, compression_stage::convert_rotation_streams_to_log);
+				convert_rotation_streams_to_log(lossy_clip_context, settings.rotation_format);
+			}
 
 			uint32_t clip_range_data_size = 0;
 			if (range_reduction != range_reduction_flags8::none)
 			{
+				scope_compression_stage stage(profiler, compression_stage::normalize_clip_streams);
+
+				// Quantize our rotation clip ranges if we need to, our samples are normalized within them
+				if (settings.enable_rotation_clip_range_quantization)
+					quantize_rotation_clip_ranges(lossy_clip_context, settings.rotation_format, range_reduction);
+
 				// Normalize our samples into the clip wide ranges per bone
-				normalize_clip_streams(lossy_clip_context, range_reduction);
-				clip_range_data_size = get_clip_range_data_size(lossy_clip_context, range_reduction, settings.rotation_format);
+				normalize_clip_streams(lossy_clip_context, range_reduction, settings.job_scheduler);
+				clip_range_data_size = get_clip_range_data_size(lossy_clip_context, range_reduction, settings.rotation_format, settings.translation_format, settings.scale_format);
+
+				// Reduce the bit rate of the vector components with a smaller range if we need to
+				calculate_component_bit_rate_reductions(lossy_clip_context, settings.translation_format, settings.scale_format);
 			}
 
-			segment_streams(allocator, lossy_clip_context, segmenting_settings);
+			{
+				scope_compression_stage stage(profiler, compression_stage::segment_streams);
+				segment_streams(scratch_allocator, lossy_clip_context, segmenting_settings);
+			}
 
 			// If we have a single segment, skip segment range reduction since it won't help
 			if (range_reduction != range_reduction_flags8::none && lossy_clip_context.num_segments > 1)
 			{
 				// Extract and fixup our segment wide ranges per bone
-				extract_segment_bone_ranges(allocator, lossy_clip_context);
+				{
+					scope_compression_stage stage(profiler, compression_stage::extract_segment_bone_ranges);
+					extract_segment_bone_ranges(scratch_allocator, lossy_clip_context, settings.job_scheduler);
+				}
 
 				// Normalize our samples into the segment wide ranges per bone
-				normalize_segment_streams(lossy_clip_context, range_reduction);
+				{
+					scope_compression_stage stage(profiler, compression_stage::normalize_segment_streams);
+					normalize_segment_streams(lossy_clip_context, range_reduction, settings.job_scheduler);
+				}
+			}
+
+			if (progress.is_cancelled())
+				return cancel_compression();
+
+			progress.report(k_progress_streams_normalized);
+
+			size_t quantization_start_size = 0;
+			if (memory_tracker != nullptr)
+			{
+				out_stats.memory.clip_contexts_peak_size = memory_tracker->get_scope_peak_size();
+				quantization_start_size = memory_tracker->get_allocated_size();
+				memory_tracker->reset_scope_peak();
+			}
+
+			// Segments can be quantized in parallel, each one records its stages in its own profiler
+			if (profiler != nullptr)
+			{
+				segment_profilers = allocate_type_array<compression_profiler>(scratch_allocator, lossy_clip_context.num_segments);
+
+				for (segment_context& segment : lossy_clip_context.segment_iterator())
+					segment.profiler = &segment_profilers[segment.segment_index];
 			}
 
 			// Find how many bits we need per sub-track and quantize everything
-			quantize_streams(allocator, lossy_clip_context, settings, raw_clip_context, additive_base_clip_context, out_stats);
+			{
+				scope_compression_stage stage(profiler, compression_stage::quantize_streams);
+				quantize_streams(scratch_allocator, lossy_clip_context, settings, raw_clip_context, additive_base_clip_context, out_stats);
+			}
+
+			if (memory_tracker != nullptr)
+			{
+				const size_t quantization_peak_size = memory_tracker->get_scope_peak_size();
+				out_stats.memory.quantization_peak_size = quantization_peak_size;
+				out_stats.memory.quantization_context_size = quantization_peak_size - quantization_start_size;
+			}
+
+			// Quantization stops early when cancelled, its output is incomplete
+			if (progress.is_cancelled())
+				return cancel_compression();
+
+			if (profiler != nullptr)
+			{
+				for (const segment_context& segment : lossy_clip_context.segment_iterator())
+					profiler->merge(*segment.profiler);
+			}
 
 			// Remove whole keyframes as needed
-			strip_keyframes(allocator, lossy_clip_context, settings);
+			{
+				scope_compression_stage stage(profiler, compression_stage::strip_keyframes);
+				strip_keyframes(scratch_allocator, lossy_clip_context, settings);
+			}
+
+			progress.report(k_progress_keyframes_stripped);
 
 			// Compression is done! Time to pack things.
+			scope_compression_stage write_stage(profiler, compression_stage::write_compressed_tracks);
+
+			if (memory_tracker != nullptr)
+				memory_tracker->reset_scope_peak();
 
 			if (remove_contributing_error)
 				settings.metadata.include_contributing_error = false;
@@ -234,9 +405,10 @@ namespace acl
 			const bool has_trivial_defaults = has_trivial_default_values(track_list, additive_format, lossy_clip_context);
 
 			uint32_t num_output_bones = 0;
-			uint32_t* output_bone_mapping = create_output_track_mapping(allocator, track_list, num_output_bones);
+			uint32_t* output_bone_mapping = create_output_track_mapping(scratch_allocator, track_list, num_output_bones);
 
-			const uint32_t constant_data_size = get_constant_data_size(lossy_clip_context);
+			const bool has_quantized_constant_rotations = has_quantized_constant_rotation_groups(lossy_clip_context, output_bone_mapping, num_output_bones);
+			const uint32_t constant_data_size = get_constant_data_size(lossy_clip_context, output_bone_mapping, num_output_bones, has_quantized_constant_rotations);
 
 			calculate_animated_data_size(lossy_clip_context, output_bone_mapping, num_output_bones);
 
@@ -319,8 +491,9 @@ namespace acl
 
 			// Optional metadata
 			const uint32_t metadata_start_offset = align_to(buffer_size, 4);
+			const bool include_track_name_table = settings.metadata.include_track_names && settings.metadata.include_track_name_table;
 			const uint32_t metadata_track_list_name_size = settings.metadata.include_track_list_name ? write_track_list_name(track_list, nullptr) : 0;
-			const uint32_t metadata_track_names_size = settings.metadata.include_track_names ? write_track_names(track_list, output_bone_mapping, num_output_bones, nullptr) : 0;
+			const uint32_t metadata_track_names_size = settings.metadata.include_track_names ? write_track_names(track_list, output_bone_mapping, num_output_bones, include_track_name_table, nullptr) : 0;
 			const uint32_t metadata_parent_track_indices_size = settings.metadata.include_parent_track_indices ? write_parent_track_indices(track_list, output_bone_mapping, num_output_bones, nullptr) : 0;
 			const uint32_t metadata_track_descriptions_size = settings.metadata.include_track_descriptions ? write_track_descriptions(track_list, output_bone_mapping, num_output_bones, nullptr) : 0;
 			const uint32_t metadata_contributing_error_size = settings.metadata.include_contributing_error ? write_contributing_error(lossy_clip_context, nullptr) : 0;
@@ -347,7 +520,7 @@ namespace acl
 			else
 				buffer_size += 15;	// Ensure we have sufficient padding for unaligned 16 byte loads
 
-			uint8_t* buffer = allocate_type_array_aligned<uint8_t>(allocator, buffer_size, alignof(compressed_tracks));
+			uint8_t* buffer = allocate_type_array_aligned<uint8_t>(allocator, buffer_size, k_compressed_tracks_preferred_alignment);
 			std::memset(buffer, 0, buffer_size);
 
 			uint8_t* buffer_start = buffer;
@@ -378,6 +551,9 @@ namespace acl
 			header->set_has_stripped_keyframes(lossy_clip_context.has_stripped_keyframes);
 			header->set_is_wrap_optimized(lossy_clip_context.looping_policy == sample_looping_policy::wrap);
 			header->set_has_metadata(metadata_size != 0);
+			header->set_has_track_name_table(include_track_name_table);
+			header->set_has_quantized_constant_rotations(has_quantized_constant_rotations);
+			header->set_has_quantized_rotation_clip_ranges(lossy_clip_context.has_quantized_rotation_clip_ranges);
 
 			// Write our transform tracks header
 			transform_tracks_header* transforms_header = safe_ptr_cast<transform_tracks_header>(buffer);
@@ -408,11 +584,11 @@ namespace acl
 
 			uint32_t written_constant_data_size = 0;
 			if (constant_data_size != 0)
-				written_constant_data_size = write_constant_track_data(lossy_clip_context, settings.rotation_format, transforms_header->get_constant_track_data(), constant_data_size, output_bone_mapping, num_output_bones);
+				written_constant_data_size = write_constant_track_data(lossy_clip_context, settings.rotation_format, has_quantized_constant_rotations, transforms_header->get_constant_track_data(), constant_data_size, output_bone_mapping, num_output_bones);
 
 			uint32_t written_clip_range_data_size = 0;
 			if (range_reduction != range_reduction_flags8::none)
-				written_clip_range_data_size = write_clip_range_data(lossy_clip_context, range_reduction, transforms_header->get_clip_range_data(), clip_range_data_size, output_bone_mapping, num_output_bones);
+				written_clip_range_data_size = write_clip_range_data(lossy_clip_context, range_reduction, settings.translation_format, settings.scale_format, transforms_header->get_clip_range_data(), clip_range_data_size, output_bone_mapping, num_output_bones);
 
 			const uint32_t written_segment_data_size = write_segment_data(lossy_clip_context, settings, range_reduction, transforms_header->get_segment_headers(), *transforms_header, output_bone_mapping, num_output_bones);
 
@@ -440,7 +616,7 @@ namespace acl
 				{
 					metadata_offset = align_to(metadata_offset, 4);
 					metadata_header->track_name_offsets = metadata_offset;
-					written_metadata_track_names_size = write_track_names(track_list, output_bone_mapping, num_output_bones, metadata_header->get_track_name_offsets(*out_compressed_tracks));
+					written_metadata_track_names_size = write_track_names(track_list, output_bone_mapping, num_output_bones, include_track_name_table, metadata_header->get_track_name_offsets(*out_compressed_tracks));
 					metadata_offset += written_metadata_track_names_size;
 				}
 				else
@@ -479,7 +655,7 @@ namespace acl
 
 			// Finish the compressed tracks raw buffer header
 			buffer_header->size = buffer_size;
-			buffer_header->hash = hash32(safe_ptr_cast<const uint8_t>(header), buffer_size - sizeof(raw_buffer_header));	// Hash everything but the raw buffer header
+			buffer_header->hash = hash_raw_buffer(header->version, safe_ptr_cast<const uint8_t>(header), buffer_size - sizeof(raw_buffer_header));	// Hash everything but the raw buffer header
 
 #if defined(ACL_HAS_ASSERT_CHECKS)
 			{
@@ -538,18 +714,26 @@ namespace acl
 			(void)buffer_start;
 #endif
 
+			write_stage.stop();
+
+			if (memory_tracker != nullptr)
+				out_stats.memory.output_peak_size = memory_tracker->get_scope_peak_size();
+
 #if defined(ACL_USE_SJSON)
 			compression_time.stop();
 
-			if (out_stats.logging != stat_logging::none)
-				write_stats(allocator, track_list, lossy_clip_context, *out_compressed_tracks, settings, segmenting_settings, range_reduction, raw_clip_context, additive_base_clip_context, compression_time, out_stats);
+			if (are_all_enum_flags_set(out_stats.logging, stat_logging::summary))
+				write_stats(scratch_allocator, track_list, lossy_clip_context, *out_compressed_tracks, settings, segmenting_settings, range_reduction, raw_clip_context, additive_base_clip_context, compression_time, profiler, out_stats);
 #endif
 
-			deallocate_type_array(allocator, output_bone_mapping, num_output_bones);
-			deallocate_type_array(allocator, clip_shell_metadata, num_input_transforms);
+			deallocate_type_array(scratch_allocator, segment_profilers, profiler != nullptr ? lossy_clip_context.num_segments : 0);
+			deallocate_type_array(scratch_allocator, output_bone_mapping, num_output_bones);
+			deallocate_type_array(scratch_allocator, owned_clip_shell_metadata, num_input_transforms);
 			destroy_clip_context(lossy_clip_context);
 			destroy_clip_context(raw_clip_context);
-			destroy_clip_context(additive_base_clip_context);
+			destroy_clip_context(owned_additive_base_clip_context);
+
+			progress.report(1.0F);
 
 			return error_result();
 		}
@@ -0,0 +1,66 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Included only once from compression_cache.h
+
+#include "acl/version.h"
+#include "acl/core/compressed_tracks_version.h"
+#include "acl/core/hash.h"
+#include "acl/compression/compression_settings.h"
+#include "acl/compression/track_array.h"
+
+#include <cstdint>
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	inline uint64_t get_compression_cache_key(const track_array& track_list, const compression_settings& settings)
+	{
+		uint64_t hash_value = 0;
+		hash_value = hash_combine(hash_value, hash64(compressed_tracks_version16::latest));
+		hash_value = hash_combine(hash_value, uint64_t(settings.get_hash()));
+		hash_value = hash_combine(hash_value, track_list.get_content_hash());
+		return hash_value;
+	}
+
+	inline uint64_t get_compression_cache_key(const track_array_qvvf& track_list, const compression_settings& settings,
+		const track_array_qvvf& additive_base_track_list, additive_clip_format8 additive_format)
+	{
+		uint64_t hash_value = get_compression_cache_key(track_list, settings);
+
+		// Without an additive format, the base is ignored and the key matches the non-additive one
+		if (additive_format != additive_clip_format8::none)
+		{
+			hash_value = hash_combine(hash_value, hash64(additive_format));
+			hash_value = hash_combine(hash_value, additive_base_track_list.get_content_hash());
+		}
+
+		return hash_value;
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
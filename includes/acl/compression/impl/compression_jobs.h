@@ -0,0 +1,94 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/compression/compression_settings.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		// State shared by every job executing a list of independent work items
+		template<class item_function_type>
+		struct compression_job_context
+		{
+			const item_function_type* item_function;
+			uint32_t num_items;
+			std::atomic<uint32_t> next_item_index;
+
+			static void execute(void* job_data)
+			{
+				compression_job_context& context = *static_cast<compression_job_context*>(job_data);
+
+				while (true)
+				{
+					const uint32_t item_index = context.next_item_index.fetch_add(1, std::memory_order_relaxed);
+					if (item_index >= context.num_items)
+						break;
+
+					(*context.item_function)(item_index);
+				}
+			}
+		};
+
+		// Executes every work item, concurrently when a job scheduler is provided
+		// Work items must be independent and the output must not depend on their execution order
+		template<class item_function_type>
+		inline void execute_compression_jobs(const compression_job_scheduler& job_scheduler, uint32_t num_items, const item_function_type& item_function)
+		{
+			compression_job_context<item_function_type> context;
+			context.item_function = &item_function;
+			context.num_items = num_items;
+			context.next_item_index.store(0, std::memory_order_relaxed);
+
+			if (job_scheduler.is_enabled() && num_items > 1)
+			{
+				const uint32_t max_num_jobs = job_scheduler.max_num_jobs != 0 ? job_scheduler.max_num_jobs : num_items;
+				const uint32_t num_jobs = std::min<uint32_t>(max_num_jobs, num_items);
+
+				for (uint32_t job_index = 0; job_index < num_jobs; ++job_index)
+					job_scheduler.submit_job(job_scheduler.user_data, &compression_job_context<item_function_type>::execute, &context);
+
+				job_scheduler.wait_for_jobs(job_scheduler.user_data);
+			}
+			else
+				compression_job_context<item_function_type>::execute(&context);
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
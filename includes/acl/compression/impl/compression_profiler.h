@@ -0,0 +1,196 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <chrono>
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// The stages of the compression pipeline we profile.
+		// Stages form a hierarchy, see get_compression_stage_parent(..).
+		enum class compression_stage : uint32_t
+		{
+			reduce_sample_rate,
+			initialize_clip_contexts,
+			optimize_looping,
+			convert_rotation_streams,
+			extract_clip_bone_ranges,
+			compact_constant_streams,
+			drop_largest_rotation_components,
+			convert_rotation_streams_to_log,
+			normalize_clip_streams,
+			segment_streams,
+			extract_segment_bone_ranges,
+			normalize_segment_streams,
+			quantize_streams,
+				quantize_segment,
+					find_optimal_bit_rates,
+					find_contributing_error,
+					quantize_all_streams,
+			strip_keyframes,
+			write_compressed_tracks,
+
+			count,
+
+			// Used to denote the root of the hierarchy
+			none = count,
+		};
+
+		constexpr uint32_t k_num_compression_stages = static_cast<uint32_t>(compression_stage::count);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the parent of a stage or 'none' if it is a top level stage.
+		inline compression_stage get_compression_stage_parent(compression_stage stage)
+		{
+			switch (stage)
+			{
+			case compression_stage::quantize_segment:
+				return compression_stage::quantize_streams;
+			case compression_stage::find_optimal_bit_rates:
+			case compression_stage::find_contributing_error:
+			case compression_stage::quantize_all_streams:
+				return compression_stage::quantize_segment;
+			default:
+				return compression_stage::none;
+			}
+		}
+
+		inline const char* get_compression_stage_name(compression_stage stage)
+		{
+			switch (stage)
+			{
+			case compression_stage::reduce_sample_rate:					return "reduce_sample_rate";
+			case compression_stage::initialize_clip_contexts:			return "initialize_clip_contexts";
+			case compression_stage::optimize_looping:					return "optimize_looping";
+			case compression_stage::convert_rotation_streams:			return "convert_rotation_streams";
+			case compression_stage::extract_clip_bone_ranges:			return "extract_clip_bone_ranges";
+			case compression_stage::compact_constant_streams:			return "compact_constant_streams";
+			case compression_stage::drop_largest_rotation_components:	return "drop_largest_rotation_components";
+			case compression_stage::convert_rotation_streams_to_log:	return "convert_rotation_streams_to_log";
+			case compression_stage::normalize_clip_streams:				return "normalize_clip_streams";
+			case compression_stage::segment_streams:					return "segment_streams";
+			case compression_stage::extract_segment_bone_ranges:		return "extract_segment_bone_ranges";
+			case compression_stage::normalize_segment_streams:			return "normalize_segment_streams";
+			case compression_stage::quantize_streams:					return "quantize_streams";
+			case compression_stage::quantize_segment:					return "quantize_segment";
+			case compression_stage::find_optimal_bit_rates:				return "find_optimal_bit_rates";
+			case compression_stage::find_contributing_error:			return "find_contributing_error";
+			case compression_stage::quantize_all_streams:				return "quantize_all_streams";
+			case compression_stage::strip_keyframes:					return "strip_keyframes";
+			case compression_stage::write_compressed_tracks:			return "write_compressed_tracks";
+			default:													return "<unknown>";
+			}
+		}
+
+		struct compression_stage_timing
+		{
+			uint64_t elapsed_ns		= 0;
+			uint32_t num_calls		= 0;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Accumulates the wall time and the number of calls of every compression stage.
+		// A profiler is only present when detailed stats are requested, stages are
+		// profiled through a nullable pointer and cost nothing otherwise.
+		// Each segment owns its own profiler to remain thread safe when segments are
+		// quantized in parallel, they are merged into the clip profiler once done.
+		// As such, the sum of the segment stages can exceed their parent wall time.
+		struct compression_profiler
+		{
+			compression_stage_timing stages[k_num_compression_stages];
+
+			void add(compression_stage stage, uint64_t elapsed_ns)
+			{
+				compression_stage_timing& timing = stages[static_cast<uint32_t>(stage)];
+				timing.elapsed_ns += elapsed_ns;
+				timing.num_calls++;
+			}
+
+			void merge(const compression_profiler& other)
+			{
+				for (uint32_t stage_index = 0; stage_index < k_num_compression_stages; ++stage_index)
+				{
+					stages[stage_index].elapsed_ns += other.stages[stage_index].elapsed_ns;
+					stages[stage_index].num_calls += other.stages[stage_index].num_calls;
+				}
+			}
+
+			const compression_stage_timing& get_timing(compression_stage stage) const { return stages[static_cast<uint32_t>(stage)]; }
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Records the wall time of a stage for the duration of the scope.
+		// Does nothing if the profiler is null.
+		class scope_compression_stage
+		{
+		public:
+			scope_compression_stage(compression_profiler* profiler, compression_stage stage)
+				: m_profiler(profiler)
+				, m_stage(stage)
+			{
+				if (profiler != nullptr)
+					m_start_time = std::chrono::high_resolution_clock::now();
+			}
+
+			~scope_compression_stage() { stop(); }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Manually ends the stage before the end of the scope.
+			void stop()
+			{
+				if (m_profiler != nullptr)
+				{
+					const auto end_time = std::chrono::high_resolution_clock::now();
+					const auto elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - m_start_time).count();
+					m_profiler->add(m_stage, static_cast<uint64_t>(elapsed_ns));
+					m_profiler = nullptr;
+				}
+			}
+
+		private:
+			scope_compression_stage(const scope_compression_stage&) = delete;
+			scope_compression_stage& operator=(const scope_compression_stage&) = delete;
+
+			compression_profiler*											m_profiler;
+			compression_stage												m_stage;
+			std::chrono::time_point<std::chrono::high_resolution_clock>		m_start_time;
+		};
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
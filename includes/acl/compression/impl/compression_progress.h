@@ -0,0 +1,65 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/error_result.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/compression/compression_settings.h"
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		// The fraction of the work done once each transform compression stage completes
+		// Quantization takes the bulk of the time and reports as each segment completes
+		constexpr float k_progress_clip_contexts_initialized = 0.05F;
+		constexpr float k_progress_constant_streams_compacted = 0.15F;
+		constexpr float k_progress_streams_normalized = 0.25F;
+		constexpr float k_progress_streams_quantized = 0.9F;
+		constexpr float k_progress_keyframes_stripped = 0.95F;
+
+		inline void report_quantization_progress(const compression_progress& progress, uint32_t num_quantized_segments, uint32_t num_segments)
+		{
+			const float fraction = float(num_quantized_segments) / float(num_segments);
+			progress.report(k_progress_streams_normalized + ((k_progress_streams_quantized - k_progress_streams_normalized) * fraction));
+		}
+
+		inline error_result make_compression_cancelled_error()
+		{
+			return error_result("Compression was cancelled");
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
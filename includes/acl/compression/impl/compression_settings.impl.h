@@ -29,6 +29,7 @@
 #include "acl/version.h"
 #include "acl/core/error_result.h"
 #include "acl/core/hash.h"
+#include "acl/core/quality_tiers.h"
 #include "acl/core/track_formats.h"
 
 #include <cstdint>
@@ -37,12 +38,30 @@ namespace acl
 {
 	ACL_IMPL_VERSION_NAMESPACE_BEGIN
 
+	inline float compression_database_settings::get_tier_proportion(quality_tier tier) const
+	{
+		ACL_ASSERT(is_database_quality_tier(tier), "The database does not contain data for this tier");
+		if (tier == quality_tier::medium_importance)
+			return medium_importance_tier_proportion;
+		else if (tier == quality_tier::lowest_importance)
+			return low_importance_tier_proportion;
+		else if (is_database_quality_tier(tier))
+			return intermediate_importance_tier_proportions[uint32_t(tier) - 2];
+		else
+			return 0.0F;
+	}
+
 	inline uint32_t compression_database_settings::get_hash() const
 	{
 		uint32_t hash_value = 0;
 		hash_value = hash_combine(hash_value, hash32(max_chunk_size));
 		hash_value = hash_combine(hash_value, hash32(medium_importance_tier_proportion));
 		hash_value = hash_combine(hash_value, hash32(low_importance_tier_proportion));
+		hash_value = hash_combine(hash_value, hash32(entropy_code_low_importance_tier));
+
+		for (uint32_t tier_index = 0; tier_index < k_num_intermediate_database_tiers; ++tier_index)
+			hash_value = hash_combine(hash_value, hash32(intermediate_importance_tier_proportions[tier_index]));
+
 		return hash_value;
 	}
 
@@ -60,11 +79,20 @@ namespace acl
 		if (!rtm::scalar_is_finite(low_importance_tier_proportion) || low_importance_tier_proportion < 0.0F || low_importance_tier_proportion > 1.0F)
 			return error_result("low_importance_tier_proportion must be in the range [0.0, 1.0]");
 
+		float database_proportion = low_importance_tier_proportion + medium_importance_tier_proportion;
+		for (uint32_t tier_index = 0; tier_index < k_num_intermediate_database_tiers; ++tier_index)
+		{
+			const float tier_proportion = intermediate_importance_tier_proportions[tier_index];
+			if (!rtm::scalar_is_finite(tier_proportion) || tier_proportion < 0.0F || tier_proportion > 1.0F)
+				return error_result("intermediate_importance_tier_proportions must be in the range [0.0, 1.0]");
+
+			database_proportion += tier_proportion;
+		}
+
 		// Add an epsilon to account for arithmetic imprecision
-		const float database_proportion = low_importance_tier_proportion + medium_importance_tier_proportion;
 		const float epsilon = 1.0e-5F;
 		if (database_proportion < epsilon || database_proportion > (1.0F + epsilon))
-			return error_result("The sum of medium_importance_tier_proportion + low_importance_tier_proportion must be in the range [0.0, 1.0]");
+			return error_result("The sum of every database tier proportion must be in the range [0.0, 1.0]");
 
 		return error_result();
 	}
@@ -78,11 +106,17 @@ namespace acl
 		hash_value = hash_combine(hash_value, hash32(include_track_descriptions));
 		hash_value = hash_combine(hash_value, hash32(include_contributing_error));
 
+		if (include_track_name_table)
+			hash_value = hash_combine(hash_value, hash32(include_track_name_table));
+
 		return hash_value;
 	}
 
 	inline error_result compression_metadata_settings::is_valid() const
 	{
+		if (include_track_name_table && !include_track_names)
+			return error_result("include_track_name_table requires include_track_names");
+
 		return error_result();
 	}
 
@@ -107,10 +141,19 @@ namespace acl
 		return error_result();
 	}
 
+	inline error_result compression_job_scheduler::is_valid() const
+	{
+		if ((submit_job == nullptr) != (wait_for_jobs == nullptr))
+			return error_result("submit_job and wait_for_jobs must both be set or both be NULL");
+
+		return error_result();
+	}
+
 	inline uint32_t compression_settings::get_hash() const
 	{
 		uint32_t hash_value = 0;
 		hash_value = hash_combine(hash_value, hash32(level));
+
 		hash_value = hash_combine(hash_value, hash32(rotation_format));
 		hash_value = hash_combine(hash_value, hash32(translation_format));
 		hash_value = hash_combine(hash_value, hash32(scale_format));
@@ -123,6 +166,34 @@ namespace acl
 		hash_value = hash_combine(hash_value, keyframe_stripping.get_hash());
 		hash_value = hash_combine(hash_value, metadata.get_hash());
 
+		// Only hashed when set to retain the hash of existing configurations
+		if (bit_rate_search_budget != 0)
+			hash_value = hash_combine(hash_value, hash32(bit_rate_search_budget));
+
+		if (bit_rate_search_strategy != bit_rate_search_strategy8::permutations)
+			hash_value = hash_combine(hash_value, hash32(bit_rate_search_strategy));
+
+		if (enable_adaptive_segmenting)
+			hash_value = hash_combine(hash_value, enable_adaptive_segmenting);
+
+		if (enable_sample_rate_reduction)
+			hash_value = hash_combine(hash_value, enable_sample_rate_reduction);
+
+		if (enable_constant_rotation_quantization)
+			hash_value = hash_combine(hash_value, enable_constant_rotation_quantization);
+
+		if (enable_rotation_clip_range_quantization)
+			hash_value = hash_combine(hash_value, enable_rotation_clip_range_quantization);
+
+		if (enable_proxy_error_rejection)
+			hash_value = hash_combine(hash_value, enable_proxy_error_rejection);
+
+		if (num_samples_per_scalar_segment != 0)
+			hash_value = hash_combine(hash_value, hash32(num_samples_per_scalar_segment));
+
+		if (bit_rate_hint != nullptr)
+			hash_value = hash_combine(hash_value, bit_rate_hint->get_hash());
+
 		return hash_value;
 	}
 
@@ -139,9 +210,26 @@ namespace acl
 		if (metadata_result.any())
 			return metadata_result;
 
+		const error_result job_scheduler_result = job_scheduler.is_valid();
+		if (job_scheduler_result.any())
+			return job_scheduler_result;
+
 		if (keyframe_stripping.enable_stripping && enable_database_support)
 			return error_result("Cannot enable keyframe stripping with database support");
 
+		if (bit_rate_search_strategy != bit_rate_search_strategy8::permutations && bit_rate_search_strategy != bit_rate_search_strategy8::greedy)
+			return error_result("Invalid bit_rate_search_strategy");
+
+		if (num_samples_per_scalar_segment == 1)
+			return error_result("num_samples_per_scalar_segment must be 0 or at least 2");
+
+		if (bit_rate_hint != nullptr)
+		{
+			const error_result bit_rate_hint_result = bit_rate_hint->is_valid(false);
+			if (bit_rate_hint_result.any())
+				return bit_rate_hint_result;
+		}
+
 		return error_result();
 	}
 
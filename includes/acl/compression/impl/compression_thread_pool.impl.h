@@ -0,0 +1,186 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Included only once from compression_thread_pool.h
+
+#include "acl/version.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	inline compression_thread_pool::compression_thread_pool(uint32_t num_threads)
+		: m_threads()
+		, m_queues()
+		, m_num_threads(num_threads != 0 ? num_threads : std::max<uint32_t>(std::thread::hardware_concurrency(), 1))
+		, m_lock()
+		, m_job_available()
+		, m_jobs_done()
+		, m_next_queue_index(0)
+		, m_num_queued_jobs(0)
+		, m_num_unfinished_jobs(0)
+		, m_is_shutting_down(false)
+	{
+		m_queues.reset(new worker_queue[m_num_threads]);
+
+		m_threads.reserve(m_num_threads);
+		for (uint32_t thread_index = 0; thread_index < m_num_threads; ++thread_index)
+			m_threads.emplace_back([this, thread_index]() { execute_jobs(thread_index); });
+	}
+
+	inline compression_thread_pool::~compression_thread_pool()
+	{
+		wait_for_jobs();
+
+		{
+			std::unique_lock<std::mutex> lock(m_lock);
+			m_is_shutting_down = true;
+		}
+
+		m_job_available.notify_all();
+
+		for (std::thread& thread : m_threads)
+			thread.join();
+	}
+
+	inline void compression_thread_pool::submit_job(job_function job, void* job_data)
+	{
+		const uint32_t num_queues = get_num_threads();
+		const uint32_t queue_index = m_next_queue_index.fetch_add(1, std::memory_order_relaxed) % num_queues;
+
+		// Counted before it is queued, a worker can only ever see more jobs than there are
+		m_num_unfinished_jobs.fetch_add(1, std::memory_order_relaxed);
+		m_num_queued_jobs.fetch_add(1, std::memory_order_release);
+
+		{
+			worker_queue& queue = m_queues[queue_index];
+			std::unique_lock<std::mutex> lock(queue.lock);
+			queue.jobs.push_back(pending_job{ job, job_data });
+		}
+
+		// Taking the lock ensures that a worker about to sleep sees our job
+		{
+			std::unique_lock<std::mutex> lock(m_lock);
+		}
+
+		m_job_available.notify_one();
+	}
+
+	inline void compression_thread_pool::wait_for_jobs()
+	{
+		while (m_num_unfinished_jobs.load(std::memory_order_acquire) != 0)
+		{
+			// Help out while we wait
+			if (try_execute_job(0))
+				continue;
+
+			// Everything left is executing on the workers
+			std::unique_lock<std::mutex> lock(m_lock);
+			m_jobs_done.wait(lock, [this]() { return m_num_unfinished_jobs.load(std::memory_order_acquire) == 0 || m_num_queued_jobs.load(std::memory_order_acquire) != 0; });
+		}
+	}
+
+	inline compression_job_scheduler compression_thread_pool::get_job_scheduler()
+	{
+		compression_job_scheduler job_scheduler;
+		job_scheduler.submit_job = [](void* user_data, job_function job, void* job_data) { static_cast<compression_thread_pool*>(user_data)->submit_job(job, job_data); };
+		job_scheduler.wait_for_jobs = [](void* user_data) { static_cast<compression_thread_pool*>(user_data)->wait_for_jobs(); };
+		job_scheduler.user_data = this;
+		job_scheduler.max_num_jobs = get_num_threads();
+		return job_scheduler;
+	}
+
+	inline void compression_thread_pool::execute_jobs(uint32_t worker_index)
+	{
+		while (true)
+		{
+			if (try_execute_job(worker_index))
+				continue;
+
+			std::unique_lock<std::mutex> lock(m_lock);
+			m_job_available.wait(lock, [this]() { return m_is_shutting_down || m_num_queued_jobs.load(std::memory_order_acquire) != 0; });
+
+			if (m_is_shutting_down && m_num_queued_jobs.load(std::memory_order_acquire) == 0)
+				break;	// Shutting down and nothing left to do
+		}
+	}
+
+	inline bool compression_thread_pool::try_execute_job(uint32_t queue_index)
+	{
+		const uint32_t num_queues = get_num_threads();
+
+		// We start with our own queue, newest job first since its data is the most likely to be in the cache.
+		// We then steal the oldest job of the other queues.
+		for (uint32_t queue_offset = 0; queue_offset < num_queues; ++queue_offset)
+		{
+			worker_queue& queue = m_queues[(queue_index + queue_offset) % num_queues];
+
+			pending_job job;
+			{
+				std::unique_lock<std::mutex> lock(queue.lock);
+				if (queue.jobs.empty())
+					continue;
+
+				if (queue_offset == 0)
+				{
+					job = queue.jobs.back();
+					queue.jobs.pop_back();
+				}
+				else
+				{
+					job = queue.jobs.front();
+					queue.jobs.pop_front();
+				}
+			}
+
+			m_num_queued_jobs.fetch_sub(1, std::memory_order_relaxed);
+
+			job.job(job.job_data);
+
+			if (m_num_unfinished_jobs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				// Last job, wake up the waiting thread
+				{
+					std::unique_lock<std::mutex> lock(m_lock);
+				}
+
+				m_jobs_done.notify_all();
+			}
+
+			return true;
+		}
+
+		return false;
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
@@ -29,13 +29,20 @@
 #include "acl/version.h"
 #include "acl/compression/compress.h"
 #include "acl/compression/track_array.h"
+#include "acl/compression/impl/compression_jobs.h"
 #include "acl/core/compressed_tracks.h"
 #include "acl/core/error_result.h"
 #include "acl/core/iallocator.h"
 #include "acl/core/track_formats.h"
-#include "acl/core/impl/debug_track_writer.h"
+#include "acl/core/track_writer.h"
+#include "acl/core/impl/compiler_utils.h"
 #include "acl/decompression/decompress.h"
 
+#include <rtm/qvvf.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+
+#include <algorithm>
 #include <cstdint>
 
 namespace acl
@@ -55,6 +62,82 @@ namespace acl
 			static constexpr bool is_translation_format_supported(vector_format8 format) { return format == vector_format8::vector3f_full; }
 			static constexpr bool is_scale_format_supported(vector_format8 format) { return format == vector_format8::vector3f_full; }
 		};
+
+		// Number of contiguous samples each conversion job decompresses, about a segment
+		constexpr uint32_t k_num_convert_samples_per_job = 32;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Writes decompressed values straight into the sample buffers of a track array.
+		// Tracks are indexed in compressed order and the sample index is set before each sample.
+		// Default sub-tracks are written from the track descriptions.
+		//////////////////////////////////////////////////////////////////////////
+		struct track_array_sample_writer final : public track_writer
+		{
+			explicit track_array_sample_writer(track_array& tracks_)
+				: tracks(tracks_)
+				, sample_index(0)
+			{}
+
+			//////////////////////////////////////////////////////////////////////////
+			// Scalar track writing
+
+			void RTM_SIMD_CALL write_float1(uint32_t track_index, rtm::scalarf_arg0 value) { rtm::scalar_store(value, static_cast<float*>(tracks[track_index][sample_index])); }
+			void RTM_SIMD_CALL write_float2(uint32_t track_index, rtm::vector4f_arg0 value) { rtm::vector_store2(value, static_cast<rtm::float2f*>(tracks[track_index][sample_index])); }
+			void RTM_SIMD_CALL write_float3(uint32_t track_index, rtm::vector4f_arg0 value) { rtm::vector_store3(value, static_cast<rtm::float3f*>(tracks[track_index][sample_index])); }
+			void RTM_SIMD_CALL write_float4(uint32_t track_index, rtm::vector4f_arg0 value) { rtm::vector_store(value, static_cast<rtm::float4f*>(tracks[track_index][sample_index])); }
+			void RTM_SIMD_CALL write_vector4(uint32_t track_index, rtm::vector4f_arg0 value) { *static_cast<rtm::vector4f*>(tracks[track_index][sample_index]) = value; }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Transform track writing
+
+			static constexpr default_sub_track_mode get_default_rotation_mode() { return default_sub_track_mode::variable; }
+			static constexpr default_sub_track_mode get_default_translation_mode() { return default_sub_track_mode::variable; }
+			static constexpr default_sub_track_mode get_default_scale_mode() { return default_sub_track_mode::variable; }
+
+			rtm::quatf RTM_SIMD_CALL get_variable_default_rotation(uint32_t track_index) const { return get_default_value(track_index).rotation; }
+			rtm::vector4f RTM_SIMD_CALL get_variable_default_translation(uint32_t track_index) const { return get_default_value(track_index).translation; }
+			rtm::vector4f RTM_SIMD_CALL get_variable_default_scale(uint32_t track_index) const { return get_default_value(track_index).scale; }
+
+			void RTM_SIMD_CALL write_rotation(uint32_t track_index, rtm::quatf_arg0 rotation) { get_qvv(track_index).rotation = rotation; }
+			void RTM_SIMD_CALL write_translation(uint32_t track_index, rtm::vector4f_arg0 translation) { get_qvv(track_index).translation = translation; }
+			void RTM_SIMD_CALL write_scale(uint32_t track_index, rtm::vector4f_arg0 scale) { get_qvv(track_index).scale = scale; }
+
+			const rtm::qvvf& get_default_value(uint32_t track_index) const { return track_cast<track_qvvf>(tracks[track_index]).get_description().default_value; }
+			rtm::qvvf& get_qvv(uint32_t track_index) { return *static_cast<rtm::qvvf*>(tracks[track_index][sample_index]); }
+
+			track_array& tracks;
+			uint32_t sample_index;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Decompresses a contiguous range of samples into the track array.
+		// Samples are visited in order, every seek lands on a key frame and we never interpolate.
+		template<class decompression_settings_type>
+		inline void convert_sample_range(const compressed_tracks& tracks, track_array& result, uint32_t first_sample_index, uint32_t num_samples)
+		{
+			// Disable floating point exceptions since decompression assumes it, jobs can run on any thread
+			scope_disable_fp_exceptions fp_off;
+
+			const float sample_rate = tracks.get_sample_rate();
+			const float duration = tracks.get_finite_duration();
+
+			decompression_context<decompression_settings_type> context;
+			context.initialize(tracks);
+
+			track_array_sample_writer writer(result);
+
+			const uint32_t end_sample_index = first_sample_index + num_samples;
+			for (uint32_t sample_index = first_sample_index; sample_index < end_sample_index; ++sample_index)
+			{
+				const float sample_time = rtm::scalar_min(float(sample_index) / sample_rate, duration);
+
+				// Round to nearest to land directly on a sample
+				context.seek(sample_time, sample_rounding_policy::nearest);
+
+				writer.sample_index = sample_index;
+				context.decompress_tracks(writer);
+			}
+		}
 	}
 
 	inline error_result convert_track_list(iallocator& allocator, const track_array& track_list, compressed_tracks*& out_compressed_tracks)
@@ -75,6 +158,11 @@ namespace acl
 	}
 
 	inline error_result convert_track_list(iallocator& allocator, const compressed_tracks& tracks, track_array& out_track_list)
+	{
+		return convert_track_list(allocator, tracks, compression_job_scheduler(), out_track_list);
+	}
+
+	inline error_result convert_track_list(iallocator& allocator, const compressed_tracks& tracks, const compression_job_scheduler& job_scheduler, track_array& out_track_list)
 	{
 		error_result error = tracks.is_valid(false);
 		if (error.any())
@@ -84,7 +172,6 @@ namespace acl
 		const track_type8 track_type = tracks.get_track_type();
 		const uint32_t num_samples = tracks.get_num_samples_per_track();
 		const float sample_rate = tracks.get_sample_rate();
-		const float duration = tracks.get_finite_duration();
 
 		track_array result(allocator, num_tracks);
 		result.set_name(string(allocator, tracks.get_name()));
@@ -138,113 +225,31 @@ namespace acl
 		if (!success)
 			return error_result("Metadata was missing from the input");
 
-		// Disable floating point exceptions since decompression assumes it
-		scope_disable_fp_exceptions fp_off;
-
 		// Decompress and populate our track data
+		// Samples are split into contiguous ranges that each job walks in order with its own context
 		const acl_impl::tracks_header& header = acl_impl::get_tracks_header(tracks);
-		if (track_type == track_type8::qvvf &&
+		const bool is_raw = track_type == track_type8::qvvf &&
 			header.get_rotation_format() == rotation_format8::quatf_full &&
 			header.get_translation_format() == vector_format8::vector3f_full &&
-			header.get_scale_format() == vector_format8::vector3f_full)
-		{
-			// Our input transform data uses full precision, retain it
-			decompression_context<acl_impl::raw_sampling_decompression_settings> context;
-			context.initialize(tracks);
+			header.get_scale_format() == vector_format8::vector3f_full;
 
-			acl_impl::debug_track_writer writer(allocator, track_type, num_tracks);
-			writer.initialize_with_defaults(result);
+		const uint32_t num_jobs = (num_samples + acl_impl::k_num_convert_samples_per_job - 1) / acl_impl::k_num_convert_samples_per_job;
 
-			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
-			{
-				const float sample_time = rtm::scalar_min(float(sample_index) / sample_rate, duration);
-
-				// Round to nearest to land directly on a sample
-				context.seek(sample_time, sample_rounding_policy::nearest);
-
-				context.decompress_tracks(writer);
-
-				for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
-				{
-					track& track_ = result[track_index];
-
-					switch (track_type)
-					{
-					case track_type8::float1f:
-						*reinterpret_cast<float*>(track_[sample_index]) = writer.read_float1(track_index);
-						break;
-					case track_type8::float2f:
-						rtm::vector_store2(writer.read_float2(track_index), reinterpret_cast<rtm::float2f*>(track_[sample_index]));
-						break;
-					case track_type8::float3f:
-						rtm::vector_store3(writer.read_float3(track_index), reinterpret_cast<rtm::float3f*>(track_[sample_index]));
-						break;
-					case track_type8::float4f:
-						rtm::vector_store(writer.read_float4(track_index), reinterpret_cast<rtm::float4f*>(track_[sample_index]));
-						break;
-					case track_type8::vector4f:
-						*reinterpret_cast<rtm::vector4f*>(track_[sample_index]) = writer.read_vector4(track_index);
-						break;
-					case track_type8::qvvf:
-						*reinterpret_cast<rtm::qvvf*>(track_[sample_index]) = writer.read_qvv(track_index);
-						break;
-					default:
-						ACL_ASSERT(false, "Unexpected track type");
-						break;
-					}
-				}
-			}
-		}
-		else
+		const auto convert_job = [&tracks, &result, num_samples, is_raw](uint32_t job_index)
 		{
-			decompression_context<decompression_settings> context;
-			context.initialize(tracks);
-
-			acl_impl::debug_track_writer writer(allocator, track_type, num_tracks);
-
-			if (track_type == track_type8::qvvf)
-				writer.initialize_with_defaults(result);
+			const uint32_t first_sample_index = job_index * acl_impl::k_num_convert_samples_per_job;
+			const uint32_t num_job_samples = std::min<uint32_t>(acl_impl::k_num_convert_samples_per_job, num_samples - first_sample_index);
 
-			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			if (is_raw)
 			{
-				const float sample_time = rtm::scalar_min(float(sample_index) / sample_rate, duration);
-
-				// Round to nearest to land directly on a sample
-				context.seek(sample_time, sample_rounding_policy::nearest);
-
-				context.decompress_tracks(writer);
-
-				for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
-				{
-					track& track_ = result[track_index];
-
-					switch (track_type)
-					{
-					case track_type8::float1f:
-						*reinterpret_cast<float*>(track_[sample_index]) = writer.read_float1(track_index);
-						break;
-					case track_type8::float2f:
-						rtm::vector_store2(writer.read_float2(track_index), reinterpret_cast<rtm::float2f*>(track_[sample_index]));
-						break;
-					case track_type8::float3f:
-						rtm::vector_store3(writer.read_float3(track_index), reinterpret_cast<rtm::float3f*>(track_[sample_index]));
-						break;
-					case track_type8::float4f:
-						rtm::vector_store(writer.read_float4(track_index), reinterpret_cast<rtm::float4f*>(track_[sample_index]));
-						break;
-					case track_type8::vector4f:
-						*reinterpret_cast<rtm::vector4f*>(track_[sample_index]) = writer.read_vector4(track_index);
-						break;
-					case track_type8::qvvf:
-						*reinterpret_cast<rtm::qvvf*>(track_[sample_index]) = writer.read_qvv(track_index);
-						break;
-					default:
-						ACL_ASSERT(false, "Unexpected track type");
-						break;
-					}
-				}
+				// Our input transform data uses full precision, retain it
+				acl_impl::convert_sample_range<acl_impl::raw_sampling_decompression_settings>(tracks, result, first_sample_index, num_job_samples);
 			}
-		}
+			else
+				acl_impl::convert_sample_range<decompression_settings>(tracks, result, first_sample_index, num_job_samples);
+		};
+
+		acl_impl::execute_compression_jobs(job_scheduler, num_jobs, convert_job);
 
 		out_track_list = std::move(result);
 		return error_result();
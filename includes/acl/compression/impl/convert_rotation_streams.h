@@ -25,11 +25,14 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "acl/version.h"
-#include "acl/core/iallocator.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/error.h"
 #include "acl/core/track_formats.h"
+#include "acl/compression/compression_settings.h"
 #include "acl/compression/impl/clip_context.h"
+#include "acl/compression/impl/compression_jobs.h"
+#include "acl/compression/impl/normalize_streams.h"
+#include "acl/math/quatf.h"
 
 #include <rtm/quatf.h>
 #include <rtm/vector4f.h>
@@ -64,49 +67,185 @@ namespace acl
 			}
 		}
 
-		inline void convert_rotation_streams(iallocator& allocator, segment_context& segment, rotation_format8 rotation_format)
+		// Flips contiguous rotations in place so that their W component is positive
+		// Every rotation goes through the same operations as rtm::quat_ensure_positive_w(..), four at a time
+		inline void ensure_positive_w_samples(rtm::vector4f* samples, uint32_t num_samples)
+		{
+			const uint32_t num_unrolled_samples = num_samples & ~3U;
+
+			uint32_t sample_index = 0;
+			for (; sample_index < num_unrolled_samples; sample_index += 4)
+			{
+				const rtm::quatf rotation0 = rtm::quat_ensure_positive_w(rtm::vector_to_quat(samples[sample_index + 0]));
+				const rtm::quatf rotation1 = rtm::quat_ensure_positive_w(rtm::vector_to_quat(samples[sample_index + 1]));
+				const rtm::quatf rotation2 = rtm::quat_ensure_positive_w(rtm::vector_to_quat(samples[sample_index + 2]));
+				const rtm::quatf rotation3 = rtm::quat_ensure_positive_w(rtm::vector_to_quat(samples[sample_index + 3]));
+
+				samples[sample_index + 0] = rtm::quat_to_vector(rotation0);
+				samples[sample_index + 1] = rtm::quat_to_vector(rotation1);
+				samples[sample_index + 2] = rtm::quat_to_vector(rotation2);
+				samples[sample_index + 3] = rtm::quat_to_vector(rotation3);
+			}
+
+			for (; sample_index < num_samples; ++sample_index)
+				samples[sample_index] = rtm::quat_to_vector(rtm::quat_ensure_positive_w(rtm::vector_to_quat(samples[sample_index])));
+		}
+
+		// We convert our rotation streams in place. We assume that the original format is quatf_full stored as rtm::quatf
+		// For all other formats, we keep the same sample size and use rtm::vector4f
+		inline void convert_rotation_streams(segment_context& segment, rotation_format8 rotation_format, const compression_job_scheduler& job_scheduler)
 		{
 			const rotation_format8 high_precision_format = get_rotation_variant(rotation_format) == rotation_variant8::quat ? rotation_format8::quatf_full : rotation_format8::quatf_drop_w_full;
 
+			// Every bone is independent
+			auto convert_bone = [&](uint32_t bone_index)
+			{
+				rotation_track_stream& rotations = segment.bone_streams[bone_index].rotations;
+				ACL_ASSERT(rotations.get_sample_size() == sizeof(rtm::quatf), "Unexpected rotation sample size. %u != %zu", rotations.get_sample_size(), sizeof(rtm::quatf));
+
+				const uint32_t num_samples = rotations.get_num_samples();
+
+				switch (high_precision_format)
+				{
+				case rotation_format8::quatf_full:
+					// Original format, nothing to do
+					break;
+				case rotation_format8::quatf_drop_w_full:
+					// Drop W, we just ensure it is positive and write it back, the W component can be ignored afterwards
+					if (num_samples != 0)
+						ensure_positive_w_samples(safe_ptr_cast<rtm::vector4f>(rotations.get_raw_sample_ptr(0)), num_samples);
+					break;
+				default:
+					ACL_ASSERT(false, "Invalid or unsupported rotation format: %s", get_rotation_format_name(high_precision_format));
+					break;
+				}
+
+				rotations.set_rotation_format(high_precision_format);
+			};
+
+			execute_compression_jobs(job_scheduler, segment.num_bones, convert_bone);
+		}
+
+		inline void convert_rotation_streams(clip_context& context, rotation_format8 rotation_format, const compression_job_scheduler& job_scheduler)
+		{
+			for (segment_context& segment : context.segment_iterator())
+				convert_rotation_streams(segment, rotation_format, job_scheduler);
+		}
+
+		// Moves the dropped component of a rotation into the W slot, see quat_unswizzle_dropped_component(..)
+		// The rotation is negated if needed to keep the dropped component positive
+		inline rtm::vector4f RTM_SIMD_CALL swizzle_dropped_component(rtm::vector4f_arg0 rotation, uint32_t dropped_component)
+		{
+			rtm::vector4f swizzled_rotation;
+
+			switch (dropped_component)
+			{
+			default:
+			case 0:
+				swizzled_rotation = rotation;
+				break;
+			case 1:
+				swizzled_rotation = rtm::vector_mix<rtm::mix4::y, rtm::mix4::z, rtm::mix4::w, rtm::mix4::x>(rotation, rotation);
+				break;
+			case 2:
+				swizzled_rotation = rtm::vector_mix<rtm::mix4::x, rtm::mix4::z, rtm::mix4::w, rtm::mix4::y>(rotation, rotation);
+				break;
+			case 3:
+				swizzled_rotation = rtm::vector_mix<rtm::mix4::x, rtm::mix4::y, rtm::mix4::w, rtm::mix4::z>(rotation, rotation);
+				break;
+			}
+
+			return rtm::quat_to_vector(rtm::quat_ensure_positive_w(rtm::vector_to_quat(swizzled_rotation)));
+		}
+
+		// When our rotation format drops the largest component, we pick which component to drop for every
+		// animated rotation sub-track. The choice is made once for the whole clip to keep the clip range
+		// reduction consistent and so that two segments can be interpolated together.
+		// We drop the component that stays the furthest away from zero, it reconstructs the most accurately
+		// and the three remaining components span a smaller range.
+		// Samples are swizzled in place and the clip range is updated to match.
+		inline void drop_largest_rotation_components(clip_context& context, rotation_format8 rotation_format)
+		{
+			if (rotation_format != rotation_format8::quatf_drop_largest_variable)
+				return;	// Nothing to do
+
+			ACL_ASSERT(context.num_segments == 1, "context must contain a single segment!");
+			segment_context& segment = context.segments[0];
+
 			for (transform_streams& bone_stream : segment.bone_iterator())
 			{
-				// We convert our rotation stream in place. We assume that the original format is quatf_full stored as rtm::quatf
-				// For all other formats, we keep the same sample size and either keep Quat_32 or use rtm::vector4f
-				ACL_ASSERT(bone_stream.rotations.get_sample_size() == sizeof(rtm::quatf), "Unexpected rotation sample size. %u != %zu", bone_stream.rotations.get_sample_size(), sizeof(rtm::quatf));
+				// Constant and default sub-tracks always drop W
+				if (bone_stream.is_rotation_constant || bone_stream.is_rotation_default)
+					continue;
 
-				const uint32_t num_samples = bone_stream.rotations.get_num_samples();
-				const float sample_rate = bone_stream.rotations.get_sample_rate();
-				rotation_track_stream converted_stream(allocator, num_samples, sizeof(rtm::quatf), sample_rate, high_precision_format);
+				rotation_track_stream& rotations = bone_stream.rotations;
+				const uint32_t num_samples = rotations.get_num_samples();
 
+				rtm::vector4f min_abs_rotation = rtm::vector_set(1.0F);
 				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
 				{
-					rtm::quatf rotation = bone_stream.rotations.get_raw_sample<rtm::quatf>(sample_index);
+					const rtm::vector4f rotation = rotations.get_raw_sample<rtm::vector4f>(sample_index);
+					min_abs_rotation = rtm::vector_min(min_abs_rotation, rtm::vector_abs(rotation));
+				}
 
-					switch (high_precision_format)
+				// We keep dropping W unless another component is strictly better
+				uint32_t dropped_component = 0;
+				float largest_min_abs = rtm::vector_get_w(min_abs_rotation);
+
+				const float min_abs_components[3] = { rtm::vector_get_x(min_abs_rotation), rtm::vector_get_y(min_abs_rotation), rtm::vector_get_z(min_abs_rotation) };
+				for (uint32_t component_index = 0; component_index < 3; ++component_index)
+				{
+					if (min_abs_components[component_index] > largest_min_abs)
 					{
-					case rotation_format8::quatf_full:
-						// Original format, nothing to do
-						break;
-					case rotation_format8::quatf_drop_w_full:
-						// Drop W, we just ensure it is positive and write it back, the W component can be ignored afterwards
-						rotation = rtm::quat_ensure_positive_w(rotation);
-						break;
-					default:
-						ACL_ASSERT(false, "Invalid or unsupported rotation format: %s", get_rotation_format_name(high_precision_format));
-						break;
+						dropped_component = component_index + 1;
+						largest_min_abs = min_abs_components[component_index];
 					}
+				}
 
-					converted_stream.set_raw_sample(sample_index, rotation);
+				if (dropped_component == 0)
+					continue;	// W is the best choice, our samples are already in the right order
+
+				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+				{
+					const rtm::vector4f rotation = rotations.get_raw_sample<rtm::vector4f>(sample_index);
+					rotations.set_raw_sample(sample_index, swizzle_dropped_component(rotation, dropped_component));
 				}
 
-				bone_stream.rotations = std::move(converted_stream);
+				bone_stream.rotation_dropped_component = uint8_t(dropped_component);
+				context.ranges[bone_stream.bone_index].rotation = calculate_track_range(rotations, true);
 			}
 		}
 
-		inline void convert_rotation_streams(iallocator& allocator, clip_context& context, rotation_format8 rotation_format)
+		// When our rotation format is the quaternion logarithm, every animated rotation sub-track is converted.
+		// A rotation maps to its rotation axis scaled by half its rotation angle which spreads the quantization
+		// error nearly uniformly over the rotation angle instead of bunching it near the identity.
+		// Constant and default sub-tracks are left untouched, they are stored like they are when W is dropped.
+		// Samples are converted in place and the clip range is updated to match.
+		inline void convert_rotation_streams_to_log(clip_context& context, rotation_format8 rotation_format)
 		{
-			for (segment_context& segment : context.segment_iterator())
-				convert_rotation_streams(allocator, segment, rotation_format);
+			if (rotation_format != rotation_format8::quatf_log_variable)
+				return;	// Nothing to do
+
+			ACL_ASSERT(context.num_segments == 1, "context must contain a single segment!");
+			segment_context& segment = context.segments[0];
+
+			for (transform_streams& bone_stream : segment.bone_iterator())
+			{
+				if (bone_stream.is_rotation_constant || bone_stream.is_rotation_default)
+					continue;
+
+				rotation_track_stream& rotations = bone_stream.rotations;
+				const uint32_t num_samples = rotations.get_num_samples();
+
+				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+				{
+					const rtm::quatf rotation = rotations.get_raw_sample<rtm::quatf>(sample_index);
+					rotations.set_raw_sample(sample_index, quat_to_log(rotation));
+				}
+
+				bone_stream.is_rotation_log = true;
+				context.ranges[bone_stream.bone_index].rotation = calculate_track_range(rotations, true);
+			}
 		}
 	}
 
@@ -28,6 +28,7 @@
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/compression/compression_settings.h"
 
+#include <algorithm>
 #include <cstdint>
 
 ACL_IMPL_FILE_PRAGMA_PUSH
@@ -64,10 +65,6 @@ namespace acl
 				bitset_set_range(&segment.hard_keyframes, hard_keyframes_desc, 0, segment.num_samples, true);
 			}
 
-			// Sort the contributing error of every keyframe within the clip
-			auto sort_predicate = [](const clip_frame_contributing_error_t& lhs, const clip_frame_contributing_error_t& rhs) { return lhs.contributing_error.error < rhs.contributing_error.error; };
-			std::sort(contributing_error_per_keyframe, contributing_error_per_keyframe + num_keyframes, sort_predicate);
-
 			// First determine how many we wish to strip based on proportion
 			// A frame is movable if it isn't the first or last frame of a segment
 			// If we have more than 1 frame, we can remove 2 frames per segment
@@ -76,16 +73,32 @@ namespace acl
 			// If we have 0 or 1 frame, none are movable
 			const uint32_t num_movable_frames = num_keyframes >= 2 ? (num_keyframes - (lossy_clip_context.num_segments * 2)) : 0;
 
+			// We only need the keyframes we strip, not their order, which means we don't need to sort every keyframe
+			// The first and last keyframes of every segment contribute infinite error and always end up last
+			auto sort_predicate = [](const clip_frame_contributing_error_t& lhs, const clip_frame_contributing_error_t& rhs) { return lhs.contributing_error.error < rhs.contributing_error.error; };
+			clip_frame_contributing_error_t* contributing_error_end = contributing_error_per_keyframe + num_keyframes;
+
 			// First estimate how many keyframes to strip using the desired minimum proportion to strip
+			// Partition our keyframes such that the ones with the lowest contributing error come first
 			uint32_t num_keyframes_to_strip = std::min<uint32_t>(num_movable_frames, uint32_t(settings.keyframe_stripping.proportion * float(num_keyframes)));
+			std::nth_element(contributing_error_per_keyframe, contributing_error_per_keyframe + num_keyframes_to_strip, contributing_error_end, sort_predicate);
+
+			// Then strip more if the remaining keyframes are below our threshold
+			// Every remaining keyframe has an error equal or above the ones we strip, only those below the threshold can be stripped
+			const float threshold = settings.keyframe_stripping.threshold;
+			auto is_below_threshold = [threshold](const clip_frame_contributing_error_t& keyframe) { return keyframe.contributing_error.error <= threshold; };
+			clip_frame_contributing_error_t* threshold_end = std::partition(contributing_error_per_keyframe + num_keyframes_to_strip, contributing_error_end, is_below_threshold);
 
-			// Then scan starting until we find our threshold if its above the proportion
-			for (; num_keyframes_to_strip < num_movable_frames; ++num_keyframes_to_strip)
+			const uint32_t num_below_threshold = uint32_t(threshold_end - (contributing_error_per_keyframe + num_keyframes_to_strip));
+			const uint32_t num_extra_keyframes_to_strip = std::min<uint32_t>(num_movable_frames - num_keyframes_to_strip, num_below_threshold);
+			if (num_extra_keyframes_to_strip < num_below_threshold)
 			{
-				if (contributing_error_per_keyframe[num_keyframes_to_strip].contributing_error.error > settings.keyframe_stripping.threshold)
-					break;	// The error exceeds our threshold, stop stripping keyframes
+				// We can't strip every keyframe below the threshold, keep the ones with the lowest error first
+				std::nth_element(contributing_error_per_keyframe + num_keyframes_to_strip, contributing_error_per_keyframe + num_keyframes_to_strip + num_extra_keyframes_to_strip, threshold_end, sort_predicate);
 			}
 
+			num_keyframes_to_strip += num_extra_keyframes_to_strip;
+
 			ACL_ASSERT(num_keyframes_to_strip <= num_movable_frames, "Cannot strip more than the number of movable keyframes");
 
 			// Now that we know how many keyframes to strip, remove them
@@ -32,7 +32,11 @@
 #include "acl/core/track_formats.h"
 #include "acl/core/track_types.h"
 #include "acl/core/range_reduction_types.h"
+#include "acl/core/impl/variable_bit_rates.h"
+#include "acl/compression/compression_settings.h"
 #include "acl/compression/impl/clip_context.h"
+#include "acl/compression/impl/compression_jobs.h"
+#include "acl/math/quat_packing.h"
 
 #include <rtm/vector4f.h>
 
@@ -46,22 +50,65 @@ namespace acl
 
 	namespace acl_impl
 	{
+		// Computes the component wise min/max of contiguous samples
+		// Four independent accumulators are used to break the dependency chain between samples
+		inline void calculate_sample_min_max(const rtm::vector4f* samples, uint32_t num_samples, rtm::vector4f& out_min, rtm::vector4f& out_max)
+		{
+			rtm::vector4f min0 = rtm::vector_set(1e10F);
+			rtm::vector4f max0 = rtm::vector_set(-1e10F);
+			rtm::vector4f min1 = min0;
+			rtm::vector4f max1 = max0;
+			rtm::vector4f min2 = min0;
+			rtm::vector4f max2 = max0;
+			rtm::vector4f min3 = min0;
+			rtm::vector4f max3 = max0;
+
+			const uint32_t num_unrolled_samples = num_samples & ~3U;
+
+			uint32_t sample_index = 0;
+			for (; sample_index < num_unrolled_samples; sample_index += 4)
+			{
+				const rtm::vector4f sample0 = samples[sample_index + 0];
+				const rtm::vector4f sample1 = samples[sample_index + 1];
+				const rtm::vector4f sample2 = samples[sample_index + 2];
+				const rtm::vector4f sample3 = samples[sample_index + 3];
+
+				min0 = rtm::vector_min(min0, sample0);
+				max0 = rtm::vector_max(max0, sample0);
+				min1 = rtm::vector_min(min1, sample1);
+				max1 = rtm::vector_max(max1, sample1);
+				min2 = rtm::vector_min(min2, sample2);
+				max2 = rtm::vector_max(max2, sample2);
+				min3 = rtm::vector_min(min3, sample3);
+				max3 = rtm::vector_max(max3, sample3);
+			}
+
+			for (; sample_index < num_samples; ++sample_index)
+			{
+				const rtm::vector4f sample = samples[sample_index];
+
+				min0 = rtm::vector_min(min0, sample);
+				max0 = rtm::vector_max(max0, sample);
+			}
+
+			out_min = rtm::vector_min(rtm::vector_min(min0, min1), rtm::vector_min(min2, min3));
+			out_max = rtm::vector_max(rtm::vector_max(max0, max1), rtm::vector_max(max2, max3));
+		}
+
 		inline track_stream_range calculate_track_range(const track_stream& stream, bool is_vector4)
 		{
 			const uint32_t num_samples = stream.get_num_samples();
 			if (num_samples == 0)
 				return track_stream_range::from_min_max(rtm::vector_zero(), rtm::vector_zero());
 
-			rtm::vector4f min = rtm::vector_set(1e10F);
-			rtm::vector4f max = rtm::vector_set(-1e10F);
-			
-			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
-			{
-				const rtm::vector4f sample = stream.get_raw_sample<rtm::vector4f>(sample_index);
+			// We expect all our samples to have the same width of sizeof(rtm::vector4f)
+			ACL_ASSERT(stream.get_sample_size() == sizeof(rtm::vector4f), "Unexpected sample size. %u != %zu", stream.get_sample_size(), sizeof(rtm::vector4f));
 
-				min = rtm::vector_min(min, sample);
-				max = rtm::vector_max(max, sample);
-			}
+			const rtm::vector4f* samples = safe_ptr_cast<const rtm::vector4f>(stream.get_raw_sample_ptr(0));
+
+			rtm::vector4f min;
+			rtm::vector4f max;
+			calculate_sample_min_max(samples, num_samples, min, max);
 
 			// Set the 4th component to zero if we don't need it
 			if (!is_vector4)
@@ -73,11 +120,12 @@ namespace acl
 			return track_stream_range::from_min_max(min, max);
 		}
 
-		inline void extract_bone_ranges_impl(const segment_context& segment, transform_range* bone_ranges)
+		inline void extract_bone_ranges_impl(const segment_context& segment, transform_range* bone_ranges, const compression_job_scheduler& job_scheduler)
 		{
 			const bool has_scale = segment_context_has_scale(segment);
 
-			for (uint32_t bone_index = 0; bone_index < segment.num_bones; ++bone_index)
+			// Every bone is independent
+			auto extract_bone_range = [&](uint32_t bone_index)
 			{
 				const transform_streams& bone_stream = segment.bone_streams[bone_index];
 				transform_range& bone_range = bone_ranges[bone_index];
@@ -89,20 +137,22 @@ namespace acl
 					bone_range.scale = calculate_track_range(bone_stream.scales, false);
 				else
 					bone_range.scale = track_stream_range();
-			}
+			};
+
+			execute_compression_jobs(job_scheduler, segment.num_bones, extract_bone_range);
 		}
 
-		inline void extract_clip_bone_ranges(iallocator& allocator, clip_context& context)
+		inline void extract_clip_bone_ranges(iallocator& allocator, clip_context& context, const compression_job_scheduler& job_scheduler)
 		{
 			context.ranges = allocate_type_array<transform_range>(allocator, context.num_bones);
 
 			ACL_ASSERT(context.num_segments == 1, "context must contain a single segment!");
 			const segment_context& segment = context.segments[0];
 
-			acl_impl::extract_bone_ranges_impl(segment, context.ranges);
+			acl_impl::extract_bone_ranges_impl(segment, context.ranges, job_scheduler);
 		}
 
-		inline void extract_segment_bone_ranges(iallocator& allocator, clip_context& context)
+		inline void extract_segment_bone_ranges(iallocator& allocator, clip_context& context, const compression_job_scheduler& job_scheduler)
 		{
 			const rtm::vector4f one = rtm::vector_set(1.0F);
 			const rtm::vector4f zero = rtm::vector_zero();
@@ -156,7 +206,7 @@ namespace acl
 			{
 				segment.ranges = allocate_type_array<transform_range>(allocator, segment.num_bones);
 
-				acl_impl::extract_bone_ranges_impl(segment, segment.ranges);
+				acl_impl::extract_bone_ranges_impl(segment, segment.ranges, job_scheduler);
 
 				for (uint32_t bone_index = 0; bone_index < segment.num_bones; ++bone_index)
 				{
@@ -175,6 +225,63 @@ namespace acl
 			}
 		}
 
+		// Quantizes the clip range of every animated rotation sub-track with 16 bits per component,
+		// see dequantize_rotation_clip_range_min(..) for details.
+		// Like segment ranges, the quantized range must encompass our samples: the minimum is rounded down
+		// and the extent is rounded up. Samples are then normalized within the quantized range.
+		inline void quantize_rotation_clip_ranges(clip_context& context, rotation_format8 rotation_format, range_reduction_flags8 range_reduction)
+		{
+			// Other rotation formats are not bounded by [-1.0, 1.0] or are not range reduced
+			const bool is_rotation_format_supported = rotation_format == rotation_format8::quatf_drop_w_variable || rotation_format == rotation_format8::quatf_drop_largest_variable;
+			if (!is_rotation_format_supported || !are_any_enum_flags_set(range_reduction, range_reduction_flags8::rotations))
+				return;
+
+			ACL_ASSERT(context.num_segments == 1, "context must contain a single segment!");
+			const segment_context& segment = context.segments[0];
+
+			const rtm::vector4f one = rtm::vector_set(1.0F);
+			const rtm::vector4f zero = rtm::vector_zero();
+			const rtm::vector4f max_value = rtm::vector_set(65535.0F);
+
+			for (const transform_streams& bone_stream : segment.const_bone_iterator())
+			{
+				if (bone_stream.is_rotation_constant)
+					continue;
+
+				track_stream_range& range = context.ranges[bone_stream.bone_index].rotation;
+
+				// We pick the quantized minimum closest to the true minimum that is lower or equal
+				const rtm::vector4f range_min = range.get_min();
+				const rtm::vector4f scaled_min = rtm::vector_mul(rtm::vector_add(range_min, one), rtm::vector_set(65535.0F * 0.5F));
+				const rtm::vector4f quantized_min0 = rtm::vector_clamp(rtm::vector_floor(scaled_min), zero, max_value);
+				const rtm::vector4f quantized_min1 = rtm::vector_max(rtm::vector_sub(quantized_min0, one), zero);
+
+				const rtm::vector4f padded_range_min0 = dequantize_rotation_clip_range_min(quantized_min0);
+				const rtm::vector4f padded_range_min1 = dequantize_rotation_clip_range_min(quantized_min1);
+
+				const rtm::mask4f is_min0_lower_mask = rtm::vector_less_equal(padded_range_min0, range_min);
+				const rtm::vector4f padded_range_min = rtm::vector_select(is_min0_lower_mask, padded_range_min0, padded_range_min1);
+
+				// Our minimum changed, we pick the quantized extent that reaches our maximum
+				const rtm::vector4f range_max = range.get_max();
+				const rtm::vector4f range_extent = rtm::vector_sub(range_max, padded_range_min);
+				const rtm::vector4f scaled_extent = rtm::vector_mul(range_extent, rtm::vector_set(65535.0F * 0.5F));
+				const rtm::vector4f quantized_extent0 = rtm::vector_clamp(rtm::vector_ceil(scaled_extent), zero, max_value);
+				const rtm::vector4f quantized_extent1 = rtm::vector_min(rtm::vector_add(quantized_extent0, one), max_value);
+
+				const rtm::vector4f padded_range_extent0 = dequantize_rotation_clip_range_extent(quantized_extent0);
+				const rtm::vector4f padded_range_extent1 = dequantize_rotation_clip_range_extent(quantized_extent1);
+
+				const rtm::mask4f is_extent0_higher_mask = rtm::vector_greater_equal(rtm::vector_add(padded_range_min, padded_range_extent0), range_max);
+				const rtm::vector4f padded_range_extent = rtm::vector_select(is_extent0_higher_mask, padded_range_extent0, padded_range_extent1);
+
+				range = track_stream_range::from_min_extent(padded_range_min, padded_range_extent);
+
+				// Only flag our clip once a range has been quantized, clips without animated rotations are unchanged
+				context.has_quantized_rotation_clip_ranges = true;
+			}
+		}
+
 		inline rtm::vector4f RTM_SIMD_CALL normalize_sample(rtm::vector4f_arg0 sample, const track_stream_range& range)
 		{
 			const rtm::vector4f range_min = range.get_min();
@@ -187,188 +294,247 @@ namespace acl
 			return rtm::vector_select(is_range_zero_mask, rtm::vector_zero(), normalized_sample);
 		}
 
-		inline void normalize_rotation_streams(transform_streams* bone_streams, const transform_range* bone_ranges, uint32_t num_bones)
+		// Normalizes contiguous samples in place within the provided range
+		// Every sample goes through the same operations as normalize_sample(..), four at a time
+		inline void normalize_samples(rtm::vector4f* samples, uint32_t num_samples, const track_stream_range& range)
 		{
+			// normalized value is between [0.0 .. 1.0]
+			// value = (normalized value * range extent) + range min
+			// normalized value = (value - range min) / range extent
 			const rtm::vector4f one = rtm::vector_set(1.0F);
 			const rtm::vector4f zero = rtm::vector_zero();
+			const rtm::vector4f range_min = range.get_min();
+			const rtm::vector4f range_extent = range.get_extent();
+			const rtm::mask4f is_range_zero_mask = rtm::vector_less_than(range_extent, rtm::vector_set(0.000000001F));
 
-			for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
-			{
-				transform_streams& bone_stream = bone_streams[bone_index];
-				const transform_range& bone_range = bone_ranges[bone_index];
+			const uint32_t num_unrolled_samples = num_samples & ~3U;
 
-				// We expect all our samples to have the same width of sizeof(rtm::vector4f)
-				ACL_ASSERT(bone_stream.rotations.get_sample_size() == sizeof(rtm::vector4f), "Unexpected rotation sample size. %u != %zu", bone_stream.rotations.get_sample_size(), sizeof(rtm::vector4f));
+			uint32_t sample_index = 0;
+			for (; sample_index < num_unrolled_samples; sample_index += 4)
+			{
+				rtm::vector4f sample0 = rtm::vector_div(rtm::vector_sub(samples[sample_index + 0], range_min), range_extent);
+				rtm::vector4f sample1 = rtm::vector_div(rtm::vector_sub(samples[sample_index + 1], range_min), range_extent);
+				rtm::vector4f sample2 = rtm::vector_div(rtm::vector_sub(samples[sample_index + 2], range_min), range_extent);
+				rtm::vector4f sample3 = rtm::vector_div(rtm::vector_sub(samples[sample_index + 3], range_min), range_extent);
+
+				// Clamp because the division might be imprecise
+				sample0 = rtm::vector_min(sample0, one);
+				sample1 = rtm::vector_min(sample1, one);
+				sample2 = rtm::vector_min(sample2, one);
+				sample3 = rtm::vector_min(sample3, one);
+
+				samples[sample_index + 0] = rtm::vector_select(is_range_zero_mask, zero, sample0);
+				samples[sample_index + 1] = rtm::vector_select(is_range_zero_mask, zero, sample1);
+				samples[sample_index + 2] = rtm::vector_select(is_range_zero_mask, zero, sample2);
+				samples[sample_index + 3] = rtm::vector_select(is_range_zero_mask, zero, sample3);
+			}
 
-				// Constant or default tracks are not normalized
-				if (bone_stream.is_rotation_constant)
-					continue;
+			for (; sample_index < num_samples; ++sample_index)
+			{
+				rtm::vector4f sample = rtm::vector_div(rtm::vector_sub(samples[sample_index], range_min), range_extent);
+				sample = rtm::vector_min(sample, one);
+				samples[sample_index] = rtm::vector_select(is_range_zero_mask, zero, sample);
+			}
+		}
 
-				const uint32_t num_samples = bone_stream.rotations.get_num_samples();
+		inline void normalize_rotation_stream(rotation_track_stream& rotations, const track_stream_range& range)
+		{
+			// We expect all our samples to have the same width of sizeof(rtm::vector4f)
+			ACL_ASSERT(rotations.get_sample_size() == sizeof(rtm::vector4f), "Unexpected rotation sample size. %u != %zu", rotations.get_sample_size(), sizeof(rtm::vector4f));
 
-				const rtm::vector4f range_min = bone_range.rotation.get_min();
-				const rtm::vector4f range_extent = bone_range.rotation.get_extent();
-				const rtm::mask4f is_range_zero_mask = rtm::vector_less_than(range_extent, rtm::vector_set(0.000000001F));
+			const uint32_t num_samples = rotations.get_num_samples();
+			if (num_samples == 0)
+				return;
 
-				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
-				{
-					// normalized value is between [0.0 .. 1.0]
-					// value = (normalized value * range extent) + range min
-					// normalized value = (value - range min) / range extent
-					const rtm::vector4f rotation = bone_stream.rotations.get_raw_sample<rtm::vector4f>(sample_index);
-					rtm::vector4f normalized_rotation = rtm::vector_div(rtm::vector_sub(rotation, range_min), range_extent);
-					// Clamp because the division might be imprecise
-					normalized_rotation = rtm::vector_min(normalized_rotation, one);
-					normalized_rotation = rtm::vector_select(is_range_zero_mask, zero, normalized_rotation);
+			rtm::vector4f* samples = safe_ptr_cast<rtm::vector4f>(rotations.get_raw_sample_ptr(0));
+			normalize_samples(samples, num_samples, range);
 
 #if defined(ACL_HAS_ASSERT_CHECKS)
-					switch (bone_stream.rotations.get_rotation_format())
-					{
-					case rotation_format8::quatf_full:
-						ACL_ASSERT(rtm::vector_all_greater_equal(normalized_rotation, zero) && rtm::vector_all_less_equal(normalized_rotation, one), "Invalid normalized rotation. 0.0 <= [%f, %f, %f, %f] <= 1.0", (float)rtm::vector_get_x(normalized_rotation), (float)rtm::vector_get_y(normalized_rotation), (float)rtm::vector_get_z(normalized_rotation), (float)rtm::vector_get_w(normalized_rotation));
-						break;
-					case rotation_format8::quatf_drop_w_full:
-					case rotation_format8::quatf_drop_w_variable:
-						ACL_ASSERT(rtm::vector_all_greater_equal3(normalized_rotation, zero) && rtm::vector_all_less_equal3(normalized_rotation, one), "Invalid normalized rotation. 0.0 <= [%f, %f, %f] <= 1.0", (float)rtm::vector_get_x(normalized_rotation), (float)rtm::vector_get_y(normalized_rotation), (float)rtm::vector_get_z(normalized_rotation));
-						break;
-					}
-#endif
+			const rtm::vector4f one = rtm::vector_set(1.0F);
+			const rtm::vector4f zero = rtm::vector_zero();
 
-					bone_stream.rotations.set_raw_sample(sample_index, normalized_rotation);
+			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			{
+				const rtm::vector4f normalized_rotation = samples[sample_index];
+
+				switch (rotations.get_rotation_format())
+				{
+				case rotation_format8::quatf_full:
+					ACL_ASSERT(rtm::vector_all_greater_equal(normalized_rotation, zero) && rtm::vector_all_less_equal(normalized_rotation, one), "Invalid normalized rotation. 0.0 <= [%f, %f, %f, %f] <= 1.0", (float)rtm::vector_get_x(normalized_rotation), (float)rtm::vector_get_y(normalized_rotation), (float)rtm::vector_get_z(normalized_rotation), (float)rtm::vector_get_w(normalized_rotation));
+					break;
+				case rotation_format8::quatf_drop_w_full:
+				case rotation_format8::quatf_drop_w_variable:
+					ACL_ASSERT(rtm::vector_all_greater_equal3(normalized_rotation, zero) && rtm::vector_all_less_equal3(normalized_rotation, one), "Invalid normalized rotation. 0.0 <= [%f, %f, %f] <= 1.0", (float)rtm::vector_get_x(normalized_rotation), (float)rtm::vector_get_y(normalized_rotation), (float)rtm::vector_get_z(normalized_rotation));
+					break;
 				}
 			}
+#endif
 		}
 
-		inline void normalize_translation_streams(transform_streams* bone_streams, const transform_range* bone_ranges, uint32_t num_bones)
+		inline void normalize_vector_stream(track_stream& stream, const track_stream_range& range)
 		{
-			const rtm::vector4f one = rtm::vector_set(1.0F);
-			const rtm::vector4f zero = rtm::vector_zero();
-
-			for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
-			{
-				transform_streams& bone_stream = bone_streams[bone_index];
-				const transform_range& bone_range = bone_ranges[bone_index];
+			// We expect all our samples to have the same width of sizeof(rtm::vector4f)
+			ACL_ASSERT(stream.get_sample_size() == sizeof(rtm::vector4f), "Unexpected sample size. %u != %zu", stream.get_sample_size(), sizeof(rtm::vector4f));
 
-				// We expect all our samples to have the same width of sizeof(rtm::vector4f)
-				ACL_ASSERT(bone_stream.translations.get_sample_size() == sizeof(rtm::vector4f), "Unexpected translation sample size. %u != %zu", bone_stream.translations.get_sample_size(), sizeof(rtm::vector4f));
-
-				// Constant or default tracks are not normalized
-				if (bone_stream.is_translation_constant)
-					continue;
+			const uint32_t num_samples = stream.get_num_samples();
+			if (num_samples == 0)
+				return;
 
-				const uint32_t num_samples = bone_stream.translations.get_num_samples();
+			rtm::vector4f* samples = safe_ptr_cast<rtm::vector4f>(stream.get_raw_sample_ptr(0));
+			normalize_samples(samples, num_samples, range);
 
-				const rtm::vector4f range_min = bone_range.translation.get_min();
-				const rtm::vector4f range_extent = bone_range.translation.get_extent();
-				const rtm::mask4f is_range_zero_mask = rtm::vector_less_than(range_extent, rtm::vector_set(0.000000001F));
+#if defined(ACL_HAS_ASSERT_CHECKS)
+			const rtm::vector4f one = rtm::vector_set(1.0F);
+			const rtm::vector4f zero = rtm::vector_zero();
 
-				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
-				{
-					// normalized value is between [0.0 .. 1.0]
-					// value = (normalized value * range extent) + range min
-					// normalized value = (value - range min) / range extent
-					const rtm::vector4f translation = bone_stream.translations.get_raw_sample<rtm::vector4f>(sample_index);
-					rtm::vector4f normalized_translation = rtm::vector_div(rtm::vector_sub(translation, range_min), range_extent);
-					// Clamp because the division might be imprecise
-					normalized_translation = rtm::vector_min(normalized_translation, one);
-					normalized_translation = rtm::vector_select(is_range_zero_mask, zero, normalized_translation);
-
-					ACL_ASSERT(rtm::vector_all_greater_equal3(normalized_translation, zero) && rtm::vector_all_less_equal3(normalized_translation, one), "Invalid normalized translation. 0.0 <= [%f, %f, %f] <= 1.0", (float)rtm::vector_get_x(normalized_translation), (float)rtm::vector_get_y(normalized_translation), (float)rtm::vector_get_z(normalized_translation));
-
-					bone_stream.translations.set_raw_sample(sample_index, normalized_translation);
-				}
+			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			{
+				const rtm::vector4f normalized_sample = samples[sample_index];
+				ACL_ASSERT(rtm::vector_all_greater_equal3(normalized_sample, zero) && rtm::vector_all_less_equal3(normalized_sample, one), "Invalid normalized sample. 0.0 <= [%f, %f, %f] <= 1.0", (float)rtm::vector_get_x(normalized_sample), (float)rtm::vector_get_y(normalized_sample), (float)rtm::vector_get_z(normalized_sample));
 			}
+#endif
 		}
 
-		inline void normalize_scale_streams(transform_streams* bone_streams, const transform_range* bone_ranges, uint32_t num_bones)
+		// Normalizes the requested sub-tracks of every bone, bones are independent and are split between jobs
+		// Constant or default sub-tracks are not normalized
+		inline void normalize_bone_streams(segment_context& segment, const transform_range* bone_ranges, range_reduction_flags8 range_reduction, const compression_job_scheduler& job_scheduler)
 		{
-			const rtm::vector4f one = rtm::vector_set(1.0F);
-			const rtm::vector4f zero = rtm::vector_zero();
+			const bool normalize_rotations = are_any_enum_flags_set(range_reduction, range_reduction_flags8::rotations);
+			const bool normalize_translations = are_any_enum_flags_set(range_reduction, range_reduction_flags8::translations);
+			const bool normalize_scales = segment_context_has_scale(segment) && are_any_enum_flags_set(range_reduction, range_reduction_flags8::scales);
 
-			for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
+			auto normalize_bone = [&](uint32_t bone_index)
 			{
-				transform_streams& bone_stream = bone_streams[bone_index];
+				transform_streams& bone_stream = segment.bone_streams[bone_index];
 				const transform_range& bone_range = bone_ranges[bone_index];
 
-				// We expect all our samples to have the same width of sizeof(rtm::vector4f)
-				ACL_ASSERT(bone_stream.scales.get_sample_size() == sizeof(rtm::vector4f), "Unexpected scale sample size. %u != %zu", bone_stream.scales.get_sample_size(), sizeof(rtm::vector4f));
-
-				// Constant or default tracks are not normalized
-				if (bone_stream.is_scale_constant)
-					continue;
+				if (normalize_rotations && !bone_stream.is_rotation_constant)
+					normalize_rotation_stream(bone_stream.rotations, bone_range.rotation);
 
-				const uint32_t num_samples = bone_stream.scales.get_num_samples();
+				if (normalize_translations && !bone_stream.is_translation_constant)
+					normalize_vector_stream(bone_stream.translations, bone_range.translation);
 
-				const rtm::vector4f range_min = bone_range.scale.get_min();
-				const rtm::vector4f range_extent = bone_range.scale.get_extent();
-				const rtm::mask4f is_range_zero_mask = rtm::vector_less_than(range_extent, rtm::vector_set(0.000000001F));
+				if (normalize_scales && !bone_stream.is_scale_constant)
+					normalize_vector_stream(bone_stream.scales, bone_range.scale);
+			};
 
-				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
-				{
-					// normalized value is between [0.0 .. 1.0]
-					// value = (normalized value * range extent) + range min
-					// normalized value = (value - range min) / range extent
-					const rtm::vector4f scale = bone_stream.scales.get_raw_sample<rtm::vector4f>(sample_index);
-					rtm::vector4f normalized_scale = rtm::vector_div(rtm::vector_sub(scale, range_min), range_extent);
-					// Clamp because the division might be imprecise
-					normalized_scale = rtm::vector_min(normalized_scale, one);
-					normalized_scale = rtm::vector_select(is_range_zero_mask, zero, normalized_scale);
-
-					ACL_ASSERT(rtm::vector_all_greater_equal3(normalized_scale, zero) && rtm::vector_all_less_equal3(normalized_scale, one), "Invalid normalized scale. 0.0 <= [%f, %f, %f] <= 1.0", (float)rtm::vector_get_x(normalized_scale), (float)rtm::vector_get_y(normalized_scale), (float)rtm::vector_get_z(normalized_scale));
-
-					bone_stream.scales.set_raw_sample(sample_index, normalized_scale);
-				}
-			}
+			execute_compression_jobs(job_scheduler, segment.num_bones, normalize_bone);
 		}
 
-		inline void normalize_clip_streams(clip_context& context, range_reduction_flags8 range_reduction)
+		inline void normalize_clip_streams(clip_context& context, range_reduction_flags8 range_reduction, const compression_job_scheduler& job_scheduler)
 		{
 			ACL_ASSERT(context.num_segments == 1, "context must contain a single segment!");
 			segment_context& segment = context.segments[0];
 
 			const bool has_scale = segment_context_has_scale(segment);
 
+			normalize_bone_streams(segment, context.ranges, range_reduction, job_scheduler);
+
 			if (are_any_enum_flags_set(range_reduction, range_reduction_flags8::rotations))
-			{
-				normalize_rotation_streams(segment.bone_streams, context.ranges, segment.num_bones);
 				context.are_rotations_normalized = true;
-			}
 
 			if (are_any_enum_flags_set(range_reduction, range_reduction_flags8::translations))
-			{
-				normalize_translation_streams(segment.bone_streams, context.ranges, segment.num_bones);
 				context.are_translations_normalized = true;
-			}
 
 			if (has_scale && are_any_enum_flags_set(range_reduction, range_reduction_flags8::scales))
-			{
-				normalize_scale_streams(segment.bone_streams, context.ranges, segment.num_bones);
 				context.are_scales_normalized = true;
+		}
+
+		// A component with half the clip range of the largest component of its sub-track needs one bit less to
+		// retain the same precision once normalized
+		inline void calculate_component_bit_rate_reductions(const track_stream_range& range, uint8_t out_bit_rate_reductions[3])
+		{
+			const rtm::vector4f extent = range.get_extent();
+			const float extent_x = rtm::vector_get_x(extent);
+			const float extent_y = rtm::vector_get_y(extent);
+			const float extent_z = rtm::vector_get_z(extent);
+			const float max_extent = rtm::scalar_max(rtm::scalar_max(extent_x, extent_y), extent_z);
+
+			const float component_extents[3] = { extent_x, extent_y, extent_z };
+			for (uint32_t component_index = 0; component_index < 3; ++component_index)
+			{
+				uint8_t bit_rate_reduction = 0;
+				while (bit_rate_reduction < k_max_component_bit_rate_reduction && (component_extents[component_index] * float(2 << bit_rate_reduction)) <= max_extent)
+					bit_rate_reduction++;
+
+				out_bit_rate_reductions[component_index] = bit_rate_reduction;
 			}
 		}
 
-		inline void normalize_segment_streams(clip_context& context, range_reduction_flags8 range_reduction)
+		// A vector3 sub-track is uniform when its components share the same clip range and are equal in every sample,
+		// only its X component needs to be stored
+		inline bool is_vector3_stream_uniform(const track_stream_range& range, const track_stream& stream)
+		{
+			const rtm::vector4f range_min = range.get_min();
+			const rtm::vector4f range_extent = range.get_extent();
+			if (rtm::vector_get_x(range_min) != rtm::vector_get_y(range_min) || rtm::vector_get_x(range_min) != rtm::vector_get_z(range_min))
+				return false;
+
+			if (rtm::vector_get_x(range_extent) != rtm::vector_get_y(range_extent) || rtm::vector_get_x(range_extent) != rtm::vector_get_z(range_extent))
+				return false;
+
+			const uint32_t num_samples = stream.get_num_samples();
+			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			{
+				const rtm::vector4f sample = stream.get_raw_sample<rtm::vector4f>(sample_index);
+				if (rtm::vector_get_x(sample) != rtm::vector_get_y(sample) || rtm::vector_get_x(sample) != rtm::vector_get_z(sample))
+					return false;
+			}
+
+			return true;
+		}
+
+		// Vector formats with a variable number of bits per component derive the bit rate of each component from
+		// the bit rate of their sub-track. This is done once per clip from the clip ranges, the bit rate search then
+		// validates the resulting precision with the error metric like any other bit rate.
+		inline void calculate_component_bit_rate_reductions(clip_context& context, vector_format8 translation_format, vector_format8 scale_format)
+		{
+			ACL_ASSERT(context.num_segments == 1, "context must contain a single segment!");
+			segment_context& segment = context.segments[0];
+
+			const bool are_translation_components_variable = translation_format == vector_format8::vector3f_variable_per_component && context.are_translations_normalized;
+			const bool are_scale_components_variable = scale_format == vector_format8::vector3f_variable_per_component && context.are_scales_normalized;
+
+			if (!are_translation_components_variable && !are_scale_components_variable)
+				return;	// Nothing to do
+
+			for (transform_streams& bone_stream : segment.bone_iterator())
+			{
+				const transform_range& bone_range = context.ranges[bone_stream.bone_index];
+
+				if (are_translation_components_variable && !bone_stream.is_translation_constant)
+					calculate_component_bit_rate_reductions(bone_range.translation, bone_stream.translation_bit_rate_reductions);
+
+				if (are_scale_components_variable && !bone_stream.is_scale_constant)
+				{
+					// Uniform scale is common, we store a single component for it
+					if (is_vector3_stream_uniform(bone_range.scale, bone_stream.scales))
+					{
+						bone_stream.scale_bit_rate_reductions[0] = 0;
+						bone_stream.scale_bit_rate_reductions[1] = k_uniform_component_bit_rate_reduction;
+						bone_stream.scale_bit_rate_reductions[2] = k_uniform_component_bit_rate_reduction;
+					}
+					else
+						calculate_component_bit_rate_reductions(bone_range.scale, bone_stream.scale_bit_rate_reductions);
+				}
+			}
+		}
+
+		inline void normalize_segment_streams(clip_context& context, range_reduction_flags8 range_reduction, const compression_job_scheduler& job_scheduler)
 		{
 			for (segment_context& segment : context.segment_iterator())
 			{
+				normalize_bone_streams(segment, segment.ranges, range_reduction, job_scheduler);
+
 				if (are_any_enum_flags_set(range_reduction, range_reduction_flags8::rotations))
-				{
-					normalize_rotation_streams(segment.bone_streams, segment.ranges, segment.num_bones);
 					segment.are_rotations_normalized = true;
-				}
 
 				if (are_any_enum_flags_set(range_reduction, range_reduction_flags8::translations))
-				{
-					normalize_translation_streams(segment.bone_streams, segment.ranges, segment.num_bones);
 					segment.are_translations_normalized = true;
-				}
 
 				const bool has_scale = segment_context_has_scale(segment);
 				if (has_scale && are_any_enum_flags_set(range_reduction, range_reduction_flags8::scales))
-				{
-					normalize_scale_streams(segment.bone_streams, segment.ranges, segment.num_bones);
 					segment.are_scales_normalized = true;
-				}
 
 				uint32_t range_data_size = 0;
 				uint32_t range_data_rotation_num = 0;
@@ -26,11 +26,13 @@
 
 #include "acl/version.h"
 #include "acl/core/impl/compiler_utils.h"
+#include "acl/core/range_reduction_types.h"
 #include "acl/compression/impl/track_list_context.h"
 
 #include <rtm/mask4i.h>
 #include <rtm/vector4f.h>
 
+#include <algorithm>
 #include <cstdint>
 
 ACL_IMPL_FILE_PRAGMA_PUSH
@@ -41,22 +43,18 @@ namespace acl
 
 	namespace acl_impl
 	{
-		inline void normalize_scalarf_track(track& mut_track, const scalarf_range& range)
+		inline void normalize_scalarf_samples(track_vector4f& typed_track, const scalarf_range& range, uint32_t start_sample_index, uint32_t end_sample_index)
 		{
 			using namespace rtm;
 
 			const vector4f one = rtm::vector_set(1.0F);
 			const vector4f zero = vector_zero();
 
-			track_vector4f& typed_track = track_cast<track_vector4f>(mut_track);
-
-			const uint32_t num_samples = mut_track.get_num_samples();
-
 			const vector4f range_min = range.get_min();
 			const vector4f range_extent = range.get_extent();
 			const mask4f is_range_zero_mask = vector_less_than(range_extent, rtm::vector_set(0.000000001F));
 
-			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			for (uint32_t sample_index = start_sample_index; sample_index < end_sample_index; ++sample_index)
 			{
 				// normalized value is between [0.0 .. 1.0]
 				// value = (normalized value * range extent) + range min
@@ -75,6 +73,12 @@ namespace acl
 			}
 		}
 
+		inline void normalize_scalarf_track(track& mut_track, const scalarf_range& range)
+		{
+			track_vector4f& typed_track = track_cast<track_vector4f>(mut_track);
+			normalize_scalarf_samples(typed_track, range, 0, mut_track.get_num_samples());
+		}
+
 		inline void normalize_tracks(track_list_context& context)
 		{
 			ACL_ASSERT(context.is_valid(), "Invalid context");
@@ -99,6 +103,84 @@ namespace acl
 				}
 			}
 		}
+
+		// Segment ranges live within the normalized track range and are quantized on 8 bits per component.
+		// We pick the closest quantized values that still encompass every sample of the segment.
+		inline scalarf_range RTM_SIMD_CALL quantize_scalarf_segment_range(rtm::vector4f_arg0 range_min, rtm::vector4f_arg1 range_max)
+		{
+			using namespace rtm;
+
+			const vector4f one = rtm::vector_set(1.0F);
+			const vector4f zero = vector_zero();
+			const float max_range_value_flt = float((1 << k_segment_range_reduction_num_bits_per_component) - 1);
+			const vector4f max_range_value = rtm::vector_set(max_range_value_flt);
+			const vector4f inv_max_range_value = rtm::vector_set(1.0F / max_range_value_flt);
+
+			// The minimum must be lower or equal to the true minimum
+			const vector4f quantized_min0 = vector_clamp(vector_floor(vector_mul(range_min, max_range_value)), zero, max_range_value);
+			const vector4f quantized_min1 = vector_max(vector_sub(quantized_min0, one), zero);
+			const vector4f padded_range_min0 = vector_mul(quantized_min0, inv_max_range_value);
+			const vector4f padded_range_min1 = vector_mul(quantized_min1, inv_max_range_value);
+			const vector4f padded_range_min = vector_select(vector_less_equal(padded_range_min0, range_min), padded_range_min0, padded_range_min1);
+
+			// The maximum we reconstruct with the extent must be higher or equal to the true maximum
+			const vector4f quantized_extent0 = vector_clamp(vector_ceil(vector_mul(vector_sub(range_max, padded_range_min), max_range_value)), zero, max_range_value);
+			const vector4f quantized_extent1 = vector_min(vector_add(quantized_extent0, one), max_range_value);
+			const vector4f padded_range_extent0 = vector_mul(quantized_extent0, inv_max_range_value);
+			const vector4f padded_range_extent1 = vector_mul(quantized_extent1, inv_max_range_value);
+			const mask4f is_extent0_higher_mask = vector_greater_equal(vector_add(padded_range_min, padded_range_extent0), range_max);
+			const vector4f padded_range_extent = vector_select(is_extent0_higher_mask, padded_range_extent0, padded_range_extent1);
+
+			return scalarf_range::from_min_extent(padded_range_min, padded_range_extent);
+		}
+
+		// Splits our normalized tracks into segments with their own range and normalizes them again within it
+		inline void normalize_track_segments(track_list_context& context, uint32_t num_samples_per_segment)
+		{
+			ACL_ASSERT(context.is_valid(), "Invalid context");
+
+			if (num_samples_per_segment == 0 || context.num_samples <= num_samples_per_segment)
+				return;	// A single segment uses the track ranges as is
+
+			const uint32_t num_tracks = context.num_tracks;
+			const uint32_t num_segments = (context.num_samples + num_samples_per_segment - 1) / num_samples_per_segment;
+
+			context.segment_range_list = allocate_type_array<track_range>(*context.allocator, size_t(num_segments) * num_tracks);
+			context.num_samples_per_segment = num_samples_per_segment;
+			context.num_segments = num_segments;
+
+			for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			{
+				const bool is_track_constant = context.is_constant(track_index);
+				if (is_track_constant)
+					continue;	// Constant tracks don't need to be modified
+
+				const track_range& range = context.range_list[track_index];
+				ACL_ASSERT(range.category == track_category8::scalarf, "Invalid track category");
+				(void)range;
+
+				track_vector4f& typed_track = track_cast<track_vector4f>(context.track_list[track_index]);
+
+				for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+				{
+					const uint32_t start_sample_index = segment_index * num_samples_per_segment;
+					const uint32_t end_sample_index = std::min<uint32_t>(start_sample_index + num_samples_per_segment, context.num_samples);
+
+					rtm::vector4f segment_min = typed_track[start_sample_index];
+					rtm::vector4f segment_max = segment_min;
+					for (uint32_t sample_index = start_sample_index + 1; sample_index < end_sample_index; ++sample_index)
+					{
+						segment_min = rtm::vector_min(segment_min, typed_track[sample_index]);
+						segment_max = rtm::vector_max(segment_max, typed_track[sample_index]);
+					}
+
+					const scalarf_range segment_range = quantize_scalarf_segment_range(segment_min, segment_max);
+					context.segment_range_list[(segment_index * num_tracks) + track_index] = track_range(segment_range);
+
+					normalize_scalarf_samples(typed_track, segment_range, start_sample_index, end_sample_index);
+				}
+			}
+		}
 	}
 
 	ACL_IMPL_VERSION_NAMESPACE_END
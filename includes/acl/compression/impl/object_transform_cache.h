@@ -0,0 +1,191 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/error.h"
+#include "acl/core/impl/variable_bit_rates.h"
+#include "acl/compression/impl/clip_context.h"
+
+#include <cstdint>
+#include <cstring>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// This class retains the lossy object space transforms of every sample in a segment.
+		// While searching for the optimal bit rates, a single transform along the chain
+		// usually changes between two error scans. The object space transforms of its parents
+		// do not change and only the chain below the changed transform needs to be recomputed.
+		// A cached transform is valid if its bit rates match, if every sample was computed,
+		// and if its parent hasn't been recomputed since.
+		// The cache must be reset whenever the segment changes.
+		//////////////////////////////////////////////////////////////////////////
+		class object_transform_cache
+		{
+		public:
+			object_transform_cache(iallocator& allocator, const clip_context& clip, size_t transform_size);
+			~object_transform_cache();
+
+			//////////////////////////////////////////////////////////////////////////
+			// Invalidates every cached transform.
+			void reset();
+
+			//////////////////////////////////////////////////////////////////////////
+			// Returns the index of the first chain link whose cached transforms cannot be used
+			// with the provided bit rates. Every link that follows it must be recomputed as well.
+			// Returns the number of links in the chain if every transform is cached.
+			uint32_t find_first_dirty_link(const uint32_t* chain_transform_indices, uint32_t num_chain_links, const transform_bit_rates* bit_rates, uint32_t num_samples) const;
+
+			//////////////////////////////////////////////////////////////////////////
+			// Returns the cached object space transform of a sample.
+			const uint8_t* get_transform(uint32_t sample_index, uint32_t transform_index) const { return m_transforms + (sample_index * m_sample_size) + (transform_index * m_transform_size); }
+			uint8_t* get_transform(uint32_t sample_index, uint32_t transform_index) { return m_transforms + (sample_index * m_sample_size) + (transform_index * m_transform_size); }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Marks the chain links starting at the first dirty link as cached with the provided bit rates.
+			// Their transforms must have been written for the first 'num_samples' samples.
+			void commit(const uint32_t* chain_transform_indices, uint32_t first_dirty_link, uint32_t num_chain_links, const transform_bit_rates* bit_rates, uint32_t num_samples);
+
+			size_t get_allocated_size() const;
+
+		private:
+			object_transform_cache(const object_transform_cache&) = delete;
+			object_transform_cache& operator=(const object_transform_cache&) = delete;
+
+			struct cache_entry
+			{
+				transform_bit_rates	bit_rates;
+				uint32_t			num_samples;
+				uint32_t			version;
+				uint32_t			parent_version;
+			};
+
+			iallocator&				m_allocator;
+			const transform_metadata* m_metadata;
+
+			cache_entry*			m_entries;			// 1 per transform
+			uint8_t*				m_transforms;		// 1 per transform per sample in segment
+
+			size_t					m_transform_size;
+			size_t					m_sample_size;
+			uint32_t				m_num_transforms;
+			uint32_t				m_max_num_samples;
+			uint32_t				m_version;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Implementation
+
+		inline object_transform_cache::object_transform_cache(iallocator& allocator, const clip_context& clip, size_t transform_size)
+			: m_allocator(allocator)
+			, m_metadata(clip.metadata)
+			, m_transform_size(transform_size)
+			, m_sample_size(transform_size * clip.num_bones)
+			, m_num_transforms(clip.num_bones)
+			, m_max_num_samples(clip.segments->num_samples)
+			, m_version(0)
+		{
+			m_entries = allocate_type_array<cache_entry>(allocator, m_num_transforms);
+			m_transforms = allocate_type_array_aligned<uint8_t>(allocator, m_sample_size * m_max_num_samples, 64);
+
+			reset();
+		}
+
+		inline object_transform_cache::~object_transform_cache()
+		{
+			deallocate_type_array(m_allocator, m_entries, m_num_transforms);
+			deallocate_type_array(m_allocator, m_transforms, m_sample_size * m_max_num_samples);
+		}
+
+		inline void object_transform_cache::reset()
+		{
+			// Entries without samples are never valid, the versions can keep increasing
+			for (uint32_t transform_index = 0; transform_index < m_num_transforms; ++transform_index)
+				m_entries[transform_index].num_samples = 0;
+		}
+
+		inline uint32_t object_transform_cache::find_first_dirty_link(const uint32_t* chain_transform_indices, uint32_t num_chain_links, const transform_bit_rates* bit_rates, uint32_t num_samples) const
+		{
+			// Chains start at the root, the first stale link invalidates everything below it
+			for (uint32_t chain_link_index = 0; chain_link_index < num_chain_links; ++chain_link_index)
+			{
+				const uint32_t transform_index = chain_transform_indices[chain_link_index];
+				const cache_entry& entry = m_entries[transform_index];
+
+				if (entry.num_samples != num_samples)
+					return chain_link_index;	// Empty or partially computed
+
+				const transform_bit_rates& transform_bit_rates_ = bit_rates[transform_index];
+				if (entry.bit_rates.rotation != transform_bit_rates_.rotation || entry.bit_rates.translation != transform_bit_rates_.translation || entry.bit_rates.scale != transform_bit_rates_.scale)
+					return chain_link_index;	// Our bit rates changed
+
+				const uint32_t parent_transform_index = m_metadata[transform_index].parent_index;
+				if (parent_transform_index != k_invalid_track_index && entry.parent_version != m_entries[parent_transform_index].version)
+					return chain_link_index;	// Our parent was recomputed since
+			}
+
+			return num_chain_links;
+		}
+
+		inline void object_transform_cache::commit(const uint32_t* chain_transform_indices, uint32_t first_dirty_link, uint32_t num_chain_links, const transform_bit_rates* bit_rates, uint32_t num_samples)
+		{
+			ACL_ASSERT(num_samples <= m_max_num_samples, "Too many samples: %u > %u", num_samples, m_max_num_samples);
+
+			// Parents are committed first, their children pick up their new version
+			for (uint32_t chain_link_index = first_dirty_link; chain_link_index < num_chain_links; ++chain_link_index)
+			{
+				const uint32_t transform_index = chain_transform_indices[chain_link_index];
+				const uint32_t parent_transform_index = m_metadata[transform_index].parent_index;
+
+				cache_entry& entry = m_entries[transform_index];
+				entry.bit_rates = bit_rates[transform_index];
+				entry.num_samples = num_samples;
+				entry.version = ++m_version;
+				entry.parent_version = parent_transform_index != k_invalid_track_index ? m_entries[parent_transform_index].version : 0;
+			}
+		}
+
+		inline size_t object_transform_cache::get_allocated_size() const
+		{
+			size_t cache_size = 0;
+			cache_size += sizeof(cache_entry) * m_num_transforms;
+			cache_size += m_sample_size * m_max_num_samples;
+			return cache_size;
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,153 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/error.h"
+#include "acl/core/memory_utils.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <cstdint>
+#include <cstring>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Appends bits to a byte aligned buffer one 64 bit word at a time.
+		// Bits are written most significant first, the resulting layout is identical
+		// to successive memcpy_bits(..) calls. Bits are accumulated into a register
+		// and only whole words are written until flush() is called to write the
+		// remaining bytes. Readers can do the reverse: load a whole word, byte swap it,
+		// and shift out the bits they need.
+		//////////////////////////////////////////////////////////////////////////
+		class packed_bit_writer
+		{
+		public:
+			explicit packed_bit_writer(uint8_t* buffer)
+				: m_buffer(buffer)
+				, m_accumulator(0)
+				, m_num_pending_bits(0)
+				, m_num_bits_written(0)
+			{
+				ACL_ASSERT(buffer != nullptr, "Buffer cannot be null");
+			}
+
+			~packed_bit_writer()
+			{
+				ACL_ASSERT(m_num_pending_bits == 0, "Writer has not been flushed");
+			}
+
+			//////////////////////////////////////////////////////////////////////////
+			// Returns the number of bits written so far, including those not flushed yet.
+			uint64_t get_num_bits_written() const { return m_num_bits_written; }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Writes the 'num_bits' least significant bits of 'value', up to 64 bits.
+			RTM_FORCE_INLINE void write(uint64_t value, uint32_t num_bits)
+			{
+				ACL_ASSERT(num_bits <= 64, "Cannot write more than 64 bits at once");
+
+				if (num_bits == 0)
+					return;	// Nothing to write
+
+				const uint64_t bits = num_bits == 64 ? value : (value & ((uint64_t(1) << num_bits) - 1));
+				const uint32_t num_free_bits = 64 - m_num_pending_bits;
+
+				if (num_bits < num_free_bits)
+				{
+					m_accumulator |= bits << (num_free_bits - num_bits);
+					m_num_pending_bits += num_bits;
+				}
+				else
+				{
+					// Our accumulator is full, write it out and retain what doesn't fit
+					const uint32_t num_overflow_bits = num_bits - num_free_bits;
+					m_accumulator |= bits >> num_overflow_bits;
+
+					unaligned_write(byte_swap(m_accumulator), m_buffer);
+					m_buffer += sizeof(uint64_t);
+
+					m_accumulator = num_overflow_bits != 0 ? (bits << (64 - num_overflow_bits)) : 0;
+					m_num_pending_bits = num_overflow_bits;
+				}
+
+				m_num_bits_written += num_bits;
+			}
+
+			//////////////////////////////////////////////////////////////////////////
+			// Writes 'num_bits' from a buffer of packed bits, most significant bit first.
+			// Only the bytes that contain the bits are read.
+			RTM_FORCE_INLINE void write_packed(const uint8_t* packed_bits, uint32_t num_bits)
+			{
+				while (num_bits >= 64)
+				{
+					write(byte_swap(unaligned_load<uint64_t>(packed_bits)), 64);
+					packed_bits += sizeof(uint64_t);
+					num_bits -= 64;
+				}
+
+				if (num_bits != 0)
+				{
+					uint64_t word = 0;
+					std::memcpy(&word, packed_bits, (num_bits + 7) / 8);
+					write(byte_swap(word) >> (64 - num_bits), num_bits);
+				}
+			}
+
+			//////////////////////////////////////////////////////////////////////////
+			// Writes the remaining bits, the last byte is padded with zeroes.
+			// Must be called once everything has been written.
+			void flush()
+			{
+				const uint32_t num_pending_bytes = (m_num_pending_bits + 7) / 8;
+				const uint64_t word = byte_swap(m_accumulator);
+				std::memcpy(m_buffer, &word, num_pending_bytes);
+
+				m_buffer += num_pending_bytes;
+				m_accumulator = 0;
+				m_num_pending_bits = 0;
+			}
+
+		private:
+			packed_bit_writer(const packed_bit_writer&) = delete;
+			packed_bit_writer& operator=(const packed_bit_writer&) = delete;
+
+			uint8_t*	m_buffer;				// Where the next word is written
+			uint64_t	m_accumulator;			// Pending bits, most significant first
+			uint32_t	m_num_pending_bits;		// Always less than 64
+			uint64_t	m_num_bits_written;
+		};
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,135 @@
+// Included only once from prepared_clip_context.h
+
+#include "acl/version.h"
+#include "acl/core/additive_utils.h"
+#include "acl/core/error_result.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/track_formats.h"
+#include "acl/compression/additive_base_context.h"
+#include "acl/compression/compression_settings.h"
+#include "acl/compression/track_array.h"
+#include "acl/compression/impl/clip_context.h"
+#include "acl/compression/impl/reduce_sample_rate.h"
+#include "acl/compression/impl/rigid_shell_utils.h"
+
+#include <cstdint>
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	inline prepared_clip_context::prepared_clip_context()
+		: m_allocator(nullptr)
+		, m_track_list(nullptr)
+		, m_additive_base(nullptr)
+		, m_error_metric(nullptr)
+		, m_enable_sample_rate_reduction(false)
+		, m_reduced_track_list()
+		, m_clip_contexts()
+		, m_clip_shell_metadata{ nullptr, nullptr }
+	{
+	}
+
+	inline prepared_clip_context::~prepared_clip_context()
+	{
+		reset();
+	}
+
+	inline error_result prepared_clip_context::initialize(iallocator& allocator, const track_array_qvvf& track_list, const compression_settings& settings)
+	{
+		return initialize_impl(allocator, track_list, settings, nullptr);
+	}
+
+	inline error_result prepared_clip_context::initialize(iallocator& allocator, const track_array_qvvf& track_list, const compression_settings& settings, const additive_base_context& additive_base)
+	{
+		if (!additive_base.is_initialized())
+			return error_result("Additive base context isn't initialized");
+
+		if (additive_base.get_error_metric() != settings.error_metric)
+			return error_result("Additive base context was prepared with a different error metric");
+
+		if (additive_base.get_track_list()->get_num_tracks() != track_list.get_num_tracks())
+			return error_result("Additive base doesn't have the same number of transforms");
+
+		return initialize_impl(allocator, track_list, settings, &additive_base);
+	}
+
+	inline error_result prepared_clip_context::initialize_impl(iallocator& allocator, const track_array_qvvf& track_list, const compression_settings& settings, const additive_base_context* additive_base)
+	{
+		reset();
+
+		error_result result = track_list.is_valid();
+		if (result.any())
+			return result;
+
+		if (settings.error_metric == nullptr)
+			return error_result("An error metric is required");
+
+		const additive_clip_format8 additive_format = additive_base != nullptr ? additive_base->get_additive_format() : additive_clip_format8::none;
+
+		// Lower the sample rate if the motion allows it, exactly like compression does
+		if (settings.enable_sample_rate_reduction)
+		{
+			const track_array_qvvf* error_base_track_list = additive_base != nullptr ? additive_base->get_track_list() : nullptr;
+			const uint32_t sample_rate_reduction_factor = acl_impl::find_sample_rate_reduction_factor(allocator, track_list, settings, error_base_track_list);
+			if (sample_rate_reduction_factor > 1)
+				m_reduced_track_list = acl_impl::make_reduced_sample_rate_track_list(allocator, track_list, sample_rate_reduction_factor);
+		}
+
+		const track_array_qvvf& prepared_track_list = m_reduced_track_list.is_empty() ? track_list : m_reduced_track_list;
+		const acl_impl::clip_context empty_additive_base_clip_context;
+		const acl_impl::clip_context& additive_base_clip_context = additive_base != nullptr ? additive_base->get_clip_context() : empty_additive_base_clip_context;
+
+		// Full precision rotations retain their original value when already normalized, other formats always normalize
+		// Only the rotation format changes how clip contexts are initialized, we prepare both variants
+		for (uint32_t format_index = 0; format_index < 2; ++format_index)
+		{
+			compression_settings format_settings = settings;
+			format_settings.rotation_format = format_index != 0 ? rotation_format8::quatf_full : rotation_format8::quatf_drop_w_variable;
+
+			acl_impl::clip_context& clip = m_clip_contexts[format_index];
+			if (!acl_impl::initialize_clip_context(allocator, prepared_track_list, format_settings, additive_format, clip, true))
+			{
+				// Clears what we allocated so far
+				m_allocator = &allocator;
+				reset();
+				return error_result("Some samples are not finite");
+			}
+
+			m_clip_shell_metadata[format_index] = acl_impl::compute_clip_shell_distances(allocator, clip, additive_base_clip_context);
+			clip.clip_shell_metadata = m_clip_shell_metadata[format_index];
+		}
+
+		m_allocator = &allocator;
+		m_track_list = &track_list;
+		m_additive_base = additive_base;
+		m_error_metric = settings.error_metric;
+		m_enable_sample_rate_reduction = settings.enable_sample_rate_reduction;
+
+		return error_result();
+	}
+
+	inline void prepared_clip_context::reset()
+	{
+		if (m_allocator == nullptr)
+			return;	// Not initialized
+
+		for (uint32_t format_index = 0; format_index < 2; ++format_index)
+		{
+			deallocate_type_array(*m_allocator, m_clip_shell_metadata[format_index], m_clip_contexts[format_index].num_bones);
+			acl_impl::destroy_clip_context(m_clip_contexts[format_index]);
+
+			m_clip_shell_metadata[format_index] = nullptr;
+			m_clip_contexts[format_index] = acl_impl::clip_context();
+		}
+
+		m_allocator = nullptr;
+		m_track_list = nullptr;
+		m_additive_base = nullptr;
+		m_error_metric = nullptr;
+		m_enable_sample_rate_reduction = false;
+		m_reduced_track_list = track_array_qvvf();
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
@@ -33,9 +33,14 @@
 #include "acl/core/impl/variable_bit_rates.h"
 #include "acl/math/quat_packing.h"
 #include "acl/math/vector4_packing.h"
+#include "acl/compression/impl/bit_rate_error_cache.h"
+#include "acl/compression/impl/object_transform_cache.h"
+#include "acl/compression/impl/bit_rate_hint.h"
 #include "acl/compression/impl/track_bit_rate_database.h"
 #include "acl/compression/impl/transform_bit_rate_permutations.h"
 #include "acl/compression/impl/clip_context.h"
+#include "acl/compression/impl/compression_profiler.h"
+#include "acl/compression/impl/compression_progress.h"
 #include "acl/compression/impl/sample_streams.h"
 #include "acl/compression/impl/normalize_streams.h"
 #include "acl/compression/impl/convert_rotation_streams.h"
@@ -50,8 +55,11 @@
 #include <sjson/writer.h>
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <functional>
 
 #define ACL_IMPL_DEBUG_LEVEL_NONE					0
@@ -81,6 +89,16 @@ namespace acl
 
 	namespace acl_impl
 	{
+		// How many samples we measure the error of at once, unless the error metric prefers larger batches
+		constexpr uint32_t k_num_error_batch_samples = 4;
+
+		// When proxy error rejection is enabled, we first measure the error of one in every this many samples
+		constexpr uint32_t k_proxy_error_sample_stride = 4;
+
+		// Segments are searched in runs, every segment within a run starts from the bit rates of the previous one.
+		// Runs have a fixed length and jobs quantize whole runs for the output to remain identical with or without them.
+		constexpr uint32_t k_num_segments_per_seed_run = 8;
+
 		struct quantization_context
 		{
 			iallocator& allocator;
@@ -92,11 +110,14 @@ namespace acl
 			const transform_metadata* metadata;
 			uint32_t num_bones;
 			const itransform_error_metric* error_metric;
+			const compression_progress* progress;
 
 			track_bit_rate_database bit_rate_database;
 			single_track_query local_query;
 			every_track_query all_local_query;
 			hierarchical_track_query object_query;
+			bit_rate_error_cache object_error_cache;
+			object_transform_cache lossy_object_cache;
 
 			uint32_t num_samples;					// Num samples within our segment
 			uint32_t segment_sample_start_index;
@@ -110,6 +131,8 @@ namespace acl
 			vector_format8 translation_format;
 			vector_format8 scale_format;
 			compression_level8 compression_level;
+			bit_rate_search_strategy8 bit_rate_search_strategy;
+			bool enable_proxy_error_rejection;
 
 			const transform_streams* raw_bone_streams;
 
@@ -129,6 +152,9 @@ namespace acl
 
 			uint8_t* local_transforms_converted;	// 1 per transform
 			uint8_t* lossy_object_pose;				// 1 per transform
+			uint8_t* lossy_object_transforms_batch;	// 1 per sample in an error batch, local or object space
+			float* batch_errors;					// 1 per sample in an error batch
+			uint32_t num_error_batch_samples;		// Max number of samples in an error batch
 			size_t metric_transform_size;
 
 			transform_bit_rates* bit_rate_per_bone;			// 1 per transform
@@ -137,7 +163,18 @@ namespace acl
 
 			uint32_t* chain_bone_indices;			// 1 per transform
 			uint32_t num_bones_in_chain;
-			uint32_t padding1 = 0;					// unused
+			uint32_t num_permutation_workers;
+
+			uint32_t bit_rate_search_budget;		// Max number of permutations to evaluate per segment, 0 if unlimited
+			uint32_t num_evaluated_permutations;	// Number of permutations evaluated in the current segment
+
+			const bit_rate_hint* warm_start_hint;	// Optional previous bit rates to start the search from
+
+			transform_bit_rates* previous_segment_bit_rates;	// 1 per transform, the bit rates found for the last segment we searched
+			uint32_t previous_segment_index;		// Index of the last segment we searched, ~0 if none
+
+			const compression_job_scheduler* permutation_job_scheduler;	// Set when searching bone chain permutations in parallel
+			quantization_context* permutation_workers;	// 1 per permutation worker
 
 			quantization_context(iallocator& allocator_, clip_context& clip_, const clip_context& raw_clip_, const clip_context& additive_base_clip_, const compression_settings& settings_)
 				: allocator(allocator_)
@@ -149,10 +186,13 @@ namespace acl
 				, metadata(clip_.metadata)
 				, num_bones(clip_.num_bones)
 				, error_metric(settings_.error_metric)
-				, bit_rate_database(allocator_, settings_.rotation_format, settings_.translation_format, settings_.scale_format, clip_.segments->bone_streams, raw_clip_.segments->bone_streams, clip_.num_bones, clip_.segments->num_samples)
+				, progress(&settings_.progress)
+				, bit_rate_database(allocator_, settings_.rotation_format, settings_.translation_format, settings_.scale_format, clip_.segments->bone_streams, raw_clip_.segments->bone_streams, clip_.num_bones, clip_.segments->num_samples, settings_.bit_rate_database_max_size)
 				, local_query()
 				, all_local_query(allocator_)
 				, object_query(allocator_)
+				, object_error_cache(allocator_, clip_)
+				, lossy_object_cache(allocator_, clip_, settings_.error_metric->get_transform_size(clip_.has_scale))
 				, num_samples(~0U)
 				, segment_sample_start_index(~0U)
 				, sample_rate(clip_.sample_rate)
@@ -163,10 +203,19 @@ namespace acl
 				, translation_format(settings_.translation_format)
 				, scale_format(settings_.scale_format)
 				, compression_level(settings_.level)
+				, bit_rate_search_strategy(settings_.bit_rate_search_strategy)
+				, enable_proxy_error_rejection(settings_.enable_proxy_error_rejection)
 				, raw_bone_streams(raw_clip_.segments[0].bone_streams)
 				, lossy_transforms_start(nullptr)
 				, lossy_transforms_end(nullptr)
 				, num_bones_in_chain(0)
+				, num_permutation_workers(0)
+				, bit_rate_search_budget(settings_.bit_rate_search_budget)
+				, num_evaluated_permutations(0)
+				, warm_start_hint(nullptr)
+				, previous_segment_index(~0U)
+				, permutation_job_scheduler(nullptr)
+				, permutation_workers(nullptr)
 			{
 				local_query.bind(bit_rate_database);
 				object_query.bind(bit_rate_database);
@@ -185,7 +234,14 @@ namespace acl
 				base_object_transforms = clip_.has_additive_base ? allocate_type_array_aligned<uint8_t>(allocator, metric_transform_size_ * num_bones * clip_.segments->num_samples, 64) : nullptr;
 				local_transforms_converted = needs_conversion ? allocate_type_array_aligned<uint8_t>(allocator, metric_transform_size_ * num_bones, 64) : nullptr;
 				lossy_object_pose = allocate_type_array_aligned<uint8_t>(allocator, metric_transform_size_ * num_bones, 64);
+
+				// Error metrics that offload their work can request larger batches, there is no point exceeding our segment size
+				num_error_batch_samples = std::max<uint32_t>(std::min<uint32_t>(settings_.error_metric->get_max_error_batch_size(), clip_.segments->num_samples), k_num_error_batch_samples);
+				lossy_object_transforms_batch = allocate_type_array_aligned<uint8_t>(allocator, metric_transform_size_ * num_error_batch_samples, 64);
+				batch_errors = allocate_type_array<float>(allocator, num_error_batch_samples);
+
 				bit_rate_per_bone = allocate_type_array<transform_bit_rates>(allocator, num_bones);
+				previous_segment_bit_rates = allocate_type_array<transform_bit_rates>(allocator, num_bones);
 				parent_transform_indices = allocate_type_array<uint32_t>(allocator, num_bones);
 				self_transform_indices = allocate_type_array<uint32_t>(allocator, num_bones);
 				chain_bone_indices = allocate_type_array<uint32_t>(allocator, num_bones);
@@ -212,7 +268,10 @@ namespace acl
 				deallocate_type_array(allocator, base_object_transforms, metric_transform_size * num_bones * clip.segments->num_samples);
 				deallocate_type_array(allocator, local_transforms_converted, metric_transform_size * num_bones);
 				deallocate_type_array(allocator, lossy_object_pose, metric_transform_size * num_bones);
+				deallocate_type_array(allocator, lossy_object_transforms_batch, metric_transform_size * num_error_batch_samples);
+				deallocate_type_array(allocator, batch_errors, num_error_batch_samples);
 				deallocate_type_array(allocator, bit_rate_per_bone, num_bones);
+				deallocate_type_array(allocator, previous_segment_bit_rates, num_bones);
 				deallocate_type_array(allocator, parent_transform_indices, num_bones);
 				deallocate_type_array(allocator, self_transform_indices, num_bones);
 				deallocate_type_array(allocator, chain_bone_indices, num_bones);
@@ -225,6 +284,9 @@ namespace acl
 				num_samples = segment_.num_samples;
 				segment_sample_start_index = segment_.clip_sample_offset;
 				bit_rate_database.set_segment(segment_.bone_streams, segment_.num_bones, segment_.num_samples);
+				object_error_cache.reset();
+				lossy_object_cache.reset();
+				num_evaluated_permutations = 0;
 
 				// Update our shell distances
 				compute_segment_shell_distances(segment_, additive_base_clip, shell_metadata_per_transform);
@@ -286,18 +348,28 @@ namespace acl
 					{
 						const float normalized_sample_time = additive_base_clip.num_samples > 1 ? (sample_time / clip_duration) : 0.0F;
 						const float additive_sample_time = additive_base_clip.num_samples > 1 ? (normalized_sample_time * additive_base_clip.duration) : 0.0F;
-						sample_streams(additive_base_clip.segments[0].bone_streams, num_bones, additive_sample_time, additive_local_pose);
-
 						uint8_t* sample_base_local_transforms = base_local_transforms + (sample_index * sample_transform_size);
 
-						if (needs_conversion)
+						const uint8_t* converted_base_transforms = additive_base_clip.converted_base_transforms[has_scale ? 1 : 0];
+						if (converted_base_transforms != nullptr)
+						{
+							// The base was sampled and converted once for every clip that shares it
+							const uint32_t base_sample_index = get_uniform_sample_key(additive_base_clip.segments[0], additive_sample_time);
+							std::memcpy(sample_base_local_transforms, converted_base_transforms + (base_sample_index * sample_transform_size), sample_transform_size);
+						}
+						else if (needs_conversion)
 						{
+							sample_streams(additive_base_clip.segments[0].bone_streams, num_bones, additive_sample_time, additive_local_pose);
+
 							const uint32_t nearest_base_sample_index = static_cast<uint32_t>(rtm::scalar_round_bankers(normalized_sample_time * additive_base_clip.num_samples));
 							convert_transforms_args_base.sample_index = nearest_base_sample_index;
 							convert_transforms_impl(error_metric_, convert_transforms_args_base, sample_base_local_transforms);
 						}
 						else
+						{
+							sample_streams(additive_base_clip.segments[0].bone_streams, num_bones, additive_sample_time, additive_local_pose);
 							std::memcpy(sample_base_local_transforms, additive_local_pose, sample_transform_size);
+						}
 
 						apply_additive_to_base_args_raw.local_transforms = sample_raw_local_transforms;
 						apply_additive_to_base_args_raw.base_transforms = sample_base_local_transforms;
@@ -311,8 +383,40 @@ namespace acl
 				}
 			}
 
+			// Shares the segment state of another context, used by the permutation workers
+			// to avoid recomputing the raw transforms
+			void set_segment(const quantization_context& source)
+			{
+				ACL_ASSERT(source.is_valid(), "Source quantization_context isn't valid");
+
+				segment = source.segment;
+				bone_streams = source.bone_streams;
+				num_samples = source.num_samples;
+				segment_sample_start_index = source.segment_sample_start_index;
+				bit_rate_database.set_segment(segment->bone_streams, segment->num_bones, segment->num_samples);
+				object_error_cache.reset();
+				lossy_object_cache.reset();
+
+				const size_t segment_transforms_size = metric_transform_size * num_bones * num_samples;
+				std::memcpy(shell_metadata_per_transform, source.shell_metadata_per_transform, sizeof(rigid_shell_metadata_t) * num_bones);
+				std::memcpy(raw_local_transforms, source.raw_local_transforms, segment_transforms_size);
+				std::memcpy(raw_object_transforms, source.raw_object_transforms, segment_transforms_size);
+
+				if (has_additive_base)
+					std::memcpy(base_local_transforms, source.base_local_transforms, segment_transforms_size);
+			}
+
 			bool is_valid() const { return segment != nullptr; }
 
+			// Returns how many more permutations we can evaluate in the current segment
+			uint32_t get_remaining_search_budget() const
+			{
+				if (bit_rate_search_budget == 0)
+					return ~0U;	// Unlimited
+
+				return bit_rate_search_budget > num_evaluated_permutations ? (bit_rate_search_budget - num_evaluated_permutations) : 0;
+			}
+
 			quantization_context(const quantization_context&) = delete;
 			quantization_context(quantization_context&&) = delete;
 			quantization_context& operator=(const quantization_context&) = delete;
@@ -376,6 +480,8 @@ namespace acl
 			const uint32_t num_samples = is_constant_bit_rate(bit_rate) ? 1 : lossy_rotations.get_num_samples();
 			const uint32_t sample_size = sizeof(uint64_t) * 2;
 			const float sample_rate = lossy_rotations.get_sample_rate();
+			// When the largest component is dropped, our samples are already swizzled and we store them like we would with W dropped
+			// The same is true when our samples are a quaternion logarithm
 			rotation_track_stream quantized_stream(context.allocator, num_samples, sample_size, sample_rate, rotation_format8::quatf_drop_w_variable, bit_rate);
 
 			if (is_constant_bit_rate(bit_rate))
@@ -402,6 +508,11 @@ namespace acl
 					{
 						rtm::vector4f rotation = raw_rotations.get_raw_sample<rtm::vector4f>(context.segment_sample_start_index + sample_index);
 						rotation = convert_rotation(rotation, rotation_format8::quatf_full, rotation_format8::quatf_drop_w_variable);
+						rotation = swizzle_dropped_component(rotation, lossy_track.rotation_dropped_component);
+
+						if (lossy_track.is_rotation_log)
+							rotation = quat_to_log(rtm::vector_to_quat(rotation));
+
 						pack_vector3_96(rotation, quantized_ptr);
 					}
 					else
@@ -457,6 +568,7 @@ namespace acl
 					pack_vector3_96(translation, quantized_ptr);
 					break;
 				case vector_format8::vector3f_variable:
+				case vector_format8::vector3f_variable_per_component:
 				default:
 					ACL_ASSERT(false, "Invalid or unsupported vector format: %s", get_vector_format_name(translation_format));
 					break;
@@ -512,6 +624,14 @@ namespace acl
 			{
 				const uint32_t num_bits_at_bit_rate = get_num_bits_at_bit_rate(bit_rate);
 
+				// Components with a smaller range can use fewer bits, see calculate_component_bit_rate_reductions(..)
+				const uint8_t* bit_rate_reductions = lossy_track.translation_bit_rate_reductions;
+				const bool is_uniform = is_vector3_uniform(bit_rate_reductions);
+				const bool are_components_variable = (bit_rate_reductions[0] | bit_rate_reductions[1] | bit_rate_reductions[2]) != 0;
+				const uint32_t num_bits_x = get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[0]);
+				const uint32_t num_bits_y = get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[1]);
+				const uint32_t num_bits_z = get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[2]);
+
 				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
 				{
 					uint8_t* quantized_ptr = quantized_stream.get_raw_sample_ptr(sample_index);
@@ -524,7 +644,13 @@ namespace acl
 					else
 					{
 						const rtm::vector4f translation = lossy_translations.get_raw_sample<rtm::vector4f>(sample_index);
-						pack_vector3_uXX_unsafe(translation, num_bits_at_bit_rate, quantized_ptr);
+
+						if (is_uniform)
+							pack_vector3_uniform_uXX_unsafe(translation, num_bits_at_bit_rate, quantized_ptr);
+						else if (are_components_variable)
+							pack_vector3_uXYZ_unsafe(translation, num_bits_x, num_bits_y, num_bits_z, quantized_ptr);
+						else
+							pack_vector3_uXX_unsafe(translation, num_bits_at_bit_rate, quantized_ptr);
 					}
 				}
 			}
@@ -573,6 +699,7 @@ namespace acl
 					pack_vector3_96(scale, quantized_ptr);
 					break;
 				case vector_format8::vector3f_variable:
+				case vector_format8::vector3f_variable_per_component:
 				default:
 					ACL_ASSERT(false, "Invalid or unsupported vector format: %s", get_vector_format_name(scale_format));
 					break;
@@ -628,6 +755,14 @@ namespace acl
 			{
 				const uint32_t num_bits_at_bit_rate = get_num_bits_at_bit_rate(bit_rate);
 
+				// Components with a smaller range can use fewer bits, see calculate_component_bit_rate_reductions(..)
+				const uint8_t* bit_rate_reductions = lossy_track.scale_bit_rate_reductions;
+				const bool is_uniform = is_vector3_uniform(bit_rate_reductions);
+				const bool are_components_variable = (bit_rate_reductions[0] | bit_rate_reductions[1] | bit_rate_reductions[2]) != 0;
+				const uint32_t num_bits_x = get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[0]);
+				const uint32_t num_bits_y = get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[1]);
+				const uint32_t num_bits_z = get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[2]);
+
 				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
 				{
 					uint8_t* quantized_ptr = quantized_stream.get_raw_sample_ptr(sample_index);
@@ -640,7 +775,13 @@ namespace acl
 					else
 					{
 						const rtm::vector4f scale = lossy_scales.get_raw_sample<rtm::vector4f>(sample_index);
-						pack_vector3_uXX_unsafe(scale, num_bits_at_bit_rate, quantized_ptr);
+
+						if (is_uniform)
+							pack_vector3_uniform_uXX_unsafe(scale, num_bits_at_bit_rate, quantized_ptr);
+						else if (are_components_variable)
+							pack_vector3_uXYZ_unsafe(scale, num_bits_x, num_bits_y, num_bits_z, quantized_ptr);
+						else
+							pack_vector3_uXX_unsafe(scale, num_bits_at_bit_rate, quantized_ptr);
 					}
 				}
 			}
@@ -682,7 +823,6 @@ namespace acl
 
 			const auto convert_transforms_impl = std::mem_fn(context.has_scale ? &itransform_error_metric::convert_transforms : &itransform_error_metric::convert_transforms_no_scale);
 			const auto apply_additive_to_base_impl = std::mem_fn(context.has_scale ? &itransform_error_metric::apply_additive_to_base : &itransform_error_metric::apply_additive_to_base_no_scale);
-			const auto calculate_error_impl = std::mem_fn(context.has_scale ? &itransform_error_metric::calculate_error : &itransform_error_metric::calculate_error_no_scale);
 
 			itransform_error_metric::convert_transforms_args convert_transforms_args_lossy;
 			convert_transforms_args_lossy.dirty_transform_indices = &target_bone_index;
@@ -700,20 +840,32 @@ namespace acl
 			apply_additive_to_base_args_lossy.base_transforms = nullptr;
 			apply_additive_to_base_args_lossy.num_transforms = num_transforms;
 
-			itransform_error_metric::calculate_error_args calculate_error_args;
-			calculate_error_args.transform0 = nullptr;
-			calculate_error_args.transform1 = needs_conversion ? (const void*)(context.local_transforms_converted + (context.metric_transform_size * target_bone_index)) : (const void*)(context.lossy_local_pose + target_bone_index);
+			const size_t metric_transform_size = context.metric_transform_size;
+			const uint8_t* lossy_transform = needs_conversion ? (context.local_transforms_converted + (metric_transform_size * target_bone_index)) : reinterpret_cast<const uint8_t*>(context.lossy_local_pose + target_bone_index);
 
 			const rigid_shell_metadata_t& transform_shell = context.shell_metadata_per_transform[target_bone_index];
-			const rtm::scalarf error_threshold = rtm::scalar_set(transform_shell.precision);
+			const float error_threshold = transform_shell.precision;
 
-			const uint8_t* raw_transform = context.raw_local_transforms + (target_bone_index * context.metric_transform_size);
+			// Like the object space scan, we measure the error of several samples at once, the lossy
+			// transforms of the batch are copied contiguously and the raw transforms are read in place
+			const uint8_t* raw_transform = context.raw_local_transforms + (target_bone_index * metric_transform_size);
 			const uint8_t* base_transforms = context.base_local_transforms;
 
+			itransform_error_metric::calculate_error_batch_args calculate_error_args;
+			calculate_error_args.construct_sphere_shell(transform_shell.local_shell_distance);
+			calculate_error_args.transforms0 = raw_transform;
+			calculate_error_args.transforms0_stride = sample_transform_size;
+			calculate_error_args.transforms1 = context.lossy_object_transforms_batch;
+			calculate_error_args.transforms1_stride = metric_transform_size;
+
+			float* batch_errors = context.batch_errors;
+			const uint32_t num_error_batch_samples = context.num_error_batch_samples;
+			uint32_t num_batch_samples = 0;
+
 			context.local_query.build(target_bone_index, context.bit_rate_per_bone[target_bone_index]);
 
 			float sample_indexf = float(context.segment_sample_start_index);
-			rtm::scalarf max_error = rtm::scalar_set(0.0F);
+			float max_error = 0.0F;
 
 			for (uint32_t sample_index = 0; sample_index < context.num_samples; ++sample_index)
 			{
@@ -740,46 +892,77 @@ namespace acl
 					apply_additive_to_base_impl(error_metric, apply_additive_to_base_args_lossy, context.lossy_local_pose);
 				}
 
-				calculate_error_args.construct_sphere_shell(transform_shell.local_shell_distance);
-				calculate_error_args.transform0 = raw_transform;
-				raw_transform += sample_transform_size;
+				std::memcpy(context.lossy_object_transforms_batch + (num_batch_samples * metric_transform_size), lossy_transform, metric_transform_size);
+				num_batch_samples++;
 
-#if defined(RTM_COMPILER_MSVC) && defined(RTM_ARCH_X86) && RTM_COMPILER_MSVC == RTM_COMPILER_MSVC_2015
-				// VS2015 fails to generate the right x86 assembly, branch instead
-				(void)calculate_error_impl;
-				const rtm::scalarf error = context.has_scale ? error_metric->calculate_error(calculate_error_args) : error_metric->calculate_error_no_scale(calculate_error_args);
-#else
-				const rtm::scalarf error = calculate_error_impl(error_metric, calculate_error_args);
-#endif
+				sample_indexf += 1.0F;
 
-				max_error = rtm::scalar_max(max_error, error);
-				if (stop_condition == error_scan_stop_condition::until_error_too_high && rtm::scalar_greater_equal(error, error_threshold))
-					break;
+				const bool is_last_sample = sample_index + 1 == context.num_samples;
+				if (num_batch_samples < num_error_batch_samples && !is_last_sample)
+					continue;	// Keep filling our batch
 
-				sample_indexf += 1.0F;
+				if (context.has_scale)
+					error_metric->calculate_error_batch(calculate_error_args, num_batch_samples, &batch_errors[0]);
+				else
+					error_metric->calculate_error_batch_no_scale(calculate_error_args, num_batch_samples, &batch_errors[0]);
+
+				raw_transform += num_batch_samples * sample_transform_size;
+				calculate_error_args.transforms0 = raw_transform;
+
+				// Process the errors in sample order, samples past the first one with a high error are ignored
+				// to yield the same result as if we had measured them one by one
+				bool is_error_too_high = false;
+				for (uint32_t batch_sample_index = 0; batch_sample_index < num_batch_samples; ++batch_sample_index)
+				{
+					const float error = batch_errors[batch_sample_index];
+					max_error = rtm::scalar_max(max_error, error);
+					if (stop_condition == error_scan_stop_condition::until_error_too_high && error >= error_threshold)
+					{
+						is_error_too_high = true;
+						break;
+					}
+				}
+
+				num_batch_samples = 0;
+
+				if (is_error_too_high)
+					break;
 			}
 
-			return rtm::scalar_cast(max_error);
+			return max_error;
 		}
 
 		inline float calculate_max_error_at_bit_rate_object(quantization_context& context, uint32_t target_bone_index, error_scan_stop_condition stop_condition)
 		{
+			// The bit rate search evaluates the same bit rates many times, skip the scan if we already know the error
+			float cached_error;
+			if (context.object_error_cache.find(target_bone_index, uint32_t(stop_condition), context.bit_rate_per_bone, cached_error))
+				return cached_error;
+
 			const itransform_error_metric* error_metric = context.error_metric;
 			const bool needs_conversion = context.needs_conversion;
 			const bool has_additive_base = context.has_additive_base;
 
-			const size_t sample_transform_size = context.metric_transform_size * context.num_bones;
+			const size_t metric_transform_size = context.metric_transform_size;
+			const size_t sample_transform_size = metric_transform_size * context.num_bones;
 			const float sample_rate = context.sample_rate;
 			const float clip_duration = context.clip_duration;
 
+			// Only the transforms below the first one whose bit rates changed need to be recomputed,
+			// the object space transforms of the parents above it are cached from a previous scan
+			object_transform_cache& lossy_object_cache = context.lossy_object_cache;
+			const uint32_t first_dirty_link = lossy_object_cache.find_first_dirty_link(context.chain_bone_indices, context.num_bones_in_chain, context.bit_rate_per_bone, context.num_samples);
+			const uint32_t* dirty_bone_indices = context.chain_bone_indices + first_dirty_link;
+			const uint32_t num_dirty_bones = context.num_bones_in_chain - first_dirty_link;
+			const uint32_t cached_parent_bone_index = first_dirty_link != 0 ? context.chain_bone_indices[first_dirty_link - 1] : k_invalid_track_index;
+
 			const auto convert_transforms_impl = std::mem_fn(context.has_scale ? &itransform_error_metric::convert_transforms : &itransform_error_metric::convert_transforms_no_scale);
 			const auto apply_additive_to_base_impl = std::mem_fn(context.has_scale ? &itransform_error_metric::apply_additive_to_base : &itransform_error_metric::apply_additive_to_base_no_scale);
 			const auto local_to_object_space_impl = std::mem_fn(context.has_scale ? &itransform_error_metric::local_to_object_space : &itransform_error_metric::local_to_object_space_no_scale);
-			const auto calculate_error_impl = std::mem_fn(context.has_scale ? &itransform_error_metric::calculate_error : &itransform_error_metric::calculate_error_no_scale);
 
 			itransform_error_metric::convert_transforms_args convert_transforms_args_lossy;
-			convert_transforms_args_lossy.dirty_transform_indices = context.chain_bone_indices;
-			convert_transforms_args_lossy.num_dirty_transforms = context.num_bones_in_chain;
+			convert_transforms_args_lossy.dirty_transform_indices = dirty_bone_indices;
+			convert_transforms_args_lossy.num_dirty_transforms = num_dirty_bones;
 			convert_transforms_args_lossy.transforms = context.lossy_local_pose;
 			convert_transforms_args_lossy.num_transforms = context.num_bones;
 			convert_transforms_args_lossy.sample_index = 0;
@@ -787,38 +970,212 @@ namespace acl
 			convert_transforms_args_lossy.is_additive_base = false;
 
 			itransform_error_metric::apply_additive_to_base_args apply_additive_to_base_args_lossy;
-			apply_additive_to_base_args_lossy.dirty_transform_indices = context.chain_bone_indices;
-			apply_additive_to_base_args_lossy.num_dirty_transforms = context.num_bones_in_chain;
+			apply_additive_to_base_args_lossy.dirty_transform_indices = dirty_bone_indices;
+			apply_additive_to_base_args_lossy.num_dirty_transforms = num_dirty_bones;
 			apply_additive_to_base_args_lossy.local_transforms = needs_conversion ? (const void*)(context.local_transforms_converted) : (const void*)context.lossy_local_pose;
 			apply_additive_to_base_args_lossy.base_transforms = nullptr;
 			apply_additive_to_base_args_lossy.num_transforms = context.num_bones;
 
 			itransform_error_metric::local_to_object_space_args local_to_object_space_args_lossy;
-			local_to_object_space_args_lossy.dirty_transform_indices = context.chain_bone_indices;
-			local_to_object_space_args_lossy.num_dirty_transforms = context.num_bones_in_chain;
+			local_to_object_space_args_lossy.dirty_transform_indices = dirty_bone_indices;
+			local_to_object_space_args_lossy.num_dirty_transforms = num_dirty_bones;
 			local_to_object_space_args_lossy.parent_transform_indices = context.parent_transform_indices;
 			local_to_object_space_args_lossy.local_transforms = needs_conversion ? (const void*)(context.local_transforms_converted) : (const void*)context.lossy_local_pose;
 			local_to_object_space_args_lossy.num_transforms = context.num_bones;
 
-			itransform_error_metric::calculate_error_args calculate_error_args;
-			calculate_error_args.transform0 = nullptr;
-			calculate_error_args.transform1 = context.lossy_object_pose + (target_bone_index * context.metric_transform_size);
-
 			const rigid_shell_metadata_t& transform_shell = context.shell_metadata_per_transform[target_bone_index];
-			const rtm::scalarf error_threshold = rtm::scalar_set(transform_shell.precision);
+			const float error_threshold = transform_shell.precision;
 
-			const uint8_t* raw_transform = context.raw_object_transforms + (target_bone_index * context.metric_transform_size);
-			const uint8_t* base_transforms = context.base_local_transforms;
+			// We measure the error of several samples at once, the lossy object transforms of the batch
+			// are copied contiguously and the raw transforms are read in place
+			const uint8_t* raw_transform = context.raw_object_transforms + (target_bone_index * metric_transform_size);
+			const uint8_t* lossy_object_transform = context.lossy_object_pose + (target_bone_index * metric_transform_size);
 
-			context.object_query.build(target_bone_index, context.bit_rate_per_bone, context.bone_streams);
+			itransform_error_metric::calculate_error_batch_args calculate_error_args;
+			calculate_error_args.construct_sphere_shell(transform_shell.local_shell_distance);
+			calculate_error_args.transforms0 = raw_transform;
+			calculate_error_args.transforms0_stride = sample_transform_size;
+			calculate_error_args.transforms1 = context.lossy_object_transforms_batch;
+			calculate_error_args.transforms1_stride = metric_transform_size;
+
+			float* batch_errors = context.batch_errors;
+			const uint32_t num_error_batch_samples = context.num_error_batch_samples;
+			uint32_t num_batch_samples = 0;
+
+			if (num_dirty_bones != 0)
+				context.object_query.build(target_bone_index, context.bit_rate_per_bone, context.bone_streams);
 
 			float sample_indexf = float(context.segment_sample_start_index);
-			rtm::scalarf max_error = rtm::scalar_set(0.0F);
+			float max_error = 0.0F;
+			uint32_t num_scanned_samples = 0;
 
 			for (uint32_t sample_index = 0; sample_index < context.num_samples; ++sample_index)
 			{
-				// Sample our streams and calculate the error
+				uint8_t* lossy_object_transform_batch = context.lossy_object_transforms_batch + (num_batch_samples * metric_transform_size);
+
+				if (num_dirty_bones != 0)
+				{
+					// Sample our streams and calculate the error
+					// The sample time is calculated from the full clip duration to be consistent with decompression
+					const float sample_time = rtm::scalar_min(sample_indexf / sample_rate, clip_duration);
+
+					context.bit_rate_database.sample(context.object_query, sample_time, context.lossy_local_pose, context.num_bones);
+
+					if (needs_conversion)
+					{
+						convert_transforms_args_lossy.sample_index = sample_index;
+						convert_transforms_impl(error_metric, convert_transforms_args_lossy, context.local_transforms_converted);
+					}
+
+					if (has_additive_base)
+					{
+						apply_additive_to_base_args_lossy.base_transforms = context.base_local_transforms + (sample_index * sample_transform_size);
+
+						// TODO: Is this accurate if we have conversion? Our input is in the converted array for base/local
+						//       and we write to the local qvvf buffer? The calculate error below will read from the converted array
+						//       if we are converted.
+						apply_additive_to_base_impl(error_metric, apply_additive_to_base_args_lossy, context.lossy_local_pose);
+					}
+
+					if (cached_parent_bone_index != k_invalid_track_index)
+						std::memcpy(context.lossy_object_pose + (cached_parent_bone_index * metric_transform_size), lossy_object_cache.get_transform(sample_index, cached_parent_bone_index), metric_transform_size);
+
+					local_to_object_space_impl(error_metric, local_to_object_space_args_lossy, context.lossy_object_pose);
+
+					for (uint32_t dirty_bone_index = 0; dirty_bone_index < num_dirty_bones; ++dirty_bone_index)
+					{
+						const uint32_t bone_index = dirty_bone_indices[dirty_bone_index];
+						std::memcpy(lossy_object_cache.get_transform(sample_index, bone_index), context.lossy_object_pose + (bone_index * metric_transform_size), metric_transform_size);
+					}
+
+					std::memcpy(lossy_object_transform_batch, lossy_object_transform, metric_transform_size);
+				}
+				else
+				{
+					// Our whole chain is cached
+					std::memcpy(lossy_object_transform_batch, lossy_object_cache.get_transform(sample_index, target_bone_index), metric_transform_size);
+				}
+
+				num_batch_samples++;
+				num_scanned_samples++;
+
+				sample_indexf += 1.0F;
+
+				const bool is_last_sample = sample_index + 1 == context.num_samples;
+				if (num_batch_samples < num_error_batch_samples && !is_last_sample)
+					continue;	// Keep filling our batch
+
+				if (context.has_scale)
+					error_metric->calculate_error_batch(calculate_error_args, num_batch_samples, &batch_errors[0]);
+				else
+					error_metric->calculate_error_batch_no_scale(calculate_error_args, num_batch_samples, &batch_errors[0]);
+
+				raw_transform += num_batch_samples * sample_transform_size;
+				calculate_error_args.transforms0 = raw_transform;
+
+				// Process the errors in sample order, samples past the first one with a high error are ignored
+				// to yield the same result as if we had measured them one by one
+				bool is_error_too_high = false;
+				for (uint32_t batch_sample_index = 0; batch_sample_index < num_batch_samples; ++batch_sample_index)
+				{
+					const float error = batch_errors[batch_sample_index];
+					max_error = rtm::scalar_max(max_error, error);
+					if (stop_condition == error_scan_stop_condition::until_error_too_high && error >= error_threshold)
+					{
+						is_error_too_high = true;
+						break;
+					}
+				}
+
+				num_batch_samples = 0;
+
+				if (is_error_too_high)
+					break;
+			}
+
+			// When we stop early, the transforms we recomputed are only cached for the samples we scanned
+			if (num_dirty_bones != 0)
+				lossy_object_cache.commit(context.chain_bone_indices, first_dirty_link, context.num_bones_in_chain, context.bit_rate_per_bone, num_scanned_samples);
+
+			const float error = max_error;
+			context.object_error_cache.insert(error);
+
+			return error;
+		}
+
+		// Measures the object space error of one in every 'k_proxy_error_sample_stride' samples of the segment
+		// Because it only considers a subset of the samples, the result is a lower bound of the exact error:
+		// if it is too high, the exact error is as well and we can skip measuring it.
+		// The caches are left untouched, every transform in the chain is recomputed for the samples we measure.
+		// Stops as soon as a sample has an error equal to or higher than the transform precision.
+		inline float calculate_proxy_error_at_bit_rate_object(quantization_context& context, uint32_t target_bone_index)
+		{
+			const itransform_error_metric* error_metric = context.error_metric;
+			const bool needs_conversion = context.needs_conversion;
+			const bool has_additive_base = context.has_additive_base;
+
+			const size_t metric_transform_size = context.metric_transform_size;
+			const size_t sample_transform_size = metric_transform_size * context.num_bones;
+			const float sample_rate = context.sample_rate;
+			const float clip_duration = context.clip_duration;
+
+			const uint32_t* dirty_bone_indices = context.chain_bone_indices;
+			const uint32_t num_dirty_bones = context.num_bones_in_chain;
+
+			const auto convert_transforms_impl = std::mem_fn(context.has_scale ? &itransform_error_metric::convert_transforms : &itransform_error_metric::convert_transforms_no_scale);
+			const auto apply_additive_to_base_impl = std::mem_fn(context.has_scale ? &itransform_error_metric::apply_additive_to_base : &itransform_error_metric::apply_additive_to_base_no_scale);
+			const auto local_to_object_space_impl = std::mem_fn(context.has_scale ? &itransform_error_metric::local_to_object_space : &itransform_error_metric::local_to_object_space_no_scale);
+
+			itransform_error_metric::convert_transforms_args convert_transforms_args_lossy;
+			convert_transforms_args_lossy.dirty_transform_indices = dirty_bone_indices;
+			convert_transforms_args_lossy.num_dirty_transforms = num_dirty_bones;
+			convert_transforms_args_lossy.transforms = context.lossy_local_pose;
+			convert_transforms_args_lossy.num_transforms = context.num_bones;
+			convert_transforms_args_lossy.sample_index = 0;
+			convert_transforms_args_lossy.is_lossy = true;
+			convert_transforms_args_lossy.is_additive_base = false;
+
+			itransform_error_metric::apply_additive_to_base_args apply_additive_to_base_args_lossy;
+			apply_additive_to_base_args_lossy.dirty_transform_indices = dirty_bone_indices;
+			apply_additive_to_base_args_lossy.num_dirty_transforms = num_dirty_bones;
+			apply_additive_to_base_args_lossy.local_transforms = needs_conversion ? (const void*)(context.local_transforms_converted) : (const void*)context.lossy_local_pose;
+			apply_additive_to_base_args_lossy.base_transforms = nullptr;
+			apply_additive_to_base_args_lossy.num_transforms = context.num_bones;
+
+			itransform_error_metric::local_to_object_space_args local_to_object_space_args_lossy;
+			local_to_object_space_args_lossy.dirty_transform_indices = dirty_bone_indices;
+			local_to_object_space_args_lossy.num_dirty_transforms = num_dirty_bones;
+			local_to_object_space_args_lossy.parent_transform_indices = context.parent_transform_indices;
+			local_to_object_space_args_lossy.local_transforms = needs_conversion ? (const void*)(context.local_transforms_converted) : (const void*)context.lossy_local_pose;
+			local_to_object_space_args_lossy.num_transforms = context.num_bones;
+
+			const rigid_shell_metadata_t& transform_shell = context.shell_metadata_per_transform[target_bone_index];
+			const float error_threshold = transform_shell.precision;
+
+			// The raw transforms of the samples we measure are read in place with a larger stride
+			const size_t raw_sample_stride = sample_transform_size * k_proxy_error_sample_stride;
+			const uint8_t* raw_transform = context.raw_object_transforms + (target_bone_index * metric_transform_size);
+			const uint8_t* lossy_object_transform = context.lossy_object_pose + (target_bone_index * metric_transform_size);
+
+			itransform_error_metric::calculate_error_batch_args calculate_error_args;
+			calculate_error_args.construct_sphere_shell(transform_shell.local_shell_distance);
+			calculate_error_args.transforms0 = raw_transform;
+			calculate_error_args.transforms0_stride = raw_sample_stride;
+			calculate_error_args.transforms1 = context.lossy_object_transforms_batch;
+			calculate_error_args.transforms1_stride = metric_transform_size;
+
+			float* batch_errors = context.batch_errors;
+			const uint32_t num_error_batch_samples = context.num_error_batch_samples;
+			uint32_t num_batch_samples = 0;
+
+			context.object_query.build(target_bone_index, context.bit_rate_per_bone, context.bone_streams);
+
+			float max_error = 0.0F;
+
+			for (uint32_t sample_index = 0; sample_index < context.num_samples; sample_index += k_proxy_error_sample_stride)
+			{
 				// The sample time is calculated from the full clip duration to be consistent with decompression
+				const float sample_indexf = float(context.segment_sample_start_index + sample_index);
 				const float sample_time = rtm::scalar_min(sample_indexf / sample_rate, clip_duration);
 
 				context.bit_rate_database.sample(context.object_query, sample_time, context.lossy_local_pose, context.num_bones);
@@ -831,37 +1188,105 @@ namespace acl
 
 				if (has_additive_base)
 				{
-					apply_additive_to_base_args_lossy.base_transforms = base_transforms;
-					base_transforms += sample_transform_size;
-
-					// TODO: Is this accurate if we have conversion? Our input is in the converted array for base/local
-					//       and we write to the local qvvf buffer? The calculate error below will read from the converted array
-					//       if we are converted.
+					apply_additive_to_base_args_lossy.base_transforms = context.base_local_transforms + (sample_index * sample_transform_size);
 					apply_additive_to_base_impl(error_metric, apply_additive_to_base_args_lossy, context.lossy_local_pose);
 				}
 
 				local_to_object_space_impl(error_metric, local_to_object_space_args_lossy, context.lossy_object_pose);
 
-				calculate_error_args.construct_sphere_shell(transform_shell.local_shell_distance);
-				calculate_error_args.transform0 = raw_transform;
-				raw_transform += sample_transform_size;
+				std::memcpy(context.lossy_object_transforms_batch + (num_batch_samples * metric_transform_size), lossy_object_transform, metric_transform_size);
+				num_batch_samples++;
 
-#if defined(RTM_COMPILER_MSVC) && defined(RTM_ARCH_X86) && RTM_COMPILER_MSVC == RTM_COMPILER_MSVC_2015
-				// VS2015 fails to generate the right x86 assembly, branch instead
-				(void)calculate_error_impl;
-				const rtm::scalarf error = context.has_scale ? error_metric->calculate_error(calculate_error_args) : error_metric->calculate_error_no_scale(calculate_error_args);
-#else
-				const rtm::scalarf error = calculate_error_impl(error_metric, calculate_error_args);
-#endif
+				const bool is_last_sample = sample_index + k_proxy_error_sample_stride >= context.num_samples;
+				if (num_batch_samples < num_error_batch_samples && !is_last_sample)
+					continue;	// Keep filling our batch
 
-				max_error = rtm::scalar_max(max_error, error);
-				if (stop_condition == error_scan_stop_condition::until_error_too_high && rtm::scalar_greater_equal(error, error_threshold))
-					break;
+				if (context.has_scale)
+					error_metric->calculate_error_batch(calculate_error_args, num_batch_samples, &batch_errors[0]);
+				else
+					error_metric->calculate_error_batch_no_scale(calculate_error_args, num_batch_samples, &batch_errors[0]);
 
-				sample_indexf += 1.0F;
+				raw_transform += num_batch_samples * raw_sample_stride;
+				calculate_error_args.transforms0 = raw_transform;
+
+				for (uint32_t batch_sample_index = 0; batch_sample_index < num_batch_samples; ++batch_sample_index)
+				{
+					const float error = batch_errors[batch_sample_index];
+					max_error = rtm::scalar_max(max_error, error);
+					if (error >= error_threshold)
+						return max_error;
+				}
+
+				num_batch_samples = 0;
+			}
+
+			return max_error;
+		}
+
+		// Returns the largest XYZ range extent of a sub-track once both the clip and segment range reductions are combined
+		// The segment range is null when the segment isn't normalized
+		inline float get_max_range_extent(const track_stream_range& clip_range, const track_stream_range* segment_range)
+		{
+			rtm::vector4f extent = clip_range.get_extent();
+			if (segment_range != nullptr)
+				extent = rtm::vector_mul(extent, segment_range->get_extent());
+
+			return rtm::scalar_max(rtm::scalar_max(rtm::vector_get_x(extent), rtm::vector_get_y(extent)), rtm::vector_get_z(extent));
+		}
+
+		// Estimates the lowest bit rate that keeps the quantization error of a sub-track under the error threshold
+		// Values are quantized uniformly over their range and we assume the worst case error on every component
+		// The error scale converts a component error into a displacement on the rigid shell
+		inline uint8_t estimate_bit_rate(uint8_t initial_bit_rate, float range_extent, float error_scale, float error_threshold)
+		{
+			if (initial_bit_rate == k_invalid_bit_rate)
+				return k_invalid_bit_rate;	// Constant or default sub-track
+
+			// sqrt(3), the error can accumulate on all three components
+			const float max_displacement = 1.7320508F * range_extent * error_scale;
+
+			for (uint8_t bit_rate = initial_bit_rate; bit_rate < k_highest_bit_rate; ++bit_rate)
+			{
+				const uint32_t num_bits = get_num_bits_at_bit_rate(bit_rate);
+
+				// With no bits, every sample is the range minimum, otherwise we are off by at most half a step
+				const float error = num_bits == 0 ? max_displacement : (0.5F * max_displacement / float((1U << num_bits) - 1));
+				if (error < error_threshold)
+					return bit_rate;
 			}
 
-			return rtm::scalar_cast(max_error);
+			return k_highest_bit_rate;
+		}
+
+		// Estimates the local space bit rates in a single pass from the range extents and the shell distance
+		// This is much cheaper than measuring the error of every local permutation but less accurate, the
+		// object space search that follows increases the bit rates where the estimate is too low
+		inline void estimate_local_space_bit_rates(quantization_context& context)
+		{
+			const segment_context& segment = *context.segment;
+			const clip_context& clip = context.clip;
+
+			const uint32_t num_bones = context.num_bones;
+			for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
+			{
+				const rigid_shell_metadata_t& shell = context.shell_metadata_per_transform[bone_index];
+				const transform_range& clip_range = clip.ranges[bone_index];
+				const transform_range* segment_range = segment.ranges != nullptr ? &segment.ranges[bone_index] : nullptr;
+				transform_bit_rates& bone_bit_rates = context.bit_rate_per_bone[bone_index];
+
+				// A small rotation error of a quaternion component rotates the shell by about twice that angle
+				const float rotation_extent = get_max_range_extent(clip_range.rotation, segment_range != nullptr && segment.are_rotations_normalized ? &segment_range->rotation : nullptr);
+				bone_bit_rates.rotation = estimate_bit_rate(bone_bit_rates.rotation, rotation_extent, 2.0F * shell.local_shell_distance, shell.precision);
+
+				const float translation_extent = get_max_range_extent(clip_range.translation, segment_range != nullptr && segment.are_translations_normalized ? &segment_range->translation : nullptr);
+				bone_bit_rates.translation = estimate_bit_rate(bone_bit_rates.translation, translation_extent, 1.0F, shell.precision);
+
+				if (context.has_scale)
+				{
+					const float scale_extent = get_max_range_extent(clip_range.scale, segment_range != nullptr && segment.are_scales_normalized ? &segment_range->scale : nullptr);
+					bone_bit_rates.scale = estimate_bit_rate(bone_bit_rates.scale, scale_extent, shell.local_shell_distance, shell.precision);
+				}
+			}
 		}
 
 		inline void calculate_local_space_bit_rates(quantization_context& context)
@@ -1034,6 +1459,106 @@ namespace acl
 			}
 		}
 
+		// Starts the local space search from the bit rates found for the previous segment of the same clip
+		// Adjacent segments usually need similar bit rates: we first check the previous bit rates and then
+		// lower them one track at a time while the error remains acceptable or raise the track that lowers
+		// the error the most until it becomes acceptable. This requires far fewer error evaluations than
+		// searching every local permutation from the lowest bit rates.
+		inline void seed_local_space_bit_rates(quantization_context& context)
+		{
+			static_assert(offsetof(transform_bit_rates, rotation) == 0 && offsetof(transform_bit_rates, scale) == sizeof(transform_bit_rates) - 1, "Invalid BoneBitRate offsets");
+			const uint32_t num_track_types = context.has_scale ? 3 : 2;
+
+			const uint32_t num_bones = context.num_bones;
+			for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
+			{
+				// Our bit rates have been initialized to the lowest we can use, see initialize_bone_bit_rates(..)
+				const transform_bit_rates lowest_bit_rates = context.bit_rate_per_bone[bone_index];
+				const transform_bit_rates& previous_bit_rates = context.previous_segment_bit_rates[bone_index];
+				transform_bit_rates& bone_bit_rates = context.bit_rate_per_bone[bone_index];
+
+				bool is_any_track_variable = false;
+				for (uint32_t track_type_index = 0; track_type_index < num_track_types; ++track_type_index)
+				{
+					const uint8_t lowest_bit_rate = (&lowest_bit_rates.rotation)[track_type_index];
+					if (lowest_bit_rate == k_invalid_bit_rate)
+						continue;	// Constant or default, nothing to search
+
+					const uint8_t previous_bit_rate = (&previous_bit_rates.rotation)[track_type_index];
+					(&bone_bit_rates.rotation)[track_type_index] = previous_bit_rate == k_invalid_bit_rate ? lowest_bit_rate : std::min<uint8_t>(std::max<uint8_t>(previous_bit_rate, lowest_bit_rate), k_highest_bit_rate);
+					is_any_track_variable = true;
+				}
+
+				if (!is_any_track_variable)
+					continue;	// Every track bit rate is constant/default, nothing else to do
+
+				const float error_threshold = context.shell_metadata_per_transform[bone_index].precision;
+				float error = calculate_max_error_at_bit_rate_local(context, bone_index, error_scan_stop_condition::until_error_too_high);
+
+				if (error < error_threshold)
+				{
+					// Lower our bit rates one track at a time for as long as our error remains acceptable
+					bool is_any_track_lowered = true;
+					while (is_any_track_lowered)
+					{
+						is_any_track_lowered = false;
+						for (uint32_t track_type_index = 0; track_type_index < num_track_types; ++track_type_index)
+						{
+							uint8_t& bit_rate = (&bone_bit_rates.rotation)[track_type_index];
+							if (bit_rate == k_invalid_bit_rate || bit_rate <= (&lowest_bit_rates.rotation)[track_type_index])
+								continue;	// Constant, default, or already at its lowest
+
+							bit_rate--;
+							error = calculate_max_error_at_bit_rate_local(context, bone_index, error_scan_stop_condition::until_error_too_high);
+							if (error < error_threshold)
+								is_any_track_lowered = true;
+							else
+								bit_rate++;
+						}
+					}
+				}
+				else
+				{
+					// Raise the track that lowers our error the most until it becomes acceptable
+					// We need the full error of every candidate to compare them
+					error = calculate_max_error_at_bit_rate_local(context, bone_index, error_scan_stop_condition::until_end_of_segment);
+					while (error >= error_threshold)
+					{
+						const transform_bit_rates current_bit_rates = bone_bit_rates;
+						transform_bit_rates best_bit_rates = current_bit_rates;
+						float best_error = error;
+
+						for (uint32_t track_type_index = 0; track_type_index < num_track_types; ++track_type_index)
+						{
+							uint8_t& bit_rate = (&bone_bit_rates.rotation)[track_type_index];
+							if (bit_rate == k_invalid_bit_rate || bit_rate >= k_highest_bit_rate)
+								continue;	// Constant, default, or maxed out
+
+							bit_rate++;
+							const float candidate_error = calculate_max_error_at_bit_rate_local(context, bone_index, error_scan_stop_condition::until_end_of_segment);
+							if (candidate_error < best_error)
+							{
+								best_error = candidate_error;
+								best_bit_rates = bone_bit_rates;
+							}
+
+							bone_bit_rates = current_bit_rates;
+						}
+
+						if (best_error >= error)
+							break;	// No single track helps, the object space search will refine this further
+
+						bone_bit_rates = best_bit_rates;
+						error = best_error;
+					}
+				}
+
+#if ACL_IMPL_DEBUG_VARIABLE_QUANTIZATION >= ACL_IMPL_DEBUG_LEVEL_BASIC_INFO
+				printf("%u: Seeded bit rates: %u | %u | %u\n", bone_index, bone_bit_rates.rotation, bone_bit_rates.translation, bone_bit_rates.scale);
+#endif
+			}
+		}
+
 		constexpr uint32_t increment_and_clamp_bit_rate(uint32_t bit_rate, uint32_t increment)
 		{
 			return bit_rate >= k_highest_bit_rate ? bit_rate : std::min<uint32_t>(bit_rate + increment, k_highest_bit_rate);
@@ -1094,45 +1619,73 @@ namespace acl
 			return best_error;
 		}
 
-		inline float calculate_bone_permutation_error(quantization_context& context, transform_bit_rates* permutation_bit_rates, uint8_t* bone_chain_permutation, uint32_t bone_index, transform_bit_rates* best_bit_rates, float old_error)
+		// Evaluates a single bone chain permutation and returns its error
+		// The resulting bit rates are written in the permutation bit rates, if none changed the permutation is invalid
+		inline float evaluate_bone_permutation(quantization_context& context, const uint8_t* bone_chain_permutation, uint32_t bone_index, float old_error, transform_bit_rates* permutation_bit_rates, bool& out_is_permutation_valid)
 		{
-			const float error_threshold = context.shell_metadata_per_transform[bone_index].precision;
-			float best_error = old_error;
+			// Copy our current bit rates to the permutation rates
+			std::memcpy(permutation_bit_rates, context.bit_rate_per_bone, sizeof(transform_bit_rates) * context.num_bones);
 
-			do
+			bool is_permutation_valid = false;
+			const uint32_t num_bones_in_chain = context.num_bones_in_chain;
+			for (uint32_t chain_link_index = 0; chain_link_index < num_bones_in_chain; ++chain_link_index)
 			{
-				// Copy our current bit rates to the permutation rates
-				std::memcpy(permutation_bit_rates, context.bit_rate_per_bone, sizeof(transform_bit_rates) * context.num_bones);
-
-				bool is_permutation_valid = false;
-				const uint32_t num_bones_in_chain = context.num_bones_in_chain;
-				for (uint32_t chain_link_index = 0; chain_link_index < num_bones_in_chain; ++chain_link_index)
+				if (bone_chain_permutation[chain_link_index] != 0)
 				{
-					if (bone_chain_permutation[chain_link_index] != 0)
-					{
-						// Increase bit rate
-						const uint32_t chain_bone_index = context.chain_bone_indices[chain_link_index];
-						transform_bit_rates chain_bone_best_bit_rates;
-						increase_bone_bit_rate(context, chain_bone_index, bone_chain_permutation[chain_link_index], old_error, chain_bone_best_bit_rates);
-						is_permutation_valid |= chain_bone_best_bit_rates.rotation != permutation_bit_rates[chain_bone_index].rotation;
-						is_permutation_valid |= chain_bone_best_bit_rates.translation != permutation_bit_rates[chain_bone_index].translation;
-						is_permutation_valid |= chain_bone_best_bit_rates.scale != permutation_bit_rates[chain_bone_index].scale;
-						permutation_bit_rates[chain_bone_index] = chain_bone_best_bit_rates;
-					}
+					// Increase bit rate
+					const uint32_t chain_bone_index = context.chain_bone_indices[chain_link_index];
+					transform_bit_rates chain_bone_best_bit_rates;
+					increase_bone_bit_rate(context, chain_bone_index, bone_chain_permutation[chain_link_index], old_error, chain_bone_best_bit_rates);
+					is_permutation_valid |= chain_bone_best_bit_rates.rotation != permutation_bit_rates[chain_bone_index].rotation;
+					is_permutation_valid |= chain_bone_best_bit_rates.translation != permutation_bit_rates[chain_bone_index].translation;
+					is_permutation_valid |= chain_bone_best_bit_rates.scale != permutation_bit_rates[chain_bone_index].scale;
+					permutation_bit_rates[chain_bone_index] = chain_bone_best_bit_rates;
 				}
+			}
 
-				if (!is_permutation_valid)
-					continue;	// Couldn't increase any bit rate, skip this permutation
+			out_is_permutation_valid = is_permutation_valid;
+			if (!is_permutation_valid)
+				return old_error;	// Couldn't increase any bit rate, skip this permutation
 
-				// Measure error
-				std::swap(context.bit_rate_per_bone, permutation_bit_rates);
-				const float permutation_error = calculate_max_error_at_bit_rate_object(context, bone_index, error_scan_stop_condition::until_error_too_high);
-				std::swap(context.bit_rate_per_bone, permutation_bit_rates);
+			// Measure error
+			std::swap(context.bit_rate_per_bone, permutation_bit_rates);
 
-				if (permutation_error < best_error)
-				{
-					best_error = permutation_error;
-					std::memcpy(best_bit_rates, permutation_bit_rates, sizeof(transform_bit_rates) * context.num_bones);
+			// Most permutations fail to meet the precision, try to reject them with a subset of the samples first
+			// Permutations that pass are always measured with every sample
+			const float error_threshold = context.shell_metadata_per_transform[bone_index].precision;
+			float permutation_error = 0.0F;
+			if (context.enable_proxy_error_rejection && context.num_samples > k_proxy_error_sample_stride)
+				permutation_error = calculate_proxy_error_at_bit_rate_object(context, bone_index);
+
+			if (permutation_error < error_threshold)
+				permutation_error = calculate_max_error_at_bit_rate_object(context, bone_index, error_scan_stop_condition::until_error_too_high);
+
+			std::swap(context.bit_rate_per_bone, permutation_bit_rates);
+
+			return permutation_error;
+		}
+
+		inline float calculate_bone_permutation_error(quantization_context& context, transform_bit_rates* permutation_bit_rates, uint8_t* bone_chain_permutation, uint32_t bone_index, transform_bit_rates* best_bit_rates, float old_error)
+		{
+			const float error_threshold = context.shell_metadata_per_transform[bone_index].precision;
+			float best_error = old_error;
+
+			do
+			{
+				if (context.get_remaining_search_budget() == 0)
+					break;	// Our search budget is spent, keep what we found so far
+
+				context.num_evaluated_permutations++;
+
+				bool is_permutation_valid;
+				const float permutation_error = evaluate_bone_permutation(context, bone_chain_permutation, bone_index, old_error, permutation_bit_rates, is_permutation_valid);
+				if (!is_permutation_valid)
+					continue;	// Couldn't increase any bit rate, skip this permutation
+
+				if (permutation_error < best_error)
+				{
+					best_error = permutation_error;
+					std::memcpy(best_bit_rates, permutation_bit_rates, sizeof(transform_bit_rates) * context.num_bones);
 
 					if (permutation_error < error_threshold)
 						break;
@@ -1142,8 +1695,136 @@ namespace acl
 			return best_error;
 		}
 
+		// How many permutations each worker evaluates per batch
+		// Permutations past the first one that meets the error threshold are wasted work, smaller batches waste less
+		// but synchronize more often
+		constexpr uint32_t k_num_permutations_per_worker_batch = 4;
+
+		// A batch of bone chain permutations evaluated in parallel, in the order the serial search visits them
+		struct permutation_batch
+		{
+			const quantization_context* main_context;
+			uint8_t* permutations;							// num_bones per permutation, only the chain links are used
+			transform_bit_rates* permutation_bit_rates;		// num_bones per permutation
+			float* errors;									// 1 per permutation
+			bool* is_valid;									// 1 per permutation
+
+			uint32_t max_num_permutations;
+			uint32_t num_permutations;
+			uint32_t bone_index;
+			float old_error;
+
+			std::atomic<uint32_t> next_permutation_index;
+		};
+
+		struct permutation_job
+		{
+			permutation_batch* batch;
+			quantization_context* worker_context;
+		};
+
+		inline void execute_permutation_job(void* job_data)
+		{
+			permutation_job& job = *static_cast<permutation_job*>(job_data);
+			permutation_batch& batch = *job.batch;
+			quantization_context& context = *job.worker_context;
+			const quantization_context& main_context = *batch.main_context;
+			const uint32_t num_bones = context.num_bones;
+
+			// Start from the same bit rates and chain as the serial search
+			std::memcpy(context.bit_rate_per_bone, main_context.bit_rate_per_bone, sizeof(transform_bit_rates) * num_bones);
+			std::memcpy(context.chain_bone_indices, main_context.chain_bone_indices, sizeof(uint32_t) * main_context.num_bones_in_chain);
+			context.num_bones_in_chain = main_context.num_bones_in_chain;
+
+			while (true)
+			{
+				const uint32_t permutation_index = batch.next_permutation_index.fetch_add(1, std::memory_order_relaxed);
+				if (permutation_index >= batch.num_permutations)
+					break;
+
+				const uint8_t* bone_chain_permutation = batch.permutations + (permutation_index * num_bones);
+				transform_bit_rates* permutation_bit_rates = batch.permutation_bit_rates + (permutation_index * num_bones);
+				batch.errors[permutation_index] = evaluate_bone_permutation(context, bone_chain_permutation, batch.bone_index, batch.old_error, permutation_bit_rates, batch.is_valid[permutation_index]);
+			}
+		}
+
+		// Same as the serial search above but when we have permutation workers, permutations are evaluated in parallel
+		// Results are reduced in permutation order which yields the same bit rates as the serial search
+		inline float calculate_bone_permutation_error(quantization_context& context, permutation_batch* batch_, permutation_job* jobs, transform_bit_rates* permutation_bit_rates, uint8_t* bone_chain_permutation, uint32_t bone_index, transform_bit_rates* best_bit_rates, float old_error)
+		{
+			if (batch_ == nullptr)
+				return calculate_bone_permutation_error(context, permutation_bit_rates, bone_chain_permutation, bone_index, best_bit_rates, old_error);
+
+			permutation_batch& batch = *batch_;
+			const compression_job_scheduler& job_scheduler = *context.permutation_job_scheduler;
+			const float error_threshold = context.shell_metadata_per_transform[bone_index].precision;
+			const uint32_t num_bones = context.num_bones;
+			const uint32_t num_bones_in_chain = context.num_bones_in_chain;
+			float best_error = old_error;
+
+			bool has_more_permutations = true;
+			while (has_more_permutations)
+			{
+				// Never gather more permutations than our search budget allows to match the serial search
+				const uint32_t max_num_permutations = std::min<uint32_t>(batch.max_num_permutations, context.get_remaining_search_budget());
+				if (max_num_permutations == 0)
+					break;	// Our search budget is spent, keep what we found so far
+
+				uint32_t num_permutations = 0;
+				do
+				{
+					std::memcpy(batch.permutations + (num_permutations * num_bones), bone_chain_permutation, num_bones_in_chain);
+					num_permutations++;
+
+					has_more_permutations = std::next_permutation(bone_chain_permutation, bone_chain_permutation + num_bones_in_chain);
+				} while (has_more_permutations && num_permutations < max_num_permutations);
+
+				batch.num_permutations = num_permutations;
+				batch.bone_index = bone_index;
+				batch.old_error = old_error;
+				batch.next_permutation_index.store(0, std::memory_order_relaxed);
+
+				const uint32_t num_jobs = std::min<uint32_t>(context.num_permutation_workers, num_permutations);
+				for (uint32_t job_index = 0; job_index < num_jobs; ++job_index)
+					job_scheduler.submit_job(job_scheduler.user_data, &execute_permutation_job, &jobs[job_index]);
+
+				job_scheduler.wait_for_jobs(job_scheduler.user_data);
+
+				for (uint32_t permutation_index = 0; permutation_index < num_permutations; ++permutation_index)
+				{
+					// Only count the permutations the serial search would have evaluated
+					context.num_evaluated_permutations++;
+
+					if (!batch.is_valid[permutation_index])
+						continue;	// Couldn't increase any bit rate, skip this permutation
+
+					const float permutation_error = batch.errors[permutation_index];
+					if (permutation_error < best_error)
+					{
+						best_error = permutation_error;
+						std::memcpy(best_bit_rates, batch.permutation_bit_rates + (permutation_index * num_bones), sizeof(transform_bit_rates) * num_bones);
+
+						if (permutation_error < error_threshold)
+							return best_error;
+					}
+				}
+			}
+
+			return best_error;
+		}
+
 		inline uint32_t calculate_bone_chain_indices(const clip_context& clip, uint32_t bone_index, uint32_t* out_chain_bone_indices)
 		{
+			const transform_hierarchy& hierarchy = *clip.hierarchy;
+			if (hierarchy.chain_offsets != nullptr)
+			{
+				// Our hierarchy comes from a skeleton context, the chains are already known
+				const uint32_t chain_offset = hierarchy.chain_offsets[bone_index];
+				const uint32_t num_bones_in_chain = hierarchy.chain_offsets[bone_index + 1] - chain_offset;
+				std::memcpy(out_chain_bone_indices, hierarchy.chain_transform_indices + chain_offset, sizeof(uint32_t) * num_bones_in_chain);
+				return num_bones_in_chain;
+			}
+
 			const bone_chain bone_chain = clip.get_bone_chain(bone_index);
 
 			uint32_t num_bones_in_chain = 0;
@@ -1216,6 +1897,148 @@ namespace acl
 			}
 		}
 
+		// A single bit rate increment proposed by a transform that misses its error threshold
+		struct greedy_bit_rate_move
+		{
+			float				score;				// Error reduction relative to the threshold per bit added, higher is better
+			uint32_t			transform_index;	// The transform whose error we measured
+			uint32_t			chain_bone_index;	// The transform along its chain whose bit rates increase
+			uint32_t			version;			// The last applied move when this one was evaluated
+			transform_bit_rates	bit_rates;			// The new bit rates of the chain transform
+		};
+
+		// Max heap ordering, ties are broken with the transform index to remain deterministic
+		inline bool is_greedy_bit_rate_move_worse(const greedy_bit_rate_move& lhs, const greedy_bit_rate_move& rhs)
+		{
+			return lhs.score < rhs.score || (lhs.score == rhs.score && lhs.transform_index > rhs.transform_index);
+		}
+
+		// Evaluates every single bit rate increment along the chain of a transform and returns the one that
+		// lowers its error the most per bit added. Returns false if the transform meets its error threshold
+		// or if no increment lowers its error.
+		inline bool find_greedy_bit_rate_move(quantization_context& context, uint32_t transform_index, greedy_bit_rate_move& out_move)
+		{
+			const float error_threshold = context.shell_metadata_per_transform[transform_index].precision;
+
+			const uint32_t num_bones_in_chain = calculate_bone_chain_indices(context.clip, transform_index, context.chain_bone_indices);
+			context.num_bones_in_chain = num_bones_in_chain;
+
+			const float error = calculate_max_error_at_bit_rate_object(context, transform_index, error_scan_stop_condition::until_end_of_segment);
+			if (error < error_threshold)
+				return false;
+
+			static_assert(offsetof(transform_bit_rates, rotation) == 0 && offsetof(transform_bit_rates, scale) == sizeof(transform_bit_rates) - 1, "Invalid BoneBitRate offsets");
+			const uint32_t num_track_types = context.has_scale ? 3 : 2;
+
+			float best_score = 0.0F;
+			for (uint32_t chain_link_index = 0; chain_link_index < num_bones_in_chain; ++chain_link_index)
+			{
+				const uint32_t chain_bone_index = context.chain_bone_indices[chain_link_index];
+				const transform_bit_rates bone_bit_rates = context.bit_rate_per_bone[chain_bone_index];
+
+				for (uint32_t track_type_index = 0; track_type_index < num_track_types; ++track_type_index)
+				{
+					const uint8_t bit_rate = (&bone_bit_rates.rotation)[track_type_index];
+					if (bit_rate == k_invalid_bit_rate || bit_rate >= k_highest_bit_rate)
+						continue;	// Constant, default, or maxed out
+
+					if (context.get_remaining_search_budget() == 0)
+						break;	// Our search budget is spent, keep what we found so far
+
+					context.num_evaluated_permutations++;
+
+					transform_bit_rates candidate_bit_rates = bone_bit_rates;
+					(&candidate_bit_rates.rotation)[track_type_index] = uint8_t(bit_rate + 1);
+
+					context.bit_rate_per_bone[chain_bone_index] = candidate_bit_rates;
+					const float candidate_error = calculate_max_error_at_bit_rate_object(context, transform_index, error_scan_stop_condition::until_end_of_segment);
+					context.bit_rate_per_bone[chain_bone_index] = bone_bit_rates;
+
+					// Lowering the error past the threshold brings nothing more
+					const float error_reduction = error - rtm::scalar_max(candidate_error, error_threshold);
+					if (error_reduction <= 0.0F)
+						continue;
+
+					const uint32_t num_bits_added = get_num_bits_at_bit_rate(bit_rate + 1) - get_num_bits_at_bit_rate(bit_rate);
+					const float score = (error_reduction / error_threshold) / float(num_bits_added);
+					if (score > best_score)
+					{
+						best_score = score;
+						out_move.score = score;
+						out_move.transform_index = transform_index;
+						out_move.chain_bone_index = chain_bone_index;
+						out_move.bit_rates = candidate_bit_rates;
+					}
+				}
+			}
+
+			return best_score > 0.0F;
+		}
+
+		// Searches the bit rates of every transform in the segment at once.
+		// Every transform that misses its error threshold proposes the bit rate increment along its chain
+		// that lowers its error the most per bit added and the best proposal across the segment is applied first.
+		// Proposals are kept in a max heap and re-evaluated lazily: once a transform along its chain changed,
+		// a proposal is evaluated again when it reaches the top of the heap. Transforms that still miss their
+		// threshold once no proposal remains are refined afterwards like with the permutation search.
+		inline void find_greedy_bit_rates(quantization_context& context)
+		{
+			const uint32_t num_bones = context.num_bones;
+
+			greedy_bit_rate_move* moves = allocate_type_array<greedy_bit_rate_move>(context.allocator, num_bones);
+			uint32_t* transform_versions = allocate_type_array<uint32_t>(context.allocator, num_bones);
+			std::fill(transform_versions, transform_versions + num_bones, 0U);
+
+			uint32_t num_moves = 0;
+			uint32_t version = 0;
+
+			// Each transform has at most a single proposal in the heap
+			for (const uint32_t bone_index : make_iterator(context.raw_clip.sorted_transforms_parent_first, num_bones))
+			{
+				greedy_bit_rate_move& move = moves[num_moves];
+				if (find_greedy_bit_rate_move(context, bone_index, move))
+				{
+					move.version = version;
+					num_moves++;
+					std::push_heap(moves, moves + num_moves, is_greedy_bit_rate_move_worse);
+				}
+			}
+
+			while (num_moves != 0)
+			{
+				// The remaining transforms keep their current bit rates, compression discards them once it notices
+				if (context.progress->is_cancelled())
+					break;
+
+				std::pop_heap(moves, moves + num_moves, is_greedy_bit_rate_move_worse);
+				num_moves--;
+
+				greedy_bit_rate_move& move = moves[num_moves];
+				const uint32_t transform_index = move.transform_index;
+
+				bool is_stale = false;
+				for (uint32_t chain_transform_index = transform_index; chain_transform_index != k_invalid_track_index; chain_transform_index = context.clip.metadata[chain_transform_index].parent_index)
+					is_stale |= transform_versions[chain_transform_index] > move.version;
+
+				if (!is_stale)
+				{
+					context.bit_rate_per_bone[move.chain_bone_index] = move.bit_rates;
+					transform_versions[move.chain_bone_index] = ++version;
+				}
+
+				// Either our proposal was stale or we applied it, propose our next move if we still need one
+				if (find_greedy_bit_rate_move(context, transform_index, move))
+				{
+					move.version = version;
+					num_moves++;
+					std::push_heap(moves, moves + num_moves, is_greedy_bit_rate_move_worse);
+				}
+			}
+
+			deallocate_type_array(context.allocator, moves, num_bones);
+			deallocate_type_array(context.allocator, transform_versions, num_bones);
+		}
+
 		inline void find_optimal_bit_rates(quantization_context& context)
 		{
 			ACL_ASSERT(context.is_valid(), "quantization_context isn't valid");
@@ -1231,8 +2054,32 @@ namespace acl
 			// In practice, the error from a child can compensate the error introduced by the parent but
 			// this is unlikely to hold true for a whole track at every key. We thus make the assumption
 			// that increasing the precision is always good regardless of the hierarchy level.
+			//
+			// When we have a hint from a previous compression, we start from its bit rates instead. Transforms
+			// that still meet their error threshold are skipped below and only those that changed are searched again.
+			//
+			// With the lowest compression level, the local space bit rates are estimated from the range extents instead.
+			//
+			// Otherwise, when we just searched the previous segment of the same run, we start from its bit rates
+			// and only refine them locally since adjacent segments usually need similar bit rates.
+
+			const uint32_t segment_index = context.segment->segment_index;
+			const bool is_previous_segment_seed = (segment_index % k_num_segments_per_seed_run) != 0 && context.previous_segment_index == segment_index - 1;
+
+			if (context.warm_start_hint != nullptr)
+				context.warm_start_hint->apply(*context.segment, context.bit_rate_per_bone);
+			else if (context.compression_level == compression_level8::lowest)
+				estimate_local_space_bit_rates(context);
+			else if (is_previous_segment_seed)
+				seed_local_space_bit_rates(context);
+			else
+				calculate_local_space_bit_rates(context);
 
-			calculate_local_space_bit_rates(context);
+			// The greedy search processes every transform at once and leaves the permutation search out,
+			// the transforms that remain above their error threshold are refined below
+			const bool is_greedy_search = context.bit_rate_search_strategy == bit_rate_search_strategy8::greedy;
+			if (is_greedy_search)
+				find_greedy_bit_rates(context);
 
 			// Now that we found an approximate lower bound for the bit rates, we start at the root and perform a brute force search.
 			// For each bone, we do the following:
@@ -1275,11 +2122,42 @@ namespace acl
 			transform_bit_rates* best_bit_rates = allocate_type_array<transform_bit_rates>(context.allocator, context.num_bones);
 			std::memcpy(best_bit_rates, context.bit_rate_per_bone, sizeof(transform_bit_rates) * context.num_bones);
 
+			// When we have permutation workers, they evaluate batches of permutations in parallel
+			permutation_batch* batch = nullptr;
+			permutation_job* jobs = nullptr;
+			const uint32_t num_permutation_workers = context.num_permutation_workers;
+			const uint32_t max_num_batch_permutations = num_permutation_workers * k_num_permutations_per_worker_batch;
+			if (num_permutation_workers != 0)
+			{
+				batch = allocate_type<permutation_batch>(context.allocator);
+				batch->main_context = &context;
+				batch->permutations = allocate_type_array<uint8_t>(context.allocator, size_t(max_num_batch_permutations) * context.num_bones);
+				batch->permutation_bit_rates = allocate_type_array<transform_bit_rates>(context.allocator, size_t(max_num_batch_permutations) * context.num_bones);
+				batch->errors = allocate_type_array<float>(context.allocator, max_num_batch_permutations);
+				batch->is_valid = allocate_type_array<bool>(context.allocator, max_num_batch_permutations);
+				batch->max_num_permutations = max_num_batch_permutations;
+				batch->num_permutations = 0;
+
+				jobs = allocate_type_array<permutation_job>(context.allocator, num_permutation_workers);
+				for (uint32_t worker_index = 0; worker_index < num_permutation_workers; ++worker_index)
+				{
+					quantization_context& worker_context = context.permutation_workers[worker_index];
+					worker_context.set_segment(context);
+
+					jobs[worker_index].batch = batch;
+					jobs[worker_index].worker_context = &worker_context;
+				}
+			}
+
 			// Iterate from the root transforms first
 			// I attempted to iterate from leaves first and the memory footprint was severely worse
 			const uint32_t num_bones = context.num_bones;
 			for (const uint32_t bone_index : make_iterator(context.raw_clip.sorted_transforms_parent_first, num_bones))
 			{
+				// The remaining bones keep their current bit rates, compression discards them once it notices
+				if (context.progress->is_cancelled())
+					break;
+
 				// Update our context with the new bone data
 				const float error_threshold = context.shell_metadata_per_transform[bone_index].precision;
 
@@ -1292,7 +2170,10 @@ namespace acl
 
 				const float initial_error = error;
 
-				while (error >= error_threshold)
+				// Once our search budget is spent, we skip straight to increasing the bit rates below
+				// The lowest and low compression levels do not search permutations and only perform that single refinement pass
+				const bool search_permutations = !is_greedy_search && context.compression_level >= compression_level8::medium;
+				while (search_permutations && error >= error_threshold && context.get_remaining_search_budget() != 0)
 				{
 					// Generate permutations for up to 3 bit rate increments
 					// Perform an exhaustive search of the permutations and pick the best result
@@ -1303,7 +2184,7 @@ namespace acl
 					// The first permutation increases the bit rate of a single track/bone
 					std::fill(bone_chain_permutation, bone_chain_permutation + num_bones, uint8_t(0));
 					bone_chain_permutation[num_bones_in_chain - 1] = 1;
-					error = calculate_bone_permutation_error(context, permutation_bit_rates, bone_chain_permutation, bone_index, best_permutation_bit_rates, original_error);
+					error = calculate_bone_permutation_error(context, batch, jobs, permutation_bit_rates, bone_chain_permutation, bone_index, best_permutation_bit_rates, original_error);
 					if (error < best_error)
 					{
 						best_error = error;
@@ -1318,7 +2199,7 @@ namespace acl
 						// The second permutation increases the bit rate of 2 track/bones
 						std::fill(bone_chain_permutation, bone_chain_permutation + num_bones, uint8_t(0));
 						bone_chain_permutation[num_bones_in_chain - 1] = 2;
-						error = calculate_bone_permutation_error(context, permutation_bit_rates, bone_chain_permutation, bone_index, best_permutation_bit_rates, original_error);
+						error = calculate_bone_permutation_error(context, batch, jobs, permutation_bit_rates, bone_chain_permutation, bone_index, best_permutation_bit_rates, original_error);
 						if (error < best_error)
 						{
 							best_error = error;
@@ -1333,7 +2214,7 @@ namespace acl
 							std::fill(bone_chain_permutation, bone_chain_permutation + num_bones, uint8_t(0));
 							bone_chain_permutation[num_bones_in_chain - 2] = 1;
 							bone_chain_permutation[num_bones_in_chain - 1] = 1;
-							error = calculate_bone_permutation_error(context, permutation_bit_rates, bone_chain_permutation, bone_index, best_permutation_bit_rates, original_error);
+							error = calculate_bone_permutation_error(context, batch, jobs, permutation_bit_rates, bone_chain_permutation, bone_index, best_permutation_bit_rates, original_error);
 							if (error < best_error)
 							{
 								best_error = error;
@@ -1350,7 +2231,7 @@ namespace acl
 						// The third permutation increases the bit rate of 3 track/bones
 						std::fill(bone_chain_permutation, bone_chain_permutation + num_bones, uint8_t(0));
 						bone_chain_permutation[num_bones_in_chain - 1] = 3;
-						error = calculate_bone_permutation_error(context, permutation_bit_rates, bone_chain_permutation, bone_index, best_permutation_bit_rates, original_error);
+						error = calculate_bone_permutation_error(context, batch, jobs, permutation_bit_rates, bone_chain_permutation, bone_index, best_permutation_bit_rates, original_error);
 						if (error < best_error)
 						{
 							best_error = error;
@@ -1365,7 +2246,7 @@ namespace acl
 							std::fill(bone_chain_permutation, bone_chain_permutation + num_bones, uint8_t(0));
 							bone_chain_permutation[num_bones_in_chain - 2] = 2;
 							bone_chain_permutation[num_bones_in_chain - 1] = 1;
-							error = calculate_bone_permutation_error(context, permutation_bit_rates, bone_chain_permutation, bone_index, best_permutation_bit_rates, original_error);
+							error = calculate_bone_permutation_error(context, batch, jobs, permutation_bit_rates, bone_chain_permutation, bone_index, best_permutation_bit_rates, original_error);
 							if (error < best_error)
 							{
 								best_error = error;
@@ -1381,7 +2262,7 @@ namespace acl
 								bone_chain_permutation[num_bones_in_chain - 3] = 1;
 								bone_chain_permutation[num_bones_in_chain - 2] = 1;
 								bone_chain_permutation[num_bones_in_chain - 1] = 1;
-								error = calculate_bone_permutation_error(context, permutation_bit_rates, bone_chain_permutation, bone_index, best_permutation_bit_rates, original_error);
+								error = calculate_bone_permutation_error(context, batch, jobs, permutation_bit_rates, bone_chain_permutation, bone_index, best_permutation_bit_rates, original_error);
 								if (error < best_error)
 								{
 									best_error = error;
@@ -1565,6 +2446,20 @@ namespace acl
 			deallocate_type_array(context.allocator, permutation_bit_rates, num_bones);
 			deallocate_type_array(context.allocator, best_permutation_bit_rates, num_bones);
 			deallocate_type_array(context.allocator, best_bit_rates, num_bones);
+
+			if (batch != nullptr)
+			{
+				deallocate_type_array(context.allocator, batch->permutations, size_t(max_num_batch_permutations) * num_bones);
+				deallocate_type_array(context.allocator, batch->permutation_bit_rates, size_t(max_num_batch_permutations) * num_bones);
+				deallocate_type_array(context.allocator, batch->errors, max_num_batch_permutations);
+				deallocate_type_array(context.allocator, batch->is_valid, max_num_batch_permutations);
+				deallocate_type(context.allocator, batch);
+				deallocate_type_array(context.allocator, jobs, num_permutation_workers);
+			}
+
+			// Retain our bit rates to seed the next segment
+			std::memcpy(context.previous_segment_bit_rates, context.bit_rate_per_bone, sizeof(transform_bit_rates) * num_bones);
+			context.previous_segment_index = context.segment->segment_index;
 		}
 
 		// Partitioning will be done as follow in two phases: calculating the error contribution for every frame and a global optimization pass.
@@ -1601,26 +2496,27 @@ namespace acl
 		// This is thus a globally optimal process. If we wish to retain the 20% most important frames in tier 0 (our compressed clips) and 80% in the database, we can.
 		// Some clips might see more than 80% of their frames moved to the database while others might see less.
 
-		inline void find_contributing_error(quantization_context& context)
+		// Binds our bit rate database and builds the query that samples every transform at the current bit rates
+		inline void prepare_contributing_error(quantization_context& context)
 		{
-			ACL_ASSERT(context.num_samples <= 32, "Expected no more than 32 samples per track");
+			if (context.lossy_transforms_start == nullptr)
+			{
+				// This is the first time we call this, initialize what we'll need and re-use
+				context.all_local_query.bind(context.bit_rate_database);
 
-			if (context.segment->contributing_error == nullptr)
-				context.segment->contributing_error = allocate_type_array<frame_contributing_error>(context.allocator, 32);	// Always no more than 32 frames per segment
+				context.lossy_transforms_start = allocate_type_array<rtm::qvvf>(context.allocator, context.num_bones);
+				context.lossy_transforms_end = allocate_type_array<rtm::qvvf>(context.allocator, context.num_bones);
+			}
 
-			const uint32_t num_frames = context.num_samples;
+			context.all_local_query.build(context.bit_rate_per_bone);
+		}
+
+		// Calculates the error we contribute if the provided frame is removed from the frames retained
+		// The contributing error is the worst error of every frame in between the remaining two interpolation frames
+		inline float calculate_frame_contributing_error(quantization_context& context, uint32_t frames_retained, uint32_t frame_index)
+		{
 			const uint32_t num_bones = context.num_bones;
 			const bitset_description desc = bitset_description::make_from_num_bits<32>();
-			constexpr float infinity = std::numeric_limits<float>::infinity();
-
-			frame_contributing_error* contributing_error = context.segment->contributing_error;
-			uint32_t frames_retained = ~0U;	// By default, every frame is present
-
-			// First and last frame of the segment cannot be removed and thus contribute infinite error
-			// TODO: We could retain only the first/last frames of the clip instead but it would mean interpolating
-			// with a frame from the previous/next segments
-			contributing_error[0] = frame_contributing_error{ 0, infinity };
-			contributing_error[num_frames - 1] = frame_contributing_error{ num_frames - 1, infinity };
 
 			// START OF ERROR METRIC STUFF
 			const itransform_error_metric* error_metric = context.error_metric;
@@ -1661,126 +2557,222 @@ namespace acl
 			const uint8_t* raw_transform = context.raw_object_transforms;
 			const uint8_t* base_transforms = context.base_local_transforms;
 
-			if (context.lossy_transforms_start == nullptr)
-			{
-				// This is the first time we call this, initialize what we'll need and re-use
-				context.all_local_query.bind(context.bit_rate_database);
-
-				context.lossy_transforms_start = allocate_type_array<rtm::qvvf>(context.allocator, num_bones);
-				context.lossy_transforms_end = allocate_type_array<rtm::qvvf>(context.allocator, num_bones);
-			}
-
 			rtm::qvvf* lossy_transforms_start = context.lossy_transforms_start;
 			rtm::qvvf* lossy_transforms_end = context.lossy_transforms_end;
-
-			context.all_local_query.build(context.bit_rate_per_bone);
 			// END OF ERROR METRIC STUFF
 
-			// We iterate until every frame but the first and last have been removed
-			for (uint32_t iteration_count = 1; iteration_count < num_frames - 1; ++iteration_count)
+			// Find the first frame before the current one that is retained, it'll be our interpolation start point
+			uint32_t interp_start_frame_index = frame_index - 1;
+			while (!bitset_test(&frames_retained, desc, interp_start_frame_index))
+				interp_start_frame_index--;	// This frame isn't being retained, skip it
+
+			// Find the first frame after the current one that is retained, it'll be out interpolation end point
+			uint32_t interp_end_frame_index = frame_index + 1;
+			while (!bitset_test(&frames_retained, desc, interp_end_frame_index))
+				interp_end_frame_index++;	// This frame isn't being retained, skip it
+
+			// TODO: We could cache the contributing error and only invalidate it when we remove a frame
+
+			// The sample time is calculated from the full clip duration to be consistent with decompression
+			const float interp_start_time = rtm::scalar_min(float(interp_start_frame_index) / sample_rate, clip_duration);
+			const float interp_end_time = rtm::scalar_min(float(interp_end_frame_index) / sample_rate, clip_duration);
+
+			// We'll calculate the resulting error on every frame already removed that lives in between the remaining
+			// two interpolation frames.
+			context.bit_rate_database.sample(context.all_local_query, interp_start_time, lossy_transforms_start, num_bones);
+			context.bit_rate_database.sample(context.all_local_query, interp_end_time, lossy_transforms_end, num_bones);
+
+			// We'll retain the worst error as the current frame's contributing error.
+			rtm::scalarf max_contributing_error = rtm::scalar_set(0.0F);
+
+			for (uint32_t interp_frame_index = interp_start_frame_index + 1; interp_frame_index < interp_end_frame_index; ++interp_frame_index)
 			{
-				frame_contributing_error best_error{ num_frames, infinity };
+				// Calculate our interpolation alpha
+				const float interpolation_alpha = find_linear_interpolation_alpha(float(interp_frame_index), interp_start_frame_index, interp_end_frame_index, sample_rounding_policy::none);
 
-#if ACL_IMPL_DEBUG_CONTRIBUTING_ERROR
-				printf("Contributing error for segment %u (%u frames), iteration %u ...\n", context.segment->segment_index, num_frames, iteration_count);
-#endif
+				// Interpolate our transforms in local space before we convert or apply the additive and transform to object space
+				for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
+				{
+					// TODO: Implement qvv_lerp(..)
+					const rtm::quatf interp_rotation = rtm::quat_lerp(lossy_transforms_start[bone_index].rotation, lossy_transforms_end[bone_index].rotation, interpolation_alpha);
+					const rtm::vector4f interp_translation = rtm::vector_lerp(lossy_transforms_start[bone_index].translation, lossy_transforms_end[bone_index].translation, interpolation_alpha);
+					const rtm::vector4f interp_scale = rtm::vector_lerp(lossy_transforms_start[bone_index].scale, lossy_transforms_end[bone_index].scale, interpolation_alpha);
 
-				// Calculate how much error each frame contributes as we remove them, skip the first and last
-				for (uint32_t frame_index = 1; frame_index < num_frames - 1; ++frame_index)
+					context.lossy_local_pose[bone_index] = rtm::qvv_set(interp_rotation, interp_translation, interp_scale);
+				}
+
+				// Convert to our object space representation
+				if (needs_conversion)
 				{
-					// We'll attempt to remove the current frame if it hasn't been removed already
-					if (!bitset_test(&frames_retained, desc, frame_index))
-						continue;	// This frame has already been removed, skip it
+					convert_transforms_args_lossy.sample_index = interp_frame_index;
+					convert_transforms_impl(error_metric, convert_transforms_args_lossy, context.local_transforms_converted);
+				}
 
-					// Find the first frame before the current one that is retained, it'll be our interpolation start point
-					uint32_t interp_start_frame_index = frame_index - 1;
-					while (!bitset_test(&frames_retained, desc, interp_start_frame_index))
-						interp_start_frame_index--;	// This frame isn't being retained, skip it
+				if (has_additive_base)
+				{
+					apply_additive_to_base_args_lossy.base_transforms = base_transforms + (interp_frame_index * sample_transform_size);
 
-					// Find the first frame after the current one that is retained, it'll be out interpolation end point
-					uint32_t interp_end_frame_index = frame_index + 1;
-					while (!bitset_test(&frames_retained, desc, interp_end_frame_index))
-						interp_end_frame_index++;	// This frame isn't being retained, skip it
+					apply_additive_to_base_impl(error_metric, apply_additive_to_base_args_lossy, context.lossy_local_pose);
+				}
 
-					// TODO: We could cache the contributing error and only invalidate it when we remove a frame
+				local_to_object_space_impl(error_metric, local_to_object_space_args_lossy, context.lossy_object_pose);
 
-					// The sample time is calculated from the full clip duration to be consistent with decompression
-					const float interp_start_time = rtm::scalar_min(float(interp_start_frame_index) / sample_rate, clip_duration);
-					const float interp_end_time = rtm::scalar_min(float(interp_end_frame_index) / sample_rate, clip_duration);
+				// Calculate our error
+				const uint8_t* raw_frame_transform = raw_transform + (interp_frame_index * sample_transform_size);
 
-					// We'll calculate the resulting error on every frame already removed that lives in between the remaining
-					// two interpolation frames.
-					context.bit_rate_database.sample(context.all_local_query, interp_start_time, lossy_transforms_start, num_bones);
-					context.bit_rate_database.sample(context.all_local_query, interp_end_time, lossy_transforms_end, num_bones);
+				for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
+				{
+					itransform_error_metric::calculate_error_args calculate_error_args;
+					calculate_error_args.transform0 = raw_frame_transform + (bone_index * context.metric_transform_size);
+					calculate_error_args.transform1 = context.lossy_object_pose + (bone_index * context.metric_transform_size);
 
-					// We'll retain the worst error as the current frame's contributing error.
-					rtm::scalarf max_contributing_error = rtm::scalar_set(0.0F);
+					const rigid_shell_metadata_t& transform_shell = context.shell_metadata_per_transform[bone_index];
+					calculate_error_args.construct_sphere_shell(transform_shell.local_shell_distance);
 
-					for (uint32_t interp_frame_index = interp_start_frame_index + 1; interp_frame_index < interp_end_frame_index; ++interp_frame_index)
-					{
-						// Calculate our interpolation alpha
-						const float interpolation_alpha = find_linear_interpolation_alpha(float(interp_frame_index), interp_start_frame_index, interp_end_frame_index, sample_rounding_policy::none);
+#if defined(RTM_COMPILER_MSVC) && defined(RTM_ARCH_X86) && RTM_COMPILER_MSVC == RTM_COMPILER_MSVC_2015
+					// VS2015 fails to generate the right x86 assembly, branch instead
+					(void)calculate_error_impl;
+					const rtm::scalarf error = context.has_scale ? error_metric->calculate_error(calculate_error_args) : error_metric->calculate_error_no_scale(calculate_error_args);
+#else
+					const rtm::scalarf error = calculate_error_impl(error_metric, calculate_error_args);
+#endif
 
-						// Interpolate our transforms in local space before we convert or apply the additive and transform to object space
-						for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
-						{
-							// TODO: Implement qvv_lerp(..)
-							const rtm::quatf interp_rotation = rtm::quat_lerp(lossy_transforms_start[bone_index].rotation, lossy_transforms_end[bone_index].rotation, interpolation_alpha);
-							const rtm::vector4f interp_translation = rtm::vector_lerp(lossy_transforms_start[bone_index].translation, lossy_transforms_end[bone_index].translation, interpolation_alpha);
-							const rtm::vector4f interp_scale = rtm::vector_lerp(lossy_transforms_start[bone_index].scale, lossy_transforms_end[bone_index].scale, interpolation_alpha);
+					// Important transforms contribute more error, we retain their frames first
+					const rtm::scalarf weighted_error = rtm::scalar_mul(error, rtm::scalar_set(context.metadata[bone_index].importance));
 
-							context.lossy_local_pose[bone_index] = rtm::qvv_set(interp_rotation, interp_translation, interp_scale);
-						}
+					max_contributing_error = rtm::scalar_max(max_contributing_error, weighted_error);
+				}
+			}
 
-						// Convert to our object space representation
-						if (needs_conversion)
-						{
-							convert_transforms_args_lossy.sample_index = interp_frame_index;
-							convert_transforms_impl(error_metric, convert_transforms_args_lossy, context.local_transforms_converted);
-						}
+			const float max_contributing_errorf = rtm::scalar_cast(max_contributing_error);
 
-						if (has_additive_base)
-						{
-							apply_additive_to_base_args_lossy.base_transforms = base_transforms + (interp_frame_index * sample_transform_size);
+#if ACL_IMPL_DEBUG_CONTRIBUTING_ERROR
+			printf("    Error between frame [%u, %u] while testing %u: %f\n", interp_start_frame_index, interp_end_frame_index, frame_index, max_contributing_errorf);
+#endif
 
-							apply_additive_to_base_impl(error_metric, apply_additive_to_base_args_lossy, context.lossy_local_pose);
-						}
+			return max_contributing_errorf;
+		}
 
-						local_to_object_space_impl(error_metric, local_to_object_space_args_lossy, context.lossy_object_pose);
+		// The frames we evaluate in a single iteration of the contributing error search, shared by every job
+		struct contributing_error_batch
+		{
+			uint32_t frames_retained;
+			uint32_t num_frames;
 
-						// Calculate our error
-						const uint8_t* raw_frame_transform = raw_transform + (interp_frame_index * sample_transform_size);
+			uint32_t frame_indices[32];		// Always no more than 32 frames per segment
+			float errors[32];
 
-						for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
-						{
-							itransform_error_metric::calculate_error_args calculate_error_args;
-							calculate_error_args.transform0 = raw_frame_transform + (bone_index * context.metric_transform_size);
-							calculate_error_args.transform1 = context.lossy_object_pose + (bone_index * context.metric_transform_size);
+			std::atomic<uint32_t> next_frame_index;
+		};
 
-							const rigid_shell_metadata_t& transform_shell = context.shell_metadata_per_transform[bone_index];
-							calculate_error_args.construct_sphere_shell(transform_shell.local_shell_distance);
+		struct contributing_error_job
+		{
+			contributing_error_batch* batch;
+			quantization_context* worker_context;
+		};
 
-#if defined(RTM_COMPILER_MSVC) && defined(RTM_ARCH_X86) && RTM_COMPILER_MSVC == RTM_COMPILER_MSVC_2015
-							// VS2015 fails to generate the right x86 assembly, branch instead
-							(void)calculate_error_impl;
-							const rtm::scalarf error = context.has_scale ? error_metric->calculate_error(calculate_error_args) : error_metric->calculate_error_no_scale(calculate_error_args);
-#else
-							const rtm::scalarf error = calculate_error_impl(error_metric, calculate_error_args);
-#endif
+		inline void execute_contributing_error_job(void* job_data)
+		{
+			contributing_error_job& job = *static_cast<contributing_error_job*>(job_data);
+			contributing_error_batch& batch = *job.batch;
+			quantization_context& context = *job.worker_context;
 
-							max_contributing_error = rtm::scalar_max(max_contributing_error, error);
-						}
-					}
+			while (true)
+			{
+				const uint32_t batch_frame_index = batch.next_frame_index.fetch_add(1, std::memory_order_relaxed);
+				if (batch_frame_index >= batch.num_frames)
+					break;
+
+				batch.errors[batch_frame_index] = calculate_frame_contributing_error(context, batch.frames_retained, batch.frame_indices[batch_frame_index]);
+			}
+		}
+
+		inline void find_contributing_error(quantization_context& context)
+		{
+			ACL_ASSERT(context.num_samples <= 32, "Expected no more than 32 samples per track");
 
-					const float max_contributing_errorf = rtm::scalar_cast(max_contributing_error);
+			if (context.segment->contributing_error == nullptr)
+				context.segment->contributing_error = allocate_type_array<frame_contributing_error>(context.allocator, 32);	// Always no more than 32 frames per segment
+
+			const uint32_t num_frames = context.num_samples;
+			const bitset_description desc = bitset_description::make_from_num_bits<32>();
+			constexpr float infinity = std::numeric_limits<float>::infinity();
 
+			frame_contributing_error* contributing_error = context.segment->contributing_error;
+
+			// First and last frame of the segment cannot be removed and thus contribute infinite error
+			// TODO: We could retain only the first/last frames of the clip instead but it would mean interpolating
+			// with a frame from the previous/next segments
+			contributing_error[0] = frame_contributing_error{ 0, infinity };
+			contributing_error[num_frames - 1] = frame_contributing_error{ num_frames - 1, infinity };
+
+			prepare_contributing_error(context);
+
+			// When we have permutation workers, the frames we try to remove are evaluated in parallel
+			// Every worker shares our segment and bit rates to sample the same lossy transforms
+			const uint32_t num_workers = num_frames > 3 ? context.num_permutation_workers : 0;
+			contributing_error_job* jobs = nullptr;
+			if (num_workers != 0)
+			{
+				jobs = allocate_type_array<contributing_error_job>(context.allocator, num_workers);
+				for (uint32_t worker_index = 0; worker_index < num_workers; ++worker_index)
+				{
+					quantization_context& worker_context = context.permutation_workers[worker_index];
+					worker_context.set_segment(context);
+					std::memcpy(worker_context.bit_rate_per_bone, context.bit_rate_per_bone, sizeof(transform_bit_rates) * context.num_bones);
+					prepare_contributing_error(worker_context);
+
+					jobs[worker_index].worker_context = &worker_context;
+				}
+			}
+
+			contributing_error_batch batch;
+			batch.frames_retained = ~0U;	// By default, every frame is present
+
+			for (uint32_t worker_index = 0; worker_index < num_workers; ++worker_index)
+				jobs[worker_index].batch = &batch;
+
+			// We iterate until every frame but the first and last have been removed
+			for (uint32_t iteration_count = 1; iteration_count < num_frames - 1; ++iteration_count)
+			{
 #if ACL_IMPL_DEBUG_CONTRIBUTING_ERROR
-					printf("    Error between frame [%u, %u] while testing %u: %f\n", interp_start_frame_index, interp_end_frame_index, frame_index, max_contributing_errorf);
+				printf("Contributing error for segment %u (%u frames), iteration %u ...\n", context.segment->segment_index, num_frames, iteration_count);
 #endif
 
-					// If our current frame's contributing error is lowest, it is the best candidate for removal
-					if (max_contributing_errorf < best_error.error)
-						best_error = frame_contributing_error{ frame_index, max_contributing_errorf };
+				// Gather every frame we can still remove, skip the first and last
+				batch.num_frames = 0;
+				for (uint32_t frame_index = 1; frame_index < num_frames - 1; ++frame_index)
+				{
+					// We'll attempt to remove the current frame if it hasn't been removed already
+					if (bitset_test(&batch.frames_retained, desc, frame_index))
+						batch.frame_indices[batch.num_frames++] = frame_index;
+				}
+
+				// Calculate how much error each frame contributes as we remove them
+				if (num_workers != 0 && batch.num_frames > 1)
+				{
+					const compression_job_scheduler& job_scheduler = *context.permutation_job_scheduler;
+					batch.next_frame_index.store(0, std::memory_order_relaxed);
+
+					const uint32_t num_jobs = std::min<uint32_t>(num_workers, batch.num_frames);
+					for (uint32_t job_index = 0; job_index < num_jobs; ++job_index)
+						job_scheduler.submit_job(job_scheduler.user_data, &execute_contributing_error_job, &jobs[job_index]);
+
+					job_scheduler.wait_for_jobs(job_scheduler.user_data);
+				}
+				else
+				{
+					for (uint32_t batch_frame_index = 0; batch_frame_index < batch.num_frames; ++batch_frame_index)
+						batch.errors[batch_frame_index] = calculate_frame_contributing_error(context, batch.frames_retained, batch.frame_indices[batch_frame_index]);
+				}
+
+				// If a frame's contributing error is lowest, it is the best candidate for removal
+				// Frames are reduced in order which yields the same result as the serial search
+				frame_contributing_error best_error{ num_frames, infinity };
+				for (uint32_t batch_frame_index = 0; batch_frame_index < batch.num_frames; ++batch_frame_index)
+				{
+					if (batch.errors[batch_frame_index] < best_error.error)
+						best_error = frame_contributing_error{ batch.frame_indices[batch_frame_index], batch.errors[batch_frame_index] };
 				}
 
 				ACL_ASSERT(best_error.index != num_frames, "Failed to find the best contributing error");
@@ -1791,95 +2783,264 @@ namespace acl
 
 				// We found the best frame to remove, remove it
 				contributing_error[best_error.index] = best_error;
-				bitset_set(&frames_retained, desc, best_error.index, false);
+				bitset_set(&batch.frames_retained, desc, best_error.index, false);
 			}
 
+			deallocate_type_array(context.allocator, jobs, num_workers);
+
 			// We found the contributing error for every frame, sort them by lowest error first
 			auto sort_predicate = [](const frame_contributing_error& lhs, const frame_contributing_error& rhs) { return lhs.error < rhs.error; };
 			std::sort(contributing_error, contributing_error + num_frames, sort_predicate);
 		}
 
-		inline void quantize_streams(iallocator& allocator, clip_context& clip, const compression_settings& settings, const clip_context& raw_clip_context, const clip_context& additive_base_clip_context, const output_stats& out_stats)
+		inline void quantize_segment(quantization_context& context, segment_context& segment, bool is_any_variable, bool include_contributing_error)
 		{
-			(void)out_stats;
-
-			if (clip.num_bones == 0)
-				return;
-
-			const bool is_rotation_variable = is_rotation_format_variable(settings.rotation_format);
-			const bool is_translation_variable = is_vector_format_variable(settings.translation_format);
-			const bool is_scale_variable = is_vector_format_variable(settings.scale_format);
-			const bool is_any_variable = is_rotation_variable || is_translation_variable || is_scale_variable;
-
-			quantization_context context(allocator, clip, raw_clip_context, additive_base_clip_context, settings);
-
-			for (segment_context& segment : clip.segment_iterator())
-			{
 #if ACL_IMPL_DEBUG_VARIABLE_QUANTIZATION >= ACL_IMPL_DEBUG_LEVEL_SUMMARY_ONLY
-				printf("Quantizing segment %u...\n", segment.segment_index);
+			printf("Quantizing segment %u...\n", segment.segment_index);
 #endif
 
 #if ACL_IMPL_PROFILE_MATH
-				{
-					scope_profiler timer;
+			{
+				scope_profiler timer;
 
-					for (int32_t i = 0; i < 10; ++i)
-					{
-						context.set_segment(segment);
+				for (int32_t i = 0; i < 10; ++i)
+				{
+					context.set_segment(segment);
 
-						if (is_any_variable)
-							find_optimal_bit_rates(context);
-					}
+					if (is_any_variable)
+						find_optimal_bit_rates(context);
+				}
 
-					timer.stop();
+				timer.stop();
 
 #if defined(__ANDROID__)
-					__android_log_print(ANDROID_LOG_INFO, "acl", "Quantization optimization for segment %u took: %.4f ms", segment.segment_index, timer.get_elapsed_milliseconds());
+				__android_log_print(ANDROID_LOG_INFO, "acl", "Quantization optimization for segment %u took: %.4f ms", segment.segment_index, timer.get_elapsed_milliseconds());
 #else
-					printf("Quantization optimization for segment %u took: %.4f ms\n", segment.segment_index, timer.get_elapsed_milliseconds());
+				printf("Quantization optimization for segment %u took: %.4f ms\n", segment.segment_index, timer.get_elapsed_milliseconds());
 #endif
-				}
+			}
 #endif
 
-				context.set_segment(segment);
+			// Every segment owns its profiler, this remains safe when quantizing in parallel
+			scope_compression_stage segment_stage(segment.profiler, compression_stage::quantize_segment);
 
-				// If we use a variable bit rate, run our optimization algorithm to find the optimal bit rates
-				if (is_any_variable)
-					find_optimal_bit_rates(context);
+			context.set_segment(segment);
 
-				// If we need the contributing error of each frame, find it now before we quantize
-				if (settings.metadata.include_contributing_error)
-					find_contributing_error(context);
+			// If we use a variable bit rate, run our optimization algorithm to find the optimal bit rates
+			if (is_any_variable)
+			{
+				scope_compression_stage stage(segment.profiler, compression_stage::find_optimal_bit_rates);
+				find_optimal_bit_rates(context);
+			}
+
+			// If we need the contributing error of each frame, find it now before we quantize
+			if (include_contributing_error)
+			{
+				scope_compression_stage stage(segment.profiler, compression_stage::find_contributing_error);
+				find_contributing_error(context);
+			}
 
-				// Quantize our streams now that we found the optimal bit rates
+			// Quantize our streams now that we found the optimal bit rates
+			{
+				scope_compression_stage stage(segment.profiler, compression_stage::quantize_all_streams);
 				quantize_all_streams(context);
 			}
+		}
+
+		// State shared by every job quantizing segments in parallel
+		struct quantize_segments_job_context
+		{
+			iallocator* allocator;
+			clip_context* clip;
+			const compression_settings* settings;
+			const clip_context* raw_clip_context;
+			const clip_context* additive_base_clip_context;
+			const bit_rate_hint* warm_start_hint;
+
+			std::atomic<uint32_t> next_run_index;
+			std::atomic<uint32_t> num_quantized_segments;
+			bool is_any_variable;
+			bool include_contributing_error;
+		};
+
+		// Each job has its own quantization context scratch and pulls runs of segments until none remain
+		struct quantize_segments_job
+		{
+			quantize_segments_job_context* job_context;
+			size_t bit_rate_database_size;
+		};
+
+		inline void execute_quantize_segments_job(void* job_data)
+		{
+			quantize_segments_job& job = *static_cast<quantize_segments_job*>(job_data);
+			quantize_segments_job_context& job_context = *job.job_context;
+			clip_context& clip = *job_context.clip;
+
+			quantization_context context(*job_context.allocator, clip, *job_context.raw_clip_context, *job_context.additive_base_clip_context, *job_context.settings);
+			context.warm_start_hint = job_context.warm_start_hint;
+			job.bit_rate_database_size = context.bit_rate_database.get_allocated_size();
+
+			while (true)
+			{
+				const compression_progress& progress = job_context.settings->progress;
+				if (progress.is_cancelled())
+					break;
+
+				// Segments within a run are quantized in order, each one seeds the bit rates of the next
+				const uint32_t run_index = job_context.next_run_index.fetch_add(1, std::memory_order_relaxed);
+				const uint32_t first_segment_index = run_index * k_num_segments_per_seed_run;
+				if (first_segment_index >= clip.num_segments)
+					break;
+
+				const uint32_t end_segment_index = std::min<uint32_t>(first_segment_index + k_num_segments_per_seed_run, clip.num_segments);
+				for (uint32_t segment_index = first_segment_index; segment_index < end_segment_index; ++segment_index)
+				{
+					if (progress.is_cancelled())
+						break;
+
+					quantize_segment(context, clip.segments[segment_index], job_context.is_any_variable, job_context.include_contributing_error);
+
+					const uint32_t num_quantized_segments = job_context.num_quantized_segments.fetch_add(1, std::memory_order_relaxed) + 1;
+					report_quantization_progress(progress, num_quantized_segments, clip.num_segments);
+				}
+			}
+		}
 
 #if defined(ACL_USE_SJSON)
+		inline void write_quantization_stats(const clip_context& clip, const compression_settings& settings, size_t bit_rate_database_size, uint32_t num_bit_rate_databases, const output_stats& out_stats)
+		{
 			if (are_all_enum_flags_set(out_stats.logging, stat_logging::detailed))
 			{
+				const uint32_t num_bones = clip.num_bones;
+				const uint32_t num_samples = clip.segments->num_samples;
+				const bool needs_conversion = settings.error_metric->needs_conversion(clip.has_scale);
+				const size_t metric_transform_size = settings.error_metric->get_transform_size(clip.has_scale);
+
 				sjson::ObjectWriter& writer = *out_stats.writer;
-				writer["track_bit_rate_database_size"] = static_cast<uint32_t>(context.bit_rate_database.get_allocated_size());
+				writer["track_bit_rate_database_size"] = static_cast<uint32_t>(bit_rate_database_size);
+				writer["track_bit_rate_database_peak_size"] = static_cast<uint32_t>(bit_rate_database_size * num_bit_rate_databases);
 
 				size_t transform_cache_size = 0;
-				transform_cache_size += sizeof(rtm::qvvf) * context.num_bones;	// raw_local_pose
-				transform_cache_size += sizeof(rtm::qvvf) * context.num_bones;	// lossy_local_pose
-				transform_cache_size += context.metric_transform_size * context.num_bones;	// lossy_object_pose
-				transform_cache_size += context.metric_transform_size * context.num_bones * context.clip.segments->num_samples;	// raw_local_transforms
-				transform_cache_size += context.metric_transform_size * context.num_bones * context.clip.segments->num_samples;	// raw_object_transforms
+				transform_cache_size += sizeof(rtm::qvvf) * num_bones;	// raw_local_pose
+				transform_cache_size += sizeof(rtm::qvvf) * num_bones;	// lossy_local_pose
+				transform_cache_size += metric_transform_size * num_bones;	// lossy_object_pose
+				transform_cache_size += metric_transform_size * k_num_error_batch_samples;	// lossy_object_transforms_batch
+				transform_cache_size += metric_transform_size * num_bones * num_samples;	// raw_local_transforms
+				transform_cache_size += metric_transform_size * num_bones * num_samples;	// raw_object_transforms
 
-				if (context.needs_conversion)
-					transform_cache_size += context.metric_transform_size * context.num_bones;	// local_transforms_converted
+				if (needs_conversion)
+					transform_cache_size += metric_transform_size * num_bones;	// local_transforms_converted
 
-				if (context.has_additive_base)
+				if (clip.has_additive_base)
 				{
-					transform_cache_size += sizeof(rtm::qvvf) * context.num_bones;	// additive_local_pose
-					transform_cache_size += context.metric_transform_size * context.num_bones * context.clip.segments->num_samples;	// base_local_transforms
-					transform_cache_size += context.metric_transform_size * context.num_bones * context.clip.segments->num_samples;	// base_object_transforms
+					transform_cache_size += sizeof(rtm::qvvf) * num_bones;	// additive_local_pose
+					transform_cache_size += metric_transform_size * num_bones * num_samples;	// base_local_transforms
+					transform_cache_size += metric_transform_size * num_bones * num_samples;	// base_object_transforms
 				}
 
 				writer["transform_cache_size"] = static_cast<uint32_t>(transform_cache_size);
 			}
+		}
+#endif
+
+		inline void quantize_streams(iallocator& allocator, clip_context& clip, const compression_settings& settings, const clip_context& raw_clip_context, const clip_context& additive_base_clip_context, output_stats& out_stats)
+		{
+			if (clip.num_bones == 0)
+				return;
+
+			const bool is_rotation_variable = is_rotation_format_variable(settings.rotation_format);
+			const bool is_translation_variable = is_vector_format_variable(settings.translation_format);
+			const bool is_scale_variable = is_vector_format_variable(settings.scale_format);
+			const bool is_any_variable = is_rotation_variable || is_translation_variable || is_scale_variable;
+			const bool include_contributing_error = settings.metadata.include_contributing_error;
+
+			size_t bit_rate_database_size = 0;
+			uint32_t num_bit_rate_databases = 0;	// Every job and permutation worker has its own and they are all alive at once
+
+			// Previous bit rates are only used when the hint matches our layout
+			const bit_rate_hint hint(allocator, clip, settings);
+			const bit_rate_hint* warm_start_hint = is_any_variable && hint.is_enabled() ? &hint : nullptr;
+
+			// When we have fewer segments than jobs, the permutation search and the contributing error search within
+			// each segment are parallelized instead
+			// We don't do both at once since jobs cannot wait on other jobs
+			const compression_job_scheduler& job_scheduler = settings.job_scheduler;
+			const bool use_parallel_permutations = job_scheduler.is_enabled()
+				&& ((is_any_variable && settings.level >= compression_level8::high) || include_contributing_error)
+				&& job_scheduler.max_num_jobs > 1 && clip.num_segments < job_scheduler.max_num_jobs;
+			const uint32_t num_seed_runs = (clip.num_segments + k_num_segments_per_seed_run - 1) / k_num_segments_per_seed_run;
+			const bool use_parallel_segments = job_scheduler.is_enabled() && num_seed_runs > 1 && !use_parallel_permutations;
+
+			if (use_parallel_segments)
+			{
+				// Runs of segments are independent, quantize them in parallel
+				// Each job allocates its own scratch memory which is why we cap how many we submit
+				const uint32_t max_num_jobs = job_scheduler.max_num_jobs != 0 ? job_scheduler.max_num_jobs : num_seed_runs;
+				const uint32_t num_jobs = std::min<uint32_t>(max_num_jobs, num_seed_runs);
+
+				quantize_segments_job_context job_context;
+				job_context.allocator = &allocator;
+				job_context.clip = &clip;
+				job_context.settings = &settings;
+				job_context.raw_clip_context = &raw_clip_context;
+				job_context.additive_base_clip_context = &additive_base_clip_context;
+				job_context.warm_start_hint = warm_start_hint;
+				job_context.next_run_index.store(0, std::memory_order_relaxed);
+				job_context.num_quantized_segments.store(0, std::memory_order_relaxed);
+				job_context.is_any_variable = is_any_variable;
+				job_context.include_contributing_error = include_contributing_error;
+
+				quantize_segments_job* jobs = allocate_type_array<quantize_segments_job>(allocator, num_jobs);
+				for (uint32_t job_index = 0; job_index < num_jobs; ++job_index)
+				{
+					jobs[job_index].job_context = &job_context;
+					jobs[job_index].bit_rate_database_size = 0;
+
+					job_scheduler.submit_job(job_scheduler.user_data, &execute_quantize_segments_job, &jobs[job_index]);
+				}
+
+				job_scheduler.wait_for_jobs(job_scheduler.user_data);
+
+				// Every job has the same scratch layout
+				bit_rate_database_size = jobs[0].bit_rate_database_size;
+				num_bit_rate_databases = num_jobs;
+
+				deallocate_type_array(allocator, jobs, num_jobs);
+			}
+			else
+			{
+				quantization_context context(allocator, clip, raw_clip_context, additive_base_clip_context, settings);
+				context.warm_start_hint = warm_start_hint;
+
+				// Each permutation worker has its own scratch memory
+				const uint32_t num_permutation_workers = use_parallel_permutations ? job_scheduler.max_num_jobs : 0;
+				if (use_parallel_permutations)
+				{
+					context.permutation_job_scheduler = &job_scheduler;
+					context.permutation_workers = allocate_type_array<quantization_context>(allocator, num_permutation_workers, allocator, clip, raw_clip_context, additive_base_clip_context, settings);
+					context.num_permutation_workers = num_permutation_workers;
+				}
+
+				for (segment_context& segment : clip.segment_iterator())
+				{
+					if (settings.progress.is_cancelled())
+						break;
+
+					quantize_segment(context, segment, is_any_variable, include_contributing_error);
+					report_quantization_progress(settings.progress, segment.segment_index + 1, clip.num_segments);
+				}
+
+				bit_rate_database_size = context.bit_rate_database.get_allocated_size();
+				num_bit_rate_databases = 1 + num_permutation_workers;
+
+				deallocate_type_array(allocator, context.permutation_workers, num_permutation_workers);
+			}
+
+			if (are_any_enum_flags_set(out_stats.logging, stat_logging::memory))
+				out_stats.memory.bit_rate_database_size = uint64_t(bit_rate_database_size) * num_bit_rate_databases;
+
+#if defined(ACL_USE_SJSON)
+			write_quantization_stats(clip, settings, bit_rate_database_size, num_bit_rate_databases, out_stats);
 #endif
 		}
 	}
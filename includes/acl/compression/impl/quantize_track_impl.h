@@ -28,11 +28,14 @@
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/track_types.h"
 #include "acl/core/impl/variable_bit_rates.h"
+#include "acl/compression/compression_settings.h"
 #include "acl/compression/impl/track_list_context.h"
 
 #include <rtm/mask4i.h>
 #include <rtm/vector4f.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 
 ACL_IMPL_FILE_PRAGMA_PUSH
@@ -104,6 +107,53 @@ namespace acl
 			vector4f raw_sample = zero;
 			uint8_t best_bit_rate = k_highest_bit_rate;	// Default to raw if we fail to find something better
 
+			// Segmented tracks undo their segment range before their track range
+			const bool is_segmented = context.is_segmented();
+			const uint32_t num_samples_per_segment = context.num_samples_per_segment;
+			const uint32_t num_tracks = context.num_tracks;
+
+			// Tracks with a single component measure the error of 4 samples at once.
+			// We gather their samples once in contiguous buffers, the padding samples have no error.
+			const bool is_float1f = ref_element_size == sizeof(float);
+			const uint32_t num_padded_samples = is_float1f ? align_to(num_samples, 4U) : 0;
+			const uint32_t num_buffers = is_segmented ? 4 : 2;
+			float* raw_values = is_float1f ? allocate_type_array_aligned<float>(*context.allocator, size_t(num_padded_samples) * num_buffers, 16) : nullptr;
+			float* normalized_values = is_float1f ? (raw_values + num_padded_samples) : nullptr;
+			float* segment_range_min_values = is_float1f && is_segmented ? (normalized_values + num_padded_samples) : nullptr;
+			float* segment_range_extent_values = is_float1f && is_segmented ? (segment_range_min_values + num_padded_samples) : nullptr;
+
+			if (is_float1f)
+			{
+				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+				{
+					std::memcpy(&raw_values[sample_index], ref_track[sample_index], sizeof(float));
+					normalized_values[sample_index] = vector_get_x(mut_track[sample_index]);
+
+					if (is_segmented)
+					{
+						const scalarf_range& segment_range = context.segment_range_list[((sample_index / num_samples_per_segment) * num_tracks) + track_index].range.scalarf;
+						segment_range_min_values[sample_index] = vector_get_x(segment_range.get_min());
+						segment_range_extent_values[sample_index] = vector_get_x(segment_range.get_extent());
+					}
+				}
+
+				for (uint32_t sample_index = num_samples; sample_index < num_padded_samples; ++sample_index)
+				{
+					raw_values[sample_index] = vector_get_x(range_min);
+					normalized_values[sample_index] = 0.0F;
+
+					if (is_segmented)
+					{
+						segment_range_min_values[sample_index] = 0.0F;
+						segment_range_extent_values[sample_index] = 0.0F;
+					}
+				}
+			}
+
+			const vector4f precision_x4 = vector_set(mut_track.get_description().precision);
+			const vector4f range_min_x4 = vector_set(vector_get_x(range_min));
+			const vector4f range_extent_x4 = vector_set(vector_get_x(range_extent));
+
 			// First we look for the best bit rate possible that keeps us within our precision target
 			for (uint8_t bit_rate = k_highest_bit_rate - 1; bit_rate != 0; --bit_rate)	// Skip the raw bit rate and the constant bit rate
 			{
@@ -111,24 +161,55 @@ namespace acl
 				const quantization_scales scales(num_bits_at_bit_rate);
 
 				bool is_error_to_high = false;
-				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+				if (is_float1f)
 				{
-					std::memcpy(&raw_sample, ref_track[sample_index], ref_element_size);
+					for (uint32_t sample_index = 0; sample_index < num_padded_samples; sample_index += 4)
+					{
+						const vector4f raw_samples = vector_load(&raw_values[sample_index]);
+						const vector4f normalized_samples = vector_load(&normalized_values[sample_index]);
+
+						// Decay our values through quantization and undo normalization
+						vector4f decayed_normalized_samples = decay_vector4_uXX(normalized_samples, scales);
+						if (is_segmented)
+							decayed_normalized_samples = vector_mul_add(decayed_normalized_samples, vector_load(&segment_range_extent_values[sample_index]), vector_load(&segment_range_min_values[sample_index]));
+
+						const vector4f decayed_samples = vector_mul_add(decayed_normalized_samples, range_extent_x4, range_min_x4);
+
+						const vector4f delta = vector_abs(vector_sub(raw_samples, decayed_samples));
+						if (!vector_all_less_equal(delta, precision_x4))
+						{
+							is_error_to_high = true;
+							break;
+						}
+					}
+				}
+				else
+				{
+					for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+					{
+						std::memcpy(&raw_sample, ref_track[sample_index], ref_element_size);
 
-					const vector4f normalized_sample = mut_track[sample_index];
+						const vector4f normalized_sample = mut_track[sample_index];
 
-					// Decay our value through quantization
-					const vector4f decayed_normalized_sample = decay_vector4_uXX(normalized_sample, scales);
+						// Decay our value through quantization
+						vector4f decayed_normalized_sample = decay_vector4_uXX(normalized_sample, scales);
 
-					// Undo normalization
-					const vector4f decayed_sample = vector_mul_add(decayed_normalized_sample, range_extent, range_min);
+						if (is_segmented)
+						{
+							const scalarf_range& segment_range = context.segment_range_list[((sample_index / num_samples_per_segment) * num_tracks) + track_index].range.scalarf;
+							decayed_normalized_sample = vector_mul_add(decayed_normalized_sample, segment_range.get_extent(), segment_range.get_min());
+						}
 
-					const vector4f delta = vector_abs(vector_sub(raw_sample, decayed_sample));
-					const vector4f masked_delta = vector_select(sample_mask, delta, zero);
-					if (!vector_all_less_equal(masked_delta, precision))
-					{
-						is_error_to_high = true;
-						break;
+						// Undo normalization
+						const vector4f decayed_sample = vector_mul_add(decayed_normalized_sample, range_extent, range_min);
+
+						const vector4f delta = vector_abs(vector_sub(raw_sample, decayed_sample));
+						const vector4f masked_delta = vector_select(sample_mask, delta, zero);
+						if (!vector_all_less_equal(masked_delta, precision))
+						{
+							is_error_to_high = true;
+							break;
+						}
 					}
 				}
 
@@ -139,6 +220,8 @@ namespace acl
 				best_bit_rate = bit_rate;
 			}
 
+			deallocate_type_array(*context.allocator, raw_values, size_t(num_padded_samples) * num_buffers);
+
 			context.bit_rate_list[track_index].scalar.value = best_bit_rate;
 
 			// Done, update our track with the final result
@@ -159,29 +242,73 @@ namespace acl
 			}
 		}
 
-		inline void quantize_tracks(track_list_context& context)
+		inline void quantize_track(track_list_context& context, uint32_t track_index)
+		{
+			const bool is_track_constant = context.is_constant(track_index);
+			if (is_track_constant)
+				return;	// Constant tracks don't need to be modified
+
+			const track_range& range = context.range_list[track_index];
+
+			switch (range.category)
+			{
+			case track_category8::scalarf:
+				quantize_scalarf_track(context, track_index);
+				break;
+			default:
+				ACL_ASSERT(false, "Invalid track category");
+				break;
+			}
+		}
+
+		// State shared by every job quantizing tracks in parallel
+		struct quantize_tracks_job_context
+		{
+			track_list_context* context;
+			std::atomic<uint32_t> next_track_index;
+		};
+
+		// Tracks are independent, each job pulls tracks until none remain
+		inline void execute_quantize_tracks_job(void* job_data)
+		{
+			quantize_tracks_job_context& job_context = *static_cast<quantize_tracks_job_context*>(job_data);
+			track_list_context& context = *job_context.context;
+
+			while (true)
+			{
+				const uint32_t track_index = job_context.next_track_index.fetch_add(1, std::memory_order_relaxed);
+				if (track_index >= context.num_tracks)
+					break;
+
+				quantize_track(context, track_index);
+			}
+		}
+
+		inline void quantize_tracks(track_list_context& context, const compression_job_scheduler& job_scheduler)
 		{
 			ACL_ASSERT(context.is_valid(), "Invalid context");
 
 			context.bit_rate_list = allocate_type_array<track_bit_rate>(*context.allocator, context.num_tracks);
 
-			for (uint32_t track_index = 0; track_index < context.num_tracks; ++track_index)
+			if (job_scheduler.is_enabled() && context.num_tracks > 1)
 			{
-				const bool is_track_constant = context.is_constant(track_index);
-				if (is_track_constant)
-					continue;	// Constant tracks don't need to be modified
+				const uint32_t max_num_jobs = job_scheduler.max_num_jobs != 0 ? job_scheduler.max_num_jobs : context.num_tracks;
+				const uint32_t num_jobs = std::min<uint32_t>(max_num_jobs, context.num_tracks);
 
-				const track_range& range = context.range_list[track_index];
+				quantize_tracks_job_context job_context;
+				job_context.context = &context;
+				job_context.next_track_index.store(0, std::memory_order_relaxed);
 
-				switch (range.category)
-				{
-				case track_category8::scalarf:
-					quantize_scalarf_track(context, track_index);
-					break;
-				default:
-					ACL_ASSERT(false, "Invalid track category");
-					break;
-				}
+				// Every job shares the same context, they have no scratch of their own
+				for (uint32_t job_index = 0; job_index < num_jobs; ++job_index)
+					job_scheduler.submit_job(job_scheduler.user_data, &execute_quantize_tracks_job, &job_context);
+
+				job_scheduler.wait_for_jobs(job_scheduler.user_data);
+			}
+			else
+			{
+				for (uint32_t track_index = 0; track_index < context.num_tracks; ++track_index)
+					quantize_track(context, track_index);
 			}
 		}
 	}
@@ -0,0 +1,216 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/track_desc.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/impl/debug_track_writer.h"
+#include "acl/compression/compression_settings.h"
+#include "acl/compression/track_array.h"
+#include "acl/compression/track_error.h"
+#include "acl/compression/transform_error_metrics.h"
+
+#include <rtm/scalarf.h>
+
+#include <cstdint>
+#include <utility>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		// The largest reduction factor we attempt, e.g. 120 Hz down to 15 Hz
+		constexpr uint32_t k_max_sample_rate_reduction_factor = 8;
+
+		// Returns whether or not a track list can be resampled by keeping one sample out of 'factor'
+		// while retaining its duration.
+		inline bool is_sample_rate_reduction_factor_valid(const track_array_qvvf& track_list, uint32_t factor)
+		{
+			const uint32_t num_samples = track_list.get_num_samples_per_track();
+			if (num_samples < 3)
+				return false;	// Nothing to reduce
+
+			// With wrapping, the last sample interpolates towards the first and it must remain a multiple
+			const uint32_t num_intervals = track_list.get_looping_policy() == sample_looping_policy::wrap ? num_samples : (num_samples - 1);
+			if (num_intervals % factor != 0)
+				return false;
+
+			// We need at least two samples to interpolate
+			const uint32_t num_reduced_samples = (num_samples + factor - 1) / factor;
+			return num_reduced_samples >= 2;
+		}
+
+		// Creates a track list that references every 'factor' sample of the provided track list.
+		// No sample is copied, the reduced track list must not outlive the original.
+		inline track_array_qvvf make_reduced_sample_rate_track_list(iallocator& allocator, const track_array_qvvf& track_list, uint32_t factor)
+		{
+			const uint32_t num_tracks = track_list.get_num_tracks();
+			const uint32_t num_samples = track_list.get_num_samples_per_track();
+			const uint32_t num_reduced_samples = (num_samples + factor - 1) / factor;
+			const float reduced_sample_rate = track_list.get_sample_rate() / float(factor);
+
+			track_array_qvvf reduced_track_list(allocator, num_tracks);
+			reduced_track_list.set_looping_policy(track_list.get_looping_policy());
+			reduced_track_list.set_name(track_list.get_name());
+
+			for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			{
+				const track_qvvf& track_ = track_list[track_index];
+
+				// The track samples are never modified, we only reference them with a larger stride
+				rtm::qvvf* samples = const_cast<rtm::qvvf*>(&track_[0]);
+				const uint32_t stride = track_.get_stride() * factor;
+
+				track_qvvf reduced_track = track_qvvf::make_ref(track_.get_description(), samples, num_reduced_samples, reduced_sample_rate, stride);
+				reduced_track.set_name(track_.get_name());
+
+				reduced_track_list[track_index] = std::move(reduced_track);
+			}
+
+			return reduced_track_list;
+		}
+
+		// Measures the worst error between a track list and its reduced version interpolated at the original sample times.
+		inline track_error calculate_sample_rate_reduction_error(iallocator& allocator, const track_array_qvvf& track_list, const track_array_qvvf& reduced_track_list,
+			const compression_settings& settings, const track_array_qvvf* additive_base_track_list)
+		{
+			struct error_calculation_adapter final : public ierror_calculation_adapter
+			{
+				const track_array_qvvf& raw_tracks_;
+				const track_array_qvvf& reduced_tracks_;
+				const track_array_qvvf* additive_base_tracks_;
+
+				error_calculation_adapter(const track_array_qvvf& raw_tracks__, const track_array_qvvf& reduced_tracks__, const track_array_qvvf* additive_base_tracks__)
+					: raw_tracks_(raw_tracks__)
+					, reduced_tracks_(reduced_tracks__)
+					, additive_base_tracks_(additive_base_tracks__)
+				{
+				}
+
+				virtual void sample_tracks0(float sample_time, sample_rounding_policy rounding_policy, debug_track_writer& track_writer) override
+				{
+					raw_tracks_.sample_tracks(sample_time, rounding_policy, track_writer);
+				}
+
+				virtual void sample_tracks1(float sample_time, sample_rounding_policy rounding_policy, debug_track_writer& track_writer) override
+				{
+					// The removed samples are interpolated, exactly like they will be when decompressing
+					(void)rounding_policy;
+					reduced_tracks_.sample_tracks(sample_time, sample_rounding_policy::none, track_writer);
+				}
+
+				virtual uint32_t get_output_index(uint32_t track_index) override
+				{
+					return raw_tracks_[track_index].get_description().output_index;
+				}
+
+				virtual uint32_t get_parent_index(uint32_t track_index) override
+				{
+					return raw_tracks_[track_index].get_description().parent_index;
+				}
+
+				virtual float get_shell_distance(uint32_t track_index) override
+				{
+					return raw_tracks_[track_index].get_description().shell_distance;
+				}
+
+				virtual bool has_additive_base() const override { return additive_base_tracks_ != nullptr; }
+				virtual void sample_tracks_base(float sample_time, sample_rounding_policy rounding_policy, debug_track_writer& track_writer) override
+				{
+					additive_base_tracks_->sample_tracks(sample_time, rounding_policy, track_writer);
+				}
+			};
+
+			error_calculation_adapter adapter(track_list, reduced_track_list, additive_base_track_list);
+
+			calculate_track_error_args args(adapter);
+			args.num_samples = track_list.get_num_samples_per_track();
+			args.num_tracks = track_list.get_num_tracks();
+			args.duration = track_list.get_finite_duration();
+			args.sample_rate = track_list.get_sample_rate();
+			args.track_type = track_type8::qvvf;
+			args.rounding_policy = sample_rounding_policy::nearest;
+			args.error_metric = settings.error_metric;
+
+			if (additive_base_track_list != nullptr)
+			{
+				args.base_num_samples = additive_base_track_list->get_num_samples_per_track();
+				args.base_duration = additive_base_track_list->get_finite_duration();
+			}
+
+			return calculate_transform_track_error(allocator, args);
+		}
+
+		// Returns the largest factor by which the sample rate can be divided while the resampling
+		// error remains under half the precision of every track. The other half of the error budget
+		// remains for quantization since its error is measured against the resampled clip.
+		// Factors are tried in increasing order and the search stops at the first that fails.
+		// Returns 1 if the sample rate cannot be reduced.
+		inline uint32_t find_sample_rate_reduction_factor(iallocator& allocator, const track_array_qvvf& track_list, const compression_settings& settings,
+			const track_array_qvvf* additive_base_track_list)
+		{
+			float min_precision = -1.0F;
+			for (const track_qvvf& track_ : track_list)
+			{
+				const track_desc_transformf& desc = track_.get_description();
+				if (desc.output_index == k_invalid_track_index)
+					continue;	// Stripped
+
+				min_precision = min_precision < 0.0F ? desc.precision : rtm::scalar_min(min_precision, desc.precision);
+			}
+
+			if (min_precision <= 0.0F)
+				return 1;	// Nothing to output or lossless
+
+			const float error_threshold = min_precision * 0.5F;
+
+			uint32_t best_factor = 1;
+			for (uint32_t factor = 2; factor <= k_max_sample_rate_reduction_factor; ++factor)
+			{
+				if (!is_sample_rate_reduction_factor_valid(track_list, factor))
+					continue;
+
+				const track_array_qvvf reduced_track_list = make_reduced_sample_rate_track_list(allocator, track_list, factor);
+				const track_error error = calculate_sample_rate_reduction_error(allocator, track_list, reduced_track_list, settings, additive_base_track_list);
+				if (error.error > error_threshold)
+					break;
+
+				best_factor = factor;
+			}
+
+			return best_factor;
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -31,7 +31,10 @@
 #include "acl/compression/impl/sample_streams.h"
 
 #include <rtm/qvvf.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
 
+#include <algorithm>
 #include <cstdint>
 
 ACL_IMPL_FILE_PRAGMA_PUSH
@@ -42,140 +45,153 @@ namespace acl
 
 	namespace acl_impl
 	{
-		// We use the raw data to compute the rigid shell
-		// For each transform, its rigid shell is formed by the dominant joint (itself or a child)
-		// We compute the largest value over the whole clip per transform
-		inline rigid_shell_metadata_t* compute_clip_shell_distances(iallocator& allocator, const clip_context& raw_clip_context, const clip_context& additive_base_clip_context)
-		{
-			const uint32_t num_transforms = raw_clip_context.num_bones;
-			if (num_transforms == 0)
-				return nullptr;	// No transforms present, no shell distances
-
-			const uint32_t num_samples = raw_clip_context.num_samples;
-			if (num_samples == 0)
-				return nullptr;	// No samples present, no shell distances
-
-			const segment_context& raw_segment = raw_clip_context.segments[0];
-			const bool has_additive_base = raw_clip_context.has_additive_base;
-
-			rigid_shell_metadata_t* shell_metadata = allocate_type_array<rigid_shell_metadata_t>(allocator, num_transforms);
-
-			// Initialize everything
-			for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
-			{
-				const transform_metadata& metadata = raw_clip_context.metadata[transform_index];
-
-				shell_metadata[transform_index].local_shell_distance = metadata.shell_distance;
-				shell_metadata[transform_index].precision = metadata.precision;
-				shell_metadata[transform_index].parent_shell_distance = 0.0F;
-			}
-
-			// Iterate from leaf transforms towards their root, we want to bubble up our shell distance
-			for (const uint32_t transform_index : make_reverse_iterator(raw_clip_context.sorted_transforms_parent_first, num_transforms))
-			{
-				const transform_streams& raw_bone_stream = raw_segment.bone_streams[transform_index];
-
-				rigid_shell_metadata_t& shell = shell_metadata[transform_index];
-
-				// Use the accumulated shell distance so far to see how far it deforms with our local transform
-				const rtm::vector4f vtx0 = rtm::vector_set(shell.local_shell_distance, 0.0F, 0.0F);
-				const rtm::vector4f vtx1 = rtm::vector_set(0.0F, shell.local_shell_distance, 0.0F);
-				const rtm::vector4f vtx2 = rtm::vector_set(0.0F, 0.0F, shell.local_shell_distance);
-
-				// Calculate the shell distance in parent space
-				rtm::scalarf parent_shell_distance = rtm::scalar_set(0.0F);
-				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
-				{
-					const rtm::quatf raw_rotation = raw_bone_stream.rotations.get_sample_clamped(sample_index);
-					const rtm::vector4f raw_translation = raw_bone_stream.translations.get_sample_clamped(sample_index);
-					const rtm::vector4f raw_scale = raw_bone_stream.scales.get_sample_clamped(sample_index);
-
-					rtm::qvvf raw_transform = rtm::qvv_set(raw_rotation, raw_translation, raw_scale);
+		// Number of samples processed at once, one per SIMD lane
+		static constexpr uint32_t k_num_shell_samples_per_block = 4;
 
-					if (has_additive_base)
-					{
-						// If we are additive, we must apply our local transform on the base to figure out
-						// the true shell distance
-						const segment_context& base_segment = additive_base_clip_context.segments[0];
-						const transform_streams& base_bone_stream = base_segment.bone_streams[transform_index];
+		// Returns the sample transform, applied on the additive base if present
+		inline rtm::qvvf get_shell_sample_transform(const clip_context& owner_clip_context, const transform_streams& bone_stream, const clip_context& additive_base_clip_context, uint32_t transform_index, uint32_t clip_sample_offset, uint32_t sample_index)
+		{
+			const rtm::quatf raw_rotation = bone_stream.rotations.get_sample_clamped(sample_index);
+			const rtm::vector4f raw_translation = bone_stream.translations.get_sample_clamped(sample_index);
+			const rtm::vector4f raw_scale = bone_stream.scales.get_sample_clamped(sample_index);
 
-						// The sample time is calculated from the full clip duration to be consistent with decompression
-						const float sample_time = rtm::scalar_min(float(sample_index) / raw_clip_context.sample_rate, raw_clip_context.duration);
+			const rtm::qvvf raw_transform = rtm::qvv_set(raw_rotation, raw_translation, raw_scale);
 
-						const float normalized_sample_time = base_segment.num_samples > 1 ? (sample_time / raw_clip_context.duration) : 0.0F;
-						const float additive_sample_time = base_segment.num_samples > 1 ? (normalized_sample_time * additive_base_clip_context.duration) : 0.0F;
+			if (!owner_clip_context.has_additive_base)
+				return raw_transform;
 
-						// With uniform sample distributions, we do not interpolate.
-						const uint32_t base_sample_index = get_uniform_sample_key(base_segment, additive_sample_time);
+			// If we are additive, we must apply our local transform on the base to figure out
+			// the true shell distance
+			const segment_context& base_segment = additive_base_clip_context.segments[0];
+			const transform_streams& base_bone_stream = base_segment.bone_streams[transform_index];
 
-						const rtm::quatf base_rotation = base_bone_stream.rotations.get_sample_clamped(base_sample_index);
-						const rtm::vector4f base_translation = base_bone_stream.translations.get_sample_clamped(base_sample_index);
-						const rtm::vector4f base_scale = base_bone_stream.scales.get_sample_clamped(base_sample_index);
+			// The sample time is calculated from the full clip duration to be consistent with decompression
+			const float sample_time = rtm::scalar_min(float(sample_index + clip_sample_offset) / owner_clip_context.sample_rate, owner_clip_context.duration);
 
-						const rtm::qvvf base_transform = rtm::qvv_set(base_rotation, base_translation, base_scale);
-						raw_transform = apply_additive_to_base(raw_clip_context.additive_format, base_transform, raw_transform);
-					}
+			const float normalized_sample_time = base_segment.num_samples > 1 ? (sample_time / owner_clip_context.duration) : 0.0F;
+			const float additive_sample_time = base_segment.num_samples > 1 ? (normalized_sample_time * additive_base_clip_context.duration) : 0.0F;
 
-					const rtm::vector4f raw_vtx0 = rtm::qvv_mul_point3(vtx0, raw_transform);
-					const rtm::vector4f raw_vtx1 = rtm::qvv_mul_point3(vtx1, raw_transform);
-					const rtm::vector4f raw_vtx2 = rtm::qvv_mul_point3(vtx2, raw_transform);
+			// With uniform sample distributions, we do not interpolate.
+			const uint32_t base_sample_index = get_uniform_sample_key(base_segment, additive_sample_time);
 
-					const rtm::scalarf vtx0_distance = rtm::vector_length3(raw_vtx0);
-					const rtm::scalarf vtx1_distance = rtm::vector_length3(raw_vtx1);
-					const rtm::scalarf vtx2_distance = rtm::vector_length3(raw_vtx2);
+			const rtm::quatf base_rotation = base_bone_stream.rotations.get_sample_clamped(base_sample_index);
+			const rtm::vector4f base_translation = base_bone_stream.translations.get_sample_clamped(base_sample_index);
+			const rtm::vector4f base_scale = base_bone_stream.scales.get_sample_clamped(base_sample_index);
 
-					const rtm::scalarf transform_length = rtm::scalar_max(rtm::scalar_max(vtx0_distance, vtx1_distance), vtx2_distance);
-					parent_shell_distance = rtm::scalar_max(parent_shell_distance, transform_length);
-				}
+			const rtm::qvvf base_transform = rtm::qvv_set(base_rotation, base_translation, base_scale);
+			return apply_additive_to_base(owner_clip_context.additive_format, base_transform, raw_transform);
+		}
 
-				shell.parent_shell_distance = rtm::scalar_cast(parent_shell_distance);
+		// Returns the squared distance from the transform root of a shell vertex that lies on a local axis
+		// The vertex 'shell_distance * axis' is transformed into 'shell_distance * scale[axis] * rotation_column[axis] + translation'
+		// Every lane holds a different sample
+		inline rtm::vector4f RTM_SIMD_CALL calculate_shell_vertex_distance_sq_soa(
+			rtm::vector4f_arg0 column_x, rtm::vector4f_arg1 column_y, rtm::vector4f_arg2 column_z,
+			rtm::vector4f_arg3 scaled_shell_distance,
+			rtm::vector4f_arg4 translation_x, rtm::vector4f_arg5 translation_y, rtm::vector4f_argn translation_z)
+		{
+			const rtm::vector4f vertex_x = rtm::vector_mul_add(column_x, scaled_shell_distance, translation_x);
+			const rtm::vector4f vertex_y = rtm::vector_mul_add(column_y, scaled_shell_distance, translation_y);
+			const rtm::vector4f vertex_z = rtm::vector_mul_add(column_z, scaled_shell_distance, translation_z);
 
-				const transform_metadata& metadata = raw_clip_context.metadata[transform_index];
+			return rtm::vector_mul_add(vertex_z, vertex_z, rtm::vector_mul_add(vertex_y, vertex_y, rtm::vector_mul(vertex_x, vertex_x)));
+		}
 
-				// Add precision since we want to make sure to encompass the maximum amount of error allowed
-				// Add it only for non-dominant transforms to account for the error they introduce
-				// Dominant transforms will use their own precision
-				// If our shell distance has changed, we are non-dominant since a dominant child updated it
-				if (shell.local_shell_distance != metadata.shell_distance)
-					shell.parent_shell_distance += metadata.precision;
+		// Calculates the largest distance from the transform root of its rigid shell vertices over every sample
+		// Samples are processed in blocks in SOA form, one sample per SIMD lane
+		inline float calculate_parent_shell_distance(const clip_context& owner_clip_context, const transform_streams& bone_stream, const clip_context& additive_base_clip_context,
+			uint32_t transform_index, uint32_t clip_sample_offset, uint32_t num_samples, float local_shell_distance)
+		{
+			const rtm::vector4f shell_distance = rtm::vector_set(local_shell_distance);
+			rtm::vector4f max_distance_sq = rtm::vector_zero();
 
-				if (metadata.parent_index != k_invalid_track_index)
+			for (uint32_t block_start_index = 0; block_start_index < num_samples; block_start_index += k_num_shell_samples_per_block)
+			{
+				// Gather our samples in SOA form, the last block repeats the last sample which doesn't change the largest distance
+				float rotation_x[k_num_shell_samples_per_block];
+				float rotation_y[k_num_shell_samples_per_block];
+				float rotation_z[k_num_shell_samples_per_block];
+				float rotation_w[k_num_shell_samples_per_block];
+				float translation_x[k_num_shell_samples_per_block];
+				float translation_y[k_num_shell_samples_per_block];
+				float translation_z[k_num_shell_samples_per_block];
+				float scale_x[k_num_shell_samples_per_block];
+				float scale_y[k_num_shell_samples_per_block];
+				float scale_z[k_num_shell_samples_per_block];
+
+				for (uint32_t lane_index = 0; lane_index < k_num_shell_samples_per_block; ++lane_index)
 				{
-					// We have a parent, propagate our shell distance if we are a dominant transform
-					// We are a dominant transform if our shell distance in parent space is larger
-					// than our parent's shell distance in local space. Otherwise, if we are smaller
-					// or equal, it means that the full range of motion of our transform fits within
-					// the parent's shell distance.
-
-					rigid_shell_metadata_t& parent_shell = shell_metadata[metadata.parent_index];
-
-					if (shell.parent_shell_distance > parent_shell.local_shell_distance)
-					{
-						// We are the new dominant transform, use our shell distance and precision
-						parent_shell.local_shell_distance = shell.parent_shell_distance;
-						parent_shell.precision = shell.precision;
-					}
+					const uint32_t sample_index = std::min<uint32_t>(block_start_index + lane_index, num_samples - 1);
+					const rtm::qvvf transform = get_shell_sample_transform(owner_clip_context, bone_stream, additive_base_clip_context, transform_index, clip_sample_offset, sample_index);
+
+					rotation_x[lane_index] = rtm::quat_get_x(transform.rotation);
+					rotation_y[lane_index] = rtm::quat_get_y(transform.rotation);
+					rotation_z[lane_index] = rtm::quat_get_z(transform.rotation);
+					rotation_w[lane_index] = rtm::quat_get_w(transform.rotation);
+					translation_x[lane_index] = rtm::vector_get_x(transform.translation);
+					translation_y[lane_index] = rtm::vector_get_y(transform.translation);
+					translation_z[lane_index] = rtm::vector_get_z(transform.translation);
+					scale_x[lane_index] = rtm::vector_get_x(transform.scale);
+					scale_y[lane_index] = rtm::vector_get_y(transform.scale);
+					scale_z[lane_index] = rtm::vector_get_z(transform.scale);
 				}
+
+				const rtm::vector4f qx = rtm::vector_load(&rotation_x[0]);
+				const rtm::vector4f qy = rtm::vector_load(&rotation_y[0]);
+				const rtm::vector4f qz = rtm::vector_load(&rotation_z[0]);
+				const rtm::vector4f qw = rtm::vector_load(&rotation_w[0]);
+				const rtm::vector4f tx = rtm::vector_load(&translation_x[0]);
+				const rtm::vector4f ty = rtm::vector_load(&translation_y[0]);
+				const rtm::vector4f tz = rtm::vector_load(&translation_z[0]);
+
+				// Rotation matrix columns of 'q * v * conjugate(q)', we don't assume the rotations are normalized
+				const rtm::vector4f qxx = rtm::vector_mul(qx, qx);
+				const rtm::vector4f qyy = rtm::vector_mul(qy, qy);
+				const rtm::vector4f qzz = rtm::vector_mul(qz, qz);
+				const rtm::vector4f qww = rtm::vector_mul(qw, qw);
+				const rtm::vector4f qxy2 = rtm::vector_mul(rtm::vector_mul(qx, qy), 2.0F);
+				const rtm::vector4f qxz2 = rtm::vector_mul(rtm::vector_mul(qx, qz), 2.0F);
+				const rtm::vector4f qyz2 = rtm::vector_mul(rtm::vector_mul(qy, qz), 2.0F);
+				const rtm::vector4f qwx2 = rtm::vector_mul(rtm::vector_mul(qw, qx), 2.0F);
+				const rtm::vector4f qwy2 = rtm::vector_mul(rtm::vector_mul(qw, qy), 2.0F);
+				const rtm::vector4f qwz2 = rtm::vector_mul(rtm::vector_mul(qw, qz), 2.0F);
+
+				const rtm::vector4f column0_x = rtm::vector_sub(rtm::vector_sub(rtm::vector_add(qww, qxx), qyy), qzz);
+				const rtm::vector4f column0_y = rtm::vector_add(qxy2, qwz2);
+				const rtm::vector4f column0_z = rtm::vector_sub(qxz2, qwy2);
+
+				const rtm::vector4f column1_x = rtm::vector_sub(qxy2, qwz2);
+				const rtm::vector4f column1_y = rtm::vector_sub(rtm::vector_sub(rtm::vector_add(qww, qyy), qxx), qzz);
+				const rtm::vector4f column1_z = rtm::vector_add(qyz2, qwx2);
+
+				const rtm::vector4f column2_x = rtm::vector_add(qxz2, qwy2);
+				const rtm::vector4f column2_y = rtm::vector_sub(qyz2, qwx2);
+				const rtm::vector4f column2_z = rtm::vector_sub(rtm::vector_sub(rtm::vector_add(qww, qzz), qxx), qyy);
+
+				const rtm::vector4f scaled_shell_distance_x = rtm::vector_mul(rtm::vector_load(&scale_x[0]), shell_distance);
+				const rtm::vector4f scaled_shell_distance_y = rtm::vector_mul(rtm::vector_load(&scale_y[0]), shell_distance);
+				const rtm::vector4f scaled_shell_distance_z = rtm::vector_mul(rtm::vector_load(&scale_z[0]), shell_distance);
+
+				const rtm::vector4f vtx0_distance_sq = calculate_shell_vertex_distance_sq_soa(column0_x, column0_y, column0_z, scaled_shell_distance_x, tx, ty, tz);
+				const rtm::vector4f vtx1_distance_sq = calculate_shell_vertex_distance_sq_soa(column1_x, column1_y, column1_z, scaled_shell_distance_y, tx, ty, tz);
+				const rtm::vector4f vtx2_distance_sq = calculate_shell_vertex_distance_sq_soa(column2_x, column2_y, column2_z, scaled_shell_distance_z, tx, ty, tz);
+
+				max_distance_sq = rtm::vector_max(max_distance_sq, rtm::vector_max(rtm::vector_max(vtx0_distance_sq, vtx1_distance_sq), vtx2_distance_sq));
 			}
 
-			return shell_metadata;
+			// The square root is monotonic, we only need it for the largest distance
+			const float max_lane_distance_sq = rtm::scalar_max(
+				rtm::scalar_max(rtm::vector_get_x(max_distance_sq), rtm::vector_get_y(max_distance_sq)),
+				rtm::scalar_max(rtm::vector_get_z(max_distance_sq), rtm::vector_get_w(max_distance_sq)));
+			return rtm::scalar_sqrt(max_lane_distance_sq);
 		}
 
-		// We use the raw data to compute the rigid shell
+		// Computes the rigid shell of every transform over the samples of the provided segment
 		// For each transform, its rigid shell is formed by the dominant joint (itself or a child)
-		// We compute the largest value over the whole segment per transform
-		inline void compute_segment_shell_distances(const segment_context& segment, const clip_context& additive_base_clip_context, rigid_shell_metadata_t* out_shell_metadata)
+		inline void compute_shell_distances_impl(const clip_context& owner_clip_context, const segment_context& segment, const clip_context& additive_base_clip_context, rigid_shell_metadata_t* out_shell_metadata)
 		{
 			const uint32_t num_transforms = segment.num_bones;
-			if (num_transforms == 0)
-				return;	// No transforms present, no shell distances
-
 			const uint32_t num_samples = segment.num_samples;
-			if (num_samples == 0)
-				return;	// No samples present, no shell distances
-
-			const clip_context& owner_clip_context = *segment.clip;
-			const bool has_additive_base = owner_clip_context.has_additive_base;
 
 			// Initialize everything
 			for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
@@ -190,62 +206,12 @@ namespace acl
 			// Iterate from leaf transforms towards their root, we want to bubble up our shell distance
 			for (const uint32_t transform_index : make_reverse_iterator(owner_clip_context.sorted_transforms_parent_first, num_transforms))
 			{
-				const transform_streams& segment_bone_stream = segment.bone_streams[transform_index];
-
 				rigid_shell_metadata_t& shell = out_shell_metadata[transform_index];
 
 				// Use the accumulated shell distance so far to see how far it deforms with our local transform
-				const rtm::vector4f vtx0 = rtm::vector_set(shell.local_shell_distance, 0.0F, 0.0F);
-				const rtm::vector4f vtx1 = rtm::vector_set(0.0F, shell.local_shell_distance, 0.0F);
-				const rtm::vector4f vtx2 = rtm::vector_set(0.0F, 0.0F, shell.local_shell_distance);
-
-				// Calculate the shell distance in parent space
-				rtm::scalarf parent_shell_distance = rtm::scalar_set(0.0F);
-				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
-				{
-					const rtm::quatf raw_rotation = segment_bone_stream.rotations.get_sample_clamped(sample_index);
-					const rtm::vector4f raw_translation = segment_bone_stream.translations.get_sample_clamped(sample_index);
-					const rtm::vector4f raw_scale = segment_bone_stream.scales.get_sample_clamped(sample_index);
-
-					rtm::qvvf raw_transform = rtm::qvv_set(raw_rotation, raw_translation, raw_scale);
-
-					if (has_additive_base)
-					{
-						// If we are additive, we must apply our local transform on the base to figure out
-						// the true shell distance
-						const segment_context& base_segment = additive_base_clip_context.segments[0];
-						const transform_streams& base_bone_stream = base_segment.bone_streams[transform_index];
-
-						// The sample time is calculated from the full clip duration to be consistent with decompression
-						const float sample_time = rtm::scalar_min(float(sample_index + segment.clip_sample_offset) / owner_clip_context.sample_rate, owner_clip_context.duration);
-
-						const float normalized_sample_time = base_segment.num_samples > 1 ? (sample_time / owner_clip_context.duration) : 0.0F;
-						const float additive_sample_time = base_segment.num_samples > 1 ? (normalized_sample_time * additive_base_clip_context.duration) : 0.0F;
-
-						// With uniform sample distributions, we do not interpolate.
-						const uint32_t base_sample_index = get_uniform_sample_key(base_segment, additive_sample_time);
-
-						const rtm::quatf base_rotation = base_bone_stream.rotations.get_sample_clamped(base_sample_index);
-						const rtm::vector4f base_translation = base_bone_stream.translations.get_sample_clamped(base_sample_index);
-						const rtm::vector4f base_scale = base_bone_stream.scales.get_sample_clamped(base_sample_index);
-
-						const rtm::qvvf base_transform = rtm::qvv_set(base_rotation, base_translation, base_scale);
-						raw_transform = apply_additive_to_base(owner_clip_context.additive_format, base_transform, raw_transform);
-					}
-
-					const rtm::vector4f raw_vtx0 = rtm::qvv_mul_point3(vtx0, raw_transform);
-					const rtm::vector4f raw_vtx1 = rtm::qvv_mul_point3(vtx1, raw_transform);
-					const rtm::vector4f raw_vtx2 = rtm::qvv_mul_point3(vtx2, raw_transform);
-
-					const rtm::scalarf vtx0_distance = rtm::vector_length3(raw_vtx0);
-					const rtm::scalarf vtx1_distance = rtm::vector_length3(raw_vtx1);
-					const rtm::scalarf vtx2_distance = rtm::vector_length3(raw_vtx2);
-
-					const rtm::scalarf transform_length = rtm::scalar_max(rtm::scalar_max(vtx0_distance, vtx1_distance), vtx2_distance);
-					parent_shell_distance = rtm::scalar_max(parent_shell_distance, transform_length);
-				}
-
-				shell.parent_shell_distance = rtm::scalar_cast(parent_shell_distance);
+				// and calculate the shell distance in parent space
+				shell.parent_shell_distance = calculate_parent_shell_distance(owner_clip_context, segment.bone_streams[transform_index], additive_base_clip_context,
+					transform_index, segment.clip_sample_offset, num_samples, shell.local_shell_distance);
 
 				const transform_metadata& metadata = owner_clip_context.metadata[transform_index];
 
@@ -275,6 +241,43 @@ namespace acl
 				}
 			}
 		}
+
+		// We use the raw data to compute the rigid shell
+		// For each transform, its rigid shell is formed by the dominant joint (itself or a child)
+		// We compute the largest value over the whole clip per transform
+		inline rigid_shell_metadata_t* compute_clip_shell_distances(iallocator& allocator, const clip_context& raw_clip_context, const clip_context& additive_base_clip_context)
+		{
+			const uint32_t num_transforms = raw_clip_context.num_bones;
+			if (num_transforms == 0)
+				return nullptr;	// No transforms present, no shell distances
+
+			const uint32_t num_samples = raw_clip_context.num_samples;
+			if (num_samples == 0)
+				return nullptr;	// No samples present, no shell distances
+
+			rigid_shell_metadata_t* shell_metadata = allocate_type_array<rigid_shell_metadata_t>(allocator, num_transforms);
+
+			// The raw clip has a single segment that spans the whole clip
+			compute_shell_distances_impl(raw_clip_context, raw_clip_context.segments[0], additive_base_clip_context, shell_metadata);
+
+			return shell_metadata;
+		}
+
+		// We compute the rigid shell from the segment samples
+		// For each transform, its rigid shell is formed by the dominant joint (itself or a child)
+		// We compute the largest value over the whole segment per transform
+		inline void compute_segment_shell_distances(const segment_context& segment, const clip_context& additive_base_clip_context, rigid_shell_metadata_t* out_shell_metadata)
+		{
+			const uint32_t num_transforms = segment.num_bones;
+			if (num_transforms == 0)
+				return;	// No transforms present, no shell distances
+
+			const uint32_t num_samples = segment.num_samples;
+			if (num_samples == 0)
+				return;	// No samples present, no shell distances
+
+			compute_shell_distances_impl(*segment.clip, segment, additive_base_clip_context, out_shell_metadata);
+		}
 	}
 
 	ACL_IMPL_VERSION_NAMESPACE_END
@@ -32,6 +32,7 @@
 #include "acl/core/track_formats.h"
 #include "acl/core/impl/variable_bit_rates.h"
 #include "acl/math/quat_packing.h"
+#include "acl/math/quatf.h"
 #include "acl/math/vector4_packing.h"
 #include "acl/compression/impl/track_stream.h"
 #include "acl/compression/impl/normalize_streams.h"
@@ -78,7 +79,7 @@ namespace acl
 			}
 		}
 
-		inline rtm::vector4f RTM_SIMD_CALL load_vector_sample(const uint8_t* ptr, vector_format8 format, uint8_t bit_rate)
+		inline rtm::vector4f RTM_SIMD_CALL load_vector_sample(const uint8_t* ptr, vector_format8 format, uint8_t bit_rate, const uint8_t bit_rate_reductions[3])
 		{
 			switch (format)
 			{
@@ -93,6 +94,20 @@ namespace acl
 				else
 				{
 					const uint32_t num_bits_at_bit_rate = get_num_bits_at_bit_rate(bit_rate);
+
+					// Uniform sub-tracks only store their X component, see is_vector3_uniform(..)
+					if (is_vector3_uniform(bit_rate_reductions))
+						return unpack_vector3_uniform_uXX_unsafe(num_bits_at_bit_rate, ptr, 0);
+
+					// When every component has the same number of bits, this is equivalent to unpack_vector3_uXX_unsafe(..)
+					if ((bit_rate_reductions[0] | bit_rate_reductions[1] | bit_rate_reductions[2]) != 0)
+					{
+						const uint32_t num_bits_x = get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[0]);
+						const uint32_t num_bits_y = get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[1]);
+						const uint32_t num_bits_z = get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[2]);
+						return unpack_vector3_uXYZ_unsafe(num_bits_x, num_bits_y, num_bits_z, ptr, 0);
+					}
+
 					return unpack_vector3_uXX_unsafe(num_bits_at_bit_rate, ptr, 0);
 				}
 			default:
@@ -101,7 +116,7 @@ namespace acl
 			}
 		}
 
-		inline rtm::quatf RTM_SIMD_CALL rotation_to_quat_32(rtm::vector4f_arg0 rotation, rotation_format8 format)
+		inline rtm::quatf RTM_SIMD_CALL rotation_to_quat_32(rtm::vector4f_arg0 rotation, rotation_format8 format, uint32_t dropped_component, bool is_log)
 		{
 			switch (format)
 			{
@@ -109,9 +124,14 @@ namespace acl
 				return rtm::vector_to_quat(rotation);
 			case rotation_format8::quatf_drop_w_full:
 			case rotation_format8::quatf_drop_w_variable:
+				// Our logarithm is stored like a rotation with W dropped, we reconstruct it the same way the decompression does
+				if (is_log)
+					return rtm::quat_normalize(quat_from_log(rotation));
+
 				// quat_from_positive_w might not yield an accurate quaternion because the square-root instruction
 				// isn't very accurate on small inputs, we need to normalize
-				return rtm::quat_normalize(rtm::quat_from_positive_w(rotation));
+				// If the largest component was dropped, it lives in the W slot and we restore the original order afterwards
+				return quat_unswizzle_dropped_component(rtm::quat_normalize(rtm::quat_from_positive_w(rotation)), dropped_component);
 			default:
 				ACL_ASSERT(false, "Invalid or unsupported rotation format: %s", get_rotation_format_name(format));
 				return rtm::quat_identity();
@@ -154,7 +174,7 @@ namespace acl
 				packed_rotation = rtm::vector_mul_add(packed_rotation, clip_range_extent, clip_range_min);
 			}
 
-			return acl_impl::rotation_to_quat_32(packed_rotation, format);
+			return acl_impl::rotation_to_quat_32(packed_rotation, format, bone_steams.rotation_dropped_component, bone_steams.is_rotation_log);
 		}
 
 		// Gets a rotation sample at the specified bit rate
@@ -176,6 +196,10 @@ namespace acl
 				const uint8_t* quantized_ptr = raw_bone_steams.rotations.get_raw_sample_ptr(segment->clip_sample_offset + sample_index);
 				const rtm::vector4f rotation = acl_impl::load_rotation_sample(quantized_ptr, rotation_format8::quatf_full, k_invalid_bit_rate);
 				packed_rotation = convert_rotation(rotation, rotation_format8::quatf_full, format);
+				packed_rotation = swizzle_dropped_component(packed_rotation, bone_steams.rotation_dropped_component);
+
+				if (bone_steams.is_rotation_log)
+					packed_rotation = quat_to_log(rtm::vector_to_quat(packed_rotation));
 			}
 			else
 			{
@@ -206,7 +230,7 @@ namespace acl
 				packed_rotation = rtm::vector_mul_add(packed_rotation, clip_range_extent, clip_range_min);
 			}
 
-			return acl_impl::rotation_to_quat_32(packed_rotation, format);
+			return acl_impl::rotation_to_quat_32(packed_rotation, format, bone_steams.rotation_dropped_component, bone_steams.is_rotation_log);
 		}
 
 		// Gets a rotation sample with the desired format
@@ -256,7 +280,7 @@ namespace acl
 				packed_rotation = rtm::vector_mul_add(packed_rotation, clip_range_extent, clip_range_min);
 			}
 
-			return acl_impl::rotation_to_quat_32(packed_rotation, format);
+			return acl_impl::rotation_to_quat_32(packed_rotation, format, bone_steams.rotation_dropped_component, bone_steams.is_rotation_log);
 		}
 
 		// Gets a translation sample from the format/bit rate stored
@@ -274,7 +298,7 @@ namespace acl
 
 			const uint8_t* quantized_ptr = bone_steams.translations.get_raw_sample_ptr(sample_index);
 
-			rtm::vector4f packed_translation = acl_impl::load_vector_sample(quantized_ptr, format, bit_rate);
+			rtm::vector4f packed_translation = acl_impl::load_vector_sample(quantized_ptr, format, bit_rate, bone_steams.translation_bit_rate_reductions);
 
 			if (!bone_steams.is_translation_constant && are_translations_normalized && !is_raw_bit_rate(bit_rate))
 			{
@@ -325,7 +349,19 @@ namespace acl
 				const rtm::vector4f translation = bone_steams.translations.get_sample(sample_index);
 
 				const uint32_t num_bits_at_bit_rate = get_num_bits_at_bit_rate(bit_rate);
-				packed_translation = decay_vector3_uXX(translation, num_bits_at_bit_rate);
+
+				const uint8_t* bit_rate_reductions = bone_steams.translation_bit_rate_reductions;
+				if (is_vector3_uniform(bit_rate_reductions))
+					packed_translation = decay_vector3_uXX(translation, num_bits_at_bit_rate);	// Every component is equal
+				else if ((bit_rate_reductions[0] | bit_rate_reductions[1] | bit_rate_reductions[2]) != 0)
+				{
+					const uint32_t num_bits_x = get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[0]);
+					const uint32_t num_bits_y = get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[1]);
+					const uint32_t num_bits_z = get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[2]);
+					packed_translation = decay_vector3_uXYZ(translation, num_bits_x, num_bits_y, num_bits_z);
+				}
+				else
+					packed_translation = decay_vector3_uXX(translation, num_bits_at_bit_rate);
 			}
 
 			if (!is_raw_bit_rate(bit_rate))
@@ -360,7 +396,7 @@ namespace acl
 			const uint8_t* quantized_ptr = bone_steams.translations.get_raw_sample_ptr(sample_index);
 			const vector_format8 format = bone_steams.translations.get_vector_format();
 
-			const rtm::vector4f translation = acl_impl::load_vector_sample(quantized_ptr, format, 0);
+			const rtm::vector4f translation = acl_impl::load_vector_sample(quantized_ptr, format, 0, bone_steams.translation_bit_rate_reductions);
 
 			// Pack and unpack in our desired format
 			rtm::vector4f packed_translation;
@@ -413,7 +449,7 @@ namespace acl
 
 			const uint8_t* quantized_ptr = bone_steams.scales.get_raw_sample_ptr(sample_index);
 
-			rtm::vector4f packed_scale = acl_impl::load_vector_sample(quantized_ptr, format, bit_rate);
+			rtm::vector4f packed_scale = acl_impl::load_vector_sample(quantized_ptr, format, bit_rate, bone_steams.scale_bit_rate_reductions);
 
 			if (!bone_steams.is_scale_constant && clip->are_scales_normalized && !is_raw_bit_rate(bit_rate))
 			{
@@ -464,7 +500,19 @@ namespace acl
 				const rtm::vector4f scale = bone_steams.scales.get_sample(sample_index);
 
 				const uint32_t num_bits_at_bit_rate = get_num_bits_at_bit_rate(bit_rate);
-				packed_scale = decay_vector3_uXX(scale, num_bits_at_bit_rate);
+
+				const uint8_t* bit_rate_reductions = bone_steams.scale_bit_rate_reductions;
+				if (is_vector3_uniform(bit_rate_reductions))
+					packed_scale = decay_vector3_uXX(scale, num_bits_at_bit_rate);	// Every component is equal
+				else if ((bit_rate_reductions[0] | bit_rate_reductions[1] | bit_rate_reductions[2]) != 0)
+				{
+					const uint32_t num_bits_x = get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[0]);
+					const uint32_t num_bits_y = get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[1]);
+					const uint32_t num_bits_z = get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[2]);
+					packed_scale = decay_vector3_uXYZ(scale, num_bits_x, num_bits_y, num_bits_z);
+				}
+				else
+					packed_scale = decay_vector3_uXX(scale, num_bits_at_bit_rate);
 			}
 
 			if (!is_raw_bit_rate(bit_rate))
@@ -499,7 +547,7 @@ namespace acl
 			const uint8_t* quantized_ptr = bone_steams.scales.get_raw_sample_ptr(sample_index);
 			const vector_format8 format = bone_steams.scales.get_vector_format();
 
-			const rtm::vector4f scale = acl_impl::load_vector_sample(quantized_ptr, format, 0);
+			const rtm::vector4f scale = acl_impl::load_vector_sample(quantized_ptr, format, 0, bone_steams.scale_bit_rate_reductions);
 
 			// Pack and unpack in our desired format
 			rtm::vector4f packed_scale;
@@ -619,6 +667,167 @@ namespace acl
 				return get_scale_sample(bone_stream, context.sample_key);
 		}
 
+		// Loads the packed rotation samples of 4 bones that share the same format and bit rate
+		// The format is handled once for the whole group
+		inline void RTM_SIMD_CALL load_rotation_samples4(const uint8_t* const ptrs[4], rotation_format8 format, uint8_t bit_rate, rtm::vector4f out_samples[4])
+		{
+			switch (format)
+			{
+			case rotation_format8::quatf_full:
+				for (uint32_t group_index = 0; group_index < 4; ++group_index)
+					out_samples[group_index] = unpack_vector4_128(ptrs[group_index]);
+				break;
+			case rotation_format8::quatf_drop_w_full:
+				for (uint32_t group_index = 0; group_index < 4; ++group_index)
+					out_samples[group_index] = unpack_vector3_96_unsafe(ptrs[group_index]);
+				break;
+			case rotation_format8::quatf_drop_w_variable:
+				ACL_ASSERT(bit_rate != k_invalid_bit_rate, "Invalid bit rate!");
+				if (is_constant_bit_rate(bit_rate))
+				{
+					for (uint32_t group_index = 0; group_index < 4; ++group_index)
+						out_samples[group_index] = unpack_vector3_u48_unsafe(ptrs[group_index]);
+				}
+				else if (is_raw_bit_rate(bit_rate))
+				{
+					for (uint32_t group_index = 0; group_index < 4; ++group_index)
+						out_samples[group_index] = unpack_vector3_96_unsafe(ptrs[group_index]);
+				}
+				else
+				{
+					const uint32_t num_bits_at_bit_rate = get_num_bits_at_bit_rate(bit_rate);
+					for (uint32_t group_index = 0; group_index < 4; ++group_index)
+						out_samples[group_index] = unpack_vector3_uXX_unsafe(num_bits_at_bit_rate, ptrs[group_index], 0);
+				}
+				break;
+			default:
+				ACL_ASSERT(false, "Invalid or unsupported rotation format: %s", get_rotation_format_name(format));
+				for (uint32_t group_index = 0; group_index < 4; ++group_index)
+					out_samples[group_index] = rtm::vector_zero();
+				break;
+			}
+		}
+
+		// Applies the range reduction of 4 bones in SOA form
+		inline void RTM_SIMD_CALL apply_rotation_ranges4(const transform_range* ranges, const uint32_t bone_indices[4], rtm::vector4f& xxxx, rtm::vector4f& yyyy, rtm::vector4f& zzzz)
+		{
+			const track_stream_range& range0 = ranges[bone_indices[0]].rotation;
+			const track_stream_range& range1 = ranges[bone_indices[1]].rotation;
+			const track_stream_range& range2 = ranges[bone_indices[2]].rotation;
+			const track_stream_range& range3 = ranges[bone_indices[3]].rotation;
+
+			rtm::vector4f min_xxxx;
+			rtm::vector4f min_yyyy;
+			rtm::vector4f min_zzzz;
+			rtm::vector4f min_wwww;
+			RTM_MATRIXF_TRANSPOSE_4X4(range0.get_min(), range1.get_min(), range2.get_min(), range3.get_min(), min_xxxx, min_yyyy, min_zzzz, min_wwww);
+
+			rtm::vector4f extent_xxxx;
+			rtm::vector4f extent_yyyy;
+			rtm::vector4f extent_zzzz;
+			rtm::vector4f extent_wwww;
+			RTM_MATRIXF_TRANSPOSE_4X4(range0.get_extent(), range1.get_extent(), range2.get_extent(), range3.get_extent(), extent_xxxx, extent_yyyy, extent_zzzz, extent_wwww);
+
+			(void)min_wwww;
+			(void)extent_wwww;
+
+			xxxx = rtm::vector_mul_add(xxxx, extent_xxxx, min_xxxx);
+			yyyy = rtm::vector_mul_add(yyyy, extent_yyyy, min_yyyy);
+			zzzz = rtm::vector_mul_add(zzzz, extent_zzzz, min_zzzz);
+		}
+
+		// Samples the animated rotations of 4 bones that share the same format and bit rate in SOA form
+		// Equivalent to sample_rotation(..) for each bone, rotations stored as logarithms are not supported
+		inline void sample_rotations4(const transform_streams* bone_streams, const uint32_t bone_indices[4], uint32_t sample_key, rtm::qvvf* out_local_pose)
+		{
+			const transform_streams& bone_stream0 = bone_streams[bone_indices[0]];
+			const segment_context* segment = bone_stream0.segment;
+			const clip_context* clip = segment->clip;
+
+			const rotation_format8 format = bone_stream0.rotations.get_rotation_format();
+			const uint8_t bit_rate = bone_stream0.rotations.get_bit_rate();
+
+			const uint32_t sample_index = format == rotation_format8::quatf_drop_w_variable && is_constant_bit_rate(bit_rate) ? 0 : sample_key;
+
+			const uint8_t* ptrs[4];
+			for (uint32_t group_index = 0; group_index < 4; ++group_index)
+			{
+				const transform_streams& bone_stream = bone_streams[bone_indices[group_index]];
+				ACL_ASSERT(!bone_stream.is_rotation_default && !bone_stream.is_rotation_constant && !bone_stream.is_rotation_log, "Expected an animated rotation");
+				ACL_ASSERT(bone_stream.rotations.get_rotation_format() == format && bone_stream.rotations.get_bit_rate() == bit_rate, "Rotations must share their format and bit rate");
+
+				ptrs[group_index] = bone_stream.rotations.get_raw_sample_ptr(sample_index);
+			}
+
+			rtm::vector4f samples[4];
+			load_rotation_samples4(ptrs, format, bit_rate, samples);
+
+			rtm::vector4f xxxx;
+			rtm::vector4f yyyy;
+			rtm::vector4f zzzz;
+			rtm::vector4f wwww;
+			RTM_MATRIXF_TRANSPOSE_4X4(samples[0], samples[1], samples[2], samples[3], xxxx, yyyy, zzzz, wwww);
+
+			if (clip->are_rotations_normalized && !is_raw_bit_rate(bit_rate))
+			{
+				if (segment->are_rotations_normalized && !is_constant_bit_rate(bit_rate))
+					apply_rotation_ranges4(segment->ranges, bone_indices, xxxx, yyyy, zzzz);
+
+				apply_rotation_ranges4(clip->ranges, bone_indices, xxxx, yyyy, zzzz);
+			}
+
+			const bool is_w_dropped = format != rotation_format8::quatf_full;
+			if (is_w_dropped)
+			{
+				// quat_from_positive_w4 might not yield an accurate quaternion because the square-root instruction
+				// isn't very accurate on small inputs, we need to normalize
+				wwww = quat_from_positive_w4(xxxx, yyyy, zzzz);
+				quat_normalize4(xxxx, yyyy, zzzz, wwww);
+			}
+
+			quat_normalize4(xxxx, yyyy, zzzz, wwww);
+
+			RTM_MATRIXF_TRANSPOSE_4X4(xxxx, yyyy, zzzz, wwww, samples[0], samples[1], samples[2], samples[3]);
+
+			for (uint32_t group_index = 0; group_index < 4; ++group_index)
+			{
+				const uint32_t bone_index = bone_indices[group_index];
+				const transform_streams& bone_stream = bone_streams[bone_index];
+
+				rtm::quatf rotation = rtm::vector_to_quat(samples[group_index]);
+				if (is_w_dropped)
+					rotation = quat_unswizzle_dropped_component(rotation, bone_stream.rotation_dropped_component);
+
+				out_local_pose[bone_index].rotation = rotation;
+			}
+		}
+
+		// Animated rotations are sampled in groups of 4 that share their format and bit rate
+		// Variable bit rates use their bit rate as key, full precision formats use the last two keys
+		constexpr uint32_t k_num_rotation_group_keys = k_num_bit_rates + 2;
+
+		// Returns the group key of an animated rotation or ~0 if it cannot be grouped
+		inline uint32_t get_rotation_group_key(const transform_streams& bone_stream)
+		{
+			if (bone_stream.is_rotation_default || bone_stream.is_rotation_constant || bone_stream.is_rotation_log)
+				return ~0U;	// Not animated or requires its own reconstruction
+
+			switch (bone_stream.rotations.get_rotation_format())
+			{
+			case rotation_format8::quatf_full:
+				return k_num_bit_rates + 1;
+			case rotation_format8::quatf_drop_w_full:
+				return k_num_bit_rates;
+			case rotation_format8::quatf_drop_w_variable:
+			{
+				const uint8_t bit_rate = bone_stream.rotations.get_bit_rate();
+				return bit_rate < k_num_bit_rates ? bit_rate : ~0U;
+			}
+			default:
+				return ~0U;
+			}
+		}
+
 		// Samples all transforms at a point in time
 		// Transforms can be raw or quantized
 		inline void sample_streams(const transform_streams* bone_streams, uint32_t num_bones, float sample_time, rtm::qvvf* out_local_pose)
@@ -633,17 +842,51 @@ namespace acl
 			context.sample_key = sample_key;
 			context.sample_time = sample_time;
 
+			uint32_t group_bone_indices[k_num_rotation_group_keys][4];
+			uint32_t num_group_bones[k_num_rotation_group_keys] = { 0 };
+
 			for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
 			{
 				context.track_index = bone_index;
 
 				const transform_streams& bone_stream = bone_streams[bone_index];
 
-				const rtm::quatf rotation = acl_impl::sample_rotation(context, bone_stream);
 				const rtm::vector4f translation = acl_impl::sample_translation(context, bone_stream);
 				const rtm::vector4f scale = has_scale ? acl_impl::sample_scale(context, bone_stream) : bone_stream.default_value.scale;
 
-				out_local_pose[bone_index] = rtm::qvv_set(rotation, translation, scale);
+				const uint32_t group_key = get_rotation_group_key(bone_stream);
+				if (group_key == ~0U)
+				{
+					const rtm::quatf rotation = acl_impl::sample_rotation(context, bone_stream);
+					out_local_pose[bone_index] = rtm::qvv_set(rotation, translation, scale);
+					continue;
+				}
+
+				// Our rotation is written once its group is full
+				out_local_pose[bone_index] = rtm::qvv_set(rtm::quat_identity(), translation, scale);
+
+				uint32_t* bone_indices = group_bone_indices[group_key];
+				bone_indices[num_group_bones[group_key]++] = bone_index;
+
+				if (num_group_bones[group_key] == 4)
+				{
+					acl_impl::sample_rotations4(bone_streams, bone_indices, sample_key, out_local_pose);
+					num_group_bones[group_key] = 0;
+				}
+			}
+
+			// Flush the partial groups, unused entries repeat the first bone of the group
+			for (uint32_t group_key = 0; group_key < k_num_rotation_group_keys; ++group_key)
+			{
+				const uint32_t num_bones_in_group = num_group_bones[group_key];
+				if (num_bones_in_group == 0)
+					continue;
+
+				uint32_t* bone_indices = group_bone_indices[group_key];
+				for (uint32_t group_index = num_bones_in_group; group_index < 4; ++group_index)
+					bone_indices[group_index] = bone_indices[0];
+
+				acl_impl::sample_rotations4(bone_streams, bone_indices, sample_key, out_local_pose);
 			}
 		}
 	}
@@ -32,6 +32,7 @@
 #include "acl/core/quality_tiers.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/impl/compressed_headers.h"
+#include "acl/compression/impl/compression_profiler.h"
 #include "acl/compression/impl/track_stream.h"
 
 #include <cstdint>
@@ -64,6 +65,12 @@ namespace acl
 			// Defaults to '31'
 			uint32_t max_num_samples = 31;
 
+			//////////////////////////////////////////////////////////////////////////
+			// Whether or not to move the segment boundaries to follow the motion.
+			// See 'compression_settings::enable_adaptive_segmenting' for details.
+			// Defaults to 'false'
+			bool enable_adaptive_segmenting = false;
+
 			//////////////////////////////////////////////////////////////////////////
 			// Checks if everything is valid and if it isn't, returns an error string.
 			// Returns nullptr if the settings are valid.
@@ -107,6 +114,7 @@ namespace acl
 			uint32_t range_data_size						= 0;
 			uint32_t segment_data_size						= 0;
 			uint32_t total_header_size						= 0;
+			compression_profiler* profiler					= nullptr;	// Optional, only present with detailed stats
 
 			//////////////////////////////////////////////////////////////////////////
 			iterator<transform_streams> bone_iterator() { return iterator<transform_streams>(bone_streams, num_bones); }
@@ -31,7 +31,12 @@
 #include "acl/compression/compression_settings.h"
 #include "acl/compression/impl/clip_context.h"
 
+#include <rtm/vector4f.h>
+
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <limits>
 
 ACL_IMPL_FILE_PRAGMA_PUSH
 
@@ -125,6 +130,281 @@ namespace acl
 			return num_samples_per_segment;
 		}
 
+		//////////////////////////////////////////////////////////////////////////
+		// Returns whether or not every sample finds its segment with the search performed
+		// when seeking, see seek_v0(..). The segment is first estimated with the average number
+		// of samples per segment and the search only considers a few segments around the estimate.
+		//////////////////////////////////////////////////////////////////////////
+		inline bool is_segment_layout_seekable(const uint32_t* num_samples_per_segment, uint32_t num_segments, uint32_t num_samples)
+		{
+			const uint32_t approx_num_samples_per_segment = num_samples / num_segments;
+
+			uint32_t segment_start_index = 0;
+			for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+			{
+				const uint32_t segment_end_index = segment_start_index + num_samples_per_segment[segment_index];
+
+				// The segment found is monotonic with the sample index, we only need to test both ends
+				const uint32_t sample_indices[2] = { segment_start_index, segment_end_index - 1 };
+				for (const uint32_t sample_index : sample_indices)
+				{
+					const uint32_t approx_segment_index = sample_index / approx_num_samples_per_segment;
+					const uint32_t start_segment_index = approx_segment_index > 0 ? (approx_segment_index - 1) : 0;
+					const uint32_t end_segment_index = start_segment_index + 4;
+
+					uint32_t found_segment_index = ~0U;
+					uint32_t search_start_index = 0;
+					for (uint32_t search_index = 0; search_index < end_segment_index && search_index <= num_segments; ++search_index)
+					{
+						// Past the last segment, we hit the sentinel value
+						const uint32_t search_segment_start_index = search_index < num_segments ? search_start_index : ~0U;
+						if (search_index >= start_segment_index && sample_index < search_segment_start_index)
+						{
+							found_segment_index = search_index - 1;	// Wraps if we search before the first segment
+							break;
+						}
+
+						if (search_index < num_segments)
+							search_start_index += num_samples_per_segment[search_index];
+					}
+
+					if (found_segment_index != segment_index)
+						return false;
+				}
+
+				segment_start_index = segment_end_index;
+			}
+
+			return true;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Moves the segment boundaries of a uniform split to follow the motion.
+		//
+		// Animated samples are quantized within their segment range: the number of bits
+		// a component needs grows with the log2 of its segment extent. A segment that straddles
+		// a motion change has a large extent and requires higher bit rates for all its samples.
+		// For a candidate segment, we estimate its cost as:
+		//    num_samples * sum(log2(extent)) for every normalized animated component
+		// and we find the boundaries that minimize the total cost with dynamic programming.
+		//
+		// Each boundary can only move within a window around its uniform position which keeps
+		// the number of segments and the constant time segment lookup when seeking. The segment
+		// lengths remain within the segmenting settings. If no better layout is found or if it
+		// isn't seekable, the uniform split is retained.
+		//////////////////////////////////////////////////////////////////////////
+		inline void adapt_samples_per_segment(iallocator& allocator, const clip_context& clip, const compression_segmenting_settings& settings, uint32_t* num_samples_per_segment, uint32_t num_segments)
+		{
+			const segment_context& clip_segment = clip.segments[0];
+			const uint32_t num_samples = clip.num_samples;
+
+			// Gather the normalized animated components, other components do not depend on the segment range
+			uint32_t num_channels = 0;
+			for (const transform_streams& bone_stream : clip_segment.const_bone_iterator())
+			{
+				if (clip.are_rotations_normalized && !bone_stream.is_rotation_constant)
+					num_channels += 3;
+
+				if (clip.are_translations_normalized && !bone_stream.is_translation_constant)
+					num_channels += 3;
+
+				if (clip.are_scales_normalized && !bone_stream.is_scale_constant)
+					num_channels += 3;
+			}
+
+			if (num_channels == 0)
+				return;	// Nothing to range reduce per segment, keep the uniform split
+
+			// Samples are stored contiguously per sample index
+			float* channel_values = allocate_type_array<float>(allocator, size_t(num_samples) * num_channels);
+
+			const auto write_channels = [num_channels, channel_values](const rtm::vector4f& value, uint32_t sample_index, uint32_t channel_index)
+			{
+				float* sample_values = channel_values + (size_t(sample_index) * num_channels) + channel_index;
+				sample_values[0] = rtm::vector_get_x(value);
+				sample_values[1] = rtm::vector_get_y(value);
+				sample_values[2] = rtm::vector_get_z(value);
+			};
+
+			uint32_t channel_offset = 0;
+			for (const transform_streams& bone_stream : clip_segment.const_bone_iterator())
+			{
+				if (clip.are_rotations_normalized && !bone_stream.is_rotation_constant)
+				{
+					for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+						write_channels(bone_stream.rotations.get_raw_sample<rtm::vector4f>(sample_index), sample_index, channel_offset);
+					channel_offset += 3;
+				}
+
+				if (clip.are_translations_normalized && !bone_stream.is_translation_constant)
+				{
+					for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+						write_channels(bone_stream.translations.get_raw_sample<rtm::vector4f>(sample_index), sample_index, channel_offset);
+					channel_offset += 3;
+				}
+
+				if (clip.are_scales_normalized && !bone_stream.is_scale_constant)
+				{
+					for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+						write_channels(bone_stream.scales.get_raw_sample<rtm::vector4f>(sample_index), sample_index, channel_offset);
+					channel_offset += 3;
+				}
+			}
+
+			// Extents smaller than this are quantized with the lowest bit rates regardless
+			const float k_min_extent = 1.0E-5F;
+
+			float* channel_min = allocate_type_array<float>(allocator, num_channels);
+			float* channel_max = allocate_type_array<float>(allocator, num_channels);
+
+			const auto reset_extents = [num_channels, channel_values, channel_min, channel_max](uint32_t sample_index)
+			{
+				const float* sample_values = channel_values + (size_t(sample_index) * num_channels);
+				std::copy(sample_values, sample_values + num_channels, channel_min);
+				std::copy(sample_values, sample_values + num_channels, channel_max);
+			};
+
+			const auto extend_extents = [num_channels, channel_values, channel_min, channel_max](uint32_t sample_index)
+			{
+				const float* sample_values = channel_values + (size_t(sample_index) * num_channels);
+				for (uint32_t channel_index = 0; channel_index < num_channels; ++channel_index)
+				{
+					channel_min[channel_index] = std::min(channel_min[channel_index], sample_values[channel_index]);
+					channel_max[channel_index] = std::max(channel_max[channel_index], sample_values[channel_index]);
+				}
+			};
+
+			const auto calculate_cost = [num_channels, channel_min, channel_max, k_min_extent](uint32_t segment_num_samples)
+			{
+				double cost = 0.0;
+				for (uint32_t channel_index = 0; channel_index < num_channels; ++channel_index)
+					cost += std::log2(std::max(channel_max[channel_index] - channel_min[channel_index], k_min_extent));
+				return cost * segment_num_samples;
+			};
+
+			// Find the uniform boundaries, our lengths must remain valid for the uniform split
+			uint32_t* uniform_start_indices = allocate_type_array<uint32_t>(allocator, num_segments + 1);
+			uint32_t min_segment_num_samples = (settings.ideal_num_samples + 1) / 2;
+			uint32_t max_segment_num_samples = settings.max_num_samples;
+			double uniform_cost = 0.0;
+
+			uniform_start_indices[0] = 0;
+			for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+			{
+				const uint32_t segment_num_samples = num_samples_per_segment[segment_index];
+				const uint32_t segment_start_index = uniform_start_indices[segment_index];
+				uniform_start_indices[segment_index + 1] = segment_start_index + segment_num_samples;
+
+				min_segment_num_samples = std::min(min_segment_num_samples, segment_num_samples);
+				max_segment_num_samples = std::max(max_segment_num_samples, segment_num_samples);
+
+				reset_extents(segment_start_index);
+				for (uint32_t sample_index = segment_start_index + 1; sample_index < segment_start_index + segment_num_samples; ++sample_index)
+					extend_extents(sample_index);
+
+				uniform_cost += calculate_cost(segment_num_samples);
+			}
+
+			// Each inner boundary can move by less than half the average segment length
+			// This keeps the windows disjoint and the segment lookup close to the uniform case
+			const uint32_t approx_num_samples_per_segment = num_samples / num_segments;
+			const uint32_t window_radius = approx_num_samples_per_segment > 2 ? ((approx_num_samples_per_segment / 2) - 1) : 0;
+			const uint32_t window_size = (window_radius * 2) + 1;
+
+			const auto get_window_start = [num_segments, uniform_start_indices, window_radius](uint32_t boundary_index)
+			{
+				// The first and last boundaries are fixed
+				if (boundary_index == 0 || boundary_index == num_segments)
+					return uniform_start_indices[boundary_index];
+
+				return uniform_start_indices[boundary_index] - std::min(window_radius, uniform_start_indices[boundary_index]);
+			};
+
+			const auto get_window_end = [num_segments, num_samples, uniform_start_indices, window_radius](uint32_t boundary_index)
+			{
+				if (boundary_index == 0 || boundary_index == num_segments)
+					return uniform_start_indices[boundary_index];
+
+				return std::min(uniform_start_indices[boundary_index] + window_radius, num_samples - 1);
+			};
+
+			// Best cost and previous boundary for every candidate position of every boundary
+			const size_t num_entries = size_t(num_segments + 1) * window_size;
+			double* best_costs = allocate_type_array<double>(allocator, num_entries);
+			uint32_t* best_previous = allocate_type_array<uint32_t>(allocator, num_entries);
+			std::fill(best_costs, best_costs + num_entries, std::numeric_limits<double>::infinity());
+
+			best_costs[0] = 0.0;
+
+			for (uint32_t boundary_index = 1; boundary_index <= num_segments; ++boundary_index)
+			{
+				const uint32_t prev_window_start = get_window_start(boundary_index - 1);
+				const uint32_t prev_window_end = get_window_end(boundary_index - 1);
+				const uint32_t window_start = get_window_start(boundary_index);
+				const uint32_t window_end = get_window_end(boundary_index);
+
+				const double* prev_costs = best_costs + (size_t(boundary_index - 1) * window_size);
+				double* costs = best_costs + (size_t(boundary_index) * window_size);
+				uint32_t* previous = best_previous + (size_t(boundary_index) * window_size);
+
+				for (uint32_t segment_start_index = prev_window_start; segment_start_index <= prev_window_end; ++segment_start_index)
+				{
+					const double prev_cost = prev_costs[segment_start_index - prev_window_start];
+					if (prev_cost == std::numeric_limits<double>::infinity())
+						continue;	// Unreachable
+
+					// Grow our segment one sample at a time and evaluate every end within the window
+					const uint32_t last_segment_end_index = std::min(segment_start_index + max_segment_num_samples, window_end);
+
+					reset_extents(segment_start_index);
+					for (uint32_t segment_end_index = segment_start_index + 1; segment_end_index <= last_segment_end_index; ++segment_end_index)
+					{
+						extend_extents(segment_end_index - 1);
+
+						const uint32_t segment_num_samples = segment_end_index - segment_start_index;
+						if (segment_end_index < window_start || segment_num_samples < min_segment_num_samples)
+							continue;
+
+						const double cost = prev_cost + calculate_cost(segment_num_samples);
+						if (cost < costs[segment_end_index - window_start])
+						{
+							costs[segment_end_index - window_start] = cost;
+							previous[segment_end_index - window_start] = segment_start_index;
+						}
+					}
+				}
+			}
+
+			// Keep the uniform split unless we are meaningfully better, this avoids churn from rounding noise
+			const double adaptive_cost = best_costs[size_t(num_segments) * window_size];
+			if (adaptive_cost < uniform_cost - 1.0E-3 * std::abs(uniform_cost))
+			{
+				uint32_t* adaptive_num_samples_per_segment = allocate_type_array<uint32_t>(allocator, num_segments);
+
+				uint32_t segment_end_index = num_samples;
+				for (uint32_t boundary_index = num_segments; boundary_index > 0; --boundary_index)
+				{
+					const uint32_t segment_start_index = best_previous[(size_t(boundary_index) * window_size) + (segment_end_index - get_window_start(boundary_index))];
+					adaptive_num_samples_per_segment[boundary_index - 1] = segment_end_index - segment_start_index;
+					segment_end_index = segment_start_index;
+				}
+
+				ACL_ASSERT(segment_end_index == 0, "Adaptive segments should start at the first sample");
+
+				if (is_segment_layout_seekable(adaptive_num_samples_per_segment, num_segments, num_samples))
+					std::copy(adaptive_num_samples_per_segment, adaptive_num_samples_per_segment + num_segments, num_samples_per_segment);
+
+				deallocate_type_array(allocator, adaptive_num_samples_per_segment, num_segments);
+			}
+
+			deallocate_type_array(allocator, best_previous, num_entries);
+			deallocate_type_array(allocator, best_costs, num_entries);
+			deallocate_type_array(allocator, uniform_start_indices, num_segments + 1);
+			deallocate_type_array(allocator, channel_max, num_channels);
+			deallocate_type_array(allocator, channel_min, num_channels);
+			deallocate_type_array(allocator, channel_values, size_t(num_samples) * num_channels);
+		}
+
 		inline void segment_streams(iallocator& allocator, clip_context& clip, const compression_segmenting_settings& settings)
 		{
 			ACL_ASSERT(clip.num_segments == 1, "clip_context must have a single segment.");
@@ -139,6 +419,12 @@ namespace acl
 			uint32_t* num_samples_per_segment = split_samples_per_segment(allocator, clip.num_samples, settings, num_estimated_segments, num_segments);
 			ACL_ASSERT(num_samples_per_segment != nullptr, "Expected at least one segment");
 
+			if (settings.enable_adaptive_segmenting)
+				adapt_samples_per_segment(allocator, clip, settings, num_samples_per_segment, num_segments);
+
+			// Seeking relies on every sample being found near its estimated segment, see seek_v0(..)
+			ACL_ASSERT(is_segment_layout_seekable(num_samples_per_segment, num_segments, clip.num_samples), "Segment layout isn't seekable");
+
 			segment_context* clip_segment = clip.segments;
 			clip.segments = allocate_type_array<segment_context>(allocator, num_segments);
 			clip.num_segments = num_segments;
@@ -225,6 +511,11 @@ namespace acl
 					segment_bone_stream.is_translation_default = clip_bone_stream.is_translation_default;
 					segment_bone_stream.is_scale_constant = clip_bone_stream.is_scale_constant;
 					segment_bone_stream.is_scale_default = clip_bone_stream.is_scale_default;
+					segment_bone_stream.is_rotation_quantized = clip_bone_stream.is_rotation_quantized;
+					segment_bone_stream.rotation_dropped_component = clip_bone_stream.rotation_dropped_component;
+					segment_bone_stream.is_rotation_log = clip_bone_stream.is_rotation_log;
+					std::memcpy(&segment_bone_stream.translation_bit_rate_reductions[0], &clip_bone_stream.translation_bit_rate_reductions[0], sizeof(segment_bone_stream.translation_bit_rate_reductions));
+					std::memcpy(&segment_bone_stream.scale_bit_rate_reductions[0], &clip_bone_stream.scale_bit_rate_reductions[0], sizeof(segment_bone_stream.scale_bit_rate_reductions));
 
 					// Extract our potential segment constant values now before we normalize over the segment
 					segment_bone_stream.constant_rotation = segment_bone_stream.rotations.get_raw_sample<rtm::vector4f>(0);
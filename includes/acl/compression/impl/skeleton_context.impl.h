@@ -0,0 +1,91 @@
+
+
+// Included only once from skeleton_context.h
+
+#include "acl/version.h"
+#include "acl/core/error_result.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/track_types.h"
+#include "acl/compression/track_array.h"
+#include "acl/compression/impl/transform_hierarchy.h"
+
+#include <cstdint>
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	inline skeleton_context::skeleton_context()
+		: m_allocator(nullptr)
+		, m_parent_indices(nullptr)
+		, m_hierarchy()
+	{
+	}
+
+	inline skeleton_context::~skeleton_context()
+	{
+		reset();
+	}
+
+	inline error_result skeleton_context::initialize(iallocator& allocator, const track_array_qvvf& track_list)
+	{
+		reset();
+
+		const uint32_t num_transforms = track_list.get_num_tracks();
+		if (num_transforms == 0)
+			return error_result("Skeleton has no transforms");
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			const uint32_t parent_index = track_list[transform_index].get_description().parent_index;
+			if (parent_index != k_invalid_track_index && (parent_index >= num_transforms || parent_index == transform_index))
+				return error_result("Invalid parent index");
+		}
+
+		m_allocator = &allocator;
+		m_parent_indices = allocate_type_array<uint32_t>(allocator, num_transforms);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+			m_parent_indices[transform_index] = track_list[transform_index].get_description().parent_index;
+
+		const uint32_t* parent_indices = m_parent_indices;
+		const auto get_parent_index = [parent_indices](uint32_t transform_index) { return parent_indices[transform_index]; };
+
+		// Chain transform indices are only built here, every clip that shares them saves their computation
+		acl_impl::initialize_transform_hierarchy(allocator, num_transforms, get_parent_index, true, m_hierarchy);
+
+		return error_result();
+	}
+
+	inline void skeleton_context::reset()
+	{
+		if (m_allocator == nullptr)
+			return;	// Not initialized
+
+		deallocate_type_array(*m_allocator, m_parent_indices, m_hierarchy.num_transforms);
+		acl_impl::destroy_transform_hierarchy(*m_allocator, m_hierarchy);
+
+		m_allocator = nullptr;
+		m_parent_indices = nullptr;
+	}
+
+	inline bool skeleton_context::is_compatible(const track_array_qvvf& track_list) const
+	{
+		if (!is_initialized())
+			return false;
+
+		const uint32_t num_transforms = track_list.get_num_tracks();
+		if (num_transforms != m_hierarchy.num_transforms)
+			return false;
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			if (track_list[transform_index].get_description().parent_index != m_parent_indices[transform_index])
+				return false;
+		}
+
+		return true;
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
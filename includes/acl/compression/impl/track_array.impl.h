@@ -28,16 +28,20 @@
 
 #include "acl/version.h"
 #include "acl/core/error_result.h"
+#include "acl/core/hash.h"
 #include "acl/core/iallocator.h"
 #include "acl/core/interpolation_utils.h"
 #include "acl/core/track_types.h"
 #include "acl/core/track_writer.h"
 
+#include <rtm/qvvf.h>
 #include <rtm/quatf.h>
 #include <rtm/scalarf.h>
 #include <rtm/vector4f.h>
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 
 namespace acl
 {
@@ -202,6 +206,27 @@ namespace acl
 				return error_result("Output indices are not contiguous");
 		}
 
+		// Validate LOD levels, the output tracks retained at an LOD must precede the ones it drops
+		if (get_track_category() == track_category8::transformf)
+		{
+			for (uint32_t track_index = 0; track_index < m_num_tracks; ++track_index)
+			{
+				const track& track_ = m_tracks[track_index];
+				const uint32_t output_index = track_.get_output_index();
+				if (output_index == k_invalid_track_index)
+					continue;	// Stripped
+
+				const uint32_t lod_level = track_.get_description<track_desc_transformf>().lod_level;
+				for (uint32_t track_index2 = 0; track_index2 < m_num_tracks; ++track_index2)
+				{
+					const track& track2_ = m_tracks[track_index2];
+					const uint32_t output_index2 = track2_.get_output_index();
+					if (output_index2 != k_invalid_track_index && output_index2 > output_index && track2_.get_description<track_desc_transformf>().lod_level < lod_level)
+						return error_result("Output indices must be sorted by increasing lod_level");
+				}
+			}
+		}
+
 		return error_result();
 	}
 
@@ -455,6 +480,97 @@ namespace acl
 		return total_size;
 	}
 
+	inline uint64_t track_array::get_content_hash() const
+	{
+		const uint32_t num_samples = get_num_samples_per_track();
+		const track_type8 track_type = get_track_type();
+		const float sample_rate = get_sample_rate();
+
+		uint64_t hash_value = 0;
+		hash_value = hash_combine(hash_value, hash64(track_type));
+		hash_value = hash_combine(hash_value, hash64(m_num_tracks));
+		hash_value = hash_combine(hash_value, hash64(num_samples));
+		hash_value = hash_combine(hash_value, hash64(sample_rate));
+		hash_value = hash_combine(hash_value, hash64(m_looping_policy));
+		hash_value = hash_combine(hash_value, hash64(m_name.c_str()));
+
+		// Samples are gathered into a small buffer to skip padding and strides, each
+		// chunk is hashed with the hash of the previous chunk as seed
+		constexpr uint32_t k_chunk_buffer_size = 1024;
+		alignas(16) uint8_t chunk_buffer[k_chunk_buffer_size];
+
+		for (uint32_t track_index = 0; track_index < m_num_tracks; ++track_index)
+		{
+			const track& track_ = m_tracks[track_index];
+
+			hash_value = hash_combine(hash_value, hash64(track_.get_name().c_str()));
+
+			if (track_type == track_type8::qvvf)
+			{
+				const track_desc_transformf& desc = track_.get_description<track_desc_transformf>();
+
+				float default_value[10];
+				rtm::quat_store(desc.default_value.rotation, &default_value[0]);
+				rtm::vector_store3(desc.default_value.translation, &default_value[4]);
+				rtm::vector_store3(desc.default_value.scale, &default_value[7]);
+
+				hash_value = hash_combine(hash_value, hash64(default_value));
+				hash_value = hash_combine(hash_value, hash64(desc.output_index));
+				hash_value = hash_combine(hash_value, hash64(desc.parent_index));
+				hash_value = hash_combine(hash_value, hash64(desc.precision));
+				hash_value = hash_combine(hash_value, hash64(desc.shell_distance));
+				hash_value = hash_combine(hash_value, hash64(desc.importance));
+			}
+			else
+			{
+				const track_desc_scalarf& desc = track_.get_description<track_desc_scalarf>();
+
+				hash_value = hash_combine(hash_value, hash64(desc.output_index));
+				hash_value = hash_combine(hash_value, hash64(desc.precision));
+			}
+
+			const uint32_t sample_size = track_type == track_type8::qvvf ? uint32_t(10 * sizeof(float)) : track_.get_sample_size();
+			if (sample_size == 0 || num_samples == 0)
+				continue;
+
+			if (track_type != track_type8::qvvf && track_.get_stride() == sample_size)
+			{
+				// Contiguous samples, hash them in place
+				hash_value = hash64_fast(track_[0], size_t(num_samples) * sample_size, hash_value);
+				continue;
+			}
+
+			const uint32_t num_samples_per_chunk = k_chunk_buffer_size / sample_size;
+			for (uint32_t chunk_start_index = 0; chunk_start_index < num_samples; chunk_start_index += num_samples_per_chunk)
+			{
+				const uint32_t num_chunk_samples = std::min<uint32_t>(num_samples - chunk_start_index, num_samples_per_chunk);
+
+				uint8_t* chunk_ptr = &chunk_buffer[0];
+				for (uint32_t sample_index = 0; sample_index < num_chunk_samples; ++sample_index)
+				{
+					const void* sample_ptr = track_[chunk_start_index + sample_index];
+
+					if (track_type == track_type8::qvvf)
+					{
+						const rtm::qvvf& sample = *static_cast<const rtm::qvvf*>(sample_ptr);
+						float* sample_values = reinterpret_cast<float*>(chunk_ptr);
+						rtm::quat_store(sample.rotation, &sample_values[0]);
+						rtm::vector_store3(sample.translation, &sample_values[4]);
+						rtm::vector_store3(sample.scale, &sample_values[7]);
+					}
+					else
+						std::memcpy(chunk_ptr, sample_ptr, sample_size);
+
+					chunk_ptr += sample_size;
+				}
+
+				hash_value = hash64_fast(&chunk_buffer[0], size_t(num_chunk_samples) * sample_size, hash_value);
+			}
+		}
+
+		return hash_value;
+	}
+
 	template<track_type8 track_type_>
 	inline typename track_array_typed<track_type_>::track_member_type& track_array_typed<track_type_>::operator[](uint32_t index)
 	{
@@ -501,5 +617,18 @@ namespace acl
 		return static_cast<const track_array_type*>(track_array_);
 	}
 
+	inline uint32_t calculate_num_lod_tracks(const track_array_qvvf& track_list, uint32_t lod)
+	{
+		uint32_t num_lod_tracks = 0;
+		for (const track_qvvf& track_ : track_list)
+		{
+			const track_desc_transformf& desc = track_.get_description();
+			if (desc.output_index != k_invalid_track_index && desc.lod_level <= lod)
+				num_lod_tracks++;
+		}
+
+		return num_lod_tracks;
+	}
+
 	ACL_IMPL_VERSION_NAMESPACE_END
 }
@@ -36,6 +36,7 @@
 #include <rtm/qvvf.h>
 #include <rtm/vector4f.h>
 
+#include <algorithm>
 #include <cstdint>
 
 // 0 = disabled, 1 = enabled
@@ -180,11 +181,14 @@ namespace acl
 		//////////////////////////////////////////////////////////////////////////
 		// This class manages bit rate queries against tracks.
 		// It will cache recently requested bit rates to speed up repeating queries.
+		// Up to 4 bit rates are cached per track, when a maximum size is provided, fewer
+		// bit rates are cached to fit and the least recently used one is evicted. At least
+		// one bit rate per track is always cached since queries need them all at once.
 		//////////////////////////////////////////////////////////////////////////
 		class track_bit_rate_database
 		{
 		public:
-			track_bit_rate_database(iallocator& allocator, rotation_format8 rotation_format, vector_format8 translation_format, vector_format8 scale_format, const transform_streams* bone_streams, const transform_streams* raw_bone_steams, uint32_t num_transforms, uint32_t num_samples_per_track);
+			track_bit_rate_database(iallocator& allocator, rotation_format8 rotation_format, vector_format8 translation_format, vector_format8 scale_format, const transform_streams* bone_streams, const transform_streams* raw_bone_steams, uint32_t num_transforms, uint32_t num_samples_per_track, size_t max_size = 0);
 			~track_bit_rate_database();
 
 			void set_segment(const transform_streams* bone_streams, uint32_t num_transforms, uint32_t num_samples_per_track);
@@ -194,12 +198,14 @@ namespace acl
 			void sample(const every_track_query& query, float sample_time, rtm::qvvf* out_transforms, uint32_t num_transforms);
 
 			size_t get_allocated_size() const;
+			uint32_t get_num_cached_bit_rates_per_track() const { return m_num_bit_rates_cached_per_track; }
 
 		private:
 			track_bit_rate_database(const track_bit_rate_database&) = delete;
 			track_bit_rate_database& operator=(const track_bit_rate_database&) = delete;
 
 			void find_cache_entries(uint32_t track_index, const transform_bit_rates& bit_rates, uint32_t& out_rotation_cache_index, uint32_t& out_translation_cache_index, uint32_t& out_scale_cache_index);
+			void recycle_buffers(uint32_t num_samples_per_track);
 
 			RTM_FORCE_INLINE rtm::quatf RTM_SIMD_CALL sample_rotation(const sample_context& context, uint32_t rotation_cache_index);
 			RTM_FORCE_INLINE rtm::vector4f RTM_SIMD_CALL sample_translation(const sample_context& context, uint32_t translation_cache_index);
@@ -239,6 +245,7 @@ namespace acl
 			uint32_t			m_num_transforms;
 			uint32_t			m_num_samples_per_track;
 			uint32_t			m_num_entries_per_transform;
+			uint32_t			m_num_bit_rates_cached_per_track;
 			uint32_t			m_track_size;
 
 			bitset_description	m_bitset_desc;
@@ -353,7 +360,7 @@ namespace acl
 			return -1;
 		}
 
-		inline track_bit_rate_database::track_bit_rate_database(iallocator& allocator, rotation_format8 rotation_format, vector_format8 translation_format, vector_format8 scale_format, const transform_streams* bone_streams, const transform_streams* raw_bone_steams, uint32_t num_transforms, uint32_t num_samples_per_track)
+		inline track_bit_rate_database::track_bit_rate_database(iallocator& allocator, rotation_format8 rotation_format, vector_format8 translation_format, vector_format8 scale_format, const transform_streams* bone_streams, const transform_streams* raw_bone_steams, uint32_t num_transforms, uint32_t num_samples_per_track, size_t max_size)
 			: m_allocator(allocator)
 			, m_mutable_bone_streams(bone_streams)
 			, m_raw_bone_streams(raw_bone_steams)
@@ -366,13 +373,24 @@ namespace acl
 			m_has_scale = has_scale;
 
 			const uint32_t num_tracks_per_transform = has_scale ? 3 : 2;
-			const uint32_t num_entries_per_transform = num_tracks_per_transform * k_num_bit_rates_cached_per_track;
-			m_num_entries_per_transform = num_entries_per_transform;
+			const uint32_t num_tracks = num_transforms * num_tracks_per_transform;
 
-			const uint32_t num_cached_tracks = num_transforms * m_num_entries_per_transform;
+			const bitset_description bitset_desc = bitset_description::make_from_num_bits(num_samples_per_track);
 
-			m_bitset_desc = bitset_description::make_from_num_bits(num_samples_per_track);
-			m_bitref_constant = num_samples_per_track != 0 ? bitset_index_ref(m_bitset_desc, 0) : bitset_index_ref();
+			// Each track is padded and aligned to ensure that it starts on a cache line boundary.
+			const uint32_t track_size = align_to<uint32_t>(sizeof(rtm::vector4f) * num_samples_per_track, 64);
+
+			// We cache 4 bit rates for every rot/trans/scale track of each transform unless we are asked to use less memory
+			uint32_t num_bit_rates_cached_per_track = k_num_bit_rates_cached_per_track;
+			if (max_size != 0)
+			{
+				const size_t cache_entries_size = sizeof(transform_cache_entry) * num_transforms;
+				const size_t bit_rate_size = (track_size + bitset_desc.get_num_bytes()) * size_t(num_tracks);
+				const size_t num_bit_rates_that_fit = max_size > cache_entries_size && bit_rate_size != 0 ? ((max_size - cache_entries_size) / bit_rate_size) : 0;
+				num_bit_rates_cached_per_track = uint32_t(std::max<size_t>(std::min<size_t>(num_bit_rates_that_fit, k_num_bit_rates_cached_per_track), 1));
+			}
+
+			const uint32_t num_cached_tracks = num_tracks * num_bit_rates_cached_per_track;
 
 			m_rotation_format = rotation_format;
 			m_translation_format = translation_format;
@@ -383,19 +401,16 @@ namespace acl
 
 			m_generation_id = 1;
 
-			const uint32_t track_bitsets_size = m_bitset_desc.get_size() * num_cached_tracks;
+			const uint32_t track_bitsets_size = bitset_desc.get_size() * num_cached_tracks;
 			m_track_entry_bitsets = allocate_type_array<uint32_t>(allocator, track_bitsets_size);
 			m_track_bitsets_size = track_bitsets_size;
 
-			// We allocate a single float buffer to accommodate 4 bit rates for every rot/trans/scale track of each transform.
-			// Each track is padded and aligned to ensure that it starts on a cache line boundary.
-			const uint32_t track_size = align_to<uint32_t>(sizeof(rtm::vector4f) * num_samples_per_track, 64);
-			m_track_size = track_size;
-
+			// We allocate a single float buffer to accommodate every cached bit rate.
 			const uint32_t data_size = track_size * num_cached_tracks;
 			m_data = reinterpret_cast<uint8_t*>(allocator.allocate(data_size, 64));
 			m_data_size = data_size;
-			m_num_cached_tracks = num_cached_tracks;
+
+			recycle_buffers(num_samples_per_track);
 		}
 
 		inline track_bit_rate_database::~track_bit_rate_database()
@@ -411,11 +426,13 @@ namespace acl
 			ACL_ASSERT(num_transforms == m_num_transforms, "The number of transforms isn't consistent, we will corrupt the heap");
 			ACL_ASSERT(num_samples_per_track <= m_num_samples_per_track, "Not enough memory has been reserved, we will corrupt the heap");
 			(void)num_transforms;
-			(void)num_samples_per_track;
 			(void)m_num_samples_per_track;
 
 			m_mutable_bone_streams = bone_streams;
 
+			// Segments with fewer samples can cache more bit rates within the same buffers
+			recycle_buffers(num_samples_per_track);
+
 			// Reset our cache
 			for (uint32_t transform_index = 0; transform_index < m_num_transforms; ++transform_index)
 				m_transforms[transform_index] = transform_cache_entry();
@@ -425,6 +442,30 @@ namespace acl
 #endif
 		}
 
+		inline void track_bit_rate_database::recycle_buffers(uint32_t num_samples_per_track)
+		{
+			// Our buffers are allocated once, we split them into as many cached bit rates as they can hold
+			const uint32_t num_tracks_per_transform = m_has_scale ? 3 : 2;
+			const size_t num_tracks = size_t(m_num_transforms) * num_tracks_per_transform;
+
+			m_bitset_desc = bitset_description::make_from_num_bits(num_samples_per_track);
+			m_bitref_constant = num_samples_per_track != 0 ? bitset_index_ref(m_bitset_desc, 0) : bitset_index_ref();
+			m_track_size = align_to<uint32_t>(sizeof(rtm::vector4f) * num_samples_per_track, 64);
+
+			size_t num_bit_rates_that_fit = k_num_bit_rates_cached_per_track;
+			if (num_tracks != 0 && m_track_size != 0)
+			{
+				num_bit_rates_that_fit = std::min<size_t>(num_bit_rates_that_fit, m_data_size / (m_track_size * num_tracks));
+				num_bit_rates_that_fit = std::min<size_t>(num_bit_rates_that_fit, m_track_bitsets_size / (m_bitset_desc.get_size() * num_tracks));
+			}
+
+			ACL_ASSERT(num_bit_rates_that_fit != 0, "Not enough memory has been reserved, we will corrupt the heap");
+
+			m_num_bit_rates_cached_per_track = uint32_t(num_bit_rates_that_fit);
+			m_num_entries_per_transform = num_tracks_per_transform * m_num_bit_rates_cached_per_track;
+			m_num_cached_tracks = num_tracks * m_num_bit_rates_cached_per_track;
+		}
+
 		inline void track_bit_rate_database::find_cache_entries(uint32_t track_index, const transform_bit_rates& bit_rates, uint32_t& out_rotation_cache_index, uint32_t& out_translation_cache_index, uint32_t& out_scale_cache_index)
 		{
 			// Memory layout:
@@ -446,11 +487,13 @@ namespace acl
 			//            entry 3		11
 			//    track 1
 			// ...
+			// When fewer than 4 bit rates are cached per track, the entries are tightly packed.
 
 			const uint32_t num_entries_per_transform = m_num_entries_per_transform;
+			const uint32_t num_bit_rates_cached_per_track = m_num_bit_rates_cached_per_track;
 			const uint32_t base_track_offset = track_index * num_entries_per_transform;
-			const uint32_t base_rotation_offset = base_track_offset + (0 * k_num_bit_rates_cached_per_track);
-			const uint32_t base_translation_offset = base_track_offset + (1 * k_num_bit_rates_cached_per_track);
+			const uint32_t base_rotation_offset = base_track_offset + (0 * num_bit_rates_cached_per_track);
+			const uint32_t base_translation_offset = base_track_offset + (1 * num_bit_rates_cached_per_track);
 
 			const size_t bitset_size = m_bitset_desc.get_size();
 
@@ -480,13 +523,16 @@ namespace acl
 			{
 				const int32_t slot_index = entry.find_bit_rate_index(entry.rotation_bit_rates, bit_rates.rotation);
 				if (slot_index >= 0)
+				{
 					rotation_cache_index = base_rotation_offset + slot_index;
+					entry.rotation_generation_ids[slot_index] = m_generation_id++;	// Most recently used
+				}
 				else
 				{
 					// Failed to find a cached entry for this track and bit rate, clear the oldest entry
 					uint32_t oldest_generation_id = entry.rotation_generation_ids[0];
 					uint32_t oldest_index = 0;
-					for (uint32_t i = 1; i < 4; ++i)
+					for (uint32_t i = 1; i < num_bit_rates_cached_per_track; ++i)
 					{
 						if (entry.rotation_generation_ids[i] < oldest_generation_id)
 						{
@@ -536,13 +582,16 @@ namespace acl
 			{
 				const int32_t slot_index = entry.find_bit_rate_index(entry.translation_bit_rates, bit_rates.translation);
 				if (slot_index >= 0)
+				{
 					translation_cache_index = base_translation_offset + slot_index;
+					entry.translation_generation_ids[slot_index] = m_generation_id++;	// Most recently used
+				}
 				else
 				{
 					// Failed to find a cached entry for this track and bit rate, clear the oldest entry
 					uint32_t oldest_generation_id = entry.translation_generation_ids[0];
 					uint32_t oldest_index = 0;
-					for (uint32_t i = 1; i < 4; ++i)
+					for (uint32_t i = 1; i < num_bit_rates_cached_per_track; ++i)
 					{
 						if (entry.translation_generation_ids[i] < oldest_generation_id)
 						{
@@ -573,7 +622,7 @@ namespace acl
 				scale_cache_index = 0xFFFFFFFFU;
 			else
 			{
-				const uint32_t base_scale_offset = base_track_offset + (2 * k_num_bit_rates_cached_per_track);
+				const uint32_t base_scale_offset = base_track_offset + (2 * num_bit_rates_cached_per_track);
 
 				if (bit_rates.scale == k_invalid_bit_rate)
 				{
@@ -598,13 +647,16 @@ namespace acl
 				{
 					const int32_t slot_index = entry.find_bit_rate_index(entry.scale_bit_rates, bit_rates.scale);
 					if (slot_index >= 0)
+					{
 						scale_cache_index = base_scale_offset + slot_index;
+						entry.scale_generation_ids[slot_index] = m_generation_id++;	// Most recently used
+					}
 					else
 					{
 						// Failed to find a cached entry for this track and bit rate, clear the oldest entry
 						uint32_t oldest_generation_id = entry.scale_generation_ids[0];
 						uint32_t oldest_index = 0;
-						for (uint32_t i = 1; i < 4; ++i)
+						for (uint32_t i = 1; i < num_bit_rates_cached_per_track; ++i)
 						{
 							if (entry.scale_generation_ids[i] < oldest_generation_id)
 							{
@@ -0,0 +1,288 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/bitset.h"
+#include "acl/core/interpolation_utils.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/impl/compressed_headers.h"
+#include "acl/core/impl/variable_bit_rates.h"
+#include "acl/compression/compression_settings.h"
+#include "acl/compression/impl/quantize_track_impl.h"
+#include "acl/compression/impl/track_list_context.h"
+
+#include <rtm/mask4f.h>
+#include <rtm/vector4f.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Scalar tracks are split into database segments of k_num_samples_per_scalar_database_segment samples.
+		// Like transform segments (see find_contributing_error(..) in quantize_streams.h), we greedily remove
+		// the frame that contributes the least error until only the first and last frames of the segment remain.
+		// The error of a frame is the largest absolute component error of every animated track over the frames
+		// we interpolate once it is removed. It is measured in the units of the tracks, like their precision.
+		//////////////////////////////////////////////////////////////////////////
+
+		// Returns the lossy sample as it will be decompressed
+		inline rtm::vector4f RTM_SIMD_CALL get_lossy_scalarf_sample(const track_list_context& context, uint32_t track_index, uint32_t sample_index)
+		{
+			using namespace rtm;
+
+			const uint8_t bit_rate = context.bit_rate_list[track_index].scalar.value;
+			const track_vector4f& mut_track = track_cast<const track_vector4f>(context.track_list[track_index]);
+
+			if (is_raw_bit_rate(bit_rate))
+				return mut_track[sample_index];	// Raw samples are stored as is
+
+			const quantization_scales scales(get_num_bits_at_bit_rate(bit_rate));
+			vector4f sample = vector_mul(mut_track[sample_index], scales.inv_max_value);
+
+			if (context.is_segmented())
+			{
+				const scalarf_range& segment_range = context.segment_range_list[((sample_index / context.num_samples_per_segment) * context.num_tracks) + track_index].range.scalarf;
+				sample = vector_mul_add(sample, segment_range.get_extent(), segment_range.get_min());
+			}
+
+			const scalarf_range& range = context.range_list[track_index].range.scalarf;
+			return vector_mul_add(sample, range.get_extent(), range.get_min());
+		}
+
+		// Returns the largest error over the frames in between the two interpolation frames
+		inline float calculate_scalarf_interpolation_error(const track_list_context& context, const uint32_t* animated_track_indices, uint32_t num_animated_tracks,
+			uint32_t segment_start_index, uint32_t interp_start_frame_index, uint32_t interp_end_frame_index)
+		{
+			using namespace rtm;
+
+			const uint32_t num_components = get_track_num_sample_elements(context.reference_list->get_track_type());
+			const mask4f sample_mask = vector_less_than(vector_set(0.0F, 1.0F, 2.0F, 3.0F), vector_set(float(num_components)));
+			const vector4f zero = vector_zero();
+
+			vector4f max_error = zero;
+
+			for (uint32_t animated_index = 0; animated_index < num_animated_tracks; ++animated_index)
+			{
+				const uint32_t track_index = animated_track_indices[animated_index];
+				const track& ref_track = (*context.reference_list)[track_index];
+				const uint32_t element_size = ref_track.get_sample_size();
+
+				const vector4f interp_start_sample = get_lossy_scalarf_sample(context, track_index, segment_start_index + interp_start_frame_index);
+				const vector4f interp_end_sample = get_lossy_scalarf_sample(context, track_index, segment_start_index + interp_end_frame_index);
+
+				for (uint32_t interp_frame_index = interp_start_frame_index + 1; interp_frame_index < interp_end_frame_index; ++interp_frame_index)
+				{
+					const float interpolation_alpha = find_linear_interpolation_alpha(float(interp_frame_index), interp_start_frame_index, interp_end_frame_index, sample_rounding_policy::none);
+					const vector4f lossy_sample = vector_lerp(interp_start_sample, interp_end_sample, interpolation_alpha);
+
+					vector4f raw_sample = zero;
+					std::memcpy(&raw_sample, ref_track[segment_start_index + interp_frame_index], element_size);
+
+					const vector4f delta = vector_select(sample_mask, vector_abs(vector_sub(raw_sample, lossy_sample)), zero);
+					max_error = vector_max(max_error, delta);
+				}
+			}
+
+			return vector_get_max_component(max_error);
+		}
+
+		// Finds the contributing error of every frame of a database segment, sorted lowest first
+		inline void find_scalar_segment_contributing_error(const track_list_context& context, const uint32_t* animated_track_indices, uint32_t num_animated_tracks,
+			uint32_t segment_index, frame_contributing_error* contributing_error)
+		{
+			const uint32_t segment_start_index = segment_index * k_num_samples_per_scalar_database_segment;
+			const uint32_t num_frames = std::min<uint32_t>(context.num_samples - segment_start_index, k_num_samples_per_scalar_database_segment);
+			const bitset_description desc = bitset_description::make_from_num_bits<32>();
+			constexpr float infinity = std::numeric_limits<float>::infinity();
+
+			// First and last frame of the segment cannot be removed and thus contribute infinite error
+			contributing_error[0] = frame_contributing_error{ 0, infinity };
+			contributing_error[num_frames - 1] = frame_contributing_error{ num_frames - 1, infinity };
+
+			// Removing a frame only changes the error of its retained neighbors, we cache the rest
+			float candidate_errors[k_num_samples_per_scalar_database_segment];
+			uint32_t frames_retained = ~0U;	// By default, every frame is present
+
+			for (uint32_t frame_index = 1; frame_index + 1 < num_frames; ++frame_index)
+				candidate_errors[frame_index] = calculate_scalarf_interpolation_error(context, animated_track_indices, num_animated_tracks, segment_start_index, frame_index - 1, frame_index + 1);
+
+			// We iterate until every frame but the first and last have been removed
+			for (uint32_t iteration_count = 1; iteration_count + 1 < num_frames; ++iteration_count)
+			{
+				frame_contributing_error best_error{ num_frames, infinity };
+
+				for (uint32_t frame_index = 1; frame_index + 1 < num_frames; ++frame_index)
+				{
+					if (!bitset_test(&frames_retained, desc, frame_index))
+						continue;	// This frame has already been removed, skip it
+
+					if (candidate_errors[frame_index] < best_error.error || best_error.index == num_frames)
+						best_error = frame_contributing_error{ frame_index, candidate_errors[frame_index] };
+				}
+
+				ACL_ASSERT(best_error.index != num_frames, "Failed to find the best contributing error");
+
+				// We found the best frame to remove, remove it
+				contributing_error[best_error.index] = best_error;
+				bitset_set(&frames_retained, desc, best_error.index, false);
+
+				// Update the error of the retained frames on each side, they now interpolate over the removed frame
+				uint32_t prev_frame_index = best_error.index - 1;
+				while (!bitset_test(&frames_retained, desc, prev_frame_index))
+					prev_frame_index--;
+
+				uint32_t next_frame_index = best_error.index + 1;
+				while (!bitset_test(&frames_retained, desc, next_frame_index))
+					next_frame_index++;
+
+				if (prev_frame_index != 0)
+				{
+					uint32_t interp_start_frame_index = prev_frame_index - 1;
+					while (!bitset_test(&frames_retained, desc, interp_start_frame_index))
+						interp_start_frame_index--;
+
+					candidate_errors[prev_frame_index] = calculate_scalarf_interpolation_error(context, animated_track_indices, num_animated_tracks, segment_start_index, interp_start_frame_index, next_frame_index);
+				}
+
+				if (next_frame_index != num_frames - 1)
+				{
+					uint32_t interp_end_frame_index = next_frame_index + 1;
+					while (!bitset_test(&frames_retained, desc, interp_end_frame_index))
+						interp_end_frame_index++;
+
+					candidate_errors[next_frame_index] = calculate_scalarf_interpolation_error(context, animated_track_indices, num_animated_tracks, segment_start_index, prev_frame_index, interp_end_frame_index);
+				}
+			}
+
+			// We found the contributing error for every frame, sort them by lowest error first
+			auto sort_predicate = [](const frame_contributing_error& lhs, const frame_contributing_error& rhs) { return lhs.error < rhs.error; };
+			std::sort(contributing_error, contributing_error + num_frames, sort_predicate);
+		}
+
+		// State shared by every job finding the contributing error of database segments in parallel
+		struct scalar_contributing_error_job_context
+		{
+			track_list_context* context;
+			const uint32_t* animated_track_indices;
+			uint32_t num_animated_tracks;
+			uint32_t num_segments;
+			std::atomic<uint32_t> next_segment_index;
+		};
+
+		// Segments are independent, each job pulls segments until none remain
+		inline void execute_scalar_contributing_error_job(void* job_data)
+		{
+			scalar_contributing_error_job_context& job_context = *static_cast<scalar_contributing_error_job_context*>(job_data);
+			track_list_context& context = *job_context.context;
+
+			while (true)
+			{
+				const uint32_t segment_index = job_context.next_segment_index.fetch_add(1, std::memory_order_relaxed);
+				if (segment_index >= job_context.num_segments)
+					break;
+
+				frame_contributing_error* contributing_error = context.contributing_error + (segment_index * k_num_samples_per_scalar_database_segment);
+				find_scalar_segment_contributing_error(context, job_context.animated_track_indices, job_context.num_animated_tracks, segment_index, contributing_error);
+			}
+		}
+
+		// Must be called once our tracks are quantized
+		inline void find_contributing_error(track_list_context& context, const compression_job_scheduler& job_scheduler)
+		{
+			ACL_ASSERT(context.is_valid(), "Invalid context");
+			ACL_ASSERT(context.bit_rate_list != nullptr, "Tracks must be quantized first");
+
+			context.contributing_error = allocate_type_array<frame_contributing_error>(*context.allocator, context.num_samples);
+
+			const uint32_t num_segments = (context.num_samples + k_num_samples_per_scalar_database_segment - 1) / k_num_samples_per_scalar_database_segment;
+			if (num_segments == 0)
+				return;	// No samples
+
+			// Only the animated tracks we output contribute error
+			uint32_t* animated_track_indices = allocate_type_array<uint32_t>(*context.allocator, context.num_output_tracks);
+			uint32_t num_animated_tracks = 0;
+			for (uint32_t output_index = 0; output_index < context.num_output_tracks; ++output_index)
+			{
+				const uint32_t track_index = context.track_output_indices[output_index];
+				if (!context.is_constant(track_index))
+					animated_track_indices[num_animated_tracks++] = track_index;
+			}
+
+			scalar_contributing_error_job_context job_context;
+			job_context.context = &context;
+			job_context.animated_track_indices = animated_track_indices;
+			job_context.num_animated_tracks = num_animated_tracks;
+			job_context.num_segments = num_segments;
+			job_context.next_segment_index.store(0, std::memory_order_relaxed);
+
+			if (job_scheduler.is_enabled() && num_segments > 1)
+			{
+				const uint32_t max_num_jobs = job_scheduler.max_num_jobs != 0 ? job_scheduler.max_num_jobs : num_segments;
+				const uint32_t num_jobs = std::min<uint32_t>(max_num_jobs, num_segments);
+
+				for (uint32_t job_index = 0; job_index < num_jobs; ++job_index)
+					job_scheduler.submit_job(job_scheduler.user_data, &execute_scalar_contributing_error_job, &job_context);
+
+				job_scheduler.wait_for_jobs(job_scheduler.user_data);
+			}
+			else
+				execute_scalar_contributing_error_job(&job_context);
+
+			deallocate_type_array(*context.allocator, animated_track_indices, context.num_output_tracks);
+		}
+
+		// Returns the number of bytes written, values are sorted per database segment
+		inline uint32_t write_contributing_error(const track_list_context& context, frame_contributing_error* out_contributing_error)
+		{
+			ACL_ASSERT(context.is_valid(), "Invalid context");
+
+			const uint32_t size = context.num_samples * uint32_t(sizeof(frame_contributing_error));
+
+			if (out_contributing_error != nullptr)
+			{
+				ACL_ASSERT(context.contributing_error != nullptr, "Contributing error not found");
+				std::memcpy(out_contributing_error, context.contributing_error, size);
+			}
+
+			return size;
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
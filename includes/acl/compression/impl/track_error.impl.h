@@ -32,6 +32,7 @@
 #include "acl/core/error_result.h"
 #include "acl/core/iallocator.h"
 #include "acl/core/impl/debug_track_writer.h"
+#include "acl/compression/compression_settings.h"
 #include "acl/compression/track_array.h"
 #include "acl/compression/transform_error_metrics.h"
 #include "acl/compression/impl/track_list_context.h"
@@ -40,6 +41,7 @@
 #include <rtm/scalarf.h>
 #include <rtm/vector4f.h>
 
+#include <algorithm>
 #include <cstdint>
 
 namespace acl
@@ -154,8 +156,15 @@ namespace acl
 			// Optional
 			uint32_t base_num_samples = 0;
 			float base_duration = 0.0F;
+
+			// Optional, the range of samples measured [first, last), every sample by default
+			uint32_t first_sample_index = 0;
+			uint32_t last_sample_index = ~0U;
 		};
 
+		// The number of samples whose error is measured at once with the error metric batch kernel
+		constexpr uint32_t k_num_track_error_batch_samples = 8;
+
 		inline track_error calculate_scalar_track_error(iallocator& allocator, const calculate_track_error_args& args)
 		{
 			const uint32_t num_samples = args.num_samples;
@@ -179,8 +188,11 @@ namespace acl
 
 			ACL_ASSERT(track_type != track_type8::qvvf, "Don't use calculate_scalar_track_error on track_type8::qvvf");
 
+			const uint32_t first_sample_index = args.first_sample_index;
+			const uint32_t last_sample_index = std::min<uint32_t>(args.last_sample_index, num_samples);
+
 			// Measure our error
-			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			for (uint32_t sample_index = first_sample_index; sample_index < last_sample_index; ++sample_index)
 			{
 				const float sample_time = rtm::scalar_min(float(sample_index) / sample_rate, duration);
 
@@ -252,8 +264,12 @@ namespace acl
 				lossy_local_pose_converted = allocate_type_array_aligned<uint8_t>(allocator, num_tracks * transform_size, 64);
 			}
 
-			uint8_t* raw_object_pose = allocate_type_array_aligned<uint8_t>(allocator, num_tracks * transform_size, 64);
-			uint8_t* lossy_object_pose = allocate_type_array_aligned<uint8_t>(allocator, num_tracks * transform_size, 64);
+			// Object space poses are measured in batches of samples, one pose per sample
+			const size_t pose_size = num_tracks * transform_size;
+			uint8_t* raw_object_poses = allocate_type_array_aligned<uint8_t>(allocator, pose_size * k_num_track_error_batch_samples, 64);
+			uint8_t* lossy_object_poses = allocate_type_array_aligned<uint8_t>(allocator, pose_size * k_num_track_error_batch_samples, 64);
+			float* batch_errors = allocate_type_array<float>(allocator, num_tracks * k_num_track_error_batch_samples);
+			float* batch_sample_times = allocate_type_array<float>(allocator, k_num_track_error_batch_samples);
 
 			uint32_t* parent_transform_indices = allocate_type_array<uint32_t>(allocator, num_tracks);
 			uint32_t* self_transform_indices = allocate_type_array<uint32_t>(allocator, num_tracks);
@@ -306,10 +322,18 @@ namespace acl
 			itransform_error_metric::local_to_object_space_args local_to_object_space_args_lossy = local_to_object_space_args_raw;
 			local_to_object_space_args_lossy.local_transforms = lossy_local_pose_;
 
+			itransform_error_metric::calculate_error_batch_args calculate_error_args;
+			calculate_error_args.transforms0_stride = pose_size;
+			calculate_error_args.transforms1_stride = pose_size;
+
 			track_error result;
 			result.error = -1.0F;		// Can never have a negative error, use -1 so the first sample is used
 
-			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			const uint32_t first_sample_index = args.first_sample_index;
+			const uint32_t last_sample_index = std::min<uint32_t>(args.last_sample_index, num_samples);
+			uint32_t num_batch_samples = 0;
+
+			for (uint32_t sample_index = first_sample_index; sample_index < last_sample_index; ++sample_index)
 			{
 				const float sample_time = rtm::scalar_min(float(sample_index) / sample_rate, clip_duration);
 
@@ -345,34 +369,54 @@ namespace acl
 					error_metric.apply_additive_to_base(apply_additive_to_base_args_lossy, lossy_local_pose_);
 				}
 
-				error_metric.local_to_object_space(local_to_object_space_args_raw, raw_object_pose);
-				error_metric.local_to_object_space(local_to_object_space_args_lossy, lossy_object_pose);
+				error_metric.local_to_object_space(local_to_object_space_args_raw, raw_object_poses + (num_batch_samples * pose_size));
+				error_metric.local_to_object_space(local_to_object_space_args_lossy, lossy_object_poses + (num_batch_samples * pose_size));
+
+				batch_sample_times[num_batch_samples] = sample_time;
+				num_batch_samples++;
 
+				const bool is_last_sample = sample_index + 1 == last_sample_index;
+				if (num_batch_samples < k_num_track_error_batch_samples && !is_last_sample)
+					continue;	// Keep filling our batch
+
+				// Measure every sample of the batch for each transform at once
 				for (uint32_t bone_index = 0; bone_index < num_tracks; ++bone_index)
 				{
 					const float shell_distance = args.adapter.get_shell_distance(bone_index);
 
-					itransform_error_metric::calculate_error_args calculate_error_args;
-					calculate_error_args.transform0 = raw_object_pose + (bone_index * transform_size);
-					calculate_error_args.transform1 = lossy_object_pose + (bone_index * transform_size);
 					calculate_error_args.construct_sphere_shell(shell_distance);
+					calculate_error_args.transforms0 = raw_object_poses + (bone_index * transform_size);
+					calculate_error_args.transforms1 = lossy_object_poses + (bone_index * transform_size);
 
-					const float error = rtm::scalar_cast(error_metric.calculate_error(calculate_error_args));
+					error_metric.calculate_error_batch(calculate_error_args, num_batch_samples, batch_errors + (bone_index * k_num_track_error_batch_samples));
+				}
 
-					if (error > result.error)
+				// Process the errors in sample order to find the same worst error as if we had measured them one by one
+				for (uint32_t batch_sample_index = 0; batch_sample_index < num_batch_samples; ++batch_sample_index)
+				{
+					for (uint32_t bone_index = 0; bone_index < num_tracks; ++bone_index)
 					{
-						result.error = error;
-						result.index = bone_index;
-						result.sample_time = sample_time;
+						const float error = batch_errors[(bone_index * k_num_track_error_batch_samples) + batch_sample_index];
+
+						if (error > result.error)
+						{
+							result.error = error;
+							result.index = bone_index;
+							result.sample_time = batch_sample_times[batch_sample_index];
+						}
 					}
 				}
+
+				num_batch_samples = 0;
 			}
 
 			deallocate_type_array(allocator, raw_local_pose_converted, num_tracks * transform_size);
 			deallocate_type_array(allocator, base_local_pose_converted, num_tracks * transform_size);
 			deallocate_type_array(allocator, lossy_local_pose_converted, num_tracks * transform_size);
-			deallocate_type_array(allocator, raw_object_pose, num_tracks * transform_size);
-			deallocate_type_array(allocator, lossy_object_pose, num_tracks * transform_size);
+			deallocate_type_array(allocator, raw_object_poses, pose_size * k_num_track_error_batch_samples);
+			deallocate_type_array(allocator, lossy_object_poses, pose_size * k_num_track_error_batch_samples);
+			deallocate_type_array(allocator, batch_errors, num_tracks * k_num_track_error_batch_samples);
+			deallocate_type_array(allocator, batch_sample_times, k_num_track_error_batch_samples);
 			deallocate_type_array(allocator, parent_transform_indices, num_tracks);
 			deallocate_type_array(allocator, self_transform_indices, num_tracks);
 
@@ -387,101 +431,35 @@ namespace acl
 			result.sample_time = -1.0F;
 			return result;
 		}
-	}
 
-	template<class decompression_context_type, acl_impl::is_decompression_context<decompression_context_type>>
-	inline track_error calculate_compression_error(iallocator& allocator, const track_array& raw_tracks, decompression_context_type& context)
-	{
-		using namespace acl_impl;
-
-		ACL_ASSERT(raw_tracks.is_valid().empty(), "Raw tracks are invalid");
-		ACL_ASSERT(context.is_initialized(), "Context isn't initialized");
-
-		if (raw_tracks.get_track_type() == track_type8::qvvf)
-			return invalid_track_error();	// Only supports scalar tracks
-
-		struct error_calculation_adapter final : public ierror_calculation_adapter
+		// Measures the error between raw tracks and a decompression context, with an optional additive base
+		template<class decompression_context_type>
+		struct compression_error_calculation_adapter final : public ierror_calculation_adapter
 		{
 			const track_array& raw_tracks_;
 			decompression_context_type& context_;
+			const track_array_qvvf* additive_base_tracks_;
 
-			error_calculation_adapter(const track_array& raw_tracks__, decompression_context_type& context__)
-				: raw_tracks_(raw_tracks__)
-				, context_(context__)
-			{
-			}
-
-			virtual void sample_tracks0(float sample_time, sample_rounding_policy rounding_policy, debug_track_writer& track_writer) override
-			{
-				raw_tracks_.sample_tracks(sample_time, rounding_policy, track_writer);
-			}
-
-			virtual void sample_tracks1(float sample_time, sample_rounding_policy rounding_policy, debug_track_writer& track_writer) override
-			{
-				context_.seek(sample_time, rounding_policy);
-				context_.decompress_tracks(track_writer);
-			}
-
-			virtual uint32_t get_output_index(uint32_t track_index) override
-			{
-				const track& track_ = raw_tracks_[track_index];
-				return track_.get_output_index();
-			}
-		};
-
-		error_calculation_adapter adapter(raw_tracks, context);
-
-		calculate_track_error_args args(adapter);
-		args.num_samples = raw_tracks.get_num_samples_per_track();
-		args.num_tracks = raw_tracks.get_num_tracks();
-		args.duration = raw_tracks.get_finite_duration();
-		args.sample_rate = raw_tracks.get_sample_rate();
-		args.track_type = raw_tracks.get_track_type();
-
-		// We use the nearest sample to accurately measure the loss that happened, if any but only if all data is loaded
-		// If we have a database with some data missing, we can't use the nearest samples, we have to interpolate
-		// TODO: Check if all the data is loaded, always interpolate for now
-		const compressed_tracks& tracks = *context.get_compressed_tracks();
-		if (tracks.has_database() || tracks.has_stripped_keyframes())
-			args.rounding_policy = sample_rounding_policy::none;
-		else
-			args.rounding_policy = sample_rounding_policy::nearest;
-
-		return calculate_scalar_track_error(allocator, args);
-	}
-
-	template<class decompression_context_type, acl_impl::is_decompression_context<decompression_context_type>>
-	inline track_error calculate_compression_error(iallocator& allocator, const track_array& raw_tracks, decompression_context_type& context, const itransform_error_metric& error_metric)
-	{
-		using namespace acl_impl;
-
-		ACL_ASSERT(raw_tracks.is_valid().empty(), "Raw tracks are invalid");
-		ACL_ASSERT(context.is_initialized(), "Context isn't initialized");
-
-		struct error_calculation_adapter final : public ierror_calculation_adapter
-		{
-			const track_array& raw_tracks_;
-			decompression_context_type& context_;
 			iallocator& allocator_;
-
 			uint32_t* output_bone_mapping;
 			uint32_t num_output_bones;
 
-			error_calculation_adapter(iallocator& allocator__, const track_array& raw_tracks__, decompression_context_type& context__)
+			compression_error_calculation_adapter(iallocator& allocator__, const track_array& raw_tracks__, decompression_context_type& context__, const track_array_qvvf* additive_base_tracks__)
 				: raw_tracks_(raw_tracks__)
 				, context_(context__)
+				, additive_base_tracks_(additive_base_tracks__)
 				, allocator_(allocator__)
 			{
 				output_bone_mapping = create_output_track_mapping(allocator__, raw_tracks__, num_output_bones);
 			}
 
-			virtual ~error_calculation_adapter() override
+			virtual ~compression_error_calculation_adapter() override
 			{
 				deallocate_type_array(allocator_, output_bone_mapping, num_output_bones);
 			}
 
-			error_calculation_adapter(const error_calculation_adapter&) = delete;
-			error_calculation_adapter& operator=(const error_calculation_adapter&) = delete;
+			compression_error_calculation_adapter(const compression_error_calculation_adapter&) = delete;
+			compression_error_calculation_adapter& operator=(const compression_error_calculation_adapter&) = delete;
 
 			virtual void initialize_bind_pose(debug_track_writer& track_writer0, debug_track_writer& tracks_writer1) override
 			{
@@ -529,73 +507,151 @@ namespace acl
 					track_writer_remapped.tracks_typed.qvvf[bone_index] = track_writer1.tracks_typed.qvvf[output_index];
 				}
 			}
+
+			virtual bool has_additive_base() const override { return additive_base_tracks_ != nullptr && !additive_base_tracks_->is_empty(); }
+			virtual void sample_tracks_base(float sample_time, sample_rounding_policy rounding_policy, debug_track_writer& track_writer) override
+			{
+				additive_base_tracks_->sample_tracks(sample_time, rounding_policy, track_writer);
+			}
 		};
 
-		error_calculation_adapter adapter(allocator, raw_tracks, context);
+		// Measures the compression error of the samples in the range [first, last)
+		template<class decompression_context_type>
+		inline track_error calculate_compression_error_range(iallocator& allocator, const track_array& raw_tracks, decompression_context_type& context, const itransform_error_metric& error_metric, const track_array_qvvf* additive_base_tracks,
+			uint32_t first_sample_index, uint32_t last_sample_index)
+		{
+			compression_error_calculation_adapter<decompression_context_type> adapter(allocator, raw_tracks, context, additive_base_tracks);
 
-		calculate_track_error_args args(adapter);
-		args.num_samples = raw_tracks.get_num_samples_per_track();
-		args.num_tracks = raw_tracks.get_num_tracks();
-		args.duration = raw_tracks.get_finite_duration();
-		args.sample_rate = raw_tracks.get_sample_rate();
-		args.track_type = raw_tracks.get_track_type();
+			calculate_track_error_args args(adapter);
+			args.num_samples = raw_tracks.get_num_samples_per_track();
+			args.num_tracks = raw_tracks.get_num_tracks();
+			args.duration = raw_tracks.get_finite_duration();
+			args.sample_rate = raw_tracks.get_sample_rate();
+			args.track_type = raw_tracks.get_track_type();
+			args.first_sample_index = first_sample_index;
+			args.last_sample_index = last_sample_index;
 
-		// We use the nearest sample to accurately measure the loss that happened, if any but only if all data is loaded
-		// If we have a database with some data missing, we can't use the nearest samples, we have to interpolate
-		// TODO: Check if all the data is loaded, always interpolate for now
-		const compressed_tracks& tracks = *context.get_compressed_tracks();
-		if (tracks.has_database() || tracks.has_stripped_keyframes())
-			args.rounding_policy = sample_rounding_policy::none;
-		else
-			args.rounding_policy = sample_rounding_policy::nearest;
+			// We use the nearest sample to accurately measure the loss that happened, if any but only if all data is loaded
+			// If we have a database with some data missing, we can't use the nearest samples, we have to interpolate
+			// TODO: Check if all the data is loaded, always interpolate for now
+			const compressed_tracks& tracks = *context.get_compressed_tracks();
+			if (tracks.has_database() || tracks.has_stripped_keyframes())
+				args.rounding_policy = sample_rounding_policy::none;
+			else
+				args.rounding_policy = sample_rounding_policy::nearest;
 
-		if (raw_tracks.get_track_type() != track_type8::qvvf)
-			return calculate_scalar_track_error(allocator, args);
+			if (raw_tracks.get_track_type() != track_type8::qvvf)
+				return calculate_scalar_track_error(allocator, args);
 
-		args.error_metric = &error_metric;
+			args.error_metric = &error_metric;
 
-		return calculate_transform_track_error(allocator, args);
+			if (additive_base_tracks != nullptr && !additive_base_tracks->is_empty())
+			{
+				args.base_num_samples = additive_base_tracks->get_num_samples_per_track();
+				args.base_duration = additive_base_tracks->get_finite_duration();
+			}
+
+			return calculate_transform_track_error(allocator, args);
+		}
+
+		// The default number of samples measured by each job
+		constexpr uint32_t k_num_track_error_job_samples = 32;
+
+		template<class decompression_context_type>
+		struct compression_error_job
+		{
+			iallocator* allocator;
+			const track_array* raw_tracks;
+			const compressed_tracks* tracks;
+			const itransform_error_metric* error_metric;
+			const track_array_qvvf* additive_base_tracks;
+
+			uint32_t first_sample_index;
+			uint32_t last_sample_index;
+
+			track_error result;
+
+			static void execute(void* job_data)
+			{
+				compression_error_job& job = *static_cast<compression_error_job*>(job_data);
+
+				// Every job decompresses with its own context
+				decompression_context_type context;
+				if (!context.initialize(*job.tracks))
+				{
+					job.result = invalid_track_error();
+					return;
+				}
+
+				job.result = calculate_compression_error_range(*job.allocator, *job.raw_tracks, context, *job.error_metric, job.additive_base_tracks, job.first_sample_index, job.last_sample_index);
+			}
+		};
+
+		template<class decompression_context_type>
+		inline track_error calculate_compression_error_impl(iallocator& allocator, const track_array& raw_tracks, decompression_context_type& context, const itransform_error_metric& error_metric, const track_array_qvvf* additive_base_tracks, const compression_job_scheduler& job_scheduler)
+		{
+			const compressed_tracks& tracks = *context.get_compressed_tracks();
+			const uint32_t num_samples = raw_tracks.get_num_samples_per_track();
+
+			// Contexts bound to a database cannot be duplicated, we measure on the calling thread with the provided context
+			if (!job_scheduler.is_enabled() || tracks.has_database() || num_samples <= 1)
+				return calculate_compression_error_range(allocator, raw_tracks, context, error_metric, additive_base_tracks, 0, num_samples);
+
+			const uint32_t default_num_jobs = (num_samples + k_num_track_error_job_samples - 1) / k_num_track_error_job_samples;
+			const uint32_t max_num_jobs = job_scheduler.max_num_jobs != 0 ? job_scheduler.max_num_jobs : default_num_jobs;
+			const uint32_t num_jobs = std::max<uint32_t>(std::min<uint32_t>(max_num_jobs, num_samples), 1);
+
+			compression_error_job<decompression_context_type>* jobs = allocate_type_array<compression_error_job<decompression_context_type>>(allocator, num_jobs);
+			for (uint32_t job_index = 0; job_index < num_jobs; ++job_index)
+			{
+				compression_error_job<decompression_context_type>& job = jobs[job_index];
+				job.allocator = &allocator;
+				job.raw_tracks = &raw_tracks;
+				job.tracks = &tracks;
+				job.error_metric = &error_metric;
+				job.additive_base_tracks = additive_base_tracks;
+				job.first_sample_index = uint32_t((uint64_t(num_samples) * job_index) / num_jobs);
+				job.last_sample_index = uint32_t((uint64_t(num_samples) * (job_index + 1)) / num_jobs);
+
+				job_scheduler.submit_job(job_scheduler.user_data, &compression_error_job<decompression_context_type>::execute, &job);
+			}
+
+			job_scheduler.wait_for_jobs(job_scheduler.user_data);
+
+			// Merge in sample order, ties retain the earliest sample like a serial measurement
+			track_error result = jobs[0].result;
+			for (uint32_t job_index = 1; job_index < num_jobs; ++job_index)
+			{
+				if (jobs[job_index].result.error > result.error)
+					result = jobs[job_index].result;
+			}
+
+			deallocate_type_array(allocator, jobs, num_jobs);
+
+			return result;
+		}
 	}
 
 	template<class decompression_context_type, acl_impl::is_decompression_context<decompression_context_type>>
-	inline track_error calculate_compression_error(iallocator& allocator, const track_array_qvvf& raw_tracks, decompression_context_type& context, const itransform_error_metric& error_metric, const track_array_qvvf& additive_base_tracks)
+	inline track_error calculate_compression_error(iallocator& allocator, const track_array& raw_tracks, decompression_context_type& context)
 	{
 		using namespace acl_impl;
 
 		ACL_ASSERT(raw_tracks.is_valid().empty(), "Raw tracks are invalid");
 		ACL_ASSERT(context.is_initialized(), "Context isn't initialized");
 
+		if (raw_tracks.get_track_type() == track_type8::qvvf)
+			return invalid_track_error();	// Only supports scalar tracks
+
 		struct error_calculation_adapter final : public ierror_calculation_adapter
 		{
 			const track_array& raw_tracks_;
 			decompression_context_type& context_;
-			const track_array_qvvf& additive_base_tracks_;
-
-			iallocator& allocator_;
-			uint32_t* output_bone_mapping;
-			uint32_t num_output_bones;
 
-			error_calculation_adapter(iallocator& allocator__, const track_array& raw_tracks__, decompression_context_type& context__, const track_array_qvvf& additive_base_tracks__)
+			error_calculation_adapter(const track_array& raw_tracks__, decompression_context_type& context__)
 				: raw_tracks_(raw_tracks__)
 				, context_(context__)
-				, additive_base_tracks_(additive_base_tracks__)
-				, allocator_(allocator__)
-			{
-				output_bone_mapping = create_output_track_mapping(allocator__, raw_tracks__, num_output_bones);
-			}
-
-			virtual ~error_calculation_adapter() override
 			{
-				deallocate_type_array(allocator_, output_bone_mapping, num_output_bones);
-			}
-
-			error_calculation_adapter(const error_calculation_adapter&) = delete;
-			error_calculation_adapter& operator=(const error_calculation_adapter&) = delete;
-
-			virtual void initialize_bind_pose(debug_track_writer& track_writer0, debug_track_writer& tracks_writer1) override
-			{
-				(void)track_writer0;
-				tracks_writer1.initialize_with_defaults(raw_tracks_);
 			}
 
 			virtual void sample_tracks0(float sample_time, sample_rounding_policy rounding_policy, debug_track_writer& track_writer) override
@@ -614,39 +670,9 @@ namespace acl
 				const track& track_ = raw_tracks_[track_index];
 				return track_.get_output_index();
 			}
-
-			virtual uint32_t get_parent_index(uint32_t track_index) override
-			{
-				const track_qvvf& track_ = track_cast<track_qvvf>(raw_tracks_[track_index]);
-				return track_.get_description().parent_index;
-			}
-
-			virtual float get_shell_distance(uint32_t track_index) override
-			{
-				const track_qvvf& track_ = track_cast<track_qvvf>(raw_tracks_[track_index]);
-				return track_.get_description().shell_distance;
-			}
-
-			virtual void remap_output(debug_track_writer& track_writer0, debug_track_writer& track_writer1, debug_track_writer& track_writer_remapped) override
-			{
-				// Perform remapping by copying the raw pose first and we overwrite with the decompressed pose if
-				// the data is available
-				std::memcpy(track_writer_remapped.tracks_typed.qvvf, track_writer0.tracks_typed.qvvf, sizeof(rtm::qvvf) * track_writer_remapped.num_tracks);
-				for (uint32_t output_index = 0; output_index < num_output_bones; ++output_index)
-				{
-					const uint32_t bone_index = output_bone_mapping[output_index];
-					track_writer_remapped.tracks_typed.qvvf[bone_index] = track_writer1.tracks_typed.qvvf[output_index];
-				}
-			}
-
-			virtual bool has_additive_base() const override { return !additive_base_tracks_.is_empty(); }
-			virtual void sample_tracks_base(float sample_time, sample_rounding_policy rounding_policy, debug_track_writer& track_writer) override
-			{
-				additive_base_tracks_.sample_tracks(sample_time, rounding_policy, track_writer);
-			}
 		};
 
-		error_calculation_adapter adapter(allocator, raw_tracks, context, additive_base_tracks);
+		error_calculation_adapter adapter(raw_tracks, context);
 
 		calculate_track_error_args args(adapter);
 		args.num_samples = raw_tracks.get_num_samples_per_track();
@@ -664,15 +690,43 @@ namespace acl
 		else
 			args.rounding_policy = sample_rounding_policy::nearest;
 
-		args.error_metric = &error_metric;
+		return calculate_scalar_track_error(allocator, args);
+	}
 
-		if (!additive_base_tracks.is_empty())
-		{
-			args.base_num_samples = additive_base_tracks.get_num_samples_per_track();
-			args.base_duration = additive_base_tracks.get_finite_duration();
-		}
+	template<class decompression_context_type, acl_impl::is_decompression_context<decompression_context_type>>
+	inline track_error calculate_compression_error(iallocator& allocator, const track_array& raw_tracks, decompression_context_type& context, const itransform_error_metric& error_metric)
+	{
+		ACL_ASSERT(raw_tracks.is_valid().empty(), "Raw tracks are invalid");
+		ACL_ASSERT(context.is_initialized(), "Context isn't initialized");
 
-		return calculate_transform_track_error(allocator, args);
+		return acl_impl::calculate_compression_error_impl(allocator, raw_tracks, context, error_metric, nullptr, compression_job_scheduler());
+	}
+
+	template<class decompression_context_type, acl_impl::is_decompression_context<decompression_context_type>>
+	inline track_error calculate_compression_error(iallocator& allocator, const track_array& raw_tracks, decompression_context_type& context, const itransform_error_metric& error_metric, const compression_job_scheduler& job_scheduler)
+	{
+		ACL_ASSERT(raw_tracks.is_valid().empty(), "Raw tracks are invalid");
+		ACL_ASSERT(context.is_initialized(), "Context isn't initialized");
+
+		return acl_impl::calculate_compression_error_impl(allocator, raw_tracks, context, error_metric, nullptr, job_scheduler);
+	}
+
+	template<class decompression_context_type, acl_impl::is_decompression_context<decompression_context_type>>
+	inline track_error calculate_compression_error(iallocator& allocator, const track_array_qvvf& raw_tracks, decompression_context_type& context, const itransform_error_metric& error_metric, const track_array_qvvf& additive_base_tracks)
+	{
+		ACL_ASSERT(raw_tracks.is_valid().empty(), "Raw tracks are invalid");
+		ACL_ASSERT(context.is_initialized(), "Context isn't initialized");
+
+		return acl_impl::calculate_compression_error_impl(allocator, raw_tracks, context, error_metric, &additive_base_tracks, compression_job_scheduler());
+	}
+
+	template<class decompression_context_type, acl_impl::is_decompression_context<decompression_context_type>>
+	inline track_error calculate_compression_error(iallocator& allocator, const track_array_qvvf& raw_tracks, decompression_context_type& context, const itransform_error_metric& error_metric, const track_array_qvvf& additive_base_tracks, const compression_job_scheduler& job_scheduler)
+	{
+		ACL_ASSERT(raw_tracks.is_valid().empty(), "Raw tracks are invalid");
+		ACL_ASSERT(context.is_initialized(), "Context isn't initialized");
+
+		return acl_impl::calculate_compression_error_impl(allocator, raw_tracks, context, error_metric, &additive_base_tracks, job_scheduler);
 	}
 
 	template<class decompression_context_type0, class decompression_context_type1, acl_impl::is_decompression_context<decompression_context_type0>, acl_impl::is_decompression_context<decompression_context_type1>>
@@ -29,6 +29,7 @@
 #include "acl/core/iallocator.h"
 #include "acl/core/bitset.h"
 #include "acl/core/track_desc.h"
+#include "acl/core/impl/compressed_headers.h"
 #include "acl/core/impl/variable_bit_rates.h"
 #include "acl/compression/track_array.h"
 #include "acl/compression/impl/track_range.h"
@@ -73,13 +74,17 @@ namespace acl
 			track_array track_list;
 
 			track_range* range_list;
+			track_range* segment_range_list;		// Only when segmented, num_segments * num_tracks, sorted by segment then track
 			uint32_t* constant_tracks_bitset;
 			track_bit_rate* bit_rate_list;
 			uint32_t* track_output_indices;
+			frame_contributing_error* contributing_error;	// Only when requested, num_samples, sorted per database segment
 
 			uint32_t num_tracks;
 			uint32_t num_output_tracks;
 			uint32_t num_samples;
+			uint32_t num_samples_per_segment;		// 0 if we aren't segmented
+			uint32_t num_segments;					// 0 if we aren't segmented
 			float sample_rate;
 			float duration;
 
@@ -90,12 +95,16 @@ namespace acl
 				, reference_list(nullptr)
 				, track_list()
 				, range_list(nullptr)
+				, segment_range_list(nullptr)
 				, constant_tracks_bitset(nullptr)
 				, bit_rate_list(nullptr)
 				, track_output_indices(nullptr)
+				, contributing_error(nullptr)
 				, num_tracks(0)
 				, num_output_tracks(0)
 				, num_samples(0)
+				, num_samples_per_segment(0)
+				, num_segments(0)
 				, sample_rate(0.0F)
 				, duration(0.0F)
 				, looping_policy(sample_looping_policy::non_looping)
@@ -106,6 +115,7 @@ namespace acl
 				if (allocator != nullptr)
 				{
 					deallocate_type_array(*allocator, range_list, num_tracks);
+					deallocate_type_array(*allocator, segment_range_list, size_t(num_segments) * num_tracks);
 
 					const bitset_description bitset_desc = bitset_description::make_from_num_bits(num_tracks);
 					deallocate_type_array(*allocator, constant_tracks_bitset, bitset_desc.get_size());
@@ -113,10 +123,13 @@ namespace acl
 					deallocate_type_array(*allocator, bit_rate_list, num_tracks);
 
 					deallocate_type_array(*allocator, track_output_indices, num_output_tracks);
+
+					deallocate_type_array(*allocator, contributing_error, num_samples);
 				}
 			}
 
 			bool is_valid() const { return allocator != nullptr; }
+			bool is_segmented() const { return num_segments != 0; }
 			bool is_constant(uint32_t track_index) const { return bitset_test(constant_tracks_bitset, bitset_description::make_from_num_bits(num_tracks), track_index); }
 
 			track_list_context(const track_list_context&) = delete;
@@ -40,6 +40,7 @@
 #include <rtm/vector4f.h>
 
 #include <cstdint>
+#include <cstring>
 
 ACL_IMPL_FILE_PRAGMA_PUSH
 
@@ -55,6 +56,11 @@ namespace acl
 			uint8_t* get_raw_sample_ptr(uint32_t sample_index)
 			{
 				ACL_ASSERT(sample_index < m_num_samples, "Invalid sample index. %u >= %u", sample_index, m_num_samples);
+
+				// Referenced samples are read only, we copy them the first time they are written to
+				if (m_is_reference)
+					copy_referenced_samples();
+
 				uint32_t offset = sample_index * m_sample_size;
 				return m_samples + offset;
 			}
@@ -62,7 +68,7 @@ namespace acl
 			const uint8_t* get_raw_sample_ptr(uint32_t sample_index) const
 			{
 				ACL_ASSERT(sample_index < m_num_samples, "Invalid sample index. %u >= %u", sample_index, m_num_samples);
-				uint32_t offset = sample_index * m_sample_size;
+				uint32_t offset = sample_index * m_sample_stride;
 				return m_samples + offset;
 			}
 
@@ -95,6 +101,9 @@ namespace acl
 			bool is_bit_rate_variable() const { return m_bit_rate != k_invalid_bit_rate; }
 			float get_finite_duration() const { return calculate_finite_duration(m_num_samples, m_sample_rate); }
 
+			// Whether or not our samples live in the input track list and haven't been copied yet
+			bool is_reference() const { return m_is_reference; }
+
 			uint32_t get_packed_sample_size() const
 			{
 				if (m_type == animation_track_type8::rotation)
@@ -120,10 +129,12 @@ namespace acl
 				, m_num_samples_allocated(0)
 				, m_num_samples(0)
 				, m_sample_size(0)
+				, m_sample_stride(0)
 				, m_sample_rate(0.0F)
 				, m_type(type)
 				, m_format(format)
 				, m_bit_rate(0)
+				, m_is_reference(false)
 			{}
 
 			track_stream(iallocator& allocator, uint32_t num_samples, uint32_t sample_size, float sample_rate, animation_track_type8 type, track_format8 format, uint8_t bit_rate)
@@ -132,12 +143,32 @@ namespace acl
 				, m_num_samples_allocated(num_samples)
 				, m_num_samples(num_samples)
 				, m_sample_size(sample_size)
+				, m_sample_stride(sample_size)
 				, m_sample_rate(sample_rate)
 				, m_type(type)
 				, m_format(format)
 				, m_bit_rate(bit_rate)
+				, m_is_reference(false)
 			{}
 
+			// References samples that live elsewhere, they must outlive the stream.
+			// The allocator is used to copy them if they are ever written to.
+			track_stream(iallocator& allocator, const uint8_t* samples, uint32_t num_samples, uint32_t sample_size, uint32_t sample_stride, float sample_rate, animation_track_type8 type, track_format8 format, uint8_t bit_rate)
+				: m_allocator(&allocator)
+				, m_samples(const_cast<uint8_t*>(samples))
+				, m_num_samples_allocated(num_samples)
+				, m_num_samples(num_samples)
+				, m_sample_size(sample_size)
+				, m_sample_stride(sample_stride)
+				, m_sample_rate(sample_rate)
+				, m_type(type)
+				, m_format(format)
+				, m_bit_rate(bit_rate)
+				, m_is_reference(true)
+			{
+				ACL_ASSERT(sample_stride >= sample_size, "Sample stride must be at least the sample size. %u < %u", sample_stride, sample_size);
+			}
+
 			track_stream(const track_stream&) = delete;
 			track_stream(track_stream&& other) noexcept
 				: m_allocator(other.m_allocator)
@@ -145,17 +176,19 @@ namespace acl
 				, m_num_samples_allocated(other.m_num_samples_allocated)
 				, m_num_samples(other.m_num_samples)
 				, m_sample_size(other.m_sample_size)
+				, m_sample_stride(other.m_sample_stride)
 				, m_sample_rate(other.m_sample_rate)
 				, m_type(other.m_type)
 				, m_format(other.m_format)
 				, m_bit_rate(other.m_bit_rate)
+				, m_is_reference(other.m_is_reference)
 			{
 				new(&other) track_stream(other.m_type, other.m_format);
 			}
 
 			~track_stream()
 			{
-				if (m_allocator != nullptr)
+				if (m_allocator != nullptr && !m_is_reference)
 					m_allocator->deallocate(m_samples, m_sample_size * size_t(m_num_samples_allocated) + k_padding);
 			}
 
@@ -167,10 +200,12 @@ namespace acl
 				std::swap(m_num_samples_allocated, rhs.m_num_samples_allocated);
 				std::swap(m_num_samples, rhs.m_num_samples);
 				std::swap(m_sample_size, rhs.m_sample_size);
+				std::swap(m_sample_stride, rhs.m_sample_stride);
 				std::swap(m_sample_rate, rhs.m_sample_rate);
 				std::swap(m_type, rhs.m_type);
 				std::swap(m_format, rhs.m_format);
 				std::swap(m_bit_rate, rhs.m_bit_rate);
+				std::swap(m_is_reference, rhs.m_is_reference);
 				return *this;
 			}
 
@@ -184,14 +219,36 @@ namespace acl
 					copy.m_num_samples_allocated = m_num_samples;
 					copy.m_num_samples = m_num_samples;
 					copy.m_sample_size = m_sample_size;
+					copy.m_sample_stride = m_sample_size;
 					copy.m_sample_rate = m_sample_rate;
 					copy.m_format = m_format;
 					copy.m_bit_rate = m_bit_rate;
-
-					std::memcpy(copy.m_samples, m_samples, (size_t)m_sample_size * m_num_samples);
+					copy.m_is_reference = false;
+
+					if (m_sample_stride == m_sample_size)
+						std::memcpy(copy.m_samples, m_samples, (size_t)m_sample_size * m_num_samples);
+					else
+					{
+						for (uint32_t sample_index = 0; sample_index < m_num_samples; ++sample_index)
+							std::memcpy(copy.m_samples + (size_t(sample_index) * m_sample_size), m_samples + (size_t(sample_index) * m_sample_stride), m_sample_size);
+					}
 				}
 			}
 
+			// Copies our referenced samples into our own tightly packed buffer
+			void copy_referenced_samples()
+			{
+				ACL_ASSERT(m_is_reference, "Samples are already owned");
+
+				uint8_t* samples = reinterpret_cast<uint8_t*>(m_allocator->allocate(m_sample_size * size_t(m_num_samples_allocated) + k_padding, 16));
+				for (uint32_t sample_index = 0; sample_index < m_num_samples_allocated; ++sample_index)
+					std::memcpy(samples + (size_t(sample_index) * m_sample_size), m_samples + (size_t(sample_index) * m_sample_stride), m_sample_size);
+
+				m_samples = samples;
+				m_sample_stride = m_sample_size;
+				m_is_reference = false;
+			}
+
 			// In order to guarantee the safety of unaligned SIMD loads of every byte, we add some padding
 			static constexpr uint32_t k_padding = 15;
 
@@ -200,11 +257,13 @@ namespace acl
 			uint32_t				m_num_samples_allocated;
 			uint32_t				m_num_samples;
 			uint32_t				m_sample_size;
+			uint32_t				m_sample_stride;	// Only differs from the sample size when we reference our samples
 			float					m_sample_rate;
 
 			animation_track_type8	m_type;
 			track_format8			m_format;
 			uint8_t					m_bit_rate;
+			bool					m_is_reference;		// When true, our samples are read only and not owned
 		};
 
 		class rotation_track_stream final : public track_stream
@@ -214,6 +273,9 @@ namespace acl
 			rotation_track_stream(iallocator& allocator, uint32_t num_samples, uint32_t sample_size, float sample_rate, rotation_format8 format, uint8_t bit_rate = k_invalid_bit_rate)
 				: track_stream(allocator, num_samples, sample_size, sample_rate, animation_track_type8::rotation, track_format8(format), bit_rate)
 			{}
+			rotation_track_stream(iallocator& allocator, const uint8_t* samples, uint32_t num_samples, uint32_t sample_size, uint32_t sample_stride, float sample_rate, rotation_format8 format, uint8_t bit_rate = k_invalid_bit_rate)
+				: track_stream(allocator, samples, num_samples, sample_size, sample_stride, sample_rate, animation_track_type8::rotation, track_format8(format), bit_rate)
+			{}
 			rotation_track_stream(const rotation_track_stream&) = delete;
 			rotation_track_stream(rotation_track_stream&& other) noexcept
 				: track_stream(static_cast<track_stream&&>(other))
@@ -235,6 +297,7 @@ namespace acl
 			}
 
 			rotation_format8 get_rotation_format() const { return m_format.rotation; }
+			void set_rotation_format(rotation_format8 format) { m_format.rotation = format; }
 
 			rtm::quatf RTM_SIMD_CALL get_sample(uint32_t sample_index) const
 			{
@@ -268,6 +331,9 @@ namespace acl
 			translation_track_stream(iallocator& allocator, uint32_t num_samples, uint32_t sample_size, float sample_rate, vector_format8 format, uint8_t bit_rate = k_invalid_bit_rate)
 				: track_stream(allocator, num_samples, sample_size, sample_rate, animation_track_type8::translation, track_format8(format), bit_rate)
 			{}
+			translation_track_stream(iallocator& allocator, const uint8_t* samples, uint32_t num_samples, uint32_t sample_size, uint32_t sample_stride, float sample_rate, vector_format8 format, uint8_t bit_rate = k_invalid_bit_rate)
+				: track_stream(allocator, samples, num_samples, sample_size, sample_stride, sample_rate, animation_track_type8::translation, track_format8(format), bit_rate)
+			{}
 			translation_track_stream(const translation_track_stream&) = delete;
 			translation_track_stream(translation_track_stream&& other) noexcept
 				: track_stream(static_cast<track_stream&&>(other))
@@ -308,6 +374,9 @@ namespace acl
 			scale_track_stream(iallocator& allocator, uint32_t num_samples, uint32_t sample_size, float sample_rate, vector_format8 format, uint8_t bit_rate = k_invalid_bit_rate)
 				: track_stream(allocator, num_samples, sample_size, sample_rate, animation_track_type8::scale, track_format8(format), bit_rate)
 			{}
+			scale_track_stream(iallocator& allocator, const uint8_t* samples, uint32_t num_samples, uint32_t sample_size, uint32_t sample_stride, float sample_rate, vector_format8 format, uint8_t bit_rate = k_invalid_bit_rate)
+				: track_stream(allocator, samples, num_samples, sample_size, sample_stride, sample_rate, animation_track_type8::scale, track_format8(format), bit_rate)
+			{}
 			scale_track_stream(const scale_track_stream&) = delete;
 			scale_track_stream(scale_track_stream&& other) noexcept
 				: track_stream(static_cast<track_stream&&>(other))
@@ -430,7 +499,21 @@ namespace acl
 			bool is_scale_constant					= false;
 			bool is_scale_default					= false;
 
-			uint8_t padding[2]						= {};
+			// Whether the constant rotation can be stored with 16 bits per component, see get_constant_rotation_group_size(..)
+			bool is_rotation_quantized				= false;
+
+			// Which rotation component is dropped when the rotation format drops the largest component
+			// 0 = W, 1 = X, 2 = Y, 3 = Z, see quat_unswizzle_dropped_component(..)
+			uint8_t rotation_dropped_component		= 0;
+
+			// Whether the rotation samples are stored as a quaternion logarithm, see quat_to_log(..)
+			// Only animated sub-tracks are converted when the rotation format requires it
+			bool is_rotation_log					= false;
+
+			// How many bits fewer each component uses when the vector format has a variable number of bits per component
+			// See calculate_component_bit_rate_reductions(..) and get_component_num_bits(..)
+			uint8_t translation_bit_rate_reductions[3]	= { 0, 0, 0 };
+			uint8_t scale_bit_rate_reductions[3]		= { 0, 0, 0 };
 
 			bool is_stripped_from_output() const { return output_index == k_invalid_track_index; }
 
@@ -454,6 +537,11 @@ namespace acl
 				copy.is_translation_default = is_translation_default;
 				copy.is_scale_constant = is_scale_constant;
 				copy.is_scale_default = is_scale_default;
+				copy.is_rotation_quantized = is_rotation_quantized;
+				copy.rotation_dropped_component = rotation_dropped_component;
+				copy.is_rotation_log = is_rotation_log;
+				std::memcpy(&copy.translation_bit_rate_reductions[0], &translation_bit_rate_reductions[0], sizeof(translation_bit_rate_reductions));
+				std::memcpy(&copy.scale_bit_rate_reductions[0], &scale_bit_rate_reductions[0], sizeof(scale_bit_rate_reductions));
 				return copy;
 			}
 		};
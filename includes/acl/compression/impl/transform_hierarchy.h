@@ -0,0 +1,247 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/bitset.h"
+#include "acl/core/error.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/track_types.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <algorithm>
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Data derived from the parent indices of a list of transforms.
+		// It only depends on the hierarchy and can be shared by every clip of a skeleton.
+		//////////////////////////////////////////////////////////////////////////
+		struct transform_hierarchy
+		{
+			// List of bit sets for each leaf transform to track transform chains (num_leaf_transforms present)
+			uint32_t* leaf_transform_chains				= nullptr;
+
+			// The index of the leaf transform chain each transform belongs to (num_transforms present)
+			uint32_t* transform_leaf_indices			= nullptr;
+
+			// List of transform indices sorted by parent first then sibling transforms are sorted by their transform index (num_transforms present)
+			uint32_t* sorted_transforms_parent_first	= nullptr;
+
+			// Optional, the transform indices of every chain from the root, in the order
+			// 'bone_chain' iterates them (num_chain_transforms present)
+			// The chain of a transform starts at 'chain_offsets[transform_index]' (num_transforms + 1 present)
+			uint32_t* chain_transform_indices			= nullptr;
+			uint32_t* chain_offsets						= nullptr;
+
+			uint32_t num_transforms						= 0;
+			uint32_t num_leaf_transforms				= 0;
+			uint32_t num_chain_transforms				= 0;
+
+			const uint32_t* get_transform_chain(uint32_t transform_index) const
+			{
+				ACL_ASSERT(transform_index < num_transforms, "Invalid transform index: %u >= %u", transform_index, num_transforms);
+				const size_t bitset_size = bitset_description::make_from_num_bits(num_transforms).get_size();
+				return leaf_transform_chains + (transform_leaf_indices[transform_index] * bitset_size);
+			}
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Builds the hierarchy of the provided transforms.
+		// 'get_parent_index' is called with a transform index and returns its parent index.
+		// Chain transform indices are only built if requested.
+		template<class parent_index_fn>
+		inline void initialize_transform_hierarchy(iallocator& allocator, uint32_t num_transforms, parent_index_fn get_parent_index, bool build_chain_indices, transform_hierarchy& out_hierarchy)
+		{
+			out_hierarchy = transform_hierarchy();
+			out_hierarchy.num_transforms = num_transforms;
+			out_hierarchy.sorted_transforms_parent_first = allocate_type_array<uint32_t>(allocator, num_transforms);
+
+			for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+				out_hierarchy.sorted_transforms_parent_first[transform_index] = transform_index;
+
+			if (num_transforms == 0)
+				return;
+
+			// Calculate which bones are leaf bones that have no children
+			bitset_description bone_bitset_desc = bitset_description::make_from_num_bits(num_transforms);
+			const size_t bitset_size = bone_bitset_desc.get_size();
+			uint32_t* is_leaf_bitset = allocate_type_array<uint32_t>(allocator, bitset_size);
+			bitset_reset(is_leaf_bitset, bone_bitset_desc, false);
+
+			// By default  and if we find a child, we'll mark it as non-leaf
+			bitset_set_range(is_leaf_bitset, bone_bitset_desc, 0, num_transforms, true);
+
+#if defined(ACL_HAS_ASSERT_CHECKS)
+			uint32_t num_root_bones = 0;
+#endif
+
+			// Move and validate the input data
+			for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+			{
+				const uint32_t parent_index = get_parent_index(transform_index);
+
+				const bool is_root = parent_index == k_invalid_track_index;
+
+				// If we have a parent, mark it as not being a leaf bone (it has at least one child)
+				if (!is_root)
+					bitset_set(is_leaf_bitset, bone_bitset_desc, parent_index, false);
+
+#if defined(ACL_HAS_ASSERT_CHECKS)
+				if (is_root)
+					num_root_bones++;
+#endif
+			}
+
+			const uint32_t num_leaf_transforms = bitset_count_set_bits(is_leaf_bitset, bone_bitset_desc);
+			out_hierarchy.num_leaf_transforms = num_leaf_transforms;
+
+			uint32_t* leaf_transform_chains = allocate_type_array<uint32_t>(allocator, num_leaf_transforms * bitset_size);
+			out_hierarchy.leaf_transform_chains = leaf_transform_chains;
+
+			uint32_t* transform_leaf_indices = allocate_type_array<uint32_t>(allocator, num_transforms);
+			std::fill(transform_leaf_indices, transform_leaf_indices + num_transforms, k_invalid_track_index);
+			out_hierarchy.transform_leaf_indices = transform_leaf_indices;
+
+			uint32_t leaf_index = 0;
+			for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+			{
+				if (!bitset_test(is_leaf_bitset, bone_bitset_desc, transform_index))
+					continue;	// Skip non-leaf bones
+
+				uint32_t* bone_chain = leaf_transform_chains + (leaf_index * bitset_size);
+				bitset_reset(bone_chain, bone_bitset_desc, false);
+
+				uint32_t chain_bone_index = transform_index;
+				while (chain_bone_index != k_invalid_track_index)
+				{
+					bitset_set(bone_chain, bone_bitset_desc, chain_bone_index, true);
+
+					// We assign a bone chain the first time we find a bone that isn't part of one already
+					if (transform_leaf_indices[chain_bone_index] == k_invalid_track_index)
+						transform_leaf_indices[chain_bone_index] = leaf_index;
+
+					chain_bone_index = get_parent_index(chain_bone_index);
+				}
+
+				leaf_index++;
+			}
+
+			ACL_ASSERT(num_root_bones > 0, "No root bone found. The root bones must have a parent index = 0xFFFF");
+			ACL_ASSERT(leaf_index == num_leaf_transforms, "Invalid number of leaf bone found");
+			deallocate_type_array(allocator, is_leaf_bitset, bitset_size);
+
+			// We sort our transform indices by parent first
+			// If two transforms have the same parent index, we sort them by their transform index
+			auto sort_predicate = [&get_parent_index](const uint32_t& lhs_transform_index, const uint32_t& rhs_transform_index)
+			{
+				const uint32_t lhs_parent_index = get_parent_index(lhs_transform_index);
+				const uint32_t rhs_parent_index = get_parent_index(rhs_transform_index);
+
+				// If the transforms don't have the same parent, sort by the parent index
+				// We add 1 to parent indices to cause the invalid index to wrap around to 0
+				// since parents come first, they'll have the lowest value
+				if (lhs_parent_index != rhs_parent_index)
+					return (lhs_parent_index + 1) < (rhs_parent_index + 1);
+
+				// Both transforms have the same parent, sort by their index
+				return lhs_transform_index < rhs_transform_index;
+			};
+
+			std::sort(out_hierarchy.sorted_transforms_parent_first, out_hierarchy.sorted_transforms_parent_first + num_transforms, sort_predicate);
+
+			if (!build_chain_indices)
+				return;
+
+			// Bone chains iterate every transform of the leaf chain from the root up to the transform
+			// in increasing index order, we gather them the same way
+			const auto gather_chain_transforms = [&out_hierarchy, bone_bitset_desc](uint32_t transform_index, uint32_t* out_chain_indices)
+			{
+				const uint32_t* transform_chain = out_hierarchy.get_transform_chain(transform_index);
+
+				uint32_t num_chain_indices = 0;
+				for (uint32_t chain_bone_index = 0; chain_bone_index <= transform_index; ++chain_bone_index)
+				{
+					if (bitset_test(transform_chain, bone_bitset_desc, chain_bone_index))
+					{
+						if (out_chain_indices != nullptr)
+							out_chain_indices[num_chain_indices] = chain_bone_index;
+
+						num_chain_indices++;
+					}
+				}
+
+				return num_chain_indices;
+			};
+
+			uint32_t* chain_offsets = allocate_type_array<uint32_t>(allocator, num_transforms + 1);
+			out_hierarchy.chain_offsets = chain_offsets;
+
+			uint32_t num_chain_transforms = 0;
+			for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+			{
+				chain_offsets[transform_index] = num_chain_transforms;
+				num_chain_transforms += gather_chain_transforms(transform_index, nullptr);
+			}
+
+			chain_offsets[num_transforms] = num_chain_transforms;
+
+			uint32_t* chain_transform_indices = allocate_type_array<uint32_t>(allocator, num_chain_transforms);
+			out_hierarchy.chain_transform_indices = chain_transform_indices;
+			out_hierarchy.num_chain_transforms = num_chain_transforms;
+
+			for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+				gather_chain_transforms(transform_index, chain_transform_indices + chain_offsets[transform_index]);
+		}
+
+		inline void destroy_transform_hierarchy(iallocator& allocator, transform_hierarchy& hierarchy)
+		{
+			const bitset_description bone_bitset_desc = bitset_description::make_from_num_bits(hierarchy.num_transforms);
+
+			deallocate_type_array(allocator, hierarchy.leaf_transform_chains, size_t(hierarchy.num_leaf_transforms) * bone_bitset_desc.get_size());
+			deallocate_type_array(allocator, hierarchy.transform_leaf_indices, hierarchy.num_transforms);
+			deallocate_type_array(allocator, hierarchy.sorted_transforms_parent_first, hierarchy.num_transforms);
+
+			if (hierarchy.chain_offsets != nullptr)
+			{
+				deallocate_type_array(allocator, hierarchy.chain_transform_indices, hierarchy.num_chain_transforms);
+				deallocate_type_array(allocator, hierarchy.chain_offsets, hierarchy.num_transforms + 1);
+			}
+
+			hierarchy = transform_hierarchy();
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
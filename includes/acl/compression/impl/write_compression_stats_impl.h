@@ -68,6 +68,20 @@ namespace acl
 			writer["num_tracks"] = context.num_tracks;
 			writer["looping"] = tracks.get_looping_policy() == sample_looping_policy::wrap;
 		}
+
+		inline void write_memory_stats(const compression_memory_stats& memory, sjson::ObjectWriter& writer)
+		{
+			writer["memory"] = [&](sjson::ObjectWriter& memory_writer)
+			{
+				memory_writer["peak_size"] = memory.peak_size;
+				memory_writer["num_allocations"] = memory.num_allocations;
+				memory_writer["clip_contexts_peak_size"] = memory.clip_contexts_peak_size;
+				memory_writer["quantization_peak_size"] = memory.quantization_peak_size;
+				memory_writer["quantization_context_size"] = memory.quantization_context_size;
+				memory_writer["bit_rate_database_size"] = memory.bit_rate_database_size;
+				memory_writer["output_peak_size"] = memory.output_peak_size;
+			};
+		}
 	}
 
 	ACL_IMPL_VERSION_NAMESPACE_END
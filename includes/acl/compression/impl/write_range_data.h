@@ -52,11 +52,12 @@ namespace acl
 
 	namespace acl_impl
 	{
-		inline uint32_t get_clip_range_data_size(const clip_context& clip, range_reduction_flags8 range_reduction, rotation_format8 rotation_format)
+		inline uint32_t get_clip_range_data_size(const clip_context& clip, range_reduction_flags8 range_reduction, rotation_format8 rotation_format, vector_format8 translation_format, vector_format8 scale_format)
 		{
-			const uint32_t rotation_size = are_any_enum_flags_set(range_reduction, range_reduction_flags8::rotations) ? get_range_reduction_rotation_size(rotation_format) : 0;
-			const uint32_t translation_size = are_any_enum_flags_set(range_reduction, range_reduction_flags8::translations) ? k_clip_range_reduction_vector3_range_size : 0;
-			const uint32_t scale_size = are_any_enum_flags_set(range_reduction, range_reduction_flags8::scales) ? k_clip_range_reduction_vector3_range_size : 0;
+			const uint32_t rotation_range_size = clip.has_quantized_rotation_clip_ranges ? k_clip_range_reduction_quantized_rotation_range_size : get_range_reduction_rotation_size(rotation_format);
+			const uint32_t rotation_size = are_any_enum_flags_set(range_reduction, range_reduction_flags8::rotations) ? rotation_range_size : 0;
+			const uint32_t translation_size = are_any_enum_flags_set(range_reduction, range_reduction_flags8::translations) ? get_range_reduction_vector_size(translation_format) : 0;
+			const uint32_t scale_size = are_any_enum_flags_set(range_reduction, range_reduction_flags8::scales) ? get_range_reduction_vector_size(scale_format) : 0;
 			uint32_t range_data_size = 0;
 
 			// Only use the first segment, it contains the necessary information
@@ -76,7 +77,7 @@ namespace acl
 			return range_data_size;
 		}
 
-		inline uint32_t write_clip_range_data(const clip_context& clip, range_reduction_flags8 range_reduction, uint8_t* range_data, uint32_t range_data_size, const uint32_t* output_bone_mapping, uint32_t num_output_bones)
+		inline uint32_t write_clip_range_data(const clip_context& clip, range_reduction_flags8 range_reduction, vector_format8 translation_format, vector_format8 scale_format, uint8_t* range_data, uint32_t range_data_size, const uint32_t* output_bone_mapping, uint32_t num_output_bones)
 		{
 			// Only use the first segment, it contains the necessary information
 			const segment_context& segment = clip.segments[0];
@@ -92,11 +93,17 @@ namespace acl
 			const uint8_t* range_data_end = add_offset_to_ptr<uint8_t>(range_data, range_data_size);
 
 			const rotation_format8 rotation_format = segment.bone_streams[0].rotations.get_rotation_format();	// The same for every track
+			const bool has_quantized_rotation_ranges = clip.has_quantized_rotation_clip_ranges;
 
 			// Each range entry is a min/extent at most sizeof(float4f) each, 32 bytes total max per sub-track, 4 sub-tracks per group
 			rtm::vector4f range_group_min[4];
 			rtm::vector4f range_group_extent[4];
 
+			// Vector formats with a variable number of bits per component also store the bit rate reduction of each component
+			const bool has_translation_bit_rate_reductions = translation_format == vector_format8::vector3f_variable_per_component;
+			const bool has_scale_bit_rate_reductions = scale_format == vector_format8::vector3f_variable_per_component;
+			uint8_t range_group_bit_rate_reductions[4][4] = {};
+
 			auto group_filter_action = [range_reduction](animation_track_type8 group_type, uint32_t bone_index)
 			{
 				(void)bone_index;
@@ -109,7 +116,7 @@ namespace acl
 					return are_any_enum_flags_set(range_reduction, range_reduction_flags8::scales);
 			};
 
-			auto group_entry_action = [&clip, &range_group_min, &range_group_extent](animation_track_type8 group_type, uint32_t group_size, uint32_t bone_index)
+			auto group_entry_action = [&clip, &segment, &range_group_min, &range_group_extent, &range_group_bit_rate_reductions](animation_track_type8 group_type, uint32_t group_size, uint32_t bone_index)
 			{
 				if (group_type == animation_track_type8::rotation)
 				{
@@ -130,6 +137,7 @@ namespace acl
 
 					range_group_min[group_size] = range_min;
 					range_group_extent[group_size] = range_extent;
+					std::memcpy(&range_group_bit_rate_reductions[group_size][0], &segment.bone_streams[bone_index].translation_bit_rate_reductions[0], 3);
 				}
 				else
 				{
@@ -140,10 +148,11 @@ namespace acl
 
 					range_group_min[group_size] = range_min;
 					range_group_extent[group_size] = range_extent;
+					std::memcpy(&range_group_bit_rate_reductions[group_size][0], &segment.bone_streams[bone_index].scale_bit_rate_reductions[0], 3);
 				}
 			};
 
-			auto group_flush_action = [rotation_format, &range_data, range_data_end, &range_group_min, &range_group_extent](animation_track_type8 group_type, uint32_t group_size)
+			auto group_flush_action = [rotation_format, has_quantized_rotation_ranges, has_translation_bit_rate_reductions, has_scale_bit_rate_reductions, &range_data, range_data_end, &range_group_min, &range_group_extent, &range_group_bit_rate_reductions](animation_track_type8 group_type, uint32_t group_size)
 			{
 				if (group_type == animation_track_type8::rotation)
 				{
@@ -170,6 +179,27 @@ namespace acl
 
 						range_data += group_size * sizeof(float) * 8;
 					}
+					else if (has_quantized_rotation_ranges)
+					{
+						// Our ranges have already been quantized, see quantize_rotation_clip_ranges(..)
+						// min.xxxx, min.yyyy, min.zzzz, extent.xxxx, extent.yyyy, extent.zzzz with 16 bits per component
+						const rtm::vector4f one = rtm::vector_set(1.0F);
+						const rtm::vector4f half_max_value = rtm::vector_set(65535.0F * 0.5F);
+
+						for (uint32_t component_index = 0; component_index < 3; ++component_index)
+						{
+							const rtm::vector4f quantized_min = rtm::vector_round_symmetric(rtm::vector_mul(rtm::vector_add(range_group_min[component_index], one), half_max_value));
+							const rtm::vector4f quantized_extent = rtm::vector_round_symmetric(rtm::vector_mul(range_group_extent[component_index], half_max_value));
+
+							const uint16_t quantized_min_u16[4] = { uint16_t(rtm::vector_get_x(quantized_min)), uint16_t(rtm::vector_get_y(quantized_min)), uint16_t(rtm::vector_get_z(quantized_min)), uint16_t(rtm::vector_get_w(quantized_min)) };
+							const uint16_t quantized_extent_u16[4] = { uint16_t(rtm::vector_get_x(quantized_extent)), uint16_t(rtm::vector_get_y(quantized_extent)), uint16_t(rtm::vector_get_z(quantized_extent)), uint16_t(rtm::vector_get_w(quantized_extent)) };
+
+							std::memcpy(range_data + group_size * sizeof(uint16_t) * component_index, &quantized_min_u16[0], group_size * sizeof(uint16_t));
+							std::memcpy(range_data + group_size * sizeof(uint16_t) * (component_index + 3), &quantized_extent_u16[0], group_size * sizeof(uint16_t));
+						}
+
+						range_data += group_size * k_clip_range_reduction_quantized_rotation_range_size;
+					}
 					else
 					{
 						// min
@@ -187,12 +217,20 @@ namespace acl
 				}
 				else
 				{
-					// 2x float3f
+					const bool has_bit_rate_reductions = group_type == animation_track_type8::translation ? has_translation_bit_rate_reductions : has_scale_bit_rate_reductions;
+
+					// 2x float3f, optionally followed by 3x uint8_t and 1 byte of padding
 					for (uint32_t group_index = 0; group_index < group_size; ++group_index)
 					{
 						std::memcpy(range_data, &range_group_min[group_index], sizeof(rtm::float3f));
 						std::memcpy(range_data + sizeof(rtm::float3f), &range_group_extent[group_index], sizeof(rtm::float3f));
 						range_data += sizeof(rtm::float3f) * 2;
+
+						if (has_bit_rate_reductions)
+						{
+							std::memcpy(range_data, &range_group_bit_rate_reductions[group_index][0], 4);
+							range_data += 4;
+						}
 					}
 				}
 
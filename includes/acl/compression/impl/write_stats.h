@@ -31,15 +31,25 @@
 #include "acl/core/track_formats.h"
 #include "acl/core/impl/variable_bit_rates.h"
 #include "acl/core/impl/compiler_utils.h"
+#include "acl/core/impl/compressed_headers.h"
 #include "acl/compression/transform_error_metrics.h"
 #include "acl/compression/track_error.h"
 #include "acl/compression/impl/clip_context.h"
+#include "acl/compression/impl/compression_profiler.h"
+#include "acl/compression/impl/track_list_context.h"
+#include "acl/compression/impl/write_range_data.h"
+#include "acl/compression/impl/write_stream_data.h"
+#include "acl/decompression/transform_layout.h"
 
 #include <sjson/writer.h>
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <functional>
+#include <limits>
 #include <thread>
 
 ACL_IMPL_FILE_PRAGMA_PUSH
@@ -68,6 +78,104 @@ namespace acl
 			writer["animated_frame_size"] = segment.num_samples != 0 ? (double(segment.animated_data_size) / double(segment.num_samples)) : 0.0;
 		}
 
+		// Writes every stage profiled under the provided parent along with their own children
+		inline void write_compression_stages(const compression_profiler& profiler, compression_stage parent, sjson::ArrayWriter& writer)
+		{
+			for (uint32_t stage_index = 0; stage_index < k_num_compression_stages; ++stage_index)
+			{
+				const compression_stage stage = static_cast<compression_stage>(stage_index);
+				if (get_compression_stage_parent(stage) != parent)
+					continue;
+
+				const compression_stage_timing& timing = profiler.get_timing(stage);
+				if (timing.num_calls == 0)
+					continue;	// Skipped
+
+				writer.push([&](sjson::ObjectWriter& stage_writer)
+					{
+						stage_writer["name"] = get_compression_stage_name(stage);
+						stage_writer["time"] = std::chrono::duration<double>(std::chrono::nanoseconds(timing.elapsed_ns)).count();
+						stage_writer["num_calls"] = timing.num_calls;
+						stage_writer["stages"] = [&](sjson::ArrayWriter& children_writer)
+						{
+							write_compression_stages(profiler, stage, children_writer);
+						};
+					});
+			}
+		}
+
+		// Estimates how many bits a sub-track would save within its segment if its animated samples were stored as
+		// residuals of a linear prediction from the two previous samples instead of being quantized independently
+		inline uint32_t estimate_temporal_prediction_saved_bits(const track_stream& segment_stream, const track_stream& raw_stream, uint32_t clip_sample_offset, uint32_t num_samples)
+		{
+			const uint8_t bit_rate = segment_stream.get_bit_rate();
+			if (bit_rate == k_invalid_bit_rate || is_constant_bit_rate(bit_rate) || is_raw_bit_rate(bit_rate) || num_samples < 3)
+				return 0;	// Only variable bit rates can benefit and the first two samples are always stored as-is
+
+			rtm::vector4f prev_sample = raw_stream.get_raw_sample<rtm::vector4f>(clip_sample_offset);
+			rtm::vector4f sample = raw_stream.get_raw_sample<rtm::vector4f>(clip_sample_offset + 1);
+			rtm::vector4f sample_min = rtm::vector_min(prev_sample, sample);
+			rtm::vector4f sample_max = rtm::vector_max(prev_sample, sample);
+			rtm::vector4f residual_min = rtm::vector_set(std::numeric_limits<float>::max());
+			rtm::vector4f residual_max = rtm::vector_set(-std::numeric_limits<float>::max());
+
+			for (uint32_t sample_index = 2; sample_index < num_samples; ++sample_index)
+			{
+				const rtm::vector4f prediction = rtm::vector_sub(rtm::vector_add(sample, sample), prev_sample);
+				prev_sample = sample;
+				sample = raw_stream.get_raw_sample<rtm::vector4f>(clip_sample_offset + sample_index);
+
+				const rtm::vector4f residual = rtm::vector_sub(sample, prediction);
+				sample_min = rtm::vector_min(sample_min, sample);
+				sample_max = rtm::vector_max(sample_max, sample);
+				residual_min = rtm::vector_min(residual_min, residual);
+				residual_max = rtm::vector_max(residual_max, residual);
+			}
+
+			const rtm::vector4f sample_extent = rtm::vector_sub(sample_max, sample_min);
+			const rtm::vector4f residual_extent = rtm::vector_sub(residual_max, residual_min);
+			const float sample_extents[3] = { rtm::vector_get_x(sample_extent), rtm::vector_get_y(sample_extent), rtm::vector_get_z(sample_extent) };
+			const float residual_extents[3] = { rtm::vector_get_x(residual_extent), rtm::vector_get_y(residual_extent), rtm::vector_get_z(residual_extent) };
+
+			// Halving the range of a component saves one bit for the same precision, we always retain at least one bit
+			const uint32_t max_num_saved_bits = get_num_bits_at_bit_rate(bit_rate) - 1;
+			uint32_t num_saved_bits_per_sample = 0;
+			for (uint32_t component_index = 0; component_index < 3; ++component_index)
+			{
+				if (residual_extents[component_index] <= 0.0F)
+					num_saved_bits_per_sample += max_num_saved_bits;
+				else if (residual_extents[component_index] < sample_extents[component_index])
+				{
+					const uint32_t num_saved_bits = uint32_t(std::floor(std::log2(sample_extents[component_index] / residual_extents[component_index])));
+					num_saved_bits_per_sample += std::min<uint32_t>(num_saved_bits, max_num_saved_bits);
+				}
+			}
+
+			return num_saved_bits_per_sample * (num_samples - 2);
+		}
+
+		// Temporal prediction isn't a supported format, we only report how much it could save to evaluate it
+		inline void write_temporal_prediction_segment_stats(const segment_context& segment, const clip_context& raw_clip, sjson::ObjectWriter& writer)
+		{
+			if (segment.clip->num_samples != raw_clip.num_samples)
+				return;	// Our samples no longer match the raw samples (e.g. the sample rate was reduced)
+
+			const segment_context& raw_segment = raw_clip.segments[0];
+
+			uint32_t num_saved_bits = 0;
+			for (uint32_t bone_index = 0; bone_index < segment.num_bones; ++bone_index)
+			{
+				const transform_streams& bone_stream = segment.bone_streams[bone_index];
+				const transform_streams& raw_bone_stream = raw_segment.bone_streams[bone_index];
+
+				num_saved_bits += estimate_temporal_prediction_saved_bits(bone_stream.rotations, raw_bone_stream.rotations, segment.clip_sample_offset, segment.num_samples);
+				num_saved_bits += estimate_temporal_prediction_saved_bits(bone_stream.translations, raw_bone_stream.translations, segment.clip_sample_offset, segment.num_samples);
+				num_saved_bits += estimate_temporal_prediction_saved_bits(bone_stream.scales, raw_bone_stream.scales, segment.clip_sample_offset, segment.num_samples);
+			}
+
+			writer["temporal_prediction_saved_size"] = num_saved_bits / 8;
+		}
+
 		inline void write_detailed_segment_stats(const segment_context& segment, sjson::ObjectWriter& writer)
 		{
 			uint32_t bit_rate_counts[k_num_bit_rates] = { 0 };
@@ -101,18 +209,40 @@ namespace acl
 			const uint32_t num_animated_pose_cache_lines = align_to(animated_pose_byte_size, k_cache_line_byte_size) / k_cache_line_byte_size;
 			writer["decomp_touched_bytes"] = segment.clip->decomp_touched_bytes + segment.total_header_size + animated_pose_byte_size;
 			writer["decomp_touched_cache_lines"] = segment.clip->decomp_touched_cache_lines + num_segment_header_cache_lines + num_animated_pose_cache_lines;
+
+			if (segment.profiler != nullptr)
+			{
+				// Segments only record the stages of their quantization
+				writer["compression_stages"] = [&](sjson::ArrayWriter& stages_writer)
+				{
+					write_compression_stages(*segment.profiler, compression_stage::quantize_streams, stages_writer);
+				};
+			}
 		}
 
-		inline void write_exhaustive_segment_stats(iallocator& allocator, const segment_context& segment, const clip_context& raw_clip_context, const clip_context& additive_base_clip_context, const compression_settings& settings, const track_array_qvvf& track_list, sjson::ObjectWriter& writer)
+		struct exhaustive_error_job
 		{
-			const uint32_t num_bones = raw_clip_context.num_bones;
-			const bool has_scale = segment_context_has_scale(segment);
+			iallocator* allocator;
+			const clip_context* clip;
+			const clip_context* raw_clip_context;
+			const clip_context* additive_base_clip_context;
+			const compression_settings* settings;
+			const track_array_qvvf* track_list;
+
+			float* errors;					// Error of every bone at every clip sample, [sample index][bone index]
 
-			ACL_ASSERT(!settings.error_metric->needs_conversion(has_scale), "Error metric conversion not supported");
+			uint32_t first_sample_index;	// Clip sample range to process, inclusive
+			uint32_t last_sample_index;		// Exclusive
+		};
 
-			const auto local_to_object_space_impl = std::mem_fn(has_scale ? &itransform_error_metric::local_to_object_space : &itransform_error_metric::local_to_object_space_no_scale);
-			const auto calculate_error_impl = std::mem_fn(has_scale ? &itransform_error_metric::calculate_error : &itransform_error_metric::calculate_error_no_scale);
-			const auto apply_additive_to_base_impl = std::mem_fn(has_scale ? &itransform_error_metric::apply_additive_to_base : &itransform_error_metric::apply_additive_to_base_no_scale);
+		inline void calculate_exhaustive_errors(const exhaustive_error_job& job)
+		{
+			iallocator& allocator = *job.allocator;
+			const clip_context& raw_clip_context = *job.raw_clip_context;
+			const clip_context& additive_base_clip_context = *job.additive_base_clip_context;
+			const compression_settings& settings = *job.settings;
+			const track_array_qvvf& track_list = *job.track_list;
+			const uint32_t num_bones = raw_clip_context.num_bones;
 
 			rtm::qvvf* raw_local_pose = allocate_type_array<rtm::qvvf>(allocator, num_bones);
 			rtm::qvvf* base_local_pose = allocate_type_array<rtm::qvvf>(allocator, num_bones);
@@ -156,13 +286,25 @@ namespace acl
 			itransform_error_metric::local_to_object_space_args local_to_object_space_args_lossy = local_to_object_space_args_raw;
 			local_to_object_space_args_lossy.local_transforms = lossy_local_pose;
 
-			track_error worst_bone_error;
-
-			writer["error_per_frame_and_bone"] = [&](sjson::ArrayWriter& frames_writer)
+			for (const segment_context& segment : job.clip->segment_iterator())
 			{
-				for (uint32_t sample_index = 0; sample_index < segment.num_samples; ++sample_index)
+				// Only process the part of our range that lives in this segment
+				const uint32_t segment_first_sample_index = std::max<uint32_t>(segment.clip_sample_offset, job.first_sample_index);
+				const uint32_t segment_last_sample_index = std::min<uint32_t>(segment.clip_sample_offset + segment.num_samples, job.last_sample_index);
+				if (segment_first_sample_index >= segment_last_sample_index)
+					continue;
+
+				const bool has_scale = segment_context_has_scale(segment);
+
+				ACL_ASSERT(!settings.error_metric->needs_conversion(has_scale), "Error metric conversion not supported");
+
+				const auto local_to_object_space_impl = std::mem_fn(has_scale ? &itransform_error_metric::local_to_object_space : &itransform_error_metric::local_to_object_space_no_scale);
+				const auto calculate_error_impl = std::mem_fn(has_scale ? &itransform_error_metric::calculate_error : &itransform_error_metric::calculate_error_no_scale);
+				const auto apply_additive_to_base_impl = std::mem_fn(has_scale ? &itransform_error_metric::apply_additive_to_base : &itransform_error_metric::apply_additive_to_base_no_scale);
+
+				for (uint32_t clip_sample_index = segment_first_sample_index; clip_sample_index < segment_last_sample_index; ++clip_sample_index)
 				{
-					const float sample_time = rtm::scalar_min(float(segment.clip_sample_offset + sample_index) / sample_rate, ref_duration);
+					const float sample_time = rtm::scalar_min(float(clip_sample_index) / sample_rate, ref_duration);
 
 					sample_streams(raw_clip_context.segments[0].bone_streams, num_bones, sample_time, raw_local_pose);
 					sample_streams(segment.bone_streams, num_bones, sample_time, lossy_local_pose);
@@ -180,37 +322,22 @@ namespace acl
 					local_to_object_space_impl(settings.error_metric, local_to_object_space_args_raw, raw_object_pose);
 					local_to_object_space_impl(settings.error_metric, local_to_object_space_args_lossy, lossy_object_pose);
 
-					frames_writer.push_newline();
-					frames_writer.push([&](sjson::ArrayWriter& frame_writer)
-						{
-							for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
-							{
-								const track_qvvf& track = track_list[bone_index];
-								const track_desc_transformf& desc = track.get_description();
-
-								itransform_error_metric::calculate_error_args calculate_error_args;
-								calculate_error_args.transform0 = raw_object_pose + bone_index;
-								calculate_error_args.transform1 = lossy_object_pose + bone_index;
-								calculate_error_args.construct_sphere_shell(desc.shell_distance);
+					float* sample_errors = job.errors + (size_t(clip_sample_index) * num_bones);
 
-								const float error = rtm::scalar_cast(calculate_error_impl(settings.error_metric, calculate_error_args));
+					for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
+					{
+						const track_qvvf& track = track_list[bone_index];
+						const track_desc_transformf& desc = track.get_description();
 
-								frame_writer.push(error);
+						itransform_error_metric::calculate_error_args calculate_error_args;
+						calculate_error_args.transform0 = raw_object_pose + bone_index;
+						calculate_error_args.transform1 = lossy_object_pose + bone_index;
+						calculate_error_args.construct_sphere_shell(desc.shell_distance);
 
-								if (error > worst_bone_error.error)
-								{
-									worst_bone_error.error = error;
-									worst_bone_error.index = bone_index;
-									worst_bone_error.sample_time = sample_time;
-								}
-							}
-						});
+						sample_errors[bone_index] = rtm::scalar_cast(calculate_error_impl(settings.error_metric, calculate_error_args));
+					}
 				}
-			};
-
-			writer["max_error"] = worst_bone_error.error;
-			writer["worst_bone"] = worst_bone_error.index;
-			writer["worst_time"] = worst_bone_error.sample_time;
+			}
 
 			deallocate_type_array(allocator, raw_local_pose, num_bones);
 			deallocate_type_array(allocator, base_local_pose, num_bones);
@@ -223,6 +350,150 @@ namespace acl
 			deallocate_type_array(allocator, self_transform_indices, num_bones);
 		}
 
+		inline void execute_exhaustive_error_job(void* job_data)
+		{
+			calculate_exhaustive_errors(*static_cast<const exhaustive_error_job*>(job_data));
+		}
+
+		// Calculates the error of every bone at every sample of the clip, sample ranges are processed
+		// concurrently when a job scheduler is provided
+		// The caller owns the returned buffer, it contains 'num_samples * num_bones' entries
+		inline float* calculate_exhaustive_errors(iallocator& allocator, const clip_context& clip, const clip_context& raw_clip_context, const clip_context& additive_base_clip_context, const compression_settings& settings, const track_array_qvvf& track_list, uint32_t& out_num_errors)
+		{
+			uint32_t num_samples = 0;
+			for (const segment_context& segment : clip.segment_iterator())
+				num_samples += segment.num_samples;
+
+			const uint32_t num_errors = num_samples * raw_clip_context.num_bones;
+			float* errors = num_errors != 0 ? allocate_type_array<float>(allocator, num_errors) : nullptr;
+
+			exhaustive_error_job base_job;
+			base_job.allocator = &allocator;
+			base_job.clip = &clip;
+			base_job.raw_clip_context = &raw_clip_context;
+			base_job.additive_base_clip_context = &additive_base_clip_context;
+			base_job.settings = &settings;
+			base_job.track_list = &track_list;
+			base_job.errors = errors;
+			base_job.first_sample_index = 0;
+			base_job.last_sample_index = num_samples;
+
+			const compression_job_scheduler& job_scheduler = settings.job_scheduler;
+			if (job_scheduler.is_enabled() && num_samples > 1)
+			{
+				const uint32_t max_num_jobs = job_scheduler.max_num_jobs != 0 ? job_scheduler.max_num_jobs : clip.num_segments;
+				const uint32_t num_jobs = std::max<uint32_t>(std::min<uint32_t>(max_num_jobs, num_samples), 1);
+
+				exhaustive_error_job* jobs = allocate_type_array<exhaustive_error_job>(allocator, num_jobs);
+				for (uint32_t job_index = 0; job_index < num_jobs; ++job_index)
+				{
+					jobs[job_index] = base_job;
+					jobs[job_index].first_sample_index = uint32_t((uint64_t(num_samples) * job_index) / num_jobs);
+					jobs[job_index].last_sample_index = uint32_t((uint64_t(num_samples) * (job_index + 1)) / num_jobs);
+
+					job_scheduler.submit_job(job_scheduler.user_data, &execute_exhaustive_error_job, &jobs[job_index]);
+				}
+
+				job_scheduler.wait_for_jobs(job_scheduler.user_data);
+
+				deallocate_type_array(allocator, jobs, num_jobs);
+			}
+			else
+				calculate_exhaustive_errors(base_job);
+
+			out_num_errors = num_errors;
+			return errors;
+		}
+
+		inline void write_exhaustive_segment_stats(const segment_context& segment, const clip_context& raw_clip_context, const float* clip_errors, bool include_errors, sjson::ObjectWriter& writer)
+		{
+			const uint32_t num_bones = raw_clip_context.num_bones;
+			const float sample_rate = raw_clip_context.sample_rate;
+			const float ref_duration = calculate_finite_duration(raw_clip_context.num_samples, sample_rate);
+
+			track_error worst_bone_error;
+
+			for (uint32_t sample_index = 0; sample_index < segment.num_samples; ++sample_index)
+			{
+				const uint32_t clip_sample_index = segment.clip_sample_offset + sample_index;
+				const float sample_time = rtm::scalar_min(float(clip_sample_index) / sample_rate, ref_duration);
+				const float* sample_errors = clip_errors + (size_t(clip_sample_index) * num_bones);
+
+				for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
+				{
+					const float error = sample_errors[bone_index];
+					if (error > worst_bone_error.error)
+					{
+						worst_bone_error.error = error;
+						worst_bone_error.index = bone_index;
+						worst_bone_error.sample_time = sample_time;
+					}
+				}
+			}
+
+			// When a binary writer is used, the errors live there instead
+			if (include_errors)
+			{
+				writer["error_per_frame_and_bone"] = [&](sjson::ArrayWriter& frames_writer)
+				{
+					for (uint32_t sample_index = 0; sample_index < segment.num_samples; ++sample_index)
+					{
+						const uint32_t clip_sample_index = segment.clip_sample_offset + sample_index;
+						const float* sample_errors = clip_errors + (size_t(clip_sample_index) * num_bones);
+
+						frames_writer.push_newline();
+						frames_writer.push([&](sjson::ArrayWriter& frame_writer)
+							{
+								for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
+									frame_writer.push(sample_errors[bone_index]);
+							});
+					}
+				};
+			}
+
+			writer["max_error"] = worst_bone_error.error;
+			writer["worst_bone"] = worst_bone_error.index;
+			writer["worst_time"] = worst_bone_error.sample_time;
+		}
+
+		// Writes the exhaustive errors of a clip as a record of the binary statistics, see binary_stats_writer
+		inline void write_exhaustive_binary_stats(iallocator& allocator, const clip_context& clip, const clip_context& raw_clip_context, const float* clip_errors, uint32_t num_errors, binary_stats_writer& binary_writer)
+		{
+			const uint32_t num_bones = raw_clip_context.num_bones;
+			const uint32_t num_samples = num_bones != 0 ? (num_errors / num_bones) : 0;
+
+			uint32_t sample_rate_bits;
+			std::memcpy(&sample_rate_bits, &raw_clip_context.sample_rate, sizeof(float));
+
+			const uint32_t header[6] =
+			{
+				0x454C4341,	// 'ACLE'
+				1,			// Version
+				num_bones,
+				num_samples,
+				sample_rate_bits,
+				clip.num_segments,
+			};
+
+			binary_writer.write(&header[0], sizeof(header));
+
+			for (const segment_context& segment : clip.segment_iterator())
+				binary_writer.write(&segment.clip_sample_offset, sizeof(uint32_t));
+
+			// Errors are stored sample major, we write them one bone column at a time
+			float* column = allocate_type_array<float>(allocator, num_samples);
+
+			for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
+			{
+				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+					column[sample_index] = clip_errors[(size_t(sample_index) * num_bones) + bone_index];
+
+				binary_writer.write(column, sizeof(float) * num_samples);
+			}
+
+			deallocate_type_array(allocator, column, num_samples);
+		}
+
 		inline uint32_t calculate_clip_metadata_common_size(const clip_context& clip, const compressed_tracks& compressed_clip)
 		{
 			const uint32_t segment_header_size = compressed_clip.has_database() || compressed_clip.has_stripped_keyframes() ? sizeof(stripped_segment_header_t) : sizeof(segment_header);
@@ -383,11 +654,333 @@ namespace acl
 			return result;
 		}
 
+		// Size in bytes attributed to a sub-track, animated data is attributed with bit precision
+		struct sub_track_size_attribution
+		{
+			double constant_size = 0.0;			// Constant sample
+			double clip_range_size = 0.0;		// Clip range reduction data
+			double segment_format_size = 0.0;	// Variable bit rate of every segment
+			double segment_range_size = 0.0;	// Segment range reduction data
+			double animated_size = 0.0;			// Animated samples of every segment
+
+			double get_size() const { return constant_size + clip_range_size + segment_format_size + segment_range_size + animated_size; }
+		};
+
+		// Returns the number of samples a segment stores, some might have been stripped
+		inline uint32_t get_num_stored_segment_samples(const clip_context& clip, const segment_context& segment)
+		{
+			if (!clip.has_stripped_keyframes)
+				return segment.num_samples;
+
+			const bitset_description hard_keyframes_desc = bitset_description::make_from_num_bits<32>();
+			return bitset_count_set_bits(&segment.hard_keyframes, hard_keyframes_desc);
+		}
+
+		// Calculates the size of the constant rotation sample of every bone, quantized groups of 4 rotations are shared evenly
+		inline void calculate_constant_rotation_sizes(const clip_context& clip, const uint32_t* output_bone_mapping, uint32_t num_output_bones, bool has_quantized_constant_rotations, double* out_sizes)
+		{
+			const segment_context& segment = clip.segments[0];
+
+			uint32_t group_bone_indices[4];
+			uint32_t num_rotations_in_group = 0;
+			bool is_group_quantized = true;
+
+			const auto flush_group = [&]()
+			{
+				const double rotation_size = double(get_constant_rotation_group_size(num_rotations_in_group, is_group_quantized)) / double(num_rotations_in_group);
+				for (uint32_t group_index = 0; group_index < num_rotations_in_group; ++group_index)
+					out_sizes[group_bone_indices[group_index]] = rotation_size;
+
+				num_rotations_in_group = 0;
+				is_group_quantized = true;
+			};
+
+			// Groups are formed in output order, see for_each_constant_rotation_group(..)
+			for (uint32_t output_index = 0; output_index < num_output_bones; ++output_index)
+			{
+				const uint32_t bone_index = output_bone_mapping[output_index];
+				const transform_streams& bone_stream = segment.bone_streams[bone_index];
+
+				if (bone_stream.is_rotation_default || !bone_stream.is_rotation_constant)
+					continue;
+
+				if (!has_quantized_constant_rotations)
+				{
+					out_sizes[bone_index] = double(bone_stream.rotations.get_packed_sample_size());
+					continue;
+				}
+
+				is_group_quantized &= bone_stream.is_rotation_quantized;
+				group_bone_indices[num_rotations_in_group++] = bone_index;
+
+				if (num_rotations_in_group == 4)
+					flush_group();
+			}
+
+			if (num_rotations_in_group != 0)
+				flush_group();
+		}
+
+		// Writes the size attributed to a sub-track and returns it
+		inline double write_sub_track_size_attribution(const clip_context& clip, animation_track_type8 sub_track_type, uint32_t bone_index,
+			bool is_format_variable, range_reduction_flags8 range_reduction_flag, range_reduction_flags8 range_reduction,
+			uint32_t clip_range_size, uint32_t segment_range_size, double constant_size,
+			double (&animated_size_per_bit_rate)[k_num_bit_rates + 1], sjson::ObjectWriter& writer)
+		{
+			const transform_streams& first_bone_stream = clip.segments[0].bone_streams[bone_index];
+
+			bool is_default;
+			bool is_constant;
+			switch (sub_track_type)
+			{
+			case animation_track_type8::rotation:
+				is_default = first_bone_stream.is_rotation_default;
+				is_constant = first_bone_stream.is_rotation_constant;
+				break;
+			case animation_track_type8::translation:
+				is_default = first_bone_stream.is_translation_default;
+				is_constant = first_bone_stream.is_translation_constant;
+				break;
+			case animation_track_type8::scale:
+			default:
+				is_default = first_bone_stream.is_scale_default;
+				is_constant = first_bone_stream.is_scale_constant;
+				break;
+			}
+
+			sub_track_size_attribution attribution;
+
+			if (is_default)
+				writer["type"] = "default";
+			else if (is_constant)
+			{
+				writer["type"] = "constant";
+				attribution.constant_size = constant_size;
+			}
+			else
+			{
+				writer["type"] = "animated";
+
+				const bool has_range_reduction = are_any_enum_flags_set(range_reduction, range_reduction_flag);
+				if (has_range_reduction)
+				{
+					attribution.clip_range_size = double(clip_range_size);
+
+					if (clip.num_segments > 1)
+						attribution.segment_range_size = double(segment_range_size * clip.num_segments);
+				}
+
+				if (is_format_variable)
+					attribution.segment_format_size = double(clip.num_segments);	// 1 byte per segment
+
+				writer["bit_rates"] = [&](sjson::ArrayWriter& bit_rates_writer)
+				{
+					for (const segment_context& segment : clip.segment_iterator())
+					{
+						const transform_streams& bone_stream = segment.bone_streams[bone_index];
+						const track_stream& stream = sub_track_type == animation_track_type8::rotation ? static_cast<const track_stream&>(bone_stream.rotations)
+							: (sub_track_type == animation_track_type8::translation ? static_cast<const track_stream&>(bone_stream.translations) : static_cast<const track_stream&>(bone_stream.scales));
+						const uint8_t* bit_rate_reductions = sub_track_type == animation_track_type8::rotation ? k_no_bit_rate_reductions
+							: (sub_track_type == animation_track_type8::translation ? bone_stream.translation_bit_rate_reductions : bone_stream.scale_bit_rate_reductions);
+
+						uint32_t num_sample_bits = 0;
+						calculate_animated_data_size(stream, bit_rate_reductions, num_sample_bits);
+
+						const double segment_animated_size = double(num_sample_bits) * double(get_num_stored_segment_samples(clip, segment)) / 8.0;
+						attribution.animated_size += segment_animated_size;
+
+						// Fixed formats are accumulated in the last entry
+						const bool is_bit_rate_variable = stream.is_bit_rate_variable();
+						const uint8_t bit_rate = stream.get_bit_rate();
+						animated_size_per_bit_rate[is_bit_rate_variable ? bit_rate : k_num_bit_rates] += segment_animated_size;
+
+						if (is_bit_rate_variable)
+							bit_rates_writer.push(uint32_t(bit_rate));
+					}
+				};
+			}
+
+			writer["constant_size"] = attribution.constant_size;
+			writer["clip_range_size"] = attribution.clip_range_size;
+			writer["segment_format_size"] = attribution.segment_format_size;
+			writer["segment_range_size"] = attribution.segment_range_size;
+			writer["animated_size"] = attribution.animated_size;
+			writer["size"] = attribution.get_size();
+
+			return attribution.get_size();
+		}
+
+		// Breaks down the compressed size by component, by track and sub-track, and by segment
+		// Sizes attributed to tracks exclude alignment padding and the data shared by every track
+		inline void write_size_attribution_stats(iallocator& allocator, const track_array_qvvf& track_list, const clip_context& clip,
+			const compressed_tracks& compressed_clip, const compression_settings& settings, range_reduction_flags8 range_reduction,
+			sjson::ObjectWriter& writer)
+		{
+			uint32_t num_output_bones = 0;
+			uint32_t* output_bone_mapping = create_output_track_mapping(allocator, track_list, num_output_bones);
+
+			const bool has_quantized_constant_rotations = has_quantized_constant_rotation_groups(clip, output_bone_mapping, num_output_bones);
+
+			// Per component, this mirrors how the compressed tracks are laid out
+			const uint32_t compressed_size = compressed_clip.get_size();
+			const uint32_t header_size = sizeof(raw_buffer_header) + sizeof(tracks_header) + sizeof(transform_tracks_header);
+			const uint32_t segment_start_indices_size = clip.num_segments > 1 ? (uint32_t(sizeof(uint32_t)) * (clip.num_segments + 1)) : 0;
+			const uint32_t segment_header_type_size = clip.has_stripped_keyframes ? sizeof(stripped_segment_header_t) : sizeof(segment_header);
+			const uint32_t segment_headers_size = segment_start_indices_size + segment_header_type_size * clip.num_segments;
+			const uint32_t num_sub_tracks_per_bone = clip.has_scale ? 3 : 2;
+			const uint32_t sub_track_types_size = ((num_output_bones + k_num_sub_tracks_per_packed_entry - 1) / k_num_sub_tracks_per_packed_entry) * num_sub_tracks_per_bone * uint32_t(sizeof(packed_sub_track_types));
+			const uint32_t constant_data_size = get_constant_data_size(clip, output_bone_mapping, num_output_bones, has_quantized_constant_rotations);
+			const uint32_t clip_range_data_size = get_clip_range_data_size(clip, range_reduction, settings.rotation_format, settings.translation_format, settings.scale_format);
+			const uint32_t format_per_track_data_size = get_format_per_track_data_size(clip, settings.rotation_format, settings.translation_format, settings.scale_format);
+
+			uint32_t segment_format_data_size = 0;
+			uint32_t segment_range_data_size = 0;
+			uint32_t animated_data_size = 0;
+			for (const segment_context& segment : clip.segment_iterator())
+			{
+				segment_format_data_size += format_per_track_data_size;
+				segment_range_data_size += segment.range_data_size;
+				animated_data_size += segment.animated_data_size;
+			}
+
+			// Optional metadata lives at the end of the buffer along with its header
+			uint32_t metadata_size = 0;
+			if (get_tracks_header(compressed_clip).get_has_metadata())
+			{
+				const optional_metadata_header& metadata_header = get_optional_metadata_header(compressed_clip);
+				const ptr_offset32<uint8_t> metadata_offsets[] =
+				{
+					ptr_offset32<uint8_t>(uint32_t(metadata_header.track_list_name)),
+					ptr_offset32<uint8_t>(uint32_t(metadata_header.track_name_offsets)),
+					ptr_offset32<uint8_t>(uint32_t(metadata_header.parent_track_indices)),
+					ptr_offset32<uint8_t>(uint32_t(metadata_header.track_descriptions)),
+					ptr_offset32<uint8_t>(uint32_t(metadata_header.contributing_error)),
+				};
+
+				uint32_t metadata_start_offset = compressed_size - uint32_t(sizeof(optional_metadata_header));
+				for (const ptr_offset32<uint8_t>& metadata_offset : metadata_offsets)
+				{
+					if (metadata_offset.is_valid())
+						metadata_start_offset = std::min<uint32_t>(metadata_start_offset, uint32_t(metadata_offset));
+				}
+
+				metadata_size = compressed_size - metadata_start_offset;
+			}
+
+			const uint32_t known_size = header_size + segment_headers_size + sub_track_types_size + constant_data_size + clip_range_data_size
+				+ segment_format_data_size + segment_range_data_size + animated_data_size + metadata_size;
+
+			writer["compressed_size"] = compressed_size;
+			writer["components"] = [&](sjson::ObjectWriter& components_writer)
+			{
+				components_writer["header_size"] = header_size;
+				components_writer["segment_headers_size"] = segment_headers_size;
+				components_writer["sub_track_types_size"] = sub_track_types_size;
+				components_writer["constant_data_size"] = constant_data_size;
+				components_writer["clip_range_data_size"] = clip_range_data_size;
+				components_writer["segment_format_data_size"] = segment_format_data_size;
+				components_writer["segment_range_data_size"] = segment_range_data_size;
+				components_writer["animated_data_size"] = animated_data_size;
+				components_writer["metadata_size"] = metadata_size;
+				components_writer["padding_size"] = compressed_size >= known_size ? (compressed_size - known_size) : 0;
+			};
+
+			// Per track and sub-track
+			const segment_context& first_segment = clip.segments[0];
+			const uint32_t rotation_clip_range_size = clip.has_quantized_rotation_clip_ranges ? k_clip_range_reduction_quantized_rotation_range_size : get_range_reduction_rotation_size(settings.rotation_format);
+			const uint32_t translation_clip_range_size = get_range_reduction_vector_size(settings.translation_format);
+			const uint32_t scale_clip_range_size = get_range_reduction_vector_size(settings.scale_format);
+			const uint32_t vector_segment_range_size = 6 * k_segment_range_reduction_num_bytes_per_component;
+
+			double* constant_rotation_sizes = allocate_type_array<double>(allocator, clip.num_bones);
+			std::fill(constant_rotation_sizes, constant_rotation_sizes + clip.num_bones, 0.0);
+			calculate_constant_rotation_sizes(clip, output_bone_mapping, num_output_bones, has_quantized_constant_rotations, constant_rotation_sizes);
+
+			// Animated data per variable bit rate, fixed formats are in the last entry
+			double animated_size_per_bit_rate[k_num_bit_rates + 1] = { 0.0 };
+
+			writer["tracks"] = [&](sjson::ArrayWriter& tracks_writer)
+			{
+				for (uint32_t output_index = 0; output_index < num_output_bones; ++output_index)
+				{
+					const uint32_t bone_index = output_bone_mapping[output_index];
+					const transform_streams& bone_stream = first_segment.bone_streams[bone_index];
+
+					tracks_writer.push([&](sjson::ObjectWriter& track_writer)
+						{
+							const uint32_t rotation_segment_range_size = (bone_stream.rotations.get_rotation_format() == rotation_format8::quatf_full ? 8 : 6) * k_segment_range_reduction_num_bytes_per_component;
+							double track_size = 0.0;
+
+							track_writer["index"] = bone_index;
+							track_writer["output_index"] = output_index;
+							track_writer["name"] = track_list[bone_index].get_name().c_str();
+							track_writer["rotation"] = [&](sjson::ObjectWriter& sub_track_writer)
+							{
+								track_size += write_sub_track_size_attribution(clip, animation_track_type8::rotation, bone_index,
+									is_rotation_format_variable(settings.rotation_format), range_reduction_flags8::rotations, range_reduction,
+									rotation_clip_range_size, rotation_segment_range_size, constant_rotation_sizes[bone_index],
+									animated_size_per_bit_rate, sub_track_writer);
+							};
+							track_writer["translation"] = [&](sjson::ObjectWriter& sub_track_writer)
+							{
+								track_size += write_sub_track_size_attribution(clip, animation_track_type8::translation, bone_index,
+									is_vector_format_variable(settings.translation_format), range_reduction_flags8::translations, range_reduction,
+									translation_clip_range_size, vector_segment_range_size, double(bone_stream.translations.get_packed_sample_size()),
+									animated_size_per_bit_rate, sub_track_writer);
+							};
+
+							if (clip.has_scale)
+							{
+								track_writer["scale"] = [&](sjson::ObjectWriter& sub_track_writer)
+								{
+									track_size += write_sub_track_size_attribution(clip, animation_track_type8::scale, bone_index,
+										is_vector_format_variable(settings.scale_format), range_reduction_flags8::scales, range_reduction,
+										scale_clip_range_size, vector_segment_range_size, double(bone_stream.scales.get_packed_sample_size()),
+										animated_size_per_bit_rate, sub_track_writer);
+								};
+							}
+
+							track_writer["size"] = track_size;
+						});
+				}
+			};
+
+			writer["animated_size_per_bit_rate"] = [&](sjson::ArrayWriter& bit_rates_writer)
+			{
+				for (uint32_t bit_rate = 0; bit_rate < k_num_bit_rates; ++bit_rate)
+					bit_rates_writer.push(animated_size_per_bit_rate[bit_rate]);
+			};
+			writer["animated_size_fixed_formats"] = animated_size_per_bit_rate[k_num_bit_rates];
+
+			// Per segment
+			writer["segments"] = [&](sjson::ArrayWriter& segments_writer)
+			{
+				for (const segment_context& segment : clip.segment_iterator())
+				{
+					segments_writer.push([&](sjson::ObjectWriter& segment_writer)
+						{
+							const uint32_t segment_known_size = format_per_track_data_size + segment.range_data_size + segment.animated_data_size;
+
+							segment_writer["segment_index"] = segment.segment_index;
+							segment_writer["num_stored_samples"] = get_num_stored_segment_samples(clip, segment);
+							segment_writer["header_size"] = segment_header_type_size;
+							segment_writer["format_data_size"] = format_per_track_data_size;
+							segment_writer["range_data_size"] = segment.range_data_size;
+							segment_writer["animated_data_size"] = segment.animated_data_size;
+							segment_writer["padding_size"] = segment.segment_data_size >= segment_known_size ? (segment.segment_data_size - segment_known_size) : 0;
+						});
+				}
+			};
+
+			deallocate_type_array(allocator, constant_rotation_sizes, clip.num_bones);
+			deallocate_type_array(allocator, output_bone_mapping, num_output_bones);
+		}
+
 		inline void write_stats(iallocator& allocator, const track_array_qvvf& track_list, const clip_context& clip,
 			const compressed_tracks& compressed_clip, const compression_settings& settings, const compression_segmenting_settings& segmenting_settings,
 			range_reduction_flags8 range_reduction, const clip_context& raw_clip,
 			const clip_context& additive_base_clip_context, const scope_profiler& compression_time,
-			output_stats& stats)
+			const compression_profiler* profiler, output_stats& stats)
 		{
 			ACL_ASSERT(stats.writer != nullptr, "Attempted to log stats without a writer");
 			if (stats.writer == nullptr)
@@ -412,6 +1005,7 @@ namespace acl
 			writer["translation_format"] = get_vector_format_name(settings.translation_format);
 			writer["scale_format"] = get_vector_format_name(settings.scale_format);
 			writer["has_scale"] = clip.has_scale;
+			writer["layout_signature"] = get_transform_layout_signature(compressed_clip);
 			writer["looping"] = compressed_clip.get_looping_policy() == sample_looping_policy::wrap;
 			writer["error_metric"] = settings.error_metric->get_name();
 
@@ -486,8 +1080,8 @@ namespace acl
 				writer["clip_metadata_scale_constant_size"] = clip_metadata_scale_constant_size;
 
 				const uint32_t range_rotation_size = are_any_enum_flags_set(range_reduction, range_reduction_flags8::rotations) ? get_range_reduction_rotation_size(settings.rotation_format) : 0;
-				const uint32_t range_translation_size = are_any_enum_flags_set(range_reduction, range_reduction_flags8::translations) ? k_clip_range_reduction_vector3_range_size : 0;
-				const uint32_t range_scale_size = are_any_enum_flags_set(range_reduction, range_reduction_flags8::scales) ? k_clip_range_reduction_vector3_range_size : 0;
+				const uint32_t range_translation_size = are_any_enum_flags_set(range_reduction, range_reduction_flags8::translations) ? get_range_reduction_vector_size(settings.translation_format) : 0;
+				const uint32_t range_scale_size = are_any_enum_flags_set(range_reduction, range_reduction_flags8::scales) ? get_range_reduction_vector_size(settings.scale_format) : 0;
 				const uint32_t clip_metadata_rotation_animated_size = range_rotation_size * num_animated_rotation_tracks;
 				const uint32_t clip_metadata_translation_animated_size = range_translation_size * num_animated_translation_tracks;
 				const uint32_t clip_metadata_scale_animated_size = range_scale_size * num_animated_scale_tracks;
@@ -529,6 +1123,14 @@ namespace acl
 				const int32_t unknown_overhead_size = compressed_size - known_data_size;
 				ACL_ASSERT(unknown_overhead_size >= 0, "Overhead size should be positive");
 				writer["unknown_overhead_size"] = unknown_overhead_size;
+
+				if (profiler != nullptr)
+				{
+					writer["compression_stages"] = [&](sjson::ArrayWriter& stages_writer)
+					{
+						write_compression_stages(*profiler, compression_stage::none, stages_writer);
+					};
+				}
 			}
 
 			writer["segmenting"] = [&](sjson::ObjectWriter& segmenting_writer)
@@ -538,6 +1140,21 @@ namespace acl
 				segmenting_writer["max_num_samples"] = segmenting_settings.max_num_samples;
 			};
 
+			// The exhaustive error is costly to calculate, gather it for the whole clip at once
+			// so samples can be processed concurrently
+			uint32_t num_exhaustive_errors = 0;
+			float* exhaustive_errors = nullptr;
+			const bool is_exhaustive = are_all_enum_flags_set(stats.logging, stat_logging::exhaustive);
+			if (is_exhaustive)
+				exhaustive_errors = calculate_exhaustive_errors(allocator, clip, raw_clip, additive_base_clip_context, settings, track_list, num_exhaustive_errors);
+
+			const bool use_binary_errors = is_exhaustive && stats.binary_writer != nullptr;
+			if (use_binary_errors)
+			{
+				writer["exhaustive_errors_offset"] = stats.binary_writer->get_offset();
+				write_exhaustive_binary_stats(allocator, clip, raw_clip, exhaustive_errors, num_exhaustive_errors, *stats.binary_writer);
+			}
+
 			writer["segments"] = [&](sjson::ArrayWriter& segments_writer)
 			{
 				for (const segment_context& segment : clip.segment_iterator())
@@ -547,13 +1164,26 @@ namespace acl
 							write_summary_segment_stats(segment, settings.rotation_format, settings.translation_format, settings.scale_format, segment_writer);
 
 							if (are_all_enum_flags_set(stats.logging, stat_logging::detailed))
+							{
 								write_detailed_segment_stats(segment, segment_writer);
+								write_temporal_prediction_segment_stats(segment, raw_clip, segment_writer);
+							}
 
-							if (are_all_enum_flags_set(stats.logging, stat_logging::exhaustive))
-								write_exhaustive_segment_stats(allocator, segment, raw_clip, additive_base_clip_context, settings, track_list, segment_writer);
+							if (is_exhaustive)
+								write_exhaustive_segment_stats(segment, raw_clip, exhaustive_errors, !use_binary_errors, segment_writer);
 						});
 				}
 			};
+
+			deallocate_type_array(allocator, exhaustive_errors, num_exhaustive_errors);
+
+			if (are_all_enum_flags_set(stats.logging, stat_logging::size_attribution))
+			{
+				writer["size_attribution"] = [&](sjson::ObjectWriter& attribution_writer)
+				{
+					write_size_attribution_stats(allocator, track_list, clip, compressed_clip, settings, range_reduction, attribution_writer);
+				};
+			}
 		}
 	}
 
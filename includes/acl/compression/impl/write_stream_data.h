@@ -26,16 +26,20 @@
 
 #include "acl/version.h"
 #include "acl/core/impl/compiler_utils.h"
+#include "acl/core/bitset.h"
 #include "acl/core/iallocator.h"
 #include "acl/core/error.h"
 #include "acl/core/track_formats.h"
 #include "acl/core/impl/variable_bit_rates.h"
 #include "acl/compression/impl/animated_track_utils.h"
 #include "acl/compression/impl/clip_context.h"
+#include "acl/compression/impl/packed_bit_writer.h"
+#include "acl/math/scalar_packing.h"
 
 #include "acl/core/impl/compressed_headers.h"
 
 #include <cstdint>
+#include <cstring>
 
 ACL_IMPL_FILE_PRAGMA_PUSH
 
@@ -45,20 +49,97 @@ namespace acl
 
 	namespace acl_impl
 	{
-		inline uint32_t get_constant_data_size(const clip_context& clip)
+		// Calls the provided action for every group of 4 constant rotations in output order with the number of
+		// rotations it contains and whether or not they can all be quantized, see get_constant_rotation_group_size(..)
+		template<typename group_action_type>
+		inline void for_each_constant_rotation_group(const clip_context& clip, const uint32_t* output_bone_mapping, uint32_t num_output_bones, group_action_type group_action)
+		{
+			// Only use the first segment, it contains the necessary information
+			const segment_context& segment = clip.segments[0];
+
+			uint32_t num_rotations_in_group = 0;
+			bool is_group_quantized = true;
+
+			for (uint32_t output_index = 0; output_index < num_output_bones; ++output_index)
+			{
+				const uint32_t bone_index = output_bone_mapping[output_index];
+				const transform_streams& bone_stream = segment.bone_streams[bone_index];
+
+				if (bone_stream.is_rotation_default || !bone_stream.is_rotation_constant)
+					continue;
+
+				is_group_quantized &= bone_stream.is_rotation_quantized;
+				num_rotations_in_group++;
+
+				if (num_rotations_in_group == 4)
+				{
+					group_action(num_rotations_in_group, is_group_quantized);
+					num_rotations_in_group = 0;
+					is_group_quantized = true;
+				}
+			}
+
+			if (num_rotations_in_group != 0)
+				group_action(num_rotations_in_group, is_group_quantized);
+		}
+
+		// Returns whether or not at least one group of constant rotations can be quantized
+		inline bool has_quantized_constant_rotation_groups(const clip_context& clip, const uint32_t* output_bone_mapping, uint32_t num_output_bones)
+		{
+			if (!clip.has_quantized_constant_rotations)
+				return false;
+
+			bool has_quantized_groups = false;
+			for_each_constant_rotation_group(clip, output_bone_mapping, num_output_bones,
+				[&has_quantized_groups](uint32_t num_rotations, bool is_group_quantized)
+				{
+					(void)num_rotations;
+					has_quantized_groups |= is_group_quantized;
+				});
+
+			return has_quantized_groups;
+		}
+
+		inline uint32_t get_num_constant_rotation_groups(const clip_context& clip, const uint32_t* output_bone_mapping, uint32_t num_output_bones)
+		{
+			uint32_t num_groups = 0;
+			for_each_constant_rotation_group(clip, output_bone_mapping, num_output_bones,
+				[&num_groups](uint32_t num_rotations, bool is_group_quantized)
+				{
+					(void)num_rotations;
+					(void)is_group_quantized;
+					num_groups++;
+				});
+
+			return num_groups;
+		}
+
+		inline uint32_t get_constant_data_size(const clip_context& clip, const uint32_t* output_bone_mapping, uint32_t num_output_bones, bool quantize_constant_rotations)
 		{
 			// Only use the first segment, it contains the necessary information
 			const segment_context& segment = clip.segments[0];
 
 			uint32_t constant_data_size = 0;
 
-			for (uint32_t bone_index = 0; bone_index < clip.num_bones; ++bone_index)
+			if (quantize_constant_rotations)
 			{
+				// Our rotations start with their total size and the bit set of quantized groups
+				const bitset_description quantized_groups_desc = bitset_description::make_from_num_bits(get_num_constant_rotation_groups(clip, output_bone_mapping, num_output_bones));
+				constant_data_size += sizeof(uint32_t) + quantized_groups_desc.get_num_bytes();
+
+				for_each_constant_rotation_group(clip, output_bone_mapping, num_output_bones,
+					[&constant_data_size](uint32_t num_rotations, bool is_group_quantized)
+					{
+						constant_data_size += get_constant_rotation_group_size(num_rotations, is_group_quantized);
+					});
+			}
+
+			for (uint32_t output_index = 0; output_index < num_output_bones; ++output_index)
+			{
+				const uint32_t bone_index = output_bone_mapping[output_index];
 				const transform_streams& bone_stream = segment.bone_streams[bone_index];
-				if (bone_stream.output_index == k_invalid_track_index)
-					continue;	// Stripped
 
-				if (!bone_stream.is_rotation_default && bone_stream.is_rotation_constant)
+				if (!quantize_constant_rotations && !bone_stream.is_rotation_default && bone_stream.is_rotation_constant)
 					constant_data_size += bone_stream.rotations.get_packed_sample_size();
 
 				if (!bone_stream.is_translation_default && bone_stream.is_translation_constant)
@@ -101,18 +182,33 @@ namespace acl
 			out_num_constant_scale_samples = num_constant_scale_samples;
 		}
 
-		inline void get_animated_variable_bit_rate_data_size(const track_stream& track_stream, uint32_t& out_num_animated_pose_bits)
+		// Rotations and vector formats with the same number of bits per component have no bit rate reduction
+		constexpr uint8_t k_no_bit_rate_reductions[3] = { 0, 0, 0 };
+
+		// Returns the number of bits used by the 3 components of an animated sample, see get_component_num_bits(..)
+		inline uint32_t get_animated_variable_bit_rate_num_bits(uint8_t bit_rate, const uint8_t bit_rate_reductions[3])
+		{
+			const uint32_t num_bits_at_bit_rate = get_num_bits_at_bit_rate(bit_rate);
+			if (is_constant_bit_rate(bit_rate) || is_raw_bit_rate(bit_rate))
+				return num_bits_at_bit_rate * 3;	// 3 components
+
+			return get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[0])
+				+ get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[1])
+				+ get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[2]);
+		}
+
+		inline void get_animated_variable_bit_rate_data_size(const track_stream& track_stream, const uint8_t bit_rate_reductions[3], uint32_t& out_num_animated_pose_bits)
 		{
 			const uint8_t bit_rate = track_stream.get_bit_rate();
-			const uint32_t num_bits_at_bit_rate = get_num_bits_at_bit_rate(bit_rate) * 3;	// 3 components
+			const uint32_t num_bits_at_bit_rate = get_animated_variable_bit_rate_num_bits(bit_rate, bit_rate_reductions);
 			out_num_animated_pose_bits += num_bits_at_bit_rate;
 		}
 
-		inline void calculate_animated_data_size(const track_stream& track_stream, uint32_t& num_animated_pose_bits)
+		inline void calculate_animated_data_size(const track_stream& track_stream, const uint8_t bit_rate_reductions[3], uint32_t& num_animated_pose_bits)
 		{
 			if (track_stream.is_bit_rate_variable())
 			{
-				get_animated_variable_bit_rate_data_size(track_stream, num_animated_pose_bits);
+				get_animated_variable_bit_rate_data_size(track_stream, bit_rate_reductions, num_animated_pose_bits);
 			}
 			else
 			{
@@ -137,13 +233,13 @@ namespace acl
 					const transform_streams& bone_stream = segment.bone_streams[bone_index];
 
 					if (!bone_stream.is_rotation_constant)
-						calculate_animated_data_size(bone_stream.rotations, num_animated_pose_rotation_data_bits);
+						calculate_animated_data_size(bone_stream.rotations, k_no_bit_rate_reductions, num_animated_pose_rotation_data_bits);
 
 					if (!bone_stream.is_translation_constant)
-						calculate_animated_data_size(bone_stream.translations, num_animated_pose_translation_data_bits);
+						calculate_animated_data_size(bone_stream.translations, bone_stream.translation_bit_rate_reductions, num_animated_pose_translation_data_bits);
 
 					if (!bone_stream.is_scale_constant)
-						calculate_animated_data_size(bone_stream.scales, num_animated_pose_scale_data_bits);
+						calculate_animated_data_size(bone_stream.scales, bone_stream.scale_bit_rate_reductions, num_animated_pose_scale_data_bits);
 				}
 
 				const uint32_t num_animated_pose_bits = num_animated_pose_rotation_data_bits + num_animated_pose_translation_data_bits + num_animated_pose_scale_data_bits;
@@ -199,7 +295,7 @@ namespace acl
 			return format_per_track_data_size;
 		}
 
-		inline uint32_t write_constant_track_data(const clip_context& clip, rotation_format8 rotation_format, uint8_t* constant_data, uint32_t constant_data_size, const uint32_t* output_bone_mapping, uint32_t num_output_bones)
+		inline uint32_t write_constant_track_data(const clip_context& clip, rotation_format8 rotation_format, bool quantize_constant_rotations, uint8_t* constant_data, uint32_t constant_data_size, const uint32_t* output_bone_mapping, uint32_t num_output_bones)
 		{
 			ACL_ASSERT(constant_data != nullptr, "'constant_data' cannot be null!");
 			(void)constant_data_size;
@@ -211,7 +307,7 @@ namespace acl
 			const uint8_t* constant_data_end = add_offset_to_ptr<uint8_t>(constant_data, constant_data_size);
 #endif
 
-			const uint8_t* constant_data_start = constant_data;
+			uint8_t* constant_data_start = constant_data;
 
 			// If our rotation format drops the W component, we swizzle the data to store XXXX, YYYY, ZZZZ
 			const bool swizzle_rotations = get_rotation_variant(rotation_format) == rotation_variant8::quat_drop_w;
@@ -220,6 +316,61 @@ namespace acl
 			float zzzz[4];
 			uint32_t num_swizzle_written = 0;
 
+			// When our rotations are quantized, they start with their total size and the bit set of quantized groups
+			uint32_t* quantized_groups = nullptr;
+			bitset_description quantized_groups_desc;
+			uint32_t group_index = 0;
+
+			if (quantize_constant_rotations)
+			{
+				ACL_ASSERT(swizzle_rotations, "Quantized constant rotations must drop W");
+
+				quantized_groups = reinterpret_cast<uint32_t*>(constant_data + sizeof(uint32_t));
+				quantized_groups_desc = bitset_description::make_from_num_bits(get_num_constant_rotation_groups(clip, output_bone_mapping, num_output_bones));
+				bitset_reset(quantized_groups, quantized_groups_desc, false);
+
+				for_each_constant_rotation_group(clip, output_bone_mapping, num_output_bones,
+					[quantized_groups, quantized_groups_desc, &group_index](uint32_t num_rotations, bool is_group_quantized)
+					{
+						(void)num_rotations;
+						bitset_set(quantized_groups, quantized_groups_desc, group_index++, is_group_quantized);
+					});
+
+				constant_data += sizeof(uint32_t) + quantized_groups_desc.get_num_bytes();
+				group_index = 0;
+			}
+
+			auto write_swizzled_group = [&]()
+			{
+				if (quantized_groups != nullptr && bitset_test(quantized_groups, quantized_groups_desc, group_index))
+				{
+					// XXXX, YYYY, ZZZZ with 16 bits per component, padded with zeroes
+					uint16_t components[12] = { 0 };
+					for (uint32_t rotation_index = 0; rotation_index < num_swizzle_written; ++rotation_index)
+					{
+						components[num_swizzle_written * 0 + rotation_index] = static_cast<uint16_t>(pack_scalar_signed(xxxx[rotation_index], 16));
+						components[num_swizzle_written * 1 + rotation_index] = static_cast<uint16_t>(pack_scalar_signed(yyyy[rotation_index], 16));
+						components[num_swizzle_written * 2 + rotation_index] = static_cast<uint16_t>(pack_scalar_signed(zzzz[rotation_index], 16));
+					}
+
+					const uint32_t group_size = get_constant_rotation_group_size(num_swizzle_written, true);
+					std::memcpy(constant_data, &components[0], group_size);
+					constant_data += group_size;
+				}
+				else
+				{
+					std::memcpy(constant_data, &xxxx[0], num_swizzle_written * sizeof(float));
+					constant_data += num_swizzle_written * sizeof(float);
+					std::memcpy(constant_data, &yyyy[0], num_swizzle_written * sizeof(float));
+					constant_data += num_swizzle_written * sizeof(float);
+					std::memcpy(constant_data, &zzzz[0], num_swizzle_written * sizeof(float));
+					constant_data += num_swizzle_written * sizeof(float);
+				}
+
+				group_index++;
+				num_swizzle_written = 0;
+			};
+
 			// Write rotations first
 			for (uint32_t output_index = 0; output_index < num_output_bones; ++output_index)
 			{
@@ -237,15 +388,7 @@ namespace acl
 						num_swizzle_written++;
 
 						if (num_swizzle_written >= 4)
-						{
-							std::memcpy(constant_data, &xxxx[0], sizeof(xxxx));
-							constant_data += sizeof(xxxx);
-							std::memcpy(constant_data, &yyyy[0], sizeof(yyyy));
-							constant_data += sizeof(yyyy);
-							std::memcpy(constant_data, &zzzz[0], sizeof(zzzz));
-							constant_data += sizeof(zzzz);
-							num_swizzle_written = 0;
-						}
+							write_swizzled_group();
 					}
 					else
 					{
@@ -261,16 +404,18 @@ namespace acl
 
 			if (swizzle_rotations && num_swizzle_written != 0)
 			{
-				std::memcpy(constant_data, &xxxx[0], num_swizzle_written * sizeof(float));
-				constant_data += num_swizzle_written * sizeof(float);
-				std::memcpy(constant_data, &yyyy[0], num_swizzle_written * sizeof(float));
-				constant_data += num_swizzle_written * sizeof(float);
-				std::memcpy(constant_data, &zzzz[0], num_swizzle_written * sizeof(float));
-				constant_data += num_swizzle_written * sizeof(float);
+				write_swizzled_group();
 
 				ACL_ASSERT(constant_data <= constant_data_end, "Invalid constant data offset. Wrote too much data.");
 			}
 
+			if (quantize_constant_rotations)
+			{
+				// Our total size includes the size itself and the bit set
+				const uint32_t constant_rotation_data_size = safe_static_cast<uint32_t>(constant_data - constant_data_start);
+				std::memcpy(constant_data_start, &constant_rotation_data_size, sizeof(uint32_t));
+			}
+
 			// Next, write translations
 			for (uint32_t output_index = 0; output_index < num_output_bones; ++output_index)
 			{
@@ -312,14 +457,14 @@ namespace acl
 			return safe_static_cast<uint32_t>(constant_data - constant_data_start);
 		}
 
-		inline void write_animated_sample(const track_stream& track_stream, uint32_t sample_index, uint8_t* animated_track_data_begin, uint64_t& out_bit_offset)
+		inline void write_animated_sample(const track_stream& track_stream, const uint8_t bit_rate_reductions[3], uint32_t sample_index, packed_bit_writer& writer)
 		{
 			const uint8_t* raw_sample_ptr = track_stream.get_raw_sample_ptr(sample_index);
 
 			if (track_stream.is_bit_rate_variable())
 			{
 				const uint8_t bit_rate = track_stream.get_bit_rate();
-				const uint32_t num_bits_at_bit_rate = get_num_bits_at_bit_rate(bit_rate) * 3;	// 3 components
+				const uint32_t num_bits_at_bit_rate = get_animated_variable_bit_rate_num_bits(bit_rate, bit_rate_reductions);
 
 				// Track is constant, our constant sample is stored in the range information
 				ACL_ASSERT(!is_constant_bit_rate(bit_rate), "Cannot write constant variable track data");
@@ -328,41 +473,28 @@ namespace acl
 				{
 					const uint32_t* raw_sample_u32 = safe_ptr_cast<const uint32_t>(raw_sample_ptr);
 
-					const uint32_t x = byte_swap(raw_sample_u32[0]);
-					memcpy_bits(animated_track_data_begin, out_bit_offset + 0, &x, 0, 32);
-					const uint32_t y = byte_swap(raw_sample_u32[1]);
-					memcpy_bits(animated_track_data_begin, out_bit_offset + 32, &y, 0, 32);
-					const uint32_t z = byte_swap(raw_sample_u32[2]);
-					memcpy_bits(animated_track_data_begin, out_bit_offset + 64, &z, 0, 32);
+					// Full precision floats are stored in big-endian
+					writer.write((uint64_t(raw_sample_u32[0]) << 32) | raw_sample_u32[1], 64);
+					writer.write(raw_sample_u32[2], 32);
 				}
 				else
 				{
-					const uint64_t* raw_sample_u64 = safe_ptr_cast<const uint64_t>(raw_sample_ptr);
-					memcpy_bits(animated_track_data_begin, out_bit_offset, raw_sample_u64, 0, num_bits_at_bit_rate);
+					// Our sample is already packed, append it as is
+					writer.write_packed(raw_sample_ptr, num_bits_at_bit_rate);
 				}
-
-				out_bit_offset += num_bits_at_bit_rate;
 			}
 			else
 			{
 				const uint32_t* raw_sample_u32 = safe_ptr_cast<const uint32_t>(raw_sample_ptr);
 
-				const uint32_t x = byte_swap(raw_sample_u32[0]);
-				memcpy_bits(animated_track_data_begin, out_bit_offset + 0, &x, 0, 32);
-				const uint32_t y = byte_swap(raw_sample_u32[1]);
-				memcpy_bits(animated_track_data_begin, out_bit_offset + 32, &y, 0, 32);
-				const uint32_t z = byte_swap(raw_sample_u32[2]);
-				memcpy_bits(animated_track_data_begin, out_bit_offset + 64, &z, 0, 32);
+				writer.write((uint64_t(raw_sample_u32[0]) << 32) | raw_sample_u32[1], 64);
 
 				const uint32_t sample_size = track_stream.get_packed_sample_size();
 				const bool has_w_component = sample_size == (sizeof(float) * 4);
 				if (has_w_component)
-				{
-					const uint32_t w = byte_swap(raw_sample_u32[3]);
-					memcpy_bits(animated_track_data_begin, out_bit_offset + 96, &w, 0, 32);
-				}
-
-				out_bit_offset += has_w_component ? 128 : 96;
+					writer.write((uint64_t(raw_sample_u32[2]) << 32) | raw_sample_u32[3], 64);
+				else
+					writer.write(raw_sample_u32[2], 32);
 			}
 		}
 
@@ -371,15 +503,11 @@ namespace acl
 			ACL_ASSERT(animated_track_data != nullptr, "'animated_track_data' cannot be null!");
 			(void)animated_data_size;
 
-			uint8_t* animated_track_data_begin = animated_track_data;
-
 			const uint8_t* animated_track_data_start = animated_track_data;
 			const uint8_t* animated_track_data_end = add_offset_to_ptr<uint8_t>(animated_track_data, animated_data_size);
 			const bool has_stripped_keyframes = segment.clip->has_stripped_keyframes;
 			const bitset_description hard_keyframes_desc = bitset_description::make_from_num_bits<32>();
 
-			uint64_t bit_offset = 0;
-
 			// Data is sorted first by time, second by bone.
 			// This ensures that all bones are contiguous in memory when we sample a particular time.
 
@@ -389,9 +517,9 @@ namespace acl
 
 			// For animated samples, when we have a constant bit rate (bit rate 0), we do not store samples
 			// and as such the group that contains that sub-track won't contain 4 samples.
-			// The largest sample is a full precision vector4f, we can contain at most 4 samples
-			alignas(16) uint8_t group_animated_track_data[sizeof(rtm::vector4f) * 4];
-			uint64_t group_bit_offset = 0;
+
+			// Groups are contiguous in the bit stream, samples are accumulated and written out a whole word at a time
+			packed_bit_writer writer(animated_track_data);
 
 			auto group_filter_action = [](animation_track_type8 group_type, uint32_t bone_index)
 			{
@@ -403,19 +531,15 @@ namespace acl
 				return true;
 			};
 
-			auto group_flush_action = [animated_track_data_begin, &bit_offset, &group_animated_track_data, &group_bit_offset, &animated_track_data, animated_track_data_end](animation_track_type8 group_type, uint32_t group_size)
+			auto group_flush_action = [&writer, animated_track_data_start, animated_track_data_end](animation_track_type8 group_type, uint32_t group_size)
 			{
 				(void)group_type;
 				(void)group_size;
+				(void)writer;
+				(void)animated_track_data_start;
+				(void)animated_track_data_end;
 
-				memcpy_bits(animated_track_data_begin, bit_offset, &group_animated_track_data[0], 0, group_bit_offset);
-
-				bit_offset += group_bit_offset;
-				group_bit_offset = 0;
-
-				animated_track_data = animated_track_data_begin + (bit_offset / 8);
-
-				ACL_ASSERT(animated_track_data <= animated_track_data_end, "Invalid animated track data offset. Wrote too much data."); (void)animated_track_data_end;
+				ACL_ASSERT(animated_track_data_start + (writer.get_num_bits_written() / 8) <= animated_track_data_end, "Invalid animated track data offset. Wrote too much data.");
 			};
 
 			for (uint32_t sample_index = 0; sample_index < segment.num_samples; ++sample_index)
@@ -423,7 +547,7 @@ namespace acl
 				if (has_stripped_keyframes && !bitset_test(&segment.hard_keyframes, hard_keyframes_desc, sample_index))
 					continue;	// This keyframe has been stripped, skip it
 
-				auto group_entry_action = [&segment, sample_index, &group_animated_track_data, &group_bit_offset](animation_track_type8 group_type, uint32_t group_size, uint32_t bone_index)
+				auto group_entry_action = [&segment, sample_index, &writer](animation_track_type8 group_type, uint32_t group_size, uint32_t bone_index)
 				{
 					(void)group_size;
 
@@ -431,25 +555,28 @@ namespace acl
 					if (group_type == animation_track_type8::rotation)
 					{
 						if (!is_constant_bit_rate(bone_stream.rotations.get_bit_rate()))
-							write_animated_sample(bone_stream.rotations, sample_index, group_animated_track_data, group_bit_offset);
+							write_animated_sample(bone_stream.rotations, k_no_bit_rate_reductions, sample_index, writer);
 					}
 					else if (group_type == animation_track_type8::translation)
 					{
 						if (!is_constant_bit_rate(bone_stream.translations.get_bit_rate()))
-							write_animated_sample(bone_stream.translations, sample_index, group_animated_track_data, group_bit_offset);
+							write_animated_sample(bone_stream.translations, bone_stream.translation_bit_rate_reductions, sample_index, writer);
 					}
 					else
 					{
 						if (!is_constant_bit_rate(bone_stream.scales.get_bit_rate()))
-							write_animated_sample(bone_stream.scales, sample_index, group_animated_track_data, group_bit_offset);
+							write_animated_sample(bone_stream.scales, bone_stream.scale_bit_rate_reductions, sample_index, writer);
 					}
 				};
 
 				animated_group_writer(segment, output_bone_mapping, num_output_bones, group_filter_action, group_entry_action, group_flush_action);
 			}
 
+			writer.flush();
+
+			const uint64_t bit_offset = writer.get_num_bits_written();
 			if (bit_offset != 0)
-				animated_track_data = animated_track_data_begin + ((bit_offset + 7) / 8);
+				animated_track_data += (bit_offset + 7) / 8;
 
 #if defined(ACL_HAS_ASSERT_CHECKS)
 			const uint32_t num_stored_samples = has_stripped_keyframes ? bitset_count_set_bits(&segment.hard_keyframes, hard_keyframes_desc) : segment.num_samples;
@@ -491,8 +618,12 @@ namespace acl
 				const transform_streams& bone_stream = segment.bone_streams[bone_index];
 
 				uint32_t bit_rate;
+				uint32_t dropped_component = 0;
 				if (group_type == animation_track_type8::rotation)
+				{
 					bit_rate = bone_stream.rotations.get_bit_rate();
+					dropped_component = bone_stream.rotation_dropped_component;
+				}
 				else if (group_type == animation_track_type8::translation)
 					bit_rate = bone_stream.translations.get_bit_rate();
 				else
@@ -507,11 +638,13 @@ namespace acl
 				// Instead, we store the number of bits on 5 bits which has a max value of 31.
 				// To do so, we remap 32 to 31 since that value is unused.
 				// This leaves 3 unused bits in our per sub-track metadata.
-				// These will later be needed:
+				// The top 2 bits dictate which rotation component is dropped (0 = W, 1 = X, 2 = Y, 3 = Z).
+				// They are always zero for translations, scales, and rotations that drop W.
+				// The remaining bit will later be needed:
 				//    - 1 bit to dictate if rotations contain 3 or 4 components (to allow mixing full quats in with packed quats)
-				//    - 2 bits to dictate which rotation component is dropped (to allow the largest component to be dropped over our segment)
 
-				format_per_track_group[group_size] = (bit_rate == k_highest_bit_rate) ? 31 : (uint8_t)num_bits;
+				const uint32_t num_bits_metadata = (bit_rate == k_highest_bit_rate) ? 31 : num_bits;
+				format_per_track_group[group_size] = uint8_t(num_bits_metadata | (dropped_component << k_dropped_component_metadata_shift));
 			};
 
 			auto group_flush_action = [&format_per_track_data, format_per_track_data_end, &format_per_track_group](animation_track_type8 group_type, uint32_t group_size)
@@ -25,6 +25,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "acl/version.h"
+#include "acl/core/range_reduction_types.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/impl/compressed_headers.h"
 #include "acl/core/impl/variable_bit_rates.h"
@@ -128,6 +129,57 @@ namespace acl
 			return safe_static_cast<uint32_t>(output_buffer - output_buffer_start);
 		}
 
+		inline uint32_t write_track_segment_range_values(const track_list_context& context, uint32_t segment_index, uint8_t* segment_range_values)
+		{
+			ACL_ASSERT(context.is_valid(), "Invalid context");
+			ACL_ASSERT(context.is_segmented(), "Track list is not segmented");
+			ACL_ASSERT(segment_index < context.num_segments, "Invalid segment index");
+
+			uint8_t* output_buffer = segment_range_values;
+			const uint8_t* output_buffer_start = output_buffer;
+
+			const uint32_t num_components = get_track_num_sample_elements(context.reference_list->get_track_type());
+			ACL_ASSERT(num_components <= 4, "Unexpected number of elements");
+
+			const float max_range_value = float((1 << k_segment_range_reduction_num_bits_per_component) - 1);
+
+			for (uint32_t output_index = 0; output_index < context.num_output_tracks; ++output_index)
+			{
+				const uint32_t track_index = context.track_output_indices[output_index];
+
+				if (context.is_constant(track_index))
+					continue;
+
+				const uint8_t bit_rate = context.bit_rate_list[track_index].scalar.value;
+				if (is_raw_bit_rate(bit_rate))
+					continue;
+
+				if (segment_range_values != nullptr)
+				{
+					const track_range& range = context.segment_range_list[(segment_index * context.num_tracks) + track_index];
+
+					// Only support scalarf for now
+					ACL_ASSERT(range.category == track_category8::scalarf, "Unsupported category");
+
+					alignas(16) float range_min[4];
+					alignas(16) float range_extent[4];
+					rtm::vector_store(range.range.scalarf.get_min(), &range_min[0]);
+					rtm::vector_store(range.range.scalarf.get_extent(), &range_extent[0]);
+
+					for (uint32_t component_index = 0; component_index < num_components; ++component_index)
+					{
+						output_buffer[component_index] = safe_static_cast<uint8_t>(static_cast<uint32_t>((range_min[component_index] * max_range_value) + 0.5F));
+						output_buffer[num_components + component_index] = safe_static_cast<uint8_t>(static_cast<uint32_t>((range_extent[component_index] * max_range_value) + 0.5F));
+					}
+				}
+
+				output_buffer += num_components;	// Min
+				output_buffer += num_components;	// Extent
+			}
+
+			return safe_static_cast<uint32_t>(output_buffer - output_buffer_start);
+		}
+
 		inline uint32_t write_track_animated_values(const track_list_context& context, uint8_t* animated_values)
 		{
 			ACL_ASSERT(context.is_valid(), "Invalid context");
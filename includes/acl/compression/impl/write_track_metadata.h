@@ -25,9 +25,11 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "acl/version.h"
+#include "acl/core/hash.h"
 #include "acl/core/memory_utils.h"
 #include "acl/core/track_desc.h"
 #include "acl/core/impl/compiler_utils.h"
+#include "acl/core/impl/compressed_headers.h"
 #include "acl/compression/track_array.h"
 #include "acl/compression/impl/clip_context.h"
 
@@ -60,16 +62,16 @@ namespace acl
 			return safe_static_cast<uint32_t>(output_buffer - output_buffer_start);
 		}
 
-		inline uint32_t write_track_names(const track_array& tracks, const uint32_t* track_output_indices, uint32_t num_output_tracks, uint32_t* out_track_names)
+		inline uint32_t write_track_names(const track_array& tracks, const uint32_t* track_output_indices, uint32_t num_output_tracks, bool include_name_table, uint32_t* out_track_names)
 		{
 			ACL_ASSERT(out_track_names == nullptr || out_track_names[0] == 0 || num_output_tracks == 0, "Buffer overrun detected");
 
 			uint8_t* output_buffer = reinterpret_cast<uint8_t*>(out_track_names);
 			const uint8_t* output_buffer_start = output_buffer;
 
-			// Write offsets first
+			// Write offsets first, followed by the table offset if we have one
 			uint32_t* track_name_offsets = out_track_names;
-			uint32_t offset = sizeof(uint32_t) * num_output_tracks;
+			uint32_t offset = sizeof(uint32_t) * (include_name_table ? (num_output_tracks + 1) : num_output_tracks);
 			for (uint32_t output_index = 0; output_index < num_output_tracks; ++output_index)
 			{
 				const uint32_t track_index = track_output_indices[output_index];
@@ -84,6 +86,14 @@ namespace acl
 				offset += name_size;
 			}
 
+			if (include_name_table)
+			{
+				if (out_track_names != nullptr)
+					*track_name_offsets = align_to(offset, 4);
+
+				output_buffer += sizeof(uint32_t);
+			}
+
 			// Next write our track names
 			char* track_names = safe_ptr_cast<char>(output_buffer);
 			for (uint32_t output_index = 0; output_index < num_output_tracks; ++output_index)
@@ -99,6 +109,45 @@ namespace acl
 				output_buffer += name_size;
 			}
 
+			if (include_name_table)
+			{
+				// Finally, write our open addressed name table
+				// Track names are inserted in output order, the first of duplicate names will be found first
+				output_buffer = align_to(output_buffer, 4);
+
+				const uint32_t num_slots = get_num_track_name_table_slots(num_output_tracks);
+				uint32_t* num_slots_ptr = safe_ptr_cast<uint32_t>(output_buffer);
+				output_buffer += sizeof(uint32_t);
+
+				track_name_table_slot* slots = safe_ptr_cast<track_name_table_slot>(output_buffer);
+				output_buffer += sizeof(track_name_table_slot) * num_slots;
+
+				if (out_track_names != nullptr)
+				{
+					*num_slots_ptr = num_slots;
+
+					for (uint32_t slot_index = 0; slot_index < num_slots; ++slot_index)
+					{
+						slots[slot_index].name_hash = 0;
+						slots[slot_index].track_index = k_invalid_track_index;
+					}
+
+					const uint32_t slot_mask = num_slots - 1;
+					for (uint32_t output_index = 0; output_index < num_output_tracks; ++output_index)
+					{
+						const uint32_t track_index = track_output_indices[output_index];
+						const uint32_t name_hash = hash32(tracks[track_index].get_name().c_str());
+
+						uint32_t slot_index = name_hash & slot_mask;
+						while (slots[slot_index].track_index != k_invalid_track_index)
+							slot_index = (slot_index + 1) & slot_mask;
+
+						slots[slot_index].name_hash = name_hash;
+						slots[slot_index].track_index = output_index;
+					}
+				}
+			}
+
 			return safe_static_cast<uint32_t>(output_buffer - output_buffer_start);
 		}
 
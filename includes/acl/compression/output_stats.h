@@ -32,6 +32,9 @@
 #include <sjson/writer.h>
 #endif
 
+#include <cstddef>
+#include <cstdint>
+
 ACL_IMPL_FILE_PRAGMA_PUSH
 
 namespace acl
@@ -44,10 +47,72 @@ namespace acl
 		summary						= 0x0001,
 		detailed					= 0x0002 | summary,
 		exhaustive					= 0x0004 | detailed,
+
+		// Breaks down the compressed size by component, by track and sub-track, and by segment
+		// Only supported by transform tracks
+		size_attribution			= 0x0008 | summary,
+
+		// Measures the memory used by compression, see compression_memory_stats
+		// Written with the other statistics when combined with summary
+		memory						= 0x0010,
 	};
 
 	ACL_IMPL_ENUM_FLAGS_OPERATORS(stat_logging)
 
+	//////////////////////////////////////////////////////////////////////////
+	// A sink for binary statistics.
+	// Exhaustive statistics contain the error of every sample and bone and are too large
+	// to be written efficiently as SJSON. When provided, they are written to this sink
+	// instead in a compact columnar form and the SJSON statistics contain the offset where they begin.
+	//
+	// Every exhaustive error record contains, in order and little endian:
+	//    uint32_t tag ('ACLE'), uint32_t version (1)
+	//    uint32_t num_bones, uint32_t num_samples, float sample_rate, uint32_t num_segments
+	//    uint32_t segment_sample_offsets[num_segments]
+	//    float errors[num_bones][num_samples], one column of samples per bone
+	//////////////////////////////////////////////////////////////////////////
+	class binary_stats_writer
+	{
+	public:
+		virtual ~binary_stats_writer() {}
+
+		// Returns the offset in bytes at which the next write begins
+		virtual uint64_t get_offset() const = 0;
+
+		// Appends the provided data
+		virtual void write(const void* data, size_t size) = 0;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// The memory used by compression, measured when stat_logging::memory is requested.
+	// Sizes are in bytes and only include memory obtained from the allocator provided to compression.
+	// Transient data is carved out of large arena blocks when no job scheduler is used,
+	// the sizes then include the whole blocks. Only transform tracks report the sizes per stage.
+	//////////////////////////////////////////////////////////////////////////
+	struct compression_memory_stats
+	{
+		// The most memory held at once during compression, the compressed output included
+		uint64_t				peak_size = 0;
+
+		// The number of allocations made
+		uint64_t				num_allocations = 0;
+
+		// The most memory held at once while the clip contexts are initialized, normalized, and segmented
+		uint64_t				clip_contexts_peak_size = 0;
+
+		// The most memory held at once while the samples are quantized
+		uint64_t				quantization_peak_size = 0;
+
+		// The memory added while quantizing, held by the quantization contexts and their scratch
+		uint64_t				quantization_context_size = 0;
+
+		// The size of the bit rate databases used while quantizing, one per quantization context
+		uint64_t				bit_rate_database_size = 0;
+
+		// The most memory held at once while the compressed tracks are written, the output included
+		uint64_t				output_peak_size = 0;
+	};
+
 	struct output_stats
 	{
 		stat_logging			logging = stat_logging::none;
@@ -55,6 +120,12 @@ namespace acl
 #if defined(ACL_USE_SJSON)
 		sjson::ObjectWriter*	writer = nullptr;
 #endif
+
+		// Optional, exhaustive errors are written to it instead of the SJSON writer when provided
+		binary_stats_writer*	binary_writer = nullptr;
+
+		// Filled by compression when stat_logging::memory is requested
+		compression_memory_stats	memory;
 	};
 
 	ACL_IMPL_VERSION_NAMESPACE_END
@@ -0,0 +1,136 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/error_result.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/track_formats.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/compression/additive_base_context.h"
+#include "acl/compression/compression_settings.h"
+#include "acl/compression/track_array.h"
+#include "acl/compression/impl/clip_context.h"
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// A clip prepared once and compressed many times with different compression settings.
+	//
+	// Before anything depends on the compression settings, compressing a clip lowers its
+	// sample rate when allowed, copies and validates its samples, and measures the
+	// shell distance of every transform. When the same clip is compressed with many
+	// settings (e.g. to search for the best variable bit rate or segmenting settings),
+	// that work is identical every time. A prepared clip context does it once and
+	// compressing with it starts from a copy of the result, see 'compress_track_list(..)'.
+	//
+	// The output matches compressing the track list directly. The compression settings
+	// must use the error metric the clip was prepared with and the same sample rate
+	// reduction setting. The track list, the additive base context, and the skeleton
+	// context from the settings, if any, must outlive the prepared clip context.
+	// It is read only once initialized and can be used by many compression jobs concurrently.
+	//////////////////////////////////////////////////////////////////////////
+	class prepared_clip_context
+	{
+	public:
+		//////////////////////////////////////////////////////////////////////////
+		// Constructs an empty prepared clip context.
+		prepared_clip_context();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Destructs the prepared clip context and releases its memory.
+		~prepared_clip_context();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Initializes the prepared clip context from the provided track list.
+		// Only the error metric, the sample rate reduction, and the skeleton are read from the compression settings.
+		error_result initialize(iallocator& allocator, const track_array_qvvf& track_list, const compression_settings& settings);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Initializes the prepared clip context from the provided additive track list and its prepared additive base.
+		// Only the error metric, the sample rate reduction, and the skeleton are read from the compression settings.
+		error_result initialize(iallocator& allocator, const track_array_qvvf& track_list, const compression_settings& settings, const additive_base_context& additive_base);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Releases the memory held and resets the prepared clip context to its default constructed state.
+		void reset();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if this prepared clip context has been initialized, false otherwise.
+		bool is_initialized() const { return m_allocator != nullptr; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the track list the clip was prepared from.
+		const track_array_qvvf* get_track_list() const { return m_track_list; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the additive base the clip was prepared with or nullptr if the clip isn't additive.
+		const additive_base_context* get_additive_base() const { return m_additive_base; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the error metric the clip was prepared with.
+		const itransform_error_metric* get_error_metric() const { return m_error_metric; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns whether the sample rate reduction was enabled when the clip was prepared.
+		bool is_sample_rate_reduction_enabled() const { return m_enable_sample_rate_reduction; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Internal use only, returns the track list compressed, with its sample rate reduced if it could be.
+		const track_array_qvvf& get_prepared_track_list() const { return m_reduced_track_list.is_empty() ? *m_track_list : m_reduced_track_list; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Internal use only, returns the clip data prepared for the provided rotation format.
+		const acl_impl::clip_context& get_clip_context(rotation_format8 rotation_format) const { return m_clip_contexts[rotation_format == rotation_format8::quatf_full ? 1 : 0]; }
+
+	private:
+		prepared_clip_context(const prepared_clip_context& other) = delete;
+		prepared_clip_context& operator=(const prepared_clip_context& other) = delete;
+
+		error_result initialize_impl(iallocator& allocator, const track_array_qvvf& track_list, const compression_settings& settings, const additive_base_context* additive_base);
+
+		iallocator*								m_allocator;
+		const track_array_qvvf*					m_track_list;
+		const additive_base_context*			m_additive_base;
+		const itransform_error_metric*			m_error_metric;
+		bool									m_enable_sample_rate_reduction;
+
+		track_array_qvvf						m_reduced_track_list;		// Empty if the sample rate isn't reduced
+		acl_impl::clip_context					m_clip_contexts[2];			// Indexed by whether the rotation format is full precision, it changes how rotations are normalized
+		acl_impl::rigid_shell_metadata_t*		m_clip_shell_metadata[2];	// Same indexing as above
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+#include "acl/compression/impl/prepared_clip_context.impl.h"
+
+ACL_IMPL_FILE_PRAGMA_POP
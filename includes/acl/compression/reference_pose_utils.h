@@ -0,0 +1,75 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/error_result.h"
+#include "acl/core/reference_pose.h"
+#include "acl/core/track_desc.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/compression/track_array.h"
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Prepares a track list to be compressed against a reference pose.
+	// The default value of every output track is set to its reference pose
+	// transform. During compression, constant sub-tracks that match it within
+	// the track precision (as measured by the error metric) are then elided.
+	// Stripped tracks (with an invalid output index) are left untouched.
+	// Returns an error if an output index falls outside the reference pose.
+	//////////////////////////////////////////////////////////////////////////
+	inline error_result apply_reference_pose(const reference_pose& pose, track_array_qvvf& track_list)
+	{
+		for (track_qvvf& track_ : track_list)
+		{
+			const uint32_t output_index = track_.get_description().output_index;
+			if (output_index == k_invalid_track_index)
+				continue;	// Stripped
+
+			if (output_index >= pose.get_num_transforms())
+				return error_result("Track output index is outside the reference pose");
+		}
+
+		for (track_qvvf& track_ : track_list)
+		{
+			track_desc_transformf& desc = track_.get_description();
+			if (desc.output_index != k_invalid_track_index)
+				desc.default_value = pose.get_transform(desc.output_index);
+		}
+
+		return error_result();
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,279 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "acl/version.h"
+#include "acl/core/error_result.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/scalar_track_basis.h"
+#include "acl/core/track_desc.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/compression/track.h"
+#include "acl/compression/track_array.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		// Maximum number of power iterations used to find each basis vector
+		constexpr uint32_t k_max_num_basis_power_iterations = 128;
+
+		// Finds the dominant eigenvector of a symmetric matrix with power iterations and returns its eigenvalue
+		inline double find_dominant_eigenvector(const double* matrix, uint32_t size, double* scratch, double* out_eigenvector)
+		{
+			// Start from the axis with the largest variance, it is never orthogonal to the dominant eigenvector
+			uint32_t largest_index = 0;
+			for (uint32_t index = 1; index < size; ++index)
+			{
+				if (matrix[index * size + index] > matrix[largest_index * size + largest_index])
+					largest_index = index;
+			}
+
+			std::fill(out_eigenvector, out_eigenvector + size, 0.0);
+			out_eigenvector[largest_index] = 1.0;
+
+			double eigenvalue = 0.0;
+			for (uint32_t iteration = 0; iteration < k_max_num_basis_power_iterations; ++iteration)
+			{
+				double length_sq = 0.0;
+				for (uint32_t row = 0; row < size; ++row)
+				{
+					double value = 0.0;
+					for (uint32_t column = 0; column < size; ++column)
+						value += matrix[row * size + column] * out_eigenvector[column];
+
+					scratch[row] = value;
+					length_sq += value * value;
+				}
+
+				const double length = std::sqrt(length_sq);
+				if (length <= 1.0E-20)
+					return 0.0;	// No variance remains
+
+				double delta_sq = 0.0;
+				for (uint32_t index = 0; index < size; ++index)
+				{
+					const double value = scratch[index] / length;
+					delta_sq += (value - out_eigenvector[index]) * (value - out_eigenvector[index]);
+					out_eigenvector[index] = value;
+				}
+
+				eigenvalue = length;
+				if (delta_sq <= 1.0E-20)
+					break;	// Converged
+			}
+
+			return eigenvalue;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Builds a basis for a list of correlated float1f tracks (e.g. facial blend shape weights)
+	// along with the float1f tracks of its coefficients.
+	//
+	// Basis vectors are the principal components of the track values over the whole clip.
+	// They are added until every track is reconstructed within half its precision or until
+	// 'max_num_basis_vectors' is reached, in which case the track precision is no longer
+	// guaranteed. The coefficient tracks use the remaining half of the
+	// smallest track precision and can be compressed with compress_track_list(..) in place of
+	// the original tracks. When decompressing, their values are written into an array of
+	// coefficients which is then used to reconstruct the tracks, see scalar_track_basis.
+	// The larger the correlation, the fewer coefficient tracks we need.
+	//
+	// The basis data is allocated with the provided allocator, 16 bytes aligned, and contains
+	// get_scalar_track_basis_data_size(num tracks, out_num_basis_vectors) floats. It must be
+	// freed with deallocate_type_array(..).
+	//////////////////////////////////////////////////////////////////////////
+	inline error_result build_scalar_track_basis(iallocator& allocator, const track_array_float1f& track_list, uint32_t max_num_basis_vectors,
+		float*& out_basis_data, uint32_t& out_num_basis_vectors, track_array_float1f& out_coefficient_tracks)
+	{
+		out_basis_data = nullptr;
+		out_num_basis_vectors = 0;
+
+		const error_result result = track_list.is_valid();
+		if (result.any())
+			return result;
+
+		const uint32_t num_tracks = track_list.get_num_tracks();
+		const uint32_t num_samples = track_list.get_num_samples_per_track();
+		if (num_tracks == 0 || num_samples == 0)
+			return error_result("Track list must contain samples");
+
+		if (max_num_basis_vectors == 0)
+			return error_result("At least one basis vector is required");
+
+		max_num_basis_vectors = std::min<uint32_t>(max_num_basis_vectors, num_tracks);
+
+		// Center our samples, the basis reconstructs the deviation from the mean
+		double* means = allocate_type_array<double>(allocator, num_tracks);
+		double* residuals = allocate_type_array<double>(allocator, size_t(num_samples) * num_tracks);
+		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+		{
+			const track_float1f& track_ = track_list[track_index];
+
+			double sum = 0.0;
+			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+				sum += double(track_[sample_index]);
+
+			means[track_index] = sum / double(num_samples);
+
+			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+				residuals[size_t(sample_index) * num_tracks + track_index] = double(track_[sample_index]) - means[track_index];
+		}
+
+		double* covariance = allocate_type_array<double>(allocator, size_t(num_tracks) * num_tracks);
+		for (uint32_t row = 0; row < num_tracks; ++row)
+		{
+			for (uint32_t column = row; column < num_tracks; ++column)
+			{
+				double sum = 0.0;
+				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+					sum += residuals[size_t(sample_index) * num_tracks + row] * residuals[size_t(sample_index) * num_tracks + column];
+
+				covariance[row * num_tracks + column] = sum / double(num_samples);
+				covariance[column * num_tracks + row] = sum / double(num_samples);
+			}
+		}
+
+		double* basis_vectors = allocate_type_array<double>(allocator, size_t(max_num_basis_vectors) * num_tracks);
+		double* coefficients = allocate_type_array<double>(allocator, size_t(max_num_basis_vectors) * num_samples);
+		double* scratch = allocate_type_array<double>(allocator, num_tracks);
+
+		// Half our precision is used by the basis, the other half by the coefficients
+		float min_precision = track_list[0].get_description().precision;
+		for (const track_float1f& track_ : track_list)
+			min_precision = std::min<float>(min_precision, track_.get_description().precision);
+
+		uint32_t num_basis_vectors = 0;
+		while (num_basis_vectors < max_num_basis_vectors)
+		{
+			// Stop once every track is reconstructed accurately enough
+			bool is_accurate = true;
+			for (uint32_t track_index = 0; track_index < num_tracks && is_accurate; ++track_index)
+			{
+				const double max_residual = double(track_list[track_index].get_description().precision) * 0.5;
+				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+				{
+					if (std::abs(residuals[size_t(sample_index) * num_tracks + track_index]) > max_residual)
+					{
+						is_accurate = false;
+						break;
+					}
+				}
+			}
+
+			if (is_accurate)
+				break;
+
+			double* basis_vector = basis_vectors + size_t(num_basis_vectors) * num_tracks;
+			const double eigenvalue = acl_impl::find_dominant_eigenvector(covariance, num_tracks, scratch, basis_vector);
+			if (eigenvalue <= 0.0)
+				break;	// No variance remains
+
+			// Remove what this basis vector reconstructs from our residuals and our covariance
+			double* basis_coefficients = coefficients + size_t(num_basis_vectors) * num_samples;
+			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			{
+				double* sample_residuals = residuals + size_t(sample_index) * num_tracks;
+
+				double coefficient = 0.0;
+				for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+					coefficient += sample_residuals[track_index] * basis_vector[track_index];
+
+				for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+					sample_residuals[track_index] -= coefficient * basis_vector[track_index];
+
+				basis_coefficients[sample_index] = coefficient;
+			}
+
+			for (uint32_t row = 0; row < num_tracks; ++row)
+			{
+				for (uint32_t column = 0; column < num_tracks; ++column)
+					covariance[row * num_tracks + column] -= eigenvalue * basis_vector[row] * basis_vector[column];
+			}
+
+			num_basis_vectors++;
+		}
+
+		// Write our basis, padding is zeroed to reconstruct 4 tracks at a time
+		const uint32_t stride = get_scalar_track_basis_stride(num_tracks);
+		const uint32_t basis_data_size = get_scalar_track_basis_data_size(num_tracks, num_basis_vectors);
+		float* basis_data = allocate_type_array_aligned<float>(allocator, basis_data_size, 16);
+		std::fill(basis_data, basis_data + basis_data_size, 0.0F);
+
+		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			basis_data[track_index] = float(means[track_index]);
+
+		for (uint32_t basis_index = 0; basis_index < num_basis_vectors; ++basis_index)
+		{
+			for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+				basis_data[stride * (basis_index + 1) + track_index] = float(basis_vectors[size_t(basis_index) * num_tracks + track_index]);
+		}
+
+		// Each basis vector has unit length, a coefficient error contributes at most as much error to every track
+		const float coefficient_precision = num_basis_vectors != 0 ? (min_precision * 0.5F / float(num_basis_vectors)) : min_precision;
+		const float sample_rate = track_list.get_sample_rate();
+
+		track_array_float1f coefficient_tracks(allocator, num_basis_vectors);
+		for (uint32_t basis_index = 0; basis_index < num_basis_vectors; ++basis_index)
+		{
+			track_desc_scalarf desc;
+			desc.output_index = basis_index;
+			desc.precision = coefficient_precision;
+
+			track_float1f coefficient_track = track_float1f::make_reserve(desc, allocator, num_samples, sample_rate);
+			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+				coefficient_track[sample_index] = float(coefficients[size_t(basis_index) * num_samples + sample_index]);
+
+			coefficient_tracks[basis_index] = std::move(coefficient_track);
+		}
+
+		deallocate_type_array(allocator, scratch, num_tracks);
+		deallocate_type_array(allocator, coefficients, size_t(max_num_basis_vectors) * num_samples);
+		deallocate_type_array(allocator, basis_vectors, size_t(max_num_basis_vectors) * num_tracks);
+		deallocate_type_array(allocator, covariance, size_t(num_tracks) * num_tracks);
+		deallocate_type_array(allocator, residuals, size_t(num_samples) * num_tracks);
+		deallocate_type_array(allocator, means, num_tracks);
+
+		out_basis_data = basis_data;
+		out_num_basis_vectors = num_basis_vectors;
+		out_coefficient_tracks = std::move(coefficient_tracks);
+		return error_result();
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
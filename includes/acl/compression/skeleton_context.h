@@ -0,0 +1,108 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/error_result.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/compression/track_array.h"
+#include "acl/compression/impl/transform_hierarchy.h"
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Hierarchy data derived from the parent indices of a skeleton.
+	//
+	// Compressing a transform track list requires its transform chains (every transform
+	// from the root to each leaf) and its transforms sorted parent first. This only
+	// depends on the hierarchy and it is identical for every clip that shares a skeleton.
+	// A skeleton context computes it once and when provided with the compression settings,
+	// every clip context shares it instead of computing its own.
+	//
+	// A track list that doesn't match the skeleton hierarchy (a different number of
+	// transforms or parent indices) silently computes its own. The compressed output
+	// is identical with or without a skeleton context.
+	//
+	// The skeleton context is read only once initialized and can be used by many
+	// compression jobs concurrently. It must outlive compression.
+	//////////////////////////////////////////////////////////////////////////
+	class skeleton_context
+	{
+	public:
+		//////////////////////////////////////////////////////////////////////////
+		// Constructs an empty skeleton context.
+		skeleton_context();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Destructs the skeleton context and releases its memory.
+		~skeleton_context();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Initializes the skeleton context from the parent indices of the provided
+		// transform track descriptions. The samples are ignored, any clip of the skeleton can be used.
+		error_result initialize(iallocator& allocator, const track_array_qvvf& track_list);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Releases the memory held and resets the skeleton context to its default constructed state.
+		void reset();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if this skeleton context has been initialized, false otherwise.
+		bool is_initialized() const { return m_allocator != nullptr; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of transforms in the skeleton.
+		uint32_t get_num_transforms() const { return m_hierarchy.num_transforms; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns whether or not the provided track list shares this skeleton hierarchy.
+		bool is_compatible(const track_array_qvvf& track_list) const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Internal use only, returns the hierarchy data.
+		const acl_impl::transform_hierarchy& get_hierarchy() const { return m_hierarchy; }
+
+	private:
+		skeleton_context(const skeleton_context& other) = delete;
+		skeleton_context& operator=(const skeleton_context& other) = delete;
+
+		iallocator*						m_allocator;
+		uint32_t*						m_parent_indices;	// One per transform
+		acl_impl::transform_hierarchy	m_hierarchy;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+#include "acl/compression/impl/skeleton_context.impl.h"
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,83 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/compression/compression_settings.h"
+
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Adapts Intel TBB (oneTBB) to the compression job scheduler interface.
+	// Jobs run in the current task arena through a task group. TBB is not a
+	// dependency of ACL, include this header only if your project uses it.
+	//
+	// Usage:
+	//    tbb_job_scheduler scheduler;
+	//    settings.job_scheduler = scheduler.get_job_scheduler();
+	//
+	// The adapter must outlive every compression that uses its scheduler.
+	//////////////////////////////////////////////////////////////////////////
+	class tbb_job_scheduler
+	{
+	public:
+		tbb_job_scheduler() = default;
+
+		tbb_job_scheduler(const tbb_job_scheduler&) = delete;
+		tbb_job_scheduler& operator=(const tbb_job_scheduler&) = delete;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns a job scheduler that submits to TBB for use with compression.
+		compression_job_scheduler get_job_scheduler()
+		{
+			compression_job_scheduler job_scheduler;
+			job_scheduler.submit_job = [](void* user_data, compression_job_scheduler::job_function job, void* job_data)
+			{
+				static_cast<tbb_job_scheduler*>(user_data)->m_task_group.run([job, job_data]() { job(job_data); });
+			};
+			job_scheduler.wait_for_jobs = [](void* user_data) { static_cast<tbb_job_scheduler*>(user_data)->m_task_group.wait(); };
+			job_scheduler.user_data = this;
+			job_scheduler.max_num_jobs = static_cast<uint32_t>(tbb::this_task_arena::max_concurrency());
+			return job_scheduler;
+		}
+
+	private:
+		tbb::task_group		m_task_group;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
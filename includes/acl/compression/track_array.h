@@ -186,6 +186,14 @@ namespace acl
 		// the compressed size.
 		uint32_t get_raw_size() const;
 
+		//////////////////////////////////////////////////////////////////////////
+		// Returns a 64 bit hash of the track array content: its type, looping policy,
+		// sample rate, names, track descriptions, and every sample value.
+		// Only the components that are compressed are hashed (e.g. the W component of
+		// the translation and scale of QVV samples is ignored). The hash is stable across
+		// runs and platforms which makes it suitable to key a compression cache.
+		uint64_t get_content_hash() const;
+
 	protected:
 		//////////////////////////////////////////////////////////////////////////
 		// We prohibit copying
@@ -296,6 +304,11 @@ namespace acl
 	using track_array_vector4f	= track_array_typed<track_type8::vector4f>;
 	using track_array_qvvf		= track_array_typed<track_type8::qvvf>;
 
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the number of output tracks retained at the provided LOD, see 'track_desc_transformf::lod_level'.
+	// Since output tracks are sorted by LOD level, they are the first ones in output order.
+	uint32_t calculate_num_lod_tracks(const track_array_qvvf& track_list, uint32_t lod);
+
 	ACL_IMPL_VERSION_NAMESPACE_END
 }
 
@@ -29,6 +29,7 @@
 #include "acl/core/error_result.h"
 #include "acl/core/iallocator.h"
 #include "acl/core/impl/compiler_utils.h"
+#include "acl/compression/compression_settings.h"
 #include "acl/compression/track_array.h"
 #include "acl/compression/transform_error_metrics.h"
 #include "acl/decompression/decompress.h"
@@ -78,6 +79,20 @@ namespace acl
 	template<class decompression_context_type, acl_impl::is_decompression_context<decompression_context_type> = nullptr>
 	track_error calculate_compression_error(iallocator& allocator, const track_array& raw_tracks, decompression_context_type& context, const itransform_error_metric& error_metric);
 
+	//////////////////////////////////////////////////////////////////////////
+	// Calculates the worst compression error between a raw track array and its
+	// compressed tracks.
+	// Supports scalar and transform tracks.
+	// The sample times are split across jobs executed with the provided job scheduler.
+	// Each job decompresses with its own context of the same type, initialized with the
+	// same compressed tracks. The allocator must be thread safe when jobs are executed
+	// concurrently. Compressed tracks bound to a database are measured on the calling thread
+	// with the provided context.
+	//
+	// Note: This function uses SFINAE to prevent it from matching when it shouldn't.
+	template<class decompression_context_type, acl_impl::is_decompression_context<decompression_context_type> = nullptr>
+	track_error calculate_compression_error(iallocator& allocator, const track_array& raw_tracks, decompression_context_type& context, const itransform_error_metric& error_metric, const compression_job_scheduler& job_scheduler);
+
 	//////////////////////////////////////////////////////////////////////////
 	// Calculates the worst compression error between a raw track array and its
 	// compressed tracks.
@@ -87,6 +102,17 @@ namespace acl
 	template<class decompression_context_type, acl_impl::is_decompression_context<decompression_context_type> = nullptr>
 	track_error calculate_compression_error(iallocator& allocator, const track_array_qvvf& raw_tracks, decompression_context_type& context, const itransform_error_metric& error_metric, const track_array_qvvf& additive_base_tracks);
 
+	//////////////////////////////////////////////////////////////////////////
+	// Calculates the worst compression error between a raw track array and its
+	// compressed tracks.
+	// Supports transform tracks with an additive base.
+	// The sample times are split across jobs executed with the provided job scheduler.
+	// See above for details.
+	//
+	// Note: This function uses SFINAE to prevent it from matching when it shouldn't.
+	template<class decompression_context_type, acl_impl::is_decompression_context<decompression_context_type> = nullptr>
+	track_error calculate_compression_error(iallocator& allocator, const track_array_qvvf& raw_tracks, decompression_context_type& context, const itransform_error_metric& error_metric, const track_array_qvvf& additive_base_tracks, const compression_job_scheduler& job_scheduler);
+
 	//////////////////////////////////////////////////////////////////////////
 	// Calculates the worst compression error between two compressed tracks instances.
 	// Supports scalar tracks only.
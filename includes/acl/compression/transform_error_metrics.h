@@ -29,9 +29,14 @@
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/hash.h"
 
+#include <rtm/macros.h>
 #include <rtm/matrix3x4f.h>
 #include <rtm/qvvf.h>
 #include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+
+#include <cstddef>
+#include <cstdint>
 
 ACL_IMPL_FILE_PRAGMA_PUSH
 
@@ -73,6 +78,16 @@ namespace acl
 		// used by the error metric.
 		virtual bool needs_conversion(bool has_scale) const { (void)has_scale; return false; }
 
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the maximum number of transform pairs the bit rate search provides at once
+		// to 'calculate_error_batch*'. Error metrics that offload their work to another device
+		// (e.g. a GPU compute queue) can return a large value to amortize their dispatch cost:
+		// the search then provides up to a whole segment worth of samples in a single call.
+		// Errors are still processed in sample order and the compressed output is identical.
+		// Smaller values than the default batch size are ignored.
+		// Defaults to '0' (use the default batch size)
+		virtual uint32_t get_max_error_batch_size() const { return 0; }
+
 		//////////////////////////////////////////////////////////////////////////
 		// Input arguments for the 'convert_transforms*' functions.
 		//////////////////////////////////////////////////////////////////////////
@@ -271,8 +286,256 @@ namespace acl
 		//////////////////////////////////////////////////////////////////////////
 		// Measures the error between a raw and lossy transform.
 		virtual rtm::scalarf RTM_SIMD_CALL calculate_error_no_scale(const calculate_error_args& args) const = 0;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Input arguments for the 'calculate_error_batch*' functions.
+		// Every transform pair in a batch shares the same rigid shell.
+		//////////////////////////////////////////////////////////////////////////
+		struct calculate_error_batch_args
+		{
+			//////////////////////////////////////////////////////////////////////////
+			// A point on our rigid shell along the X axis.
+			rtm::vector4f shell_point_x;
+
+			//////////////////////////////////////////////////////////////////////////
+			// A point on our rigid shell along the Y axis.
+			rtm::vector4f shell_point_y;
+
+			//////////////////////////////////////////////////////////////////////////
+			// A point on our rigid shell along the Z axis.
+			rtm::vector4f shell_point_z;
+
+			//////////////////////////////////////////////////////////////////////////
+			// The first transforms used to measure the error.
+			// In the type expected by the error metric.
+			const void* transforms0;
+
+			//////////////////////////////////////////////////////////////////////////
+			// The second transforms used to measure the error.
+			// In the type expected by the error metric.
+			const void* transforms1;
+
+			//////////////////////////////////////////////////////////////////////////
+			// The number of bytes between two consecutive transforms in each array above.
+			size_t transforms0_stride;
+			size_t transforms1_stride;
+
+			//////////////////////////////////////////////////////////////////////////
+			// See calculate_error_args::construct_sphere_shell(..) for details.
+			void construct_sphere_shell(float shell_distance)
+			{
+				shell_point_x = rtm::vector_set(shell_distance, 0.0F, 0.0F, 0.0F);
+				shell_point_y = rtm::vector_set(0.0F, shell_distance, 0.0F, 0.0F);
+				shell_point_z = rtm::vector_set(0.0F, 0.0F, shell_distance, 0.0F);
+			}
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Measures the error between many raw and lossy transform pairs.
+		// One error per transform pair is written in the output.
+		// The default implementation calls 'calculate_error' for each pair, error metrics
+		// should override it with a vectorized version when possible.
+		virtual void calculate_error_batch(const calculate_error_batch_args& args, uint32_t num_transforms, float* out_errors) const
+		{
+			calculate_error_args pair_args;
+			pair_args.shell_point_x = args.shell_point_x;
+			pair_args.shell_point_y = args.shell_point_y;
+			pair_args.shell_point_z = args.shell_point_z;
+
+			const uint8_t* transforms0 = static_cast<const uint8_t*>(args.transforms0);
+			const uint8_t* transforms1 = static_cast<const uint8_t*>(args.transforms1);
+
+			for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+			{
+				pair_args.transform0 = transforms0 + (transform_index * args.transforms0_stride);
+				pair_args.transform1 = transforms1 + (transform_index * args.transforms1_stride);
+				out_errors[transform_index] = rtm::scalar_cast(calculate_error(pair_args));
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Measures the error between many raw and lossy transform pairs.
+		// See above for details.
+		virtual void calculate_error_batch_no_scale(const calculate_error_batch_args& args, uint32_t num_transforms, float* out_errors) const
+		{
+			calculate_error_args pair_args;
+			pair_args.shell_point_x = args.shell_point_x;
+			pair_args.shell_point_y = args.shell_point_y;
+			pair_args.shell_point_z = args.shell_point_z;
+
+			const uint8_t* transforms0 = static_cast<const uint8_t*>(args.transforms0);
+			const uint8_t* transforms1 = static_cast<const uint8_t*>(args.transforms1);
+
+			for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+			{
+				pair_args.transform0 = transforms0 + (transform_index * args.transforms0_stride);
+				pair_args.transform1 = transforms1 + (transform_index * args.transforms1_stride);
+				out_errors[transform_index] = rtm::scalar_cast(calculate_error_no_scale(pair_args));
+			}
+		}
 	};
 
+	namespace acl_impl
+	{
+		// Four points in SOA form
+		struct point3f4
+		{
+			rtm::vector4f xxxx;
+			rtm::vector4f yyyy;
+			rtm::vector4f zzzz;
+		};
+
+		// Four rtm::qvvf transforms in SOA form
+		struct qvvf4
+		{
+			rtm::vector4f rotation_xxxx;
+			rtm::vector4f rotation_yyyy;
+			rtm::vector4f rotation_zzzz;
+			rtm::vector4f rotation_wwww;
+			point3f4 translation;
+			point3f4 scale;
+		};
+
+		// Four rtm::matrix3x4f transforms in SOA form
+		struct matrix3x4f4
+		{
+			point3f4 x_axis;
+			point3f4 y_axis;
+			point3f4 z_axis;
+			point3f4 w_axis;
+		};
+
+		// Loads up to 4 transforms, missing transforms are padded with the last one
+		template<typename transform_type>
+		RTM_FORCE_INLINE const transform_type& get_batch_transform(const uint8_t* transforms, size_t stride, uint32_t transform_index, uint32_t num_transforms)
+		{
+			const uint32_t safe_transform_index = transform_index < num_transforms ? transform_index : (num_transforms - 1);
+			return *reinterpret_cast<const transform_type*>(transforms + (safe_transform_index * stride));
+		}
+
+		RTM_FORCE_INLINE void RTM_SIMD_CALL transpose_point3f4(rtm::vector4f_arg0 input0, rtm::vector4f_arg1 input1, rtm::vector4f_arg2 input2, rtm::vector4f_arg3 input3, point3f4& output)
+		{
+			rtm::vector4f wwww;
+			RTM_MATRIXF_TRANSPOSE_4X4(input0, input1, input2, input3, output.xxxx, output.yyyy, output.zzzz, wwww);
+			(void)wwww;
+		}
+
+		inline void load_qvvf4(const uint8_t* transforms, size_t stride, uint32_t first_transform_index, uint32_t num_transforms, qvvf4& out_transforms)
+		{
+			const rtm::qvvf& transform0 = get_batch_transform<rtm::qvvf>(transforms, stride, first_transform_index + 0, num_transforms);
+			const rtm::qvvf& transform1 = get_batch_transform<rtm::qvvf>(transforms, stride, first_transform_index + 1, num_transforms);
+			const rtm::qvvf& transform2 = get_batch_transform<rtm::qvvf>(transforms, stride, first_transform_index + 2, num_transforms);
+			const rtm::qvvf& transform3 = get_batch_transform<rtm::qvvf>(transforms, stride, first_transform_index + 3, num_transforms);
+
+			const rtm::vector4f rotation0 = rtm::quat_to_vector(transform0.rotation);
+			const rtm::vector4f rotation1 = rtm::quat_to_vector(transform1.rotation);
+			const rtm::vector4f rotation2 = rtm::quat_to_vector(transform2.rotation);
+			const rtm::vector4f rotation3 = rtm::quat_to_vector(transform3.rotation);
+			RTM_MATRIXF_TRANSPOSE_4X4(rotation0, rotation1, rotation2, rotation3, out_transforms.rotation_xxxx, out_transforms.rotation_yyyy, out_transforms.rotation_zzzz, out_transforms.rotation_wwww);
+
+			transpose_point3f4(transform0.translation, transform1.translation, transform2.translation, transform3.translation, out_transforms.translation);
+			transpose_point3f4(transform0.scale, transform1.scale, transform2.scale, transform3.scale, out_transforms.scale);
+		}
+
+		inline void load_matrix3x4f4(const uint8_t* transforms, size_t stride, uint32_t first_transform_index, uint32_t num_transforms, matrix3x4f4& out_transforms)
+		{
+			const rtm::matrix3x4f& transform0 = get_batch_transform<rtm::matrix3x4f>(transforms, stride, first_transform_index + 0, num_transforms);
+			const rtm::matrix3x4f& transform1 = get_batch_transform<rtm::matrix3x4f>(transforms, stride, first_transform_index + 1, num_transforms);
+			const rtm::matrix3x4f& transform2 = get_batch_transform<rtm::matrix3x4f>(transforms, stride, first_transform_index + 2, num_transforms);
+			const rtm::matrix3x4f& transform3 = get_batch_transform<rtm::matrix3x4f>(transforms, stride, first_transform_index + 3, num_transforms);
+
+			transpose_point3f4(transform0.x_axis, transform1.x_axis, transform2.x_axis, transform3.x_axis, out_transforms.x_axis);
+			transpose_point3f4(transform0.y_axis, transform1.y_axis, transform2.y_axis, transform3.y_axis, out_transforms.y_axis);
+			transpose_point3f4(transform0.z_axis, transform1.z_axis, transform2.z_axis, transform3.z_axis, out_transforms.z_axis);
+			transpose_point3f4(transform0.w_axis, transform1.w_axis, transform2.w_axis, transform3.w_axis, out_transforms.w_axis);
+		}
+
+		// The shell point is the same for every lane
+		inline point3f4 RTM_SIMD_CALL broadcast_point3f4(rtm::vector4f_arg0 point)
+		{
+			point3f4 result;
+			result.xxxx = rtm::vector_dup_x(point);
+			result.yyyy = rtm::vector_dup_y(point);
+			result.zzzz = rtm::vector_dup_z(point);
+			return result;
+		}
+
+		// Rotates with: v' = v + w * t + cross(q.xyz, t) where t = 2 * cross(q.xyz, v)
+		RTM_FORCE_INLINE point3f4 quat_mul_point3f4(const point3f4& point, const qvvf4& transforms)
+		{
+			const rtm::vector4f two = rtm::vector_set(2.0F);
+
+			const rtm::vector4f t_xxxx = rtm::vector_mul(two, rtm::vector_neg_mul_sub(transforms.rotation_zzzz, point.yyyy, rtm::vector_mul(transforms.rotation_yyyy, point.zzzz)));
+			const rtm::vector4f t_yyyy = rtm::vector_mul(two, rtm::vector_neg_mul_sub(transforms.rotation_xxxx, point.zzzz, rtm::vector_mul(transforms.rotation_zzzz, point.xxxx)));
+			const rtm::vector4f t_zzzz = rtm::vector_mul(two, rtm::vector_neg_mul_sub(transforms.rotation_yyyy, point.xxxx, rtm::vector_mul(transforms.rotation_xxxx, point.yyyy)));
+
+			const rtm::vector4f cross_xxxx = rtm::vector_neg_mul_sub(transforms.rotation_zzzz, t_yyyy, rtm::vector_mul(transforms.rotation_yyyy, t_zzzz));
+			const rtm::vector4f cross_yyyy = rtm::vector_neg_mul_sub(transforms.rotation_xxxx, t_zzzz, rtm::vector_mul(transforms.rotation_zzzz, t_xxxx));
+			const rtm::vector4f cross_zzzz = rtm::vector_neg_mul_sub(transforms.rotation_yyyy, t_xxxx, rtm::vector_mul(transforms.rotation_xxxx, t_yyyy));
+
+			point3f4 result;
+			result.xxxx = rtm::vector_add(rtm::vector_mul_add(transforms.rotation_wwww, t_xxxx, point.xxxx), cross_xxxx);
+			result.yyyy = rtm::vector_add(rtm::vector_mul_add(transforms.rotation_wwww, t_yyyy, point.yyyy), cross_yyyy);
+			result.zzzz = rtm::vector_add(rtm::vector_mul_add(transforms.rotation_wwww, t_zzzz, point.zzzz), cross_zzzz);
+			return result;
+		}
+
+		RTM_FORCE_INLINE point3f4 qvv_mul_point3f4(const point3f4& point, const qvvf4& transforms)
+		{
+			point3f4 scaled_point;
+			scaled_point.xxxx = rtm::vector_mul(point.xxxx, transforms.scale.xxxx);
+			scaled_point.yyyy = rtm::vector_mul(point.yyyy, transforms.scale.yyyy);
+			scaled_point.zzzz = rtm::vector_mul(point.zzzz, transforms.scale.zzzz);
+
+			point3f4 result = quat_mul_point3f4(scaled_point, transforms);
+			result.xxxx = rtm::vector_add(result.xxxx, transforms.translation.xxxx);
+			result.yyyy = rtm::vector_add(result.yyyy, transforms.translation.yyyy);
+			result.zzzz = rtm::vector_add(result.zzzz, transforms.translation.zzzz);
+			return result;
+		}
+
+		RTM_FORCE_INLINE point3f4 qvv_mul_point3f4_no_scale(const point3f4& point, const qvvf4& transforms)
+		{
+			point3f4 result = quat_mul_point3f4(point, transforms);
+			result.xxxx = rtm::vector_add(result.xxxx, transforms.translation.xxxx);
+			result.yyyy = rtm::vector_add(result.yyyy, transforms.translation.yyyy);
+			result.zzzz = rtm::vector_add(result.zzzz, transforms.translation.zzzz);
+			return result;
+		}
+
+		RTM_FORCE_INLINE point3f4 matrix_mul_point3f4(const point3f4& point, const matrix3x4f4& transforms)
+		{
+			point3f4 result;
+			result.xxxx = rtm::vector_mul_add(transforms.z_axis.xxxx, point.zzzz, rtm::vector_mul_add(transforms.y_axis.xxxx, point.yyyy, rtm::vector_mul_add(transforms.x_axis.xxxx, point.xxxx, transforms.w_axis.xxxx)));
+			result.yyyy = rtm::vector_mul_add(transforms.z_axis.yyyy, point.zzzz, rtm::vector_mul_add(transforms.y_axis.yyyy, point.yyyy, rtm::vector_mul_add(transforms.x_axis.yyyy, point.xxxx, transforms.w_axis.yyyy)));
+			result.zzzz = rtm::vector_mul_add(transforms.z_axis.zzzz, point.zzzz, rtm::vector_mul_add(transforms.y_axis.zzzz, point.yyyy, rtm::vector_mul_add(transforms.x_axis.zzzz, point.xxxx, transforms.w_axis.zzzz)));
+			return result;
+		}
+
+		RTM_FORCE_INLINE rtm::vector4f point3f4_distance(const point3f4& lhs, const point3f4& rhs)
+		{
+			const rtm::vector4f delta_xxxx = rtm::vector_sub(lhs.xxxx, rhs.xxxx);
+			const rtm::vector4f delta_yyyy = rtm::vector_sub(lhs.yyyy, rhs.yyyy);
+			const rtm::vector4f delta_zzzz = rtm::vector_sub(lhs.zzzz, rhs.zzzz);
+			return rtm::vector_sqrt(rtm::vector_mul_add(delta_zzzz, delta_zzzz, rtm::vector_mul_add(delta_yyyy, delta_yyyy, rtm::vector_mul(delta_xxxx, delta_xxxx))));
+		}
+
+		// Writes up to 4 errors
+		RTM_FORCE_INLINE void RTM_SIMD_CALL store_batch_errors(rtm::vector4f_arg0 errors, uint32_t first_transform_index, uint32_t num_transforms, float* out_errors)
+		{
+			if (first_transform_index + 4 <= num_transforms)
+				rtm::vector_store(errors, out_errors + first_transform_index);
+			else
+			{
+				float errors_[4];
+				rtm::vector_store(errors, &errors_[0]);
+
+				for (uint32_t transform_index = first_transform_index; transform_index < num_transforms; ++transform_index)
+					out_errors[transform_index] = errors_[transform_index - first_transform_index];
+			}
+		}
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Uses rtm::qvvf arithmetic for local and object space error.
 	// Note that this can cause inaccuracy when dealing with shear/skew.
@@ -375,6 +638,57 @@ namespace acl
 
 			return rtm::scalar_max(vtx0_error, vtx1_error);
 		}
+
+		virtual RTM_DISABLE_SECURITY_COOKIE_CHECK void calculate_error_batch(const calculate_error_batch_args& args, uint32_t num_transforms, float* out_errors) const override
+		{
+			const uint8_t* raw_transforms = static_cast<const uint8_t*>(args.transforms0);
+			const uint8_t* lossy_transforms = static_cast<const uint8_t*>(args.transforms1);
+
+			// Note that because we have scale, we must measure all three axes
+			const acl_impl::point3f4 vtx0 = acl_impl::broadcast_point3f4(args.shell_point_x);
+			const acl_impl::point3f4 vtx1 = acl_impl::broadcast_point3f4(args.shell_point_y);
+			const acl_impl::point3f4 vtx2 = acl_impl::broadcast_point3f4(args.shell_point_z);
+
+			// We process 4 transform pairs at a time
+			for (uint32_t transform_index = 0; transform_index < num_transforms; transform_index += 4)
+			{
+				acl_impl::qvvf4 raw_transforms_;
+				acl_impl::qvvf4 lossy_transforms_;
+				acl_impl::load_qvvf4(raw_transforms, args.transforms0_stride, transform_index, num_transforms, raw_transforms_);
+				acl_impl::load_qvvf4(lossy_transforms, args.transforms1_stride, transform_index, num_transforms, lossy_transforms_);
+
+				const rtm::vector4f vtx0_error = acl_impl::point3f4_distance(acl_impl::qvv_mul_point3f4(vtx0, raw_transforms_), acl_impl::qvv_mul_point3f4(vtx0, lossy_transforms_));
+				const rtm::vector4f vtx1_error = acl_impl::point3f4_distance(acl_impl::qvv_mul_point3f4(vtx1, raw_transforms_), acl_impl::qvv_mul_point3f4(vtx1, lossy_transforms_));
+				const rtm::vector4f vtx2_error = acl_impl::point3f4_distance(acl_impl::qvv_mul_point3f4(vtx2, raw_transforms_), acl_impl::qvv_mul_point3f4(vtx2, lossy_transforms_));
+
+				const rtm::vector4f errors = rtm::vector_max(rtm::vector_max(vtx0_error, vtx1_error), vtx2_error);
+				acl_impl::store_batch_errors(errors, transform_index, num_transforms, out_errors);
+			}
+		}
+
+		virtual RTM_DISABLE_SECURITY_COOKIE_CHECK void calculate_error_batch_no_scale(const calculate_error_batch_args& args, uint32_t num_transforms, float* out_errors) const override
+		{
+			const uint8_t* raw_transforms = static_cast<const uint8_t*>(args.transforms0);
+			const uint8_t* lossy_transforms = static_cast<const uint8_t*>(args.transforms1);
+
+			const acl_impl::point3f4 vtx0 = acl_impl::broadcast_point3f4(args.shell_point_x);
+			const acl_impl::point3f4 vtx1 = acl_impl::broadcast_point3f4(args.shell_point_y);
+
+			// We process 4 transform pairs at a time
+			for (uint32_t transform_index = 0; transform_index < num_transforms; transform_index += 4)
+			{
+				acl_impl::qvvf4 raw_transforms_;
+				acl_impl::qvvf4 lossy_transforms_;
+				acl_impl::load_qvvf4(raw_transforms, args.transforms0_stride, transform_index, num_transforms, raw_transforms_);
+				acl_impl::load_qvvf4(lossy_transforms, args.transforms1_stride, transform_index, num_transforms, lossy_transforms_);
+
+				const rtm::vector4f vtx0_error = acl_impl::point3f4_distance(acl_impl::qvv_mul_point3f4_no_scale(vtx0, raw_transforms_), acl_impl::qvv_mul_point3f4_no_scale(vtx0, lossy_transforms_));
+				const rtm::vector4f vtx1_error = acl_impl::point3f4_distance(acl_impl::qvv_mul_point3f4_no_scale(vtx1, raw_transforms_), acl_impl::qvv_mul_point3f4_no_scale(vtx1, lossy_transforms_));
+
+				const rtm::vector4f errors = rtm::vector_max(vtx0_error, vtx1_error);
+				acl_impl::store_batch_errors(errors, transform_index, num_transforms, out_errors);
+			}
+		}
 	};
 
 	//////////////////////////////////////////////////////////////////////////
@@ -458,6 +772,33 @@ namespace acl
 
 			return rtm::scalar_max(rtm::scalar_max(vtx0_error, vtx1_error), vtx2_error);
 		}
+
+		virtual RTM_DISABLE_SECURITY_COOKIE_CHECK void calculate_error_batch(const calculate_error_batch_args& args, uint32_t num_transforms, float* out_errors) const override
+		{
+			const uint8_t* raw_transforms = static_cast<const uint8_t*>(args.transforms0);
+			const uint8_t* lossy_transforms = static_cast<const uint8_t*>(args.transforms1);
+
+			// Note that because we have scale, we must measure all three axes
+			const acl_impl::point3f4 vtx0 = acl_impl::broadcast_point3f4(args.shell_point_x);
+			const acl_impl::point3f4 vtx1 = acl_impl::broadcast_point3f4(args.shell_point_y);
+			const acl_impl::point3f4 vtx2 = acl_impl::broadcast_point3f4(args.shell_point_z);
+
+			// We process 4 transform pairs at a time
+			for (uint32_t transform_index = 0; transform_index < num_transforms; transform_index += 4)
+			{
+				acl_impl::matrix3x4f4 raw_transforms_;
+				acl_impl::matrix3x4f4 lossy_transforms_;
+				acl_impl::load_matrix3x4f4(raw_transforms, args.transforms0_stride, transform_index, num_transforms, raw_transforms_);
+				acl_impl::load_matrix3x4f4(lossy_transforms, args.transforms1_stride, transform_index, num_transforms, lossy_transforms_);
+
+				const rtm::vector4f vtx0_error = acl_impl::point3f4_distance(acl_impl::matrix_mul_point3f4(vtx0, raw_transforms_), acl_impl::matrix_mul_point3f4(vtx0, lossy_transforms_));
+				const rtm::vector4f vtx1_error = acl_impl::point3f4_distance(acl_impl::matrix_mul_point3f4(vtx1, raw_transforms_), acl_impl::matrix_mul_point3f4(vtx1, lossy_transforms_));
+				const rtm::vector4f vtx2_error = acl_impl::point3f4_distance(acl_impl::matrix_mul_point3f4(vtx2, raw_transforms_), acl_impl::matrix_mul_point3f4(vtx2, lossy_transforms_));
+
+				const rtm::vector4f errors = rtm::vector_max(rtm::vector_max(vtx0_error, vtx1_error), vtx2_error);
+				acl_impl::store_batch_errors(errors, transform_index, num_transforms, out_errors);
+			}
+		}
 	};
 
 	//////////////////////////////////////////////////////////////////////////
@@ -126,19 +126,52 @@ namespace acl
 		return false;
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Per sub-track variants of 'apply_additive_to_base'.
+	// They allow the additive to be applied one sub-track at a time, as it is decompressed.
+
+	inline rtm::quatf RTM_SIMD_CALL apply_additive_rotation_to_base(additive_clip_format8 additive_format, rtm::quatf_arg0 base_rotation, rtm::quatf_arg1 additive_rotation)
+	{
+		return additive_format == additive_clip_format8::none ? additive_rotation : rtm::quat_mul(additive_rotation, base_rotation);
+	}
+
+	inline rtm::vector4f RTM_SIMD_CALL apply_additive_translation_to_base(additive_clip_format8 additive_format, rtm::qvvf_arg0 base, rtm::vector4f_arg1 additive_translation)
+	{
+		switch (additive_format)
+		{
+		default:
+		case additive_clip_format8::none:			return additive_translation;
+		case additive_clip_format8::relative:		return rtm::vector_add(rtm::quat_mul_vector3(rtm::vector_mul(additive_translation, base.scale), base.rotation), base.translation);
+		case additive_clip_format8::additive0:
+		case additive_clip_format8::additive1:		return rtm::vector_add(additive_translation, base.translation);
+		}
+	}
+
+	inline rtm::vector4f RTM_SIMD_CALL apply_additive_scale_to_base(additive_clip_format8 additive_format, rtm::vector4f_arg0 base_scale, rtm::vector4f_arg1 additive_scale)
+	{
+		switch (additive_format)
+		{
+		default:
+		case additive_clip_format8::none:			return additive_scale;
+		case additive_clip_format8::relative:
+		case additive_clip_format8::additive0:		return rtm::vector_mul(additive_scale, base_scale);
+		case additive_clip_format8::additive1:		return rtm::vector_mul(rtm::vector_add(rtm::vector_set(1.0F), additive_scale), base_scale);
+		}
+	}
+
 	inline rtm::qvvf RTM_SIMD_CALL transform_add0(rtm::qvvf_arg0 base, rtm::qvvf_arg1 additive)
 	{
-		const rtm::quatf rotation = rtm::quat_mul(additive.rotation, base.rotation);
-		const rtm::vector4f translation = rtm::vector_add(additive.translation, base.translation);
-		const rtm::vector4f scale = rtm::vector_mul(additive.scale, base.scale);
+		const rtm::quatf rotation = apply_additive_rotation_to_base(additive_clip_format8::additive0, base.rotation, additive.rotation);
+		const rtm::vector4f translation = apply_additive_translation_to_base(additive_clip_format8::additive0, base, additive.translation);
+		const rtm::vector4f scale = apply_additive_scale_to_base(additive_clip_format8::additive0, base.scale, additive.scale);
 		return rtm::qvv_set(rotation, translation, scale);
 	}
 
 	inline rtm::qvvf RTM_SIMD_CALL transform_add1(rtm::qvvf_arg0 base, rtm::qvvf_arg1 additive)
 	{
-		const rtm::quatf rotation = rtm::quat_mul(additive.rotation, base.rotation);
-		const rtm::vector4f translation = rtm::vector_add(additive.translation, base.translation);
-		const rtm::vector4f scale = rtm::vector_mul(rtm::vector_add(rtm::vector_set(1.0F), additive.scale), base.scale);
+		const rtm::quatf rotation = apply_additive_rotation_to_base(additive_clip_format8::additive1, base.rotation, additive.rotation);
+		const rtm::vector4f translation = apply_additive_translation_to_base(additive_clip_format8::additive1, base, additive.translation);
+		const rtm::vector4f scale = apply_additive_scale_to_base(additive_clip_format8::additive1, base.scale, additive.scale);
 		return rtm::qvv_set(rotation, translation, scale);
 	}
 
@@ -29,6 +29,7 @@
 #include "acl/core/error.h"
 #include "acl/core/bit_manip_utils.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <limits>
 
@@ -119,6 +120,204 @@ namespace acl
 		uint32_t mask;
 	};
 
+	////////////////////////////////////////////////////////////////////////////////
+	// The index returned when a bit search fails.
+	constexpr uint32_t k_invalid_bit_index = 0xFFFFFFFFU;
+
+	namespace acl_impl
+	{
+		////////////////////////////////////////////////////////////////////////////////
+		// Returns the mask of the bits within [start_bit_index, end_bit_index) of a word.
+		// Bits are stored from the MSB, bit 0 is 0x80000000.
+		inline uint32_t get_bitset_word_mask(uint32_t start_bit_index, uint32_t end_bit_index)
+		{
+			ACL_ASSERT(start_bit_index < end_bit_index && end_bit_index <= 32, "Invalid word bit range: [%u, %u)", start_bit_index, end_bit_index);
+
+			const uint32_t start_mask = 0xFFFFFFFFU >> start_bit_index;
+			const uint32_t end_mask = end_bit_index == 32 ? 0xFFFFFFFFU : ~(0xFFFFFFFFU >> end_bit_index);
+			return start_mask & end_mask;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Counts the number of set bits within [first_offset, last_offset) words.
+		inline uint32_t bitset_count_set_bits_in_words(const uint32_t* bitset, uint32_t first_offset, uint32_t last_offset)
+		{
+			uint32_t offset = first_offset;
+			uint32_t num_set_bits = 0;
+
+#if defined(RTM_NEON_INTRINSICS)
+			// Count the bits of every byte and accumulate them with pairwise adds
+			// Each lane can accumulate up to 2^32 bits, we'll never reach that many
+			uint32x4_t num_set_bits_v = vdupq_n_u32(0);
+			for (; offset + 4 <= last_offset; offset += 4)
+			{
+				const uint8x16_t words = vreinterpretq_u8_u32(vld1q_u32(bitset + offset));
+				num_set_bits_v = vaddq_u32(num_set_bits_v, vpaddlq_u16(vpaddlq_u8(vcntq_u8(words))));
+			}
+
+			const uint32x2_t num_set_bits_v2 = vadd_u32(vget_low_u32(num_set_bits_v), vget_high_u32(num_set_bits_v));
+			num_set_bits += vget_lane_u32(vpadd_u32(num_set_bits_v2, num_set_bits_v2), 0);
+#else
+			// Process two words at a time with a 64 bit pop-count
+			for (; offset + 2 <= last_offset; offset += 2)
+			{
+				const uint64_t words = (uint64_t(bitset[offset + 0]) << 32) | uint64_t(bitset[offset + 1]);
+				num_set_bits += uint32_t(count_set_bits(words));
+			}
+#endif
+
+			for (; offset < last_offset; ++offset)
+				num_set_bits += count_set_bits(bitset[offset]);
+
+			return num_set_bits;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Returns the index of the first word that isn't equal to the provided value within [first_offset, last_offset).
+		// Returns last_offset if every word matches.
+		inline uint32_t bitset_skip_words(const uint32_t* bitset, uint32_t first_offset, uint32_t last_offset, uint32_t skip_value)
+		{
+			uint32_t offset = first_offset;
+
+#if defined(RTM_SSE2_INTRINSICS)
+			const __m128i skip_value_v = _mm_set1_epi32(static_cast<int>(skip_value));
+			for (; offset + 4 <= last_offset; offset += 4)
+			{
+				const __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bitset + offset));
+				if (_mm_movemask_epi8(_mm_cmpeq_epi32(words, skip_value_v)) != 0xFFFF)
+					break;
+			}
+#elif defined(RTM_NEON_INTRINSICS)
+			const uint32x4_t skip_value_v = vdupq_n_u32(skip_value);
+			for (; offset + 4 <= last_offset; offset += 4)
+			{
+				// Lanes that match are all ones, combine them to test if every lane matched
+				const uint32x4_t is_equal = vceqq_u32(vld1q_u32(bitset + offset), skip_value_v);
+				const uint32x2_t is_equal2 = vand_u32(vget_low_u32(is_equal), vget_high_u32(is_equal));
+				if ((vget_lane_u32(is_equal2, 0) & vget_lane_u32(is_equal2, 1)) != 0xFFFFFFFFU)
+					break;
+			}
+#endif
+
+			for (; offset < last_offset; ++offset)
+			{
+				if (bitset[offset] != skip_value)
+					break;
+			}
+
+			return offset;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Returns the index of the first bit that doesn't match the skip value, starting at the provided index.
+		// Returns k_invalid_bit_index if none are found.
+		inline uint32_t bitset_find_next_bit(const uint32_t* bitset, bitset_description desc, uint32_t start_bit_index, uint32_t skip_value)
+		{
+			ACL_ASSERT(start_bit_index <= desc.get_num_bits(), "Invalid start bit index: %d", start_bit_index);
+
+			const uint32_t size = desc.get_size();
+			uint32_t offset = start_bit_index / 32;
+			if (offset >= size)
+				return k_invalid_bit_index;
+
+			// Flip the words such that the bits we search for are set, and ignore the bits before our start index
+			uint32_t word = (bitset[offset] ^ skip_value) & (0xFFFFFFFFU >> (start_bit_index % 32));
+			if (word == 0)
+			{
+				offset = bitset_skip_words(bitset, offset + 1, size, skip_value);
+				if (offset >= size)
+					return k_invalid_bit_index;
+
+				word = bitset[offset] ^ skip_value;
+			}
+
+			return (offset * 32) + count_leading_zeros(word);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Returns the index of the Nth set bit within a word where N is zero based and smaller than the number of set bits.
+		inline uint32_t select_set_bit(uint32_t word, uint32_t rank)
+		{
+			ACL_ASSERT(rank < count_set_bits(word), "Invalid rank: %u", rank);
+
+			// Binary search, our upper bits are the lower indices
+			uint32_t bit_index = 0;
+			for (uint32_t width = 16; width != 0; width /= 2)
+			{
+				const uint32_t upper_num_set_bits = count_set_bits(uint32_t(word >> (32 - width)));
+				if (rank >= upper_num_set_bits)
+				{
+					rank -= upper_num_set_bits;
+					bit_index += width;
+					word <<= width;
+				}
+			}
+
+			return bit_index;
+		}
+
+#if defined(RTM_SSE2_INTRINSICS)
+		using bitset_words_v = __m128i;
+#elif defined(RTM_NEON_INTRINSICS)
+		using bitset_words_v = uint32x4_t;
+#endif
+
+		struct bitset_and_op
+		{
+			uint32_t operator()(uint32_t lhs, uint32_t rhs) const { return lhs & rhs; }
+#if defined(RTM_SSE2_INTRINSICS)
+			bitset_words_v operator()(bitset_words_v lhs, bitset_words_v rhs) const { return _mm_and_si128(lhs, rhs); }
+#elif defined(RTM_NEON_INTRINSICS)
+			bitset_words_v operator()(bitset_words_v lhs, bitset_words_v rhs) const { return vandq_u32(lhs, rhs); }
+#endif
+		};
+
+		struct bitset_or_op
+		{
+			uint32_t operator()(uint32_t lhs, uint32_t rhs) const { return lhs | rhs; }
+#if defined(RTM_SSE2_INTRINSICS)
+			bitset_words_v operator()(bitset_words_v lhs, bitset_words_v rhs) const { return _mm_or_si128(lhs, rhs); }
+#elif defined(RTM_NEON_INTRINSICS)
+			bitset_words_v operator()(bitset_words_v lhs, bitset_words_v rhs) const { return vorrq_u32(lhs, rhs); }
+#endif
+		};
+
+		struct bitset_and_not_op
+		{
+			uint32_t operator()(uint32_t not_value, uint32_t and_value) const { return and_not(not_value, and_value); }
+#if defined(RTM_SSE2_INTRINSICS)
+			bitset_words_v operator()(bitset_words_v not_value, bitset_words_v and_value) const { return _mm_andnot_si128(not_value, and_value); }
+#elif defined(RTM_NEON_INTRINSICS)
+			bitset_words_v operator()(bitset_words_v not_value, bitset_words_v and_value) const { return vbicq_u32(and_value, not_value); }
+#endif
+		};
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Applies a binary operation on every word, 4 words at a time when SIMD is available.
+		// Bit sets can alias since every word is read before it is written.
+		template<class op_type>
+		inline void bitset_binary_op(uint32_t* bitset_result, const uint32_t* bitset_lhs, const uint32_t* bitset_rhs, bitset_description desc, op_type op)
+		{
+			const uint32_t size = desc.get_size();
+			uint32_t offset = 0;
+
+#if defined(RTM_SSE2_INTRINSICS)
+			for (; offset + 4 <= size; offset += 4)
+			{
+				const __m128i lhs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bitset_lhs + offset));
+				const __m128i rhs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bitset_rhs + offset));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(bitset_result + offset), op(lhs, rhs));
+			}
+#elif defined(RTM_NEON_INTRINSICS)
+			for (; offset + 4 <= size; offset += 4)
+				vst1q_u32(bitset_result + offset, op(vld1q_u32(bitset_lhs + offset), vld1q_u32(bitset_rhs + offset)));
+#endif
+
+			for (; offset < size; ++offset)
+				bitset_result[offset] = op(bitset_lhs[offset], bitset_rhs[offset]);
+		}
+	}
+
 	////////////////////////////////////////////////////////////////////////////////
 	// Resets the entire bit set to the provided value.
 	inline void bitset_reset(uint32_t* bitset, bitset_description desc, bool value)
@@ -162,10 +361,27 @@ namespace acl
 	{
 		ACL_ASSERT(desc.is_bit_index_valid(start_bit_index), "Invalid start bit index: %d", start_bit_index);
 		ACL_ASSERT(start_bit_index + num_bits <= desc.get_num_bits(), "Invalid num bits: %d > %d", start_bit_index + num_bits, desc.get_num_bits());
+		(void)desc;
+
+		if (num_bits == 0)
+			return;
 
-		const uint32_t end_bit_offset = start_bit_index + num_bits;
-		for (uint32_t offset = start_bit_index; offset < end_bit_offset; ++offset)
-			bitset_set(bitset, desc, offset, value);
+		const uint32_t end_bit_index = start_bit_index + num_bits;
+		const uint32_t first_offset = start_bit_index / 32;
+		const uint32_t last_offset = (end_bit_index - 1) / 32;
+
+		for (uint32_t offset = first_offset; offset <= last_offset; ++offset)
+		{
+			// Whole words use a full mask, only the first and last words are partial
+			const uint32_t word_start_bit_index = offset == first_offset ? (start_bit_index % 32) : 0;
+			const uint32_t word_end_bit_index = offset == last_offset ? (end_bit_index - (offset * 32)) : 32;
+			const uint32_t mask = acl_impl::get_bitset_word_mask(word_start_bit_index, word_end_bit_index);
+
+			if (value)
+				bitset[offset] |= mask;
+			else
+				bitset[offset] &= ~mask;
+		}
 	}
 
 	////////////////////////////////////////////////////////////////////////////////
@@ -192,27 +408,170 @@ namespace acl
 	// Counts the total number of set (true) bits within the bit set.
 	inline uint32_t bitset_count_set_bits(const uint32_t* bitset, bitset_description desc)
 	{
-		const uint32_t size = desc.get_size();
+		return acl_impl::bitset_count_set_bits_in_words(bitset, 0, desc.get_size());
+	}
 
-		// TODO: Optimize for NEON by using the intrinsic directly and unrolling the loop to
-		// reduce the number of pairwise add instructions.
-		uint32_t num_set_bits = 0;
-		for (uint32_t offset = 0; offset < size; ++offset)
-			num_set_bits += count_set_bits(bitset[offset]);
+	////////////////////////////////////////////////////////////////////////////////
+	// Counts the number of set (true) bits within the specified range of bits.
+	inline uint32_t bitset_count_set_bits(const uint32_t* bitset, bitset_description desc, uint32_t start_bit_index, uint32_t num_bits)
+	{
+		ACL_ASSERT(start_bit_index + num_bits <= desc.get_num_bits(), "Invalid num bits: %d > %d", start_bit_index + num_bits, desc.get_num_bits());
+		(void)desc;
+
+		if (num_bits == 0)
+			return 0;
 
+		const uint32_t end_bit_index = start_bit_index + num_bits;
+		const uint32_t first_offset = start_bit_index / 32;
+		const uint32_t last_offset = (end_bit_index - 1) / 32;
+
+		if (first_offset == last_offset)
+			return count_set_bits(uint32_t(bitset[first_offset] & acl_impl::get_bitset_word_mask(start_bit_index % 32, end_bit_index - (first_offset * 32))));
+
+		uint32_t num_set_bits = count_set_bits(uint32_t(bitset[first_offset] & acl_impl::get_bitset_word_mask(start_bit_index % 32, 32)));
+		num_set_bits += acl_impl::bitset_count_set_bits_in_words(bitset, first_offset + 1, last_offset);
+		num_set_bits += count_set_bits(uint32_t(bitset[last_offset] & acl_impl::get_bitset_word_mask(0, end_bit_index - (last_offset * 32))));
 		return num_set_bits;
 	}
 
+	////////////////////////////////////////////////////////////////////////////////
+	// Returns the index of the first set (true) bit at or after the provided start index.
+	// Returns k_invalid_bit_index if none are found.
+	inline uint32_t bitset_find_next_set_bit(const uint32_t* bitset, bitset_description desc, uint32_t start_bit_index)
+	{
+		return acl_impl::bitset_find_next_bit(bitset, desc, start_bit_index, 0x00000000U);
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Returns the index of the first clear (false) bit at or after the provided start index.
+	// Returns k_invalid_bit_index if none are found.
+	inline uint32_t bitset_find_next_clear_bit(const uint32_t* bitset, bitset_description desc, uint32_t start_bit_index)
+	{
+		return acl_impl::bitset_find_next_bit(bitset, desc, start_bit_index, 0xFFFFFFFFU);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Performs the operation: result = lhs & rhs
+	// Bit sets must have the same description
+	// Bit sets can alias
+	inline void bitset_and(uint32_t* bitset_result, const uint32_t* bitset_lhs, const uint32_t* bitset_rhs, bitset_description desc)
+	{
+		acl_impl::bitset_binary_op(bitset_result, bitset_lhs, bitset_rhs, desc, acl_impl::bitset_and_op());
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Performs the operation: result = lhs | rhs
+	// Bit sets must have the same description
+	// Bit sets can alias
+	inline void bitset_or(uint32_t* bitset_result, const uint32_t* bitset_lhs, const uint32_t* bitset_rhs, bitset_description desc)
+	{
+		acl_impl::bitset_binary_op(bitset_result, bitset_lhs, bitset_rhs, desc, acl_impl::bitset_or_op());
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Performs the operation: result = ~not_value & and_value
 	// Bit sets must have the same description
 	// Bit sets can alias
 	inline void bitset_and_not(uint32_t* bitset_result, const uint32_t* bitset_not_value, const uint32_t* bitset_and_value, bitset_description desc)
+	{
+		acl_impl::bitset_binary_op(bitset_result, bitset_not_value, bitset_and_value, desc, acl_impl::bitset_and_not_op());
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Rank and select queries
+	//
+	// A rank table caches the number of set bits that precede every block of 256 bits.
+	// With it, rank queries (how many bits are set before an index) only need to count
+	// the bits of a single block and select queries (where is the Nth set bit) can
+	// binary search the blocks. The table must be rebuilt when the bit set changes.
+	////////////////////////////////////////////////////////////////////////////////
+
+	////////////////////////////////////////////////////////////////////////////////
+	// The number of 32 bit words covered by each rank table entry.
+	constexpr uint32_t k_bitset_rank_block_size = 8;
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Returns the number of entries a rank table requires for the provided bit set description.
+	constexpr uint32_t get_bitset_rank_table_size(bitset_description desc)
+	{
+		return (desc.get_size() / k_bitset_rank_block_size) + 1;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Builds the rank table of a bit set.
+	// The output must contain get_bitset_rank_table_size(desc) entries.
+	inline void bitset_build_rank_table(const uint32_t* bitset, bitset_description desc, uint32_t* out_rank_table)
 	{
 		const uint32_t size = desc.get_size();
+		const uint32_t rank_table_size = get_bitset_rank_table_size(desc);
 
-		for (uint32_t offset = 0; offset < size; ++offset)
-			bitset_result[offset] = and_not(bitset_not_value[offset], bitset_and_value[offset]);
+		uint32_t num_set_bits = 0;
+		for (uint32_t block_index = 0; block_index < rank_table_size; ++block_index)
+		{
+			out_rank_table[block_index] = num_set_bits;
+
+			const uint32_t first_offset = block_index * k_bitset_rank_block_size;
+			const uint32_t last_offset = std::min<uint32_t>(first_offset + k_bitset_rank_block_size, size);
+			if (first_offset < last_offset)
+				num_set_bits += acl_impl::bitset_count_set_bits_in_words(bitset, first_offset, last_offset);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Returns the number of set (true) bits before the provided bit index.
+	// The bit index can be equal to the number of bits to count them all.
+	inline uint32_t bitset_rank(const uint32_t* bitset, bitset_description desc, const uint32_t* rank_table, uint32_t bit_index)
+	{
+		ACL_ASSERT(bit_index <= desc.get_num_bits(), "Invalid bit index: %d", bit_index);
+		(void)desc;
+
+		const uint32_t offset = bit_index / 32;
+		const uint32_t block_index = offset / k_bitset_rank_block_size;
+
+		uint32_t num_set_bits = rank_table[block_index];
+		num_set_bits += acl_impl::bitset_count_set_bits_in_words(bitset, block_index * k_bitset_rank_block_size, offset);
+
+		if ((bit_index % 32) != 0)
+			num_set_bits += count_set_bits(uint32_t(bitset[offset] & acl_impl::get_bitset_word_mask(0, bit_index % 32)));
+
+		return num_set_bits;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Returns the index of the Nth set (true) bit where N is zero based.
+	// Returns k_invalid_bit_index if the bit set doesn't contain enough set bits.
+	inline uint32_t bitset_select(const uint32_t* bitset, bitset_description desc, const uint32_t* rank_table, uint32_t rank)
+	{
+		const uint32_t size = desc.get_size();
+		const uint32_t rank_table_size = get_bitset_rank_table_size(desc);
+
+		// Find the last block that starts at or before our rank
+		uint32_t first_block_index = 0;
+		uint32_t last_block_index = rank_table_size;
+		while (last_block_index - first_block_index > 1)
+		{
+			const uint32_t middle_block_index = (first_block_index + last_block_index) / 2;
+			if (rank_table[middle_block_index] <= rank)
+				first_block_index = middle_block_index;
+			else
+				last_block_index = middle_block_index;
+		}
+
+		rank -= rank_table[first_block_index];
+
+		const uint32_t first_offset = first_block_index * k_bitset_rank_block_size;
+		const uint32_t last_offset = std::min<uint32_t>(first_offset + k_bitset_rank_block_size, size);
+		for (uint32_t offset = first_offset; offset < last_offset; ++offset)
+		{
+			const uint32_t word = bitset[offset];
+			const uint32_t num_set_bits = count_set_bits(word);
+			if (rank < num_set_bits)
+				return (offset * 32) + acl_impl::select_set_bit(word, rank);
+
+			rank -= num_set_bits;
+		}
+
+		return k_invalid_bit_index;
 	}
 
 	ACL_IMPL_VERSION_NAMESPACE_END
@@ -51,6 +51,26 @@ namespace acl
 		//////////////////////////////////////////////////////////////////////////
 		// Identifies a 'compressed_database' buffer.
 		compressed_database = 0xac11db01,
+
+		//////////////////////////////////////////////////////////////////////////
+		// Identifies a packed 'compressed_tracks' buffer meant for storage.
+		// See 'pack_compressed_tracks(..)' and 'unpack_compressed_tracks(..)'.
+		packed_compressed_tracks = 0xac11ac1b,
+
+		//////////////////////////////////////////////////////////////////////////
+		// Identifies a 'compressed_pack' buffer.
+		// See 'build_compressed_pack(..)' and 'make_compressed_pack(..)'.
+		compressed_pack = 0xac11ac9c,
+
+		//////////////////////////////////////////////////////////////////////////
+		// Identifies a 'compressed_bundle' buffer.
+		// See 'build_compressed_bundle(..)' and 'make_compressed_bundle(..)'.
+		compressed_bundle = 0xac11acbd,
+
+		//////////////////////////////////////////////////////////////////////////
+		// Identifies a 'compressed_mixed_tracks' buffer.
+		// See 'build_compressed_mixed_tracks(..)' and 'make_compressed_mixed_tracks(..)'.
+		compressed_mixed_tracks = 0xac11ac3d,
 	};
 
 	ACL_IMPL_VERSION_NAMESPACE_END
@@ -0,0 +1,161 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/buffer_tag.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/compressed_tracks_version.h"
+#include "acl/core/error_result.h"
+#include "acl/core/hash.h"
+#include "acl/core/track_desc.h"
+#include "acl/core/track_types.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/impl/compressed_headers.h"
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	////////////////////////////////////////////////////////////////////////////////
+	// An instance of a compressed bundle.
+	// A bundle holds every clip of a skeleton (or any other track list) in a single buffer.
+	// The track metadata they have in common (track names and descriptions) is only stored
+	// once, with the first clip, and queried through the bundle. Every clip retains its own
+	// name and parent track indices as well as everything needed to decompress it.
+	// Every offset is relative to the start of the bundle: once loaded, everything can be
+	// used in place without any fixups or allocations.
+	// The total size of the buffer can be queried with `get_size()`.
+	////////////////////////////////////////////////////////////////////////////////
+	class alignas(16) compressed_bundle final
+	{
+	public:
+		////////////////////////////////////////////////////////////////////////////////
+		// Returns the size in bytes of the compressed bundle.
+		// Includes the 'compressed_bundle' instance size.
+		uint32_t get_size() const { return m_buffer_header.size; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the hash for the compressed bundle.
+		// This is only used for sanity checking in case of memory corruption.
+		uint32_t get_hash() const { return m_buffer_header.hash; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the binary tag for the compressed bundle.
+		// This uniquely identifies the buffer as a proper 'compressed_bundle' object.
+		buffer_tag32 get_tag() const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the binary format version.
+		compressed_tracks_version16 get_version() const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of clips contained in this bundle.
+		uint32_t get_num_clips() const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the compressed tracks instance of the specified clip.
+		// Its shared metadata has been stripped, query it from the bundle instead.
+		const compressed_tracks* get_compressed_tracks(uint32_t clip_index) const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the name of the specified clip if it was stored, an empty string otherwise.
+		const char* get_clip_name(uint32_t clip_index) const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of tracks contained in every clip.
+		uint32_t get_num_tracks() const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the type of the tracks contained in every clip.
+		track_type8 get_track_type() const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Shared metadata, see the equivalent functions on 'compressed_tracks'.
+
+		const char* get_track_name(uint32_t track_index) const;
+		uint32_t find_track_index(const char* name) const;
+		uint32_t get_parent_track_index(uint32_t track_index) const;
+		bool get_track_description(uint32_t track_index, track_desc_scalarf& out_description) const;
+		bool get_track_description(uint32_t track_index, track_desc_transformf& out_description) const;
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Returns true if the compressed bundle is valid and usable.
+		// This mainly validates some invariants as well as ensuring that the
+		// memory has not been corrupted.
+		// The contained compressed tracks are not validated.
+		//
+		// check_hash: If true, the compressed bundle hash will also be compared.
+		error_result is_valid(bool check_hash) const;
+
+	private:
+		////////////////////////////////////////////////////////////////////////////////
+		// Hide everything
+		compressed_bundle() = delete;
+		compressed_bundle(const compressed_bundle&) = delete;
+		compressed_bundle(compressed_bundle&&) = delete;
+		compressed_bundle* operator=(const compressed_bundle&) = delete;
+		compressed_bundle* operator=(compressed_bundle&&) = delete;
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Raw buffer header that isn't included in the hash.
+		////////////////////////////////////////////////////////////////////////////////
+
+		acl_impl::raw_buffer_header		m_buffer_header;
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Everything starting here is included in the hash.
+		////////////////////////////////////////////////////////////////////////////////
+
+		//////////////////////////////////////////////////////////////////////////
+		// Compressed data follows here in memory.
+		//////////////////////////////////////////////////////////////////////////
+
+		// Here we define some unspecified padding but the 'bundle_header' starts here.
+		// This is done to ensure that this class is 16 byte aligned without requiring further padding
+		// if the 'bundle_header' ends up causing us to be unaligned.
+		uint32_t m_padding[2];
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Create a compressed_bundle instance in place from a raw memory buffer (e.g. a memory mapped file).
+	// The buffer must be aligned to 'k_compressed_tracks_preferred_alignment' for the clips
+	// to remain aligned.
+	// If the buffer does not contain a valid compressed_bundle instance, nullptr is returned
+	// along with an optional error result.
+	//////////////////////////////////////////////////////////////////////////
+	const compressed_bundle* make_compressed_bundle(const void* buffer, error_result* out_error_result = nullptr);
+	compressed_bundle* make_compressed_bundle(void* buffer, error_result* out_error_result = nullptr);
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+#include "acl/core/impl/compressed_bundle.impl.h"
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,162 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/buffer_tag.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/compressed_tracks_version.h"
+#include "acl/core/error_result.h"
+#include "acl/core/hash.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/impl/compressed_headers.h"
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	////////////////////////////////////////////////////////////////////////////////
+	// An instance of compressed mixed tracks.
+	// Mixed tracks hold a transform track list and a scalar track list that play back
+	// together (e.g. a character's skeleton along with its facial curves) in a single buffer.
+	// Both lists share the same number of samples, sample rate, and looping policy: they
+	// can be sought with a single sample time, see 'mixed_decompression_context'.
+	// Tracks are indexed with transform tracks first followed by scalar tracks.
+	// Every offset is relative to the start of the buffer: once loaded, everything can be
+	// used in place without any fixups or allocations.
+	// The total size of the buffer can be queried with `get_size()`.
+	////////////////////////////////////////////////////////////////////////////////
+	class alignas(16) compressed_mixed_tracks final
+	{
+	public:
+		////////////////////////////////////////////////////////////////////////////////
+		// Returns the size in bytes of the compressed mixed tracks.
+		// Includes the 'compressed_mixed_tracks' instance size.
+		uint32_t get_size() const { return m_buffer_header.size; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the hash for the compressed mixed tracks.
+		// This is only used for sanity checking in case of memory corruption.
+		uint32_t get_hash() const { return m_buffer_header.hash; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the binary tag for the compressed mixed tracks.
+		// This uniquely identifies the buffer as a proper 'compressed_mixed_tracks' object.
+		buffer_tag32 get_tag() const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the binary format version.
+		compressed_tracks_version16 get_version() const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the compressed transform tracks.
+		const compressed_tracks& get_transform_tracks() const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the compressed scalar tracks.
+		const compressed_tracks& get_scalar_tracks() const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of transform tracks, they come first.
+		uint32_t get_num_transform_tracks() const { return get_transform_tracks().get_num_tracks(); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of scalar tracks, they follow the transform tracks.
+		uint32_t get_num_scalar_tracks() const { return get_scalar_tracks().get_num_tracks(); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the total number of tracks.
+		uint32_t get_num_tracks() const { return get_num_transform_tracks() + get_num_scalar_tracks(); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of samples per track, see 'compressed_tracks::get_num_samples_per_track()'.
+		uint32_t get_num_samples_per_track() const { return get_transform_tracks().get_num_samples_per_track(); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the duration of every track, see 'compressed_tracks::get_duration(..)'.
+		float get_duration(sample_looping_policy looping_policy = sample_looping_policy::as_compressed) const { return get_transform_tracks().get_duration(looping_policy); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the sample rate used by every track.
+		float get_sample_rate() const { return get_transform_tracks().get_sample_rate(); }
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Returns true if the compressed mixed tracks are valid and usable.
+		// This mainly validates some invariants as well as ensuring that the
+		// memory has not been corrupted.
+		// The contained compressed tracks are validated without their hash.
+		//
+		// check_hash: If true, the compressed mixed tracks hash will also be compared.
+		error_result is_valid(bool check_hash) const;
+
+	private:
+		////////////////////////////////////////////////////////////////////////////////
+		// Hide everything
+		compressed_mixed_tracks() = delete;
+		compressed_mixed_tracks(const compressed_mixed_tracks&) = delete;
+		compressed_mixed_tracks(compressed_mixed_tracks&&) = delete;
+		compressed_mixed_tracks* operator=(const compressed_mixed_tracks&) = delete;
+		compressed_mixed_tracks* operator=(compressed_mixed_tracks&&) = delete;
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Raw buffer header that isn't included in the hash.
+		////////////////////////////////////////////////////////////////////////////////
+
+		acl_impl::raw_buffer_header		m_buffer_header;
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Everything starting here is included in the hash.
+		////////////////////////////////////////////////////////////////////////////////
+
+		//////////////////////////////////////////////////////////////////////////
+		// Compressed data follows here in memory.
+		//////////////////////////////////////////////////////////////////////////
+
+		// Here we define some unspecified padding but the 'mixed_tracks_header' starts here.
+		// This is done to ensure that this class is 16 byte aligned without requiring further padding
+		// if the 'mixed_tracks_header' ends up causing us to be unaligned.
+		uint32_t m_padding[2];
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Create a compressed_mixed_tracks instance in place from a raw memory buffer (e.g. a memory mapped file).
+	// The buffer must be aligned to 'k_compressed_tracks_preferred_alignment' for the tracks
+	// to remain aligned.
+	// If the buffer does not contain a valid compressed_mixed_tracks instance, nullptr is returned
+	// along with an optional error result.
+	//////////////////////////////////////////////////////////////////////////
+	const compressed_mixed_tracks* make_compressed_mixed_tracks(const void* buffer, error_result* out_error_result = nullptr);
+	compressed_mixed_tracks* make_compressed_mixed_tracks(void* buffer, error_result* out_error_result = nullptr);
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+#include "acl/core/impl/compressed_mixed_tracks.impl.h"
+
+ACL_IMPL_FILE_PRAGMA_POP
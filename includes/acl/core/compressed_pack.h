@@ -0,0 +1,161 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/buffer_tag.h"
+#include "acl/core/compressed_database.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/compressed_tracks_version.h"
+#include "acl/core/error_result.h"
+#include "acl/core/hash.h"
+#include "acl/core/quality_tiers.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/impl/compressed_headers.h"
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	////////////////////////////////////////////////////////////////////////////////
+	// An instance of a compressed pack.
+	// A pack bundles many compressed tracks instances along with an optional database
+	// and its bulk data into a single buffer meant to be loaded as a whole (e.g. memory mapped).
+	// Every entry is stored aligned and every offset is relative to the start of the pack:
+	// once loaded, everything can be used in place without any fixups or allocations.
+	// The bulk data of each tier is aligned to a page boundary to ensure that pages
+	// only fault in when the tier is streamed in.
+	// The total size of the buffer can be queried with `get_size()`.
+	////////////////////////////////////////////////////////////////////////////////
+	class alignas(16) compressed_pack final
+	{
+	public:
+		////////////////////////////////////////////////////////////////////////////////
+		// Returns the size in bytes of the compressed pack.
+		// Includes the 'compressed_pack' instance size.
+		uint32_t get_size() const { return m_buffer_header.size; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the hash for the compressed pack.
+		// This is only used for sanity checking in case of memory corruption.
+		uint32_t get_hash() const { return m_buffer_header.hash; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the binary tag for the compressed pack.
+		// This uniquely identifies the buffer as a proper 'compressed_pack' object.
+		buffer_tag32 get_tag() const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the binary format version.
+		compressed_tracks_version16 get_version() const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of compressed tracks instances contained in this pack.
+		uint32_t get_num_compressed_tracks() const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the compressed tracks instance at the specified index.
+		const compressed_tracks* get_compressed_tracks(uint32_t index) const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns whether or not this pack contains a compressed database.
+		bool has_database() const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the compressed database contained in this pack, nullptr if there is none.
+		const compressed_database* get_database() const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns a pointer to the database bulk data for the specified database tier when
+		// it is stored in this pack, nullptr otherwise.
+		// Bulk data is not stored separately when it is inline within the database.
+		// Use it with a 'null_database_streamer' or your own streamer.
+		const uint8_t* get_bulk_data(quality_tier tier) const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the size in bytes of the database bulk data stored in this pack for the specified database tier.
+		uint32_t get_bulk_data_size(quality_tier tier) const;
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Returns true if the compressed pack is valid and usable.
+		// This mainly validates some invariants as well as ensuring that the
+		// memory has not been corrupted.
+		// The contained compressed tracks and database are not validated.
+		//
+		// check_hash: If true, the compressed pack hash will also be compared.
+		error_result is_valid(bool check_hash) const;
+
+	private:
+		////////////////////////////////////////////////////////////////////////////////
+		// Hide everything
+		compressed_pack() = delete;
+		compressed_pack(const compressed_pack&) = delete;
+		compressed_pack(compressed_pack&&) = delete;
+		compressed_pack* operator=(const compressed_pack&) = delete;
+		compressed_pack* operator=(compressed_pack&&) = delete;
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Raw buffer header that isn't included in the hash.
+		////////////////////////////////////////////////////////////////////////////////
+
+		acl_impl::raw_buffer_header		m_buffer_header;
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Everything starting here is included in the hash.
+		////////////////////////////////////////////////////////////////////////////////
+
+		//////////////////////////////////////////////////////////////////////////
+		// Compressed data follows here in memory.
+		//////////////////////////////////////////////////////////////////////////
+
+		// Here we define some unspecified padding but the 'pack_header' starts here.
+		// This is done to ensure that this class is 16 byte aligned without requiring further padding
+		// if the 'pack_header' ends up causing us to be unaligned.
+		uint32_t m_padding[2];
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Create a compressed_pack instance in place from a raw memory buffer (e.g. a memory mapped file).
+	// The buffer must be aligned to 'k_compressed_pack_bulk_data_alignment' for the bulk data
+	// to remain page aligned, memory mappings always are.
+	// If the buffer does not contain a valid compressed_pack instance, nullptr is returned
+	// along with an optional error result.
+	//////////////////////////////////////////////////////////////////////////
+	const compressed_pack* make_compressed_pack(const void* buffer, error_result* out_error_result = nullptr);
+	compressed_pack* make_compressed_pack(void* buffer, error_result* out_error_result = nullptr);
+
+	// Bulk data is aligned to the most common page size
+	constexpr uint32_t k_compressed_pack_bulk_data_alignment = 4096;
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+#include "acl/core/impl/compressed_pack.impl.h"
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,103 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/error.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <rtm/scalarf.h>
+
+#include <algorithm>
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Very long clips can be compressed in consecutive parts, see compress_track_list_in_parts(..).
+	// Every part holds at most 'max_num_samples_per_part' samples and shares its last sample
+	// with the first sample of the next part. This allows playback to interpolate seamlessly
+	// across the boundary: any sample time falls within a single part.
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the number of parts needed to hold the specified number of samples.
+	inline uint32_t calculate_num_compressed_parts(uint32_t num_samples, uint32_t max_num_samples_per_part)
+	{
+		ACL_ASSERT(max_num_samples_per_part >= 2, "Parts must hold at least 2 samples");
+
+		if (num_samples <= max_num_samples_per_part)
+			return 1;
+
+		// Every part after the first adds all its samples but the shared one
+		const uint32_t num_unique_samples_per_part = max_num_samples_per_part - 1;
+		return (num_samples - 1 + num_unique_samples_per_part - 1) / num_unique_samples_per_part;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the clip relative index of the first sample held by the specified part.
+	inline uint32_t get_compressed_part_first_sample_index(uint32_t part_index, uint32_t max_num_samples_per_part)
+	{
+		ACL_ASSERT(max_num_samples_per_part >= 2, "Parts must hold at least 2 samples");
+		return part_index * (max_num_samples_per_part - 1);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the number of samples held by the specified part.
+	inline uint32_t get_compressed_part_num_samples(uint32_t part_index, uint32_t num_samples, uint32_t max_num_samples_per_part)
+	{
+		const uint32_t first_sample_index = get_compressed_part_first_sample_index(part_index, max_num_samples_per_part);
+		ACL_ASSERT(first_sample_index < num_samples, "Invalid part index: %u", part_index);
+		return std::min<uint32_t>(num_samples - first_sample_index, max_num_samples_per_part);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the part that holds the specified clip relative sample time along with
+	// the sample time relative to the start of that part to seek its context with.
+	// Parts do not loop, sample times outside the clip are clamped by the last part.
+	inline uint32_t find_compressed_part(float sample_time, float sample_rate, uint32_t num_parts, uint32_t max_num_samples_per_part, float& out_part_sample_time)
+	{
+		ACL_ASSERT(num_parts != 0, "Invalid number of parts");
+		ACL_ASSERT(max_num_samples_per_part >= 2, "Parts must hold at least 2 samples");
+
+		const uint32_t num_unique_samples_per_part = max_num_samples_per_part - 1;
+		const float sample_index = rtm::scalar_max(sample_time, 0.0F) * sample_rate;
+
+		// The sample shared by two parts is found in the second part, except for the last sample of the clip
+		const uint32_t part_index = std::min<uint32_t>(static_cast<uint32_t>(sample_index / float(num_unique_samples_per_part)), num_parts - 1);
+
+		const float part_start_time = float(part_index * num_unique_samples_per_part) / sample_rate;
+		out_part_sample_time = rtm::scalar_max(sample_time - part_start_time, 0.0F);
+		return part_index;
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -37,7 +37,9 @@
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/impl/compressed_headers.h"
 
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 ACL_IMPL_FILE_PRAGMA_PUSH
 
@@ -45,6 +47,13 @@ namespace acl
 {
 	ACL_IMPL_VERSION_NAMESPACE_BEGIN
 
+	////////////////////////////////////////////////////////////////////////////////
+	// Compressed tracks only require 'alignof(compressed_tracks)' but the library allocates
+	// them on a cache line boundary. The headers read when we seek and decompress then
+	// span as few cache lines as possible, see 'transform_tracks_header'.
+	////////////////////////////////////////////////////////////////////////////////
+	constexpr size_t k_compressed_tracks_preferred_alignment = 64;
+
 	////////////////////////////////////////////////////////////////////////////////
 	// An instance of a compressed tracks.
 	// The compressed data immediately follows this instance in memory.
@@ -117,7 +126,6 @@ namespace acl
 
 		//////////////////////////////////////////////////////////////////////////
 		// Returns whether or not this clip is split into a compressed database instance.
-		// Only supported with qvv transform tracks.
 		bool has_database() const;
 
 		//////////////////////////////////////////////////////////////////////////
@@ -128,7 +136,6 @@ namespace acl
 
 		//////////////////////////////////////////////////////////////////////////
 		// Returns whether or not this clip has had keyframes stripped.
-		// Only supported with qvv transform tracks.
 		bool has_stripped_keyframes() const;
 
 		//////////////////////////////////////////////////////////////////////////
@@ -149,6 +156,13 @@ namespace acl
 		// Returns the track name for the specified track index if metadata is present, k_invalid_track_index otherwise.
 		const char* get_track_name(uint32_t track_index) const;
 
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the track index of the first track with the specified name if track names
+		// are present, k_invalid_track_index otherwise.
+		// When the track name table is present, the lookup takes constant time. Otherwise
+		// every track name is compared. See compression_metadata_settings::include_track_name_table.
+		uint32_t find_track_index(const char* name) const;
+
 		//////////////////////////////////////////////////////////////////////////
 		// Returns the parent track index for the specified track index if metadata is present, nullptr otherwise.
 		// Only supported with qvv transform tracks.
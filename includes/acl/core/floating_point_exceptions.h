@@ -40,7 +40,7 @@ namespace acl
 	//////////////////////////////////////////////////////////////////////////
 	struct fp_environment
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_SSE2_INTRINSICS) && !defined(ACL_IMPL_WASM_SIMD128)
 		unsigned int exception_mask;
 #elif defined(RTM_NEON_INTRINSICS)
 		// TODO: Implement on ARM. API to do this is not consistent across Android, Windows ARM, and iOS
@@ -53,7 +53,7 @@ namespace acl
 	//////////////////////////////////////////////////////////////////////////
 	inline void enable_fp_exceptions(fp_environment& out_old_env)
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_SSE2_INTRINSICS) && !defined(ACL_IMPL_WASM_SIMD128)
 		// We only care about SSE and not x87
 		// Clear any exceptions that might have been raised already
 		_MM_SET_EXCEPTION_STATE(0);
@@ -72,7 +72,7 @@ namespace acl
 	//////////////////////////////////////////////////////////////////////////
 	inline void disable_fp_exceptions(fp_environment& out_old_env)
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_SSE2_INTRINSICS) && !defined(ACL_IMPL_WASM_SIMD128)
 		// We only care about SSE and not x87
 		// Cache the exception mask we had so we can restore it later
 		out_old_env.exception_mask = _MM_GET_EXCEPTION_MASK();
@@ -88,7 +88,7 @@ namespace acl
 	//////////////////////////////////////////////////////////////////////////
 	inline void restore_fp_exceptions(const fp_environment& env)
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_SSE2_INTRINSICS) && !defined(ACL_IMPL_WASM_SIMD128)
 		// We only care about SSE and not x87
 		// Clear any exceptions that might have been raised already
 		_MM_SET_EXCEPTION_STATE(0);
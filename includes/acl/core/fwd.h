@@ -56,11 +56,16 @@ namespace acl
 
 	class iallocator;
 	class ansi_allocator;
+	class linear_arena_allocator;
+	class tracking_allocator;
 
 	class bitset_description;
 	struct bitset_index_ref;
 
+	class compressed_bundle;
 	class compressed_database;
+	class compressed_mixed_tracks;
+	class compressed_pack;
 	class compressed_tracks;
 
 	class error_result;
@@ -113,6 +118,8 @@ namespace acl
 	template<typename data_type> using ptr_offset16 = ptr_offset<data_type, uint16_t>;
 	template<typename data_type> using ptr_offset32 = ptr_offset<data_type, uint32_t>;
 
+	class reference_pose;
+
 	class scope_profiler;
 
 	class string;
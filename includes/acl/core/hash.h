@@ -27,10 +27,30 @@
 #include "acl/version.h"
 #include "acl/core/impl/compiler_utils.h"
 
+#include <rtm/math.h>
+
 #include <cstdint>
 #include <cstring>
 #include <type_traits>
 
+#if !defined(ACL_CRC32_INTRINSICS) && !defined(RTM_NO_INTRINSICS)
+	#if defined(__SSE4_2__) || defined(RTM_AVX_INTRINSICS) || defined(_DURANGO) || defined(_XBOX_ONE)
+		// Enable the SSE 4.2 CRC32 instructions, every CPU with AVX supports them
+		#define ACL_CRC32_INTRINSICS
+	#elif defined(__ARM_FEATURE_CRC32)
+		// Enable the ARMv8 CRC32 instructions
+		#define ACL_CRC32_INTRINSICS
+	#endif
+#endif
+
+#if defined(ACL_CRC32_INTRINSICS)
+	#if defined(__ARM_FEATURE_CRC32)
+		#include <arm_acle.h>
+	#else
+		#include <nmmintrin.h>
+	#endif
+#endif
+
 ACL_IMPL_FILE_PRAGMA_PUSH
 
 namespace acl
@@ -135,6 +155,298 @@ namespace acl
 		return hash64(str, buffer_size);
 	}
 
+	namespace hash_impl
+	{
+		constexpr uint64_t k_xxh64_prime1 = 0x9E3779B185EBCA87ULL;
+		constexpr uint64_t k_xxh64_prime2 = 0xC2B2AE3D27D4EB4FULL;
+		constexpr uint64_t k_xxh64_prime3 = 0x165667B19E3779F9ULL;
+		constexpr uint64_t k_xxh64_prime4 = 0x85EBCA77C2B2AE63ULL;
+		constexpr uint64_t k_xxh64_prime5 = 0x27D4EB2F165667C5ULL;
+
+		inline uint64_t rotl64(uint64_t value, uint32_t shift) { return (value << shift) | (value >> (64 - shift)); }
+
+		inline uint64_t read_u64(const uint8_t* data)
+		{
+			uint64_t value;
+			std::memcpy(&value, data, sizeof(uint64_t));
+			return value;
+		}
+
+		inline uint32_t read_u32(const uint8_t* data)
+		{
+			uint32_t value;
+			std::memcpy(&value, data, sizeof(uint32_t));
+			return value;
+		}
+
+		inline uint64_t xxh64_round(uint64_t acc, uint64_t input)
+		{
+			acc += input * k_xxh64_prime2;
+			acc = rotl64(acc, 31);
+			return acc * k_xxh64_prime1;
+		}
+
+		inline uint64_t xxh64_merge_round(uint64_t acc, uint64_t value)
+		{
+			acc ^= xxh64_round(0, value);
+			return acc * k_xxh64_prime1 + k_xxh64_prime4;
+		}
+
+		// Consumes the remaining bytes that do not form a full block and mixes the final hash value
+		inline uint64_t xxh64_finalize(uint64_t hash_value, uint64_t buffer_size, const uint8_t* data, const uint8_t* data_end)
+		{
+			hash_value += buffer_size;
+
+			while (data + 8 <= data_end)
+			{
+				hash_value ^= xxh64_round(0, read_u64(data));
+				hash_value = rotl64(hash_value, 27) * k_xxh64_prime1 + k_xxh64_prime4;
+				data += 8;
+			}
+
+			if (data + 4 <= data_end)
+			{
+				hash_value ^= uint64_t(read_u32(data)) * k_xxh64_prime1;
+				hash_value = rotl64(hash_value, 23) * k_xxh64_prime2 + k_xxh64_prime3;
+				data += 4;
+			}
+
+			while (data < data_end)
+			{
+				hash_value ^= uint64_t(*data) * k_xxh64_prime5;
+				hash_value = rotl64(hash_value, 11) * k_xxh64_prime1;
+				data++;
+			}
+
+			hash_value ^= hash_value >> 33;
+			hash_value *= k_xxh64_prime2;
+			hash_value ^= hash_value >> 29;
+			hash_value *= k_xxh64_prime3;
+			hash_value ^= hash_value >> 32;
+			return hash_value;
+		}
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Returns the 64 bit XXH64 hash of the provided buffer and size in bytes.
+	// Unlike FNV 1a which consumes a byte at a time, this hash consumes 32 bytes per
+	// iteration with four independent accumulators that the CPU can process in parallel.
+	// It is meant for large buffers such as raw track samples. Previous results can be
+	// chained through the seed to hash discontiguous buffers.
+	// Reads are little endian, the result is stable across platforms and runs.
+	inline uint64_t hash64_fast(const void* buffer, size_t buffer_size, uint64_t seed = 0)
+	{
+		using namespace hash_impl;
+
+		const uint8_t* data = static_cast<const uint8_t*>(buffer);
+		const uint8_t* data_end = data + buffer_size;
+
+		uint64_t hash_value;
+		if (buffer_size >= 32)
+		{
+			uint64_t acc0 = seed + k_xxh64_prime1 + k_xxh64_prime2;
+			uint64_t acc1 = seed + k_xxh64_prime2;
+			uint64_t acc2 = seed;
+			uint64_t acc3 = seed - k_xxh64_prime1;
+
+			const uint8_t* block_end = data_end - 32;
+			do
+			{
+				acc0 = xxh64_round(acc0, read_u64(data + 0));
+				acc1 = xxh64_round(acc1, read_u64(data + 8));
+				acc2 = xxh64_round(acc2, read_u64(data + 16));
+				acc3 = xxh64_round(acc3, read_u64(data + 24));
+				data += 32;
+			} while (data <= block_end);
+
+			hash_value = rotl64(acc0, 1) + rotl64(acc1, 7) + rotl64(acc2, 12) + rotl64(acc3, 18);
+			hash_value = xxh64_merge_round(hash_value, acc0);
+			hash_value = xxh64_merge_round(hash_value, acc1);
+			hash_value = xxh64_merge_round(hash_value, acc2);
+			hash_value = xxh64_merge_round(hash_value, acc3);
+		}
+		else
+			hash_value = seed + k_xxh64_prime5;
+
+		return xxh64_finalize(hash_value, uint64_t(buffer_size), data, data_end);
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Computes the same hash as hash64_fast(..) over a buffer provided in several
+	// contiguous parts, without requiring the whole buffer to be resident at once.
+	class hash64_fast_stream final
+	{
+	public:
+		////////////////////////////////////////////////////////////////////////////////
+		// Constructs a hash stream with the provided seed.
+		explicit hash64_fast_stream(uint64_t seed = 0)
+			: m_seed(seed)
+			, m_total_size(0)
+			, m_num_buffered(0)
+		{
+			using namespace hash_impl;
+
+			m_acc[0] = seed + k_xxh64_prime1 + k_xxh64_prime2;
+			m_acc[1] = seed + k_xxh64_prime2;
+			m_acc[2] = seed;
+			m_acc[3] = seed - k_xxh64_prime1;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Updates the current hash with the next part of the buffer.
+		void update(const void* buffer, size_t buffer_size)
+		{
+			const uint8_t* data = static_cast<const uint8_t*>(buffer);
+			const uint8_t* data_end = data + buffer_size;
+
+			m_total_size += buffer_size;
+
+			if (m_num_buffered + buffer_size < 32)
+			{
+				// Not enough for a full block, wait for more data
+				std::memcpy(&m_buffer[m_num_buffered], data, buffer_size);
+				m_num_buffered += uint32_t(buffer_size);
+				return;
+			}
+
+			if (m_num_buffered != 0)
+			{
+				// Complete our partial block first
+				const uint32_t num_missing = 32 - m_num_buffered;
+				std::memcpy(&m_buffer[m_num_buffered], data, num_missing);
+				consume_block(&m_buffer[0]);
+
+				data += num_missing;
+				m_num_buffered = 0;
+			}
+
+			while (data + 32 <= data_end)
+			{
+				consume_block(data);
+				data += 32;
+			}
+
+			m_num_buffered = uint32_t(data_end - data);
+			std::memcpy(&m_buffer[0], data, m_num_buffered);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Returns the hash of every part provided so far.
+		uint64_t digest() const
+		{
+			using namespace hash_impl;
+
+			uint64_t hash_value;
+			if (m_total_size >= 32)
+			{
+				hash_value = rotl64(m_acc[0], 1) + rotl64(m_acc[1], 7) + rotl64(m_acc[2], 12) + rotl64(m_acc[3], 18);
+				hash_value = xxh64_merge_round(hash_value, m_acc[0]);
+				hash_value = xxh64_merge_round(hash_value, m_acc[1]);
+				hash_value = xxh64_merge_round(hash_value, m_acc[2]);
+				hash_value = xxh64_merge_round(hash_value, m_acc[3]);
+			}
+			else
+				hash_value = m_seed + k_xxh64_prime5;
+
+			return xxh64_finalize(hash_value, m_total_size, &m_buffer[0], &m_buffer[0] + m_num_buffered);
+		}
+
+	private:
+		void consume_block(const uint8_t* data)
+		{
+			using namespace hash_impl;
+
+			m_acc[0] = xxh64_round(m_acc[0], read_u64(data + 0));
+			m_acc[1] = xxh64_round(m_acc[1], read_u64(data + 8));
+			m_acc[2] = xxh64_round(m_acc[2], read_u64(data + 16));
+			m_acc[3] = xxh64_round(m_acc[3], read_u64(data + 24));
+		}
+
+		uint64_t	m_acc[4];		// Our four accumulators
+		uint64_t	m_seed;			// The seed provided
+		uint64_t	m_total_size;	// Number of bytes provided so far
+		uint32_t	m_num_buffered;	// Number of bytes in our partial block
+		uint8_t		m_buffer[32];	// Our partial block
+	};
+
+	namespace hash_impl
+	{
+		// Reflected CRC32C (Castagnoli) polynomial
+		constexpr uint32_t k_crc32c_polynomial = 0x82F63B78U;
+
+		inline const uint32_t* get_crc32c_table()
+		{
+			struct crc32c_table
+			{
+				uint32_t entries[256];
+
+				crc32c_table()
+				{
+					for (uint32_t index = 0; index < 256; ++index)
+					{
+						uint32_t crc = index;
+						for (uint32_t bit_index = 0; bit_index < 8; ++bit_index)
+							crc = (crc >> 1) ^ (k_crc32c_polynomial & (0U - (crc & 1)));
+						entries[index] = crc;
+					}
+				}
+			};
+
+			static const crc32c_table table;
+			return &table.entries[0];
+		}
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Returns the CRC32C (Castagnoli) checksum of the provided buffer and size in bytes.
+	// It uses the dedicated CRC32 instructions when ACL_CRC32_INTRINSICS is defined
+	// (SSE 4.2 or ARMv8 CRC), 8 bytes at a time, and a lookup table otherwise. Both
+	// produce the same checksum. Previous results can be chained through the seed to
+	// checksum discontiguous buffers.
+	// It is meant to detect corruption (e.g. IO errors), use the hash functions above
+	// to identify content.
+	inline uint32_t crc32c(const void* buffer, size_t buffer_size, uint32_t seed = 0)
+	{
+		const uint8_t* data = static_cast<const uint8_t*>(buffer);
+		const uint8_t* data_end = data + buffer_size;
+
+		uint32_t crc = ~seed;
+
+#if defined(ACL_CRC32_INTRINSICS)
+		while (data + 8 <= data_end)
+		{
+	#if defined(__ARM_FEATURE_CRC32)
+			crc = __crc32cd(crc, hash_impl::read_u64(data));
+	#elif defined(RTM_ARCH_X64)
+			crc = uint32_t(_mm_crc32_u64(crc, hash_impl::read_u64(data)));
+	#else
+			crc = _mm_crc32_u32(crc, hash_impl::read_u32(data));
+			crc = _mm_crc32_u32(crc, hash_impl::read_u32(data + 4));
+	#endif
+			data += 8;
+		}
+
+		while (data < data_end)
+		{
+	#if defined(__ARM_FEATURE_CRC32)
+			crc = __crc32cb(crc, *data);
+	#else
+			crc = _mm_crc32_u8(crc, *data);
+	#endif
+			data++;
+		}
+#else
+		const uint32_t* table = hash_impl::get_crc32c_table();
+		while (data < data_end)
+		{
+			crc = table[(crc ^ *data) & 0xFF] ^ (crc >> 8);
+			data++;
+		}
+#endif
+
+		return ~crc;
+	}
+
 	////////////////////////////////////////////////////////////////////////////////
 	// Combines two hashes into a new one.
 	inline uint32_t hash_combine(uint32_t hash_a, uint32_t hash_b) { return (hash_a ^ hash_b) * 16777619U; }
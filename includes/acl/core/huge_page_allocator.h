@@ -0,0 +1,233 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/error.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/memory_utils.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_WIN32)
+	#include <windows.h>
+
+	#define ACL_IMPL_HAS_HUGE_PAGES
+#elif defined(__linux__)
+	#include <sys/mman.h>
+
+	#define ACL_IMPL_HAS_HUGE_PAGES
+#endif
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	////////////////////////////////////////////////////////////////////////////////
+	// An allocator that backs large buffers with huge pages.
+	// Decompressing from thousands of clips touches many pages and with 4 KB pages,
+	// TLB misses quickly add up. Large allocations such as compressed clip packs and
+	// database bulk data are better served by 2 MB or 1 GB pages.
+	//
+	// Allocations of at least 'min_allocation_size' bytes are mapped directly from the OS
+	// and rounded up to a multiple of the huge page size. Explicit huge pages are used first
+	// (MAP_HUGETLB on Linux, MEM_LARGE_PAGES on Windows) and when none are available
+	// (none reserved, missing privilege), we fall back to regular pages aligned to the
+	// huge page size. On Linux, transparent huge pages are requested for them with 'madvise'.
+	// Smaller allocations are forwarded to the backing allocator.
+	//
+	// On Linux, explicit huge pages must be reserved first (see /proc/sys/vm/nr_hugepages).
+	// On Windows, the 'SeLockMemoryPrivilege' privilege is required and 1 GB pages are not
+	// supported: the platform large page size is used instead.
+	// On other platforms, every allocation is forwarded to the backing allocator.
+	//
+	// This allocator is thread safe if the backing allocator is.
+	////////////////////////////////////////////////////////////////////////////////
+	class huge_page_allocator final : public iallocator
+	{
+	public:
+		static constexpr size_t k_2mb_page_size = 2 * 1024 * 1024;
+		static constexpr size_t k_1gb_page_size = 1024 * 1024 * 1024;
+
+		explicit huge_page_allocator(iallocator& backing_allocator, size_t page_size = k_2mb_page_size, size_t min_allocation_size = 1024 * 1024)
+			: iallocator()
+			, m_backing_allocator(backing_allocator)
+			, m_page_size(page_size)
+			, m_min_allocation_size(min_allocation_size)
+			, m_num_huge_page_allocations(0)
+			, m_num_fallback_allocations(0)
+		{
+			ACL_ASSERT(page_size == k_2mb_page_size || page_size == k_1gb_page_size, "Unsupported huge page size");
+
+#if defined(_WIN32)
+			const size_t large_page_size = GetLargePageMinimum();
+			if (large_page_size != 0)
+				m_page_size = large_page_size;
+#endif
+		}
+
+		huge_page_allocator(const huge_page_allocator&) = delete;
+		huge_page_allocator& operator=(const huge_page_allocator&) = delete;
+
+		virtual void* allocate(size_t size, size_t alignment = k_default_alignment) override
+		{
+			ACL_ASSERT(is_power_of_two(alignment), "The alignment must be power of two.");
+
+#if defined(ACL_IMPL_HAS_HUGE_PAGES)
+			if (size >= m_min_allocation_size)
+			{
+				ACL_ASSERT(alignment <= m_page_size, "Huge page allocations cannot be aligned to more than the huge page size");
+				return allocate_pages(align_to(size, m_page_size));
+			}
+#endif
+
+			return m_backing_allocator.allocate(size, alignment);
+		}
+
+		virtual void deallocate(void* ptr, size_t size) override
+		{
+			if (ptr == nullptr)
+				return;
+
+#if defined(ACL_IMPL_HAS_HUGE_PAGES)
+			if (size >= m_min_allocation_size)
+			{
+				deallocate_pages(ptr, align_to(size, m_page_size));
+				return;
+			}
+#endif
+
+			m_backing_allocator.deallocate(ptr, size);
+		}
+
+		// Returns the huge page size used
+		size_t get_page_size() const { return m_page_size; }
+
+		// Returns the number of allocations that were backed by explicit huge pages
+		uint32_t get_num_huge_page_allocations() const { return m_num_huge_page_allocations.load(std::memory_order_relaxed); }
+
+		// Returns the number of allocations that fell back to regular pages
+		uint32_t get_num_fallback_allocations() const { return m_num_fallback_allocations.load(std::memory_order_relaxed); }
+
+	private:
+#if defined(ACL_IMPL_HAS_HUGE_PAGES)
+		void* allocate_pages(size_t mapping_size)
+		{
+#if defined(_WIN32)
+			void* ptr = VirtualAlloc(nullptr, mapping_size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+			if (ptr != nullptr)
+			{
+				m_num_huge_page_allocations.fetch_add(1, std::memory_order_relaxed);
+				return ptr;
+			}
+
+			// Reservations are only aligned to 64 KB, over-reserve and commit an aligned range within.
+			// The whole reservation is released from its base address when we deallocate.
+			uint8_t* reservation = static_cast<uint8_t*>(VirtualAlloc(nullptr, mapping_size + m_page_size, MEM_RESERVE, PAGE_NOACCESS));
+			if (reservation == nullptr)
+				return nullptr;
+
+			ptr = VirtualAlloc(align_to(reservation, m_page_size), mapping_size, MEM_COMMIT, PAGE_READWRITE);
+			if (ptr == nullptr)
+			{
+				VirtualFree(reservation, 0, MEM_RELEASE);
+				return nullptr;
+			}
+#else
+			int huge_page_flags = MAP_HUGETLB;
+#if defined(MAP_HUGE_SHIFT)
+			huge_page_flags |= (m_page_size == k_1gb_page_size ? 30 : 21) << MAP_HUGE_SHIFT;
+#endif
+
+			void* ptr = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | huge_page_flags, -1, 0);
+			if (ptr != MAP_FAILED)
+			{
+				m_num_huge_page_allocations.fetch_add(1, std::memory_order_relaxed);
+				return ptr;
+			}
+
+			// Over-map and trim the mapping so that it is aligned to the huge page size, otherwise
+			// transparent huge pages cannot back it
+			const size_t reservation_size = mapping_size + m_page_size;
+			void* reservation = mmap(nullptr, reservation_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (reservation == MAP_FAILED)
+				return nullptr;
+
+			uint8_t* reservation_start = static_cast<uint8_t*>(reservation);
+			uint8_t* reservation_end = reservation_start + reservation_size;
+			uint8_t* mapping_start = align_to(reservation_start, m_page_size);
+			uint8_t* mapping_end = mapping_start + mapping_size;
+
+			if (mapping_start != reservation_start)
+				munmap(reservation_start, size_t(mapping_start - reservation_start));
+
+			if (mapping_end != reservation_end)
+				munmap(mapping_end, size_t(reservation_end - mapping_end));
+
+#if defined(MADV_HUGEPAGE)
+			madvise(mapping_start, mapping_size, MADV_HUGEPAGE);
+#endif
+
+			ptr = mapping_start;
+#endif
+
+			m_num_fallback_allocations.fetch_add(1, std::memory_order_relaxed);
+			return ptr;
+		}
+
+		static void deallocate_pages(void* ptr, size_t mapping_size)
+		{
+#if defined(_WIN32)
+			(void)mapping_size;
+
+			// Fallback allocations are released from the base of their reservation
+			MEMORY_BASIC_INFORMATION info;
+			if (VirtualQuery(ptr, &info, sizeof(info)) != 0)
+				ptr = info.AllocationBase;
+
+			VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+			munmap(ptr, mapping_size);
+#endif
+		}
+#endif
+
+		iallocator&				m_backing_allocator;
+		size_t					m_page_size;
+		size_t					m_min_allocation_size;
+
+		std::atomic<uint32_t>	m_num_huge_page_allocations;
+		std::atomic<uint32_t>	m_num_fallback_allocations;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
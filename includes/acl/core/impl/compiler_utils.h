@@ -116,6 +116,17 @@ namespace acl
 	#define ACL_SWITCH_CASE_FALLTHROUGH_INTENTIONAL (void)0
 #endif
 
+//////////////////////////////////////////////////////////////////////////
+// WebAssembly SIMD128 support
+// Emscripten translates SSE intrinsics into SIMD128 instructions when compiling with
+// '-msimd128 -msse4.1'. RTM then selects its SSE2 code paths and so does ACL: the bit
+// unpacking, range reduction, and quaternion reconstruction kernels are all vectorized.
+// Some x86 state has no WebAssembly equivalent (e.g. MXCSR) and we must avoid it.
+//////////////////////////////////////////////////////////////////////////
+#if defined(__EMSCRIPTEN__) && defined(__wasm_simd128__)
+	#define ACL_IMPL_WASM_SIMD128
+#endif
+
 // When enabled, constant sub-tracks will use the weighted average of every sample instead of the first sample
 // Disabled by default, most clips have no measurable gain but some clips suffer greatly, needs to be investigated, possibly a bug somewhere
 // Note: Code has been removed in the pull request that closes: https://github.com/nfrechette/acl/issues/353
@@ -0,0 +1,167 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Included only once from compressed_pack.h
+
+#include "acl/version.h"
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		// Hide these implementations, they shouldn't be needed in user-space
+		inline const bundle_header& get_bundle_header(const compressed_bundle& bundle)
+		{
+			return *reinterpret_cast<const bundle_header*>(reinterpret_cast<const uint8_t*>(&bundle) + sizeof(raw_buffer_header));
+		}
+
+		// The first clip holds the shared metadata
+		inline const compressed_tracks& get_bundle_metadata_tracks(const compressed_bundle& bundle)
+		{
+			const bundle_header& header = get_bundle_header(bundle);
+			const pack_entry* entries = header.entries_offset.add_to(&bundle);
+			return *entries[0].tracks_offset.add_to(&bundle);
+		}
+	}
+
+	inline buffer_tag32 compressed_bundle::get_tag() const { return static_cast<buffer_tag32>(acl_impl::get_bundle_header(*this).tag); }
+
+	inline compressed_tracks_version16 compressed_bundle::get_version() const { return acl_impl::get_bundle_header(*this).version; }
+
+	inline uint32_t compressed_bundle::get_num_clips() const { return acl_impl::get_bundle_header(*this).num_clips; }
+
+	inline const compressed_tracks* compressed_bundle::get_compressed_tracks(uint32_t clip_index) const
+	{
+		const acl_impl::bundle_header& header = acl_impl::get_bundle_header(*this);
+		ACL_ASSERT(clip_index < header.num_clips, "Invalid clip index: %u", clip_index);
+		if (clip_index >= header.num_clips)
+			return nullptr;
+
+		const acl_impl::pack_entry* entries = header.entries_offset.add_to(this);
+		return entries[clip_index].tracks_offset.add_to(this);
+	}
+
+	inline const char* compressed_bundle::get_clip_name(uint32_t clip_index) const
+	{
+		const compressed_tracks* tracks = get_compressed_tracks(clip_index);
+		return tracks != nullptr ? tracks->get_name() : "";
+	}
+
+	inline uint32_t compressed_bundle::get_num_tracks() const { return acl_impl::get_bundle_header(*this).num_tracks; }
+
+	inline track_type8 compressed_bundle::get_track_type() const { return acl_impl::get_bundle_metadata_tracks(*this).get_track_type(); }
+
+	inline const char* compressed_bundle::get_track_name(uint32_t track_index) const { return acl_impl::get_bundle_metadata_tracks(*this).get_track_name(track_index); }
+
+	inline uint32_t compressed_bundle::find_track_index(const char* name) const { return acl_impl::get_bundle_metadata_tracks(*this).find_track_index(name); }
+
+	inline uint32_t compressed_bundle::get_parent_track_index(uint32_t track_index) const { return acl_impl::get_bundle_metadata_tracks(*this).get_parent_track_index(track_index); }
+
+	inline bool compressed_bundle::get_track_description(uint32_t track_index, track_desc_scalarf& out_description) const
+	{
+		return acl_impl::get_bundle_metadata_tracks(*this).get_track_description(track_index, out_description);
+	}
+
+	inline bool compressed_bundle::get_track_description(uint32_t track_index, track_desc_transformf& out_description) const
+	{
+		return acl_impl::get_bundle_metadata_tracks(*this).get_track_description(track_index, out_description);
+	}
+
+	inline error_result compressed_bundle::is_valid(bool check_hash) const
+	{
+		if (!is_aligned_to(this, alignof(compressed_bundle)))
+			return error_result("Invalid alignment");
+
+		const acl_impl::bundle_header& header = acl_impl::get_bundle_header(*this);
+		if (header.tag != static_cast<uint32_t>(buffer_tag32::compressed_bundle))
+			return error_result("Invalid tag");
+
+		if (header.version < compressed_tracks_version16::first || header.version > compressed_tracks_version16::latest)
+			return error_result("Invalid bundle version");
+
+		if (header.num_clips == 0)
+			return error_result("A bundle must contain at least one clip");
+
+		const uint32_t bundle_size = m_buffer_header.size;
+		if (uint64_t(uint32_t(header.entries_offset)) + (uint64_t(header.num_clips) * sizeof(acl_impl::pack_entry)) > uint64_t(bundle_size))
+			return error_result("Invalid table of contents");
+
+		const acl_impl::pack_entry* entries = header.entries_offset.add_to(this);
+		for (uint32_t clip_index = 0; clip_index < header.num_clips; ++clip_index)
+		{
+			const acl_impl::pack_entry& entry = entries[clip_index];
+			if (uint64_t(uint32_t(entry.tracks_offset)) + uint64_t(entry.tracks_size) > uint64_t(bundle_size))
+				return error_result("Invalid compressed tracks entry");
+		}
+
+		if (check_hash)
+		{
+			const uint32_t hash = acl_impl::hash_raw_buffer(header.version, safe_ptr_cast<const uint8_t>(&m_padding[0]), m_buffer_header.size - sizeof(acl_impl::raw_buffer_header));
+			if (hash != m_buffer_header.hash)
+				return error_result("Invalid hash");
+		}
+
+		return error_result();
+	}
+
+	namespace acl_impl
+	{
+		inline const compressed_bundle* make_compressed_bundle_impl(const void* buffer, error_result* out_error_result)
+		{
+			if (buffer == nullptr)
+			{
+				if (out_error_result != nullptr)
+					*out_error_result = error_result("Buffer is not a valid pointer");
+
+				return nullptr;
+			}
+
+			const compressed_bundle* bundle = static_cast<const compressed_bundle*>(buffer);
+			if (out_error_result != nullptr)
+			{
+				const error_result result = bundle->is_valid(false);
+				*out_error_result = result;
+
+				if (result.any())
+					return nullptr;
+			}
+
+			return bundle;
+		}
+	}
+
+	inline const compressed_bundle* make_compressed_bundle(const void* buffer, error_result* out_error_result)
+	{
+		return acl_impl::make_compressed_bundle_impl(buffer, out_error_result);
+	}
+
+	inline compressed_bundle* make_compressed_bundle(void* buffer, error_result* out_error_result)
+	{
+		return const_cast<compressed_bundle*>(acl_impl::make_compressed_bundle_impl(buffer, out_error_result));
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
@@ -46,8 +46,12 @@ namespace acl
 		const acl_impl::database_header& header = acl_impl::get_database_header(*this);
 		if (header.get_is_bulk_data_inline())
 			return m_buffer_header.size;
-		else
-			return m_buffer_header.size + header.bulk_data_size[0] + header.bulk_data_size[1];
+
+		uint32_t total_size = m_buffer_header.size;
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			total_size += header.bulk_data_size[tier_index];
+
+		return total_size;
 	}
 
 	inline uint32_t compressed_database::get_bulk_data_size(quality_tier tier) const
@@ -61,6 +65,38 @@ namespace acl
 		return header.bulk_data_size[tier_index];
 	}
 
+	inline uint32_t compressed_database::get_decoded_bulk_data_size(quality_tier tier) const
+	{
+		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
+		if (tier == quality_tier::highest_importance)
+			return 0;
+
+		const acl_impl::database_header& header = acl_impl::get_database_header(*this);
+		const uint32_t tier_index = uint32_t(tier) - 1;
+		if (!header.get_is_bulk_data_entropy_coded(tier_index))
+			return header.bulk_data_size[tier_index];
+
+		// Chunks are contiguous once decoded, the last one ends our bulk data
+		const uint32_t num_chunks = header.num_chunks[tier_index];
+		if (num_chunks == 0)
+			return 0;
+
+		const acl_impl::database_chunk_description* chunk_descriptions = header.get_chunk_descriptions(tier_index);
+		const acl_impl::database_chunk_description& last_chunk_description = chunk_descriptions[num_chunks - 1];
+		return uint32_t(last_chunk_description.offset) + last_chunk_description.size;
+	}
+
+	inline bool compressed_database::is_bulk_data_entropy_coded(quality_tier tier) const
+	{
+		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
+		if (tier == quality_tier::highest_importance)
+			return false;
+
+		const acl_impl::database_header& header = acl_impl::get_database_header(*this);
+		const uint32_t tier_index = uint32_t(tier) - 1;
+		return header.get_is_bulk_data_entropy_coded(tier_index);
+	}
+
 	inline bool compressed_database::has_bulk_data(quality_tier tier) const
 	{
 		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
@@ -145,12 +181,16 @@ namespace acl
 		if (header.tag != static_cast<uint32_t>(buffer_tag32::compressed_database))
 			return error_result("Invalid tag");
 
-		if (header.version < compressed_tracks_version16::first || header.version > compressed_tracks_version16::latest)
+		// Chunk headers gained a checksum in v02_01_99_3, older databases must be rebuilt
+		if (header.version < compressed_tracks_version16::v02_01_99_3 || header.version > compressed_tracks_version16::latest)
 			return error_result("Invalid database version");
 
+		if (header.get_num_tiers() != k_num_database_tiers)
+			return error_result("Database built with a different number of tiers, see ACL_NUM_DATABASE_TIERS");
+
 		if (check_hash)
 		{
-			const uint32_t hash = hash32(safe_ptr_cast<const uint8_t>(&m_padding[0]), m_buffer_header.size - sizeof(acl_impl::raw_buffer_header));
+			const uint32_t hash = acl_impl::hash_raw_buffer(header.version, safe_ptr_cast<const uint8_t>(&m_padding[0]), m_buffer_header.size - sizeof(acl_impl::raw_buffer_header));
 			if (hash != m_buffer_header.hash)
 				return error_result("Invalid hash");
 		}
@@ -27,6 +27,7 @@
 #include "acl/version.h"
 #include "acl/core/algorithm_types.h"
 #include "acl/core/compressed_tracks_version.h"
+#include "acl/core/hash.h"
 #include "acl/core/ptr_offset.h"
 #include "acl/core/quality_tiers.h"
 #include "acl/core/range_reduction_types.h"
@@ -43,6 +44,7 @@ namespace acl
 {
 	ACL_IMPL_VERSION_NAMESPACE_BEGIN
 
+	class compressed_database;
 	class compressed_tracks;
 
 	namespace acl_impl
@@ -57,6 +59,18 @@ namespace acl
 			uint32_t		hash;
 		};
 
+		// Returns the hash of a raw buffer (or part of one) for the provided version.
+		// Versions prior to v02_01_99_2 hash one byte at a time with FNV 1a, later
+		// versions use XXH64 folded to 32 bits which is considerably faster on large buffers.
+		inline uint32_t hash_raw_buffer(compressed_tracks_version16 version, const void* buffer, size_t buffer_size)
+		{
+			if (version < compressed_tracks_version16::v02_01_99_2)
+				return hash32(buffer, buffer_size);
+
+			const uint64_t hash_value = hash64_fast(buffer, buffer_size);
+			return uint32_t(hash_value ^ (hash_value >> 32));
+		}
+
 		// Header for 'compressed_tracks'
 		struct tracks_header
 		{
@@ -88,20 +102,31 @@ namespace acl
 			// Accessors for 'misc_packed'
 
 			// Scalar tracks use it like this (listed from LSB):
-			// Bits [0, 31): unused (31 bits)
+			// Bit 0: has segments? See scalar_segments_header for details.
+			// Bits [1, 8): unused (7 bits)
+			// Bit 8: has database? See scalar_database_header for details.
+			// Bit 9: unused
+			// Bit 10: has stripped keyframes?
+			// Bit 11: has track name table? See track_name_table_slot for details.
+			// Bits [12, 30): unused (18 bits)
 			// Bit 30: is wrap optimized? See sample_looping_policy for details.
 			// Bit 31: has metadata?
 
 			// Transform tracks use it like this (listed from LSB):
 			// Bit 0: has scale?
 			// Bit 1: default scale: 0,0,0 or 1,1,1 (bool/bit)
-			// Bit 2: scale format
-			// Bit 3: translation format
+			// Bit 2: scale format, variable? See bit 15 for the per component variant
+			// Bit 3: translation format, variable? See bit 14 for the per component variant
 			// Bits [4, 8): rotation format (4 bits)
 			// Bit 8: has database?
 			// Bit 9: has trivial default values? Non-trivial default values indicate that extra data beyond the clip will be needed at decompression (e.g. bind pose)
 			// Bit 10: has stripped keyframes?
-			// Bits [11, 30): unused (19 bits)
+			// Bit 11: has track name table? See track_name_table_slot for details.
+			// Bit 12: has quantized constant rotations? See get_constant_rotation_group_size(..) for details.
+			// Bit 13: has quantized rotation clip ranges? See dequantize_rotation_clip_range_min(..) for details.
+			// Bit 14: is translation format variable per component? See vector_format8::vector3f_variable_per_component
+			// Bit 15: is scale format variable per component? See vector_format8::vector3f_variable_per_component
+			// Bits [16, 30): unused (14 bits)
 			// Bit 30: is wrap optimized? See sample_looping_policy for details.
 			// Bit 31: has metadata?
 
@@ -110,20 +135,31 @@ namespace acl
 			void set_has_scale(bool has_scale) { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); misc_packed = (misc_packed & ~1) | static_cast<uint32_t>(has_scale); }
 			int32_t get_default_scale() const { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); return (misc_packed >> 1) & 1; }
 			void set_default_scale(uint32_t scale) { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); ACL_ASSERT(scale == 0 || scale == 1, "Invalid default scale"); misc_packed = (misc_packed & ~(1 << 1)) | (scale << 1); }
-			vector_format8 get_scale_format() const { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); return static_cast<vector_format8>((misc_packed >> 2) & 1); }
-			void set_scale_format(vector_format8 format) { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); misc_packed = (misc_packed & ~(1 << 2)) | (static_cast<uint32_t>(format) << 2); }
-			vector_format8 get_translation_format() const { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); return static_cast<vector_format8>((misc_packed >> 3) & 1); }
-			void set_translation_format(vector_format8 format) { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); misc_packed = (misc_packed & ~(1 << 3)) | (static_cast<uint32_t>(format) << 3); }
+			// Vector formats are stored as two bits: variable and per component, the latter implies the former (full = 0, variable = 1, per component = 2)
+			vector_format8 get_scale_format() const { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); return static_cast<vector_format8>(((misc_packed >> 2) & 1) + ((misc_packed >> 15) & 1)); }
+			void set_scale_format(vector_format8 format) { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); misc_packed = (misc_packed & ~((1 << 2) | (1 << 15))) | (static_cast<uint32_t>(format != vector_format8::vector3f_full) << 2) | (static_cast<uint32_t>(format == vector_format8::vector3f_variable_per_component) << 15); }
+			vector_format8 get_translation_format() const { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); return static_cast<vector_format8>(((misc_packed >> 3) & 1) + ((misc_packed >> 14) & 1)); }
+			void set_translation_format(vector_format8 format) { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); misc_packed = (misc_packed & ~((1 << 3) | (1 << 14))) | (static_cast<uint32_t>(format != vector_format8::vector3f_full) << 3) | (static_cast<uint32_t>(format == vector_format8::vector3f_variable_per_component) << 14); }
 			rotation_format8 get_rotation_format() const { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); return static_cast<rotation_format8>((misc_packed >> 4) & 15); }
 			void set_rotation_format(rotation_format8 format) { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); misc_packed = (misc_packed & ~(15 << 4)) | (static_cast<uint32_t>(format) << 4); }
-			bool get_has_database() const { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); return (misc_packed & (1 << 8)) != 0; }
-			void set_has_database(bool has_database) { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); misc_packed = (misc_packed & ~(1 << 8)) | (static_cast<uint32_t>(has_database) << 8); }
 			bool get_has_trivial_default_values() const { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); return (misc_packed & (1 << 9)) != 0; }
 			void set_has_trivial_default_values(bool has_trivial_default_values) { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); misc_packed = (misc_packed & ~(1 << 9)) | (static_cast<uint32_t>(has_trivial_default_values) << 9); }
-			bool get_has_stripped_keyframes() const { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); return (misc_packed & (1 << 10)) != 0; }
-			void set_has_stripped_keyframes(bool has_stripped_keyframes) { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); misc_packed = (misc_packed & ~(1 << 10)) | (static_cast<uint32_t>(has_stripped_keyframes) << 10); }
+			bool get_has_quantized_constant_rotations() const { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); return (misc_packed & (1 << 12)) != 0; }
+			void set_has_quantized_constant_rotations(bool has_quantized_constant_rotations) { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); misc_packed = (misc_packed & ~(1 << 12)) | (static_cast<uint32_t>(has_quantized_constant_rotations) << 12); }
+			bool get_has_quantized_rotation_clip_ranges() const { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); return (misc_packed & (1 << 13)) != 0; }
+			void set_has_quantized_rotation_clip_ranges(bool has_quantized_rotation_clip_ranges) { ACL_ASSERT(track_type == track_type8::qvvf, "Transform tracks only"); misc_packed = (misc_packed & ~(1 << 13)) | (static_cast<uint32_t>(has_quantized_rotation_clip_ranges) << 13); }
+
+			// Scalar only
+			bool get_has_scalar_segments() const { ACL_ASSERT(track_type != track_type8::qvvf, "Scalar tracks only"); return (misc_packed & 1) != 0; }
+			void set_has_scalar_segments(bool has_segments) { ACL_ASSERT(track_type != track_type8::qvvf, "Scalar tracks only"); misc_packed = (misc_packed & ~1) | static_cast<uint32_t>(has_segments); }
 
 			// Common
+			bool get_has_database() const { return (misc_packed & (1 << 8)) != 0; }
+			void set_has_database(bool has_database) { misc_packed = (misc_packed & ~(1 << 8)) | (static_cast<uint32_t>(has_database) << 8); }
+			bool get_has_stripped_keyframes() const { return (misc_packed & (1 << 10)) != 0; }
+			void set_has_stripped_keyframes(bool has_stripped_keyframes) { misc_packed = (misc_packed & ~(1 << 10)) | (static_cast<uint32_t>(has_stripped_keyframes) << 10); }
+			bool get_has_track_name_table() const { return (misc_packed & (1 << 11)) != 0; }
+			void set_has_track_name_table(bool has_track_name_table) { misc_packed = (misc_packed & ~(1 << 11)) | (static_cast<uint32_t>(has_track_name_table) << 11); }
 			bool get_is_wrap_optimized() const { return (misc_packed & (1 << 30)) != 0; }
 			void set_is_wrap_optimized(bool is_wrap_optimized) { misc_packed = (misc_packed & ~(1 << 30)) | (static_cast<uint32_t>(is_wrap_optimized) << 30); }
 			bool get_has_metadata() const { return (misc_packed >> 31) != 0; }
@@ -164,6 +200,36 @@ namespace acl
 			const uint8_t*					get_track_animated_values() const { return track_animated_values.add_to(this); }
 		};
 
+		////////////////////////////////////////////////////////////////////////////////
+		// Long scalar track lists can be split into segments of a uniform number of samples,
+		// the last segment might have fewer. Bit rates remain per track but every segment
+		// has its own range for the animated tracks that are not raw. Samples are normalized
+		// within their segment range which is itself normalized within the track range.
+		// When present, this header immediately follows the scalar_tracks_header.
+		////////////////////////////////////////////////////////////////////////////////
+		struct scalar_segments_header
+		{
+			// The number of samples per segment, the last segment might have fewer.
+			uint32_t						num_samples_per_segment;
+
+			// The size in bytes of the range data of a single segment.
+			uint32_t						segment_range_size;
+
+			// Offset to the segment range data, relative to the start of the scalar_tracks_header.
+			// Segments are stored in order and each contains, for every animated track that
+			// isn't raw, the segment range minimum of every component followed by their extent.
+			// Values are quantized on 8 bits each, see k_segment_range_reduction_num_bits_per_component.
+			ptr_offset32<uint8_t>			segment_range_values;
+
+			uint32_t						padding;
+
+			//////////////////////////////////////////////////////////////////////////
+
+			// The header is relative to the scalar_tracks_header that precedes it
+			const uint8_t*					get_segment_range_values(const scalar_tracks_header& scalars_header) const { return segment_range_values.add_to(&scalars_header); }
+			uint8_t*						get_segment_range_values(scalar_tracks_header& scalars_header) const { return segment_range_values.add_to(&scalars_header); }
+		};
+
 		////////////////////////////////////////////////////////////////////////////////
 		// A compressed clip segment header. Each segment is built from a uniform number
 		// of samples per track. A clip is split into one or more segments.
@@ -211,6 +277,46 @@ namespace acl
 			const database_runtime_clip_header*				get_clip_header(const void* base) const { return clip_header_offset.add_to(base); }
 		};
 
+		// Scalar track lists are split into database segments of a uniform number of samples, the last segment
+		// might have fewer. They are unrelated to the segments used for range reduction (see scalar_segments_header).
+		// Like transform segments, every database segment retains its first and last sample within the compressed tracks.
+		constexpr uint32_t k_num_samples_per_scalar_database_segment = 32;	// One bit per sample in a 32 bit sample indices bit set
+
+		// Header for scalar database segments
+		struct scalar_database_segment_header
+		{
+			// Bit set of which sample indices are stored in this clip (database tier 0).
+			uint32_t						sample_indices;
+
+			// Number of samples stored in this clip by the preceding segments.
+			// Every sample has the same size, our first sample starts at (sample_offset * num_bits_per_frame).
+			uint32_t						sample_offset;
+		};
+
+		////////////////////////////////////////////////////////////////////////////////
+		// Header for scalar 'compressed_tracks' that are split into a database or that have
+		// their keyframes stripped. When present, it follows the scalar_tracks_header and the
+		// scalar_segments_header (if any).
+		////////////////////////////////////////////////////////////////////////////////
+		struct scalar_database_header
+		{
+			// Offset to the database metadata header, relative to the start of the scalar_tracks_header.
+			// Only valid when bound to a database.
+			ptr_offset32<tracks_database_header>			database_header_offset;
+
+			// Offset to the database segment headers, relative to the start of the scalar_tracks_header.
+			ptr_offset32<scalar_database_segment_header>	segment_headers_offset;
+
+			//////////////////////////////////////////////////////////////////////////
+
+			// The header is relative to the scalar_tracks_header that precedes it
+			tracks_database_header*							get_database_header(scalar_tracks_header& scalars_header) const { return database_header_offset.safe_add_to(&scalars_header); }
+			const tracks_database_header*					get_database_header(const scalar_tracks_header& scalars_header) const { return database_header_offset.safe_add_to(&scalars_header); }
+
+			scalar_database_segment_header*					get_segment_headers(scalar_tracks_header& scalars_header) const { return segment_headers_offset.add_to(&scalars_header); }
+			const scalar_database_segment_header*			get_segment_headers(const scalar_tracks_header& scalars_header) const { return segment_headers_offset.add_to(&scalars_header); }
+		};
+
 		//////////////////////////////////////////////////////////////////////////
 		// A 32 bit integer that contains packed sub-track types.
 		// Each sub-track type is packed on 2 bits starting with the MSB.
@@ -223,7 +329,24 @@ namespace acl
 
 		const uint32_t k_num_sub_tracks_per_packed_entry = 16;	// 2 bits each within a 32 bit entry
 
+		//////////////////////////////////////////////////////////////////////////
+		// Constant rotations that drop W are stored in groups of 4 in SOA form: XXXX, YYYY, ZZZZ.
+		// When constant rotations are quantized (see tracks_header::get_has_quantized_constant_rotations()),
+		// the constant rotation data starts with its total size in bytes (uint32, including itself), followed by a bit set
+		// with one bit per group. Groups with their bit set store each component on 16 bits, the others
+		// store full precision floats. The last group can contain fewer than 4 rotations.
+		inline uint32_t get_constant_rotation_group_size(uint32_t num_rotations, bool is_quantized)
+		{
+			// Quantized groups are padded to keep the following groups aligned
+			return is_quantized ? align_to(num_rotations * 3 * uint32_t(sizeof(uint16_t)), 4U) : (num_rotations * 3 * uint32_t(sizeof(float)));
+		}
+
 		// Header for transform 'compressed_tracks'
+		// With the raw buffer header and the tracks header, it spans the first 84 bytes.
+		// Compressed tracks are allocated on a cache line boundary (see k_compressed_tracks_preferred_alignment):
+		//    - the first cache line holds everything initialize(..) needs along with our track/sample/segment counts
+		//    - the second cache line holds our data offsets followed by the segment start indices and segment headers
+		// Names and other optional metadata live at the end of the buffer and are never touched when decompressing.
 		struct transform_tracks_header
 		{
 			// The number of segments contained.
@@ -357,6 +480,30 @@ namespace acl
 
 		static_assert(sizeof(optional_metadata_header) >= 15, "Optional metadata must be at least 15 bytes");
 
+		//////////////////////////////////////////////////////////////////////////
+		// When present, the track name table follows the track names within their metadata block:
+		// [ name offsets (one per track), table offset, track names..., num slots, track_name_table_slot+ ]
+		// The table offset is relative to the start of the block, like the name offsets.
+		// The table is open addressed with linear probing and its number of slots is a power of two.
+		// Empty slots have an invalid track index. Names with the same hash are confirmed by comparing them.
+		struct track_name_table_slot
+		{
+			uint32_t						name_hash;			// hash32 of the track name
+			uint32_t						track_index;		// k_invalid_track_index when the slot is empty
+		};
+
+		static_assert(sizeof(track_name_table_slot) == 8, "Unexpected track name table slot size");
+
+		// Returns the number of slots in the track name table, at least twice the number of tracks
+		inline uint32_t get_num_track_name_table_slots(uint32_t num_tracks)
+		{
+			uint32_t num_slots = 2;
+			while (num_slots < num_tracks * 2)
+				num_slots *= 2;
+
+			return num_slots;
+		}
+
 		//////////////////////////////////////////////////////////////////////////
 		// Runtime metadata has the following layout:
 		// [ database_runtime_clip_header, database_runtime_segment_header+, database_runtime_clip_header, database_runtime_segment_header+, ... ]
@@ -366,8 +513,8 @@ namespace acl
 		// Header for runtime database segments
 		struct database_runtime_segment_header
 		{
-			// Each segment can be split into at most 3 tiers with tier 0 being in the compressed clip itself.
-			// As such, each segment can be split into at most 2 tiers within the database, each with it's own
+			// Each segment can be split into at most k_num_quality_tiers tiers with tier 0 being in the compressed clip itself.
+			// As such, each segment can be split into at most k_num_database_tiers tiers within the database, each with it's own
 			// chunk. Each segment contains at most 32 samples. Tiers are sorted in order from most important
 			// to least important and as such should stream in that order.
 
@@ -377,7 +524,7 @@ namespace acl
 			// Each tier value contains: (sample offset << 32) | sample indices
 			// Sample indices is a bit set of which sample indices are stored in our chunk
 			// Sample offset to the data. Zero if the data isn't used or streamed in. Relative to start of bulk data.
-			std::atomic<uint64_t>			tier_metadata[2];
+			std::atomic<uint64_t>			tier_metadata[k_num_database_tiers];
 		};
 
 		// Header for runtime database clips, 8 byte alignment to match database_runtime_segment_header
@@ -386,7 +533,10 @@ namespace acl
 			// Hash of the compressed clip stored in this entry
 			uint32_t						clip_hash;
 
-			uint32_t						padding;
+			// Number of segment tiers of this clip that are streamed in, summed over every database tier.
+			// Maintained when we stream in/out so that seeking can skip the segment headers entirely when
+			// nothing is resident. The tier metadata remains the source of truth, this is only a hint.
+			std::atomic<uint32_t>			num_resident_segment_tiers;
 
 			// Segment headers follow in memory
 
@@ -397,6 +547,8 @@ namespace acl
 			const database_runtime_segment_header*		get_segment_headers() const { return add_offset_to_ptr<const database_runtime_segment_header>(this, sizeof(database_runtime_clip_header)); }
 		};
 
+		static_assert(sizeof(database_runtime_clip_header) == 8, "The runtime clip header size is baked into the compressed offsets");
+
 		//////////////////////////////////////////////////////////////////////////
 		// Chunk data has the following layout:
 		// [ database_chunk_header, database_chunk_segment_header+, sample data ... ]
@@ -439,6 +591,10 @@ namespace acl
 		{
 			// Each chunk contains multiple segments and is at most 1 MB in size.
 
+			// CRC32C checksum of the chunk that follows this member, see calculate_database_chunk_checksum(..).
+			// Entropy coded chunks are checksummed once decoded.
+			uint32_t						checksum;
+
 			// Chunk index.
 			uint32_t						index;
 
@@ -459,6 +615,36 @@ namespace acl
 
 		static_assert((sizeof(database_chunk_header) % 4) == 0, "Header size must be a multiple of 4 bytes");
 
+		// Returns the checksum of a chunk, it covers the whole chunk except the checksum itself.
+		// The chunk size must be valid.
+		inline uint32_t calculate_database_chunk_checksum(const database_chunk_header& chunk_header)
+		{
+			const uint8_t* chunk_data = reinterpret_cast<const uint8_t*>(&chunk_header);
+			return crc32c(chunk_data + sizeof(uint32_t), chunk_header.size - sizeof(uint32_t));
+		}
+
+		// How a stored chunk is encoded when its tier is entropy coded
+		enum class database_chunk_encoding : uint32_t
+		{
+			// The chunk is stored as is, entropy coding did not make it smaller
+			stored = 0,
+
+			// The chunk is entropy coded with rANS, see 'rans_encode(..)'
+			rans = 1,
+		};
+
+		// Header for entropy coded database bulk data chunks
+		// Entropy coded tiers store their chunks back to back, each starting with this header
+		// and followed by its encoded data. Chunks are decoded into the normal chunk layout when
+		// they stream in.
+		struct database_encoded_chunk_header
+		{
+			// How the chunk data that follows is encoded.
+			database_chunk_encoding			encoding;
+		};
+
+		static_assert(sizeof(database_encoded_chunk_header) == 4, "Unexpected header size");
+
 		//////////////////////////////////////////////////////////////////////////
 		// Standalone database metadata headers
 
@@ -493,9 +679,22 @@ namespace acl
 			const database_runtime_clip_header*				get_clip_header(const void* base) const { return clip_header_offset.add_to(base); }
 		};
 
+		// Range of chunks that contain the data of a clip, per tier.
+		// Chunks are filled in clip order and as such, every clip spans a contiguous range of chunks.
+		// The first and last chunks of a range can be shared with neighboring clips.
+		// We use arrays so we can index with (tier - 1) as our index
+		struct database_clip_chunk_range
+		{
+			// Index of the first chunk containing data for this clip.
+			uint32_t										first_chunk_index[k_num_database_tiers];
+
+			// Number of chunks containing data for this clip, zero if the clip has no data in the tier.
+			uint32_t										num_chunks[k_num_database_tiers];
+		};
+
 		// Header for 'compressed_database'
 		// We use arrays so we can index with (tier - 1) as our index
-		// Index 0 = medium importance tier, index 1 = low importance
+		// Index 0 = medium importance tier, index k_num_database_tiers - 1 = low importance
 		struct database_header
 		{
 			// Serialization tag used to distinguish raw buffer types.
@@ -533,35 +732,230 @@ namespace acl
 
 			// Chunk descriptions follow in memory
 
+			// When a tier is entropy coded, its chunk descriptions, chunk indices and sample offsets all refer
+			// to the decoded bulk data. The bulk data size, offset, and hash refer to the encoded bulk data as stored
+			// and a second list of chunk descriptions locates every encoded chunk within it.
+
 			//////////////////////////////////////////////////////////////////////////
 			// Accessors for 'misc_packed'
 
 			// Listed from LSB:
 			// Bit 0: is bulk data inline?
-			// Bits [1, 16): unused (15 bits)
+			// Bit 1: has clip chunk ranges? (they follow the clip metadata)
+			// Bits [2, 2 + k_num_database_tiers): is the bulk data of each tier entropy coded? (encoded chunk descriptions follow the clip chunk ranges, in tier order)
+			// Bits [2 + k_num_database_tiers, 12): unused
+			// Bits [12, 16): number of database tiers minus 2 (zero by default), see ACL_NUM_DATABASE_TIERS
 
 			bool get_is_bulk_data_inline() const { return (misc_packed & (1 << 0)) != 0; }
 			void set_is_bulk_data_inline(bool is_inline) { misc_packed = (misc_packed & ~(1 << 0)) | (static_cast<uint16_t>(is_inline) << 0); }
 
+			bool get_has_clip_chunk_ranges() const { return (misc_packed & (1 << 1)) != 0; }
+			void set_has_clip_chunk_ranges(bool has_ranges) { misc_packed = (misc_packed & ~(1 << 1)) | (static_cast<uint16_t>(has_ranges) << 1); }
+
+			bool get_is_bulk_data_entropy_coded(uint32_t tier_index) const { return (misc_packed & (1 << (2 + tier_index))) != 0; }
+			void set_is_bulk_data_entropy_coded(uint32_t tier_index, bool is_entropy_coded) { misc_packed = (misc_packed & ~(1 << (2 + tier_index))) | (static_cast<uint16_t>(is_entropy_coded) << (2 + tier_index)); }
+
+			uint32_t get_num_tiers() const { return ((misc_packed >> 12) & 0xF) + 2; }
+			void set_num_tiers(uint32_t num_tiers) { misc_packed = (misc_packed & ~(0xF << 12)) | (static_cast<uint16_t>(num_tiers - 2) << 12); }
+
 			//////////////////////////////////////////////////////////////////////////
 			// Utility functions that return pointers from their respective offsets.
 
-			// Follows the header
-			database_chunk_description*				get_chunk_descriptions_medium() { return add_offset_to_ptr<database_chunk_description>(this, align_to(sizeof(database_header), 4)); }
-			const database_chunk_description*		get_chunk_descriptions_medium() const { return add_offset_to_ptr<const database_chunk_description>(this, align_to(sizeof(database_header), 4)); }
+			// Follows the header, one list per tier in tier order
+			database_chunk_description*				get_chunk_descriptions(uint32_t tier_index) { return add_offset_to_ptr<database_chunk_description>(this, get_chunk_descriptions_offset(tier_index)); }
+			const database_chunk_description*		get_chunk_descriptions(uint32_t tier_index) const { return add_offset_to_ptr<const database_chunk_description>(this, get_chunk_descriptions_offset(tier_index)); }
 
-			// Follows the medium descriptions
-			database_chunk_description*				get_chunk_descriptions_low() { return add_offset_to_ptr<database_chunk_description>(this, align_to(align_to(sizeof(database_header), 4) + num_chunks[0] * sizeof(database_chunk_description), 4)); }
-			const database_chunk_description*		get_chunk_descriptions_low() const { return add_offset_to_ptr<const database_chunk_description>(this, align_to(align_to(sizeof(database_header), 4) + num_chunks[0] * sizeof(database_chunk_description), 4)); }
+			// Offset relative to the header
+			uint32_t								get_chunk_descriptions_offset(uint32_t tier_index) const
+			{
+				uint32_t offset = align_to(uint32_t(sizeof(database_header)), 4);
+				for (uint32_t previous_tier_index = 0; previous_tier_index < tier_index; ++previous_tier_index)
+					offset = align_to(offset + num_chunks[previous_tier_index] * uint32_t(sizeof(database_chunk_description)), 4);
+				return offset;
+			}
 
 			database_clip_metadata*					get_clip_metadatas() { return clip_metadata_offset.add_to(this); }
 			const database_clip_metadata*			get_clip_metadatas() const { return clip_metadata_offset.add_to(this); }
 
-			uint8_t*								get_bulk_data_medium() { return bulk_data_offset[0].safe_add_to(this); }
-			const uint8_t*							get_bulk_data_medium() const { return bulk_data_offset[0].safe_add_to(this); }
+			// Follows the clip metadata, optional
+			database_clip_chunk_range*				get_clip_chunk_ranges() { return get_has_clip_chunk_ranges() ? add_offset_to_ptr<database_clip_chunk_range>(get_clip_metadatas(), num_clips * sizeof(database_clip_metadata)) : nullptr; }
+			const database_clip_chunk_range*		get_clip_chunk_ranges() const { return get_has_clip_chunk_ranges() ? add_offset_to_ptr<const database_clip_chunk_range>(get_clip_metadatas(), num_clips * sizeof(database_clip_metadata)) : nullptr; }
+
+			// Follows the clip chunk ranges, optional, one list per entropy coded tier in tier order
+			database_chunk_description*				get_encoded_chunk_descriptions(uint32_t tier_index) { return get_is_bulk_data_entropy_coded(tier_index) ? add_offset_to_ptr<database_chunk_description>(get_clip_metadatas(), get_encoded_chunk_descriptions_offset(tier_index)) : nullptr; }
+			const database_chunk_description*		get_encoded_chunk_descriptions(uint32_t tier_index) const { return get_is_bulk_data_entropy_coded(tier_index) ? add_offset_to_ptr<const database_chunk_description>(get_clip_metadatas(), get_encoded_chunk_descriptions_offset(tier_index)) : nullptr; }
+
+			// Offset relative to the clip metadata
+			uint32_t								get_encoded_chunk_descriptions_offset(uint32_t tier_index) const
+			{
+				uint32_t offset = num_clips * uint32_t(sizeof(database_clip_metadata) + (get_has_clip_chunk_ranges() ? sizeof(database_clip_chunk_range) : 0));
+				for (uint32_t previous_tier_index = 0; previous_tier_index < tier_index; ++previous_tier_index)
+					offset += get_num_encoded_chunks(previous_tier_index) * uint32_t(sizeof(database_chunk_description));
+				return offset;
+			}
+			uint32_t								get_num_encoded_chunks(uint32_t tier_index) const { return get_is_bulk_data_entropy_coded(tier_index) ? num_chunks[tier_index] : 0; }
+
+			uint8_t*								get_bulk_data(uint32_t tier_index) { return bulk_data_offset[tier_index].safe_add_to(this); }
+			const uint8_t*							get_bulk_data(uint32_t tier_index) const { return bulk_data_offset[tier_index].safe_add_to(this); }
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Packed compressed tracks headers
+		//
+		// Packed compressed tracks are meant for storage on disk. The compressed tracks are split into
+		// a fixed set of streams that group similar data together and each stream is entropy coded
+		// on its own. Unpacking restores the original compressed tracks bit for bit.
+
+		// How a packed stream is encoded
+		enum class packed_stream_encoding : uint8_t
+		{
+			// The stream is stored as is, entropy coding did not make it smaller
+			stored = 0,
+
+			// The stream is entropy coded with rANS, see 'rans_encode_compact(..)'
+			rans = 1,
+		};
+
+		// The streams of packed compressed tracks, stored in this order
+		enum class packed_stream : uint32_t
+		{
+			// Every header that precedes the constant track data, copied as is
+			headers = 0,
+
+			// The constant and range values split into byte planes, one stream per byte of each 32 bit value
+			// The last plane is followed by any trailing bytes that do not form a whole value
+			value_plane0 = 1,
+			value_plane1 = 2,
+			value_plane2 = 3,
+			value_plane3 = 4,
+
+			// The segment metadata (format per track and segment range data) along with any padding
+			segment_data = 5,
+
+			// The bit packed animated samples transposed so that every bit of a pose is contiguous across samples
+			animated_bits = 6,
+
+			// Everything that follows the animated data (e.g. optional metadata), copied as is
+			trailing_data = 7,
+
+			count = 8,
+		};
+
+		constexpr uint32_t k_num_packed_streams = static_cast<uint32_t>(packed_stream::count);
+
+		// Header for packed compressed tracks, the stream data follows back to back
+		struct packed_tracks_header
+		{
+			// Serialization tag used to distinguish raw buffer types.
+			uint32_t						tag;
+
+			// Size in bytes of the unpacked compressed tracks.
+			uint32_t						unpacked_size;
+
+			// Size in bytes of the unpacked headers stream.
+			uint32_t						headers_size;
+
+			// Size in bytes of each stream as stored.
+			uint32_t						stream_sizes[k_num_packed_streams];
+
+			// How each stream is encoded.
+			packed_stream_encoding			stream_encodings[k_num_packed_streams];
+		};
+
+		// An entry in the table of contents of a 'compressed_pack' or a 'compressed_bundle'
+		struct pack_entry
+		{
+			// Offset to the compressed tracks, relative to the start of the compressed_pack or compressed_bundle.
+			ptr_offset32<compressed_tracks>		tracks_offset;
+
+			// Size in bytes of the compressed tracks.
+			uint32_t							tracks_size;
+		};
+
+		// Header for 'compressed_pack'
+		// A pack is laid out as follows:
+		//    - raw buffer header and pack header
+		//    - table of contents (one pack_entry per compressed tracks instance)
+		//    - compressed tracks, each aligned to k_compressed_tracks_preferred_alignment
+		//    - compressed database (optional), aligned to k_compressed_tracks_preferred_alignment
+		//    - bulk data for each tier (optional), aligned to k_compressed_pack_bulk_data_alignment
+		struct pack_header
+		{
+			// Serialization tag used to distinguish raw buffer types.
+			uint32_t							tag;
+
+			// Serialization version used to build the pack.
+			compressed_tracks_version16			version;
+
+			// Unused, here for alignment.
+			uint16_t							padding;
+
+			// Number of compressed tracks instances contained.
+			uint32_t							num_entries;
+
+			// Offset to the table of contents, relative to the start of the compressed_pack.
+			ptr_offset32<pack_entry>			entries_offset;
+
+			// Offset to the compressed database (optional), relative to the start of the compressed_pack.
+			ptr_offset32<compressed_database>	database_offset;
+
+			// Offset to the bulk data for each tier (optional), relative to the start of the compressed_pack.
+			// Omitted when the database has no bulk data for that tier or when its bulk data is inline.
+			ptr_offset32<uint8_t>				bulk_data_offset[k_num_database_tiers];
+
+			// Size in bytes of the bulk data for each tier.
+			uint32_t							bulk_data_size[k_num_database_tiers];
+		};
+
+		// Header for 'compressed_bundle'
+		// A bundle is laid out as follows:
+		//    - raw buffer header and bundle header
+		//    - table of contents (one pack_entry per clip)
+		//    - compressed tracks, each aligned to k_compressed_tracks_preferred_alignment
+		// The first clip retains all of its metadata. The track names and descriptions shared by
+		// every clip are stripped from the others.
+		struct bundle_header
+		{
+			// Serialization tag used to distinguish raw buffer types.
+			uint32_t							tag;
+
+			// Serialization version used to build the bundle.
+			compressed_tracks_version16			version;
+
+			// Unused, here for alignment.
+			uint16_t							padding;
+
+			// Number of clips contained.
+			uint32_t							num_clips;
+
+			// Number of tracks contained in every clip.
+			uint32_t							num_tracks;
+
+			// Offset to the table of contents, relative to the start of the compressed_bundle.
+			ptr_offset32<pack_entry>			entries_offset;
+		};
+
+		// Header for 'compressed_mixed_tracks'
+		// Mixed tracks are laid out as follows:
+		//    - raw buffer header and mixed tracks header
+		//    - transform compressed tracks, aligned to k_compressed_tracks_preferred_alignment
+		//    - scalar compressed tracks, aligned to k_compressed_tracks_preferred_alignment
+		struct mixed_tracks_header
+		{
+			// Serialization tag used to distinguish raw buffer types.
+			uint32_t							tag;
+
+			// Serialization version used to build the mixed tracks.
+			compressed_tracks_version16			version;
+
+			// Unused, here for alignment.
+			uint16_t							padding;
+
+			// The transform compressed tracks, relative to the start of the compressed_mixed_tracks.
+			pack_entry							transform_tracks;
 
-			uint8_t*								get_bulk_data_low() { return bulk_data_offset[1].safe_add_to(this); }
-			const uint8_t*							get_bulk_data_low() const { return bulk_data_offset[1].safe_add_to(this); }
+			// The scalar compressed tracks, relative to the start of the compressed_mixed_tracks.
+			pack_entry							scalar_tracks;
 		};
 	}
 
@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Included only once from compressed_mixed_tracks.h
+
+#include "acl/version.h"
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		// Hide these implementations, they shouldn't be needed in user-space
+		inline const mixed_tracks_header& get_mixed_tracks_header(const compressed_mixed_tracks& tracks)
+		{
+			return *reinterpret_cast<const mixed_tracks_header*>(reinterpret_cast<const uint8_t*>(&tracks) + sizeof(raw_buffer_header));
+		}
+
+		inline error_result is_mixed_tracks_entry_valid(const compressed_mixed_tracks& tracks, const pack_entry& entry)
+		{
+			if (uint64_t(uint32_t(entry.tracks_offset)) + uint64_t(entry.tracks_size) > uint64_t(tracks.get_size()))
+				return error_result("Invalid compressed tracks entry");
+
+			const compressed_tracks* entry_tracks = entry.tracks_offset.add_to(&tracks);
+			if (entry_tracks->get_size() != entry.tracks_size)
+				return error_result("Invalid compressed tracks entry size");
+
+			return entry_tracks->is_valid(false);
+		}
+	}
+
+	inline buffer_tag32 compressed_mixed_tracks::get_tag() const { return static_cast<buffer_tag32>(acl_impl::get_mixed_tracks_header(*this).tag); }
+
+	inline compressed_tracks_version16 compressed_mixed_tracks::get_version() const { return acl_impl::get_mixed_tracks_header(*this).version; }
+
+	inline const compressed_tracks& compressed_mixed_tracks::get_transform_tracks() const { return *acl_impl::get_mixed_tracks_header(*this).transform_tracks.tracks_offset.add_to(this); }
+
+	inline const compressed_tracks& compressed_mixed_tracks::get_scalar_tracks() const { return *acl_impl::get_mixed_tracks_header(*this).scalar_tracks.tracks_offset.add_to(this); }
+
+	inline error_result compressed_mixed_tracks::is_valid(bool check_hash) const
+	{
+		if (!is_aligned_to(this, alignof(compressed_mixed_tracks)))
+			return error_result("Invalid alignment");
+
+		const acl_impl::mixed_tracks_header& header = acl_impl::get_mixed_tracks_header(*this);
+		if (header.tag != static_cast<uint32_t>(buffer_tag32::compressed_mixed_tracks))
+			return error_result("Invalid tag");
+
+		if (header.version < compressed_tracks_version16::first || header.version > compressed_tracks_version16::latest)
+			return error_result("Invalid mixed tracks version");
+
+		error_result result = acl_impl::is_mixed_tracks_entry_valid(*this, header.transform_tracks);
+		if (result.any())
+			return result;
+
+		result = acl_impl::is_mixed_tracks_entry_valid(*this, header.scalar_tracks);
+		if (result.any())
+			return result;
+
+		const compressed_tracks& transform_tracks = get_transform_tracks();
+		const compressed_tracks& scalar_tracks = get_scalar_tracks();
+		if (transform_tracks.get_track_type() != track_type8::qvvf || scalar_tracks.get_track_type() == track_type8::qvvf)
+			return error_result("Invalid track types");
+
+		if (transform_tracks.get_num_samples_per_track() != scalar_tracks.get_num_samples_per_track()
+			|| transform_tracks.get_sample_rate() != scalar_tracks.get_sample_rate()
+			|| transform_tracks.get_looping_policy() != scalar_tracks.get_looping_policy())
+			return error_result("Transform and scalar tracks must play back together");
+
+		if (check_hash)
+		{
+			const uint32_t hash = acl_impl::hash_raw_buffer(header.version, safe_ptr_cast<const uint8_t>(&m_padding[0]), m_buffer_header.size - sizeof(acl_impl::raw_buffer_header));
+			if (hash != m_buffer_header.hash)
+				return error_result("Invalid hash");
+		}
+
+		return error_result();
+	}
+
+	namespace acl_impl
+	{
+		inline const compressed_mixed_tracks* make_compressed_mixed_tracks_impl(const void* buffer, error_result* out_error_result)
+		{
+			if (buffer == nullptr)
+			{
+				if (out_error_result != nullptr)
+					*out_error_result = error_result("Buffer is not a valid pointer");
+
+				return nullptr;
+			}
+
+			const compressed_mixed_tracks* tracks = static_cast<const compressed_mixed_tracks*>(buffer);
+			if (out_error_result != nullptr)
+			{
+				const error_result result = tracks->is_valid(false);
+				*out_error_result = result;
+
+				if (result.any())
+					return nullptr;
+			}
+
+			return tracks;
+		}
+	}
+
+	inline const compressed_mixed_tracks* make_compressed_mixed_tracks(const void* buffer, error_result* out_error_result)
+	{
+		return acl_impl::make_compressed_mixed_tracks_impl(buffer, out_error_result);
+	}
+
+	inline compressed_mixed_tracks* make_compressed_mixed_tracks(void* buffer, error_result* out_error_result)
+	{
+		return const_cast<compressed_mixed_tracks*>(acl_impl::make_compressed_mixed_tracks_impl(buffer, out_error_result));
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
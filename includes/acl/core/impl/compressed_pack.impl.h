@@ -0,0 +1,163 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Included only once from compressed_pack.h
+
+#include "acl/version.h"
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		// Hide these implementations, they shouldn't be needed in user-space
+		inline const pack_header& get_pack_header(const compressed_pack& pack)
+		{
+			return *reinterpret_cast<const pack_header*>(reinterpret_cast<const uint8_t*>(&pack) + sizeof(raw_buffer_header));
+		}
+	}
+
+	inline buffer_tag32 compressed_pack::get_tag() const { return static_cast<buffer_tag32>(acl_impl::get_pack_header(*this).tag); }
+
+	inline compressed_tracks_version16 compressed_pack::get_version() const { return acl_impl::get_pack_header(*this).version; }
+
+	inline uint32_t compressed_pack::get_num_compressed_tracks() const { return acl_impl::get_pack_header(*this).num_entries; }
+
+	inline const compressed_tracks* compressed_pack::get_compressed_tracks(uint32_t index) const
+	{
+		const acl_impl::pack_header& header = acl_impl::get_pack_header(*this);
+		ACL_ASSERT(index < header.num_entries, "Invalid compressed tracks index: %u", index);
+		if (index >= header.num_entries)
+			return nullptr;
+
+		const acl_impl::pack_entry* entries = header.entries_offset.add_to(this);
+		return entries[index].tracks_offset.add_to(this);
+	}
+
+	inline bool compressed_pack::has_database() const { return acl_impl::get_pack_header(*this).database_offset.is_valid(); }
+
+	inline const compressed_database* compressed_pack::get_database() const { return acl_impl::get_pack_header(*this).database_offset.safe_add_to(this); }
+
+	inline const uint8_t* compressed_pack::get_bulk_data(quality_tier tier) const
+	{
+		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
+		if (tier == quality_tier::highest_importance)
+			return nullptr;
+
+		const acl_impl::pack_header& header = acl_impl::get_pack_header(*this);
+		const uint32_t tier_index = uint32_t(tier) - 1;
+		return header.bulk_data_offset[tier_index].safe_add_to(this);
+	}
+
+	inline uint32_t compressed_pack::get_bulk_data_size(quality_tier tier) const
+	{
+		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
+		if (tier == quality_tier::highest_importance)
+			return 0;
+
+		const acl_impl::pack_header& header = acl_impl::get_pack_header(*this);
+		const uint32_t tier_index = uint32_t(tier) - 1;
+		return header.bulk_data_size[tier_index];
+	}
+
+	inline error_result compressed_pack::is_valid(bool check_hash) const
+	{
+		if (!is_aligned_to(this, alignof(compressed_pack)))
+			return error_result("Invalid alignment");
+
+		const acl_impl::pack_header& header = acl_impl::get_pack_header(*this);
+		if (header.tag != static_cast<uint32_t>(buffer_tag32::compressed_pack))
+			return error_result("Invalid tag");
+
+		if (header.version < compressed_tracks_version16::first || header.version > compressed_tracks_version16::latest)
+			return error_result("Invalid pack version");
+
+		const uint32_t pack_size = m_buffer_header.size;
+		if (uint64_t(uint32_t(header.entries_offset)) + (uint64_t(header.num_entries) * sizeof(acl_impl::pack_entry)) > uint64_t(pack_size))
+			return error_result("Invalid table of contents");
+
+		const acl_impl::pack_entry* entries = header.entries_offset.add_to(this);
+		for (uint32_t entry_index = 0; entry_index < header.num_entries; ++entry_index)
+		{
+			const acl_impl::pack_entry& entry = entries[entry_index];
+			if (uint64_t(uint32_t(entry.tracks_offset)) + uint64_t(entry.tracks_size) > uint64_t(pack_size))
+				return error_result("Invalid compressed tracks entry");
+		}
+
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			const ptr_offset32<uint8_t> bulk_data_offset = header.bulk_data_offset[tier_index];
+			if (bulk_data_offset.is_valid() && uint64_t(uint32_t(bulk_data_offset)) + uint64_t(header.bulk_data_size[tier_index]) > uint64_t(pack_size))
+				return error_result("Invalid bulk data entry");
+		}
+
+		if (check_hash)
+		{
+			const uint32_t hash = acl_impl::hash_raw_buffer(header.version, safe_ptr_cast<const uint8_t>(&m_padding[0]), m_buffer_header.size - sizeof(acl_impl::raw_buffer_header));
+			if (hash != m_buffer_header.hash)
+				return error_result("Invalid hash");
+		}
+
+		return error_result();
+	}
+
+	namespace acl_impl
+	{
+		inline const compressed_pack* make_compressed_pack_impl(const void* buffer, error_result* out_error_result)
+		{
+			if (buffer == nullptr)
+			{
+				if (out_error_result != nullptr)
+					*out_error_result = error_result("Buffer is not a valid pointer");
+
+				return nullptr;
+			}
+
+			const compressed_pack* pack = static_cast<const compressed_pack*>(buffer);
+			if (out_error_result != nullptr)
+			{
+				const error_result result = pack->is_valid(false);
+				*out_error_result = result;
+
+				if (result.any())
+					return nullptr;
+			}
+
+			return pack;
+		}
+	}
+
+	inline const compressed_pack* make_compressed_pack(const void* buffer, error_result* out_error_result)
+	{
+		return acl_impl::make_compressed_pack_impl(buffer, out_error_result);
+	}
+
+	inline compressed_pack* make_compressed_pack(void* buffer, error_result* out_error_result)
+	{
+		return const_cast<compressed_pack*>(acl_impl::make_compressed_pack_impl(buffer, out_error_result));
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
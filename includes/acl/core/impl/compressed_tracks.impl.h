@@ -46,6 +46,33 @@ namespace acl
 			return *reinterpret_cast<const scalar_tracks_header*>(reinterpret_cast<const uint8_t*>(&tracks) + sizeof(raw_buffer_header) + sizeof(tracks_header));
 		}
 
+		inline scalar_tracks_header& get_scalar_tracks_header(compressed_tracks& tracks)
+		{
+			return *reinterpret_cast<scalar_tracks_header*>(reinterpret_cast<uint8_t*>(&tracks) + sizeof(raw_buffer_header) + sizeof(tracks_header));
+		}
+
+		inline const scalar_segments_header& get_scalar_segments_header(const scalar_tracks_header& scalars_header)
+		{
+			return *reinterpret_cast<const scalar_segments_header*>(&scalars_header + 1);
+		}
+
+		// Only valid when the scalar tracks are bound to a database or have their keyframes stripped
+		inline const scalar_database_header& get_scalar_database_header(const compressed_tracks& tracks)
+		{
+			const tracks_header& header = get_tracks_header(tracks);
+			const scalar_tracks_header& scalars_header = get_scalar_tracks_header(tracks);
+			const uint8_t* database_header = reinterpret_cast<const uint8_t*>(&scalars_header + 1);
+			if (header.get_has_scalar_segments())
+				database_header += sizeof(scalar_segments_header);
+
+			return *reinterpret_cast<const scalar_database_header*>(database_header);
+		}
+
+		inline scalar_database_header& get_scalar_database_header(compressed_tracks& tracks)
+		{
+			return const_cast<scalar_database_header&>(get_scalar_database_header(static_cast<const compressed_tracks&>(tracks)));
+		}
+
 		inline transform_tracks_header& get_transform_tracks_header(compressed_tracks& tracks)
 		{
 			return *reinterpret_cast<transform_tracks_header*>(reinterpret_cast<uint8_t*>(&tracks) + sizeof(raw_buffer_header) + sizeof(tracks_header));
@@ -60,6 +87,63 @@ namespace acl
 		{
 			return *reinterpret_cast<const optional_metadata_header*>(reinterpret_cast<const uint8_t*>(&tracks) + tracks.get_size() - sizeof(optional_metadata_header));
 		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Database support is shared by transform and scalar tracks, these helpers abstract
+		// where their database metadata lives and how they are split into database segments.
+		// Transform tracks use their segments while scalar tracks use a uniform number of samples
+		// per segment, see k_num_samples_per_scalar_database_segment.
+
+		// Returns the database header or nullptr if the tracks aren't bound to a database
+		inline const tracks_database_header* get_tracks_database_header(const compressed_tracks& tracks)
+		{
+			if (get_tracks_header(tracks).track_type == track_type8::qvvf)
+				return get_transform_tracks_header(tracks).get_database_header();
+
+			if (!tracks.has_database())
+				return nullptr;
+
+			return get_scalar_database_header(tracks).get_database_header(get_scalar_tracks_header(tracks));
+		}
+
+		inline tracks_database_header* get_tracks_database_header(compressed_tracks& tracks)
+		{
+			return const_cast<tracks_database_header*>(get_tracks_database_header(static_cast<const compressed_tracks&>(tracks)));
+		}
+
+		// Returns the number of database segments, an empty track list has a single empty segment
+		inline uint32_t get_num_database_segments(const compressed_tracks& tracks)
+		{
+			const tracks_header& header = get_tracks_header(tracks);
+			if (header.track_type == track_type8::qvvf)
+				return get_transform_tracks_header(tracks).num_segments;
+
+			const uint32_t num_segments = (header.num_samples + k_num_samples_per_scalar_database_segment - 1) / k_num_samples_per_scalar_database_segment;
+			return num_segments != 0 ? num_segments : 1;
+		}
+
+		// Returns the first sample index of a database segment
+		inline uint32_t get_database_segment_start_index(const compressed_tracks& tracks, uint32_t segment_index)
+		{
+			if (get_tracks_header(tracks).track_type != track_type8::qvvf)
+				return segment_index * k_num_samples_per_scalar_database_segment;
+
+			const transform_tracks_header& transform_header = get_transform_tracks_header(tracks);
+			return transform_header.has_multiple_segments() ? transform_header.get_segment_start_indices()[segment_index] : 0;
+		}
+
+		// Returns the number of samples in a database segment
+		inline uint32_t get_database_segment_num_samples(const compressed_tracks& tracks, uint32_t segment_index)
+		{
+			const uint32_t num_samples = get_tracks_header(tracks).num_samples;
+			const uint32_t num_segments = get_num_database_segments(tracks);
+			const uint32_t segment_start_index = get_database_segment_start_index(tracks, segment_index);
+
+			if (segment_index + 1 == num_segments)
+				return num_samples - segment_start_index;	// Last segment has the remaining samples
+
+			return get_database_segment_start_index(tracks, segment_index + 1) - segment_start_index;
+		}
 	}
 
 	inline algorithm_type8 compressed_tracks::get_algorithm_type() const { return acl_impl::get_tracks_header(*this).algorithm_type; }
@@ -144,7 +228,7 @@ namespace acl
 			return "";	// No metadata is stored
 
 		const acl_impl::optional_metadata_header& metadata_header = acl_impl::get_optional_metadata_header(*this);
-		if (!metadata_header.track_name_offsets.is_valid())
+		if (!metadata_header.track_list_name.is_valid())
 			return "";	// Metadata isn't stored
 
 		return metadata_header.get_track_list_name(*this);
@@ -169,6 +253,56 @@ namespace acl
 		return offset.add_to(track_names_offsets);
 	}
 
+	inline uint32_t compressed_tracks::find_track_index(const char* name) const
+	{
+		const acl_impl::tracks_header& header = acl_impl::get_tracks_header(*this);
+		if (!header.get_has_metadata() || name == nullptr)
+			return k_invalid_track_index;	// No metadata is stored
+
+		const acl_impl::optional_metadata_header& metadata_header = acl_impl::get_optional_metadata_header(*this);
+		if (!metadata_header.track_name_offsets.is_valid())
+			return k_invalid_track_index;	// Metadata isn't stored
+
+		const uint32_t num_tracks = header.num_tracks;
+		const uint32_t* track_names_offsets = metadata_header.get_track_name_offsets(*this);
+
+		if (!header.get_has_track_name_table())
+		{
+			// No table, search linearly
+			for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			{
+				const ptr_offset32<char> offset = track_names_offsets[track_index];
+				if (std::strcmp(offset.add_to(track_names_offsets), name) == 0)
+					return track_index;
+			}
+
+			return k_invalid_track_index;
+		}
+
+		// The table offset follows the name offsets
+		const ptr_offset32<uint32_t> table_offset = track_names_offsets[num_tracks];
+		const uint32_t* table = table_offset.add_to(track_names_offsets);
+		const uint32_t num_slots = table[0];
+		const uint32_t slot_mask = num_slots - 1;
+		const acl_impl::track_name_table_slot* slots = reinterpret_cast<const acl_impl::track_name_table_slot*>(table + 1);
+
+		const uint32_t name_hash = hash32(name);
+
+		// The table is never full, we always find an empty slot
+		for (uint32_t slot_index = name_hash & slot_mask; slots[slot_index].track_index != k_invalid_track_index; slot_index = (slot_index + 1) & slot_mask)
+		{
+			const acl_impl::track_name_table_slot& slot = slots[slot_index];
+			if (slot.name_hash != name_hash)
+				continue;
+
+			const ptr_offset32<char> offset = track_names_offsets[slot.track_index];
+			if (std::strcmp(offset.add_to(track_names_offsets), name) == 0)
+				return slot.track_index;
+		}
+
+		return k_invalid_track_index;
+	}
+
 	inline uint32_t compressed_tracks::get_parent_track_index(uint32_t track_index) const
 	{
 		const acl_impl::tracks_header& header = acl_impl::get_tracks_header(*this);
@@ -289,7 +423,7 @@ namespace acl
 
 		if (check_hash)
 		{
-			const uint32_t hash = hash32(safe_ptr_cast<const uint8_t>(&m_padding[0]), m_buffer_header.size - sizeof(acl_impl::raw_buffer_header));
+			const uint32_t hash = acl_impl::hash_raw_buffer(header.version, safe_ptr_cast<const uint8_t>(&m_padding[0]), m_buffer_header.size - sizeof(acl_impl::raw_buffer_header));
 			if (hash != m_buffer_header.hash)
 				return error_result("Invalid hash");
 		}
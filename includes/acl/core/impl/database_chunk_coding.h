@@ -0,0 +1,99 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "acl/version.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/impl/compressed_headers.h"
+#include "acl/core/impl/entropy_coding.h"
+
+#include <cstdint>
+#include <cstring>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		// Encodes a single chunk of an entropy coded tier along with its encoded chunk header
+		// The output must be large enough to hold the chunk and its encoded chunk header
+		// We only retain the entropy coded data if it is smaller than the chunk itself
+		// Returns the size of the encoded chunk
+		inline uint32_t encode_database_chunk(const uint8_t* chunk_data, uint32_t chunk_size, uint8_t* encoded_chunk)
+		{
+			uint8_t* encoded_chunk_data = encoded_chunk + sizeof(database_encoded_chunk_header);
+
+			database_encoded_chunk_header encoded_chunk_header;
+			uint32_t encoded_chunk_data_size = rans_encode(chunk_data, chunk_size, encoded_chunk_data, chunk_size);
+			if (encoded_chunk_data_size != 0)
+				encoded_chunk_header.encoding = database_chunk_encoding::rans;
+			else
+			{
+				encoded_chunk_header.encoding = database_chunk_encoding::stored;
+				std::memcpy(encoded_chunk_data, chunk_data, chunk_size);
+				encoded_chunk_data_size = chunk_size;
+			}
+
+			std::memcpy(encoded_chunk, &encoded_chunk_header, sizeof(database_encoded_chunk_header));
+
+			return uint32_t(sizeof(database_encoded_chunk_header)) + encoded_chunk_data_size;
+		}
+
+		// Decodes a single chunk written by 'encode_database_chunk(..)'
+		inline bool decode_database_chunk(const uint8_t* encoded_chunk, uint32_t encoded_chunk_size, uint8_t* chunk_data, uint32_t chunk_size)
+		{
+			if (encoded_chunk_size < sizeof(database_encoded_chunk_header))
+				return false;
+
+			database_encoded_chunk_header encoded_chunk_header;
+			std::memcpy(&encoded_chunk_header, encoded_chunk, sizeof(database_encoded_chunk_header));
+
+			const uint8_t* encoded_chunk_data = encoded_chunk + sizeof(database_encoded_chunk_header);
+			const uint32_t encoded_chunk_data_size = encoded_chunk_size - uint32_t(sizeof(database_encoded_chunk_header));
+
+			switch (encoded_chunk_header.encoding)
+			{
+			case database_chunk_encoding::stored:
+				if (encoded_chunk_data_size != chunk_size)
+					return false;
+
+				std::memcpy(chunk_data, encoded_chunk_data, chunk_size);
+				return true;
+			case database_chunk_encoding::rans:
+				return rans_decode(encoded_chunk_data, encoded_chunk_data_size, chunk_data, chunk_size);
+			default:
+				return false;	// Unknown encoding
+			}
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
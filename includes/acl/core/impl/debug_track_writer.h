@@ -102,6 +102,17 @@ namespace acl
 				rtm::scalar_store(value, &tracks_typed.float1f[track_index]);
 			}
 
+			//////////////////////////////////////////////////////////////////////////
+			// Float1f tracks are stored contiguously, we can write 4 at a time.
+			static constexpr bool supports_float1_batch_output() { return true; }
+
+			void RTM_SIMD_CALL write_float1_batch(uint32_t first_track_index, rtm::vector4f_arg0 values)
+			{
+				ACL_ASSERT(type == track_type8::float1f, "Unexpected track type access");
+				ACL_ASSERT(first_track_index + 4 <= num_tracks, "Invalid track index");
+				rtm::vector_store(values, &tracks_typed.float1f[first_track_index]);
+			}
+
 			float RTM_SIMD_CALL read_float1(uint32_t track_index) const
 			{
 				ACL_ASSERT(type == track_type8::float1f, "Unexpected track type access");
@@ -0,0 +1,419 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/error.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <cstdint>
+#include <cstring>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// A static byte oriented rANS (range asymmetric numeral system) entropy coder.
+		//
+		// Encoded data has the following layout:
+		// [ symbol frequencies (256x uint16_t), coder state (uint32_t), renormalization bytes ... ]
+		// Every value is stored in little endian. The frequencies are normalized to sum up to
+		// 'k_rans_probability_scale' and they are stored once for the whole input.
+		// A compact frequency table variant is also provided, see 'rans_encode_compact(..)'.
+		//
+		// The encoder runs backwards over its input so that the decoder can run forward and
+		// write its output linearly.
+		//////////////////////////////////////////////////////////////////////////
+
+		constexpr uint32_t k_rans_num_symbols = 256;
+		constexpr uint32_t k_rans_probability_bits = 12;
+		constexpr uint32_t k_rans_probability_scale = 1 << k_rans_probability_bits;
+		constexpr uint32_t k_rans_state_lower_bound = 1 << 23;
+
+		constexpr uint32_t k_rans_frequency_table_size = k_rans_num_symbols * sizeof(uint16_t);
+		constexpr uint32_t k_rans_min_encoded_size = k_rans_frequency_table_size + sizeof(uint32_t);
+
+		// Scales the symbol counts to frequencies that add up to our probability scale
+		// Every symbol present in the input retains a non-zero frequency
+		inline void rans_normalize_frequencies(const uint32_t counts[k_rans_num_symbols], uint32_t num_values, uint32_t out_frequencies[k_rans_num_symbols])
+		{
+			uint32_t frequency_sum = 0;
+			for (uint32_t symbol = 0; symbol < k_rans_num_symbols; ++symbol)
+			{
+				uint32_t frequency = 0;
+				if (counts[symbol] != 0)
+				{
+					frequency = uint32_t((uint64_t(counts[symbol]) * k_rans_probability_scale) / num_values);
+					frequency = frequency != 0 ? frequency : 1;
+				}
+
+				out_frequencies[symbol] = frequency;
+				frequency_sum += frequency;
+			}
+
+			// Rounding leaves us slightly off, steal from or give to the most frequent symbols
+			while (frequency_sum != k_rans_probability_scale)
+			{
+				uint32_t largest_symbol = 0;
+				for (uint32_t symbol = 1; symbol < k_rans_num_symbols; ++symbol)
+				{
+					if (out_frequencies[symbol] > out_frequencies[largest_symbol])
+						largest_symbol = symbol;
+				}
+
+				if (frequency_sum > k_rans_probability_scale)
+				{
+					ACL_ASSERT(out_frequencies[largest_symbol] > 1, "Cannot remove the last frequency of a symbol");
+					out_frequencies[largest_symbol]--;
+					frequency_sum--;
+				}
+				else
+				{
+					out_frequencies[largest_symbol]++;
+					frequency_sum++;
+				}
+			}
+		}
+
+		// Counts the symbols of the input and normalizes them into frequencies
+		inline void rans_build_frequencies(const uint8_t* input, uint32_t input_size, uint32_t out_frequencies[k_rans_num_symbols])
+		{
+			uint32_t counts[k_rans_num_symbols] = { 0 };
+			for (uint32_t value_index = 0; value_index < input_size; ++value_index)
+				counts[input[value_index]]++;
+
+			rans_normalize_frequencies(counts, input_size, out_frequencies);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Entropy codes the input with the provided frequencies into the output buffer.
+		// Only the coder state and the renormalization bytes are written, the frequencies must be stored separately.
+		// Returns the size in bytes of the encoded data or 0 if it does not fit within the output capacity.
+		inline uint32_t rans_encode_stream(const uint8_t* input, uint32_t input_size, const uint32_t frequencies[k_rans_num_symbols], uint8_t* output, uint32_t output_capacity)
+		{
+			uint32_t cumulative_frequencies[k_rans_num_symbols];
+			uint32_t cumulative_frequency = 0;
+			for (uint32_t symbol = 0; symbol < k_rans_num_symbols; ++symbol)
+			{
+				cumulative_frequencies[symbol] = cumulative_frequency;
+				cumulative_frequency += frequencies[symbol];
+			}
+
+			// We write backwards from the end of our output buffer and move the data in place once we are done
+			uint8_t* stream_begin = output;
+			uint8_t* stream_ptr = output + output_capacity;
+
+			uint32_t state = k_rans_state_lower_bound;
+			for (uint32_t value_index = input_size; value_index-- > 0;)
+			{
+				const uint32_t symbol = input[value_index];
+				const uint32_t frequency = frequencies[symbol];
+
+				// Renormalize to keep our state within [lower bound, lower bound * 256)
+				const uint32_t max_state = ((k_rans_state_lower_bound >> k_rans_probability_bits) << 8) * frequency;
+				while (state >= max_state)
+				{
+					if (stream_ptr == stream_begin)
+						return 0;	// Ran out of space
+
+					*--stream_ptr = uint8_t(state);
+					state >>= 8;
+				}
+
+				state = ((state / frequency) << k_rans_probability_bits) + (state % frequency) + cumulative_frequencies[symbol];
+			}
+
+			// Flush our final state
+			if (uint32_t(stream_ptr - stream_begin) < sizeof(uint32_t))
+				return 0;	// Ran out of space
+
+			stream_ptr -= sizeof(uint32_t);
+			stream_ptr[0] = uint8_t(state);
+			stream_ptr[1] = uint8_t(state >> 8);
+			stream_ptr[2] = uint8_t(state >> 16);
+			stream_ptr[3] = uint8_t(state >> 24);
+
+			const uint32_t stream_size = uint32_t(output + output_capacity - stream_ptr);
+			std::memmove(stream_begin, stream_ptr, stream_size);
+
+			return stream_size;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Decodes data written by 'rans_encode_stream(..)' with the same frequencies into the output buffer.
+		// The frequencies must add up to 'k_rans_probability_scale' and the output size must match the original input size.
+		// Returns false if the encoded data or the frequencies are malformed.
+		inline bool rans_decode_stream(const uint8_t* input, uint32_t input_size, const uint32_t frequencies[k_rans_num_symbols], uint8_t* output, uint32_t output_size)
+		{
+			if (input_size < sizeof(uint32_t))
+				return false;
+
+			uint32_t cumulative_frequencies[k_rans_num_symbols];
+			uint8_t slot_symbols[k_rans_probability_scale];
+
+			uint32_t cumulative_frequency = 0;
+			for (uint32_t symbol = 0; symbol < k_rans_num_symbols; ++symbol)
+			{
+				const uint32_t frequency = frequencies[symbol];
+				if (frequency > k_rans_probability_scale - cumulative_frequency)
+					return false;	// Frequencies add up to more than our scale
+
+				cumulative_frequencies[symbol] = cumulative_frequency;
+
+				std::memset(&slot_symbols[cumulative_frequency], int(symbol), frequency);
+				cumulative_frequency += frequency;
+			}
+
+			if (cumulative_frequency != k_rans_probability_scale)
+				return false;	// Frequencies add up to less than our scale, some slots have no symbol
+
+			const uint8_t* stream_ptr = input;
+			const uint8_t* stream_end = input + input_size;
+
+			uint32_t state = uint32_t(stream_ptr[0]) | (uint32_t(stream_ptr[1]) << 8) | (uint32_t(stream_ptr[2]) << 16) | (uint32_t(stream_ptr[3]) << 24);
+			stream_ptr += sizeof(uint32_t);
+
+			for (uint32_t value_index = 0; value_index < output_size; ++value_index)
+			{
+				const uint32_t slot = state & (k_rans_probability_scale - 1);
+				const uint32_t symbol = slot_symbols[slot];
+
+				state = frequencies[symbol] * (state >> k_rans_probability_bits) + slot - cumulative_frequencies[symbol];
+
+				// Renormalize
+				while (state < k_rans_state_lower_bound)
+				{
+					if (stream_ptr == stream_end)
+						return false;	// Truncated data
+
+					state = (state << 8) | *stream_ptr++;
+				}
+
+				output[value_index] = uint8_t(symbol);
+			}
+
+			// The encoder started from the lower bound and every byte must have been consumed
+			return state == k_rans_state_lower_bound && stream_ptr == stream_end;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Entropy codes the input into the output buffer.
+		// Returns the size in bytes of the encoded data or 0 if it does not fit within the output capacity.
+		inline uint32_t rans_encode(const uint8_t* input, uint32_t input_size, uint8_t* output, uint32_t output_capacity)
+		{
+			if (input_size == 0 || output_capacity < k_rans_min_encoded_size)
+				return 0;
+
+			uint32_t frequencies[k_rans_num_symbols];
+			rans_build_frequencies(input, input_size, frequencies);
+
+			for (uint32_t symbol = 0; symbol < k_rans_num_symbols; ++symbol)
+			{
+				output[symbol * 2 + 0] = uint8_t(frequencies[symbol]);
+				output[symbol * 2 + 1] = uint8_t(frequencies[symbol] >> 8);
+			}
+
+			const uint32_t stream_size = rans_encode_stream(input, input_size, frequencies, output + k_rans_frequency_table_size, output_capacity - k_rans_frequency_table_size);
+			if (stream_size == 0)
+				return 0;	// Ran out of space
+
+			return k_rans_frequency_table_size + stream_size;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Decodes entropy coded data written by 'rans_encode(..)' into the output buffer.
+		// The output size must match the original input size.
+		// Returns false if the encoded data is malformed.
+		inline bool rans_decode(const uint8_t* input, uint32_t input_size, uint8_t* output, uint32_t output_size)
+		{
+			if (input_size < k_rans_min_encoded_size)
+				return false;
+
+			uint32_t frequencies[k_rans_num_symbols];
+
+			uint32_t frequency_sum = 0;
+			for (uint32_t symbol = 0; symbol < k_rans_num_symbols; ++symbol)
+			{
+				const uint32_t frequency = uint32_t(input[symbol * 2 + 0]) | (uint32_t(input[symbol * 2 + 1]) << 8);
+				if (frequency > k_rans_probability_scale - frequency_sum)
+					return false;	// Frequencies add up to more than our scale
+
+				frequencies[symbol] = frequency;
+				frequency_sum += frequency;
+			}
+
+			if (frequency_sum != k_rans_probability_scale)
+				return false;
+
+			return rans_decode_stream(input + k_rans_frequency_table_size, input_size - k_rans_frequency_table_size, frequencies, output, output_size);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// A compact variant of the frequency table for small inputs where a full table would dominate.
+		// Each symbol in order stores its frequency in one byte if it is below 128 or in two bytes otherwise,
+		// the high bit of the first byte flagging the two byte form. A zero frequency is followed by a byte
+		// holding how many of the following symbols also have a zero frequency.
+		//
+		// Compact encoded data has the following layout:
+		// [ compact symbol frequencies, coder state (uint32_t), renormalization bytes ... ]
+
+		// Writes the compact frequency table into the output buffer.
+		// Returns the size in bytes written or 0 if it does not fit within the output capacity.
+		inline uint32_t rans_write_compact_frequencies(const uint32_t frequencies[k_rans_num_symbols], uint8_t* output, uint32_t output_capacity)
+		{
+			uint32_t output_size = 0;
+			for (uint32_t symbol = 0; symbol < k_rans_num_symbols;)
+			{
+				const uint32_t frequency = frequencies[symbol];
+				if (frequency == 0)
+				{
+					uint32_t num_zeros = 1;
+					while (symbol + num_zeros < k_rans_num_symbols && num_zeros <= 255 && frequencies[symbol + num_zeros] == 0)
+						num_zeros++;
+
+					if (output_capacity - output_size < 2)
+						return 0;
+
+					output[output_size++] = 0;
+					output[output_size++] = uint8_t(num_zeros - 1);
+					symbol += num_zeros;
+				}
+				else if (frequency < 128)
+				{
+					if (output_capacity - output_size < 1)
+						return 0;
+
+					output[output_size++] = uint8_t(frequency);
+					symbol++;
+				}
+				else
+				{
+					if (output_capacity - output_size < 2)
+						return 0;
+
+					output[output_size++] = uint8_t(0x80 | (frequency >> 8));
+					output[output_size++] = uint8_t(frequency);
+					symbol++;
+				}
+			}
+
+			return output_size;
+		}
+
+		// Reads a compact frequency table written by 'rans_write_compact_frequencies(..)'.
+		// Returns the size in bytes read or 0 if the table is malformed.
+		inline uint32_t rans_read_compact_frequencies(const uint8_t* input, uint32_t input_size, uint32_t out_frequencies[k_rans_num_symbols])
+		{
+			uint32_t input_offset = 0;
+			uint32_t frequency_sum = 0;
+			for (uint32_t symbol = 0; symbol < k_rans_num_symbols;)
+			{
+				if (input_offset >= input_size)
+					return 0;	// Truncated data
+
+				const uint32_t value = input[input_offset++];
+				if (value == 0)
+				{
+					if (input_offset >= input_size)
+						return 0;	// Truncated data
+
+					const uint32_t num_zeros = uint32_t(input[input_offset++]) + 1;
+					if (num_zeros > k_rans_num_symbols - symbol)
+						return 0;	// Too many symbols
+
+					for (uint32_t zero_index = 0; zero_index < num_zeros; ++zero_index)
+						out_frequencies[symbol++] = 0;
+
+					continue;
+				}
+
+				uint32_t frequency = value;
+				if ((value & 0x80) != 0)
+				{
+					if (input_offset >= input_size)
+						return 0;	// Truncated data
+
+					frequency = ((value & 0x7F) << 8) | input[input_offset++];
+				}
+
+				if (frequency > k_rans_probability_scale - frequency_sum)
+					return 0;	// Frequencies add up to more than our scale
+
+				out_frequencies[symbol++] = frequency;
+				frequency_sum += frequency;
+			}
+
+			if (frequency_sum != k_rans_probability_scale)
+				return 0;
+
+			return input_offset;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Entropy codes the input into the output buffer with a compact frequency table.
+		// Returns the size in bytes of the encoded data or 0 if it does not fit within the output capacity.
+		inline uint32_t rans_encode_compact(const uint8_t* input, uint32_t input_size, uint8_t* output, uint32_t output_capacity)
+		{
+			if (input_size == 0)
+				return 0;
+
+			uint32_t frequencies[k_rans_num_symbols];
+			rans_build_frequencies(input, input_size, frequencies);
+
+			const uint32_t table_size = rans_write_compact_frequencies(frequencies, output, output_capacity);
+			if (table_size == 0)
+				return 0;	// Ran out of space
+
+			const uint32_t stream_size = rans_encode_stream(input, input_size, frequencies, output + table_size, output_capacity - table_size);
+			if (stream_size == 0)
+				return 0;	// Ran out of space
+
+			return table_size + stream_size;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Decodes entropy coded data written by 'rans_encode_compact(..)' into the output buffer.
+		// The output size must match the original input size.
+		// Returns false if the encoded data is malformed.
+		inline bool rans_decode_compact(const uint8_t* input, uint32_t input_size, uint8_t* output, uint32_t output_size)
+		{
+			uint32_t frequencies[k_rans_num_symbols];
+			const uint32_t table_size = rans_read_compact_frequencies(input, input_size, frequencies);
+			if (table_size == 0)
+				return false;
+
+			return rans_decode_stream(input + table_size, input_size - table_size, frequencies, output, output_size);
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,402 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/bit_manip_utils.h"
+#include "acl/core/error.h"
+#include "acl/core/memory_utils.h"
+#include "acl/core/track_types.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/impl/compressed_headers.h"
+
+#include <rtm/math.h>
+
+#include <cstdint>
+#include <cstring>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Packed compressed tracks are built from a series of regions, each belonging to a stream.
+		// The regions are found by reading the compressed tracks headers which are stored
+		// in the first stream. This allows the unpacking to find the same regions without
+		// storing them.
+		//////////////////////////////////////////////////////////////////////////
+
+		enum class packed_region_type
+		{
+			// The region is copied as is
+			bytes,
+
+			// The region holds 32 bit values split into byte planes
+			value_planes,
+
+			// The region holds bit packed rows that are transposed
+			bit_matrix,
+		};
+
+		struct packed_region
+		{
+			packed_stream		stream;
+			packed_region_type	type;
+
+			// Offset and size in bytes within the compressed tracks
+			uint32_t			offset;
+			uint32_t			size;
+
+			// Only used by bit matrices
+			uint32_t			num_rows;
+			uint32_t			num_row_bits;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the size in bytes of the headers stream or 0 if the headers do not fit within the buffer.
+		inline uint32_t get_packed_headers_size(const uint8_t* tracks_buffer, uint32_t buffer_size)
+		{
+			const uint32_t header_offset = sizeof(raw_buffer_header) + sizeof(tracks_header);
+			if (buffer_size < header_offset)
+				return 0;
+
+			const tracks_header& header = *reinterpret_cast<const tracks_header*>(tracks_buffer + sizeof(raw_buffer_header));
+
+			uint64_t headers_size;
+			if (header.track_type == track_type8::qvvf)
+			{
+				if (buffer_size < header_offset + sizeof(transform_tracks_header))
+					return 0;
+
+				const transform_tracks_header& transform_header = *reinterpret_cast<const transform_tracks_header*>(tracks_buffer + header_offset);
+				headers_size = uint64_t(header_offset) + uint32_t(transform_header.constant_track_data_offset);
+			}
+			else
+			{
+				if (buffer_size < header_offset + sizeof(scalar_tracks_header))
+					return 0;
+
+				const scalar_tracks_header& scalar_header = *reinterpret_cast<const scalar_tracks_header*>(tracks_buffer + header_offset);
+				headers_size = uint64_t(header_offset) + uint32_t(scalar_header.track_constant_values);
+			}
+
+			return headers_size <= buffer_size ? uint32_t(headers_size) : 0;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Calls the visitor with every region that follows the headers stream, in order.
+		// The regions cover the rest of the buffer without overlapping.
+		// Only the headers stream needs to be valid within the buffer.
+		// Returns false if the headers are malformed.
+		template<class region_visitor_type>
+		inline bool visit_packed_regions(const uint8_t* tracks_buffer, uint32_t headers_size, uint32_t buffer_size, region_visitor_type& visitor)
+		{
+			if (headers_size == 0 || headers_size != get_packed_headers_size(tracks_buffer, headers_size))
+				return false;	// Headers must end where the constant track data starts
+
+			const auto visit = [&visitor](packed_stream stream, packed_region_type type, uint32_t offset, uint32_t size, uint32_t num_rows, uint32_t num_row_bits)
+			{
+				if (size == 0)
+					return;
+
+				packed_region region;
+				region.stream = stream;
+				region.type = type;
+				region.offset = offset;
+				region.size = size;
+				region.num_rows = num_rows;
+				region.num_row_bits = num_row_bits;
+				visitor(region);
+			};
+
+			// Bit packed rows must fit within their limit, otherwise they are copied as is
+			const auto visit_animated_data = [&visit](packed_stream fallback_stream, uint32_t offset, uint32_t limit, uint32_t num_rows, uint32_t num_row_bits) -> uint32_t
+			{
+				const uint64_t size = ((uint64_t(num_rows) * num_row_bits) + 7) / 8;
+				if (offset + size > limit)
+				{
+					visit(fallback_stream, packed_region_type::bytes, offset, limit - offset, 0, 0);
+					return limit;
+				}
+
+				visit(packed_stream::animated_bits, packed_region_type::bit_matrix, offset, uint32_t(size), num_rows, num_row_bits);
+				return offset + uint32_t(size);
+			};
+
+			const uint32_t header_offset = sizeof(raw_buffer_header) + sizeof(tracks_header);
+			const tracks_header& header = *reinterpret_cast<const tracks_header*>(tracks_buffer + sizeof(raw_buffer_header));
+
+			if (header.track_type != track_type8::qvvf)
+			{
+				const scalar_tracks_header& scalar_header = *reinterpret_cast<const scalar_tracks_header*>(tracks_buffer + header_offset);
+
+				const uint64_t animated_offset = uint64_t(header_offset) + uint32_t(scalar_header.track_animated_values);
+				if (animated_offset < headers_size || animated_offset > buffer_size)
+					return false;
+
+				visit(packed_stream::value_plane0, packed_region_type::value_planes, headers_size, uint32_t(animated_offset) - headers_size, 0, 0);
+
+				const uint32_t animated_end = visit_animated_data(packed_stream::trailing_data, uint32_t(animated_offset), buffer_size, header.num_samples, scalar_header.num_bits_per_frame);
+
+				visit(packed_stream::trailing_data, packed_region_type::bytes, animated_end, buffer_size - animated_end, 0, 0);
+				return true;
+			}
+
+			const transform_tracks_header& transform_header = *reinterpret_cast<const transform_tracks_header*>(tracks_buffer + header_offset);
+			const uint32_t num_segments = transform_header.num_segments;
+			if (num_segments == 0)
+			{
+				visit(packed_stream::trailing_data, packed_region_type::bytes, headers_size, buffer_size - headers_size, 0, 0);
+				return true;
+			}
+
+			// Stripped segment headers contain the sample indices they retain
+			const bool has_sample_indices = header.get_has_database() || header.get_has_stripped_keyframes();
+			const uint32_t segment_header_size = has_sample_indices ? sizeof(stripped_segment_header_t) : sizeof(segment_header);
+
+			const uint64_t segment_headers_offset = uint64_t(header_offset) + uint32_t(transform_header.segment_headers_offset);
+			if (segment_headers_offset + uint64_t(num_segments) * segment_header_size > headers_size)
+				return false;
+
+			const uint32_t* segment_start_indices = nullptr;
+			if (transform_header.has_multiple_segments())
+			{
+				const uint64_t segment_start_indices_offset = header_offset + align_to(sizeof(transform_tracks_header), 4);
+				if (segment_start_indices_offset + (uint64_t(num_segments) + 1) * sizeof(uint32_t) > headers_size)
+					return false;
+
+				segment_start_indices = transform_header.get_segment_start_indices();
+			}
+
+			const uint8_t* segment_headers = tracks_buffer + segment_headers_offset;
+			const auto get_segment_data_offset = [&](uint32_t segment_index)
+			{
+				return uint64_t(header_offset) + uint32_t(reinterpret_cast<const segment_header*>(segment_headers + segment_index * segment_header_size)->segment_data);
+			};
+
+			const uint64_t segment_data_offset = get_segment_data_offset(0);
+			if (segment_data_offset < headers_size || segment_data_offset > buffer_size)
+				return false;
+
+			visit(packed_stream::value_plane0, packed_region_type::value_planes, headers_size, uint32_t(segment_data_offset) - headers_size, 0, 0);
+
+			const uint32_t format_per_track_data_size = transform_header.num_animated_variable_sub_tracks;
+			const uint32_t range_data_size = transform_header.has_multiple_segments() ? (k_segment_range_reduction_num_bytes_per_component * 6 * transform_header.num_animated_variable_sub_tracks) : 0;
+
+			uint32_t offset = uint32_t(segment_data_offset);
+			for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+			{
+				const segment_header& segment = *reinterpret_cast<const segment_header*>(segment_headers + segment_index * segment_header_size);
+
+				const uint64_t segment_offset = get_segment_data_offset(segment_index);
+				const uint64_t segment_limit = (segment_index + 1) < num_segments ? get_segment_data_offset(segment_index + 1) : buffer_size;
+
+				// Segment data follows the layout from 'transform_tracks_header::get_segment_data(..)'
+				const uint64_t animated_offset = align_to(align_to(segment_offset + format_per_track_data_size, 2) + range_data_size, 4);
+
+				if (segment_offset < offset || animated_offset > segment_limit || segment_limit > buffer_size)
+					return false;
+
+				uint32_t num_samples;
+				if (has_sample_indices)
+					num_samples = count_set_bits(reinterpret_cast<const stripped_segment_header_t&>(segment).sample_indices);
+				else if (segment_start_indices != nullptr)
+				{
+					const uint32_t segment_end_index = (segment_index + 1) < num_segments ? segment_start_indices[segment_index + 1] : header.num_samples;
+					num_samples = segment_end_index >= segment_start_indices[segment_index] ? (segment_end_index - segment_start_indices[segment_index]) : 0;
+				}
+				else
+					num_samples = header.num_samples;
+
+				visit(packed_stream::segment_data, packed_region_type::bytes, offset, uint32_t(animated_offset) - offset, 0, 0);
+
+				offset = visit_animated_data(packed_stream::segment_data, uint32_t(animated_offset), uint32_t(segment_limit), num_samples, segment.animated_pose_bit_size);
+
+				// Any padding up to the next segment
+				if ((segment_index + 1) < num_segments)
+				{
+					visit(packed_stream::segment_data, packed_region_type::bytes, offset, uint32_t(segment_limit) - offset, 0, 0);
+					offset = uint32_t(segment_limit);
+				}
+			}
+
+			visit(packed_stream::trailing_data, packed_region_type::bytes, offset, buffer_size - offset, 0, 0);
+			return true;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Region transforms
+
+		// Number of bytes a region contributes to each value plane stream
+		inline uint32_t get_value_plane_size(uint32_t region_size, uint32_t plane_index)
+		{
+			const uint32_t num_values = region_size / 4;
+			return plane_index == 3 ? (num_values + (region_size % 4)) : num_values;
+		}
+
+		// Splits the 32 bit values of the input into byte planes
+		// The trailing bytes that do not form a whole value are appended to the last plane
+		inline void split_value_planes(const uint8_t* input, uint32_t input_size, uint8_t* out_planes[4])
+		{
+			const uint32_t num_values = input_size / 4;
+			for (uint32_t value_index = 0; value_index < num_values; ++value_index)
+			{
+				out_planes[0][value_index] = input[value_index * 4 + 0];
+				out_planes[1][value_index] = input[value_index * 4 + 1];
+				out_planes[2][value_index] = input[value_index * 4 + 2];
+				out_planes[3][value_index] = input[value_index * 4 + 3];
+			}
+
+			std::memcpy(out_planes[3] + num_values, input + num_values * 4, input_size % 4);
+		}
+
+		// Interleaves byte planes back into 32 bit values, the inverse of 'split_value_planes(..)'
+		inline void merge_value_planes(const uint8_t* const planes[4], uint32_t output_size, uint8_t* output)
+		{
+			const uint32_t num_values = output_size / 4;
+			uint32_t value_index = 0;
+
+#if defined(RTM_SSE2_INTRINSICS)
+			for (; value_index + 16 <= num_values; value_index += 16)
+			{
+				const __m128i plane0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[0] + value_index));
+				const __m128i plane1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[1] + value_index));
+				const __m128i plane2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[2] + value_index));
+				const __m128i plane3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[3] + value_index));
+
+				const __m128i plane01_lo = _mm_unpacklo_epi8(plane0, plane1);
+				const __m128i plane01_hi = _mm_unpackhi_epi8(plane0, plane1);
+				const __m128i plane23_lo = _mm_unpacklo_epi8(plane2, plane3);
+				const __m128i plane23_hi = _mm_unpackhi_epi8(plane2, plane3);
+
+				__m128i* values = reinterpret_cast<__m128i*>(output + value_index * 4);
+				_mm_storeu_si128(values + 0, _mm_unpacklo_epi16(plane01_lo, plane23_lo));
+				_mm_storeu_si128(values + 1, _mm_unpackhi_epi16(plane01_lo, plane23_lo));
+				_mm_storeu_si128(values + 2, _mm_unpacklo_epi16(plane01_hi, plane23_hi));
+				_mm_storeu_si128(values + 3, _mm_unpackhi_epi16(plane01_hi, plane23_hi));
+			}
+#elif defined(RTM_NEON_INTRINSICS)
+			for (; value_index + 16 <= num_values; value_index += 16)
+			{
+				uint8x16x4_t values;
+				values.val[0] = vld1q_u8(planes[0] + value_index);
+				values.val[1] = vld1q_u8(planes[1] + value_index);
+				values.val[2] = vld1q_u8(planes[2] + value_index);
+				values.val[3] = vld1q_u8(planes[3] + value_index);
+
+				vst4q_u8(output + value_index * 4, values);
+			}
+#endif
+
+			for (; value_index < num_values; ++value_index)
+			{
+				output[value_index * 4 + 0] = planes[0][value_index];
+				output[value_index * 4 + 1] = planes[1][value_index];
+				output[value_index * 4 + 2] = planes[2][value_index];
+				output[value_index * 4 + 3] = planes[3][value_index];
+			}
+
+			std::memcpy(output + num_values * 4, planes[3] + num_values, output_size % 4);
+		}
+
+		// Bits are read and written from the most significant bit of every byte, like our bit packed samples
+		inline uint32_t read_packed_bit(const uint8_t* buffer, uint64_t bit_offset)
+		{
+			return (buffer[bit_offset / 8] >> (7 - (bit_offset % 8))) & 1;
+		}
+
+		inline void write_packed_bit(uint8_t* buffer, uint64_t bit_offset, uint32_t bit)
+		{
+			buffer[bit_offset / 8] |= uint8_t(bit << (7 - (bit_offset % 8)));
+		}
+
+		// Trailing bits of the last byte that are beyond the matrix are copied as is
+		inline void copy_bit_matrix_padding(const uint8_t* input, uint32_t size, uint64_t num_bits, uint8_t* output)
+		{
+			const uint32_t num_padding_bits = uint32_t((uint64_t(size) * 8) - num_bits);
+			if (num_padding_bits != 0)
+			{
+				const uint8_t padding_mask = uint8_t((1 << num_padding_bits) - 1);
+				output[size - 1] |= input[size - 1] & padding_mask;
+			}
+		}
+
+		// Transposes bit packed rows so that every bit position of a row is contiguous across rows
+		// When rows are animated samples, their high order bits rarely change and the transposed bytes are mostly uniform
+		inline void transpose_bit_matrix(const uint8_t* input, uint32_t size, uint32_t num_rows, uint32_t num_row_bits, uint8_t* output)
+		{
+			std::memset(output, 0, size);
+
+			for (uint32_t row_index = 0; row_index < num_rows; ++row_index)
+			{
+				const uint64_t row_offset = uint64_t(row_index) * num_row_bits;
+				for (uint32_t bit_index = 0; bit_index < num_row_bits; ++bit_index)
+					write_packed_bit(output, uint64_t(bit_index) * num_rows + row_index, read_packed_bit(input, row_offset + bit_index));
+			}
+
+			copy_bit_matrix_padding(input, size, uint64_t(num_rows) * num_row_bits, output);
+		}
+
+		// Restores bit packed rows transposed by 'transpose_bit_matrix(..)'
+		inline void untranspose_bit_matrix(const uint8_t* input, uint32_t size, uint32_t num_rows, uint32_t num_row_bits, uint8_t* output)
+		{
+			std::memset(output, 0, size);
+
+			for (uint32_t bit_index = 0; bit_index < num_row_bits; ++bit_index)
+			{
+				const uint64_t column_offset = uint64_t(bit_index) * num_rows;
+				for (uint32_t row_index = 0; row_index < num_rows; ++row_index)
+					write_packed_bit(output, uint64_t(row_index) * num_row_bits + bit_index, read_packed_bit(input, column_offset + row_index));
+			}
+
+			copy_bit_matrix_padding(input, size, uint64_t(num_rows) * num_row_bits, output);
+		}
+
+		// Sums up the size in bytes of every stream from the regions it visits
+		struct packed_stream_size_counter
+		{
+			uint32_t stream_sizes[k_num_packed_streams];
+
+			void operator()(const packed_region& region)
+			{
+				if (region.type == packed_region_type::value_planes)
+				{
+					for (uint32_t plane_index = 0; plane_index < 4; ++plane_index)
+						stream_sizes[static_cast<uint32_t>(packed_stream::value_plane0) + plane_index] += get_value_plane_size(region.size, plane_index);
+				}
+				else
+					stream_sizes[static_cast<uint32_t>(region.stream)] += region.size;
+			}
+		};
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
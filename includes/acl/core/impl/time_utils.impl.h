@@ -111,6 +111,31 @@ namespace acl
 		return float(num_samples - 1) / sample_rate;
 	}
 
+	inline float advance_sample_time(float sample_time, float delta_time, float duration, sample_looping_policy looping_policy)
+	{
+		ACL_ASSERT(duration >= 0.0F && rtm::scalar_is_finite(duration), "Invalid duration: %f", duration);
+		ACL_ASSERT(rtm::scalar_is_finite(delta_time), "Invalid delta time: %f", delta_time);
+		ACL_ASSERT(looping_policy != sample_looping_policy::as_compressed, "As compressed looping policy is not supported");
+
+		float new_sample_time = sample_time + delta_time;
+
+		if (looping_policy == sample_looping_policy::wrap && duration > 0.0F)
+		{
+			// Playback typically advances by less than the duration, a single step brings us back in range
+			if (new_sample_time > duration)
+				new_sample_time -= duration;
+			else if (new_sample_time < 0.0F)
+				new_sample_time += duration;
+
+			// Large steps are rare, only then do we pay for the division
+			if (new_sample_time < 0.0F || new_sample_time > duration)
+				new_sample_time -= rtm::scalar_floor(new_sample_time / duration) * duration;
+		}
+
+		// Clamp for safety as well, floating point rounding can leave us slightly outside the range
+		return rtm::scalar_clamp(new_sample_time, 0.0F, duration);
+	}
+
 	ACL_IMPL_VERSION_NAMESPACE_END
 }
 
@@ -55,6 +55,9 @@ namespace acl
 		if (shell_distance < 0.0F || !rtm::scalar_is_finite(shell_distance))
 			return error_result("Invalid shell_distance");
 
+		if (importance < 0.0F || !rtm::scalar_is_finite(importance))
+			return error_result("Invalid importance");
+
 		if (!rtm::qvv_is_finite(default_value))
 			return error_result("Invalid default_value must be finite");
 
@@ -43,6 +43,8 @@ namespace acl
 		case rotation_format8::quatf_full:				return "quatf_full";
 		case rotation_format8::quatf_drop_w_full:		return "quatf_drop_w_full";
 		case rotation_format8::quatf_drop_w_variable:	return "quatf_drop_w_variable";
+		case rotation_format8::quatf_drop_largest_variable:	return "quatf_drop_largest_variable";
+		case rotation_format8::quatf_log_variable:		return "quatf_log_variable";
 		default:										return "<Invalid>";
 		}
 	}
@@ -80,12 +82,27 @@ namespace acl
 			return true;
 		}
 
+		const char* quatf_drop_largest_variable_format = "quatf_drop_largest_variable";
+		if (std::strncmp(format, quatf_drop_largest_variable_format, std::strlen(quatf_drop_largest_variable_format)) == 0)
+		{
+			out_format = rotation_format8::quatf_drop_largest_variable;
+			return true;
+		}
+
+		const char* quatf_log_variable_format = "quatf_log_variable";
+		if (std::strncmp(format, quatf_log_variable_format, std::strlen(quatf_log_variable_format)) == 0)
+		{
+			out_format = rotation_format8::quatf_log_variable;
+			return true;
+		}
+
 		return false;
 	}
 
 	constexpr const char* get_vector_format_name(vector_format8 format)
 	{
-		return format == vector_format8::vector3f_full ? "vector3f_full" : "vector3f_variable";
+		return format == vector_format8::vector3f_full ? "vector3f_full"
+			: (format == vector_format8::vector3f_variable ? "vector3f_variable" : "vector3f_variable_per_component");
 	}
 
 	inline bool get_vector_format(const char* format, vector_format8& out_format)
@@ -103,6 +120,14 @@ namespace acl
 			return true;
 		}
 
+		// Must be tested before vector3f_variable since that name is a prefix of this one
+		const char* vector3f_variable_per_component_format = "vector3f_variable_per_component";
+		if (std::strncmp(format, vector3f_variable_per_component_format, std::strlen(vector3f_variable_per_component_format)) == 0)
+		{
+			out_format = vector_format8::vector3f_variable_per_component;
+			return true;
+		}
+
 		const char* vector3_variable_format = "Vector3_Variable";	// ACL_DEPRECATED Legacy name, keep for backwards compatibility, remove in 3.0
 		const char* vector3f_variable_format = "vector3f_variable";
 		if (std::strncmp(format, vector3_variable_format, std::strlen(vector3_variable_format)) == 0
@@ -117,6 +142,9 @@ namespace acl
 
 	constexpr rotation_variant8 get_rotation_variant(rotation_format8 rotation_format)
 	{
+		// Dropping the largest component stores the same three components as dropping W once the
+		// dropped component has been swizzled into the W slot so both share the same variant
+		// The quaternion logarithm also stores three components and its constant sub-tracks drop W
 		return rotation_format == rotation_format8::quatf_full ? rotation_variant8::quat : rotation_variant8::quat_drop_w;
 	}
 
@@ -127,7 +155,7 @@ namespace acl
 
 	constexpr bool is_rotation_format_variable(rotation_format8 format)
 	{
-		return format == rotation_format8::quatf_drop_w_variable;
+		return format == rotation_format8::quatf_drop_w_variable || format == rotation_format8::quatf_drop_largest_variable || format == rotation_format8::quatf_log_variable;
 	}
 
 	constexpr bool is_rotation_format_full_precision(rotation_format8 format)
@@ -137,7 +165,7 @@ namespace acl
 
 	constexpr bool is_vector_format_variable(vector_format8 format)
 	{
-		return format == vector_format8::vector3f_variable;
+		return format == vector_format8::vector3f_variable || format == vector_format8::vector3f_variable_per_component;
 	}
 
 	constexpr bool is_vector_format_full_precision(vector_format8 format)
@@ -52,6 +52,12 @@ namespace acl
 
 		static_assert(k_num_bit_rates == 25, "Expecting 25 bit rates");
 
+		// The per sub-track metadata stores the number of bits in its lower 5 bits
+		// Rotations that drop their largest component store which one in the upper 2 bits
+		// See write_format_per_track_data(..) for details
+		constexpr uint8_t k_num_bits_metadata_mask = 0x1F;
+		constexpr uint32_t k_dropped_component_metadata_shift = 6;
+
 		inline uint32_t get_num_bits_at_bit_rate(uint32_t bit_rate)
 		{
 			ACL_ASSERT(bit_rate <= k_highest_bit_rate, "Invalid bit rate: %u", bit_rate);
@@ -62,6 +68,28 @@ namespace acl
 		constexpr bool is_constant_bit_rate(uint32_t bit_rate) { return bit_rate == 0; }
 		constexpr bool is_raw_bit_rate(uint32_t bit_rate) { return bit_rate == k_highest_bit_rate; }
 
+		// The largest bit rate reduction a vector3 component can have, see get_component_num_bits(..)
+		constexpr uint8_t k_max_component_bit_rate_reduction = k_highest_bit_rate - k_lowest_bit_rate - 1;
+
+		// Bit rate reduction of a component equal to the X component of its sub-track, see is_vector3_uniform(..)
+		constexpr uint8_t k_uniform_component_bit_rate_reduction = 0xFF;
+
+		// Vector formats with a variable number of bits per component reduce the number of bits of the components
+		// with a smaller range than the largest component of their sub-track
+		// Only applies to bit rates that are neither constant nor raw, we always retain at least one bit unless
+		// the component is uniform
+		constexpr uint32_t get_component_num_bits(uint32_t num_bits, uint32_t bit_rate_reduction)
+		{
+			return bit_rate_reduction == k_uniform_component_bit_rate_reduction ? 0 : (num_bits > bit_rate_reduction ? (num_bits - bit_rate_reduction) : 1);
+		}
+
+		// Vector3 sub-tracks with equal components (e.g. uniform scale) only store their X component,
+		// the Y and Z components use this bit rate reduction and are not stored
+		inline bool is_vector3_uniform(const uint8_t bit_rate_reductions[3])
+		{
+			return bit_rate_reductions[1] == k_uniform_component_bit_rate_reduction;
+		}
+
 		struct transform_bit_rates
 		{
 			uint8_t rotation;
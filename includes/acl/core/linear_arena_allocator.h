@@ -0,0 +1,209 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/error.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/memory_utils.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	////////////////////////////////////////////////////////////////////////////////
+	// A linear arena allocator implementation. Memory is carved out of large blocks
+	// obtained from a backing allocator. Individual deallocations are ignored, memory
+	// is reclaimed in bulk by resetting the arena to a marker or to its start.
+	// Blocks are retained across resets which allows the same arena to be reused
+	// without allocating from the backing allocator again.
+	// This allocator is not thread safe.
+	////////////////////////////////////////////////////////////////////////////////
+	class linear_arena_allocator final : public iallocator
+	{
+		struct block_header;
+
+	public:
+		static constexpr size_t k_default_block_size = 1024 * 1024;
+
+		//////////////////////////////////////////////////////////////////////////
+		// A position within the arena that can later be reset to.
+		class marker
+		{
+		public:
+			marker() : m_block(nullptr), m_offset(0) {}
+
+		private:
+			marker(block_header* block, size_t offset) : m_block(block), m_offset(offset) {}
+
+			block_header*	m_block;
+			size_t			m_offset;
+
+			friend linear_arena_allocator;
+		};
+
+		explicit linear_arena_allocator(iallocator& backing_allocator, size_t block_size = k_default_block_size)
+			: iallocator()
+			, m_backing_allocator(backing_allocator)
+			, m_first_block(nullptr)
+			, m_current_block(nullptr)
+			, m_block_size(block_size)
+		{}
+
+		virtual ~linear_arena_allocator() override
+		{
+			block_header* block = m_first_block;
+			while (block != nullptr)
+			{
+				block_header* next_block = block->next;
+				m_backing_allocator.deallocate(block, block->size);
+				block = next_block;
+			}
+		}
+
+		linear_arena_allocator(const linear_arena_allocator&) = delete;
+		linear_arena_allocator& operator=(const linear_arena_allocator&) = delete;
+
+		virtual void* allocate(size_t size, size_t alignment = k_default_alignment) override
+		{
+			ACL_ASSERT(is_power_of_two(alignment), "The alignment must be power of two.");
+
+			// Try the current block first and then any block retained from a previous reset
+			while (m_current_block != nullptr)
+			{
+				void* ptr = m_current_block->allocate(size, alignment);
+				if (ptr != nullptr)
+					return ptr;
+
+				if (m_current_block->next == nullptr)
+					break;
+
+				m_current_block = m_current_block->next;
+				m_current_block->offset = sizeof(block_header);
+			}
+
+			// Every block is full, add a new one large enough for the request
+			const size_t block_size = std::max<size_t>(m_block_size, sizeof(block_header) + size + alignment);
+			block_header* block = static_cast<block_header*>(m_backing_allocator.allocate(block_size, alignof(block_header)));
+			block->next = nullptr;
+			block->size = block_size;
+			block->offset = sizeof(block_header);
+
+			if (m_current_block != nullptr)
+				m_current_block->next = block;
+			else
+				m_first_block = block;
+
+			m_current_block = block;
+
+			void* ptr = block->allocate(size, alignment);
+			ACL_ASSERT(ptr != nullptr, "Failed to allocate from a new block");
+			return ptr;
+		}
+
+		virtual void deallocate(void* ptr, size_t size) override
+		{
+			// Memory is reclaimed when the arena is reset
+			(void)ptr;
+			(void)size;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns a marker for the current arena position.
+		marker get_marker() const
+		{
+			return marker(m_current_block, m_current_block != nullptr ? m_current_block->offset : 0);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Reclaims every allocation made since the marker was obtained, the blocks are retained.
+		void reset(const marker& position)
+		{
+			if (position.m_block == nullptr)
+			{
+				reset();
+				return;
+			}
+
+			m_current_block = position.m_block;
+			m_current_block->offset = position.m_offset;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Reclaims every allocation at once, the blocks are retained.
+		void reset()
+		{
+			m_current_block = m_first_block;
+			if (m_current_block != nullptr)
+				m_current_block->offset = sizeof(block_header);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the total size of the blocks owned by the arena.
+		size_t get_reserved_size() const
+		{
+			size_t reserved_size = 0;
+			for (const block_header* block = m_first_block; block != nullptr; block = block->next)
+				reserved_size += block->size;
+			return reserved_size;
+		}
+
+	private:
+		struct block_header
+		{
+			block_header*	next;
+			size_t			size;
+			size_t			offset;
+
+			void* allocate(size_t alloc_size, size_t alignment)
+			{
+				uint8_t* block_start = reinterpret_cast<uint8_t*>(this);
+				uint8_t* ptr = align_to(block_start + offset, alignment);
+				const size_t alloc_end = size_t(ptr - block_start) + alloc_size;
+				if (alloc_end > size)
+					return nullptr;
+
+				offset = alloc_end;
+				return ptr;
+			}
+		};
+
+		iallocator&		m_backing_allocator;
+		block_header*	m_first_block;
+		block_header*	m_current_block;
+		size_t			m_block_size;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,203 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/error.h"
+#include "acl/core/error_result.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_WIN32)
+	#include <windows.h>
+
+	#define ACL_IMPL_HAS_MAPPED_FILE
+#elif defined(__unix__) || defined(__APPLE__)
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+
+	#define ACL_IMPL_HAS_MAPPED_FILE
+#endif
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+#if defined(ACL_IMPL_HAS_MAPPED_FILE)
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Maps a whole file in memory, read-only.
+	// Compressed tracks, packs, and databases only contain offsets relative to their start
+	// and can be used in place: nothing needs to be allocated or copied and pages are
+	// read from disk on first access (or shared with the OS file cache).
+	// The mapping is aligned to the OS page size which satisfies every ACL buffer alignment.
+	// Writing to the mapping faults.
+	// Only available on Windows and POSIX platforms.
+	////////////////////////////////////////////////////////////////////////////////
+	class mapped_file final
+	{
+	public:
+		mapped_file() : m_mapping(nullptr), m_mapping_size(0) {}
+		~mapped_file() { close(); }
+
+		mapped_file(mapped_file&& other) noexcept
+			: m_mapping(other.m_mapping)
+			, m_mapping_size(other.m_mapping_size)
+		{
+			other.m_mapping = nullptr;
+			other.m_mapping_size = 0;
+		}
+
+		mapped_file& operator=(mapped_file&& other) noexcept
+		{
+			if (this != &other)
+			{
+				close();
+
+				m_mapping = other.m_mapping;
+				m_mapping_size = other.m_mapping_size;
+				other.m_mapping = nullptr;
+				other.m_mapping_size = 0;
+			}
+
+			return *this;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Maps the whole file in memory. Empty files cannot be mapped.
+		error_result open(const char* filename)
+		{
+			ACL_ASSERT(m_mapping == nullptr, "Mapped file is already open");
+			if (m_mapping != nullptr)
+				return error_result("Mapped file is already open");
+
+			if (filename == nullptr)
+				return error_result("Filename cannot be null");
+
+#if defined(_WIN32)
+			const HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+			if (file == INVALID_HANDLE_VALUE)
+				return error_result("Failed to open file");
+
+			LARGE_INTEGER file_size;
+			if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0)
+			{
+				CloseHandle(file);
+				return error_result("Failed to read the file size or the file is empty");
+			}
+
+			const HANDLE file_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+			// The view remains valid once the file and the file mapping are closed
+			CloseHandle(file);
+
+			if (file_mapping == nullptr)
+				return error_result("Failed to map file");
+
+			void* mapping = MapViewOfFile(file_mapping, FILE_MAP_READ, 0, 0, 0);
+			CloseHandle(file_mapping);
+
+			if (mapping == nullptr)
+				return error_result("Failed to map file");
+
+			m_mapping = mapping;
+			m_mapping_size = size_t(file_size.QuadPart);
+#else
+			const int file = ::open(filename, O_RDONLY);
+			if (file < 0)
+				return error_result("Failed to open file");
+
+			struct stat file_stat;
+			if (fstat(file, &file_stat) != 0 || file_stat.st_size <= 0)
+			{
+				::close(file);
+				return error_result("Failed to read the file size or the file is empty");
+			}
+
+			const size_t file_size = size_t(file_stat.st_size);
+			void* mapping = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+			// The mapping remains valid once the file is closed
+			::close(file);
+
+			if (mapping == MAP_FAILED)
+				return error_result("Failed to map file");
+
+			m_mapping = mapping;
+			m_mapping_size = file_size;
+#endif
+
+			return error_result();
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Unmaps the file. Every context bound to its content must be reset beforehand.
+		void close()
+		{
+			if (m_mapping != nullptr)
+			{
+#if defined(_WIN32)
+				UnmapViewOfFile(m_mapping);
+#else
+				munmap(m_mapping, m_mapping_size);
+#endif
+			}
+
+			m_mapping = nullptr;
+			m_mapping_size = 0;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if a file is mapped.
+		bool is_open() const { return m_mapping != nullptr; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the mapped file content, nullptr if none is open.
+		const void* get_data() const { return m_mapping; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the mapped file size in bytes.
+		size_t get_size() const { return m_mapping_size; }
+
+	private:
+		mapped_file(const mapped_file&) = delete;
+		mapped_file& operator=(const mapped_file&) = delete;
+
+		void* m_mapping;
+		size_t m_mapping_size;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+#endif	// defined(ACL_IMPL_HAS_MAPPED_FILE)
+
+ACL_IMPL_FILE_PRAGMA_POP
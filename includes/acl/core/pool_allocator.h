@@ -0,0 +1,329 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/error.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/memory_utils.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	////////////////////////////////////////////////////////////////////////////////
+	// A thread safe pool allocator implementation.
+	// Small allocations (up to k_max_block_size bytes) are rounded up to a power of two
+	// size class and carved out of slabs obtained from a backing allocator. Every thread
+	// that allocates gets its own cache of free blocks per size class and does not need
+	// to synchronize with other threads. Blocks freed by another thread than the one that
+	// allocated them are returned to their owner through a lock-free list.
+	// Larger allocations and new slabs go through the backing allocator under a lock.
+	//
+	// This makes it well suited for decompression contexts and scratch memory that are
+	// created and destroyed frequently from many threads.
+	//
+	// Slabs are retained until the allocator is destroyed, including those of threads
+	// that have exited. Small allocations must not be aligned to more than k_max_block_size.
+	////////////////////////////////////////////////////////////////////////////////
+	class pool_allocator final : public iallocator
+	{
+	public:
+		// The size of the slabs obtained from the backing allocator, they are also aligned to it
+		static constexpr size_t k_slab_size = 64 * 1024;
+
+		// The smallest and largest size classes, every power of two in between is a size class
+		static constexpr size_t k_min_block_size = 16;
+		static constexpr size_t k_max_block_size = 4096;
+		static constexpr uint32_t k_num_size_classes = 9;
+
+		explicit pool_allocator(iallocator& backing_allocator)
+			: iallocator()
+			, m_backing_allocator(backing_allocator)
+			, m_lock()
+			, m_heaps(nullptr)
+			, m_id(make_allocator_id())
+			, m_reserved_size(0)
+		{}
+
+		virtual ~pool_allocator() override
+		{
+			thread_heap* heap = m_heaps;
+			while (heap != nullptr)
+			{
+				slab_header* slab = heap->slabs;
+				while (slab != nullptr)
+				{
+					slab_header* next_slab = slab->next;
+					m_backing_allocator.deallocate(slab, k_slab_size);
+					slab = next_slab;
+				}
+
+				thread_heap* next_heap = heap->next;
+				deallocate_type(m_backing_allocator, heap);
+				heap = next_heap;
+			}
+		}
+
+		pool_allocator(const pool_allocator&) = delete;
+		pool_allocator& operator=(const pool_allocator&) = delete;
+
+		virtual void* allocate(size_t size, size_t alignment = k_default_alignment) override
+		{
+			ACL_ASSERT(is_power_of_two(alignment), "The alignment must be power of two.");
+
+			if (size > k_max_block_size || alignment > k_max_block_size)
+			{
+				ACL_ASSERT(size > k_max_block_size, "Small allocations cannot be aligned to more than k_max_block_size");
+
+				std::unique_lock<std::mutex> lock(m_lock);
+				return m_backing_allocator.allocate(size, alignment);
+			}
+
+			// Blocks are aligned to their size, a larger alignment uses a larger size class
+			const uint32_t size_class = get_size_class(std::max<size_t>(size, alignment));
+
+			thread_heap* heap = get_thread_heap();
+
+			block* free_block = heap->free_blocks[size_class];
+			if (free_block == nullptr)
+			{
+				// Grab everything other threads returned to us at once
+				free_block = heap->remote_free_blocks[size_class].exchange(nullptr, std::memory_order_acquire);
+			}
+
+			if (free_block != nullptr)
+			{
+				heap->free_blocks[size_class] = free_block->next;
+				return free_block;
+			}
+
+			return allocate_from_slab(*heap, size_class);
+		}
+
+		virtual void deallocate(void* ptr, size_t size) override
+		{
+			if (ptr == nullptr)
+				return;
+
+			if (size > k_max_block_size)
+			{
+				std::unique_lock<std::mutex> lock(m_lock);
+				m_backing_allocator.deallocate(ptr, size);
+				return;
+			}
+
+			// Slabs are aligned to their size, their header tells us which size class and thread the block belongs to
+			slab_header* slab = reinterpret_cast<slab_header*>(reinterpret_cast<uintptr_t>(ptr) & ~uintptr_t(k_slab_size - 1));
+			thread_heap* owner = slab->owner;
+			const uint32_t size_class = slab->size_class;
+
+			block* freed_block = static_cast<block*>(ptr);
+
+			if (owner == find_thread_heap())
+			{
+				freed_block->next = owner->free_blocks[size_class];
+				owner->free_blocks[size_class] = freed_block;
+			}
+			else
+			{
+				// Another thread owns it, push it on its list of remote frees
+				std::atomic<block*>& remote_free_blocks = owner->remote_free_blocks[size_class];
+
+				block* head = remote_free_blocks.load(std::memory_order_relaxed);
+				do
+				{
+					freed_block->next = head;
+				} while (!remote_free_blocks.compare_exchange_weak(head, freed_block, std::memory_order_release, std::memory_order_relaxed));
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the total size of the slabs owned by the allocator.
+		size_t get_reserved_size() const
+		{
+			return m_reserved_size.load(std::memory_order_relaxed);
+		}
+
+	private:
+		// A free block, the link lives within the block memory
+		struct block
+		{
+			block*			next;
+		};
+
+		struct thread_heap;
+
+		struct slab_header
+		{
+			thread_heap*	owner;
+			slab_header*	next;
+			uint32_t		size_class;
+		};
+
+		// The blocks cached by a single thread, only the remote free lists are touched by other threads
+		struct thread_heap
+		{
+			thread_heap()
+				: next(nullptr)
+				, slabs(nullptr)
+			{
+				for (uint32_t size_class = 0; size_class < k_num_size_classes; ++size_class)
+				{
+					free_blocks[size_class] = nullptr;
+					remote_free_blocks[size_class].store(nullptr, std::memory_order_relaxed);
+					current_slabs[size_class] = nullptr;
+					current_slab_offsets[size_class] = k_slab_size;
+				}
+			}
+
+			block*				free_blocks[k_num_size_classes];
+			std::atomic<block*>	remote_free_blocks[k_num_size_classes];
+
+			// Slabs are carved out linearly as blocks are needed
+			slab_header*		current_slabs[k_num_size_classes];
+			size_t				current_slab_offsets[k_num_size_classes];
+
+			thread_heap*		next;	// Next heap of the allocator
+			slab_header*		slabs;	// Every slab owned by this heap
+		};
+
+		// Each thread remembers its heap for the last few allocators it used
+		struct thread_heap_cache_entry
+		{
+			uint64_t		allocator_id;
+			thread_heap*	heap;
+		};
+
+		static constexpr uint32_t k_num_cached_thread_heaps = 4;
+
+		static uint64_t make_allocator_id()
+		{
+			// Identifiers are never reused, a stale cache entry for a destroyed allocator can never match
+			static std::atomic<uint64_t> s_next_id(1);
+			return s_next_id.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		static uint32_t get_size_class(size_t size)
+		{
+			uint32_t size_class = 0;
+			while ((k_min_block_size << size_class) < size)
+				size_class++;
+			return size_class;
+		}
+
+		static thread_heap_cache_entry* get_thread_heap_cache()
+		{
+			static thread_local thread_heap_cache_entry t_cache[k_num_cached_thread_heaps] = {};
+			return &t_cache[0];
+		}
+
+		thread_heap* find_thread_heap() const
+		{
+			const thread_heap_cache_entry* cache = get_thread_heap_cache();
+			for (uint32_t entry_index = 0; entry_index < k_num_cached_thread_heaps; ++entry_index)
+			{
+				if (cache[entry_index].allocator_id == m_id)
+					return cache[entry_index].heap;
+			}
+
+			return nullptr;
+		}
+
+		thread_heap* get_thread_heap()
+		{
+			thread_heap* heap = find_thread_heap();
+			if (heap != nullptr)
+				return heap;
+
+			{
+				std::unique_lock<std::mutex> lock(m_lock);
+				heap = allocate_type<thread_heap>(m_backing_allocator);
+				heap->next = m_heaps;
+				m_heaps = heap;
+			}
+
+			// When the cache is full, the oldest entry is replaced and its heap is retained until the allocator is destroyed
+			thread_heap_cache_entry* cache = get_thread_heap_cache();
+			for (uint32_t entry_index = k_num_cached_thread_heaps - 1; entry_index > 0; --entry_index)
+				cache[entry_index] = cache[entry_index - 1];
+
+			cache[0].allocator_id = m_id;
+			cache[0].heap = heap;
+			return heap;
+		}
+
+		void* allocate_from_slab(thread_heap& heap, uint32_t size_class)
+		{
+			const size_t block_size = k_min_block_size << size_class;
+
+			if (heap.current_slab_offsets[size_class] + block_size > k_slab_size)
+			{
+				slab_header* slab;
+				{
+					std::unique_lock<std::mutex> lock(m_lock);
+					slab = static_cast<slab_header*>(m_backing_allocator.allocate(k_slab_size, k_slab_size));
+				}
+
+				m_reserved_size.fetch_add(k_slab_size, std::memory_order_relaxed);
+
+				slab->owner = &heap;
+				slab->size_class = size_class;
+				slab->next = heap.slabs;
+				heap.slabs = slab;
+
+				// Blocks are aligned to their size within the slab, the first one follows the header
+				heap.current_slabs[size_class] = slab;
+				heap.current_slab_offsets[size_class] = align_to(sizeof(slab_header), block_size);
+			}
+
+			void* ptr = reinterpret_cast<uint8_t*>(heap.current_slabs[size_class]) + heap.current_slab_offsets[size_class];
+			heap.current_slab_offsets[size_class] += block_size;
+			return ptr;
+		}
+
+		static_assert((k_min_block_size << (k_num_size_classes - 1)) == k_max_block_size, "Every power of two between the smallest and largest block sizes must have a size class");
+		static_assert(k_max_block_size < k_slab_size, "A slab must fit more than one block of the largest size class");
+
+		iallocator&			m_backing_allocator;
+		std::mutex			m_lock;			// Protects the backing allocator and our list of heaps
+		thread_heap*		m_heaps;
+		uint64_t			m_id;
+		std::atomic<size_t>	m_reserved_size;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
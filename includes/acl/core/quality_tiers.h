@@ -35,8 +35,32 @@ namespace acl
 {
 	ACL_IMPL_VERSION_NAMESPACE_BEGIN
 
+	//////////////////////////////////////////////////////////////////////////
+	// The number of quality tiers stored within a database can be configured by defining
+	// ACL_NUM_DATABASE_TIERS before including ACL. More tiers allow memory to be traded
+	// against quality in smaller increments when streaming. The value must match between
+	// compression and decompression, databases built with a different number of tiers are invalid.
+	// Defaults to 2 tiers (medium and lowest importance), must be in the range [2, 10].
+#if !defined(ACL_NUM_DATABASE_TIERS)
+	#define ACL_NUM_DATABASE_TIERS 2
+#endif
+
+	// Database contains 2 tiers by default
+	constexpr uint32_t k_num_database_tiers = ACL_NUM_DATABASE_TIERS;
+
+	static_assert(k_num_database_tiers >= 2 && k_num_database_tiers <= 10, "ACL_NUM_DATABASE_TIERS must be in the range [2, 10]");
+
+	// The highest importance tier lives in the compressed tracks, the others in the database
+	constexpr uint32_t k_num_quality_tiers = k_num_database_tiers + 1;
+
+	// Number of database tiers between the medium and lowest importance tiers, zero by default
+	constexpr uint32_t k_num_intermediate_database_tiers = k_num_database_tiers - 2;
+
 	//////////////////////////////////////////////////////////////////////////
 	// What quality tier a key frame/sample belongs to
+	// When the database contains more than 2 tiers, the intermediate tiers sit between the
+	// medium and lowest importance tiers in order of decreasing importance and they are
+	// referred to by value: quality_tier(2), quality_tier(3), etc.
 	enum class quality_tier
 	{
 		// Highest importance frames remain in the compressed clip and can be used to interpolate even without the database present
@@ -47,17 +71,24 @@ namespace acl
 		// Medium importance frames live in the compressed database and contribute more the quality than those of the lower importance tiers
 		medium_importance	= 1,
 
-		//low_importance,	// RESERVED
-
 		// Lowest importance frames live in the compressed database and contribute the least to the quality
-		lowest_importance	= 2,
+		lowest_importance	= k_num_database_tiers,
 	};
 
-	// We only support 3 tiers
-	constexpr uint32_t k_num_quality_tiers = 3;
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the quality tier that lives in the database at the specified index.
+	// Index 0 is the medium importance tier and index 'k_num_database_tiers - 1' the lowest importance tier.
+	constexpr quality_tier get_database_quality_tier(uint32_t database_tier_index)
+	{
+		return static_cast<quality_tier>(database_tier_index + 1);
+	}
 
-	// Database contains 2 tiers
-	constexpr uint32_t k_num_database_tiers = 2;
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the specified quality tier lives in the database, false otherwise.
+	constexpr bool is_database_quality_tier(quality_tier tier)
+	{
+		return tier != quality_tier::highest_importance && uint32_t(tier) <= k_num_database_tiers;
+	}
 
 	ACL_IMPL_VERSION_NAMESPACE_END
 }
@@ -41,6 +41,14 @@ namespace acl
 	constexpr uint8_t k_segment_range_reduction_num_bits_per_component = 8;
 	constexpr uint8_t k_segment_range_reduction_num_bytes_per_component = 1;
 	constexpr uint32_t k_clip_range_reduction_vector3_range_size = sizeof(float) * 6;
+	constexpr uint32_t k_clip_range_reduction_quantized_rotation_range_size = sizeof(uint16_t) * 6;
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Returns the size in bytes of the clip range min/extent of a single rotation sub-track.
+	constexpr uint32_t get_rotation_clip_range_entry_size(bool are_clip_ranges_quantized)
+	{
+		return are_clip_ranges_quantized ? k_clip_range_reduction_quantized_rotation_range_size : k_clip_range_reduction_vector3_range_size;
+	}
 
 	////////////////////////////////////////////////////////////////////////////////
 	// range_reduction_flags8 represents the types of range reduction we support as a bit field.
@@ -0,0 +1,97 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/error.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <rtm/qvvf.h>
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// A reference pose shared by many clips (e.g. the bind pose of a skeleton).
+	//
+	// Clips compressed against it elide every constant sub-track that matches
+	// the reference pose within the precision of its track: such sub-tracks are
+	// stored as default sub-tracks and no data is written for them. When decompressing,
+	// their values come from the same reference pose through the track writer.
+	// See acl/compression/reference_pose_utils.h and acl/decompression/reference_pose_writer.h.
+	//
+	// Transforms are indexed by their output index. The reference pose does not own
+	// its transforms, they must outlive it.
+	//////////////////////////////////////////////////////////////////////////
+	class reference_pose
+	{
+	public:
+		//////////////////////////////////////////////////////////////////////////
+		// Constructs an empty reference pose.
+		reference_pose() noexcept : m_transforms(nullptr), m_num_transforms(0) {}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Constructs a reference pose that references the provided transforms.
+		reference_pose(const rtm::qvvf* transforms, uint32_t num_transforms) noexcept
+			: m_transforms(transforms)
+			, m_num_transforms(num_transforms)
+		{
+			ACL_ASSERT(transforms != nullptr || num_transforms == 0, "Reference pose transforms cannot be null");
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of transforms in the reference pose.
+		uint32_t get_num_transforms() const { return m_num_transforms; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the transforms of the reference pose.
+		const rtm::qvvf* get_transforms() const { return m_transforms; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the transform at the specified output index.
+		const rtm::qvvf& get_transform(uint32_t output_index) const
+		{
+			ACL_ASSERT(output_index < m_num_transforms, "Invalid reference pose index: %u >= %u", output_index, m_num_transforms);
+			return m_transforms[output_index];
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if the reference pose contains no transforms.
+		bool is_empty() const { return m_num_transforms == 0; }
+
+	private:
+		const rtm::qvvf*	m_transforms;		// The transforms, indexed by output index
+		uint32_t			m_num_transforms;	// The number of transforms
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,143 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "acl/version.h"
+#include "acl/core/error.h"
+#include "acl/core/memory_utils.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the number of floats in between two basis vectors for the provided number of scalar tracks.
+	// Basis vectors are padded to a multiple of 4 floats to reconstruct 4 tracks at a time.
+	constexpr uint32_t get_scalar_track_basis_stride(uint32_t num_tracks) { return (num_tracks + 3) & ~3U; }
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the number of floats required to hold the basis data of the provided number of scalar tracks and basis vectors.
+	constexpr uint32_t get_scalar_track_basis_data_size(uint32_t num_tracks, uint32_t num_basis_vectors) { return get_scalar_track_basis_stride(num_tracks) * (num_basis_vectors + 1); }
+
+	//////////////////////////////////////////////////////////////////////////
+	// A basis shared by a list of correlated float1f tracks (e.g. facial blend shape weights).
+	//
+	// Instead of compressing every track, only the coefficients of a few basis vectors are
+	// compressed as float1f tracks. Each track value is reconstructed from the coefficients:
+	//    value[track] = mean[track] + sum(coefficient[k] * basis[k][track])
+	// See acl/compression/scalar_track_basis_utils.h.
+	//
+	// The basis data contains the mean followed by every basis vector, each padded to
+	// get_scalar_track_basis_stride(..) floats, and must be 16 bytes aligned.
+	// The basis does not own its data, it must outlive it.
+	//////////////////////////////////////////////////////////////////////////
+	class scalar_track_basis
+	{
+	public:
+		//////////////////////////////////////////////////////////////////////////
+		// Constructs an empty basis.
+		scalar_track_basis() noexcept : m_data(nullptr), m_num_tracks(0), m_num_basis_vectors(0) {}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Constructs a basis that references the provided data.
+		scalar_track_basis(const float* data, uint32_t num_tracks, uint32_t num_basis_vectors) noexcept
+			: m_data(data)
+			, m_num_tracks(num_tracks)
+			, m_num_basis_vectors(num_basis_vectors)
+		{
+			ACL_ASSERT(data != nullptr || num_tracks == 0, "Basis data cannot be null");
+			ACL_ASSERT(is_aligned_to(data, 16), "Basis data must be 16 bytes aligned");
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of tracks reconstructed by this basis.
+		uint32_t get_num_tracks() const { return m_num_tracks; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of basis vectors, one coefficient is required for each.
+		uint32_t get_num_basis_vectors() const { return m_num_basis_vectors; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the basis data.
+		const float* get_data() const { return m_data; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if the basis contains no tracks.
+		bool is_empty() const { return m_num_tracks == 0; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Reconstructs every track value from the provided basis coefficients.
+		// 'coefficients' must contain get_num_basis_vectors() values and 'out_values' get_num_tracks() values.
+		void reconstruct(const float* coefficients, float* out_values) const
+		{
+			const uint32_t stride = get_scalar_track_basis_stride(m_num_tracks);
+			const uint32_t num_simd_tracks = m_num_tracks & ~3U;
+
+			for (uint32_t track_index = 0; track_index < num_simd_tracks; track_index += 4)
+			{
+				rtm::vector4f values = rtm::vector_load(m_data + track_index);
+
+				const float* basis_vector = m_data + stride + track_index;
+				for (uint32_t basis_index = 0; basis_index < m_num_basis_vectors; ++basis_index, basis_vector += stride)
+					values = rtm::vector_mul_add(rtm::vector_load(basis_vector), coefficients[basis_index], values);
+
+				rtm::vector_store(values, out_values + track_index);
+			}
+
+			// Our remaining tracks are padded in the basis data, we reconstruct them together but only write what we need
+			if (num_simd_tracks != m_num_tracks)
+			{
+				rtm::vector4f values = rtm::vector_load(m_data + num_simd_tracks);
+
+				const float* basis_vector = m_data + stride + num_simd_tracks;
+				for (uint32_t basis_index = 0; basis_index < m_num_basis_vectors; ++basis_index, basis_vector += stride)
+					values = rtm::vector_mul_add(rtm::vector_load(basis_vector), coefficients[basis_index], values);
+
+				float remaining_values[4];
+				rtm::vector_store(values, &remaining_values[0]);
+
+				for (uint32_t track_index = num_simd_tracks; track_index < m_num_tracks; ++track_index)
+					out_values[track_index] = remaining_values[track_index - num_simd_tracks];
+			}
+		}
+
+	private:
+		const float*	m_data;					// The mean and basis vectors
+		uint32_t		m_num_tracks;			// The number of tracks reconstructed
+		uint32_t		m_num_basis_vectors;	// The number of basis vectors
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -25,6 +25,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "acl/version.h"
+#include "acl/core/sample_looping_policy.h"
 #include "acl/core/impl/compiler_utils.h"
 
 #include <cstdint>
@@ -70,6 +71,15 @@ namespace acl
 	//////////////////////////////////////////////////////////////////////////
 	float calculate_finite_duration(uint32_t num_samples, float sample_rate);
 
+	//////////////////////////////////////////////////////////////////////////
+	// Advances a sample time by a delta time (positive or negative) and returns
+	// the new sample time within [0, duration] inclusive.
+	// With the wrap looping policy, the sample time wraps around the duration which
+	// must include the repeating first sample. Otherwise, the sample time is clamped.
+	// When the delta time is smaller than the duration, no division is required.
+	//////////////////////////////////////////////////////////////////////////
+	float advance_sample_time(float sample_time, float delta_time, float duration, sample_looping_policy looping_policy);
+
 	ACL_IMPL_VERSION_NAMESPACE_END
 }
 
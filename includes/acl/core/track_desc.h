@@ -154,13 +154,30 @@ namespace acl
 		ACL_DEPRECATED("Replaced by error metric, to be removed in v3.0")
 		float constant_scale_threshold = 0.00001F;
 
-		uint32_t padding = 0;
+		//////////////////////////////////////////////////////////////////////////
+		// How much this transform matters relative to the others when deciding which key frames
+		// to retain. The contributing error of this transform is scaled by it when key frames are
+		// stripped or assigned to database quality tiers. Transforms that are often seen up close
+		// (e.g. face, hands) can use a higher value to retain more of their motion in the higher tiers.
+		// It does not impact the precision of the compressed tracks.
+		// Defaults to '1.0'
+		float importance = 1.0F;
+
+		//////////////////////////////////////////////////////////////////////////
+		// The level of detail at which this transform is dropped, tracks with a higher level are
+		// dropped first. A transform is retained at every LOD lower than or equal to its level.
+		// Output indices must list transforms by increasing LOD level: the tracks retained at an LOD
+		// are then stored first and decompression can stop once they are unpacked.
+		// See 'calculate_num_lod_tracks(..)' and 'decompression_context::decompress_lod_tracks(..)'.
+		// Defaults to '0' (retained at every LOD)
+		uint32_t lod_level = 0;
 
 		//////////////////////////////////////////////////////////////////////////
 		// Returns whether a transform track description is valid or not.
 		// It is valid if:
 		//    - The precision is positive or zero and finite
 		//    - The shell distance is positive or zero and finite
+		//    - The importance is positive or zero and finite
 		//    - The constant rotation threshold angle is positive or zero and finite
 		//    - The constant translation threshold is positive or zero and finite
 		//    - The constant scale threshold is positive or zero and finite
@@ -51,14 +51,14 @@ namespace acl
 		//quatf_variable			= 1,	// TODO Quantized quaternion, [x,y,z,w] stored with [N,N,N,N] bits (same number of bits per component)
 		quatf_drop_w_full			= 2,	// Full precision quaternion, [x,y,z] stored with float32 (w is dropped)
 		quatf_drop_w_variable		= 3,	// Quantized quaternion, [x,y,z] stored with [N,N,N] bits (w is dropped, same number of bits per component)
+		quatf_drop_largest_variable	= 4,	// Quantized quaternion, [a,b,c] stored with [N,N,N] bits (largest component dropped, same number of bits per component)
+		quatf_log_variable			= 5,	// Quantized quaternion logarithm, [x,y,z] stored with [N,N,N] bits (same number of bits per component)
 
 		//quatf_optimal				= 15,	// Mix of quatf_variable and quatf_drop_w_variable
 
 		// TODO: Implement these?
 		//quatf_drop_largest_full			// Full precision quaternion, [a,b,c] stored with float32 (largest component dropped)
-		//quatf_drop_largest_variable		// Quantized quaternion, [a,b,c] stored with [N,N,N] bits (largest component dropped, same number of bits per component)
 		//quatf_log_full,					// Full precision quaternion logarithm, [x,y,z] stored with float32
-		//quatf_log_variable,				// Quantized quaternion logarithm, [x,y,z] stored with [N,N,N] bits (same number of bits per component)
 	};
 
 	// BE CAREFUL WHEN CHANGING VALUES IN THIS ENUM
@@ -68,6 +68,7 @@ namespace acl
 	{
 		vector3f_full				= 0,	// Full precision vector3f, [x,y,z] stored with float32
 		vector3f_variable			= 1,	// Quantized vector3f, [x,y,z] stored with [N,N,N] bits (same number of bits per component)
+		vector3f_variable_per_component	= 2,	// Quantized vector3f, [x,y,z] stored with [X,Y,Z] bits (each component has its own number of bits)
 	};
 
 	union track_format8
@@ -29,6 +29,7 @@
 
 #include <rtm/types.h>
 #include <rtm/quatf.h>
+#include <rtm/scalarf.h>
 #include <rtm/vector4f.h>
 
 #include <cstdint>
@@ -106,6 +107,26 @@ namespace acl
 			(void)value;
 		}
 
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not animated float1f tracks can be written 4 at a time with 'write_float1_batch'.
+		// Consecutive animated tracks that share the same bit rate are then unpacked and
+		// interpolated together. Constant tracks and the remaining animated tracks are still
+		// written with 'write_float1'. Only used when per track rounding is not supported by
+		// the decompression settings and when decompressing every track.
+		// Disabled by default.
+		// Must be static constexpr!
+		static constexpr bool supports_float1_batch_output() { return false; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Called by the decoder to write out the values of 4 consecutive tracks starting at
+		// the specified track index. Lane X holds the first track, lane W the last one.
+		// Only called when 'supports_float1_batch_output' returns true.
+		void RTM_SIMD_CALL write_float1_batch(uint32_t first_track_index, rtm::vector4f_arg0 values)
+		{
+			(void)first_track_index;
+			(void)values;
+		}
+
 		//////////////////////////////////////////////////////////////////////////
 		// Called by the decoder to write out a value for a specified track index.
 		void RTM_SIMD_CALL write_float2(uint32_t track_index, rtm::vector4f_arg0 value)
@@ -187,6 +208,31 @@ namespace acl
 			(void)rotation;
 		}
 
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not animated rotations can be written in SOA form with 'write_rotations_soa'.
+		// This avoids transposing the decompressed samples back into AOS form when the host
+		// runtime consumes them in SOA form. Default and constant rotations are still written
+		// with 'write_rotation'. Only used when per track rounding is not supported by the
+		// decompression settings, otherwise 'write_rotation' is used for every rotation.
+		// Disabled by default.
+		// Must be static constexpr!
+		static constexpr bool supports_soa_rotation_output() { return false; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Called by the decoder to write out up to 4 animated rotations in SOA form.
+		// The track indices are in increasing order and lanes past 'num_tracks' contain garbage.
+		// 'skip_track_rotation' is not used, every animated rotation is provided.
+		// Only called when 'supports_soa_rotation_output' returns true.
+		void RTM_SIMD_CALL write_rotations_soa(const uint32_t* track_indices, uint32_t num_tracks, rtm::vector4f_arg0 xxxx, rtm::vector4f_arg1 yyyy, rtm::vector4f_arg2 zzzz, rtm::vector4f_arg3 wwww)
+		{
+			(void)track_indices;
+			(void)num_tracks;
+			(void)xxxx;
+			(void)yyyy;
+			(void)zzzz;
+			(void)wwww;
+		}
+
 		//////////////////////////////////////////////////////////////////////////
 		// Called by the decoder to write out a translation value for a specified bone index.
 		void RTM_SIMD_CALL write_translation(uint32_t track_index, rtm::vector4f_arg0 translation)
@@ -202,6 +248,100 @@ namespace acl
 			(void)track_index;
 			(void)scale;
 		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not velocities are written alongside the pose with 'write_linear_velocity'
+		// and 'write_angular_velocity'. Velocities are the derivative of the interpolation between
+		// the two key frames we unpack for the pose, they come for free without unpacking anything more.
+		// Requires per track rounding to be supported by the decompression settings and the context
+		// to seek with the 'per_track' rounding policy, 'get_rounding_policy' then picks how the pose
+		// is sampled (e.g. 'none' to interpolate). Track rounding tables are not supported.
+		// Only animated sub-tracks write velocities, default and constant sub-tracks do not move.
+		// Disabled by default.
+		// Must be static constexpr!
+		static constexpr bool supports_velocity_output() { return false; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Called by the decoder to write out the linear velocity in units per second of an animated translation.
+		// Only called when 'supports_velocity_output' returns true.
+		void RTM_SIMD_CALL write_linear_velocity(uint32_t track_index, rtm::vector4f_arg0 velocity)
+		{
+			(void)track_index;
+			(void)velocity;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Called by the decoder to write out the angular velocity in radians per second of an animated rotation.
+		// The velocity is expressed as a rotation axis scaled by the angular speed in the parent space of the track.
+		// Only called when 'supports_velocity_output' returns true.
+		void RTM_SIMD_CALL write_angular_velocity(uint32_t track_index, rtm::vector4f_arg0 velocity)
+		{
+			(void)track_index;
+			(void)velocity;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not 'read_rotation', 'read_translation', and 'read_scale' return the values
+		// previously written. Functions that read the pose back (e.g. 'decompress_blended_tracks')
+		// require it and fail to compile otherwise, the defaults below would silently return the identity.
+		// Disabled by default.
+		// Must be static constexpr!
+		static constexpr bool supports_read_back() { return false; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Called to read back the value previously written for a specified bone index.
+		// Used by 'decompress_blended_tracks' and 'decompress_layered_tracks' to blend with the pose
+		// already written and by 'decompress_tracks_object_space' and 'decompress_skinning_palette'
+		// to convert local space values. Only called by those functions, see 'supports_read_back'.
+		rtm::quatf RTM_SIMD_CALL read_rotation(uint32_t /*track_index*/) const { return rtm::quat_identity(); }
+		rtm::vector4f RTM_SIMD_CALL read_translation(uint32_t /*track_index*/) const { return rtm::vector_zero(); }
+		rtm::vector4f RTM_SIMD_CALL read_scale(uint32_t /*track_index*/) const { return rtm::vector_set(1.0F); }
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A track writer that outputs scalar tracks into a contiguous float array.
+	// Each track writes as many floats as its type holds (1 for float1f, 2 for float2f, etc.)
+	// and track N starts at 'output[N * num_components]'. The output buffer must be
+	// large enough to hold every track written into it.
+	// Float1f tracks are written 4 at a time when possible, see 'supports_float1_batch_output'.
+	//////////////////////////////////////////////////////////////////////////
+	struct dense_float_writer : public track_writer
+	{
+		explicit dense_float_writer(float* output_) : output(output_) {}
+
+		static constexpr bool supports_float1_batch_output() { return true; }
+
+		void RTM_SIMD_CALL write_float1(uint32_t track_index, rtm::scalarf_arg0 value)
+		{
+			rtm::scalar_store(value, output + track_index);
+		}
+
+		void RTM_SIMD_CALL write_float1_batch(uint32_t first_track_index, rtm::vector4f_arg0 values)
+		{
+			rtm::vector_store(values, output + first_track_index);
+		}
+
+		void RTM_SIMD_CALL write_float2(uint32_t track_index, rtm::vector4f_arg0 value)
+		{
+			rtm::vector_store2(value, output + (track_index * 2));
+		}
+
+		void RTM_SIMD_CALL write_float3(uint32_t track_index, rtm::vector4f_arg0 value)
+		{
+			rtm::vector_store3(value, output + (track_index * 3));
+		}
+
+		void RTM_SIMD_CALL write_float4(uint32_t track_index, rtm::vector4f_arg0 value)
+		{
+			rtm::vector_store(value, output + (track_index * 4));
+		}
+
+		void RTM_SIMD_CALL write_vector4(uint32_t track_index, rtm::vector4f_arg0 value)
+		{
+			rtm::vector_store(value, output + (track_index * 4));
+		}
+
+		float* output;
 	};
 
 	ACL_IMPL_VERSION_NAMESPACE_END
@@ -0,0 +1,124 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	////////////////////////////////////////////////////////////////////////////////
+	// An allocator that measures the memory allocated through it.
+	// Every allocation is forwarded to a backing allocator while we track how many bytes
+	// are held, the most held at once (the peak), and how many allocations were made.
+	// A second peak can be reset at will to measure the peak of a section of code.
+	// This allocator is thread safe if the backing allocator is.
+	////////////////////////////////////////////////////////////////////////////////
+	class tracking_allocator final : public iallocator
+	{
+	public:
+		explicit tracking_allocator(iallocator& backing_allocator)
+			: iallocator()
+			, m_backing_allocator(backing_allocator)
+			, m_allocated_size(0)
+			, m_peak_size(0)
+			, m_scope_peak_size(0)
+			, m_num_allocations(0)
+		{}
+
+		tracking_allocator(const tracking_allocator&) = delete;
+		tracking_allocator& operator=(const tracking_allocator&) = delete;
+
+		virtual void* allocate(size_t size, size_t alignment = k_default_alignment) override
+		{
+			void* ptr = m_backing_allocator.allocate(size, alignment);
+
+			const size_t allocated_size = m_allocated_size.fetch_add(size, std::memory_order_relaxed) + size;
+			update_peak(m_peak_size, allocated_size);
+			update_peak(m_scope_peak_size, allocated_size);
+			m_num_allocations.fetch_add(1, std::memory_order_relaxed);
+
+			return ptr;
+		}
+
+		virtual void deallocate(void* ptr, size_t size) override
+		{
+			if (ptr == nullptr)
+				return;
+
+			m_backing_allocator.deallocate(ptr, size);
+			m_allocated_size.fetch_sub(size, std::memory_order_relaxed);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of bytes currently allocated.
+		size_t get_allocated_size() const { return m_allocated_size.load(std::memory_order_relaxed); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the most bytes allocated at once since construction.
+		size_t get_peak_size() const { return m_peak_size.load(std::memory_order_relaxed); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the most bytes allocated at once since the last call to 'reset_scope_peak()'.
+		size_t get_scope_peak_size() const { return m_scope_peak_size.load(std::memory_order_relaxed); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of allocations made since construction.
+		uint64_t get_num_allocations() const { return m_num_allocations.load(std::memory_order_relaxed); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Resets the scope peak to the number of bytes currently allocated.
+		void reset_scope_peak() { m_scope_peak_size.store(m_allocated_size.load(std::memory_order_relaxed), std::memory_order_relaxed); }
+
+	private:
+		static void update_peak(std::atomic<size_t>& peak_size, size_t allocated_size)
+		{
+			size_t current_peak_size = peak_size.load(std::memory_order_relaxed);
+			while (allocated_size > current_peak_size && !peak_size.compare_exchange_weak(current_peak_size, allocated_size, std::memory_order_relaxed))
+			{
+				// Another thread updated the peak, try again
+			}
+		}
+
+		iallocator&				m_backing_allocator;
+		std::atomic<size_t>		m_allocated_size;
+		std::atomic<size_t>		m_peak_size;
+		std::atomic<size_t>		m_scope_peak_size;
+		std::atomic<uint64_t>	m_num_allocations;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
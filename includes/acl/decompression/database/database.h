@@ -70,8 +70,47 @@ namespace acl
 		//////////////////////////////////////////////////////////////////////////
 		// Ran out of streaming requests
 		no_free_streaming_requests,
+
+		//////////////////////////////////////////////////////////////////////////
+		// The compressed tracks instance isn't part of the database or the database
+		// predates the clip chunk ranges required to stream individual clips
+		clip_chunk_ranges_unavailable,
+
+		//////////////////////////////////////////////////////////////////////////
+		// The chunks have been queued, see database_context::dispatch_queued_stream_in(..)
+		queued,
 	};
 
+	//////////////////////////////////////////////////////////////////////////
+	// A snapshot of the streaming telemetry of a database context.
+	// See database_settings::is_telemetry_supported().
+	//////////////////////////////////////////////////////////////////////////
+	struct database_telemetry
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Number of key frames looked up by seeks that sampled from the database, two per seek.
+		uint64_t num_frames_requested = 0;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Number of key frames served from each quality tier, indexed by quality tier.
+		// Key frames served from 'quality_tier::highest_importance' live within the compressed tracks.
+		uint64_t num_frames_served[k_num_quality_tiers] = {};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Number of key frames that weren't streamed in and that were reconstructed by
+		// interpolating the closest key frames resident instead.
+		uint64_t num_frames_reconstructed = 0;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Number of bytes of the bulk data, as stored, streamed in and out successfully for each
+		// database tier. Index 0 is the medium importance tier, see get_database_quality_tier(..).
+		uint64_t num_bytes_streamed_in[k_num_database_tiers] = {};
+		uint64_t num_bytes_streamed_out[k_num_database_tiers] = {};
+	};
+
+	template<class database_settings_type>
+	class database_budget_manager;
+
 	//////////////////////////////////////////////////////////////////////////
 	// Database decompression context for the uniformly sampled algorithm. The context
 	// allows various streaming actions to be performed on the database.
@@ -105,6 +144,7 @@ namespace acl
 		//////////////////////////////////////////////////////////////////////////
 		// Initializes the context instance to a particular compressed database instance.
 		// No streaming can be performed and it is assumed that all the data is present in memory.
+		// Entropy coded tiers are not supported here, they must be decoded by a streamer.
 		// Returns whether initialization was successful or not.
 		bool initialize(iallocator& allocator, const compressed_database& database);
 
@@ -113,8 +153,17 @@ namespace acl
 		// The streamer instances will be used to issue IO stream in/out requests.
 		// If a tier is stripped, the null_database_streamer can be used.
 		// Returns whether initialization was successful or not.
+		// Only supported when the database contains two tiers (the default), see ACL_NUM_DATABASE_TIERS.
 		bool initialize(iallocator& allocator, const compressed_database& database, database_streamer& medium_tier_streamer, database_streamer& low_tier_streamer);
 
+		//////////////////////////////////////////////////////////////////////////
+		// Initializes the context instance to a particular compressed database instance.
+		// One streamer instance is provided per database tier in order of decreasing importance,
+		// they will be used to issue IO stream in/out requests.
+		// If a tier is stripped, the null_database_streamer can be used.
+		// Returns whether initialization was successful or not.
+		bool initialize(iallocator& allocator, const compressed_database& database, database_streamer* const (&streamers)[k_num_database_tiers]);
+
 		//////////////////////////////////////////////////////////////////////////
 		// Returns true if this context instance is bound to a compressed database instance, false otherwise.
 		bool is_initialized() const;
@@ -137,8 +186,13 @@ namespace acl
 		// Assumes that the streamers have retained the same bulk data state as well. If it is
 		// not the case, reset and re-initialize the context.
 		// Returns whether rebinding was successful or not.
+		// Only supported when the database contains two tiers (the default), see ACL_NUM_DATABASE_TIERS.
 		bool relocated(const compressed_database& database, database_streamer& medium_tier_streamer, database_streamer& low_tier_streamer);
 
+		//////////////////////////////////////////////////////////////////////////
+		// Same as above but with one streamer instance per database tier in order of decreasing importance.
+		bool relocated(const compressed_database& database, database_streamer* const (&streamers)[k_num_database_tiers]);
+
 		//////////////////////////////////////////////////////////////////////////
 		// Returns true if this context instance is bound to the specified database instance, false otherwise.
 		bool is_bound_to(const compressed_database& database) const;
@@ -148,32 +202,117 @@ namespace acl
 		bool contains(const compressed_tracks& tracks) const;
 
 		//////////////////////////////////////////////////////////////////////////
-		// Returns whether or not we have streamed in any of the database bulk data for the specified tier (medium or low).
+		// Returns whether or not we have streamed in any of the database bulk data for the specified database tier.
 		bool is_streamed_in(quality_tier tier) const;
 
 		//////////////////////////////////////////////////////////////////////////
-		// Returns whether or not a streaming request is in flight for the specified tier (medium or low).
+		// Returns whether or not a streaming request is in flight for the specified database tier.
+		// Requests can complete on any thread, see database_streamer. Streaming requests are dispatched and
+		// this context is queried by a single thread at a time, typically the game thread.
 		bool is_streaming(quality_tier tier) const;
 
 		//////////////////////////////////////////////////////////////////////////
-		// Issues a stream in request and returns the current status for the specified tier (medium or low).
+		// Issues a stream in request and returns the current status for the specified database tier.
 		// By default, every chunk will be streamed in but they can be streamed progressively
-		// by providing a number of chunks.
-		database_stream_request_result stream_in(quality_tier tier, uint32_t num_chunks_to_stream = ~0U);
+		// by providing a number of chunks. The priority is provided to the streamer.
+		database_stream_request_result stream_in(quality_tier tier, uint32_t num_chunks_to_stream = ~0U, streaming_priority priority = streaming_priority::normal);
 
 		//////////////////////////////////////////////////////////////////////////
-		// Issues a stream out request and returns the current status for the specified tier (medium or low).
+		// Issues a stream out request and returns the current status for the specified database tier.
 		// By default, every chunk will be streamed out but they can be streamed progressively
 		// by providing a number of chunks.
 		database_stream_request_result stream_out(quality_tier tier, uint32_t num_chunks_to_stream = ~0U);
 
+		//////////////////////////////////////////////////////////////////////////
+		// Issues a stream in request for the chunks the provided compressed tracks instance needs
+		// and returns the current status for the specified database tier.
+		// Only one request can be in flight per tier, call this again once it completes until 'done' is returned.
+		// The first and last chunks of a clip can contain data for neighboring clips as well.
+		// The priority is provided to the streamer.
+		database_stream_request_result stream_in(const compressed_tracks& tracks, quality_tier tier, streaming_priority priority = streaming_priority::normal);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Issues a stream out request for the chunks the provided compressed tracks instance uses
+		// and returns the current status for the specified database tier.
+		// Use this to evict clips that are no longer sampled. Neighboring clips that share a chunk
+		// with this clip will lose the data within it as well until it is streamed back in.
+		// Only one request can be in flight per tier, call this again once it completes until 'done' is returned.
+		database_stream_request_result stream_out(const compressed_tracks& tracks, quality_tier tier);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Queues the chunks the provided compressed tracks instance needs for the specified database tier
+		// without issuing a request and returns 'queued' on success.
+		// Queue every clip that needs data within a frame then call 'dispatch_queued_stream_in(..)': adjacent
+		// chunks are coalesced into fewer, larger requests. A chunk queued more than once retains its highest priority.
+		database_stream_request_result queue_stream_in(const compressed_tracks& tracks, quality_tier tier, streaming_priority priority = streaming_priority::normal);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Issues a stream in request for the queued chunks and returns the current status for the specified database tier.
+		// The request starts from the first queued chunk with the highest priority and spans the queued chunks adjacent
+		// to it, up to 'num_chunks_to_stream'. The highest priority within it is provided to the streamer.
+		// Chunks are no longer queued once they stream in, those of a canceled request remain queued.
+		// Only one request can be in flight per tier, call this again once it completes until 'done' is returned.
+		database_stream_request_result dispatch_queued_stream_in(quality_tier tier, uint32_t num_chunks_to_stream = ~0U);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Predicts which chunks the provided compressed tracks instance will sample from within the
+		// next 'lookahead_time' seconds when playing from 'sample_time' at 'playback_rate' (negative when
+		// playing backwards) and issues a low priority stream in request for those missing for the specified database tier.
+		// Call this every frame for each playing clip with the parameters of its decompression context,
+		// data that streams in ahead of time avoids quality pops when playback reaches it.
+		// Only one request can be in flight per tier, 'done' is returned once the predicted chunks are streamed in.
+		database_stream_request_result prefetch(const compressed_tracks& tracks, quality_tier tier, float sample_time, float playback_rate, float lookahead_time);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the memory backing the chunks that aren't streamed in back to the system for the specified database tier.
+		// After many partial stream in/out cycles, a streamer can retain memory for chunks that streamed out long ago
+		// since its bulk data is only freed once every chunk has streamed out.
+		// Chunks that are streamed in do not move: bound decompression contexts remain valid and decompression can be
+		// in progress while we compact. How much memory is released depends on the streamer, see database_streamer.
+		// Returns 'streaming_in_progress' if a request is in flight for the tier, call this again once it completes.
+		database_stream_request_result compact(quality_tier tier);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Writes a snapshot of the streaming telemetry gathered since initialization or since it was last cleared.
+		// Seeks from other threads can update the counters while we read them, each counter is read atomically.
+		// Returns false and leaves the output untouched if telemetry isn't supported by our settings.
+		bool get_telemetry(database_telemetry& out_telemetry) const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Resets every telemetry counter to zero, if telemetry is supported by our settings.
+		void clear_telemetry();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Sets the listener notified when streaming requests complete or are canceled, nullptr clears it.
+		// It is called from the thread that completes requests, see database_streaming_listener.
+		// The context must be initialized and no request can be in flight when the listener changes.
+		// Initializing the context clears it.
+		void set_streaming_listener(database_streaming_listener* listener);
+
 	private:
 		database_context(const database_context& other) = delete;
 		database_context& operator=(const database_context& other) = delete;
 
+		// Returns the chunk range of the provided clip or nullptr if it is unavailable
+		const acl_impl::database_clip_chunk_range* find_clip_chunk_range(const compressed_tracks& tracks) const;
+
+		// Streams the first run of chunks within [begin_chunk_index, end_chunk_index) that isn't in the desired state
+		database_stream_request_result stream_in_range(quality_tier tier, uint32_t begin_chunk_index, uint32_t end_chunk_index, uint32_t num_chunks_to_stream, streaming_priority priority);
+		database_stream_request_result stream_out_range(quality_tier tier, uint32_t begin_chunk_index, uint32_t end_chunk_index, uint32_t num_chunks_to_stream);
+
+		// Marks the request as in flight for the specified tier, it must be retired once it completes
+		void dispatch_streaming_request(uint32_t tier_index, streaming_request_id request_id);
+
+		// Retires the request of the specified tier once it completes and returns whether or not it is still in flight
+		// Completed requests update our chunk bitsets and are released here, on the thread that dispatches requests
+		bool retire_streaming_request(uint32_t tier_index) const;
+
 		// Internal context data
 		acl_impl::database_context_v0 m_context;
 
+		template<class budget_database_settings_type>
+		friend class database_budget_manager;
+
 		static_assert(std::is_base_of<database_settings, settings_type>::value, "database_settings_type must derive from database_settings!");
 
 		// TODO: I'd like to assert here but we use a dummy pointer to init the decompression context which triggers this
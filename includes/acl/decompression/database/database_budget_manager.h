@@ -0,0 +1,310 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/bitset.h"
+#include "acl/core/error.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/quality_tiers.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/decompression/database/database.h"
+#include "acl/decompression/database/impl/database_context.h"
+
+#include <atomic>
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Manages a memory budget for the streamed in bulk data of a database context.
+	//
+	// Once bound, every seek into a clip stamps the chunks it samples from with the
+	// current frame. Call 'advance_frame()' once per game frame and 'update(..)' to
+	// stream out the least recently sampled chunks of a tier until it fits within its budget.
+	//
+	// Streaming out cannot happen while decompression is in progress, 'update(..)'
+	// follows the same rules as 'database_context::stream_out(..)'.
+	// The budget manager must be reset before its database context is.
+	//////////////////////////////////////////////////////////////////////////
+	template<class database_settings_type>
+	class database_budget_manager
+	{
+	public:
+		//////////////////////////////////////////////////////////////////////////
+		// Constructs a budget manager instance.
+		database_budget_manager();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Destructs a budget manager instance.
+		~database_budget_manager();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Binds the budget manager to an initialized database context with a budget in bytes per tier.
+		// Intermediate tiers, if any (see ACL_NUM_DATABASE_TIERS), are unbounded until 'set_budget(..)' is called.
+		// Returns whether initialization was successful or not.
+		bool initialize(iallocator& allocator, database_context<database_settings_type>& context, uint32_t medium_tier_budget, uint32_t low_tier_budget);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if this budget manager is bound to a database context.
+		bool is_initialized() const { return m_context != nullptr; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Unbinds the budget manager from its database context and stops tracking chunk usage.
+		void reset();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the budget in bytes of the specified database tier.
+		uint32_t get_budget(quality_tier tier) const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Sets the budget in bytes of the specified database tier.
+		void set_budget(quality_tier tier, uint32_t budget);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the size in bytes of the chunks loaded for the specified database tier.
+		uint32_t get_streamed_in_size(quality_tier tier) const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Advances the frame counter that is stamped on sampled chunks.
+		void advance_frame();
+
+		//////////////////////////////////////////////////////////////////////////
+		// If the specified database tier is over budget, issues a stream out request for the
+		// least recently sampled chunk and returns the current status.
+		// Returns 'done' when the tier fits within its budget.
+		database_stream_request_result update(quality_tier tier);
+
+	private:
+		database_budget_manager(const database_budget_manager& other) = delete;
+		database_budget_manager& operator=(const database_budget_manager& other) = delete;
+
+		iallocator* m_allocator;
+		database_context<database_settings_type>* m_context;
+		acl_impl::database_chunk_usage_v0* m_chunk_usage;
+
+		uint32_t m_budgets[k_num_database_tiers];
+	};
+
+	template<class database_settings_type>
+	inline database_budget_manager<database_settings_type>::database_budget_manager()
+		: m_allocator(nullptr)
+		, m_context(nullptr)
+		, m_chunk_usage(nullptr)
+		, m_budgets{}
+	{
+	}
+
+	template<class database_settings_type>
+	inline database_budget_manager<database_settings_type>::~database_budget_manager()
+	{
+		reset();
+	}
+
+	template<class database_settings_type>
+	inline bool database_budget_manager<database_settings_type>::initialize(iallocator& allocator, database_context<database_settings_type>& context, uint32_t medium_tier_budget, uint32_t low_tier_budget)
+	{
+		ACL_ASSERT(!is_initialized(), "Cannot initialize budget manager twice");
+		if (is_initialized())
+			return false;
+
+		ACL_ASSERT(context.is_initialized(), "Database context isn't initialized");
+		if (!context.is_initialized())
+			return false;
+
+		acl_impl::database_context_v0& context_v0 = context.m_context;
+		ACL_ASSERT(context_v0.chunk_usage == nullptr, "Database context already has a budget manager");
+		if (context_v0.chunk_usage != nullptr)
+			return false;
+
+		const compressed_database& database = *context.get_compressed_database();
+
+		acl_impl::database_chunk_usage_v0* chunk_usage = allocate_type<acl_impl::database_chunk_usage_v0>(allocator);
+		chunk_usage->current_frame.store(0, std::memory_order::memory_order_relaxed);
+		chunk_usage->max_chunk_size = database.get_max_chunk_size();
+
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			const uint32_t num_chunks = database.get_num_chunks(get_database_quality_tier(tier_index));
+			chunk_usage->num_chunks[tier_index] = num_chunks;
+
+			std::atomic<uint32_t>* last_sampled_frames = allocate_type_array<std::atomic<uint32_t>>(allocator, num_chunks);
+			for (uint32_t chunk_index = 0; chunk_index < num_chunks; ++chunk_index)
+				last_sampled_frames[chunk_index].store(0, std::memory_order::memory_order_relaxed);
+
+			chunk_usage->last_sampled_frames[tier_index] = last_sampled_frames;
+		}
+
+		m_allocator = &allocator;
+		m_context = &context;
+		m_chunk_usage = chunk_usage;
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			m_budgets[tier_index] = ~0U;
+
+		m_budgets[0] = medium_tier_budget;
+		m_budgets[k_num_database_tiers - 1] = low_tier_budget;
+
+		// Start tracking
+		context_v0.chunk_usage = chunk_usage;
+
+		return true;
+	}
+
+	template<class database_settings_type>
+	inline void database_budget_manager<database_settings_type>::reset()
+	{
+		if (!is_initialized())
+			return;	// Nothing to do
+
+		// Stop tracking
+		if (m_context->is_initialized())
+			m_context->m_context.chunk_usage = nullptr;
+
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			deallocate_type_array(*m_allocator, m_chunk_usage->last_sampled_frames[tier_index], m_chunk_usage->num_chunks[tier_index]);
+
+		deallocate_type(*m_allocator, m_chunk_usage);
+
+		m_allocator = nullptr;
+		m_context = nullptr;
+		m_chunk_usage = nullptr;
+	}
+
+	template<class database_settings_type>
+	inline uint32_t database_budget_manager<database_settings_type>::get_budget(quality_tier tier) const
+	{
+		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
+		if (tier == quality_tier::highest_importance)
+			return 0;
+
+		return m_budgets[uint32_t(tier) - 1];
+	}
+
+	template<class database_settings_type>
+	inline void database_budget_manager<database_settings_type>::set_budget(quality_tier tier, uint32_t budget)
+	{
+		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
+		if (tier == quality_tier::highest_importance)
+			return;
+
+		m_budgets[uint32_t(tier) - 1] = budget;
+	}
+
+	template<class database_settings_type>
+	inline uint32_t database_budget_manager<database_settings_type>::get_streamed_in_size(quality_tier tier) const
+	{
+		ACL_ASSERT(is_initialized(), "Budget manager isn't initialized");
+		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
+		if (!is_initialized() || tier == quality_tier::highest_importance)
+			return 0;
+
+		const acl_impl::database_context_v0& context_v0 = m_context->m_context;
+		const acl_impl::database_header& header = acl_impl::get_database_header(*context_v0.db);
+		const uint32_t tier_index = uint32_t(tier) - 1;
+		const acl_impl::database_chunk_description* chunk_descriptions = header.get_chunk_descriptions(tier_index);
+		const uint32_t num_chunks = header.num_chunks[tier_index];
+		const bitset_description desc = bitset_description::make_from_num_bits(num_chunks);
+		const uint32_t* loaded_chunks = context_v0.loaded_chunks[tier_index];
+
+		// Retire our completed request, if any, to account for the chunks it streamed
+		m_context->retire_streaming_request(tier_index);
+
+		uint32_t streamed_in_size = 0;
+		for (uint32_t chunk_index = 0; chunk_index < num_chunks; ++chunk_index)
+		{
+			if (bitset_test(loaded_chunks, desc, chunk_index))
+				streamed_in_size += chunk_descriptions[chunk_index].size;
+		}
+
+		return streamed_in_size;
+	}
+
+	template<class database_settings_type>
+	inline void database_budget_manager<database_settings_type>::advance_frame()
+	{
+		ACL_ASSERT(is_initialized(), "Budget manager isn't initialized");
+		if (!is_initialized())
+			return;
+
+		// Only we write to the frame counter, decompression threads only read it
+		const uint32_t current_frame = m_chunk_usage->current_frame.load(std::memory_order::memory_order_relaxed);
+		m_chunk_usage->current_frame.store(current_frame + 1, std::memory_order::memory_order_relaxed);
+	}
+
+	template<class database_settings_type>
+	inline database_stream_request_result database_budget_manager<database_settings_type>::update(quality_tier tier)
+	{
+		ACL_ASSERT(is_initialized(), "Budget manager isn't initialized");
+		if (!is_initialized() || !m_context->is_initialized())
+			return database_stream_request_result::context_not_initialized;
+
+		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
+		if (tier == quality_tier::highest_importance)
+			return database_stream_request_result::invalid_database_tier;
+
+		if (m_context->is_streaming(tier))
+			return database_stream_request_result::streaming_in_progress;	// Can't stream while we are streaming
+
+		const uint32_t tier_index = uint32_t(tier) - 1;
+		if (get_streamed_in_size(tier) <= m_budgets[tier_index])
+			return database_stream_request_result::done;	// Within budget, nothing to do
+
+		const acl_impl::database_context_v0& context_v0 = m_context->m_context;
+		const uint32_t num_chunks = m_chunk_usage->num_chunks[tier_index];
+		const bitset_description desc = bitset_description::make_from_num_bits(num_chunks);
+		const uint32_t* loaded_chunks = context_v0.loaded_chunks[tier_index];
+		const std::atomic<uint32_t>* last_sampled_frames = m_chunk_usage->last_sampled_frames[tier_index];
+		const uint32_t current_frame = m_chunk_usage->current_frame.load(std::memory_order::memory_order_relaxed);
+
+		// Find the least recently sampled chunk, the age is computed with wrapping in mind
+		uint32_t lru_chunk_index = ~0U;
+		uint32_t lru_chunk_age = 0;
+		for (uint32_t chunk_index = 0; chunk_index < num_chunks; ++chunk_index)
+		{
+			if (!bitset_test(loaded_chunks, desc, chunk_index))
+				continue;
+
+			const uint32_t chunk_age = current_frame - last_sampled_frames[chunk_index].load(std::memory_order::memory_order_relaxed);
+			if (lru_chunk_index == ~0U || chunk_age > lru_chunk_age)
+			{
+				lru_chunk_index = chunk_index;
+				lru_chunk_age = chunk_age;
+			}
+		}
+
+		if (lru_chunk_index == ~0U)
+			return database_stream_request_result::done;	// Nothing loaded
+
+		return m_context->stream_out_range(tier, lru_chunk_index, lru_chunk_index + 1, 1);
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,337 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// This header is opt-in and requires C++20 coroutines, the rest of the library only requires C++11
+#if !defined(__cpp_impl_coroutine) || __cpp_impl_coroutine < 201902L
+	#error "acl/decompression/database/database_coroutines.h requires C++20 coroutine support"
+#endif
+
+#include "acl/version.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/quality_tiers.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/decompression/database/database.h"
+#include "acl/decompression/database/database_streamer.h"
+
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	template<class database_settings_type>
+	class database_stream_awaiter;
+
+	//////////////////////////////////////////////////////////////////////////
+	// Wraps the streaming requests of a database context as C++20 awaitables that
+	// resume the awaiting coroutine as soon as the streamer completes or cancels them.
+	//
+	// The awaitables bind themselves as the streaming listener of the context, see
+	// database_context::set_streaming_listener(..). While bound, every request of the
+	// context must be issued through them.
+	//
+	// Awaiting dispatches the request and returns the result of the dispatch. When it is
+	// 'dispatched', the coroutine only resumes once the request is no longer in flight.
+	// Streaming progressively is a loop:
+	//
+	//    while (co_await awaitables.stream_in(tier, num_chunks) == database_stream_request_result::dispatched) {}
+	//
+	// Requests complete on the thread of the streamer (e.g. an IO worker). By default, the
+	// coroutine resumes right away on that thread. Since the database context can only be used
+	// by the thread that dispatches requests, provide a resume function that schedules the
+	// coroutine on it (e.g. posts it to a game thread queue) if the streamer is asynchronous.
+	//
+	// Only one coroutine can await a given tier at a time since only one request can be in flight
+	// per tier. The awaitables must outlive the coroutines that await them.
+	//////////////////////////////////////////////////////////////////////////
+	template<class database_settings_type>
+	class database_streaming_awaitables final : public database_streaming_listener
+	{
+	public:
+		//////////////////////////////////////////////////////////////////////////
+		// A function that resumes the provided coroutine, called from the thread that completes requests.
+		using resume_function = void (*)(std::coroutine_handle<> handle, void* user_data);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Binds to the provided initialized database context. No request can be in flight.
+		// When no resume function is provided, coroutines resume on the thread that completes requests.
+		explicit database_streaming_awaitables(database_context<database_settings_type>& context, resume_function resume = nullptr, void* user_data = nullptr);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Unbinds from the database context. No request can be in flight.
+		~database_streaming_awaitables();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns an awaitable that issues a stream in request, see database_context::stream_in(..).
+		database_stream_awaiter<database_settings_type> stream_in(quality_tier tier, uint32_t num_chunks_to_stream = ~0U, streaming_priority priority = streaming_priority::normal);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns an awaitable that issues a stream out request, see database_context::stream_out(..).
+		database_stream_awaiter<database_settings_type> stream_out(quality_tier tier, uint32_t num_chunks_to_stream = ~0U);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns an awaitable that issues a stream in request for the chunks the provided compressed tracks need,
+		// see database_context::stream_in(..). The compressed tracks must outlive the awaitable.
+		database_stream_awaiter<database_settings_type> stream_in(const compressed_tracks& tracks, quality_tier tier, streaming_priority priority = streaming_priority::normal);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns an awaitable that issues a stream out request for the chunks the provided compressed tracks use,
+		// see database_context::stream_out(..). The compressed tracks must outlive the awaitable.
+		database_stream_awaiter<database_settings_type> stream_out(const compressed_tracks& tracks, quality_tier tier);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns an awaitable that issues a stream in request for the queued chunks,
+		// see database_context::dispatch_queued_stream_in(..).
+		database_stream_awaiter<database_settings_type> dispatch_queued_stream_in(quality_tier tier, uint32_t num_chunks_to_stream = ~0U);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the database context we are bound to.
+		database_context<database_settings_type>& get_context() const { return m_context; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Called by the thread that completes or cancels a request, resumes the coroutine awaiting it, if any.
+		virtual void on_request_completed(streaming_action action, quality_tier tier, bool succeeded) override;
+
+	private:
+		database_streaming_awaitables(const database_streaming_awaitables&) = delete;
+		database_streaming_awaitables& operator=(const database_streaming_awaitables&) = delete;
+
+		// Registers the coroutine awaiting the request we just dispatched for the specified tier.
+		// Returns false if the request already completed and the coroutine must resume right away.
+		bool suspend(uint32_t tier_index, std::coroutine_handle<> handle);
+
+		// The state of a tier, see suspend(..) and on_request_completed(..)
+		struct tier_state
+		{
+			// Number of requests completed or canceled, written by the threads that complete requests
+			std::atomic<uint32_t>	num_completed_requests{ 0 };
+
+			// Completion count the awaiting coroutine resumes on, written by the thread that dispatches requests
+			std::atomic<uint32_t>	awaited_request_count{ 0 };
+
+			// Address of the awaiting coroutine handle, nullptr if there is none
+			// Whichever thread exchanges it with nullptr first resumes the coroutine
+			std::atomic<void*>		awaiting_coroutine{ nullptr };
+
+			// Number of requests dispatched, only touched by the thread that dispatches requests
+			uint32_t				num_dispatched_requests = 0;
+		};
+
+		database_context<database_settings_type>& m_context;
+		resume_function m_resume;
+		void* m_user_data;
+
+		tier_state m_tiers[k_num_database_tiers];
+
+		friend class database_stream_awaiter<database_settings_type>;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// An awaitable streaming request, see database_streaming_awaitables.
+	// The request is dispatched when the awaitable is awaited.
+	//////////////////////////////////////////////////////////////////////////
+	template<class database_settings_type>
+	class database_stream_awaiter
+	{
+	public:
+		bool await_ready() const noexcept { return false; }
+		bool await_suspend(std::coroutine_handle<> handle);
+		database_stream_request_result await_resume() const noexcept { return m_result; }
+
+	private:
+		enum class request_kind
+		{
+			stream_in,
+			stream_out,
+			stream_in_tracks,
+			stream_out_tracks,
+			dispatch_queued_stream_in,
+		};
+
+		database_stream_awaiter(database_streaming_awaitables<database_settings_type>& awaitables, request_kind kind, const compressed_tracks* tracks, quality_tier tier, uint32_t num_chunks_to_stream, streaming_priority priority)
+			: m_awaitables(awaitables)
+			, m_tracks(tracks)
+			, m_kind(kind)
+			, m_tier(tier)
+			, m_num_chunks_to_stream(num_chunks_to_stream)
+			, m_priority(priority)
+			, m_result(database_stream_request_result::context_not_initialized)
+		{}
+
+		// Issues our request to the database context
+		database_stream_request_result dispatch() const;
+
+		database_streaming_awaitables<database_settings_type>& m_awaitables;
+		const compressed_tracks* m_tracks;
+		request_kind m_kind;
+		quality_tier m_tier;
+		uint32_t m_num_chunks_to_stream;
+		streaming_priority m_priority;
+		database_stream_request_result m_result;
+
+		friend class database_streaming_awaitables<database_settings_type>;
+	};
+
+	template<class database_settings_type>
+	inline database_streaming_awaitables<database_settings_type>::database_streaming_awaitables(database_context<database_settings_type>& context, resume_function resume, void* user_data)
+		: m_context(context)
+		, m_resume(resume)
+		, m_user_data(user_data)
+		, m_tiers()
+	{
+		context.set_streaming_listener(this);
+	}
+
+	template<class database_settings_type>
+	inline database_streaming_awaitables<database_settings_type>::~database_streaming_awaitables()
+	{
+		if (m_context.is_initialized())
+			m_context.set_streaming_listener(nullptr);
+	}
+
+	template<class database_settings_type>
+	inline database_stream_awaiter<database_settings_type> database_streaming_awaitables<database_settings_type>::stream_in(quality_tier tier, uint32_t num_chunks_to_stream, streaming_priority priority)
+	{
+		using kind = typename database_stream_awaiter<database_settings_type>::request_kind;
+		return database_stream_awaiter<database_settings_type>(*this, kind::stream_in, nullptr, tier, num_chunks_to_stream, priority);
+	}
+
+	template<class database_settings_type>
+	inline database_stream_awaiter<database_settings_type> database_streaming_awaitables<database_settings_type>::stream_out(quality_tier tier, uint32_t num_chunks_to_stream)
+	{
+		using kind = typename database_stream_awaiter<database_settings_type>::request_kind;
+		return database_stream_awaiter<database_settings_type>(*this, kind::stream_out, nullptr, tier, num_chunks_to_stream, streaming_priority::normal);
+	}
+
+	template<class database_settings_type>
+	inline database_stream_awaiter<database_settings_type> database_streaming_awaitables<database_settings_type>::stream_in(const compressed_tracks& tracks, quality_tier tier, streaming_priority priority)
+	{
+		using kind = typename database_stream_awaiter<database_settings_type>::request_kind;
+		return database_stream_awaiter<database_settings_type>(*this, kind::stream_in_tracks, &tracks, tier, ~0U, priority);
+	}
+
+	template<class database_settings_type>
+	inline database_stream_awaiter<database_settings_type> database_streaming_awaitables<database_settings_type>::stream_out(const compressed_tracks& tracks, quality_tier tier)
+	{
+		using kind = typename database_stream_awaiter<database_settings_type>::request_kind;
+		return database_stream_awaiter<database_settings_type>(*this, kind::stream_out_tracks, &tracks, tier, ~0U, streaming_priority::normal);
+	}
+
+	template<class database_settings_type>
+	inline database_stream_awaiter<database_settings_type> database_streaming_awaitables<database_settings_type>::dispatch_queued_stream_in(quality_tier tier, uint32_t num_chunks_to_stream)
+	{
+		using kind = typename database_stream_awaiter<database_settings_type>::request_kind;
+		return database_stream_awaiter<database_settings_type>(*this, kind::dispatch_queued_stream_in, nullptr, tier, num_chunks_to_stream, streaming_priority::normal);
+	}
+
+	template<class database_settings_type>
+	inline bool database_streaming_awaitables<database_settings_type>::suspend(uint32_t tier_index, std::coroutine_handle<> handle)
+	{
+		tier_state& state = m_tiers[tier_index];
+		ACL_ASSERT(state.awaiting_coroutine.load(std::memory_order::memory_order_relaxed) == nullptr, "A coroutine is already awaiting this tier");
+
+		// Our request is the next one to complete, older completions might still be notifying us
+		const uint32_t awaited_request_count = ++state.num_dispatched_requests;
+		state.awaited_request_count.store(awaited_request_count, std::memory_order::memory_order_relaxed);
+		state.awaiting_coroutine.store(handle.address(), std::memory_order::memory_order_seq_cst);
+
+		// Synchronous streamers complete the request before we register our coroutine, it might have been missed
+		const uint32_t num_completed_requests = state.num_completed_requests.load(std::memory_order::memory_order_seq_cst);
+		if (int32_t(num_completed_requests - awaited_request_count) < 0)
+			return true;	// Still in flight, we'll be resumed when it completes
+
+		// Completed, resume right away unless the completing thread already took our coroutine
+		return state.awaiting_coroutine.exchange(nullptr, std::memory_order::memory_order_acq_rel) == nullptr;
+	}
+
+	template<class database_settings_type>
+	inline void database_streaming_awaitables<database_settings_type>::on_request_completed(streaming_action action, quality_tier tier, bool succeeded)
+	{
+		(void)action;
+		(void)succeeded;
+
+		tier_state& state = m_tiers[uint32_t(tier) - 1];
+
+		// Completions of a tier can be notified out of order when requests complete on different threads but
+		// our count only reaches the awaited value once every request up to the awaited one has completed
+		const uint32_t num_completed_requests = state.num_completed_requests.fetch_add(1, std::memory_order::memory_order_seq_cst) + 1;
+		if (state.awaiting_coroutine.load(std::memory_order::memory_order_seq_cst) == nullptr)
+			return;	// Nobody awaits, or our request completed before the coroutine registered, see suspend(..)
+
+		if (int32_t(num_completed_requests - state.awaited_request_count.load(std::memory_order::memory_order_relaxed)) < 0)
+			return;	// An older request completed, the awaited one is still in flight
+
+		void* coroutine_address = state.awaiting_coroutine.exchange(nullptr, std::memory_order::memory_order_acq_rel);
+		if (coroutine_address == nullptr)
+			return;	// The awaiting coroutine resumed on its own
+
+		const std::coroutine_handle<> handle = std::coroutine_handle<>::from_address(coroutine_address);
+		if (m_resume != nullptr)
+			m_resume(handle, m_user_data);
+		else
+			handle.resume();
+	}
+
+	template<class database_settings_type>
+	inline bool database_stream_awaiter<database_settings_type>::await_suspend(std::coroutine_handle<> handle)
+	{
+		m_result = dispatch();
+		if (m_result != database_stream_request_result::dispatched)
+			return false;	// Nothing is in flight for us, resume right away
+
+		// The awaiter is part of the coroutine frame, we can't touch it past this point if we remain suspended
+		return m_awaitables.suspend(uint32_t(m_tier) - 1, handle);
+	}
+
+	template<class database_settings_type>
+	inline database_stream_request_result database_stream_awaiter<database_settings_type>::dispatch() const
+	{
+		database_context<database_settings_type>& context = m_awaitables.get_context();
+
+		switch (m_kind)
+		{
+		case request_kind::stream_in:
+			return context.stream_in(m_tier, m_num_chunks_to_stream, m_priority);
+		case request_kind::stream_out:
+			return context.stream_out(m_tier, m_num_chunks_to_stream);
+		case request_kind::stream_in_tracks:
+			return context.stream_in(*m_tracks, m_tier, m_priority);
+		case request_kind::stream_out_tracks:
+			return context.stream_out(*m_tracks, m_tier);
+		case request_kind::dispatch_queued_stream_in:
+		default:
+			return context.dispatch_queued_stream_in(m_tier, m_num_chunks_to_stream);
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -53,6 +53,22 @@ namespace acl
 		// versions which yields optimal performance.
 		// Must be static constexpr!
 		static constexpr compressed_tracks_version16 version_supported() { return compressed_tracks_version16::any; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not to gather streaming telemetry: key frames requested by seeks, served
+		// from each quality tier, reconstructed because they weren't resident, and bytes streamed in/out.
+		// Counters are updated with atomics from every decompressing thread, disabled by default.
+		// See database_context::get_telemetry(..).
+		// Must be static constexpr!
+		static constexpr bool is_telemetry_supported() { return false; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not to validate the checksum of every chunk when a stream in request completes.
+		// A request with a corrupted chunk fails as if it had been canceled and none of its chunks
+		// are used, the streaming listener is notified. Disabled by default.
+		// This is much cheaper than compressed_database::is_valid(true) which hashes the whole database.
+		// Must be static constexpr!
+		static constexpr bool is_chunk_validation_enabled() { return false; }
 	};
 
 	//////////////////////////////////////////////////////////////////////////
@@ -69,6 +85,8 @@ namespace acl
 	//////////////////////////////////////////////////////////////////////////
 	struct debug_database_settings : public database_settings
 	{
+		static constexpr bool is_telemetry_supported() { return true; }
+		static constexpr bool is_chunk_validation_enabled() { return true; }
 	};
 
 	//////////////////////////////////////////////////////////////////////////
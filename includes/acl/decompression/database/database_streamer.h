@@ -50,12 +50,23 @@ namespace acl
 		stream_out,
 	};
 
+	//////////////////////////////////////////////////////////////////////////
+	// Enum representing the priority of a streaming request
+	//////////////////////////////////////////////////////////////////////////
+	enum class streaming_priority : uint8_t
+	{
+		low,		// e.g. background prefetching
+		normal,
+		high,		// e.g. clips playing on screen
+	};
+
 	//////////////////////////////////////////////////////////////////////////
 	// A streaming request
 	//////////////////////////////////////////////////////////////////////////
 	struct streaming_request
 	{
 		streaming_action		action = streaming_action::stream_in;
+		streaming_priority		priority = streaming_priority::normal;
 		quality_tier			tier = quality_tier::highest_importance;	// Marks the request as invalid since we never stream the highest tier
 		uint32_t				first_chunk_index = 0;
 		uint32_t				num_streaming_chunks = 0;
@@ -81,6 +92,27 @@ namespace acl
 	// An invalid streaming request ID
 	constexpr streaming_request_id k_invalid_streamer_request_id = { ~0ULL };
 
+	////////////////////////////////////////////////////////////////////////////////
+	// An optional listener notified when streaming requests complete or are canceled,
+	// see database_context::set_streaming_listener(..).
+	//
+	// It allows the code that issues requests to react as soon as they complete instead
+	// of polling database_context::is_streaming(..).
+	////////////////////////////////////////////////////////////////////////////////
+	class database_streaming_listener
+	{
+	public:
+		//////////////////////////////////////////////////////////////////////////
+		// Listener destructor
+		virtual ~database_streaming_listener() = default;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Called by the thread that completes or cancels a request (e.g. an IO worker) once it is no longer
+		// in flight. The database context retires it the next time it is queried by the thread that dispatches
+		// requests, the context must not be used from here.
+		virtual void on_request_completed(streaming_action action, quality_tier tier, bool succeeded) = 0;
+	};
+
 	////////////////////////////////////////////////////////////////////////////////
 	// The base class for database streamers.
 	//
@@ -91,6 +123,10 @@ namespace acl
 	// Streamers cannot be shared by multiple databases.
 	// A streamer implementation must also provide a list of streaming requests to use and
 	// recycle. A proper implementation should consider how many requests it needs.
+	// Requests can be completed or canceled from any thread (e.g. an IO worker thread) while
+	// decompression is in progress and while the database context is used by the thread that
+	// dispatches requests: completion is published lock free and the context retires completed
+	// requests the next time it is queried.
 	////////////////////////////////////////////////////////////////////////////////
 	class database_streamer
 	{
@@ -137,9 +173,21 @@ namespace acl
 		// A stream out request CANNOT be canceled!
 		virtual void stream_out(uint32_t offset, uint32_t size, bool can_deallocate_bulk_data, quality_tier tier, streaming_request_id request_id) = 0;
 
+		//////////////////////////////////////////////////////////////////////////
+		// Called when the database context compacts the specified quality tier, see database_context::compact(..).
+		// The offset into the bulk data returned by get_bulk_data(..) and the size in bytes of a range that contains
+		// no chunk streamed in are provided as arguments. Decompression does not read it until it streams back in.
+		// The streamer can return the memory backing the range to the system (e.g. whole pages) but the bulk data
+		// pointer cannot change and later stream in requests must be able to write into the range again.
+		// This is synchronous and is never called while a request is in flight for the tier.
+		// By default, nothing is released.
+		virtual void release_unused_bulk_data(uint32_t offset, uint32_t size, quality_tier tier) { (void)offset; (void)size; (void)tier; }
+
 		//////////////////////////////////////////////////////////////////////////
 		// Signifies that the streamer has completed this streaming request successfully.
-		// The bulk data must be allocated and ready to use.
+		// The bulk data must be allocated and ready to use. This can be called from any thread
+		// as long as the streamed in bulk data was written by, or is visible to, the calling thread.
+		// A request must be completed or canceled exactly once.
 		void complete(streaming_request_id request_id);
 
 		//////////////////////////////////////////////////////////////////////////
@@ -152,6 +200,31 @@ namespace acl
 		// The provided requests will be used and recycled internally when we stream in/out.
 		database_streamer(streaming_request* requests, uint32_t num_requests);
 
+		//////////////////////////////////////////////////////////////////////////
+		// Returns whether or not the bulk data of the specified tier is entropy coded.
+		// When it is, the offsets and sizes provided to stream_in(..) and stream_out(..) refer to the
+		// bulk data as stored while the bulk data returned by get_bulk_data(..) must contain the decoded
+		// chunks, see decode_bulk_data(..).
+		// The streamer must be bound to a database context, which is the case once streaming begins.
+		bool is_bulk_data_entropy_coded(quality_tier tier) const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the size in bytes of the decoded bulk data for the specified tier.
+		// The streamer must be bound to a database context, which is the case once streaming begins.
+		uint32_t get_decoded_bulk_data_size(quality_tier tier) const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Decodes every entropy coded chunk within the stored bulk data range provided into the decoded bulk data.
+		// The stored data points to the 'size' bytes we read from 'offset' in the bulk data as stored.
+		// Returns false if the stored data is malformed.
+		bool decode_bulk_data(quality_tier tier, uint32_t offset, uint32_t size, const uint8_t* stored_data, uint8_t* bulk_data) const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the priority of the provided request while it is in flight.
+		// Streamers that service several requests at once (e.g. shared between tiers or forwarding to an
+		// IO scheduler) should service the higher priorities first.
+		streaming_priority get_request_priority(streaming_request_id request_id) const;
+
 	private:
 		//////////////////////////////////////////////////////////////////////////
 		// Binds this streamer instance to our database context.
@@ -161,7 +234,7 @@ namespace acl
 		//////////////////////////////////////////////////////////////////////////
 		// Finds and builds a new streaming request if we have one to spare, otherwise
 		// the request ID is invalid.
-		streaming_request_id build_request(streaming_action action, quality_tier tier, uint32_t first_chunk_index, uint32_t num_streaming_chunks);
+		streaming_request_id build_request(streaming_action action, streaming_priority priority, quality_tier tier, uint32_t first_chunk_index, uint32_t num_streaming_chunks);
 
 		acl_impl::database_context_v0* m_context;
 		streaming_request* m_requests;
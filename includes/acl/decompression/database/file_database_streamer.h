@@ -0,0 +1,289 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/error.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/memory_utils.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/decompression/database/database_streamer.h"
+#include "acl/decompression/database/impl/streaming_job_queue.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+
+#if defined(_WIN32)
+	#include <windows.h>
+#else
+	#include <sys/mman.h>
+	#include <unistd.h>
+#endif
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Implements an asynchronous streamer that reads the bulk data from a file written
+	// from the output of 'split_database_bulk_data(..)'.
+	// Reads are performed by a dedicated IO worker thread in blocks of at most 'read_granularity'
+	// bytes, typically the database max chunk size. Requests are completed from that worker
+	// thread and never block the thread that issues them.
+	// Entropy coded tiers are decoded by the worker thread as they stream in.
+	// The bulk data is only freed once every chunk streams out, compacting returns the pages of the
+	// chunks streamed out in the meantime to the OS.
+	// An optional latency can be added before every request is read to simulate slower
+	// storage (e.g. optical media or network) when profiling.
+	// It cannot be shared between tiers.
+	////////////////////////////////////////////////////////////////////////////////
+	class file_database_streamer final : public database_streamer
+	{
+	public:
+		file_database_streamer(iallocator& allocator, const char* bulk_data_filename, uint32_t bulk_data_size, uint32_t read_granularity, uint32_t simulated_latency_us = 0)
+			: database_streamer(m_requests, k_max_num_requests)
+			, m_allocator(allocator)
+			, m_file(open_file(bulk_data_filename))
+			, m_streamed_bulk_data(nullptr)
+			, m_bulk_data_size(bulk_data_size)
+			, m_streamed_bulk_data_size(0)
+			, m_read_granularity(read_granularity)
+			, m_simulated_latency_us(simulated_latency_us)
+			, m_page_size(get_page_size())
+		{
+			ACL_ASSERT(read_granularity != 0, "Read granularity must be greater than zero");
+
+			if (m_file != nullptr)
+				m_worker = std::thread([this]() { execute_jobs(); });
+		}
+
+		virtual ~file_database_streamer() override
+		{
+			m_jobs.stop();
+
+			if (m_worker.joinable())
+				m_worker.join();
+
+			if (m_file != nullptr)
+				std::fclose(m_file);
+
+			deallocate_type_array(m_allocator, m_streamed_bulk_data, m_streamed_bulk_data_size);
+		}
+
+		virtual bool is_initialized() const override { return m_bulk_data_size == 0 || m_file != nullptr; }
+
+		virtual const uint8_t* get_bulk_data(quality_tier tier) const override
+		{
+			ACL_ASSERT(tier != quality_tier::highest_importance, "Cannot stream the highest importance tier");
+			(void)tier;
+			return m_streamed_bulk_data;
+		}
+
+		virtual void stream_in(uint32_t offset, uint32_t size, bool can_allocate_bulk_data, quality_tier tier, streaming_request_id request_id) override
+		{
+			ACL_ASSERT(offset < m_bulk_data_size, "Steam offset is outside of the bulk data range");
+			ACL_ASSERT(size <= m_bulk_data_size, "Stream size is larger than the bulk data size");
+			ACL_ASSERT(uint64_t(offset) + uint64_t(size) <= uint64_t(m_bulk_data_size), "Streaming request is outside of the bulk data range");
+
+			// Entropy coded chunks are decoded into the normal chunk layout, our bulk data must be large enough to hold it
+			const bool is_entropy_coded = is_bulk_data_entropy_coded(tier);
+
+			if (can_allocate_bulk_data)
+			{
+				ACL_ASSERT(m_streamed_bulk_data == nullptr, "Bulk data already allocated");
+
+				// Allocate right away so that the pointer is stable before the worker thread writes into it
+				m_streamed_bulk_data_size = is_entropy_coded ? get_decoded_bulk_data_size(tier) : m_bulk_data_size;
+				m_streamed_bulk_data = allocate_type_array<uint8_t>(m_allocator, m_streamed_bulk_data_size);
+			}
+
+			acl_impl::streaming_job job;
+			job.request_id = request_id;
+			job.offset = offset;
+			job.size = size;
+			job.tier = tier;
+			job.is_entropy_coded = is_entropy_coded;
+
+			if (m_file == nullptr || !m_jobs.push(job))
+				cancel(request_id);
+		}
+
+		virtual void stream_out(uint32_t offset, uint32_t size, bool can_deallocate_bulk_data, quality_tier tier, streaming_request_id request_id) override
+		{
+			ACL_ASSERT(offset < m_bulk_data_size, "Steam offset is outside of the bulk data range");
+			ACL_ASSERT(size <= m_bulk_data_size, "Stream size is larger than the bulk data size");
+			ACL_ASSERT(uint64_t(offset) + uint64_t(size) <= uint64_t(m_bulk_data_size), "Streaming request is outside of the bulk data range");
+			(void)offset;
+			(void)size;
+			(void)tier;
+
+			// Nothing to write back, the data simply becomes unused
+			// Only a single request can be in flight per tier, the worker thread no longer touches our buffer
+			if (can_deallocate_bulk_data)
+			{
+				ACL_ASSERT(m_streamed_bulk_data != nullptr, "Bulk data already deallocated");
+
+				deallocate_type_array(m_allocator, m_streamed_bulk_data, m_streamed_bulk_data_size);
+				m_streamed_bulk_data = nullptr;
+			}
+
+			complete(request_id);
+		}
+
+		virtual void release_unused_bulk_data(uint32_t offset, uint32_t size, quality_tier tier) override
+		{
+			ACL_ASSERT(uint64_t(offset) + uint64_t(size) <= uint64_t(m_streamed_bulk_data_size), "Release range is outside of the bulk data range");
+			(void)tier;
+
+			if (m_streamed_bulk_data == nullptr)
+				return;
+
+			// We can only release the pages entirely contained within our range, the others hold chunks still in use
+			const uintptr_t range_start = reinterpret_cast<uintptr_t>(m_streamed_bulk_data) + offset;
+			const uintptr_t first_page = align_to(range_start, m_page_size);
+			const uintptr_t end_page = (range_start + size) / m_page_size * m_page_size;
+			if (first_page >= end_page)
+				return;
+
+			// The pages remain part of our allocation, the worker thread can write into them again when they stream back in
+#if defined(_WIN32)
+			VirtualAlloc(reinterpret_cast<void*>(first_page), size_t(end_page - first_page), MEM_RESET, PAGE_READWRITE);
+#else
+			madvise(reinterpret_cast<void*>(first_page), size_t(end_page - first_page), MADV_DONTNEED);
+#endif
+		}
+
+	private:
+		file_database_streamer(const file_database_streamer&) = delete;
+		file_database_streamer& operator=(const file_database_streamer&) = delete;
+
+		static uint32_t get_page_size()
+		{
+#if defined(_WIN32)
+			SYSTEM_INFO system_info;
+			GetSystemInfo(&system_info);
+			return uint32_t(system_info.dwPageSize);
+#else
+			return uint32_t(sysconf(_SC_PAGESIZE));
+#endif
+		}
+
+		static std::FILE* open_file(const char* filename)
+		{
+			if (filename == nullptr)
+				return nullptr;
+
+			std::FILE* file = nullptr;
+
+#ifdef _WIN32
+			fopen_s(&file, filename, "rb");
+#else
+			file = fopen(filename, "rb");
+#endif
+
+			if (file != nullptr)
+				setvbuf(file, nullptr, _IONBF, 0);	// We read large blocks directly into the bulk data, no need to buffer
+
+			return file;
+		}
+
+		bool read_range(uint32_t offset, uint32_t size, uint8_t* buffer)
+		{
+#ifdef _WIN32
+			const int seek_result = _fseeki64(m_file, int64_t(offset), SEEK_SET);
+#else
+			const int seek_result = fseeko(m_file, off_t(offset), SEEK_SET);
+#endif
+
+			if (seek_result != 0)
+				return false;
+
+			while (size != 0)
+			{
+				const uint32_t read_size = std::min<uint32_t>(size, m_read_granularity);
+				if (std::fread(buffer, 1, read_size, m_file) != read_size)
+					return false;
+
+				buffer += read_size;
+				size -= read_size;
+			}
+
+			return true;
+		}
+
+		void execute_jobs()
+		{
+			acl_impl::streaming_job job;
+			while (m_jobs.pop(job))
+			{
+				if (m_simulated_latency_us != 0)
+					std::this_thread::sleep_for(std::chrono::microseconds(m_simulated_latency_us));
+
+				if (execute_job(job))
+					complete(job.request_id);
+				else
+					cancel(job.request_id);
+			}
+		}
+
+		bool execute_job(const acl_impl::streaming_job& job)
+		{
+			if (!job.is_entropy_coded)
+				return read_range(job.offset, job.size, m_streamed_bulk_data + job.offset);
+
+			// Read the stored chunks into a temporary buffer and decode them in place in our bulk data
+			uint8_t* stored_data = allocate_type_array<uint8_t>(m_allocator, job.size);
+
+			const bool is_decoded = read_range(job.offset, job.size, stored_data) && decode_bulk_data(job.tier, job.offset, job.size, stored_data, m_streamed_bulk_data);
+
+			deallocate_type_array(m_allocator, stored_data, job.size);
+			return is_decoded;
+		}
+
+		iallocator& m_allocator;
+		std::FILE* m_file;
+		uint8_t* m_streamed_bulk_data;
+		uint32_t m_bulk_data_size;
+		uint32_t m_streamed_bulk_data_size;
+		uint32_t m_read_granularity;
+		uint32_t m_simulated_latency_us;
+		uint32_t m_page_size;
+
+		acl_impl::streaming_job_queue m_jobs;
+		std::thread m_worker;
+
+		static constexpr uint32_t k_max_num_requests = k_num_database_tiers;	// One per database tier
+		streaming_request m_requests[k_max_num_requests];
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -32,7 +32,12 @@
 #include "acl/core/compressed_tracks_version.h"
 #include "acl/decompression/database/impl/database_context.h"
 
+#include <rtm/scalarf.h>
+
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <cstring>
 
 namespace acl
 {
@@ -40,32 +45,136 @@ namespace acl
 
 	namespace acl_impl
 	{
+		// Finds the first run of chunks within [begin_chunk_index, end_chunk_index) that are in the desired loaded state.
+		// Returns the number of chunks in the run, at most max_num_chunks.
+		inline uint32_t find_chunk_run(const uint32_t* loaded_chunks, bitset_description desc, uint32_t begin_chunk_index, uint32_t end_chunk_index, bool is_loaded, uint32_t max_num_chunks, uint32_t& out_first_chunk_index)
+		{
+			uint32_t chunk_index = begin_chunk_index;
+			while (chunk_index < end_chunk_index && bitset_test(loaded_chunks, desc, chunk_index) != is_loaded)
+				chunk_index++;
+
+			out_first_chunk_index = chunk_index;
+
+			uint32_t num_chunks = 0;
+			while (chunk_index < end_chunk_index && num_chunks < max_num_chunks && bitset_test(loaded_chunks, desc, chunk_index) == is_loaded)
+			{
+				chunk_index++;
+				num_chunks++;
+			}
+
+			return num_chunks;
+		}
+
+		// Calculates the range of the bulk data as stored that contains the provided run of chunks
+		// Entropy coded tiers store their chunks back to back, otherwise every chunk but the last is of the max chunk size
+		inline void calculate_chunk_run_stream_range(const database_header& header, quality_tier tier, uint32_t first_chunk_index, uint32_t num_chunks, uint32_t& out_stream_offset, uint32_t& out_stream_size)
+		{
+			const uint32_t tier_index = uint32_t(tier) - 1;
+			const uint32_t last_chunk_index = first_chunk_index + num_chunks - 1;
+
+			if (header.get_is_bulk_data_entropy_coded(tier_index))
+			{
+				const database_chunk_description* encoded_chunk_descriptions = header.get_encoded_chunk_descriptions(tier_index);
+				const database_chunk_description& first_chunk_description = encoded_chunk_descriptions[first_chunk_index];
+				const database_chunk_description& last_chunk_description = encoded_chunk_descriptions[last_chunk_index];
+
+				out_stream_offset = first_chunk_description.offset;
+				out_stream_size = uint32_t(last_chunk_description.offset) + last_chunk_description.size - out_stream_offset;
+			}
+			else
+			{
+				const database_chunk_description* chunk_descriptions = header.get_chunk_descriptions(tier_index);
+				const database_chunk_description& first_chunk_description = chunk_descriptions[first_chunk_index];
+				const database_chunk_description& last_chunk_description = chunk_descriptions[last_chunk_index];
+
+				// Account for the fact that the last chunk doesn't have the same size
+				out_stream_offset = first_chunk_description.offset;
+				out_stream_size = ((num_chunks - 1) * header.max_chunk_size) + last_chunk_description.size;
+			}
+		}
+
 		inline uint32_t calculate_runtime_data_size(const compressed_database& database)
 		{
 			const database_header& header = get_database_header(database);
 
-			const uint32_t num_medium_chunks = header.num_chunks[0];
-			const uint32_t num_low_chunks = header.num_chunks[1];
 			const uint32_t num_clips = header.num_clips;
 			const uint32_t num_segments = header.num_segments;
 
-			const bitset_description medium_desc = bitset_description::make_from_num_bits(num_medium_chunks);
-			const bitset_description low_desc = bitset_description::make_from_num_bits(num_low_chunks);
-
-			const uint32_t medium_bitset_size = medium_desc.get_num_bytes();
-			const uint32_t low_bitset_size = low_desc.get_num_bytes();
-
 			uint32_t runtime_data_size = 0;
-			runtime_data_size += medium_bitset_size;			// Loaded chunks
-			runtime_data_size += medium_bitset_size;			// Streaming chunks
-			runtime_data_size += low_bitset_size;				// Loaded chunks
-			runtime_data_size += low_bitset_size;				// Streaming chunks
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				const bitset_description desc = bitset_description::make_from_num_bits(header.num_chunks[tier_index]);
+				const uint32_t bitset_size = desc.get_num_bytes();
+
+				runtime_data_size += bitset_size;				// Loaded chunks
+				runtime_data_size += bitset_size;				// Streaming chunks
+			}
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+				runtime_data_size += header.num_chunks[tier_index];	// Queued chunk priorities
 			runtime_data_size = align_to(runtime_data_size, 8);	// Align runtime headers
 			runtime_data_size += num_clips * sizeof(database_runtime_clip_header);
 			runtime_data_size += num_segments * sizeof(database_runtime_segment_header);
 
 			return runtime_data_size;
 		}
+
+		// Returns the queued stream in priority of every chunk of a tier, zero if a chunk isn't queued, otherwise its priority + 1
+		// They follow the chunk bitsets of every tier within the runtime data, see calculate_runtime_data_size(..)
+		inline uint8_t* get_queued_chunk_priorities(const database_context_v0& context, uint32_t tier_index)
+		{
+			const database_header& header = get_database_header(*context.db);
+
+			constexpr uint32_t last_tier_index = k_num_database_tiers - 1;
+			const bitset_description last_tier_desc = bitset_description::make_from_num_bits(header.num_chunks[last_tier_index]);
+			uint8_t* queued_chunk_priorities = reinterpret_cast<uint8_t*>(context.streaming_chunks[last_tier_index]) + last_tier_desc.get_num_bytes();
+
+			for (uint32_t prev_tier_index = 0; prev_tier_index < tier_index; ++prev_tier_index)
+				queued_chunk_priorities += header.num_chunks[prev_tier_index];
+
+			return queued_chunk_priorities;
+		}
+
+		// Allocates and sets up the chunk bitsets and the runtime clip/segment headers of a context
+		inline void initialize_runtime_data(database_context_v0& context, iallocator& allocator, const compressed_database& database)
+		{
+			const database_header& header = get_database_header(database);
+
+			// Allocate a single buffer for everything we need. This is faster to allocate and it ensures better virtual
+			// memory locality which should help reduce the cost of TLB misses.
+			const uint32_t runtime_data_size = calculate_runtime_data_size(database);
+			uint8_t* runtime_data_buffer = allocate_type_array_aligned<uint8_t>(allocator, runtime_data_size, 16);
+
+			// Initialize everything to 0
+			std::memset(runtime_data_buffer, 0, runtime_data_size);
+
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				const bitset_description desc = bitset_description::make_from_num_bits(header.num_chunks[tier_index]);
+				const uint32_t bitset_size = desc.get_num_bytes();
+
+				context.loaded_chunks[tier_index] = reinterpret_cast<uint32_t*>(runtime_data_buffer);
+				runtime_data_buffer += bitset_size;
+
+				context.streaming_chunks[tier_index] = reinterpret_cast<uint32_t*>(runtime_data_buffer);
+				runtime_data_buffer += bitset_size;
+			}
+
+			// Skip our queued chunk priorities, see get_queued_chunk_priorities(..)
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+				runtime_data_buffer += header.num_chunks[tier_index];
+
+			context.clip_segment_headers = align_to(runtime_data_buffer, 8);	// Align runtime headers
+
+			// Copy our clip hashes to setup our headers
+			const uint32_t num_clips = header.num_clips;
+			const database_clip_metadata* clip_metadatas = header.get_clip_metadatas();
+			for (uint32_t clip_index = 0; clip_index < num_clips; ++clip_index)
+			{
+				const database_clip_metadata& clip_metadata = clip_metadatas[clip_index];
+				database_runtime_clip_header* clip_header = clip_metadata.get_clip_header(context.clip_segment_headers);
+				clip_header->clip_hash = clip_metadata.clip_hash;
+			}
+		}
 	}
 
 	template<class database_settings_type>
@@ -98,6 +207,15 @@ namespace acl
 		if (!database.is_bulk_data_inline())
 			return false;
 
+		// Entropy coded bulk data must be decoded by a streamer as it streams in
+		bool is_bulk_data_entropy_coded = false;
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			is_bulk_data_entropy_coded |= database.is_bulk_data_entropy_coded(get_database_quality_tier(tier_index));
+
+		ACL_ASSERT(!is_bulk_data_entropy_coded, "Bulk data cannot be entropy coded when initializing without a streamer");
+		if (is_bulk_data_entropy_coded)
+			return false;
+
 		ACL_ASSERT(!is_initialized(), "Cannot initialize database twice");
 		if (is_initialized())
 			return false;
@@ -105,104 +223,54 @@ namespace acl
 		m_context.db = &database;
 		m_context.db_hash = database.get_hash();
 		m_context.allocator = &allocator;
-		m_context.bulk_data[0] = database.get_bulk_data(quality_tier::medium_importance);
-		m_context.bulk_data[1] = database.get_bulk_data(quality_tier::lowest_importance);
-		m_context.streamers[0] = m_context.streamers[1] = nullptr;
-
-		const acl_impl::database_header& header = acl_impl::get_database_header(database);
-
-		const uint32_t num_medium_chunks = header.num_chunks[0];
-		const uint32_t num_low_chunks = header.num_chunks[1];
-
-		const bitset_description medium_desc = bitset_description::make_from_num_bits(num_medium_chunks);
-		const bitset_description low_desc = bitset_description::make_from_num_bits(num_low_chunks);
-
-		const uint32_t medium_bitset_size = medium_desc.get_num_bytes();
-		const uint32_t low_bitset_size = low_desc.get_num_bytes();
-
-		// Allocate a single buffer for everything we need. This is faster to allocate and it ensures better virtual
-		// memory locality which should help reduce the cost of TLB misses.
-		const uint32_t runtime_data_size = acl_impl::calculate_runtime_data_size(database);
-		uint8_t* runtime_data_buffer = allocate_type_array_aligned<uint8_t>(allocator, runtime_data_size, 16);
-
-		// Initialize everything to 0
-		std::memset(runtime_data_buffer, 0, runtime_data_size);
-
-		m_context.loaded_chunks[0] = reinterpret_cast<uint32_t*>(runtime_data_buffer);
-		runtime_data_buffer += medium_bitset_size;
-
-		m_context.streaming_chunks[0] = reinterpret_cast<uint32_t*>(runtime_data_buffer);
-		runtime_data_buffer += medium_bitset_size;
-
-		m_context.loaded_chunks[1] = reinterpret_cast<uint32_t*>(runtime_data_buffer);
-		runtime_data_buffer += low_bitset_size;
-
-		m_context.streaming_chunks[1] = reinterpret_cast<uint32_t*>(runtime_data_buffer);
-		runtime_data_buffer += low_bitset_size;
-
-		m_context.clip_segment_headers = align_to(runtime_data_buffer, 8);	// Align runtime headers
-
-		// Copy our clip hashes to setup our headers
-		const uint32_t num_clips = header.num_clips;
-		const acl_impl::database_clip_metadata* clip_metadatas = header.get_clip_metadatas();
-		for (uint32_t clip_index = 0; clip_index < num_clips; ++clip_index)
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
 		{
-			const acl_impl::database_clip_metadata& clip_metadata = clip_metadatas[clip_index];
-			acl_impl::database_runtime_clip_header* clip_header = clip_metadata.get_clip_header(m_context.clip_segment_headers);
-			clip_header->clip_hash = clip_metadata.clip_hash;
+			m_context.bulk_data[tier_index].store(database.get_bulk_data(get_database_quality_tier(tier_index)), std::memory_order::memory_order_relaxed);
+			m_context.streamers[tier_index] = nullptr;
+			m_context.streaming_request_indices[tier_index] = acl_impl::k_invalid_streaming_request_index;
 		}
+		m_context.streaming_state.store(0, std::memory_order::memory_order_relaxed);
+		m_context.chunk_usage = nullptr;
+		m_context.telemetry = settings_type::is_telemetry_supported() ? allocate_type<acl_impl::database_telemetry_v0>(allocator) : nullptr;
+		m_context.streaming_listener = nullptr;
+		m_context.validate_chunks = settings_type::is_chunk_validation_enabled();
 
-		// Bulk data is inline so stream everything in right away
-		const acl_impl::database_chunk_description* chunk_descriptions = header.get_chunk_descriptions_medium();
-		for (uint32_t chunk_index = 0; chunk_index < num_medium_chunks; ++chunk_index)
-		{
-			const acl_impl::database_chunk_description& chunk_description = chunk_descriptions[chunk_index];
-			const acl_impl::database_chunk_header* chunk_header = chunk_description.get_chunk_header(m_context.bulk_data[0]);
-			ACL_ASSERT(chunk_header->index == chunk_index, "Unexpected chunk index");
-
-			const acl_impl::database_chunk_segment_header* chunk_segment_headers = chunk_header->get_segment_headers();
-			const uint32_t num_segments = chunk_header->num_segments;
-			for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
-			{
-				const acl_impl::database_chunk_segment_header& chunk_segment_header = chunk_segment_headers[segment_index];
-
-#if defined(ACL_HAS_ASSERT_CHECKS)
-				const acl_impl::database_runtime_clip_header* clip_header = chunk_segment_header.get_clip_header(m_context.clip_segment_headers);
-				ACL_ASSERT(clip_header->clip_hash == chunk_segment_header.clip_hash, "Unexpected clip hash");
-#endif
-
-				acl_impl::database_runtime_segment_header* segment_header = chunk_segment_header.get_segment_header(m_context.clip_segment_headers);
-				ACL_ASSERT(segment_header->tier_metadata[0].load(std::memory_order::memory_order_relaxed) == 0, "Tier metadata should not be initialized");
-				segment_header->tier_metadata[0].store((uint64_t(chunk_segment_header.samples_offset) << 32) | chunk_segment_header.sample_indices, std::memory_order::memory_order_relaxed);
-			}
+		acl_impl::initialize_runtime_data(m_context, allocator, database);
+		clear_telemetry();
 
-			bitset_set(m_context.loaded_chunks[0], medium_desc, chunk_index, true);
-		}
+		const acl_impl::database_header& header = acl_impl::get_database_header(database);
 
-		chunk_descriptions = header.get_chunk_descriptions_low();
-		for (uint32_t chunk_index = 0; chunk_index < num_low_chunks; ++chunk_index)
+		// Bulk data is inline so stream everything in right away
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
 		{
-			const acl_impl::database_chunk_description& chunk_description = chunk_descriptions[chunk_index];
-			const acl_impl::database_chunk_header* chunk_header = chunk_description.get_chunk_header(m_context.bulk_data[1]);
-			ACL_ASSERT(chunk_header->index == chunk_index, "Unexpected chunk index");
+			const uint32_t num_chunks = header.num_chunks[tier_index];
+			const bitset_description desc = bitset_description::make_from_num_bits(num_chunks);
+			const uint8_t* bulk_data = m_context.bulk_data[tier_index].load(std::memory_order::memory_order_relaxed);
 
-			const acl_impl::database_chunk_segment_header* chunk_segment_headers = chunk_header->get_segment_headers();
-			const uint32_t num_segments = chunk_header->num_segments;
-			for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+			const acl_impl::database_chunk_description* chunk_descriptions = header.get_chunk_descriptions(tier_index);
+			for (uint32_t chunk_index = 0; chunk_index < num_chunks; ++chunk_index)
 			{
-				const acl_impl::database_chunk_segment_header& chunk_segment_header = chunk_segment_headers[segment_index];
-
-#if defined(ACL_HAS_ASSERT_CHECKS)
-				const acl_impl::database_runtime_clip_header* clip_header = chunk_segment_header.get_clip_header(m_context.clip_segment_headers);
-				ACL_ASSERT(clip_header->clip_hash == chunk_segment_header.clip_hash, "Unexpected clip hash");
-#endif
-
-				acl_impl::database_runtime_segment_header* segment_header = chunk_segment_header.get_segment_header(m_context.clip_segment_headers);
-				ACL_ASSERT(segment_header->tier_metadata[1].load(std::memory_order::memory_order_relaxed) == 0, "Tier metadata should not be initialized");
-				segment_header->tier_metadata[1].store((uint64_t(chunk_segment_header.samples_offset) << 32) | chunk_segment_header.sample_indices, std::memory_order::memory_order_relaxed);
+				const acl_impl::database_chunk_description& chunk_description = chunk_descriptions[chunk_index];
+				const acl_impl::database_chunk_header* chunk_header = chunk_description.get_chunk_header(bulk_data);
+				ACL_ASSERT(chunk_header->index == chunk_index, "Unexpected chunk index");
+
+				const acl_impl::database_chunk_segment_header* chunk_segment_headers = chunk_header->get_segment_headers();
+				const uint32_t num_segments = chunk_header->num_segments;
+				for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+				{
+					const acl_impl::database_chunk_segment_header& chunk_segment_header = chunk_segment_headers[segment_index];
+
+					acl_impl::database_runtime_clip_header* clip_header = chunk_segment_header.get_clip_header(m_context.clip_segment_headers);
+					ACL_ASSERT(clip_header->clip_hash == chunk_segment_header.clip_hash, "Unexpected clip hash");
+
+					acl_impl::database_runtime_segment_header* segment_header = chunk_segment_header.get_segment_header(m_context.clip_segment_headers);
+					ACL_ASSERT(segment_header->tier_metadata[tier_index].load(std::memory_order::memory_order_relaxed) == 0, "Tier metadata should not be initialized");
+					segment_header->tier_metadata[tier_index].store((uint64_t(chunk_segment_header.samples_offset) << 32) | chunk_segment_header.sample_indices, std::memory_order::memory_order_relaxed);
+					clip_header->num_resident_segment_tiers.fetch_add(1, std::memory_order::memory_order_relaxed);
+				}
+
+				bitset_set(m_context.loaded_chunks[tier_index], desc, chunk_index, true);
 			}
-
-			bitset_set(m_context.loaded_chunks[1], low_desc, chunk_index, true);
 		}
 
 		return true;
@@ -210,19 +278,29 @@ namespace acl
 
 	template<class database_settings_type>
 	inline bool database_context<database_settings_type>::initialize(iallocator& allocator, const compressed_database& database, database_streamer& medium_tier_streamer, database_streamer& low_tier_streamer)
+	{
+		// Intermediate tiers, if any, have no streamer and the array overload will fail
+		database_streamer* streamers[k_num_database_tiers] = {};
+		streamers[0] = &medium_tier_streamer;
+		streamers[k_num_database_tiers - 1] = &low_tier_streamer;
+		return initialize(allocator, database, streamers);
+	}
+
+	template<class database_settings_type>
+	inline bool database_context<database_settings_type>::initialize(iallocator& allocator, const compressed_database& database, database_streamer* const (&streamers)[k_num_database_tiers])
 	{
 		const bool is_valid = database.is_valid(false).empty();
 		ACL_ASSERT(is_valid, "Invalid compressed database instance");
 		if (!is_valid)
 			return false;
 
-		ACL_ASSERT(medium_tier_streamer.is_initialized(), "Medium importance tier streamer must be initialized");
-		if (!medium_tier_streamer.is_initialized())
-			return false;
-
-		ACL_ASSERT(low_tier_streamer.is_initialized(), "Low importance tier streamer must be initialized");
-		if (!low_tier_streamer.is_initialized())
-			return false;
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			const bool is_streamer_initialized = streamers[tier_index] != nullptr && streamers[tier_index]->is_initialized();
+			ACL_ASSERT(is_streamer_initialized, "Every database tier streamer must be initialized");
+			if (!is_streamer_initialized)
+				return false;
+		}
 
 		ACL_ASSERT(!is_initialized(), "Cannot initialize database twice");
 		if (is_initialized())
@@ -231,55 +309,23 @@ namespace acl
 		m_context.db = &database;
 		m_context.db_hash = database.get_hash();
 		m_context.allocator = &allocator;
-		m_context.bulk_data[0] = m_context.bulk_data[1] = nullptr;	// Will be set during the first stream in request
-		m_context.streamers[0] = &medium_tier_streamer;
-		m_context.streamers[1] = &low_tier_streamer;
-
-		medium_tier_streamer.bind(m_context);
-		low_tier_streamer.bind(m_context);
-
-		const acl_impl::database_header& header = acl_impl::get_database_header(database);
-
-		const uint32_t num_medium_chunks = header.num_chunks[0];
-		const uint32_t num_low_chunks = header.num_chunks[1];
-
-		const bitset_description medium_desc = bitset_description::make_from_num_bits(num_medium_chunks);
-		const bitset_description low_desc = bitset_description::make_from_num_bits(num_low_chunks);
-
-		const uint32_t medium_bitset_size = medium_desc.get_num_bytes();
-		const uint32_t low_bitset_size = low_desc.get_num_bytes();
-
-		// Allocate a single buffer for everything we need. This is faster to allocate and it ensures better virtual
-		// memory locality which should help reduce the cost of TLB misses.
-		const uint32_t runtime_data_size = acl_impl::calculate_runtime_data_size(database);
-		uint8_t* runtime_data_buffer = allocate_type_array_aligned<uint8_t>(allocator, runtime_data_size, 16);
-
-		// Initialize everything to 0
-		std::memset(runtime_data_buffer, 0, runtime_data_size);
-
-		m_context.loaded_chunks[0] = reinterpret_cast<uint32_t*>(runtime_data_buffer);
-		runtime_data_buffer += medium_bitset_size;
-
-		m_context.streaming_chunks[0] = reinterpret_cast<uint32_t*>(runtime_data_buffer);
-		runtime_data_buffer += medium_bitset_size;
-
-		m_context.loaded_chunks[1] = reinterpret_cast<uint32_t*>(runtime_data_buffer);
-		runtime_data_buffer += low_bitset_size;
-
-		m_context.streaming_chunks[1] = reinterpret_cast<uint32_t*>(runtime_data_buffer);
-		runtime_data_buffer += low_bitset_size;
-
-		m_context.clip_segment_headers = align_to(runtime_data_buffer, 8);	// Align runtime headers
-
-		// Copy our clip hashes to setup our headers
-		const uint32_t num_clips = header.num_clips;
-		const acl_impl::database_clip_metadata* clip_metadatas = header.get_clip_metadatas();
-		for (uint32_t clip_index = 0; clip_index < num_clips; ++clip_index)
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
 		{
-			const acl_impl::database_clip_metadata& clip_metadata = clip_metadatas[clip_index];
-			acl_impl::database_runtime_clip_header* clip_header = clip_metadata.get_clip_header(m_context.clip_segment_headers);
-			clip_header->clip_hash = clip_metadata.clip_hash;
+			m_context.bulk_data[tier_index].store(nullptr, std::memory_order::memory_order_relaxed);	// Will be set during the first stream in request
+			m_context.streamers[tier_index] = streamers[tier_index];
+			m_context.streaming_request_indices[tier_index] = acl_impl::k_invalid_streaming_request_index;
 		}
+		m_context.streaming_state.store(0, std::memory_order::memory_order_relaxed);
+		m_context.chunk_usage = nullptr;
+		m_context.telemetry = settings_type::is_telemetry_supported() ? allocate_type<acl_impl::database_telemetry_v0>(allocator) : nullptr;
+		m_context.streaming_listener = nullptr;
+		m_context.validate_chunks = settings_type::is_chunk_validation_enabled();
+
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			streamers[tier_index]->bind(m_context);
+
+		acl_impl::initialize_runtime_data(m_context, allocator, database);
+		clear_telemetry();
 
 		return true;
 	}
@@ -293,12 +339,17 @@ namespace acl
 		if (!is_initialized())
 			return;	// Nothing to do
 
-		ACL_ASSERT(!is_streaming(quality_tier::medium_importance), "Behavior is undefined if context is reset while streaming is in progress");
-		ACL_ASSERT(!is_streaming(quality_tier::lowest_importance), "Behavior is undefined if context is reset while streaming is in progress");
+#if defined(ACL_HAS_ASSERT_CHECKS)
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			ACL_ASSERT(!is_streaming(get_database_quality_tier(tier_index)), "Behavior is undefined if context is reset while streaming is in progress");
+#endif
 
 		const uint32_t runtime_data_size = acl_impl::calculate_runtime_data_size(*m_context.db);
 		deallocate_type_array(*m_context.allocator, reinterpret_cast<uint8_t*>(m_context.loaded_chunks[0]), runtime_data_size);
 
+		if (m_context.telemetry != nullptr)
+			deallocate_type(*m_context.allocator, m_context.telemetry);
+
 		// Just reset the DB pointer, this will mark us as no longer initialized indicating everything is stale
 		m_context.db = nullptr;
 	}
@@ -319,14 +370,24 @@ namespace acl
 
 		// The instances are identical and might have relocated, update our metadata
 		m_context.db = &database;
-		m_context.bulk_data[0] = database.get_bulk_data(quality_tier::medium_importance);
-		m_context.bulk_data[1] = database.get_bulk_data(quality_tier::lowest_importance);
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			m_context.bulk_data[tier_index].store(database.get_bulk_data(get_database_quality_tier(tier_index)), std::memory_order::memory_order_relaxed);
 
 		return true;
 	}
 
 	template<class database_settings_type>
 	inline bool database_context<database_settings_type>::relocated(const compressed_database& database, database_streamer& medium_tier_streamer, database_streamer& low_tier_streamer)
+	{
+		// Intermediate tiers, if any, have no streamer and the array overload will fail
+		database_streamer* streamers[k_num_database_tiers] = {};
+		streamers[0] = &medium_tier_streamer;
+		streamers[k_num_database_tiers - 1] = &low_tier_streamer;
+		return relocated(database, streamers);
+	}
+
+	template<class database_settings_type>
+	inline bool database_context<database_settings_type>::relocated(const compressed_database& database, database_streamer* const (&streamers)[k_num_database_tiers])
 	{
 		if (!m_context.is_initialized())
 			return false;	// Not initialized, cannot be relocated
@@ -339,13 +400,20 @@ namespace acl
 		if (m_context.db_hash != database.get_hash())
 			return false;	// Hash is different, this instance did not relocate, it is different
 
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			ACL_ASSERT(streamers[tier_index] != nullptr, "Every database tier requires a streamer");
+			if (streamers[tier_index] == nullptr)
+				return false;
+		}
+
 		// The instances are identical and might have relocated, update our metadata
 		m_context.db = &database;
-		m_context.streamers[0] = &medium_tier_streamer;
-		m_context.streamers[1] = &low_tier_streamer;
-
-		medium_tier_streamer.bind(m_context);
-		low_tier_streamer.bind(m_context);
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			m_context.streamers[tier_index] = streamers[tier_index];
+			streamers[tier_index]->bind(m_context);
+		}
 
 		return true;
 	}
@@ -373,8 +441,7 @@ namespace acl
 		if (!tracks.has_database())
 			return false;	// Clip not bound to anything
 
-		const acl_impl::transform_tracks_header& transform_header = acl_impl::get_transform_tracks_header(tracks);
-		const acl_impl::tracks_database_header* tracks_db_header = transform_header.get_database_header();
+		const acl_impl::tracks_database_header* tracks_db_header = acl_impl::get_tracks_database_header(tracks);
 		ACL_ASSERT(tracks_db_header != nullptr, "Expected a 'tracks_database_header'");
 
 		if (!tracks_db_header->clip_header_offset.is_valid())
@@ -409,9 +476,12 @@ namespace acl
 		if (!is_initialized() || tier == quality_tier::highest_importance)
 			return false;
 
+		const uint32_t tier_index = uint32_t(tier) - 1;
+		if (retire_streaming_request(tier_index))
+			return false;	// Our tier is streaming in or out, some chunks aren't loaded
+
 		const uint32_t num_chunks = m_context.db->get_num_chunks(tier);
 		const bitset_description desc = bitset_description::make_from_num_bits(num_chunks);
-		const uint32_t tier_index = uint32_t(tier) - 1;
 
 		const uint32_t* loaded_chunks = m_context.loaded_chunks[tier_index];
 		const uint32_t num_loaded_chunks = bitset_count_set_bits(loaded_chunks, desc);
@@ -427,18 +497,83 @@ namespace acl
 		if (!is_initialized() || tier == quality_tier::highest_importance)
 			return false;
 
+		const uint32_t tier_index = uint32_t(tier) - 1;
+		return retire_streaming_request(tier_index);
+	}
+
+	template<class database_settings_type>
+	inline database_stream_request_result database_context<database_settings_type>::stream_in(quality_tier tier, uint32_t num_chunks_to_stream, streaming_priority priority)
+	{
+		ACL_ASSERT(is_initialized(), "Database isn't initialized");
+		if (!is_initialized())
+			return database_stream_request_result::context_not_initialized;
+
+		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
+		if (tier == quality_tier::highest_importance)
+			return database_stream_request_result::invalid_database_tier;
+
 		const uint32_t num_chunks = m_context.db->get_num_chunks(tier);
-		const bitset_description desc = bitset_description::make_from_num_bits(num_chunks);
+		return stream_in_range(tier, 0, num_chunks, num_chunks_to_stream, priority);
+	}
+
+	template<class database_settings_type>
+	inline database_stream_request_result database_context<database_settings_type>::stream_in(const compressed_tracks& tracks, quality_tier tier, streaming_priority priority)
+	{
+		ACL_ASSERT(is_initialized(), "Database isn't initialized");
+		if (!is_initialized())
+			return database_stream_request_result::context_not_initialized;
+
+		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
+		if (tier == quality_tier::highest_importance)
+			return database_stream_request_result::invalid_database_tier;
+
+		const acl_impl::database_clip_chunk_range* clip_chunk_range = find_clip_chunk_range(tracks);
+		if (clip_chunk_range == nullptr)
+			return database_stream_request_result::clip_chunk_ranges_unavailable;
+
+		const uint32_t tier_index = uint32_t(tier) - 1;
+		const uint32_t begin_chunk_index = clip_chunk_range->first_chunk_index[tier_index];
+		const uint32_t end_chunk_index = begin_chunk_index + clip_chunk_range->num_chunks[tier_index];
+		return stream_in_range(tier, begin_chunk_index, end_chunk_index, ~0U, priority);
+	}
+
+	template<class database_settings_type>
+	inline database_stream_request_result database_context<database_settings_type>::queue_stream_in(const compressed_tracks& tracks, quality_tier tier, streaming_priority priority)
+	{
+		ACL_ASSERT(is_initialized(), "Database isn't initialized");
+		if (!is_initialized())
+			return database_stream_request_result::context_not_initialized;
+
+		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
+		if (tier == quality_tier::highest_importance)
+			return database_stream_request_result::invalid_database_tier;
+
+		const acl_impl::database_clip_chunk_range* clip_chunk_range = find_clip_chunk_range(tracks);
+		if (clip_chunk_range == nullptr)
+			return database_stream_request_result::clip_chunk_ranges_unavailable;
+
 		const uint32_t tier_index = uint32_t(tier) - 1;
+		const uint32_t begin_chunk_index = clip_chunk_range->first_chunk_index[tier_index];
+		const uint32_t end_chunk_index = begin_chunk_index + clip_chunk_range->num_chunks[tier_index];
 
-		const uint32_t* streaming_chunks = m_context.streaming_chunks[tier_index];
-		const uint32_t num_streaming_chunks = bitset_count_set_bits(streaming_chunks, desc);
+		const uint32_t num_chunks = m_context.db->get_num_chunks(tier);
+		const bitset_description desc = bitset_description::make_from_num_bits(num_chunks);
+		const uint32_t* loaded_chunks = m_context.loaded_chunks[tier_index];
+		uint8_t* queued_chunk_priorities = acl_impl::get_queued_chunk_priorities(m_context, tier_index);
+
+		// Chunks queued more than once retain their highest priority
+		const uint8_t queued_priority = uint8_t(uint32_t(priority) + 1);
+		for (uint32_t chunk_index = begin_chunk_index; chunk_index < end_chunk_index; ++chunk_index)
+		{
+			if (!bitset_test(loaded_chunks, desc, chunk_index))
+				queued_chunk_priorities[chunk_index] = std::max<uint8_t>(queued_chunk_priorities[chunk_index], queued_priority);
+		}
 
-		return num_streaming_chunks != 0;
+		return database_stream_request_result::queued;
 	}
 
 	template<class database_settings_type>
-	inline database_stream_request_result database_context<database_settings_type>::stream_in(quality_tier tier, uint32_t num_chunks_to_stream)
+	inline database_stream_request_result database_context<database_settings_type>::dispatch_queued_stream_in(quality_tier tier, uint32_t num_chunks_to_stream)
 	{
 		ACL_ASSERT(is_initialized(), "Database isn't initialized");
 		if (!is_initialized())
@@ -451,159 +586,482 @@ namespace acl
 		if (is_streaming(tier))
 			return database_stream_request_result::streaming_in_progress;	// Can't stream while we are streaming
 
-		const acl_impl::database_header& header = acl_impl::get_database_header(*m_context.db);
-		const acl_impl::database_chunk_description* chunk_descriptions = tier == quality_tier::medium_importance ? header.get_chunk_descriptions_medium() : header.get_chunk_descriptions_low();
+		const uint32_t tier_index = uint32_t(tier) - 1;
+		const uint32_t num_chunks = m_context.db->get_num_chunks(tier);
+		const bitset_description desc = bitset_description::make_from_num_bits(num_chunks);
+		const uint32_t* loaded_chunks = m_context.loaded_chunks[tier_index];
+		uint8_t* queued_chunk_priorities = acl_impl::get_queued_chunk_priorities(m_context, tier_index);
+
+		// Find the first queued chunk with the highest priority, chunks that streamed in some other way are no longer queued
+		uint32_t seed_chunk_index = num_chunks;
+		uint8_t seed_priority = 0;
+		for (uint32_t chunk_index = 0; chunk_index < num_chunks; ++chunk_index)
+		{
+			if (queued_chunk_priorities[chunk_index] == 0)
+				continue;
+
+			if (bitset_test(loaded_chunks, desc, chunk_index))
+				queued_chunk_priorities[chunk_index] = 0;
+			else if (queued_chunk_priorities[chunk_index] > seed_priority)
+			{
+				seed_chunk_index = chunk_index;
+				seed_priority = queued_chunk_priorities[chunk_index];
+			}
+		}
+
+		if (seed_chunk_index == num_chunks)
+			return database_stream_request_result::done;	// Nothing queued
+
+		// Coalesce the adjacent queued chunks regardless of their priority into a single larger request
+		// Every queued chunk isn't loaded, see above
+		num_chunks_to_stream = std::max<uint32_t>(num_chunks_to_stream, 1);
+
+		uint32_t first_chunk_index = seed_chunk_index;
+		uint32_t end_chunk_index = seed_chunk_index + 1;
+		uint8_t request_priority = seed_priority;
+
+		while (end_chunk_index < num_chunks && (end_chunk_index - first_chunk_index) < num_chunks_to_stream && queued_chunk_priorities[end_chunk_index] != 0)
+			end_chunk_index++;
+
+		while (first_chunk_index > 0 && (end_chunk_index - first_chunk_index) < num_chunks_to_stream && queued_chunk_priorities[first_chunk_index - 1] != 0)
+			first_chunk_index--;
+
+		for (uint32_t chunk_index = first_chunk_index; chunk_index < end_chunk_index; ++chunk_index)
+			request_priority = std::max<uint8_t>(request_priority, queued_chunk_priorities[chunk_index]);
+
+		return stream_in_range(tier, first_chunk_index, end_chunk_index, ~0U, streaming_priority(request_priority - 1));
+	}
+
+	template<class database_settings_type>
+	inline database_stream_request_result database_context<database_settings_type>::stream_out(quality_tier tier, uint32_t num_chunks_to_stream)
+	{
+		ACL_ASSERT(is_initialized(), "Database isn't initialized");
+		if (!is_initialized())
+			return database_stream_request_result::context_not_initialized;
+
+		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
+		if (tier == quality_tier::highest_importance)
+			return database_stream_request_result::invalid_database_tier;
+
+		const uint32_t num_chunks = m_context.db->get_num_chunks(tier);
+		return stream_out_range(tier, 0, num_chunks, num_chunks_to_stream);
+	}
+
+	template<class database_settings_type>
+	inline database_stream_request_result database_context<database_settings_type>::stream_out(const compressed_tracks& tracks, quality_tier tier)
+	{
+		ACL_ASSERT(is_initialized(), "Database isn't initialized");
+		if (!is_initialized())
+			return database_stream_request_result::context_not_initialized;
+
+		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
+		if (tier == quality_tier::highest_importance)
+			return database_stream_request_result::invalid_database_tier;
+
+		const acl_impl::database_clip_chunk_range* clip_chunk_range = find_clip_chunk_range(tracks);
+		if (clip_chunk_range == nullptr)
+			return database_stream_request_result::clip_chunk_ranges_unavailable;
+
+		const uint32_t tier_index = uint32_t(tier) - 1;
+		const uint32_t begin_chunk_index = clip_chunk_range->first_chunk_index[tier_index];
+		const uint32_t end_chunk_index = begin_chunk_index + clip_chunk_range->num_chunks[tier_index];
+		return stream_out_range(tier, begin_chunk_index, end_chunk_index, ~0U);
+	}
+
+	template<class database_settings_type>
+	inline database_stream_request_result database_context<database_settings_type>::prefetch(const compressed_tracks& tracks, quality_tier tier, float sample_time, float playback_rate, float lookahead_time)
+	{
+		ACL_ASSERT(is_initialized(), "Database isn't initialized");
+		if (!is_initialized())
+			return database_stream_request_result::context_not_initialized;
+
+		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
+		if (tier == quality_tier::highest_importance)
+			return database_stream_request_result::invalid_database_tier;
+
+		const acl_impl::database_clip_chunk_range* clip_chunk_range = find_clip_chunk_range(tracks);
+		if (clip_chunk_range == nullptr)
+			return database_stream_request_result::clip_chunk_ranges_unavailable;
+
+		const uint32_t tier_index = uint32_t(tier) - 1;
+		const uint32_t clip_first_chunk_index = clip_chunk_range->first_chunk_index[tier_index];
+		const uint32_t clip_num_chunks = clip_chunk_range->num_chunks[tier_index];
+		if (clip_num_chunks == 0)
+			return database_stream_request_result::done;	// Clip has no data in this tier
+
+		// Find the sample range we'll play through, we clamp instead of wrapping, the start of a looping
+		// clip will be predicted once playback wraps around
+		const float duration = tracks.get_finite_duration();
+		const float sample_time0 = rtm::scalar_clamp(sample_time, 0.0F, duration);
+		const float sample_time1 = rtm::scalar_clamp(sample_time + (playback_rate * lookahead_time), 0.0F, duration);
+
+		const uint32_t num_samples = tracks.get_num_samples_per_track();
+		const float sample_rate = tracks.get_sample_rate();
+		const uint32_t last_sample_index = num_samples != 0 ? (num_samples - 1) : 0;
+		const uint32_t first_sample_index = std::min<uint32_t>(uint32_t(rtm::scalar_min(sample_time0, sample_time1) * sample_rate), last_sample_index);
+		const uint32_t end_sample_index = std::min<uint32_t>(uint32_t(rtm::scalar_max(sample_time0, sample_time1) * sample_rate) + 1, last_sample_index);
+
+		// Find the segments that contain our samples
+		const uint32_t num_segments = acl_impl::get_num_database_segments(tracks);
+
+		uint32_t first_segment_index = 0;
+		uint32_t last_segment_index = 0;
+		for (uint32_t segment_index = 1; segment_index < num_segments; ++segment_index)
+		{
+			const uint32_t segment_start_index = acl_impl::get_database_segment_start_index(tracks, segment_index);
+
+			if (segment_start_index <= first_sample_index)
+				first_segment_index = segment_index;
+
+			if (segment_start_index <= end_sample_index)
+				last_segment_index = segment_index;
+		}
+
+		// Map our segments to chunks, once a segment is streamed in we know exactly where it lives,
+		// otherwise we estimate from its position within the clip since segments are laid out in order
+		// and we widen our range by one chunk to account for the error
+		const acl_impl::tracks_database_header* tracks_db_header = acl_impl::get_tracks_database_header(tracks);
+		const acl_impl::database_runtime_clip_header* db_clip_header = tracks_db_header->get_clip_header(m_context.clip_segment_headers);
+		const acl_impl::database_runtime_segment_header* db_segment_headers = db_clip_header->get_segment_headers();
+		const uint32_t max_chunk_size = m_context.db->get_max_chunk_size();
+		const uint32_t clip_last_chunk_index = clip_first_chunk_index + clip_num_chunks - 1;
+
+		const auto find_segment_chunk_index = [&](uint32_t segment_index, bool round_up) -> uint32_t
+		{
+			const uint64_t tier_metadata = db_segment_headers[segment_index].tier_metadata[tier_index].load(std::memory_order::memory_order_relaxed);
+			if (tier_metadata != 0)
+				return std::min<uint32_t>(uint32_t(tier_metadata >> 32) / max_chunk_size, clip_last_chunk_index);
+
+			const uint32_t estimated_chunk_offset = uint32_t((uint64_t(segment_index) * clip_num_chunks) / num_segments);
+			const uint32_t estimated_chunk_index = clip_first_chunk_index + estimated_chunk_offset;
+			if (round_up)
+				return std::min<uint32_t>(estimated_chunk_index + 1, clip_last_chunk_index);
+			else
+				return estimated_chunk_index > clip_first_chunk_index ? (estimated_chunk_index - 1) : clip_first_chunk_index;
+		};
+
+		const uint32_t first_chunk_index = find_segment_chunk_index(first_segment_index, false);
+		const uint32_t last_chunk_index = std::max<uint32_t>(find_segment_chunk_index(last_segment_index, true), first_chunk_index);
+
+		// Prefetching is speculative, data that is needed right away goes ahead of it
+		return stream_in_range(tier, first_chunk_index, last_chunk_index + 1, ~0U, streaming_priority::low);
+	}
+
+	template<class database_settings_type>
+	inline database_stream_request_result database_context<database_settings_type>::compact(quality_tier tier)
+	{
+		ACL_ASSERT(is_initialized(), "Database isn't initialized");
+		if (!is_initialized())
+			return database_stream_request_result::context_not_initialized;
+
+		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
+		if (tier == quality_tier::highest_importance)
+			return database_stream_request_result::invalid_database_tier;
+
+		if (is_streaming(tier))
+			return database_stream_request_result::streaming_in_progress;	// The streamer could be writing into the chunks we would release
 
 		const uint32_t tier_index = uint32_t(tier) - 1;
+		if (m_context.bulk_data[tier_index].load(std::memory_order::memory_order_relaxed) == nullptr)
+			return database_stream_request_result::done;	// Nothing is allocated, nothing to release
+
+		const acl_impl::database_header& header = acl_impl::get_database_header(*m_context.db);
+		const acl_impl::database_chunk_description* chunk_descriptions = header.get_chunk_descriptions(tier_index);
 
 		const uint32_t num_chunks = header.num_chunks[tier_index];
 		const bitset_description desc = bitset_description::make_from_num_bits(num_chunks);
-		const uint32_t max_chunk_size = header.max_chunk_size;
+		const uint32_t* loaded_chunks = m_context.loaded_chunks[tier_index];
+
+		database_streamer* streamer = m_context.streamers[tier_index];
 
-		uint32_t first_chunk_index = ~0U;
+		// Decompression never reads chunks that aren't loaded, their segments have no tier metadata
+		// Release every run of them, the range spans the decoded bulk data up to the next loaded chunk
+		uint32_t chunk_index = 0;
+		while (chunk_index < num_chunks)
+		{
+			uint32_t first_chunk_index;
+			const uint32_t num_unloaded_chunks = acl_impl::find_chunk_run(loaded_chunks, desc, chunk_index, num_chunks, false, ~0U, first_chunk_index);
+			if (num_unloaded_chunks == 0)
+				break;
 
-		// Clamp the total number of chunks we can stream
-		num_chunks_to_stream = std::min<uint32_t>(num_chunks_to_stream, num_chunks);
+			const uint32_t end_chunk_index = first_chunk_index + num_unloaded_chunks;
+			const acl_impl::database_chunk_description& last_chunk_description = chunk_descriptions[end_chunk_index - 1];
 
-		// Look for chunks that aren't loaded yet and aren't streaming yet
-		const uint32_t num_entries = desc.get_size();
-		const uint32_t* loaded_chunks = m_context.loaded_chunks[tier_index];
-		for (uint32_t entry_index = 0; entry_index < num_entries; ++entry_index)
+			const uint32_t release_offset = chunk_descriptions[first_chunk_index].offset;
+			const uint32_t release_end_offset = end_chunk_index < num_chunks ? uint32_t(chunk_descriptions[end_chunk_index].offset) : (uint32_t(last_chunk_description.offset) + last_chunk_description.size);
+			streamer->release_unused_bulk_data(release_offset, release_end_offset - release_offset, tier);
+
+			chunk_index = end_chunk_index;
+		}
+
+		return database_stream_request_result::done;
+	}
+
+	template<class database_settings_type>
+	inline bool database_context<database_settings_type>::get_telemetry(database_telemetry& out_telemetry) const
+	{
+		ACL_ASSERT(is_initialized(), "Database isn't initialized");
+		const acl_impl::database_telemetry_v0* telemetry = is_initialized() ? m_context.telemetry : nullptr;
+		if (telemetry == nullptr)
+			return false;
+
+		out_telemetry.num_frames_requested = telemetry->num_frames_requested.load(std::memory_order::memory_order_relaxed);
+		for (uint32_t tier_index = 0; tier_index < k_num_quality_tiers; ++tier_index)
+			out_telemetry.num_frames_served[tier_index] = telemetry->num_frames_served[tier_index].load(std::memory_order::memory_order_relaxed);
+		out_telemetry.num_frames_reconstructed = telemetry->num_frames_reconstructed.load(std::memory_order::memory_order_relaxed);
+
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
 		{
-			const uint32_t maybe_loaded = loaded_chunks[entry_index];
-			const uint32_t num_pending_chunks = count_trailing_zeros(maybe_loaded);
-			if (num_pending_chunks != 0)
+			out_telemetry.num_bytes_streamed_in[tier_index] = telemetry->num_bytes_streamed_in[tier_index].load(std::memory_order::memory_order_relaxed);
+			out_telemetry.num_bytes_streamed_out[tier_index] = telemetry->num_bytes_streamed_out[tier_index].load(std::memory_order::memory_order_relaxed);
+		}
+
+		return true;
+	}
+
+	template<class database_settings_type>
+	inline void database_context<database_settings_type>::clear_telemetry()
+	{
+		acl_impl::database_telemetry_v0* telemetry = is_initialized() ? m_context.telemetry : nullptr;
+		if (telemetry == nullptr)
+			return;
+
+		telemetry->num_frames_requested.store(0, std::memory_order::memory_order_relaxed);
+		for (uint32_t tier_index = 0; tier_index < k_num_quality_tiers; ++tier_index)
+			telemetry->num_frames_served[tier_index].store(0, std::memory_order::memory_order_relaxed);
+		telemetry->num_frames_reconstructed.store(0, std::memory_order::memory_order_relaxed);
+
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+		{
+			telemetry->num_bytes_streamed_in[tier_index].store(0, std::memory_order::memory_order_relaxed);
+			telemetry->num_bytes_streamed_out[tier_index].store(0, std::memory_order::memory_order_relaxed);
+		}
+	}
+
+	template<class database_settings_type>
+	inline void database_context<database_settings_type>::set_streaming_listener(database_streaming_listener* listener)
+	{
+		ACL_ASSERT(is_initialized(), "Database context isn't initialized");
+		if (!is_initialized())
+			return;
+
+#if defined(ACL_HAS_ASSERT_CHECKS)
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			ACL_ASSERT(!is_streaming(get_database_quality_tier(tier_index)), "Cannot change the streaming listener while streaming is in progress");
+#endif
+
+		m_context.streaming_listener = listener;
+	}
+
+	template<class database_settings_type>
+	inline void database_context<database_settings_type>::dispatch_streaming_request(uint32_t tier_index, streaming_request_id request_id)
+	{
+		ACL_ASSERT(m_context.streaming_request_indices[tier_index] == acl_impl::k_invalid_streaming_request_index, "A request is already in flight");
+
+		// Only the thread that completes our request reads the request past this point, until we retire it
+		m_context.streaming_request_indices[tier_index] = uint16_t(acl_impl::get_request_index(request_id));
+		m_context.streaming_state.fetch_or(acl_impl::k_streaming_state_in_flight << (tier_index * acl_impl::k_num_streaming_state_bits), std::memory_order::memory_order_relaxed);
+	}
+
+	template<class database_settings_type>
+	inline bool database_context<database_settings_type>::retire_streaming_request(uint32_t tier_index) const
+	{
+		const uint32_t request_index = m_context.streaming_request_indices[tier_index];
+		if (request_index == acl_impl::k_invalid_streaming_request_index)
+			return false;	// Nothing in flight
+
+		// Acquire semantics pair with the thread that completed our request, we observe everything it did
+		const uint32_t state_shift = tier_index * acl_impl::k_num_streaming_state_bits;
+		const uint32_t state = m_context.streaming_state.load(std::memory_order::memory_order_acquire) >> state_shift;
+		if ((state & acl_impl::k_streaming_state_in_flight) != 0)
+			return true;	// Still in flight
+
+		// Our request completed, we own our chunk bitsets and the request again
+		const uint32_t num_chunks = m_context.db->get_num_chunks(quality_tier(tier_index + 1));
+		const bitset_description desc = bitset_description::make_from_num_bits(num_chunks);
+		uint32_t* loaded_chunks = m_context.loaded_chunks[tier_index];
+		uint32_t* streaming_chunks = m_context.streaming_chunks[tier_index];
+
+		if ((state & acl_impl::k_streaming_state_succeeded) != 0)
+		{
+			// Chunks that streamed in are now loaded and those that streamed out no longer are
+			const uint32_t bitset_size = desc.get_size();
+			for (uint32_t offset = 0; offset < bitset_size; ++offset)
+				loaded_chunks[offset] ^= streaming_chunks[offset];
+
+			const streaming_request& request = m_context.streamers[tier_index]->m_requests[request_index];
+
+			if (m_context.telemetry != nullptr)
 			{
-				first_chunk_index = (entry_index * 32) + (32 - num_pending_chunks);
-				break;
+				uint32_t stream_offset;
+				uint32_t stream_size;
+				acl_impl::calculate_chunk_run_stream_range(acl_impl::get_database_header(*m_context.db), request.tier, request.first_chunk_index, request.num_streaming_chunks, stream_offset, stream_size);
+
+				std::atomic<uint64_t>& num_bytes_streamed = request.action == streaming_action::stream_in ? m_context.telemetry->num_bytes_streamed_in[tier_index] : m_context.telemetry->num_bytes_streamed_out[tier_index];
+				num_bytes_streamed.fetch_add(stream_size, std::memory_order::memory_order_relaxed);
 			}
+
+			// Chunks that streamed in are no longer queued, those of a canceled request remain queued
+			if (request.action == streaming_action::stream_in)
+			{
+				uint8_t* queued_chunk_priorities = acl_impl::get_queued_chunk_priorities(m_context, tier_index);
+				std::memset(queued_chunk_priorities + request.first_chunk_index, 0, request.num_streaming_chunks);
+			}
+
+			m_context.streaming_state.fetch_and(~(acl_impl::k_streaming_state_succeeded << state_shift), std::memory_order::memory_order_relaxed);
 		}
 
-		if (first_chunk_index == ~0U)
-			return database_stream_request_result::done;	// Everything is streamed in or streaming, nothing to do
+		// Mark chunks as no longer streaming
+		bitset_reset(streaming_chunks, desc, false);
+
+		m_context.streamers[tier_index]->m_requests[request_index].reset();
+		m_context.streaming_request_indices[tier_index] = acl_impl::k_invalid_streaming_request_index;
+
+		return false;
+	}
+
+	template<class database_settings_type>
+	inline const acl_impl::database_clip_chunk_range* database_context<database_settings_type>::find_clip_chunk_range(const compressed_tracks& tracks) const
+	{
+		const acl_impl::database_header& header = acl_impl::get_database_header(*m_context.db);
+		const acl_impl::database_clip_chunk_range* clip_chunk_ranges = header.get_clip_chunk_ranges();
+		if (clip_chunk_ranges == nullptr)
+			return nullptr;	// Older database, we don't know which chunks belong to which clip
 
-		// Calculate and clamp our last chunk index (and handle wrapping for safety)
-		const uint64_t last_chunk_index64 = uint64_t(first_chunk_index) + uint64_t(num_chunks_to_stream) - 1;
-		const uint32_t last_chunk_index = last_chunk_index64 >= uint64_t(num_chunks) ? (num_chunks - 1) : uint32_t(last_chunk_index64);
+		if (!contains(tracks))
+			return nullptr;	// Clip isn't part of our database
 
-		// Calculate our stream size and account for the fact that the last chunk doesn't have the same size
-		const uint32_t num_streaming_chunks = last_chunk_index - first_chunk_index + 1;
+		const uint32_t clip_header_offset = acl_impl::get_tracks_database_header(tracks)->clip_header_offset;
+
+		// Clip metadata is sorted by clip header offset, binary search for ours
+		const acl_impl::database_clip_metadata* clip_metadatas = header.get_clip_metadatas();
+		uint32_t first_clip_index = 0;
+		uint32_t last_clip_index = header.num_clips;
+		while (first_clip_index < last_clip_index)
+		{
+			const uint32_t clip_index = first_clip_index + ((last_clip_index - first_clip_index) / 2);
+			const uint32_t offset = clip_metadatas[clip_index].clip_header_offset;
+
+			if (offset == clip_header_offset)
+				return &clip_chunk_ranges[clip_index];
+			else if (offset < clip_header_offset)
+				first_clip_index = clip_index + 1;
+			else
+				last_clip_index = clip_index;
+		}
+
+		ACL_ASSERT(false, "Clip header offset not found");
+		return nullptr;
+	}
+
+	template<class database_settings_type>
+	inline database_stream_request_result database_context<database_settings_type>::stream_in_range(quality_tier tier, uint32_t begin_chunk_index, uint32_t end_chunk_index, uint32_t num_chunks_to_stream, streaming_priority priority)
+	{
+		if (is_streaming(tier))
+			return database_stream_request_result::streaming_in_progress;	// Can't stream while we are streaming
+
+		const acl_impl::database_header& header = acl_impl::get_database_header(*m_context.db);
+
+		const uint32_t tier_index = uint32_t(tier) - 1;
+
+		const uint32_t num_chunks = header.num_chunks[tier_index];
+		const bitset_description desc = bitset_description::make_from_num_bits(num_chunks);
+
+		ACL_ASSERT(begin_chunk_index <= end_chunk_index && end_chunk_index <= num_chunks, "Invalid chunk range");
+		end_chunk_index = std::min<uint32_t>(end_chunk_index, num_chunks);
+
+		// Look for the first run of chunks that aren't loaded yet, nothing is streaming at this point
+		const uint32_t* loaded_chunks = m_context.loaded_chunks[tier_index];
+		uint32_t first_chunk_index;
+		const uint32_t num_streaming_chunks = acl_impl::find_chunk_run(loaded_chunks, desc, begin_chunk_index, end_chunk_index, false, num_chunks_to_stream, first_chunk_index);
 
 		if (num_streaming_chunks == 0)
-			return database_stream_request_result::done;	// Nothing more to stream
+			return database_stream_request_result::done;	// Everything is streamed in, nothing to do
 
 		database_streamer* streamer = m_context.streamers[tier_index];
 
-		const streaming_request_id request_id = streamer->build_request(streaming_action::stream_in, tier, first_chunk_index, num_streaming_chunks);
+		const streaming_request_id request_id = streamer->build_request(streaming_action::stream_in, priority, tier, first_chunk_index, num_streaming_chunks);
 		if (!request_id.is_valid())
 			return database_stream_request_result::no_free_streaming_requests;
 
-		// Find the stream start offset from our first chunk's offset
-		const acl_impl::database_chunk_description& first_chunk_description = chunk_descriptions[first_chunk_index];
-		const uint32_t stream_start_offset = first_chunk_description.offset;
-
-		const acl_impl::database_chunk_description& last_chunk_description = chunk_descriptions[last_chunk_index];
-		const uint32_t stream_size = ((num_streaming_chunks - 1) * max_chunk_size) + last_chunk_description.size;
+		// Find the range of the bulk data that contains our chunks
+		uint32_t stream_start_offset;
+		uint32_t stream_size;
+		acl_impl::calculate_chunk_run_stream_range(header, tier, first_chunk_index, num_streaming_chunks, stream_start_offset, stream_size);
 
 		// We can allocate our bulk data if we haven't already
-		const uint8_t* bulk_data = m_context.bulk_data[tier_index];
+		// Nothing is in flight, only we write to it
+		const uint8_t* bulk_data = m_context.bulk_data[tier_index].load(std::memory_order::memory_order_relaxed);
 		const bool can_allocate_bulk_data = bulk_data == nullptr;
 
 		// Mark chunks as in-streaming
 		uint32_t* streaming_chunks = m_context.streaming_chunks[tier_index];
 		bitset_set_range(streaming_chunks, desc, first_chunk_index, num_streaming_chunks, true);
+		dispatch_streaming_request(tier_index, request_id);
 
 		// Fire the stream in request and let the streamer handle it (sync/async)
 		streamer->stream_in(stream_start_offset, stream_size, can_allocate_bulk_data, tier, request_id);
 
+		// Synchronous streamers have already completed our request, retire it right away
+		retire_streaming_request(tier_index);
+
 		return database_stream_request_result::dispatched;
 	}
 
 	template<class database_settings_type>
-	inline database_stream_request_result database_context<database_settings_type>::stream_out(quality_tier tier, uint32_t num_chunks_to_stream)
+	inline database_stream_request_result database_context<database_settings_type>::stream_out_range(quality_tier tier, uint32_t begin_chunk_index, uint32_t end_chunk_index, uint32_t num_chunks_to_stream)
 	{
-		ACL_ASSERT(is_initialized(), "Database isn't initialized");
-		if (!is_initialized())
-			return database_stream_request_result::context_not_initialized;
-
-		ACL_ASSERT(tier != quality_tier::highest_importance, "The database does not contain data for the high importance tier, it lives inside compressed_tracks");
-		if (tier == quality_tier::highest_importance)
-			return database_stream_request_result::invalid_database_tier;
-
 		if (is_streaming(tier))
 			return database_stream_request_result::streaming_in_progress;	// Can't stream while we are streaming
 
 		const acl_impl::database_header& header = acl_impl::get_database_header(*m_context.db);
-		const acl_impl::database_chunk_description* chunk_descriptions = tier == quality_tier::medium_importance ? header.get_chunk_descriptions_medium() : header.get_chunk_descriptions_low();
 
 		const uint32_t tier_index = uint32_t(tier) - 1;
+		const acl_impl::database_chunk_description* chunk_descriptions = header.get_chunk_descriptions(tier_index);
 
 		const uint32_t num_chunks = header.num_chunks[tier_index];
 		const bitset_description desc = bitset_description::make_from_num_bits(num_chunks);
-		const uint32_t max_chunk_size = header.max_chunk_size;
-
-		// Clamp the total number of chunks we can stream
-		num_chunks_to_stream = std::min<uint32_t>(num_chunks_to_stream, num_chunks);
 
-		uint32_t first_chunk_index = ~0U;
+		ACL_ASSERT(begin_chunk_index <= end_chunk_index && end_chunk_index <= num_chunks, "Invalid chunk range");
+		end_chunk_index = std::min<uint32_t>(end_chunk_index, num_chunks);
 
-		// Look for chunks that aren't unloaded yet and aren't streaming yet
-		const uint32_t num_entries = desc.get_size();
+		// Look for the first run of chunks that are loaded, nothing is streaming at this point
 		const uint32_t* loaded_chunks = m_context.loaded_chunks[tier_index];
-		for (uint32_t entry_index = 0; entry_index < num_entries; ++entry_index)
-		{
-			const uint32_t maybe_loaded = loaded_chunks[entry_index];
-			const uint32_t num_pending_chunks = count_leading_zeros(maybe_loaded);
-			if (num_pending_chunks != 32)
-			{
-				first_chunk_index = (entry_index * 32) + num_pending_chunks;
-				break;
-			}
-		}
-
-		if (first_chunk_index == ~0U)
-			return database_stream_request_result::done;	// Everything is streamed out or streaming, nothing to do
-
-		// Calculate and clamp our last chunk index (and handle wrapping for safety)
-		const uint64_t last_chunk_index64 = uint64_t(first_chunk_index) + uint64_t(num_chunks_to_stream) - 1;
-		const uint32_t last_chunk_index = last_chunk_index64 >= uint64_t(num_chunks) ? (num_chunks - 1) : uint32_t(last_chunk_index64);
-
-		// Calculate our stream size and account for the fact that the last chunk doesn't have the same size
-		const uint32_t num_streaming_chunks = last_chunk_index - first_chunk_index + 1;
+		uint32_t first_chunk_index;
+		const uint32_t num_streaming_chunks = acl_impl::find_chunk_run(loaded_chunks, desc, begin_chunk_index, end_chunk_index, true, num_chunks_to_stream, first_chunk_index);
 
 		if (num_streaming_chunks == 0)
-			return database_stream_request_result::done;	// Nothing more to stream
+			return database_stream_request_result::done;	// Everything is streamed out, nothing to do
+
+		const uint32_t last_chunk_index = first_chunk_index + num_streaming_chunks - 1;
 
 		database_streamer* streamer = m_context.streamers[tier_index];
 
-		const streaming_request_id request_id = streamer->build_request(streaming_action::stream_out, tier, first_chunk_index, num_streaming_chunks);
+		const streaming_request_id request_id = streamer->build_request(streaming_action::stream_out, streaming_priority::normal, tier, first_chunk_index, num_streaming_chunks);
 		if (!request_id.is_valid())
 			return database_stream_request_result::no_free_streaming_requests;
 
-		// Find the stream start offset from our first chunk's offset
-		const acl_impl::database_chunk_description& first_chunk_description = chunk_descriptions[first_chunk_index];
-		const uint32_t stream_start_offset = first_chunk_description.offset;
-
-		const acl_impl::database_chunk_description& last_chunk_description = chunk_descriptions[last_chunk_index];
-		const uint32_t stream_size = ((num_streaming_chunks - 1) * max_chunk_size) + last_chunk_description.size;
+		// Find the range of the bulk data that contains our chunks
+		uint32_t stream_start_offset;
+		uint32_t stream_size;
+		acl_impl::calculate_chunk_run_stream_range(header, tier, first_chunk_index, num_streaming_chunks, stream_start_offset, stream_size);
 
 		// Mark chunks as in-streaming
 		uint32_t* streaming_chunks = m_context.streaming_chunks[tier_index];
 		bitset_set_range(streaming_chunks, desc, first_chunk_index, num_streaming_chunks, true);
 
-		const uint8_t*& bulk_data_ref = m_context.bulk_data[tier_index];
-		const uint8_t* bulk_data = bulk_data_ref;
+		std::atomic<const uint8_t*>& bulk_data_ref = m_context.bulk_data[tier_index];
+		const uint8_t* bulk_data = bulk_data_ref.load(std::memory_order::memory_order_relaxed);
 		ACL_ASSERT(bulk_data != nullptr, "Bulk data should be allocated when we stream out");
 
 		// We can deallocate our bulk data if we are streaming out the last chunks
 		const uint32_t num_loaded_chunks = bitset_count_set_bits(loaded_chunks, desc);
 		const bool can_deallocate_bulk_data = num_streaming_chunks == num_loaded_chunks;
 		if (can_deallocate_bulk_data)
-			bulk_data_ref = nullptr;
+			bulk_data_ref.store(nullptr, std::memory_order::memory_order_relaxed);
 
 		// Unregister our chunks
-		const uint32_t end_chunk_index = first_chunk_index + num_streaming_chunks;
-		for (uint32_t chunk_index = first_chunk_index; chunk_index < end_chunk_index; ++chunk_index)
+		for (uint32_t chunk_index = first_chunk_index; chunk_index <= last_chunk_index; ++chunk_index)
 		{
 			const acl_impl::database_chunk_description& chunk_description = chunk_descriptions[chunk_index];
 			const acl_impl::database_chunk_header* chunk_header = chunk_description.get_chunk_header(bulk_data);
@@ -615,21 +1073,26 @@ namespace acl
 			{
 				const acl_impl::database_chunk_segment_header& chunk_segment_header = chunk_segment_headers[segment_index];
 
-#if defined(ACL_HAS_ASSERT_CHECKS)
-				const acl_impl::database_runtime_clip_header* clip_header = chunk_segment_header.get_clip_header(m_context.clip_segment_headers);
+				acl_impl::database_runtime_clip_header* clip_header = chunk_segment_header.get_clip_header(m_context.clip_segment_headers);
 				ACL_ASSERT(clip_header->clip_hash == chunk_segment_header.clip_hash, "Unexpected clip hash");
-#endif
+				ACL_ASSERT(clip_header->num_resident_segment_tiers.load(std::memory_order::memory_order_relaxed) != 0, "Clip should have resident segments");
 
 				acl_impl::database_runtime_segment_header* segment_header = chunk_segment_header.get_segment_header(m_context.clip_segment_headers);
 				const uint64_t tier_metadata = (uint64_t(chunk_segment_header.samples_offset) << 32) | chunk_segment_header.sample_indices;
 				ACL_ASSERT(segment_header->tier_metadata[tier_index].load(std::memory_order::memory_order_relaxed) == tier_metadata, "Database tier metadata should have been initialized"); (void)tier_metadata;
 				segment_header->tier_metadata[tier_index].store(0, std::memory_order::memory_order_relaxed);
+				clip_header->num_resident_segment_tiers.fetch_sub(1, std::memory_order::memory_order_relaxed);
 			}
 		}
 
+		dispatch_streaming_request(tier_index, request_id);
+
 		// Fire the stream out request and let the streamer handle it (sync/async)
 		streamer->stream_out(stream_start_offset, stream_size, can_deallocate_bulk_data, tier, request_id);
 
+		// Synchronous streamers have already completed our request, retire it right away
+		retire_streaming_request(tier_index);
+
 		return database_stream_request_result::dispatched;
 	}
 
@@ -25,8 +25,12 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "acl/version.h"
+#include "acl/core/quality_tiers.h"
 #include "acl/core/impl/compiler_utils.h"
+#include "acl/core/impl/compressed_headers.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 
 ACL_IMPL_FILE_PRAGMA_PUSH
@@ -36,29 +40,81 @@ namespace acl
 	ACL_IMPL_VERSION_NAMESPACE_BEGIN
 
 	class database_streamer;
+	class database_streaming_listener;
 
 	namespace acl_impl
 	{
+		// Chunk usage bookkeeping used by the database budget manager to evict the least recently
+		// sampled chunks. Owned by the budget manager, optional.
+		struct database_chunk_usage_v0
+		{
+			// Frame counter advanced by the budget manager, stamped on every chunk we sample from
+			std::atomic<uint32_t> current_frame;
+
+			// Cached from the database header to map sample offsets to chunk indices cheaply
+			uint32_t max_chunk_size;
+			uint32_t num_chunks[k_num_database_tiers];
+
+			// Last frame each chunk was sampled on, one entry per chunk
+			std::atomic<uint32_t>* last_sampled_frames[k_num_database_tiers];
+		};
+
+		// Streaming telemetry counters, see database_settings::is_telemetry_supported(). Owned by the database context, optional.
+		// Every counter is updated with relaxed atomics from the threads that seek and the thread that retires requests.
+		struct database_telemetry_v0
+		{
+			// Number of key frames seeks looked up while the database was sampled from
+			std::atomic<uint64_t> num_frames_requested;
+
+			// Number of key frames served from each quality tier, indexed by quality tier (the compressed tracks are at index 0)
+			std::atomic<uint64_t> num_frames_served[k_num_quality_tiers];
+
+			// Number of key frames that weren't resident and that we interpolated from the closest ones instead
+			std::atomic<uint64_t> num_frames_reconstructed;
+
+			// Number of bytes of the bulk data, as stored, that completed streaming in/out for each database tier
+			std::atomic<uint64_t> num_bytes_streamed_in[k_num_database_tiers];
+			std::atomic<uint64_t> num_bytes_streamed_out[k_num_database_tiers];
+		};
+
+		// Streaming state bits of a tier within database_context_v0::streaming_state
+		// The thread that dispatches requests (e.g. the game thread) sets the in flight bit and the thread
+		// that completes them (e.g. an IO worker) clears it. The latter publishes the newly registered chunks
+		// with release semantics, they are visible to whoever observes the in flight bit cleared.
+		constexpr uint32_t k_streaming_state_in_flight = 1;		// A request is in flight
+		constexpr uint32_t k_streaming_state_succeeded = 2;		// The last request completed successfully
+		constexpr uint32_t k_num_streaming_state_bits = 2;
+
+		// No streaming request to retire
+		constexpr uint16_t k_invalid_streaming_request_index = 0xFFFF;
+
+		// Size of the members of database_context_v0, the padding rounds it up to a multiple of 64 bytes
+		// An array cannot be empty, we pad a whole cache line when the members already fill one
+		constexpr uint32_t k_database_context_v0_unpadded_size = sizeof(void*) == 4 ? (33 + 18 * k_num_database_tiers) : (57 + 34 * k_num_database_tiers);
+		constexpr uint32_t k_database_context_v0_padding_size = ((k_database_context_v0_unpadded_size + 64) & ~63U) - k_database_context_v0_unpadded_size;
+
 		// TODO: If we need to make the context smaller, we can use offsets for the bitsets instead of pointers
 		// from the clip_segment_headers base pointer. The bitsets also follow linearly in memory, we could store only
 		// one offset for the base, and index with the tier * desc.size
 		struct database_context_v0
 		{
-			//														//   offsets
+			//														//   offsets (with 2 tiers)
 			// Only member used to detect if we are initialized, must be first
 			const compressed_database* db;							//   0 |   0
 
 			// We use arrays so we can index with (tier - 1) as our index
-			// Index 0 = medium importance tier, index 1 = low importance
+			// Index 0 = medium importance tier, index k_num_database_tiers - 1 = low importance
 
 			// Runtime related data, commonly accessed
 			uint8_t* clip_segment_headers;							//   4 |   8
 
-			const uint8_t* bulk_data[k_num_database_tiers];			//   8 |  16
+			// Set by the thread that completes the first stream in request
+			std::atomic<const uint8_t*> bulk_data[k_num_database_tiers];	//   8 |  16
 
 			// Streaming related data not commonly accessed
 			database_streamer* streamers[k_num_database_tiers];		//  16 |  32
 
+			// Chunk bitsets, only touched by the thread that dispatches requests
 			uint32_t* loaded_chunks[k_num_database_tiers];			//  24 |  48
 			uint32_t* streaming_chunks[k_num_database_tiers];		//  32 |  64
 
@@ -67,9 +123,27 @@ namespace acl
 			// Cached hash of the bound database instance
 			uint32_t db_hash;										//  44 |  88
 
-			uint8_t padding1[sizeof(void*) == 4 ? 16 : 36];			//  48 |  92
+			// Streaming state bits of every tier, written concurrently by the threads that complete requests
+			mutable std::atomic<uint32_t> streaming_state;			//  48 |  92
 
-			//											Total size:	    64 | 128
+			// Optional chunk usage tracking, see database_budget_manager
+			database_chunk_usage_v0* chunk_usage;					//  52 |  96
+
+			// Optional streaming telemetry, see database_settings::is_telemetry_supported()
+			database_telemetry_v0* telemetry;						//  56 | 104
+
+			// Optional listener notified when requests complete, see database_context::set_streaming_listener(..)
+			database_streaming_listener* streaming_listener;		//  60 | 112
+
+			// Request in flight of every tier until it is retired, only touched by the thread that dispatches requests
+			mutable uint16_t streaming_request_indices[k_num_database_tiers];	//  64 | 120
+
+			// Whether chunk checksums are validated when they stream in, see database_settings::is_chunk_validation_enabled()
+			bool validate_chunks;									//  68 | 124
+
+			uint8_t padding1[k_database_context_v0_padding_size];	//  69 | 125
+
+			//											Total size:	   128 | 128
 
 			//////////////////////////////////////////////////////////////////////////
 
@@ -79,6 +153,94 @@ namespace acl
 			void reset() { db = nullptr; }
 		};
 
+		//////////////////////////////////////////////////////////////////////////
+		// Stamps the chunk that contains the provided tier metadata as sampled on the current frame.
+		// Does nothing if usage tracking is disabled or if the tier data isn't streamed in.
+		inline void mark_chunk_sampled(const database_context_v0& context, uint32_t tier_index, uint64_t tier_metadata)
+		{
+			database_chunk_usage_v0* chunk_usage = context.chunk_usage;
+			if (chunk_usage == nullptr || tier_metadata == 0)
+				return;
+
+			// Every chunk but the last is exactly max_chunk_size bytes
+			const uint32_t samples_offset = uint32_t(tier_metadata >> 32);
+			const uint32_t last_chunk_index = chunk_usage->num_chunks[tier_index] - 1;
+			const uint32_t chunk_index = std::min<uint32_t>(samples_offset / chunk_usage->max_chunk_size, last_chunk_index);
+
+			const uint32_t current_frame = chunk_usage->current_frame.load(std::memory_order::memory_order_relaxed);
+			chunk_usage->last_sampled_frames[tier_index][chunk_index].store(current_frame, std::memory_order::memory_order_relaxed);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Stamps the chunks that contain the provided segment metadata of every tier as sampled on the current frame.
+		inline void mark_chunks_sampled(const database_context_v0& context, const uint64_t (&tier_metadata)[k_num_database_tiers])
+		{
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+				mark_chunk_sampled(context, tier_index, tier_metadata[tier_index]);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Records the two key frames a seek looked up, the quality tier each was served from, and how many
+		// weren't resident and are reconstructed by interpolating the closest ones.
+		// Does nothing if telemetry is disabled.
+		inline void record_seek_telemetry(const database_context_v0& context, quality_tier sample_tier0, quality_tier sample_tier1, uint32_t num_reconstructed_frames)
+		{
+			database_telemetry_v0* telemetry = context.telemetry;
+			if (telemetry == nullptr)
+				return;
+
+			telemetry->num_frames_requested.fetch_add(2, std::memory_order::memory_order_relaxed);
+			telemetry->num_frames_served[uint32_t(sample_tier0)].fetch_add(1, std::memory_order::memory_order_relaxed);
+			telemetry->num_frames_served[uint32_t(sample_tier1)].fetch_add(1, std::memory_order::memory_order_relaxed);
+
+			if (num_reconstructed_frames != 0)
+				telemetry->num_frames_reconstructed.fetch_add(num_reconstructed_frames, std::memory_order::memory_order_relaxed);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns whether any segment of the provided clip is streamed in within any database tier.
+		// When it returns false, every sample lives in the compressed tracks and the segment headers need not be touched.
+		// This is only a hint maintained when streaming in/out, the tier metadata loaded afterwards remains authoritative.
+		inline bool has_resident_segments(const database_runtime_clip_header& clip_header)
+		{
+			return clip_header.num_resident_segment_tiers.load(std::memory_order::memory_order_relaxed) != 0;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Loads the metadata of a segment for every tier up to the specified max quality tier and returns
+		// the combined sample indices. The metadata of the tiers we don't sample from is zero.
+		// There can be another thread writing to those memory locations at the same time (e.g. streaming in/out),
+		// each value is loaded atomically. Acquire semantics pair with the thread that streamed the data in,
+		// the bulk data is visible once we observe them.
+		inline uint32_t load_segment_tier_metadata(const database_runtime_segment_header& segment_header, quality_tier max_quality_tier, uint64_t (&out_tier_metadata)[k_num_database_tiers])
+		{
+			const uint32_t num_sampled_tiers = uint32_t(max_quality_tier);
+
+			uint32_t sample_indices = 0;
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				const uint64_t tier_metadata = tier_index < num_sampled_tiers ? segment_header.tier_metadata[tier_index].load(std::memory_order::memory_order_acquire) : 0;
+				out_tier_metadata[tier_index] = tier_metadata;
+				sample_indices |= uint32_t(tier_metadata);
+			}
+
+			return sample_indices;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the quality tier of the first database tier that contains the provided sample bit,
+		// highest importance if it lives in the compressed tracks.
+		inline quality_tier find_sample_quality_tier(const uint64_t (&tier_metadata)[k_num_database_tiers], uint64_t sample_index)
+		{
+			for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			{
+				if ((tier_metadata[tier_index] & sample_index) != 0)
+					return get_database_quality_tier(tier_index);
+			}
+
+			return quality_tier::highest_importance;
+		}
+
 		static_assert((sizeof(database_context_v0) % 64) == 0, "Unexpected size");
 		static_assert(offsetof(database_context_v0, db) == 0, "db pointer needs to be the first member, see initialize_v0");
 	}
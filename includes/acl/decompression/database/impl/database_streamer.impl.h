@@ -27,11 +27,13 @@
 // Included only once from database_streamer.h
 
 #include "acl/version.h"
-#include "acl/core/bitset.h"
 #include "acl/core/impl/compressed_headers.h"
+#include "acl/core/impl/database_chunk_coding.h"
 #include "acl/decompression/database/impl/database_context.h"
 
+#include <atomic>
 #include <cstdint>
+#include <cstring>
 
 namespace acl
 {
@@ -54,82 +56,123 @@ namespace acl
 			return uint32_t(request_id.value >> 32);
 		}
 
+		// Returns whether the checksum of every chunk of a stream in request matches, the chunks must be resident
+		inline bool validate_streamed_in_chunks(const database_context_v0& context, const streaming_request& request)
+		{
+			const uint32_t tier_index_ = uint32_t(request.tier) - 1;
+
+			const uint8_t* bulk_data_ = context.bulk_data[tier_index_].load(std::memory_order::memory_order_relaxed);
+			if (bulk_data_ == nullptr)
+				bulk_data_ = context.streamers[tier_index_]->get_bulk_data(request.tier);	// First stream in request, it isn't cached yet
+
+			if (bulk_data_ == nullptr)
+				return false;
+
+			const database_header& header_ = get_database_header(*context.db);
+			const database_chunk_description* chunk_descriptions_ = header_.get_chunk_descriptions(tier_index_);
+
+			const uint32_t end_chunk_index = request.first_chunk_index + request.num_streaming_chunks;
+			for (uint32_t chunk_index = request.first_chunk_index; chunk_index < end_chunk_index; ++chunk_index)
+			{
+				const database_chunk_description& chunk_description = chunk_descriptions_[chunk_index];
+				const database_chunk_header* chunk_header = chunk_description.get_chunk_header(bulk_data_);
+
+				// The checksum covers the chunk size, make sure it is sane before we use it
+				if (chunk_header->size != chunk_description.size)
+					return false;
+
+				if (chunk_header->checksum != calculate_database_chunk_checksum(*chunk_header))
+					return false;
+			}
+
+			return true;
+		}
+
+		// Called by the thread that completes or cancels a request, it can run concurrently with decompression
+		// and with the thread that dispatches requests. Chunks that streamed in are registered for decompression
+		// right away while the chunk bitsets are updated when the request is retired, see database_context::is_streaming(..)
 		inline void execute_request(bool success, database_context_v0& context, const streaming_request& request)
 		{
 			const quality_tier tier = request.tier;
-			const uint32_t first_chunk_index = request.first_chunk_index;
-			const uint32_t num_streaming_chunks = request.num_streaming_chunks;
-
-			const uint32_t num_chunks_ = context.db->get_num_chunks(tier);
-			const bitset_description desc_ = bitset_description::make_from_num_bits(num_chunks_);
 			const uint32_t tier_index_ = uint32_t(tier) - 1;
 
-			if (request.action == streaming_action::stream_in)
+			ACL_ASSERT(success || request.action == streaming_action::stream_in, "Cannot cancel/abort stream out request");
+
+			// A corrupted chunk fails the whole request as if it had been canceled, none of its chunks are registered
+			if (success && request.action == streaming_action::stream_in && context.validate_chunks)
+				success = validate_streamed_in_chunks(context, request);
+
+			if (success && request.action == streaming_action::stream_in)
 			{
-				// Streaming in
-				if (success)
+				const uint32_t first_chunk_index = request.first_chunk_index;
+				const uint32_t end_chunk_index = first_chunk_index + request.num_streaming_chunks;
+
+				std::atomic<const uint8_t*>& bulk_data_ref = context.bulk_data[tier_index_];
+				const uint8_t* bulk_data_ = bulk_data_ref.load(std::memory_order::memory_order_relaxed);
+				if (bulk_data_ == nullptr)
 				{
-					const uint8_t*& bulk_data_ref = context.bulk_data[tier_index_];
-					const uint8_t* bulk_data_ = bulk_data_ref;
-					if (bulk_data_ == nullptr)
-					{
-						// This is the first stream in request, our bulk data should be allocated now, query and cache it
-						const database_streamer* streamer_ = context.streamers[tier_index_];
-						bulk_data_ = streamer_->get_bulk_data(tier);
-						ACL_ASSERT(bulk_data_ != nullptr, "Bulk data should be allocated when we stream in");
+					// This is the first stream in request, our bulk data should be allocated now, query and cache it
+					// It is published along with our tier metadata below
+					const database_streamer* streamer_ = context.streamers[tier_index_];
+					bulk_data_ = streamer_->get_bulk_data(tier);
+					ACL_ASSERT(bulk_data_ != nullptr, "Bulk data should be allocated when we stream in");
 
-						bulk_data_ref = bulk_data_;
-					}
+					bulk_data_ref.store(bulk_data_, std::memory_order::memory_order_relaxed);
+				}
 
-					// Register our new chunks
-					const database_header& header_ = get_database_header(*context.db);
-					const database_chunk_description* chunk_descriptions_ = tier == quality_tier::medium_importance ? header_.get_chunk_descriptions_medium() : header_.get_chunk_descriptions_low();
-					const uint32_t end_chunk_index = first_chunk_index + num_streaming_chunks;
-					for (uint32_t chunk_index = first_chunk_index; chunk_index < end_chunk_index; ++chunk_index)
+				// Register our new chunks
+				const database_header& header_ = get_database_header(*context.db);
+				const database_chunk_description* chunk_descriptions_ = header_.get_chunk_descriptions(tier_index_);
+				for (uint32_t chunk_index = first_chunk_index; chunk_index < end_chunk_index; ++chunk_index)
+				{
+					const database_chunk_description& chunk_description = chunk_descriptions_[chunk_index];
+					const database_chunk_header* chunk_header = chunk_description.get_chunk_header(bulk_data_);
+					ACL_ASSERT(chunk_header->index == chunk_index, "Unexpected chunk index");
+
+					const database_chunk_segment_header* chunk_segment_headers = chunk_header->get_segment_headers();
+					const uint32_t num_segments = chunk_header->num_segments;
+					for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
 					{
-						const database_chunk_description& chunk_description = chunk_descriptions_[chunk_index];
-						const database_chunk_header* chunk_header = chunk_description.get_chunk_header(bulk_data_);
-						ACL_ASSERT(chunk_header->index == chunk_index, "Unexpected chunk index");
-
-						const database_chunk_segment_header* chunk_segment_headers = chunk_header->get_segment_headers();
-						const uint32_t num_segments = chunk_header->num_segments;
-						for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
-						{
-							const database_chunk_segment_header& chunk_segment_header = chunk_segment_headers[segment_index];
-
-#if defined(ACL_HAS_ASSERT_CHECKS)
-							const database_runtime_clip_header* clip_header = chunk_segment_header.get_clip_header(context.clip_segment_headers);
-							ACL_ASSERT(clip_header->clip_hash == chunk_segment_header.clip_hash, "Unexpected clip hash");
-#endif
-
-							database_runtime_segment_header* segment_header = chunk_segment_header.get_segment_header(context.clip_segment_headers);
-							ACL_ASSERT(segment_header->tier_metadata[tier_index_].load(std::memory_order::memory_order_relaxed) == 0, "Tier metadata should not be initialized");
-							segment_header->tier_metadata[tier_index_].store((uint64_t(chunk_segment_header.samples_offset) << 32) | chunk_segment_header.sample_indices, std::memory_order::memory_order_relaxed);
-						}
-					}
+						const database_chunk_segment_header& chunk_segment_header = chunk_segment_headers[segment_index];
+
+						database_runtime_clip_header* clip_header = chunk_segment_header.get_clip_header(context.clip_segment_headers);
+						ACL_ASSERT(clip_header->clip_hash == chunk_segment_header.clip_hash, "Unexpected clip hash");
 
-					// Mark chunks as done streaming
-					uint32_t* loaded_chunks_ = context.loaded_chunks[tier_index_];
-					bitset_set_range(loaded_chunks_, desc_, first_chunk_index, num_streaming_chunks, true);
+						// Release semantics ensure that decompression threads that observe our tier metadata also observe
+						// the bulk data pointer and the chunk data
+						database_runtime_segment_header* segment_header = chunk_segment_header.get_segment_header(context.clip_segment_headers);
+						ACL_ASSERT(segment_header->tier_metadata[tier_index_].load(std::memory_order::memory_order_relaxed) == 0, "Tier metadata should not be initialized");
+						segment_header->tier_metadata[tier_index_].store((uint64_t(chunk_segment_header.samples_offset) << 32) | chunk_segment_header.sample_indices, std::memory_order::memory_order_release);
+						clip_header->num_resident_segment_tiers.fetch_add(1, std::memory_order::memory_order_relaxed);
+					}
 				}
 
-				// Mark chunks as no longer streaming
-				uint32_t* streaming_chunks_ = context.streaming_chunks[tier_index_];
-				bitset_set_range(streaming_chunks_, desc_, first_chunk_index, num_streaming_chunks, false);
+				// Newly streamed in chunks count as used so that they aren't evicted before they are sampled
+				database_chunk_usage_v0* chunk_usage = context.chunk_usage;
+				if (chunk_usage != nullptr)
+				{
+					const uint32_t current_frame = chunk_usage->current_frame.load(std::memory_order::memory_order_relaxed);
+					for (uint32_t chunk_index = first_chunk_index; chunk_index < end_chunk_index; ++chunk_index)
+						chunk_usage->last_sampled_frames[tier_index_][chunk_index].store(current_frame, std::memory_order::memory_order_relaxed);
+				}
 			}
-			else
-			{
-				// Streaming out
-				ACL_ASSERT(success, "Cannot cancel/abort stream out request");
 
-				// Mark chunks as done streaming out
-				uint32_t* loaded_chunks_ = context.loaded_chunks[tier_index_];
-				bitset_set_range(loaded_chunks_, desc_, first_chunk_index, num_streaming_chunks, false);
+			// The request and the context can be retired and reused once the request is no longer in flight, read what we need first
+			const streaming_action action = request.action;
+			database_streaming_listener* listener = context.streaming_listener;
+
+			// Mark our request as no longer in flight, this is the last time we touch the context
+			// Release semantics publish everything above to the thread that retires the request
+			const uint32_t state_shift = tier_index_ * k_num_streaming_state_bits;
+			const uint32_t in_flight_bit = k_streaming_state_in_flight << state_shift;
+			const uint32_t succeeded_bit = k_streaming_state_succeeded << state_shift;
+			if (success)
+				context.streaming_state.fetch_xor(in_flight_bit | succeeded_bit, std::memory_order::memory_order_release);	// Clears in flight, sets succeeded
+			else
+				context.streaming_state.fetch_and(~in_flight_bit, std::memory_order::memory_order_release);
 
-				// Mark chunks as no longer streaming
-				uint32_t* streaming_chunks_ = context.streaming_chunks[tier_index_];
-				bitset_set_range(streaming_chunks_, desc_, first_chunk_index, num_streaming_chunks, false);
-			}
+			if (listener != nullptr)
+				listener->on_request_completed(action, tier, success);
 		}
 	}
 
@@ -162,10 +205,8 @@ namespace acl
 		if (request.generation_id != generation_id)
 			return;
 
+		// Our request is released once the database context retires it
 		acl_impl::execute_request(true, *m_context, request);
-
-		// Mark our request as invalid
-		request.reset();
 	}
 
 	inline void database_streamer::cancel(streaming_request_id request_id)
@@ -186,10 +227,59 @@ namespace acl
 		if (request.generation_id != generation_id)
 			return;
 
+		// Our request is released once the database context retires it
 		acl_impl::execute_request(false, *m_context, request);
+	}
 
-		// Mark our request as invalid
-		request.reset();
+	inline bool database_streamer::is_bulk_data_entropy_coded(quality_tier tier) const
+	{
+		ACL_ASSERT(m_context != nullptr, "Streamer must be bound to a database context");
+		return m_context->db->is_bulk_data_entropy_coded(tier);
+	}
+
+	inline uint32_t database_streamer::get_decoded_bulk_data_size(quality_tier tier) const
+	{
+		ACL_ASSERT(m_context != nullptr, "Streamer must be bound to a database context");
+		return m_context->db->get_decoded_bulk_data_size(tier);
+	}
+
+	inline bool database_streamer::decode_bulk_data(quality_tier tier, uint32_t offset, uint32_t size, const uint8_t* stored_data, uint8_t* bulk_data) const
+	{
+		ACL_ASSERT(m_context != nullptr, "Streamer must be bound to a database context");
+		ACL_ASSERT(is_bulk_data_entropy_coded(tier), "Bulk data must be entropy coded");
+
+		const acl_impl::database_header& header = acl_impl::get_database_header(*m_context->db);
+		const uint32_t tier_index = uint32_t(tier) - 1;
+		const acl_impl::database_chunk_description* chunk_descriptions = header.get_chunk_descriptions(tier_index);
+		const acl_impl::database_chunk_description* encoded_chunk_descriptions = header.get_encoded_chunk_descriptions(tier_index);
+		if (encoded_chunk_descriptions == nullptr)
+			return false;
+
+		const uint32_t num_chunks = header.num_chunks[tier_index];
+		const uint32_t end_offset = offset + size;
+
+		// Encoded chunks are sorted by offset, decode those that fall within our range
+		for (uint32_t chunk_index = 0; chunk_index < num_chunks; ++chunk_index)
+		{
+			const acl_impl::database_chunk_description& encoded_chunk_description = encoded_chunk_descriptions[chunk_index];
+			const uint32_t encoded_chunk_offset = encoded_chunk_description.offset;
+			if (encoded_chunk_offset < offset)
+				continue;	// Before our range
+
+			if (encoded_chunk_offset >= end_offset)
+				break;		// After our range, we are done
+
+			if (uint64_t(encoded_chunk_offset) + uint64_t(encoded_chunk_description.size) > uint64_t(end_offset))
+				return false;	// Chunks can't be partially streamed
+
+			const acl_impl::database_chunk_description& chunk_description = chunk_descriptions[chunk_index];
+			uint8_t* chunk_data = bulk_data + uint32_t(chunk_description.offset);
+
+			if (!acl_impl::decode_database_chunk(stored_data + (encoded_chunk_offset - offset), encoded_chunk_description.size, chunk_data, chunk_description.size))
+				return false;
+		}
+
+		return true;
 	}
 
 	inline void database_streamer::bind(acl_impl::database_context_v0& context)
@@ -198,7 +288,19 @@ namespace acl
 		m_context = &context;
 	}
 
-	inline streaming_request_id database_streamer::build_request(streaming_action action, quality_tier tier, uint32_t first_chunk_index, uint32_t num_streaming_chunks)
+	inline streaming_priority database_streamer::get_request_priority(streaming_request_id request_id) const
+	{
+		const uint32_t request_index = acl_impl::get_request_index(request_id);
+		ACL_ASSERT(request_index < m_num_requests, "Invalid request index");
+		if (request_index >= m_num_requests)
+			return streaming_priority::normal;
+
+		const streaming_request& request = m_requests[request_index];
+		ACL_ASSERT(request.is_valid() && request.generation_id == acl_impl::get_generation_id(request_id), "Request is not in flight");
+		return request.priority;
+	}
+
+	inline streaming_request_id database_streamer::build_request(streaming_action action, streaming_priority priority, quality_tier tier, uint32_t first_chunk_index, uint32_t num_streaming_chunks)
 	{
 		const uint32_t request_index = m_next_request_index;
 		streaming_request& request = m_requests[request_index];
@@ -213,6 +315,7 @@ namespace acl
 		const uint32_t generation_id = m_generation_id++;
 
 		request.action = action;
+		request.priority = priority;
 		request.tier = tier;
 		request.first_chunk_index = first_chunk_index;
 		request.num_streaming_chunks = num_streaming_chunks;
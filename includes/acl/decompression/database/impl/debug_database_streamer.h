@@ -42,6 +42,7 @@ namespace acl
 	////////////////////////////////////////////////////////////////////////////////
 	// Implements a debug streamer where we duplicate the bulk data in memory and use
 	// memcpy to stream in the data. Streamed out data is explicitly set to 0xCD with memset.
+	// Entropy coded tiers are decoded as they stream in.
 	// It cannot be shared between tiers.
 	////////////////////////////////////////////////////////////////////////////////
 	class debug_database_streamer final : public database_streamer
@@ -53,12 +54,13 @@ namespace acl
 			, m_src_bulk_data(bulk_data)
 			, m_streamed_bulk_data(nullptr)
 			, m_bulk_data_size(bulk_data_size)
+			, m_streamed_bulk_data_size(0)
 		{
 		}
 
 		virtual ~debug_database_streamer() override
 		{
-			deallocate_type_array(m_allocator, m_streamed_bulk_data, m_bulk_data_size);
+			deallocate_type_array(m_allocator, m_streamed_bulk_data, m_streamed_bulk_data_size);
 		}
 
 		virtual bool is_initialized() const override { return m_bulk_data_size == 0 || m_src_bulk_data != nullptr; }
@@ -75,15 +77,28 @@ namespace acl
 			ACL_ASSERT(offset < m_bulk_data_size, "Steam offset is outside of the bulk data range");
 			ACL_ASSERT(size <= m_bulk_data_size, "Stream size is larger than the bulk data size");
 			ACL_ASSERT(uint64_t(offset) + uint64_t(size) <= uint64_t(m_bulk_data_size), "Streaming request is outside of the bulk data range");
-			(void)tier;
+
+			const bool is_entropy_coded = is_bulk_data_entropy_coded(tier);
 
 			if (can_allocate_bulk_data)
 			{
 				ACL_ASSERT(m_streamed_bulk_data == nullptr, "Bulk data already allocated");
 
-				m_streamed_bulk_data = allocate_type_array<uint8_t>(m_allocator, m_bulk_data_size);
+				// Entropy coded chunks are decoded into the normal chunk layout
+				m_streamed_bulk_data_size = is_entropy_coded ? get_decoded_bulk_data_size(tier) : m_bulk_data_size;
+				m_streamed_bulk_data = allocate_type_array<uint8_t>(m_allocator, m_streamed_bulk_data_size);
 
-				std::memset(m_streamed_bulk_data, 0xCD, m_bulk_data_size);
+				std::memset(m_streamed_bulk_data, 0xCD, m_streamed_bulk_data_size);
+			}
+
+			if (is_entropy_coded)
+			{
+				if (decode_bulk_data(tier, offset, size, m_src_bulk_data + offset, m_streamed_bulk_data))
+					complete(request_id);
+				else
+					cancel(request_id);
+
+				return;
 			}
 
 			std::memcpy(m_streamed_bulk_data + offset, m_src_bulk_data + offset, size);
@@ -95,15 +110,16 @@ namespace acl
 			ACL_ASSERT(offset < m_bulk_data_size, "Steam offset is outside of the bulk data range");
 			ACL_ASSERT(size <= m_bulk_data_size, "Stream size is larger than the bulk data size");
 			ACL_ASSERT(uint64_t(offset) + uint64_t(size) <= uint64_t(m_bulk_data_size), "Streaming request is outside of the bulk data range");
-			(void)tier;
 
-			std::memset(m_streamed_bulk_data + offset, 0xCD, size);
+			// Entropy coded tiers provide the range as stored which doesn't match our decoded data, it is left as is
+			if (!is_bulk_data_entropy_coded(tier))
+				std::memset(m_streamed_bulk_data + offset, 0xCD, size);
 
 			if (can_deallocate_bulk_data)
 			{
 				ACL_ASSERT(m_streamed_bulk_data != nullptr, "Bulk data already deallocated");
 
-				deallocate_type_array(m_allocator, m_streamed_bulk_data, m_bulk_data_size);
+				deallocate_type_array(m_allocator, m_streamed_bulk_data, m_streamed_bulk_data_size);
 				m_streamed_bulk_data = nullptr;
 			}
 
@@ -118,6 +134,7 @@ namespace acl
 		const uint8_t* m_src_bulk_data;
 		uint8_t* m_streamed_bulk_data;
 		uint32_t m_bulk_data_size;
+		uint32_t m_streamed_bulk_data_size;
 
 		static constexpr uint32_t k_max_num_requests = k_num_database_tiers;	// One per database tier
 		streaming_request m_requests[k_max_num_requests];
@@ -0,0 +1,131 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/error.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/decompression/database/database_streamer.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// A streaming job to be executed by an IO worker thread.
+		struct streaming_job
+		{
+			streaming_request_id	request_id = k_invalid_streamer_request_id;
+			uint32_t				offset = 0;
+			uint32_t				size = 0;
+			quality_tier			tier = quality_tier::highest_importance;
+			bool					is_entropy_coded = false;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// A small blocking job queue shared between the thread that issues streaming requests
+		// and the IO worker thread that fulfills them.
+		// Since a single request can be in flight per quality tier, we only need a handful of slots.
+		//////////////////////////////////////////////////////////////////////////
+		class streaming_job_queue
+		{
+		public:
+			streaming_job_queue() = default;
+
+			//////////////////////////////////////////////////////////////////////////
+			// Queues a new job and wakes up the worker thread.
+			// Returns false if the queue is full or stopped.
+			bool push(const streaming_job& job)
+			{
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					if (m_is_stopped || m_num_jobs >= k_max_num_jobs)
+						return false;
+
+					m_jobs[(m_first_job_index + m_num_jobs) % k_max_num_jobs] = job;
+					m_num_jobs++;
+				}
+
+				m_condition.notify_one();
+				return true;
+			}
+
+			//////////////////////////////////////////////////////////////////////////
+			// Blocks until a job is available or the queue is stopped.
+			// Returns false once the queue is stopped and no job remains.
+			bool pop(streaming_job& out_job)
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_condition.wait(lock, [this]() { return m_is_stopped || m_num_jobs != 0; });
+
+				if (m_num_jobs == 0)
+					return false;	// Stopped
+
+				out_job = m_jobs[m_first_job_index];
+				m_first_job_index = (m_first_job_index + 1) % k_max_num_jobs;
+				m_num_jobs--;
+				return true;
+			}
+
+			//////////////////////////////////////////////////////////////////////////
+			// Stops the queue, pending jobs will still be popped.
+			void stop()
+			{
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					m_is_stopped = true;
+				}
+
+				m_condition.notify_all();
+			}
+
+		private:
+			streaming_job_queue(const streaming_job_queue&) = delete;
+			streaming_job_queue& operator=(const streaming_job_queue&) = delete;
+
+			static constexpr uint32_t k_max_num_jobs = k_num_database_tiers * 2;
+
+			std::mutex m_mutex;
+			std::condition_variable m_condition;
+
+			streaming_job m_jobs[k_max_num_jobs];
+			uint32_t m_first_job_index = 0;
+			uint32_t m_num_jobs = 0;
+			bool m_is_stopped = false;
+		};
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,222 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/error.h"
+#include "acl/core/memory_utils.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/decompression/database/database_streamer.h"
+#include "acl/decompression/database/impl/streaming_job_queue.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+
+#if !defined(_WIN32)
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <unistd.h>
+
+	#define ACL_IMPL_HAS_MMAP_DATABASE_STREAMER
+#endif
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+#if defined(ACL_IMPL_HAS_MMAP_DATABASE_STREAMER)
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Implements an asynchronous streamer that memory maps a bulk data file written
+	// from the output of 'split_database_bulk_data(..)'.
+	// The mapping is used directly as the bulk data. Streaming in faults the requested pages in
+	// from a dedicated IO worker thread in blocks of at most 'read_granularity' bytes, typically
+	// the database max chunk size, so that decompression never page faults on the calling thread.
+	// Streaming out releases the pages back to the OS and compacting releases those that straddled
+	// chunks streamed out separately.
+	// Entropy coded tiers cannot be used in place and are not supported, use 'file_database_streamer' instead.
+	// Only available on POSIX platforms, use 'file_database_streamer' elsewhere.
+	// It cannot be shared between tiers.
+	////////////////////////////////////////////////////////////////////////////////
+	class mmap_database_streamer final : public database_streamer
+	{
+	public:
+		mmap_database_streamer(const char* bulk_data_filename, uint32_t bulk_data_size, uint32_t read_granularity)
+			: database_streamer(m_requests, k_max_num_requests)
+			, m_bulk_data(nullptr)
+			, m_bulk_data_size(bulk_data_size)
+			, m_read_granularity(read_granularity)
+			, m_page_size(uint32_t(sysconf(_SC_PAGESIZE)))
+		{
+			ACL_ASSERT(read_granularity != 0, "Read granularity must be greater than zero");
+
+			if (bulk_data_filename != nullptr && bulk_data_size != 0)
+			{
+				const int file = open(bulk_data_filename, O_RDONLY);
+				if (file >= 0)
+				{
+					void* mapping = mmap(nullptr, bulk_data_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+					// The mapping remains valid once the file is closed
+					close(file);
+
+					if (mapping != MAP_FAILED)
+					{
+						m_bulk_data = static_cast<uint8_t*>(mapping);
+						m_worker = std::thread([this]() { execute_jobs(); });
+					}
+				}
+			}
+		}
+
+		virtual ~mmap_database_streamer() override
+		{
+			m_jobs.stop();
+
+			if (m_worker.joinable())
+				m_worker.join();
+
+			if (m_bulk_data != nullptr)
+				munmap(m_bulk_data, m_bulk_data_size);
+		}
+
+		virtual bool is_initialized() const override { return m_bulk_data_size == 0 || m_bulk_data != nullptr; }
+
+		virtual const uint8_t* get_bulk_data(quality_tier tier) const override
+		{
+			ACL_ASSERT(tier != quality_tier::highest_importance, "Cannot stream the highest importance tier");
+			(void)tier;
+			return m_bulk_data;
+		}
+
+		virtual void stream_in(uint32_t offset, uint32_t size, bool can_allocate_bulk_data, quality_tier tier, streaming_request_id request_id) override
+		{
+			ACL_ASSERT(offset < m_bulk_data_size, "Steam offset is outside of the bulk data range");
+			ACL_ASSERT(size <= m_bulk_data_size, "Stream size is larger than the bulk data size");
+			ACL_ASSERT(uint64_t(offset) + uint64_t(size) <= uint64_t(m_bulk_data_size), "Streaming request is outside of the bulk data range");
+			(void)can_allocate_bulk_data;
+
+			// Our mapping is used as is, entropy coded chunks would need to be decoded elsewhere
+			ACL_ASSERT(!is_bulk_data_entropy_coded(tier), "Entropy coded bulk data is not supported");
+			if (is_bulk_data_entropy_coded(tier))
+			{
+				cancel(request_id);
+				return;
+			}
+
+			acl_impl::streaming_job job;
+			job.request_id = request_id;
+			job.offset = offset;
+			job.size = size;
+
+			if (m_bulk_data == nullptr || !m_jobs.push(job))
+				cancel(request_id);
+		}
+
+		virtual void stream_out(uint32_t offset, uint32_t size, bool can_deallocate_bulk_data, quality_tier tier, streaming_request_id request_id) override
+		{
+			ACL_ASSERT(offset < m_bulk_data_size, "Steam offset is outside of the bulk data range");
+			ACL_ASSERT(size <= m_bulk_data_size, "Stream size is larger than the bulk data size");
+			ACL_ASSERT(uint64_t(offset) + uint64_t(size) <= uint64_t(m_bulk_data_size), "Streaming request is outside of the bulk data range");
+			(void)can_deallocate_bulk_data;
+			(void)tier;
+
+			// We can only release the pages entirely contained within our range, the others might still be in use
+			const uint32_t first_page_offset = align_to(offset, m_page_size);
+			const uint32_t end_page_offset = (offset + size) / m_page_size * m_page_size;
+			if (m_bulk_data != nullptr && first_page_offset < end_page_offset)
+				madvise(m_bulk_data + first_page_offset, end_page_offset - first_page_offset, MADV_DONTNEED);
+
+			complete(request_id);
+		}
+
+		virtual void release_unused_bulk_data(uint32_t offset, uint32_t size, quality_tier tier) override
+		{
+			ACL_ASSERT(uint64_t(offset) + uint64_t(size) <= uint64_t(m_bulk_data_size), "Release range is outside of the bulk data range");
+			(void)tier;
+
+			// Pages that straddle chunks we streamed out separately were retained, the range now covers them entirely
+			const uint32_t first_page_offset = align_to(offset, m_page_size);
+			const uint32_t end_page_offset = (offset + size) / m_page_size * m_page_size;
+			if (m_bulk_data != nullptr && first_page_offset < end_page_offset)
+				madvise(m_bulk_data + first_page_offset, end_page_offset - first_page_offset, MADV_DONTNEED);
+		}
+
+	private:
+		mmap_database_streamer(const mmap_database_streamer&) = delete;
+		mmap_database_streamer& operator=(const mmap_database_streamer&) = delete;
+
+		void fault_in_range(uint32_t offset, uint32_t size) const
+		{
+			const uint32_t end_offset = offset + size;
+			uint32_t block_offset = offset / m_page_size * m_page_size;
+			while (block_offset < end_offset)
+			{
+				const uint32_t block_size = std::min<uint32_t>(end_offset - block_offset, m_read_granularity);
+
+				// Kick off the read for the whole block before we touch it
+				madvise(m_bulk_data + block_offset, block_size, MADV_WILLNEED);
+
+				// Touch every page to make sure it is resident before we complete the request
+				uint32_t checksum = 0;
+				for (uint32_t page_offset = block_offset; page_offset < block_offset + block_size; page_offset += m_page_size)
+					checksum += static_cast<const volatile uint8_t*>(m_bulk_data)[page_offset];
+
+				(void)checksum;
+				block_offset += block_size;
+			}
+		}
+
+		void execute_jobs()
+		{
+			acl_impl::streaming_job job;
+			while (m_jobs.pop(job))
+			{
+				fault_in_range(job.offset, job.size);
+				complete(job.request_id);
+			}
+		}
+
+		uint8_t* m_bulk_data;
+		uint32_t m_bulk_data_size;
+		uint32_t m_read_granularity;
+		uint32_t m_page_size;
+
+		acl_impl::streaming_job_queue m_jobs;
+		std::thread m_worker;
+
+		static constexpr uint32_t k_max_num_requests = k_num_database_tiers;	// One per database tier
+		streaming_request m_requests[k_max_num_requests];
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+#endif	// ACL_IMPL_HAS_MMAP_DATABASE_STREAMER
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -41,6 +41,7 @@ namespace acl
 	// Implements a null streamer where we simply use the provided bulk data buffer and
 	// perform no operations on it as everything is already streamed in.
 	// This streamer is the default in-memory streaming implementation.
+	// Entropy coded tiers are not supported since they must be decoded as they stream in.
 	// It cannot be shared between multiple tiers.
 	////////////////////////////////////////////////////////////////////////////////
 	class null_database_streamer final : public database_streamer
@@ -71,7 +72,14 @@ namespace acl
 			(void)offset;
 			(void)size;
 			(void)can_allocate_bulk_data;
-			(void)tier;
+
+			// The provided bulk data is used as is, entropy coded chunks would need to be decoded elsewhere
+			ACL_ASSERT(!is_bulk_data_entropy_coded(tier), "Entropy coded bulk data is not supported");
+			if (is_bulk_data_entropy_coded(tier))
+			{
+				cancel(request_id);
+				return;
+			}
 
 			complete(request_id);
 		}
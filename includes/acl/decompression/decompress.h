@@ -25,27 +25,45 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "acl/version.h"
+#include "acl/core/additive_utils.h"
+#include "acl/core/bitset.h"
+#include "acl/core/compressed_bundle.h"
 #include "acl/core/compressed_database.h"
 #include "acl/core/compressed_tracks.h"
 #include "acl/core/compressed_tracks_version.h"
 #include "acl/core/error.h"
 #include "acl/core/floating_point_exceptions.h"
 #include "acl/core/iallocator.h"
+#include "acl/core/memory_utils.h"
 #include "acl/core/interpolation_utils.h"
+#include "acl/core/quality_tiers.h"
+#include "acl/core/time_utils.h"
 #include "acl/core/track_formats.h"
 #include "acl/core/track_traits.h"
 #include "acl/core/track_types.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/decompression/decompression_settings.h"
+#include "acl/decompression/decompression_stats.h"
+#include "acl/decompression/track_offset_table.h"
+#include "acl/decompression/track_rounding_table.h"
+#include "acl/decompression/unpacked_constant_pose.h"
 #include "acl/decompression/database/database.h"
+#include "acl/decompression/impl/additive_track_writer.h"
+#include "acl/decompression/impl/blend_track_writer.h"
+#include "acl/decompression/impl/capture_track_writer.h"
 #include "acl/decompression/impl/decompression_context_selector.h"
+#include "acl/decompression/impl/decompression_stats.impl.h"
 #include "acl/decompression/impl/decompression_version_selector.h"
+#include "acl/decompression/impl/layer_track_writer.h"
+#include "acl/decompression/impl/masked_track_writer.h"
 #include "acl/decompression/impl/scalar_track_decompression.h"
 #include "acl/decompression/impl/transform_track_decompression.h"
 #include "acl/decompression/impl/universal_track_decompression.h"
 #include "acl/math/vector4_packing.h"
 
 #include <rtm/types.h>
+#include <rtm/matrix3x4f.h>
+#include <rtm/qvvf.h>
 #include <rtm/scalarf.h>
 #include <rtm/vector4f.h>
 
@@ -58,6 +76,8 @@ namespace acl
 {
 	ACL_IMPL_VERSION_NAMESPACE_BEGIN
 
+	template<class decompression_settings_type> class decompression_binding;
+
 	//////////////////////////////////////////////////////////////////////////
 	// Decompression context for the uniformly sampled algorithm. The context
 	// allows various decompression actions to be performed on a compressed track list.
@@ -72,9 +92,13 @@ namespace acl
 	// the track list, we can trivially calculate the offsets required to read the
 	// desired data. All the data is sorted in order to ensure all reads are
 	// as contiguous as possible for optimal cache locality during decompression.
+	//
+	// When stats tracking is disabled (the default), a context is exactly as large
+	// as its persistent state: 128 bytes (two cache lines) for transform tracks.
+	// See also 'decompression_context_pool' to manage many contexts.
 	//////////////////////////////////////////////////////////////////////////
 	template<class decompression_settings_type>
-	class decompression_context
+	class decompression_context : private acl_impl::decompression_stats_storage<decompression_settings_type::is_stats_tracking_enabled()>
 	{
 	public:
 		//////////////////////////////////////////////////////////////////////////
@@ -107,6 +131,19 @@ namespace acl
 		// Returns whether initialization was successful or not.
 		bool initialize(const compressed_tracks& tracks, const database_context<db_settings_type>& database);
 
+		//////////////////////////////////////////////////////////////////////////
+		// Initializes the context instance to a particular clip contained in a compressed bundle.
+		// The clip's shared metadata lives in the bundle, query it from there.
+		// Returns whether initialization was successful or not.
+		bool initialize(const compressed_bundle& bundle, uint32_t clip_index);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Initializes the context instance from a shared binding, see decompression_binding.
+		// The binding state is copied as-is and the compressed tracks aren't read or validated again.
+		// This is safe to call from multiple threads on the same binding.
+		// Returns whether initialization was successful or not.
+		bool initialize(const decompression_binding<decompression_settings_type>& binding);
+
 		//////////////////////////////////////////////////////////////////////////
 		// Returns true if this context instance is bound to a compressed tracks instance, false otherwise.
 		bool is_initialized() const { return m_context.is_initialized(); }
@@ -141,6 +178,15 @@ namespace acl
 		// Returns true if this context instance is bound to the specified database instance, false otherwise.
 		bool is_bound_to(const compressed_database& database) const;
 
+		//////////////////////////////////////////////////////////////////////////
+		// Shares the constant rotations of an unpacked constant pose with this context instance.
+		// Instead of unpacking them every time, the context reads them from the pose when
+		// decompressing every track. The pose must be bound to the same compressed tracks instance
+		// and it must outlive this context. Initializing the context again unbinds the pose.
+		// Providing nullptr unbinds the current pose.
+		// Returns whether binding was successful or not. Only transform tracks are supported.
+		bool set_constant_pose(const unpacked_constant_pose* pose);
+
 		//////////////////////////////////////////////////////////////////////////
 		// Sets the looping policy.
 		// Should only be used when the host runtime requires overriding the default behavior.
@@ -153,24 +199,187 @@ namespace acl
 		// If wrapping is not disabled, this is the policy from the compressed data by default.
 		sample_looping_policy get_looping_policy() const;
 
+		//////////////////////////////////////////////////////////////////////////
+		// Sets the highest quality tier this context samples from when bound to a database.
+		// Key frames that live in a higher tier are ignored even when they are streamed in and
+		// we interpolate the ones around them instead. With 'highest_importance', only the key frames
+		// within the compressed tracks are used and the database isn't accessed at all.
+		// This is useful for distant characters that do not need the quality of the database.
+		// If we already seeked, we seek again to the current sample time to honor the new tier.
+		// By default, `lowest_importance` is used and every tier streamed in is sampled.
+		// Initializing the context again resets it to its default value.
+		void set_max_quality_tier(quality_tier tier);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Gets the highest quality tier this context samples from.
+		quality_tier get_max_quality_tier() const;
+
 		//////////////////////////////////////////////////////////////////////////
 		// Seeks within the compressed tracks to a particular point in time with the
 		// desired rounding policy.
 		// The sample_time value must be within [0, clip duration] inclusive otherwise it will be clamped.
 		void seek(float sample_time, sample_rounding_policy rounding_policy);
 
+		//////////////////////////////////////////////////////////////////////////
+		// Seeks relative to the current sample time by a delta time (positive or negative)
+		// with the desired rounding policy. The new sample time wraps around the duration
+		// with the wrap looping policy and is clamped otherwise, see advance_sample_time(..).
+		// If the context hasn't seeked yet, we advance from the start.
+		void advance(float delta_time, sample_rounding_policy rounding_policy);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Seeks to a particular point in time, like 'seek', and issues software prefetches
+		// for the headers, the constant data, the range data, and the animated data of the
+		// key frames we interpolate. Nothing is unpacked.
+		// This is meant to be called ahead of time (e.g. in an earlier job phase) so that
+		// 'decompress_tracks' later runs with a warm cache. Calling 'seek' again with the same
+		// sample time and rounding policy does nothing.
+		void prefetch(float sample_time, sample_rounding_policy rounding_policy);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the current sample time or a negative value if we haven't seeked yet.
+		float get_sample_time() const;
+
 		//////////////////////////////////////////////////////////////////////////
 		// Decompress every track at the current sample time.
 		// The track_writer_type allows complete control over how the tracks are written out.
 		template<class track_writer_type>
 		void decompress_tracks(track_writer_type& writer);
 
+		//////////////////////////////////////////////////////////////////////////
+		// Decompress every track at the current sample time.
+		// The rounding table provides the rounding policy of every track and must be bound to the
+		// same compressed tracks instance, see track_rounding_table. When seeking with
+		// 'sample_rounding_policy::per_track', the track writer is no longer queried for them.
+		// Scalar tracks ignore the rounding table.
+		// The track_writer_type allows complete control over how the tracks are written out.
+		template<class track_writer_type>
+		void decompress_tracks(const track_rounding_table& rounding_table, track_writer_type& writer);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Decompress the subset of tracks set in the provided track mask at the current sample time.
+		// This is useful to implement LOD: tracks not in the mask are not written out and whole groups
+		// of masked out animated transform sub-tracks are skipped without being unpacked.
+		// The track mask must contain at least as many bits as there are tracks.
+		// The track_writer_type allows complete control over how the tracks are written out.
+		template<class track_writer_type>
+		void decompress_tracks(const bitset_description& mask_desc, const uint32_t* track_mask, track_writer_type& writer);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Decompress the rotation, translation, and scale sub-tracks set in their respective masks at the current sample time.
+		// Each mask contains one bit per track and a null mask keeps every sub-track of its kind.
+		// Groups of 4 animated sub-tracks that are all masked out are skipped without being unpacked.
+		// Unlike the compile time skip functions of the track writer, the masks can change every call
+		// at the cost of a bit test per sub-track.
+		// Only transform tracks are supported.
+		template<class track_writer_type>
+		void decompress_tracks(const bitset_description& mask_desc, const uint32_t* rotation_mask, const uint32_t* translation_mask, const uint32_t* scale_mask, track_writer_type& writer);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Decompress the tracks retained at an LOD at the current sample time.
+		// Tracks are stored in output order and the tracks of lower LOD levels come first,
+		// see 'track_desc_transformf::lod_level' and 'calculate_num_lod_tracks(..)'.
+		// Only the first 'num_lod_tracks' tracks are written. Transform tracks stop unpacking
+		// once those are done instead of testing a mask for every track, the data of the tracks
+		// dropped by the LOD is never read.
+		// The track_writer_type allows complete control over how the tracks are written out.
+		template<class track_writer_type>
+		void decompress_lod_tracks(uint32_t num_lod_tracks, track_writer_type& writer);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Seeks and decompresses every track at each of the provided sample times.
+		// Samples are processed in increasing time order, regardless of the order provided, which
+		// walks the segments linearly and reuses their data while it is still in the cache.
+		// This is useful when sampling a clip many times (e.g. to extract motion matching features).
+		// The writers are a parallel array indexed like the sample times.
+		// The allocator is used for temporary storage and the context is left sought at the
+		// largest sample time. The sample times follow the same rules as 'seek'.
+		template<class track_writer_type>
+		void decompress_tracks_at_times(iallocator& allocator, const float* sample_times, uint32_t num_sample_times, sample_rounding_policy rounding_policy, track_writer_type* const* writers);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Decompress every track of an additive clip at the current sample time and apply them on top of a base pose.
+		// The additive format must match the one used when compressing and the base pose must contain one
+		// transform per track. The writer receives the final transforms with the additive applied.
+		// Only transform tracks are supported.
+		template<class track_writer_type>
+		void decompress_additive_tracks(additive_clip_format8 additive_format, const rtm::qvvf* base_pose, track_writer_type& writer);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Decompress every track at the current sample time and convert them into object space.
+		// The parent track indices stored in the optional metadata are used and parents must come
+		// before their children. Tracks are converted in place, in stored order, after they have
+		// been written out in local space. The track writer must implement
+		// read_rotation/read_translation/read_scale (see track_writer::supports_read_back) to return the values it was last written.
+		// Returns false and leaves the tracks in local space if the parent track indices are not stored
+		// or if a parent is stored after one of its children.
+		// Only transform tracks are supported.
+		template<class track_writer_type>
+		bool decompress_tracks_object_space(track_writer_type& writer);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Decompress every track at the current sample time and write out a skinning palette.
+		// Tracks are written in local space and they are then converted into rtm::matrix3x4f, combined
+		// into object space with their parent, and multiplied by their inverse bind pose:
+		//    palette[i] = inverse_bind_pose[i] * object_transform[i]
+		// Matrix arithmetic is used to combine the transforms, like qvvf_matrix3x4f_transform_error_metric, which
+		// properly handles non-uniform scale. The inverse bind pose and the palette must contain one matrix per track.
+		// The parent track indices stored in the optional metadata are used and parents must come before their children.
+		// The track writer must implement read_rotation/read_translation/read_scale (see track_writer::supports_read_back) to return the values it was last written.
+		// If the parent track indices are not stored, every track is treated as a root.
+		// Returns false and leaves the palette untouched if a parent is stored after one of its children.
+		// Only transform tracks are supported.
+		template<class track_writer_type>
+		bool decompress_skinning_palette(const rtm::matrix3x4f* inverse_bind_pose, track_writer_type& writer, rtm::matrix3x4f* out_palette);
+
 		//////////////////////////////////////////////////////////////////////////
 		// Decompress a single track at the current sample time.
 		// The track_writer_type allows complete control over how the track is written out.
 		template<class track_writer_type>
 		void decompress_track(uint32_t track_index, track_writer_type& writer);
 
+		//////////////////////////////////////////////////////////////////////////
+		// Decompress a single track at the current sample time.
+		// The offset table provides the location of the track data and must be bound to the
+		// same compressed tracks instance, see track_offset_table. The cost no longer depends on the track index.
+		// Scalar tracks ignore the offset table.
+		// The track_writer_type allows complete control over how the track is written out.
+		template<class track_writer_type>
+		void decompress_track(uint32_t track_index, const track_offset_table& offset_table, track_writer_type& writer);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Decompress the tracks [first_track_index, first_track_index + num_range_tracks) at the current sample time.
+		// The offset table provides where the data of the range starts and must be bound to the same
+		// compressed tracks instance, see track_offset_table. Ranges must start on a multiple of
+		// 'k_track_range_alignment' tracks and their track indices are the same as with 'decompress_tracks'.
+		// The context isn't modified: once it has been sought, disjoint ranges can be decompressed
+		// concurrently from several threads to split the cost of a very large pose. Each thread must use
+		// its own track writer or a writer that supports concurrent writes to distinct tracks.
+		// The key frame cache and SOA rotation output are not used.
+		// Only transform tracks are supported.
+		template<class track_writer_type>
+		void decompress_track_range(uint32_t first_track_index, uint32_t num_range_tracks, const track_offset_table& offset_table, track_writer_type& writer) const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Decompress a single transform track at two points in time and write out the delta between them.
+		// The delta is relative to the first sample: transform1 = qvv_mul(delta, transform0)
+		// This is typically used to extract root motion. Both sample times follow the same rules as 'seek'
+		// and the context remains sought at the second sample time afterwards.
+		// This seeks twice and decompresses the track at each sample time, it costs as much as two
+		// calls to 'seek' and 'decompress_track' but the delta is computed without a track writer round-trip.
+		// The track_writer_type allows complete control over how the delta is written out.
+		template<class track_writer_type>
+		void decompress_track_delta(uint32_t track_index, float sample_time0, float sample_time1, sample_rounding_policy rounding_policy, track_writer_type& writer);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the stats accumulated since the context was constructed or the stats were last reset.
+		// Stats are only accumulated when 'decompression_settings::is_stats_tracking_enabled()' is true.
+		const decompression_stats& get_stats() const { return stats_storage_type::get_accumulated_stats(); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Resets the accumulated stats to zero.
+		void reset_stats() { stats_storage_type::reset_accumulated_stats(); }
+
 	private:
 		decompression_context(const decompression_context& other) = delete;
 		decompression_context& operator=(const decompression_context& other) = delete;
@@ -186,20 +395,139 @@ namespace acl
 		static constexpr bool k_supports_transform_tracks = settings_type::is_track_type_supported(track_type8::qvvf);
 
 		// The type of our persistent context based on what track types we support
-		using context_type = typename acl_impl::persistent_decompression_context_selector<k_supports_scalar_tracks, k_supports_transform_tracks>::type;
+		using context_type = typename acl_impl::persistent_decompression_context_selector<k_supports_scalar_tracks, k_supports_transform_tracks, settings_type::get_keyframe_cache_max_num_sub_tracks(), settings_type::is_segment_range_cache_enabled()>::type;
 
 		// The type of our algorithm implementation based on the supported version
 		using version_impl_type = acl_impl::decompression_version_selector<settings_type::version_supported()>;
 
+		// Accumulated stats are only stored when stats tracking is enabled
+		using stats_storage_type = acl_impl::decompression_stats_storage<settings_type::is_stats_tracking_enabled()>;
+
 		// Internal context data
 		context_type m_context;
 
+		template<class settings_type_>
+		friend class decompression_context_pool;
+
+		template<class settings_type_>
+		friend uint32_t initialize_batch(decompression_context<settings_type_>* const* contexts, const compressed_tracks* const* tracks_list, uint32_t num_contexts);
+
+		template<class settings_type_, class track_writer_type>
+		friend void decompress_tracks_batch(decompression_context<settings_type_>* const* contexts, const float* sample_times, sample_rounding_policy rounding_policy, track_writer_type* const* writers, uint32_t num_contexts);
+
+		template<class settings_type_, class track_writer_type>
+		friend void decompress_tracks_batch(decompression_context<settings_type_>* const* contexts, const float* sample_times, sample_rounding_policy rounding_policy, const bitset_description& mask_desc, const uint32_t* track_mask, track_writer_type* const* writers, uint32_t num_contexts);
+
 		static_assert(std::is_base_of<decompression_settings, settings_type>::value, "decompression_settings_type must derive from decompression_settings!");
 		static_assert(std::is_base_of<database_settings, db_settings_type>::value, "database_settings_type must derive from database_settings!");
 		static_assert(settings_type::version_supported() != compressed_tracks_version16::none, "decompression_settings_type must support at least one version");
 		static_assert(db_settings_type::version_supported() == compressed_tracks_version16::none || db_settings_type::version_supported() == settings_type::version_supported(), "database_settings_type's supported version must be none or match the supported version from decompression_settings_type");
 	};
 
+	//////////////////////////////////////////////////////////////////////////
+	// Initializes multiple context instances in a single call (e.g. when a level loads or a crowd spawns).
+	// Each context is initialized with its corresponding compressed tracks instance. The headers of the
+	// compressed tracks are prefetched a few contexts ahead so that their cache misses overlap.
+	// When consecutive contexts use the same compressed tracks instance, it is only validated and read
+	// once and the following contexts copy the state of the first like a decompression_binding would.
+	// Grouping contexts by clip maximizes this reuse.
+	// Returns the number of contexts successfully initialized, contexts that fail are left as-is.
+	template<class decompression_settings_type>
+	uint32_t initialize_batch(decompression_context<decompression_settings_type>* const* contexts, const compressed_tracks* const* tracks_list, uint32_t num_contexts);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Seeks multiple context instances in a single call.
+	// Each context is sought to its corresponding sample time. The contexts and the headers
+	// of their compressed tracks are prefetched a few contexts ahead so that their cache misses overlap.
+	// Every context must be initialized and the sample times follow the same rules as 'seek'.
+	template<class decompression_settings_type>
+	void seek_batch(decompression_context<decompression_settings_type>* const* contexts, const float* sample_times, sample_rounding_policy rounding_policy, uint32_t num_contexts);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Seeks and decompresses every track of multiple context instances in a single call.
+	// Each context is sought to its corresponding sample time and written out with its corresponding writer.
+	// The batch is pipelined: the next context is sought and its segment data prefetched
+	// while the current context is being unpacked, hiding the per clip cache miss latency.
+	// Every context must be initialized and the sample times follow the same rules as 'seek'.
+	template<class decompression_settings_type, class track_writer_type>
+	void decompress_tracks_batch(decompression_context<decompression_settings_type>* const* contexts, const float* sample_times, sample_rounding_policy rounding_policy, track_writer_type* const* writers, uint32_t num_contexts);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Seeks and decompresses the tracks set in the provided mask of multiple context instances in a single call.
+	// This is the access pattern of server side rewind (lag compensation): every context is sampled at an
+	// unrelated time in the past and only a few tracks (e.g. hitbox bones) are needed. Sample times are random
+	// and the segment data of every context is cold, the batch is pipelined like the unmasked version.
+	// The same mask is used for every context and it must cover the tracks of every context.
+	template<class decompression_settings_type, class track_writer_type>
+	void decompress_tracks_batch(decompression_context<decompression_settings_type>* const* contexts, const float* sample_times, sample_rounding_policy rounding_policy, const bitset_description& mask_desc, const uint32_t* track_mask, track_writer_type* const* writers, uint32_t num_contexts);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Decompresses and blends every transform track of two context instances at their current sample time.
+	// The first context is written out as usual and the second context is blended on top as it is unpacked:
+	//    result = lerp(first, second, blend_alpha)
+	// The track writer must implement read_rotation/read_translation/read_scale (see track_writer::supports_read_back) to return the values it
+	// was last written since they are read back before blending. This avoids decompressing the second context
+	// into an intermediate pose and blending them in a separate pass.
+	// Both contexts must be initialized with transform tracks that contain the same number of tracks.
+	template<class decompression_settings_type_a, class decompression_settings_type_b, class track_writer_type>
+	void decompress_blended_tracks(decompression_context<decompression_settings_type_a>& context_a, decompression_context<decompression_settings_type_b>& context_b, float blend_alpha, track_writer_type& writer);
+
+	//////////////////////////////////////////////////////////////////////////
+	// How a pose layer is combined with the layers before it, see decompress_layered_tracks(..).
+	//////////////////////////////////////////////////////////////////////////
+	enum class pose_layer_blend_mode : uint8_t
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// The layer is blended with the previous override layers, relative to their combined weight.
+		// Override layers with weights that sum to one (e.g. blend space corners) yield their weighted average.
+		override_pose,
+
+		//////////////////////////////////////////////////////////////////////////
+		// The layer is an additive clip scaled by its weight and applied on top of the pose of the previous layers.
+		additive,
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A layer evaluated by decompress_layered_tracks(..).
+	//////////////////////////////////////////////////////////////////////////
+	template<class decompression_settings_type>
+	struct pose_layer
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// The context to decompress, it must be initialized with transform tracks and already sought.
+		decompression_context<decompression_settings_type>* context = nullptr;
+
+		//////////////////////////////////////////////////////////////////////////
+		// The weight of the layer, layers with a weight of zero or less are skipped.
+		float weight = 1.0F;
+
+		//////////////////////////////////////////////////////////////////////////
+		// How the layer is combined with the previous layers.
+		pose_layer_blend_mode blend_mode = pose_layer_blend_mode::override_pose;
+
+		//////////////////////////////////////////////////////////////////////////
+		// The additive format of an additive layer, it must match the one used during compression.
+		// Relative additive layers are not supported.
+		additive_clip_format8 additive_format = additive_clip_format8::additive1;
+
+		//////////////////////////////////////////////////////////////////////////
+		// An optional track mask, tracks that aren't set retain the pose of the previous layers.
+		// Null means every track is used.
+		const uint32_t* track_mask = nullptr;
+		bitset_description mask_desc;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Decompresses and combines the transform tracks of several weighted layers at their current sample time.
+	// Layers are evaluated in order and each is combined with the pose of the previous layers as it is unpacked,
+	// group by group, into the single pose held by the track writer: no intermediate pose is written per layer.
+	// The first layer with a positive weight must be an override layer and it is written out as usual.
+	// The track writer must implement read_rotation/read_translation/read_scale (see track_writer::supports_read_back) to return the values it
+	// was last written since they are read back before blending.
+	// Every context must contain the same number of tracks.
+	template<class decompression_settings_type, class track_writer_type>
+	void decompress_layered_tracks(const pose_layer<decompression_settings_type>* layers, uint32_t num_layers, track_writer_type& writer);
+
 	//////////////////////////////////////////////////////////////////////////
 	// Allocates and constructs an instance of the decompression context
 	template<class decompression_settings_type>
@@ -0,0 +1,118 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/compressed_bundle.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/decompression/decompress.h"
+#include "acl/decompression/database/database.h"
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// The immutable binding of a decompression context to a compressed tracks instance
+	// (and optionally its database).
+	//
+	// Initializing a context validates the compressed tracks, looks them up in their
+	// database, and reads their headers. When many threads sample the same clip (e.g. a crowd),
+	// the binding performs this work once and every context, which then only holds the seek
+	// state of its thread, is initialized from it with a plain copy that doesn't touch the
+	// compressed data. The binding is never sought and it can be shared between threads as long
+	// as it isn't initialized again concurrently.
+	//
+	// Contexts do not reference the binding once initialized from it, only the compressed
+	// tracks (and database) it is bound to must outlive them.
+	//////////////////////////////////////////////////////////////////////////
+	template<class decompression_settings_type>
+	class decompression_binding
+	{
+	public:
+		//////////////////////////////////////////////////////////////////////////
+		// An alias to the decompression context type.
+		using context_type = decompression_context<decompression_settings_type>;
+
+		//////////////////////////////////////////////////////////////////////////
+		// An alias to the database settings type.
+		using db_settings_type = typename decompression_settings_type::database_settings_type;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Constructs an unbound instance.
+		decompression_binding() = default;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the compressed tracks this binding is bound to.
+		const compressed_tracks* get_compressed_tracks() const { return m_context.get_compressed_tracks(); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Binds to a particular compressed tracks instance.
+		// Returns whether initialization was successful or not.
+		bool initialize(const compressed_tracks& tracks) { return m_context.initialize(tracks); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Binds to a particular compressed tracks instance and its database instance.
+		// Returns whether initialization was successful or not.
+		bool initialize(const compressed_tracks& tracks, const database_context<db_settings_type>& database) { return m_context.initialize(tracks, database); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Binds to a particular clip contained in a compressed bundle.
+		// Returns whether initialization was successful or not.
+		bool initialize(const compressed_bundle& bundle, uint32_t clip_index) { return m_context.initialize(bundle, clip_index); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if this binding is bound to a compressed tracks instance, false otherwise.
+		bool is_initialized() const { return m_context.is_initialized(); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Resets the binding to its default constructed state.
+		// Contexts previously initialized from it remain valid.
+		void reset() { m_context.reset(); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Sets the looping policy that contexts initialized from this binding start with.
+		// See decompression_context::set_looping_policy(..).
+		void set_looping_policy(sample_looping_policy policy) { m_context.set_looping_policy(policy); }
+
+	private:
+		decompression_binding(const decompression_binding& other) = delete;
+		decompression_binding& operator=(const decompression_binding& other) = delete;
+
+		// A context that is initialized but never sought
+		context_type m_context;
+
+		friend context_type;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
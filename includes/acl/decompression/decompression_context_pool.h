@@ -0,0 +1,119 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/sample_rounding_policy.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/decompression/decompress.h"
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// A pool of decompression contexts stored contiguously in a single allocation.
+	//
+	// When many contexts are updated every frame (e.g. a crowd of characters), allocating
+	// them individually scatters them in memory and every context update is a cache miss
+	// that cannot be predicted. The pool stores them in a cache line aligned array: when
+	// they are updated in order, the access pattern is linear and the hardware prefetcher
+	// hides most of the latency. Sample times and writers are provided as parallel arrays
+	// indexed with the context index.
+	//
+	// Contexts are default constructed and must be initialized individually.
+	//////////////////////////////////////////////////////////////////////////
+	template<class decompression_settings_type>
+	class decompression_context_pool
+	{
+	public:
+		//////////////////////////////////////////////////////////////////////////
+		// An alias to the decompression context type.
+		using context_type = decompression_context<decompression_settings_type>;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Constructs an empty pool.
+		decompression_context_pool();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Destructs the pool and releases its memory.
+		~decompression_context_pool();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Allocates the requested number of contexts.
+		// Returns whether initialization was successful or not.
+		bool initialize(iallocator& allocator, uint32_t num_contexts);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Releases the memory held and resets the pool to its default constructed state.
+		void reset();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if this pool has been initialized, false otherwise.
+		bool is_initialized() const { return m_contexts != nullptr; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of contexts in the pool.
+		uint32_t get_num_contexts() const { return m_num_contexts; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the context at the specified index.
+		context_type& get_context(uint32_t context_index) { ACL_ASSERT(context_index < m_num_contexts, "Invalid context index: %u", context_index); return m_contexts[context_index]; }
+		const context_type& get_context(uint32_t context_index) const { ACL_ASSERT(context_index < m_num_contexts, "Invalid context index: %u", context_index); return m_contexts[context_index]; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Seeks every initialized context to its corresponding sample time.
+		// See 'seek_batch(..)' for details.
+		void seek(const float* sample_times, sample_rounding_policy rounding_policy);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Seeks and decompresses every initialized context with its corresponding writer.
+		// See 'decompress_tracks_batch(..)' for details.
+		template<class track_writer_type>
+		void decompress_tracks(const float* sample_times, sample_rounding_policy rounding_policy, track_writer_type* const* writers);
+
+	private:
+		decompression_context_pool(const decompression_context_pool& other) = delete;
+		decompression_context_pool& operator=(const decompression_context_pool& other) = delete;
+
+		// Contexts are aligned to a cache line boundary
+		static constexpr size_t k_context_alignment = 64;
+
+		iallocator*			m_allocator;
+		context_type*		m_contexts;
+		uint32_t			m_num_contexts;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+#include "acl/decompression/impl/decompression_context_pool.impl.h"
+
+ACL_IMPL_FILE_PRAGMA_POP
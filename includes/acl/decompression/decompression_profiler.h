@@ -0,0 +1,142 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	class compressed_tracks;
+
+	//////////////////////////////////////////////////////////////////////////
+	// The decompression phases reported to a profiler.
+	// Zones can nest: 'seek' contains 'database_tier_lookup' and 'decompress_tracks'
+	// contains the unpacking zones.
+	//////////////////////////////////////////////////////////////////////////
+	enum class decompression_zone : uint8_t
+	{
+		// Covers a whole seek(..) call
+		seek,
+
+		// Finding which database tier holds our key frames during seek(..)
+		database_tier_lookup,
+
+		// Covers a whole decompress_tracks(..) call
+		decompress_tracks,
+
+		// Covers a whole decompress_track(..) call
+		decompress_track,
+
+		// Unpacking constant rotation, translation, or scale sub-tracks
+		unpack_constant_sub_tracks,
+
+		// Unpacking animated rotation, translation, or scale sub-tracks
+		unpack_animated_rotations,
+		unpack_animated_translations,
+		unpack_animated_scales,
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns a string of the zone name.
+	inline const char* get_decompression_zone_name(decompression_zone zone)
+	{
+		switch (zone)
+		{
+		case decompression_zone::seek:							return "seek";
+		case decompression_zone::database_tier_lookup:			return "database_tier_lookup";
+		case decompression_zone::decompress_tracks:				return "decompress_tracks";
+		case decompression_zone::decompress_track:				return "decompress_track";
+		case decompression_zone::unpack_constant_sub_tracks:	return "unpack_constant_sub_tracks";
+		case decompression_zone::unpack_animated_rotations:		return "unpack_animated_rotations";
+		case decompression_zone::unpack_animated_translations:	return "unpack_animated_translations";
+		case decompression_zone::unpack_animated_scales:		return "unpack_animated_scales";
+		default:												return "<Invalid>";
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// A profiler receives begin/end zone events from the decompression code.
+	// To forward them to an engine tracer (e.g. Tracy, Superluminal), derive
+	// from this struct, hide both functions, and set your type as the
+	// 'profiler_type' of your decompression settings.
+	// The compressed tracks being decompressed are provided to attribute the
+	// cost per clip. Events are emitted from the calling thread and every
+	// begin event is matched by an end event for the same zone.
+	//
+	// This default profiler does nothing and is stripped entirely by the compiler.
+	//////////////////////////////////////////////////////////////////////////
+	struct null_decompression_profiler
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Called when a zone begins.
+		// Must be static!
+		static void begin_zone(decompression_zone /*zone*/, const compressed_tracks* /*tracks*/) {}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Called when a zone ends.
+		// Must be static!
+		static void end_zone(decompression_zone /*zone*/, const compressed_tracks* /*tracks*/) {}
+	};
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Emits the begin/end events of a zone for the duration of the scope.
+		template<class profiler_type>
+		class scope_decompression_zone
+		{
+		public:
+			RTM_FORCE_INLINE scope_decompression_zone(decompression_zone zone, const compressed_tracks* tracks)
+				: m_tracks(tracks)
+				, m_zone(zone)
+			{
+				profiler_type::begin_zone(zone, tracks);
+			}
+
+			RTM_FORCE_INLINE ~scope_decompression_zone()
+			{
+				profiler_type::end_zone(m_zone, m_tracks);
+			}
+
+		private:
+			scope_decompression_zone(const scope_decompression_zone&) = delete;
+			scope_decompression_zone& operator=(const scope_decompression_zone&) = delete;
+
+			const compressed_tracks*	m_tracks;
+			decompression_zone			m_zone;
+		};
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
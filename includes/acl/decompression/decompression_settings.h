@@ -29,6 +29,8 @@
 #include "acl/core/track_formats.h"
 #include "acl/core/track_types.h"
 #include "acl/core/impl/compiler_utils.h"
+#include "acl/decompression/decompression_profiler.h"
+#include "acl/decompression/transform_layout.h"
 #include "acl/decompression/database/database_settings.h"
 
 #include <cstdint>
@@ -59,6 +61,14 @@ namespace acl
 
 		// Always normalize rotations
 		always		= 2,
+
+		// Same as lerp_only but interpolated rotations are normalized with a reciprocal square root
+		// estimate refined with one Newton-Raphson step. This is cheaper, most notably on ARM.
+		// Only the SIMD (4 rotations at a time) interpolation of animated rotations uses the estimate,
+		// other code paths behave like lerp_only.
+		// The length of normalized rotations is within 1.0e-6 of 1.0 with SSE/AVX
+		// and within 5.0e-5 of 1.0 with NEON. Other platforms normalize with full precision.
+		approximate	= 3,
 	};
 
 	//////////////////////////////////////////////////////////////////////////
@@ -159,10 +169,56 @@ namespace acl
 		// Must be static constexpr!
 		static constexpr bool is_per_track_rounding_supported() { return true; }
 
+		//////////////////////////////////////////////////////////////////////////
+		// The maximum number of animated sub-tracks per type (rotation, translation, scale)
+		// that the persistent key frame cache can retain.
+		// When playback moves forward in small steps, consecutive calls to decompress_tracks(..)
+		// often interpolate between the same two key frames. When enabled, the decompression
+		// context retains both unpacked key frames and only the interpolation is performed until
+		// the key frames change. The cache lives within the decompression context and uses
+		// 384 bytes for every 4 sub-tracks. Clips with more animated sub-tracks bypass the cache.
+		// Only supported with transform tracks when the database isn't used.
+		// Disabled by default (0).
+		// Must be static constexpr!
+		static constexpr uint32_t get_keyframe_cache_max_num_sub_tracks() { return 0; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not the persistent key frame cache also retains the unpacked segment range
+		// data of the animated rotations. When playback moves forward within a segment, the key
+		// frames change every few calls but the segment range data remains the same and it is then
+		// only unpacked once per segment. The cache uses 96 more bytes for every 4 sub-tracks and
+		// it is bypassed when interpolating between two segments.
+		// Requires the key frame cache, see get_keyframe_cache_max_num_sub_tracks().
+		// Disabled by default.
+		// Must be static constexpr!
+		static constexpr bool is_segment_range_cache_enabled() { return false; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not to accumulate how much compressed data is read when decompressing.
+		// When enabled, every decompress_tracks(writer) call measures the bytes read and the
+		// cache lines touched and accumulates them in the stats of the decompression context.
+		// See 'decompression_stats' for details. This adds a measurable cost to every call
+		// and is meant for profiling only.
+		// Disabled by default.
+		// Must be static constexpr!
+		static constexpr bool is_stats_tracking_enabled() { return false; }
+
 		//////////////////////////////////////////////////////////////////////////
 		// The database settings to use when decompressing.
 		// By default, the database isn't supported.
 		using database_settings_type = null_database_settings;
+
+		//////////////////////////////////////////////////////////////////////////
+		// The profiler that receives begin/end zone events while decompressing.
+		// See 'null_decompression_profiler' for details.
+		// By default, no events are emitted.
+		using profiler_type = null_decompression_profiler;
+
+		//////////////////////////////////////////////////////////////////////////
+		// The transform layout that decompress_tracks(..) is specialized for.
+		// See 'null_transform_layout' for details.
+		// By default, every clip uses the generic code path.
+		using transform_layout_type = null_transform_layout;
 	};
 
 	//////////////////////////////////////////////////////////////////////////
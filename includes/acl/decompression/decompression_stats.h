@@ -0,0 +1,90 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Accumulates how much compressed data is read when decompressing.
+	// Stats are only tracked when 'decompression_settings::is_stats_tracking_enabled()'
+	// is overridden and they are accumulated by every decompress_tracks(writer) call
+	// of transform tracks. Other decompression functions and scalar tracks are not tracked.
+	//
+	// Stats are measured from the memory layout of the sought samples, they assume
+	// every sub-track is unpacked from memory (e.g. the key frame cache is ignored).
+	//////////////////////////////////////////////////////////////////////////
+	struct decompression_stats
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// The number of decompress_tracks(writer) calls tracked.
+		uint64_t num_decompress_calls		= 0;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Bytes read from the clip headers, segment headers, and sub-track types.
+		uint64_t header_bytes_read			= 0;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Bytes read from the constant sub-track samples (or the shared constant pose).
+		uint64_t constant_bytes_read		= 0;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Bytes read from the clip range data.
+		uint64_t clip_range_bytes_read		= 0;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Bytes read from the segment data: per sub-track formats, segment range data,
+		// and animated key frames stored within the compressed tracks.
+		uint64_t segment_bytes_read			= 0;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Bytes read from the animated key frames stored in a database tier.
+		uint64_t database_bytes_read		= 0;
+
+		//////////////////////////////////////////////////////////////////////////
+		// The number of distinct 64 byte cache lines touched, summed over every call.
+		uint64_t num_cache_lines_touched	= 0;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the total number of bytes read.
+		uint64_t get_total_bytes_read() const { return header_bytes_read + constant_bytes_read + clip_range_bytes_read + segment_bytes_read + database_bytes_read; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Resets every stat to zero.
+		void reset() { *this = decompression_stats(); }
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,131 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/error.h"
+#include "acl/core/memory_utils.h"
+#include "acl/core/track_writer.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <rtm/qvvf.h>
+#include <rtm/quatf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Stores a vector to 16 byte aligned memory, bypassing the cache when requested and supported.
+		// Non-temporal stores don't read the cache line for ownership before writing it.
+		template<bool use_non_temporal_stores>
+		RTM_FORCE_INLINE void RTM_SIMD_CALL dense_pose_store(rtm::vector4f_arg0 value, float* output)
+		{
+#if defined(RTM_SSE2_INTRINSICS)
+			if (use_non_temporal_stores)
+			{
+				_mm_stream_ps(output, value);
+				return;
+			}
+#endif
+
+			rtm::vector_store(value, output);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// A track writer that writes every transform directly into a dense array of
+	// 'rtm::qvvf' (or any structure that starts with one), one entry per track.
+	// Every sub-track is written with a single SIMD store at 'output + track_index * stride'
+	// where the stride is in bytes. The output must be 16 byte aligned as must the stride.
+	//
+	// When the pose is consumed by another core (e.g. a job that skins the mesh), non-temporal
+	// stores can be used to write the pose without reading every cache line for ownership first
+	// and without evicting the working set of the decompression. Non-temporal stores are
+	// weakly ordered: call 'flush()' once decompression completes and before the pose is
+	// published to another thread. Reading the pose back (e.g. when blending) is slow with
+	// non-temporal stores as it is no longer in the cache. Only supported with SSE2, regular
+	// stores are used elsewhere.
+	//////////////////////////////////////////////////////////////////////////
+	template<bool use_non_temporal_stores = false>
+	struct dense_qvvf_writer : public track_writer
+	{
+		explicit dense_qvvf_writer(rtm::qvvf* output_, uint32_t stride_ = sizeof(rtm::qvvf))
+			: output(reinterpret_cast<uint8_t*>(output_))
+			, stride(stride_)
+		{
+			ACL_ASSERT(is_aligned_to(output_, 16), "Output must be 16 byte aligned");
+			ACL_ASSERT(is_aligned_to(stride_, 16) && stride_ >= sizeof(rtm::qvvf), "Stride must be a multiple of 16 bytes large enough to hold a transform");
+		}
+
+		rtm::qvvf& get_transform(uint32_t track_index) const { return *reinterpret_cast<rtm::qvvf*>(output + (track_index * stride)); }
+
+		void RTM_SIMD_CALL write_rotation(uint32_t track_index, rtm::quatf_arg0 rotation)
+		{
+			acl_impl::dense_pose_store<use_non_temporal_stores>(rtm::quat_to_vector(rotation), reinterpret_cast<float*>(&get_transform(track_index).rotation));
+		}
+
+		void RTM_SIMD_CALL write_translation(uint32_t track_index, rtm::vector4f_arg0 translation)
+		{
+			acl_impl::dense_pose_store<use_non_temporal_stores>(translation, reinterpret_cast<float*>(&get_transform(track_index).translation));
+		}
+
+		void RTM_SIMD_CALL write_scale(uint32_t track_index, rtm::vector4f_arg0 scale)
+		{
+			acl_impl::dense_pose_store<use_non_temporal_stores>(scale, reinterpret_cast<float*>(&get_transform(track_index).scale));
+		}
+
+		static constexpr bool supports_read_back() { return true; }
+
+		rtm::quatf RTM_SIMD_CALL read_rotation(uint32_t track_index) const { return get_transform(track_index).rotation; }
+		rtm::vector4f RTM_SIMD_CALL read_translation(uint32_t track_index) const { return get_transform(track_index).translation; }
+		rtm::vector4f RTM_SIMD_CALL read_scale(uint32_t track_index) const { return get_transform(track_index).scale; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Makes our non-temporal stores globally visible, call it before publishing the pose to another thread.
+		// Does nothing with regular stores.
+		void flush() const
+		{
+#if defined(RTM_SSE2_INTRINSICS)
+			if (use_non_temporal_stores)
+				_mm_sfence();
+#endif
+		}
+
+		uint8_t* output;
+		uint32_t stride;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
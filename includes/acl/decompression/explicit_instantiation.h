@@ -0,0 +1,119 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/decompression/decompress.h"
+
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////
+// Explicit instantiation of the decompression code
+//
+// The decompression code is instantiated in every translation unit that uses it with a
+// given decompression settings type and track writer type. To build it only once, declare
+// the combinations used in a header included everywhere decompression happens:
+//
+//    ACL_DECLARE_DECOMPRESSION_CONTEXT(my_decompression_settings)
+//    ACL_DECLARE_DECOMPRESSION_TRACK_WRITER(my_decompression_settings, my_track_writer)
+//
+// and instantiate them in a single translation unit:
+//
+//    ACL_INSTANTIATE_DECOMPRESSION_CONTEXT(my_decompression_settings)
+//    ACL_INSTANTIATE_DECOMPRESSION_TRACK_WRITER(my_decompression_settings, my_track_writer)
+//
+// Track writers that support reading back the pose (see track_writer::supports_read_back()) can also
+// declare and instantiate the functions that require it with ACL_DECLARE_DECOMPRESSION_READ_BACK_TRACK_WRITER
+// and ACL_INSTANTIATE_DECOMPRESSION_READ_BACK_TRACK_WRITER.
+//
+// These macros must be used at global scope. Types with commas in their name must be
+// aliased first (e.g. with 'using').
+//
+// Every function remains inline: when optimizations are enabled, the compiler can still
+// instantiate a function where it is called to inline it. Build times improve the most
+// when optimizations are disabled or when inlining is limited (e.g. iteration builds).
+//////////////////////////////////////////////////////////////////////////
+
+// Applies the provided prefix to every instantiation of the decompression context and the functions that only depend on our settings
+#define ACL_IMPL_DECOMPRESSION_CONTEXT_INSTANTIATIONS(prefix, settings_type) \
+	prefix class ::acl::decompression_context<settings_type>; \
+	prefix uint32_t ::acl::initialize_batch<settings_type>(::acl::decompression_context<settings_type>* const*, const ::acl::compressed_tracks* const*, uint32_t); \
+	prefix void ::acl::seek_batch<settings_type>(::acl::decompression_context<settings_type>* const*, const float*, ::acl::sample_rounding_policy, uint32_t);
+
+// Applies the provided prefix to every instantiation of the decompression functions that depend on our settings and track writer
+#define ACL_IMPL_DECOMPRESSION_TRACK_WRITER_INSTANTIATIONS(prefix, settings_type, track_writer_type) \
+	prefix void ::acl::decompression_context<settings_type>::decompress_tracks<track_writer_type>(track_writer_type&); \
+	prefix void ::acl::decompression_context<settings_type>::decompress_tracks<track_writer_type>(const ::acl::track_rounding_table&, track_writer_type&); \
+	prefix void ::acl::decompression_context<settings_type>::decompress_tracks<track_writer_type>(const ::acl::bitset_description&, const uint32_t*, track_writer_type&); \
+	prefix void ::acl::decompression_context<settings_type>::decompress_tracks<track_writer_type>(const ::acl::bitset_description&, const uint32_t*, const uint32_t*, const uint32_t*, track_writer_type&); \
+	prefix void ::acl::decompression_context<settings_type>::decompress_lod_tracks<track_writer_type>(uint32_t, track_writer_type&); \
+	prefix void ::acl::decompression_context<settings_type>::decompress_tracks_at_times<track_writer_type>(::acl::iallocator&, const float*, uint32_t, ::acl::sample_rounding_policy, track_writer_type* const*); \
+	prefix void ::acl::decompression_context<settings_type>::decompress_additive_tracks<track_writer_type>(::acl::additive_clip_format8, const ::rtm::qvvf*, track_writer_type&); \
+	prefix void ::acl::decompression_context<settings_type>::decompress_track<track_writer_type>(uint32_t, track_writer_type&); \
+	prefix void ::acl::decompression_context<settings_type>::decompress_track<track_writer_type>(uint32_t, const ::acl::track_offset_table&, track_writer_type&); \
+	prefix void ::acl::decompression_context<settings_type>::decompress_track_range<track_writer_type>(uint32_t, uint32_t, const ::acl::track_offset_table&, track_writer_type&) const; \
+	prefix void ::acl::decompression_context<settings_type>::decompress_track_delta<track_writer_type>(uint32_t, float, float, ::acl::sample_rounding_policy, track_writer_type&); \
+	prefix void ::acl::decompress_tracks_batch<settings_type, track_writer_type>(::acl::decompression_context<settings_type>* const*, const float*, ::acl::sample_rounding_policy, track_writer_type* const*, uint32_t); \
+	prefix void ::acl::decompress_tracks_batch<settings_type, track_writer_type>(::acl::decompression_context<settings_type>* const*, const float*, ::acl::sample_rounding_policy, const ::acl::bitset_description&, const uint32_t*, track_writer_type* const*, uint32_t);
+
+// Applies the provided prefix to every instantiation of the decompression functions that read back what the track writer was written
+#define ACL_IMPL_DECOMPRESSION_READ_BACK_TRACK_WRITER_INSTANTIATIONS(prefix, settings_type, track_writer_type) \
+	prefix bool ::acl::decompression_context<settings_type>::decompress_tracks_object_space<track_writer_type>(track_writer_type&); \
+	prefix bool ::acl::decompression_context<settings_type>::decompress_skinning_palette<track_writer_type>(const ::rtm::matrix3x4f*, track_writer_type&, ::rtm::matrix3x4f*); \
+	prefix void ::acl::decompress_layered_tracks<settings_type, track_writer_type>(const ::acl::pose_layer<settings_type>*, uint32_t, track_writer_type&);
+
+//////////////////////////////////////////////////////////////////////////
+// Declares that the decompression context for the provided settings is instantiated in another translation unit.
+#define ACL_DECLARE_DECOMPRESSION_CONTEXT(settings_type) \
+	ACL_IMPL_DECOMPRESSION_CONTEXT_INSTANTIATIONS(extern template, settings_type)
+
+//////////////////////////////////////////////////////////////////////////
+// Instantiates the decompression context for the provided settings, use it in a single translation unit.
+#define ACL_INSTANTIATE_DECOMPRESSION_CONTEXT(settings_type) \
+	ACL_IMPL_DECOMPRESSION_CONTEXT_INSTANTIATIONS(template, settings_type)
+
+//////////////////////////////////////////////////////////////////////////
+// Declares that the decompression functions for the provided settings and track writer are instantiated in another translation unit.
+// decompress_blended_tracks(..) depends on two settings types and isn't covered.
+#define ACL_DECLARE_DECOMPRESSION_TRACK_WRITER(settings_type, track_writer_type) \
+	ACL_IMPL_DECOMPRESSION_TRACK_WRITER_INSTANTIATIONS(extern template, settings_type, track_writer_type)
+
+//////////////////////////////////////////////////////////////////////////
+// Instantiates the decompression functions for the provided settings and track writer, use it in a single translation unit.
+#define ACL_INSTANTIATE_DECOMPRESSION_TRACK_WRITER(settings_type, track_writer_type) \
+	ACL_IMPL_DECOMPRESSION_TRACK_WRITER_INSTANTIATIONS(template, settings_type, track_writer_type)
+
+//////////////////////////////////////////////////////////////////////////
+// Declares that the decompression functions that read back the pose (object space, skinning palette, and layers)
+// for the provided settings and track writer are instantiated in another translation unit.
+// The track writer must support reading back the pose, see track_writer::supports_read_back().
+#define ACL_DECLARE_DECOMPRESSION_READ_BACK_TRACK_WRITER(settings_type, track_writer_type) \
+	ACL_IMPL_DECOMPRESSION_READ_BACK_TRACK_WRITER_INSTANTIATIONS(extern template, settings_type, track_writer_type)
+
+//////////////////////////////////////////////////////////////////////////
+// Instantiates the decompression functions that read back the pose for the provided settings and track writer, use it in a single translation unit.
+// The track writer must support reading back the pose, see track_writer::supports_read_back().
+#define ACL_INSTANTIATE_DECOMPRESSION_READ_BACK_TRACK_WRITER(settings_type, track_writer_type) \
+	ACL_IMPL_DECOMPRESSION_READ_BACK_TRACK_WRITER_INSTANTIATIONS(template, settings_type, track_writer_type)
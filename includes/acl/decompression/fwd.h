@@ -26,6 +26,8 @@
 
 #include "acl/version.h"
 
+#include <cstdint>
+
 ////////////////////////////////////////////////////////////////////////////////
 // This header provides forward declarations for all public ACL types.
 // Forward declaring symbols from a 3rd party library is a bad idea, use this
@@ -42,6 +44,11 @@ namespace acl
     struct debug_database_settings;
     struct default_database_settings;
 
+    enum class decompression_zone : uint8_t;
+    struct null_decompression_profiler;
+    struct decompression_stats;
+    struct null_transform_layout;
+
     struct decompression_settings;
     struct debug_scalar_decompression_settings;
     struct default_scalar_decompression_settings;
@@ -57,7 +64,9 @@ namespace acl
     enum class database_stream_request_result;
     template<class database_settings_type> class database_context;
 
+    template<class decompression_settings_type> class decompression_binding;
     template<class decompression_settings_type> class decompression_context;
+    template<class decompression_settings_type> class decompression_context_pool;
 
     ACL_IMPL_VERSION_NAMESPACE_END
 }
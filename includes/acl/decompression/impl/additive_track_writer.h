@@ -0,0 +1,113 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/additive_utils.h"
+#include "acl/core/track_writer.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <rtm/qvvf.h>
+#include <rtm/quatf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Wraps a track writer and applies every additive sub-track value on top of
+		// the provided base pose before it is written out.
+		// Default sub-tracks of an additive clip are the additive identity and they
+		// are always written since they yield the base pose value.
+		// The additive is applied one sub-track at a time as it is written, not on the
+		// groups of 4 unpacked sub-tracks: the groups only hold animated sub-tracks in
+		// SOA form while constant and default sub-tracks are written one at a time, and
+		// a single code path keeps every sub-track kind and additive format consistent.
+		//////////////////////////////////////////////////////////////////////////
+		template<class track_writer_type>
+		struct additive_track_writer final : public track_writer
+		{
+			additive_track_writer(track_writer_type& writer_, additive_clip_format8 additive_format_, const rtm::qvvf* base_pose_)
+				: writer(writer_)
+				, base_pose(base_pose_)
+				, additive_format(additive_format_)
+			{}
+
+			//////////////////////////////////////////////////////////////////////////
+			// Common track writing
+
+			sample_rounding_policy get_rounding_policy(sample_rounding_policy seek_policy, uint32_t track_index) const { return writer.get_rounding_policy(seek_policy, track_index); }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Transform track writing
+
+			// Identity rotation and zero translation, scale uses the default scale of the compressed clip
+			static constexpr default_sub_track_mode get_default_rotation_mode() { return default_sub_track_mode::constant; }
+			static constexpr default_sub_track_mode get_default_translation_mode() { return default_sub_track_mode::constant; }
+			static constexpr default_sub_track_mode get_default_scale_mode() { return default_sub_track_mode::legacy; }
+
+			static constexpr bool skip_all_rotations() { return track_writer_type::skip_all_rotations(); }
+			static constexpr bool skip_all_translations() { return track_writer_type::skip_all_translations(); }
+			static constexpr bool skip_all_scales() { return track_writer_type::skip_all_scales(); }
+
+			bool skip_track_rotation(uint32_t track_index) const { return writer.skip_track_rotation(track_index); }
+			bool skip_track_translation(uint32_t track_index) const { return writer.skip_track_translation(track_index); }
+			bool skip_track_scale(uint32_t track_index) const { return writer.skip_track_scale(track_index); }
+
+			void RTM_SIMD_CALL write_rotation(uint32_t track_index, rtm::quatf_arg0 rotation)
+			{
+				writer.write_rotation(track_index, apply_additive_rotation_to_base(additive_format, base_pose[track_index].rotation, rotation));
+			}
+
+			void RTM_SIMD_CALL write_translation(uint32_t track_index, rtm::vector4f_arg0 translation)
+			{
+				writer.write_translation(track_index, apply_additive_translation_to_base(additive_format, base_pose[track_index], translation));
+			}
+
+			void RTM_SIMD_CALL write_scale(uint32_t track_index, rtm::vector4f_arg0 scale)
+			{
+				writer.write_scale(track_index, apply_additive_scale_to_base(additive_format, base_pose[track_index].scale, scale));
+			}
+
+			// The base pose is applied one rotation at a time
+			static constexpr bool supports_soa_rotation_output() { return false; }
+
+			track_writer_type& writer;
+			const rtm::qvvf* base_pose;
+			additive_clip_format8 additive_format;
+		};
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
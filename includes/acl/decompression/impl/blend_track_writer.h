@@ -0,0 +1,113 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/track_writer.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <rtm/quatf.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Wraps a track writer that already contains the first clip of a blend.
+		// Every value written is blended with the value read back from the wrapped
+		// writer before being written out. Everything else is forwarded to the wrapped writer.
+		//////////////////////////////////////////////////////////////////////////
+		template<class track_writer_type>
+		struct blend_track_writer final : public track_writer
+		{
+			blend_track_writer(track_writer_type& writer_, float blend_alpha_)
+				: writer(writer_)
+				, blend_alpha(blend_alpha_)
+			{}
+
+			//////////////////////////////////////////////////////////////////////////
+			// Common track writing
+
+			sample_rounding_policy get_rounding_policy(sample_rounding_policy seek_policy, uint32_t track_index) const { return writer.get_rounding_policy(seek_policy, track_index); }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Transform track writing
+
+			static constexpr default_sub_track_mode get_default_rotation_mode() { return track_writer_type::get_default_rotation_mode(); }
+			static constexpr default_sub_track_mode get_default_translation_mode() { return track_writer_type::get_default_translation_mode(); }
+			static constexpr default_sub_track_mode get_default_scale_mode() { return track_writer_type::get_default_scale_mode(); }
+
+			rtm::quatf RTM_SIMD_CALL get_constant_default_rotation() const { return writer.get_constant_default_rotation(); }
+			rtm::vector4f RTM_SIMD_CALL get_constant_default_translation() const { return writer.get_constant_default_translation(); }
+			rtm::vector4f RTM_SIMD_CALL get_constant_default_scale() const { return writer.get_constant_default_scale(); }
+
+			rtm::quatf RTM_SIMD_CALL get_variable_default_rotation(uint32_t track_index) const { return writer.get_variable_default_rotation(track_index); }
+			rtm::vector4f RTM_SIMD_CALL get_variable_default_translation(uint32_t track_index) const { return writer.get_variable_default_translation(track_index); }
+			rtm::vector4f RTM_SIMD_CALL get_variable_default_scale(uint32_t track_index) const { return writer.get_variable_default_scale(track_index); }
+
+			static constexpr bool skip_all_rotations() { return track_writer_type::skip_all_rotations(); }
+			static constexpr bool skip_all_translations() { return track_writer_type::skip_all_translations(); }
+			static constexpr bool skip_all_scales() { return track_writer_type::skip_all_scales(); }
+
+			bool skip_track_rotation(uint32_t track_index) const { return writer.skip_track_rotation(track_index); }
+			bool skip_track_translation(uint32_t track_index) const { return writer.skip_track_translation(track_index); }
+			bool skip_track_scale(uint32_t track_index) const { return writer.skip_track_scale(track_index); }
+
+			void RTM_SIMD_CALL write_rotation(uint32_t track_index, rtm::quatf_arg0 rotation)
+			{
+				// quat_lerp picks the shortest path and normalizes
+				writer.write_rotation(track_index, rtm::quat_lerp(writer.read_rotation(track_index), rotation, blend_alpha));
+			}
+
+			void RTM_SIMD_CALL write_translation(uint32_t track_index, rtm::vector4f_arg0 translation)
+			{
+				writer.write_translation(track_index, rtm::vector_lerp(writer.read_translation(track_index), translation, blend_alpha));
+			}
+
+			void RTM_SIMD_CALL write_scale(uint32_t track_index, rtm::vector4f_arg0 scale)
+			{
+				writer.write_scale(track_index, rtm::vector_lerp(writer.read_scale(track_index), scale, blend_alpha));
+			}
+
+			// Rotations must be blended one at a time
+			static constexpr bool supports_soa_rotation_output() { return false; }
+
+			track_writer_type& writer;
+			float blend_alpha;
+		};
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
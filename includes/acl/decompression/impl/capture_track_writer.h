@@ -0,0 +1,90 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/track_writer.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <rtm/qvvf.h>
+#include <rtm/quatf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Captures a single transform track into a local transform.
+		// Default sub-track values come from the wrapped writer but since we need a complete
+		// transform, skipped default sub-tracks are written with their identity value.
+		//////////////////////////////////////////////////////////////////////////
+		template<class track_writer_type>
+		struct capture_track_writer final : public track_writer
+		{
+			explicit capture_track_writer(const track_writer_type& writer_)
+				: writer(writer_)
+				, transform(rtm::qvv_identity())
+			{}
+
+			//////////////////////////////////////////////////////////////////////////
+			// Common track writing
+
+			sample_rounding_policy get_rounding_policy(sample_rounding_policy seek_policy, uint32_t track_index) const { return writer.get_rounding_policy(seek_policy, track_index); }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Transform track writing
+
+			static constexpr default_sub_track_mode get_default_rotation_mode() { return track_writer_type::get_default_rotation_mode() == default_sub_track_mode::skipped ? default_sub_track_mode::constant : track_writer_type::get_default_rotation_mode(); }
+			static constexpr default_sub_track_mode get_default_translation_mode() { return track_writer_type::get_default_translation_mode() == default_sub_track_mode::skipped ? default_sub_track_mode::constant : track_writer_type::get_default_translation_mode(); }
+			static constexpr default_sub_track_mode get_default_scale_mode() { return track_writer_type::get_default_scale_mode() == default_sub_track_mode::skipped ? default_sub_track_mode::legacy : track_writer_type::get_default_scale_mode(); }
+
+			rtm::quatf RTM_SIMD_CALL get_constant_default_rotation() const { return track_writer_type::get_default_rotation_mode() == default_sub_track_mode::skipped ? rtm::quat_identity() : writer.get_constant_default_rotation(); }
+			rtm::vector4f RTM_SIMD_CALL get_constant_default_translation() const { return track_writer_type::get_default_translation_mode() == default_sub_track_mode::skipped ? rtm::vector_zero() : writer.get_constant_default_translation(); }
+			rtm::vector4f RTM_SIMD_CALL get_constant_default_scale() const { return writer.get_constant_default_scale(); }
+
+			rtm::quatf RTM_SIMD_CALL get_variable_default_rotation(uint32_t track_index) const { return writer.get_variable_default_rotation(track_index); }
+			rtm::vector4f RTM_SIMD_CALL get_variable_default_translation(uint32_t track_index) const { return writer.get_variable_default_translation(track_index); }
+			rtm::vector4f RTM_SIMD_CALL get_variable_default_scale(uint32_t track_index) const { return writer.get_variable_default_scale(track_index); }
+
+			void RTM_SIMD_CALL write_rotation(uint32_t /*track_index*/, rtm::quatf_arg0 rotation) { transform.rotation = rotation; }
+			void RTM_SIMD_CALL write_translation(uint32_t /*track_index*/, rtm::vector4f_arg0 translation) { transform.translation = translation; }
+			void RTM_SIMD_CALL write_scale(uint32_t /*track_index*/, rtm::vector4f_arg0 scale) { transform.scale = scale; }
+
+			const track_writer_type& writer;
+			rtm::qvvf transform;
+		};
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -27,7 +27,9 @@
 // Included only once from decompress.h
 
 #include "acl/version.h"
+#include "acl/core/iallocator.h"
 
+#include <algorithm>
 #include <type_traits>
 
 namespace acl
@@ -41,6 +43,21 @@ namespace acl
 		//////////////////////////////////////////////////////////////////////////
 		template<class T>
 		using is_decompression_context = typename std::enable_if<std::is_base_of<acl::decompression_context<typename T::settings_type>, T>::value, std::nullptr_t>::type;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns whether every parent track is stored before its children.
+		// Hierarchies can be converted into object space in a single pass in stored order only when this holds.
+		inline bool are_parent_tracks_stored_first(const uint32_t* parent_track_indices, uint32_t num_tracks)
+		{
+			for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			{
+				const uint32_t parent_track_index = parent_track_indices[track_index];
+				if (parent_track_index != k_invalid_track_index && parent_track_index >= track_index)
+					return false;
+			}
+
+			return true;
+		}
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -48,7 +65,8 @@ namespace acl
 
 	template<class decompression_settings_type>
 	inline decompression_context<decompression_settings_type>::decompression_context()
-		: m_context()
+		: stats_storage_type()
+		, m_context()
 	{
 		m_context.reset();
 
@@ -108,6 +126,27 @@ namespace acl
 		return version_impl_type::template initialize<decompression_settings_type>(m_context, tracks, &database);
 	}
 
+	template<class decompression_settings_type>
+	inline bool decompression_context<decompression_settings_type>::initialize(const compressed_bundle& bundle, uint32_t clip_index)
+	{
+		ACL_ASSERT(clip_index < bundle.get_num_clips(), "Invalid clip index: %u", clip_index);
+		if (clip_index >= bundle.get_num_clips())
+			return false;	// Invalid clip index
+
+		return initialize(*bundle.get_compressed_tracks(clip_index));
+	}
+
+	template<class decompression_settings_type>
+	inline bool decompression_context<decompression_settings_type>::initialize(const decompression_binding<decompression_settings_type>& binding)
+	{
+		ACL_ASSERT(binding.is_initialized(), "Binding is not initialized");
+		if (!binding.is_initialized())
+			return false;	// Binding is not initialized
+
+		acl_impl::copy_binding(m_context, binding.m_context.m_context);
+		return true;
+	}
+
 	template<class decompression_settings_type>
 	inline void decompression_context<decompression_settings_type>::reset()
 	{
@@ -188,6 +227,20 @@ namespace acl
 		return version_impl_type::template is_bound_to(m_context, database);
 	}
 
+	template<class decompression_settings_type>
+	inline bool decompression_context<decompression_settings_type>::set_constant_pose(const unpacked_constant_pose* pose)
+	{
+		ACL_ASSERT(m_context.is_initialized(), "Context is not initialized");
+
+		if (!m_context.is_initialized())
+			return false;	// Context is not initialized
+
+		if (pose != nullptr && !pose->is_bound_to(*m_context.get_compressed_tracks()))
+			return false;	// The pose was built from a different compressed tracks instance
+
+		return acl_impl::bind_constant_rotations(m_context, pose != nullptr ? pose->get_constant_rotations() : nullptr);
+	}
+
 	template<class decompression_settings_type>
 	inline void decompression_context<decompression_settings_type>::set_looping_policy(sample_looping_policy policy)
 	{
@@ -202,6 +255,20 @@ namespace acl
 		return m_context.get_looping_policy();
 	}
 
+	template<class decompression_settings_type>
+	inline void decompression_context<decompression_settings_type>::set_max_quality_tier(quality_tier tier)
+	{
+		ACL_ASSERT(m_context.is_initialized(), "Context is not initialized");
+		version_impl_type::template set_max_quality_tier<decompression_settings_type>(m_context, tier);
+	}
+
+	template<class decompression_settings_type>
+	inline quality_tier decompression_context<decompression_settings_type>::get_max_quality_tier() const
+	{
+		ACL_ASSERT(m_context.is_initialized(), "Context is not initialized");
+		return m_context.get_max_quality_tier();
+	}
+
 	template<class decompression_settings_type>
 	inline void decompression_context<decompression_settings_type>::seek(float sample_time, sample_rounding_policy rounding_policy)
 	{
@@ -215,6 +282,41 @@ namespace acl
 		version_impl_type::template seek<decompression_settings_type>(m_context, sample_time, rounding_policy);
 	}
 
+	template<class decompression_settings_type>
+	inline void decompression_context<decompression_settings_type>::prefetch(float sample_time, sample_rounding_policy rounding_policy)
+	{
+		ACL_ASSERT(m_context.is_initialized(), "Context is not initialized");
+		ACL_ASSERT(rtm::scalar_is_finite(sample_time), "Invalid sample time");
+		ACL_ASSERT(rounding_policy != sample_rounding_policy::per_track || decompression_settings_type::is_per_track_rounding_supported(), "Per track rounding must be enabled");
+
+		if (!m_context.is_initialized())
+			return;	// Context is not initialized
+
+		version_impl_type::template seek<decompression_settings_type>(m_context, sample_time, rounding_policy);
+		version_impl_type::prefetch(m_context);
+	}
+
+	template<class decompression_settings_type>
+	inline void decompression_context<decompression_settings_type>::advance(float delta_time, sample_rounding_policy rounding_policy)
+	{
+		ACL_ASSERT(m_context.is_initialized(), "Context is not initialized");
+
+		if (!m_context.is_initialized())
+			return;	// Context is not initialized
+
+		// If we haven't seeked yet, we start from the beginning
+		const float current_sample_time = rtm::scalar_max(m_context.get_sample_time(), 0.0F);
+		const float sample_time = advance_sample_time(current_sample_time, delta_time, m_context.get_duration(), m_context.get_looping_policy());
+		seek(sample_time, rounding_policy);
+	}
+
+	template<class decompression_settings_type>
+	inline float decompression_context<decompression_settings_type>::get_sample_time() const
+	{
+		ACL_ASSERT(m_context.is_initialized(), "Context is not initialized");
+		return m_context.get_sample_time();
+	}
+
 	template<class decompression_settings_type>
 	template<class track_writer_type>
 	inline void decompression_context<decompression_settings_type>::decompress_tracks(track_writer_type& writer)
@@ -225,7 +327,238 @@ namespace acl
 		if (!m_context.is_initialized())
 			return;	// Context is not initialized
 
+		acl_impl::bind_keyframe_cache(m_context);
+		version_impl_type::template decompress_tracks<decompression_settings_type>(m_context, writer);
+
+		stats_storage_type::template accumulate_stats<decompression_settings_type>(m_context);
+	}
+
+	template<class decompression_settings_type>
+	template<class track_writer_type>
+	inline void decompression_context<decompression_settings_type>::decompress_tracks(const track_rounding_table& rounding_table, track_writer_type& writer)
+	{
+		static_assert(std::is_base_of<track_writer, track_writer_type>::value, "track_writer_type must derive from track_writer");
+		ACL_ASSERT(m_context.is_initialized(), "Context is not initialized");
+
+		if (!m_context.is_initialized())
+			return;	// Context is not initialized
+
+		ACL_ASSERT(rounding_table.is_bound_to(*m_context.get_compressed_tracks()), "Rounding table is bound to a different compressed tracks instance");
+
+		// Fall back to querying the track writer when the table doesn't match our compressed tracks
+		const acl_impl::track_rounding_table_v0* groups = rounding_table.is_bound_to(*m_context.get_compressed_tracks()) ? &rounding_table.get_groups() : nullptr;
+
+		acl_impl::bind_keyframe_cache(m_context);
+		version_impl_type::template decompress_tracks<decompression_settings_type>(m_context, groups, writer);
+
+		stats_storage_type::template accumulate_stats<decompression_settings_type>(m_context);
+	}
+
+	template<class decompression_settings_type>
+	template<class track_writer_type>
+	inline void decompression_context<decompression_settings_type>::decompress_tracks(const bitset_description& mask_desc, const uint32_t* track_mask, track_writer_type& writer)
+	{
+		static_assert(std::is_base_of<track_writer, track_writer_type>::value, "track_writer_type must derive from track_writer");
+		ACL_ASSERT(m_context.is_initialized(), "Context is not initialized");
+		ACL_ASSERT(track_mask != nullptr, "Track mask cannot be null");
+		ACL_ASSERT(mask_desc.get_num_bits() >= m_context.get_compressed_tracks()->get_num_tracks(), "Track mask is too small");
+
+		if (!m_context.is_initialized() || track_mask == nullptr)
+			return;	// Context is not initialized or no mask provided
+
+		acl_impl::masked_track_writer<track_writer_type> masked_writer(writer, mask_desc, track_mask);
+		acl_impl::bind_keyframe_cache(m_context);
+		version_impl_type::template decompress_tracks<decompression_settings_type>(m_context, masked_writer);
+	}
+
+	template<class decompression_settings_type>
+	template<class track_writer_type>
+	inline void decompression_context<decompression_settings_type>::decompress_tracks(const bitset_description& mask_desc, const uint32_t* rotation_mask, const uint32_t* translation_mask, const uint32_t* scale_mask, track_writer_type& writer)
+	{
+		static_assert(std::is_base_of<track_writer, track_writer_type>::value, "track_writer_type must derive from track_writer");
+		ACL_ASSERT(m_context.is_initialized(), "Context is not initialized");
+		ACL_ASSERT(mask_desc.get_num_bits() >= m_context.get_compressed_tracks()->get_num_tracks(), "Sub-track masks are too small");
+
+		if (!m_context.is_initialized())
+			return;	// Context is not initialized
+
+		ACL_ASSERT(m_context.get_compressed_tracks()->get_track_type() == track_type8::qvvf, "Sub-track masks only support transform tracks");
+
+		acl_impl::sub_track_masked_track_writer<track_writer_type> masked_writer(writer, mask_desc, rotation_mask, translation_mask, scale_mask);
+		acl_impl::bind_keyframe_cache(m_context);
+		version_impl_type::template decompress_tracks<decompression_settings_type>(m_context, masked_writer);
+	}
+
+	template<class decompression_settings_type>
+	template<class track_writer_type>
+	inline void decompression_context<decompression_settings_type>::decompress_lod_tracks(uint32_t num_lod_tracks, track_writer_type& writer)
+	{
+		static_assert(std::is_base_of<track_writer, track_writer_type>::value, "track_writer_type must derive from track_writer");
+		ACL_ASSERT(m_context.is_initialized(), "Context is not initialized");
+		ACL_ASSERT(num_lod_tracks <= m_context.get_compressed_tracks()->get_num_tracks(), "Invalid number of LOD tracks: %u", num_lod_tracks);
+
+		if (!m_context.is_initialized())
+			return;	// Context is not initialized
+
+		acl_impl::lod_track_writer<track_writer_type> lod_writer(writer, num_lod_tracks);
+		acl_impl::bind_keyframe_cache(m_context);
+		version_impl_type::template decompress_tracks<decompression_settings_type>(m_context, lod_writer);
+	}
+
+	template<class decompression_settings_type>
+	template<class track_writer_type>
+	inline void decompression_context<decompression_settings_type>::decompress_tracks_at_times(iallocator& allocator, const float* sample_times, uint32_t num_sample_times, sample_rounding_policy rounding_policy, track_writer_type* const* writers)
+	{
+		static_assert(std::is_base_of<track_writer, track_writer_type>::value, "track_writer_type must derive from track_writer");
+		ACL_ASSERT(m_context.is_initialized(), "Context is not initialized");
+		ACL_ASSERT(sample_times != nullptr || num_sample_times == 0, "Sample times cannot be null");
+		ACL_ASSERT(writers != nullptr || num_sample_times == 0, "Writers cannot be null");
+
+		if (!m_context.is_initialized() || num_sample_times == 0)
+			return;	// Context is not initialized or nothing to sample
+
+		uint32_t* sample_order = allocate_type_array<uint32_t>(allocator, num_sample_times);
+		for (uint32_t sample_index = 0; sample_index < num_sample_times; ++sample_index)
+			sample_order[sample_index] = sample_index;
+
+		// Segments and key frames are sorted by time, once our samples are sorted too we walk the
+		// clip linearly: consecutive samples mostly share their segment and its headers, formats, and
+		// range data remain in the cache. When the key frame cache is enabled, samples that interpolate
+		// the same two key frames also reuse them without unpacking.
+		std::sort(sample_order, sample_order + num_sample_times, [sample_times](uint32_t lhs, uint32_t rhs) { return sample_times[lhs] < sample_times[rhs]; });
+
+		for (uint32_t order_index = 0; order_index < num_sample_times; ++order_index)
+		{
+			const uint32_t sample_index = sample_order[order_index];
+
+			seek(sample_times[sample_index], rounding_policy);
+			decompress_tracks(*writers[sample_index]);
+		}
+
+		deallocate_type_array(allocator, sample_order, num_sample_times);
+	}
+
+	template<class decompression_settings_type>
+	template<class track_writer_type>
+	inline void decompression_context<decompression_settings_type>::decompress_additive_tracks(additive_clip_format8 additive_format, const rtm::qvvf* base_pose, track_writer_type& writer)
+	{
+		static_assert(std::is_base_of<track_writer, track_writer_type>::value, "track_writer_type must derive from track_writer");
+		ACL_ASSERT(m_context.is_initialized(), "Context is not initialized");
+		ACL_ASSERT(base_pose != nullptr, "Base pose cannot be null");
+
+		if (!m_context.is_initialized() || base_pose == nullptr)
+			return;	// Context is not initialized or no base pose provided
+
+		ACL_ASSERT(m_context.get_compressed_tracks()->get_track_type() == track_type8::qvvf, "Only transform tracks can be additive");
+
+		acl_impl::additive_track_writer<track_writer_type> additive_writer(writer, additive_format, base_pose);
+		acl_impl::bind_keyframe_cache(m_context);
+		version_impl_type::template decompress_tracks<decompression_settings_type>(m_context, additive_writer);
+	}
+
+	template<class decompression_settings_type>
+	template<class track_writer_type>
+	inline bool decompression_context<decompression_settings_type>::decompress_tracks_object_space(track_writer_type& writer)
+	{
+		static_assert(std::is_base_of<track_writer, track_writer_type>::value, "track_writer_type must derive from track_writer");
+		static_assert(track_writer_type::supports_read_back(), "track_writer_type must read back the values it was written, see track_writer::supports_read_back()");
+		ACL_ASSERT(m_context.is_initialized(), "Context is not initialized");
+
+		if (!m_context.is_initialized())
+			return false;	// Context is not initialized
+
+		const compressed_tracks* tracks = m_context.get_compressed_tracks();
+		ACL_ASSERT(tracks->get_track_type() == track_type8::qvvf, "Only transform tracks can be converted to object space");
+
+		acl_impl::bind_keyframe_cache(m_context);
 		version_impl_type::template decompress_tracks<decompression_settings_type>(m_context, writer);
+
+		const acl_impl::tracks_header& header = acl_impl::get_tracks_header(*tracks);
+		if (!header.get_has_metadata())
+			return false;	// No metadata, we cannot convert to object space
+
+		const acl_impl::optional_metadata_header& metadata_header = acl_impl::get_optional_metadata_header(*tracks);
+		const uint32_t* parent_track_indices = metadata_header.get_parent_track_indices(*tracks);
+		ACL_ASSERT(parent_track_indices != nullptr, "Parent track indices are not stored in the compressed tracks");
+		if (parent_track_indices == nullptr)
+			return false;	// Parent track indices aren't stored
+
+		const uint32_t num_tracks = header.num_tracks;
+		if (!acl_impl::are_parent_tracks_stored_first(parent_track_indices, num_tracks))
+			return false;	// Parents must come first, we leave the tracks in local space
+
+		// Parents come first, when we reach a track its parent has already been converted
+		// and the parent was recently written which means it is likely still in the cache
+		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+		{
+			const uint32_t parent_track_index = parent_track_indices[track_index];
+			if (parent_track_index == k_invalid_track_index)
+				continue;	// Root tracks are already in object space
+
+			const rtm::qvvf local_transform = rtm::qvv_set(writer.read_rotation(track_index), writer.read_translation(track_index), writer.read_scale(track_index));
+			const rtm::qvvf parent_transform = rtm::qvv_set(writer.read_rotation(parent_track_index), writer.read_translation(parent_track_index), writer.read_scale(parent_track_index));
+			const rtm::qvvf object_transform = rtm::qvv_normalize(rtm::qvv_mul(local_transform, parent_transform));
+
+			writer.write_rotation(track_index, object_transform.rotation);
+			writer.write_translation(track_index, object_transform.translation);
+			writer.write_scale(track_index, object_transform.scale);
+		}
+
+		return true;
+	}
+
+	template<class decompression_settings_type>
+	template<class track_writer_type>
+	inline bool decompression_context<decompression_settings_type>::decompress_skinning_palette(const rtm::matrix3x4f* inverse_bind_pose, track_writer_type& writer, rtm::matrix3x4f* out_palette)
+	{
+		static_assert(std::is_base_of<track_writer, track_writer_type>::value, "track_writer_type must derive from track_writer");
+		static_assert(track_writer_type::supports_read_back(), "track_writer_type must read back the values it was written, see track_writer::supports_read_back()");
+		ACL_ASSERT(m_context.is_initialized(), "Context is not initialized");
+		ACL_ASSERT(inverse_bind_pose != nullptr && out_palette != nullptr, "Inverse bind pose and palette cannot be null");
+
+		if (!m_context.is_initialized() || inverse_bind_pose == nullptr || out_palette == nullptr)
+			return false;	// Context is not initialized or no inverse bind pose/palette provided
+
+		const compressed_tracks* tracks = m_context.get_compressed_tracks();
+		ACL_ASSERT(tracks->get_track_type() == track_type8::qvvf, "Only transform tracks can be converted into a skinning palette");
+
+		acl_impl::bind_keyframe_cache(m_context);
+		version_impl_type::template decompress_tracks<decompression_settings_type>(m_context, writer);
+
+		const acl_impl::tracks_header& header = acl_impl::get_tracks_header(*tracks);
+		const uint32_t* parent_track_indices = nullptr;
+		if (header.get_has_metadata())
+		{
+			const acl_impl::optional_metadata_header& metadata_header = acl_impl::get_optional_metadata_header(*tracks);
+			parent_track_indices = metadata_header.get_parent_track_indices(*tracks);
+		}
+
+		const uint32_t num_tracks = header.num_tracks;
+		if (parent_track_indices != nullptr && !acl_impl::are_parent_tracks_stored_first(parent_track_indices, num_tracks))
+			return false;	// Parents must come first, we cannot build the palette
+
+		// Parents come first, when we reach a track its parent object transform is already in the palette
+		// and it was recently written which means it is likely still in the cache
+		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+		{
+			const rtm::qvvf local_transform = rtm::qvv_set(writer.read_rotation(track_index), writer.read_translation(track_index), writer.read_scale(track_index));
+			const rtm::matrix3x4f local_mtx = rtm::matrix_from_qvv(local_transform);
+
+			const uint32_t parent_track_index = parent_track_indices != nullptr ? parent_track_indices[track_index] : k_invalid_track_index;
+			if (parent_track_index == k_invalid_track_index)
+			{
+				out_palette[track_index] = local_mtx;	// Root tracks are already in object space
+				continue;
+			}
+
+			out_palette[track_index] = rtm::matrix_mul(local_mtx, out_palette[parent_track_index]);
+		}
+
+		// Children read the object transform of their parent, we can only apply the inverse bind pose once every track is in object space
+		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			out_palette[track_index] = rtm::matrix_mul(inverse_bind_pose[track_index], out_palette[track_index]);
+
+		return true;
 	}
 
 	template<class decompression_settings_type>
@@ -241,5 +574,323 @@ namespace acl
 		version_impl_type::template decompress_track<decompression_settings_type>(m_context, track_index, writer);
 	}
 
+	template<class decompression_settings_type>
+	template<class track_writer_type>
+	inline void decompression_context<decompression_settings_type>::decompress_track(uint32_t track_index, const track_offset_table& offset_table, track_writer_type& writer)
+	{
+		static_assert(std::is_base_of<track_writer, track_writer_type>::value, "track_writer_type must derive from track_writer");
+		ACL_ASSERT(m_context.is_initialized(), "Context is not initialized");
+
+		if (!m_context.is_initialized())
+			return;	// Context is not initialized
+
+		ACL_ASSERT(offset_table.is_bound_to(*m_context.get_compressed_tracks()), "Offset table is bound to a different compressed tracks instance");
+
+		// Fall back to counting when the table doesn't match our compressed tracks
+		const acl_impl::track_offset_table_v0* offsets = offset_table.is_bound_to(*m_context.get_compressed_tracks()) ? &offset_table.get_offsets() : nullptr;
+		version_impl_type::template decompress_track<decompression_settings_type>(m_context, track_index, offsets, writer);
+	}
+
+	template<class decompression_settings_type>
+	template<class track_writer_type>
+	inline void decompression_context<decompression_settings_type>::decompress_track_range(uint32_t first_track_index, uint32_t num_range_tracks, const track_offset_table& offset_table, track_writer_type& writer) const
+	{
+		static_assert(std::is_base_of<track_writer, track_writer_type>::value, "track_writer_type must derive from track_writer");
+		ACL_ASSERT(m_context.is_initialized(), "Context is not initialized");
+
+		if (!m_context.is_initialized())
+			return;	// Context is not initialized
+
+		ACL_ASSERT(m_context.get_compressed_tracks()->get_track_type() == track_type8::qvvf, "Track ranges only support transform tracks");
+		ACL_ASSERT(offset_table.is_bound_to(*m_context.get_compressed_tracks()), "Offset table is bound to a different compressed tracks instance");
+		ACL_ASSERT((first_track_index % k_track_range_alignment) == 0, "Track ranges must start on a multiple of %u tracks", k_track_range_alignment);
+		ACL_ASSERT(first_track_index + num_range_tracks <= m_context.get_compressed_tracks()->get_num_tracks(), "Invalid track range: [%u, %u)", first_track_index, first_track_index + num_range_tracks);
+
+		if (!offset_table.is_bound_to(*m_context.get_compressed_tracks()))
+			return;	// The range cannot be located without a matching table
+
+		version_impl_type::template decompress_track_range<decompression_settings_type>(m_context, first_track_index, num_range_tracks, offset_table.get_offsets(), writer);
+	}
+
+	template<class decompression_settings_type>
+	template<class track_writer_type>
+	inline void decompression_context<decompression_settings_type>::decompress_track_delta(uint32_t track_index, float sample_time0, float sample_time1, sample_rounding_policy rounding_policy, track_writer_type& writer)
+	{
+		static_assert(std::is_base_of<track_writer, track_writer_type>::value, "track_writer_type must derive from track_writer");
+		ACL_ASSERT(m_context.is_initialized(), "Context is not initialized");
+
+		if (!m_context.is_initialized())
+			return;	// Context is not initialized
+
+		ACL_ASSERT(m_context.get_compressed_tracks()->get_track_type() == track_type8::qvvf, "Only transform tracks support deltas");
+
+		// The context only holds a single sample position (segments, key frames, and interpolation alpha)
+		// and the decompression functions read it directly. Rather than duplicating that state, we seek
+		// twice and decompress the track independently at each sample time. Seeking is cheap and when both
+		// samples land in the same segment, the segment data we touch for the first sample is still in
+		// the cache when we unpack the second.
+		acl_impl::capture_track_writer<track_writer_type> writer0(writer);
+		seek(sample_time0, rounding_policy);
+		version_impl_type::template decompress_track<decompression_settings_type>(m_context, track_index, writer0);
+
+		acl_impl::capture_track_writer<track_writer_type> writer1(writer);
+		seek(sample_time1, rounding_policy);
+		version_impl_type::template decompress_track<decompression_settings_type>(m_context, track_index, writer1);
+
+		const rtm::qvvf delta = convert_to_relative(writer0.transform, writer1.transform);
+
+		writer.write_rotation(track_index, delta.rotation);
+		writer.write_translation(track_index, delta.translation);
+		writer.write_scale(track_index, delta.scale);
+	}
+
+	template<class decompression_settings_type>
+	inline uint32_t initialize_batch(decompression_context<decompression_settings_type>* const* contexts, const compressed_tracks* const* tracks_list, uint32_t num_contexts)
+	{
+		ACL_ASSERT(num_contexts == 0 || (contexts != nullptr && tracks_list != nullptr), "Invalid batch arguments");
+
+		// Initializing reads the headers of the compressed tracks which span two cache lines and are usually cold
+		constexpr uint32_t k_header_prefetch_distance = 4;
+
+		for (uint32_t context_index = 0; context_index < num_contexts && context_index < k_header_prefetch_distance; ++context_index)
+		{
+			const compressed_tracks* tracks = tracks_list[context_index];
+			memory_prefetch(tracks);
+			memory_prefetch(reinterpret_cast<const uint8_t*>(tracks) + 64);
+		}
+
+		// The last context we initialized, it hasn't been sought yet and its state can be copied
+		const decompression_context<decompression_settings_type>* previous_context = nullptr;
+		uint32_t num_initialized = 0;
+
+		for (uint32_t context_index = 0; context_index < num_contexts; ++context_index)
+		{
+			const uint32_t header_prefetch_index = context_index + k_header_prefetch_distance;
+			if (header_prefetch_index < num_contexts)
+			{
+				const compressed_tracks* tracks = tracks_list[header_prefetch_index];
+				memory_prefetch(tracks);
+				memory_prefetch(reinterpret_cast<const uint8_t*>(tracks) + 64);
+			}
+
+			decompression_context<decompression_settings_type>* context = contexts[context_index];
+			const compressed_tracks* tracks = tracks_list[context_index];
+
+			if (previous_context != nullptr && previous_context->get_compressed_tracks() == tracks)
+			{
+				// Same clip as the previous context, it has already been validated and read
+				acl_impl::copy_binding(context->m_context, previous_context->m_context);
+				num_initialized++;
+				continue;
+			}
+
+			previous_context = nullptr;
+
+			if (tracks == nullptr || !context->initialize(*tracks))
+				continue;	// Failed to initialize
+
+			previous_context = context;
+			num_initialized++;
+		}
+
+		return num_initialized;
+	}
+
+	template<class decompression_settings_type>
+	inline void seek_batch(decompression_context<decompression_settings_type>* const* contexts, const float* sample_times, sample_rounding_policy rounding_policy, uint32_t num_contexts)
+	{
+		ACL_ASSERT(num_contexts == 0 || (contexts != nullptr && sample_times != nullptr), "Invalid batch arguments");
+
+		// Seeking first reads the context and then the headers of its compressed tracks, both are usually cold.
+		// We prefetch in two stages: the context is prefetched far ahead and once it is likely in the cache,
+		// we read its compressed tracks pointer to prefetch the headers which span two cache lines.
+		constexpr uint32_t k_context_prefetch_distance = 8;
+		constexpr uint32_t k_header_prefetch_distance = 4;
+
+		for (uint32_t context_index = 0; context_index < num_contexts && context_index < k_context_prefetch_distance; ++context_index)
+			memory_prefetch(contexts[context_index]);
+
+		for (uint32_t context_index = 0; context_index < num_contexts && context_index < k_header_prefetch_distance; ++context_index)
+		{
+			const compressed_tracks* tracks = contexts[context_index]->get_compressed_tracks();
+			memory_prefetch(tracks);
+			memory_prefetch(reinterpret_cast<const uint8_t*>(tracks) + 64);
+		}
+
+		for (uint32_t context_index = 0; context_index < num_contexts; ++context_index)
+		{
+			const uint32_t context_prefetch_index = context_index + k_context_prefetch_distance;
+			if (context_prefetch_index < num_contexts)
+				memory_prefetch(contexts[context_prefetch_index]);
+
+			const uint32_t header_prefetch_index = context_index + k_header_prefetch_distance;
+			if (header_prefetch_index < num_contexts)
+			{
+				// Prefetching a null pointer is harmless if the context isn't initialized
+				const compressed_tracks* tracks = contexts[header_prefetch_index]->get_compressed_tracks();
+				memory_prefetch(tracks);
+				memory_prefetch(reinterpret_cast<const uint8_t*>(tracks) + 64);
+			}
+
+			contexts[context_index]->seek(sample_times[context_index], rounding_policy);
+		}
+	}
+
+	template<class decompression_settings_type, class track_writer_type>
+	inline void decompress_tracks_batch(decompression_context<decompression_settings_type>* const* contexts, const float* sample_times, sample_rounding_policy rounding_policy, track_writer_type* const* writers, uint32_t num_contexts)
+	{
+		static_assert(std::is_base_of<track_writer, track_writer_type>::value, "track_writer_type must derive from track_writer");
+		ACL_ASSERT(num_contexts == 0 || (contexts != nullptr && sample_times != nullptr && writers != nullptr), "Invalid batch arguments");
+
+		if (num_contexts == 0)
+			return;	// Nothing to do
+
+		using context_type = decompression_context<decompression_settings_type>;
+		using version_impl_type = typename context_type::version_impl_type;
+
+		// Seeking touches the headers and figures out where our segment data lives.
+		// We seek one context ahead and prefetch its data before we unpack the current one
+		// so that its cache misses are in flight while we work.
+		contexts[0]->seek(sample_times[0], rounding_policy);
+
+		for (uint32_t context_index = 0; context_index < num_contexts; ++context_index)
+		{
+			const uint32_t next_context_index = context_index + 1;
+			if (next_context_index < num_contexts)
+			{
+				context_type* next_context = contexts[next_context_index];
+				next_context->seek(sample_times[next_context_index], rounding_policy);
+
+				if (next_context->m_context.is_initialized())
+					version_impl_type::prefetch(next_context->m_context);
+			}
+
+			contexts[context_index]->decompress_tracks(*writers[context_index]);
+		}
+	}
+
+	template<class decompression_settings_type, class track_writer_type>
+	inline void decompress_tracks_batch(decompression_context<decompression_settings_type>* const* contexts, const float* sample_times, sample_rounding_policy rounding_policy, const bitset_description& mask_desc, const uint32_t* track_mask, track_writer_type* const* writers, uint32_t num_contexts)
+	{
+		static_assert(std::is_base_of<track_writer, track_writer_type>::value, "track_writer_type must derive from track_writer");
+		ACL_ASSERT(num_contexts == 0 || (contexts != nullptr && sample_times != nullptr && writers != nullptr), "Invalid batch arguments");
+		ACL_ASSERT(track_mask != nullptr, "Track mask cannot be null");
+
+		if (num_contexts == 0 || track_mask == nullptr)
+			return;	// Nothing to do
+
+		using context_type = decompression_context<decompression_settings_type>;
+		using version_impl_type = typename context_type::version_impl_type;
+
+		// Same pipeline as the unmasked version, the next context is sought and prefetched while
+		// we unpack the current one. With random sample times, every seek lands in a cold segment
+		// and overlapping these misses is where most of the time goes.
+		contexts[0]->seek(sample_times[0], rounding_policy);
+
+		for (uint32_t context_index = 0; context_index < num_contexts; ++context_index)
+		{
+			const uint32_t next_context_index = context_index + 1;
+			if (next_context_index < num_contexts)
+			{
+				context_type* next_context = contexts[next_context_index];
+				next_context->seek(sample_times[next_context_index], rounding_policy);
+
+				if (next_context->m_context.is_initialized())
+					version_impl_type::prefetch(next_context->m_context);
+			}
+
+			contexts[context_index]->decompress_tracks(mask_desc, track_mask, *writers[context_index]);
+		}
+	}
+
+	template<class decompression_settings_type_a, class decompression_settings_type_b, class track_writer_type>
+	inline void decompress_blended_tracks(decompression_context<decompression_settings_type_a>& context_a, decompression_context<decompression_settings_type_b>& context_b, float blend_alpha, track_writer_type& writer)
+	{
+		static_assert(std::is_base_of<track_writer, track_writer_type>::value, "track_writer_type must derive from track_writer");
+		static_assert(track_writer_type::supports_read_back(), "track_writer_type must read back the values it was written, see track_writer::supports_read_back()");
+		ACL_ASSERT(context_a.is_initialized() && context_b.is_initialized(), "Contexts are not initialized");
+		ACL_ASSERT(rtm::scalar_is_finite(blend_alpha), "Invalid blend alpha");
+
+		if (!context_a.is_initialized() || !context_b.is_initialized())
+			return;	// Contexts are not initialized
+
+		ACL_ASSERT(context_a.get_compressed_tracks()->get_track_type() == track_type8::qvvf && context_b.get_compressed_tracks()->get_track_type() == track_type8::qvvf, "Only transform tracks can be blended");
+		ACL_ASSERT(context_a.get_compressed_tracks()->get_num_tracks() == context_b.get_compressed_tracks()->get_num_tracks(), "Both contexts must have the same number of tracks");
+
+		// When a single clip contributes, there is nothing to blend
+		if (blend_alpha <= 0.0F)
+		{
+			context_a.decompress_tracks(writer);
+			return;
+		}
+
+		if (blend_alpha >= 1.0F)
+		{
+			context_b.decompress_tracks(writer);
+			return;
+		}
+
+		context_a.decompress_tracks(writer);
+
+		acl_impl::blend_track_writer<track_writer_type> blend_writer(writer, blend_alpha);
+		context_b.decompress_tracks(blend_writer);
+	}
+
+	template<class decompression_settings_type, class track_writer_type>
+	inline void decompress_layered_tracks(const pose_layer<decompression_settings_type>* layers, uint32_t num_layers, track_writer_type& writer)
+	{
+		static_assert(std::is_base_of<track_writer, track_writer_type>::value, "track_writer_type must derive from track_writer");
+		static_assert(track_writer_type::supports_read_back(), "track_writer_type must read back the values it was written, see track_writer::supports_read_back()");
+		ACL_ASSERT(layers != nullptr || num_layers == 0, "Layers must be provided");
+
+		// Combined weight of the override layers so far
+		float override_weight = 0.0F;
+
+		for (uint32_t layer_index = 0; layer_index < num_layers; ++layer_index)
+		{
+			const pose_layer<decompression_settings_type>& layer = layers[layer_index];
+			ACL_ASSERT(layer.context != nullptr && layer.context->is_initialized(), "Layer context is not initialized");
+			ACL_ASSERT(rtm::scalar_is_finite(layer.weight), "Invalid layer weight");
+
+			if (layer.context == nullptr || !layer.context->is_initialized() || layer.weight <= 0.0F)
+				continue;	// Layer does not contribute
+
+			ACL_ASSERT(layer.context->get_compressed_tracks()->get_track_type() == track_type8::qvvf, "Only transform tracks can be layered");
+			ACL_ASSERT(layer_index == 0 || layers[0].context == nullptr || layer.context->get_compressed_tracks()->get_num_tracks() == layers[0].context->get_compressed_tracks()->get_num_tracks(), "Every layer must have the same number of tracks");
+
+			const bool is_additive = layer.blend_mode == pose_layer_blend_mode::additive;
+
+			float blend_alpha;
+			if (is_additive)
+			{
+				ACL_ASSERT(override_weight > 0.0F, "An additive layer must follow an override layer");
+				ACL_ASSERT(layer.additive_format == additive_clip_format8::additive0 || layer.additive_format == additive_clip_format8::additive1, "Unsupported additive layer format");
+				if (override_weight <= 0.0F)
+					continue;	// Nothing to apply it on
+
+				blend_alpha = layer.weight;
+			}
+			else
+			{
+				// Blending each override layer relative to the weight accumulated so far yields their weighted average
+				override_weight += layer.weight;
+				blend_alpha = layer.weight / override_weight;
+			}
+
+			if (!is_additive && blend_alpha >= 1.0F)
+			{
+				// The first contributing layer, nothing to blend with
+				if (layer.track_mask == nullptr)
+					layer.context->decompress_tracks(writer);
+				else
+					layer.context->decompress_tracks(layer.mask_desc, layer.track_mask, writer);
+				continue;
+			}
+
+			acl_impl::layer_track_writer<track_writer_type> layer_writer(writer, blend_alpha, is_additive, layer.additive_format, layer.mask_desc, layer.track_mask);
+			layer.context->decompress_tracks(layer_writer);
+		}
+	}
+
 	ACL_IMPL_VERSION_NAMESPACE_END
 }
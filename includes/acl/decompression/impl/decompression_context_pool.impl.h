@@ -0,0 +1,153 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Included only once from decompression_context_pool.h
+
+#include "acl/version.h"
+#include "acl/core/error.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/memory_utils.h"
+#include "acl/core/track_writer.h"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	template<class decompression_settings_type>
+	inline decompression_context_pool<decompression_settings_type>::decompression_context_pool()
+		: m_allocator(nullptr)
+		, m_contexts(nullptr)
+		, m_num_contexts(0)
+	{
+	}
+
+	template<class decompression_settings_type>
+	inline decompression_context_pool<decompression_settings_type>::~decompression_context_pool()
+	{
+		reset();
+	}
+
+	template<class decompression_settings_type>
+	inline bool decompression_context_pool<decompression_settings_type>::initialize(iallocator& allocator, uint32_t num_contexts)
+	{
+		reset();
+
+		if (num_contexts == 0)
+			return false;	// Nothing to allocate
+
+		const size_t alignment = alignof(context_type) > k_context_alignment ? alignof(context_type) : k_context_alignment;
+
+		m_allocator = &allocator;
+		m_contexts = allocate_type_array_aligned<context_type>(allocator, num_contexts, alignment);
+		m_num_contexts = num_contexts;
+		return true;
+	}
+
+	template<class decompression_settings_type>
+	inline void decompression_context_pool<decompression_settings_type>::reset()
+	{
+		if (m_contexts == nullptr)
+			return;	// Not initialized
+
+		deallocate_type_array(*m_allocator, m_contexts, m_num_contexts);
+
+		m_allocator = nullptr;
+		m_contexts = nullptr;
+		m_num_contexts = 0;
+	}
+
+	template<class decompression_settings_type>
+	inline void decompression_context_pool<decompression_settings_type>::seek(const float* sample_times, sample_rounding_policy rounding_policy)
+	{
+		ACL_ASSERT(m_num_contexts == 0 || sample_times != nullptr, "Invalid sample times");
+
+		// Contexts are contiguous and the hardware prefetcher follows them but it can't
+		// predict where their compressed tracks live, we prefetch their headers ahead
+		constexpr uint32_t k_header_prefetch_distance = 4;
+
+		const uint32_t num_contexts = m_num_contexts;
+		for (uint32_t context_index = 0; context_index < num_contexts; ++context_index)
+		{
+			const uint32_t header_prefetch_index = context_index + k_header_prefetch_distance;
+			if (header_prefetch_index < num_contexts)
+			{
+				// Prefetching a null pointer is harmless if the context isn't initialized
+				const compressed_tracks* tracks = m_contexts[header_prefetch_index].get_compressed_tracks();
+				memory_prefetch(tracks);
+				memory_prefetch(reinterpret_cast<const uint8_t*>(tracks) + 64);
+			}
+
+			context_type& context = m_contexts[context_index];
+			if (context.is_initialized())
+				context.seek(sample_times[context_index], rounding_policy);
+		}
+	}
+
+	template<class decompression_settings_type>
+	template<class track_writer_type>
+	inline void decompression_context_pool<decompression_settings_type>::decompress_tracks(const float* sample_times, sample_rounding_policy rounding_policy, track_writer_type* const* writers)
+	{
+		static_assert(std::is_base_of<track_writer, track_writer_type>::value, "track_writer_type must derive from track_writer");
+		ACL_ASSERT(m_num_contexts == 0 || (sample_times != nullptr && writers != nullptr), "Invalid batch arguments");
+
+		using version_impl_type = typename context_type::version_impl_type;
+
+		const uint32_t num_contexts = m_num_contexts;
+		const auto find_next_initialized_context = [this, num_contexts](uint32_t context_index)
+		{
+			while (context_index < num_contexts && !m_contexts[context_index].is_initialized())
+				context_index++;
+			return context_index;
+		};
+
+		uint32_t context_index = find_next_initialized_context(0);
+		if (context_index >= num_contexts)
+			return;	// Nothing to decompress
+
+		// Like decompress_tracks_batch(..), we seek one context ahead and prefetch its data
+		// before we unpack the current one so that its cache misses are in flight while we work
+		m_contexts[context_index].seek(sample_times[context_index], rounding_policy);
+
+		while (context_index < num_contexts)
+		{
+			const uint32_t next_context_index = find_next_initialized_context(context_index + 1);
+			if (next_context_index < num_contexts)
+			{
+				context_type& next_context = m_contexts[next_context_index];
+				next_context.seek(sample_times[next_context_index], rounding_policy);
+				version_impl_type::prefetch(next_context.m_context);
+			}
+
+			m_contexts[context_index].decompress_tracks(*writers[context_index]);
+			context_index = next_context_index;
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
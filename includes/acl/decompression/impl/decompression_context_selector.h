@@ -27,9 +27,14 @@
 #include "acl/version.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/decompression/impl/scalar_track_decompression.h"
+#include "acl/decompression/impl/transform_keyframe_cache.h"
 #include "acl/decompression/impl/transform_track_decompression.h"
 #include "acl/decompression/impl/universal_track_decompression.h"
 
+#include <rtm/types.h>
+
+#include <cstdint>
+
 ACL_IMPL_FILE_PRAGMA_PUSH
 
 namespace acl
@@ -40,26 +45,85 @@ namespace acl
 	{
 		//////////////////////////////////////////////////////////////////////////
 		// Helper struct to choose the decompression context type based on what tracks we support
-		template<bool supports_scalar_tracks, bool supports_transform_tracks>
+		// The persistent key frame and segment range caches are only supported with transform tracks
+		template<bool supports_scalar_tracks, bool supports_transform_tracks, uint32_t keyframe_cache_max_num_sub_tracks = 0, bool has_segment_range_cache = false>
 		struct persistent_decompression_context_selector {};
 
-		template<>
-		struct persistent_decompression_context_selector<true, false>
+		template<uint32_t keyframe_cache_max_num_sub_tracks, bool has_segment_range_cache>
+		struct persistent_decompression_context_selector<true, false, keyframe_cache_max_num_sub_tracks, has_segment_range_cache>
 		{
 			using type = persistent_scalar_decompression_context_v0;
 		};
 
-		template<>
-		struct persistent_decompression_context_selector<false, true>
+		template<bool has_segment_range_cache>
+		struct persistent_decompression_context_selector<false, true, 0, has_segment_range_cache>
 		{
 			using type = persistent_transform_decompression_context_v0;
 		};
 
-		template<>
-		struct persistent_decompression_context_selector<true, true>
+		template<uint32_t keyframe_cache_max_num_sub_tracks, bool has_segment_range_cache>
+		struct persistent_decompression_context_selector<false, true, keyframe_cache_max_num_sub_tracks, has_segment_range_cache>
+		{
+			using type = persistent_keyframe_cached_transform_decompression_context_v0<keyframe_cache_max_num_sub_tracks, has_segment_range_cache>;
+		};
+
+		template<uint32_t keyframe_cache_max_num_sub_tracks, bool has_segment_range_cache>
+		struct persistent_decompression_context_selector<true, true, keyframe_cache_max_num_sub_tracks, has_segment_range_cache>
 		{
 			using type = persistent_universal_decompression_context;
 		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Binds shared unpacked constant rotations to a context, see unpacked_constant_pose
+		// Only transform tracks support this, returns false otherwise
+		template<class context_type>
+		inline bool bind_constant_rotations(context_type& context, const rtm::quatf* constant_rotations)
+		{
+			(void)context;
+			(void)constant_rotations;
+			return false;
+		}
+
+		inline bool bind_constant_rotations(persistent_transform_decompression_context_v0& context, const rtm::quatf* constant_rotations)
+		{
+			context.constant_rotations = constant_rotations;
+			return true;
+		}
+
+		template<uint32_t max_num_sub_tracks, bool has_segment_range_cache>
+		inline bool bind_constant_rotations(persistent_keyframe_cached_transform_decompression_context_v0<max_num_sub_tracks, has_segment_range_cache>& context, const rtm::quatf* constant_rotations)
+		{
+			context.constant_rotations = constant_rotations;
+			return true;
+		}
+
+		inline bool bind_constant_rotations(persistent_universal_decompression_context& context, const rtm::quatf* constant_rotations)
+		{
+			if (context.scalar.tracks->get_track_type() != track_type8::qvvf)
+				return false;	// Scalar tracks have no constant rotations
+
+			context.transform.constant_rotations = constant_rotations;
+			return true;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Copies the state of an initialized context that has not been sought into another, see decompression_binding
+		template<class context_type>
+		inline void copy_binding(context_type& context, const context_type& binding)
+		{
+			context = binding;
+		}
+
+		template<uint32_t max_num_sub_tracks, bool has_segment_range_cache>
+		inline void copy_binding(persistent_keyframe_cached_transform_decompression_context_v0<max_num_sub_tracks, has_segment_range_cache>& context, const persistent_keyframe_cached_transform_decompression_context_v0<max_num_sub_tracks, has_segment_range_cache>& binding)
+		{
+			// The key frame cache belongs to each context, only the transform context is copied and the cache starts empty
+			static_cast<persistent_transform_decompression_context_v0&>(context) = binding;
+			context.keyframe_cache = nullptr;
+			context.keyframe_cache_storage.tracks = nullptr;
+			context.keyframe_cache_storage.is_valid = 0;
+			context.keyframe_cache_storage.is_segment_range_valid = 0;
+		}
 	}
 
 	ACL_IMPL_VERSION_NAMESPACE_END
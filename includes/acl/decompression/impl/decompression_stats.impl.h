@@ -0,0 +1,284 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Included only once from decompress.h
+
+#include "acl/version.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/error.h"
+#include "acl/core/track_formats.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/impl/compressed_headers.h"
+#include "acl/decompression/decompression_stats.h"
+#include "acl/decompression/impl/transform_decompression_context.h"
+#include "acl/decompression/impl/transform_keyframe_cache.h"
+#include "acl/decompression/impl/universal_track_decompression.h"
+#include "acl/math/quat_packing.h"
+#include "acl/math/vector4_packing.h"
+
+#include <rtm/types.h>
+
+#include <cstdint>
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Tracks the memory ranges read and counts the distinct cache lines they touch.
+		// Ranges can overlap and be added in any order.
+		class memory_range_tracker
+		{
+		public:
+			static constexpr uint32_t k_cache_line_size = 64;
+			static constexpr uint32_t k_max_num_ranges = 16;
+
+			memory_range_tracker() : m_num_ranges(0) {}
+
+			// Adds the range [ptr, ptr + size) and returns its size
+			uint32_t add(const void* ptr, uint32_t size)
+			{
+				if (size == 0)
+					return 0;	// Nothing read
+
+				ACL_ASSERT(m_num_ranges < k_max_num_ranges, "Too many memory ranges");
+				if (m_num_ranges >= k_max_num_ranges)
+					return size;
+
+				const uintptr_t first_line = reinterpret_cast<uintptr_t>(ptr) / k_cache_line_size;
+				const uintptr_t last_line = (reinterpret_cast<uintptr_t>(ptr) + size - 1) / k_cache_line_size;
+
+				// Insertion sort by first cache line, we have very few ranges
+				uint32_t insert_index = m_num_ranges;
+				while (insert_index > 0 && m_first_lines[insert_index - 1] > first_line)
+				{
+					m_first_lines[insert_index] = m_first_lines[insert_index - 1];
+					m_last_lines[insert_index] = m_last_lines[insert_index - 1];
+					insert_index--;
+				}
+
+				m_first_lines[insert_index] = first_line;
+				m_last_lines[insert_index] = last_line;
+				m_num_ranges++;
+
+				return size;
+			}
+
+			// Returns the number of distinct cache lines touched by every range added
+			uint32_t get_num_cache_lines() const
+			{
+				uint32_t num_cache_lines = 0;
+				uintptr_t next_line = 0;	// First line not yet counted
+
+				for (uint32_t range_index = 0; range_index < m_num_ranges; ++range_index)
+				{
+					// Skip the lines already counted by the previous ranges
+					const uintptr_t first_line = m_first_lines[range_index] > next_line ? m_first_lines[range_index] : next_line;
+					const uintptr_t last_line = m_last_lines[range_index];
+
+					if (last_line >= first_line)
+					{
+						num_cache_lines += uint32_t(last_line - first_line + 1);
+						next_line = last_line + 1;
+					}
+				}
+
+				return num_cache_lines;
+			}
+
+		private:
+			uintptr_t m_first_lines[k_max_num_ranges];
+			uintptr_t m_last_lines[k_max_num_ranges];
+			uint32_t m_num_ranges;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Accumulates the bytes read by a decompress_tracks(writer) call from the current seek position.
+		template<class decompression_settings_type>
+		inline void accumulate_decompression_stats_v0(const persistent_transform_decompression_context_v0& context, decompression_stats& stats)
+		{
+			const compressed_tracks* tracks = context.tracks;
+			const tracks_header& header = get_tracks_header(*tracks);
+			if (header.num_tracks == 0 || context.sample_time < 0.0F)
+				return;	// Empty track list or we didn't seek yet, nothing is read
+
+			const transform_tracks_header& transform_header = get_transform_tracks_header(*tracks);
+			const bool has_scale = context.has_scale != 0;
+			const bool has_stripped_keyframes = tracks->has_database() || tracks->has_stripped_keyframes();
+
+			memory_range_tracker ranges;
+
+			// Headers, we read the clip headers, our segment headers, and the sub-track types
+			{
+				const uint8_t* tracks_ptr = reinterpret_cast<const uint8_t*>(tracks);
+				const uint8_t* transform_header_end = reinterpret_cast<const uint8_t*>(&transform_header + 1);
+				stats.header_bytes_read += ranges.add(tracks_ptr, uint32_t(transform_header_end - tracks_ptr));
+
+				// Static poses bind their segment data when initialized and never read the segment headers
+				const uint32_t segment_header_size = has_stripped_keyframes ? uint32_t(sizeof(stripped_segment_header_t)) : uint32_t(sizeof(segment_header));
+				if (!context.is_static_pose)
+					stats.header_bytes_read += ranges.add(context.segment_offsets[0].add_to(tracks), segment_header_size);
+				if (!context.is_static_pose && !context.uses_single_segment)
+					stats.header_bytes_read += ranges.add(context.segment_offsets[1].add_to(tracks), segment_header_size);
+
+				const uint32_t num_sub_track_entries = (header.num_tracks + k_num_sub_tracks_per_packed_entry - 1) / k_num_sub_tracks_per_packed_entry;
+				const uint32_t num_sub_track_types = has_scale ? 3 : 2;
+				stats.header_bytes_read += ranges.add(transform_header.get_sub_track_types(), num_sub_track_entries * num_sub_track_types * uint32_t(sizeof(packed_sub_track_types)));
+			}
+
+			// Constant samples, every one of them is read
+			{
+				const rotation_format8 rotation_format = get_rotation_format<decompression_settings_type>(context.rotation_format);
+				const rotation_format8 packed_format = is_rotation_format_variable(rotation_format) ? get_highest_variant_precision(get_rotation_variant(rotation_format)) : rotation_format;
+				const uint32_t packed_rotation_size = get_packed_rotation_size(packed_format);
+				const uint32_t packed_vector_size = get_packed_vector_size(vector_format8::vector3f_full);
+
+				const uint8_t* constant_data_rotations = transform_header.get_constant_track_data();
+
+				// Quantized constant rotations start with their total size, see get_constant_rotation_group_size(..)
+				const uint32_t constant_rotation_data_size = header.get_has_quantized_constant_rotations() ? unaligned_load<uint32_t>(constant_data_rotations) : (packed_rotation_size * transform_header.num_constant_rotation_samples);
+				const uint8_t* constant_data_translations = constant_data_rotations + constant_rotation_data_size;
+				const uint8_t* constant_data_scales = constant_data_translations + packed_vector_size * transform_header.num_constant_translation_samples;
+
+				if (context.constant_rotations != nullptr)
+					stats.constant_bytes_read += ranges.add(context.constant_rotations, uint32_t(sizeof(rtm::quatf)) * transform_header.num_constant_rotation_samples);
+				else
+					stats.constant_bytes_read += ranges.add(constant_data_rotations, constant_rotation_data_size);
+
+				stats.constant_bytes_read += ranges.add(constant_data_translations, packed_vector_size * transform_header.num_constant_translation_samples);
+
+				if (has_scale)
+					stats.constant_bytes_read += ranges.add(constant_data_scales, packed_vector_size * transform_header.num_constant_scale_samples);
+			}
+
+			if (context.is_static_pose)
+			{
+				// Static poses only contain default and constant sub-tracks, nothing animated is read
+				stats.num_cache_lines_touched += ranges.get_num_cache_lines();
+				stats.num_decompress_calls++;
+				return;
+			}
+
+			// Segment data, the clip range data is stored right before the first segment's data
+			const segment_header& first_segment_header = *transform_header.get_segment_headers();
+			const uint32_t clip_range_data_size = uint32_t(first_segment_header.segment_data) - uint32_t(transform_header.clip_range_data_offset);
+			stats.clip_range_bytes_read += ranges.add(transform_header.get_clip_range_data(), clip_range_data_size);
+
+			const uint32_t num_segments_read = context.uses_single_segment ? 1 : 2;
+			for (uint32_t segment_index = 0; segment_index < 2; ++segment_index)
+			{
+				const segment_header& current_segment_header = *context.segment_offsets[segment_index].add_to(tracks);
+
+				const uint8_t* format_per_track_data;
+				const uint8_t* segment_range_data;
+				const uint8_t* segment_animated_data;
+				transform_header.get_segment_data(current_segment_header, format_per_track_data, segment_range_data, segment_animated_data);
+
+				// Per sub-track formats and segment range data
+				if (segment_index < num_segments_read)
+					stats.segment_bytes_read += ranges.add(format_per_track_data, uint32_t(segment_animated_data - format_per_track_data));
+
+				// Our key frame, it lives either in our segment or in a database tier
+				const uint32_t key_frame_bit_offset = context.key_frame_bit_offsets[segment_index];
+				const uint32_t key_frame_size = ((key_frame_bit_offset % 8) + current_segment_header.animated_pose_bit_size + 7) / 8;
+				const uint8_t* animated_data = context.animated_track_data[segment_index];
+				const uint32_t num_bytes_read = ranges.add(animated_data + (key_frame_bit_offset / 8), key_frame_size);
+
+				if (animated_data != segment_animated_data)
+					stats.database_bytes_read += num_bytes_read;
+				else
+					stats.segment_bytes_read += num_bytes_read;
+			}
+
+			stats.num_cache_lines_touched += ranges.get_num_cache_lines();
+			stats.num_decompress_calls++;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Dispatches to the stats of the context type, scalar tracks are not tracked
+		template<class decompression_settings_type, class context_type>
+		inline void accumulate_decompression_stats(const context_type& context, decompression_stats& stats)
+		{
+			(void)context;
+			(void)stats;
+		}
+
+		template<class decompression_settings_type>
+		inline void accumulate_decompression_stats(const persistent_transform_decompression_context_v0& context, decompression_stats& stats)
+		{
+			accumulate_decompression_stats_v0<decompression_settings_type>(context, stats);
+		}
+
+		template<class decompression_settings_type, uint32_t max_num_sub_tracks, bool has_segment_range_cache>
+		inline void accumulate_decompression_stats(const persistent_keyframe_cached_transform_decompression_context_v0<max_num_sub_tracks, has_segment_range_cache>& context, decompression_stats& stats)
+		{
+			accumulate_decompression_stats_v0<decompression_settings_type>(context, stats);
+		}
+
+		template<class decompression_settings_type>
+		inline void accumulate_decompression_stats(const persistent_universal_decompression_context& context, decompression_stats& stats)
+		{
+			if (context.scalar.tracks->get_track_type() == track_type8::qvvf)
+				accumulate_decompression_stats_v0<decompression_settings_type>(context.transform, stats);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Holds the stats accumulated by a decompression context.
+		// When stats tracking is disabled, the storage is empty and decompression contexts
+		// derive from it to avoid paying for it: every context remains as small as its persistent context.
+		template<bool is_stats_tracking_enabled>
+		struct decompression_stats_storage
+		{
+			const decompression_stats& get_accumulated_stats() const { return stats; }
+			void reset_accumulated_stats() { stats.reset(); }
+
+			template<class decompression_settings_type, class context_type>
+			void accumulate_stats(const context_type& context) { accumulate_decompression_stats<decompression_settings_type>(context, stats); }
+
+			decompression_stats stats;
+		};
+
+		template<>
+		struct decompression_stats_storage<false>
+		{
+			const decompression_stats& get_accumulated_stats() const
+			{
+				// Nothing is ever accumulated, every context shares the same zeroed stats
+				static const decompression_stats k_empty_stats;
+				return k_empty_stats;
+			}
+
+			void reset_accumulated_stats() {}
+
+			template<class decompression_settings_type, class context_type>
+			void accumulate_stats(const context_type& context) { (void)context; }
+		};
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
@@ -29,6 +29,7 @@
 #include "acl/core/compressed_tracks_version.h"
 #include "acl/core/error.h"
 #include "acl/core/interpolation_utils.h"
+#include "acl/core/quality_tiers.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/decompression/database/database.h"
 #include "acl/decompression/impl/scalar_track_decompression.h"
@@ -75,14 +76,29 @@ namespace acl
 			template<class decompression_settings_type, class context_type>
 			RTM_FORCE_INLINE static void set_looping_policy(context_type& context, sample_looping_policy policy) { acl_impl::set_looping_policy_v0<decompression_settings_type>(context, policy); }
 
+			template<class decompression_settings_type, class context_type>
+			RTM_FORCE_INLINE static void set_max_quality_tier(context_type& context, quality_tier tier) { acl_impl::set_max_quality_tier_v0<decompression_settings_type>(context, tier); }
+
 			template<class decompression_settings_type, class context_type>
 			RTM_FORCE_INLINE static void seek(context_type& context, float sample_time, sample_rounding_policy rounding_policy) { acl_impl::seek_v0<decompression_settings_type>(context, sample_time, rounding_policy); }
 
+			template<class context_type>
+			RTM_FORCE_INLINE static void prefetch(const context_type& context) { acl_impl::prefetch_v0(context); }
+
 			template<class decompression_settings_type, class track_writer_type, class context_type>
 			RTM_FORCE_INLINE static void decompress_tracks(context_type& context, track_writer_type& writer) { acl_impl::decompress_tracks_v0<decompression_settings_type>(context, writer); }
 
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_tracks(context_type& context, const acl_impl::track_rounding_table_v0* rounding_table, track_writer_type& writer) { acl_impl::decompress_tracks_v0<decompression_settings_type>(context, rounding_table, writer); }
+
 			template<class decompression_settings_type, class track_writer_type, class context_type>
 			RTM_FORCE_INLINE static void decompress_track(context_type& context, uint32_t track_index, track_writer_type& writer) { acl_impl::decompress_track_v0<decompression_settings_type>(context, track_index, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_track(context_type& context, uint32_t track_index, const acl_impl::track_offset_table_v0* offset_table, track_writer_type& writer) { acl_impl::decompress_track_v0<decompression_settings_type>(context, track_index, offset_table, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_track_range(context_type& context, uint32_t first_track_index, uint32_t num_range_tracks, const acl_impl::track_offset_table_v0& offset_table, track_writer_type& writer) { acl_impl::decompress_track_range_v0<decompression_settings_type>(context, first_track_index, num_range_tracks, offset_table, writer); }
 		};
 
 		//////////////////////////////////////////////////////////////////////////
@@ -108,14 +124,29 @@ namespace acl
 			template<class decompression_settings_type, class context_type>
 			RTM_FORCE_INLINE static void set_looping_policy(context_type& context, sample_looping_policy policy) { acl_impl::set_looping_policy_v0<decompression_settings_type>(context, policy); }
 
+			template<class decompression_settings_type, class context_type>
+			RTM_FORCE_INLINE static void set_max_quality_tier(context_type& context, quality_tier tier) { acl_impl::set_max_quality_tier_v0<decompression_settings_type>(context, tier); }
+
 			template<class decompression_settings_type, class context_type>
 			RTM_FORCE_INLINE static void seek(context_type& context, float sample_time, sample_rounding_policy rounding_policy) { acl_impl::seek_v0<decompression_settings_type>(context, sample_time, rounding_policy); }
 
+			template<class context_type>
+			RTM_FORCE_INLINE static void prefetch(const context_type& context) { acl_impl::prefetch_v0(context); }
+
 			template<class decompression_settings_type, class track_writer_type, class context_type>
 			RTM_FORCE_INLINE static void decompress_tracks(context_type& context, track_writer_type& writer) { acl_impl::decompress_tracks_v0<decompression_settings_type>(context, writer); }
 
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_tracks(context_type& context, const acl_impl::track_rounding_table_v0* rounding_table, track_writer_type& writer) { acl_impl::decompress_tracks_v0<decompression_settings_type>(context, rounding_table, writer); }
+
 			template<class decompression_settings_type, class track_writer_type, class context_type>
 			RTM_FORCE_INLINE static void decompress_track(context_type& context, uint32_t track_index, track_writer_type& writer) { acl_impl::decompress_track_v0<decompression_settings_type>(context, track_index, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_track(context_type& context, uint32_t track_index, const acl_impl::track_offset_table_v0* offset_table, track_writer_type& writer) { acl_impl::decompress_track_v0<decompression_settings_type>(context, track_index, offset_table, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_track_range(context_type& context, uint32_t first_track_index, uint32_t num_range_tracks, const acl_impl::track_offset_table_v0& offset_table, track_writer_type& writer) { acl_impl::decompress_track_range_v0<decompression_settings_type>(context, first_track_index, num_range_tracks, offset_table, writer); }
 		};
 
 		template<>
@@ -138,14 +169,119 @@ namespace acl
 			template<class decompression_settings_type, class context_type>
 			RTM_FORCE_INLINE static void set_looping_policy(context_type& context, sample_looping_policy policy) { acl_impl::set_looping_policy_v0<decompression_settings_type>(context, policy); }
 
+			template<class decompression_settings_type, class context_type>
+			RTM_FORCE_INLINE static void set_max_quality_tier(context_type& context, quality_tier tier) { acl_impl::set_max_quality_tier_v0<decompression_settings_type>(context, tier); }
+
 			template<class decompression_settings_type, class context_type>
 			RTM_FORCE_INLINE static void seek(context_type& context, float sample_time, sample_rounding_policy rounding_policy) { acl_impl::seek_v0<decompression_settings_type>(context, sample_time, rounding_policy); }
 
+			template<class context_type>
+			RTM_FORCE_INLINE static void prefetch(const context_type& context) { acl_impl::prefetch_v0(context); }
+
 			template<class decompression_settings_type, class track_writer_type, class context_type>
 			RTM_FORCE_INLINE static void decompress_tracks(context_type& context, track_writer_type& writer) { acl_impl::decompress_tracks_v0<decompression_settings_type>(context, writer); }
 
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_tracks(context_type& context, const acl_impl::track_rounding_table_v0* rounding_table, track_writer_type& writer) { acl_impl::decompress_tracks_v0<decompression_settings_type>(context, rounding_table, writer); }
+
 			template<class decompression_settings_type, class track_writer_type, class context_type>
 			RTM_FORCE_INLINE static void decompress_track(context_type& context, uint32_t track_index, track_writer_type& writer) { acl_impl::decompress_track_v0<decompression_settings_type>(context, track_index, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_track(context_type& context, uint32_t track_index, const acl_impl::track_offset_table_v0* offset_table, track_writer_type& writer) { acl_impl::decompress_track_v0<decompression_settings_type>(context, track_index, offset_table, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_track_range(context_type& context, uint32_t first_track_index, uint32_t num_range_tracks, const acl_impl::track_offset_table_v0& offset_table, track_writer_type& writer) { acl_impl::decompress_track_range_v0<decompression_settings_type>(context, first_track_index, num_range_tracks, offset_table, writer); }
+		};
+
+		template<>
+		struct decompression_version_selector<compressed_tracks_version16::v02_01_99_2>
+		{
+			static constexpr bool is_version_supported(compressed_tracks_version16 version) { return version == compressed_tracks_version16::v02_01_99_2; }
+
+			template<class decompression_settings_type, class context_type, class database_settings_type>
+			RTM_FORCE_INLINE static bool initialize(context_type& context, const compressed_tracks& tracks, const database_context<database_settings_type>* database) { return acl_impl::initialize_v0<decompression_settings_type>(context, tracks, database); }
+
+			template<class decompression_settings_type, class context_type, class database_settings_type>
+			RTM_FORCE_INLINE static bool relocated(context_type& context, const compressed_tracks& tracks, const database_context<database_settings_type>* database) { return acl_impl::relocated_v0<decompression_settings_type>(context, tracks, database); }
+
+			template<class context_type>
+			RTM_FORCE_INLINE static bool is_bound_to(const context_type& context, const compressed_tracks& tracks) { return acl_impl::is_bound_to_v0(context, tracks); }
+
+			template<class context_type>
+			RTM_FORCE_INLINE static bool is_bound_to(const context_type& context, const compressed_database& database) { return acl_impl::is_bound_to_v0(context, database); }
+
+			template<class decompression_settings_type, class context_type>
+			RTM_FORCE_INLINE static void set_looping_policy(context_type& context, sample_looping_policy policy) { acl_impl::set_looping_policy_v0<decompression_settings_type>(context, policy); }
+
+			template<class decompression_settings_type, class context_type>
+			RTM_FORCE_INLINE static void set_max_quality_tier(context_type& context, quality_tier tier) { acl_impl::set_max_quality_tier_v0<decompression_settings_type>(context, tier); }
+
+			template<class decompression_settings_type, class context_type>
+			RTM_FORCE_INLINE static void seek(context_type& context, float sample_time, sample_rounding_policy rounding_policy) { acl_impl::seek_v0<decompression_settings_type>(context, sample_time, rounding_policy); }
+
+			template<class context_type>
+			RTM_FORCE_INLINE static void prefetch(const context_type& context) { acl_impl::prefetch_v0(context); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_tracks(context_type& context, track_writer_type& writer) { acl_impl::decompress_tracks_v0<decompression_settings_type>(context, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_tracks(context_type& context, const acl_impl::track_rounding_table_v0* rounding_table, track_writer_type& writer) { acl_impl::decompress_tracks_v0<decompression_settings_type>(context, rounding_table, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_track(context_type& context, uint32_t track_index, track_writer_type& writer) { acl_impl::decompress_track_v0<decompression_settings_type>(context, track_index, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_track(context_type& context, uint32_t track_index, const acl_impl::track_offset_table_v0* offset_table, track_writer_type& writer) { acl_impl::decompress_track_v0<decompression_settings_type>(context, track_index, offset_table, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_track_range(context_type& context, uint32_t first_track_index, uint32_t num_range_tracks, const acl_impl::track_offset_table_v0& offset_table, track_writer_type& writer) { acl_impl::decompress_track_range_v0<decompression_settings_type>(context, first_track_index, num_range_tracks, offset_table, writer); }
+		};
+
+		template<>
+		struct decompression_version_selector<compressed_tracks_version16::v02_01_99_3>
+		{
+			static constexpr bool is_version_supported(compressed_tracks_version16 version) { return version == compressed_tracks_version16::v02_01_99_3; }
+
+			template<class decompression_settings_type, class context_type, class database_settings_type>
+			RTM_FORCE_INLINE static bool initialize(context_type& context, const compressed_tracks& tracks, const database_context<database_settings_type>* database) { return acl_impl::initialize_v0<decompression_settings_type>(context, tracks, database); }
+
+			template<class decompression_settings_type, class context_type, class database_settings_type>
+			RTM_FORCE_INLINE static bool relocated(context_type& context, const compressed_tracks& tracks, const database_context<database_settings_type>* database) { return acl_impl::relocated_v0<decompression_settings_type>(context, tracks, database); }
+
+			template<class context_type>
+			RTM_FORCE_INLINE static bool is_bound_to(const context_type& context, const compressed_tracks& tracks) { return acl_impl::is_bound_to_v0(context, tracks); }
+
+			template<class context_type>
+			RTM_FORCE_INLINE static bool is_bound_to(const context_type& context, const compressed_database& database) { return acl_impl::is_bound_to_v0(context, database); }
+
+			template<class decompression_settings_type, class context_type>
+			RTM_FORCE_INLINE static void set_looping_policy(context_type& context, sample_looping_policy policy) { acl_impl::set_looping_policy_v0<decompression_settings_type>(context, policy); }
+
+			template<class decompression_settings_type, class context_type>
+			RTM_FORCE_INLINE static void set_max_quality_tier(context_type& context, quality_tier tier) { acl_impl::set_max_quality_tier_v0<decompression_settings_type>(context, tier); }
+
+			template<class decompression_settings_type, class context_type>
+			RTM_FORCE_INLINE static void seek(context_type& context, float sample_time, sample_rounding_policy rounding_policy) { acl_impl::seek_v0<decompression_settings_type>(context, sample_time, rounding_policy); }
+
+			template<class context_type>
+			RTM_FORCE_INLINE static void prefetch(const context_type& context) { acl_impl::prefetch_v0(context); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_tracks(context_type& context, track_writer_type& writer) { acl_impl::decompress_tracks_v0<decompression_settings_type>(context, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_tracks(context_type& context, const acl_impl::track_rounding_table_v0* rounding_table, track_writer_type& writer) { acl_impl::decompress_tracks_v0<decompression_settings_type>(context, rounding_table, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_track(context_type& context, uint32_t track_index, track_writer_type& writer) { acl_impl::decompress_track_v0<decompression_settings_type>(context, track_index, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_track(context_type& context, uint32_t track_index, const acl_impl::track_offset_table_v0* offset_table, track_writer_type& writer) { acl_impl::decompress_track_v0<decompression_settings_type>(context, track_index, offset_table, writer); }
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			RTM_FORCE_INLINE static void decompress_track_range(context_type& context, uint32_t first_track_index, uint32_t num_range_tracks, const acl_impl::track_offset_table_v0& offset_table, track_writer_type& writer) { acl_impl::decompress_track_range_v0<decompression_settings_type>(context, first_track_index, num_range_tracks, offset_table, writer); }
 		};
 
 		//////////////////////////////////////////////////////////////////////////
@@ -169,6 +305,8 @@ namespace acl
 				case compressed_tracks_version16::v02_00_00:
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
+				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
 					return acl_impl::initialize_v0<decompression_settings_type>(context, tracks, database);
 				default:
 					ACL_ASSERT(false, "Unsupported version");
@@ -185,6 +323,8 @@ namespace acl
 				case compressed_tracks_version16::v02_00_00:
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
+				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
 					return acl_impl::relocated_v0<decompression_settings_type>(context, tracks, database);
 				default:
 					ACL_ASSERT(false, "Unsupported version");
@@ -201,6 +341,8 @@ namespace acl
 				case compressed_tracks_version16::v02_00_00:
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
+				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
 					return acl_impl::is_bound_to_v0(context, tracks);
 				default:
 					ACL_ASSERT(false, "Unsupported version");
@@ -217,6 +359,8 @@ namespace acl
 				case compressed_tracks_version16::v02_00_00:
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
+				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
 					return acl_impl::is_bound_to_v0(context, database);
 				default:
 					ACL_ASSERT(false, "Unsupported version");
@@ -233,6 +377,8 @@ namespace acl
 				case compressed_tracks_version16::v02_00_00:
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
+				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
 					acl_impl::set_looping_policy_v0<decompression_settings_type>(context, policy);
 					break;
 				default:
@@ -241,6 +387,25 @@ namespace acl
 				}
 			}
 
+			template<class decompression_settings_type, class context_type>
+			static void set_max_quality_tier(context_type& context, quality_tier tier)
+			{
+				const compressed_tracks_version16 version = context.get_version();
+				switch (version)
+				{
+				case compressed_tracks_version16::v02_00_00:
+				case compressed_tracks_version16::v02_01_99:
+				case compressed_tracks_version16::v02_01_99_1:
+				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
+					acl_impl::set_max_quality_tier_v0<decompression_settings_type>(context, tier);
+					break;
+				default:
+					ACL_ASSERT(false, "Unsupported version");
+					break;
+				}
+			}
+
 			template<class decompression_settings_type, class context_type>
 			static void seek(context_type& context, float sample_time, sample_rounding_policy rounding_policy)
 			{
@@ -250,6 +415,8 @@ namespace acl
 				case compressed_tracks_version16::v02_00_00:
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
+				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
 					acl_impl::seek_v0<decompression_settings_type>(context, sample_time, rounding_policy);
 					break;
 				default:
@@ -258,6 +425,25 @@ namespace acl
 				}
 			}
 
+			template<class context_type>
+			static void prefetch(const context_type& context)
+			{
+				const compressed_tracks_version16 version = context.get_version();
+				switch (version)
+				{
+				case compressed_tracks_version16::v02_00_00:
+				case compressed_tracks_version16::v02_01_99:
+				case compressed_tracks_version16::v02_01_99_1:
+				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
+					acl_impl::prefetch_v0(context);
+					break;
+				default:
+					ACL_ASSERT(false, "Unsupported version");
+					break;
+				}
+			}
+
 			template<class decompression_settings_type, class track_writer_type, class context_type>
 			static void decompress_tracks(context_type& context, track_writer_type& writer)
 			{
@@ -267,6 +453,8 @@ namespace acl
 				case compressed_tracks_version16::v02_00_00:
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
+				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
 					acl_impl::decompress_tracks_v0<decompression_settings_type>(context, writer);
 					break;
 				default:
@@ -275,6 +463,25 @@ namespace acl
 				}
 			}
 
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			static void decompress_tracks(context_type& context, const acl_impl::track_rounding_table_v0* rounding_table, track_writer_type& writer)
+			{
+				const compressed_tracks_version16 version = context.get_version();
+				switch (version)
+				{
+				case compressed_tracks_version16::v02_00_00:
+				case compressed_tracks_version16::v02_01_99:
+				case compressed_tracks_version16::v02_01_99_1:
+				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
+					acl_impl::decompress_tracks_v0<decompression_settings_type>(context, rounding_table, writer);
+					break;
+				default:
+					ACL_ASSERT(false, "Unsupported version");
+					break;
+				}
+			}
+
 			template<class decompression_settings_type, class track_writer_type, class context_type>
 			static void decompress_track(context_type& context, uint32_t track_index, track_writer_type& writer)
 			{
@@ -284,6 +491,8 @@ namespace acl
 				case compressed_tracks_version16::v02_00_00:
 				case compressed_tracks_version16::v02_01_99:
 				case compressed_tracks_version16::v02_01_99_1:
+				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
 					acl_impl::decompress_track_v0<decompression_settings_type>(context, track_index, writer);
 					break;
 				default:
@@ -291,6 +500,44 @@ namespace acl
 					break;
 				}
 			}
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			static void decompress_track(context_type& context, uint32_t track_index, const acl_impl::track_offset_table_v0* offset_table, track_writer_type& writer)
+			{
+				const compressed_tracks_version16 version = context.get_version();
+				switch (version)
+				{
+				case compressed_tracks_version16::v02_00_00:
+				case compressed_tracks_version16::v02_01_99:
+				case compressed_tracks_version16::v02_01_99_1:
+				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
+					acl_impl::decompress_track_v0<decompression_settings_type>(context, track_index, offset_table, writer);
+					break;
+				default:
+					ACL_ASSERT(false, "Unsupported version");
+					break;
+				}
+			}
+
+			template<class decompression_settings_type, class track_writer_type, class context_type>
+			static void decompress_track_range(context_type& context, uint32_t first_track_index, uint32_t num_range_tracks, const acl_impl::track_offset_table_v0& offset_table, track_writer_type& writer)
+			{
+				const compressed_tracks_version16 version = context.get_version();
+				switch (version)
+				{
+				case compressed_tracks_version16::v02_00_00:
+				case compressed_tracks_version16::v02_01_99:
+				case compressed_tracks_version16::v02_01_99_1:
+				case compressed_tracks_version16::v02_01_99_2:
+				case compressed_tracks_version16::v02_01_99_3:
+					acl_impl::decompress_track_range_v0<decompression_settings_type>(context, first_track_index, num_range_tracks, offset_table, writer);
+					break;
+				default:
+					ACL_ASSERT(false, "Unsupported version");
+					break;
+				}
+			}
 		};
 	}
 
@@ -0,0 +1,193 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/additive_utils.h"
+#include "acl/core/bitset.h"
+#include "acl/core/track_writer.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <rtm/quatf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Wraps a track writer that already contains the pose of the previous layers.
+		// Every value written is combined with the value read back from the wrapped writer:
+		//    override: lerp(pose, value, blend_alpha)
+		//    additive: apply the additive value scaled by blend_alpha on top of the pose
+		// Tracks that aren't set in the optional track mask are skipped.
+		//////////////////////////////////////////////////////////////////////////
+		template<class track_writer_type>
+		struct layer_track_writer final : public track_writer
+		{
+			layer_track_writer(track_writer_type& writer_, float blend_alpha_, bool is_additive_, additive_clip_format8 additive_format_, bitset_description mask_desc_, const uint32_t* track_mask_)
+				: writer(writer_)
+				, track_mask(track_mask_)
+				, mask_desc(mask_desc_)
+				, blend_alpha(blend_alpha_)
+				, is_additive(is_additive_)
+				, additive_format(additive_format_)
+			{}
+
+			bool is_track_used(uint32_t track_index) const { return track_mask == nullptr || bitset_test(track_mask, mask_desc, track_index); }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Common track writing
+
+			sample_rounding_policy get_rounding_policy(sample_rounding_policy seek_policy, uint32_t track_index) const { return writer.get_rounding_policy(seek_policy, track_index); }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Transform track writing
+
+			// Default sub-tracks of an additive layer are the additive identity, see additive_track_writer
+			// Override layers use the defaults of the wrapped writer
+			static constexpr default_sub_track_mode get_default_rotation_mode() { return default_sub_track_mode::variable; }
+			static constexpr default_sub_track_mode get_default_translation_mode() { return default_sub_track_mode::variable; }
+			static constexpr default_sub_track_mode get_default_scale_mode() { return default_sub_track_mode::variable; }
+
+			rtm::quatf RTM_SIMD_CALL get_variable_default_rotation(uint32_t track_index) const
+			{
+				return is_additive ? rtm::quat_identity() : get_wrapped_default_rotation(track_index);
+			}
+
+			rtm::vector4f RTM_SIMD_CALL get_variable_default_translation(uint32_t track_index) const
+			{
+				return is_additive ? rtm::vector_zero() : get_wrapped_default_translation(track_index);
+			}
+
+			rtm::vector4f RTM_SIMD_CALL get_variable_default_scale(uint32_t track_index) const
+			{
+				// Additive1 stores its scale as an offset from one
+				if (is_additive)
+					return additive_format == additive_clip_format8::additive1 ? rtm::vector_zero() : rtm::vector_set(1.0F);
+
+				return get_wrapped_default_scale(track_index);
+			}
+
+			static constexpr bool skip_all_rotations() { return track_writer_type::skip_all_rotations(); }
+			static constexpr bool skip_all_translations() { return track_writer_type::skip_all_translations(); }
+			static constexpr bool skip_all_scales() { return track_writer_type::skip_all_scales(); }
+
+			bool skip_track_rotation(uint32_t track_index) const { return !is_track_used(track_index) || writer.skip_track_rotation(track_index); }
+			bool skip_track_translation(uint32_t track_index) const { return !is_track_used(track_index) || writer.skip_track_translation(track_index); }
+			bool skip_track_scale(uint32_t track_index) const { return !is_track_used(track_index) || writer.skip_track_scale(track_index); }
+
+			void RTM_SIMD_CALL write_rotation(uint32_t track_index, rtm::quatf_arg0 rotation)
+			{
+				const rtm::quatf pose_rotation = writer.read_rotation(track_index);
+
+				// quat_lerp picks the shortest path and normalizes
+				if (is_additive)
+					writer.write_rotation(track_index, apply_additive_rotation_to_base(additive_format, pose_rotation, rtm::quat_lerp(rtm::quat_identity(), rotation, blend_alpha)));
+				else
+					writer.write_rotation(track_index, rtm::quat_lerp(pose_rotation, rotation, blend_alpha));
+			}
+
+			void RTM_SIMD_CALL write_translation(uint32_t track_index, rtm::vector4f_arg0 translation)
+			{
+				const rtm::vector4f pose_translation = writer.read_translation(track_index);
+
+				// Relative additive layers are not supported, their translation does not depend on the rest of the pose
+				if (is_additive)
+					writer.write_translation(track_index, rtm::vector_mul_add(translation, blend_alpha, pose_translation));
+				else
+					writer.write_translation(track_index, rtm::vector_lerp(pose_translation, translation, blend_alpha));
+			}
+
+			void RTM_SIMD_CALL write_scale(uint32_t track_index, rtm::vector4f_arg0 scale)
+			{
+				const rtm::vector4f pose_scale = writer.read_scale(track_index);
+
+				if (is_additive)
+				{
+					// Scale the additive contribution, one is the identity of additive0 and zero the identity of additive1
+					const rtm::vector4f weighted_scale = additive_format == additive_clip_format8::additive1 ? rtm::vector_mul(scale, blend_alpha) : rtm::vector_lerp(rtm::vector_set(1.0F), scale, blend_alpha);
+					writer.write_scale(track_index, apply_additive_scale_to_base(additive_format, pose_scale, weighted_scale));
+				}
+				else
+					writer.write_scale(track_index, rtm::vector_lerp(pose_scale, scale, blend_alpha));
+			}
+
+			// Rotations must be blended one at a time
+			static constexpr bool supports_soa_rotation_output() { return false; }
+
+			track_writer_type& writer;
+			const uint32_t* track_mask;
+			bitset_description mask_desc;
+			float blend_alpha;
+			bool is_additive;
+			additive_clip_format8 additive_format;
+
+		private:
+			// The wrapped writer can use any default mode, resolve it here
+			// Skipped default sub-tracks read back the pose, blending with them leaves it unchanged
+			rtm::quatf RTM_SIMD_CALL get_wrapped_default_rotation(uint32_t track_index) const
+			{
+				switch (track_writer_type::get_default_rotation_mode())
+				{
+				case default_sub_track_mode::constant:	return writer.get_constant_default_rotation();
+				case default_sub_track_mode::variable:	return writer.get_variable_default_rotation(track_index);
+				default:								return writer.read_rotation(track_index);	// Skipped, the pose remains unchanged
+				}
+			}
+
+			rtm::vector4f RTM_SIMD_CALL get_wrapped_default_translation(uint32_t track_index) const
+			{
+				switch (track_writer_type::get_default_translation_mode())
+				{
+				case default_sub_track_mode::constant:	return writer.get_constant_default_translation();
+				case default_sub_track_mode::variable:	return writer.get_variable_default_translation(track_index);
+				default:								return writer.read_translation(track_index);	// Skipped, the pose remains unchanged
+				}
+			}
+
+			rtm::vector4f RTM_SIMD_CALL get_wrapped_default_scale(uint32_t track_index) const
+			{
+				switch (track_writer_type::get_default_scale_mode())
+				{
+				case default_sub_track_mode::constant:	return writer.get_constant_default_scale();
+				case default_sub_track_mode::variable:	return writer.get_variable_default_scale(track_index);
+				case default_sub_track_mode::legacy:	return rtm::vector_set(1.0F);	// Override layers aren't additive
+				default:								return writer.read_scale(track_index);	// Skipped, the pose remains unchanged
+				}
+			}
+		};
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
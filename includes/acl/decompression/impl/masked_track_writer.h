@@ -0,0 +1,319 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/bitset.h"
+#include "acl/core/track_writer.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <rtm/quatf.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Wraps a track writer and skips every track that isn't set in the provided track mask.
+		// Everything else is forwarded to the wrapped writer.
+		//////////////////////////////////////////////////////////////////////////
+		template<class track_writer_type>
+		struct masked_track_writer final : public track_writer
+		{
+			masked_track_writer(track_writer_type& writer_, bitset_description mask_desc_, const uint32_t* track_mask_)
+				: writer(writer_)
+				, track_mask(track_mask_)
+				, mask_desc(mask_desc_)
+			{}
+
+			bool is_track_used(uint32_t track_index) const { return bitset_test(track_mask, mask_desc, track_index); }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Common track writing
+
+			sample_rounding_policy get_rounding_policy(sample_rounding_policy seek_policy, uint32_t track_index) const { return writer.get_rounding_policy(seek_policy, track_index); }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Scalar track writing
+			// Scalar tracks do not support skipping, masked out tracks are unpacked but not written
+
+			void RTM_SIMD_CALL write_float1(uint32_t track_index, rtm::scalarf_arg0 value) { if (is_track_used(track_index)) writer.write_float1(track_index, value); }
+			void RTM_SIMD_CALL write_float2(uint32_t track_index, rtm::vector4f_arg0 value) { if (is_track_used(track_index)) writer.write_float2(track_index, value); }
+			void RTM_SIMD_CALL write_float3(uint32_t track_index, rtm::vector4f_arg0 value) { if (is_track_used(track_index)) writer.write_float3(track_index, value); }
+			void RTM_SIMD_CALL write_float4(uint32_t track_index, rtm::vector4f_arg0 value) { if (is_track_used(track_index)) writer.write_float4(track_index, value); }
+			void RTM_SIMD_CALL write_vector4(uint32_t track_index, rtm::vector4f_arg0 value) { if (is_track_used(track_index)) writer.write_vector4(track_index, value); }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Transform track writing
+
+			static constexpr default_sub_track_mode get_default_rotation_mode() { return track_writer_type::get_default_rotation_mode(); }
+			static constexpr default_sub_track_mode get_default_translation_mode() { return track_writer_type::get_default_translation_mode(); }
+			static constexpr default_sub_track_mode get_default_scale_mode() { return track_writer_type::get_default_scale_mode(); }
+
+			rtm::quatf RTM_SIMD_CALL get_constant_default_rotation() const { return writer.get_constant_default_rotation(); }
+			rtm::vector4f RTM_SIMD_CALL get_constant_default_translation() const { return writer.get_constant_default_translation(); }
+			rtm::vector4f RTM_SIMD_CALL get_constant_default_scale() const { return writer.get_constant_default_scale(); }
+
+			rtm::quatf RTM_SIMD_CALL get_variable_default_rotation(uint32_t track_index) const { return writer.get_variable_default_rotation(track_index); }
+			rtm::vector4f RTM_SIMD_CALL get_variable_default_translation(uint32_t track_index) const { return writer.get_variable_default_translation(track_index); }
+			rtm::vector4f RTM_SIMD_CALL get_variable_default_scale(uint32_t track_index) const { return writer.get_variable_default_scale(track_index); }
+
+			static constexpr bool skip_all_rotations() { return track_writer_type::skip_all_rotations(); }
+			static constexpr bool skip_all_translations() { return track_writer_type::skip_all_translations(); }
+			static constexpr bool skip_all_scales() { return track_writer_type::skip_all_scales(); }
+
+			bool skip_track_rotation(uint32_t track_index) const { return !is_track_used(track_index) || writer.skip_track_rotation(track_index); }
+			bool skip_track_translation(uint32_t track_index) const { return !is_track_used(track_index) || writer.skip_track_translation(track_index); }
+			bool skip_track_scale(uint32_t track_index) const { return !is_track_used(track_index) || writer.skip_track_scale(track_index); }
+
+			void RTM_SIMD_CALL write_rotation(uint32_t track_index, rtm::quatf_arg0 rotation) { writer.write_rotation(track_index, rotation); }
+			void RTM_SIMD_CALL write_translation(uint32_t track_index, rtm::vector4f_arg0 translation) { writer.write_translation(track_index, translation); }
+			void RTM_SIMD_CALL write_scale(uint32_t track_index, rtm::vector4f_arg0 scale) { writer.write_scale(track_index, scale); }
+
+			// SOA output cannot honor the track mask, rotations are always written one at a time
+			static constexpr bool supports_soa_rotation_output() { return false; }
+
+			track_writer_type& writer;
+			const uint32_t* track_mask;
+			bitset_description mask_desc;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Wraps a transform track writer and skips every sub-track that isn't set in its sub-track mask.
+		// Each sub-track kind has its own mask and a null mask keeps every sub-track of that kind.
+		// Only transform tracks are supported.
+		//////////////////////////////////////////////////////////////////////////
+		template<class track_writer_type>
+		struct sub_track_masked_track_writer final : public track_writer
+		{
+			sub_track_masked_track_writer(track_writer_type& writer_, bitset_description mask_desc_, const uint32_t* rotation_mask_, const uint32_t* translation_mask_, const uint32_t* scale_mask_)
+				: writer(writer_)
+				, rotation_mask(rotation_mask_)
+				, translation_mask(translation_mask_)
+				, scale_mask(scale_mask_)
+				, mask_desc(mask_desc_)
+			{}
+
+			bool is_sub_track_used(const uint32_t* sub_track_mask, uint32_t track_index) const { return sub_track_mask == nullptr || bitset_test(sub_track_mask, mask_desc, track_index); }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Common track writing
+
+			sample_rounding_policy get_rounding_policy(sample_rounding_policy seek_policy, uint32_t track_index) const { return writer.get_rounding_policy(seek_policy, track_index); }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Transform track writing
+
+			static constexpr default_sub_track_mode get_default_rotation_mode() { return track_writer_type::get_default_rotation_mode(); }
+			static constexpr default_sub_track_mode get_default_translation_mode() { return track_writer_type::get_default_translation_mode(); }
+			static constexpr default_sub_track_mode get_default_scale_mode() { return track_writer_type::get_default_scale_mode(); }
+
+			rtm::quatf RTM_SIMD_CALL get_constant_default_rotation() const { return writer.get_constant_default_rotation(); }
+			rtm::vector4f RTM_SIMD_CALL get_constant_default_translation() const { return writer.get_constant_default_translation(); }
+			rtm::vector4f RTM_SIMD_CALL get_constant_default_scale() const { return writer.get_constant_default_scale(); }
+
+			rtm::quatf RTM_SIMD_CALL get_variable_default_rotation(uint32_t track_index) const { return writer.get_variable_default_rotation(track_index); }
+			rtm::vector4f RTM_SIMD_CALL get_variable_default_translation(uint32_t track_index) const { return writer.get_variable_default_translation(track_index); }
+			rtm::vector4f RTM_SIMD_CALL get_variable_default_scale(uint32_t track_index) const { return writer.get_variable_default_scale(track_index); }
+
+			// The compile time skip flags of the wrapped writer still strip the code entirely, the masks only add a runtime check
+			static constexpr bool skip_all_rotations() { return track_writer_type::skip_all_rotations(); }
+			static constexpr bool skip_all_translations() { return track_writer_type::skip_all_translations(); }
+			static constexpr bool skip_all_scales() { return track_writer_type::skip_all_scales(); }
+
+			bool skip_track_rotation(uint32_t track_index) const { return !is_sub_track_used(rotation_mask, track_index) || writer.skip_track_rotation(track_index); }
+			bool skip_track_translation(uint32_t track_index) const { return !is_sub_track_used(translation_mask, track_index) || writer.skip_track_translation(track_index); }
+			bool skip_track_scale(uint32_t track_index) const { return !is_sub_track_used(scale_mask, track_index) || writer.skip_track_scale(track_index); }
+
+			void RTM_SIMD_CALL write_rotation(uint32_t track_index, rtm::quatf_arg0 rotation) { writer.write_rotation(track_index, rotation); }
+			void RTM_SIMD_CALL write_translation(uint32_t track_index, rtm::vector4f_arg0 translation) { writer.write_translation(track_index, translation); }
+			void RTM_SIMD_CALL write_scale(uint32_t track_index, rtm::vector4f_arg0 scale) { writer.write_scale(track_index, scale); }
+
+			// SOA output cannot honor the rotation mask, rotations are always written one at a time
+			static constexpr bool supports_soa_rotation_output() { return false; }
+
+			track_writer_type& writer;
+			const uint32_t* rotation_mask;
+			const uint32_t* translation_mask;
+			const uint32_t* scale_mask;
+			bitset_description mask_desc;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Wraps a track writer and only keeps the tracks that precede an LOD boundary in output order.
+		// Decompression stops once the packed sub-track entries of those tracks have been unpacked.
+		// Tracks past the boundary that share the last entry are unpacked but not written.
+		//////////////////////////////////////////////////////////////////////////
+		template<class track_writer_type>
+		struct lod_track_writer final : public track_writer
+		{
+			lod_track_writer(track_writer_type& writer_, uint32_t num_lod_tracks_)
+				: writer(writer_)
+				, num_lod_tracks(num_lod_tracks_)
+			{}
+
+			bool is_track_used(uint32_t track_index) const { return track_index < num_lod_tracks; }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Common track writing
+
+			sample_rounding_policy get_rounding_policy(sample_rounding_policy seek_policy, uint32_t track_index) const { return writer.get_rounding_policy(seek_policy, track_index); }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Scalar track writing
+			// Scalar tracks do not stop early, tracks past the LOD are unpacked but not written
+
+			void RTM_SIMD_CALL write_float1(uint32_t track_index, rtm::scalarf_arg0 value) { if (is_track_used(track_index)) writer.write_float1(track_index, value); }
+			void RTM_SIMD_CALL write_float2(uint32_t track_index, rtm::vector4f_arg0 value) { if (is_track_used(track_index)) writer.write_float2(track_index, value); }
+			void RTM_SIMD_CALL write_float3(uint32_t track_index, rtm::vector4f_arg0 value) { if (is_track_used(track_index)) writer.write_float3(track_index, value); }
+			void RTM_SIMD_CALL write_float4(uint32_t track_index, rtm::vector4f_arg0 value) { if (is_track_used(track_index)) writer.write_float4(track_index, value); }
+			void RTM_SIMD_CALL write_vector4(uint32_t track_index, rtm::vector4f_arg0 value) { if (is_track_used(track_index)) writer.write_vector4(track_index, value); }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Transform track writing
+
+			static constexpr default_sub_track_mode get_default_rotation_mode() { return track_writer_type::get_default_rotation_mode(); }
+			static constexpr default_sub_track_mode get_default_translation_mode() { return track_writer_type::get_default_translation_mode(); }
+			static constexpr default_sub_track_mode get_default_scale_mode() { return track_writer_type::get_default_scale_mode(); }
+
+			rtm::quatf RTM_SIMD_CALL get_constant_default_rotation() const { return writer.get_constant_default_rotation(); }
+			rtm::vector4f RTM_SIMD_CALL get_constant_default_translation() const { return writer.get_constant_default_translation(); }
+			rtm::vector4f RTM_SIMD_CALL get_constant_default_scale() const { return writer.get_constant_default_scale(); }
+
+			rtm::quatf RTM_SIMD_CALL get_variable_default_rotation(uint32_t track_index) const { return writer.get_variable_default_rotation(track_index); }
+			rtm::vector4f RTM_SIMD_CALL get_variable_default_translation(uint32_t track_index) const { return writer.get_variable_default_translation(track_index); }
+			rtm::vector4f RTM_SIMD_CALL get_variable_default_scale(uint32_t track_index) const { return writer.get_variable_default_scale(track_index); }
+
+			static constexpr bool skip_all_rotations() { return track_writer_type::skip_all_rotations(); }
+			static constexpr bool skip_all_translations() { return track_writer_type::skip_all_translations(); }
+			static constexpr bool skip_all_scales() { return track_writer_type::skip_all_scales(); }
+
+			bool skip_track_rotation(uint32_t track_index) const { return !is_track_used(track_index) || writer.skip_track_rotation(track_index); }
+			bool skip_track_translation(uint32_t track_index) const { return !is_track_used(track_index) || writer.skip_track_translation(track_index); }
+			bool skip_track_scale(uint32_t track_index) const { return !is_track_used(track_index) || writer.skip_track_scale(track_index); }
+
+			void RTM_SIMD_CALL write_rotation(uint32_t track_index, rtm::quatf_arg0 rotation) { writer.write_rotation(track_index, rotation); }
+			void RTM_SIMD_CALL write_translation(uint32_t track_index, rtm::vector4f_arg0 translation) { writer.write_translation(track_index, translation); }
+			void RTM_SIMD_CALL write_scale(uint32_t track_index, rtm::vector4f_arg0 scale) { writer.write_scale(track_index, scale); }
+
+			// SOA output cannot honor the LOD boundary within a group, rotations are always written one at a time
+			static constexpr bool supports_soa_rotation_output() { return false; }
+
+			track_writer_type& writer;
+			uint32_t num_lod_tracks;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Wraps a track writer and offsets every track index by the first track of a range.
+		// Decompression sees the range as a track list of its own that starts at index 0
+		// and stops once the tracks of the range have been unpacked, like an LOD boundary.
+		// Tracks past the range that share its last entry are unpacked but not written.
+		// Only transform tracks are supported.
+		//////////////////////////////////////////////////////////////////////////
+		template<class track_writer_type>
+		struct track_range_writer final : public track_writer
+		{
+			track_range_writer(track_writer_type& writer_, uint32_t first_track_index_, uint32_t num_range_tracks_)
+				: writer(writer_)
+				, first_track_index(first_track_index_)
+				, num_range_tracks(num_range_tracks_)
+			{}
+
+			bool is_track_used(uint32_t track_index) const { return track_index < num_range_tracks; }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Common track writing
+
+			sample_rounding_policy get_rounding_policy(sample_rounding_policy seek_policy, uint32_t track_index) const { return writer.get_rounding_policy(seek_policy, first_track_index + track_index); }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Transform track writing
+
+			static constexpr default_sub_track_mode get_default_rotation_mode() { return track_writer_type::get_default_rotation_mode(); }
+			static constexpr default_sub_track_mode get_default_translation_mode() { return track_writer_type::get_default_translation_mode(); }
+			static constexpr default_sub_track_mode get_default_scale_mode() { return track_writer_type::get_default_scale_mode(); }
+
+			rtm::quatf RTM_SIMD_CALL get_constant_default_rotation() const { return writer.get_constant_default_rotation(); }
+			rtm::vector4f RTM_SIMD_CALL get_constant_default_translation() const { return writer.get_constant_default_translation(); }
+			rtm::vector4f RTM_SIMD_CALL get_constant_default_scale() const { return writer.get_constant_default_scale(); }
+
+			rtm::quatf RTM_SIMD_CALL get_variable_default_rotation(uint32_t track_index) const { return writer.get_variable_default_rotation(first_track_index + track_index); }
+			rtm::vector4f RTM_SIMD_CALL get_variable_default_translation(uint32_t track_index) const { return writer.get_variable_default_translation(first_track_index + track_index); }
+			rtm::vector4f RTM_SIMD_CALL get_variable_default_scale(uint32_t track_index) const { return writer.get_variable_default_scale(first_track_index + track_index); }
+
+			static constexpr bool skip_all_rotations() { return track_writer_type::skip_all_rotations(); }
+			static constexpr bool skip_all_translations() { return track_writer_type::skip_all_translations(); }
+			static constexpr bool skip_all_scales() { return track_writer_type::skip_all_scales(); }
+
+			bool skip_track_rotation(uint32_t track_index) const { return !is_track_used(track_index) || writer.skip_track_rotation(first_track_index + track_index); }
+			bool skip_track_translation(uint32_t track_index) const { return !is_track_used(track_index) || writer.skip_track_translation(first_track_index + track_index); }
+			bool skip_track_scale(uint32_t track_index) const { return !is_track_used(track_index) || writer.skip_track_scale(first_track_index + track_index); }
+
+			void RTM_SIMD_CALL write_rotation(uint32_t track_index, rtm::quatf_arg0 rotation) { writer.write_rotation(first_track_index + track_index, rotation); }
+			void RTM_SIMD_CALL write_translation(uint32_t track_index, rtm::vector4f_arg0 translation) { writer.write_translation(first_track_index + track_index, translation); }
+			void RTM_SIMD_CALL write_scale(uint32_t track_index, rtm::vector4f_arg0 scale) { writer.write_scale(first_track_index + track_index, scale); }
+
+			// A range can start within a group of animated rotations, rotations are always written one at a time
+			static constexpr bool supports_soa_rotation_output() { return false; }
+
+			track_writer_type& writer;
+			uint32_t first_track_index;
+			uint32_t num_range_tracks;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of tracks to decompress, every track unless the writer stops at an LOD or range boundary
+		template<class track_writer_type>
+		constexpr uint32_t get_num_lod_tracks(const track_writer_type& /*writer*/, uint32_t num_tracks) { return num_tracks; }
+
+		template<class track_writer_type>
+		inline uint32_t get_num_lod_tracks(const lod_track_writer<track_writer_type>& writer, uint32_t num_tracks) { return std::min<uint32_t>(writer.num_lod_tracks, num_tracks); }
+
+		template<class track_writer_type>
+		inline uint32_t get_num_lod_tracks(const track_range_writer<track_writer_type>& writer, uint32_t num_tracks) { return std::min<uint32_t>(writer.num_range_tracks, num_tracks); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Type trait to detect when a track writer is a masked_track_writer
+		template<class track_writer_type>
+		struct is_masked_track_writer : std::false_type {};
+
+		template<class track_writer_type>
+		struct is_masked_track_writer<masked_track_writer<track_writer_type>> : std::true_type {};
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
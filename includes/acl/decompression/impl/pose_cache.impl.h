@@ -0,0 +1,316 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Included only once from pose_cache.h
+
+#include "acl/version.h"
+#include "acl/core/error.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/memory_utils.h"
+#include "acl/core/track_types.h"
+#include "acl/core/track_writer.h"
+
+#include <rtm/quatf.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		enum pose_cache_value_flags : uint8_t
+		{
+			pose_cache_rotation = 0x01,		// Also used by scalar tracks
+			pose_cache_translation = 0x02,
+			pose_cache_scale = 0x04,
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Captures a whole pose into a pose cache slot.
+		// Default sub-track modes and values come from the wrapped writer. Every track
+		// is captured even if the wrapped writer skips it since other writers might not.
+		//////////////////////////////////////////////////////////////////////////
+		template<class track_writer_type>
+		struct pose_cache_capture_writer final : public track_writer
+		{
+			pose_cache_capture_writer(const track_writer_type& writer_, rtm::vector4f* values_, uint8_t* value_flags_)
+				: writer(writer_)
+				, values(values_)
+				, value_flags(value_flags_)
+			{}
+
+			//////////////////////////////////////////////////////////////////////////
+			// Common track writing
+
+			sample_rounding_policy get_rounding_policy(sample_rounding_policy seek_policy, uint32_t track_index) const { return writer.get_rounding_policy(seek_policy, track_index); }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Scalar track writing
+
+			void RTM_SIMD_CALL write_float1(uint32_t track_index, rtm::scalarf_arg0 value) { write_value(track_index, 0, pose_cache_rotation, rtm::vector_set(rtm::scalar_cast(value))); }
+			void RTM_SIMD_CALL write_float2(uint32_t track_index, rtm::vector4f_arg0 value) { write_value(track_index, 0, pose_cache_rotation, value); }
+			void RTM_SIMD_CALL write_float3(uint32_t track_index, rtm::vector4f_arg0 value) { write_value(track_index, 0, pose_cache_rotation, value); }
+			void RTM_SIMD_CALL write_float4(uint32_t track_index, rtm::vector4f_arg0 value) { write_value(track_index, 0, pose_cache_rotation, value); }
+			void RTM_SIMD_CALL write_vector4(uint32_t track_index, rtm::vector4f_arg0 value) { write_value(track_index, 0, pose_cache_rotation, value); }
+
+			//////////////////////////////////////////////////////////////////////////
+			// Transform track writing
+
+			static constexpr default_sub_track_mode get_default_rotation_mode() { return track_writer_type::get_default_rotation_mode(); }
+			static constexpr default_sub_track_mode get_default_translation_mode() { return track_writer_type::get_default_translation_mode(); }
+			static constexpr default_sub_track_mode get_default_scale_mode() { return track_writer_type::get_default_scale_mode(); }
+
+			rtm::quatf RTM_SIMD_CALL get_constant_default_rotation() const { return writer.get_constant_default_rotation(); }
+			rtm::vector4f RTM_SIMD_CALL get_constant_default_translation() const { return writer.get_constant_default_translation(); }
+			rtm::vector4f RTM_SIMD_CALL get_constant_default_scale() const { return writer.get_constant_default_scale(); }
+
+			rtm::quatf RTM_SIMD_CALL get_variable_default_rotation(uint32_t track_index) const { return writer.get_variable_default_rotation(track_index); }
+			rtm::vector4f RTM_SIMD_CALL get_variable_default_translation(uint32_t track_index) const { return writer.get_variable_default_translation(track_index); }
+			rtm::vector4f RTM_SIMD_CALL get_variable_default_scale(uint32_t track_index) const { return writer.get_variable_default_scale(track_index); }
+
+			void RTM_SIMD_CALL write_rotation(uint32_t track_index, rtm::quatf_arg0 rotation) { write_value(track_index, 0, pose_cache_rotation, rtm::quat_to_vector(rotation)); }
+			void RTM_SIMD_CALL write_translation(uint32_t track_index, rtm::vector4f_arg0 translation) { write_value(track_index, 1, pose_cache_translation, translation); }
+			void RTM_SIMD_CALL write_scale(uint32_t track_index, rtm::vector4f_arg0 scale) { write_value(track_index, 2, pose_cache_scale, scale); }
+
+			void RTM_SIMD_CALL write_value(uint32_t track_index, uint32_t sub_track_index, uint8_t flag, rtm::vector4f_arg0 value)
+			{
+				values[(track_index * 3) + sub_track_index] = value;
+				value_flags[track_index] |= flag;
+			}
+
+			const track_writer_type& writer;
+			rtm::vector4f* values;
+			uint8_t* value_flags;
+		};
+
+		template<class track_writer_type>
+		inline void write_cached_pose(track_type8 track_type, uint32_t num_tracks, const rtm::vector4f* values, const uint8_t* value_flags, track_writer_type& writer)
+		{
+			if (track_type == track_type8::qvvf)
+			{
+				for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+				{
+					const rtm::vector4f* track_values = values + (track_index * 3);
+					const uint8_t flags = value_flags[track_index];
+
+					if ((flags & pose_cache_rotation) != 0 && !track_writer_type::skip_all_rotations() && !writer.skip_track_rotation(track_index))
+						writer.write_rotation(track_index, rtm::vector_to_quat(track_values[0]));
+
+					if ((flags & pose_cache_translation) != 0 && !track_writer_type::skip_all_translations() && !writer.skip_track_translation(track_index))
+						writer.write_translation(track_index, track_values[1]);
+
+					if ((flags & pose_cache_scale) != 0 && !track_writer_type::skip_all_scales() && !writer.skip_track_scale(track_index))
+						writer.write_scale(track_index, track_values[2]);
+				}
+			}
+			else
+			{
+				for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+				{
+					if ((value_flags[track_index] & pose_cache_rotation) == 0)
+						continue;
+
+					const rtm::vector4f value = values[track_index * 3];
+
+					switch (track_type)
+					{
+					case track_type8::float1f:
+						writer.write_float1(track_index, rtm::scalar_set(rtm::vector_get_x(value)));
+						break;
+					case track_type8::float2f:
+						writer.write_float2(track_index, value);
+						break;
+					case track_type8::float3f:
+						writer.write_float3(track_index, value);
+						break;
+					case track_type8::float4f:
+						writer.write_float4(track_index, value);
+						break;
+					case track_type8::vector4f:
+						writer.write_vector4(track_index, value);
+						break;
+					default:
+						ACL_ASSERT(false, "Unsupported track type");
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	template<class decompression_settings_type>
+	inline pose_cache<decompression_settings_type>::pose_cache()
+		: m_allocator(nullptr)
+		, m_keys(nullptr)
+		, m_values(nullptr)
+		, m_value_flags(nullptr)
+		, m_num_slots(0)
+		, m_max_num_tracks(0)
+		, m_quantization_rate(0.0F)
+		, m_stats()
+	{
+	}
+
+	template<class decompression_settings_type>
+	inline pose_cache<decompression_settings_type>::~pose_cache()
+	{
+		reset();
+	}
+
+	template<class decompression_settings_type>
+	inline bool pose_cache<decompression_settings_type>::initialize(iallocator& allocator, uint32_t max_num_poses, uint32_t max_num_tracks, float quantization_rate)
+	{
+		reset();
+
+		if (max_num_poses == 0 || max_num_tracks == 0 || max_num_poses > (1U << 31))
+			return false;	// Nothing to allocate or too large
+
+		if (!(quantization_rate >= 0.0F))
+			return false;	// Invalid quantization rate, must be positive or zero
+
+		uint32_t num_slots = 1;
+		while (num_slots < max_num_poses)
+			num_slots *= 2;
+
+		m_allocator = &allocator;
+		m_keys = allocate_type_array<cache_key>(allocator, num_slots);
+		m_values = allocate_type_array_aligned<rtm::vector4f>(allocator, size_t(num_slots) * max_num_tracks * k_num_values_per_track, alignof(rtm::vector4f));
+		m_value_flags = allocate_type_array<uint8_t>(allocator, size_t(num_slots) * max_num_tracks);
+		m_num_slots = num_slots;
+		m_max_num_tracks = max_num_tracks;
+		m_quantization_rate = quantization_rate;
+		m_stats = pose_cache_stats();
+
+		clear();
+		return true;
+	}
+
+	template<class decompression_settings_type>
+	inline void pose_cache<decompression_settings_type>::reset()
+	{
+		if (m_keys == nullptr)
+			return;	// Not initialized
+
+		deallocate_type_array(*m_allocator, m_keys, m_num_slots);
+		deallocate_type_array(*m_allocator, m_values, size_t(m_num_slots) * m_max_num_tracks * k_num_values_per_track);
+		deallocate_type_array(*m_allocator, m_value_flags, size_t(m_num_slots) * m_max_num_tracks);
+
+		m_allocator = nullptr;
+		m_keys = nullptr;
+		m_values = nullptr;
+		m_value_flags = nullptr;
+		m_num_slots = 0;
+		m_max_num_tracks = 0;
+		m_quantization_rate = 0.0F;
+		m_stats = pose_cache_stats();
+	}
+
+	template<class decompression_settings_type>
+	inline void pose_cache<decompression_settings_type>::clear()
+	{
+		for (uint32_t slot_index = 0; slot_index < m_num_slots; ++slot_index)
+			m_keys[slot_index].tracks = nullptr;
+	}
+
+	template<class decompression_settings_type>
+	inline uint32_t pose_cache<decompression_settings_type>::get_slot_index(const compressed_tracks* tracks, float sample_time, sample_rounding_policy rounding_policy) const
+	{
+		uint32_t sample_time_bits;
+		std::memcpy(&sample_time_bits, &sample_time, sizeof(float));
+
+		// Mix the key bits with a 64 bit finalizer, the slot index is taken from the high bits
+		uint64_t hash = uint64_t(reinterpret_cast<uintptr_t>(tracks));
+		hash ^= (uint64_t(sample_time_bits) << 8) | uint64_t(rounding_policy);
+		hash ^= hash >> 33;
+		hash *= 0xFF51AFD7ED558CCDULL;
+		hash ^= hash >> 33;
+		hash *= 0xC4CEB9FE1A85EC53ULL;
+		hash ^= hash >> 33;
+
+		return uint32_t(hash) & (m_num_slots - 1);
+	}
+
+	template<class decompression_settings_type>
+	template<class track_writer_type>
+	inline bool pose_cache<decompression_settings_type>::decompress_tracks(context_type& context, float sample_time, sample_rounding_policy rounding_policy, track_writer_type& writer)
+	{
+		static_assert(std::is_base_of<track_writer, track_writer_type>::value, "track_writer_type must derive from track_writer");
+		ACL_ASSERT(is_initialized(), "Pose cache is not initialized");
+		ACL_ASSERT(context.is_initialized(), "Context is not initialized");
+
+		const compressed_tracks* tracks = context.get_compressed_tracks();
+		const uint32_t num_tracks = tracks->get_num_tracks();
+
+		if (m_quantization_rate > 0.0F)
+			sample_time = std::round(sample_time * m_quantization_rate) / m_quantization_rate;
+
+		if (num_tracks > m_max_num_tracks)
+		{
+			// Too many tracks to fit, bypass the cache
+			m_stats.num_misses++;
+			context.seek(sample_time, rounding_policy);
+			context.decompress_tracks(writer);
+			return false;
+		}
+
+		const uint32_t slot_index = get_slot_index(tracks, sample_time, rounding_policy);
+		cache_key& key = m_keys[slot_index];
+		rtm::vector4f* values = m_values + (size_t(slot_index) * m_max_num_tracks * k_num_values_per_track);
+		uint8_t* value_flags = m_value_flags + (size_t(slot_index) * m_max_num_tracks);
+
+		const bool is_hit = key.tracks == tracks && key.sample_time == sample_time && key.rounding_policy == rounding_policy;
+		if (is_hit)
+			m_stats.num_hits++;
+		else
+		{
+			m_stats.num_misses++;
+			if (key.tracks != nullptr)
+				m_stats.num_evictions++;
+
+			std::memset(value_flags, 0, num_tracks);
+
+			acl_impl::pose_cache_capture_writer<track_writer_type> capture_writer(writer, values, value_flags);
+			context.seek(sample_time, rounding_policy);
+			context.decompress_tracks(capture_writer);
+
+			key.tracks = tracks;
+			key.sample_time = sample_time;
+			key.rounding_policy = rounding_policy;
+		}
+
+		acl_impl::write_cached_pose(tracks->get_track_type(), num_tracks, values, value_flags, writer);
+		return is_hit;
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
@@ -25,12 +25,15 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "acl/version.h"
+#include "acl/core/bit_manip_utils.h"
 #include "acl/core/compressed_tracks.h"
 #include "acl/core/compressed_tracks_version.h"
 #include "acl/core/interpolation_utils.h"
+#include "acl/core/quality_tiers.h"
 #include "acl/core/track_writer.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/impl/variable_bit_rates.h"
+#include "acl/decompression/decompression_profiler.h"
 #include "acl/decompression/database/database.h"
 #include "acl/math/scalar_packing.h"
 #include "acl/math/vector4_packing.h"
@@ -62,29 +65,47 @@ namespace acl
 			// Only member used to detect if we are initialized, must be first
 			const compressed_tracks* tracks;						//   0 |   0
 
+			// Database context, optional
+			const database_context_v0* db;							//   4 |   8
+
 			// Cached hash of the bound compressed track instance
-			uint32_t tracks_hash;									//   4 |   8
+			uint32_t tracks_hash;									//   8 |  16
+
+			// Cached hash of the bound database instance, if any
+			uint32_t db_hash;										//  12 |  20
 
 			// Only used when the wrap loop policy isn't supported
-			float duration;											//   8 |  12
+			float duration;											//  16 |  24
 
 			// Seeking related data
-			float interpolation_alpha;								//  12 |  16
-			float sample_time;										//  16 |  20
+			float interpolation_alpha;								//  20 |  28
+			float sample_time;										//  24 |  32
+
+			uint32_t key_frame_bit_offsets[2];						//  28 |  36	// Variable quantization, relative to the data of their tier
+			uint32_t key_frame_data_offsets[2];						//  36 |  44	// Only when streamed, relative to the bulk data of their tier
+			uint32_t segment_range_offsets[2];						//  44 |  52	// Only when segmented, relative to the segment range values
 
-			uint32_t key_frame_bit_offsets[2];						//  20 |  24	// Variable quantization
+			// 4 bits per key frame with the tier they live in (0 = clip, 1 = medium importance, k_num_database_tiers = low importance)
+			uint8_t key_frame_tiers;								//  52 |  60
 
-			uint8_t looping_policy;									//  28 |  32
-			uint8_t rounding_policy;								//  29 |  33
+			// The highest quality tier we sample from, see quality_tier
+			uint8_t max_quality_tier;								//  53 |  61
 
-			uint8_t padding_tail[sizeof(void*) == 4 ? 34 : 30];		//  30 |  34
+			// Bits 0-3: the looping policy, bits 4-7: the rounding policy
+			uint8_t policies;										//  54 |  62
+
+			uint8_t padding_tail[sizeof(void*) == 4 ? 9 : 1];		//  55 |  63
 
 			//////////////////////////////////////////////////////////////////////////
 
 			const compressed_tracks* get_compressed_tracks() const { return tracks; }
 			compressed_tracks_version16 get_version() const { return tracks->get_version(); }
-			sample_looping_policy get_looping_policy() const { return static_cast<sample_looping_policy>(looping_policy); }
-			sample_rounding_policy get_rounding_policy() const { return static_cast<sample_rounding_policy>(rounding_policy); }
+			sample_looping_policy get_looping_policy() const { return static_cast<sample_looping_policy>(policies & 0x0F); }
+			sample_rounding_policy get_rounding_policy() const { return static_cast<sample_rounding_policy>(policies >> 4); }
+			quality_tier get_max_quality_tier() const { return static_cast<quality_tier>(max_quality_tier); }
+			float get_sample_time() const { return sample_time; }
+			float get_duration() const { return duration; }
+			uint32_t get_key_frame_tiers() const { return key_frame_tiers; }
 			bool is_initialized() const { return tracks != nullptr; }
 			void reset()
 			{
@@ -101,22 +122,26 @@ namespace acl
 		{
 			ACL_ASSERT(tracks.get_algorithm_type() == algorithm_type8::uniformly_sampled, "Invalid algorithm type [%s], expected [%s]", get_algorithm_name(tracks.get_algorithm_type()), get_algorithm_name(algorithm_type8::uniformly_sampled));
 
-			if (database != nullptr)
-				return false;	// Database decompression is not supported for scalar tracks
+			// Context is always the first member and versions should always match
+			const database_context_v0* db = reinterpret_cast<const database_context_v0*>(database);
 
 			context.tracks = &tracks;
+			context.db = db;
 			context.tracks_hash = tracks.get_hash();
+			context.db_hash = db != nullptr ? db->db_hash : 0;
 			context.sample_time = -1.0F;
+			context.key_frame_tiers = 0;
+			context.max_quality_tier = static_cast<uint8_t>(quality_tier::lowest_importance);
 
 			if (decompression_settings_type::is_wrapping_supported())
 			{
 				context.duration = tracks.get_finite_duration();
-				context.looping_policy = static_cast<uint8_t>(tracks.get_looping_policy());
+				context.policies = static_cast<uint8_t>(tracks.get_looping_policy());
 			}
 			else
 			{
 				context.duration = tracks.get_finite_duration(sample_looping_policy::clamp);
-				context.looping_policy = static_cast<uint8_t>(sample_looping_policy::clamp);
+				context.policies = static_cast<uint8_t>(sample_looping_policy::clamp);
 			}
 
 			return true;
@@ -128,13 +153,19 @@ namespace acl
 			if (context.tracks_hash != tracks.get_hash())
 				return false;	// Hash is different, this instance did not relocate, it is different
 
-			if (database != nullptr)
-				return false;	// Database decompression is not supported for scalar tracks
+			// Context is always the first member and versions should always match
+			const database_context_v0* db = reinterpret_cast<const database_context_v0*>(database);
+			const uint32_t db_hash = db != nullptr ? db->db_hash : 0;
+
+			if (context.db_hash != db_hash)
+				return false;	// Hash is different, this instance did not relocate, it is different
 
 			// The instances are identical and might have relocated, update our metadata
 			context.tracks = &tracks;
+			context.db = db;
 
 			// Reset the sample time to force seek() to be called again.
+			// The key frame data offsets are relative to the bulk data of the database and are populated during seek.
 			context.sample_time = -1.0F;
 
 			return true;
@@ -154,10 +185,17 @@ namespace acl
 
 		inline bool is_bound_to_v0(const persistent_scalar_decompression_context_v0& context, const compressed_database& database)
 		{
-			// Database decompression is not supported for scalar tracks
-			(void)context;
-			(void)database;
-			return false;
+			if (context.db == nullptr)
+				return false;	// Not bound to any database
+
+			if (context.db->db != &database)
+				return false;	// Different pointer, no guarantees
+
+			if (context.db_hash != database.get_hash())
+				return false;	// Different hash
+
+			// Must be bound to it!
+			return true;
 		}
 
 		template<class decompression_settings_type>
@@ -169,18 +207,21 @@ namespace acl
 			if (policy == sample_looping_policy::as_compressed)
 				policy = context.tracks->get_looping_policy();
 
-			const sample_looping_policy current_policy = static_cast<sample_looping_policy>(context.looping_policy);
+			const sample_looping_policy current_policy = context.get_looping_policy();
 			if (current_policy != policy)
 			{
 				// Policy changed
 				context.duration = context.tracks->get_finite_duration(policy);
-				context.looping_policy = static_cast<uint8_t>(policy);
+				context.policies = static_cast<uint8_t>((context.policies & 0xF0) | static_cast<uint32_t>(policy));
 			}
 		}
 
 		template<class decompression_settings_type>
 		inline void seek_v0(persistent_scalar_decompression_context_v0& context, float sample_time, sample_rounding_policy rounding_policy)
 		{
+			using profiler_type = typename decompression_settings_type::profiler_type;
+			const scope_decompression_zone<profiler_type> seek_zone(decompression_zone::seek, context.tracks);
+
 			const acl_impl::tracks_header& header = acl_impl::get_tracks_header(*context.tracks);
 			if (header.num_samples == 0)
 				return;	// Empty track list
@@ -195,23 +236,379 @@ namespace acl
 			context.sample_time = sample_time;
 
 			// If the wrap looping policy isn't supported, use our statically known value
-			const sample_looping_policy looping_policy_ = decompression_settings_type::is_wrapping_supported() ? static_cast<sample_looping_policy>(context.looping_policy) : sample_looping_policy::clamp;
+			const sample_looping_policy looping_policy_ = decompression_settings_type::is_wrapping_supported() ? context.get_looping_policy() : sample_looping_policy::clamp;
 
 			uint32_t key_frame0;
 			uint32_t key_frame1;
 			find_linear_interpolation_samples_with_sample_rate(header.num_samples, header.sample_rate, sample_time, rounding_policy, looping_policy_, key_frame0, key_frame1, context.interpolation_alpha);
 
-			context.rounding_policy = static_cast<uint8_t>(rounding_policy);
+			context.policies = static_cast<uint8_t>((context.policies & 0x0F) | (static_cast<uint32_t>(rounding_policy) << 4));
+
+			const compressed_tracks* tracks = context.tracks;
+			const acl_impl::scalar_tracks_header& scalars_header = acl_impl::get_scalar_tracks_header(*tracks);
+			const uint32_t num_bits_per_frame = scalars_header.num_bits_per_frame;
+
+			if (tracks->has_database() || tracks->has_stripped_keyframes())
+			{
+				constexpr bool is_database_supported = decompression_settings_type::database_settings_type::version_supported() != compressed_tracks_version16::none;
+				ACL_ASSERT(is_database_supported || !tracks->has_database(), "Cannot have a database when it isn't supported");
+
+				// Without a database, only the key frames retained in the clip are used
+				// When we only sample from the compressed tracks, we skip the database entirely
+				const bool has_database = is_database_supported && tracks->has_database();
+				const quality_tier max_quality_tier = context.get_max_quality_tier();
+				const database_context_v0* db = has_database && max_quality_tier != quality_tier::highest_importance ? context.db : nullptr;
+
+				const uint32_t segment_index0 = key_frame0 / k_num_samples_per_scalar_database_segment;
+				const uint32_t segment_index1 = key_frame1 / k_num_samples_per_scalar_database_segment;
+
+				uint32_t segment_key_frame0 = key_frame0 - (segment_index0 * k_num_samples_per_scalar_database_segment);
+				uint32_t segment_key_frame1 = key_frame1 - (segment_index1 * k_num_samples_per_scalar_database_segment);
+
+				const acl_impl::scalar_database_segment_header* segment_headers = acl_impl::get_scalar_database_header(*tracks).get_segment_headers(scalars_header);
+				const acl_impl::scalar_database_segment_header& segment_header0 = segment_headers[segment_index0];
+				const acl_impl::scalar_database_segment_header& segment_header1 = segment_headers[segment_index1];
+
+				uint32_t sample_indices0 = segment_header0.sample_indices;
+				uint32_t sample_indices1 = segment_header1.sample_indices;
+
+				// When we load our sample indices and offsets from the database, there can be another thread writing
+				// to those memory locations at the same time (e.g. streaming in/out), see load_segment_tier_metadata(..).
+				// The metadata of the tiers we don't sample from remains zero.
+				uint64_t tier_metadata0[k_num_database_tiers] = {};
+				uint64_t tier_metadata1[k_num_database_tiers] = {};
+
+				// Combine all our loaded samples into a single bit set to find which samples we need to interpolate
+				if (db != nullptr)
+				{
+					const scope_decompression_zone<profiler_type> lookup_zone(decompression_zone::database_tier_lookup, tracks);
+
+					const acl_impl::tracks_database_header* tracks_db_header = acl_impl::get_tracks_database_header(*tracks);
+					const database_runtime_clip_header* db_clip_header = tracks_db_header->get_clip_header(db->clip_segment_headers);
+
+					// Skip the segment headers when nothing of our clip is streamed in, every sample then lives in the compressed tracks
+					if (has_resident_segments(*db_clip_header))
+					{
+						const database_runtime_segment_header* db_segment_headers = db_clip_header->get_segment_headers();
+
+						const database_runtime_segment_header* db_segment_header0 = db_segment_headers + segment_index0;
+						sample_indices0 |= load_segment_tier_metadata(*db_segment_header0, max_quality_tier, tier_metadata0);
+
+						mark_chunks_sampled(*db, tier_metadata0);
+
+						const database_runtime_segment_header* db_segment_header1 = db_segment_headers + segment_index1;
+						sample_indices1 |= load_segment_tier_metadata(*db_segment_header1, max_quality_tier, tier_metadata1);
+
+						if (segment_index1 != segment_index0)
+							mark_chunks_sampled(*db, tier_metadata1);
+					}
+				}
+
+				const uint32_t requested_key_frame0 = key_frame0;
+				const uint32_t requested_key_frame1 = key_frame1;
+
+				// Find the closest loaded samples, the first and last sample of every segment are always present
+				// Mask all trailing samples to find the first sample by counting trailing zeros
+				const uint32_t candidate_indices0 = sample_indices0 & (0xFFFFFFFFU << (31 - segment_key_frame0));
+				segment_key_frame0 = 31 - count_trailing_zeros(candidate_indices0);
+
+				// Mask all leading samples to find the second sample by counting leading zeros
+				const uint32_t candidate_indices1 = sample_indices1 & (0xFFFFFFFFU >> segment_key_frame1);
+				segment_key_frame1 = count_leading_zeros(candidate_indices1);
+
+				const uint32_t clip_key_frame0 = (segment_index0 * k_num_samples_per_scalar_database_segment) + segment_key_frame0;
+				const uint32_t clip_key_frame1 = (segment_index1 * k_num_samples_per_scalar_database_segment) + segment_key_frame1;
+
+				if (clip_key_frame0 != key_frame0 || clip_key_frame1 != key_frame1)
+				{
+					// We used the rounding policy above to snap to the correct key frame earlier but we need to interpolate now
+					// since key frames have been removed
+					const float sample_index = context.interpolation_alpha + float(key_frame0);
+					context.interpolation_alpha = find_linear_interpolation_alpha(sample_index, clip_key_frame0, clip_key_frame1, sample_rounding_policy::none);
+
+					key_frame0 = clip_key_frame0;
+					key_frame1 = clip_key_frame1;
+				}
+
+				// Find where our data lives (clip or database tier X)
+				uint32_t key_frame_tiers = 0;
+				sample_indices0 = segment_header0.sample_indices;
+				sample_indices1 = segment_header1.sample_indices;
+				uint32_t sample_offset0 = segment_header0.sample_offset;
+				uint32_t sample_offset1 = segment_header1.sample_offset;
+				context.key_frame_data_offsets[0] = 0;
+				context.key_frame_data_offsets[1] = 0;
+
+				if (db != nullptr)
+				{
+					const uint64_t sample_index0 = uint64_t(1) << (31 - segment_key_frame0);
+					const uint64_t sample_index1 = uint64_t(1) << (31 - segment_key_frame1);
+
+					const quality_tier sample_tier0 = find_sample_quality_tier(tier_metadata0, sample_index0);
+					if (sample_tier0 != quality_tier::highest_importance)
+					{
+						const uint64_t sample_tier_metadata0 = tier_metadata0[uint32_t(sample_tier0) - 1];
+						sample_indices0 = uint32_t(sample_tier_metadata0);
+						sample_offset0 = 0;
+						context.key_frame_data_offsets[0] = uint32_t(sample_tier_metadata0 >> 32);
+						key_frame_tiers |= uint32_t(sample_tier0);
+					}
+
+					const quality_tier sample_tier1 = find_sample_quality_tier(tier_metadata1, sample_index1);
+					if (sample_tier1 != quality_tier::highest_importance)
+					{
+						const uint64_t sample_tier_metadata1 = tier_metadata1[uint32_t(sample_tier1) - 1];
+						sample_indices1 = uint32_t(sample_tier_metadata1);
+						sample_offset1 = 0;
+						context.key_frame_data_offsets[1] = uint32_t(sample_tier_metadata1 >> 32);
+						key_frame_tiers |= uint32_t(sample_tier1) << 4;
+					}
+
+					// Without telemetry support, the counters are stripped
+					if (decompression_settings_type::database_settings_type::is_telemetry_supported())
+						record_seek_telemetry(*db, sample_tier0, sample_tier1, uint32_t(key_frame0 != requested_key_frame0) + uint32_t(key_frame1 != requested_key_frame1));
+				}
+
+				context.key_frame_tiers = static_cast<uint8_t>(key_frame_tiers);
+
+				// Remap our sample indices within the ones actually stored (e.g. index 3 might be the second frame stored)
+				const uint32_t stored_key_frame0 = sample_offset0 + count_set_bits(and_not(0xFFFFFFFFU >> segment_key_frame0, sample_indices0));
+				const uint32_t stored_key_frame1 = sample_offset1 + count_set_bits(and_not(0xFFFFFFFFU >> segment_key_frame1, sample_indices1));
+
+				context.key_frame_bit_offsets[0] = stored_key_frame0 * num_bits_per_frame;
+				context.key_frame_bit_offsets[1] = stored_key_frame1 * num_bits_per_frame;
+			}
+			else
+			{
+				context.key_frame_bit_offsets[0] = key_frame0 * num_bits_per_frame;
+				context.key_frame_bit_offsets[1] = key_frame1 * num_bits_per_frame;
+				context.key_frame_data_offsets[0] = 0;
+				context.key_frame_data_offsets[1] = 0;
+				context.key_frame_tiers = 0;
+			}
+
+			if (header.get_has_scalar_segments())
+			{
+				const acl_impl::scalar_segments_header& segments_header = acl_impl::get_scalar_segments_header(scalars_header);
+				context.segment_range_offsets[0] = (key_frame0 / segments_header.num_samples_per_segment) * segments_header.segment_range_size;
+				context.segment_range_offsets[1] = (key_frame1 / segments_header.num_samples_per_segment) * segments_header.segment_range_size;
+			}
+			else
+			{
+				context.segment_range_offsets[0] = 0;
+				context.segment_range_offsets[1] = 0;
+			}
+		}
+
+		template<class decompression_settings_type>
+		inline void set_max_quality_tier_v0(persistent_scalar_decompression_context_v0& context, quality_tier tier)
+		{
+			if (context.get_max_quality_tier() == tier)
+				return;	// Nothing to do
+
+			context.max_quality_tier = static_cast<uint8_t>(tier);
+
+			if (context.sample_time < 0.0F)
+				return;	// We didn't seek yet, the next seek will honor our new tier
+
+			// Seek again to the current sample time, our key frames might now live elsewhere
+			const float sample_time = context.sample_time;
+			context.sample_time = -1.0F;
+			seek_v0<decompression_settings_type>(context, sample_time, context.get_rounding_policy());
+		}
+
+		// Returns the segment range values of both key frames or null if we aren't segmented
+		inline void get_segment_range_values_v0(const persistent_scalar_decompression_context_v0& context, const uint8_t*& out_segment_range_values0, const uint8_t*& out_segment_range_values1)
+		{
+			const acl_impl::tracks_header& header = acl_impl::get_tracks_header(*context.tracks);
+			if (!header.get_has_scalar_segments())
+			{
+				out_segment_range_values0 = nullptr;
+				out_segment_range_values1 = nullptr;
+				return;
+			}
+
+			const acl_impl::scalar_tracks_header& scalars_header = acl_impl::get_scalar_tracks_header(*context.tracks);
+			const uint8_t* segment_range_values = acl_impl::get_scalar_segments_header(scalars_header).get_segment_range_values(scalars_header);
+			out_segment_range_values0 = segment_range_values + context.segment_range_offsets[0];
+			out_segment_range_values1 = segment_range_values + context.segment_range_offsets[1];
+		}
+
+		// Returns the animated values of both key frames, they live in the compressed tracks or in a database tier
+		inline void get_animated_values_v0(const persistent_scalar_decompression_context_v0& context, const uint8_t*& out_animated_values0, const uint8_t*& out_animated_values1)
+		{
+			const uint8_t* animated_values = acl_impl::get_scalar_tracks_header(*context.tracks).get_track_animated_values();
+			out_animated_values0 = animated_values;
+			out_animated_values1 = animated_values;
+
+			const uint32_t key_frame_tiers = context.get_key_frame_tiers();
+			if (key_frame_tiers == 0)
+				return;	// Both key frames live in the compressed tracks
+
+			// The tier bulk data is visible since we observed its metadata with acquire semantics during seek
+			const database_context_v0* db = context.db;
+			const uint32_t key_frame_tier0 = key_frame_tiers & 0x0F;
+			const uint32_t key_frame_tier1 = key_frame_tiers >> 4;
+
+			if (key_frame_tier0 != 0)
+				out_animated_values0 = db->bulk_data[key_frame_tier0 - 1].load(std::memory_order::memory_order_relaxed) + context.key_frame_data_offsets[0];
+
+			if (key_frame_tier1 != 0)
+				out_animated_values1 = db->bulk_data[key_frame_tier1 - 1].load(std::memory_order::memory_order_relaxed) + context.key_frame_data_offsets[1];
+		}
+
+		// Segment ranges are stored on 8 bits per component, the minimum of every component followed by their extent
+		inline rtm::scalarf RTM_SIMD_CALL apply_scalarf_segment_range(rtm::scalarf_arg0 value, const uint8_t* segment_range_values)
+		{
+			const rtm::scalarf segment_range_min = rtm::scalar_set(unpack_scalar_unsigned(segment_range_values[0], 8));
+			const rtm::scalarf segment_range_extent = rtm::scalar_set(unpack_scalar_unsigned(segment_range_values[1], 8));
+			return rtm::scalar_mul_add(value, segment_range_extent, segment_range_min);
+		}
+
+		inline rtm::vector4f RTM_SIMD_CALL apply_vector4f_segment_range(rtm::vector4f_arg0 value, const uint8_t* segment_range_values, uint32_t num_components)
+		{
+			const rtm::vector4f segment_range_min = unpack_vector4_32(segment_range_values, true);
+			const rtm::vector4f segment_range_extent = unpack_vector4_32(segment_range_values + num_components, true);
+			return rtm::vector_mul_add(value, segment_range_extent, segment_range_min);
+		}
+
+		inline void prefetch_v0(const persistent_scalar_decompression_context_v0& context)
+		{
+			const acl_impl::tracks_header& header = acl_impl::get_tracks_header(*context.tracks);
+			if (header.num_tracks == 0 || context.sample_time < 0.0F)
+				return;	// Empty track list or we didn't seek yet
 
 			const acl_impl::scalar_tracks_header& scalars_header = acl_impl::get_scalar_tracks_header(*context.tracks);
 
-			context.key_frame_bit_offsets[0] = key_frame0 * scalars_header.num_bits_per_frame;
-			context.key_frame_bit_offsets[1] = key_frame1 * scalars_header.num_bits_per_frame;
+			const uint8_t* animated_values0;
+			const uint8_t* animated_values1;
+			get_animated_values_v0(context, animated_values0, animated_values1);
+
+			memory_prefetch(scalars_header.get_track_metadata());
+			memory_prefetch(scalars_header.get_track_constant_values());
+			memory_prefetch(scalars_header.get_track_range_values());
+
+			const uint8_t* segment_range_values0;
+			const uint8_t* segment_range_values1;
+			get_segment_range_values_v0(context, segment_range_values0, segment_range_values1);
+			if (segment_range_values0 != nullptr)
+			{
+				memory_prefetch(segment_range_values0);
+				memory_prefetch(segment_range_values1);
+			}
+
+			memory_prefetch(animated_values0 + (context.key_frame_bit_offsets[0] / 8));
+			memory_prefetch(animated_values1 + (context.key_frame_bit_offsets[1] / 8));
+		}
+
+		// Decompresses float1f tracks, animated tracks that share the same bit rate are
+		// unpacked and interpolated 4 at a time and written with 'write_float1_batch'
+		template<class track_writer_type>
+		inline void decompress_float1_tracks_batched_v0(const acl_impl::track_metadata* per_track_metadata, const float* constant_values, const float* range_values,
+			const uint8_t* segment_range_values0, const uint8_t* segment_range_values1, const uint8_t* animated_values0, const uint8_t* animated_values1,
+			uint32_t track_bit_offset0, uint32_t track_bit_offset1, const uint8_t* num_bits_at_bit_rate, uint32_t num_tracks, float interpolation_alpha, track_writer_type& writer)
+		{
+			const rtm::scalarf alpha = rtm::scalar_set(interpolation_alpha);
+
+			for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			{
+				const uint32_t bit_rate = per_track_metadata[track_index].bit_rate;
+				const uint32_t num_bits_per_component = num_bits_at_bit_rate[bit_rate];
+
+				if (num_bits_per_component == 0)	// Constant bit rate
+				{
+					writer.write_float1(track_index, rtm::scalar_load(constant_values));
+					constant_values += 1;
+					continue;
+				}
+
+				if (num_bits_per_component == 32)	// Raw bit rate
+				{
+					const rtm::scalarf value0 = unpack_scalarf_32_unsafe(animated_values0, track_bit_offset0);
+					const rtm::scalarf value1 = unpack_scalarf_32_unsafe(animated_values1, track_bit_offset1);
+					writer.write_float1(track_index, rtm::scalar_lerp(value0, value1, alpha));
+
+					track_bit_offset0 += 32;
+					track_bit_offset1 += 32;
+					continue;
+				}
+
+				// Animated samples are contiguous in memory, if the next 3 tracks have the same bit rate we can unpack them together
+				const bool can_batch = (track_index + 4) <= num_tracks
+					&& per_track_metadata[track_index + 1].bit_rate == bit_rate
+					&& per_track_metadata[track_index + 2].bit_rate == bit_rate
+					&& per_track_metadata[track_index + 3].bit_rate == bit_rate;
+
+				if (can_batch)
+				{
+					rtm::vector4f value0 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values0, track_bit_offset0);
+					rtm::vector4f value1 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values1, track_bit_offset1);
+
+					if (segment_range_values0 != nullptr)
+					{
+						// Segment range values are interleaved per track as well: min0, extent0, min1, extent1, ...
+						const uint8_t* segment0 = segment_range_values0;
+						const uint8_t* segment1 = segment_range_values1;
+						const rtm::vector4f segment_range_min0 = rtm::vector_set(unpack_scalar_unsigned(segment0[0], 8), unpack_scalar_unsigned(segment0[2], 8), unpack_scalar_unsigned(segment0[4], 8), unpack_scalar_unsigned(segment0[6], 8));
+						const rtm::vector4f segment_range_extent0 = rtm::vector_set(unpack_scalar_unsigned(segment0[1], 8), unpack_scalar_unsigned(segment0[3], 8), unpack_scalar_unsigned(segment0[5], 8), unpack_scalar_unsigned(segment0[7], 8));
+						const rtm::vector4f segment_range_min1 = rtm::vector_set(unpack_scalar_unsigned(segment1[0], 8), unpack_scalar_unsigned(segment1[2], 8), unpack_scalar_unsigned(segment1[4], 8), unpack_scalar_unsigned(segment1[6], 8));
+						const rtm::vector4f segment_range_extent1 = rtm::vector_set(unpack_scalar_unsigned(segment1[1], 8), unpack_scalar_unsigned(segment1[3], 8), unpack_scalar_unsigned(segment1[5], 8), unpack_scalar_unsigned(segment1[7], 8));
+						value0 = rtm::vector_mul_add(value0, segment_range_extent0, segment_range_min0);
+						value1 = rtm::vector_mul_add(value1, segment_range_extent1, segment_range_min1);
+						segment_range_values0 += 8;
+						segment_range_values1 += 8;
+					}
+
+					// Range values are interleaved per track: min0, extent0, min1, extent1, ...
+					const rtm::vector4f range01 = rtm::vector_load(range_values);
+					const rtm::vector4f range23 = rtm::vector_load(range_values + 4);
+					const rtm::vector4f range_min = rtm::vector_mix<rtm::mix4::x, rtm::mix4::z, rtm::mix4::a, rtm::mix4::c>(range01, range23);
+					const rtm::vector4f range_extent = rtm::vector_mix<rtm::mix4::y, rtm::mix4::w, rtm::mix4::b, rtm::mix4::d>(range01, range23);
+					value0 = rtm::vector_mul_add(value0, range_extent, range_min);
+					value1 = rtm::vector_mul_add(value1, range_extent, range_min);
+					range_values += 8;
+
+					writer.write_float1_batch(track_index, rtm::vector_lerp(value0, value1, alpha));
+
+					const uint32_t num_sample_bits = num_bits_per_component * 4;
+					track_bit_offset0 += num_sample_bits;
+					track_bit_offset1 += num_sample_bits;
+
+					track_index += 3;
+				}
+				else
+				{
+					rtm::scalarf value0 = unpack_scalarf_uXX_unsafe(num_bits_per_component, animated_values0, track_bit_offset0);
+					rtm::scalarf value1 = unpack_scalarf_uXX_unsafe(num_bits_per_component, animated_values1, track_bit_offset1);
+
+					if (segment_range_values0 != nullptr)
+					{
+						value0 = apply_scalarf_segment_range(value0, segment_range_values0);
+						value1 = apply_scalarf_segment_range(value1, segment_range_values1);
+						segment_range_values0 += 2;
+						segment_range_values1 += 2;
+					}
+
+					const rtm::scalarf range_min = rtm::scalar_load(range_values);
+					const rtm::scalarf range_extent = rtm::scalar_load(range_values + 1);
+					value0 = rtm::scalar_mul_add(value0, range_extent, range_min);
+					value1 = rtm::scalar_mul_add(value1, range_extent, range_min);
+					range_values += 2;
+
+					writer.write_float1(track_index, rtm::scalar_lerp(value0, value1, alpha));
+
+					track_bit_offset0 += num_bits_per_component;
+					track_bit_offset1 += num_bits_per_component;
+				}
+			}
 		}
 
 		template<class decompression_settings_type, class track_writer_type>
 		inline void decompress_tracks_v0(const persistent_scalar_decompression_context_v0& context, track_writer_type& writer)
 		{
+			using profiler_type = typename decompression_settings_type::profiler_type;
+			const scope_decompression_zone<profiler_type> decompress_zone(decompression_zone::decompress_tracks, context.tracks);
+
 			const acl_impl::tracks_header& header = acl_impl::get_tracks_header(*context.tracks);
 			const uint32_t num_tracks = header.num_tracks;
 			if (num_tracks == 0)
@@ -230,7 +627,7 @@ namespace acl
 			const acl_impl::scalar_tracks_header& scalars_header = acl_impl::get_scalar_tracks_header(*context.tracks);
 			const rtm::scalarf interpolation_alpha = rtm::scalar_set(context.interpolation_alpha);
 
-			const sample_rounding_policy rounding_policy = static_cast<sample_rounding_policy>(context.rounding_policy);
+			const sample_rounding_policy rounding_policy = context.get_rounding_policy();
 
 			float interpolation_alpha_per_policy[k_num_sample_rounding_policies] = {};
 			if (decompression_settings_type::is_per_track_rounding_supported())
@@ -249,7 +646,14 @@ namespace acl
 			const acl_impl::track_metadata* per_track_metadata = scalars_header.get_track_metadata();
 			const float* constant_values = scalars_header.get_track_constant_values();
 			const float* range_values = scalars_header.get_track_range_values();
-			const uint8_t* animated_values = scalars_header.get_track_animated_values();
+
+			const uint8_t* animated_values0;
+			const uint8_t* animated_values1;
+			get_animated_values_v0(context, animated_values0, animated_values1);
+
+			const uint8_t* segment_range_values0;
+			const uint8_t* segment_range_values1;
+			get_segment_range_values_v0(context, segment_range_values0, segment_range_values1);
 
 			uint32_t track_bit_offset0 = context.key_frame_bit_offsets[0];
 			uint32_t track_bit_offset1 = context.key_frame_bit_offsets[1];
@@ -263,6 +667,17 @@ namespace acl
 			const uint32_t max_bit_rate = version == compressed_tracks_version16::v02_00_00 ? sizeof(k_bit_rate_num_bits_v0) : sizeof(k_bit_rate_num_bits);
 #endif
 
+			if (track_writer_type::supports_float1_batch_output() && !decompression_settings_type::is_per_track_rounding_supported()
+				&& track_type == track_type8::float1f && decompression_settings_type::is_track_type_supported(track_type8::float1f))
+			{
+				decompress_float1_tracks_batched_v0(per_track_metadata, constant_values, range_values, segment_range_values0, segment_range_values1, animated_values0, animated_values1, track_bit_offset0, track_bit_offset1, num_bits_at_bit_rate, num_tracks, context.interpolation_alpha, writer);
+
+				if (decompression_settings_type::disable_fp_exeptions())
+					restore_fp_exceptions(fp_env);
+
+				return;
+			}
+
 			for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
 			{
 				const acl_impl::track_metadata& metadata = per_track_metadata[track_index];
@@ -293,13 +708,21 @@ namespace acl
 						rtm::scalarf value1;
 						if (num_bits_per_component == 32)	// Raw bit rate
 						{
-							value0 = unpack_scalarf_32_unsafe(animated_values, track_bit_offset0);
-							value1 = unpack_scalarf_32_unsafe(animated_values, track_bit_offset1);
+							value0 = unpack_scalarf_32_unsafe(animated_values0, track_bit_offset0);
+							value1 = unpack_scalarf_32_unsafe(animated_values1, track_bit_offset1);
 						}
 						else
 						{
-							value0 = unpack_scalarf_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset0);
-							value1 = unpack_scalarf_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset1);
+							value0 = unpack_scalarf_uXX_unsafe(num_bits_per_component, animated_values0, track_bit_offset0);
+							value1 = unpack_scalarf_uXX_unsafe(num_bits_per_component, animated_values1, track_bit_offset1);
+
+							if (segment_range_values0 != nullptr)
+							{
+								value0 = apply_scalarf_segment_range(value0, segment_range_values0);
+								value1 = apply_scalarf_segment_range(value1, segment_range_values1);
+								segment_range_values0 += 2;
+								segment_range_values1 += 2;
+							}
 
 							const rtm::scalarf range_min = rtm::scalar_load(range_values);
 							const rtm::scalarf range_extent = rtm::scalar_load(range_values + 1);
@@ -331,13 +754,21 @@ namespace acl
 						rtm::vector4f value1;
 						if (num_bits_per_component == 32)	// Raw bit rate
 						{
-							value0 = unpack_vector2_64_unsafe(animated_values, track_bit_offset0);
-							value1 = unpack_vector2_64_unsafe(animated_values, track_bit_offset1);
+							value0 = unpack_vector2_64_unsafe(animated_values0, track_bit_offset0);
+							value1 = unpack_vector2_64_unsafe(animated_values1, track_bit_offset1);
 						}
 						else
 						{
-							value0 = unpack_vector2_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset0);
-							value1 = unpack_vector2_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset1);
+							value0 = unpack_vector2_uXX_unsafe(num_bits_per_component, animated_values0, track_bit_offset0);
+							value1 = unpack_vector2_uXX_unsafe(num_bits_per_component, animated_values1, track_bit_offset1);
+
+							if (segment_range_values0 != nullptr)
+							{
+								value0 = apply_vector4f_segment_range(value0, segment_range_values0, 2);
+								value1 = apply_vector4f_segment_range(value1, segment_range_values1, 2);
+								segment_range_values0 += 4;
+								segment_range_values1 += 4;
+							}
 
 							const rtm::vector4f range_min = rtm::vector_load(range_values);
 							const rtm::vector4f range_extent = rtm::vector_load(range_values + 2);
@@ -369,13 +800,21 @@ namespace acl
 						rtm::vector4f value1;
 						if (num_bits_per_component == 32)	// Raw bit rate
 						{
-							value0 = unpack_vector3_96_unsafe(animated_values, track_bit_offset0);
-							value1 = unpack_vector3_96_unsafe(animated_values, track_bit_offset1);
+							value0 = unpack_vector3_96_unsafe(animated_values0, track_bit_offset0);
+							value1 = unpack_vector3_96_unsafe(animated_values1, track_bit_offset1);
 						}
 						else
 						{
-							value0 = unpack_vector3_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset0);
-							value1 = unpack_vector3_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset1);
+							value0 = unpack_vector3_uXX_unsafe(num_bits_per_component, animated_values0, track_bit_offset0);
+							value1 = unpack_vector3_uXX_unsafe(num_bits_per_component, animated_values1, track_bit_offset1);
+
+							if (segment_range_values0 != nullptr)
+							{
+								value0 = apply_vector4f_segment_range(value0, segment_range_values0, 3);
+								value1 = apply_vector4f_segment_range(value1, segment_range_values1, 3);
+								segment_range_values0 += 6;
+								segment_range_values1 += 6;
+							}
 
 							const rtm::vector4f range_min = rtm::vector_load(range_values);
 							const rtm::vector4f range_extent = rtm::vector_load(range_values + 3);
@@ -407,13 +846,21 @@ namespace acl
 						rtm::vector4f value1;
 						if (num_bits_per_component == 32)	// Raw bit rate
 						{
-							value0 = unpack_vector4_128_unsafe(animated_values, track_bit_offset0);
-							value1 = unpack_vector4_128_unsafe(animated_values, track_bit_offset1);
+							value0 = unpack_vector4_128_unsafe(animated_values0, track_bit_offset0);
+							value1 = unpack_vector4_128_unsafe(animated_values1, track_bit_offset1);
 						}
 						else
 						{
-							value0 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset0);
-							value1 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset1);
+							value0 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values0, track_bit_offset0);
+							value1 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values1, track_bit_offset1);
+
+							if (segment_range_values0 != nullptr)
+							{
+								value0 = apply_vector4f_segment_range(value0, segment_range_values0, 4);
+								value1 = apply_vector4f_segment_range(value1, segment_range_values1, 4);
+								segment_range_values0 += 8;
+								segment_range_values1 += 8;
+							}
 
 							const rtm::vector4f range_min = rtm::vector_load(range_values);
 							const rtm::vector4f range_extent = rtm::vector_load(range_values + 4);
@@ -445,13 +892,21 @@ namespace acl
 						rtm::vector4f value1;
 						if (num_bits_per_component == 32)	// Raw bit rate
 						{
-							value0 = unpack_vector4_128_unsafe(animated_values, track_bit_offset0);
-							value1 = unpack_vector4_128_unsafe(animated_values, track_bit_offset1);
+							value0 = unpack_vector4_128_unsafe(animated_values0, track_bit_offset0);
+							value1 = unpack_vector4_128_unsafe(animated_values1, track_bit_offset1);
 						}
 						else
 						{
-							value0 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset0);
-							value1 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, track_bit_offset1);
+							value0 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values0, track_bit_offset0);
+							value1 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values1, track_bit_offset1);
+
+							if (segment_range_values0 != nullptr)
+							{
+								value0 = apply_vector4f_segment_range(value0, segment_range_values0, 4);
+								value1 = apply_vector4f_segment_range(value1, segment_range_values1, 4);
+								segment_range_values0 += 8;
+								segment_range_values1 += 8;
+							}
 
 							const rtm::vector4f range_min = rtm::vector_load(range_values);
 							const rtm::vector4f range_extent = rtm::vector_load(range_values + 4);
@@ -478,6 +933,9 @@ namespace acl
 		template<class decompression_settings_type, class track_writer_type>
 		inline void decompress_track_v0(const persistent_scalar_decompression_context_v0& context, uint32_t track_index, track_writer_type& writer)
 		{
+			using profiler_type = typename decompression_settings_type::profiler_type;
+			const scope_decompression_zone<profiler_type> decompress_zone(decompression_zone::decompress_track, context.tracks);
+
 			const tracks_header& header = get_tracks_header(*context.tracks);
 			if (header.num_tracks == 0)
 				return;	// Empty track list
@@ -501,7 +959,7 @@ namespace acl
 			rtm::scalarf interpolation_alpha = rtm::scalar_set(context.interpolation_alpha);
 			if (decompression_settings_type::is_per_track_rounding_supported())
 			{
-				const sample_rounding_policy rounding_policy = static_cast<sample_rounding_policy>(context.rounding_policy);
+				const sample_rounding_policy rounding_policy = context.get_rounding_policy();
 				const sample_rounding_policy rounding_policy_ = writer.get_rounding_policy(rounding_policy, track_index);
 				ACL_ASSERT(rounding_policy_ != sample_rounding_policy::per_track, "track_writer::get_rounding_policy() cannot return per_track");
 				
@@ -518,9 +976,15 @@ namespace acl
 			const float* constant_values = scalars_header.get_track_constant_values();
 			const float* range_values = scalars_header.get_track_range_values();
 
+			const uint8_t* segment_range_values0;
+			const uint8_t* segment_range_values1;
+			get_segment_range_values_v0(context, segment_range_values0, segment_range_values1);
+			const bool has_segments = segment_range_values0 != nullptr;
+
 			const track_type8 track_type = header.track_type;
 			const uint32_t num_element_components = get_track_num_sample_elements(track_type);
 			uint32_t track_bit_offset = 0;
+			uint32_t segment_range_offset = 0;
 
 			const acl_impl::track_metadata* per_track_metadata = scalars_header.get_track_metadata();
 			for (uint32_t scan_track_index = 0; scan_track_index < track_index; ++scan_track_index)
@@ -534,7 +998,16 @@ namespace acl
 				if (num_bits_per_component == 0)	// Constant bit rate
 					constant_values += num_element_components;
 				else if (num_bits_per_component < 32)	// Not raw bit rate
+				{
 					range_values += num_element_components * 2;
+					segment_range_offset += num_element_components * 2;
+				}
+			}
+
+			if (has_segments)
+			{
+				segment_range_values0 += segment_range_offset;
+				segment_range_values1 += segment_range_offset;
 			}
 
 			const acl_impl::track_metadata& metadata = per_track_metadata[track_index];
@@ -542,7 +1015,9 @@ namespace acl
 			ACL_ASSERT(bit_rate < max_bit_rate, "Invalid bit rate: %u", bit_rate);
 			const uint32_t num_bits_per_component = num_bits_at_bit_rate[bit_rate];
 
-			const uint8_t* animated_values = scalars_header.get_track_animated_values();
+			const uint8_t* animated_values0;
+			const uint8_t* animated_values1;
+			get_animated_values_v0(context, animated_values0, animated_values1);
 
 			if (track_type == track_type8::float1f && decompression_settings_type::is_track_type_supported(track_type8::float1f))
 			{
@@ -555,13 +1030,19 @@ namespace acl
 					rtm::scalarf value1;
 					if (num_bits_per_component == 32)	// Raw bit rate
 					{
-						value0 = unpack_scalarf_32_unsafe(animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
-						value1 = unpack_scalarf_32_unsafe(animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
+						value0 = unpack_scalarf_32_unsafe(animated_values0, context.key_frame_bit_offsets[0] + track_bit_offset);
+						value1 = unpack_scalarf_32_unsafe(animated_values1, context.key_frame_bit_offsets[1] + track_bit_offset);
 					}
 					else
 					{
-						value0 = unpack_scalarf_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
-						value1 = unpack_scalarf_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
+						value0 = unpack_scalarf_uXX_unsafe(num_bits_per_component, animated_values0, context.key_frame_bit_offsets[0] + track_bit_offset);
+						value1 = unpack_scalarf_uXX_unsafe(num_bits_per_component, animated_values1, context.key_frame_bit_offsets[1] + track_bit_offset);
+
+						if (has_segments)
+						{
+							value0 = apply_scalarf_segment_range(value0, segment_range_values0);
+							value1 = apply_scalarf_segment_range(value1, segment_range_values1);
+						}
 
 						const rtm::scalarf range_min = rtm::scalar_load(range_values);
 						const rtm::scalarf range_extent = rtm::scalar_load(range_values + num_element_components);
@@ -585,13 +1066,19 @@ namespace acl
 					rtm::vector4f value1;
 					if (num_bits_per_component == 32)	// Raw bit rate
 					{
-						value0 = unpack_vector2_64_unsafe(animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
-						value1 = unpack_vector2_64_unsafe(animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
+						value0 = unpack_vector2_64_unsafe(animated_values0, context.key_frame_bit_offsets[0] + track_bit_offset);
+						value1 = unpack_vector2_64_unsafe(animated_values1, context.key_frame_bit_offsets[1] + track_bit_offset);
 					}
 					else
 					{
-						value0 = unpack_vector2_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
-						value1 = unpack_vector2_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
+						value0 = unpack_vector2_uXX_unsafe(num_bits_per_component, animated_values0, context.key_frame_bit_offsets[0] + track_bit_offset);
+						value1 = unpack_vector2_uXX_unsafe(num_bits_per_component, animated_values1, context.key_frame_bit_offsets[1] + track_bit_offset);
+
+						if (has_segments)
+						{
+							value0 = apply_vector4f_segment_range(value0, segment_range_values0, num_element_components);
+							value1 = apply_vector4f_segment_range(value1, segment_range_values1, num_element_components);
+						}
 
 						const rtm::vector4f range_min = rtm::vector_load(range_values);
 						const rtm::vector4f range_extent = rtm::vector_load(range_values + num_element_components);
@@ -615,13 +1102,19 @@ namespace acl
 					rtm::vector4f value1;
 					if (num_bits_per_component == 32)	// Raw bit rate
 					{
-						value0 = unpack_vector3_96_unsafe(animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
-						value1 = unpack_vector3_96_unsafe(animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
+						value0 = unpack_vector3_96_unsafe(animated_values0, context.key_frame_bit_offsets[0] + track_bit_offset);
+						value1 = unpack_vector3_96_unsafe(animated_values1, context.key_frame_bit_offsets[1] + track_bit_offset);
 					}
 					else
 					{
-						value0 = unpack_vector3_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
-						value1 = unpack_vector3_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
+						value0 = unpack_vector3_uXX_unsafe(num_bits_per_component, animated_values0, context.key_frame_bit_offsets[0] + track_bit_offset);
+						value1 = unpack_vector3_uXX_unsafe(num_bits_per_component, animated_values1, context.key_frame_bit_offsets[1] + track_bit_offset);
+
+						if (has_segments)
+						{
+							value0 = apply_vector4f_segment_range(value0, segment_range_values0, num_element_components);
+							value1 = apply_vector4f_segment_range(value1, segment_range_values1, num_element_components);
+						}
 
 						const rtm::vector4f range_min = rtm::vector_load(range_values);
 						const rtm::vector4f range_extent = rtm::vector_load(range_values + num_element_components);
@@ -645,13 +1138,19 @@ namespace acl
 					rtm::vector4f value1;
 					if (num_bits_per_component == 32)	// Raw bit rate
 					{
-						value0 = unpack_vector4_128_unsafe(animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
-						value1 = unpack_vector4_128_unsafe(animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
+						value0 = unpack_vector4_128_unsafe(animated_values0, context.key_frame_bit_offsets[0] + track_bit_offset);
+						value1 = unpack_vector4_128_unsafe(animated_values1, context.key_frame_bit_offsets[1] + track_bit_offset);
 					}
 					else
 					{
-						value0 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
-						value1 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
+						value0 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values0, context.key_frame_bit_offsets[0] + track_bit_offset);
+						value1 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values1, context.key_frame_bit_offsets[1] + track_bit_offset);
+
+						if (has_segments)
+						{
+							value0 = apply_vector4f_segment_range(value0, segment_range_values0, num_element_components);
+							value1 = apply_vector4f_segment_range(value1, segment_range_values1, num_element_components);
+						}
 
 						const rtm::vector4f range_min = rtm::vector_load(range_values);
 						const rtm::vector4f range_extent = rtm::vector_load(range_values + num_element_components);
@@ -675,13 +1174,19 @@ namespace acl
 					rtm::vector4f value1;
 					if (num_bits_per_component == 32)	// Raw bit rate
 					{
-						value0 = unpack_vector4_128_unsafe(animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
-						value1 = unpack_vector4_128_unsafe(animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
+						value0 = unpack_vector4_128_unsafe(animated_values0, context.key_frame_bit_offsets[0] + track_bit_offset);
+						value1 = unpack_vector4_128_unsafe(animated_values1, context.key_frame_bit_offsets[1] + track_bit_offset);
 					}
 					else
 					{
-						value0 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[0] + track_bit_offset);
-						value1 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values, context.key_frame_bit_offsets[1] + track_bit_offset);
+						value0 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values0, context.key_frame_bit_offsets[0] + track_bit_offset);
+						value1 = unpack_vector4_uXX_unsafe(num_bits_per_component, animated_values1, context.key_frame_bit_offsets[1] + track_bit_offset);
+
+						if (has_segments)
+						{
+							value0 = apply_vector4f_segment_range(value0, segment_range_values0, num_element_components);
+							value1 = apply_vector4f_segment_range(value1, segment_range_values1, num_element_components);
+						}
 
 						const rtm::vector4f range_min = rtm::vector_load(range_values);
 						const rtm::vector4f range_extent = rtm::vector_load(range_values + num_element_components);
@@ -0,0 +1,233 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Included only once from track_offset_table.h
+
+#include "acl/version.h"
+#include "acl/core/bit_manip_utils.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/track_types.h"
+#include "acl/core/impl/compressed_headers.h"
+#include "acl/decompression/database/database.h"
+#include "acl/decompression/impl/transform_animated_track_cache.h"
+#include "acl/decompression/impl/transform_decompression_context.h"
+#include "acl/decompression/impl/transform_track_decompression.h"
+
+#include <cstdint>
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	inline track_offset_table::track_offset_table()
+		: m_allocator(nullptr)
+		, m_tracks(nullptr)
+		, m_buffer(nullptr)
+		, m_buffer_size(0)
+		, m_tracks_hash(0)
+		, m_offsets()
+	{
+	}
+
+	inline track_offset_table::~track_offset_table()
+	{
+		reset();
+	}
+
+	template<class decompression_settings_type>
+	inline bool track_offset_table::initialize(iallocator& allocator, const compressed_tracks& tracks)
+	{
+		reset();
+
+		if (tracks.get_track_type() != track_type8::qvvf)
+			return false;	// Only transform tracks are supported
+
+		// We re-use the decompression code path to ensure the offsets are identical to what a context would compute
+		using database_settings_type = typename decompression_settings_type::database_settings_type;
+		using translation_adapter = acl_impl::translation_decompression_settings_adapter<decompression_settings_type>;
+		using scale_adapter = acl_impl::scale_decompression_settings_adapter<decompression_settings_type>;
+
+		acl_impl::persistent_transform_decompression_context_v0 context;
+		if (!acl_impl::initialize_v0<decompression_settings_type>(context, tracks, static_cast<const database_context<database_settings_type>*>(nullptr)))
+			return false;
+
+		const acl_impl::tracks_header& header = acl_impl::get_tracks_header(tracks);
+		const acl_impl::transform_tracks_header& transform_header = acl_impl::get_transform_tracks_header(tracks);
+
+		const uint32_t num_tracks = header.num_tracks;
+		const uint32_t num_sub_track_entries = (num_tracks + acl_impl::k_num_sub_tracks_per_packed_entry - 1) / acl_impl::k_num_sub_tracks_per_packed_entry;
+		const bool has_scale = context.has_scale != 0;
+
+		const uint32_t num_rotation_groups = (transform_header.num_animated_rotation_sub_tracks + 3) / 4;
+		const uint32_t num_translation_groups = (transform_header.num_animated_translation_sub_tracks + 3) / 4;
+		const uint32_t num_scale_groups = (transform_header.num_animated_scale_sub_tracks + 3) / 4;
+		const uint32_t num_groups = num_rotation_groups + num_translation_groups + num_scale_groups;
+		const uint32_t num_segments = transform_header.num_segments;
+
+		const uint32_t num_sub_track_counts = num_sub_track_entries * acl_impl::k_track_offset_table_num_counts_per_entry;
+		const uint32_t buffer_size = num_sub_track_counts + (num_segments * num_groups);
+
+		uint32_t* buffer = buffer_size != 0 ? allocate_type_array<uint32_t>(allocator, buffer_size) : nullptr;
+		uint32_t* sub_track_counts = buffer;
+		uint32_t* group_bit_offsets = buffer + num_sub_track_counts;
+
+		// Count how many sub-tracks of each type precede every packed entry
+		const acl_impl::packed_sub_track_types* rotation_sub_track_types = transform_header.get_sub_track_types();
+		const acl_impl::packed_sub_track_types* translation_sub_track_types = rotation_sub_track_types + num_sub_track_entries;
+		const acl_impl::packed_sub_track_types* scale_sub_track_types = translation_sub_track_types + num_sub_track_entries;
+
+		uint32_t num_constant_rotations = 0;
+		uint32_t num_animated_rotations = 0;
+		uint32_t num_constant_translations = 0;
+		uint32_t num_animated_translations = 0;
+		uint32_t num_constant_scales = 0;
+		uint32_t num_animated_scales = 0;
+
+		for (uint32_t entry_index = 0; entry_index < num_sub_track_entries; ++entry_index)
+		{
+			uint32_t* entry_counts = sub_track_counts + (entry_index * acl_impl::k_track_offset_table_num_counts_per_entry);
+			entry_counts[0] = num_constant_rotations;
+			entry_counts[1] = num_animated_rotations;
+			entry_counts[2] = num_constant_translations;
+			entry_counts[3] = num_animated_translations;
+			entry_counts[4] = num_constant_scales;
+			entry_counts[5] = num_animated_scales;
+
+			// Padding sub-tracks are default and do not contribute
+			const uint32_t rotation_sub_track_types_ = rotation_sub_track_types[entry_index].types;
+			const uint32_t translation_sub_track_types_ = translation_sub_track_types[entry_index].types;
+			const uint32_t scale_sub_track_types_ = has_scale ? scale_sub_track_types[entry_index].types : 0;
+
+			num_constant_rotations += count_set_bits(rotation_sub_track_types_ & 0x55555555);
+			num_animated_rotations += count_set_bits(rotation_sub_track_types_ & 0xAAAAAAAA);
+			num_constant_translations += count_set_bits(translation_sub_track_types_ & 0x55555555);
+			num_animated_translations += count_set_bits(translation_sub_track_types_ & 0xAAAAAAAA);
+			num_constant_scales += count_set_bits(scale_sub_track_types_ & 0x55555555);
+			num_animated_scales += count_set_bits(scale_sub_track_types_ & 0xAAAAAAAA);
+		}
+
+		// Record, for every segment, how many bits precede each animated group within a key frame
+		// We point both key frames to the start of the segment and skip one group at a time
+		const bool has_stripped_segment_headers = tracks.has_database() || tracks.has_stripped_keyframes();
+		const uint8_t* segment_headers = has_stripped_segment_headers ? reinterpret_cast<const uint8_t*>(transform_header.get_stripped_segment_headers()) : reinterpret_cast<const uint8_t*>(transform_header.get_segment_headers());
+		const size_t segment_header_size = has_stripped_segment_headers ? sizeof(acl_impl::stripped_segment_header_t) : sizeof(acl_impl::segment_header);
+
+		for (uint32_t segment_index = 0; segment_index < num_segments; ++segment_index)
+		{
+			// Nasty but safe since they have the same layout
+			const acl_impl::segment_header* segment_header_ = reinterpret_cast<const acl_impl::segment_header*>(segment_headers + (segment_index * segment_header_size));
+
+			transform_header.get_segment_data(*segment_header_, context.format_per_track_data[0], context.segment_range_data[0], context.animated_track_data[0]);
+			context.format_per_track_data[1] = context.format_per_track_data[0];
+			context.segment_range_data[1] = context.segment_range_data[0];
+			context.animated_track_data[1] = context.animated_track_data[0];
+			context.key_frame_bit_offsets[0] = 0;
+			context.key_frame_bit_offsets[1] = 0;
+			context.segment_offsets[0] = ptr_offset32<acl_impl::segment_header>(&tracks, segment_header_);
+			context.segment_offsets[1] = context.segment_offsets[0];
+			context.uses_single_segment = true;
+
+			acl_impl::animated_track_cache_v0 animated_track_cache;
+			animated_track_cache.initialize<decompression_settings_type, translation_adapter>(context);
+
+			uint32_t* segment_group_bit_offsets = group_bit_offsets + (segment_index * num_groups);
+
+			const uint32_t rotation_bit_offset = animated_track_cache.segment_sampling_context_rotations[0].animated_track_data_bit_offset;
+			for (uint32_t group_index = 0; group_index < num_rotation_groups; ++group_index)
+			{
+				if (group_index != 0)
+					animated_track_cache.skip_rotation_groups<decompression_settings_type>(context, 1);
+
+				segment_group_bit_offsets[group_index] = animated_track_cache.segment_sampling_context_rotations[0].animated_track_data_bit_offset - rotation_bit_offset;
+			}
+
+			segment_group_bit_offsets += num_rotation_groups;
+
+			const uint32_t translation_bit_offset = animated_track_cache.segment_sampling_context_translations[0].animated_track_data_bit_offset;
+			for (uint32_t group_index = 0; group_index < num_translation_groups; ++group_index)
+			{
+				if (group_index != 0)
+					animated_track_cache.skip_translation_groups<translation_adapter>(context, 1);
+
+				segment_group_bit_offsets[group_index] = animated_track_cache.segment_sampling_context_translations[0].animated_track_data_bit_offset - translation_bit_offset;
+			}
+
+			segment_group_bit_offsets += num_translation_groups;
+
+			// The scale sampling context is only initialized when we have scale
+			if (num_scale_groups != 0)
+			{
+				const uint32_t scale_bit_offset = animated_track_cache.segment_sampling_context_scales[0].animated_track_data_bit_offset;
+				for (uint32_t group_index = 0; group_index < num_scale_groups; ++group_index)
+				{
+					if (group_index != 0)
+						animated_track_cache.skip_scale_groups<scale_adapter>(context, 1);
+
+					segment_group_bit_offsets[group_index] = animated_track_cache.segment_sampling_context_scales[0].animated_track_data_bit_offset - scale_bit_offset;
+				}
+			}
+		}
+
+		m_allocator = &allocator;
+		m_tracks = &tracks;
+		m_buffer = buffer;
+		m_buffer_size = buffer_size;
+		m_tracks_hash = tracks.get_hash();
+
+		m_offsets.sub_track_counts = sub_track_counts;
+		m_offsets.group_bit_offsets = group_bit_offsets;
+		m_offsets.num_rotation_groups = num_rotation_groups;
+		m_offsets.num_translation_groups = num_translation_groups;
+		m_offsets.num_scale_groups = num_scale_groups;
+
+		return true;
+	}
+
+	inline void track_offset_table::reset()
+	{
+		if (m_buffer != nullptr)
+			deallocate_type_array(*m_allocator, m_buffer, m_buffer_size);
+
+		m_allocator = nullptr;
+		m_tracks = nullptr;
+		m_buffer = nullptr;
+		m_buffer_size = 0;
+		m_tracks_hash = 0;
+		m_offsets = acl_impl::track_offset_table_v0();
+	}
+
+	inline bool track_offset_table::is_bound_to(const compressed_tracks& tracks) const
+	{
+		if (m_tracks != &tracks)
+			return false;	// Different pointer, no guarantees
+
+		if (m_tracks_hash != tracks.get_hash())
+			return false;	// Different hash
+
+		return true;
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
@@ -0,0 +1,172 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "acl/version.h"
+#include "acl/core/bit_manip_utils.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/error.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/interpolation_utils.h"
+#include "acl/core/track_types.h"
+#include "acl/core/track_writer.h"
+#include "acl/core/impl/compressed_headers.h"
+#include "acl/decompression/impl/transform_decompression_context.h"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	inline track_rounding_table::track_rounding_table()
+		: m_allocator(nullptr)
+		, m_tracks(nullptr)
+		, m_group_masks(nullptr)
+		, m_num_groups(0)
+		, m_tracks_hash(0)
+		, m_groups()
+	{
+	}
+
+	inline track_rounding_table::~track_rounding_table()
+	{
+		reset();
+	}
+
+	template<class track_writer_type>
+	inline bool track_rounding_table::initialize(iallocator& allocator, const compressed_tracks& tracks, track_writer_type& writer)
+	{
+		static_assert(std::is_base_of<track_writer, track_writer_type>::value, "track_writer_type must derive from track_writer");
+
+		reset();
+
+		if (tracks.get_track_type() != track_type8::qvvf)
+			return false;	// Only transform tracks are supported
+
+		const acl_impl::tracks_header& header = acl_impl::get_tracks_header(tracks);
+		const acl_impl::transform_tracks_header& transform_header = acl_impl::get_transform_tracks_header(tracks);
+
+		const uint32_t num_tracks = header.num_tracks;
+		const uint32_t num_sub_track_entries = (num_tracks + acl_impl::k_num_sub_tracks_per_packed_entry - 1) / acl_impl::k_num_sub_tracks_per_packed_entry;
+
+		const uint32_t num_rotation_groups = (transform_header.num_animated_rotation_sub_tracks + 3) / 4;
+		const uint32_t num_translation_groups = (transform_header.num_animated_translation_sub_tracks + 3) / 4;
+		const uint32_t num_scale_groups = (transform_header.num_animated_scale_sub_tracks + 3) / 4;
+		const uint32_t num_groups = num_rotation_groups + num_translation_groups + num_scale_groups;
+
+		uint16_t* group_masks = num_groups != 0 ? allocate_type_array<uint16_t>(allocator, num_groups) : nullptr;
+
+		// Animated sub-tracks are grouped by 4 in the order they appear, see unpack_animated_rotation_sub_tracks(..)
+		const auto build_groups = [&](const acl_impl::packed_sub_track_types* sub_track_types, uint32_t num_type_groups, uint16_t* type_group_masks)
+		{
+			for (uint32_t group_index = 0; group_index < num_type_groups; ++group_index)
+				type_group_masks[group_index] = 0;
+
+			uint32_t animated_index = 0;
+			for (uint32_t entry_index = 0; entry_index < num_sub_track_entries; ++entry_index)
+			{
+				// Mask out everything but animated sub-tracks, padding sub-tracks are default
+				uint32_t packed_entry = and_not(~0xAAAAAAAAU, sub_track_types[entry_index].types);
+				const uint32_t entry_track_index = entry_index * acl_impl::k_num_sub_tracks_per_packed_entry;
+
+				while (packed_entry != 0)
+				{
+					const uint32_t num_leading_zeros = count_leading_zeros(packed_entry);
+					packed_entry &= ~(0x80000000U >> num_leading_zeros);
+
+					const uint32_t track_index = entry_track_index + (num_leading_zeros / 2);
+					const sample_rounding_policy rounding_policy = writer.get_rounding_policy(sample_rounding_policy::per_track, track_index);
+					ACL_ASSERT(rounding_policy != sample_rounding_policy::per_track, "track_writer::get_rounding_policy() cannot return per_track");
+
+					// Sub-tracks that interpolate do not have a bit set
+					const uint32_t lane_index = animated_index % 4;
+					uint32_t lane_mask = 0;
+					if (rounding_policy == sample_rounding_policy::floor)
+						lane_mask = 1U << lane_index;
+					else if (rounding_policy == sample_rounding_policy::ceil)
+						lane_mask = 1U << (lane_index + 4);
+					else if (rounding_policy == sample_rounding_policy::nearest)
+						lane_mask = 1U << (lane_index + 8);
+
+					type_group_masks[animated_index / 4] |= uint16_t(lane_mask);
+					animated_index++;
+				}
+			}
+
+			ACL_ASSERT(((animated_index + 3) / 4) == num_type_groups, "Unexpected number of animated groups");
+		};
+
+		const acl_impl::packed_sub_track_types* rotation_sub_track_types = transform_header.get_sub_track_types();
+		const acl_impl::packed_sub_track_types* translation_sub_track_types = rotation_sub_track_types + num_sub_track_entries;
+		const acl_impl::packed_sub_track_types* scale_sub_track_types = translation_sub_track_types + num_sub_track_entries;
+
+		build_groups(rotation_sub_track_types, num_rotation_groups, group_masks);
+		build_groups(translation_sub_track_types, num_translation_groups, group_masks + num_rotation_groups);
+
+		// Scale sub-track types are only present when we have scale
+		if (num_scale_groups != 0)
+			build_groups(scale_sub_track_types, num_scale_groups, group_masks + num_rotation_groups + num_translation_groups);
+
+		m_allocator = &allocator;
+		m_tracks = &tracks;
+		m_group_masks = group_masks;
+		m_num_groups = num_groups;
+		m_tracks_hash = tracks.get_hash();
+
+		m_groups.group_masks = group_masks;
+		m_groups.num_rotation_groups = num_rotation_groups;
+		m_groups.num_translation_groups = num_translation_groups;
+		m_groups.num_scale_groups = num_scale_groups;
+
+		return true;
+	}
+
+	inline void track_rounding_table::reset()
+	{
+		if (m_group_masks != nullptr)
+			deallocate_type_array(*m_allocator, m_group_masks, m_num_groups);
+
+		m_allocator = nullptr;
+		m_tracks = nullptr;
+		m_group_masks = nullptr;
+		m_num_groups = 0;
+		m_tracks_hash = 0;
+		m_groups = acl_impl::track_rounding_table_v0();
+	}
+
+	inline bool track_rounding_table::is_bound_to(const compressed_tracks& tracks) const
+	{
+		if (m_tracks != &tracks)
+			return false;	// Different pointer, no guarantees
+
+		if (m_tracks_hash != tracks.get_hash())
+			return false;	// Different hash
+
+		return true;
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
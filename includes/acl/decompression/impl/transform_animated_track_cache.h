@@ -26,9 +26,14 @@
 
 #include "acl/version.h"
 #include "acl/core/impl/compiler_utils.h"
+#include "acl/core/range_reduction_types.h"
+#include "acl/core/impl/variable_bit_rates.h"
 #include "acl/decompression/impl/track_cache.h"
 #include "acl/decompression/impl/transform_decompression_context.h"
+#include "acl/decompression/impl/transform_keyframe_cache.h"
+#include "acl/math/quat_packing.h"
 #include "acl/math/quatf.h"
+#include "acl/math/vector4_packing.h"
 #include "acl/math/vector4f.h"
 
 #include <rtm/mask4f.h>
@@ -110,6 +115,7 @@ namespace acl
 			// This is because we always process 4 animated sub-tracks at a time and cache the results.
 
 			const uint8_t* clip_range_data;				// Range information of the current sub-track in the clip
+			bool are_clip_ranges_quantized;				// Whether the clip range min/extent are stored on 16 bits per component (rotations only)
 		};
 
 		struct segment_animated_sampling_context_v0
@@ -296,6 +302,39 @@ namespace acl
 #endif
 		}
 
+		// Copies the unpacked range data of the first segment into the persistent segment range cache
+		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void store_segment_range_data(const segment_animated_scratch_v0& segment_scratch, rtm::vector4f* cached_range_data)
+		{
+			cached_range_data[0] = segment_scratch.segment_range_min[0];
+			cached_range_data[1] = segment_scratch.segment_range_min[2];
+			cached_range_data[2] = segment_scratch.segment_range_min[4];
+			cached_range_data[3] = segment_scratch.segment_range_extent[0];
+			cached_range_data[4] = segment_scratch.segment_range_extent[2];
+			cached_range_data[5] = segment_scratch.segment_range_extent[4];
+		}
+
+		// Restores the range data of the first segment from the persistent segment range cache
+		// The layout matches what unpack_segment_range_data(..) writes for the first segment
+		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void load_segment_range_data(const rtm::vector4f* cached_range_data, segment_animated_scratch_v0& output_scratch)
+		{
+			output_scratch.segment_range_min[0] = cached_range_data[0];
+			output_scratch.segment_range_min[2] = cached_range_data[1];
+			output_scratch.segment_range_min[4] = cached_range_data[2];
+			output_scratch.segment_range_extent[0] = cached_range_data[3];
+			output_scratch.segment_range_extent[2] = cached_range_data[4];
+			output_scratch.segment_range_extent[4] = cached_range_data[5];
+
+#if defined(ACL_IMPL_USE_AVX_8_WIDE_DECOMP)
+			// The 8 wide code path expects the first segment data to be duplicated
+			output_scratch.segment_range_min[1] = cached_range_data[0];
+			output_scratch.segment_range_min[3] = cached_range_data[1];
+			output_scratch.segment_range_min[5] = cached_range_data[2];
+			output_scratch.segment_range_extent[1] = cached_range_data[3];
+			output_scratch.segment_range_extent[3] = cached_range_data[4];
+			output_scratch.segment_range_extent[5] = cached_range_data[5];
+#endif
+		}
+
 		// About 19 cycles with AVX on Skylake
 		// Force inline this function, we only use it to keep the code readable
 		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void RTM_SIMD_CALL remap_segment_range_data4(const segment_animated_scratch_v0& segment_scratch, uint32_t scratch_offset, range_reduction_masks_t range_reduction_masks,
@@ -386,16 +425,46 @@ namespace acl
 		}
 #endif
 
+		// Force inline this function, we only use it to keep the code readable
+		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void RTM_SIMD_CALL load_clip_range_data4(const uint8_t* clip_range_data, uint32_t num_to_unpack, bool are_clip_ranges_quantized,
+			rtm::vector4f& out_min_xxxx, rtm::vector4f& out_min_yyyy, rtm::vector4f& out_min_zzzz,
+			rtm::vector4f& out_extent_xxxx, rtm::vector4f& out_extent_yyyy, rtm::vector4f& out_extent_zzzz)
+		{
+			if (are_clip_ranges_quantized)
+			{
+				// Always load 4x rotations, we might contain garbage in a few lanes but it's fine
+				const uint32_t load_size = num_to_unpack * sizeof(uint16_t);
+
+				out_min_xxxx = dequantize_rotation_clip_range_min(load_vector4_u16x4_unsafe(clip_range_data + load_size * 0));
+				out_min_yyyy = dequantize_rotation_clip_range_min(load_vector4_u16x4_unsafe(clip_range_data + load_size * 1));
+				out_min_zzzz = dequantize_rotation_clip_range_min(load_vector4_u16x4_unsafe(clip_range_data + load_size * 2));
+
+				out_extent_xxxx = dequantize_rotation_clip_range_extent(load_vector4_u16x4_unsafe(clip_range_data + load_size * 3));
+				out_extent_yyyy = dequantize_rotation_clip_range_extent(load_vector4_u16x4_unsafe(clip_range_data + load_size * 4));
+				out_extent_zzzz = dequantize_rotation_clip_range_extent(load_vector4_u16x4_unsafe(clip_range_data + load_size * 5));
+			}
+			else
+			{
+				// Always load 4x rotations, we might contain garbage in a few lanes but it's fine
+				const uint32_t load_size = num_to_unpack * sizeof(float);
+
+				out_min_xxxx = rtm::vector_load(clip_range_data + load_size * 0);
+				out_min_yyyy = rtm::vector_load(clip_range_data + load_size * 1);
+				out_min_zzzz = rtm::vector_load(clip_range_data + load_size * 2);
+
+				out_extent_xxxx = rtm::vector_load(clip_range_data + load_size * 3);
+				out_extent_yyyy = rtm::vector_load(clip_range_data + load_size * 4);
+				out_extent_zzzz = rtm::vector_load(clip_range_data + load_size * 5);
+			}
+		}
+
 		// About 24 cycles with AVX on Skylake
 		// Force inline this function, we only use it to keep the code readable
-		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void RTM_SIMD_CALL remap_clip_range_data4(const uint8_t* clip_range_data, uint32_t num_to_unpack,
+		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void RTM_SIMD_CALL remap_clip_range_data4(const uint8_t* clip_range_data, uint32_t num_to_unpack, bool are_clip_ranges_quantized,
 			range_reduction_masks_t range_reduction_masks0, range_reduction_masks_t range_reduction_masks1,
 			rtm::vector4f& xxxx0, rtm::vector4f& yyyy0, rtm::vector4f& zzzz0,
 			rtm::vector4f& xxxx1, rtm::vector4f& yyyy1, rtm::vector4f& zzzz1)
 		{
-			// Always load 4x rotations, we might contain garbage in a few lanes but it's fine
-			const uint32_t load_size = num_to_unpack * sizeof(float);
-
 #if defined(RTM_SSE2_INTRINSICS)
 			const __m128 clip_range_mask0 = _mm_castsi128_ps(_mm_unpackhi_epi16(range_reduction_masks0, range_reduction_masks0));
 			const __m128 clip_range_mask1 = _mm_castsi128_ps(_mm_unpackhi_epi16(range_reduction_masks1, range_reduction_masks1));
@@ -409,13 +478,15 @@ namespace acl
 			const rtm::mask4f clip_range_mask1 = rtm::mask_set((clip_range_mask_u32_1 & 0x000000FF) != 0, (clip_range_mask_u32_1 & 0x0000FF00) != 0, (clip_range_mask_u32_1 & 0x00FF0000) != 0, (clip_range_mask_u32_1 & 0xFF000000) != 0);
 #endif
 
-			const rtm::vector4f clip_range_min_xxxx = rtm::vector_load(clip_range_data + load_size * 0);
-			const rtm::vector4f clip_range_min_yyyy = rtm::vector_load(clip_range_data + load_size * 1);
-			const rtm::vector4f clip_range_min_zzzz = rtm::vector_load(clip_range_data + load_size * 2);
-
-			const rtm::vector4f clip_range_extent_xxxx = rtm::vector_load(clip_range_data + load_size * 3);
-			const rtm::vector4f clip_range_extent_yyyy = rtm::vector_load(clip_range_data + load_size * 4);
-			const rtm::vector4f clip_range_extent_zzzz = rtm::vector_load(clip_range_data + load_size * 5);
+			rtm::vector4f clip_range_min_xxxx;
+			rtm::vector4f clip_range_min_yyyy;
+			rtm::vector4f clip_range_min_zzzz;
+			rtm::vector4f clip_range_extent_xxxx;
+			rtm::vector4f clip_range_extent_yyyy;
+			rtm::vector4f clip_range_extent_zzzz;
+			load_clip_range_data4(clip_range_data, num_to_unpack, are_clip_ranges_quantized,
+				clip_range_min_xxxx, clip_range_min_yyyy, clip_range_min_zzzz,
+				clip_range_extent_xxxx, clip_range_extent_yyyy, clip_range_extent_zzzz);
 
 			// Mask out the clip ranges we ignore
 #if defined(RTM_SSE2_INTRINSICS)
@@ -467,27 +538,26 @@ namespace acl
 
 #if defined(ACL_IMPL_USE_AVX_8_WIDE_DECOMP)
 		// Force inline this function, we only use it to keep the code readable
-		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void RTM_SIMD_CALL remap_clip_range_data_avx8(const uint8_t* clip_range_data, uint32_t num_to_unpack,
+		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void RTM_SIMD_CALL remap_clip_range_data_avx8(const uint8_t* clip_range_data, uint32_t num_to_unpack, bool are_clip_ranges_quantized,
 			range_reduction_masks_t range_reduction_masks0, range_reduction_masks_t range_reduction_masks1,
 			__m256& xxxx0_xxxx1, __m256& yyyy0_yyyy1, __m256& zzzz0_zzzz1)
 		{
 			const __m256 one_v = _mm256_set1_ps(1.0F);
 
-			// Always load 4x rotations, we might contain garbage in a few lanes but it's fine
-			const uint32_t load_size = num_to_unpack * sizeof(float);
-
 			const __m128 clip_range_mask0 = _mm_castsi128_ps(_mm_unpackhi_epi16(range_reduction_masks0, range_reduction_masks0));
 			const __m128 clip_range_mask1 = _mm_castsi128_ps(_mm_unpackhi_epi16(range_reduction_masks1, range_reduction_masks1));
 
 			const __m256 clip_range_mask0_mask1 = _mm256_set_m128(clip_range_mask1, clip_range_mask0);
 
-			const rtm::vector4f clip_range_min_xxxx = rtm::vector_load(clip_range_data + load_size * 0);
-			const rtm::vector4f clip_range_min_yyyy = rtm::vector_load(clip_range_data + load_size * 1);
-			const rtm::vector4f clip_range_min_zzzz = rtm::vector_load(clip_range_data + load_size * 2);
-
-			const rtm::vector4f clip_range_extent_xxxx = rtm::vector_load(clip_range_data + load_size * 3);
-			const rtm::vector4f clip_range_extent_yyyy = rtm::vector_load(clip_range_data + load_size * 4);
-			const rtm::vector4f clip_range_extent_zzzz = rtm::vector_load(clip_range_data + load_size * 5);
+			rtm::vector4f clip_range_min_xxxx;
+			rtm::vector4f clip_range_min_yyyy;
+			rtm::vector4f clip_range_min_zzzz;
+			rtm::vector4f clip_range_extent_xxxx;
+			rtm::vector4f clip_range_extent_yyyy;
+			rtm::vector4f clip_range_extent_zzzz;
+			load_clip_range_data4(clip_range_data, num_to_unpack, are_clip_ranges_quantized,
+				clip_range_min_xxxx, clip_range_min_yyyy, clip_range_min_zzzz,
+				clip_range_extent_xxxx, clip_range_extent_yyyy, clip_range_extent_zzzz);
 
 			__m256 clip_range_min_xxxx_xxxx = _mm256_set_m128(clip_range_min_xxxx, clip_range_min_xxxx);
 			__m256 clip_range_min_yyyy_yyyy = _mm256_set_m128(clip_range_min_yyyy, clip_range_min_yyyy);
@@ -522,6 +592,9 @@ namespace acl
 			// See write_format_per_track_data(..) for details
 			const uint32_t num_raw_bit_rate_bits = version >= compressed_tracks_version16::v02_01_99_1 ? 31 : 32;
 
+			// Rotations that drop their largest component also store which one in the upper bits of the metadata
+			const uint32_t num_bits_metadata_mask = is_rotation_format_drop_largest_supported<decompression_settings_type>(rotation_format) ? k_num_bits_metadata_mask : 0xFF;
+
 			uint32_t segment_range_ignore_mask = 0;
 			uint32_t clip_range_ignore_mask = 0;
 
@@ -542,9 +615,9 @@ namespace acl
 				// Our decompressed rotation as a vector4
 				rtm::vector4f rotation_as_vec;
 
-				if (rotation_format == rotation_format8::quatf_drop_w_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable))
+				if (is_rotation_format_variable_supported<decompression_settings_type>(rotation_format))
 				{
-					const uint32_t num_bits_at_bit_rate = format_per_track_data[unpack_index];
+					const uint32_t num_bits_at_bit_rate = format_per_track_data[unpack_index] & num_bits_metadata_mask;
 
 					uint32_t sample_segment_range_ignore_mask;
 					uint32_t sample_clip_range_ignore_mask;
@@ -639,7 +712,7 @@ namespace acl
 #endif
 
 			// Update our pointers
-			if (rotation_format == rotation_format8::quatf_drop_w_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable))
+			if (is_rotation_format_variable_supported<decompression_settings_type>(rotation_format))
 			{
 #if defined(ACL_IMPL_PREFETCH_EARLY)
 				// Prefetch the next cache line in all levels of the CPU cache
@@ -654,7 +727,7 @@ namespace acl
 
 			range_reduction_masks_t range_reduction_masks;	// function's return value
 
-			if (rotation_format == rotation_format8::quatf_drop_w_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable))
+			if (is_rotation_format_variable_supported<decompression_settings_type>(rotation_format))
 			{
 #if defined(RTM_SSE2_INTRINSICS)
 				const __m128i ignore_masks_v8 = _mm_set_epi32(0, 0, clip_range_ignore_mask, segment_range_ignore_mask);
@@ -697,6 +770,9 @@ namespace acl
 			// See write_format_per_track_data(..) for details
 			const uint32_t num_raw_bit_rate_bits = version >= compressed_tracks_version16::v02_01_99_1 ? 31 : 32;
 
+			// Rotations that drop their largest component also store which one in the upper bits of the metadata
+			const uint32_t num_bits_metadata_mask = is_rotation_format_drop_largest_supported<decompression_settings_type>(rotation_format) ? k_num_bits_metadata_mask : 0xFF;
+
 			uint32_t segment_range_ignore_mask = 0;
 			uint32_t clip_range_ignore_mask = 0;
 
@@ -707,7 +783,7 @@ namespace acl
 
 			// Unpack sample
 			rtm::vector4f rotation_as_vec;
-			if (rotation_format == rotation_format8::quatf_drop_w_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable))
+			if (is_rotation_format_variable_supported<decompression_settings_type>(rotation_format))
 			{
 				// Fall-through intentional
 				uint32_t skip_size = 0;
@@ -717,19 +793,19 @@ namespace acl
 				case 3:
 				{
 					// TODO: Can we do an alternate more efficient implementation? We want to increment by one if num bits == 31
-					const uint32_t num_bits_at_bit_rate = format_per_track_data[2];
+					const uint32_t num_bits_at_bit_rate = format_per_track_data[2] & num_bits_metadata_mask;
 					skip_size += (num_bits_at_bit_rate == num_raw_bit_rate_bits) ? 32 : num_bits_at_bit_rate;
 				}
 					ACL_SWITCH_CASE_FALLTHROUGH_INTENTIONAL;
 				case 2:
 				{
-					const uint32_t num_bits_at_bit_rate = format_per_track_data[1];
+					const uint32_t num_bits_at_bit_rate = format_per_track_data[1] & num_bits_metadata_mask;
 					skip_size += (num_bits_at_bit_rate == num_raw_bit_rate_bits) ? 32 : num_bits_at_bit_rate;
 				}
 					ACL_SWITCH_CASE_FALLTHROUGH_INTENTIONAL;
 				case 1:
 				{
-					const uint32_t num_bits_at_bit_rate = format_per_track_data[0];
+					const uint32_t num_bits_at_bit_rate = format_per_track_data[0] & num_bits_metadata_mask;
 					skip_size += (num_bits_at_bit_rate == num_raw_bit_rate_bits) ? 32 : num_bits_at_bit_rate;
 				}
 					ACL_SWITCH_CASE_FALLTHROUGH_INTENTIONAL;
@@ -741,7 +817,7 @@ namespace acl
 				// Skip prior samples
 				animated_track_data_bit_offset += skip_size * 3;
 
-				const uint32_t num_bits_at_bit_rate = format_per_track_data[unpack_index];
+				const uint32_t num_bits_at_bit_rate = format_per_track_data[unpack_index] & num_bits_metadata_mask;
 
 				if (num_bits_at_bit_rate == 0)	// Constant bit rate
 				{
@@ -808,7 +884,7 @@ namespace acl
 			}
 
 			// Remap within our ranges
-			if (rotation_format == rotation_format8::quatf_drop_w_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable))
+			if (is_rotation_format_variable_supported<decompression_settings_type>(rotation_format))
 			{
 				if (decomp_context.has_segments && segment_range_ignore_mask == 0)
 				{
@@ -847,7 +923,23 @@ namespace acl
 					rotation_as_vec = rtm::vector_mul_add(rotation_as_vec, segment_range_extent, segment_range_min);
 				}
 
-				if (clip_range_ignore_mask == 0)
+				if (clip_range_ignore_mask == 0 && clip_sampling_context.are_clip_ranges_quantized)
+				{
+					const uint16_t* clip_range_data = reinterpret_cast<const uint16_t*>(clip_sampling_context.clip_range_data) + unpack_index;	// Offset to our sample
+
+					const uint16_t min_x = clip_range_data[group_size * 0];
+					const uint16_t min_y = clip_range_data[group_size * 1];
+					const uint16_t min_z = clip_range_data[group_size * 2];
+					const rtm::vector4f clip_range_min = dequantize_rotation_clip_range_min(rtm::vector_set(float(min_x), float(min_y), float(min_z), 0.0F));
+
+					const uint16_t extent_x = clip_range_data[group_size * 3];
+					const uint16_t extent_y = clip_range_data[group_size * 4];
+					const uint16_t extent_z = clip_range_data[group_size * 5];
+					const rtm::vector4f clip_range_extent = dequantize_rotation_clip_range_extent(rtm::vector_set(float(extent_x), float(extent_y), float(extent_z), 0.0F));
+
+					rotation_as_vec = rtm::vector_mul_add(rotation_as_vec, clip_range_extent, clip_range_min);
+				}
+				else if (clip_range_ignore_mask == 0)
 				{
 					const float* clip_range_data = reinterpret_cast<const float*>(clip_sampling_context.clip_range_data) + unpack_index;	// Offset to our sample
 
@@ -868,6 +960,20 @@ namespace acl
 			return rotation_as_vec;
 		}
 
+		// Returns the number of bits used by an animated vector3 sample when each component has its own number of bits
+		// See get_component_num_bits(..) for details
+		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK uint32_t get_animated_vector3_per_component_bit_size(uint32_t num_bits_at_bit_rate, uint32_t num_raw_bit_rate_bits, const uint8_t* bit_rate_reductions)
+		{
+			if (num_bits_at_bit_rate == 0)	// Constant bit rate
+				return 0;
+			else if (num_bits_at_bit_rate == num_raw_bit_rate_bits)	// Raw bit rate
+				return 96;
+
+			return get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[0])
+				+ get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[1])
+				+ get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[2]);
+		}
+
 		template<class decompression_settings_adapter_type>
 		inline RTM_DISABLE_SECURITY_COOKIE_CHECK void unpack_animated_vector3(const persistent_transform_decompression_context_v0& decomp_context, rtm::vector4f output_scratch[4],
 			uint32_t num_to_unpack,
@@ -886,6 +992,10 @@ namespace acl
 
 			const uint8_t* clip_range_data = clip_sampling_context.clip_range_data;
 
+			// Formats with a variable number of bits per component store them after the clip range min/extent
+			const bool are_components_variable = is_vector_format_per_component_supported<decompression_settings_adapter_type>(format);
+			const uint32_t clip_range_entry_size = get_range_reduction_vector_size(format);
+
 			for (uint32_t unpack_index = 0; unpack_index < num_to_unpack; ++unpack_index)
 			{
 				// Range ignore flags are used to skip range normalization at the clip and/or segment levels
@@ -895,7 +1005,7 @@ namespace acl
 				uint32_t range_ignore_flags;
 
 				rtm::vector4f sample;
-				if (format == vector_format8::vector3f_variable && decompression_settings_adapter_type::is_vector_format_supported(vector_format8::vector3f_variable))
+				if (is_vector_format_variable_supported<decompression_settings_adapter_type>(format))
 				{
 					const uint32_t num_bits_at_bit_rate = *format_per_track_data;
 					format_per_track_data++;
@@ -913,6 +1023,21 @@ namespace acl
 						segment_range_data += sizeof(uint16_t) * 3;	// Raw bit rates have unused range data, skip it
 						range_ignore_flags = 0x03;	// Skip clip and segment
 					}
+					else if (are_components_variable)
+					{
+						const uint8_t* bit_rate_reductions = clip_range_data + (clip_range_entry_size * unpack_index) + k_clip_range_reduction_vector3_range_size;
+						const uint32_t num_bits_x = get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[0]);
+						const uint32_t num_bits_y = get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[1]);
+						const uint32_t num_bits_z = get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[2]);
+
+						// Uniform sub-tracks only store their X component, the others have no bits
+						if (is_vector3_uniform(bit_rate_reductions))
+							sample = unpack_vector3_uniform_uXX_unsafe(num_bits_x, animated_track_data, animated_track_data_bit_offset);
+						else
+							sample = unpack_vector3_uXYZ_unsafe(num_bits_x, num_bits_y, num_bits_z, animated_track_data, animated_track_data_bit_offset);
+						animated_track_data_bit_offset += num_bits_x + num_bits_y + num_bits_z;
+						range_ignore_flags = 0x00;	// Don't skip range reduction
+					}
 					else
 					{
 						sample = unpack_vector3_uXX_unsafe(num_bits_at_bit_rate, animated_track_data, animated_track_data_bit_offset);
@@ -928,7 +1053,7 @@ namespace acl
 				}
 
 				// Remap within our ranges
-				if (format == vector_format8::vector3f_variable && decompression_settings_adapter_type::is_vector_format_supported(vector_format8::vector3f_variable))
+				if (is_vector_format_variable_supported<decompression_settings_adapter_type>(format))
 				{
 					if (decomp_context.has_segments && (range_ignore_flags & 0x01) == 0)
 					{
@@ -948,7 +1073,7 @@ namespace acl
 					{
 						// Apply clip range remapping
 						const uint32_t range_entry_size = 3 * sizeof(float);
-						const uint32_t sub_track_offset = range_entry_size * 2 * unpack_index;
+						const uint32_t sub_track_offset = clip_range_entry_size * unpack_index;
 						const uint8_t* clip_range_min_ptr = clip_range_data + sub_track_offset;
 						const uint8_t* clip_range_extent_ptr = clip_range_min_ptr + range_entry_size;
 
@@ -1007,6 +1132,10 @@ namespace acl
 
 			const uint8_t* clip_range_data = clip_sampling_context.clip_range_data;
 
+			// Formats with a variable number of bits per component store them after the clip range min/extent
+			const bool are_components_variable = is_vector_format_per_component_supported<decompression_settings_adapter_type>(format);
+			const uint32_t clip_range_entry_size = get_range_reduction_vector_size(format);
+
 			// Range ignore flags are used to skip range normalization at the clip and/or segment levels
 			// Each sample has two bits like so:
 			//    - 0x01 = ignore segment level
@@ -1014,41 +1143,54 @@ namespace acl
 			uint32_t range_ignore_flags;
 
 			rtm::vector4f sample;
-			if (format == vector_format8::vector3f_variable && decompression_settings_adapter_type::is_vector_format_supported(vector_format8::vector3f_variable))
+			if (is_vector_format_variable_supported<decompression_settings_adapter_type>(format))
 			{
-				// Fall-through intentional
-				uint32_t skip_size = 0;
-				switch (unpack_index)
-				{
-				default:
-				case 3:
+				if (are_components_variable)
 				{
-					// TODO: Can we do an alternate more efficient implementation? We want to increment by one if num bits == 31
-					const uint32_t num_bits_at_bit_rate = format_per_track_data[2];
-					skip_size += (num_bits_at_bit_rate == num_raw_bit_rate_bits) ? 32 : num_bits_at_bit_rate;
-				}
-					ACL_SWITCH_CASE_FALLTHROUGH_INTENTIONAL;
-				case 2:
-				{
-					const uint32_t num_bits_at_bit_rate = format_per_track_data[1];
-					skip_size += (num_bits_at_bit_rate == num_raw_bit_rate_bits) ? 32 : num_bits_at_bit_rate;
+					// Every component has its own number of bits, add them up for every prior sample
+					for (uint32_t sub_track_index = 0; sub_track_index < unpack_index; ++sub_track_index)
+					{
+						const uint8_t* bit_rate_reductions = clip_range_data + (clip_range_entry_size * sub_track_index) + k_clip_range_reduction_vector3_range_size;
+						animated_track_data_bit_offset += get_animated_vector3_per_component_bit_size(format_per_track_data[sub_track_index], num_raw_bit_rate_bits, bit_rate_reductions);
+					}
 				}
-					ACL_SWITCH_CASE_FALLTHROUGH_INTENTIONAL;
-				case 1:
+				else
 				{
-					const uint32_t num_bits_at_bit_rate = format_per_track_data[0];
-					skip_size += (num_bits_at_bit_rate == num_raw_bit_rate_bits) ? 32 : num_bits_at_bit_rate;
-				}
-					ACL_SWITCH_CASE_FALLTHROUGH_INTENTIONAL;
-				case 0:
-					// Nothing to skip
-					(void)skip_size;
+					// Fall-through intentional
+					uint32_t skip_size = 0;
+					switch (unpack_index)
+					{
+					default:
+					case 3:
+					{
+						// TODO: Can we do an alternate more efficient implementation? We want to increment by one if num bits == 31
+						const uint32_t num_bits_at_bit_rate = format_per_track_data[2];
+						skip_size += (num_bits_at_bit_rate == num_raw_bit_rate_bits) ? 32 : num_bits_at_bit_rate;
+					}
+						ACL_SWITCH_CASE_FALLTHROUGH_INTENTIONAL;
+					case 2:
+					{
+						const uint32_t num_bits_at_bit_rate = format_per_track_data[1];
+						skip_size += (num_bits_at_bit_rate == num_raw_bit_rate_bits) ? 32 : num_bits_at_bit_rate;
+					}
+						ACL_SWITCH_CASE_FALLTHROUGH_INTENTIONAL;
+					case 1:
+					{
+						const uint32_t num_bits_at_bit_rate = format_per_track_data[0];
+						skip_size += (num_bits_at_bit_rate == num_raw_bit_rate_bits) ? 32 : num_bits_at_bit_rate;
+					}
+						ACL_SWITCH_CASE_FALLTHROUGH_INTENTIONAL;
+					case 0:
+						// Nothing to skip
+						(void)skip_size;
+					}
+
+					// Skip prior samples
+					animated_track_data_bit_offset += skip_size * 3;
 				}
 
-				// Skip prior samples
-				animated_track_data_bit_offset += skip_size * 3;
 				segment_range_data += sizeof(uint8_t) * 6 * unpack_index;
-				clip_range_data += sizeof(rtm::float3f) * 2 * unpack_index;
+				clip_range_data += clip_range_entry_size * unpack_index;
 
 				const uint32_t num_bits_at_bit_rate = format_per_track_data[unpack_index];
 
@@ -1062,6 +1204,20 @@ namespace acl
 					sample = unpack_vector3_96_unsafe(animated_track_data, animated_track_data_bit_offset);
 					range_ignore_flags = 0x03;	// Skip clip and segment
 				}
+				else if (are_components_variable)
+				{
+					const uint8_t* bit_rate_reductions = clip_range_data + k_clip_range_reduction_vector3_range_size;
+					const uint32_t num_bits_x = get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[0]);
+					const uint32_t num_bits_y = get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[1]);
+					const uint32_t num_bits_z = get_component_num_bits(num_bits_at_bit_rate, bit_rate_reductions[2]);
+
+					// Uniform sub-tracks only store their X component, the others have no bits
+					if (is_vector3_uniform(bit_rate_reductions))
+						sample = unpack_vector3_uniform_uXX_unsafe(num_bits_x, animated_track_data, animated_track_data_bit_offset);
+					else
+						sample = unpack_vector3_uXYZ_unsafe(num_bits_x, num_bits_y, num_bits_z, animated_track_data, animated_track_data_bit_offset);
+					range_ignore_flags = 0x00;	// Don't skip range reduction
+				}
 				else
 				{
 					sample = unpack_vector3_uXX_unsafe(num_bits_at_bit_rate, animated_track_data, animated_track_data_bit_offset);
@@ -1076,7 +1232,7 @@ namespace acl
 			}
 
 			// Remap within our ranges
-			if (format == vector_format8::vector3f_variable && decompression_settings_adapter_type::is_vector_format_supported(vector_format8::vector3f_variable))
+			if (is_vector_format_variable_supported<decompression_settings_adapter_type>(format))
 			{
 				if (decomp_context.has_segments && (range_ignore_flags & 0x01) == 0)
 				{
@@ -1105,7 +1261,7 @@ namespace acl
 		template<class decompression_settings_adapter_type>
 		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void count_animated_group_bit_size(
 			const persistent_transform_decompression_context_v0& decomp_context,
-			const uint8_t* format_per_track_data0, const uint8_t* format_per_track_data1, uint32_t num_groups_to_skip,
+			const uint8_t* format_per_track_data0, const uint8_t* format_per_track_data1, uint32_t num_groups_to_skip, uint32_t num_bits_metadata_mask,
 			uint32_t& out_group_bit_size_per_component0, uint32_t& out_group_bit_size_per_component1)
 		{
 			const compressed_tracks_version16 version = get_version<decompression_settings_adapter_type>(decomp_context.get_version());
@@ -1117,6 +1273,7 @@ namespace acl
 #if defined(RTM_AVX_INTRINSICS)
 			const __m128i zero = _mm_setzero_si128();
 			const __m128i num_raw_bit_rate_bits_v = _mm_set1_epi32(num_raw_bit_rate_bits);
+			const __m128i num_bits_metadata_mask_v = _mm_set1_epi8(static_cast<char>(num_bits_metadata_mask));
 			__m128i group_bit_size_per_component0_v = zero;
 			__m128i group_bit_size_per_component1_v = zero;
 
@@ -1124,8 +1281,8 @@ namespace acl
 			for (uint32_t group_index = 0; group_index < num_groups_to_skip; ++group_index)
 			{
 				const uint32_t group_offset = group_index * 4;
-				const __m128i group_bit_size_per_component0_u8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(format_per_track_data0 + group_offset));
-				const __m128i group_bit_size_per_component1_u8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(format_per_track_data1 + group_offset));
+				const __m128i group_bit_size_per_component0_u8 = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(format_per_track_data0 + group_offset)), num_bits_metadata_mask_v);
+				const __m128i group_bit_size_per_component1_u8 = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(format_per_track_data1 + group_offset)), num_bits_metadata_mask_v);
 
 				// Unpack from uint8_t to uint32_t
 				__m128i group_bit_size_per_component0_u32 = _mm_unpacklo_epi16(_mm_unpacklo_epi8(group_bit_size_per_component0_u8, zero), zero);
@@ -1164,14 +1321,14 @@ namespace acl
 			{
 				// TODO: Can we do an alternate more efficient implementation? We want to increment by one if num bits == 31
 
-				const uint32_t num_bits_at_bit_rate_0_0 = format_per_track_data0[(group_index * 4) + 0];
-				const uint32_t num_bits_at_bit_rate_1_0 = format_per_track_data1[(group_index * 4) + 0];
-				const uint32_t num_bits_at_bit_rate_0_1 = format_per_track_data0[(group_index * 4) + 1];
-				const uint32_t num_bits_at_bit_rate_1_1 = format_per_track_data1[(group_index * 4) + 1];
-				const uint32_t num_bits_at_bit_rate_0_2 = format_per_track_data0[(group_index * 4) + 2];
-				const uint32_t num_bits_at_bit_rate_1_2 = format_per_track_data1[(group_index * 4) + 2];
-				const uint32_t num_bits_at_bit_rate_0_3 = format_per_track_data0[(group_index * 4) + 3];
-				const uint32_t num_bits_at_bit_rate_1_3 = format_per_track_data1[(group_index * 4) + 3];
+				const uint32_t num_bits_at_bit_rate_0_0 = format_per_track_data0[(group_index * 4) + 0] & num_bits_metadata_mask;
+				const uint32_t num_bits_at_bit_rate_1_0 = format_per_track_data1[(group_index * 4) + 0] & num_bits_metadata_mask;
+				const uint32_t num_bits_at_bit_rate_0_1 = format_per_track_data0[(group_index * 4) + 1] & num_bits_metadata_mask;
+				const uint32_t num_bits_at_bit_rate_1_1 = format_per_track_data1[(group_index * 4) + 1] & num_bits_metadata_mask;
+				const uint32_t num_bits_at_bit_rate_0_2 = format_per_track_data0[(group_index * 4) + 2] & num_bits_metadata_mask;
+				const uint32_t num_bits_at_bit_rate_1_2 = format_per_track_data1[(group_index * 4) + 2] & num_bits_metadata_mask;
+				const uint32_t num_bits_at_bit_rate_0_3 = format_per_track_data0[(group_index * 4) + 3] & num_bits_metadata_mask;
+				const uint32_t num_bits_at_bit_rate_1_3 = format_per_track_data1[(group_index * 4) + 3] & num_bits_metadata_mask;
 
 				group_bit_size_per_component0 += (num_bits_at_bit_rate_0_0 == num_raw_bit_rate_bits) ? 32 : num_bits_at_bit_rate_0_0;
 				group_bit_size_per_component1 += (num_bits_at_bit_rate_1_0 == num_raw_bit_rate_bits) ? 32 : num_bits_at_bit_rate_1_0;
@@ -1191,6 +1348,39 @@ namespace acl
 #endif
 		}
 
+		// Force inline this function, we only use it to keep the code readable
+		// Unlike count_animated_group_bit_size(..), this returns the total number of bits of the groups skipped
+		template<class decompression_settings_adapter_type>
+		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void count_animated_vector3_per_component_group_bit_size(
+			const persistent_transform_decompression_context_v0& decomp_context,
+			const uint8_t* format_per_track_data0, const uint8_t* format_per_track_data1, const uint8_t* clip_range_data, uint32_t num_groups_to_skip,
+			uint32_t& out_group_bit_size0, uint32_t& out_group_bit_size1)
+		{
+			const vector_format8 format = get_vector_format<decompression_settings_adapter_type>(decompression_settings_adapter_type::get_vector_format(decomp_context));
+
+			// Per component bit rates were introduced after we remapped the raw bit rate to 31
+			// See write_format_per_track_data(..) for details
+			const uint32_t num_raw_bit_rate_bits = 31;
+
+			// The bit rate reductions are stored after the clip range min/extent of every sub-track
+			const uint32_t clip_range_entry_size = get_range_reduction_vector_size(format);
+			const uint8_t* bit_rate_reductions = clip_range_data + k_clip_range_reduction_vector3_range_size;
+
+			uint32_t group_bit_size0 = 0;
+			uint32_t group_bit_size1 = 0;
+
+			const uint32_t num_sub_tracks_to_skip = num_groups_to_skip * 4;
+			for (uint32_t sub_track_index = 0; sub_track_index < num_sub_tracks_to_skip; ++sub_track_index)
+			{
+				group_bit_size0 += get_animated_vector3_per_component_bit_size(format_per_track_data0[sub_track_index], num_raw_bit_rate_bits, bit_rate_reductions);
+				group_bit_size1 += get_animated_vector3_per_component_bit_size(format_per_track_data1[sub_track_index], num_raw_bit_rate_bits, bit_rate_reductions);
+				bit_rate_reductions += clip_range_entry_size;
+			}
+
+			out_group_bit_size0 = group_bit_size0;
+			out_group_bit_size1 = group_bit_size1;
+		}
+
 		// Performance notes:
 		//    - Using SOA after unpacking vec3 appears to be slightly slower. Full groups aren't super common
 		//      because animated translation/scale isn't common. But even with clips with lots of full groups,
@@ -1220,6 +1410,35 @@ namespace acl
 			segment_animated_sampling_context_v0 segment_sampling_context_translations[2];
 			segment_animated_sampling_context_v0 segment_sampling_context_scales[2];
 
+			// Optional persistent key frame cache, null when unused
+			keyframe_cache_v0* keyframe_cache;
+
+			// Whether the cached key frames match the ones we interpolate
+			bool is_keyframe_cache_hit;
+
+			uint32_t num_keyframe_cache_groups_written;
+
+			// Optional persistent segment range cache, null when unused
+			rtm::vector4f* segment_range_cache;
+
+			// Whether the cached segment range data matches the segment we interpolate
+			bool is_segment_range_cache_hit;
+
+			uint32_t num_segment_range_groups_written;
+
+			// Which group we unpack next for each sub-track type
+			uint32_t keyframe_cache_rotation_group_index;
+			uint32_t keyframe_cache_translation_group_index;
+			uint32_t keyframe_cache_scale_group_index;
+
+			// Whether both key frames are the same, we then only unpack and return the first one
+			// This is the case when the rounding policy selects a single key frame (floor, ceil, nearest)
+			bool uses_single_key_frame;
+
+			// Optional precomputed per track rounding policies, null when unused
+			// When bound, only the 'none' cache entries are written and they contain the sample each sub-track needs
+			const track_rounding_table_v0* rounding_table;
+
 			template<class decompression_settings_type, class decompression_settings_translation_adapter_type>
 			void RTM_DISABLE_SECURITY_COOKIE_CHECK initialize(const persistent_transform_decompression_context_v0& decomp_context)
 			{
@@ -1234,6 +1453,9 @@ namespace acl
 
 				const uint8_t* clip_range_data_rotations = transform_header.get_clip_range_data();
 				clip_sampling_context_rotations.clip_range_data = clip_range_data_rotations;
+				clip_sampling_context_rotations.are_clip_ranges_quantized = get_tracks_header(*tracks).get_has_quantized_rotation_clip_ranges();
+				clip_sampling_context_translations.are_clip_ranges_quantized = false;
+				clip_sampling_context_scales.are_clip_ranges_quantized = false;
 
 				const uint8_t* format_per_track_data_rotations0 = decomp_context.format_per_track_data[0];
 				const uint8_t* segment_range_data_rotations0 = decomp_context.segment_range_data[0];
@@ -1252,12 +1474,12 @@ namespace acl
 				segment_sampling_context_rotations[1].animated_track_data_bit_offset = animated_track_data_bit_offset_rotations1;
 
 				const rotation_format8 rotation_format = get_rotation_format<decompression_settings_type>(decomp_context.rotation_format);
-				const bool are_rotations_variable = rotation_format == rotation_format8::quatf_drop_w_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable);
+				const bool are_rotations_variable = is_rotation_format_variable_supported<decompression_settings_type>(rotation_format);
 
 				const uint32_t num_animated_rotation_sub_tracks_padded = align_to(transform_header.num_animated_rotation_sub_tracks, 4);
 
 				// Rotation range data follows translations, no padding
-				const uint32_t rotation_clip_range_data_size = are_rotations_variable ? (sizeof(rtm::float3f) * 2) : 0;
+				const uint32_t rotation_clip_range_data_size = are_rotations_variable ? get_rotation_clip_range_entry_size(clip_sampling_context_rotations.are_clip_ranges_quantized) : 0;
 				const uint8_t* clip_range_data_translations = clip_range_data_rotations + (transform_header.num_animated_rotation_sub_tracks * rotation_clip_range_data_size);
 				clip_sampling_context_translations.clip_range_data = clip_range_data_translations;
 
@@ -1287,10 +1509,10 @@ namespace acl
 				if (decomp_context.has_scale)
 				{
 					const vector_format8 translation_format = get_vector_format<decompression_settings_translation_adapter_type>(decompression_settings_translation_adapter_type::get_vector_format(decomp_context));
-					const bool are_translations_variable = translation_format == vector_format8::vector3f_variable && decompression_settings_translation_adapter_type::is_vector_format_supported(vector_format8::vector3f_variable);
+					const bool are_translations_variable = is_vector_format_variable_supported<decompression_settings_translation_adapter_type>(translation_format);
 
 					// Scale data just follows the translation data without any extra padding
-					const uint32_t translation_clip_range_data_size = are_translations_variable ? (sizeof(rtm::float3f) * 2) : 0;
+					const uint32_t translation_clip_range_data_size = are_translations_variable ? get_range_reduction_vector_size(translation_format) : 0;
 					clip_sampling_context_scales.clip_range_data = clip_range_data_translations + (transform_header.num_animated_translation_sub_tracks * translation_clip_range_data_size);
 
 					const uint32_t translation_per_track_metadata_size = are_translations_variable ? 1 : 0;
@@ -1311,18 +1533,102 @@ namespace acl
 				rotations.num_left_to_unpack = transform_header.num_animated_rotation_sub_tracks;
 				translations.num_left_to_unpack = transform_header.num_animated_translation_sub_tracks;
 				scales.num_left_to_unpack = transform_header.num_animated_scale_sub_tracks;
+
+				keyframe_cache = nullptr;
+				is_keyframe_cache_hit = false;
+				num_keyframe_cache_groups_written = 0;
+				segment_range_cache = nullptr;
+				is_segment_range_cache_hit = false;
+				num_segment_range_groups_written = 0;
+				keyframe_cache_rotation_group_index = 0;
+				keyframe_cache_translation_group_index = 0;
+				keyframe_cache_scale_group_index = 0;
+
+				uses_single_key_frame = decomp_context.segment_offsets[0] == decomp_context.segment_offsets[1]
+					&& decomp_context.key_frame_bit_offsets[0] == decomp_context.key_frame_bit_offsets[1]
+					&& animated_track_data0 == animated_track_data1;
+
+				rounding_table = nullptr;
 			}
 
+			// Binds the precomputed per track rounding policies if we seeked with the per track rounding policy
 			template<class decompression_settings_type>
+			void RTM_DISABLE_SECURITY_COOKIE_CHECK bind_rounding_table(const persistent_transform_decompression_context_v0& decomp_context, const track_rounding_table_v0* table)
+			{
+				if (!decompression_settings_type::is_per_track_rounding_supported() || decomp_context.get_rounding_policy() != sample_rounding_policy::per_track)
+					return;	// Every track uses the seek policy, the interpolation alpha already accounts for it
+
+				rounding_table = table;
+			}
+
+			bool has_rounding_table() const { return rounding_table != nullptr; }
+
+			// Binds the persistent key frame cache if the context has one and if it can hold every animated sub-track
+			void RTM_DISABLE_SECURITY_COOKIE_CHECK bind_keyframe_cache(const persistent_transform_decompression_context_v0& decomp_context)
+			{
+				keyframe_cache_v0* cache = decomp_context.keyframe_cache;
+				if (cache == nullptr || decomp_context.db != nullptr)
+					return;	// No cache or we use a database which can stream in new data for the same key frames
+
+				const transform_tracks_header& transform_header = get_transform_tracks_header(*decomp_context.tracks);
+				const uint32_t max_num_sub_tracks = cache->max_num_groups * 4;
+				if (transform_header.num_animated_rotation_sub_tracks > max_num_sub_tracks
+					|| transform_header.num_animated_translation_sub_tracks > max_num_sub_tracks
+					|| transform_header.num_animated_scale_sub_tracks > max_num_sub_tracks)
+					return;	// Too many sub-tracks, bypass the cache
+
+				// The segment range data is only cached when we interpolate within a single segment
+				// It must be checked before the key frames are bound since they can invalidate it
+				if (cache->segment_range_samples != nullptr && decomp_context.has_segments && decomp_context.uses_single_segment)
+				{
+					is_segment_range_cache_hit = cache->is_segment_range_bound_to(decomp_context);
+					if (!is_segment_range_cache_hit)
+						cache->bind_segment_range_to(decomp_context);
+
+					segment_range_cache = cache->segment_range_samples;
+				}
+
+				is_keyframe_cache_hit = cache->is_bound_to(decomp_context);
+				if (!is_keyframe_cache_hit)
+					cache->bind_to(decomp_context);
+
+				keyframe_cache = cache;
+			}
+
+			// Once we are done unpacking, the key frame cache is only valid if every group made it in
+			// Groups can be skipped when tracks aren't needed by the track writer
+			void RTM_DISABLE_SECURITY_COOKIE_CHECK commit_keyframe_cache(const persistent_transform_decompression_context_v0& decomp_context)
+			{
+				if (keyframe_cache == nullptr || is_keyframe_cache_hit)
+					return;	// Nothing to do
+
+				const transform_tracks_header& transform_header = get_transform_tracks_header(*decomp_context.tracks);
+				const uint32_t num_rotation_groups = (transform_header.num_animated_rotation_sub_tracks + 3) / 4;
+				const uint32_t num_groups = num_rotation_groups
+					+ ((transform_header.num_animated_translation_sub_tracks + 3) / 4)
+					+ ((transform_header.num_animated_scale_sub_tracks + 3) / 4);
+
+				keyframe_cache->is_valid = num_keyframe_cache_groups_written == num_groups ? 1 : 0;
+
+				// Likewise, the segment range data is only valid if every rotation group made it in
+				if (segment_range_cache != nullptr && !is_segment_range_cache_hit)
+					keyframe_cache->is_segment_range_valid = num_segment_range_groups_written == num_rotation_groups ? 1 : 0;
+			}
+
+			// When 'soa_output' is true, the interpolated samples are left in SOA form in 'scratch0' (xxxx, yyyy, zzzz, wwww)
+			// instead of being written to the cache. Only valid when per track rounding isn't supported.
+			template<class decompression_settings_type, bool soa_output = false>
 			void RTM_DISABLE_SECURITY_COOKIE_CHECK unpack_rotation_group(const persistent_transform_decompression_context_v0& decomp_context)
 			{
 				const uint32_t num_left_to_unpack = rotations.num_left_to_unpack;
+				ACL_ASSERT(!soa_output || num_left_to_unpack != 0, "No rotations left to unpack, the SOA output would be stale");
 				if (num_left_to_unpack == 0)
 					return;	// Nothing left to do, we are done
 
 				// If we have less than 4 cached samples, unpack 4 more and prefetch the next cache line
+				// With SOA output, we never consume from the cache and we always unpack
 				const uint32_t num_cached = rotations.get_num_cached();
-				if (num_cached >= 4)
+				if (!soa_output && num_cached >= 4)
 					return;	// Enough cached, nothing to do
 
 				const uint32_t num_to_unpack = std::min<uint32_t>(num_left_to_unpack, 4);
@@ -1334,146 +1640,243 @@ namespace acl
 
 				const rotation_format8 rotation_format = get_rotation_format<decompression_settings_type>(decomp_context.rotation_format);
 				const float interpolation_alpha = decomp_context.interpolation_alpha;
-				const bool should_interpolate = should_interpolate_samples<decompression_settings_type>(rotation_format, interpolation_alpha);
+				const bool should_interpolate = !uses_single_key_frame && should_interpolate_samples<decompression_settings_type>(rotation_format, interpolation_alpha);
 
-				segment_animated_scratch_v0 segment_scratch;
+				rtm::vector4f scratch0_xxxx;
+				rtm::vector4f scratch0_yyyy;
+				rtm::vector4f scratch0_zzzz;
+				rtm::vector4f scratch0_wwww;
+				rtm::vector4f scratch1_xxxx;
+				rtm::vector4f scratch1_yyyy;
+				rtm::vector4f scratch1_zzzz;
+				rtm::vector4f scratch1_wwww;
 
-				// We start by unpacking our segment range data into our scratch memory
-				// We often only use a single segment to interpolate, we can avoid redundant work
-				if (rotation_format == rotation_format8::quatf_drop_w_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable))
+				if (is_keyframe_cache_hit)
 				{
-					if (decomp_context.has_segments)
+					// Our key frames haven't changed since we cached them, no need to unpack anything
+					const rtm::vector4f* cached_samples = keyframe_cache->rotation_samples + (keyframe_cache_rotation_group_index * keyframe_cache_v0::k_num_samples_per_group);
+
+					scratch0_xxxx = cached_samples[0];
+					scratch0_yyyy = cached_samples[1];
+					scratch0_zzzz = cached_samples[2];
+					scratch0_wwww = cached_samples[3];
+					scratch1_xxxx = cached_samples[4];
+					scratch1_yyyy = cached_samples[5];
+					scratch1_zzzz = cached_samples[6];
+					scratch1_wwww = cached_samples[7];
+				}
+				else
+				{
+					segment_animated_scratch_v0 segment_scratch;
+
+					// We start by unpacking our segment range data into our scratch memory
+					// We often only use a single segment to interpolate, we can avoid redundant work
+					if (is_rotation_format_variable_supported<decompression_settings_type>(rotation_format))
 					{
-						unpack_segment_range_data(segment_sampling_context_rotations[0].segment_range_data, 0, segment_scratch);
+						if (decomp_context.has_segments)
+						{
+							// When we remain within the same segment, our segment range data has already been unpacked
+							if (decompression_settings_type::is_segment_range_cache_enabled() && is_segment_range_cache_hit)
+								load_segment_range_data(segment_range_cache + (keyframe_cache_rotation_group_index * 6), segment_scratch);
+							else
+							{
+								unpack_segment_range_data(segment_sampling_context_rotations[0].segment_range_data, 0, segment_scratch);
 
-						// We are interpolating between two segments (rare)
-						if (!decomp_context.uses_single_segment)
-							unpack_segment_range_data(segment_sampling_context_rotations[1].segment_range_data, 1, segment_scratch);
+								// We are interpolating between two segments (rare)
+								if (!decomp_context.uses_single_segment)
+									unpack_segment_range_data(segment_sampling_context_rotations[1].segment_range_data, 1, segment_scratch);
+
+								if (decompression_settings_type::is_segment_range_cache_enabled() && segment_range_cache != nullptr)
+								{
+									store_segment_range_data(segment_scratch, segment_range_cache + (keyframe_cache_rotation_group_index * 6));
+									num_segment_range_groups_written++;
+								}
+							}
 
 #if !defined(ACL_IMPL_PREFETCH_EARLY)
-						// Our segment range data takes 24 bytes per group (4 samples, 6 bytes each), each cache line fits 2.67 groups
-						// Prefetch every time while alternating between both segments
-						ACL_IMPL_ANIMATED_PREFETCH(segment_sampling_context_rotations[cache_write_index % 2].segment_range_data + 64);
+							// Our segment range data takes 24 bytes per group (4 samples, 6 bytes each), each cache line fits 2.67 groups
+							// Prefetch every time while alternating between both segments
+							ACL_IMPL_ANIMATED_PREFETCH(segment_sampling_context_rotations[cache_write_index % 2].segment_range_data + 64);
 #endif
+						}
 					}
-				}
 
-				const range_reduction_masks_t range_reduction_masks0 = unpack_animated_quat<decompression_settings_type>(decomp_context, scratch0, num_to_unpack, segment_sampling_context_rotations[0]);
-				const range_reduction_masks_t range_reduction_masks1 = unpack_animated_quat<decompression_settings_type>(decomp_context, scratch1, num_to_unpack, segment_sampling_context_rotations[1]);
+					// Unpacking skips our per sub-track metadata, keep track of it since it also contains our dropped components
+					const uint8_t* format_per_track_data0 = segment_sampling_context_rotations[0].format_per_track_data;
+					const uint8_t* format_per_track_data1 = segment_sampling_context_rotations[1].format_per_track_data;
 
-				// Swizzle our samples into SOA form
-				rtm::vector4f scratch0_xxxx;
-				rtm::vector4f scratch0_yyyy;
-				rtm::vector4f scratch0_zzzz;
-				rtm::vector4f scratch0_wwww;
-				RTM_MATRIXF_TRANSPOSE_4X4(scratch0[0], scratch0[1], scratch0[2], scratch0[3], scratch0_xxxx, scratch0_yyyy, scratch0_zzzz, scratch0_wwww);
+					const range_reduction_masks_t range_reduction_masks0 = unpack_animated_quat<decompression_settings_type>(decomp_context, scratch0, num_to_unpack, segment_sampling_context_rotations[0]);
+					range_reduction_masks_t range_reduction_masks1;
 
-				rtm::vector4f scratch1_xxxx;
-				rtm::vector4f scratch1_yyyy;
-				rtm::vector4f scratch1_zzzz;
-				rtm::vector4f scratch1_wwww;
-				RTM_MATRIXF_TRANSPOSE_4X4(scratch1[0], scratch1[1], scratch1[2], scratch1[3], scratch1_xxxx, scratch1_yyyy, scratch1_zzzz, scratch1_wwww);
+					if (uses_single_key_frame)
+					{
+						// Both key frames are identical, skip the second bitstream read
+						range_reduction_masks1 = range_reduction_masks0;
+						segment_sampling_context_rotations[1] = segment_sampling_context_rotations[0];
+
+						for (uint32_t sample_index = 0; sample_index < 4; ++sample_index)
+							scratch1[sample_index] = scratch0[sample_index];
+					}
+					else
+						range_reduction_masks1 = unpack_animated_quat<decompression_settings_type>(decomp_context, scratch1, num_to_unpack, segment_sampling_context_rotations[1]);
+
+					// Swizzle our samples into SOA form
+					RTM_MATRIXF_TRANSPOSE_4X4(scratch0[0], scratch0[1], scratch0[2], scratch0[3], scratch0_xxxx, scratch0_yyyy, scratch0_zzzz, scratch0_wwww);
+
+					RTM_MATRIXF_TRANSPOSE_4X4(scratch1[0], scratch1[1], scratch1[2], scratch1[3], scratch1_xxxx, scratch1_yyyy, scratch1_zzzz, scratch1_wwww);
 
 #if defined(ACL_IMPL_USE_AVX_8_WIDE_DECOMP)
-				__m256 scratch_xxxx0_xxxx1 = _mm256_set_m128(scratch1_xxxx, scratch0_xxxx);
-				__m256 scratch_yyyy0_yyyy1 = _mm256_set_m128(scratch1_yyyy, scratch0_yyyy);
-				__m256 scratch_zzzz0_zzzz1 = _mm256_set_m128(scratch1_zzzz, scratch0_zzzz);
+					__m256 scratch_xxxx0_xxxx1 = _mm256_set_m128(scratch1_xxxx, scratch0_xxxx);
+					__m256 scratch_yyyy0_yyyy1 = _mm256_set_m128(scratch1_yyyy, scratch0_yyyy);
+					__m256 scratch_zzzz0_zzzz1 = _mm256_set_m128(scratch1_zzzz, scratch0_zzzz);
 #endif
 
-				// If we have a variable bit rate, we perform range reduction, skip the data we used
-				if (rotation_format == rotation_format8::quatf_drop_w_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable))
-				{
-					if (decomp_context.has_segments)
+					// If we have a variable bit rate, we perform range reduction, skip the data we used
+					if (is_rotation_format_variable_supported<decompression_settings_type>(rotation_format))
 					{
+						if (decomp_context.has_segments)
+						{
 #if defined(ACL_IMPL_USE_AVX_8_WIDE_DECOMP)
-						remap_segment_range_data_avx8(segment_scratch, range_reduction_masks0, range_reduction_masks1, scratch_xxxx0_xxxx1, scratch_yyyy0_yyyy1, scratch_zzzz0_zzzz1);
+							remap_segment_range_data_avx8(segment_scratch, range_reduction_masks0, range_reduction_masks1, scratch_xxxx0_xxxx1, scratch_yyyy0_yyyy1, scratch_zzzz0_zzzz1);
 #else
-						remap_segment_range_data4(segment_scratch, 0, range_reduction_masks0, scratch0_xxxx, scratch0_yyyy, scratch0_zzzz);
-						remap_segment_range_data4(segment_scratch, uint32_t(!decomp_context.uses_single_segment), range_reduction_masks1, scratch1_xxxx, scratch1_yyyy, scratch1_zzzz);
+							remap_segment_range_data4(segment_scratch, 0, range_reduction_masks0, scratch0_xxxx, scratch0_yyyy, scratch0_zzzz);
+							remap_segment_range_data4(segment_scratch, uint32_t(!decomp_context.uses_single_segment), range_reduction_masks1, scratch1_xxxx, scratch1_yyyy, scratch1_zzzz);
 #endif
-					}
+						}
 
-					const uint8_t* clip_range_data = clip_sampling_context_rotations.clip_range_data;
+						const uint8_t* clip_range_data = clip_sampling_context_rotations.clip_range_data;
 
 #if defined(ACL_IMPL_USE_AVX_8_WIDE_DECOMP)
-					remap_clip_range_data_avx8(clip_range_data, num_to_unpack, range_reduction_masks0, range_reduction_masks1, scratch_xxxx0_xxxx1, scratch_yyyy0_yyyy1, scratch_zzzz0_zzzz1);
+						remap_clip_range_data_avx8(clip_range_data, num_to_unpack, clip_sampling_context_rotations.are_clip_ranges_quantized, range_reduction_masks0, range_reduction_masks1, scratch_xxxx0_xxxx1, scratch_yyyy0_yyyy1, scratch_zzzz0_zzzz1);
 #else
-					remap_clip_range_data4(clip_range_data, num_to_unpack, range_reduction_masks0, range_reduction_masks1, scratch0_xxxx, scratch0_yyyy, scratch0_zzzz, scratch1_xxxx, scratch1_yyyy, scratch1_zzzz);
+						remap_clip_range_data4(clip_range_data, num_to_unpack, clip_sampling_context_rotations.are_clip_ranges_quantized, range_reduction_masks0, range_reduction_masks1, scratch0_xxxx, scratch0_yyyy, scratch0_zzzz, scratch1_xxxx, scratch1_yyyy, scratch1_zzzz);
 #endif
 
-					// Skip our data
-					clip_range_data += num_to_unpack * sizeof(rtm::float3f) * 2;
-					clip_sampling_context_rotations.clip_range_data = clip_range_data;
+						// Skip our data
+						clip_range_data += num_to_unpack * get_rotation_clip_range_entry_size(clip_sampling_context_rotations.are_clip_ranges_quantized);
+						clip_sampling_context_rotations.clip_range_data = clip_range_data;
 
 #if defined(ACL_IMPL_PREFETCH_EARLY)
-					// Clip range data is 24 bytes per sub-track and as such we need to prefetch two cache lines ahead to process 4 sub-tracks
-					ACL_IMPL_ANIMATED_PREFETCH(clip_range_data + 64);
-					ACL_IMPL_ANIMATED_PREFETCH(clip_range_data + 128);
+						// Clip range data is up to 24 bytes per sub-track and as such we need to prefetch two cache lines ahead to process 4 sub-tracks
+						ACL_IMPL_ANIMATED_PREFETCH(clip_range_data + 64);
+						ACL_IMPL_ANIMATED_PREFETCH(clip_range_data + 128);
 #endif
-				}
+					}
 
-				// Reconstruct our quaternion W component in SOA
-				if (rotation_format != rotation_format8::quatf_full || !decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_full))
-				{
+					// Reconstruct our quaternion W component in SOA
+					if (rotation_format != rotation_format8::quatf_full || !decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_full))
+					{
+						if (is_rotation_format_log_supported<decompression_settings_type>(rotation_format))
+						{
+#if defined(ACL_IMPL_USE_AVX_8_WIDE_DECOMP)
+							scratch0_xxxx = _mm256_extractf128_ps(scratch_xxxx0_xxxx1, 0);
+							scratch1_xxxx = _mm256_extractf128_ps(scratch_xxxx0_xxxx1, 1);
+							scratch0_yyyy = _mm256_extractf128_ps(scratch_yyyy0_yyyy1, 0);
+							scratch1_yyyy = _mm256_extractf128_ps(scratch_yyyy0_yyyy1, 1);
+							scratch0_zzzz = _mm256_extractf128_ps(scratch_zzzz0_zzzz1, 0);
+							scratch1_zzzz = _mm256_extractf128_ps(scratch_zzzz0_zzzz1, 1);
+#endif
+
+							// Our samples are a quaternion logarithm, there is no square-root here but a short polynomial
+							scratch0_wwww = quat_from_log4(scratch0_xxxx, scratch0_yyyy, scratch0_zzzz);
+							scratch1_wwww = quat_from_log4(scratch1_xxxx, scratch1_yyyy, scratch1_zzzz);
+						}
+						else
 #if defined(ACL_IMPL_USE_AVX_8_WIDE_DECOMP)
-					const __m256 scratch_wwww0_wwww1 = quat_from_positive_w_avx8(scratch_xxxx0_xxxx1, scratch_yyyy0_yyyy1, scratch_zzzz0_zzzz1);
-
-					// This is the last AVX step, unpack everything
-					scratch0_xxxx = _mm256_extractf128_ps(scratch_xxxx0_xxxx1, 0);
-					scratch1_xxxx = _mm256_extractf128_ps(scratch_xxxx0_xxxx1, 1);
-					scratch0_yyyy = _mm256_extractf128_ps(scratch_yyyy0_yyyy1, 0);
-					scratch1_yyyy = _mm256_extractf128_ps(scratch_yyyy0_yyyy1, 1);
-					scratch0_zzzz = _mm256_extractf128_ps(scratch_zzzz0_zzzz1, 0);
-					scratch1_zzzz = _mm256_extractf128_ps(scratch_zzzz0_zzzz1, 1);
-					scratch0_wwww = _mm256_extractf128_ps(scratch_wwww0_wwww1, 0);
-					scratch1_wwww = _mm256_extractf128_ps(scratch_wwww0_wwww1, 1);
+						{
+							const __m256 scratch_wwww0_wwww1 = quat_from_positive_w_avx8(scratch_xxxx0_xxxx1, scratch_yyyy0_yyyy1, scratch_zzzz0_zzzz1);
+
+							// This is the last AVX step, unpack everything
+							scratch0_xxxx = _mm256_extractf128_ps(scratch_xxxx0_xxxx1, 0);
+							scratch1_xxxx = _mm256_extractf128_ps(scratch_xxxx0_xxxx1, 1);
+							scratch0_yyyy = _mm256_extractf128_ps(scratch_yyyy0_yyyy1, 0);
+							scratch1_yyyy = _mm256_extractf128_ps(scratch_yyyy0_yyyy1, 1);
+							scratch0_zzzz = _mm256_extractf128_ps(scratch_zzzz0_zzzz1, 0);
+							scratch1_zzzz = _mm256_extractf128_ps(scratch_zzzz0_zzzz1, 1);
+							scratch0_wwww = _mm256_extractf128_ps(scratch_wwww0_wwww1, 0);
+							scratch1_wwww = _mm256_extractf128_ps(scratch_wwww0_wwww1, 1);
+						}
 #else
-					scratch0_wwww = quat_from_positive_w4(scratch0_xxxx, scratch0_yyyy, scratch0_zzzz);
+						{
+							scratch0_wwww = quat_from_positive_w4(scratch0_xxxx, scratch0_yyyy, scratch0_zzzz);
 
 #if !defined(ACL_IMPL_PREFETCH_EARLY)
-					if (rotation_format == rotation_format8::quatf_drop_w_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable))
-					{
-						// Our segment per track metadata takes 4 bytes per group (4 samples, 1 byte each), each cache line fits 16 groups
-						// Prefetch every other 8th group
-						// We prefetch here because we have a square-root in quat_from_positive_w4(..) that we'll wait after
-						// This allows us to insert the prefetch basically for free in its shadow
-						// Branching is faster than prefetching every time and alternating between the two
-						if (cache_write_index == 0)
-							ACL_IMPL_ANIMATED_PREFETCH(segment_sampling_context_rotations[0].format_per_track_data + 64);
-						else if (cache_write_index == 4)
-							ACL_IMPL_ANIMATED_PREFETCH(segment_sampling_context_rotations[1].format_per_track_data + 64);
-					}
+							if (is_rotation_format_variable_supported<decompression_settings_type>(rotation_format))
+							{
+								// Our segment per track metadata takes 4 bytes per group (4 samples, 1 byte each), each cache line fits 16 groups
+								// Prefetch every other 8th group
+								// We prefetch here because we have a square-root in quat_from_positive_w4(..) that we'll wait after
+								// This allows us to insert the prefetch basically for free in its shadow
+								// Branching is faster than prefetching every time and alternating between the two
+								if (cache_write_index == 0)
+									ACL_IMPL_ANIMATED_PREFETCH(segment_sampling_context_rotations[0].format_per_track_data + 64);
+								else if (cache_write_index == 4)
+									ACL_IMPL_ANIMATED_PREFETCH(segment_sampling_context_rotations[1].format_per_track_data + 64);
+							}
 #endif
 
-					scratch1_wwww = quat_from_positive_w4(scratch1_xxxx, scratch1_yyyy, scratch1_zzzz);
+							scratch1_wwww = quat_from_positive_w4(scratch1_xxxx, scratch1_yyyy, scratch1_zzzz);
 
 #if !defined(ACL_IMPL_PREFETCH_EARLY)
-					if (rotation_format == rotation_format8::quatf_drop_w_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable))
-					{
-						// Our clip range data is 24 bytes per sub-track and as such we need to prefetch two cache lines ahead to process 4 sub-tracks
-						// Each group is 96 bytes (4 samples, 24 bytes each), each cache line fits 0.67 groups
-						// We prefetch here because we have a square-root in quat_from_positive_w4(..) that we'll wait after
-						// This allows us to insert the prefetch basically for free in its shadow
-						ACL_IMPL_ANIMATED_PREFETCH(clip_sampling_context_rotations.clip_range_data + 64);
-						ACL_IMPL_ANIMATED_PREFETCH(clip_sampling_context_rotations.clip_range_data + 128);
-					}
+							if (is_rotation_format_variable_supported<decompression_settings_type>(rotation_format))
+							{
+								// Our clip range data is 24 bytes per sub-track and as such we need to prefetch two cache lines ahead to process 4 sub-tracks
+								// Each group is 96 bytes (4 samples, 24 bytes each), each cache line fits 0.67 groups
+								// We prefetch here because we have a square-root in quat_from_positive_w4(..) that we'll wait after
+								// This allows us to insert the prefetch basically for free in its shadow
+								ACL_IMPL_ANIMATED_PREFETCH(clip_sampling_context_rotations.clip_range_data + 64);
+								ACL_IMPL_ANIMATED_PREFETCH(clip_sampling_context_rotations.clip_range_data + 128);
+							}
 #endif
+						}
 #endif
 
-					if (decompression_settings_type::get_rotation_normalization_policy() == rotation_normalization_policy_t::always)
-					{
-						// quat_from_positive_w might not yield an accurate quaternion because the square-root instruction
-						// isn't very accurate on small inputs, we need to normalize
-						// If we support per track rounding, we need to normalize as we might not interpolate
-						// Otherwise, if we don't interpolate we also need to normalize
-						if (decompression_settings_type::is_per_track_rounding_supported() || !should_interpolate)
+						if (is_rotation_format_drop_largest_supported<decompression_settings_type>(rotation_format))
+						{
+							// Now that our dropped component has been reconstructed, restore the original component order
+							quat_unswizzle_dropped_component4(format_per_track_data0, scratch0_xxxx, scratch0_yyyy, scratch0_zzzz, scratch0_wwww);
+							quat_unswizzle_dropped_component4(format_per_track_data1, scratch1_xxxx, scratch1_yyyy, scratch1_zzzz, scratch1_wwww);
+						}
+						else
 						{
-							quat_normalize4(scratch0_xxxx, scratch0_yyyy, scratch0_zzzz, scratch0_wwww);
-							quat_normalize4(scratch1_xxxx, scratch1_yyyy, scratch1_zzzz, scratch1_wwww);
+							(void)format_per_track_data0;
+							(void)format_per_track_data1;
+						}
+
+						if (decompression_settings_type::get_rotation_normalization_policy() == rotation_normalization_policy_t::always)
+						{
+							// quat_from_positive_w might not yield an accurate quaternion because the square-root instruction
+							// isn't very accurate on small inputs, we need to normalize
+							// If we support per track rounding, we need to normalize as we might not interpolate
+							// Otherwise, if we don't interpolate we also need to normalize
+							// Cached key frames might later be used without interpolating, we need to normalize as well
+							if (decompression_settings_type::is_per_track_rounding_supported() || !should_interpolate || keyframe_cache != nullptr)
+							{
+								quat_normalize4(scratch0_xxxx, scratch0_yyyy, scratch0_zzzz, scratch0_wwww);
+								quat_normalize4(scratch1_xxxx, scratch1_yyyy, scratch1_zzzz, scratch1_wwww);
+							}
 						}
 					}
+
+					if (keyframe_cache != nullptr)
+					{
+						rtm::vector4f* cached_samples = keyframe_cache->rotation_samples + (keyframe_cache_rotation_group_index * keyframe_cache_v0::k_num_samples_per_group);
+
+						cached_samples[0] = scratch0_xxxx;
+						cached_samples[1] = scratch0_yyyy;
+						cached_samples[2] = scratch0_zzzz;
+						cached_samples[3] = scratch0_wwww;
+						cached_samples[4] = scratch1_xxxx;
+						cached_samples[5] = scratch1_yyyy;
+						cached_samples[6] = scratch1_zzzz;
+						cached_samples[7] = scratch1_wwww;
+
+						num_keyframe_cache_groups_written++;
+					}
 				}
 
+				keyframe_cache_rotation_group_index++;
+
 				// Interpolate linearly and store our rotations in SOA
 				{
 					const rtm::vector4f interpolation_alpha_v = rtm::vector_set(interpolation_alpha);
@@ -1490,6 +1893,7 @@ namespace acl
 						// to avoid any dependencies and fully hide the sqrt costs. That being said, there is
 						// quite a bit of work to do and we might still be CPU bound below.
 
+						if (rounding_table == nullptr)
 						{
 							// Swizzle out our 4 floor samples
 							rtm::vector4f sample0;
@@ -1506,8 +1910,9 @@ namespace acl
 							cache_ptr[3] = rtm::vector_to_quat(sample3);
 						}
 
+						if (rounding_table == nullptr)
 						{
-							// Swizzle out our 4 floor ceil
+							// Swizzle out our 4 ceil samples
 							rtm::vector4f sample0;
 							rtm::vector4f sample1;
 							rtm::vector4f sample2;
@@ -1522,6 +1927,7 @@ namespace acl
 							cache_ptr[3] = rtm::vector_to_quat(sample3);
 						}
 
+						if (rounding_table == nullptr)
 						{
 							// Find nearest and swizzle it out
 							const rtm::mask4f use_sample0 = rtm::vector_less_than(interpolation_alpha_v, rtm::vector_set(0.5F));
@@ -1559,9 +1965,28 @@ namespace acl
 
 							// Due to the interpolation, the result might not be anywhere near normalized!
 							// Make sure to normalize afterwards if we need to
-							if (decompression_settings_type::get_rotation_normalization_policy() >= rotation_normalization_policy_t::lerp_only)
+							if (decompression_settings_type::get_rotation_normalization_policy() == rotation_normalization_policy_t::approximate)
+								quat_normalize_approx4(interp_xxxx, interp_yyyy, interp_zzzz, interp_wwww);
+							else if (decompression_settings_type::get_rotation_normalization_policy() >= rotation_normalization_policy_t::lerp_only)
 								quat_normalize4(interp_xxxx, interp_yyyy, interp_zzzz, interp_wwww);
 
+							if (rounding_table != nullptr)
+							{
+								// Our rounding policies are known ahead of time, select the sample each sub-track needs
+								// Our group index has already been incremented above
+								uint32_t sample0_lanes;
+								uint32_t sample1_lanes;
+								rounding_table->get_group_lanes(keyframe_cache_rotation_group_index - 1, interpolation_alpha, sample0_lanes, sample1_lanes);
+
+								const rtm::mask4f use_sample0 = rtm::mask_set((sample0_lanes & 1) != 0, (sample0_lanes & 2) != 0, (sample0_lanes & 4) != 0, (sample0_lanes & 8) != 0);
+								const rtm::mask4f use_sample1 = rtm::mask_set((sample1_lanes & 1) != 0, (sample1_lanes & 2) != 0, (sample1_lanes & 4) != 0, (sample1_lanes & 8) != 0);
+
+								interp_xxxx = rtm::vector_select(use_sample1, scratch1_xxxx, rtm::vector_select(use_sample0, scratch0_xxxx, interp_xxxx));
+								interp_yyyy = rtm::vector_select(use_sample1, scratch1_yyyy, rtm::vector_select(use_sample0, scratch0_yyyy, interp_yyyy));
+								interp_zzzz = rtm::vector_select(use_sample1, scratch1_zzzz, rtm::vector_select(use_sample0, scratch0_zzzz, interp_zzzz));
+								interp_wwww = rtm::vector_select(use_sample1, scratch1_wwww, rtm::vector_select(use_sample0, scratch0_wwww, interp_wwww));
+							}
+
 #if !defined(ACL_IMPL_PREFETCH_EARLY)
 							{
 								// Our animated variable bit packed data uses at most 32 bits per component
@@ -1611,7 +2036,9 @@ namespace acl
 
 							// Due to the interpolation, the result might not be anywhere near normalized!
 							// Make sure to normalize afterwards if we need to
-							if (decompression_settings_type::get_rotation_normalization_policy() >= rotation_normalization_policy_t::lerp_only)
+							if (decompression_settings_type::get_rotation_normalization_policy() == rotation_normalization_policy_t::approximate)
+								quat_normalize_approx4(interp_xxxx, interp_yyyy, interp_zzzz, interp_wwww);
+							else if (decompression_settings_type::get_rotation_normalization_policy() >= rotation_normalization_policy_t::lerp_only)
 								quat_normalize4(interp_xxxx, interp_yyyy, interp_zzzz, interp_wwww);
 						}
 						else
@@ -1643,55 +2070,84 @@ namespace acl
 						}
 #endif
 
-						// Swizzle out our 4 samples
-						rtm::vector4f sample0;
-						rtm::vector4f sample1;
-						rtm::vector4f sample2;
-						rtm::vector4f sample3;
-						RTM_MATRIXF_TRANSPOSE_4X4(interp_xxxx, interp_yyyy, interp_zzzz, interp_wwww, sample0, sample1, sample2, sample3);
+						if (soa_output)
+						{
+							// Our samples are consumed in SOA form, our scratch space is no longer used and we can store them there
+							scratch0[0] = interp_xxxx;
+							scratch0[1] = interp_yyyy;
+							scratch0[2] = interp_zzzz;
+							scratch0[3] = interp_wwww;
+						}
+						else
+						{
+							// Swizzle out our 4 samples
+							rtm::vector4f sample0;
+							rtm::vector4f sample1;
+							rtm::vector4f sample2;
+							rtm::vector4f sample3;
+							RTM_MATRIXF_TRANSPOSE_4X4(interp_xxxx, interp_yyyy, interp_zzzz, interp_wwww, sample0, sample1, sample2, sample3);
 
-						// Always first rounding mode (none)
-						rtm::quatf* cache_ptr = &rotations.cached_samples[static_cast<int>(sample_rounding_policy::none)][cache_write_index];
+							// Always first rounding mode (none)
+							rtm::quatf* cache_ptr = &rotations.cached_samples[static_cast<int>(sample_rounding_policy::none)][cache_write_index];
 
-						cache_ptr[0] = rtm::vector_to_quat(sample0);
-						cache_ptr[1] = rtm::vector_to_quat(sample1);
-						cache_ptr[2] = rtm::vector_to_quat(sample2);
-						cache_ptr[3] = rtm::vector_to_quat(sample3);
+							cache_ptr[0] = rtm::vector_to_quat(sample0);
+							cache_ptr[1] = rtm::vector_to_quat(sample1);
+							cache_ptr[2] = rtm::vector_to_quat(sample2);
+							cache_ptr[3] = rtm::vector_to_quat(sample3);
+						}
 					}
 				}
 			}
 
+			// When provided, 'group_bit_sizes' contains the number of bits of the groups skipped for both key frames, see track_offset_table
 			template<class decompression_settings_type>
-			RTM_DISABLE_SECURITY_COOKIE_CHECK void skip_rotation_groups(const persistent_transform_decompression_context_v0& decomp_context, uint32_t num_groups_to_skip)
+			RTM_DISABLE_SECURITY_COOKIE_CHECK void skip_rotation_groups(const persistent_transform_decompression_context_v0& decomp_context, uint32_t num_groups_to_skip, const uint32_t* group_bit_sizes = nullptr)
 			{
 				const uint32_t num_left_to_unpack = rotations.num_left_to_unpack;
 				const uint32_t num_to_skip = num_groups_to_skip * 4;
 				ACL_ASSERT(num_to_skip < num_left_to_unpack, "Cannot skip rotations that aren't present");
 
 				rotations.num_left_to_unpack = num_left_to_unpack - num_to_skip;
+				keyframe_cache_rotation_group_index += num_groups_to_skip;
 
 				const rotation_format8 rotation_format = get_rotation_format<decompression_settings_type>(decomp_context.rotation_format);
-				if (rotation_format == rotation_format8::quatf_drop_w_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable))
+				if (is_rotation_format_variable_supported<decompression_settings_type>(rotation_format))
 				{
 					const uint8_t* format_per_track_data0 = segment_sampling_context_rotations[0].format_per_track_data;
 					const uint8_t* format_per_track_data1 = segment_sampling_context_rotations[1].format_per_track_data;
 
-					uint32_t group_bit_size_per_component0;
-					uint32_t group_bit_size_per_component1;
-					count_animated_group_bit_size<decompression_settings_type>(decomp_context, format_per_track_data0, format_per_track_data1, num_groups_to_skip, group_bit_size_per_component0, group_bit_size_per_component1);
+					// Rotations that drop their largest component also store which one in the upper bits of the metadata
+					const uint32_t num_bits_metadata_mask = is_rotation_format_drop_largest_supported<decompression_settings_type>(rotation_format) ? k_num_bits_metadata_mask : 0xFF;
+
+					uint32_t group_bit_size0;
+					uint32_t group_bit_size1;
+					if (group_bit_sizes != nullptr)
+					{
+						group_bit_size0 = group_bit_sizes[0];
+						group_bit_size1 = group_bit_sizes[1];
+					}
+					else
+					{
+						uint32_t group_bit_size_per_component0;
+						uint32_t group_bit_size_per_component1;
+						count_animated_group_bit_size<decompression_settings_type>(decomp_context, format_per_track_data0, format_per_track_data1, num_groups_to_skip, num_bits_metadata_mask, group_bit_size_per_component0, group_bit_size_per_component1);
+
+						group_bit_size0 = group_bit_size_per_component0 * 3;
+						group_bit_size1 = group_bit_size_per_component1 * 3;
+					}
 
 					const uint32_t format_per_track_data_skip_size = num_groups_to_skip * 4;
 					const uint32_t segment_range_data_skip_size = num_groups_to_skip * 6 * 4;
 
 					segment_sampling_context_rotations[0].format_per_track_data = format_per_track_data0 + format_per_track_data_skip_size;
 					segment_sampling_context_rotations[0].segment_range_data += segment_range_data_skip_size;
-					segment_sampling_context_rotations[0].animated_track_data_bit_offset += group_bit_size_per_component0 * 3;
+					segment_sampling_context_rotations[0].animated_track_data_bit_offset += group_bit_size0;
 
 					segment_sampling_context_rotations[1].format_per_track_data = format_per_track_data1 + format_per_track_data_skip_size;
 					segment_sampling_context_rotations[1].segment_range_data += segment_range_data_skip_size;
-					segment_sampling_context_rotations[1].animated_track_data_bit_offset += group_bit_size_per_component1 * 3;
+					segment_sampling_context_rotations[1].animated_track_data_bit_offset += group_bit_size1;
 
-					clip_sampling_context_rotations.clip_range_data += sizeof(rtm::float3f) * 2 * 4 * num_groups_to_skip;
+					clip_sampling_context_rotations.clip_range_data += get_rotation_clip_range_entry_size(clip_sampling_context_rotations.are_clip_ranges_quantized) * 4 * num_groups_to_skip;
 				}
 				else
 				{
@@ -1714,7 +2170,7 @@ namespace acl
 				const uint32_t group_size = std::min<uint32_t>(rotations.num_left_to_unpack, 4);
 
 				const rtm::vector4f sample_as_vec0 = unpack_single_animated_quat<decompression_settings_type>(decomp_context, unpack_index, group_size, clip_sampling_context_rotations, segment_sampling_context_rotations[0]);
-				const rtm::vector4f sample_as_vec1 = unpack_single_animated_quat<decompression_settings_type>(decomp_context, unpack_index, group_size, clip_sampling_context_rotations, segment_sampling_context_rotations[1]);
+				const rtm::vector4f sample_as_vec1 = uses_single_key_frame ? sample_as_vec0 : unpack_single_animated_quat<decompression_settings_type>(decomp_context, unpack_index, group_size, clip_sampling_context_rotations, segment_sampling_context_rotations[1]);
 
 				rtm::quatf sample0;
 				rtm::quatf sample1;
@@ -1723,8 +2179,26 @@ namespace acl
 				const rotation_format8 rotation_format = get_rotation_format<decompression_settings_type>(decomp_context.rotation_format);
 				if (rotation_format != rotation_format8::quatf_full || !decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_full))
 				{
-					sample0 = rtm::quat_from_positive_w(sample_as_vec0);
-					sample1 = rtm::quat_from_positive_w(sample_as_vec1);
+					if (is_rotation_format_log_supported<decompression_settings_type>(rotation_format))
+					{
+						sample0 = quat_from_log(sample_as_vec0);
+						sample1 = quat_from_log(sample_as_vec1);
+					}
+					else
+					{
+						sample0 = rtm::quat_from_positive_w(sample_as_vec0);
+						sample1 = rtm::quat_from_positive_w(sample_as_vec1);
+					}
+
+					if (is_rotation_format_drop_largest_supported<decompression_settings_type>(rotation_format))
+					{
+						// Now that our dropped component has been reconstructed, restore the original component order
+						const uint32_t dropped_component0 = segment_sampling_context_rotations[0].format_per_track_data[unpack_index] >> k_dropped_component_metadata_shift;
+						const uint32_t dropped_component1 = segment_sampling_context_rotations[1].format_per_track_data[unpack_index] >> k_dropped_component_metadata_shift;
+
+						sample0 = quat_unswizzle_dropped_component(sample0, dropped_component0);
+						sample1 = quat_unswizzle_dropped_component(sample1, dropped_component1);
+					}
 				}
 				else
 				{
@@ -1734,7 +2208,7 @@ namespace acl
 
 				rtm::quatf result;
 
-				const bool should_interpolate = should_interpolate_samples<decompression_settings_type>(rotation_format, interpolation_alpha);
+				const bool should_interpolate = !uses_single_key_frame && should_interpolate_samples<decompression_settings_type>(rotation_format, interpolation_alpha);
 				if (should_interpolate)
 				{
 					// Due to the interpolation, the result might not be anywhere near normalized!
@@ -1771,6 +2245,16 @@ namespace acl
 				return rotations.cached_samples[static_cast<int>(policy)][cache_read_index % 8];
 			}
 
+			// Returns the key frames of the last consumed sample, they remain cached until the next group is unpacked
+			// Only valid when per track rounding is supported and no rounding table is bound
+			RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void get_consumed_rotation_key_frames(rtm::quatf& out_sample0, rtm::quatf& out_sample1) const
+			{
+				ACL_ASSERT(rotations.cache_read_index != 0, "Attempting to read an animated sample that wasn't consumed");
+				const uint32_t cache_read_index = (rotations.cache_read_index - 1) % 8;
+				out_sample0 = rotations.cached_samples[static_cast<int>(sample_rounding_policy::floor)][cache_read_index];
+				out_sample1 = rotations.cached_samples[static_cast<int>(sample_rounding_policy::ceil)][cache_read_index];
+			}
+
 			template<class decompression_settings_adapter_type>
 			RTM_DISABLE_SECURITY_COOKIE_CHECK void unpack_translation_group(const persistent_transform_decompression_context_v0& decomp_context)
 			{
@@ -1790,8 +2274,47 @@ namespace acl
 				const uint32_t cache_write_index = translations.cache_write_index % 8;
 				translations.cache_write_index += num_to_unpack;
 
-				unpack_animated_vector3<decompression_settings_adapter_type>(decomp_context, scratch0, num_to_unpack, clip_sampling_context_translations, segment_sampling_context_translations[0]);
-				unpack_animated_vector3<decompression_settings_adapter_type>(decomp_context, scratch1, num_to_unpack, clip_sampling_context_translations, segment_sampling_context_translations[1]);
+				if (is_keyframe_cache_hit)
+				{
+					// Our key frames haven't changed since we cached them, no need to unpack anything
+					const rtm::vector4f* cached_samples = keyframe_cache->translation_samples + (keyframe_cache_translation_group_index * keyframe_cache_v0::k_num_samples_per_group);
+
+					for (uint32_t sample_index = 0; sample_index < 4; ++sample_index)
+					{
+						scratch0[sample_index] = cached_samples[sample_index];
+						scratch1[sample_index] = cached_samples[sample_index + 4];
+					}
+				}
+				else
+				{
+					unpack_animated_vector3<decompression_settings_adapter_type>(decomp_context, scratch0, num_to_unpack, clip_sampling_context_translations, segment_sampling_context_translations[0]);
+
+					if (uses_single_key_frame)
+					{
+						// Both key frames are identical, skip the second bitstream read
+						segment_sampling_context_translations[1] = segment_sampling_context_translations[0];
+
+						for (uint32_t sample_index = 0; sample_index < 4; ++sample_index)
+							scratch1[sample_index] = scratch0[sample_index];
+					}
+					else
+						unpack_animated_vector3<decompression_settings_adapter_type>(decomp_context, scratch1, num_to_unpack, clip_sampling_context_translations, segment_sampling_context_translations[1]);
+
+					if (keyframe_cache != nullptr)
+					{
+						rtm::vector4f* cached_samples = keyframe_cache->translation_samples + (keyframe_cache_translation_group_index * keyframe_cache_v0::k_num_samples_per_group);
+
+						for (uint32_t sample_index = 0; sample_index < 4; ++sample_index)
+						{
+							cached_samples[sample_index] = scratch0[sample_index];
+							cached_samples[sample_index + 4] = scratch1[sample_index];
+						}
+
+						num_keyframe_cache_groups_written++;
+					}
+				}
+
+				keyframe_cache_translation_group_index++;
 
 				const rtm::vector4f interpolation_alpha = rtm::vector_set(decomp_context.interpolation_alpha);
 				const rtm::mask4f use_sample0 = rtm::vector_less_than(interpolation_alpha, rtm::vector_set(0.5F));
@@ -1805,11 +2328,31 @@ namespace acl
 				rtm::vector4f* cache_ptr_ceil = &translations.cached_samples[static_cast<int>(sample_rounding_policy::ceil)][cache_write_index];
 				rtm::vector4f* cache_ptr_nearest = &translations.cached_samples[static_cast<int>(sample_rounding_policy::nearest)][cache_write_index];
 
+				// When our rounding policies are known ahead of time, we only write the sample each sub-track needs
+				// Our group index has already been incremented above
+				uint32_t sample0_lanes = 0;
+				uint32_t sample1_lanes = 0;
+				if (decompression_settings_adapter_type::is_per_track_rounding_supported() && rounding_table != nullptr)
+					rounding_table->get_group_lanes(rounding_table->num_rotation_groups + keyframe_cache_translation_group_index - 1, decomp_context.interpolation_alpha, sample0_lanes, sample1_lanes);
+
 				for (uint32_t unpack_index = 0; unpack_index < num_to_unpack; ++unpack_index)
 				{
 					const rtm::vector4f sample0 = scratch0[unpack_index];
 					const rtm::vector4f sample1 = scratch1[unpack_index];
 
+					if (decompression_settings_adapter_type::is_per_track_rounding_supported() && rounding_table != nullptr)
+					{
+						const uint32_t lane_mask = 1U << unpack_index;
+						if ((sample0_lanes & lane_mask) != 0)
+							cache_ptr_none[unpack_index] = sample0;
+						else if ((sample1_lanes & lane_mask) != 0)
+							cache_ptr_none[unpack_index] = sample1;
+						else
+							cache_ptr_none[unpack_index] = rtm::vector_lerp(sample0, sample1, interpolation_alpha);
+
+						continue;
+					}
+
 					if (decompression_settings_adapter_type::is_per_track_rounding_supported())
 					{
 						// These stores have no dependency and can be dispatched right away
@@ -1818,54 +2361,73 @@ namespace acl
 						cache_ptr_nearest[unpack_index] = rtm::vector_select(use_sample0, sample0, sample1);
 					}
 
-					const rtm::vector4f sample = rtm::vector_lerp(sample0, sample1, interpolation_alpha);
+					const rtm::vector4f sample = uses_single_key_frame ? sample0 : rtm::vector_lerp(sample0, sample1, interpolation_alpha);
 
 					cache_ptr_none[unpack_index] = sample;
 				}
 
 				// If we have clip range data, skip it
 				const vector_format8 format = get_vector_format<decompression_settings_adapter_type>(decompression_settings_adapter_type::get_vector_format(decomp_context));
-				if (format == vector_format8::vector3f_variable && decompression_settings_adapter_type::is_vector_format_supported(vector_format8::vector3f_variable))
+				if (is_vector_format_variable_supported<decompression_settings_adapter_type>(format))
 				{
-					clip_sampling_context_translations.clip_range_data += num_to_unpack * sizeof(rtm::float3f) * 2;
+					clip_sampling_context_translations.clip_range_data += num_to_unpack * get_range_reduction_vector_size(format);
 
-					// Clip range data is 24 bytes per sub-track and as such we need to prefetch two cache lines ahead to process 4 sub-tracks
+					// Clip range data is 24 or 28 bytes per sub-track and as such we need to prefetch two cache lines ahead to process 4 sub-tracks
 					ACL_IMPL_ANIMATED_PREFETCH(clip_sampling_context_translations.clip_range_data + 64);
 					ACL_IMPL_ANIMATED_PREFETCH(clip_sampling_context_translations.clip_range_data + 128);
 				}
 			}
 
+			// When provided, 'group_bit_sizes' contains the number of bits of the groups skipped for both key frames, see track_offset_table
 			template<class decompression_settings_adapter_type>
-			RTM_DISABLE_SECURITY_COOKIE_CHECK void skip_translation_groups(const persistent_transform_decompression_context_v0& decomp_context, uint32_t num_groups_to_skip)
+			RTM_DISABLE_SECURITY_COOKIE_CHECK void skip_translation_groups(const persistent_transform_decompression_context_v0& decomp_context, uint32_t num_groups_to_skip, const uint32_t* group_bit_sizes = nullptr)
 			{
 				const uint32_t num_left_to_unpack = translations.num_left_to_unpack;
 				const uint32_t num_to_skip = num_groups_to_skip * 4;
 				ACL_ASSERT(num_to_skip < num_left_to_unpack, "Cannot skip translations that aren't present");
 
 				translations.num_left_to_unpack = num_left_to_unpack - num_to_skip;
+				keyframe_cache_translation_group_index += num_groups_to_skip;
 
 				const vector_format8 format = get_vector_format<decompression_settings_adapter_type>(decompression_settings_adapter_type::get_vector_format(decomp_context));
-				if (format == vector_format8::vector3f_variable && decompression_settings_adapter_type::is_vector_format_supported(vector_format8::vector3f_variable))
+				if (is_vector_format_variable_supported<decompression_settings_adapter_type>(format))
 				{
 					const uint8_t* format_per_track_data0 = segment_sampling_context_translations[0].format_per_track_data;
 					const uint8_t* format_per_track_data1 = segment_sampling_context_translations[1].format_per_track_data;
 
-					uint32_t group_bit_size_per_component0;
-					uint32_t group_bit_size_per_component1;
-					count_animated_group_bit_size<decompression_settings_adapter_type>(decomp_context, format_per_track_data0, format_per_track_data1, num_groups_to_skip, group_bit_size_per_component0, group_bit_size_per_component1);
+					uint32_t group_bit_size0;
+					uint32_t group_bit_size1;
+					if (group_bit_sizes != nullptr)
+					{
+						group_bit_size0 = group_bit_sizes[0];
+						group_bit_size1 = group_bit_sizes[1];
+					}
+					else if (is_vector_format_per_component_supported<decompression_settings_adapter_type>(format))
+					{
+						count_animated_vector3_per_component_group_bit_size<decompression_settings_adapter_type>(decomp_context, format_per_track_data0, format_per_track_data1, clip_sampling_context_translations.clip_range_data, num_groups_to_skip, group_bit_size0, group_bit_size1);
+					}
+					else
+					{
+						uint32_t group_bit_size_per_component0;
+						uint32_t group_bit_size_per_component1;
+						count_animated_group_bit_size<decompression_settings_adapter_type>(decomp_context, format_per_track_data0, format_per_track_data1, num_groups_to_skip, 0xFF, group_bit_size_per_component0, group_bit_size_per_component1);
+
+						group_bit_size0 = group_bit_size_per_component0 * 3;
+						group_bit_size1 = group_bit_size_per_component1 * 3;
+					}
 
 					const uint32_t format_per_track_data_skip_size = num_groups_to_skip * 4;
 					const uint32_t segment_range_data_skip_size = num_groups_to_skip * 6 * 4;
 
 					segment_sampling_context_translations[0].format_per_track_data = format_per_track_data0 + format_per_track_data_skip_size;
 					segment_sampling_context_translations[0].segment_range_data += segment_range_data_skip_size;
-					segment_sampling_context_translations[0].animated_track_data_bit_offset += group_bit_size_per_component0 * 3;
+					segment_sampling_context_translations[0].animated_track_data_bit_offset += group_bit_size0;
 
 					segment_sampling_context_translations[1].format_per_track_data = format_per_track_data1 + format_per_track_data_skip_size;
 					segment_sampling_context_translations[1].segment_range_data += segment_range_data_skip_size;
-					segment_sampling_context_translations[1].animated_track_data_bit_offset += group_bit_size_per_component1 * 3;
+					segment_sampling_context_translations[1].animated_track_data_bit_offset += group_bit_size1;
 
-					clip_sampling_context_translations.clip_range_data += sizeof(rtm::float3f) * 2 * 4 * num_groups_to_skip;
+					clip_sampling_context_translations.clip_range_data += get_range_reduction_vector_size(format) * 4 * num_groups_to_skip;
 				}
 				else
 				{
@@ -1881,6 +2443,9 @@ namespace acl
 				ACL_ASSERT(unpack_index < translations.num_left_to_unpack && unpack_index < 4, "Cannot unpack sample that isn't present");
 
 				const rtm::vector4f sample0 = unpack_single_animated_vector3<decompression_settings_adapter_type>(decomp_context, unpack_index, clip_sampling_context_translations, segment_sampling_context_translations[0]);
+				if (uses_single_key_frame)
+					return sample0;
+
 				const rtm::vector4f sample1 = unpack_single_animated_vector3<decompression_settings_adapter_type>(decomp_context, unpack_index, clip_sampling_context_translations, segment_sampling_context_translations[1]);
 
 				return rtm::vector_lerp(sample0, sample1, interpolation_alpha);
@@ -1893,6 +2458,16 @@ namespace acl
 				return translations.cached_samples[static_cast<int>(policy)][cache_read_index % 8];
 			}
 
+			// Returns the key frames of the last consumed sample, they remain cached until the next group is unpacked
+			// Only valid when per track rounding is supported and no rounding table is bound
+			RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void get_consumed_translation_key_frames(rtm::vector4f& out_sample0, rtm::vector4f& out_sample1) const
+			{
+				ACL_ASSERT(translations.cache_read_index != 0, "Attempting to read an animated sample that wasn't consumed");
+				const uint32_t cache_read_index = (translations.cache_read_index - 1) % 8;
+				out_sample0 = translations.cached_samples[static_cast<int>(sample_rounding_policy::floor)][cache_read_index];
+				out_sample1 = translations.cached_samples[static_cast<int>(sample_rounding_policy::ceil)][cache_read_index];
+			}
+
 			template<class decompression_settings_adapter_type>
 			RTM_DISABLE_SECURITY_COOKIE_CHECK void unpack_scale_group(const persistent_transform_decompression_context_v0& decomp_context)
 			{
@@ -1912,8 +2487,47 @@ namespace acl
 				const uint32_t cache_write_index = scales.cache_write_index % 8;
 				scales.cache_write_index += num_to_unpack;
 
-				unpack_animated_vector3<decompression_settings_adapter_type>(decomp_context, scratch0, num_to_unpack, clip_sampling_context_scales, segment_sampling_context_scales[0]);
-				unpack_animated_vector3<decompression_settings_adapter_type>(decomp_context, scratch1, num_to_unpack, clip_sampling_context_scales, segment_sampling_context_scales[1]);
+				if (is_keyframe_cache_hit)
+				{
+					// Our key frames haven't changed since we cached them, no need to unpack anything
+					const rtm::vector4f* cached_samples = keyframe_cache->scale_samples + (keyframe_cache_scale_group_index * keyframe_cache_v0::k_num_samples_per_group);
+
+					for (uint32_t sample_index = 0; sample_index < 4; ++sample_index)
+					{
+						scratch0[sample_index] = cached_samples[sample_index];
+						scratch1[sample_index] = cached_samples[sample_index + 4];
+					}
+				}
+				else
+				{
+					unpack_animated_vector3<decompression_settings_adapter_type>(decomp_context, scratch0, num_to_unpack, clip_sampling_context_scales, segment_sampling_context_scales[0]);
+
+					if (uses_single_key_frame)
+					{
+						// Both key frames are identical, skip the second bitstream read
+						segment_sampling_context_scales[1] = segment_sampling_context_scales[0];
+
+						for (uint32_t sample_index = 0; sample_index < 4; ++sample_index)
+							scratch1[sample_index] = scratch0[sample_index];
+					}
+					else
+						unpack_animated_vector3<decompression_settings_adapter_type>(decomp_context, scratch1, num_to_unpack, clip_sampling_context_scales, segment_sampling_context_scales[1]);
+
+					if (keyframe_cache != nullptr)
+					{
+						rtm::vector4f* cached_samples = keyframe_cache->scale_samples + (keyframe_cache_scale_group_index * keyframe_cache_v0::k_num_samples_per_group);
+
+						for (uint32_t sample_index = 0; sample_index < 4; ++sample_index)
+						{
+							cached_samples[sample_index] = scratch0[sample_index];
+							cached_samples[sample_index + 4] = scratch1[sample_index];
+						}
+
+						num_keyframe_cache_groups_written++;
+					}
+				}
+
+				keyframe_cache_scale_group_index++;
 
 				const rtm::vector4f interpolation_alpha = rtm::vector_set(decomp_context.interpolation_alpha);
 				const rtm::mask4f use_sample0 = rtm::vector_less_than(interpolation_alpha, rtm::vector_set(0.5F));
@@ -1927,11 +2541,31 @@ namespace acl
 				rtm::vector4f* cache_ptr_ceil = &scales.cached_samples[static_cast<int>(sample_rounding_policy::ceil)][cache_write_index];
 				rtm::vector4f* cache_ptr_nearest = &scales.cached_samples[static_cast<int>(sample_rounding_policy::nearest)][cache_write_index];
 
+				// When our rounding policies are known ahead of time, we only write the sample each sub-track needs
+				// Our group index has already been incremented above
+				uint32_t sample0_lanes = 0;
+				uint32_t sample1_lanes = 0;
+				if (decompression_settings_adapter_type::is_per_track_rounding_supported() && rounding_table != nullptr)
+					rounding_table->get_group_lanes(rounding_table->num_rotation_groups + rounding_table->num_translation_groups + keyframe_cache_scale_group_index - 1, decomp_context.interpolation_alpha, sample0_lanes, sample1_lanes);
+
 				for (uint32_t unpack_index = 0; unpack_index < num_to_unpack; ++unpack_index)
 				{
 					const rtm::vector4f sample0 = scratch0[unpack_index];
 					const rtm::vector4f sample1 = scratch1[unpack_index];
 
+					if (decompression_settings_adapter_type::is_per_track_rounding_supported() && rounding_table != nullptr)
+					{
+						const uint32_t lane_mask = 1U << unpack_index;
+						if ((sample0_lanes & lane_mask) != 0)
+							cache_ptr_none[unpack_index] = sample0;
+						else if ((sample1_lanes & lane_mask) != 0)
+							cache_ptr_none[unpack_index] = sample1;
+						else
+							cache_ptr_none[unpack_index] = rtm::vector_lerp(sample0, sample1, interpolation_alpha);
+
+						continue;
+					}
+
 					if (decompression_settings_adapter_type::is_per_track_rounding_supported())
 					{
 						// These stores have no dependency and can be dispatched right away
@@ -1940,54 +2574,73 @@ namespace acl
 						cache_ptr_nearest[unpack_index] = rtm::vector_select(use_sample0, sample0, sample1);
 					}
 
-					const rtm::vector4f sample = rtm::vector_lerp(sample0, sample1, interpolation_alpha);
+					const rtm::vector4f sample = uses_single_key_frame ? sample0 : rtm::vector_lerp(sample0, sample1, interpolation_alpha);
 
 					cache_ptr_none[unpack_index] = sample;
 				}
 
 				// If we have clip range data, skip it
 				const vector_format8 format = get_vector_format<decompression_settings_adapter_type>(decompression_settings_adapter_type::get_vector_format(decomp_context));
-				if (format == vector_format8::vector3f_variable && decompression_settings_adapter_type::is_vector_format_supported(vector_format8::vector3f_variable))
+				if (is_vector_format_variable_supported<decompression_settings_adapter_type>(format))
 				{
-					clip_sampling_context_scales.clip_range_data += num_to_unpack * sizeof(rtm::float3f) * 2;
+					clip_sampling_context_scales.clip_range_data += num_to_unpack * get_range_reduction_vector_size(format);
 
-					// Clip range data is 24 bytes per sub-track and as such we need to prefetch two cache lines ahead to process 4 sub-tracks
+					// Clip range data is 24 or 28 bytes per sub-track and as such we need to prefetch two cache lines ahead to process 4 sub-tracks
 					ACL_IMPL_ANIMATED_PREFETCH(clip_sampling_context_scales.clip_range_data + 64);
 					ACL_IMPL_ANIMATED_PREFETCH(clip_sampling_context_scales.clip_range_data + 128);
 				}
 			}
 
+			// When provided, 'group_bit_sizes' contains the number of bits of the groups skipped for both key frames, see track_offset_table
 			template<class decompression_settings_adapter_type>
-			RTM_DISABLE_SECURITY_COOKIE_CHECK void skip_scale_groups(const persistent_transform_decompression_context_v0& decomp_context, uint32_t num_groups_to_skip)
+			RTM_DISABLE_SECURITY_COOKIE_CHECK void skip_scale_groups(const persistent_transform_decompression_context_v0& decomp_context, uint32_t num_groups_to_skip, const uint32_t* group_bit_sizes = nullptr)
 			{
 				const uint32_t num_left_to_unpack = scales.num_left_to_unpack;
 				const uint32_t num_to_skip = num_groups_to_skip * 4;
 				ACL_ASSERT(num_to_skip < num_left_to_unpack, "Cannot skip scales that aren't present");
 
 				scales.num_left_to_unpack = num_left_to_unpack - num_to_skip;
+				keyframe_cache_scale_group_index += num_groups_to_skip;
 
 				const vector_format8 format = get_vector_format<decompression_settings_adapter_type>(decompression_settings_adapter_type::get_vector_format(decomp_context));
-				if (format == vector_format8::vector3f_variable && decompression_settings_adapter_type::is_vector_format_supported(vector_format8::vector3f_variable))
+				if (is_vector_format_variable_supported<decompression_settings_adapter_type>(format))
 				{
 					const uint8_t* format_per_track_data0 = segment_sampling_context_scales[0].format_per_track_data;
 					const uint8_t* format_per_track_data1 = segment_sampling_context_scales[1].format_per_track_data;
 
-					uint32_t group_bit_size_per_component0;
-					uint32_t group_bit_size_per_component1;
-					count_animated_group_bit_size<decompression_settings_adapter_type>(decomp_context, format_per_track_data0, format_per_track_data1, num_groups_to_skip, group_bit_size_per_component0, group_bit_size_per_component1);
+					uint32_t group_bit_size0;
+					uint32_t group_bit_size1;
+					if (group_bit_sizes != nullptr)
+					{
+						group_bit_size0 = group_bit_sizes[0];
+						group_bit_size1 = group_bit_sizes[1];
+					}
+					else if (is_vector_format_per_component_supported<decompression_settings_adapter_type>(format))
+					{
+						count_animated_vector3_per_component_group_bit_size<decompression_settings_adapter_type>(decomp_context, format_per_track_data0, format_per_track_data1, clip_sampling_context_scales.clip_range_data, num_groups_to_skip, group_bit_size0, group_bit_size1);
+					}
+					else
+					{
+						uint32_t group_bit_size_per_component0;
+						uint32_t group_bit_size_per_component1;
+						count_animated_group_bit_size<decompression_settings_adapter_type>(decomp_context, format_per_track_data0, format_per_track_data1, num_groups_to_skip, 0xFF, group_bit_size_per_component0, group_bit_size_per_component1);
+
+						group_bit_size0 = group_bit_size_per_component0 * 3;
+						group_bit_size1 = group_bit_size_per_component1 * 3;
+					}
 
 					const uint32_t format_per_track_data_skip_size = num_groups_to_skip * 4;
 					const uint32_t segment_range_data_skip_size = num_groups_to_skip * 6 * 4;
 
 					segment_sampling_context_scales[0].format_per_track_data = format_per_track_data0 + format_per_track_data_skip_size;
 					segment_sampling_context_scales[0].segment_range_data += segment_range_data_skip_size;
-					segment_sampling_context_scales[0].animated_track_data_bit_offset += group_bit_size_per_component0 * 3;
+					segment_sampling_context_scales[0].animated_track_data_bit_offset += group_bit_size0;
 
 					segment_sampling_context_scales[1].format_per_track_data = format_per_track_data1 + format_per_track_data_skip_size;
 					segment_sampling_context_scales[1].segment_range_data += segment_range_data_skip_size;
-					segment_sampling_context_scales[1].animated_track_data_bit_offset += group_bit_size_per_component1 * 3;
+					segment_sampling_context_scales[1].animated_track_data_bit_offset += group_bit_size1;
 
-					clip_sampling_context_scales.clip_range_data += sizeof(rtm::float3f) * 2 * 4 * num_groups_to_skip;
+					clip_sampling_context_scales.clip_range_data += get_range_reduction_vector_size(format) * 4 * num_groups_to_skip;
 				}
 				else
 				{
@@ -2003,6 +2656,9 @@ namespace acl
 				ACL_ASSERT(unpack_index < scales.num_left_to_unpack && unpack_index < 4, "Cannot unpack sample that isn't present");
 
 				const rtm::vector4f sample0 = unpack_single_animated_vector3<decompression_settings_adapter_type>(decomp_context, unpack_index, clip_sampling_context_scales, segment_sampling_context_scales[0]);
+				if (uses_single_key_frame)
+					return sample0;
+
 				const rtm::vector4f sample1 = unpack_single_animated_vector3<decompression_settings_adapter_type>(decomp_context, unpack_index, clip_sampling_context_scales, segment_sampling_context_scales[1]);
 
 				return rtm::vector_lerp(sample0, sample1, interpolation_alpha);
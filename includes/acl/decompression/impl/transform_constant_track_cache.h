@@ -25,6 +25,8 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "acl/version.h"
+#include "acl/core/bitset.h"
+#include "acl/core/memory_utils.h"
 #include "acl/core/track_formats.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/decompression/impl/track_cache.h"
@@ -74,6 +76,17 @@ namespace acl
 
 	namespace acl_impl
 	{
+		// Unpacks 4 components stored on 16 bits each in native byte order into [-1.0, 1.0]
+		// Always loads 8 bytes, see get_constant_rotation_group_size(..)
+		inline rtm::vector4f RTM_SIMD_CALL unpack_constant_rotation_components_s16_unsafe(const uint8_t* data)
+		{
+			const rtm::vector4f components = load_vector4_u16x4_unsafe(data);
+
+			const float inv_max_value = 1.0F / float((1 << 16) - 1);
+			const rtm::vector4f normalized = rtm::vector_mul(components, inv_max_value);
+			return rtm::vector_neg_mul_sub(normalized, -2.0F, rtm::vector_set(-1.0F));
+		}
+
 		struct constant_track_cache_v0
 		{
 			// Our constant rotation samples are packed in groups of 4 samples (16 floats, 64 bytes) in AOS form when we have full precision
@@ -86,17 +99,31 @@ namespace acl
 
 			track_cache_quatf_v0<32, 1> rotations;
 
+			// Points to the shared unpacked constant rotations when present, we read from it instead of unpacking
+			const rtm::quatf* shared_rotations;
+
 			// Points to our packed sub-track data
 			const uint8_t*	constant_data_rotations;
 			const uint8_t*	constant_data_translations;
 			const uint8_t*	constant_data_scales;
 
+			// Points to the bit set of quantized rotation groups when present, see get_constant_rotation_group_size(..)
+			const uint32_t*	quantized_rotation_groups;
+			bitset_description quantized_rotation_groups_desc;
+			uint32_t		rotation_group_index;
+
+			bool is_rotation_group_quantized(uint32_t group_index) const
+			{
+				return quantized_rotation_groups != nullptr && bitset_test(quantized_rotation_groups, quantized_rotation_groups_desc, group_index);
+			}
+
 			template<class decompression_settings_type>
 			RTM_DISABLE_SECURITY_COOKIE_CHECK void initialize(const persistent_transform_decompression_context_v0& decomp_context)
 			{
 				const transform_tracks_header& transform_header = get_transform_tracks_header(*decomp_context.tracks);
 
 				rotations.num_left_to_unpack = transform_header.num_constant_rotation_samples;
+				shared_rotations = decomp_context.constant_rotations;
 
 				const rotation_format8 rotation_format = get_rotation_format<decompression_settings_type>(decomp_context.rotation_format);
 				const rotation_format8 packed_format = is_rotation_format_variable(rotation_format) ? get_highest_variant_precision(get_rotation_variant(rotation_format)) : rotation_format;
@@ -104,13 +131,34 @@ namespace acl
 				const uint32_t packed_translation_size = get_packed_vector_size(vector_format8::vector3f_full);
 
 				constant_data_rotations = transform_header.get_constant_track_data();
-				constant_data_translations = constant_data_rotations + packed_rotation_size * transform_header.num_constant_rotation_samples;
+				rotation_group_index = 0;
+
+				if (get_tracks_header(*decomp_context.tracks).get_has_quantized_constant_rotations())
+				{
+					const uint32_t num_rotation_groups = (transform_header.num_constant_rotation_samples + 3) / 4;
+					const uint32_t constant_rotation_data_size = unaligned_load<uint32_t>(constant_data_rotations);
+
+					quantized_rotation_groups = reinterpret_cast<const uint32_t*>(constant_data_rotations + sizeof(uint32_t));
+					quantized_rotation_groups_desc = bitset_description::make_from_num_bits(num_rotation_groups);
+
+					constant_data_translations = constant_data_rotations + constant_rotation_data_size;
+					constant_data_rotations += sizeof(uint32_t) + quantized_rotation_groups_desc.get_num_bytes();
+				}
+				else
+				{
+					quantized_rotation_groups = nullptr;
+					constant_data_translations = constant_data_rotations + packed_rotation_size * transform_header.num_constant_rotation_samples;
+				}
+
 				constant_data_scales = constant_data_translations + packed_translation_size * transform_header.num_constant_translation_samples;
 			}
 
 			template<class decompression_settings_type>
 			RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void unpack_rotation_group(const persistent_transform_decompression_context_v0& decomp_context)
 			{
+				if (shared_rotations != nullptr)
+					return;	// Already unpacked, nothing to do
+
 				const uint32_t num_left_to_unpack = rotations.num_left_to_unpack;
 				if (num_left_to_unpack == 0)
 					return;	// Nothing left to do, we are done
@@ -157,14 +205,34 @@ namespace acl
 						// Unpack
 						// Always load 4x rotations, we might contain garbage in a few lanes but it's fine
 						// The last group contains no padding so we have to make to align our reads properly
-						const uint32_t load_size = unpack_count * sizeof(float);
+						rtm::vector4f xxxx;
+						rtm::vector4f yyyy;
+						rtm::vector4f zzzz;
+
+						if (is_rotation_group_quantized(rotation_group_index))
+						{
+							const uint32_t load_size = unpack_count * sizeof(uint16_t);
+
+							xxxx = unpack_constant_rotation_components_s16_unsafe(constant_track_data + load_size * 0);
+							yyyy = unpack_constant_rotation_components_s16_unsafe(constant_track_data + load_size * 1);
+							zzzz = unpack_constant_rotation_components_s16_unsafe(constant_track_data + load_size * 2);
 
-						rtm::vector4f xxxx = rtm::vector_load(reinterpret_cast<const float*>(constant_track_data + load_size * 0));
-						rtm::vector4f yyyy = rtm::vector_load(reinterpret_cast<const float*>(constant_track_data + load_size * 1));
-						rtm::vector4f zzzz = rtm::vector_load(reinterpret_cast<const float*>(constant_track_data + load_size * 2));
+							// Update our read ptr
+							constant_track_data += get_constant_rotation_group_size(unpack_count, true);
+						}
+						else
+						{
+							const uint32_t load_size = unpack_count * sizeof(float);
 
-						// Update our read ptr
-						constant_track_data += load_size * 3;
+							xxxx = rtm::vector_load(reinterpret_cast<const float*>(constant_track_data + load_size * 0));
+							yyyy = rtm::vector_load(reinterpret_cast<const float*>(constant_track_data + load_size * 1));
+							zzzz = rtm::vector_load(reinterpret_cast<const float*>(constant_track_data + load_size * 2));
+
+							// Update our read ptr
+							constant_track_data += load_size * 3;
+						}
+
+						rotation_group_index++;
 
 						rtm::vector4f wwww = quat_from_positive_w4(xxxx, yyyy, zzzz);
 
@@ -218,6 +286,14 @@ namespace acl
 				const rotation_format8 rotation_format = get_rotation_format<decompression_settings_type>(decomp_context.rotation_format);
 				if (rotation_format == rotation_format8::quatf_full && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_full))
 					constant_track_data += num_to_skip * sizeof(rtm::float4f);
+				else if (quantized_rotation_groups != nullptr)
+				{
+					// Groups have different sizes, walk them
+					for (uint32_t group_index = 0; group_index < num_groups_to_skip; ++group_index)
+						constant_track_data += get_constant_rotation_group_size(4, is_rotation_group_quantized(rotation_group_index + group_index));
+
+					rotation_group_index += num_groups_to_skip;
+				}
 				else
 					constant_track_data += num_to_skip * sizeof(rtm::float3f);
 
@@ -244,11 +320,25 @@ namespace acl
 				{
 					// Data is in SOA form
 					const uint32_t group_size = std::min<uint32_t>(rotations.num_left_to_unpack, 4);
-					const float* constant_track_data = reinterpret_cast<const float*>(constant_data_rotations) + unpack_index;
-					const float x = constant_track_data[group_size * 0];
-					const float y = constant_track_data[group_size * 1];
-					const float z = constant_track_data[group_size * 2];
-					const rtm::vector4f sample_v = rtm::vector_set(x, y, z, 0.0F);
+
+					rtm::vector4f sample_v;
+					if (is_rotation_group_quantized(rotation_group_index))
+					{
+						const uint16_t* constant_track_data = reinterpret_cast<const uint16_t*>(constant_data_rotations) + unpack_index;
+						const float x = unpack_scalar_signed(constant_track_data[group_size * 0], 16);
+						const float y = unpack_scalar_signed(constant_track_data[group_size * 1], 16);
+						const float z = unpack_scalar_signed(constant_track_data[group_size * 2], 16);
+						sample_v = rtm::vector_set(x, y, z, 0.0F);
+					}
+					else
+					{
+						const float* constant_track_data = reinterpret_cast<const float*>(constant_data_rotations) + unpack_index;
+						const float x = constant_track_data[group_size * 0];
+						const float y = constant_track_data[group_size * 1];
+						const float z = constant_track_data[group_size * 2];
+						sample_v = rtm::vector_set(x, y, z, 0.0F);
+					}
+
 					sample = rtm::quat_from_positive_w(sample_v);
 
 					// quat_from_positive_w might not yield an accurate quaternion because the square-root instruction
@@ -264,6 +354,9 @@ namespace acl
 
 			RTM_DISABLE_SECURITY_COOKIE_CHECK const rtm::quatf& RTM_SIMD_CALL consume_rotation()
 			{
+				if (shared_rotations != nullptr)
+					return *shared_rotations++;
+
 				ACL_ASSERT(rotations.cache_read_index < rotations.cache_write_index, "Attempting to consume a constant sample that isn't cached");
 				const uint32_t cache_read_index = rotations.cache_read_index++;
 				return rotations.cached_samples[0][cache_read_index % 32];
@@ -28,11 +28,14 @@
 #include "acl/core/bitset.h"
 #include "acl/core/compressed_tracks.h"
 #include "acl/core/compressed_tracks_version.h"
+#include "acl/core/quality_tiers.h"
 #include "acl/core/range_reduction_types.h"
 #include "acl/core/track_formats.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/decompression/database/impl/database_context.h"
 
+#include <rtm/types.h>
+
 #include <cstdint>
 
 ACL_IMPL_FILE_PRAGMA_PUSH
@@ -50,6 +53,8 @@ namespace acl
 
 	namespace acl_impl
 	{
+		struct keyframe_cache_v0;
+
 		struct persistent_transform_decompression_context_v0
 		{
 			// Clip related data								//   offsets
@@ -75,27 +80,51 @@ namespace acl
 
 			uint8_t looping_policy;								//  25 |  33
 
-			uint8_t padding0[16];								//  26 |  34
-
 			// Seeking related data
-			uint8_t rounding_policy;							//  42 |  50
-			uint8_t uses_single_segment;						//  43 |  51
+			uint8_t rounding_policy;							//  26 |  34
+			uint8_t uses_single_segment;						//  27 |  35
 
-			float sample_time;									//  44 |  52
+			float sample_time;									//  28 |  36
+
+			// Optional persistent key frame cache, bound when we decompress
+			keyframe_cache_v0* keyframe_cache;					//  32 |  40
+
+			// Optional shared constant rotations, see unpacked_constant_pose
+			const rtm::quatf* constant_rotations;				//  36 |  48
 
 			// Offsets in bytes relative to the 'tracks' pointer
-			ptr_offset32<segment_header> segment_offsets[2];	//  48 |  56
+			ptr_offset32<segment_header> segment_offsets[2];	//  40 |  56
 
-			const uint8_t* format_per_track_data[2];			//  56 |  64
-			const uint8_t* segment_range_data[2];				//  64 |  80
-			const uint8_t* animated_track_data[2];				//  72 |  96
+			const uint8_t* format_per_track_data[2];			//  48 |  64
+			const uint8_t* segment_range_data[2];				//  56 |  80
+			const uint8_t* animated_track_data[2];				//  64 |  96
 
 			// Offsets in bits relative to the 'animated_track_data' pointers
-			uint32_t key_frame_bit_offsets[2];					//  80 | 112
+			uint32_t key_frame_bit_offsets[2];					//  72 | 112
+
+			float interpolation_alpha;							//  80 | 120
 
-			float interpolation_alpha;							//  88 | 120
+			// Whether the clip matches the statically known transform layout of our decompression settings
+			uint8_t uses_static_layout : 1;						//  84 | 124
 
-			uint8_t padding1[sizeof(void*) == 4 ? 36 : 4];		//  92 | 124
+			// Whether the clip has no animated sub-tracks, its pose is then identical at every sample time
+			// Its segment data is bound once when we initialize and seeking only records the sample time
+			uint8_t is_static_pose : 1;							//  84 | 124
+
+			// The highest quality tier we sample from, see quality_tier
+			uint8_t max_quality_tier;							//  85 | 125
+
+			// The average number of samples per segment used to estimate the segment we seek into, zero if it doesn't fit
+			uint8_t approx_num_samples_per_segment;				//  86 | 126
+
+			union
+			{
+				// The number of samples between our two key frames, zero when they are identical
+				// Used to scale velocities, see track_writer::supports_velocity_output()
+				uint8_t key_frame_span;							//  87 | 127
+
+				uint8_t padding1[sizeof(void*) == 4 ? 41 : 1];	//  87 | 127
+			};
 
 			//										Total size:	   128 | 128
 
@@ -105,6 +134,9 @@ namespace acl
 			compressed_tracks_version16 get_version() const { return tracks->get_version(); }
 			sample_looping_policy get_looping_policy() const { return static_cast<sample_looping_policy>(looping_policy); }
 			sample_rounding_policy get_rounding_policy() const { return static_cast<sample_rounding_policy>(rounding_policy); }
+			quality_tier get_max_quality_tier() const { return static_cast<quality_tier>(max_quality_tier); }
+			float get_sample_time() const { return sample_time; }
+			float get_duration() const { return clip_duration; }
 			bool is_initialized() const { return tracks != nullptr; }
 			void reset()
 			{
@@ -116,6 +148,50 @@ namespace acl
 		static_assert(sizeof(persistent_transform_decompression_context_v0) == 128, "Unexpected size");
 		static_assert(offsetof(persistent_transform_decompression_context_v0, tracks) == 0, "tracks pointer needs to be the first member");
 
+		// Precomputed offsets used to decompress a single track in constant time, see track_offset_table
+		struct track_offset_table_v0
+		{
+			// Number of sub-tracks that precede each packed sub-track entry, 6 values per entry:
+			// constant rotations, animated rotations, constant translations, animated translations, constant scales, animated scales
+			const uint32_t* sub_track_counts;
+
+			// For each segment, the number of bits within a key frame that precede each animated group of 4 sub-tracks
+			// Rotation groups come first, followed by translation groups and scale groups
+			const uint32_t* group_bit_offsets;
+
+			uint32_t num_rotation_groups;
+			uint32_t num_translation_groups;
+			uint32_t num_scale_groups;
+
+			uint32_t get_num_groups() const { return num_rotation_groups + num_translation_groups + num_scale_groups; }
+		};
+
+		static constexpr uint32_t k_track_offset_table_num_counts_per_entry = 6;
+
+		// Per track rounding policies precomputed for every animated group of 4 sub-tracks, see track_rounding_table
+		struct track_rounding_table_v0
+		{
+			// One entry per animated group, rotation groups come first, followed by translation groups and scale groups
+			// Bits [0, 4) contain the sub-tracks that use the floor sample, bits [4, 8) those that use the ceil sample,
+			// and bits [8, 12) those that use the nearest sample. Sub-tracks without a bit set interpolate.
+			const uint16_t* group_masks;
+
+			uint32_t num_rotation_groups;
+			uint32_t num_translation_groups;
+			uint32_t num_scale_groups;
+
+			// Returns which sub-tracks of a group use the first or the second key frame, the others interpolate
+			void get_group_lanes(uint32_t group_index, float interpolation_alpha, uint32_t& out_sample0_lanes, uint32_t& out_sample1_lanes) const
+			{
+				const uint32_t group_mask = group_masks[group_index];
+				const uint32_t nearest_lanes = (group_mask >> 8) & 0xF;
+				const bool is_nearest_sample0 = interpolation_alpha < 0.5F;
+
+				out_sample0_lanes = (group_mask & 0xF) | (is_nearest_sample0 ? nearest_lanes : 0);
+				out_sample1_lanes = ((group_mask >> 4) & 0xF) | (is_nearest_sample0 ? 0 : nearest_lanes);
+			}
+		};
+
 		// We use adapters to wrap the decompression_settings
 		// This allows us to re-use the code for skipping and decompressing Vector3 samples
 		// Code generation will generate specialized code for each specialization
@@ -147,7 +223,9 @@ namespace acl
 		{
 			return int32_t(decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_full))
 				+ int32_t(decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_full))
-				+ int32_t(decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable));
+				+ int32_t(decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable))
+				+ int32_t(decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_largest_variable))
+				+ int32_t(decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_log_variable));
 		}
 
 		// Returns the statically known rotation format supported if we only support one, otherwise we return the input value
@@ -161,7 +239,34 @@ namespace acl
 				// Only one format is supported, figure out statically which one it is and return it
 				: (decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_full) ? rotation_format8::quatf_full
 					: (decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_full) ? rotation_format8::quatf_drop_w_full
-						: rotation_format8::quatf_drop_w_variable));
+						: (decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable) ? rotation_format8::quatf_drop_w_variable
+							: (decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_largest_variable) ? rotation_format8::quatf_drop_largest_variable
+								: rotation_format8::quatf_log_variable))));
+		}
+
+		// Returns whether or not the rotation format uses a variable bit rate and is supported by the decompression settings
+		template<class decompression_settings_type>
+		constexpr bool is_rotation_format_variable_supported(rotation_format8 format)
+		{
+			return (format == rotation_format8::quatf_drop_w_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_w_variable))
+				|| (format == rotation_format8::quatf_drop_largest_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_largest_variable))
+				|| (format == rotation_format8::quatf_log_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_log_variable));
+		}
+
+		// Returns whether or not the rotation format drops the largest component and is supported by the decompression settings
+		// When it does, the per sub-track metadata also contains which component was dropped
+		template<class decompression_settings_type>
+		constexpr bool is_rotation_format_drop_largest_supported(rotation_format8 format)
+		{
+			return format == rotation_format8::quatf_drop_largest_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_drop_largest_variable);
+		}
+
+		// Returns whether or not the rotation format is the quaternion logarithm and is supported by the decompression settings
+		// When it is, animated rotations are reconstructed with quat_from_log4(..) instead of dropping W
+		template<class decompression_settings_type>
+		constexpr bool is_rotation_format_log_supported(rotation_format8 format)
+		{
+			return format == rotation_format8::quatf_log_variable && decompression_settings_type::is_rotation_format_supported(rotation_format8::quatf_log_variable);
 		}
 
 		// Returns the statically known number of vector formats supported by the decompression settings
@@ -169,7 +274,8 @@ namespace acl
 		constexpr int32_t num_supported_vector_formats()
 		{
 			return int32_t(decompression_settings_adapter_type::is_vector_format_supported(vector_format8::vector3f_full))
-				+ int32_t(decompression_settings_adapter_type::is_vector_format_supported(vector_format8::vector3f_variable));
+				+ int32_t(decompression_settings_adapter_type::is_vector_format_supported(vector_format8::vector3f_variable))
+				+ int32_t(decompression_settings_adapter_type::is_vector_format_supported(vector_format8::vector3f_variable_per_component));
 		}
 
 		// Returns the statically known vector format supported if we only support one, otherwise we return the input value
@@ -182,7 +288,24 @@ namespace acl
 				? format
 				// Only one format is supported, figure out statically which one it is and return it
 				: (decompression_settings_adapter_type::is_vector_format_supported(vector_format8::vector3f_full) ? vector_format8::vector3f_full
-					: vector_format8::vector3f_variable);
+					: (decompression_settings_adapter_type::is_vector_format_supported(vector_format8::vector3f_variable) ? vector_format8::vector3f_variable
+						: vector_format8::vector3f_variable_per_component));
+		}
+
+		// Returns whether or not the vector format uses a variable bit rate and is supported by the decompression settings
+		template<class decompression_settings_adapter_type>
+		constexpr bool is_vector_format_variable_supported(vector_format8 format)
+		{
+			return (format == vector_format8::vector3f_variable && decompression_settings_adapter_type::is_vector_format_supported(vector_format8::vector3f_variable))
+				|| (format == vector_format8::vector3f_variable_per_component && decompression_settings_adapter_type::is_vector_format_supported(vector_format8::vector3f_variable_per_component));
+		}
+
+		// Returns whether or not the vector format has a variable number of bits per component and is supported by the decompression settings
+		// When it does, the clip range data also contains the bit rate reduction of each component
+		template<class decompression_settings_adapter_type>
+		constexpr bool is_vector_format_per_component_supported(vector_format8 format)
+		{
+			return format == vector_format8::vector3f_variable_per_component && decompression_settings_adapter_type::is_vector_format_supported(vector_format8::vector3f_variable_per_component);
 		}
 
 		// Returns whether or not we should interpolate our samples
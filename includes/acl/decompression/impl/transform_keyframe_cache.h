@@ -0,0 +1,193 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/ptr_offset.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/decompression/impl/transform_decompression_context.h"
+
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+#if defined(RTM_COMPILER_MSVC)
+	#pragma warning(push)
+	// warning C26495: Variable '...' is uninitialized. Always initialize a member variable (type.6).
+	// We explicitly control initialization
+	#pragma warning(disable : 26495)
+#endif
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// A persistent cache that retains the two unpacked key frames of every animated sub-track.
+		// Samples are retained before interpolation and they are reused as long as we interpolate
+		// between the same two key frames. Every group of 4 sub-tracks uses 8 vectors:
+		//    - rotations: xxxx, yyyy, zzzz, wwww of the first key frame followed by the second key frame
+		//    - translations/scales: the 4 samples of the first key frame followed by the second key frame
+		//////////////////////////////////////////////////////////////////////////
+		struct keyframe_cache_v0
+		{
+			static constexpr uint32_t k_num_samples_per_group = 8;
+
+			// Identifies which key frames are currently cached
+			const compressed_tracks* tracks;
+			uint32_t tracks_hash;
+			ptr_offset32<segment_header> segment_offsets[2];
+			uint32_t key_frame_bit_offsets[2];
+
+			// Whether or not every animated group has been cached
+			uint32_t is_valid;
+
+			// How many groups of 4 sub-tracks we can hold per sub-track type
+			uint32_t max_num_groups;
+
+			rtm::vector4f* rotation_samples;
+			rtm::vector4f* translation_samples;
+			rtm::vector4f* scale_samples;
+
+			// Optional unpacked segment range data of every animated rotation group, null when unused
+			// Every group uses 6 vectors: min xxxx, yyyy, zzzz followed by extent xxxx, yyyy, zzzz
+			// It remains valid as long as we interpolate within the same segment, even when key frames change
+			rtm::vector4f* segment_range_samples;
+
+			// Identifies which segment has its range data cached
+			ptr_offset32<segment_header> segment_range_offset;
+
+			// Whether or not every animated rotation group has its segment range data cached
+			uint32_t is_segment_range_valid;
+
+			//////////////////////////////////////////////////////////////////////////
+
+			bool is_bound_to(const persistent_transform_decompression_context_v0& context) const
+			{
+				return is_valid != 0
+					&& tracks == context.tracks
+					&& tracks_hash == context.tracks_hash
+					&& segment_offsets[0] == context.segment_offsets[0]
+					&& segment_offsets[1] == context.segment_offsets[1]
+					&& key_frame_bit_offsets[0] == context.key_frame_bit_offsets[0]
+					&& key_frame_bit_offsets[1] == context.key_frame_bit_offsets[1];
+			}
+
+			bool is_segment_range_bound_to(const persistent_transform_decompression_context_v0& context) const
+			{
+				return is_segment_range_valid != 0
+					&& tracks == context.tracks
+					&& tracks_hash == context.tracks_hash
+					&& segment_range_offset == context.segment_offsets[0];
+			}
+
+			void bind_segment_range_to(const persistent_transform_decompression_context_v0& context)
+			{
+				segment_range_offset = context.segment_offsets[0];
+
+				// We'll be valid once every rotation group has been written
+				is_segment_range_valid = 0;
+			}
+
+			void bind_to(const persistent_transform_decompression_context_v0& context)
+			{
+				// Our cached segment range data belongs to the previous tracks instance
+				if (tracks != context.tracks || tracks_hash != context.tracks_hash)
+					is_segment_range_valid = 0;
+
+				tracks = context.tracks;
+				tracks_hash = context.tracks_hash;
+				segment_offsets[0] = context.segment_offsets[0];
+				segment_offsets[1] = context.segment_offsets[1];
+				key_frame_bit_offsets[0] = context.key_frame_bit_offsets[0];
+				key_frame_bit_offsets[1] = context.key_frame_bit_offsets[1];
+
+				// We'll be valid once every group has been written
+				is_valid = 0;
+			}
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Owns the key frame cache storage for a fixed number of sub-tracks per type.
+		// The persistent context wraps the transform context to keep both together and
+		// the cache is only bound when we decompress since the context can be relocated in memory.
+		// The segment range cache storage is only present when enabled.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t max_num_sub_tracks, bool has_segment_range_cache>
+		struct persistent_keyframe_cached_transform_decompression_context_v0 : public persistent_transform_decompression_context_v0
+		{
+			static constexpr uint32_t k_max_num_groups = (max_num_sub_tracks + 3) / 4;
+			static constexpr uint32_t k_num_samples = k_max_num_groups * keyframe_cache_v0::k_num_samples_per_group;
+			static constexpr uint32_t k_num_segment_range_samples = has_segment_range_cache ? (k_max_num_groups * 6) : 1;
+
+			rtm::vector4f rotation_samples[k_num_samples];
+			rtm::vector4f translation_samples[k_num_samples];
+			rtm::vector4f scale_samples[k_num_samples];
+			rtm::vector4f segment_range_samples[k_num_segment_range_samples];
+
+			keyframe_cache_v0 keyframe_cache_storage;
+
+			persistent_keyframe_cached_transform_decompression_context_v0()
+				: persistent_transform_decompression_context_v0()
+			{
+				keyframe_cache_storage.tracks = nullptr;
+				keyframe_cache_storage.is_valid = 0;
+				keyframe_cache_storage.is_segment_range_valid = 0;
+			}
+
+			void bind_keyframe_cache()
+			{
+				keyframe_cache_storage.max_num_groups = k_max_num_groups;
+				keyframe_cache_storage.rotation_samples = &rotation_samples[0];
+				keyframe_cache_storage.translation_samples = &translation_samples[0];
+				keyframe_cache_storage.scale_samples = &scale_samples[0];
+				keyframe_cache_storage.segment_range_samples = has_segment_range_cache ? &segment_range_samples[0] : nullptr;
+
+				keyframe_cache = &keyframe_cache_storage;
+			}
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Binds the key frame cache to its context if it has one, does nothing otherwise
+		template<class context_type>
+		inline void bind_keyframe_cache(context_type& context) { (void)context; }
+
+		template<uint32_t max_num_sub_tracks, bool has_segment_range_cache>
+		inline void bind_keyframe_cache(persistent_keyframe_cached_transform_decompression_context_v0<max_num_sub_tracks, has_segment_range_cache>& context) { context.bind_keyframe_cache(); }
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+#if defined(RTM_COMPILER_MSVC)
+	#pragma warning(pop)
+#endif
+
+ACL_IMPL_FILE_PRAGMA_POP
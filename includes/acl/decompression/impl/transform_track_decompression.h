@@ -35,7 +35,10 @@
 #include "acl/core/track_writer.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/impl/variable_bit_rates.h"
+#include "acl/decompression/decompression_profiler.h"
+#include "acl/decompression/transform_layout.h"
 #include "acl/decompression/database/database.h"
+#include "acl/decompression/impl/masked_track_writer.h"
 #include "acl/decompression/impl/transform_animated_track_cache.h"
 #include "acl/decompression/impl/transform_constant_track_cache.h"
 #include "acl/decompression/impl/transform_decompression_context.h"
@@ -47,6 +50,7 @@
 #include <rtm/scalarf.h>
 #include <rtm/vector4f.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <type_traits>
 
@@ -73,12 +77,130 @@ namespace acl
 #define ACL_IMPL_SEEK_PREFETCH(ptr) (void)(ptr)
 #endif
 
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the index of the first of 4 segments, starting at the provided one, that starts after the key frame.
+		// The segment start indices end with a sentinel of 0xFFFFFFFF and the segment headers follow them which
+		// makes it safe to read 4 values even if the sentinel comes earlier. Values past it are never selected.
+		inline uint32_t find_next_segment_index(const uint32_t* segment_start_indices, uint32_t start_segment_index, uint32_t key_frame)
+		{
+			const uint32_t* segment_start_indices_ = segment_start_indices + start_segment_index;
+
+#if defined(RTM_SSE2_INTRINSICS)
+			// SSE2 only has a signed comparison, flip the sign bit to compare as unsigned
+			const __m128i sign_bit = _mm_set1_epi32(static_cast<int32_t>(0x80000000U));
+			const __m128i start_indices = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(segment_start_indices_)), sign_bit);
+			const __m128i key_frame_ = _mm_xor_si128(_mm_set1_epi32(static_cast<int32_t>(key_frame)), sign_bit);
+			const uint32_t mask = static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(key_frame_, start_indices))));
+#elif defined(RTM_NEON_INTRINSICS)
+			const uint32x4_t start_indices = vld1q_u32(segment_start_indices_);
+			const uint32x4_t is_before = vcltq_u32(vdupq_n_u32(key_frame), start_indices);
+
+			// Keep a single bit per lane and sum them up to build our mask
+			alignas(16) static constexpr uint32_t k_lane_bits[4] = { 1, 2, 4, 8 };
+			const uint32x4_t lane_mask = vandq_u32(is_before, vld1q_u32(&k_lane_bits[0]));
+			const uint32x2_t lane_mask_xy_zw = vorr_u32(vget_low_u32(lane_mask), vget_high_u32(lane_mask));
+			const uint32_t mask = vget_lane_u32(lane_mask_xy_zw, 0) | vget_lane_u32(lane_mask_xy_zw, 1);
+#else
+			uint32_t mask = 0;
+			for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+				mask |= key_frame < segment_start_indices_[lane_index] ? (1U << lane_index) : 0;
+#endif
+
+			ACL_ASSERT(mask != 0, "Segment not found for key frame: %u", key_frame);
+			return start_segment_index + count_trailing_zeros(mask);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Snaps our segment relative key frames onto the samples retained in the provided bit sets, the first
+		// sample of a segment is the most significant bit. The first key frame snaps to the closest retained
+		// sample at or before it and the second to the closest one at or after it. The first and last samples
+		// of every segment are always retained.
+		RTM_FORCE_INLINE void snap_to_retained_samples(uint32_t sample_indices0, uint32_t sample_indices1, uint32_t& key_frame0, uint32_t& key_frame1)
+		{
+			// Mask all trailing samples to find the first sample by counting trailing zeros
+			key_frame0 = 31 - count_trailing_zeros(sample_indices0 & (0xFFFFFFFFU << (31 - key_frame0)));
+
+			// Mask all leading samples to find the second sample by counting leading zeros
+			key_frame1 = count_leading_zeros(sample_indices1 & (0xFFFFFFFFU >> key_frame1));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the scale that converts a delta between our two key frames into a velocity per second
+		// Zero when both key frames are identical since nothing moves, see track_writer::supports_velocity_output()
+		inline float get_velocity_scale(const persistent_transform_decompression_context_v0& context)
+		{
+			const tracks_header& header = get_tracks_header(*context.tracks);
+			return context.key_frame_span != 0 ? (header.sample_rate / float(context.key_frame_span)) : 0.0F;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Writes the angular velocity of the last rotation consumed from the animated track cache.
+		// It is the derivative of our interpolation between both key frames, nothing more is unpacked.
+		template<class track_writer_type>
+		RTM_FORCE_INLINE void write_consumed_angular_velocity(const animated_track_cache_v0& animated_track_cache, float velocity_scale, uint32_t track_index, track_writer_type& writer)
+		{
+			rtm::quatf sample0;
+			rtm::quatf sample1;
+			animated_track_cache.get_consumed_rotation_key_frames(sample0, sample1);
+
+			// Our delta lives in the parent space of the track and its log is the axis scaled by half the angle
+			// The log takes the shortest path, same as our interpolation
+			const rtm::quatf delta = rtm::quat_mul(rtm::quat_conjugate(sample0), sample1);
+			writer.write_angular_velocity(track_index, rtm::vector_mul(quat_to_log(delta), 2.0F * velocity_scale));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Writes the linear velocity of the last translation consumed from the animated track cache.
+		// It is the derivative of our interpolation between both key frames, nothing more is unpacked.
+		template<class track_writer_type>
+		RTM_FORCE_INLINE void write_consumed_linear_velocity(const animated_track_cache_v0& animated_track_cache, float velocity_scale, uint32_t track_index, track_writer_type& writer)
+		{
+			rtm::vector4f sample0;
+			rtm::vector4f sample1;
+			animated_track_cache.get_consumed_translation_key_frames(sample0, sample1);
+
+			writer.write_linear_velocity(track_index, rtm::vector_mul(rtm::vector_sub(sample1, sample0), velocity_scale));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns where a retained sample lives among the samples stored with the provided bit set
+		// (e.g. sample 3 might be the second sample stored).
+		RTM_FORCE_INLINE uint32_t get_retained_sample_index(uint32_t sample_indices, uint32_t key_frame)
+		{
+			return count_set_bits(and_not(0xFFFFFFFFU >> key_frame, sample_indices));
+		}
+
 		template<class decompression_settings_type>
 		constexpr bool is_database_supported_impl()
 		{
 			return decompression_settings_type::database_settings_type::version_supported() != compressed_tracks_version16::none;
 		}
 
+		//////////////////////////////////////////////////////////////////////////
+		// Binds the segment data of a static pose, see persistent_transform_decompression_context_v0::is_static_pose.
+		// Without animated sub-tracks, every sample time reads the same data and we point both key frames
+		// to the first one of the first segment. Seeking then has nothing left to compute.
+		inline void bind_static_pose_v0(persistent_transform_decompression_context_v0& context)
+		{
+			const compressed_tracks* tracks = context.tracks;
+			const transform_tracks_header& transform_header = get_transform_tracks_header(*tracks);
+
+			// Stripped segment headers start at the same address and share the same layout
+			const segment_header* segment_header0 = transform_header.get_segment_headers();
+
+			transform_header.get_segment_data(*segment_header0, context.format_per_track_data[0], context.segment_range_data[0], context.animated_track_data[0]);
+			context.format_per_track_data[1] = context.format_per_track_data[0];
+			context.segment_range_data[1] = context.segment_range_data[0];
+			context.animated_track_data[1] = context.animated_track_data[0];
+			context.key_frame_bit_offsets[0] = 0;
+			context.key_frame_bit_offsets[1] = 0;
+			context.segment_offsets[0] = ptr_offset32<segment_header>(tracks, segment_header0);
+			context.segment_offsets[1] = context.segment_offsets[0];
+			context.uses_single_segment = true;
+			context.interpolation_alpha = 0.0F;
+			context.key_frame_span = 0;
+		}
+
 		template<class decompression_settings_type, class database_settings_type>
 		inline bool initialize_v0(persistent_transform_decompression_context_v0& context, const compressed_tracks& tracks, const database_context<database_settings_type>* database)
 		{
@@ -115,6 +237,16 @@ namespace acl
 			context.has_scale = header.get_has_scale();
 			context.has_segments = transform_header.has_multiple_segments();
 
+			// Segments contain at most a few dozen samples, cache the average to avoid a division when seeking
+			const uint32_t approx_num_samples_per_segment = transform_header.has_multiple_segments() ? (header.num_samples / transform_header.num_segments) : 0;
+			context.approx_num_samples_per_segment = approx_num_samples_per_segment <= 0xFF ? static_cast<uint8_t>(approx_num_samples_per_segment) : 0;
+			context.keyframe_cache = nullptr;
+			context.constant_rotations = nullptr;
+
+			using transform_layout_type = typename decompression_settings_type::transform_layout_type;
+			context.uses_static_layout = transform_layout_type::is_enabled() && get_transform_layout_signature(tracks) == transform_layout_type::get_signature();
+			context.max_quality_tier = static_cast<uint8_t>(quality_tier::lowest_importance);
+
 			if (decompression_settings_type::is_wrapping_supported())
 			{
 				context.clip_duration = tracks.get_finite_duration();
@@ -126,6 +258,12 @@ namespace acl
 				context.looping_policy = static_cast<uint8_t>(sample_looping_policy::clamp);
 			}
 
+			// Single pose and fully constant clips (e.g. idles, additive offsets) have no animated sub-tracks
+			// Their segment data is bound once here and seeking them is free, see seek_v0(..)
+			context.is_static_pose = header.num_tracks != 0 && (transform_header.num_animated_rotation_sub_tracks + transform_header.num_animated_translation_sub_tracks + transform_header.num_animated_scale_sub_tracks) == 0;
+			if (context.is_static_pose)
+				bind_static_pose_v0(context);
+
 			return true;
 		}
 
@@ -151,6 +289,10 @@ namespace acl
 			// that are populated during seek.
 			context.sample_time = -1.0F;
 
+			// Static poses populate them when bound instead
+			if (context.is_static_pose)
+				bind_static_pose_v0(context);
+
 			return true;
 		}
 
@@ -205,6 +347,27 @@ namespace acl
 		inline void seek_v0(persistent_transform_decompression_context_v0& context, float sample_time, sample_rounding_policy rounding_policy)
 		{
 			const compressed_tracks* tracks = context.tracks;
+
+			using profiler_type = typename decompression_settings_type::profiler_type;
+			const scope_decompression_zone<profiler_type> seek_zone(decompression_zone::seek, tracks);
+
+			if (context.is_static_pose)
+			{
+				// Every sample time decompresses the same pose and our segment data was bound when we initialized
+				// We only record where we are, the compressed tracks aren't touched
+				if (decompression_settings_type::clamp_sample_time())
+					sample_time = rtm::scalar_clamp(sample_time, 0.0F, context.clip_duration);
+
+				context.sample_time = sample_time;
+				context.rounding_policy = static_cast<uint8_t>(rounding_policy);
+				return;
+			}
+
+			// Our headers span two cache lines when the compressed tracks are aligned to 64 bytes (the default)
+			// The second line holds our data offsets and the first segment headers, its address doesn't
+			// depend on the first line and prefetching it allows both cache misses to overlap
+			ACL_IMPL_SEEK_PREFETCH(reinterpret_cast<const uint8_t*>(tracks) + 64);
+
 			const tracks_header& header = get_tracks_header(*tracks);
 			if (header.num_tracks == 0)
 				return;	// Empty track list
@@ -258,7 +421,14 @@ namespace acl
 			ACL_ASSERT(is_database_supported || !tracks->has_database(), "Cannot have a database when it isn't supported");
 
 			const bool has_database = is_database_supported && tracks->has_database();
-			const database_context_v0* db = context.db;
+
+			// Without telemetry support, the counters are stripped
+			constexpr bool is_telemetry_supported = is_database_supported && decompression_settings_type::database_settings_type::is_telemetry_supported();
+
+			// When we only sample from the compressed tracks, we skip the database entirely
+			// Without database support, this is known at compile time and the database code is stripped
+			const quality_tier max_quality_tier = context.get_max_quality_tier();
+			const database_context_v0* db = is_database_supported && max_quality_tier != quality_tier::highest_importance ? context.db : nullptr;
 
 			const bool has_stripped_keyframes = has_database || tracks->has_stripped_keyframes();
 
@@ -277,82 +447,90 @@ namespace acl
 					// Calculate our clip relative sample index, we'll remap it later relative to the samples we'll use
 					const float sample_index = context.interpolation_alpha + float(key_frame0);
 
-					// When we load our sample indices and offsets from the database, there can be another thread writing
-					// to those memory locations at the same time (e.g. streaming in/out).
-					// To ensure thread safety, we atomically load the offset and sample indices.
-					uint64_t medium_importance_tier_metadata0 = 0;
-					uint64_t low_importance_tier_metadata0 = 0;
-
-					// Combine all our loaded samples into a single bit set to find which samples we need to interpolate
-					if (db != nullptr)
+					if (db == nullptr)
 					{
-						// Possible cache miss for the clip header offset
-						// Cache miss for the db clip segment headers pointer
-						const tracks_database_header* tracks_db_header = transform_header.get_database_header();
-						const database_runtime_clip_header* db_clip_header = tracks_db_header->get_clip_header(db->clip_segment_headers);
-						const database_runtime_segment_header* db_segment_headers = db_clip_header->get_segment_headers();
-
-						// Cache miss for the db segment headers
-						const database_runtime_segment_header* db_segment_header0 = db_segment_headers;
-						medium_importance_tier_metadata0 = db_segment_header0->tier_metadata[0].load(std::memory_order::memory_order_relaxed);
-						low_importance_tier_metadata0 = db_segment_header0->tier_metadata[1].load(std::memory_order::memory_order_relaxed);
-
-						sample_indices0 |= uint32_t(medium_importance_tier_metadata0);
-						sample_indices0 |= uint32_t(low_importance_tier_metadata0);
+						// Only the samples retained within our compressed tracks are used, the segment bit set
+						// maps our key frames directly and the database is never accessed
+						snap_to_retained_samples(sample_indices0, sample_indices0, key_frame0, key_frame1);
+
+						// Calculate our new interpolation alpha
+						// We used the rounding policy above to snap to the correct key frame earlier but we might need to interpolate now
+						// if key frames have been removed
+						context.interpolation_alpha = find_linear_interpolation_alpha(sample_index, key_frame0, key_frame1, sample_rounding_policy::none);
+
+						// Remap our sample indices within the ones actually stored
+						segment_key_frame0 = get_retained_sample_index(sample_indices0, key_frame0);
+						segment_key_frame1 = get_retained_sample_index(sample_indices0, key_frame1);
 					}
+					else
+					{
+						// When we load our sample indices and offsets from the database, there can be another thread writing
+						// to those memory locations at the same time (e.g. streaming in/out), see load_segment_tier_metadata(..).
+						// The metadata of the tiers we don't sample from remains zero.
+						uint64_t tier_metadata0[k_num_database_tiers] = {};
+
+						// Combine all our loaded samples into a single bit set to find which samples we need to interpolate
+						{
+							const scope_decompression_zone<profiler_type> lookup_zone(decompression_zone::database_tier_lookup, tracks);
 
-					// Find the closest loaded samples
-					// Mask all trailing samples to find the first sample by counting trailing zeros
-					const uint32_t candidate_indices0 = sample_indices0 & (0xFFFFFFFFU << (31 - key_frame0));
-					key_frame0 = 31 - count_trailing_zeros(candidate_indices0);
+							// Possible cache miss for the clip header offset
+							// Cache miss for the db clip segment headers pointer
+							const tracks_database_header* tracks_db_header = transform_header.get_database_header();
+							const database_runtime_clip_header* db_clip_header = tracks_db_header->get_clip_header(db->clip_segment_headers);
 
-					// Mask all leading samples to find the second sample by counting leading zeros
-					const uint32_t candidate_indices1 = sample_indices0 & (0xFFFFFFFFU >> key_frame1);
-					key_frame1 = count_leading_zeros(candidate_indices1);
+							// Skip the segment headers when nothing of our clip is streamed in, every sample then lives in the compressed tracks
+							if (has_resident_segments(*db_clip_header))
+							{
+								const database_runtime_segment_header* db_segment_headers = db_clip_header->get_segment_headers();
 
-					// Calculate our new interpolation alpha
-					// We used the rounding policy above to snap to the correct key frame earlier but we might need to interpolate now
-					// if key frames have been removed
-					context.interpolation_alpha = find_linear_interpolation_alpha(sample_index, key_frame0, key_frame1, sample_rounding_policy::none);
+								// Cache miss for the db segment headers
+								const database_runtime_segment_header* db_segment_header0 = db_segment_headers;
+								sample_indices0 |= load_segment_tier_metadata(*db_segment_header0, max_quality_tier, tier_metadata0);
 
-					// Find where our data lives (clip or database tier X)
-					sample_indices0 = segment_tier0_header0->sample_indices;
-					uint32_t sample_indices1 = sample_indices0;	// Identical
+								mark_chunks_sampled(*db, tier_metadata0);
+							}
+						}
+
+						// Find the closest loaded samples
+						const uint32_t requested_key_frame0 = key_frame0;
+						const uint32_t requested_key_frame1 = key_frame1;
+						snap_to_retained_samples(sample_indices0, sample_indices0, key_frame0, key_frame1);
+
+						// Calculate our new interpolation alpha
+						context.interpolation_alpha = find_linear_interpolation_alpha(sample_index, key_frame0, key_frame1, sample_rounding_policy::none);
+
+						// Find where our data lives (clip or database tier X)
+						sample_indices0 = segment_tier0_header0->sample_indices;
+						uint32_t sample_indices1 = sample_indices0;	// Identical
 
-					if (db != nullptr)
-					{
 						const uint64_t sample_index0 = uint64_t(1) << (31 - key_frame0);
 						const uint64_t sample_index1 = uint64_t(1) << (31 - key_frame1);
 
-						const uint8_t* bulk_data_medium = db->bulk_data[0];		// Might be nullptr if we haven't streamed in yet
-						const uint8_t* bulk_data_low = db->bulk_data[1];		// Might be nullptr if we haven't streamed in yet
-						if ((medium_importance_tier_metadata0 & sample_index0) != 0)
+						// The bulk data of a tier is visible once we observe a sample within it
+						const quality_tier sample_tier0 = find_sample_quality_tier(tier_metadata0, sample_index0);
+						if (sample_tier0 != quality_tier::highest_importance)
 						{
-							sample_indices0 = uint32_t(medium_importance_tier_metadata0);
-							db_animated_track_data0 = bulk_data_medium + uint32_t(medium_importance_tier_metadata0 >> 32);
-						}
-						else if ((low_importance_tier_metadata0 & sample_index0) != 0)
-						{
-							sample_indices0 = uint32_t(low_importance_tier_metadata0);
-							db_animated_track_data0 = bulk_data_low + uint32_t(low_importance_tier_metadata0 >> 32);
+							const uint32_t tier_index = uint32_t(sample_tier0) - 1;
+							sample_indices0 = uint32_t(tier_metadata0[tier_index]);
+							db_animated_track_data0 = db->bulk_data[tier_index].load(std::memory_order::memory_order_relaxed) + uint32_t(tier_metadata0[tier_index] >> 32);
 						}
 
 						// Only one segment, our metadata is the same for our second key frame
-						if ((medium_importance_tier_metadata0 & sample_index1) != 0)
-						{
-							sample_indices1 = uint32_t(medium_importance_tier_metadata0);
-							db_animated_track_data1 = bulk_data_medium + uint32_t(medium_importance_tier_metadata0 >> 32);
-						}
-						else if ((low_importance_tier_metadata0 & sample_index1) != 0)
+						const quality_tier sample_tier1 = find_sample_quality_tier(tier_metadata0, sample_index1);
+						if (sample_tier1 != quality_tier::highest_importance)
 						{
-							sample_indices1 = uint32_t(low_importance_tier_metadata0);
-							db_animated_track_data1 = bulk_data_low + uint32_t(low_importance_tier_metadata0 >> 32);
+							const uint32_t tier_index = uint32_t(sample_tier1) - 1;
+							sample_indices1 = uint32_t(tier_metadata0[tier_index]);
+							db_animated_track_data1 = db->bulk_data[tier_index].load(std::memory_order::memory_order_relaxed) + uint32_t(tier_metadata0[tier_index] >> 32);
 						}
-					}
 
-					// Remap our sample indices within the ones actually stored (e.g. index 3 might be the second frame stored)
-					segment_key_frame0 = count_set_bits(and_not(0xFFFFFFFFU >> key_frame0, sample_indices0));
-					segment_key_frame1 = count_set_bits(and_not(0xFFFFFFFFU >> key_frame1, sample_indices1));
+						if (is_telemetry_supported)
+							record_seek_telemetry(*db, sample_tier0, sample_tier1, uint32_t(key_frame0 != requested_key_frame0) + uint32_t(key_frame1 != requested_key_frame1));
+
+						// Remap our sample indices within the ones actually stored (e.g. index 3 might be the second frame stored)
+						segment_key_frame0 = get_retained_sample_index(sample_indices0, key_frame0);
+						segment_key_frame1 = get_retained_sample_index(sample_indices1, key_frame1);
+					}
 
 					// Nasty but safe since they have the same layout
 					segment_header0 = reinterpret_cast<const segment_header*>(segment_tier0_header0);
@@ -372,36 +550,29 @@ namespace acl
 				const uint32_t* segment_start_indices = transform_header.get_segment_start_indices();
 
 				// See segment_streams(..) for implementation details. This implementation is directly tied to it.
-				const uint32_t approx_num_samples_per_segment = header.num_samples / num_segments;	// TODO: Store in header?
+				// The average is cached when the context is initialized unless it doesn't fit.
+				const uint32_t approx_num_samples_per_segment = context.approx_num_samples_per_segment != 0 ? context.approx_num_samples_per_segment : (header.num_samples / num_segments);
 				const uint32_t approx_segment_index = key_frame0 / approx_num_samples_per_segment;
 
-				uint32_t segment_index0 = 0;
-				uint32_t segment_index1 = 0;
-
 				// Our approximate segment guess is just that, a guess. The actual segments we need could be just before or after.
 				// We start looking one segment earlier and up to 2 after. If we have too few segments after, we will hit the
-				// sentinel value of 0xFFFFFFFF and exit the loop.
-				// TODO: Can we do this with SIMD? Load all 4 values, set key_frame0, compare, move mask, count leading zeroes
+				// sentinel value of 0xFFFFFFFF which always compares greater.
+				// The compression guarantees that every sample is found within this window which keeps the lookup
+				// constant time regardless of how many segments the clip contains.
+				// All 4 candidates are compared at once and the first segment that starts after our key frame is the next one.
 				const uint32_t start_segment_index = approx_segment_index > 0 ? (approx_segment_index - 1) : 0;
-				const uint32_t end_segment_index = start_segment_index + 4;
+				const uint32_t segment_index = find_next_segment_index(segment_start_indices, start_segment_index, key_frame0);
 
-				for (uint32_t segment_index = start_segment_index; segment_index < end_segment_index; ++segment_index)
-				{
-					if (key_frame0 < segment_start_indices[segment_index])
-					{
-						// We went too far, use previous segment
-						ACL_ASSERT(segment_index > 0, "Invalid segment index: %u", segment_index);
-						segment_index0 = segment_index - 1;
+				// We went too far, use previous segment
+				ACL_ASSERT(segment_index > 0, "Invalid segment index: %u", segment_index);
+				const uint32_t segment_index0 = segment_index - 1;
 
-						// If wrapping is enabled and we wrapped, use the first segment
-						if (decompression_settings_type::is_wrapping_supported() && key_frame1 == 0)
-							segment_index1 = 0;
-						else
-							segment_index1 = key_frame1 < segment_start_indices[segment_index] ? segment_index0 : segment_index;
-
-						break;
-					}
-				}
+				// If wrapping is enabled and we wrapped, use the first segment
+				uint32_t segment_index1;
+				if (decompression_settings_type::is_wrapping_supported() && key_frame1 == 0)
+					segment_index1 = 0;
+				else
+					segment_index1 = key_frame1 < segment_start_indices[segment_index] ? segment_index0 : segment_index;
 
 				segment_key_frame0 = key_frame0 - segment_start_indices[segment_index0];
 				segment_key_frame1 = key_frame1 - segment_start_indices[segment_index1];
@@ -418,94 +589,108 @@ namespace acl
 					// Calculate our clip relative sample index, we'll remap it later relative to the samples we'll use
 					const float sample_index = context.interpolation_alpha + float(key_frame0);
 
-					// When we load our sample indices and offsets from the database, there can be another thread writing
-					// to those memory locations at the same time (e.g. streaming in/out).
-					// To ensure thread safety, we atomically load the offset and sample indices.
-					uint64_t medium_importance_tier_metadata0 = 0;
-					uint64_t medium_importance_tier_metadata1 = 0;
-					uint64_t low_importance_tier_metadata0 = 0;
-					uint64_t low_importance_tier_metadata1 = 0;
-
-					// Combine all our loaded samples into a single bit set to find which samples we need to interpolate
-					if (db != nullptr)
+					if (db == nullptr)
 					{
-						// Possible cache miss for the clip header offset
-						// Cache miss for the db clip segment headers pointer
-						const tracks_database_header* tracks_db_header = transform_header.get_database_header();
-						const database_runtime_clip_header* db_clip_header = tracks_db_header->get_clip_header(db->clip_segment_headers);
-						const database_runtime_segment_header* db_segment_headers = db_clip_header->get_segment_headers();
-
-						// Cache miss for the db segment headers
-						const database_runtime_segment_header* db_segment_header0 = db_segment_headers + segment_index0;
-						medium_importance_tier_metadata0 = db_segment_header0->tier_metadata[0].load(std::memory_order::memory_order_relaxed);
-						low_importance_tier_metadata0 = db_segment_header0->tier_metadata[1].load(std::memory_order::memory_order_relaxed);
-
-						sample_indices0 |= uint32_t(medium_importance_tier_metadata0);
-						sample_indices0 |= uint32_t(low_importance_tier_metadata0);
-
-						const database_runtime_segment_header* db_segment_header1 = db_segment_headers + segment_index1;
-						medium_importance_tier_metadata1 = db_segment_header1->tier_metadata[0].load(std::memory_order::memory_order_relaxed);
-						low_importance_tier_metadata1 = db_segment_header1->tier_metadata[1].load(std::memory_order::memory_order_relaxed);
-
-						sample_indices1 |= uint32_t(medium_importance_tier_metadata1);
-						sample_indices1 |= uint32_t(low_importance_tier_metadata1);
+						// Only the samples retained within our compressed tracks are used, the segment bit sets
+						// map our key frames directly and the database is never accessed
+						snap_to_retained_samples(sample_indices0, sample_indices1, segment_key_frame0, segment_key_frame1);
+
+						// Calculate our new interpolation alpha from our clip relative sample indices
+						// We used the rounding policy above to snap to the correct key frame earlier but we might need to interpolate now
+						// if key frames have been removed
+						const uint32_t clip_key_frame0 = segment_start_indices[segment_index0] + segment_key_frame0;
+						const uint32_t clip_key_frame1 = segment_start_indices[segment_index1] + segment_key_frame1;
+						context.interpolation_alpha = find_linear_interpolation_alpha(sample_index, clip_key_frame0, clip_key_frame1, sample_rounding_policy::none);
+
+						key_frame0 = clip_key_frame0;
+						key_frame1 = clip_key_frame1;
+
+						// Remap our sample indices within the ones actually stored
+						segment_key_frame0 = get_retained_sample_index(sample_indices0, segment_key_frame0);
+						segment_key_frame1 = get_retained_sample_index(sample_indices1, segment_key_frame1);
 					}
+					else
+					{
+						// When we load our sample indices and offsets from the database, there can be another thread writing
+						// to those memory locations at the same time (e.g. streaming in/out), see load_segment_tier_metadata(..).
+						// The metadata of the tiers we don't sample from remains zero.
+						uint64_t tier_metadata0[k_num_database_tiers] = {};
+						uint64_t tier_metadata1[k_num_database_tiers] = {};
 
-					// Find the closest loaded samples
-					// Mask all trailing samples to find the first sample by counting trailing zeros
-					const uint32_t candidate_indices0 = sample_indices0 & (0xFFFFFFFFU << (31 - segment_key_frame0));
-					segment_key_frame0 = 31 - count_trailing_zeros(candidate_indices0);
+						// Combine all our loaded samples into a single bit set to find which samples we need to interpolate
+						{
+							const scope_decompression_zone<profiler_type> lookup_zone(decompression_zone::database_tier_lookup, tracks);
 
-					// Mask all leading samples to find the second sample by counting leading zeros
-					const uint32_t candidate_indices1 = sample_indices1 & (0xFFFFFFFFU >> segment_key_frame1);
-					segment_key_frame1 = count_leading_zeros(candidate_indices1);
+							// Possible cache miss for the clip header offset
+							// Cache miss for the db clip segment headers pointer
+							const tracks_database_header* tracks_db_header = transform_header.get_database_header();
+							const database_runtime_clip_header* db_clip_header = tracks_db_header->get_clip_header(db->clip_segment_headers);
 
-					// Calculate our clip relative sample indices
-					const uint32_t clip_key_frame0 = segment_start_indices[segment_index0] + segment_key_frame0;
-					const uint32_t clip_key_frame1 = segment_start_indices[segment_index1] + segment_key_frame1;
+							// Skip the segment headers when nothing of our clip is streamed in, every sample then lives in the compressed tracks
+							if (has_resident_segments(*db_clip_header))
+							{
+								const database_runtime_segment_header* db_segment_headers = db_clip_header->get_segment_headers();
 
-					// Calculate our new interpolation alpha
-					// We used the rounding policy above to snap to the correct key frame earlier but we might need to interpolate now
-					// if key frames have been removed
-					context.interpolation_alpha = find_linear_interpolation_alpha(sample_index, clip_key_frame0, clip_key_frame1, sample_rounding_policy::none);
+								// Cache miss for the db segment headers
+								const database_runtime_segment_header* db_segment_header0 = db_segment_headers + segment_index0;
+								sample_indices0 |= load_segment_tier_metadata(*db_segment_header0, max_quality_tier, tier_metadata0);
 
-					// Find where our data lives (clip or database tier X)
-					sample_indices0 = segment_tier0_header0->sample_indices;
-					sample_indices1 = segment_tier0_header1->sample_indices;
+								mark_chunks_sampled(*db, tier_metadata0);
+
+								const database_runtime_segment_header* db_segment_header1 = db_segment_headers + segment_index1;
+								sample_indices1 |= load_segment_tier_metadata(*db_segment_header1, max_quality_tier, tier_metadata1);
+
+								if (segment_index1 != segment_index0)
+									mark_chunks_sampled(*db, tier_metadata1);
+							}
+						}
+
+						// Find the closest loaded samples
+						const uint32_t requested_key_frame0 = segment_key_frame0;
+						const uint32_t requested_key_frame1 = segment_key_frame1;
+						snap_to_retained_samples(sample_indices0, sample_indices1, segment_key_frame0, segment_key_frame1);
+
+						// Calculate our clip relative sample indices
+						const uint32_t clip_key_frame0 = segment_start_indices[segment_index0] + segment_key_frame0;
+						const uint32_t clip_key_frame1 = segment_start_indices[segment_index1] + segment_key_frame1;
+
+						// Calculate our new interpolation alpha
+						context.interpolation_alpha = find_linear_interpolation_alpha(sample_index, clip_key_frame0, clip_key_frame1, sample_rounding_policy::none);
+
+						key_frame0 = clip_key_frame0;
+						key_frame1 = clip_key_frame1;
+
+						// Find where our data lives (clip or database tier X)
+						sample_indices0 = segment_tier0_header0->sample_indices;
+						sample_indices1 = segment_tier0_header1->sample_indices;
 
-					if (db != nullptr)
-					{
 						const uint64_t sample_index0 = uint64_t(1) << (31 - segment_key_frame0);
 						const uint64_t sample_index1 = uint64_t(1) << (31 - segment_key_frame1);
 
-						const uint8_t* bulk_data_medium = db->bulk_data[0];		// Might be nullptr if we haven't streamed in yet
-						const uint8_t* bulk_data_low = db->bulk_data[1];		// Might be nullptr if we haven't streamed in yet
-						if ((medium_importance_tier_metadata0 & sample_index0) != 0)
+						// The bulk data of a tier is visible once we observe a sample within it
+						const quality_tier sample_tier0 = find_sample_quality_tier(tier_metadata0, sample_index0);
+						if (sample_tier0 != quality_tier::highest_importance)
 						{
-							sample_indices0 = uint32_t(medium_importance_tier_metadata0);
-							db_animated_track_data0 = bulk_data_medium + uint32_t(medium_importance_tier_metadata0 >> 32);
-						}
-						else if ((low_importance_tier_metadata0 & sample_index0) != 0)
-						{
-							sample_indices0 = uint32_t(low_importance_tier_metadata0);
-							db_animated_track_data0 = bulk_data_low + uint32_t(low_importance_tier_metadata0 >> 32);
+							const uint32_t tier_index = uint32_t(sample_tier0) - 1;
+							sample_indices0 = uint32_t(tier_metadata0[tier_index]);
+							db_animated_track_data0 = db->bulk_data[tier_index].load(std::memory_order::memory_order_relaxed) + uint32_t(tier_metadata0[tier_index] >> 32);
 						}
 
-						if ((medium_importance_tier_metadata1 & sample_index1) != 0)
-						{
-							sample_indices1 = uint32_t(medium_importance_tier_metadata1);
-							db_animated_track_data1 = bulk_data_medium + uint32_t(medium_importance_tier_metadata1 >> 32);
-						}
-						else if ((low_importance_tier_metadata1 & sample_index1) != 0)
+						const quality_tier sample_tier1 = find_sample_quality_tier(tier_metadata1, sample_index1);
+						if (sample_tier1 != quality_tier::highest_importance)
 						{
-							sample_indices1 = uint32_t(low_importance_tier_metadata1);
-							db_animated_track_data1 = bulk_data_low + uint32_t(low_importance_tier_metadata1 >> 32);
+							const uint32_t tier_index = uint32_t(sample_tier1) - 1;
+							sample_indices1 = uint32_t(tier_metadata1[tier_index]);
+							db_animated_track_data1 = db->bulk_data[tier_index].load(std::memory_order::memory_order_relaxed) + uint32_t(tier_metadata1[tier_index] >> 32);
 						}
-					}
 
-					// Remap our sample indices within the ones actually stored (e.g. index 3 might be the second frame stored)
-					segment_key_frame0 = count_set_bits(and_not(0xFFFFFFFFU >> segment_key_frame0, sample_indices0));
-					segment_key_frame1 = count_set_bits(and_not(0xFFFFFFFFU >> segment_key_frame1, sample_indices1));
+						if (is_telemetry_supported)
+							record_seek_telemetry(*db, sample_tier0, sample_tier1, uint32_t(segment_key_frame0 != requested_key_frame0) + uint32_t(segment_key_frame1 != requested_key_frame1));
+
+						// Remap our sample indices within the ones actually stored (e.g. index 3 might be the second frame stored)
+						segment_key_frame0 = get_retained_sample_index(sample_indices0, segment_key_frame0);
+						segment_key_frame1 = get_retained_sample_index(sample_indices1, segment_key_frame1);
+					}
 
 					// Nasty but safe since they have the same layout
 					segment_header0 = reinterpret_cast<const segment_header*>(segment_tier0_header0);
@@ -518,6 +703,32 @@ namespace acl
 				}
 			}
 
+			// Velocities are scaled by the number of samples between our key frames, we might have wrapped around
+			// Key frames are snapped within at most two segments and the span always fits
+			const uint32_t key_frame_span = key_frame1 >= key_frame0 ? (key_frame1 - key_frame0) : (header.num_samples - key_frame0 + key_frame1);
+			context.key_frame_span = static_cast<uint8_t>(std::min<uint32_t>(key_frame_span, 255));
+
+			// With the floor, ceil, and nearest rounding policies (or when we land on a key frame), a single key frame
+			// contributes. Both key frames then point to it and the animated track cache only unpacks it once.
+			// With per track rounding, every track picks its own key frame and we need both.
+			if (rounding_policy != sample_rounding_policy::per_track)
+			{
+				if (context.interpolation_alpha >= 1.0F)
+				{
+					segment_header0 = segment_header1;
+					segment_key_frame0 = segment_key_frame1;
+					db_animated_track_data0 = db_animated_track_data1;
+					context.interpolation_alpha = 0.0F;
+				}
+
+				if (context.interpolation_alpha <= 0.0F)
+				{
+					segment_header1 = segment_header0;
+					segment_key_frame1 = segment_key_frame0;
+					db_animated_track_data1 = db_animated_track_data0;
+				}
+			}
+
 			{
 				// Prefetch our constant rotation data, we'll need it soon when we start decompressing and we are about to cache miss on the segment headers
 				const uint8_t* constant_data_rotations = transform_header.get_constant_track_data();
@@ -560,6 +771,57 @@ namespace acl
 			context.segment_offsets[1] = ptr_offset32<segment_header>(tracks, segment_header1);
 		}
 
+		template<class decompression_settings_type>
+		inline void set_max_quality_tier_v0(persistent_transform_decompression_context_v0& context, quality_tier tier)
+		{
+			if (context.get_max_quality_tier() == tier)
+				return;	// Nothing to do
+
+			context.max_quality_tier = static_cast<uint8_t>(tier);
+
+			// Cached key frames might have been unpacked from a tier we no longer sample from
+			if (context.keyframe_cache != nullptr)
+				context.keyframe_cache->is_valid = 0;
+
+			if (context.sample_time < 0.0F)
+				return;	// We didn't seek yet, the next seek will honor our new tier
+
+			// Seek again to the current sample time, our key frames might now live elsewhere
+			const float sample_time = context.sample_time;
+			context.sample_time = -1.0F;
+			seek_v0<decompression_settings_type>(context, sample_time, context.get_rounding_policy());
+		}
+
+		inline void prefetch_v0(const persistent_transform_decompression_context_v0& context)
+		{
+			const tracks_header& header = get_tracks_header(*context.tracks);
+			if (header.num_tracks == 0 || context.sample_time < 0.0F)
+				return;	// Empty track list or we didn't seek yet
+
+			const transform_tracks_header& transform_header = get_transform_tracks_header(*context.tracks);
+
+			// Prefetch the first cache line of everything we touch when we start decompressing
+			// Once we seek, the segment pointers are known and we can reach the animated data directly
+			memory_prefetch(transform_header.get_sub_track_types());
+			memory_prefetch(transform_header.get_constant_track_data());
+
+			if (context.is_static_pose)
+				return;	// Only default and constant sub-tracks, nothing else is read
+
+			memory_prefetch(transform_header.get_clip_range_data());
+			memory_prefetch(context.format_per_track_data[0]);
+			memory_prefetch(context.segment_range_data[0]);
+			memory_prefetch(context.animated_track_data[0] + (context.key_frame_bit_offsets[0] / 8));
+
+			if (!context.uses_single_segment)
+			{
+				memory_prefetch(context.format_per_track_data[1]);
+				memory_prefetch(context.segment_range_data[1]);
+			}
+
+			memory_prefetch(context.animated_track_data[1] + (context.key_frame_bit_offsets[1] / 8));
+		}
+
 
 		// TODO: Merge the per track format and segment range info into a single buffer? Less to prefetch and used together
 		// TODO: Remove segment data alignment, no longer required?
@@ -745,6 +1007,134 @@ namespace acl
 			}
 		}
 
+		// Force inline this function, we only use it to keep the code readable
+		template<class decompression_settings_type, class track_writer_type>
+		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void RTM_SIMD_CALL unpack_animated_rotation_sub_tracks_masked(
+			const packed_sub_track_types* rotation_sub_track_types, uint32_t last_entry_index,
+			const persistent_transform_decompression_context_v0& context,
+			animated_track_cache_v0& animated_track_cache, track_writer_type& writer)
+		{
+			const sample_rounding_policy rounding_policy = context.get_rounding_policy();
+
+			// Animated sub-tracks are unpacked in groups of 4 in the order they appear
+			// We gather the track indices of the next 4 animated sub-tracks and if none of them are needed,
+			// we skip the whole group without unpacking it. Consecutive skipped groups are skipped together.
+			uint32_t track_indices[4];
+			uint32_t num_group_tracks = 0;
+			uint32_t num_groups_to_skip = 0;
+			bool is_group_used = false;
+
+			const auto write_group = [&]()
+			{
+				if (num_groups_to_skip != 0)
+				{
+					animated_track_cache.skip_rotation_groups<decompression_settings_type>(context, num_groups_to_skip);
+					num_groups_to_skip = 0;
+				}
+
+				animated_track_cache.unpack_rotation_group<decompression_settings_type>(context);
+
+				for (uint32_t group_index = 0; group_index < num_group_tracks; ++group_index)
+				{
+					const uint32_t track_index = track_indices[group_index];
+
+					// We need the true rounding policy to be statically known when per track rounding is not supported
+					// When it isn't supported, we always use 'none' since the interpolation alpha was properly calculated
+					// and rounding has already been performed for us. Precomputed rounding policies are already applied as well.
+					const sample_rounding_policy rounding_policy_ =
+						decompression_settings_type::is_per_track_rounding_supported() && !animated_track_cache.has_rounding_table() ?
+						writer.get_rounding_policy(rounding_policy, track_index) :
+						sample_rounding_policy::none;
+
+					ACL_ASSERT(rounding_policy_ != sample_rounding_policy::per_track, "track_writer::get_rounding_policy() cannot return per_track");
+
+					const rtm::quatf& value = animated_track_cache.consume_rotation(rounding_policy_);
+
+					if (!writer.skip_track_rotation(track_index))
+						writer.write_rotation(track_index, value);
+				}
+			};
+
+			for (uint32_t entry_index = 0; entry_index <= last_entry_index; ++entry_index)
+			{
+				// Mask out everything but animated sub-tracks
+				uint32_t packed_entry = and_not(~0xAAAAAAAAU, rotation_sub_track_types[entry_index].types);
+				const uint32_t entry_track_index = entry_index * k_num_sub_tracks_per_packed_entry;
+
+				while (packed_entry != 0)
+				{
+					const uint32_t num_leading_zeros = count_leading_zeros(packed_entry);
+					packed_entry &= ~(0x80000000U >> num_leading_zeros);
+
+					const uint32_t track_index = entry_track_index + (num_leading_zeros / 2);
+					track_indices[num_group_tracks++] = track_index;
+					is_group_used |= !writer.skip_track_rotation(track_index);
+
+					if (num_group_tracks == 4)
+					{
+						if (is_group_used)
+							write_group();
+						else
+							num_groups_to_skip++;
+
+						num_group_tracks = 0;
+						is_group_used = false;
+					}
+				}
+			}
+
+			// Our last group is partial, if it isn't needed we are done and there is nothing left to skip
+			if (num_group_tracks != 0 && is_group_used)
+				write_group();
+		}
+
+		// Force inline this function, we only use it to keep the code readable
+		template<class decompression_settings_type, class track_writer_type>
+		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void RTM_SIMD_CALL unpack_animated_rotation_sub_tracks_soa(
+			const packed_sub_track_types* rotation_sub_track_types, uint32_t last_entry_index,
+			const persistent_transform_decompression_context_v0& context,
+			animated_track_cache_v0& animated_track_cache, track_writer_type& writer)
+		{
+			// Animated sub-tracks are unpacked in groups of 4 in the order they appear
+			// We gather the track indices of the next 4 animated sub-tracks and we hand them to the writer in SOA form
+			uint32_t track_indices[4];
+			uint32_t num_group_tracks = 0;
+
+			for (uint32_t entry_index = 0; entry_index <= last_entry_index; ++entry_index)
+			{
+				// Mask out everything but animated sub-tracks
+				uint32_t packed_entry = and_not(~0xAAAAAAAAU, rotation_sub_track_types[entry_index].types);
+				const uint32_t entry_track_index = entry_index * k_num_sub_tracks_per_packed_entry;
+
+				while (packed_entry != 0)
+				{
+					const uint32_t num_leading_zeros = count_leading_zeros(packed_entry);
+					packed_entry &= ~(0x80000000U >> num_leading_zeros);
+
+					track_indices[num_group_tracks++] = entry_track_index + (num_leading_zeros / 2);
+
+					if (num_group_tracks == 4)
+					{
+						animated_track_cache.unpack_rotation_group<decompression_settings_type, true>(context);
+
+						const rtm::vector4f* samples = &animated_track_cache.scratch0[0];
+						writer.write_rotations_soa(&track_indices[0], num_group_tracks, samples[0], samples[1], samples[2], samples[3]);
+
+						num_group_tracks = 0;
+					}
+				}
+			}
+
+			if (num_group_tracks != 0)
+			{
+				// Our last group is partial
+				animated_track_cache.unpack_rotation_group<decompression_settings_type, true>(context);
+
+				const rtm::vector4f* samples = &animated_track_cache.scratch0[0];
+				writer.write_rotations_soa(&track_indices[0], num_group_tracks, samples[0], samples[1], samples[2], samples[3]);
+			}
+		}
+
 		// Force inline this function, we only use it to keep the code readable
 		template<class decompression_settings_type, class track_writer_type>
 		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void RTM_SIMD_CALL unpack_animated_rotation_sub_tracks(
@@ -753,6 +1143,19 @@ namespace acl
 			animated_track_cache_v0& animated_track_cache, track_writer_type& writer)
 		{
 			const sample_rounding_policy rounding_policy = context.get_rounding_policy();
+			const float velocity_scale = track_writer_type::supports_velocity_output() ? get_velocity_scale(context) : 0.0F;
+
+			if (is_masked_track_writer<track_writer_type>::value)
+			{
+				unpack_animated_rotation_sub_tracks_masked<decompression_settings_type>(rotation_sub_track_types, last_entry_index, context, animated_track_cache, writer);
+				return;
+			}
+
+			if (track_writer_type::supports_soa_rotation_output() && !decompression_settings_type::is_per_track_rounding_supported())
+			{
+				unpack_animated_rotation_sub_tracks_soa<decompression_settings_type>(rotation_sub_track_types, last_entry_index, context, animated_track_cache, writer);
+				return;
+			}
 
 			for (uint32_t entry_index = 0, track_index = 0; entry_index <= last_entry_index; ++entry_index)
 			{
@@ -787,9 +1190,9 @@ namespace acl
 
 						// We need the true rounding policy to be statically known when per track rounding is not supported
 						// When it isn't supported, we always use 'none' since the interpolation alpha was properly calculated
-						// and rounding has already been performed for us.
+						// and rounding has already been performed for us. Precomputed rounding policies are already applied as well.
 						const sample_rounding_policy rounding_policy_ =
-							decompression_settings_type::is_per_track_rounding_supported() ?
+							decompression_settings_type::is_per_track_rounding_supported() && !animated_track_cache.has_rounding_table() ?
 							writer.get_rounding_policy(rounding_policy, track_index0) :
 							sample_rounding_policy::none;
 
@@ -801,7 +1204,12 @@ namespace acl
 						ACL_ASSERT(rtm::quat_is_normalized(rotation), "Rotation is not normalized!");
 
 						if (!track_writer_type::skip_all_rotations() && !writer.skip_track_rotation(track_index0))
+						{
 							writer.write_rotation(track_index0, rotation);
+
+							if (track_writer_type::supports_velocity_output())
+								write_consumed_angular_velocity(animated_track_cache, velocity_scale, track_index0, writer);
+						}
 					}
 
 					if ((packed_group & 0x20000000) != 0)
@@ -810,9 +1218,9 @@ namespace acl
 
 						// We need the true rounding policy to be statically known when per track rounding is not supported
 						// When it isn't supported, we always use 'none' since the interpolation alpha was properly calculated
-						// and rounding has already been performed for us.
+						// and rounding has already been performed for us. Precomputed rounding policies are already applied as well.
 						const sample_rounding_policy rounding_policy_ =
-							decompression_settings_type::is_per_track_rounding_supported() ?
+							decompression_settings_type::is_per_track_rounding_supported() && !animated_track_cache.has_rounding_table() ?
 							writer.get_rounding_policy(rounding_policy, track_index1) :
 							sample_rounding_policy::none;
 
@@ -824,7 +1232,12 @@ namespace acl
 						ACL_ASSERT(rtm::quat_is_normalized(rotation), "Rotation is not normalized!");
 
 						if (!track_writer_type::skip_all_rotations() && !writer.skip_track_rotation(track_index1))
+						{
 							writer.write_rotation(track_index1, rotation);
+
+							if (track_writer_type::supports_velocity_output())
+								write_consumed_angular_velocity(animated_track_cache, velocity_scale, track_index1, writer);
+						}
 					}
 
 					if ((packed_group & 0x08000000) != 0)
@@ -833,9 +1246,9 @@ namespace acl
 
 						// We need the true rounding policy to be statically known when per track rounding is not supported
 						// When it isn't supported, we always use 'none' since the interpolation alpha was properly calculated
-						// and rounding has already been performed for us.
+						// and rounding has already been performed for us. Precomputed rounding policies are already applied as well.
 						const sample_rounding_policy rounding_policy_ =
-							decompression_settings_type::is_per_track_rounding_supported() ?
+							decompression_settings_type::is_per_track_rounding_supported() && !animated_track_cache.has_rounding_table() ?
 							writer.get_rounding_policy(rounding_policy, track_index2) :
 							sample_rounding_policy::none;
 
@@ -847,7 +1260,12 @@ namespace acl
 						ACL_ASSERT(rtm::quat_is_normalized(rotation), "Rotation is not normalized!");
 
 						if (!track_writer_type::skip_all_rotations() && !writer.skip_track_rotation(track_index2))
+						{
 							writer.write_rotation(track_index2, rotation);
+
+							if (track_writer_type::supports_velocity_output())
+								write_consumed_angular_velocity(animated_track_cache, velocity_scale, track_index2, writer);
+						}
 					}
 
 					if ((packed_group & 0x02000000) != 0)
@@ -856,9 +1274,9 @@ namespace acl
 
 						// We need the true rounding policy to be statically known when per track rounding is not supported
 						// When it isn't supported, we always use 'none' since the interpolation alpha was properly calculated
-						// and rounding has already been performed for us.
+						// and rounding has already been performed for us. Precomputed rounding policies are already applied as well.
 						const sample_rounding_policy rounding_policy_ =
-							decompression_settings_type::is_per_track_rounding_supported() ?
+							decompression_settings_type::is_per_track_rounding_supported() && !animated_track_cache.has_rounding_table() ?
 							writer.get_rounding_policy(rounding_policy, track_index3) :
 							sample_rounding_policy::none;
 
@@ -870,7 +1288,12 @@ namespace acl
 						ACL_ASSERT(rtm::quat_is_normalized(rotation), "Rotation is not normalized!");
 
 						if (!track_writer_type::skip_all_rotations() && !writer.skip_track_rotation(track_index3))
+						{
 							writer.write_rotation(track_index3, rotation);
+
+							if (track_writer_type::supports_velocity_output())
+								write_consumed_angular_velocity(animated_track_cache, velocity_scale, track_index3, writer);
+						}
 					}
 				}
 			}
@@ -1069,6 +1492,87 @@ namespace acl
 			}
 		}
 
+		// Force inline this function, we only use it to keep the code readable
+		template<class decompression_settings_adapter_type, class track_writer_type>
+		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void RTM_SIMD_CALL unpack_animated_translation_sub_tracks_masked(
+			const packed_sub_track_types* translation_sub_track_types, uint32_t last_entry_index,
+			const persistent_transform_decompression_context_v0& context,
+			animated_track_cache_v0& animated_track_cache, track_writer_type& writer)
+		{
+			const sample_rounding_policy rounding_policy = context.get_rounding_policy();
+
+			// Animated sub-tracks are unpacked in groups of 4 in the order they appear
+			// We gather the track indices of the next 4 animated sub-tracks and if none of them are needed,
+			// we skip the whole group without unpacking it. Consecutive skipped groups are skipped together.
+			uint32_t track_indices[4];
+			uint32_t num_group_tracks = 0;
+			uint32_t num_groups_to_skip = 0;
+			bool is_group_used = false;
+
+			const auto write_group = [&]()
+			{
+				if (num_groups_to_skip != 0)
+				{
+					animated_track_cache.skip_translation_groups<decompression_settings_adapter_type>(context, num_groups_to_skip);
+					num_groups_to_skip = 0;
+				}
+
+				animated_track_cache.unpack_translation_group<decompression_settings_adapter_type>(context);
+
+				for (uint32_t group_index = 0; group_index < num_group_tracks; ++group_index)
+				{
+					const uint32_t track_index = track_indices[group_index];
+
+					// We need the true rounding policy to be statically known when per track rounding is not supported
+					// When it isn't supported, we always use 'none' since the interpolation alpha was properly calculated
+					// and rounding has already been performed for us. Precomputed rounding policies are already applied as well.
+					const sample_rounding_policy rounding_policy_ =
+						decompression_settings_adapter_type::is_per_track_rounding_supported() && !animated_track_cache.has_rounding_table() ?
+						writer.get_rounding_policy(rounding_policy, track_index) :
+						sample_rounding_policy::none;
+
+					ACL_ASSERT(rounding_policy_ != sample_rounding_policy::per_track, "track_writer::get_rounding_policy() cannot return per_track");
+
+					const rtm::vector4f& value = animated_track_cache.consume_translation(rounding_policy_);
+
+					if (!writer.skip_track_translation(track_index))
+						writer.write_translation(track_index, value);
+				}
+			};
+
+			for (uint32_t entry_index = 0; entry_index <= last_entry_index; ++entry_index)
+			{
+				// Mask out everything but animated sub-tracks
+				uint32_t packed_entry = and_not(~0xAAAAAAAAU, translation_sub_track_types[entry_index].types);
+				const uint32_t entry_track_index = entry_index * k_num_sub_tracks_per_packed_entry;
+
+				while (packed_entry != 0)
+				{
+					const uint32_t num_leading_zeros = count_leading_zeros(packed_entry);
+					packed_entry &= ~(0x80000000U >> num_leading_zeros);
+
+					const uint32_t track_index = entry_track_index + (num_leading_zeros / 2);
+					track_indices[num_group_tracks++] = track_index;
+					is_group_used |= !writer.skip_track_translation(track_index);
+
+					if (num_group_tracks == 4)
+					{
+						if (is_group_used)
+							write_group();
+						else
+							num_groups_to_skip++;
+
+						num_group_tracks = 0;
+						is_group_used = false;
+					}
+				}
+			}
+
+			// Our last group is partial, if it isn't needed we are done and there is nothing left to skip
+			if (num_group_tracks != 0 && is_group_used)
+				write_group();
+		}
+
 		// Force inline this function, we only use it to keep the code readable
 		template<class decompression_settings_adapter_type, class track_writer_type>
 		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void RTM_SIMD_CALL unpack_animated_translation_sub_tracks(
@@ -1077,6 +1581,13 @@ namespace acl
 			animated_track_cache_v0& animated_track_cache, track_writer_type& writer)
 		{
 			const sample_rounding_policy rounding_policy = context.get_rounding_policy();
+			const float velocity_scale = track_writer_type::supports_velocity_output() ? get_velocity_scale(context) : 0.0F;
+
+			if (is_masked_track_writer<track_writer_type>::value)
+			{
+				unpack_animated_translation_sub_tracks_masked<decompression_settings_adapter_type>(translation_sub_track_types, last_entry_index, context, animated_track_cache, writer);
+				return;
+			}
 
 			for (uint32_t entry_index = 0, track_index = 0; entry_index <= last_entry_index; ++entry_index)
 			{
@@ -1111,9 +1622,9 @@ namespace acl
 
 						// We need the true rounding policy to be statically known when per track rounding is not supported
 						// When it isn't supported, we always use 'none' since the interpolation alpha was properly calculated
-						// and rounding has already been performed for us.
+						// and rounding has already been performed for us. Precomputed rounding policies are already applied as well.
 						const sample_rounding_policy rounding_policy_ =
-							decompression_settings_adapter_type::is_per_track_rounding_supported() ?
+							decompression_settings_adapter_type::is_per_track_rounding_supported() && !animated_track_cache.has_rounding_table() ?
 							writer.get_rounding_policy(rounding_policy, track_index0) :
 							sample_rounding_policy::none;
 
@@ -1124,7 +1635,12 @@ namespace acl
 						ACL_ASSERT(rtm::vector_is_finite3(translation), "Translation is not valid!");
 
 						if (!track_writer_type::skip_all_translations() && !writer.skip_track_translation(track_index0))
+						{
 							writer.write_translation(track_index0, translation);
+
+							if (track_writer_type::supports_velocity_output())
+								write_consumed_linear_velocity(animated_track_cache, velocity_scale, track_index0, writer);
+						}
 					}
 
 					if ((packed_group & 0x20000000) != 0)
@@ -1133,9 +1649,9 @@ namespace acl
 
 						// We need the true rounding policy to be statically known when per track rounding is not supported
 						// When it isn't supported, we always use 'none' since the interpolation alpha was properly calculated
-						// and rounding has already been performed for us.
+						// and rounding has already been performed for us. Precomputed rounding policies are already applied as well.
 						const sample_rounding_policy rounding_policy_ =
-							decompression_settings_adapter_type::is_per_track_rounding_supported() ?
+							decompression_settings_adapter_type::is_per_track_rounding_supported() && !animated_track_cache.has_rounding_table() ?
 							writer.get_rounding_policy(rounding_policy, track_index1) :
 							sample_rounding_policy::none;
 
@@ -1146,7 +1662,12 @@ namespace acl
 						ACL_ASSERT(rtm::vector_is_finite3(translation), "Translation is not valid!");
 
 						if (!track_writer_type::skip_all_translations() && !writer.skip_track_translation(track_index1))
+						{
 							writer.write_translation(track_index1, translation);
+
+							if (track_writer_type::supports_velocity_output())
+								write_consumed_linear_velocity(animated_track_cache, velocity_scale, track_index1, writer);
+						}
 					}
 
 					if ((packed_group & 0x08000000) != 0)
@@ -1155,9 +1676,9 @@ namespace acl
 
 						// We need the true rounding policy to be statically known when per track rounding is not supported
 						// When it isn't supported, we always use 'none' since the interpolation alpha was properly calculated
-						// and rounding has already been performed for us.
+						// and rounding has already been performed for us. Precomputed rounding policies are already applied as well.
 						const sample_rounding_policy rounding_policy_ =
-							decompression_settings_adapter_type::is_per_track_rounding_supported() ?
+							decompression_settings_adapter_type::is_per_track_rounding_supported() && !animated_track_cache.has_rounding_table() ?
 							writer.get_rounding_policy(rounding_policy, track_index2) :
 							sample_rounding_policy::none;
 
@@ -1168,7 +1689,12 @@ namespace acl
 						ACL_ASSERT(rtm::vector_is_finite3(translation), "Translation is not valid!");
 
 						if (!track_writer_type::skip_all_translations() && !writer.skip_track_translation(track_index2))
+						{
 							writer.write_translation(track_index2, translation);
+
+							if (track_writer_type::supports_velocity_output())
+								write_consumed_linear_velocity(animated_track_cache, velocity_scale, track_index2, writer);
+						}
 					}
 
 					if ((packed_group & 0x02000000) != 0)
@@ -1177,9 +1703,9 @@ namespace acl
 
 						// We need the true rounding policy to be statically known when per track rounding is not supported
 						// When it isn't supported, we always use 'none' since the interpolation alpha was properly calculated
-						// and rounding has already been performed for us.
+						// and rounding has already been performed for us. Precomputed rounding policies are already applied as well.
 						const sample_rounding_policy rounding_policy_ =
-							decompression_settings_adapter_type::is_per_track_rounding_supported() ?
+							decompression_settings_adapter_type::is_per_track_rounding_supported() && !animated_track_cache.has_rounding_table() ?
 							writer.get_rounding_policy(rounding_policy, track_index3) :
 							sample_rounding_policy::none;
 
@@ -1190,7 +1716,12 @@ namespace acl
 						ACL_ASSERT(rtm::vector_is_finite3(translation), "Translation is not valid!");
 
 						if (!track_writer_type::skip_all_translations() && !writer.skip_track_translation(track_index3))
+						{
 							writer.write_translation(track_index3, translation);
+
+							if (track_writer_type::supports_velocity_output())
+								write_consumed_linear_velocity(animated_track_cache, velocity_scale, track_index3, writer);
+						}
 					}
 				}
 			}
@@ -1394,6 +1925,87 @@ namespace acl
 			}
 		}
 
+		// Force inline this function, we only use it to keep the code readable
+		template<class decompression_settings_adapter_type, class track_writer_type>
+		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void RTM_SIMD_CALL unpack_animated_scale_sub_tracks_masked(
+			const packed_sub_track_types* scale_sub_track_types, uint32_t last_entry_index,
+			const persistent_transform_decompression_context_v0& context,
+			animated_track_cache_v0& animated_track_cache, track_writer_type& writer)
+		{
+			const sample_rounding_policy rounding_policy = context.get_rounding_policy();
+
+			// Animated sub-tracks are unpacked in groups of 4 in the order they appear
+			// We gather the track indices of the next 4 animated sub-tracks and if none of them are needed,
+			// we skip the whole group without unpacking it. Consecutive skipped groups are skipped together.
+			uint32_t track_indices[4];
+			uint32_t num_group_tracks = 0;
+			uint32_t num_groups_to_skip = 0;
+			bool is_group_used = false;
+
+			const auto write_group = [&]()
+			{
+				if (num_groups_to_skip != 0)
+				{
+					animated_track_cache.skip_scale_groups<decompression_settings_adapter_type>(context, num_groups_to_skip);
+					num_groups_to_skip = 0;
+				}
+
+				animated_track_cache.unpack_scale_group<decompression_settings_adapter_type>(context);
+
+				for (uint32_t group_index = 0; group_index < num_group_tracks; ++group_index)
+				{
+					const uint32_t track_index = track_indices[group_index];
+
+					// We need the true rounding policy to be statically known when per track rounding is not supported
+					// When it isn't supported, we always use 'none' since the interpolation alpha was properly calculated
+					// and rounding has already been performed for us. Precomputed rounding policies are already applied as well.
+					const sample_rounding_policy rounding_policy_ =
+						decompression_settings_adapter_type::is_per_track_rounding_supported() && !animated_track_cache.has_rounding_table() ?
+						writer.get_rounding_policy(rounding_policy, track_index) :
+						sample_rounding_policy::none;
+
+					ACL_ASSERT(rounding_policy_ != sample_rounding_policy::per_track, "track_writer::get_rounding_policy() cannot return per_track");
+
+					const rtm::vector4f& value = animated_track_cache.consume_scale(rounding_policy_);
+
+					if (!writer.skip_track_scale(track_index))
+						writer.write_scale(track_index, value);
+				}
+			};
+
+			for (uint32_t entry_index = 0; entry_index <= last_entry_index; ++entry_index)
+			{
+				// Mask out everything but animated sub-tracks
+				uint32_t packed_entry = and_not(~0xAAAAAAAAU, scale_sub_track_types[entry_index].types);
+				const uint32_t entry_track_index = entry_index * k_num_sub_tracks_per_packed_entry;
+
+				while (packed_entry != 0)
+				{
+					const uint32_t num_leading_zeros = count_leading_zeros(packed_entry);
+					packed_entry &= ~(0x80000000U >> num_leading_zeros);
+
+					const uint32_t track_index = entry_track_index + (num_leading_zeros / 2);
+					track_indices[num_group_tracks++] = track_index;
+					is_group_used |= !writer.skip_track_scale(track_index);
+
+					if (num_group_tracks == 4)
+					{
+						if (is_group_used)
+							write_group();
+						else
+							num_groups_to_skip++;
+
+						num_group_tracks = 0;
+						is_group_used = false;
+					}
+				}
+			}
+
+			// Our last group is partial, if it isn't needed we are done and there is nothing left to skip
+			if (num_group_tracks != 0 && is_group_used)
+				write_group();
+		}
+
 		// Force inline this function, we only use it to keep the code readable
 		template<class decompression_settings_adapter_type, class track_writer_type>
 		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void RTM_SIMD_CALL unpack_animated_scale_sub_tracks(
@@ -1403,6 +2015,12 @@ namespace acl
 		{
 			const sample_rounding_policy rounding_policy = context.get_rounding_policy();
 
+			if (is_masked_track_writer<track_writer_type>::value)
+			{
+				unpack_animated_scale_sub_tracks_masked<decompression_settings_adapter_type>(scale_sub_track_types, last_entry_index, context, animated_track_cache, writer);
+				return;
+			}
+
 			for (uint32_t entry_index = 0, track_index = 0; entry_index <= last_entry_index; ++entry_index)
 			{
 				// Mask out everything but animated sub-tracks, this way we can early out when we iterate
@@ -1436,9 +2054,9 @@ namespace acl
 
 						// We need the true rounding policy to be statically known when per track rounding is not supported
 						// When it isn't supported, we always use 'none' since the interpolation alpha was properly calculated
-						// and rounding has already been performed for us.
+						// and rounding has already been performed for us. Precomputed rounding policies are already applied as well.
 						const sample_rounding_policy rounding_policy_ =
-							decompression_settings_adapter_type::is_per_track_rounding_supported() ?
+							decompression_settings_adapter_type::is_per_track_rounding_supported() && !animated_track_cache.has_rounding_table() ?
 							writer.get_rounding_policy(rounding_policy, track_index0) :
 							sample_rounding_policy::none;
 
@@ -1458,9 +2076,9 @@ namespace acl
 
 						// We need the true rounding policy to be statically known when per track rounding is not supported
 						// When it isn't supported, we always use 'none' since the interpolation alpha was properly calculated
-						// and rounding has already been performed for us.
+						// and rounding has already been performed for us. Precomputed rounding policies are already applied as well.
 						const sample_rounding_policy rounding_policy_ =
-							decompression_settings_adapter_type::is_per_track_rounding_supported() ?
+							decompression_settings_adapter_type::is_per_track_rounding_supported() && !animated_track_cache.has_rounding_table() ?
 							writer.get_rounding_policy(rounding_policy, track_index1) :
 							sample_rounding_policy::none;
 
@@ -1480,9 +2098,9 @@ namespace acl
 
 						// We need the true rounding policy to be statically known when per track rounding is not supported
 						// When it isn't supported, we always use 'none' since the interpolation alpha was properly calculated
-						// and rounding has already been performed for us.
+						// and rounding has already been performed for us. Precomputed rounding policies are already applied as well.
 						const sample_rounding_policy rounding_policy_ =
-							decompression_settings_adapter_type::is_per_track_rounding_supported() ?
+							decompression_settings_adapter_type::is_per_track_rounding_supported() && !animated_track_cache.has_rounding_table() ?
 							writer.get_rounding_policy(rounding_policy, track_index2) :
 							sample_rounding_policy::none;
 
@@ -1502,9 +2120,9 @@ namespace acl
 
 						// We need the true rounding policy to be statically known when per track rounding is not supported
 						// When it isn't supported, we always use 'none' since the interpolation alpha was properly calculated
-						// and rounding has already been performed for us.
+						// and rounding has already been performed for us. Precomputed rounding policies are already applied as well.
 						const sample_rounding_policy rounding_policy_ =
-							decompression_settings_adapter_type::is_per_track_rounding_supported() ?
+							decompression_settings_adapter_type::is_per_track_rounding_supported() && !animated_track_cache.has_rounding_table() ?
 							writer.get_rounding_policy(rounding_policy, track_index3) :
 							sample_rounding_policy::none;
 
@@ -1521,19 +2139,168 @@ namespace acl
 			}
 		}
 
-		template<class decompression_settings_type, class track_writer_type>
-		inline void decompress_tracks_v0(const persistent_transform_decompression_context_v0& context, track_writer_type& writer)
+		// Returns the number of bits that precede each animated group within the key frames we interpolate, see track_offset_table
+		inline void get_group_bit_offsets(const persistent_transform_decompression_context_v0& context, const track_offset_table_v0& offset_table, const uint32_t*& out_group_bit_offsets0, const uint32_t*& out_group_bit_offsets1)
+		{
+			const compressed_tracks* tracks = context.tracks;
+			const transform_tracks_header& transform_header = get_transform_tracks_header(*tracks);
+			const bool has_stripped_segment_headers = tracks->has_database() || tracks->has_stripped_keyframes();
+			const uint8_t* segment_headers = has_stripped_segment_headers ? reinterpret_cast<const uint8_t*>(transform_header.get_stripped_segment_headers()) : reinterpret_cast<const uint8_t*>(transform_header.get_segment_headers());
+			const size_t segment_header_size = has_stripped_segment_headers ? sizeof(stripped_segment_header_t) : sizeof(segment_header);
+
+			const uint32_t segment_index0 = uint32_t((reinterpret_cast<const uint8_t*>(context.segment_offsets[0].add_to(tracks)) - segment_headers) / segment_header_size);
+			const uint32_t segment_index1 = uint32_t((reinterpret_cast<const uint8_t*>(context.segment_offsets[1].add_to(tracks)) - segment_headers) / segment_header_size);
+
+			const uint32_t num_groups = offset_table.get_num_groups();
+			out_group_bit_offsets0 = offset_table.group_bit_offsets + (segment_index0 * num_groups);
+			out_group_bit_offsets1 = offset_table.group_bit_offsets + (segment_index1 * num_groups);
+		}
+
+		// Moves our track caches to the first sub-track of a packed sub-track entry
+		// Whole groups are skipped using the offset table and when the entry starts within a group,
+		// that group is unpacked and the samples that precede the entry are consumed and discarded
+		template<class decompression_settings_type>
+		inline void skip_to_sub_track_entry(const persistent_transform_decompression_context_v0& context, const track_offset_table_v0& offset_table, uint32_t entry_index,
+			constant_track_cache_v0& constant_track_cache, animated_track_cache_v0& animated_track_cache)
+		{
+			using translation_adapter = acl_impl::translation_decompression_settings_adapter<decompression_settings_type>;
+			using scale_adapter = acl_impl::scale_decompression_settings_adapter<decompression_settings_type>;
+
+			const uint32_t* sub_track_counts = offset_table.sub_track_counts + (entry_index * k_track_offset_table_num_counts_per_entry);
+			const uint32_t num_constant_rotations = sub_track_counts[0];
+			const uint32_t num_animated_rotations = sub_track_counts[1];
+			const uint32_t num_constant_translations = sub_track_counts[2];
+			const uint32_t num_animated_translations = sub_track_counts[3];
+			const uint32_t num_constant_scales = sub_track_counts[4];
+			const uint32_t num_animated_scales = sub_track_counts[5];
+
+			// Constant rotations are either shared or unpacked 16 at a time
+			if (constant_track_cache.shared_rotations != nullptr)
+				constant_track_cache.shared_rotations += num_constant_rotations;
+			else if (num_constant_rotations >= constant_track_cache.rotations.num_left_to_unpack)
+				constant_track_cache.rotations.num_left_to_unpack = 0;	// None are left for us
+			else
+			{
+				if (num_constant_rotations >= 4)
+					constant_track_cache.skip_rotation_groups<decompression_settings_type>(context, num_constant_rotations / 4);
+
+				if ((num_constant_rotations % 4) != 0)
+				{
+					constant_track_cache.unpack_rotation_group<decompression_settings_type>(context);
+					constant_track_cache.rotations.cache_read_index += num_constant_rotations % 4;
+				}
+			}
+
+			// Constant translations and scales are read in place
+			constant_track_cache.constant_data_translations += num_constant_translations * sizeof(rtm::float3f);
+			constant_track_cache.constant_data_scales += num_constant_scales * sizeof(rtm::float3f);
+
+			if (context.is_static_pose)
+				return;	// No animated sub-tracks, the animated track cache isn't used
+
+			const uint32_t* group_bit_offsets0;
+			const uint32_t* group_bit_offsets1;
+			get_group_bit_offsets(context, offset_table, group_bit_offsets0, group_bit_offsets1);
+
+			if (num_animated_rotations >= animated_track_cache.rotations.num_left_to_unpack)
+				animated_track_cache.rotations.num_left_to_unpack = 0;	// None are left for us
+			else
+			{
+				const uint32_t num_groups_to_skip = num_animated_rotations / 4;
+				if (num_groups_to_skip != 0)
+				{
+					const uint32_t group_bit_sizes[2] = { group_bit_offsets0[num_groups_to_skip], group_bit_offsets1[num_groups_to_skip] };
+					animated_track_cache.skip_rotation_groups<decompression_settings_type>(context, num_groups_to_skip, group_bit_sizes);
+				}
+
+				if ((num_animated_rotations % 4) != 0)
+				{
+					animated_track_cache.unpack_rotation_group<decompression_settings_type>(context);
+					animated_track_cache.rotations.cache_read_index += num_animated_rotations % 4;
+				}
+			}
+
+			if (num_animated_translations >= animated_track_cache.translations.num_left_to_unpack)
+				animated_track_cache.translations.num_left_to_unpack = 0;	// None are left for us
+			else
+			{
+				const uint32_t num_groups_to_skip = num_animated_translations / 4;
+				if (num_groups_to_skip != 0)
+				{
+					const uint32_t group_index = offset_table.num_rotation_groups + num_groups_to_skip;
+					const uint32_t group_bit_sizes[2] = { group_bit_offsets0[group_index], group_bit_offsets1[group_index] };
+					animated_track_cache.skip_translation_groups<translation_adapter>(context, num_groups_to_skip, group_bit_sizes);
+				}
+
+				if ((num_animated_translations % 4) != 0)
+				{
+					animated_track_cache.unpack_translation_group<translation_adapter>(context);
+					animated_track_cache.translations.cache_read_index += num_animated_translations % 4;
+				}
+			}
+
+			if (num_animated_scales >= animated_track_cache.scales.num_left_to_unpack)
+				animated_track_cache.scales.num_left_to_unpack = 0;	// None are left for us
+			else
+			{
+				const uint32_t num_groups_to_skip = num_animated_scales / 4;
+				if (num_groups_to_skip != 0)
+				{
+					const uint32_t group_index = offset_table.num_rotation_groups + offset_table.num_translation_groups + num_groups_to_skip;
+					const uint32_t group_bit_sizes[2] = { group_bit_offsets0[group_index], group_bit_offsets1[group_index] };
+					animated_track_cache.skip_scale_groups<scale_adapter>(context, num_groups_to_skip, group_bit_sizes);
+				}
+
+				if ((num_animated_scales % 4) != 0)
+				{
+					animated_track_cache.unpack_scale_group<scale_adapter>(context);
+					animated_track_cache.scales.cache_read_index += num_animated_scales % 4;
+				}
+			}
+		}
+
+		// Reads the track layout from the compressed tracks
+		struct dynamic_transform_layout_adapter
+		{
+			static uint32_t get_num_tracks(const tracks_header& header) { return header.num_tracks; }
+			static uint32_t has_scale(const persistent_transform_decompression_context_v0& context) { return context.has_scale; }
+			static const packed_sub_track_types* get_sub_track_types(const compressed_tracks& tracks) { return get_transform_tracks_header(tracks).get_sub_track_types(); }
+		};
+
+		// Uses the statically known track layout, see null_transform_layout
+		template<class transform_layout_type>
+		struct static_transform_layout_adapter
+		{
+			static constexpr uint32_t get_num_tracks(const tracks_header& /*header*/) { return transform_layout_type::get_num_tracks(); }
+			static constexpr uint32_t has_scale(const persistent_transform_decompression_context_v0& /*context*/) { return transform_layout_type::has_scale() ? 1 : 0; }
+			static const packed_sub_track_types* get_sub_track_types(const compressed_tracks& /*tracks*/) { return reinterpret_cast<const packed_sub_track_types*>(transform_layout_type::get_packed_sub_track_types()); }
+		};
+
+		template<class decompression_settings_type, class layout_adapter_type, class track_writer_type>
+		// When an offset table is provided, only the tracks from the first entry onward are decompressed and the
+		// track writer receives track indices relative to its first track, see decompress_track_range_v0(..)
+		inline void decompress_tracks_v0_impl(const persistent_transform_decompression_context_v0& context, const track_rounding_table_v0* rounding_table, const track_offset_table_v0* offset_table, uint32_t first_entry_index, track_writer_type& writer)
 		{
 			const compressed_tracks* tracks = context.tracks;
+
+			using profiler_type = typename decompression_settings_type::profiler_type;
+			const scope_decompression_zone<profiler_type> decompress_zone(decompression_zone::decompress_tracks, tracks);
+
 			const tracks_header& header = get_tracks_header(*tracks);
-			const uint32_t num_tracks = header.num_tracks;
-			if (num_tracks == 0)
-				return;	// Empty track list
+			const uint32_t num_tracks = layout_adapter_type::get_num_tracks(header);
+			const uint32_t first_track_index = first_entry_index * k_num_sub_tracks_per_packed_entry;
+			if (num_tracks <= first_track_index || get_num_lod_tracks(writer, num_tracks - first_track_index) == 0)
+				return;	// Empty track list, LOD, or range
 
 			ACL_ASSERT(context.sample_time >= 0.0f, "Context not set to a valid sample time");
 			if (context.sample_time < 0.0F)
 				return;	// Invalid sample time, we didn't seek yet
 
+			// Velocities are calculated from the floor and ceil key frames retained for per track rounding
+			static_assert(!track_writer_type::supports_velocity_output() || decompression_settings_type::is_per_track_rounding_supported(), "Velocity output requires per track rounding support");
+			ACL_ASSERT(!track_writer_type::supports_velocity_output() || rounding_table == nullptr, "Velocity output does not support track rounding tables");
+			ACL_ASSERT(!track_writer_type::supports_velocity_output() || context.get_rounding_policy() == sample_rounding_policy::per_track, "Velocity output requires seeking with the per_track rounding policy");
+
 			// Due to the SIMD operations, we sometimes overflow in the SIMD lanes not used.
 			// Disable floating point exceptions to avoid issues.
 			fp_environment fp_env;
@@ -1544,12 +2311,18 @@ namespace acl
 			using scale_adapter = acl_impl::scale_decompression_settings_adapter<decompression_settings_type>;
 
 			const rtm::vector4f default_scale = rtm::vector_set(float(header.get_default_scale()));
-			const uint32_t has_scale = context.has_scale;
+			const uint32_t has_scale = layout_adapter_type::has_scale(context);
 
-			const packed_sub_track_types* sub_track_types = get_transform_tracks_header(*tracks).get_sub_track_types();
+			const packed_sub_track_types* sub_track_types = layout_adapter_type::get_sub_track_types(*tracks);
 			const uint32_t num_sub_track_entries = (num_tracks + k_num_sub_tracks_per_packed_entry - 1) / k_num_sub_tracks_per_packed_entry;
-			const uint32_t num_padded_sub_tracks = (num_sub_track_entries * k_num_sub_tracks_per_packed_entry) - num_tracks;
-			const uint32_t last_entry_index = num_sub_track_entries - 1;
+
+			// Tracks are stored in output order, when only the tracks of an LOD are needed we stop once they have been unpacked
+			// Every sub-track kind reads its data independently, the ones past the LOD are never touched
+			// A range skips the entries that precede it and its tracks are then numbered from 0
+			const uint32_t num_lod_tracks = get_num_lod_tracks(writer, num_tracks - first_track_index);
+			const uint32_t num_lod_sub_track_entries = (num_lod_tracks + k_num_sub_tracks_per_packed_entry - 1) / k_num_sub_tracks_per_packed_entry;
+			const uint32_t num_padded_sub_tracks = (num_lod_sub_track_entries * k_num_sub_tracks_per_packed_entry) - num_lod_tracks;
+			const uint32_t last_entry_index = num_lod_sub_track_entries - 1;
 
 			// Build a mask to strip the extra sub-tracks we don't need that live in the padding
 			// They are set to 0 which means they would be 'default' sub-tracks but they don't really exist
@@ -1557,7 +2330,7 @@ namespace acl
 			// Sub-tracks that are kept have their bits set to 1 to mask them with logical AND later
 			const uint32_t padding_mask = num_padded_sub_tracks != 0 ? ~(0xFFFFFFFF >> ((k_num_sub_tracks_per_packed_entry - num_padded_sub_tracks) * 2)) : 0xFFFFFFFF;
 
-			const packed_sub_track_types* rotation_sub_track_types = sub_track_types;
+			const packed_sub_track_types* rotation_sub_track_types = sub_track_types + first_entry_index;
 			const packed_sub_track_types* translation_sub_track_types = rotation_sub_track_types + num_sub_track_entries;
 			const packed_sub_track_types* scale_sub_track_types = translation_sub_track_types + num_sub_track_entries;
 
@@ -1576,9 +2349,24 @@ namespace acl
 				ACL_IMPL_SEEK_PREFETCH(constant_track_cache.constant_data_translations + 128);
 			}
 
+			// Static poses only contain default and constant sub-tracks, we skip everything animated
+			const bool is_static_pose = context.is_static_pose;
+
 			animated_track_cache_v0 animated_track_cache;
-			animated_track_cache.initialize<decompression_settings_type, translation_adapter>(context);
+			if (!is_static_pose)
+			{
+				animated_track_cache.initialize<decompression_settings_type, translation_adapter>(context);
+				animated_track_cache.bind_rounding_table<decompression_settings_type>(context, rounding_table);
+
+				// Ranges can be decompressed concurrently from the same context, they do not use the persistent key frame cache
+				if (offset_table == nullptr)
+					animated_track_cache.bind_keyframe_cache(context);
+			}
 
+			if (offset_table != nullptr && first_entry_index != 0)
+				skip_to_sub_track_entry<decompression_settings_type>(context, *offset_table, first_entry_index, constant_track_cache, animated_track_cache);
+
+			if (!is_static_pose)
 			{
 				// Start prefetching the per track metadata of both segments
 				// They might live in a different memory page than the clip's header and constant data
@@ -1606,7 +2394,10 @@ namespace acl
 
 			// Unpack our constant rotation sub-tracks
 			// Constant rotation sub-tracks are very common, this should take at least 200 cycles
-			unpack_constant_rotation_sub_tracks<decompression_settings_type>(rotation_sub_track_types, last_entry_index, context, constant_track_cache, writer);
+			{
+				const scope_decompression_zone<profiler_type> zone(decompression_zone::unpack_constant_sub_tracks, tracks);
+				unpack_constant_rotation_sub_tracks<decompression_settings_type>(rotation_sub_track_types, last_entry_index, context, constant_track_cache, writer);
+			}
 
 			// By now, our constant translations (3 cache lines) have landed in L2 after our prefetching has completed
 			// We typically will do enough work above to hide the latency
@@ -1614,6 +2405,7 @@ namespace acl
 			// Instead, we prefetch our segment range and animated data
 			// The second key frame of animated data might not live in the same memory page even if we use a single segment
 			// so this allows us to prime the TLB as well
+			if (!is_static_pose)
 			{
 				const uint8_t* segment_range_data0 = animated_track_cache.segment_sampling_context_rotations[0].segment_range_data;
 				const uint8_t* segment_range_data1 = animated_track_cache.segment_sampling_context_rotations[1].segment_range_data;
@@ -1636,7 +2428,10 @@ namespace acl
 
 			// Unpack our constant translation sub-tracks
 			// Constant translation sub-tracks are very common, this should take at least 200 cycles
-			unpack_constant_translation_sub_tracks(translation_sub_track_types, last_entry_index, constant_track_cache, writer);
+			{
+				const scope_decompression_zone<profiler_type> zone(decompression_zone::unpack_constant_sub_tracks, tracks);
+				unpack_constant_translation_sub_tracks(translation_sub_track_types, last_entry_index, constant_track_cache, writer);
+			}
 
 			if (has_scale)
 			{
@@ -1646,6 +2441,7 @@ namespace acl
 
 				// Unpack our constant scale sub-tracks
 				// Constant scale sub-tracks are very rare, this shouldn't take much more than 50 cycles
+				const scope_decompression_zone<profiler_type> zone(decompression_zone::unpack_constant_sub_tracks, tracks);
 				unpack_constant_scale_sub_tracks(scale_sub_track_types, last_entry_index, constant_track_cache, writer);
 			}
 			else
@@ -1664,7 +2460,7 @@ namespace acl
 
 					// No scale present, everything is just the default value
 					// This shouldn't take much more than 50 cycles
-					for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+					for (uint32_t track_index = 0; track_index < num_lod_tracks; ++track_index)
 					{
 						if (!track_writer_type::skip_all_scales() && !writer.skip_track_scale(track_index))
 						{
@@ -1677,6 +2473,15 @@ namespace acl
 				}
 			}
 
+			if (is_static_pose)
+			{
+				// Every sub-track has been written, there is nothing animated to unpack
+				if (decompression_settings_type::disable_fp_exeptions())
+					restore_fp_exceptions(fp_env);
+
+				return;
+			}
+
 			{
 				// By now the first few cache lines of our segment data has landed in the L2
 				// Prefetch ahead some more to prime the hardware prefetcher
@@ -1697,7 +2502,22 @@ namespace acl
 				ACL_IMPL_SEEK_PREFETCH(animated_track_cache.clip_sampling_context_rotations.clip_range_data);
 				ACL_IMPL_SEEK_PREFETCH(animated_track_cache.clip_sampling_context_rotations.clip_range_data + 64);
 
-				// TODO: Can we prefetch the translation data ahead instead to prime the TLB?
+				// Within each key frame, the translation and scale data follow the rotation data and form their own
+				// memory streams. We prime them now so their first cache line lands while we unpack rotations.
+				const uint8_t* frame_translation_data0 = animated_data0 + (animated_track_cache.segment_sampling_context_translations[0].animated_track_data_bit_offset / 8);
+				const uint8_t* frame_translation_data1 = animated_data1 + (animated_track_cache.segment_sampling_context_translations[1].animated_track_data_bit_offset / 8);
+
+				ACL_IMPL_SEEK_PREFETCH(frame_translation_data0);
+				ACL_IMPL_SEEK_PREFETCH(frame_translation_data1);
+
+				if (has_scale)
+				{
+					const uint8_t* frame_scale_data0 = animated_data0 + (animated_track_cache.segment_sampling_context_scales[0].animated_track_data_bit_offset / 8);
+					const uint8_t* frame_scale_data1 = animated_data1 + (animated_track_cache.segment_sampling_context_scales[1].animated_track_data_bit_offset / 8);
+
+					ACL_IMPL_SEEK_PREFETCH(frame_scale_data0);
+					ACL_IMPL_SEEK_PREFETCH(frame_scale_data1);
+				}
 			}
 
 			// Unpack our variable sub-tracks
@@ -1719,21 +2539,69 @@ namespace acl
 
 			// Unpack rotations first
 			// Animated rotation sub-tracks are very common, this should take at least 400 cycles
-			unpack_animated_rotation_sub_tracks<decompression_settings_type>(rotation_sub_track_types, last_entry_index, context, animated_track_cache, writer);
+			{
+				const scope_decompression_zone<profiler_type> zone(decompression_zone::unpack_animated_rotations, tracks);
+				unpack_animated_rotation_sub_tracks<decompression_settings_type>(rotation_sub_track_types, last_entry_index, context, animated_track_cache, writer);
+			}
 
 			// Unpack translations second
 			// Animated translation sub-tracks are common, this should take at least 200 cycles
-			unpack_animated_translation_sub_tracks<translation_adapter>(translation_sub_track_types, last_entry_index, context, animated_track_cache, writer);
+			{
+				const scope_decompression_zone<profiler_type> zone(decompression_zone::unpack_animated_translations, tracks);
+				unpack_animated_translation_sub_tracks<translation_adapter>(translation_sub_track_types, last_entry_index, context, animated_track_cache, writer);
+			}
 
 			// Unpack scales last
 			// Animated scale sub-tracks are very rare, this shouldn't take much more than 100 cycles
 			if (has_scale)
+			{
+				const scope_decompression_zone<profiler_type> zone(decompression_zone::unpack_animated_scales, tracks);
 				unpack_animated_scale_sub_tracks<scale_adapter>(scale_sub_track_types, last_entry_index, context, animated_track_cache, writer);
+			}
+
+			animated_track_cache.commit_keyframe_cache(context);
 
 			if (decompression_settings_type::disable_fp_exeptions())
 				restore_fp_exceptions(fp_env);
 		}
 
+		template<class decompression_settings_type, class track_writer_type>
+		inline void decompress_tracks_v0(const persistent_transform_decompression_context_v0& context, const track_rounding_table_v0* rounding_table, track_writer_type& writer)
+		{
+			using transform_layout_type = typename decompression_settings_type::transform_layout_type;
+			using static_layout_adapter = typename std::conditional<transform_layout_type::is_enabled(), static_transform_layout_adapter<transform_layout_type>, dynamic_transform_layout_adapter>::type;
+
+			// Clips that share our static layout have their loops unrolled and their sub-track type branches folded
+			if (transform_layout_type::is_enabled() && context.uses_static_layout)
+			{
+				ACL_ASSERT(get_tracks_header(*context.tracks).num_tracks == transform_layout_type::get_num_tracks(), "Static transform layout doesn't match the compressed tracks");
+				decompress_tracks_v0_impl<decompression_settings_type, static_layout_adapter>(context, rounding_table, nullptr, 0, writer);
+			}
+			else
+				decompress_tracks_v0_impl<decompression_settings_type, dynamic_transform_layout_adapter>(context, rounding_table, nullptr, 0, writer);
+		}
+
+		template<class decompression_settings_type, class track_writer_type>
+		inline void decompress_tracks_v0(const persistent_transform_decompression_context_v0& context, track_writer_type& writer)
+		{
+			decompress_tracks_v0<decompression_settings_type>(context, static_cast<const track_rounding_table_v0*>(nullptr), writer);
+		}
+
+		// Decompresses the tracks [first_track_index, first_track_index + num_range_tracks) on their own
+		// The range must start on a packed sub-track entry and the offset table locates its data
+		// The context isn't modified, disjoint ranges can be decompressed concurrently
+		template<class decompression_settings_type, class track_writer_type>
+		inline void decompress_track_range_v0(const persistent_transform_decompression_context_v0& context, uint32_t first_track_index, uint32_t num_range_tracks, const track_offset_table_v0& offset_table, track_writer_type& writer)
+		{
+			ACL_ASSERT((first_track_index % k_num_sub_tracks_per_packed_entry) == 0, "Track ranges must start on a multiple of %u tracks", k_num_sub_tracks_per_packed_entry);
+			if ((first_track_index % k_num_sub_tracks_per_packed_entry) != 0)
+				return;	// Invalid range
+
+			// Indices are relative to the range, the static layout cannot be used
+			track_range_writer<track_writer_type> range_writer(writer, first_track_index, num_range_tracks);
+			decompress_tracks_v0_impl<decompression_settings_type, dynamic_transform_layout_adapter>(context, nullptr, &offset_table, first_track_index / k_num_sub_tracks_per_packed_entry, range_writer);
+		}
+
 		// We only initialize some variables when we need them which prompts the compiler to complain
 		// The usage is perfectly safe and because this code is VERY hot and needs to be as fast as possible,
 		// we disable the warning to avoid zeroing out things we don't need
@@ -1749,9 +2617,13 @@ namespace acl
 #endif
 
 		template<class decompression_settings_type, class track_writer_type>
-		inline void decompress_track_v0(const persistent_transform_decompression_context_v0& context, uint32_t track_index, track_writer_type& writer)
+		inline void decompress_track_v0(const persistent_transform_decompression_context_v0& context, uint32_t track_index, const track_offset_table_v0* offset_table, track_writer_type& writer)
 		{
 			const compressed_tracks* tracks = context.tracks;
+
+			using profiler_type = typename decompression_settings_type::profiler_type;
+			const scope_decompression_zone<profiler_type> decompress_zone(decompression_zone::decompress_track, tracks);
+
 			const tracks_header& tracks_header_ = get_tracks_header(*tracks);
 			const uint32_t num_tracks = tracks_header_.num_tracks;
 			if (num_tracks == 0)
@@ -1868,7 +2740,20 @@ namespace acl
 			// Sub-tracks that are kept have their bits set to 0 to mask them with logical ANDNOT later
 			const uint32_t padding_mask = num_padded_sub_tracks != 0 ? (0xFFFFFFFF >> ((k_num_sub_tracks_per_packed_entry - num_padded_sub_tracks) * 2)) : 0x00000000;
 
-			for (uint32_t sub_track_entry_index_ = 0; sub_track_entry_index_ <= last_entry_index; ++sub_track_entry_index_)
+			// With an offset table, we only need to count the sub-tracks within our own entry
+			const uint32_t first_entry_index = offset_table != nullptr ? last_entry_index : 0;
+			if (offset_table != nullptr)
+			{
+				const uint32_t* sub_track_counts = offset_table->sub_track_counts + (last_entry_index * k_track_offset_table_num_counts_per_entry);
+				num_constant_rotations = sub_track_counts[0];
+				num_animated_rotations = sub_track_counts[1];
+				num_constant_translations = sub_track_counts[2];
+				num_animated_translations = sub_track_counts[3];
+				num_constant_scales = sub_track_counts[4];
+				num_animated_scales = sub_track_counts[5];
+			}
+
+			for (uint32_t sub_track_entry_index_ = first_entry_index; sub_track_entry_index_ <= last_entry_index; ++sub_track_entry_index_)
 			{
 				// Our last entry might contain more information than we need so we strip the padding we don't need
 				const uint32_t entry_padding_mask = (sub_track_entry_index_ == last_entry_index) ? padding_mask : 0x00000000;
@@ -1940,13 +2825,27 @@ namespace acl
 				// TODO: Can we init just what we need?
 				animated_track_cache.initialize<decompression_settings_type, translation_adapter>(context);
 
+				// With an offset table, the number of bits to skip is looked up instead of being summed over every group we skip
+				const uint32_t* group_bit_offsets0 = nullptr;
+				const uint32_t* group_bit_offsets1 = nullptr;
+				if (offset_table != nullptr)
+					get_group_bit_offsets(context, *offset_table, group_bit_offsets0, group_bit_offsets1);
+
 				if (rotation_sub_track_type & 2)
 				{
 					rotation_group_sample_index = num_animated_rotations % 4;
 
 					const uint32_t num_groups_to_skip = num_animated_rotations / 4;
 					if (num_groups_to_skip != 0)
-						animated_track_cache.skip_rotation_groups<decompression_settings_type>(context, num_groups_to_skip);
+					{
+						if (offset_table != nullptr)
+						{
+							const uint32_t group_bit_sizes[2] = { group_bit_offsets0[num_groups_to_skip], group_bit_offsets1[num_groups_to_skip] };
+							animated_track_cache.skip_rotation_groups<decompression_settings_type>(context, num_groups_to_skip, group_bit_sizes);
+						}
+						else
+							animated_track_cache.skip_rotation_groups<decompression_settings_type>(context, num_groups_to_skip);
+					}
 				}
 
 				if (translation_sub_track_type & 2)
@@ -1955,7 +2854,16 @@ namespace acl
 
 					const uint32_t num_groups_to_skip = num_animated_translations / 4;
 					if (num_groups_to_skip != 0)
-						animated_track_cache.skip_translation_groups<translation_adapter>(context, num_groups_to_skip);
+					{
+						if (offset_table != nullptr)
+						{
+							const uint32_t group_index = offset_table->num_rotation_groups + num_groups_to_skip;
+							const uint32_t group_bit_sizes[2] = { group_bit_offsets0[group_index], group_bit_offsets1[group_index] };
+							animated_track_cache.skip_translation_groups<translation_adapter>(context, num_groups_to_skip, group_bit_sizes);
+						}
+						else
+							animated_track_cache.skip_translation_groups<translation_adapter>(context, num_groups_to_skip);
+					}
 				}
 
 				if (scale_sub_track_type & 2)
@@ -1964,7 +2872,16 @@ namespace acl
 
 					const uint32_t num_groups_to_skip = num_animated_scales / 4;
 					if (num_groups_to_skip != 0)
-						animated_track_cache.skip_scale_groups<scale_adapter>(context, num_groups_to_skip);
+					{
+						if (offset_table != nullptr)
+						{
+							const uint32_t group_index = offset_table->num_rotation_groups + offset_table->num_translation_groups + num_groups_to_skip;
+							const uint32_t group_bit_sizes[2] = { group_bit_offsets0[group_index], group_bit_offsets1[group_index] };
+							animated_track_cache.skip_scale_groups<scale_adapter>(context, num_groups_to_skip, group_bit_sizes);
+						}
+						else
+							animated_track_cache.skip_scale_groups<scale_adapter>(context, num_groups_to_skip);
+					}
 				}
 			}
 
@@ -2047,6 +2964,12 @@ namespace acl
 				restore_fp_exceptions(fp_env);
 		}
 
+		template<class decompression_settings_type, class track_writer_type>
+		inline void decompress_track_v0(const persistent_transform_decompression_context_v0& context, uint32_t track_index, track_writer_type& writer)
+		{
+			decompress_track_v0<decompression_settings_type>(context, track_index, static_cast<const track_offset_table_v0*>(nullptr), writer);
+		}
+
 		// Restore our warnings
 #if defined(RTM_COMPILER_MSVC)
 		#pragma warning(pop)
@@ -74,7 +74,7 @@ namespace acl
 				case track_type8::float3f:
 				case track_type8::float4f:
 				case track_type8::vector4f:
-					return static_cast<sample_looping_policy>(scalar.looping_policy);
+					return scalar.get_looping_policy();
 				case track_type8::qvvf:
 					return static_cast<sample_looping_policy>(transform.looping_policy);
 				default:
@@ -82,6 +82,28 @@ namespace acl
 					return sample_looping_policy::non_looping;
 				}
 			}
+			quality_tier get_max_quality_tier() const
+			{
+				// Scalar and transform contexts store their tier differently
+				if (scalar.tracks->get_track_type() == track_type8::qvvf)
+					return transform.get_max_quality_tier();
+				else
+					return scalar.get_max_quality_tier();
+			}
+			float get_sample_time() const
+			{
+				if (scalar.tracks->get_track_type() == track_type8::qvvf)
+					return transform.get_sample_time();
+				else
+					return scalar.get_sample_time();
+			}
+			float get_duration() const
+			{
+				if (scalar.tracks->get_track_type() == track_type8::qvvf)
+					return transform.get_duration();
+				else
+					return scalar.get_duration();
+			}
 			bool is_initialized() const { return scalar.is_initialized(); }
 			void reset()
 			{
@@ -193,6 +215,28 @@ namespace acl
 			}
 		}
 
+		template<class decompression_settings_type>
+		inline void set_max_quality_tier_v0(persistent_universal_decompression_context& context, quality_tier tier)
+		{
+			const track_type8 track_type = context.scalar.tracks->get_track_type();
+			switch (track_type)
+			{
+			case track_type8::float1f:
+			case track_type8::float2f:
+			case track_type8::float3f:
+			case track_type8::float4f:
+			case track_type8::vector4f:
+				set_max_quality_tier_v0<decompression_settings_type>(context.scalar, tier);
+				break;
+			case track_type8::qvvf:
+				set_max_quality_tier_v0<decompression_settings_type>(context.transform, tier);
+				break;
+			default:
+				ACL_ASSERT(false, "Invalid track type");
+				break;
+			}
+		}
+
 		template<class decompression_settings_type>
 		inline void seek_v0(persistent_universal_decompression_context& context, float sample_time, sample_rounding_policy rounding_policy)
 		{
@@ -217,6 +261,29 @@ namespace acl
 			}
 		}
 
+		inline void prefetch_v0(const persistent_universal_decompression_context& context)
+		{
+			ACL_ASSERT(context.is_initialized(), "Context is not initialized");
+
+			const track_type8 track_type = context.scalar.tracks->get_track_type();
+			switch (track_type)
+			{
+			case track_type8::float1f:
+			case track_type8::float2f:
+			case track_type8::float3f:
+			case track_type8::float4f:
+			case track_type8::vector4f:
+				prefetch_v0(context.scalar);
+				break;
+			case track_type8::qvvf:
+				prefetch_v0(context.transform);
+				break;
+			default:
+				ACL_ASSERT(false, "Invalid track type");
+				break;
+			}
+		}
+
 		template<class decompression_settings_type, class track_writer_type>
 		inline void decompress_tracks_v0(const persistent_universal_decompression_context& context, track_writer_type& writer)
 		{
@@ -241,6 +308,31 @@ namespace acl
 			}
 		}
 
+		template<class decompression_settings_type, class track_writer_type>
+		inline void decompress_tracks_v0(const persistent_universal_decompression_context& context, const track_rounding_table_v0* rounding_table, track_writer_type& writer)
+		{
+			ACL_ASSERT(context.is_initialized(), "Context is not initialized");
+
+			const track_type8 track_type = context.scalar.tracks->get_track_type();
+			switch (track_type)
+			{
+			case track_type8::float1f:
+			case track_type8::float2f:
+			case track_type8::float3f:
+			case track_type8::float4f:
+			case track_type8::vector4f:
+				// Scalar tracks do not use rounding tables
+				decompress_tracks_v0<decompression_settings_type>(context.scalar, writer);
+				break;
+			case track_type8::qvvf:
+				decompress_tracks_v0<decompression_settings_type>(context.transform, rounding_table, writer);
+				break;
+			default:
+				ACL_ASSERT(false, "Invalid track type");
+				break;
+			}
+		}
+
 		template<class decompression_settings_type, class track_writer_type>
 		inline void decompress_track_v0(const persistent_universal_decompression_context& context, uint32_t track_index, track_writer_type& writer)
 		{
@@ -264,6 +356,48 @@ namespace acl
 				break;
 			}
 		}
+
+		template<class decompression_settings_type, class track_writer_type>
+		inline void decompress_track_v0(const persistent_universal_decompression_context& context, uint32_t track_index, const track_offset_table_v0* offset_table, track_writer_type& writer)
+		{
+			ACL_ASSERT(context.is_initialized(), "Context is not initialized");
+
+			const track_type8 track_type = context.scalar.tracks->get_track_type();
+			switch (track_type)
+			{
+			case track_type8::float1f:
+			case track_type8::float2f:
+			case track_type8::float3f:
+			case track_type8::float4f:
+			case track_type8::vector4f:
+				// Scalar tracks do not use offset tables
+				decompress_track_v0<decompression_settings_type>(context.scalar, track_index, writer);
+				break;
+			case track_type8::qvvf:
+				decompress_track_v0<decompression_settings_type>(context.transform, track_index, offset_table, writer);
+				break;
+			default:
+				ACL_ASSERT(false, "Invalid track type");
+				break;
+			}
+		}
+
+		template<class decompression_settings_type, class track_writer_type>
+		inline void decompress_track_range_v0(const persistent_universal_decompression_context& context, uint32_t first_track_index, uint32_t num_range_tracks, const track_offset_table_v0& offset_table, track_writer_type& writer)
+		{
+			ACL_ASSERT(context.is_initialized(), "Context is not initialized");
+
+			const track_type8 track_type = context.scalar.tracks->get_track_type();
+			switch (track_type)
+			{
+			case track_type8::qvvf:
+				decompress_track_range_v0<decompression_settings_type>(context.transform, first_track_index, num_range_tracks, offset_table, writer);
+				break;
+			default:
+				ACL_ASSERT(false, "Track ranges only support transform tracks");
+				break;
+			}
+		}
 	}
 
 	ACL_IMPL_VERSION_NAMESPACE_END
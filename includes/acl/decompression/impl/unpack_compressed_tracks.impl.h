@@ -0,0 +1,221 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Included only once from unpack_compressed_tracks.h
+
+#include "acl/version.h"
+#include "acl/core/buffer_tag.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/error_result.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/memory_utils.h"
+#include "acl/core/impl/compressed_headers.h"
+#include "acl/core/impl/entropy_coding.h"
+#include "acl/core/impl/packed_tracks_utils.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		// Returns the packed tracks header if it is valid, nullptr otherwise
+		inline const packed_tracks_header* get_packed_tracks_header(const void* packed_tracks, uint32_t packed_tracks_size)
+		{
+			if (packed_tracks == nullptr || !is_aligned_to(packed_tracks, alignof(packed_tracks_header)) || packed_tracks_size < sizeof(packed_tracks_header))
+				return nullptr;
+
+			const packed_tracks_header* header = static_cast<const packed_tracks_header*>(packed_tracks);
+			if (header->tag != static_cast<uint32_t>(buffer_tag32::packed_compressed_tracks))
+				return nullptr;
+
+			if (header->headers_size > header->unpacked_size)
+				return nullptr;
+
+			uint64_t streams_size = 0;
+			for (uint32_t stream_index = 0; stream_index < k_num_packed_streams; ++stream_index)
+			{
+				const packed_stream_encoding encoding = header->stream_encodings[stream_index];
+				if (encoding != packed_stream_encoding::stored && encoding != packed_stream_encoding::rans)
+					return nullptr;
+
+				streams_size += header->stream_sizes[stream_index];
+			}
+
+			if (streams_size != packed_tracks_size - sizeof(packed_tracks_header))
+				return nullptr;
+
+			return header;
+		}
+
+		inline bool decode_packed_stream(const uint8_t* stream, uint32_t stream_size, packed_stream_encoding encoding, uint8_t* output, uint32_t output_size)
+		{
+			if (encoding == packed_stream_encoding::rans)
+				return rans_decode_compact(stream, stream_size, output, output_size);
+
+			if (stream_size != output_size)
+				return false;
+
+			std::memcpy(output, stream, stream_size);
+			return true;
+		}
+
+		struct packed_stream_reader
+		{
+			uint8_t* tracks_buffer;
+			const uint8_t* stream_cursors[k_num_packed_streams];
+
+			void operator()(const packed_region& region)
+			{
+				uint8_t* region_data = tracks_buffer + region.offset;
+
+				if (region.type == packed_region_type::value_planes)
+				{
+					const uint8_t** plane_cursors = &stream_cursors[static_cast<uint32_t>(packed_stream::value_plane0)];
+					merge_value_planes(plane_cursors, region.size, region_data);
+
+					for (uint32_t plane_index = 0; plane_index < 4; ++plane_index)
+						plane_cursors[plane_index] += get_value_plane_size(region.size, plane_index);
+				}
+				else
+				{
+					const uint8_t*& stream_cursor = stream_cursors[static_cast<uint32_t>(region.stream)];
+
+					if (region.type == packed_region_type::bit_matrix)
+						untranspose_bit_matrix(stream_cursor, region.size, region.num_rows, region.num_row_bits, region_data);
+					else
+						std::memcpy(region_data, stream_cursor, region.size);
+
+					stream_cursor += region.size;
+				}
+			}
+		};
+	}
+
+	inline uint32_t get_unpacked_compressed_tracks_size(const void* packed_tracks, uint32_t packed_tracks_size)
+	{
+		const acl_impl::packed_tracks_header* header = acl_impl::get_packed_tracks_header(packed_tracks, packed_tracks_size);
+		return header != nullptr ? header->unpacked_size : 0;
+	}
+
+	inline error_result unpack_compressed_tracks(iallocator& allocator, const void* packed_tracks, uint32_t packed_tracks_size,
+		void* buffer, uint32_t buffer_size, compressed_tracks*& out_compressed_tracks)
+	{
+		using namespace acl_impl;
+
+		const packed_tracks_header* header = get_packed_tracks_header(packed_tracks, packed_tracks_size);
+		if (header == nullptr)
+			return error_result("Invalid packed tracks");
+
+		if (buffer == nullptr || !is_aligned_to(buffer, alignof(compressed_tracks)))
+			return error_result("Invalid buffer alignment");
+
+		const uint32_t unpacked_size = header->unpacked_size;
+		if (buffer_size < unpacked_size)
+			return error_result("Buffer is too small");
+
+		uint8_t* tracks_buffer = static_cast<uint8_t*>(buffer);
+		const uint8_t* stream = reinterpret_cast<const uint8_t*>(header) + sizeof(packed_tracks_header);
+
+		// The headers come first and they tell us where every other region lives
+		const uint32_t headers_size = header->headers_size;
+		const uint32_t headers_stream_index = static_cast<uint32_t>(packed_stream::headers);
+		if (!decode_packed_stream(stream, header->stream_sizes[headers_stream_index], header->stream_encodings[headers_stream_index], tracks_buffer, headers_size))
+			return error_result("Invalid packed tracks headers");
+
+		stream += header->stream_sizes[headers_stream_index];
+
+		if (headers_size < sizeof(raw_buffer_header) || reinterpret_cast<const raw_buffer_header*>(tracks_buffer)->size != unpacked_size)
+			return error_result("Invalid packed tracks headers");
+
+		packed_stream_size_counter size_counter;
+		std::memset(&size_counter, 0, sizeof(size_counter));
+
+		if (!visit_packed_regions(tracks_buffer, headers_size, unpacked_size, size_counter))
+			return error_result("Invalid packed tracks headers");
+
+		// Decode the remaining streams back to back into a temporary buffer and scatter them into the output buffer
+		const uint32_t streams_size = unpacked_size - headers_size;
+		uint8_t* streams = streams_size != 0 ? allocate_type_array<uint8_t>(allocator, streams_size) : nullptr;
+
+		packed_stream_reader stream_reader;
+		stream_reader.tracks_buffer = tracks_buffer;
+		stream_reader.stream_cursors[headers_stream_index] = nullptr;
+
+		uint32_t stream_offset = 0;
+		bool is_valid = true;
+		for (uint32_t stream_index = headers_stream_index + 1; stream_index < k_num_packed_streams; ++stream_index)
+		{
+			const uint32_t stream_size = size_counter.stream_sizes[stream_index];
+
+			stream_reader.stream_cursors[stream_index] = streams + stream_offset;
+			is_valid &= decode_packed_stream(stream, header->stream_sizes[stream_index], header->stream_encodings[stream_index], streams + stream_offset, stream_size);
+
+			stream += header->stream_sizes[stream_index];
+			stream_offset += stream_size;
+		}
+
+		if (is_valid)
+			visit_packed_regions(tracks_buffer, headers_size, unpacked_size, stream_reader);
+
+		deallocate_type_array(allocator, streams, streams_size);
+
+		if (!is_valid)
+			return error_result("Invalid packed tracks data");
+
+		// Stored streams are not validated when they are decoded, the hash catches any corruption
+		compressed_tracks* tracks = make_compressed_tracks(buffer);
+		const error_result result = tracks->is_valid(true);
+		if (result.any())
+			return result;
+
+		out_compressed_tracks = tracks;
+		return error_result();
+	}
+
+	inline error_result unpack_compressed_tracks(iallocator& allocator, const void* packed_tracks, uint32_t packed_tracks_size, compressed_tracks*& out_compressed_tracks)
+	{
+		const uint32_t unpacked_size = get_unpacked_compressed_tracks_size(packed_tracks, packed_tracks_size);
+		if (unpacked_size == 0)
+			return error_result("Invalid packed tracks");
+
+		uint8_t* buffer = allocate_type_array_aligned<uint8_t>(allocator, unpacked_size, k_compressed_tracks_preferred_alignment);
+
+		const error_result result = unpack_compressed_tracks(allocator, packed_tracks, packed_tracks_size, buffer, unpacked_size, out_compressed_tracks);
+		if (result.any())
+		{
+			deallocate_type_array(allocator, buffer, unpacked_size);
+			out_compressed_tracks = nullptr;
+		}
+
+		return result;
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
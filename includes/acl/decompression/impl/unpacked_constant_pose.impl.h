@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Included only once from unpacked_constant_pose.h
+
+#include "acl/version.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/track_types.h"
+#include "acl/core/impl/compressed_headers.h"
+#include "acl/decompression/database/database.h"
+#include "acl/decompression/impl/transform_constant_track_cache.h"
+#include "acl/decompression/impl/transform_decompression_context.h"
+#include "acl/decompression/impl/transform_track_decompression.h"
+
+#include <rtm/quatf.h>
+
+#include <cstdint>
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	inline unpacked_constant_pose::unpacked_constant_pose()
+		: m_allocator(nullptr)
+		, m_tracks(nullptr)
+		, m_rotations(nullptr)
+		, m_tracks_hash(0)
+		, m_num_rotations(0)
+	{
+	}
+
+	inline unpacked_constant_pose::~unpacked_constant_pose()
+	{
+		reset();
+	}
+
+	template<class decompression_settings_type>
+	inline bool unpacked_constant_pose::initialize(iallocator& allocator, const compressed_tracks& tracks)
+	{
+		reset();
+
+		if (tracks.get_track_type() != track_type8::qvvf)
+			return false;	// Only transform tracks are supported
+
+		// We re-use the decompression code path to ensure the rotations are identical to what a context would unpack
+		using database_settings_type = typename decompression_settings_type::database_settings_type;
+
+		acl_impl::persistent_transform_decompression_context_v0 context;
+		if (!acl_impl::initialize_v0<decompression_settings_type>(context, tracks, static_cast<const database_context<database_settings_type>*>(nullptr)))
+			return false;
+
+		const acl_impl::transform_tracks_header& transform_header = acl_impl::get_transform_tracks_header(tracks);
+		const uint32_t num_rotations = transform_header.num_constant_rotation_samples;
+
+		rtm::quatf* rotations = num_rotations != 0 ? allocate_type_array<rtm::quatf>(allocator, num_rotations) : nullptr;
+
+		acl_impl::constant_track_cache_v0 constant_track_cache;
+		constant_track_cache.initialize<decompression_settings_type>(context);
+
+		for (uint32_t rotation_index = 0; rotation_index < num_rotations; ++rotation_index)
+		{
+			// The cache unpacks 16 rotations at a time once it runs low
+			if ((rotation_index % 16) == 0)
+				constant_track_cache.unpack_rotation_group<decompression_settings_type>(context);
+
+			rotations[rotation_index] = constant_track_cache.consume_rotation();
+		}
+
+		m_allocator = &allocator;
+		m_tracks = &tracks;
+		m_rotations = rotations;
+		m_tracks_hash = tracks.get_hash();
+		m_num_rotations = num_rotations;
+
+		return true;
+	}
+
+	inline void unpacked_constant_pose::reset()
+	{
+		if (m_rotations != nullptr)
+			deallocate_type_array(*m_allocator, m_rotations, m_num_rotations);
+
+		m_allocator = nullptr;
+		m_tracks = nullptr;
+		m_rotations = nullptr;
+		m_tracks_hash = 0;
+		m_num_rotations = 0;
+	}
+
+	inline bool unpacked_constant_pose::is_bound_to(const compressed_tracks& tracks) const
+	{
+		if (m_tracks != &tracks)
+			return false;	// Different pointer, no guarantees
+
+		if (m_tracks_hash != tracks.get_hash())
+			return false;	// Different hash
+
+		return true;
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
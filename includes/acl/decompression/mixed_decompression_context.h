@@ -0,0 +1,191 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/compressed_mixed_tracks.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/sample_rounding_policy.h"
+#include "acl/core/track_writer.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/decompression/decompress.h"
+#include "acl/decompression/decompression_settings.h"
+
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Forwards the scalar tracks to the user track writer with their mixed track index.
+		// Scalar tracks follow the transform tracks.
+		template<class track_writer_type>
+		struct mixed_scalar_track_writer : public track_writer
+		{
+			mixed_scalar_track_writer(track_writer_type& writer_, uint32_t first_scalar_track_index_)
+				: writer(writer_)
+				, first_scalar_track_index(first_scalar_track_index_)
+			{}
+
+			sample_rounding_policy get_rounding_policy(sample_rounding_policy seek_policy, uint32_t track_index) const { return writer.get_rounding_policy(seek_policy, first_scalar_track_index + track_index); }
+
+			static constexpr bool supports_float1_batch_output() { return track_writer_type::supports_float1_batch_output(); }
+
+			void RTM_SIMD_CALL write_float1(uint32_t track_index, rtm::scalarf_arg0 value) { writer.write_float1(first_scalar_track_index + track_index, value); }
+			void RTM_SIMD_CALL write_float1_batch(uint32_t first_track_index, rtm::vector4f_arg0 values) { writer.write_float1_batch(first_scalar_track_index + first_track_index, values); }
+			void RTM_SIMD_CALL write_float2(uint32_t track_index, rtm::vector4f_arg0 value) { writer.write_float2(first_scalar_track_index + track_index, value); }
+			void RTM_SIMD_CALL write_float3(uint32_t track_index, rtm::vector4f_arg0 value) { writer.write_float3(first_scalar_track_index + track_index, value); }
+			void RTM_SIMD_CALL write_float4(uint32_t track_index, rtm::vector4f_arg0 value) { writer.write_float4(first_scalar_track_index + track_index, value); }
+			void RTM_SIMD_CALL write_vector4(uint32_t track_index, rtm::vector4f_arg0 value) { writer.write_vector4(first_scalar_track_index + track_index, value); }
+
+			track_writer_type& writer;
+			uint32_t first_scalar_track_index;
+		};
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Decompression context for compressed mixed tracks, see 'compressed_mixed_tracks'.
+	// It binds a transform and a scalar decompression context to the track lists
+	// that play back together and drives both with a single seek. Every track is then
+	// written out with a single track writer: transform tracks use their track index and
+	// scalar tracks follow them, their index is offset by the number of transform tracks.
+	//
+	// Both track lists remain separate compressed tracks instances with their own headers,
+	// this context saves the bookkeeping of driving two contexts per character.
+	// The underlying contexts can be accessed for anything else (e.g. track masks).
+	//
+	// Both the constructor and destructor are public because it is safe to place
+	// instances of this context on the stack or as member variables.
+	//////////////////////////////////////////////////////////////////////////
+	template<class transform_decompression_settings_type = default_transform_decompression_settings, class scalar_decompression_settings_type = default_scalar_decompression_settings>
+	class mixed_decompression_context
+	{
+	public:
+		//////////////////////////////////////////////////////////////////////////
+		// Aliases to the decompression context types.
+		using transform_context_type = decompression_context<transform_decompression_settings_type>;
+		using scalar_context_type = decompression_context<scalar_decompression_settings_type>;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the compressed mixed tracks bound to this context instance.
+		const compressed_mixed_tracks* get_compressed_mixed_tracks() const { return m_tracks; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Initializes the context instance to a particular compressed mixed tracks instance.
+		// Returns whether initialization was successful or not.
+		bool initialize(const compressed_mixed_tracks& tracks)
+		{
+			reset();
+
+			if (transform_decompression_settings_type::skip_initialize_safety_checks() && scalar_decompression_settings_type::skip_initialize_safety_checks())
+			{
+				// Nothing to check
+			}
+			else if (tracks.is_valid(false).any())
+				return false;
+
+			if (!m_transform_context.initialize(tracks.get_transform_tracks()) || !m_scalar_context.initialize(tracks.get_scalar_tracks()))
+			{
+				reset();
+				return false;
+			}
+
+			m_tracks = &tracks;
+			return true;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if this context instance is bound to a compressed mixed tracks instance, false otherwise.
+		bool is_initialized() const { return m_tracks != nullptr; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if this context instance is bound to the specified compressed mixed tracks instance, false otherwise.
+		bool is_bound_to(const compressed_mixed_tracks& tracks) const { return m_tracks == &tracks; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Resets the context instance to its default constructed state.
+		void reset()
+		{
+			m_transform_context.reset();
+			m_scalar_context.reset();
+			m_tracks = nullptr;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Seeks every track to a particular point in time with the desired rounding policy.
+		// The sample_time value must be within [0, duration] inclusive otherwise it will be clamped.
+		void seek(float sample_time, sample_rounding_policy rounding_policy)
+		{
+			ACL_ASSERT(is_initialized(), "Context is not initialized");
+
+			m_transform_context.seek(sample_time, rounding_policy);
+			m_scalar_context.seek(sample_time, rounding_policy);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the current sample time or a negative value if we haven't seeked yet.
+		float get_sample_time() const { return m_transform_context.get_sample_time(); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Decompress every transform and scalar track at the current sample time.
+		// Scalar tracks are written after the transform tracks, with their index offset
+		// by the number of transform tracks.
+		// The track_writer_type allows complete control over how the tracks are written out.
+		template<class track_writer_type>
+		void decompress_tracks(track_writer_type& writer)
+		{
+			ACL_ASSERT(is_initialized(), "Context is not initialized");
+
+			m_transform_context.decompress_tracks(writer);
+
+			acl_impl::mixed_scalar_track_writer<track_writer_type> scalar_writer(writer, m_tracks->get_num_transform_tracks());
+			m_scalar_context.decompress_tracks(scalar_writer);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the underlying decompression contexts.
+		transform_context_type& get_transform_context() { return m_transform_context; }
+		const transform_context_type& get_transform_context() const { return m_transform_context; }
+		scalar_context_type& get_scalar_context() { return m_scalar_context; }
+		const scalar_context_type& get_scalar_context() const { return m_scalar_context; }
+
+	private:
+		transform_context_type				m_transform_context;
+		scalar_context_type					m_scalar_context;
+		const compressed_mixed_tracks*		m_tracks = nullptr;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,104 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/track_writer.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/math/pose_packing.h"
+
+#include <rtm/quatf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// A track writer that packs every transform with 16 bits per component as it
+	// is decompressed into a packed_qvvf16 array, one entry per track.
+	// Packed transforms take 20 bytes instead of 48 which reduces the memory
+	// bandwidth when the pose is consumed by a later stage. See acl/math/pose_packing.h
+	// to unpack them.
+	//
+	// Animated rotations are written in SOA form 4 at a time which allows them
+	// to be quantized with SIMD before they are transposed.
+	//////////////////////////////////////////////////////////////////////////
+	struct packed_qvvf16_writer : public track_writer
+	{
+		explicit packed_qvvf16_writer(packed_qvvf16* output_) : output(output_) {}
+
+		void RTM_SIMD_CALL write_rotation(uint32_t track_index, rtm::quatf_arg0 rotation)
+		{
+			pack_quat_snorm16(rotation, &output[track_index].rotation[0]);
+		}
+
+		static constexpr bool supports_soa_rotation_output() { return true; }
+
+		void RTM_SIMD_CALL write_rotations_soa(const uint32_t* track_indices, uint32_t num_tracks, rtm::vector4f_arg0 xxxx, rtm::vector4f_arg1 yyyy, rtm::vector4f_arg2 zzzz, rtm::vector4f_arg3 wwww)
+		{
+			// Quantize every component of our 4 rotations at once
+			const rtm::vector4f packed_xxxx = rtm::vector_round_symmetric(rtm::vector_mul(xxxx, 32767.0F));
+			const rtm::vector4f packed_yyyy = rtm::vector_round_symmetric(rtm::vector_mul(yyyy, 32767.0F));
+			const rtm::vector4f packed_zzzz = rtm::vector_round_symmetric(rtm::vector_mul(zzzz, 32767.0F));
+			const rtm::vector4f packed_wwww = rtm::vector_round_symmetric(rtm::vector_mul(wwww, 32767.0F));
+
+			alignas(16) float packed_components[4][4];
+			rtm::vector_store(packed_xxxx, &packed_components[0][0]);
+			rtm::vector_store(packed_yyyy, &packed_components[1][0]);
+			rtm::vector_store(packed_zzzz, &packed_components[2][0]);
+			rtm::vector_store(packed_wwww, &packed_components[3][0]);
+
+			for (uint32_t lane_index = 0; lane_index < num_tracks; ++lane_index)
+			{
+				int16_t* rotation_data = &output[track_indices[lane_index]].rotation[0];
+				rotation_data[0] = static_cast<int16_t>(packed_components[0][lane_index]);
+				rotation_data[1] = static_cast<int16_t>(packed_components[1][lane_index]);
+				rotation_data[2] = static_cast<int16_t>(packed_components[2][lane_index]);
+				rotation_data[3] = static_cast<int16_t>(packed_components[3][lane_index]);
+			}
+		}
+
+		void RTM_SIMD_CALL write_translation(uint32_t track_index, rtm::vector4f_arg0 translation)
+		{
+			pack_vector3_half(translation, &output[track_index].translation[0]);
+		}
+
+		void RTM_SIMD_CALL write_scale(uint32_t track_index, rtm::vector4f_arg0 scale)
+		{
+			pack_vector3_half(scale, &output[track_index].scale[0]);
+		}
+
+		packed_qvvf16* output;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,171 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/sample_rounding_policy.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/decompression/decompress.h"
+
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Statistics gathered by a pose cache.
+	//////////////////////////////////////////////////////////////////////////
+	struct pose_cache_stats
+	{
+		uint64_t num_hits = 0;			// Number of poses written from the cache
+		uint64_t num_misses = 0;		// Number of poses decompressed
+		uint64_t num_evictions = 0;		// Number of cached poses replaced by another
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the ratio of poses written from the cache, in [0.0, 1.0].
+		float get_hit_rate() const
+		{
+			const uint64_t num_requests = num_hits + num_misses;
+			return num_requests != 0 ? float(double(num_hits) / double(num_requests)) : 0.0F;
+		}
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A cache of decompressed poses shared by many decompression contexts.
+	//
+	// When a crowd plays the same clip with various time offsets, many agents sample
+	// the same pose every frame. Poses are cached by compressed tracks, quantized sample
+	// time, and rounding policy: only the first request for a given key decompresses,
+	// every later request copies the cached pose into its writer instead.
+	//
+	// Sample times are quantized to a multiple of 1 / quantization_rate seconds and the pose
+	// is decompressed at the quantized time, every request for the same key receives
+	// the same pose. With a rate of zero, sample times are used as is and only requests
+	// with an identical sample time share their pose.
+	//
+	// Cached values depend on the default sub-track values of the writer that missed.
+	// Every writer used with the same cache must provide the same default values (e.g.
+	// they share the same skeleton) and their default sub-track mode must be the same.
+	// Writers can skip different tracks, the whole pose is cached.
+	//
+	// The cache is direct mapped: a pose replaces the one cached in its slot, if any.
+	// Compressed tracks are identified by their address, call 'clear()' when compressed
+	// tracks that have poses cached are released.
+	//
+	// The cache is not thread safe.
+	//////////////////////////////////////////////////////////////////////////
+	template<class decompression_settings_type>
+	class pose_cache
+	{
+	public:
+		//////////////////////////////////////////////////////////////////////////
+		// An alias to the decompression context type.
+		using context_type = decompression_context<decompression_settings_type>;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Constructs an empty cache.
+		pose_cache();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Destructs the cache and releases its memory.
+		~pose_cache();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Allocates room for the requested number of poses, rounded up to a power of two.
+		// Every pose has room for 'max_num_tracks' tracks, compressed tracks with more
+		// tracks bypass the cache.
+		// Returns whether initialization was successful or not.
+		bool initialize(iallocator& allocator, uint32_t max_num_poses, uint32_t max_num_tracks, float quantization_rate);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Releases the memory held and resets the cache to its default constructed state.
+		void reset();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if this cache has been initialized, false otherwise.
+		bool is_initialized() const { return m_keys != nullptr; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Removes every cached pose. Statistics are retained.
+		void clear();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the statistics gathered since initialization or since they were last reset.
+		const pose_cache_stats& get_stats() const { return m_stats; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Resets the statistics.
+		void reset_stats() { m_stats = pose_cache_stats(); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Writes the pose at the specified sample time of the context compressed tracks.
+		// If the pose isn't cached, the context seeks to the quantized sample time and
+		// decompresses it into the cache. The cached pose is then written with the writer.
+		// The context must be initialized.
+		// Returns true if the pose was found in the cache, false otherwise.
+		template<class track_writer_type>
+		bool decompress_tracks(context_type& context, float sample_time, sample_rounding_policy rounding_policy, track_writer_type& writer);
+
+	private:
+		pose_cache(const pose_cache& other) = delete;
+		pose_cache& operator=(const pose_cache& other) = delete;
+
+		struct cache_key
+		{
+			const compressed_tracks*	tracks;			// Null if the slot is empty
+			float						sample_time;	// Quantized
+			sample_rounding_policy		rounding_policy;
+		};
+
+		// A transform track needs 3 values, a scalar track needs 1
+		static constexpr uint32_t k_num_values_per_track = 3;
+
+		uint32_t get_slot_index(const compressed_tracks* tracks, float sample_time, sample_rounding_policy rounding_policy) const;
+
+		iallocator*			m_allocator;
+		cache_key*			m_keys;
+		rtm::vector4f*		m_values;		// [slot][track][sub-track]
+		uint8_t*			m_value_flags;	// [slot][track] which sub-tracks are cached
+
+		uint32_t			m_num_slots;
+		uint32_t			m_max_num_tracks;
+		float				m_quantization_rate;
+
+		pose_cache_stats	m_stats;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+#include "acl/decompression/impl/pose_cache.impl.h"
+
+ACL_IMPL_FILE_PRAGMA_POP
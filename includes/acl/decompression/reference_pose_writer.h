@@ -0,0 +1,72 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/reference_pose.h"
+#include "acl/core/track_writer.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <rtm/quatf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// A base track writer that provides the default sub-track values from a
+	// reference pose. Clips compressed against a reference pose do not store
+	// the sub-tracks that match it, derive your writer from this one and they
+	// will be written with their reference pose value.
+	// See acl/core/reference_pose.h for details.
+	//
+	// Additive clips use the additive identity as their default value, see
+	// 'compressed_tracks::get_default_scale()'. Do not use this writer with them
+	// unless their default values were also set from the reference pose.
+	//////////////////////////////////////////////////////////////////////////
+	struct reference_pose_track_writer : public track_writer
+	{
+		explicit reference_pose_track_writer(const reference_pose& pose_) : pose(pose_) {}
+
+		static constexpr default_sub_track_mode get_default_rotation_mode() { return default_sub_track_mode::variable; }
+		static constexpr default_sub_track_mode get_default_translation_mode() { return default_sub_track_mode::variable; }
+		static constexpr default_sub_track_mode get_default_scale_mode() { return default_sub_track_mode::variable; }
+
+		rtm::quatf RTM_SIMD_CALL get_variable_default_rotation(uint32_t track_index) const { return pose.get_transform(track_index).rotation; }
+		rtm::vector4f RTM_SIMD_CALL get_variable_default_translation(uint32_t track_index) const { return pose.get_transform(track_index).translation; }
+		rtm::vector4f RTM_SIMD_CALL get_variable_default_scale(uint32_t track_index) const { return pose.get_transform(track_index).scale; }
+
+		reference_pose pose;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
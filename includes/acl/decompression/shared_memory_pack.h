@@ -0,0 +1,201 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/compressed_pack.h"
+#include "acl/core/error.h"
+#include "acl/core/error_result.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <cstdint>
+#include <cstring>
+
+#if !defined(_WIN32)
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+
+	#define ACL_IMPL_HAS_SHARED_MEMORY_PACK
+#endif
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+#if defined(ACL_IMPL_HAS_SHARED_MEMORY_PACK)
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	////////////////////////////////////////////////////////////////////////////////
+	// Maps a compressed pack from a named shared memory segment, read-only.
+	// Many processes on the same machine (e.g. dedicated servers) can share a single
+	// physical copy of their animation data: one process publishes the pack with
+	// 'publish_shared_memory_pack(..)' and every process opens it by name.
+	// Packs only contain offsets relative to their start and can be used at any address.
+	// Decompression contexts and database contexts never write into the buffers they
+	// are bound to, their mutable state lives in their own memory. The mapping is
+	// read-only and any write faults.
+	// The database bulk data within the pack can be used in place with a 'null_database_streamer'.
+	// Entropy coded tiers must be decoded as they stream in and cannot be shared.
+	// Only available on POSIX platforms. On some platforms, linking with 'rt' is required.
+	////////////////////////////////////////////////////////////////////////////////
+	class shared_memory_pack final
+	{
+	public:
+		shared_memory_pack() : m_mapping(nullptr), m_mapping_size(0) {}
+		~shared_memory_pack() { close(); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Maps the named shared memory segment and validates the pack it contains.
+		// The name must start with a '/' and contain no other slashes, see 'shm_open'.
+		error_result open(const char* name)
+		{
+			ACL_ASSERT(m_mapping == nullptr, "Shared memory pack is already open");
+			if (m_mapping != nullptr)
+				return error_result("Shared memory pack is already open");
+
+			if (name == nullptr)
+				return error_result("Shared memory name cannot be null");
+
+			const int segment = shm_open(name, O_RDONLY, 0);
+			if (segment < 0)
+				return error_result("Failed to open shared memory segment");
+
+			struct stat segment_stat;
+			if (fstat(segment, &segment_stat) != 0 || segment_stat.st_size < off_t(sizeof(compressed_pack)))
+			{
+				::close(segment);
+				return error_result("Shared memory segment is too small to contain a pack");
+			}
+
+			const size_t segment_size = size_t(segment_stat.st_size);
+			void* mapping = mmap(nullptr, segment_size, PROT_READ, MAP_SHARED, segment, 0);
+
+			// The mapping remains valid once the segment is closed
+			::close(segment);
+
+			if (mapping == MAP_FAILED)
+				return error_result("Failed to map shared memory segment");
+
+			error_result result;
+			const compressed_pack* pack = make_compressed_pack(mapping, &result);
+			if (pack == nullptr || pack->get_size() > segment_size)
+			{
+				munmap(mapping, segment_size);
+				return result.any() ? result : error_result("Shared memory segment is smaller than the pack it contains");
+			}
+
+			m_mapping = mapping;
+			m_mapping_size = segment_size;
+			return error_result();
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Unmaps the shared memory segment. The segment itself remains until it is removed.
+		// Every context bound to the pack must be reset beforehand.
+		void close()
+		{
+			if (m_mapping != nullptr)
+				munmap(m_mapping, m_mapping_size);
+
+			m_mapping = nullptr;
+			m_mapping_size = 0;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if a shared memory segment is mapped.
+		bool is_open() const { return m_mapping != nullptr; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the mapped pack, nullptr if none is open.
+		const compressed_pack* get_pack() const { return static_cast<const compressed_pack*>(m_mapping); }
+
+	private:
+		shared_memory_pack(const shared_memory_pack&) = delete;
+		shared_memory_pack& operator=(const shared_memory_pack&) = delete;
+
+		void* m_mapping;
+		size_t m_mapping_size;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a named shared memory segment and copies the provided pack into it.
+	// Fails if a segment with the same name already exists.
+	// The segment remains until 'remove_shared_memory_pack(..)' is called, even once
+	// the publishing process exits.
+	//////////////////////////////////////////////////////////////////////////
+	inline error_result publish_shared_memory_pack(const char* name, const compressed_pack& pack)
+	{
+		if (name == nullptr)
+			return error_result("Shared memory name cannot be null");
+
+		const error_result pack_result = pack.is_valid(false);
+		if (pack_result.any())
+			return pack_result;
+
+		const int segment = shm_open(name, O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+		if (segment < 0)
+			return error_result("Failed to create shared memory segment");
+
+		const uint32_t pack_size = pack.get_size();
+		void* mapping = ftruncate(segment, off_t(pack_size)) == 0 ? mmap(nullptr, pack_size, PROT_READ | PROT_WRITE, MAP_SHARED, segment, 0) : MAP_FAILED;
+
+		::close(segment);
+
+		if (mapping == MAP_FAILED)
+		{
+			shm_unlink(name);
+			return error_result("Failed to map shared memory segment");
+		}
+
+		std::memcpy(mapping, &pack, pack_size);
+		munmap(mapping, pack_size);
+
+		return error_result();
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Removes a named shared memory segment created with 'publish_shared_memory_pack(..)'.
+	// Processes that have it open retain their mapping until they close it.
+	//////////////////////////////////////////////////////////////////////////
+	inline error_result remove_shared_memory_pack(const char* name)
+	{
+		if (name == nullptr)
+			return error_result("Shared memory name cannot be null");
+
+		if (shm_unlink(name) != 0)
+			return error_result("Failed to remove shared memory segment");
+
+		return error_result();
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+#endif	// defined(ACL_IMPL_HAS_SHARED_MEMORY_PACK)
+
+ACL_IMPL_FILE_PRAGMA_POP
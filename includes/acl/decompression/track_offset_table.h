@@ -0,0 +1,117 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/decompression/impl/transform_decompression_context.h"
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Track ranges decompressed with 'decompression_context::decompress_track_range(..)'
+	// must start on a multiple of this many tracks, the size of a packed sub-track entry.
+	constexpr uint32_t k_track_range_alignment = 16;
+
+	//////////////////////////////////////////////////////////////////////////
+	// To decompress a single track, a decompression context must find where its
+	// data lives. It counts the constant and animated sub-tracks that come before it
+	// and it sums the bit sizes of every animated group it skips. This costs more the
+	// higher the track index is.
+	//
+	// A track offset table precomputes these values once for a compressed tracks instance.
+	// Contexts can then look them up when decompressing a single track, see
+	// 'decompression_context::decompress_track(..)'. The cost no longer depends on the track index.
+	// They also locate where a range of tracks starts, see 'decompression_context::decompress_track_range(..)'.
+	//
+	// The table is read-only once initialized and can be shared between threads. It holds
+	// 6 counts for every 16 tracks plus one bit offset per animated group and per segment.
+	// Only transform tracks are supported.
+	//////////////////////////////////////////////////////////////////////////
+	class track_offset_table
+	{
+	public:
+		//////////////////////////////////////////////////////////////////////////
+		// Constructs an empty table.
+		track_offset_table();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Destructs the table and releases its memory.
+		~track_offset_table();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Builds the table for the provided compressed tracks instance.
+		// The decompression settings must match the ones used by the contexts that will
+		// use this table since they control which formats are supported.
+		// Returns whether initialization was successful or not.
+		template<class decompression_settings_type>
+		bool initialize(iallocator& allocator, const compressed_tracks& tracks);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Releases the memory held and resets the table to its default constructed state.
+		void reset();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if this table has been initialized, false otherwise.
+		bool is_initialized() const { return m_tracks != nullptr; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if this table was built from the specified compressed tracks instance, false otherwise.
+		bool is_bound_to(const compressed_tracks& tracks) const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the size in bytes of the table.
+		uint32_t get_size() const { return m_buffer_size * uint32_t(sizeof(uint32_t)); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the precomputed offsets used by decompression contexts.
+		const acl_impl::track_offset_table_v0& get_offsets() const { return m_offsets; }
+
+	private:
+		track_offset_table(const track_offset_table& other) = delete;
+		track_offset_table& operator=(const track_offset_table& other) = delete;
+
+		iallocator*							m_allocator;
+		const compressed_tracks*			m_tracks;
+		uint32_t*							m_buffer;
+		uint32_t							m_buffer_size;
+		uint32_t							m_tracks_hash;
+		acl_impl::track_offset_table_v0		m_offsets;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+#include "acl/decompression/impl/track_offset_table.impl.h"
+
+ACL_IMPL_FILE_PRAGMA_POP
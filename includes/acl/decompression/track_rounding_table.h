@@ -0,0 +1,111 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/decompression/impl/transform_decompression_context.h"
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// When seeking with 'sample_rounding_policy::per_track', a decompression context queries
+	// the track writer for the rounding policy of every track as it decompresses. To let the
+	// writer pick any of them, the samples of every rounding policy are computed and cached.
+	//
+	// When the rounding policy of every track never changes (e.g. contact sensitive IK tracks
+	// always use 'floor'), a track rounding table queries the writer once and precomputes which
+	// sub-tracks of every animated group use which key frame. Contexts then select the sample
+	// each sub-track needs without calling the writer, see 'decompression_context::decompress_tracks(..)'.
+	//
+	// The table is read-only once initialized and can be shared between threads. It holds
+	// 2 bytes per animated group of 4 sub-tracks. It only has an effect when the decompression
+	// settings support per track rounding. Only transform tracks are supported.
+	//////////////////////////////////////////////////////////////////////////
+	class track_rounding_table
+	{
+	public:
+		//////////////////////////////////////////////////////////////////////////
+		// Constructs an empty table.
+		track_rounding_table();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Destructs the table and releases its memory.
+		~track_rounding_table();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Builds the table for the provided compressed tracks instance.
+		// The track writer is queried once per track with 'sample_rounding_policy::per_track' as
+		// the seek policy and it must return the policy it would return when decompressing.
+		// Returns whether initialization was successful or not.
+		template<class track_writer_type>
+		bool initialize(iallocator& allocator, const compressed_tracks& tracks, track_writer_type& writer);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Releases the memory held and resets the table to its default constructed state.
+		void reset();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if this table has been initialized, false otherwise.
+		bool is_initialized() const { return m_tracks != nullptr; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if this table was built from the specified compressed tracks instance, false otherwise.
+		bool is_bound_to(const compressed_tracks& tracks) const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the size in bytes of the table.
+		uint32_t get_size() const { return m_num_groups * uint32_t(sizeof(uint16_t)); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the precomputed rounding groups used by decompression contexts.
+		const acl_impl::track_rounding_table_v0& get_groups() const { return m_groups; }
+
+	private:
+		track_rounding_table(const track_rounding_table& other) = delete;
+		track_rounding_table& operator=(const track_rounding_table& other) = delete;
+
+		iallocator*							m_allocator;
+		const compressed_tracks*			m_tracks;
+		uint16_t*							m_group_masks;
+		uint32_t							m_num_groups;
+		uint32_t							m_tracks_hash;
+		acl_impl::track_rounding_table_v0	m_groups;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+#include "acl/decompression/impl/track_rounding_table.impl.h"
+
+ACL_IMPL_FILE_PRAGMA_POP
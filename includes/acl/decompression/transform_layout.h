@@ -0,0 +1,115 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/hash.h"
+#include "acl/core/track_types.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/impl/compressed_headers.h"
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the layout signature of a transform track list.
+	// The layout is made of the number of tracks, whether or not scale is present,
+	// and the type (default, constant, animated) of every sub-track. Clips of the same
+	// skeleton that animate the same sub-tracks share the same signature.
+	// Returns 0 for scalar tracks or an empty track list.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t get_transform_layout_signature(const compressed_tracks& tracks)
+	{
+		if (tracks.get_track_type() != track_type8::qvvf || tracks.get_num_tracks() == 0)
+			return 0;
+
+		const acl_impl::tracks_header& header = acl_impl::get_tracks_header(tracks);
+		const acl_impl::transform_tracks_header& transform_header = acl_impl::get_transform_tracks_header(tracks);
+
+		const uint32_t num_tracks = header.num_tracks;
+		const bool has_scale = header.get_has_scale();
+		const uint32_t num_sub_track_entries = (num_tracks + acl_impl::k_num_sub_tracks_per_packed_entry - 1) / acl_impl::k_num_sub_tracks_per_packed_entry;
+		const uint32_t num_packed_entries = num_sub_track_entries * (has_scale ? 3 : 2);
+
+		uint32_t signature = hash32(num_tracks);
+		signature = hash_combine(signature, hash32(has_scale));
+		signature = hash_combine(signature, hash32(transform_header.get_sub_track_types(), num_packed_entries * sizeof(acl_impl::packed_sub_track_types)));
+
+		// Zero is reserved for the absence of a layout
+		return signature != 0 ? signature : 1;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// A transform layout statically describes the sub-tracks of a skeleton. When a clip
+	// shares the layout, decompress_tracks(..) uses the statically known number of tracks and
+	// sub-track types. This allows the compiler to unroll the loops over the packed sub-track
+	// types and to fold away the branches on them.
+	//
+	// Layouts are generated by 'acl_compressor' with its '-layout' option: derive from this
+	// struct, hide every function, and set your type as the 'transform_layout_type' of your
+	// decompression settings. Clips with a different layout signature use the generic code path.
+	//
+	// This default layout is disabled and every clip uses the generic code path.
+	//////////////////////////////////////////////////////////////////////////
+	struct null_transform_layout
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not this layout is enabled.
+		// Must be static constexpr!
+		static constexpr bool is_enabled() { return false; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// The layout signature, see get_transform_layout_signature(..).
+		// Must be static constexpr!
+		static constexpr uint32_t get_signature() { return 0; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// The number of transform tracks.
+		// Must be static constexpr!
+		static constexpr uint32_t get_num_tracks() { return 0; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not scale sub-tracks are present.
+		// Must be static constexpr!
+		static constexpr bool has_scale() { return false; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// The packed sub-track types as stored in the compressed tracks: one 32 bit entry per
+		// 16 sub-tracks, 2 bits per sub-track (0 default, 1 constant, 2 animated) starting with the
+		// most significant bits. All rotation entries come first, followed by translations and scales.
+		// Must be static and should point to a 'static constexpr' array for the compiler to fold it.
+		static const uint32_t* get_packed_sub_track_types() { return nullptr; }
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
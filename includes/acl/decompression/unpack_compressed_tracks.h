@@ -0,0 +1,79 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/error_result.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the size in bytes of the compressed tracks once unpacked or 0 if the
+	// buffer does not contain valid packed tracks.
+	// See 'pack_compressed_tracks(..)' for details.
+	//////////////////////////////////////////////////////////////////////////
+	uint32_t get_unpacked_compressed_tracks_size(const void* packed_tracks, uint32_t packed_tracks_size);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks packed tracks into the provided buffer, restoring the original compressed tracks.
+	// Once unpacked, the compressed tracks are ordinary and sampling them has no extra cost.
+	// The streams are decoded into a temporary buffer about as large as the unpacked tracks
+	// before they are scattered into the provided buffer.
+	//
+	//    allocator:				The allocator instance to use to allocate temporary memory.
+	//    packed_tracks:			The packed tracks to unpack.
+	//    packed_tracks_size:		The size in bytes of the packed tracks.
+	//    buffer:					The buffer to unpack into, it must be aligned to 'alignof(compressed_tracks)'.
+	//    buffer_size:				The size in bytes of the buffer, see 'get_unpacked_compressed_tracks_size(..)'.
+	//    out_compressed_tracks:	The resulting compressed tracks which live in the provided buffer.
+	//////////////////////////////////////////////////////////////////////////
+	error_result unpack_compressed_tracks(iallocator& allocator, const void* packed_tracks, uint32_t packed_tracks_size,
+		void* buffer, uint32_t buffer_size, compressed_tracks*& out_compressed_tracks);
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks packed tracks into a new buffer, restoring the original compressed tracks.
+	//
+	//    allocator:				The allocator instance to use to allocate the compressed tracks and temporary memory.
+	//    packed_tracks:			The packed tracks to unpack.
+	//    packed_tracks_size:		The size in bytes of the packed tracks.
+	//    out_compressed_tracks:	The resulting compressed tracks. The caller owns the returned memory and must free it.
+	//////////////////////////////////////////////////////////////////////////
+	error_result unpack_compressed_tracks(iallocator& allocator, const void* packed_tracks, uint32_t packed_tracks_size, compressed_tracks*& out_compressed_tracks);
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+#include "acl/decompression/impl/unpack_compressed_tracks.impl.h"
+
+ACL_IMPL_FILE_PRAGMA_POP
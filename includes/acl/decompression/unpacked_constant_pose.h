@@ -0,0 +1,108 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/compressed_tracks.h"
+#include "acl/core/iallocator.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <rtm/types.h>
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Constant rotation sub-tracks are packed and each decompression context normally unpacks
+	// them every time it decompresses. When many contexts play back the same compressed tracks
+	// (e.g. a crowd), the constant rotations can be unpacked once into an unpacked constant pose
+	// and shared by every context, see 'decompression_context::set_constant_pose(..)'.
+	//
+	// The pose is read-only once initialized and can be shared between threads. It must
+	// outlive every context that references it. Constant translations and scales are not
+	// packed and are read directly from the compressed tracks.
+	// Only transform tracks are supported.
+	//////////////////////////////////////////////////////////////////////////
+	class unpacked_constant_pose
+	{
+	public:
+		//////////////////////////////////////////////////////////////////////////
+		// Constructs an empty pose.
+		unpacked_constant_pose();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Destructs the pose and releases its memory.
+		~unpacked_constant_pose();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Unpacks the constant rotations of the provided compressed tracks instance.
+		// The decompression settings must be compatible with the ones used by the contexts
+		// that will reference this pose since they control how rotations are reconstructed.
+		// Returns whether initialization was successful or not.
+		template<class decompression_settings_type>
+		bool initialize(iallocator& allocator, const compressed_tracks& tracks);
+
+		//////////////////////////////////////////////////////////////////////////
+		// Releases the memory held and resets the pose to its default constructed state.
+		void reset();
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if this pose has been initialized, false otherwise.
+		bool is_initialized() const { return m_tracks != nullptr; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if this pose was built from the specified compressed tracks instance, false otherwise.
+		bool is_bound_to(const compressed_tracks& tracks) const;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the unpacked constant rotations in the order they are stored in the compressed tracks.
+		const rtm::quatf* get_constant_rotations() const { return m_rotations; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of unpacked constant rotations.
+		uint32_t get_num_constant_rotations() const { return m_num_rotations; }
+
+	private:
+		unpacked_constant_pose(const unpacked_constant_pose& other) = delete;
+		unpacked_constant_pose& operator=(const unpacked_constant_pose& other) = delete;
+
+		iallocator*					m_allocator;
+		const compressed_tracks*	m_tracks;
+		rtm::quatf*					m_rotations;
+		uint32_t					m_tracks_hash;
+		uint32_t					m_num_rotations;
+	};
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+#include "acl/decompression/impl/unpacked_constant_pose.impl.h"
+
+ACL_IMPL_FILE_PRAGMA_POP
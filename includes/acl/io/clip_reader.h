@@ -28,11 +28,15 @@
 
 #include "acl/version.h"
 #include "acl/io/clip_reader_error.h"
+#include "acl/io/impl/binary_raw_clip.h"
+#include "acl/io/impl/hex_decoding.h"
 #include "acl/compression/compression_settings.h"
 #include "acl/compression/track_array.h"
 #include "acl/core/algorithm_types.h"
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/iallocator.h"
+#include "acl/core/memory_utils.h"
+#include "acl/core/sample_looping_policy.h"
 #include "acl/core/string.h"
 #include "acl/core/track_desc.h"
 #include "acl/core/unique_ptr.h"
@@ -109,6 +113,23 @@ namespace acl
 	#pragma GCC diagnostic pop
 #endif
 
+	//////////////////////////////////////////////////////////////////////////
+	// A job scheduler supplied by the caller to decode track samples in parallel.
+	// See clip_reader::read_raw_clip(..) and clip_reader::read_raw_track_list(..).
+	class iclip_reader_scheduler
+	{
+	public:
+		using job_function = void (*)(uint32_t job_index, void* user_data);
+
+		virtual ~iclip_reader_scheduler() = default;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Executes the job function once for every job index in [0, num_jobs) and
+		// returns once they have all completed. Jobs are independent from one another
+		// and they can run concurrently on any thread.
+		virtual void execute(uint32_t num_jobs, job_function job, void* user_data) = 0;
+	};
+
 	//////////////////////////////////////////////////////////////////////////
 	// An SJSON ACL file reader.
 	class clip_reader
@@ -116,6 +137,8 @@ namespace acl
 	public:
 		clip_reader(iallocator& allocator, const char* sjson_input, size_t input_length)
 			: m_allocator(allocator)
+			, m_input(sjson_input)
+			, m_input_length(input_length)
 			, m_parser(sjson_input, input_length)
 		{
 		}
@@ -141,7 +164,87 @@ namespace acl
 			return sjson_file_type::unknown;
 		}
 
-		bool read_raw_clip(sjson_raw_clip& out_data)
+		bool read_raw_clip(sjson_raw_clip& out_data) { return read_raw_clip_impl(out_data, nullptr); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Reads a raw clip and decodes its track samples in parallel on the provided scheduler.
+		// The document is first indexed on the calling thread to find where the samples of
+		// every track begin, they are then decoded concurrently with one job per sample block.
+		// Files that aren't binary exact cannot be indexed cheaply, they are read serially.
+		bool read_raw_clip(sjson_raw_clip& out_data, iclip_reader_scheduler& scheduler) { return read_raw_clip_impl(out_data, &scheduler); }
+
+		bool read_raw_track_list(sjson_raw_track_list& out_data) { return read_raw_track_list_impl(out_data, nullptr); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Reads a raw track list and decodes its track samples in parallel on the provided scheduler.
+		// The document is first indexed on the calling thread to find where the samples of
+		// every track begin, they are then decoded concurrently with one job per track.
+		// Files that aren't binary exact cannot be indexed cheaply, they are read serially.
+		bool read_raw_track_list(sjson_raw_track_list& out_data, iclip_reader_scheduler& scheduler) { return read_raw_track_list_impl(out_data, &scheduler); }
+
+		clip_reader_error get_error() const { return m_error; }
+
+	private:
+		clip_reader(const clip_reader&) = delete;
+		clip_reader& operator=(const clip_reader&) = delete;
+
+		enum class sample_block_type
+		{
+			rotations,
+			translations,
+			scales,
+			track_list_data,
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// The location of a block of track samples within the input, indexed
+		// on the calling thread and decoded later as an independent job.
+		struct sample_block
+		{
+			explicit sample_block(const sjson::ParserState& state_) : state(state_) {}
+
+			sjson::ParserState state;
+			clip_reader_error error;
+
+			track_qvvf* track_							= nullptr;	// Raw clips decode straight into their tracks
+			void* samples								= nullptr;	// Track lists decode into their sample buffer
+			uint32_t num_samples						= 0;
+			uint32_t num_components						= 0;
+			track_type8 track_type						= track_type8::float1f;
+			sample_block_type type						= sample_block_type::rotations;
+			bool is_used								= false;
+			bool is_decoded								= false;
+		};
+
+		struct decode_job_context
+		{
+			const clip_reader* reader;
+			sample_block* blocks;
+		};
+
+		iallocator& m_allocator;
+		const char* m_input;
+		size_t m_input_length;
+		sjson::Parser m_parser;
+		clip_reader_error m_error;
+
+		uint32_t m_version								= 0;
+		uint32_t m_num_samples							= 0;
+		float m_sample_rate								= 0.0F;
+		sjson::StringView m_clip_name;
+		bool m_is_binary_exact							= false;
+		additive_clip_format8 m_additive_format			= additive_clip_format8::none;
+		sjson::StringView m_additive_base_name;
+		uint32_t m_additive_base_num_samples			= 0;
+		float m_additive_base_sample_rate				= 0.0F;
+
+		bool m_has_settings								= false;
+		float m_error_threshold							= 0.0F;
+
+		sjson::StringView* m_bone_names					= nullptr;
+		uint32_t m_num_bones							= 0;
+
+		bool read_raw_clip_impl(sjson_raw_clip& out_data, iclip_reader_scheduler* scheduler)
 		{
 			reset_state();
 
@@ -157,7 +260,22 @@ namespace acl
 			if (!create_skeleton(out_data.track_list))
 				return false;
 
-			if (!read_tracks(out_data.track_list, out_data.additive_base_track_list))
+			// Samples can only be skipped cheaply when they are binary exact
+			if (!m_is_binary_exact)
+				scheduler = nullptr;
+
+			// Every transform has up to 3 blocks for its clip samples and 3 more for its additive base samples
+			const uint32_t num_blocks = scheduler != nullptr ? (out_data.track_list.get_num_tracks() * 6) : 0;
+			sample_block* blocks = scheduler != nullptr ? allocate_type_array<sample_block>(m_allocator, num_blocks, m_parser.save_state()) : nullptr;
+
+			bool success = read_tracks(out_data.track_list, out_data.additive_base_track_list, blocks);
+
+			if (success && scheduler != nullptr)
+				success = decode_sample_blocks(blocks, num_blocks, *scheduler);
+
+			deallocate_type_array(m_allocator, blocks, num_blocks);
+
+			if (!success)
 				return false;
 
 			out_data.additive_format = !out_data.additive_base_track_list.is_empty() ? m_additive_format : additive_clip_format8::none;
@@ -165,7 +283,7 @@ namespace acl
 			return nothing_follows();
 		}
 
-		bool read_raw_track_list(sjson_raw_track_list& out_data)
+		bool read_raw_track_list_impl(sjson_raw_track_list& out_data, iclip_reader_scheduler* scheduler)
 		{
 			reset_state();
 
@@ -178,38 +296,16 @@ namespace acl
 			if (!read_settings(&out_data.has_settings, &out_data.settings))
 				return false;
 
-			if (!create_track_list(out_data.track_list))
+			// Samples can only be skipped cheaply when they are binary exact
+			if (!m_is_binary_exact)
+				scheduler = nullptr;
+
+			if (!create_track_list(out_data.track_list, scheduler))
 				return false;
 
 			return nothing_follows();
 		}
 
-		clip_reader_error get_error() const { return m_error; }
-
-	private:
-		clip_reader(const clip_reader&) = delete;
-		clip_reader& operator=(const clip_reader&) = delete;
-
-		iallocator& m_allocator;
-		sjson::Parser m_parser;
-		clip_reader_error m_error;
-
-		uint32_t m_version								= 0;
-		uint32_t m_num_samples							= 0;
-		float m_sample_rate								= 0.0F;
-		sjson::StringView m_clip_name;
-		bool m_is_binary_exact							= false;
-		additive_clip_format8 m_additive_format			= additive_clip_format8::none;
-		sjson::StringView m_additive_base_name;
-		uint32_t m_additive_base_num_samples			= 0;
-		float m_additive_base_sample_rate				= 0.0F;
-
-		bool m_has_settings								= false;
-		float m_error_threshold							= 0.0F;
-
-		sjson::StringView* m_bone_names					= nullptr;
-		uint32_t m_num_bones							= 0;
-
 		string convert_string(const sjson::StringView& str) const
 		{
 			return string(m_allocator, str.c_str(), str.size());
@@ -478,7 +574,7 @@ namespace acl
 			return true;
 		}
 
-		static double hex_to_double(const sjson::StringView& value)
+		static double u64_to_double(uint64_t value_u64)
 		{
 			union UInt64ToDouble
 			{
@@ -488,12 +584,10 @@ namespace acl
 				constexpr explicit UInt64ToDouble(uint64_t u64_value) : u64(u64_value) {}
 			};
 
-			ACL_ASSERT(value.size() <= 16, "Invalid binary exact double value");
-			uint64_t value_u64 = acl_impl::strtoull(value.c_str(), nullptr, 16);
 			return UInt64ToDouble(value_u64).dbl;
 		}
 
-		static float hex_to_float(const sjson::StringView& value)
+		static float u32_to_float(uint32_t value_u32)
 		{
 			union UInt32ToFloat
 			{
@@ -503,30 +597,45 @@ namespace acl
 				constexpr explicit UInt32ToFloat(uint32_t u32_value) : u32(u32_value) {}
 			};
 
-			ACL_ASSERT(value.size() <= 8, "Invalid binary exact float value");
-			uint32_t value_u32 = safe_static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 16));
 			return UInt32ToFloat(value_u32).flt;
 		}
 
+		static float hex_to_float(const sjson::StringView& value)
+		{
+			ACL_ASSERT(value.size() <= 8, "Invalid binary exact float value");
+			uint32_t value_u32;
+			acl_impl::hex_to_u32(&value, 1, &value_u32);
+			return u32_to_float(value_u32);
+		}
+
 		static rtm::quatd hex_to_quat(const sjson::StringView values[4])
 		{
-			return rtm::quat_set(hex_to_double(values[0]), hex_to_double(values[1]), hex_to_double(values[2]), hex_to_double(values[3]));
+			// Our components are decoded two at a time
+			uint64_t values_u64[4];
+			acl_impl::hex_to_u64(values, 4, values_u64);
+			return rtm::quat_set(u64_to_double(values_u64[0]), u64_to_double(values_u64[1]), u64_to_double(values_u64[2]), u64_to_double(values_u64[3]));
 		}
 
 		static rtm::vector4d hex_to_vector3(const sjson::StringView values[3])
 		{
-			return rtm::vector_set(hex_to_double(values[0]), hex_to_double(values[1]), hex_to_double(values[2]));
+			uint64_t values_u64[3];
+			acl_impl::hex_to_u64(values, 3, values_u64);
+			return rtm::vector_set(u64_to_double(values_u64[0]), u64_to_double(values_u64[1]), u64_to_double(values_u64[2]));
 		}
 
 		static rtm::float4f hex_to_float4f(const sjson::StringView values[4], uint32_t num_components)
 		{
 			ACL_ASSERT(num_components <= 4, "Invalid number of components");
 
+			// Every component is decoded at once
+			uint32_t values_u32[4];
+			acl_impl::hex_to_u32(values, num_components, values_u32);
+
 			rtm::float4f result = { 0.0F, 0.0F, 0.0F, 0.0F };
 			float* result_ptr = &result.x;
 
 			for (uint32_t component_index = 0; component_index < num_components; ++component_index)
-				result_ptr[component_index] = hex_to_float(values[component_index]);
+				result_ptr[component_index] = u32_to_float(values_u32[component_index]);
 
 			return result;
 		}
@@ -658,27 +767,27 @@ namespace acl
 			return value;
 		}
 
-		bool read_qvv_sample(rtm::qvvf& out_sample)
+		bool read_qvv_sample(sjson::Parser& parser, rtm::qvvf& out_sample) const
 		{
 			rtm::qvvf sample = rtm::qvv_identity();
 			sjson::StringView values_str[4];
 			double values[4] = { 0.0, 0.0, 0.0, 0.0 };
 
 			{
-				if (!m_parser.array_begins())
+				if (!parser.array_begins())
 					return false;
 
 				rtm::float4f value;
 				if (m_is_binary_exact)
 				{
-					if (!m_parser.read(values_str, 4))
+					if (!parser.read(values_str, 4))
 						return false;
 
 					value = hex_to_float4f(values_str, 4);
 				}
 				else
 				{
-					if (!m_parser.read(values, 4))
+					if (!parser.read(values, 4))
 						return false;
 
 					value = { static_cast<float>(values[0]), static_cast<float>(values[1]), static_cast<float>(values[2]), static_cast<float>(values[3])};
@@ -688,28 +797,28 @@ namespace acl
 				if (!rtm::quat_is_finite(sample.rotation))
 					return false;
 
-				if (!m_parser.array_ends())
+				if (!parser.array_ends())
 					return false;
 			}
 
-			if (!m_parser.read_comma())
+			if (!parser.read_comma())
 				return false;
 
 			{
-				if (!m_parser.array_begins())
+				if (!parser.array_begins())
 					return false;
 
 				rtm::float4f value;
 				if (m_is_binary_exact)
 				{
-					if (!m_parser.read(values_str, 3))
+					if (!parser.read(values_str, 3))
 						return false;
 
 					value = hex_to_float4f(values_str, 4);
 				}
 				else
 				{
-					if (!m_parser.read(values, 3))
+					if (!parser.read(values, 3))
 						return false;
 
 					value = { static_cast<float>(values[0]), static_cast<float>(values[1]), static_cast<float>(values[2]), 0.0F };
@@ -719,28 +828,28 @@ namespace acl
 				if (!rtm::vector_is_finite3(sample.translation))
 					return false;
 
-				if (!m_parser.array_ends())
+				if (!parser.array_ends())
 					return false;
 			}
 
-			if (!m_parser.read_comma())
+			if (!parser.read_comma())
 				return false;
 
 			{
-				if (!m_parser.array_begins())
+				if (!parser.array_begins())
 					return false;
 
 				rtm::float4f value;
 				if (m_is_binary_exact)
 				{
-					if (!m_parser.read(values_str, 3))
+					if (!parser.read(values_str, 3))
 						return false;
 
 					value = hex_to_float4f(values_str, 4);
 				}
 				else
 				{
-					if (!m_parser.read(values, 3))
+					if (!parser.read(values, 3))
 						return false;
 
 					value = { static_cast<float>(values[0]), static_cast<float>(values[1]), static_cast<float>(values[2]), 0.0F };
@@ -750,7 +859,7 @@ namespace acl
 				if (!rtm::vector_is_finite3(sample.scale))
 					return false;
 
-				if (!m_parser.array_ends())
+				if (!parser.array_ends())
 					return false;
 			}
 
@@ -758,7 +867,103 @@ namespace acl
 			return true;
 		}
 
-		bool process_track_list(track* tracks, uint32_t& num_tracks)
+		bool read_track_list_samples(sjson::Parser& parser, track_type8 track_type, uint32_t num_components, uint32_t num_samples, void* samples) const
+		{
+			bool has_error = false;
+			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			{
+				if (!parser.array_begins())
+				{
+					has_error = true;
+					break;
+				}
+
+				if (m_is_binary_exact)
+				{
+					switch (track_type)
+					{
+					case track_type8::float1f:
+					case track_type8::float2f:
+					case track_type8::float3f:
+					case track_type8::float4f:
+					case track_type8::vector4f:
+					{
+						sjson::StringView values[4];
+						if (parser.read(values, num_components))
+						{
+							const rtm::float4f value = hex_to_float4f(values, num_components);
+							std::memcpy(static_cast<float*>(samples) + (size_t(sample_index) * num_components), &value, sizeof(float) * num_components);
+						}
+						else
+							has_error = true;
+						break;
+					}
+					case track_type8::qvvf:
+					{
+						rtm::qvvf sample;
+						if (!read_qvv_sample(parser, sample))
+							has_error = true;
+						else
+							std::memcpy(static_cast<rtm::qvvf*>(samples) + sample_index, &sample, sizeof(rtm::qvvf));
+						break;
+					}
+					default:
+						ACL_ASSERT(false, "Unsupported track type");
+						break;
+					}
+
+					if (has_error)
+						break;
+				}
+				else
+				{
+					switch (track_type)
+					{
+					case track_type8::float1f:
+					case track_type8::float2f:
+					case track_type8::float3f:
+					case track_type8::float4f:
+					case track_type8::vector4f:
+					{
+						double values[4] = { 0.0, 0.0, 0.0, 0.0 };
+						if (parser.read(values, num_components))
+						{
+							const rtm::float4f value = { static_cast<float>(values[0]), static_cast<float>(values[1]), static_cast<float>(values[2]), static_cast<float>(values[3]) };
+							std::memcpy(static_cast<float*>(samples) + (size_t(sample_index) * num_components), &value, sizeof(float) * num_components);
+						}
+						else
+							has_error = true;
+						break;
+					}
+					case track_type8::qvvf:
+					{
+						rtm::qvvf sample;
+						if (!read_qvv_sample(parser, sample))
+							has_error = true;
+						else
+							std::memcpy(static_cast<rtm::qvvf*>(samples) + sample_index, &sample, sizeof(rtm::qvvf));
+						break;
+					}
+					default:
+						ACL_ASSERT(false, "Unsupported track type");
+						break;
+					}
+
+					if (has_error)
+						break;
+				}
+
+				if (!has_error && !parser.array_ends())
+				{
+					has_error = true;
+					break;
+				}
+			}
+
+			return !has_error;
+		}
+
+		bool process_track_list(track* tracks, uint32_t& num_tracks, bool defer_samples, sample_block* blocks)
 		{
 			const bool counting = tracks == nullptr;
 			track dummy;
@@ -819,6 +1024,7 @@ namespace acl
 				m_parser.try_read("parent_index", transform_desc.parent_index, k_invalid_track_index);
 
 				transform_desc.shell_distance = read_optional_float("shell_distance", transform_desc.shell_distance);
+				transform_desc.importance = read_optional_float("importance", transform_desc.importance);
 
 				// Deprecated, no longer used
 				read_optional_float("constant_rotation_threshold_angle", -1.0F);
@@ -917,95 +1123,25 @@ namespace acl
 					break;
 				}
 
-				bool has_error = false;
-				for (uint32_t sample_index = 0; sample_index < m_num_samples; ++sample_index)
+				bool has_error;
+				if (!defer_samples)
+					has_error = !read_track_list_samples(m_parser, track_type, num_components, m_num_samples, track_samples_typed.any);
+				else
 				{
-					if (!m_parser.array_begins())
+					// Only remember where the samples live, they are decoded later
+					if (!counting)
 					{
-						has_error = true;
-						break;
+						sample_block& block = blocks[i];
+						block.state = m_parser.save_state();
+						block.samples = track_samples_typed.any;
+						block.num_samples = m_num_samples;
+						block.num_components = num_components;
+						block.track_type = track_type;
+						block.type = sample_block_type::track_list_data;
+						block.is_used = true;
 					}
 
-					if (m_is_binary_exact)
-					{
-						switch (track_type)
-						{
-						case track_type8::float1f:
-						case track_type8::float2f:
-						case track_type8::float3f:
-						case track_type8::float4f:
-						case track_type8::vector4f:
-						{
-							sjson::StringView values[4];
-							if (m_parser.read(values, num_components))
-							{
-								const rtm::float4f value = hex_to_float4f(values, num_components);
-								std::memcpy(track_samples_typed.float1f + (size_t(sample_index) * num_components), &value, sizeof(float) * num_components);
-							}
-							else
-								has_error = true;
-							break;
-						}
-						case track_type8::qvvf:
-						{
-							rtm::qvvf sample;
-							if (!read_qvv_sample(sample))
-								has_error = true;
-							else
-								std::memcpy(track_samples_typed.qvvf + sample_index, &sample, sizeof(rtm::qvvf));
-							break;
-						}
-						default:
-							ACL_ASSERT(false, "Unsupported track type");
-							break;
-						}
-
-						if (has_error)
-							break;
-					}
-					else
-					{
-						switch (track_type)
-						{
-						case track_type8::float1f:
-						case track_type8::float2f:
-						case track_type8::float3f:
-						case track_type8::float4f:
-						case track_type8::vector4f:
-						{
-							double values[4] = { 0.0, 0.0, 0.0, 0.0 };
-							if (m_parser.read(values, num_components))
-							{
-								const rtm::float4f value = { static_cast<float>(values[0]), static_cast<float>(values[1]), static_cast<float>(values[2]), static_cast<float>(values[3]) };
-								std::memcpy(track_samples_typed.float1f + (size_t(sample_index) * num_components), &value, sizeof(float) * num_components);
-							}
-							else
-								has_error = true;
-							break;
-						}
-						case track_type8::qvvf:
-						{
-							rtm::qvvf sample;
-							if (!read_qvv_sample(sample))
-								has_error = true;
-							else
-								std::memcpy(track_samples_typed.qvvf + sample_index, &sample, sizeof(rtm::qvvf));
-							break;
-						}
-						default:
-							ACL_ASSERT(false, "Unsupported track type");
-							break;
-						}
-
-						if (has_error)
-							break;
-					}
-
-					if (!has_error && !m_parser.array_ends())
-					{
-						has_error = true;
-						break;
-					}
+					has_error = !skip_track_list_samples(track_type, num_components);
 				}
 
 				if (!has_error && !m_parser.array_ends())
@@ -1087,12 +1223,13 @@ namespace acl
 			return false;
 		}
 
-		bool create_track_list(track_array& track_list)
+		bool create_track_list(track_array& track_list, iclip_reader_scheduler* scheduler)
 		{
+			const bool defer_samples = scheduler != nullptr;
 			const sjson::ParserState before_tracks = m_parser.save_state();
 
 			uint32_t num_tracks;
-			if (!process_track_list(nullptr, num_tracks))
+			if (!process_track_list(nullptr, num_tracks, defer_samples, nullptr))
 				return false;
 
 			m_parser.restore_state(before_tracks);
@@ -1100,7 +1237,16 @@ namespace acl
 			track_list = track_array(m_allocator, num_tracks);
 			track_list.set_name(convert_string(m_clip_name));
 
-			if (!process_track_list(track_list.begin(), num_tracks))
+			sample_block* blocks = defer_samples ? allocate_type_array<sample_block>(m_allocator, num_tracks, before_tracks) : nullptr;
+
+			bool success = process_track_list(track_list.begin(), num_tracks, defer_samples, blocks);
+
+			if (success && defer_samples)
+				success = decode_sample_blocks(blocks, num_tracks, *scheduler);
+
+			deallocate_type_array(m_allocator, blocks, num_tracks);
+
+			if (!success)
 				return false;
 
 			ACL_ASSERT(num_tracks == track_list.get_num_tracks(), "Number of tracks read mismatch");
@@ -1108,7 +1254,9 @@ namespace acl
 			return true;
 		}
 
-		bool read_tracks(track_array_qvvf& track_list, track_array_qvvf& additive_base_track_list)
+		// When sample blocks are provided, the samples are only indexed and they must be decoded afterwards
+		// Each transform uses 3 consecutive blocks, the additive base transforms follow the clip transforms
+		bool read_tracks(track_array_qvvf& track_list, track_array_qvvf& additive_base_track_list, sample_block* blocks)
 		{
 			const uint32_t num_transforms = track_list.get_num_tracks();
 
@@ -1142,41 +1290,12 @@ namespace acl
 					track_qvvf track = track_qvvf::make_reserve(desc, m_allocator, m_additive_base_num_samples, m_additive_base_sample_rate);
 					track.set_name(convert_string(name));
 
-					if (m_parser.try_array_begins("rotations"))
-					{
-						if (!read_track_rotations(track, m_additive_base_num_samples) || !m_parser.array_ends())
-							goto error;
-					}
-					else
-					{
-						for (uint32_t sample_index = 0; sample_index < m_additive_base_num_samples; ++sample_index)
-							track[sample_index].rotation = rtm::quat_identity();
-					}
-
-					if (m_parser.try_array_begins("translations"))
-					{
-						if (!read_track_translations(track, m_additive_base_num_samples) || !m_parser.array_ends())
-							goto error;
-					}
-					else
-					{
-						for (uint32_t sample_index = 0; sample_index < m_additive_base_num_samples; ++sample_index)
-							track[sample_index].translation = rtm::vector_zero();
-					}
-
-					if (m_parser.try_array_begins("scales"))
-					{
-						if (!read_track_scales(track, m_additive_base_num_samples) || !m_parser.array_ends())
-							goto error;
-					}
-					else
-					{
-						for (uint32_t sample_index = 0; sample_index < m_additive_base_num_samples; ++sample_index)
-							track[sample_index].scale = rtm::vector_set(1.0F);
-					}
-
 					additive_base_track_list[bone_index] = std::move(track);
 
+					sample_block* track_blocks = blocks != nullptr ? &blocks[(num_transforms + bone_index) * 3] : nullptr;
+					if (!read_transform_samples(additive_base_track_list[bone_index], m_additive_base_num_samples, track_blocks))
+						goto error;
+
 					if (!m_parser.object_ends())
 						goto error;
 				}
@@ -1207,41 +1326,12 @@ namespace acl
 				track_qvvf track = track_qvvf::make_reserve(desc, m_allocator, m_num_samples, m_sample_rate);
 				track.set_name(convert_string(name));
 
-				if (m_parser.try_array_begins("rotations"))
-				{
-					if (!read_track_rotations(track, m_num_samples) || !m_parser.array_ends())
-						goto error;
-				}
-				else
-				{
-					for (uint32_t sample_index = 0; sample_index < m_num_samples; ++sample_index)
-						track[sample_index].rotation = rtm::quat_identity();
-				}
-
-				if (m_parser.try_array_begins("translations"))
-				{
-					if (!read_track_translations(track, m_num_samples) || !m_parser.array_ends())
-						goto error;
-				}
-				else
-				{
-					for (uint32_t sample_index = 0; sample_index < m_num_samples; ++sample_index)
-						track[sample_index].translation = rtm::vector_zero();
-				}
-
-				if (m_parser.try_array_begins("scales"))
-				{
-					if (!read_track_scales(track, m_num_samples) || !m_parser.array_ends())
-						goto error;
-				}
-				else
-				{
-					for (uint32_t sample_index = 0; sample_index < m_num_samples; ++sample_index)
-						track[sample_index].scale = rtm::vector_set(1.0F);
-				}
-
 				track_list[bone_index] = std::move(track);
 
+				sample_block* track_blocks = blocks != nullptr ? &blocks[bone_index * 3] : nullptr;
+				if (!read_transform_samples(track_list[bone_index], m_num_samples, track_blocks))
+					goto error;
+
 				if (!m_parser.object_ends())
 					goto error;
 			}
@@ -1253,11 +1343,11 @@ namespace acl
 			return false;
 		}
 
-		bool read_track_rotations(track_qvvf& track, uint32_t num_samples_expected)
+		bool read_track_rotations(sjson::Parser& parser, track_qvvf& track, uint32_t num_samples_expected) const
 		{
 			for (uint32_t i = 0; i < num_samples_expected; ++i)
 			{
-				if (!m_parser.array_begins())
+				if (!parser.array_begins())
 					return false;
 
 				rtm::quatd rotation;
@@ -1265,7 +1355,7 @@ namespace acl
 				if (m_is_binary_exact)
 				{
 					sjson::StringView values[4];
-					if (!m_parser.read(values, 4))
+					if (!parser.read(values, 4))
 						return false;
 
 					rotation = hex_to_quat(values);
@@ -1273,13 +1363,13 @@ namespace acl
 				else
 				{
 					double values[4] = { 0.0, 0.0, 0.0, 0.0 };
-					if (!m_parser.read(values, 4))
+					if (!parser.read(values, 4))
 						return false;
 
 					rotation = rtm::quat_load(values);
 				}
 
-				if (!m_parser.array_ends())
+				if (!parser.array_ends())
 					return false;
 
 				track[i].rotation = rtm::quat_normalize_deterministic(rtm::quat_cast(rotation));
@@ -1288,11 +1378,11 @@ namespace acl
 			return true;
 		}
 
-		bool read_track_translations(track_qvvf& track, uint32_t num_samples_expected)
+		bool read_track_translations(sjson::Parser& parser, track_qvvf& track, uint32_t num_samples_expected) const
 		{
 			for (uint32_t i = 0; i < num_samples_expected; ++i)
 			{
-				if (!m_parser.array_begins())
+				if (!parser.array_begins())
 					return false;
 
 				rtm::vector4d translation;
@@ -1300,7 +1390,7 @@ namespace acl
 				if (m_is_binary_exact)
 				{
 					sjson::StringView values[3];
-					if (!m_parser.read(values, 3))
+					if (!parser.read(values, 3))
 						return false;
 
 					translation = hex_to_vector3(values);
@@ -1308,13 +1398,13 @@ namespace acl
 				else
 				{
 					double values[3];
-					if (!m_parser.read(values, 3))
+					if (!parser.read(values, 3))
 						return false;
 
 					translation = rtm::vector_load3(values);
 				}
 
-				if (!m_parser.array_ends())
+				if (!parser.array_ends())
 					return false;
 
 				track[i].translation = rtm::vector_cast(translation);
@@ -1323,11 +1413,11 @@ namespace acl
 			return true;
 		}
 
-		bool read_track_scales(track_qvvf& track, uint32_t num_samples_expected)
+		bool read_track_scales(sjson::Parser& parser, track_qvvf& track, uint32_t num_samples_expected) const
 		{
 			for (uint32_t i = 0; i < num_samples_expected; ++i)
 			{
-				if (!m_parser.array_begins())
+				if (!parser.array_begins())
 					return false;
 
 				rtm::vector4d scale;
@@ -1335,7 +1425,7 @@ namespace acl
 				if (m_is_binary_exact)
 				{
 					sjson::StringView values[3];
-					if (!m_parser.read(values, 3))
+					if (!parser.read(values, 3))
 						return false;
 
 					scale = hex_to_vector3(values);
@@ -1343,13 +1433,13 @@ namespace acl
 				else
 				{
 					double values[3];
-					if (!m_parser.read(values, 3))
+					if (!parser.read(values, 3))
 						return false;
 
 					scale = rtm::vector_load3(values);
 				}
 
-				if (!m_parser.array_ends())
+				if (!parser.array_ends())
 					return false;
 
 				track[i].scale = rtm::vector_cast(scale);
@@ -1358,6 +1448,169 @@ namespace acl
 			return true;
 		}
 
+		bool read_transform_samples(track_qvvf& track, uint32_t num_samples, sample_block* blocks)
+		{
+			if (m_parser.try_array_begins("rotations"))
+			{
+				const bool success = blocks != nullptr ? defer_transform_samples(track, num_samples, sample_block_type::rotations, blocks[0]) : read_track_rotations(m_parser, track, num_samples);
+				if (!success || !m_parser.array_ends())
+					return false;
+			}
+			else
+			{
+				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+					track[sample_index].rotation = rtm::quat_identity();
+
+				if (blocks != nullptr)
+					blocks[0].is_used = false;
+			}
+
+			if (m_parser.try_array_begins("translations"))
+			{
+				const bool success = blocks != nullptr ? defer_transform_samples(track, num_samples, sample_block_type::translations, blocks[1]) : read_track_translations(m_parser, track, num_samples);
+				if (!success || !m_parser.array_ends())
+					return false;
+			}
+			else
+			{
+				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+					track[sample_index].translation = rtm::vector_zero();
+
+				if (blocks != nullptr)
+					blocks[1].is_used = false;
+			}
+
+			if (m_parser.try_array_begins("scales"))
+			{
+				const bool success = blocks != nullptr ? defer_transform_samples(track, num_samples, sample_block_type::scales, blocks[2]) : read_track_scales(m_parser, track, num_samples);
+				if (!success || !m_parser.array_ends())
+					return false;
+			}
+			else
+			{
+				for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+					track[sample_index].scale = rtm::vector_set(1.0F);
+
+				if (blocks != nullptr)
+					blocks[2].is_used = false;
+			}
+
+			return true;
+		}
+
+		bool defer_transform_samples(track_qvvf& track, uint32_t num_samples, sample_block_type type, sample_block& block)
+		{
+			block.state = m_parser.save_state();
+			block.track_ = &track;
+			block.num_samples = num_samples;
+			block.num_components = type == sample_block_type::rotations ? 4 : 3;
+			block.type = type;
+			block.is_used = true;
+
+			return skip_samples(num_samples, block.num_components);
+		}
+
+		// Skips over samples without decoding them, only supported with binary exact values
+		bool skip_samples(uint32_t num_samples, uint32_t num_components)
+		{
+			ACL_ASSERT(m_is_binary_exact, "Only binary exact samples can be skipped");
+
+			sjson::StringView values[4];
+			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			{
+				if (!m_parser.array_begins() || !m_parser.read(values, num_components) || !m_parser.array_ends())
+					return false;
+			}
+
+			return true;
+		}
+
+		bool skip_track_list_samples(track_type8 track_type, uint32_t num_components)
+		{
+			if (track_type != track_type8::qvvf)
+				return skip_samples(m_num_samples, num_components);
+
+			// Each sample holds a rotation, a translation, and a scale array
+			for (uint32_t sample_index = 0; sample_index < m_num_samples; ++sample_index)
+			{
+				if (!m_parser.array_begins())
+					return false;
+
+				if (!skip_samples(1, 4) || !m_parser.read_comma())
+					return false;
+
+				if (!skip_samples(1, 3) || !m_parser.read_comma())
+					return false;
+
+				if (!skip_samples(1, 3))
+					return false;
+
+				if (!m_parser.array_ends())
+					return false;
+			}
+
+			return true;
+		}
+
+		void decode_sample_block(sample_block& block) const
+		{
+			if (!block.is_used)
+				return;
+
+			// Every block uses its own parser over the same input so that blocks can be decoded concurrently
+			sjson::Parser parser(m_input, m_input_length);
+			parser.restore_state(block.state);
+
+			bool success = false;
+			switch (block.type)
+			{
+			case sample_block_type::rotations:
+				success = read_track_rotations(parser, *block.track_, block.num_samples);
+				break;
+			case sample_block_type::translations:
+				success = read_track_translations(parser, *block.track_, block.num_samples);
+				break;
+			case sample_block_type::scales:
+				success = read_track_scales(parser, *block.track_, block.num_samples);
+				break;
+			case sample_block_type::track_list_data:
+				success = read_track_list_samples(parser, block.track_type, block.num_components, block.num_samples, block.samples);
+				break;
+			}
+
+			if (!success)
+				block.error = parser.get_error();
+
+			block.is_decoded = success;
+		}
+
+		static void decode_sample_block_job(uint32_t job_index, void* user_data)
+		{
+			decode_job_context& context = *static_cast<decode_job_context*>(user_data);
+			context.reader->decode_sample_block(context.blocks[job_index]);
+		}
+
+		bool decode_sample_blocks(sample_block* blocks, uint32_t num_blocks, iclip_reader_scheduler& scheduler)
+		{
+			decode_job_context context;
+			context.reader = this;
+			context.blocks = blocks;
+
+			scheduler.execute(num_blocks, &decode_sample_block_job, &context);
+
+			for (uint32_t block_index = 0; block_index < num_blocks; ++block_index)
+			{
+				const sample_block& block = blocks[block_index];
+				if (block.is_used && !block.is_decoded)
+				{
+					m_error = block.error;
+					return false;
+				}
+			}
+
+			return true;
+		}
+
 		bool nothing_follows()
 		{
 			if (!m_parser.remainder_is_comments_and_whitespace())
@@ -1376,6 +1629,250 @@ namespace acl
 		}
 	};
 
+	//////////////////////////////////////////////////////////////////////////
+	// A binary ACL raw clip file reader (.acl.bin), see write_binary_track_list(..).
+	// No parsing takes place, track samples are referenced in place inside the
+	// provided buffer with 'track_typed<..>::make_ref(..)'. The buffer is typically
+	// a memory mapped file. It must be aligned to 16 bytes and it must outlive the
+	// tracks read from it. Clip and track names are copied.
+	class binary_clip_reader
+	{
+	public:
+		binary_clip_reader(iallocator& allocator, void* buffer, size_t buffer_size)
+			: m_allocator(allocator)
+			, m_buffer(static_cast<uint8_t*>(buffer))
+			, m_buffer_size(buffer_size)
+			, m_error()
+		{
+		}
+
+		sjson_file_type get_file_type()
+		{
+			if (!validate())
+				return sjson_file_type::unknown;
+
+			return get_header().track_type == track_type8::qvvf ? sjson_file_type::raw_clip : sjson_file_type::raw_track_list;
+		}
+
+		bool read_raw_clip(sjson_raw_clip& out_data)
+		{
+			if (!validate())
+				return false;
+
+			const acl_impl::binary_raw_clip_header& header = get_header();
+			if (header.track_type != track_type8::qvvf)
+			{
+				m_error.error = clip_reader_error::InvalidTrackType;
+				return false;
+			}
+
+			out_data.track_list = track_array_qvvf(m_allocator, header.num_tracks);
+			read_tracks(out_data.track_list, false);
+
+			if (header.additive_base_num_samples != 0)
+			{
+				out_data.additive_base_track_list = track_array_qvvf(m_allocator, header.num_tracks);
+				read_tracks(out_data.additive_base_track_list, true);
+			}
+
+			out_data.additive_format = !out_data.additive_base_track_list.is_empty() ? additive_clip_format8(header.additive_format) : additive_clip_format8::none;
+
+			read_settings(&out_data.has_settings, &out_data.settings);
+			return true;
+		}
+
+		bool read_raw_track_list(sjson_raw_track_list& out_data)
+		{
+			if (!validate())
+				return false;
+
+			const acl_impl::binary_raw_clip_header& header = get_header();
+
+			out_data.track_list = track_array(m_allocator, header.num_tracks);
+			read_tracks(out_data.track_list, false);
+
+			read_settings(&out_data.has_settings, &out_data.settings);
+			return true;
+		}
+
+		clip_reader_error get_error() const { return m_error; }
+
+	private:
+		binary_clip_reader(const binary_clip_reader&) = delete;
+		binary_clip_reader& operator=(const binary_clip_reader&) = delete;
+
+		iallocator& m_allocator;
+		uint8_t* m_buffer;
+		size_t m_buffer_size;
+		clip_reader_error m_error;
+
+		const acl_impl::binary_raw_clip_header& get_header() const
+		{
+			return *safe_ptr_cast<const acl_impl::binary_raw_clip_header>(m_buffer);
+		}
+
+		const acl_impl::binary_raw_track_desc* get_track_descs() const
+		{
+			return safe_ptr_cast<const acl_impl::binary_raw_track_desc>(m_buffer + get_header().track_descs_offset);
+		}
+
+		string make_string(uint32_t offset, uint32_t size) const
+		{
+			return string(m_allocator, safe_ptr_cast<const char>(m_buffer + offset), size);
+		}
+
+		static bool is_range_valid(uint32_t offset, uint64_t size, uint32_t buffer_size)
+		{
+			return uint64_t(offset) + size <= buffer_size;
+		}
+
+		bool validate()
+		{
+			m_error = clip_reader_error();
+
+			if (m_buffer == nullptr || m_buffer_size < sizeof(acl_impl::binary_raw_clip_header) || !is_aligned_to(m_buffer, acl_impl::k_binary_raw_clip_sample_alignment))
+			{
+				m_error.error = clip_reader_error::InvalidBinaryClip;
+				return false;
+			}
+
+			const acl_impl::binary_raw_clip_header& header = get_header();
+			if (header.tag != acl_impl::k_binary_raw_clip_tag || header.size > m_buffer_size)
+			{
+				m_error.error = clip_reader_error::InvalidBinaryClip;
+				return false;
+			}
+
+			if (header.version != acl_impl::k_binary_raw_clip_version)
+			{
+				m_error.error = clip_reader_error::UnsupportedVersion;
+				return false;
+			}
+
+			const uint32_t sample_size = acl_impl::get_binary_raw_sample_size(header.track_type);
+			if (sample_size == 0)
+			{
+				m_error.error = clip_reader_error::InvalidTrackType;
+				return false;
+			}
+
+			const bool has_additive_base = header.additive_base_num_samples != 0;
+			const uint64_t samples_size = uint64_t(header.num_samples) * sample_size;
+			const uint64_t additive_base_samples_size = uint64_t(header.additive_base_num_samples) * sample_size;
+
+			bool is_valid = header.looping_policy <= uint8_t(sample_looping_policy::wrap);
+			is_valid = is_valid && (!has_additive_base || header.track_type == track_type8::qvvf);
+			is_valid = is_valid && is_aligned_to(header.track_descs_offset, alignof(acl_impl::binary_raw_track_desc));
+			is_valid = is_valid && is_range_valid(header.track_descs_offset, uint64_t(header.num_tracks) * sizeof(acl_impl::binary_raw_track_desc), header.size);
+			is_valid = is_valid && is_range_valid(header.name_offset, header.name_size, header.size);
+			is_valid = is_valid && is_range_valid(header.additive_base_name_offset, header.additive_base_name_size, header.size);
+
+			const acl_impl::binary_raw_track_desc* descs = is_valid ? get_track_descs() : nullptr;
+			for (uint32_t track_index = 0; is_valid && track_index < header.num_tracks; ++track_index)
+			{
+				const acl_impl::binary_raw_track_desc& desc = descs[track_index];
+
+				is_valid = is_range_valid(desc.name_offset, desc.name_size, header.size);
+				is_valid = is_valid && is_aligned_to(desc.samples_offset, acl_impl::k_binary_raw_clip_sample_alignment);
+				is_valid = is_valid && is_range_valid(desc.samples_offset, samples_size, header.size);
+
+				if (has_additive_base)
+				{
+					is_valid = is_valid && is_aligned_to(desc.additive_base_samples_offset, acl_impl::k_binary_raw_clip_sample_alignment);
+					is_valid = is_valid && is_range_valid(desc.additive_base_samples_offset, additive_base_samples_size, header.size);
+				}
+			}
+
+			if (!is_valid)
+			{
+				m_error.error = clip_reader_error::InvalidBinaryClip;
+				return false;
+			}
+
+			return true;
+		}
+
+		void read_tracks(track_array& track_list, bool is_additive_base) const
+		{
+			const acl_impl::binary_raw_clip_header& header = get_header();
+			const acl_impl::binary_raw_track_desc* descs = get_track_descs();
+
+			const uint32_t num_samples = is_additive_base ? header.additive_base_num_samples : header.num_samples;
+			const float sample_rate = is_additive_base ? header.additive_base_sample_rate : header.sample_rate;
+
+			if (is_additive_base)
+				track_list.set_name(make_string(header.additive_base_name_offset, header.additive_base_name_size));
+			else
+			{
+				track_list.set_name(make_string(header.name_offset, header.name_size));
+				track_list.set_looping_policy(sample_looping_policy(header.looping_policy));
+			}
+
+			for (uint32_t track_index = 0; track_index < header.num_tracks; ++track_index)
+			{
+				const acl_impl::binary_raw_track_desc& desc = descs[track_index];
+				uint8_t* samples = m_buffer + (is_additive_base ? desc.additive_base_samples_offset : desc.samples_offset);
+
+				track_desc_scalarf scalar_desc;
+				scalar_desc.output_index = desc.output_index;
+				scalar_desc.precision = desc.precision;
+
+				track& track_ = track_list[track_index];
+
+				switch (header.track_type)
+				{
+				case track_type8::float1f:
+					track_ = track_float1f::make_ref(scalar_desc, safe_ptr_cast<float>(samples), num_samples, sample_rate);
+					break;
+				case track_type8::float2f:
+					track_ = track_float2f::make_ref(scalar_desc, safe_ptr_cast<rtm::float2f>(samples), num_samples, sample_rate);
+					break;
+				case track_type8::float3f:
+					track_ = track_float3f::make_ref(scalar_desc, safe_ptr_cast<rtm::float3f>(samples), num_samples, sample_rate);
+					break;
+				case track_type8::float4f:
+					track_ = track_float4f::make_ref(scalar_desc, safe_ptr_cast<rtm::float4f>(samples), num_samples, sample_rate);
+					break;
+				case track_type8::vector4f:
+					track_ = track_vector4f::make_ref(scalar_desc, safe_ptr_cast<rtm::vector4f>(samples), num_samples, sample_rate);
+					break;
+				case track_type8::qvvf:
+				{
+					track_desc_transformf transform_desc;
+					transform_desc.output_index = desc.output_index;
+					transform_desc.parent_index = desc.parent_index;
+					transform_desc.precision = desc.precision;
+					transform_desc.shell_distance = desc.shell_distance;
+					transform_desc.default_value = rtm::qvv_set(rtm::quat_load(&desc.default_rotation[0]), rtm::vector_load3(&desc.default_translation[0]), rtm::vector_load3(&desc.default_scale[0]));
+
+					track_ = track_qvvf::make_ref(transform_desc, safe_ptr_cast<rtm::qvvf>(samples), num_samples, sample_rate);
+					break;
+				}
+				default:
+					ACL_ASSERT(false, "Unsupported track type");
+					break;
+				}
+
+				track_.set_name(make_string(desc.name_offset, desc.name_size));
+			}
+		}
+
+		void read_settings(bool* out_has_settings, compression_settings* out_settings) const
+		{
+			const acl_impl::binary_raw_clip_header& header = get_header();
+
+			*out_has_settings = header.has_settings != 0;
+
+			if (header.has_settings != 0)
+			{
+				out_settings->level = compression_level8(header.level);
+				out_settings->rotation_format = rotation_format8(header.rotation_format);
+				out_settings->translation_format = vector_format8(header.translation_format);
+				out_settings->scale_format = vector_format8(header.scale_format);
+			}
+		}
+	};
+
 	ACL_IMPL_VERSION_NAMESPACE_END
 }
 
@@ -51,6 +51,7 @@ namespace acl
 			InvalidAdditiveClipFormat,
 			PositiveValueExpected,
 			InvalidTrackType,
+			InvalidBinaryClip,
 		};
 
 		clip_reader_error() noexcept = default;
@@ -82,6 +83,8 @@ namespace acl
 				return "A positive value is expected here";
 			case InvalidTrackType:
 				return "Invalid raw track type";
+			case InvalidBinaryClip:
+				return "The binary raw clip data is truncated or malformed";
 			default:
 				return sjson::ParserError::get_description();
 			}
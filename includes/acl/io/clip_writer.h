@@ -32,16 +32,21 @@
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/iallocator.h"
 #include "acl/core/error.h"
+#include "acl/core/additive_utils.h"
+#include "acl/core/memory_utils.h"
 #include "acl/core/track_desc.h"
+#include "acl/io/impl/binary_raw_clip.h"
 
 #include <rtm/quatd.h>
+#include <rtm/quatf.h>
 #include <rtm/vector4d.h>
+#include <rtm/vector4f.h>
 
 #include <sjson/writer.h>
 
 #include <cstdint>
-#include <cinttypes>
 #include <cstdio>
+#include <cstring>
 
 ACL_IMPL_FILE_PRAGMA_PUSH
 
@@ -51,7 +56,9 @@ namespace acl
 
 	namespace acl_impl
 	{
-		inline const char* format_hex_float(float value, char* buffer, size_t buffer_size)
+		// Writes the upper case hexadecimal representation of the float bits without leading zeros and
+		// without a NULL terminator, same as printf with "%X". Returns the number of characters written.
+		inline size_t write_hex_float(float value, char* buffer)
 		{
 			union FloatToUInt32
 			{
@@ -61,10 +68,34 @@ namespace acl
 				constexpr explicit FloatToUInt32(float flt_value) : flt(flt_value) {}
 			};
 
-			snprintf(buffer, buffer_size, "%" PRIX32, FloatToUInt32(value).u32);
+			constexpr const char* k_hex_digits = "0123456789ABCDEF";
+
+			const uint32_t value_u32 = FloatToUInt32(value).u32;
+
+			// Always write at least one digit
+			uint32_t num_digits = 1;
+			while (num_digits < 8 && (value_u32 >> (num_digits * 4)) != 0)
+				num_digits++;
+
+			for (uint32_t digit_index = 0; digit_index < num_digits; ++digit_index)
+			{
+				const uint32_t shift = (num_digits - digit_index - 1) * 4;
+				buffer[digit_index] = k_hex_digits[(value_u32 >> shift) & 0xF];
+			}
+
+			return num_digits;
+		}
+
+		inline const char* format_hex_float(float value, char* buffer, size_t buffer_size)
+		{
+			ACL_ASSERT(buffer_size > 8, "Buffer is too small to hold a hex float");
+			(void)buffer_size;
+
+			const size_t num_digits = write_hex_float(value, buffer);
+			buffer[num_digits] = '\0';
 
 			return buffer;
-		};
+		}
 
 		inline void write_sjson_settings(const compression_settings& settings, sjson::Writer& writer)
 		{
@@ -121,6 +152,7 @@ namespace acl
 			writer["output_index"] = desc.output_index;
 			writer["parent_index"] = desc.parent_index;
 			writer["shell_distance"] = format_hex_float(desc.shell_distance, buffer, sizeof(buffer));
+			writer["importance"] = format_hex_float(desc.importance, buffer, sizeof(buffer));
 			writer["bind_rotation"] = [&](sjson::ArrayWriter& rotation_writer)
 			{
 				rotation_writer.push(acl_impl::format_hex_float(rtm::quat_get_x(desc.default_value.rotation), buffer, sizeof(buffer)));
@@ -371,6 +403,230 @@ namespace acl
 			std::fclose(file);
 			return error_result();
 		}
+
+		inline bool write_binary_padding(std::FILE* file, uint64_t& offset, uint64_t target_offset)
+		{
+			static constexpr uint8_t k_zeros[k_binary_raw_clip_sample_alignment] = { 0 };
+
+			ACL_ASSERT(target_offset >= offset && target_offset - offset <= sizeof(k_zeros), "Invalid padding");
+			const size_t padding = size_t(target_offset - offset);
+			offset = target_offset;
+
+			return padding == 0 || std::fwrite(k_zeros, 1, padding, file) == padding;
+		}
+
+		inline bool write_binary_samples(std::FILE* file, const track& track_, uint32_t sample_size, uint64_t& offset)
+		{
+			const uint32_t num_samples = track_.get_num_samples();
+			offset += uint64_t(num_samples) * sample_size;
+
+			if (num_samples == 0)
+				return true;
+
+			// Tracks that are densely packed are written in one go, others one sample at a time
+			if (track_.get_stride() == sample_size)
+				return std::fwrite(track_[0], sample_size, num_samples, file) == num_samples;
+
+			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			{
+				if (std::fwrite(track_[sample_index], sample_size, 1, file) != 1)
+					return false;
+			}
+
+			return true;
+		}
+
+		inline error_result write_binary_track_list(const track_array& track_list, const track_array_qvvf* additive_base_track_list, additive_clip_format8 additive_format, const compression_settings* settings, const char* acl_filename)
+		{
+			if (acl_filename == nullptr)
+				return error_result("'acl_filename' cannot be NULL!");
+
+			const size_t filename_len = std::strlen(acl_filename);
+			if (filename_len < 8 || strncmp(acl_filename + filename_len - 8, ".acl.bin", 8) != 0)
+				return error_result("'acl_filename' file must be a binary ACL raw clip file of the form: *.acl.bin");
+
+			const track_type8 track_type = track_list.get_track_type();
+			const uint32_t sample_size = get_binary_raw_sample_size(track_type);
+			if (sample_size == 0)
+				return error_result("Unsupported track type");
+
+			const uint32_t num_tracks = track_list.get_num_tracks();
+			const uint32_t num_samples = track_list.get_num_samples_per_track();
+
+			const bool has_additive_base = additive_base_track_list != nullptr && !additive_base_track_list->is_empty();
+			if (has_additive_base && additive_base_track_list->get_num_tracks() != num_tracks)
+				return error_result("The additive base must have as many tracks as the track list");
+
+			const uint32_t additive_base_num_samples = has_additive_base ? additive_base_track_list->get_num_samples_per_track() : 0;
+
+			const string& name = track_list.get_name();
+			const size_t name_size = name.size();
+			const size_t additive_base_name_size = has_additive_base ? additive_base_track_list->get_name().size() : 0;
+
+			iallocator* allocator = track_list.get_allocator();
+			if (num_tracks != 0 && allocator == nullptr)
+				return error_result("Track list has no allocator");
+
+			binary_raw_track_desc* descs = num_tracks != 0 ? allocate_type_array<binary_raw_track_desc>(*allocator, num_tracks) : nullptr;
+
+			// Lay out everything first, we write sequentially afterwards
+			uint64_t offset = sizeof(binary_raw_clip_header);
+
+			const uint64_t track_descs_offset = offset;
+			offset += uint64_t(num_tracks) * sizeof(binary_raw_track_desc);
+
+			const uint64_t name_offset = offset;
+			offset += name_size;
+
+			const uint64_t additive_base_name_offset = offset;
+			offset += additive_base_name_size;
+
+			for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			{
+				const track& track_ = track_list[track_index];
+
+				binary_raw_track_desc& desc = descs[track_index];
+				std::memset(&desc, 0, sizeof(binary_raw_track_desc));
+
+				desc.name_offset = uint32_t(offset);
+				desc.name_size = uint32_t(track_.get_name().size());
+				offset += desc.name_size;
+
+				if (track_type == track_type8::qvvf)
+				{
+					const track_desc_transformf& transform_desc = track_.get_description<track_desc_transformf>();
+					desc.output_index = transform_desc.output_index;
+					desc.parent_index = transform_desc.parent_index;
+					desc.precision = transform_desc.precision;
+					desc.shell_distance = transform_desc.shell_distance;
+					rtm::quat_store(transform_desc.default_value.rotation, &desc.default_rotation[0]);
+					rtm::vector_store3(transform_desc.default_value.translation, &desc.default_translation[0]);
+					rtm::vector_store3(transform_desc.default_value.scale, &desc.default_scale[0]);
+				}
+				else
+				{
+					const track_desc_scalarf& scalar_desc = track_.get_description<track_desc_scalarf>();
+					desc.output_index = scalar_desc.output_index;
+					desc.parent_index = k_invalid_track_index;
+					desc.precision = scalar_desc.precision;
+				}
+			}
+
+			const uint64_t strings_end_offset = offset;
+
+			for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			{
+				offset = align_to(offset, k_binary_raw_clip_sample_alignment);
+				descs[track_index].samples_offset = uint32_t(offset);
+				offset += uint64_t(track_list[track_index].get_num_samples()) * sample_size;
+			}
+
+			for (uint32_t track_index = 0; has_additive_base && track_index < num_tracks; ++track_index)
+			{
+				offset = align_to(offset, k_binary_raw_clip_sample_alignment);
+				descs[track_index].additive_base_samples_offset = uint32_t(offset);
+				offset += uint64_t((*additive_base_track_list)[track_index].get_num_samples()) * sample_size;
+			}
+
+			const uint64_t file_size = offset;
+			if (file_size > uint64_t(0xFFFFFFFFU))
+			{
+				if (descs != nullptr)
+					deallocate_type_array(*allocator, descs, num_tracks);
+
+				return error_result("Track list is too large to be written as a binary ACL raw clip file");
+			}
+
+			binary_raw_clip_header header;
+			std::memset(&header, 0, sizeof(binary_raw_clip_header));
+			header.tag = k_binary_raw_clip_tag;
+			header.version = k_binary_raw_clip_version;
+			header.size = uint32_t(file_size);
+			header.num_tracks = num_tracks;
+			header.num_samples = num_samples;
+			header.sample_rate = track_list.get_sample_rate();
+			header.additive_base_num_samples = additive_base_num_samples;
+			header.additive_base_sample_rate = has_additive_base ? additive_base_track_list->get_sample_rate() : 0.0F;
+			header.name_offset = uint32_t(name_offset);
+			header.name_size = uint32_t(name_size);
+			header.additive_base_name_offset = uint32_t(additive_base_name_offset);
+			header.additive_base_name_size = uint32_t(additive_base_name_size);
+			header.track_descs_offset = uint32_t(track_descs_offset);
+			header.track_type = track_type;
+			header.looping_policy = uint8_t(track_list.get_looping_policy());
+			header.additive_format = uint8_t(has_additive_base ? additive_format : additive_clip_format8::none);
+			header.has_settings = settings != nullptr ? 1 : 0;
+
+			if (settings != nullptr)
+			{
+				header.level = uint8_t(settings->level);
+				header.rotation_format = uint8_t(settings->rotation_format);
+				header.translation_format = uint8_t(settings->translation_format);
+				header.scale_format = uint8_t(settings->scale_format);
+			}
+
+			std::FILE* file = nullptr;
+
+#ifdef _WIN32
+			char path[1 * 1024] = { 0 };
+			snprintf(path, get_array_size(path), "\\\\?\\%s", acl_filename);
+			fopen_s(&file, path, "wb");
+#else
+			file = fopen(acl_filename, "wb");
+#endif
+
+			if (file == nullptr)
+			{
+				if (descs != nullptr)
+					deallocate_type_array(*allocator, descs, num_tracks);
+
+				return error_result("Failed to open ACL file for writing");
+			}
+
+			bool success = std::fwrite(&header, sizeof(binary_raw_clip_header), 1, file) == 1;
+
+			if (success && num_tracks != 0)
+				success = std::fwrite(descs, sizeof(binary_raw_track_desc), num_tracks, file) == num_tracks;
+
+			if (success && name_size != 0)
+				success = std::fwrite(name.c_str(), 1, name_size, file) == name_size;
+
+			if (success && additive_base_name_size != 0)
+				success = std::fwrite(additive_base_track_list->get_name().c_str(), 1, additive_base_name_size, file) == additive_base_name_size;
+
+			for (uint32_t track_index = 0; success && track_index < num_tracks; ++track_index)
+			{
+				const size_t track_name_size = descs[track_index].name_size;
+				if (track_name_size != 0)
+					success = std::fwrite(track_list[track_index].get_name().c_str(), 1, track_name_size, file) == track_name_size;
+			}
+
+			offset = strings_end_offset;
+
+			for (uint32_t track_index = 0; success && track_index < num_tracks; ++track_index)
+			{
+				success = write_binary_padding(file, offset, descs[track_index].samples_offset);
+				success = success && write_binary_samples(file, track_list[track_index], sample_size, offset);
+			}
+
+			for (uint32_t track_index = 0; success && has_additive_base && track_index < num_tracks; ++track_index)
+			{
+				success = write_binary_padding(file, offset, descs[track_index].additive_base_samples_offset);
+				success = success && write_binary_samples(file, (*additive_base_track_list)[track_index], sample_size, offset);
+			}
+
+			ACL_ASSERT(!success || offset == file_size, "Unexpected binary ACL raw clip file size");
+
+			std::fclose(file);
+
+			if (descs != nullptr)
+				deallocate_type_array(*allocator, descs, num_tracks);
+
+			if (!success)
+				return error_result("Failed to write ACL file");
+
+			return error_result();
+		}
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -389,6 +645,424 @@ namespace acl
 		return acl_impl::write_track_list(track_list, &settings, acl_filename);
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Write out a binary ACL raw track list file (.acl.bin).
+	// Samples are stored uncompressed and can be read back in place with binary_clip_reader.
+	//////////////////////////////////////////////////////////////////////////
+	inline error_result write_binary_track_list(const track_array& track_list, const char* acl_filename)
+	{
+		return acl_impl::write_binary_track_list(track_list, nullptr, additive_clip_format8::none, nullptr, acl_filename);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Write out a binary ACL raw track list file (.acl.bin).
+	// Samples are stored uncompressed and can be read back in place with binary_clip_reader.
+	//////////////////////////////////////////////////////////////////////////
+	inline error_result write_binary_track_list(const track_array& track_list, const compression_settings& settings, const char* acl_filename)
+	{
+		return acl_impl::write_binary_track_list(track_list, nullptr, additive_clip_format8::none, &settings, acl_filename);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Write out a binary ACL raw clip file (.acl.bin) along with its additive base.
+	// The settings are optional and can be NULL.
+	// Samples are stored uncompressed and can be read back in place with binary_clip_reader.
+	//////////////////////////////////////////////////////////////////////////
+	inline error_result write_binary_track_list(const track_array_qvvf& track_list, const track_array_qvvf& additive_base_track_list, additive_clip_format8 additive_format, const compression_settings* settings, const char* acl_filename)
+	{
+		return acl_impl::write_binary_track_list(track_list, &additive_base_track_list, additive_format, settings, acl_filename);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes out an SJSON ACL track list file incrementally.
+	// Unlike write_track_list(..), the tracks do not need to live in memory: their
+	// samples are provided in as many chunks as needed and the output is emitted to
+	// a file or a callback through a fixed size buffer. Values are binary exact.
+	//
+	// Usage:
+	//    begin_track_list(..)
+	//    For every track: begin_track(..), write_samples(..) until all samples are written, end_track()
+	//    end_track_list()
+	//////////////////////////////////////////////////////////////////////////
+	class track_list_stream_writer
+	{
+	public:
+		//////////////////////////////////////////////////////////////////////////
+		// Called with every chunk of output, in order.
+		using write_callback = void (*)(const char* buffer, size_t buffer_size, void* user_data);
+
+		explicit track_list_stream_writer(std::FILE* file)
+			: m_file(file)
+		{
+		}
+
+		track_list_stream_writer(write_callback callback, void* user_data)
+			: m_callback(callback)
+			, m_user_data(user_data)
+		{
+		}
+
+		~track_list_stream_writer()
+		{
+			flush();
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Writes the track list header, the settings are optional.
+		// Every track must have 'num_samples' samples.
+		void begin_track_list(const char* name, uint32_t num_samples, float sample_rate, const compression_settings* settings = nullptr)
+		{
+			ACL_ASSERT(m_state == state::empty, "Track list already started");
+
+			m_num_samples = num_samples;
+
+			write("version = 5\n\ntrack_list = {\n\tname = ");
+			write_string(name);
+			write("\n\tnum_samples = ");
+			write_uint32(num_samples);
+			write("\n\tsample_rate = ");
+			write_float(sample_rate);
+			write("\n\tis_binary_exact = true\n}\n\n");
+
+			if (settings != nullptr)
+			{
+				write("settings = {\n\tlevel = ");
+				write_string(get_compression_level_name(settings->level));
+				write("\n\trotation_format = ");
+				write_string(get_rotation_format_name(settings->rotation_format));
+				write("\n\ttranslation_format = ");
+				write_string(get_vector_format_name(settings->translation_format));
+				write("\n\tscale_format = ");
+				write_string(get_vector_format_name(settings->scale_format));
+				write("\n}\n\n");
+			}
+
+			write("tracks = [\n");
+
+			m_state = state::tracks;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Begins a new scalar track.
+		void begin_track(const char* name, track_type8 track_type, const track_desc_scalarf& desc)
+		{
+			ACL_ASSERT(track_type != track_type8::qvvf, "Transform tracks require a transform description");
+
+			begin_track_impl(name, track_type);
+
+			write("\t\tprecision = ");
+			write_hex_float_string(desc.precision);
+			write("\n\t\toutput_index = ");
+			write_uint32(desc.output_index);
+
+			begin_data();
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Begins a new transform track.
+		void begin_track(const char* name, const track_desc_transformf& desc)
+		{
+			begin_track_impl(name, track_type8::qvvf);
+
+			write("\t\tprecision = ");
+			write_hex_float_string(desc.precision);
+			write("\n\t\toutput_index = ");
+			write_uint32(desc.output_index);
+			write("\n\t\tparent_index = ");
+			write_uint32(desc.parent_index);
+			write("\n\t\tshell_distance = ");
+			write_hex_float_string(desc.shell_distance);
+			write("\n\t\timportance = ");
+			write_hex_float_string(desc.importance);
+
+			write("\n\t\tbind_rotation = ");
+			write_hex_float_array(rtm::quat_get_x(desc.default_value.rotation), rtm::quat_get_y(desc.default_value.rotation), rtm::quat_get_z(desc.default_value.rotation), rtm::quat_get_w(desc.default_value.rotation));
+			write("\n\t\tbind_translation = ");
+			write_hex_float_array(rtm::vector_get_x(desc.default_value.translation), rtm::vector_get_y(desc.default_value.translation), rtm::vector_get_z(desc.default_value.translation));
+			write("\n\t\tbind_scale = ");
+			write_hex_float_array(rtm::vector_get_x(desc.default_value.scale), rtm::vector_get_y(desc.default_value.scale), rtm::vector_get_z(desc.default_value.scale));
+
+			begin_data();
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Writes the next samples of the current track.
+		// The sample type must match the type of the current track.
+		void write_samples(const float* samples, uint32_t num_samples)
+		{
+			ACL_ASSERT(m_track_type == track_type8::float1f, "Unexpected sample type");
+			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			{
+				begin_sample();
+				write_hex_float_array(samples[sample_index]);
+			}
+		}
+
+		void write_samples(const rtm::float2f* samples, uint32_t num_samples)
+		{
+			ACL_ASSERT(m_track_type == track_type8::float2f, "Unexpected sample type");
+			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			{
+				begin_sample();
+				write_hex_float_array(samples[sample_index].x, samples[sample_index].y);
+			}
+		}
+
+		void write_samples(const rtm::float3f* samples, uint32_t num_samples)
+		{
+			ACL_ASSERT(m_track_type == track_type8::float3f, "Unexpected sample type");
+			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			{
+				begin_sample();
+				write_hex_float_array(samples[sample_index].x, samples[sample_index].y, samples[sample_index].z);
+			}
+		}
+
+		void write_samples(const rtm::float4f* samples, uint32_t num_samples)
+		{
+			ACL_ASSERT(m_track_type == track_type8::float4f, "Unexpected sample type");
+			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			{
+				begin_sample();
+				write_hex_float_array(samples[sample_index].x, samples[sample_index].y, samples[sample_index].z, samples[sample_index].w);
+			}
+		}
+
+		void write_samples(const rtm::vector4f* samples, uint32_t num_samples)
+		{
+			ACL_ASSERT(m_track_type == track_type8::vector4f, "Unexpected sample type");
+			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			{
+				const rtm::vector4f& sample = samples[sample_index];
+
+				begin_sample();
+				write_hex_float_array(rtm::vector_get_x(sample), rtm::vector_get_y(sample), rtm::vector_get_z(sample), rtm::vector_get_w(sample));
+			}
+		}
+
+		void write_samples(const rtm::qvvf* samples, uint32_t num_samples)
+		{
+			ACL_ASSERT(m_track_type == track_type8::qvvf, "Unexpected sample type");
+			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			{
+				const rtm::qvvf& sample = samples[sample_index];
+
+				begin_sample();
+				write("[ ");
+				write_hex_float_array(rtm::quat_get_x(sample.rotation), rtm::quat_get_y(sample.rotation), rtm::quat_get_z(sample.rotation), rtm::quat_get_w(sample.rotation));
+				write(", ");
+				write_hex_float_array(rtm::vector_get_x(sample.translation), rtm::vector_get_y(sample.translation), rtm::vector_get_z(sample.translation));
+				write(", ");
+				write_hex_float_array(rtm::vector_get_x(sample.scale), rtm::vector_get_y(sample.scale), rtm::vector_get_z(sample.scale));
+				write(" ]");
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Ends the current track, every sample must have been written.
+		void end_track()
+		{
+			ACL_ASSERT(m_state == state::track, "No track started");
+
+			if (m_num_track_samples != m_num_samples)
+				m_error = error_result("Track sample count does not match the track list");
+
+			write(m_num_track_samples != 0 ? "\n\t\t]\n\t}" : "\t\t]\n\t}");
+
+			m_state = state::tracks;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Ends the track list and flushes the output.
+		// Returns an error if the output failed or if the tracks were malformed.
+		error_result end_track_list()
+		{
+			ACL_ASSERT(m_state == state::tracks, "Track list not started or a track is still open");
+
+			write(m_num_tracks != 0 ? "\n]\n" : "]\n");
+			flush();
+
+			m_state = state::done;
+			return m_error;
+		}
+
+	private:
+		track_list_stream_writer(const track_list_stream_writer&) = delete;
+		track_list_stream_writer& operator=(const track_list_stream_writer&) = delete;
+
+		// Output is emitted in chunks of this size
+		static constexpr size_t k_buffer_size = 16 * 1024;
+
+		// Longest single write we perform is a qvvf sample
+		static constexpr size_t k_max_write_size = 256;
+
+		enum class state
+		{
+			empty,
+			tracks,
+			track,
+			done,
+		};
+
+		std::FILE* m_file							= nullptr;
+		write_callback m_callback					= nullptr;
+		void* m_user_data							= nullptr;
+
+		error_result m_error;
+		state m_state								= state::empty;
+		track_type8 m_track_type					= track_type8::float1f;
+		uint32_t m_num_samples						= 0;
+		uint32_t m_num_tracks						= 0;
+		uint32_t m_num_track_samples				= 0;
+
+		size_t m_buffer_size						= 0;
+		char m_buffer[k_buffer_size];
+
+		void flush()
+		{
+			if (m_buffer_size == 0)
+				return;
+
+			if (m_file != nullptr)
+			{
+				if (std::fwrite(m_buffer, 1, m_buffer_size, m_file) != m_buffer_size)
+					m_error = error_result("Failed to write ACL file");
+			}
+			else if (m_callback != nullptr)
+				m_callback(m_buffer, m_buffer_size, m_user_data);
+
+			m_buffer_size = 0;
+		}
+
+		char* reserve(size_t size)
+		{
+			ACL_ASSERT(size <= k_buffer_size, "Write is too large");
+
+			if (m_buffer_size + size > k_buffer_size)
+				flush();
+
+			char* buffer = m_buffer + m_buffer_size;
+			m_buffer_size += size;
+			return buffer;
+		}
+
+		void write(const char* str, size_t size)
+		{
+			// Large strings (e.g. names) are written in pieces
+			while (size != 0)
+			{
+				const size_t chunk_size = size < k_buffer_size ? size : k_buffer_size;
+				std::memcpy(reserve(chunk_size), str, chunk_size);
+
+				str += chunk_size;
+				size -= chunk_size;
+			}
+		}
+
+		void write(const char* c_str) { write(c_str, std::strlen(c_str)); }
+
+		void write_string(const char* c_str)
+		{
+			write("\"", 1);
+			write(c_str != nullptr ? c_str : "");
+			write("\"", 1);
+		}
+
+		void write_uint32(uint32_t value)
+		{
+			char buffer[16];
+			const int length = snprintf(buffer, sizeof(buffer), "%u", value);
+			write(buffer, size_t(length));
+		}
+
+		void write_float(float value)
+		{
+			char buffer[32];
+			const int length = snprintf(buffer, sizeof(buffer), "%.9g", double(value));
+			write(buffer, size_t(length));
+		}
+
+		void write_hex_float_string(float value)
+		{
+			char* buffer = reserve(10);
+			buffer[0] = '"';
+			const size_t num_digits = acl_impl::write_hex_float(value, buffer + 1);
+			buffer[num_digits + 1] = '"';
+
+			// Return what we didn't use
+			m_buffer_size -= 8 - num_digits;
+		}
+
+		void write_hex_float_array(float x)
+		{
+			write("[ ", 2);
+			write_hex_float_string(x);
+			write(" ]", 2);
+		}
+
+		void write_hex_float_array(float x, float y)
+		{
+			write("[ ", 2);
+			write_hex_float_string(x);
+			write(", ", 2);
+			write_hex_float_string(y);
+			write(" ]", 2);
+		}
+
+		void write_hex_float_array(float x, float y, float z)
+		{
+			write("[ ", 2);
+			write_hex_float_string(x);
+			write(", ", 2);
+			write_hex_float_string(y);
+			write(", ", 2);
+			write_hex_float_string(z);
+			write(" ]", 2);
+		}
+
+		void write_hex_float_array(float x, float y, float z, float w)
+		{
+			write("[ ", 2);
+			write_hex_float_string(x);
+			write(", ", 2);
+			write_hex_float_string(y);
+			write(", ", 2);
+			write_hex_float_string(z);
+			write(", ", 2);
+			write_hex_float_string(w);
+			write(" ]", 2);
+		}
+
+		void begin_track_impl(const char* name, track_type8 track_type)
+		{
+			ACL_ASSERT(m_state == state::tracks, "Track list not started or a track is still open");
+
+			write(m_num_tracks != 0 ? ",\n\t{\n\t\tname = " : "\t{\n\t\tname = ");
+			write_string(name);
+			write("\n\t\ttype = ");
+			write_string(get_track_type_name(track_type));
+			write("\n");
+
+			m_track_type = track_type;
+			m_num_track_samples = 0;
+			m_num_tracks++;
+			m_state = state::track;
+		}
+
+		void begin_data()
+		{
+			write("\n\t\tdata = [\n");
+		}
+
+		void begin_sample()
+		{
+			ACL_ASSERT(m_state == state::track, "No track started");
+
+			write(m_num_track_samples != 0 ? ",\n\t\t\t" : "\t\t\t");
+			m_num_track_samples++;
+		}
+	};
+
 	ACL_IMPL_VERSION_NAMESPACE_END
 }
 
@@ -41,7 +41,10 @@ namespace acl
     enum class sjson_file_type;
     struct sjson_raw_clip;
     struct sjson_raw_track_list;
+    class iclip_reader_scheduler;
     class clip_reader;
+    class binary_clip_reader;
+    class track_list_stream_writer;
 
     ACL_IMPL_VERSION_NAMESPACE_END
 }
@@ -0,0 +1,135 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/track_traits.h"
+#include "acl/core/track_types.h"
+
+#include <cstdint>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		////////////////////////////////////////////////////////////////////////////////
+		// Binary raw clip format (.acl.bin)
+		//
+		// Memory layout:
+		//    binary_raw_clip_header
+		//    binary_raw_track_desc[num_tracks]
+		//    Strings (clip name, additive base name, track names), not NULL terminated
+		//    Track samples, each track starts on a 16 byte boundary
+		//    Additive base track samples (optional), each track starts on a 16 byte boundary
+		//
+		// Samples are stored uncompressed in their native 'track_traits<..>::sample_type'
+		// layout with a stride equal to the sample size. This allows the reader to reference
+		// them in place with 'track_typed<..>::make_ref(..)' straight from a memory mapped file.
+		// All values are in native endianness, a byte swapped tag identifies a foreign file.
+		////////////////////////////////////////////////////////////////////////////////
+
+		constexpr uint32_t k_binary_raw_clip_tag = 0xac11b100;
+		constexpr uint32_t k_binary_raw_clip_version = 1;
+
+		// Every sample array starts on this boundary so that SIMD types can be referenced in place
+		constexpr uint32_t k_binary_raw_clip_sample_alignment = 16;
+
+		struct binary_raw_clip_header
+		{
+			uint32_t		tag;							// k_binary_raw_clip_tag
+			uint32_t		version;						// k_binary_raw_clip_version
+			uint32_t		size;							// Total size in bytes of the file
+
+			uint32_t		num_tracks;
+			uint32_t		num_samples;
+			float			sample_rate;
+
+			uint32_t		additive_base_num_samples;		// Zero when there is no additive base
+			float			additive_base_sample_rate;
+
+			uint32_t		name_offset;					// Offsets are relative to the start of the header
+			uint32_t		name_size;
+			uint32_t		additive_base_name_offset;
+			uint32_t		additive_base_name_size;
+			uint32_t		track_descs_offset;				// Offset to binary_raw_track_desc[num_tracks]
+
+			track_type8		track_type;
+			uint8_t			looping_policy;					// sample_looping_policy
+			uint8_t			additive_format;				// additive_clip_format8
+			uint8_t			has_settings;					// Non-zero if the settings below are present
+
+			uint8_t			level;							// compression_level8
+			uint8_t			rotation_format;				// rotation_format8
+			uint8_t			translation_format;				// vector_format8
+			uint8_t			scale_format;					// vector_format8
+		};
+
+		static_assert(sizeof(binary_raw_clip_header) == 60, "Unexpected binary_raw_clip_header size");
+
+		struct binary_raw_track_desc
+		{
+			uint32_t		name_offset;
+			uint32_t		name_size;
+
+			uint32_t		samples_offset;					// Aligned to k_binary_raw_clip_sample_alignment
+			uint32_t		additive_base_samples_offset;	// Zero when there is no additive base
+
+			uint32_t		output_index;
+			uint32_t		parent_index;					// Transforms only
+			float			precision;
+			float			shell_distance;					// Transforms only
+
+			float			default_rotation[4];			// Transforms only
+			float			default_translation[3];			// Transforms only
+			float			default_scale[3];				// Transforms only
+		};
+
+		static_assert(sizeof(binary_raw_track_desc) == 72, "Unexpected binary_raw_track_desc size");
+
+		// Returns the size in bytes of a single sample as stored in a binary raw clip, zero if the type is unsupported
+		inline uint32_t get_binary_raw_sample_size(track_type8 track_type)
+		{
+			switch (track_type)
+			{
+			case track_type8::float1f:	return uint32_t(sizeof(track_traits<track_type8::float1f>::sample_type));
+			case track_type8::float2f:	return uint32_t(sizeof(track_traits<track_type8::float2f>::sample_type));
+			case track_type8::float3f:	return uint32_t(sizeof(track_traits<track_type8::float3f>::sample_type));
+			case track_type8::float4f:	return uint32_t(sizeof(track_traits<track_type8::float4f>::sample_type));
+			case track_type8::vector4f:	return uint32_t(sizeof(track_traits<track_type8::vector4f>::sample_type));
+			case track_type8::qvvf:		return uint32_t(sizeof(track_traits<track_type8::qvvf>::sample_type));
+			default:					return 0;
+			}
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
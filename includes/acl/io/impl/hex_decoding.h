@@ -0,0 +1,166 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#if defined(ACL_USE_SJSON)
+
+#include "acl/version.h"
+#include "acl/core/error.h"
+#include "acl/core/memory_utils.h"
+#include "acl/core/impl/compiler_utils.h"
+
+#include <rtm/math.h>
+
+#include <sjson/parser.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	namespace acl_impl
+	{
+		////////////////////////////////////////////////////////////////////////////////
+		// Binary exact SJSON files store every value as the hexadecimal representation of its bits
+		// without leading zeros. Parsing them one character at a time dominates the time spent
+		// reading raw clips. Instead, we right align the digits of several values in a block of
+		// 32 digits and convert the whole block at once into 16 bytes.
+		//
+		// Digits must be valid upper or lower case hexadecimal characters.
+		////////////////////////////////////////////////////////////////////////////////
+
+		// Converts 32 hexadecimal digits into 16 bytes, the first two digits make up the first byte
+		inline void decode_hex_digits(const char* digits, uint8_t* out_bytes)
+		{
+#if defined(RTM_SSE2_INTRINSICS)
+			// A digit's value is its low nibble, letters have bit 0x40 set and are offset by 9: 'A' (0x41) -> 1 + 9
+			const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+			const __m128i nine = _mm_set1_epi8(9);
+			const __m128i last_decimal_digit = _mm_set1_epi8('9');
+			const __m128i low_byte_mask = _mm_set1_epi16(0x00FF);
+
+			const __m128i digits0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits + 0));
+			const __m128i digits1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits + 16));
+
+			const __m128i nibbles0 = _mm_add_epi8(_mm_and_si128(digits0, nibble_mask), _mm_and_si128(_mm_cmpgt_epi8(digits0, last_decimal_digit), nine));
+			const __m128i nibbles1 = _mm_add_epi8(_mm_and_si128(digits1, nibble_mask), _mm_and_si128(_mm_cmpgt_epi8(digits1, last_decimal_digit), nine));
+
+			// Every 16 bit lane holds the high nibble in its low byte and the low nibble in its high byte
+			const __m128i bytes0 = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(nibbles0, low_byte_mask), 4), _mm_srli_epi16(nibbles0, 8));
+			const __m128i bytes1 = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(nibbles1, low_byte_mask), 4), _mm_srli_epi16(nibbles1, 8));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out_bytes), _mm_packus_epi16(bytes0, bytes1));
+#elif defined(RTM_NEON_INTRINSICS)
+			// De-interleave our digits, even digits are high nibbles and odd digits are low nibbles
+			const uint8x16x2_t digit_pairs = vld2q_u8(reinterpret_cast<const uint8_t*>(digits));
+
+			// A digit's value is its low nibble, letters have bit 0x40 set and are offset by 9: 'A' (0x41) -> 1 + 9
+			const uint8x16_t nibble_mask = vdupq_n_u8(0x0F);
+			const uint8x16_t nine = vdupq_n_u8(9);
+			const uint8x16_t last_decimal_digit = vdupq_n_u8('9');
+
+			const uint8x16_t high_nibbles = vaddq_u8(vandq_u8(digit_pairs.val[0], nibble_mask), vandq_u8(vcgtq_u8(digit_pairs.val[0], last_decimal_digit), nine));
+			const uint8x16_t low_nibbles = vaddq_u8(vandq_u8(digit_pairs.val[1], nibble_mask), vandq_u8(vcgtq_u8(digit_pairs.val[1], last_decimal_digit), nine));
+
+			vst1q_u8(out_bytes, vorrq_u8(vshlq_n_u8(high_nibbles, 4), low_nibbles));
+#else
+			for (uint32_t byte_index = 0; byte_index < 16; ++byte_index)
+			{
+				const uint8_t high_digit = uint8_t(digits[byte_index * 2 + 0]);
+				const uint8_t low_digit = uint8_t(digits[byte_index * 2 + 1]);
+
+				const uint8_t high_nibble = uint8_t((high_digit & 0x0F) + (high_digit > '9' ? 9 : 0));
+				const uint8_t low_nibble = uint8_t((low_digit & 0x0F) + (low_digit > '9' ? 9 : 0));
+
+				out_bytes[byte_index] = uint8_t((high_nibble << 4) | low_nibble);
+			}
+#endif
+		}
+
+		// Copies the digits of our value right aligned within 'num_block_digits', the leading digits must already be '0'
+		inline void align_hex_digits(const sjson::StringView& value, uint32_t num_block_digits, char* out_digits)
+		{
+			ACL_ASSERT(value.size() <= num_block_digits, "Too many hexadecimal digits: %u", uint32_t(value.size()));
+
+			const size_t num_digits = std::min<size_t>(value.size(), num_block_digits);
+			std::memcpy(out_digits + (num_block_digits - num_digits), value.c_str() + (value.size() - num_digits), num_digits);
+		}
+
+		// Converts the hexadecimal strings of up to 8 digits into their 32 bit values, 4 at a time
+		inline void hex_to_u32(const sjson::StringView* values, uint32_t num_values, uint32_t* out_values)
+		{
+			for (uint32_t value_index = 0; value_index < num_values; value_index += 4)
+			{
+				const uint32_t num_block_values = std::min<uint32_t>(num_values - value_index, 4);
+
+				char digits[32];
+				std::memset(digits, '0', sizeof(digits));
+
+				for (uint32_t block_value_index = 0; block_value_index < num_block_values; ++block_value_index)
+					align_hex_digits(values[value_index + block_value_index], 8, digits + (block_value_index * 8));
+
+				uint8_t bytes[16];
+				decode_hex_digits(digits, bytes);
+
+				// Our bytes are in big-endian order
+				for (uint32_t block_value_index = 0; block_value_index < num_block_values; ++block_value_index)
+					out_values[value_index + block_value_index] = byte_swap(unaligned_load<uint32_t>(bytes + (block_value_index * 4)));
+			}
+		}
+
+		// Converts the hexadecimal strings of up to 16 digits into their 64 bit values, 2 at a time
+		inline void hex_to_u64(const sjson::StringView* values, uint32_t num_values, uint64_t* out_values)
+		{
+			for (uint32_t value_index = 0; value_index < num_values; value_index += 2)
+			{
+				const uint32_t num_block_values = std::min<uint32_t>(num_values - value_index, 2);
+
+				char digits[32];
+				std::memset(digits, '0', sizeof(digits));
+
+				for (uint32_t block_value_index = 0; block_value_index < num_block_values; ++block_value_index)
+					align_hex_digits(values[value_index + block_value_index], 16, digits + (block_value_index * 16));
+
+				uint8_t bytes[16];
+				decode_hex_digits(digits, bytes);
+
+				// Our bytes are in big-endian order
+				for (uint32_t block_value_index = 0; block_value_index < num_block_values; ++block_value_index)
+					out_values[value_index + block_value_index] = byte_swap(unaligned_load<uint64_t>(bytes + (block_value_index * 8)));
+			}
+		}
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
+
+#endif	// #if defined(ACL_USE_SJSON)
@@ -0,0 +1,228 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/version.h"
+#include "acl/core/impl/compiler_utils.h"
+#include "acl/core/error.h"
+
+#include <rtm/quatf.h>
+#include <rtm/qvvf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+#include <cstring>
+
+// F16C comes with every AVX2 capable CPU, MSVC doesn't define __F16C__
+#if defined(RTM_AVX_INTRINSICS) && (defined(__F16C__) || defined(__AVX2__))
+	#define ACL_IMPL_USE_F16C
+#endif
+
+ACL_IMPL_FILE_PRAGMA_PUSH
+
+namespace acl
+{
+	ACL_IMPL_VERSION_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Pose packing
+	//
+	// Decompressed poses are often consumed by a later stage (e.g. skinning) and
+	// copying them around at 48 bytes per transform costs memory bandwidth.
+	// A transform packed with 16 bits per component only takes 20 bytes:
+	//    - Rotations are stored with 4 signed normalized 16 bit components
+	//    - Translations and scales are stored as 3 half floats
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts a float into a half float, rounding to nearest even.
+	// Values too large are converted into infinity and NaN is retained.
+	inline uint16_t float_to_half(float value)
+	{
+		uint32_t value_u32;
+		std::memcpy(&value_u32, &value, sizeof(float));
+
+		const uint32_t sign = (value_u32 >> 16) & 0x8000U;
+		value_u32 &= 0x7FFFFFFFU;
+
+		if (value_u32 >= 0x47800000U)
+			return static_cast<uint16_t>(sign | (value_u32 > 0x7F800000U ? 0x7E00U : 0x7C00U));	// Overflow to infinity or NaN
+
+		if (value_u32 < 0x38800000U)
+		{
+			// Denormal or zero, let the FPU round by adding 0.5 which shifts the mantissa in place
+			float abs_value;
+			std::memcpy(&abs_value, &value_u32, sizeof(float));
+			abs_value += 0.5F;
+
+			uint32_t abs_value_u32;
+			std::memcpy(&abs_value_u32, &abs_value, sizeof(float));
+			return static_cast<uint16_t>(sign | (abs_value_u32 - 0x3F000000U));
+		}
+
+		// Normal value, rebias the exponent and round the mantissa to nearest even
+		const uint32_t is_mantissa_odd = (value_u32 >> 13) & 1;
+		value_u32 += 0xC8000FFFU + is_mantissa_odd;
+		return static_cast<uint16_t>(sign | (value_u32 >> 13));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts a half float into a float, the conversion is exact.
+	inline float half_to_float(uint16_t value)
+	{
+		const uint32_t shifted_exponent_mask = 0x7C00U << 13;
+
+		uint32_t result_u32 = (uint32_t(value) & 0x7FFFU) << 13;
+		const uint32_t exponent = result_u32 & shifted_exponent_mask;
+		result_u32 += (127 - 15) << 23;		// Rebias the exponent
+
+		if (exponent == shifted_exponent_mask)
+			result_u32 += (128 - 16) << 23;		// Infinity or NaN
+		else if (exponent == 0)
+		{
+			// Denormal, renormalize with the FPU
+			result_u32 += 1 << 23;
+
+			float denormal;
+			std::memcpy(&denormal, &result_u32, sizeof(float));
+			denormal -= 6.10351562e-05F;	// 2^-14
+			std::memcpy(&result_u32, &denormal, sizeof(float));
+		}
+
+		result_u32 |= (uint32_t(value) & 0x8000U) << 16;
+
+		float result;
+		std::memcpy(&result, &result_u32, sizeof(float));
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs the XYZ components of a vector into 3 half floats.
+	inline void RTM_SIMD_CALL pack_vector3_half(rtm::vector4f_arg0 vector, uint16_t* out_vector_data)
+	{
+#if defined(ACL_IMPL_USE_F16C)
+		const __m128i packed = _mm_cvtps_ph(vector, _MM_FROUND_TO_NEAREST_INT);
+		const uint32_t xy = static_cast<uint32_t>(_mm_cvtsi128_si32(packed));
+		out_vector_data[0] = static_cast<uint16_t>(xy);
+		out_vector_data[1] = static_cast<uint16_t>(xy >> 16);
+		out_vector_data[2] = static_cast<uint16_t>(_mm_extract_epi16(packed, 2));
+#else
+		out_vector_data[0] = float_to_half(rtm::vector_get_x(vector));
+		out_vector_data[1] = float_to_half(rtm::vector_get_y(vector));
+		out_vector_data[2] = float_to_half(rtm::vector_get_z(vector));
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks 3 half floats into the XYZ components of a vector, W is zero.
+	inline rtm::vector4f RTM_SIMD_CALL unpack_vector3_half(const uint16_t* vector_data)
+	{
+#if defined(ACL_IMPL_USE_F16C)
+		const __m128i packed = _mm_set_epi16(0, 0, 0, 0, 0, static_cast<short>(vector_data[2]), static_cast<short>(vector_data[1]), static_cast<short>(vector_data[0]));
+		return _mm_cvtph_ps(packed);
+#else
+		return rtm::vector_set(half_to_float(vector_data[0]), half_to_float(vector_data[1]), half_to_float(vector_data[2]), 0.0F);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs a normalized rotation into 4 signed normalized 16 bit components.
+	inline void RTM_SIMD_CALL pack_quat_snorm16(rtm::quatf_arg0 rotation, int16_t* out_rotation_data)
+	{
+		ACL_ASSERT(rtm::quat_is_normalized(rotation), "Rotation is not normalized");
+
+		const rtm::vector4f packed = rtm::vector_round_symmetric(rtm::vector_mul(rtm::quat_to_vector(rotation), 32767.0F));
+
+#if defined(RTM_SSE2_INTRINSICS)
+		// Saturate to 16 bits and store XYZW at once
+		const __m128i packed_i32 = _mm_cvttps_epi32(packed);
+		const __m128i packed_i16 = _mm_packs_epi32(packed_i32, packed_i32);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(out_rotation_data), packed_i16);
+#elif defined(RTM_NEON_INTRINSICS)
+		const int16x4_t packed_i16 = vqmovn_s32(vcvtq_s32_f32(packed));
+		vst1_s16(out_rotation_data, packed_i16);
+#else
+		out_rotation_data[0] = static_cast<int16_t>(rtm::vector_get_x(packed));
+		out_rotation_data[1] = static_cast<int16_t>(rtm::vector_get_y(packed));
+		out_rotation_data[2] = static_cast<int16_t>(rtm::vector_get_z(packed));
+		out_rotation_data[3] = static_cast<int16_t>(rtm::vector_get_w(packed));
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks 4 signed normalized 16 bit components into a normalized rotation.
+	inline rtm::quatf RTM_SIMD_CALL unpack_quat_snorm16(const int16_t* rotation_data)
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		const __m128i packed_i16 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(rotation_data));
+
+		// Sign extend our 16 bit values by moving them into the upper half and shifting back down
+		const __m128i packed_i32 = _mm_srai_epi32(_mm_unpacklo_epi16(packed_i16, packed_i16), 16);
+		const rtm::vector4f packed = _mm_cvtepi32_ps(packed_i32);
+#elif defined(RTM_NEON_INTRINSICS)
+		const int32x4_t packed_i32 = vmovl_s16(vld1_s16(rotation_data));
+		const rtm::vector4f packed = vcvtq_f32_s32(packed_i32);
+#else
+		const rtm::vector4f packed = rtm::vector_set(float(rotation_data[0]), float(rotation_data[1]), float(rotation_data[2]), float(rotation_data[3]));
+#endif
+
+		// Quantization leaves a small error on the norm, normalize to avoid skewing our transforms
+		return rtm::quat_normalize(rtm::vector_to_quat(rtm::vector_mul(packed, 1.0F / 32767.0F)));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// A transform packed with 16 bits per component, see above.
+	struct packed_qvvf16
+	{
+		int16_t rotation[4];
+		uint16_t translation[3];
+		uint16_t scale[3];
+	};
+
+	static_assert(sizeof(packed_qvvf16) == 20, "Unexpected packed_qvvf16 size");
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs a transform with 16 bits per component.
+	inline void RTM_SIMD_CALL pack_qvvf16(rtm::qvvf_arg0 transform, packed_qvvf16& out_transform)
+	{
+		pack_quat_snorm16(transform.rotation, &out_transform.rotation[0]);
+		pack_vector3_half(transform.translation, &out_transform.translation[0]);
+		pack_vector3_half(transform.scale, &out_transform.scale[0]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks a transform packed with 16 bits per component.
+	inline rtm::qvvf RTM_SIMD_CALL unpack_qvvf16(const packed_qvvf16& transform)
+	{
+		const rtm::quatf rotation = unpack_quat_snorm16(&transform.rotation[0]);
+		const rtm::vector4f translation = unpack_vector3_half(&transform.translation[0]);
+		const rtm::vector4f scale = unpack_vector3_half(&transform.scale[0]);
+		return rtm::qvv_set(rotation, translation, scale);
+	}
+
+	ACL_IMPL_VERSION_NAMESPACE_END
+}
+
+ACL_IMPL_FILE_PRAGMA_POP
@@ -92,6 +92,44 @@ namespace acl
 		return rtm::quat_from_positive_w(rotation_xyz);
 	}
 
+	// Packs the rotations one after another in big-endian order with 'num_bits' per component, starting at 'bit_offset'
+	// The W component is dropped and reconstructed when unpacking, see pack_vector3_sXX_array(..)
+	inline void pack_quat_sXX_array(const rtm::quatf* rotations, uint32_t num_rotations, uint32_t num_bits, uint8_t* out_rotation_data, uint32_t bit_offset)
+	{
+		ACL_ASSERT(num_bits < 31, "Attempting to pack on too many bits");
+
+		const rtm::vector4f half = rtm::vector_set(0.5F);
+		const rtm::vector4f max_value = rtm::vector_set(rtm::scalar_safe_to_float((1 << num_bits) - 1));
+		acl_impl::packed_bit_writer writer(out_rotation_data, bit_offset);
+
+		for (uint32_t rotation_index = 0; rotation_index < num_rotations; ++rotation_index)
+		{
+			const rtm::vector4f rotation_xyz = rtm::quat_to_vector(rtm::quat_ensure_positive_w(rotations[rotation_index]));
+
+			uint32_t values[3];
+			acl_impl::quantize_vector3_unsigned(rtm::vector_mul_add(rotation_xyz, half, half), max_value, values);
+
+			writer.write(values[0], num_bits);
+			writer.write(values[1], num_bits);
+			writer.write(values[2], num_bits);
+		}
+
+		writer.flush();
+	}
+
+	// Unpacks rotations packed one after another with pack_quat_sXX_array(..)
+	// Assumes the 'rotation_data' is in big-endian order and padded in order to load up to 16 bytes past the last rotation
+	inline void unpack_quat_sXX_array_unsafe(uint32_t num_bits, const uint8_t* rotation_data, uint32_t bit_offset, uint32_t num_rotations, rtm::quatf* out_rotations)
+	{
+		const uint32_t num_bits_per_rotation = num_bits * 3;
+
+		for (uint32_t rotation_index = 0; rotation_index < num_rotations; ++rotation_index, bit_offset += num_bits_per_rotation)
+		{
+			const rtm::vector4f rotation_xyz = unpack_vector3_sXX_unsafe(num_bits, rotation_data, bit_offset);
+			out_rotations[rotation_index] = rtm::quat_from_positive_w(rotation_xyz);
+		}
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 
 	constexpr uint32_t get_packed_rotation_size(rotation_format8 format)
@@ -104,6 +142,18 @@ namespace acl
 		return format == rotation_format8::quatf_full ? (sizeof(float) * 8) : (sizeof(float) * 6);
 	}
 
+	// Rotation clip ranges can be quantized with 16 bits per component. The minimum maps [0, 65535] onto [-1.0, 1.0]
+	// and the extent maps it onto [0.0, 2.0]. Compression and decompression both reconstruct the range with these.
+	inline rtm::vector4f RTM_SIMD_CALL dequantize_rotation_clip_range_min(rtm::vector4f_arg0 quantized_min)
+	{
+		return rtm::vector_mul_add(quantized_min, rtm::vector_set(2.0F / 65535.0F), rtm::vector_set(-1.0F));
+	}
+
+	inline rtm::vector4f RTM_SIMD_CALL dequantize_rotation_clip_range_extent(rtm::vector4f_arg0 quantized_extent)
+	{
+		return rtm::vector_mul(quantized_extent, 2.0F / 65535.0F);
+	}
+
 	ACL_IMPL_VERSION_NAMESPACE_END
 }
 
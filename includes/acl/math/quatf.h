@@ -26,8 +26,12 @@
 
 #include "acl/version.h"
 #include "acl/core/impl/compiler_utils.h"
+#include "acl/core/impl/variable_bit_rates.h"
 
+#include <rtm/mask4f.h>
 #include <rtm/quatf.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
 
 #include <cstdint>
 
@@ -209,6 +213,160 @@ namespace acl
 			zzzz = rtm::vector_mul(zzzz, inv_len4);
 			wwww = rtm::vector_mul(wwww, inv_len4);
 		}
+
+		// Same as quat_normalize4(..) but uses a reciprocal square root estimate refined with one Newton-Raphson step
+		// The resulting length is within 1.0e-6 of 1.0 with SSE/AVX and within 5.0e-5 of 1.0 with NEON
+		// Force inline this function, we only use it to keep the code readable
+		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void RTM_SIMD_CALL quat_normalize_approx4(rtm::vector4f& xxxx, rtm::vector4f& yyyy, rtm::vector4f& zzzz, rtm::vector4f& wwww)
+		{
+			const rtm::vector4f dot4 = rtm::vector_mul_add(wwww, wwww, rtm::vector_mul_add(zzzz, zzzz, rtm::vector_mul_add(yyyy, yyyy, rtm::vector_mul(xxxx, xxxx))));
+
+#if defined(RTM_SSE2_INTRINSICS)
+			// The estimate has a relative error of at most 1.5 * 2^-12, one step brings it down to about 2^-22
+			// inv_len = estimate * (1.5 - 0.5 * dot * estimate * estimate)
+			const __m128 estimate = _mm_rsqrt_ps(dot4);
+			const __m128 half_dot = _mm_mul_ps(dot4, _mm_set_ps1(0.5F));
+			const __m128 estimate_squared = _mm_mul_ps(estimate, estimate);
+			const rtm::vector4f inv_len4 = _mm_mul_ps(estimate, _mm_sub_ps(_mm_set_ps1(1.5F), _mm_mul_ps(half_dot, estimate_squared)));
+#elif defined(RTM_NEON_INTRINSICS)
+			// The estimate has a relative error of at most 2^-8, one step brings it down to about 2^-15
+			// vrsqrtsq_f32(a, b) computes (3.0 - a * b) / 2.0
+			const float32x4_t estimate = vrsqrteq_f32(dot4);
+			const rtm::vector4f inv_len4 = vmulq_f32(estimate, vrsqrtsq_f32(vmulq_f32(dot4, estimate), estimate));
+#else
+			const rtm::vector4f len4 = rtm::vector_sqrt(dot4);
+			const rtm::vector4f inv_len4 = rtm::vector_div(rtm::vector_set(1.0F), len4);
+#endif
+
+			xxxx = rtm::vector_mul(xxxx, inv_len4);
+			yyyy = rtm::vector_mul(yyyy, inv_len4);
+			zzzz = rtm::vector_mul(zzzz, inv_len4);
+			wwww = rtm::vector_mul(wwww, inv_len4);
+		}
+
+		// Rotations that drop their largest component store the remaining three in order followed by the
+		// dropped component in the W slot. The dropped component is: 0 = W, 1 = X, 2 = Y, 3 = Z.
+		// Restores the original component order once the W slot has been reconstructed.
+		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK rtm::quatf RTM_SIMD_CALL quat_unswizzle_dropped_component(rtm::quatf_arg0 rotation, uint32_t dropped_component)
+		{
+			const rtm::vector4f rotation_v = rtm::quat_to_vector(rotation);
+
+			switch (dropped_component)
+			{
+			default:
+			case 0:
+				return rotation;
+			case 1:
+				return rtm::vector_to_quat(rtm::vector_mix<rtm::mix4::w, rtm::mix4::x, rtm::mix4::y, rtm::mix4::z>(rotation_v, rotation_v));
+			case 2:
+				return rtm::vector_to_quat(rtm::vector_mix<rtm::mix4::x, rtm::mix4::w, rtm::mix4::y, rtm::mix4::z>(rotation_v, rotation_v));
+			case 3:
+				return rtm::vector_to_quat(rtm::vector_mix<rtm::mix4::x, rtm::mix4::y, rtm::mix4::w, rtm::mix4::z>(rotation_v, rotation_v));
+			}
+		}
+
+		// Same as quat_unswizzle_dropped_component(..) but for 4 rotations in SOA form
+		// The dropped components are read from the per sub-track metadata of the group
+		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void RTM_SIMD_CALL quat_unswizzle_dropped_component4(const uint8_t* format_per_track_data,
+			rtm::vector4f& xxxx, rtm::vector4f& yyyy, rtm::vector4f& zzzz, rtm::vector4f& wwww)
+		{
+			const uint32_t component0 = format_per_track_data[0] >> k_dropped_component_metadata_shift;
+			const uint32_t component1 = format_per_track_data[1] >> k_dropped_component_metadata_shift;
+			const uint32_t component2 = format_per_track_data[2] >> k_dropped_component_metadata_shift;
+			const uint32_t component3 = format_per_track_data[3] >> k_dropped_component_metadata_shift;
+
+			// Most groups only drop W, nothing to do
+			if ((component0 | component1 | component2 | component3) == 0)
+				return;
+
+			const rtm::mask4f is_x = rtm::mask_set(component0 == 1, component1 == 1, component2 == 1, component3 == 1);
+			const rtm::mask4f is_y = rtm::mask_set(component0 == 2, component1 == 2, component2 == 2, component3 == 2);
+			const rtm::mask4f is_z = rtm::mask_set(component0 == 3, component1 == 3, component2 == 3, component3 == 3);
+			const rtm::mask4f is_x_or_y = rtm::mask_set(component0 == 1 || component0 == 2, component1 == 1 || component1 == 2, component2 == 1 || component2 == 2, component3 == 1 || component3 == 2);
+			const rtm::mask4f is_not_w = rtm::mask_set(component0 != 0, component1 != 0, component2 != 0, component3 != 0);
+
+			// Stored as [a, b, c, dropped]
+			// X dropped: [dropped, a, b, c]
+			// Y dropped: [a, dropped, b, c]
+			// Z dropped: [a, b, dropped, c]
+			const rtm::vector4f out_xxxx = rtm::vector_select(is_x, wwww, xxxx);
+			const rtm::vector4f out_yyyy = rtm::vector_select(is_x, xxxx, rtm::vector_select(is_y, wwww, yyyy));
+			const rtm::vector4f out_zzzz = rtm::vector_select(is_z, wwww, rtm::vector_select(is_x_or_y, yyyy, zzzz));
+			const rtm::vector4f out_wwww = rtm::vector_select(is_not_w, zzzz, wwww);
+
+			xxxx = out_xxxx;
+			yyyy = out_yyyy;
+			zzzz = out_zzzz;
+			wwww = out_wwww;
+		}
+
+		// Calculates sin(angle) / angle and cos(angle) from the squared angle, the angle must be within [0, PI/2]
+		// Both functions are even and their Taylor series only use the squared angle: we need no square-root,
+		// no division, and zero needs no special care. The error is below 1.0E-7 over the whole range.
+		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK void RTM_SIMD_CALL sinc_cos_from_squared_angle4(rtm::vector4f_arg0 angle_sq, rtm::vector4f& out_sinc, rtm::vector4f& out_cos)
+		{
+			// sin(t) / t = 1 - t^2/3! + t^4/5! - t^6/7! + t^8/9! - t^10/11!
+			rtm::vector4f sinc = rtm::vector_mul_add(angle_sq, rtm::vector_set(-2.50521084e-8F), rtm::vector_set(2.75573192e-6F));
+			sinc = rtm::vector_mul_add(sinc, angle_sq, rtm::vector_set(-1.98412698e-4F));
+			sinc = rtm::vector_mul_add(sinc, angle_sq, rtm::vector_set(8.33333333e-3F));
+			sinc = rtm::vector_mul_add(sinc, angle_sq, rtm::vector_set(-1.66666667e-1F));
+			out_sinc = rtm::vector_mul_add(sinc, angle_sq, rtm::vector_set(1.0F));
+
+			// cos(t) = 1 - t^2/2! + t^4/4! - t^6/6! + t^8/8! - t^10/10! + t^12/12!
+			rtm::vector4f cos_angle = rtm::vector_mul_add(angle_sq, rtm::vector_set(2.08767570e-9F), rtm::vector_set(-2.75573192e-7F));
+			cos_angle = rtm::vector_mul_add(cos_angle, angle_sq, rtm::vector_set(2.48015873e-5F));
+			cos_angle = rtm::vector_mul_add(cos_angle, angle_sq, rtm::vector_set(-1.38888889e-3F));
+			cos_angle = rtm::vector_mul_add(cos_angle, angle_sq, rtm::vector_set(4.16666667e-2F));
+			cos_angle = rtm::vector_mul_add(cos_angle, angle_sq, rtm::vector_set(-0.5F));
+			out_cos = rtm::vector_mul_add(cos_angle, angle_sq, rtm::vector_set(1.0F));
+		}
+
+		// Returns the logarithm of a rotation: its rotation axis scaled by half its rotation angle
+		// The rotation is made to have a positive W component first, the half angle is then within [0, PI/2]
+		// The W component of the result is zero
+		inline rtm::vector4f RTM_SIMD_CALL quat_to_log(rtm::quatf_arg0 rotation)
+		{
+			const rtm::quatf positive_rotation = rtm::quat_ensure_positive_w(rotation);
+			const rtm::vector4f axis_sin_half_angle = rtm::vector_mix<rtm::mix4::x, rtm::mix4::y, rtm::mix4::z, rtm::mix4::d>(rtm::quat_to_vector(positive_rotation), rtm::vector_zero());
+
+			const float sin_half_angle = rtm::scalar_sqrt(rtm::vector_length_squared3(axis_sin_half_angle));
+			if (sin_half_angle < 1.0E-8F)
+				return axis_sin_half_angle;	// Near the identity, angle / sin(angle) is 1.0
+
+			const float half_angle = rtm::scalar_atan2(sin_half_angle, rtm::quat_get_w(positive_rotation));
+			return rtm::vector_mul(axis_sin_half_angle, half_angle / sin_half_angle);
+		}
+
+		// Reconstructs a rotation from its logarithm, see quat_to_log(..)
+		// The result has a positive W component
+		inline rtm::quatf RTM_SIMD_CALL quat_from_log(rtm::vector4f_arg0 log_rotation)
+		{
+			const float half_angle_sq = rtm::vector_length_squared3(log_rotation);
+
+			rtm::vector4f sinc;
+			rtm::vector4f cos_angle;
+			sinc_cos_from_squared_angle4(rtm::vector_set(half_angle_sq), sinc, cos_angle);
+
+			const rtm::vector4f axis_sin_half_angle = rtm::vector_mul(log_rotation, sinc);
+			return rtm::vector_to_quat(rtm::vector_mix<rtm::mix4::x, rtm::mix4::y, rtm::mix4::z, rtm::mix4::d>(axis_sin_half_angle, cos_angle));
+		}
+
+		// Same as quat_from_log(..) but for 4 rotations in SOA form
+		// The XYZ components are updated in place and the W component is returned
+		// Force inline this function, we only use it to keep the code readable
+		RTM_FORCE_INLINE RTM_DISABLE_SECURITY_COOKIE_CHECK rtm::vector4f RTM_SIMD_CALL quat_from_log4(rtm::vector4f& xxxx, rtm::vector4f& yyyy, rtm::vector4f& zzzz)
+		{
+			const rtm::vector4f half_angle_sq = rtm::vector_mul_add(zzzz, zzzz, rtm::vector_mul_add(yyyy, yyyy, rtm::vector_mul(xxxx, xxxx)));
+
+			rtm::vector4f sinc;
+			rtm::vector4f cos_angle;
+			sinc_cos_from_squared_angle4(half_angle_sq, sinc, cos_angle);
+
+			xxxx = rtm::vector_mul(xxxx, sinc);
+			yyyy = rtm::vector_mul(yyyy, sinc);
+			zzzz = rtm::vector_mul(zzzz, sinc);
+			return cos_angle;
+		}
 	}
 
 	ACL_IMPL_VERSION_NAMESPACE_END
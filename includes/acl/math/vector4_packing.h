@@ -28,6 +28,7 @@
 #include "acl/core/impl/compiler_utils.h"
 #include "acl/core/error.h"
 #include "acl/core/memory_utils.h"
+#include "acl/core/range_reduction_types.h"
 #include "acl/core/track_formats.h"
 #include "acl/core/track_types.h"
 #include "acl/math/scalar_packing.h"
@@ -285,70 +286,69 @@ namespace acl
 		};
 
 #if defined(RTM_SSE2_INTRINSICS)
-		const uint32_t bit_shift = 32 - num_bits;
 		const __m128i mask = _mm_castps_si128(_mm_load_ps1((const float*)&k_packed_constants[num_bits].mask));
 		const __m128 inv_max_value = _mm_load_ps1(&k_packed_constants[num_bits].max_value);
 
+		// With at most 23 bits per component and a 7 bit offset, two components always fit within a single 64 bit load
 		uint32_t byte_offset = bit_offset / 8;
-		uint32_t vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t x32 = (vector_u32 >> (bit_shift - (bit_offset % 8)));
-
-		bit_offset += num_bits;
-
-		byte_offset = bit_offset / 8;
-		vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t y32 = (vector_u32 >> (bit_shift - (bit_offset % 8)));
+		const uint64_t xy_u64 = byte_swap(unaligned_load<uint64_t>(vector_data + byte_offset)) << (bit_offset % 8);
+		const uint32_t x32 = uint32_t(xy_u64 >> (64 - num_bits));
+		const uint32_t y32 = uint32_t(xy_u64 >> (64 - num_bits * 2));
 
-		bit_offset += num_bits;
+		bit_offset += num_bits * 2;
 
 		byte_offset = bit_offset / 8;
-		vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t z32 = (vector_u32 >> (bit_shift - (bit_offset % 8)));
-
-		bit_offset += num_bits;
-
-		byte_offset = bit_offset / 8;
-		vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t w32 = (vector_u32 >> (bit_shift - (bit_offset % 8)));
+		const uint64_t zw_u64 = byte_swap(unaligned_load<uint64_t>(vector_data + byte_offset)) << (bit_offset % 8);
+		const uint32_t z32 = uint32_t(zw_u64 >> (64 - num_bits));
+		const uint32_t w32 = uint32_t(zw_u64 >> (64 - num_bits * 2));
 
 		__m128i int_value = _mm_set_epi32(w32, z32, y32, x32);
 		int_value = _mm_and_si128(int_value, mask);
 		const __m128 value = _mm_cvtepi32_ps(int_value);
 		return _mm_mul_ps(value, inv_max_value);
-#elif defined(RTM_NEON_INTRINSICS)
+#elif defined(RTM_NEON64_INTRINSICS)
+		// With 23 bits per component at most, our 4 components span at most 99 bits (including the initial bit offset)
+		// We load 16 bytes once and use a table lookup to gather the 4 big-endian bytes of every component
+		// in their own lane. Each lane is then shifted by its own amount to align the value.
 		const uint32_t bit_shift = 32 - num_bits;
-		uint32x4_t mask = vdupq_n_u32(k_packed_constants[num_bits].mask);
-		float inv_max_value = k_packed_constants[num_bits].max_value;
+		const uint32x4_t mask = vdupq_n_u32(k_packed_constants[num_bits].mask);
+		const float inv_max_value = k_packed_constants[num_bits].max_value;
 
-		uint32_t byte_offset = bit_offset / 8;
-		uint32_t vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t x32 = (vector_u32 >> (bit_shift - (bit_offset % 8)));
+		alignas(16) static constexpr uint32_t k_component_indices[4] = { 0, 1, 2, 3 };
 
-		bit_offset += num_bits;
+		const uint32_t byte_offset = bit_offset / 8;
+		const uint8x16_t vector_u8 = vld1q_u8(vector_data + byte_offset);
 
-		byte_offset = bit_offset / 8;
-		vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t y32 = (vector_u32 >> (bit_shift - (bit_offset % 8)));
+		// Bit offset of each component relative to the first byte we loaded: (bit_offset % 8) + { 0, 1, 2, 3 } * num_bits
+		const uint32x4_t component_bit_offsets = vmlaq_n_u32(vdupq_n_u32(bit_offset % 8), vld1q_u32(&k_component_indices[0]), num_bits);
+		const uint32x4_t component_byte_offsets = vshrq_n_u32(component_bit_offsets, 3);
 
-		bit_offset += num_bits;
+		// Our data is big-endian, the first byte goes in the most significant byte of each lane
+		const uint32x4_t byte_indices = vmlaq_n_u32(vdupq_n_u32(0x00010203), component_byte_offsets, 0x01010101);
+		const uint32x4_t components_u32 = vreinterpretq_u32_u8(vqtbl1q_u8(vector_u8, vreinterpretq_u8_u32(byte_indices)));
 
-		byte_offset = bit_offset / 8;
-		vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t z32 = (vector_u32 >> (bit_shift - (bit_offset % 8)));
+		// Shift right each lane: negative shift values shift to the right
+		const int32x4_t component_shifts = vsubq_s32(vreinterpretq_s32_u32(vandq_u32(component_bit_offsets, vdupq_n_u32(7))), vdupq_n_s32(int32_t(bit_shift)));
+		const uint32x4_t value_u32 = vandq_u32(vshlq_u32(components_u32, component_shifts), mask);
 
-		bit_offset += num_bits;
+		const float32x4_t value_f32 = vcvtq_f32_u32(value_u32);
+		return vmulq_n_f32(value_f32, inv_max_value);
+#elif defined(RTM_NEON_INTRINSICS)
+		uint32x4_t mask = vdupq_n_u32(k_packed_constants[num_bits].mask);
+		float inv_max_value = k_packed_constants[num_bits].max_value;
+
+		// With at most 23 bits per component and a 7 bit offset, two components always fit within a single 64 bit load
+		uint32_t byte_offset = bit_offset / 8;
+		const uint64_t xy_u64 = byte_swap(unaligned_load<uint64_t>(vector_data + byte_offset)) << (bit_offset % 8);
+		const uint32_t x32 = uint32_t(xy_u64 >> (64 - num_bits));
+		const uint32_t y32 = uint32_t(xy_u64 >> (64 - num_bits * 2));
+
+		bit_offset += num_bits * 2;
 
 		byte_offset = bit_offset / 8;
-		vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t w32 = (vector_u32 >> (bit_shift - (bit_offset % 8)));
+		const uint64_t zw_u64 = byte_swap(unaligned_load<uint64_t>(vector_data + byte_offset)) << (bit_offset % 8);
+		const uint32_t z32 = uint32_t(zw_u64 >> (64 - num_bits));
+		const uint32_t w32 = uint32_t(zw_u64 >> (64 - num_bits * 2));
 
 		uint32x2_t xy = vcreate_u32(uint64_t(x32) | (uint64_t(y32) << 32));
 		uint32x2_t zw = vcreate_u32(uint64_t(z32) | (uint64_t(w32) << 32));
@@ -357,35 +357,21 @@ namespace acl
 		float32x4_t value_f32 = vcvtq_f32_u32(value_u32);
 		return vmulq_n_f32(value_f32, inv_max_value);
 #else
-		const uint32_t bit_shift = 32 - num_bits;
 		const uint32_t mask = k_packed_constants[num_bits].mask;
 		const float inv_max_value = k_packed_constants[num_bits].max_value;
 
+		// With at most 23 bits per component and a 7 bit offset, two components always fit within a single 64 bit load
 		uint32_t byte_offset = bit_offset / 8;
-		uint32_t vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t x32 = (vector_u32 >> (bit_shift - (bit_offset % 8))) & mask;
-
-		bit_offset += num_bits;
-
-		byte_offset = bit_offset / 8;
-		vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t y32 = (vector_u32 >> (bit_shift - (bit_offset % 8))) & mask;
-
-		bit_offset += num_bits;
-
-		byte_offset = bit_offset / 8;
-		vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t z32 = (vector_u32 >> (bit_shift - (bit_offset % 8))) & mask;
+		const uint64_t xy_u64 = byte_swap(unaligned_load<uint64_t>(vector_data + byte_offset)) << (bit_offset % 8);
+		const uint32_t x32 = uint32_t(xy_u64 >> (64 - num_bits)) & mask;
+		const uint32_t y32 = uint32_t(xy_u64 >> (64 - num_bits * 2)) & mask;
 
-		bit_offset += num_bits;
+		bit_offset += num_bits * 2;
 
 		byte_offset = bit_offset / 8;
-		vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t w32 = (vector_u32 >> (bit_shift - (bit_offset % 8))) & mask;
+		const uint64_t zw_u64 = byte_swap(unaligned_load<uint64_t>(vector_data + byte_offset)) << (bit_offset % 8);
+		const uint32_t z32 = uint32_t(zw_u64 >> (64 - num_bits)) & mask;
+		const uint32_t w32 = uint32_t(zw_u64 >> (64 - num_bits * 2)) & mask;
 
 		return rtm::vector_mul(rtm::vector_set(float(x32), float(y32), float(z32), float(w32)), inv_max_value);
 #endif
@@ -619,6 +605,25 @@ namespace acl
 		data[2] = safe_static_cast<uint16_t>(vector_z);
 	}
 
+	// Loads 4 unsigned 16 bit integers stored in native byte order, the output lies within [0.0, 65535.0]
+	// Assumes the 'vector_data' is padded in order to load up to 8 bytes from it
+	inline rtm::vector4f RTM_SIMD_CALL load_vector4_u16x4_unsafe(const uint8_t* vector_data)
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		const __m128i vector_u16 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(vector_data));
+		const __m128i vector_u32 = _mm_unpacklo_epi16(vector_u16, _mm_setzero_si128());
+		return _mm_cvtepi32_ps(vector_u32);
+#elif defined(RTM_NEON_INTRINSICS)
+		const uint16x4_t vector_u16 = vld1_u16(reinterpret_cast<const uint16_t*>(vector_data));
+		const uint32x4_t vector_u32 = vmovl_u16(vector_u16);
+		return vcvtq_f32_u32(vector_u32);
+#else
+		uint16_t vector_u16[4];
+		std::memcpy(&vector_u16[0], vector_data, sizeof(vector_u16));
+		return rtm::vector_set(float(vector_u16[0]), float(vector_u16[1]), float(vector_u16[2]), float(vector_u16[3]));
+#endif
+	}
+
 	// Assumes the 'vector_data' is padded in order to load up to 16 bytes from it
 	inline rtm::vector4f RTM_SIMD_CALL unpack_vector3_u48_unsafe(const uint8_t* vector_data)
 	{
@@ -943,51 +948,64 @@ namespace acl
 		const __m128i mask = _mm_castps_si128(_mm_load_ps1((const float*)&k_packed_constants[num_bits].mask));
 		const __m128 inv_max_value = _mm_load_ps1(&k_packed_constants[num_bits].max_value);
 
+		// With at most 23 bits per component and a 7 bit offset, two components always fit within a single 64 bit load
 		uint32_t byte_offset = bit_offset / 8;
-		uint32_t vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t x32 = (vector_u32 >> (bit_shift - (bit_offset % 8)));
-
-		bit_offset += num_bits;
+		const uint64_t xy_u64 = byte_swap(unaligned_load<uint64_t>(vector_data + byte_offset)) << (bit_offset % 8);
+		const uint32_t x32 = uint32_t(xy_u64 >> (64 - num_bits));
+		const uint32_t y32 = uint32_t(xy_u64 >> (64 - num_bits * 2));
 
-		byte_offset = bit_offset / 8;
-		vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t y32 = (vector_u32 >> (bit_shift - (bit_offset % 8)));
-
-		bit_offset += num_bits;
+		bit_offset += num_bits * 2;
 
 		byte_offset = bit_offset / 8;
-		vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
+		const uint32_t vector_u32 = byte_swap(unaligned_load<uint32_t>(vector_data + byte_offset));
 		const uint32_t z32 = (vector_u32 >> (bit_shift - (bit_offset % 8)));
 
 		__m128i int_value = _mm_set_epi32(x32, z32, y32, x32);
 		int_value = _mm_and_si128(int_value, mask);
 		const __m128 value = _mm_cvtepi32_ps(int_value);
 		return _mm_mul_ps(value, inv_max_value);
+#elif defined(RTM_NEON64_INTRINSICS)
+		// With 23 bits per component at most, our 3 components span at most 76 bits (including the initial bit offset)
+		// We load 16 bytes once and use a table lookup to gather the 4 big-endian bytes of every component
+		// in their own lane. Each lane is then shifted by its own amount to align the value.
+		const uint32_t bit_shift = 32 - num_bits;
+		const uint32x4_t mask = vdupq_n_u32(k_packed_constants[num_bits].mask);
+		const float inv_max_value = k_packed_constants[num_bits].max_value;
+
+		alignas(16) static constexpr uint32_t k_component_indices[4] = { 0, 1, 2, 0 };
+
+		const uint32_t byte_offset = bit_offset / 8;
+		const uint8x16_t vector_u8 = vld1q_u8(vector_data + byte_offset);
+
+		// Bit offset of each component relative to the first byte we loaded: (bit_offset % 8) + { 0, 1, 2, 0 } * num_bits
+		const uint32x4_t component_bit_offsets = vmlaq_n_u32(vdupq_n_u32(bit_offset % 8), vld1q_u32(&k_component_indices[0]), num_bits);
+		const uint32x4_t component_byte_offsets = vshrq_n_u32(component_bit_offsets, 3);
+
+		// Our data is big-endian, the first byte goes in the most significant byte of each lane
+		const uint32x4_t byte_indices = vmlaq_n_u32(vdupq_n_u32(0x00010203), component_byte_offsets, 0x01010101);
+		const uint32x4_t components_u32 = vreinterpretq_u32_u8(vqtbl1q_u8(vector_u8, vreinterpretq_u8_u32(byte_indices)));
+
+		// Shift right each lane: negative shift values shift to the right
+		const int32x4_t component_shifts = vsubq_s32(vreinterpretq_s32_u32(vandq_u32(component_bit_offsets, vdupq_n_u32(7))), vdupq_n_s32(int32_t(bit_shift)));
+		const uint32x4_t value_u32 = vandq_u32(vshlq_u32(components_u32, component_shifts), mask);
+
+		const float32x4_t value_f32 = vcvtq_f32_u32(value_u32);
+		return vmulq_n_f32(value_f32, inv_max_value);
 #elif defined(RTM_NEON_INTRINSICS)
 		const uint32_t bit_shift = 32 - num_bits;
 		uint32x4_t mask = vdupq_n_u32(k_packed_constants[num_bits].mask);
 		float inv_max_value = k_packed_constants[num_bits].max_value;
 
+		// With at most 23 bits per component and a 7 bit offset, two components always fit within a single 64 bit load
 		uint32_t byte_offset = bit_offset / 8;
-		uint32_t vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t x32 = (vector_u32 >> (bit_shift - (bit_offset % 8)));
-
-		bit_offset += num_bits;
-
-		byte_offset = bit_offset / 8;
-		vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t y32 = (vector_u32 >> (bit_shift - (bit_offset % 8)));
+		const uint64_t xy_u64 = byte_swap(unaligned_load<uint64_t>(vector_data + byte_offset)) << (bit_offset % 8);
+		const uint32_t x32 = uint32_t(xy_u64 >> (64 - num_bits));
+		const uint32_t y32 = uint32_t(xy_u64 >> (64 - num_bits * 2));
 
-		bit_offset += num_bits;
+		bit_offset += num_bits * 2;
 
 		byte_offset = bit_offset / 8;
-		vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
+		const uint32_t vector_u32 = byte_swap(unaligned_load<uint32_t>(vector_data + byte_offset));
 		const uint32_t z32 = (vector_u32 >> (bit_shift - (bit_offset % 8)));
 
 		uint32x2_t xy = vcreate_u32(uint64_t(x32) | (uint64_t(y32) << 32));
@@ -1001,23 +1019,16 @@ namespace acl
 		const uint32_t mask = k_packed_constants[num_bits].mask;
 		const float inv_max_value = k_packed_constants[num_bits].max_value;
 
+		// With at most 23 bits per component and a 7 bit offset, two components always fit within a single 64 bit load
 		uint32_t byte_offset = bit_offset / 8;
-		uint32_t vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t x32 = (vector_u32 >> (bit_shift - (bit_offset % 8))) & mask;
+		const uint64_t xy_u64 = byte_swap(unaligned_load<uint64_t>(vector_data + byte_offset)) << (bit_offset % 8);
+		const uint32_t x32 = uint32_t(xy_u64 >> (64 - num_bits)) & mask;
+		const uint32_t y32 = uint32_t(xy_u64 >> (64 - num_bits * 2)) & mask;
 
-		bit_offset += num_bits;
+		bit_offset += num_bits * 2;
 
 		byte_offset = bit_offset / 8;
-		vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t y32 = (vector_u32 >> (bit_shift - (bit_offset % 8))) & mask;
-
-		bit_offset += num_bits;
-
-		byte_offset = bit_offset / 8;
-		vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
+		const uint32_t vector_u32 = byte_swap(unaligned_load<uint32_t>(vector_data + byte_offset));
 		const uint32_t z32 = (vector_u32 >> (bit_shift - (bit_offset % 8))) & mask;
 
 		return rtm::vector_mul(rtm::vector_set(float(x32), float(y32), float(z32)), inv_max_value);
@@ -1031,6 +1042,231 @@ namespace acl
 		return rtm::vector_neg_mul_sub(unsigned_value, -2.0F, rtm::vector_set(-1.0F));
 	}
 
+	namespace acl_impl
+	{
+		// Appends values one after another in big-endian order
+		// Full 32 bit words are written as they fill up and the last partial byte is written when we flush
+		class packed_bit_writer
+		{
+		public:
+			packed_bit_writer(uint8_t* output, uint32_t bit_offset)
+				: m_output(output + (bit_offset / 8))
+				, m_pending_bits(0)
+				, m_num_pending_bits(bit_offset % 8)
+			{
+				// Retain the bits that precede our offset in the first byte
+				if (m_num_pending_bits != 0)
+					m_pending_bits = m_output[0] >> (8 - m_num_pending_bits);
+			}
+
+			void write(uint32_t value, uint32_t num_bits)
+			{
+				ACL_ASSERT(num_bits <= 32, "Cannot write more than 32 bits at a time");
+
+				if (num_bits == 0)
+					return;
+
+				m_pending_bits = (m_pending_bits << num_bits) | value;
+				m_num_pending_bits += num_bits;
+
+				if (m_num_pending_bits >= 32)
+				{
+					const uint32_t word = uint32_t(m_pending_bits >> (m_num_pending_bits - 32));
+					unaligned_write(byte_swap(word), m_output);
+
+					m_output += 4;
+					m_num_pending_bits -= 32;
+				}
+			}
+
+			// The bits that follow our last value in its last byte are cleared
+			void flush()
+			{
+				for (; m_num_pending_bits >= 8; m_num_pending_bits -= 8)
+					*m_output++ = uint8_t(m_pending_bits >> (m_num_pending_bits - 8));
+
+				if (m_num_pending_bits != 0)
+					*m_output = uint8_t(m_pending_bits << (8 - m_num_pending_bits));
+
+				m_num_pending_bits = 0;
+			}
+
+		private:
+			uint8_t* m_output;
+			uint64_t m_pending_bits;
+			uint32_t m_num_pending_bits;
+		};
+
+		// Quantizes the XYZ components of a normalized unsigned vector, same as pack_scalar_unsigned(..) for each component
+		inline void RTM_SIMD_CALL quantize_vector3_unsigned(rtm::vector4f_arg0 input, rtm::vector4f_arg1 max_value, uint32_t* out_values)
+		{
+			ACL_ASSERT(rtm::vector_all_greater_equal3(input, rtm::vector_zero()) && rtm::vector_all_less_equal3(input, rtm::vector_set(1.0F)), "Expected normalized unsigned input value: %f, %f, %f", (float)rtm::vector_get_x(input), (float)rtm::vector_get_y(input), (float)rtm::vector_get_z(input));
+
+			const rtm::vector4f packed = rtm::vector_round_symmetric(rtm::vector_mul(input, max_value));
+
+#if defined(RTM_SSE2_INTRINSICS)
+			alignas(16) uint32_t values[4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(&values[0]), _mm_cvttps_epi32(packed));
+#elif defined(RTM_NEON_INTRINSICS)
+			alignas(16) uint32_t values[4];
+			vst1q_u32(&values[0], vcvtq_u32_f32(packed));
+#else
+			const uint32_t values[3] = { static_cast<uint32_t>(rtm::vector_get_x(packed)), static_cast<uint32_t>(rtm::vector_get_y(packed)), static_cast<uint32_t>(rtm::vector_get_z(packed)) };
+#endif
+
+			out_values[0] = values[0];
+			out_values[1] = values[1];
+			out_values[2] = values[2];
+		}
+	}
+
+	// Packs the vectors one after another in big-endian order with 'num_bits' per component, starting at 'bit_offset'
+	// Every vector can be read back with unpack_vector3_uXX_unsafe(..), the Nth one lies at 'bit_offset + N * num_bits * 3'
+	// The bits before 'bit_offset' are retained and the bits that follow the last vector in its last byte are cleared
+	inline void pack_vector3_uXX_array(const rtm::vector4f* vectors, uint32_t num_vectors, uint32_t num_bits, uint8_t* out_vector_data, uint32_t bit_offset)
+	{
+		ACL_ASSERT(num_bits < 31, "Attempting to pack on too many bits");
+
+		const rtm::vector4f max_value = rtm::vector_set(rtm::scalar_safe_to_float((1 << num_bits) - 1));
+		acl_impl::packed_bit_writer writer(out_vector_data, bit_offset);
+
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+		{
+			uint32_t values[3];
+			acl_impl::quantize_vector3_unsigned(vectors[vector_index], max_value, values);
+
+			writer.write(values[0], num_bits);
+			writer.write(values[1], num_bits);
+			writer.write(values[2], num_bits);
+		}
+
+		writer.flush();
+	}
+
+	// Same as pack_vector3_uXX_array(..) but with input components within [-1.0, 1.0]
+	inline void pack_vector3_sXX_array(const rtm::vector4f* vectors, uint32_t num_vectors, uint32_t num_bits, uint8_t* out_vector_data, uint32_t bit_offset)
+	{
+		ACL_ASSERT(num_bits < 31, "Attempting to pack on too many bits");
+
+		const rtm::vector4f half = rtm::vector_set(0.5F);
+		const rtm::vector4f max_value = rtm::vector_set(rtm::scalar_safe_to_float((1 << num_bits) - 1));
+		acl_impl::packed_bit_writer writer(out_vector_data, bit_offset);
+
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+		{
+			uint32_t values[3];
+			acl_impl::quantize_vector3_unsigned(rtm::vector_mul_add(vectors[vector_index], half, half), max_value, values);
+
+			writer.write(values[0], num_bits);
+			writer.write(values[1], num_bits);
+			writer.write(values[2], num_bits);
+		}
+
+		writer.flush();
+	}
+
+	// Unpacks vectors packed one after another with pack_vector3_uXX_array(..)
+	// Assumes the 'vector_data' is in big-endian order and padded in order to load up to 16 bytes past the last vector
+	inline void unpack_vector3_uXX_array_unsafe(uint32_t num_bits, const uint8_t* vector_data, uint32_t bit_offset, uint32_t num_vectors, rtm::vector4f* out_vectors)
+	{
+		const uint32_t num_bits_per_vector = num_bits * 3;
+
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index, bit_offset += num_bits_per_vector)
+			out_vectors[vector_index] = unpack_vector3_uXX_unsafe(num_bits, vector_data, bit_offset);
+	}
+
+	// Unpacks vectors packed one after another with pack_vector3_sXX_array(..)
+	// Assumes the 'vector_data' is in big-endian order and padded in order to load up to 16 bytes past the last vector
+	inline void unpack_vector3_sXX_array_unsafe(uint32_t num_bits, const uint8_t* vector_data, uint32_t bit_offset, uint32_t num_vectors, rtm::vector4f* out_vectors)
+	{
+		const uint32_t num_bits_per_vector = num_bits * 3;
+
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index, bit_offset += num_bits_per_vector)
+			out_vectors[vector_index] = unpack_vector3_sXX_unsafe(num_bits, vector_data, bit_offset);
+	}
+
+	// Packs data in big-endian order with its own number of bits per component
+	// Assumes the 'out_vector_data' is padded in order to write up to 16 bytes to it
+	inline void RTM_SIMD_CALL pack_vector3_uXYZ_unsafe(rtm::vector4f_arg0 vector, uint32_t num_bits_x, uint32_t num_bits_y, uint32_t num_bits_z, uint8_t* out_vector_data)
+	{
+		ACL_ASSERT(num_bits_x != 0 && num_bits_x <= 23, "This function does not support writing more than 23 bits per component");
+		ACL_ASSERT(num_bits_y != 0 && num_bits_y <= 23, "This function does not support writing more than 23 bits per component");
+		ACL_ASSERT(num_bits_z != 0 && num_bits_z <= 23, "This function does not support writing more than 23 bits per component");
+
+		const uint32_t vector_x = byte_swap(pack_scalar_unsigned(rtm::vector_get_x(vector), num_bits_x) << (32 - num_bits_x));
+		const uint32_t vector_y = byte_swap(pack_scalar_unsigned(rtm::vector_get_y(vector), num_bits_y) << (32 - num_bits_y));
+		const uint32_t vector_z = byte_swap(pack_scalar_unsigned(rtm::vector_get_z(vector), num_bits_z) << (32 - num_bits_z));
+
+		// Our components span at most 69 bits, clear them first to not leave garbage behind
+		std::memset(out_vector_data, 0, sizeof(uint64_t) * 2);
+
+		memcpy_bits(out_vector_data, 0, &vector_x, 0, num_bits_x);
+		memcpy_bits(out_vector_data, num_bits_x, &vector_y, 0, num_bits_y);
+		memcpy_bits(out_vector_data, uint64_t(num_bits_x) + num_bits_y, &vector_z, 0, num_bits_z);
+	}
+
+	inline rtm::vector4f RTM_SIMD_CALL decay_vector3_uXYZ(rtm::vector4f_arg0 input, uint32_t num_bits_x, uint32_t num_bits_y, uint32_t num_bits_z)
+	{
+		ACL_ASSERT(rtm::vector_all_greater_equal3(input, rtm::vector_zero()) && rtm::vector_all_less_equal3(input, rtm::vector_set(1.0F)), "Expected normalized unsigned input value: %f, %f, %f", (float)rtm::vector_get_x(input), (float)rtm::vector_get_y(input), (float)rtm::vector_get_z(input));
+
+		const float max_value_x = rtm::scalar_safe_to_float((1 << num_bits_x) - 1);
+		const float max_value_y = rtm::scalar_safe_to_float((1 << num_bits_y) - 1);
+		const float max_value_z = rtm::scalar_safe_to_float((1 << num_bits_z) - 1);
+		const rtm::vector4f max_value = rtm::vector_set(max_value_x, max_value_y, max_value_z, max_value_z);
+		const rtm::vector4f inv_max_value = rtm::vector_set(1.0F / max_value_x, 1.0F / max_value_y, 1.0F / max_value_z, 1.0F / max_value_z);
+
+		const rtm::vector4f packed = rtm::vector_round_symmetric(rtm::vector_mul(input, max_value));
+		const rtm::vector4f decayed = rtm::vector_mul(packed, inv_max_value);
+		return decayed;
+	}
+
+	// Assumes the 'vector_data' is in big-endian order and padded in order to load up to 16 bytes from it
+	inline rtm::vector4f RTM_SIMD_CALL unpack_vector3_uXYZ_unsafe(uint32_t num_bits_x, uint32_t num_bits_y, uint32_t num_bits_z, const uint8_t* vector_data, uint32_t bit_offset)
+	{
+		ACL_ASSERT(num_bits_x <= 23 && num_bits_y <= 23 && num_bits_z <= 23, "This function does not support reading more than 23 bits per component");
+
+		// With at most 23 bits per component and a 7 bit offset, two components always fit within a single 64 bit load
+		uint32_t byte_offset = bit_offset / 8;
+		const uint64_t xy_u64 = byte_swap(unaligned_load<uint64_t>(vector_data + byte_offset)) << (bit_offset % 8);
+		const uint32_t x32 = uint32_t(xy_u64 >> (64 - num_bits_x)) & ((1 << num_bits_x) - 1);
+		const uint32_t y32 = uint32_t(xy_u64 >> (64 - num_bits_x - num_bits_y)) & ((1 << num_bits_y) - 1);
+
+		bit_offset += num_bits_x + num_bits_y;
+
+		byte_offset = bit_offset / 8;
+		const uint32_t vector_u32 = byte_swap(unaligned_load<uint32_t>(vector_data + byte_offset));
+		const uint32_t z32 = (vector_u32 >> ((32 - num_bits_z) - (bit_offset % 8))) & ((1 << num_bits_z) - 1);
+
+		const rtm::vector4f value = rtm::vector_set(float(x32), float(y32), float(z32));
+		const rtm::vector4f inv_max_value = rtm::vector_set(1.0F / float((1 << num_bits_x) - 1), 1.0F / float((1 << num_bits_y) - 1), 1.0F / float((1 << num_bits_z) - 1));
+		return rtm::vector_mul(value, inv_max_value);
+	}
+
+	// Packs only the X component in big-endian order, the Y and Z components are assumed to be equal to it
+	// Assumes the 'out_vector_data' is padded in order to write up to 16 bytes to it
+	inline void RTM_SIMD_CALL pack_vector3_uniform_uXX_unsafe(rtm::vector4f_arg0 vector, uint32_t num_bits, uint8_t* out_vector_data)
+	{
+		ACL_ASSERT(num_bits != 0 && num_bits <= 23, "This function does not support writing more than 23 bits per component");
+
+		const uint32_t vector_x = byte_swap(pack_scalar_unsigned(rtm::vector_get_x(vector), num_bits) << (32 - num_bits));
+
+		std::memset(out_vector_data, 0, sizeof(uint32_t));
+		memcpy_bits(out_vector_data, 0, &vector_x, 0, num_bits);
+	}
+
+	// Unpacks a single component and broadcasts it to X, Y, and Z
+	// Assumes the 'vector_data' is in big-endian order and padded in order to load up to 16 bytes from it
+	inline rtm::vector4f RTM_SIMD_CALL unpack_vector3_uniform_uXX_unsafe(uint32_t num_bits, const uint8_t* vector_data, uint32_t bit_offset)
+	{
+		ACL_ASSERT(num_bits <= 23, "This function does not support reading more than 23 bits per component");
+
+		const uint32_t byte_offset = bit_offset / 8;
+		const uint32_t vector_u32 = byte_swap(unaligned_load<uint32_t>(vector_data + byte_offset));
+		const uint32_t x32 = (vector_u32 >> ((32 - num_bits) - (bit_offset % 8))) & ((1 << num_bits) - 1);
+
+		return rtm::vector_set(float(x32) * (1.0F / float((1 << num_bits) - 1)));
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// vector2 packing and decay
 
@@ -1074,42 +1310,28 @@ namespace acl
 		};
 
 #if defined(RTM_SSE2_INTRINSICS)
-		const uint32_t bit_shift = 32 - num_bits;
 		const __m128i mask = _mm_castps_si128(_mm_load_ps1((const float*)&k_packed_constants[num_bits].mask));
 		const __m128 inv_max_value = _mm_load_ps1(&k_packed_constants[num_bits].max_value);
 
-		uint32_t byte_offset = bit_offset / 8;
-		uint32_t vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t x32 = (vector_u32 >> (bit_shift - (bit_offset % 8)));
-
-		bit_offset += num_bits;
-
-		byte_offset = bit_offset / 8;
-		vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t y32 = (vector_u32 >> (bit_shift - (bit_offset % 8)));
+		// With at most 23 bits per component and a 7 bit offset, both components fit within a single 64 bit load
+		const uint32_t byte_offset = bit_offset / 8;
+		const uint64_t xy_u64 = byte_swap(unaligned_load<uint64_t>(vector_data + byte_offset)) << (bit_offset % 8);
+		const uint32_t x32 = uint32_t(xy_u64 >> (64 - num_bits));
+		const uint32_t y32 = uint32_t(xy_u64 >> (64 - num_bits * 2));
 
 		__m128i int_value = _mm_set_epi32(y32, x32, y32, x32);
 		int_value = _mm_and_si128(int_value, mask);
 		const __m128 value = _mm_cvtepi32_ps(int_value);
 		return _mm_mul_ps(value, inv_max_value);
 #elif defined(RTM_NEON_INTRINSICS)
-		const uint32_t bit_shift = 32 - num_bits;
 		uint32x2_t mask = vdup_n_u32(k_packed_constants[num_bits].mask);
 		float inv_max_value = k_packed_constants[num_bits].max_value;
 
-		uint32_t byte_offset = bit_offset / 8;
-		uint32_t vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t x32 = (vector_u32 >> (bit_shift - (bit_offset % 8)));
-
-		bit_offset += num_bits;
-
-		byte_offset = bit_offset / 8;
-		vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t y32 = (vector_u32 >> (bit_shift - (bit_offset % 8)));
+		// With at most 23 bits per component and a 7 bit offset, both components fit within a single 64 bit load
+		const uint32_t byte_offset = bit_offset / 8;
+		const uint64_t xy_u64 = byte_swap(unaligned_load<uint64_t>(vector_data + byte_offset)) << (bit_offset % 8);
+		const uint32_t x32 = uint32_t(xy_u64 >> (64 - num_bits));
+		const uint32_t y32 = uint32_t(xy_u64 >> (64 - num_bits * 2));
 
 		uint32x2_t xy = vcreate_u32(uint64_t(x32) | (uint64_t(y32) << 32));
 		xy = vand_u32(xy, mask);
@@ -1117,21 +1339,14 @@ namespace acl
 		float32x2_t result = vmul_n_f32(value_f32, inv_max_value);
 		return vcombine_f32(result, result);
 #else
-		const uint32_t bit_shift = 32 - num_bits;
 		const uint32_t mask = k_packed_constants[num_bits].mask;
 		const float inv_max_value = k_packed_constants[num_bits].max_value;
 
-		uint32_t byte_offset = bit_offset / 8;
-		uint32_t vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t x32 = (vector_u32 >> (bit_shift - (bit_offset % 8))) & mask;
-
-		bit_offset += num_bits;
-
-		byte_offset = bit_offset / 8;
-		vector_u32 = unaligned_load<uint32_t>(vector_data + byte_offset);
-		vector_u32 = byte_swap(vector_u32);
-		const uint32_t y32 = (vector_u32 >> (bit_shift - (bit_offset % 8))) & mask;
+		// With at most 23 bits per component and a 7 bit offset, both components fit within a single 64 bit load
+		const uint32_t byte_offset = bit_offset / 8;
+		const uint64_t xy_u64 = byte_swap(unaligned_load<uint64_t>(vector_data + byte_offset)) << (bit_offset % 8);
+		const uint32_t x32 = uint32_t(xy_u64 >> (64 - num_bits)) & mask;
+		const uint32_t y32 = uint32_t(xy_u64 >> (64 - num_bits * 2)) & mask;
 
 		return rtm::vector_mul(rtm::vector_set(float(x32), float(y32), 0.0F, 0.0F), inv_max_value);
 #endif
@@ -1146,12 +1361,20 @@ namespace acl
 		{
 		case vector_format8::vector3f_full:		return sizeof(float) * 3;
 		case vector_format8::vector3f_variable:
+		case vector_format8::vector3f_variable_per_component:
 		default:
 			ACL_ASSERT(false, "Invalid or unsupported vector format: %s", get_vector_format_name(format));
 			return 0;
 		}
 	}
 
+	// Formats with a variable number of bits per component store the bit rate reduction of each component
+	// after the clip range min/extent, padded to 4 bytes
+	constexpr uint32_t get_range_reduction_vector_size(vector_format8 format)
+	{
+		return format == vector_format8::vector3f_variable_per_component ? (k_clip_range_reduction_vector3_range_size + 4) : k_clip_range_reduction_vector3_range_size;
+	}
+
 	ACL_IMPL_VERSION_NAMESPACE_END
 }
 
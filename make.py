@@ -894,8 +894,10 @@ def do_pull_bench_android(build_dir):
 	cmd = 'adb pull "{}" "{}"'.format(src_filename, dst_filename)
 	os.system(cmd)
 
-def do_run_bench_native(build_dir, test_data_dir):
-	if platform.system() == 'Windows':
+def do_run_bench_native(build_dir, test_data_dir, args):
+	if args.compiler == 'emscripten':
+		bench_exe = 'node {}'.format(os.path.join(os.getcwd(), 'bin/acl_decompressor.js'))
+	elif platform.system() == 'Windows':
 		bench_exe = os.path.join(os.getcwd(), 'bin/acl_decompressor.exe')
 	else:
 		bench_exe = os.path.join(os.getcwd(), 'bin/acl_decompressor')
@@ -918,7 +920,7 @@ def do_run_bench(build_dir, test_data_dir, args):
 	if args.compiler == 'android':
 		do_run_bench_android(build_dir, args)
 	else:
-		do_run_bench_native(build_dir, test_data_dir)
+		do_run_bench_native(build_dir, test_data_dir, args)
 
 if __name__ == "__main__":
 	args = parse_argv()
@@ -0,0 +1,74 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch2/catch.hpp>
+
+#include "../decompression/decompression_test_utils.h"
+
+#include <acl/compression/compress.h>
+#include <acl/compression/track_error.h>
+#include <acl/compression/transform_error_metrics.h>
+#include <acl/core/ansi_allocator.h>
+#include <acl/decompression/decompress.h>
+
+#include <cstdint>
+
+using namespace acl;
+
+TEST_CASE("compression levels meet the precision", "[compression][level]")
+{
+	ansi_allocator allocator;
+
+	// A long chain, every track accumulates the error of its parents
+	const uint32_t num_tracks = 8;
+	const uint32_t num_samples = 31;
+	const track_array_qvvf track_list = acl_test::make_test_track_list(allocator, num_tracks, num_samples, true);
+
+	qvvf_transform_error_metric error_metric;
+
+	// The lowest and low levels skip the permutation search, their refinement pass alone must meet the precision
+	const compression_level8 levels[] = { compression_level8::lowest, compression_level8::low, compression_level8::medium, compression_level8::high, compression_level8::highest };
+	for (const compression_level8 level : levels)
+	{
+		compression_settings settings = get_default_compression_settings();
+		settings.level = level;
+		settings.error_metric = &error_metric;
+
+		output_stats stats;
+		compressed_tracks* tracks = nullptr;
+		const error_result result = compress_track_list(allocator, track_list, settings, tracks, stats);
+		REQUIRE(result.empty());
+		REQUIRE(tracks != nullptr);
+		CHECK(tracks->is_valid(true).empty());
+
+		decompression_context<debug_transform_decompression_settings> context;
+		REQUIRE(context.initialize(*tracks));
+
+		// Our tracks have a precision of 1mm, allow a small margin for the decompression rounding
+		const track_error error = calculate_compression_error(allocator, track_list, context, error_metric);
+		CHECK(error.error < 0.0011F);
+
+		allocator.deallocate(tracks, tracks->get_size());
+	}
+}
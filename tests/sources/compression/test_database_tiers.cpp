@@ -0,0 +1,153 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch2/catch.hpp>
+
+#include "../decompression/decompression_test_utils.h"
+
+#include <acl/compression/compress.h>
+#include <acl/compression/track_error.h>
+#include <acl/compression/transform_error_metrics.h>
+#include <acl/core/ansi_allocator.h>
+#include <acl/core/compressed_database.h>
+#include <acl/core/quality_tiers.h>
+#include <acl/decompression/decompress.h>
+#include <acl/decompression/database/database.h>
+
+#include <cstdint>
+#include <cstring>
+
+// The number of database tiers is a compile time constant that every translation unit must agree on.
+// These tests run with the default number of tiers and, in their own executable, with ACL_NUM_DATABASE_TIERS=4.
+
+using namespace acl;
+
+namespace
+{
+	struct database_tiers_decompression_settings final : public debug_transform_decompression_settings
+	{
+		using database_settings_type = debug_database_settings;
+	};
+
+	compressed_database* build_test_database(ansi_allocator& allocator, const track_array_qvvf& track_list, const qvvf_transform_error_metric& error_metric, compressed_tracks*& out_database_tracks)
+	{
+		compression_settings settings = get_default_compression_settings();
+		settings.error_metric = &error_metric;
+		settings.enable_database_support = true;
+
+		output_stats stats;
+		compressed_tracks* tracks = nullptr;
+		const error_result result = compress_track_list(allocator, track_list, settings, tracks, stats);
+		REQUIRE(result.empty());
+
+		// Every database tier retains some key frames
+		compression_database_settings database_settings;
+		database_settings.medium_importance_tier_proportion = 0.2F;
+		database_settings.low_importance_tier_proportion = 0.3F;
+		for (uint32_t tier_index = 0; tier_index < k_num_intermediate_database_tiers; ++tier_index)
+			database_settings.intermediate_importance_tier_proportions[tier_index] = 0.05F;
+
+		compressed_tracks* database_tracks[1] = { nullptr };
+		compressed_database* database = nullptr;
+		const error_result database_result = build_database(allocator, database_settings, &tracks, 1, database_tracks, database);
+		allocator.deallocate(tracks, tracks->get_size());
+		REQUIRE(database_result.empty());
+
+		out_database_tracks = database_tracks[0];
+		return database;
+	}
+}
+
+TEST_CASE("database tiers round trip", "[compression][database]")
+{
+	ansi_allocator allocator;
+
+	const uint32_t num_tracks = 4;
+	const uint32_t num_samples = 61;
+	const track_array_qvvf track_list = acl_test::make_test_track_list(allocator, num_tracks, num_samples, true);
+
+	qvvf_transform_error_metric error_metric;
+
+	compressed_tracks* database_tracks = nullptr;
+	compressed_database* database = build_test_database(allocator, track_list, error_metric, database_tracks);
+
+	CHECK(database->is_valid(true).empty());
+	CHECK(database_tracks->is_valid(true).empty());
+
+	for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+	{
+		const quality_tier tier = get_database_quality_tier(tier_index);
+		CHECK(database->get_num_chunks(tier) != 0);
+		CHECK(database->get_bulk_data_size(tier) != 0);
+	}
+
+	{
+		// Our bulk data is inline, every tier is present
+		database_context<debug_database_settings> db_context;
+		REQUIRE(db_context.initialize(allocator, *database));
+
+		for (uint32_t tier_index = 0; tier_index < k_num_database_tiers; ++tier_index)
+			CHECK(db_context.is_streamed_in(get_database_quality_tier(tier_index)));
+
+		decompression_context<database_tiers_decompression_settings> context;
+		REQUIRE(context.initialize(*database_tracks, db_context));
+
+		// Our tracks have a precision of 1mm, allow a small margin for the decompression rounding
+		const track_error error = calculate_compression_error(allocator, track_list, context, error_metric);
+		CHECK(error.error < 0.0011F);
+	}
+
+	allocator.deallocate(database_tracks, database_tracks->get_size());
+	allocator.deallocate(database, database->get_size());
+}
+
+TEST_CASE("database tiers mismatch", "[compression][database]")
+{
+	ansi_allocator allocator;
+
+	const track_array_qvvf track_list = acl_test::make_test_track_list(allocator, 2, 31, true);
+
+	qvvf_transform_error_metric error_metric;
+
+	compressed_tracks* database_tracks = nullptr;
+	compressed_database* database = build_test_database(allocator, track_list, error_metric, database_tracks);
+	REQUIRE(database->is_valid(true).empty());
+
+	// A database built with a different number of tiers has a different layout and must be rejected
+	const uint32_t database_size = database->get_size();
+	uint8_t* buffer = allocate_type_array_aligned<uint8_t>(allocator, database_size, alignof(compressed_database));
+	std::memcpy(buffer, database, database_size);
+
+	acl_impl::database_header& header = *reinterpret_cast<acl_impl::database_header*>(buffer + sizeof(acl_impl::raw_buffer_header));
+	CHECK(header.get_num_tiers() == k_num_database_tiers);
+
+	header.set_num_tiers(k_num_database_tiers == 2 ? 3 : (k_num_database_tiers - 1));
+
+	const compressed_database* mismatched_database = reinterpret_cast<const compressed_database*>(buffer);
+	CHECK(mismatched_database->is_valid(false).any());
+
+	deallocate_type_array(allocator, buffer, database_size);
+	allocator.deallocate(database_tracks, database_tracks->get_size());
+	allocator.deallocate(database, database->get_size());
+}
@@ -0,0 +1,194 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch2/catch.hpp>
+
+#include "../decompression/decompression_test_utils.h"
+
+#include <acl/compression/compress.h>
+#include <acl/compression/track_error.h>
+#include <acl/compression/transform_error_metrics.h>
+#include <acl/core/ansi_allocator.h>
+#include <acl/core/compressed_tracks.h>
+#include <acl/decompression/decompress.h>
+
+#include <cstdint>
+
+using namespace acl;
+
+namespace
+{
+	compressed_tracks* compress_test_tracks(ansi_allocator& allocator, const track_array_qvvf& track_list, compression_settings settings)
+	{
+		qvvf_transform_error_metric error_metric;
+		settings.error_metric = &error_metric;
+
+		output_stats stats;
+		compressed_tracks* tracks = nullptr;
+		const error_result result = compress_track_list(allocator, track_list, settings, tracks, stats);
+		REQUIRE(result.empty());
+		REQUIRE(tracks != nullptr);
+		CHECK(tracks->is_valid(true).empty());
+
+		return tracks;
+	}
+
+	float calculate_test_error(ansi_allocator& allocator, const track_array_qvvf& track_list, const compressed_tracks& tracks)
+	{
+		qvvf_transform_error_metric error_metric;
+
+		decompression_context<debug_transform_decompression_settings> context;
+		REQUIRE(context.initialize(tracks));
+
+		return calculate_compression_error(allocator, track_list, context, error_metric).error;
+	}
+}
+
+TEST_CASE("constant rotation quantization", "[compression][quantization]")
+{
+	ansi_allocator allocator;
+
+	// A static pose, every rotation is constant and not the identity
+	// With 10 tracks, the last group of constant rotations is partial
+	const uint32_t num_tracks = 10;
+	track_array_qvvf track_list = acl_test::make_test_track_list(allocator, num_tracks, 11, false);
+
+	compression_settings settings = get_default_compression_settings();
+	settings.rotation_format = rotation_format8::quatf_drop_w_variable;
+
+	{
+		compressed_tracks* full_tracks = compress_test_tracks(allocator, track_list, settings);
+
+		settings.enable_constant_rotation_quantization = true;
+		compressed_tracks* quantized_tracks = compress_test_tracks(allocator, track_list, settings);
+
+		CHECK(!acl_impl::get_tracks_header(*full_tracks).get_has_quantized_constant_rotations());
+		CHECK(acl_impl::get_tracks_header(*quantized_tracks).get_has_quantized_constant_rotations());
+
+		// Constant rotations use 16 bits per component instead of 32, plus their size and group bit set
+		CHECK(quantized_tracks->get_size() < full_tracks->get_size());
+
+		// Our tracks have a precision of 1mm, allow a small margin for the decompression rounding
+		CHECK(calculate_test_error(allocator, track_list, *quantized_tracks) < 0.0011F);
+
+		// Both decompress to nearly the same pose
+		decompression_context<debug_transform_decompression_settings> full_context;
+		decompression_context<debug_transform_decompression_settings> quantized_context;
+		REQUIRE(full_context.initialize(*full_tracks));
+		REQUIRE(quantized_context.initialize(*quantized_tracks));
+
+		full_context.seek(0.0F, sample_rounding_policy::none);
+		quantized_context.seek(0.0F, sample_rounding_policy::none);
+
+		rtm::qvvf full_pose[num_tracks];
+		rtm::qvvf quantized_pose[num_tracks];
+		acl_test::qvvf_pose_writer full_writer(full_pose);
+		acl_test::qvvf_pose_writer quantized_writer(quantized_pose);
+		full_context.decompress_tracks(full_writer);
+		quantized_context.decompress_tracks(quantized_writer);
+
+		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			CHECK(acl_test::qvvf_near_equal(full_pose[track_index], quantized_pose[track_index], 1.0E-3F));
+
+		allocator.deallocate(full_tracks, full_tracks->get_size());
+		allocator.deallocate(quantized_tracks, quantized_tracks->get_size());
+	}
+
+	{
+		// Only the variable format drops W and can be quantized
+		compression_settings full_settings = settings;
+		full_settings.rotation_format = rotation_format8::quatf_full;
+
+		compressed_tracks* tracks = compress_test_tracks(allocator, track_list, full_settings);
+		CHECK(!acl_impl::get_tracks_header(*tracks).get_has_quantized_constant_rotations());
+		allocator.deallocate(tracks, tracks->get_size());
+	}
+
+	{
+		// With a precision that 16 bits cannot meet, no group is quantized and the layout is unchanged
+		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			track_list[track_index].get_description().precision = 1.0E-7F;
+
+		compressed_tracks* tracks = compress_test_tracks(allocator, track_list, settings);
+
+		settings.enable_constant_rotation_quantization = false;
+		compressed_tracks* full_tracks = compress_test_tracks(allocator, track_list, settings);
+
+		CHECK(!acl_impl::get_tracks_header(*tracks).get_has_quantized_constant_rotations());
+		CHECK(tracks->get_size() == full_tracks->get_size());
+
+		allocator.deallocate(full_tracks, full_tracks->get_size());
+		allocator.deallocate(tracks, tracks->get_size());
+	}
+}
+
+TEST_CASE("rotation clip range quantization", "[compression][quantization]")
+{
+	ansi_allocator allocator;
+
+	const uint32_t num_tracks = 6;
+	const track_array_qvvf track_list = acl_test::make_test_track_list(allocator, num_tracks, 31, true);
+
+	const rotation_format8 rotation_formats[] = { rotation_format8::quatf_drop_w_variable, rotation_format8::quatf_drop_largest_variable };
+	for (const rotation_format8 rotation_format : rotation_formats)
+	{
+		compression_settings settings = get_default_compression_settings();
+		settings.rotation_format = rotation_format;
+		compressed_tracks* full_tracks = compress_test_tracks(allocator, track_list, settings);
+
+		settings.enable_rotation_clip_range_quantization = true;
+		compressed_tracks* quantized_tracks = compress_test_tracks(allocator, track_list, settings);
+
+		CHECK(!acl_impl::get_tracks_header(*full_tracks).get_has_quantized_rotation_clip_ranges());
+		CHECK(acl_impl::get_tracks_header(*quantized_tracks).get_has_quantized_rotation_clip_ranges());
+
+		// Our ranges are wider once quantized but every sample must still meet the precision
+		// Our tracks have a precision of 1mm, allow a small margin for the decompression rounding
+		CHECK(calculate_test_error(allocator, track_list, *full_tracks) < 0.0011F);
+		CHECK(calculate_test_error(allocator, track_list, *quantized_tracks) < 0.0011F);
+
+		allocator.deallocate(full_tracks, full_tracks->get_size());
+		allocator.deallocate(quantized_tracks, quantized_tracks->get_size());
+	}
+
+	compression_settings settings = get_default_compression_settings();
+	settings.enable_rotation_clip_range_quantization = true;
+
+	{
+		// Full precision rotations are not range reduced
+		settings.rotation_format = rotation_format8::quatf_full;
+		compressed_tracks* tracks = compress_test_tracks(allocator, track_list, settings);
+		CHECK(!acl_impl::get_tracks_header(*tracks).get_has_quantized_rotation_clip_ranges());
+		allocator.deallocate(tracks, tracks->get_size());
+	}
+
+	{
+		// Without animated rotations, there is no clip range to quantize
+		const track_array_qvvf static_track_list = acl_test::make_test_track_list(allocator, num_tracks, 31, false);
+		settings.rotation_format = rotation_format8::quatf_drop_w_variable;
+		compressed_tracks* tracks = compress_test_tracks(allocator, static_track_list, settings);
+		CHECK(!acl_impl::get_tracks_header(*tracks).get_has_quantized_rotation_clip_ranges());
+		allocator.deallocate(tracks, tracks->get_size());
+	}
+}
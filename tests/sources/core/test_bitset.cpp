@@ -128,3 +128,132 @@ TEST_CASE("bitset", "[core][utils]")
 	CHECK(bitset_data[0] == 0x10101001);
 	CHECK(bitset_data[1] == 0x10001011);
 }
+
+TEST_CASE("bitset bulk operations", "[core][utils]")
+{
+	// Large enough to cover the SIMD paths and their remainder
+	constexpr bitset_description desc = bitset_description::make_from_num_bits<32 * 11>();
+	constexpr uint32_t num_bits = desc.get_num_bits();
+
+	uint32_t bitset_lhs[desc.get_size()];
+	uint32_t bitset_rhs[desc.get_size()];
+	uint32_t bitset_result[desc.get_size()];
+
+	uint32_t seed = 0x12345678;
+	for (uint32_t offset = 0; offset < desc.get_size(); ++offset)
+	{
+		seed = seed * 1664525 + 1013904223;
+		bitset_lhs[offset] = seed;
+		seed = seed * 1664525 + 1013904223;
+		bitset_rhs[offset] = seed;
+	}
+
+	bitset_and(bitset_result, bitset_lhs, bitset_rhs, desc);
+	for (uint32_t offset = 0; offset < desc.get_size(); ++offset)
+		CHECK(bitset_result[offset] == (bitset_lhs[offset] & bitset_rhs[offset]));
+
+	bitset_or(bitset_result, bitset_lhs, bitset_rhs, desc);
+	for (uint32_t offset = 0; offset < desc.get_size(); ++offset)
+		CHECK(bitset_result[offset] == (bitset_lhs[offset] | bitset_rhs[offset]));
+
+	bitset_and_not(bitset_result, bitset_lhs, bitset_rhs, desc);
+	for (uint32_t offset = 0; offset < desc.get_size(); ++offset)
+		CHECK(bitset_result[offset] == (~bitset_lhs[offset] & bitset_rhs[offset]));
+
+	// Range counts must match a bit by bit count
+	uint32_t num_range_mismatches = 0;
+	for (uint32_t start_bit_index = 0; start_bit_index < num_bits; start_bit_index += 7)
+	{
+		for (uint32_t num_range_bits = 0; start_bit_index + num_range_bits <= num_bits; num_range_bits += 5)
+		{
+			uint32_t expected_num_set_bits = 0;
+			for (uint32_t bit_index = start_bit_index; bit_index < start_bit_index + num_range_bits; ++bit_index)
+				expected_num_set_bits += bitset_test(bitset_lhs, desc, bit_index) ? 1 : 0;
+
+			if (bitset_count_set_bits(bitset_lhs, desc, start_bit_index, num_range_bits) != expected_num_set_bits)
+				num_range_mismatches++;
+		}
+	}
+	CHECK(num_range_mismatches == 0);
+	CHECK(bitset_count_set_bits(bitset_lhs, desc, 0, num_bits) == bitset_count_set_bits(bitset_lhs, desc));
+
+	// Ranges can straddle words
+	bitset_reset(bitset_result, desc, false);
+	bitset_set_range(bitset_result, desc, 20, 80, true);
+	CHECK(bitset_result[0] == 0x00000FFF);
+	CHECK(bitset_result[1] == 0xFFFFFFFF);
+	CHECK(bitset_result[2] == 0xFFFFFFFF);
+	CHECK(bitset_result[3] == 0xF0000000);
+	CHECK(bitset_result[4] == 0);
+	CHECK(bitset_count_set_bits(bitset_result, desc) == 80);
+
+	bitset_set_range(bitset_result, desc, 30, 60, false);
+	CHECK(bitset_result[0] == 0x00000FFC);
+	CHECK(bitset_result[1] == 0);
+	CHECK(bitset_result[2] == 0x0000003F);
+	CHECK(bitset_result[3] == 0xF0000000);
+
+	// Find next set and clear bits
+	CHECK(bitset_find_next_set_bit(bitset_result, desc, 0) == 20);
+	CHECK(bitset_find_next_set_bit(bitset_result, desc, 29) == 29);
+	CHECK(bitset_find_next_set_bit(bitset_result, desc, 30) == 90);
+	CHECK(bitset_find_next_set_bit(bitset_result, desc, 100) == k_invalid_bit_index);
+	CHECK(bitset_find_next_set_bit(bitset_result, desc, num_bits) == k_invalid_bit_index);
+	CHECK(bitset_find_next_clear_bit(bitset_result, desc, 20) == 30);
+	CHECK(bitset_find_next_clear_bit(bitset_result, desc, 90) == 100);
+
+	bitset_result[desc.get_size() - 1] = 0x00000001;
+	CHECK(bitset_find_next_set_bit(bitset_result, desc, 100) == num_bits - 1);
+
+	bitset_reset(bitset_result, desc, true);
+	CHECK(bitset_find_next_clear_bit(bitset_result, desc, 0) == k_invalid_bit_index);
+	bitset_set(bitset_result, desc, 300, false);
+	CHECK(bitset_find_next_clear_bit(bitset_result, desc, 1) == 300);
+}
+
+TEST_CASE("bitset rank select", "[core][utils]")
+{
+	constexpr bitset_description desc = bitset_description::make_from_num_bits<32 * 19>();
+	constexpr uint32_t num_bits = desc.get_num_bits();
+
+	uint32_t bitset_data[desc.get_size()];
+	uint32_t rank_table[get_bitset_rank_table_size(desc)];
+
+	// An empty bit set has no set bits to select
+	bitset_reset(bitset_data, desc, false);
+	bitset_build_rank_table(bitset_data, desc, rank_table);
+	CHECK(bitset_rank(bitset_data, desc, rank_table, num_bits) == 0);
+	CHECK(bitset_select(bitset_data, desc, rank_table, 0) == k_invalid_bit_index);
+
+	uint32_t seed = 0x9E3779B9;
+	for (uint32_t offset = 0; offset < desc.get_size(); ++offset)
+	{
+		seed = seed * 1664525 + 1013904223;
+		bitset_data[offset] = seed & (offset % 3 == 0 ? 0x00000000 : 0xFFFFFFFF);	// Leave some words empty
+	}
+
+	bitset_build_rank_table(bitset_data, desc, rank_table);
+
+	uint32_t num_rank_mismatches = 0;
+	uint32_t num_select_mismatches = 0;
+	uint32_t num_set_bits = 0;
+	for (uint32_t bit_index = 0; bit_index < num_bits; ++bit_index)
+	{
+		if (bitset_rank(bitset_data, desc, rank_table, bit_index) != num_set_bits)
+			num_rank_mismatches++;
+
+		if (bitset_test(bitset_data, desc, bit_index))
+		{
+			if (bitset_select(bitset_data, desc, rank_table, num_set_bits) != bit_index)
+				num_select_mismatches++;
+
+			num_set_bits++;
+		}
+	}
+
+	CHECK(num_rank_mismatches == 0);
+	CHECK(num_select_mismatches == 0);
+	CHECK(bitset_rank(bitset_data, desc, rank_table, num_bits) == num_set_bits);
+	CHECK(num_set_bits == bitset_count_set_bits(bitset_data, desc));
+	CHECK(bitset_select(bitset_data, desc, rank_table, num_set_bits) == k_invalid_bit_index);
+}
@@ -0,0 +1,80 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch2/catch.hpp>
+
+#include <acl/core/impl/compressed_headers.h>
+
+using namespace acl;
+using namespace acl::acl_impl;
+
+TEST_CASE("tracks_header transform formats", "[core][headers]")
+{
+	const rotation_format8 rotation_formats[] = { rotation_format8::quatf_full, rotation_format8::quatf_drop_w_full, rotation_format8::quatf_drop_w_variable, rotation_format8::quatf_drop_largest_variable, rotation_format8::quatf_log_variable };
+	const vector_format8 vector_formats[] = { vector_format8::vector3f_full, vector_format8::vector3f_variable, vector_format8::vector3f_variable_per_component };
+
+	tracks_header header;
+	header.track_type = track_type8::qvvf;
+
+	for (rotation_format8 rotation_format : rotation_formats)
+	{
+		for (vector_format8 translation_format : vector_formats)
+		{
+			for (vector_format8 scale_format : vector_formats)
+			{
+				// Start with every bit set to make sure the formats only touch their own bits
+				header.misc_packed = 0xFFFFFFFFU;
+				header.set_has_scale(false);
+				header.set_default_scale(1);
+				header.set_rotation_format(rotation_format);
+				header.set_translation_format(translation_format);
+				header.set_scale_format(scale_format);
+
+				CHECK(header.get_rotation_format() == rotation_format);
+				CHECK(header.get_translation_format() == translation_format);
+				CHECK(header.get_scale_format() == scale_format);
+				CHECK(header.get_has_scale() == false);
+				CHECK(header.get_default_scale() == 1);
+				CHECK(header.get_has_database() == true);
+				CHECK(header.get_has_trivial_default_values() == true);
+				CHECK(header.get_has_quantized_constant_rotations() == true);
+				CHECK(header.get_has_quantized_rotation_clip_ranges() == true);
+				CHECK(header.get_is_wrap_optimized() == true);
+				CHECK(header.get_has_metadata() == true);
+
+				header.misc_packed = 0;
+				header.set_translation_format(translation_format);
+				header.set_scale_format(scale_format);
+				header.set_rotation_format(rotation_format);
+
+				CHECK(header.get_rotation_format() == rotation_format);
+				CHECK(header.get_translation_format() == translation_format);
+				CHECK(header.get_scale_format() == scale_format);
+				CHECK(header.get_has_scale() == false);
+				CHECK(header.get_has_database() == false);
+				CHECK(header.get_has_metadata() == false);
+			}
+		}
+	}
+}
@@ -0,0 +1,88 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch2/catch.hpp>
+
+#include <acl/compression/compress.h>
+#include <acl/core/ansi_allocator.h>
+#include <acl/core/compressed_pack.h>
+
+#include <cstdint>
+
+using namespace acl;
+
+TEST_CASE("compressed pack", "[core][compressed_pack]")
+{
+	ansi_allocator allocator;
+
+	{
+		compressed_pack* pack = nullptr;
+		const error_result result = build_compressed_pack(allocator, nullptr, 0, nullptr, nullptr, nullptr, pack);
+		REQUIRE(result.empty());
+		REQUIRE(pack != nullptr);
+
+		CHECK(pack->get_tag() == buffer_tag32::compressed_pack);
+		CHECK(pack->get_version() == compressed_tracks_version16::latest);
+		CHECK(pack->get_num_compressed_tracks() == 0);
+		CHECK(!pack->has_database());
+		CHECK(pack->get_database() == nullptr);
+		CHECK(pack->get_bulk_data(quality_tier::medium_importance) == nullptr);
+		CHECK(pack->get_bulk_data_size(quality_tier::lowest_importance) == 0);
+		CHECK(pack->is_valid(true).empty());
+		CHECK(is_aligned_to(pack, k_compressed_pack_bulk_data_alignment));
+
+		error_result make_result;
+		CHECK(make_compressed_pack(static_cast<const void*>(pack), &make_result) == pack);
+		CHECK(make_result.empty());
+
+		// Corrupting the content must be caught by the hash
+		uint8_t* buffer = reinterpret_cast<uint8_t*>(pack);
+		buffer[pack->get_size() - 1] ^= 0xFF;
+		CHECK(pack->is_valid(true).any());
+		CHECK(pack->is_valid(false).empty());
+
+		// Corrupting the tag must be caught without the hash
+		buffer[8] ^= 0xFF;
+		CHECK(pack->is_valid(false).any());
+		CHECK(make_compressed_pack(static_cast<const void*>(pack), &make_result) == nullptr);
+		CHECK(make_result.any());
+
+		allocator.deallocate(pack, pack->get_size());
+	}
+
+	{
+		error_result make_result;
+		CHECK(make_compressed_pack(static_cast<const void*>(nullptr), &make_result) == nullptr);
+		CHECK(make_result.any());
+	}
+
+	{
+		// Bulk data without a database is invalid
+		const uint8_t bulk_data[4] = { 0 };
+		compressed_pack* pack = nullptr;
+		const error_result result = build_compressed_pack(allocator, nullptr, 0, nullptr, bulk_data, nullptr, pack);
+		CHECK(result.any());
+		CHECK(pack == nullptr);
+	}
+}
@@ -0,0 +1,85 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch2/catch.hpp>
+
+
+#include <catch2/catch.hpp>
+
+#include <acl/core/compressed_parts.h>
+#include <rtm/scalarf.h>
+
+using namespace acl;
+using namespace rtm;
+
+TEST_CASE("compressed parts", "[core][utils]")
+{
+	{
+		CHECK(calculate_num_compressed_parts(1, 4) == 1);
+		CHECK(calculate_num_compressed_parts(4, 4) == 1);
+		CHECK(calculate_num_compressed_parts(5, 4) == 2);
+		CHECK(calculate_num_compressed_parts(7, 4) == 2);
+		CHECK(calculate_num_compressed_parts(8, 4) == 3);
+		CHECK(calculate_num_compressed_parts(10, 4) == 3);
+		CHECK(calculate_num_compressed_parts(11, 4) == 4);
+	}
+
+	{
+		// Parts share their last sample with the next part
+		CHECK(get_compressed_part_first_sample_index(0, 4) == 0);
+		CHECK(get_compressed_part_first_sample_index(1, 4) == 3);
+		CHECK(get_compressed_part_first_sample_index(2, 4) == 6);
+
+		CHECK(get_compressed_part_num_samples(0, 11, 4) == 4);
+		CHECK(get_compressed_part_num_samples(2, 11, 4) == 4);
+		CHECK(get_compressed_part_num_samples(3, 11, 4) == 2);
+	}
+
+	{
+		const float error_threshold = 1.0E-6F;
+		const float sample_rate = 30.0F;
+		const uint32_t num_parts = calculate_num_compressed_parts(10, 4);
+		float part_sample_time;
+
+		CHECK(find_compressed_part(0.0F, sample_rate, num_parts, 4, part_sample_time) == 0);
+		CHECK(scalar_near_equal(part_sample_time, 0.0F, error_threshold));
+
+		CHECK(find_compressed_part(2.5F / sample_rate, sample_rate, num_parts, 4, part_sample_time) == 0);
+		CHECK(scalar_near_equal(part_sample_time, 2.5F / sample_rate, error_threshold));
+
+		// The shared sample is found in the second part
+		CHECK(find_compressed_part(3.0F / sample_rate, sample_rate, num_parts, 4, part_sample_time) == 1);
+		CHECK(scalar_near_equal(part_sample_time, 0.0F, error_threshold));
+
+		CHECK(find_compressed_part(7.5F / sample_rate, sample_rate, num_parts, 4, part_sample_time) == 2);
+		CHECK(scalar_near_equal(part_sample_time, 1.5F / sample_rate, error_threshold));
+
+		// The last sample is found in the last part
+		CHECK(find_compressed_part(9.0F / sample_rate, sample_rate, num_parts, 4, part_sample_time) == 2);
+		CHECK(scalar_near_equal(part_sample_time, 3.0F / sample_rate, error_threshold));
+
+		// Sample times past the end are clamped by the last part
+		CHECK(find_compressed_part(2.0F, sample_rate, num_parts, 4, part_sample_time) == 2);
+	}
+}
@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch2/catch.hpp>
+
+#include <acl/core/impl/entropy_coding.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace acl;
+using namespace acl::acl_impl;
+
+static bool round_trip_rans(const std::vector<uint8_t>& input, uint32_t& out_encoded_size)
+{
+	const uint32_t input_size = uint32_t(input.size());
+
+	std::vector<uint8_t> encoded(input_size + k_rans_min_encoded_size);
+	out_encoded_size = rans_encode(input.data(), input_size, encoded.data(), uint32_t(encoded.size()));
+	if (out_encoded_size == 0)
+		return false;
+
+	std::vector<uint8_t> decoded(input_size, 0xCD);
+	if (!rans_decode(encoded.data(), out_encoded_size, decoded.data(), input_size))
+		return false;
+
+	return std::memcmp(input.data(), decoded.data(), input_size) == 0;
+}
+
+static bool round_trip_rans_compact(const std::vector<uint8_t>& input, uint32_t& out_encoded_size)
+{
+	const uint32_t input_size = uint32_t(input.size());
+
+	std::vector<uint8_t> encoded(input_size + k_rans_min_encoded_size);
+	out_encoded_size = rans_encode_compact(input.data(), input_size, encoded.data(), uint32_t(encoded.size()));
+	if (out_encoded_size == 0)
+		return false;
+
+	std::vector<uint8_t> decoded(input_size, 0xCD);
+	if (!rans_decode_compact(encoded.data(), out_encoded_size, decoded.data(), input_size))
+		return false;
+
+	return std::memcmp(input.data(), decoded.data(), input_size) == 0;
+}
+
+TEST_CASE("rans entropy coding", "[core][entropy_coding]")
+{
+	uint32_t encoded_size;
+
+	{
+		// Skewed distribution, similar to our quantized samples
+		std::vector<uint8_t> input(64 * 1024);
+		uint32_t seed = 12345;
+		for (uint8_t& value : input)
+		{
+			seed = seed * 1664525 + 1013904223;
+			const uint32_t random = seed >> 24;
+			value = random < 192 ? uint8_t(random & 0x03) : uint8_t(random);
+		}
+
+		CHECK(round_trip_rans(input, encoded_size));
+		CHECK(encoded_size < input.size());
+	}
+
+	{
+		// A single symbol
+		std::vector<uint8_t> input(4096, 0x7F);
+		CHECK(round_trip_rans(input, encoded_size));
+		CHECK(encoded_size == k_rans_min_encoded_size);
+	}
+
+	{
+		// Every symbol is present at least once
+		std::vector<uint8_t> input(1024);
+		for (uint32_t value_index = 0; value_index < input.size(); ++value_index)
+			input[value_index] = uint8_t(value_index * 7);
+
+		CHECK(round_trip_rans(input, encoded_size));
+	}
+
+	{
+		// Not enough room to encode
+		std::vector<uint8_t> input(1024);
+		for (uint32_t value_index = 0; value_index < input.size(); ++value_index)
+			input[value_index] = uint8_t(value_index * 7);
+
+		std::vector<uint8_t> encoded(input.size() / 2);
+		CHECK(rans_encode(input.data(), uint32_t(input.size()), encoded.data(), uint32_t(encoded.size())) == 0);
+	}
+
+	{
+		// Truncated data must be rejected
+		std::vector<uint8_t> input(4096);
+		for (uint32_t value_index = 0; value_index < input.size(); ++value_index)
+			input[value_index] = uint8_t(value_index % 5);
+
+		std::vector<uint8_t> encoded(input.size() + k_rans_min_encoded_size);
+		encoded_size = rans_encode(input.data(), uint32_t(input.size()), encoded.data(), uint32_t(encoded.size()));
+		REQUIRE(encoded_size > k_rans_min_encoded_size);
+
+		std::vector<uint8_t> decoded(input.size());
+		CHECK(!rans_decode(encoded.data(), encoded_size - 1, decoded.data(), uint32_t(decoded.size())));
+		CHECK(!rans_decode(encoded.data(), k_rans_min_encoded_size - 1, decoded.data(), uint32_t(decoded.size())));
+	}
+
+	{
+		// Malformed frequency tables must be rejected
+		std::vector<uint8_t> input(1024);
+		for (uint32_t value_index = 0; value_index < input.size(); ++value_index)
+			input[value_index] = uint8_t(value_index % 3);
+
+		std::vector<uint8_t> encoded(input.size() + k_rans_min_encoded_size);
+		encoded_size = rans_encode(input.data(), uint32_t(input.size()), encoded.data(), uint32_t(encoded.size()));
+		REQUIRE(encoded_size > k_rans_min_encoded_size);
+
+		const uint8_t* stream = encoded.data() + k_rans_frequency_table_size;
+		const uint32_t stream_size = encoded_size - k_rans_frequency_table_size;
+		std::vector<uint8_t> decoded(input.size());
+
+		uint32_t frequencies[k_rans_num_symbols] = { 0 };
+		frequencies[0] = k_rans_probability_scale;
+		frequencies[1] = 1;	// Adds up to more than our scale
+		CHECK(!rans_decode_stream(stream, stream_size, frequencies, decoded.data(), uint32_t(decoded.size())));
+
+		frequencies[0] = k_rans_probability_scale + 1;	// A single frequency larger than our scale
+		frequencies[1] = 0;
+		CHECK(!rans_decode_stream(stream, stream_size, frequencies, decoded.data(), uint32_t(decoded.size())));
+
+		frequencies[0] = k_rans_probability_scale / 2;	// Adds up to less than our scale
+		CHECK(!rans_decode_stream(stream, stream_size, frequencies, decoded.data(), uint32_t(decoded.size())));
+	}
+
+	{
+		// Compact frequency tables
+		std::vector<uint8_t> input(256);
+		for (uint32_t value_index = 0; value_index < input.size(); ++value_index)
+			input[value_index] = value_index < 200 ? uint8_t(0x3F) : uint8_t(0x40 + (value_index % 3));
+
+		CHECK(round_trip_rans_compact(input, encoded_size));
+		CHECK(encoded_size < 64);
+
+		std::vector<uint8_t> single_symbol(4096, 0xFF);
+		CHECK(round_trip_rans_compact(single_symbol, encoded_size));
+
+		std::vector<uint8_t> every_symbol(1024);
+		for (uint32_t value_index = 0; value_index < every_symbol.size(); ++value_index)
+			every_symbol[value_index] = uint8_t(value_index * 7);
+
+		CHECK(round_trip_rans_compact(every_symbol, encoded_size));
+
+		std::vector<uint8_t> encoded(input.size() + k_rans_min_encoded_size);
+		encoded_size = rans_encode_compact(input.data(), uint32_t(input.size()), encoded.data(), uint32_t(encoded.size()));
+		REQUIRE(encoded_size != 0);
+
+		std::vector<uint8_t> decoded(input.size());
+		CHECK(!rans_decode_compact(encoded.data(), encoded_size - 1, decoded.data(), uint32_t(decoded.size())));
+		CHECK(!rans_decode_compact(encoded.data(), 1, decoded.data(), uint32_t(decoded.size())));
+	}
+}
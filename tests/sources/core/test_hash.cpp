@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch2/catch.hpp>
+
+#include <acl/core/hash.h>
+#include <acl/core/impl/compressed_headers.h>
+
+#include <cstdint>
+#include <cstring>
+
+using namespace acl;
+
+TEST_CASE("hash64_fast", "[core][hash]")
+{
+	// Reference XXH64 values
+	CHECK(hash64_fast(nullptr, 0) == 0xEF46DB3751D8E999ULL);
+	CHECK(hash64_fast("a", 1) == 0xD24EC4F1A98C6E5BULL);
+
+	const char* long_str = "Nobody inspects the spammish repetition";
+	CHECK(hash64_fast(long_str, std::strlen(long_str)) == 0xFBCEA83C8A378BF1ULL);
+
+	// Every tail length must contribute to the hash
+	uint8_t buffer[67];
+	for (uint32_t i = 0; i < 67; ++i)
+		buffer[i] = uint8_t(i * 7);
+
+	for (uint32_t size = 1; size <= 67; ++size)
+	{
+		const uint64_t hash_value = hash64_fast(&buffer[0], size);
+		CHECK(hash_value != hash64_fast(&buffer[0], size - 1));
+
+		buffer[size - 1] ^= 0x10;
+		CHECK(hash_value != hash64_fast(&buffer[0], size));
+		buffer[size - 1] ^= 0x10;
+		CHECK(hash_value == hash64_fast(&buffer[0], size));
+	}
+
+	// The seed changes the hash
+	CHECK(hash64_fast(&buffer[0], 40, 1) != hash64_fast(&buffer[0], 40, 0));
+}
+
+TEST_CASE("hash_raw_buffer", "[core][hash]")
+{
+	uint8_t buffer[100];
+	for (uint32_t i = 0; i < 100; ++i)
+		buffer[i] = uint8_t(i * 13);
+
+	// Older versions retain FNV 1a
+	CHECK(acl_impl::hash_raw_buffer(compressed_tracks_version16::v02_00_00, &buffer[0], 100) == hash32(&buffer[0], 100));
+	CHECK(acl_impl::hash_raw_buffer(compressed_tracks_version16::v02_01_99_1, &buffer[0], 100) == hash32(&buffer[0], 100));
+
+	const uint64_t hash_value = hash64_fast(&buffer[0], 100);
+	CHECK(acl_impl::hash_raw_buffer(compressed_tracks_version16::v02_01_99_2, &buffer[0], 100) == uint32_t(hash_value ^ (hash_value >> 32)));
+	CHECK(acl_impl::hash_raw_buffer(compressed_tracks_version16::latest, &buffer[0], 100) == acl_impl::hash_raw_buffer(compressed_tracks_version16::v02_01_99_2, &buffer[0], 100));
+}
+
+TEST_CASE("crc32c", "[core][hash]")
+{
+	// Reference CRC32C values
+	CHECK(crc32c(nullptr, 0) == 0);
+	CHECK(crc32c("123456789", 9) == 0xE3069283U);
+
+	uint8_t buffer[67];
+	for (uint32_t i = 0; i < 67; ++i)
+		buffer[i] = uint8_t(i * 7);
+
+	// Every byte must contribute, including the tail that doesn't fill a full word
+	for (uint32_t size = 1; size <= 67; ++size)
+	{
+		const uint32_t checksum = crc32c(&buffer[0], size);
+
+		buffer[size - 1] ^= 0x10;
+		CHECK(checksum != crc32c(&buffer[0], size));
+		buffer[size - 1] ^= 0x10;
+		CHECK(checksum == crc32c(&buffer[0], size));
+	}
+
+	// Chaining through the seed matches a single pass
+	CHECK(crc32c(&buffer[0], 67) == crc32c(&buffer[21], 46, crc32c(&buffer[0], 21)));
+}
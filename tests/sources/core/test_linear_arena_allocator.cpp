@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch2/catch.hpp>
+
+#include <acl/core/ansi_allocator.h>
+#include <acl/core/linear_arena_allocator.h>
+#include <acl/core/memory_utils.h>
+
+#include <cstdint>
+
+using namespace acl;
+
+TEST_CASE("linear arena allocator", "[core][memory]")
+{
+	ansi_allocator backing_allocator;
+
+	{
+		linear_arena_allocator allocator(backing_allocator, 1024);
+		CHECK(allocator.get_reserved_size() == 0);
+		CHECK(backing_allocator.get_allocation_count() == 0);
+
+		void* ptr0 = allocator.allocate(32);
+		CHECK(ptr0 != nullptr);
+		CHECK(backing_allocator.get_allocation_count() == 1);
+		CHECK(allocator.get_reserved_size() == 1024);
+
+		void* ptr1 = allocator.allocate(48, 256);
+		CHECK(is_aligned_to(ptr1, 256));
+		CHECK(ptr1 != ptr0);
+		CHECK(backing_allocator.get_allocation_count() == 1);
+
+		// Deallocation is a no-op
+		allocator.deallocate(ptr1, 48);
+		CHECK(backing_allocator.get_allocation_count() == 1);
+
+		const linear_arena_allocator::marker position = allocator.get_marker();
+		void* ptr2 = allocator.allocate(16);
+		allocator.reset(position);
+		void* ptr3 = allocator.allocate(16);
+		CHECK(ptr2 == ptr3);
+
+		// Large allocations get a dedicated block
+		void* ptr4 = allocator.allocate(4096);
+		CHECK(ptr4 != nullptr);
+		CHECK(backing_allocator.get_allocation_count() == 2);
+
+		// Resetting retains the blocks
+		allocator.reset();
+		CHECK(allocator.get_reserved_size() > 1024);
+		void* ptr5 = allocator.allocate(32);
+		CHECK(ptr5 == ptr0);
+		CHECK(backing_allocator.get_allocation_count() == 2);
+
+		// Blocks retained from a previous reset are reused
+		void* ptr6 = allocator.allocate(2048);
+		CHECK(ptr6 != nullptr);
+		CHECK(backing_allocator.get_allocation_count() == 2);
+
+		// Resetting to an empty marker rewinds everything
+		allocator.reset(linear_arena_allocator::marker());
+		CHECK(allocator.allocate(32) == ptr0);
+	}
+
+	CHECK(backing_allocator.get_allocation_count() == 0);
+}
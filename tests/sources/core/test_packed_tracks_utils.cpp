@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch2/catch.hpp>
+
+#include <acl/core/impl/packed_tracks_utils.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace acl;
+using namespace acl::acl_impl;
+
+TEST_CASE("packed tracks value planes", "[core][packed_tracks]")
+{
+	// Odd sizes leave trailing bytes that are appended to the last plane
+	for (uint32_t size : { 0U, 3U, 4U, 61U, 64U, 130U })
+	{
+		std::vector<uint8_t> input(size);
+		for (uint32_t value_index = 0; value_index < size; ++value_index)
+			input[value_index] = uint8_t(value_index * 13 + 7);
+
+		std::vector<uint8_t> planes(size);
+		uint8_t* plane_ptrs[4];
+		uint32_t plane_offset = 0;
+		for (uint32_t plane_index = 0; plane_index < 4; ++plane_index)
+		{
+			plane_ptrs[plane_index] = planes.data() + plane_offset;
+			plane_offset += get_value_plane_size(size, plane_index);
+		}
+
+		REQUIRE(plane_offset == size);
+
+		split_value_planes(input.data(), size, plane_ptrs);
+
+		for (uint32_t value_index = 0; value_index < size / 4; ++value_index)
+		{
+			CHECK(plane_ptrs[0][value_index] == input[value_index * 4 + 0]);
+			CHECK(plane_ptrs[3][value_index] == input[value_index * 4 + 3]);
+		}
+
+		std::vector<uint8_t> output(size, 0xCD);
+		const uint8_t* const const_plane_ptrs[4] = { plane_ptrs[0], plane_ptrs[1], plane_ptrs[2], plane_ptrs[3] };
+		merge_value_planes(const_plane_ptrs, size, output.data());
+
+		CHECK(std::memcmp(input.data(), output.data(), size) == 0);
+	}
+}
+
+TEST_CASE("packed tracks bit matrix", "[core][packed_tracks]")
+{
+	// Rows of 11 bits leave padding bits in the last byte that must be retained
+	const uint32_t num_rows = 13;
+	const uint32_t num_row_bits = 11;
+	const uint32_t size = ((num_rows * num_row_bits) + 7) / 8;
+
+	std::vector<uint8_t> input(size);
+	for (uint32_t value_index = 0; value_index < size; ++value_index)
+		input[value_index] = uint8_t(value_index * 29 + 3);
+
+	std::vector<uint8_t> transposed(size);
+	transpose_bit_matrix(input.data(), size, num_rows, num_row_bits, transposed.data());
+
+	// The first bit of every row comes first
+	for (uint32_t row_index = 0; row_index < num_rows; ++row_index)
+		CHECK(read_packed_bit(transposed.data(), row_index) == read_packed_bit(input.data(), uint64_t(row_index) * num_row_bits));
+
+	std::vector<uint8_t> output(size);
+	untranspose_bit_matrix(transposed.data(), size, num_rows, num_row_bits, output.data());
+
+	CHECK(std::memcmp(input.data(), output.data(), size) == 0);
+}
@@ -0,0 +1,95 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch2/catch.hpp>
+
+#include <acl/core/ansi_allocator.h>
+#include <acl/core/memory_utils.h>
+#include <acl/core/pool_allocator.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace acl;
+
+TEST_CASE("pool allocator", "[core][memory]")
+{
+	ansi_allocator backing_allocator;
+
+	{
+		pool_allocator allocator(backing_allocator);
+		CHECK(allocator.get_reserved_size() == 0);
+
+		void* ptr0 = allocator.allocate(24);
+		CHECK(ptr0 != nullptr);
+		CHECK(allocator.get_reserved_size() == pool_allocator::k_slab_size);
+
+		// Freed blocks are reused by the same size class
+		allocator.deallocate(ptr0, 24);
+		void* ptr1 = allocator.allocate(32);
+		CHECK(ptr1 == ptr0);
+
+		// A larger alignment uses a larger size class
+		void* ptr2 = allocator.allocate(24, 256);
+		CHECK(is_aligned_to(ptr2, 256));
+		allocator.deallocate(ptr2, 24);
+
+		// Large allocations go through the backing allocator
+		const int32_t num_backing_allocations = backing_allocator.get_allocation_count();
+		void* ptr3 = allocator.allocate(64 * 1024);
+		CHECK(ptr3 != nullptr);
+		CHECK(backing_allocator.get_allocation_count() == num_backing_allocations + 1);
+		allocator.deallocate(ptr3, 64 * 1024);
+		CHECK(backing_allocator.get_allocation_count() == num_backing_allocations);
+
+		allocator.deallocate(ptr1, 32);
+	}
+
+	{
+		pool_allocator allocator(backing_allocator);
+
+		constexpr uint32_t k_num_blocks = 1000;
+		std::vector<void*> blocks;
+		for (uint32_t block_index = 0; block_index < k_num_blocks; ++block_index)
+			blocks.push_back(allocator.allocate(48));
+
+		// Blocks freed from another thread are returned to the thread that allocated them
+		std::thread thread([&]()
+			{
+				for (void* block : blocks)
+					allocator.deallocate(block, 48);
+			});
+		thread.join();
+
+		const size_t reserved_size = allocator.get_reserved_size();
+		void* ptr = allocator.allocate(48);
+		CHECK(std::find(blocks.begin(), blocks.end(), ptr) != blocks.end());
+		CHECK(allocator.get_reserved_size() == reserved_size);
+		allocator.deallocate(ptr, 48);
+	}
+
+	CHECK(backing_allocator.get_allocation_count() == 0);
+}
@@ -52,3 +52,19 @@ TEST_CASE("misc utils", "[core][utils]")
 	CHECK(scalar_near_equal(calculate_finite_duration(31, 30.0F), 1.0F, 1.0E-8F));
 	CHECK(scalar_near_equal(calculate_finite_duration(9, 8.0F), 1.0F, 1.0E-8F));
 }
+
+TEST_CASE("advance sample time", "[core][utils]")
+{
+	CHECK(scalar_near_equal(advance_sample_time(0.25F, 0.5F, 1.0F, sample_looping_policy::clamp), 0.75F, 1.0E-6F));
+	CHECK(advance_sample_time(0.75F, 0.5F, 1.0F, sample_looping_policy::clamp) == 1.0F);
+	CHECK(advance_sample_time(0.25F, -0.5F, 1.0F, sample_looping_policy::clamp) == 0.0F);
+
+	CHECK(scalar_near_equal(advance_sample_time(0.25F, 0.5F, 1.0F, sample_looping_policy::wrap), 0.75F, 1.0E-6F));
+	CHECK(scalar_near_equal(advance_sample_time(0.75F, 0.5F, 1.0F, sample_looping_policy::wrap), 0.25F, 1.0E-6F));
+	CHECK(scalar_near_equal(advance_sample_time(0.25F, -0.5F, 1.0F, sample_looping_policy::wrap), 0.75F, 1.0E-6F));
+	CHECK(scalar_near_equal(advance_sample_time(0.25F, 3.5F, 1.0F, sample_looping_policy::wrap), 0.75F, 1.0E-5F));
+	CHECK(scalar_near_equal(advance_sample_time(0.25F, -3.5F, 1.0F, sample_looping_policy::wrap), 0.75F, 1.0E-5F));
+	CHECK(advance_sample_time(0.0F, 1.0F, 1.0F, sample_looping_policy::wrap) == 1.0F);
+
+	CHECK(advance_sample_time(0.0F, 0.5F, 0.0F, sample_looping_policy::wrap) == 0.0F);
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <acl/compression/compress.h>
+#include <acl/compression/track_array.h>
+#include <acl/compression/transform_error_metrics.h>
+#include <acl/core/compressed_tracks.h>
+#include <acl/core/iallocator.h>
+#include <acl/core/track_writer.h>
+
+#include <rtm/qvvf.h>
+#include <rtm/quatf.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+namespace acl_test
+{
+	constexpr float k_test_sample_rate = 30.0F;
+
+	//////////////////////////////////////////////////////////////////////////
+	// Builds a chain of transform tracks where every track is parented to the previous one.
+	// When animated, every sub-track of every track varies over time, otherwise every
+	// sample is equal to the first one and the whole clip is a static pose.
+	inline acl::track_array_qvvf make_test_track_list(acl::iallocator& allocator, uint32_t num_tracks, uint32_t num_samples, bool is_animated)
+	{
+		acl::track_array_qvvf track_list(allocator, num_tracks);
+
+		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+		{
+			acl::track_desc_transformf desc;
+			desc.output_index = track_index;
+			desc.parent_index = track_index == 0 ? acl::k_invalid_track_index : (track_index - 1);
+			desc.precision = 0.001F;
+
+			track_list[track_index] = acl::track_qvvf::make_reserve(desc, allocator, num_samples, k_test_sample_rate);
+
+			const float track_offset = float(track_index) * 0.25F;
+			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			{
+				const float t = is_animated ? (float(sample_index) / float(num_samples)) : 0.0F;
+
+				rtm::qvvf& transform = track_list[track_index][sample_index];
+				transform.rotation = rtm::quat_from_euler(0.1F + track_offset + t, 0.5F - t * 0.5F, 1.2F + track_offset * t);
+				transform.translation = rtm::vector_set(1.0F + track_offset, 0.6F + t * 2.0F, -2.3F * t + track_offset);
+				transform.scale = rtm::vector_set(1.0F + t * 0.5F, 1.0F + track_offset * t, 1.0F - t * 0.25F);
+			}
+		}
+
+		return track_list;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Compresses the track list with the default settings and the provided formats.
+	// The parent track indices are always included in the metadata.
+	// Returns nullptr on failure, the caller owns the returned memory otherwise.
+	inline acl::compressed_tracks* compress_test_track_list(acl::iallocator& allocator, const acl::track_array_qvvf& track_list,
+		acl::rotation_format8 rotation_format, acl::vector_format8 vector_format)
+	{
+		acl::qvvf_transform_error_metric error_metric;
+
+		acl::compression_settings settings = acl::get_default_compression_settings();
+		settings.rotation_format = rotation_format;
+		settings.translation_format = vector_format;
+		settings.scale_format = vector_format;
+		settings.error_metric = &error_metric;
+		settings.metadata.include_parent_track_indices = true;
+
+		acl::output_stats stats;
+		acl::compressed_tracks* compressed_tracks = nullptr;
+		const acl::error_result result = acl::compress_track_list(allocator, track_list, settings, compressed_tracks, stats);
+		if (result.any())
+			return nullptr;
+
+		return compressed_tracks;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns whether two transforms are nearly equal.
+	// Rotations are compared by rotating a point to be insensitive to the quaternion sign.
+	inline bool qvvf_near_equal(const rtm::qvvf& lhs, const rtm::qvvf& rhs, float threshold)
+	{
+		const rtm::vector4f point = rtm::vector_set(1.0F, 2.0F, 3.0F);
+		const rtm::vector4f lhs_point = rtm::quat_mul_vector3(point, lhs.rotation);
+		const rtm::vector4f rhs_point = rtm::quat_mul_vector3(point, rhs.rotation);
+
+		return rtm::vector_all_near_equal3(lhs_point, rhs_point, threshold)
+			&& rtm::vector_all_near_equal3(lhs.translation, rhs.translation, threshold)
+			&& rtm::vector_all_near_equal3(lhs.scale, rhs.scale, threshold);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes every transform track into a caller provided pose, one rtm::qvvf per track.
+	struct qvvf_pose_writer final : public acl::track_writer
+	{
+		explicit qvvf_pose_writer(rtm::qvvf* pose_) : pose(pose_) {}
+
+		void RTM_SIMD_CALL write_rotation(uint32_t track_index, rtm::quatf_arg0 rotation) { pose[track_index].rotation = rotation; }
+		void RTM_SIMD_CALL write_translation(uint32_t track_index, rtm::vector4f_arg0 translation) { pose[track_index].translation = translation; }
+		void RTM_SIMD_CALL write_scale(uint32_t track_index, rtm::vector4f_arg0 scale) { pose[track_index].scale = scale; }
+
+		static constexpr bool supports_read_back() { return true; }
+
+		rtm::quatf RTM_SIMD_CALL read_rotation(uint32_t track_index) const { return pose[track_index].rotation; }
+		rtm::vector4f RTM_SIMD_CALL read_translation(uint32_t track_index) const { return pose[track_index].translation; }
+		rtm::vector4f RTM_SIMD_CALL read_scale(uint32_t track_index) const { return pose[track_index].scale; }
+
+		rtm::qvvf* pose;
+	};
+}
@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch2/catch.hpp>
+
+#include "decompression_test_utils.h"
+
+#include <acl/compression/compress.h>
+#include <acl/compression/transform_error_metrics.h>
+#include <acl/core/additive_utils.h>
+#include <acl/core/ansi_allocator.h>
+#include <acl/decompression/decompress.h>
+
+#include <rtm/qvvf.h>
+
+#include <cstdint>
+
+using namespace acl;
+
+TEST_CASE("additive decompression", "[decompression][additive]")
+{
+	ansi_allocator allocator;
+
+	const uint32_t num_tracks = 4;
+	const uint32_t num_samples = 11;
+
+	const track_array_qvvf additive_track_list = acl_test::make_test_track_list(allocator, num_tracks, num_samples, true);
+	const track_array_qvvf base_track_list = acl_test::make_test_track_list(allocator, num_tracks, 2, false);
+
+	// The base pose used at runtime does not have to match the additive base used when compressing
+	rtm::qvvf base_pose[num_tracks];
+	for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+		base_pose[track_index] = rtm::qvv_set(rtm::quat_from_euler(0.3F, -0.2F, float(track_index) * 0.1F), rtm::vector_set(0.5F, float(track_index), -1.0F), rtm::vector_set(1.5F, 1.0F, 0.75F));
+
+	const additive_clip_format8 additive_formats[] = { additive_clip_format8::relative, additive_clip_format8::additive0, additive_clip_format8::additive1 };
+	for (const additive_clip_format8 additive_format : additive_formats)
+	{
+		qvvf_transform_error_metric error_metric;
+
+		compression_settings settings = get_default_compression_settings();
+		settings.rotation_format = rotation_format8::quatf_full;
+		settings.translation_format = vector_format8::vector3f_full;
+		settings.scale_format = vector_format8::vector3f_full;
+		settings.error_metric = &error_metric;
+
+		output_stats stats;
+		compressed_tracks* tracks = nullptr;
+		const error_result result = compress_track_list(allocator, additive_track_list, settings, base_track_list, additive_format, tracks, stats);
+		REQUIRE(result.empty());
+		REQUIRE(tracks != nullptr);
+
+		decompression_context<debug_transform_decompression_settings> context;
+		REQUIRE(context.initialize(*tracks));
+
+		rtm::qvvf pose[num_tracks];
+		acl_test::qvvf_pose_writer writer(pose);
+
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		{
+			context.seek(float(sample_index) / acl_test::k_test_sample_rate, sample_rounding_policy::nearest);
+			context.decompress_additive_tracks(additive_format, base_pose, writer);
+
+			for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			{
+				const rtm::qvvf expected = apply_additive_to_base(additive_format, base_pose[track_index], additive_track_list[track_index][sample_index]);
+				CHECK(acl_test::qvvf_near_equal(pose[track_index], expected, 1.0E-3F));
+			}
+		}
+
+		allocator.deallocate(tracks, tracks->get_size());
+	}
+}
@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch2/catch.hpp>
+
+#include "decompression_test_utils.h"
+
+#include <acl/core/ansi_allocator.h>
+#include <acl/core/bitset.h>
+#include <acl/decompression/decompress.h>
+
+#include <rtm/qvvf.h>
+
+#include <cstdint>
+
+using namespace acl;
+
+TEST_CASE("batch decompression", "[decompression][batch]")
+{
+	ansi_allocator allocator;
+
+	constexpr uint32_t k_num_contexts = 3;
+	const uint32_t num_tracks = 4;
+	const uint32_t num_samples[k_num_contexts] = { 11, 7, 23 };
+
+	track_array_qvvf track_lists[k_num_contexts];
+	compressed_tracks* tracks[k_num_contexts];
+	decompression_context<debug_transform_decompression_settings> contexts[k_num_contexts];
+	decompression_context<debug_transform_decompression_settings>* context_ptrs[k_num_contexts];
+
+	for (uint32_t context_index = 0; context_index < k_num_contexts; ++context_index)
+	{
+		track_lists[context_index] = acl_test::make_test_track_list(allocator, num_tracks, num_samples[context_index], true);
+
+		tracks[context_index] = acl_test::compress_test_track_list(allocator, track_lists[context_index], rotation_format8::quatf_full, vector_format8::vector3f_full);
+		REQUIRE(tracks[context_index] != nullptr);
+
+		context_ptrs[context_index] = &contexts[context_index];
+	}
+
+	CHECK(initialize_batch(context_ptrs, tracks, k_num_contexts) == k_num_contexts);
+
+	rtm::qvvf poses[k_num_contexts][num_tracks];
+	acl_test::qvvf_pose_writer writers[k_num_contexts] = { acl_test::qvvf_pose_writer(poses[0]), acl_test::qvvf_pose_writer(poses[1]), acl_test::qvvf_pose_writer(poses[2]) };
+	acl_test::qvvf_pose_writer* writer_ptrs[k_num_contexts] = { &writers[0], &writers[1], &writers[2] };
+
+	// Every context is sampled at a different sample
+	const uint32_t sample_indices[k_num_contexts] = { 3, 6, 20 };
+	float sample_times[k_num_contexts];
+	for (uint32_t context_index = 0; context_index < k_num_contexts; ++context_index)
+		sample_times[context_index] = float(sample_indices[context_index]) / acl_test::k_test_sample_rate;
+
+	decompress_tracks_batch(context_ptrs, sample_times, sample_rounding_policy::nearest, writer_ptrs, k_num_contexts);
+
+	for (uint32_t context_index = 0; context_index < k_num_contexts; ++context_index)
+	{
+		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			CHECK(acl_test::qvvf_near_equal(poses[context_index][track_index], track_lists[context_index][track_index][sample_indices[context_index]], 1.0E-4F));
+	}
+
+	// Only the masked tracks are written out
+	const rtm::qvvf sentinel = rtm::qvv_set(rtm::quat_identity(), rtm::vector_set(-100.0F), rtm::vector_set(-100.0F));
+	for (uint32_t context_index = 0; context_index < k_num_contexts; ++context_index)
+	{
+		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			poses[context_index][track_index] = sentinel;
+
+		sample_times[context_index] = 0.0F;
+	}
+
+	const bitset_description mask_desc = bitset_description::make_from_num_bits(num_tracks);
+	uint32_t track_mask[1];
+	bitset_reset(track_mask, mask_desc, false);
+	bitset_set(track_mask, mask_desc, 1, true);
+	bitset_set(track_mask, mask_desc, 2, true);
+
+	decompress_tracks_batch(context_ptrs, sample_times, sample_rounding_policy::nearest, mask_desc, track_mask, writer_ptrs, k_num_contexts);
+
+	for (uint32_t context_index = 0; context_index < k_num_contexts; ++context_index)
+	{
+		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+		{
+			if (bitset_test(track_mask, mask_desc, track_index))
+				CHECK(acl_test::qvvf_near_equal(poses[context_index][track_index], track_lists[context_index][track_index][0], 1.0E-4F));
+			else
+				CHECK(acl_test::qvvf_near_equal(poses[context_index][track_index], sentinel, 0.0F));
+		}
+	}
+
+	for (uint32_t context_index = 0; context_index < k_num_contexts; ++context_index)
+		allocator.deallocate(tracks[context_index], tracks[context_index]->get_size());
+}
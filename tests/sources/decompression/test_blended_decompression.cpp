@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch2/catch.hpp>
+
+#include "decompression_test_utils.h"
+
+#include <acl/core/ansi_allocator.h>
+#include <acl/decompression/decompress.h>
+
+#include <rtm/qvvf.h>
+#include <rtm/quatf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+using namespace acl;
+
+TEST_CASE("blended decompression", "[decompression][blend]")
+{
+	ansi_allocator allocator;
+
+	const uint32_t num_tracks = 4;
+	const uint32_t num_samples = 11;
+
+	// Blend an animated clip with a static pose
+	const track_array_qvvf track_list_a = acl_test::make_test_track_list(allocator, num_tracks, num_samples, true);
+	const track_array_qvvf track_list_b = acl_test::make_test_track_list(allocator, num_tracks, 2, false);
+
+	compressed_tracks* tracks_a = acl_test::compress_test_track_list(allocator, track_list_a, rotation_format8::quatf_full, vector_format8::vector3f_full);
+	compressed_tracks* tracks_b = acl_test::compress_test_track_list(allocator, track_list_b, rotation_format8::quatf_full, vector_format8::vector3f_full);
+	REQUIRE(tracks_a != nullptr);
+	REQUIRE(tracks_b != nullptr);
+
+	decompression_context<debug_transform_decompression_settings> context_a;
+	decompression_context<debug_transform_decompression_settings> context_b;
+	REQUIRE(context_a.initialize(*tracks_a));
+	REQUIRE(context_b.initialize(*tracks_b));
+
+	rtm::qvvf pose[num_tracks];
+	acl_test::qvvf_pose_writer writer(pose);
+
+	const uint32_t sample_index = 7;
+	context_a.seek(float(sample_index) / acl_test::k_test_sample_rate, sample_rounding_policy::nearest);
+	context_b.seek(0.0F, sample_rounding_policy::nearest);
+
+	const float blend_alphas[] = { 0.0F, 0.25F, 1.0F };
+	for (const float blend_alpha : blend_alphas)
+	{
+		decompress_blended_tracks(context_a, context_b, blend_alpha, writer);
+
+		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+		{
+			const rtm::qvvf& transform_a = track_list_a[track_index][sample_index];
+			const rtm::qvvf& transform_b = track_list_b[track_index][0];
+
+			const rtm::qvvf expected = rtm::qvv_set(
+				rtm::quat_lerp(transform_a.rotation, transform_b.rotation, blend_alpha),
+				rtm::vector_lerp(transform_a.translation, transform_b.translation, blend_alpha),
+				rtm::vector_lerp(transform_a.scale, transform_b.scale, blend_alpha));
+
+			CHECK(acl_test::qvvf_near_equal(pose[track_index], expected, 1.0E-3F));
+		}
+	}
+
+	allocator.deallocate(tracks_a, tracks_a->get_size());
+	allocator.deallocate(tracks_b, tracks_b->get_size());
+}
@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch2/catch.hpp>
+
+#include "decompression_test_utils.h"
+
+#include <acl/core/ansi_allocator.h>
+#include <acl/core/bitset.h>
+#include <acl/decompression/decompress.h>
+
+#include <rtm/qvvf.h>
+
+#include <cstdint>
+
+using namespace acl;
+
+TEST_CASE("masked decompression", "[decompression][mask]")
+{
+	ansi_allocator allocator;
+
+	// Enough tracks to span several groups of 4 animated sub-tracks
+	const uint32_t num_tracks = 10;
+	const uint32_t num_samples = 11;
+	const uint32_t sample_index = 5;
+
+	const track_array_qvvf track_list = acl_test::make_test_track_list(allocator, num_tracks, num_samples, true);
+
+	compressed_tracks* tracks = acl_test::compress_test_track_list(allocator, track_list, rotation_format8::quatf_drop_w_variable, vector_format8::vector3f_variable);
+	REQUIRE(tracks != nullptr);
+
+	decompression_context<debug_transform_decompression_settings> context;
+	REQUIRE(context.initialize(*tracks));
+	context.seek(float(sample_index) / acl_test::k_test_sample_rate, sample_rounding_policy::nearest);
+
+	const rtm::qvvf sentinel = rtm::qvv_set(rtm::quat_identity(), rtm::vector_set(-100.0F), rtm::vector_set(-100.0F));
+
+	rtm::qvvf pose[num_tracks];
+	acl_test::qvvf_pose_writer writer(pose);
+
+	const bitset_description mask_desc = bitset_description::make_from_num_bits(num_tracks);
+	uint32_t track_mask[1];
+	uint32_t empty_mask[1];
+	bitset_reset(empty_mask, mask_desc, false);
+
+	// Variable formats are lossy, our tracks have a precision of 1mm
+	const float threshold = 0.05F;
+
+	{
+		// Only the tracks set in the mask are written out, every other group of 4 tracks is skipped entirely
+		for (rtm::qvvf& transform : pose)
+			transform = sentinel;
+
+		bitset_reset(track_mask, mask_desc, false);
+		bitset_set(track_mask, mask_desc, 1, true);
+		bitset_set(track_mask, mask_desc, 9, true);
+
+		context.decompress_tracks(mask_desc, track_mask, writer);
+
+		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+		{
+			if (bitset_test(track_mask, mask_desc, track_index))
+				CHECK(acl_test::qvvf_near_equal(pose[track_index], track_list[track_index][sample_index], threshold));
+			else
+				CHECK(acl_test::qvvf_near_equal(pose[track_index], sentinel, 0.0F));
+		}
+	}
+
+	{
+		// Per sub-track masks: rotations of even tracks, every translation, and no scale
+		for (rtm::qvvf& transform : pose)
+			transform = sentinel;
+
+		bitset_reset(track_mask, mask_desc, false);
+		for (uint32_t track_index = 0; track_index < num_tracks; track_index += 2)
+			bitset_set(track_mask, mask_desc, track_index, true);
+
+		context.decompress_tracks(mask_desc, track_mask, nullptr, empty_mask, writer);
+
+		const rtm::vector4f point = rtm::vector_set(1.0F, 2.0F, 3.0F);
+		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+		{
+			const rtm::qvvf& raw_transform = track_list[track_index][sample_index];
+
+			const rtm::quatf expected_rotation = bitset_test(track_mask, mask_desc, track_index) ? raw_transform.rotation : sentinel.rotation;
+			const float rotation_threshold = bitset_test(track_mask, mask_desc, track_index) ? threshold : 0.0F;
+			CHECK(rtm::vector_all_near_equal3(rtm::quat_mul_vector3(point, pose[track_index].rotation), rtm::quat_mul_vector3(point, expected_rotation), rotation_threshold));
+			CHECK(rtm::vector_all_near_equal3(pose[track_index].translation, raw_transform.translation, threshold));
+			CHECK(rtm::vector_all_near_equal3(pose[track_index].scale, sentinel.scale, 0.0F));
+		}
+	}
+
+	allocator.deallocate(tracks, tracks->get_size());
+}
@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch2/catch.hpp>
+
+#include "decompression_test_utils.h"
+
+#include <acl/core/ansi_allocator.h>
+#include <acl/decompression/decompress.h>
+#include <acl/decompression/dense_pose_writer.h>
+
+#include <rtm/matrix3x4f.h>
+#include <rtm/qvvf.h>
+
+#include <cstdint>
+
+using namespace acl;
+
+TEST_CASE("object space decompression", "[decompression][object_space]")
+{
+	ansi_allocator allocator;
+
+	const uint32_t num_tracks = 4;
+	const uint32_t num_samples = 11;
+
+	{
+		const track_array_qvvf track_list = acl_test::make_test_track_list(allocator, num_tracks, num_samples, true);
+
+		compressed_tracks* tracks = acl_test::compress_test_track_list(allocator, track_list, rotation_format8::quatf_full, vector_format8::vector3f_full);
+		REQUIRE(tracks != nullptr);
+
+		decompression_context<debug_transform_decompression_settings> context;
+		REQUIRE(context.initialize(*tracks));
+
+		rtm::qvvf pose[num_tracks];
+		dense_qvvf_writer<> writer(pose);
+
+		rtm::matrix3x4f inverse_bind_pose[num_tracks];
+		rtm::matrix3x4f palette[num_tracks];
+		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			inverse_bind_pose[track_index] = rtm::matrix_identity();
+
+		const rtm::vector4f point = rtm::vector_set(1.0F, 2.0F, 3.0F);
+
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		{
+			context.seek(float(sample_index) / acl_test::k_test_sample_rate, sample_rounding_policy::nearest);
+			CHECK(context.decompress_tracks_object_space(writer));
+
+			// Every track is parented to the previous one
+			rtm::qvvf object_transform = rtm::qvv_identity();
+			for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			{
+				object_transform = rtm::qvv_normalize(rtm::qvv_mul(track_list[track_index][sample_index], object_transform));
+				CHECK(acl_test::qvvf_near_equal(pose[track_index], object_transform, 1.0E-3F));
+			}
+
+			CHECK(context.decompress_skinning_palette(inverse_bind_pose, writer, palette));
+
+			// The writer retains the local pose
+			for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+				CHECK(acl_test::qvvf_near_equal(pose[track_index], track_list[track_index][sample_index], 1.0E-4F));
+
+			object_transform = rtm::qvv_identity();
+			for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			{
+				object_transform = rtm::qvv_mul(track_list[track_index][sample_index], object_transform);
+
+				const rtm::vector4f expected_point = rtm::qvv_mul_point3(point, object_transform);
+				const rtm::vector4f palette_point = rtm::matrix_mul_point3(point, palette[track_index]);
+				CHECK(rtm::vector_all_near_equal3(palette_point, expected_point, 1.0E-2F));
+			}
+		}
+
+		allocator.deallocate(tracks, tracks->get_size());
+	}
+
+	{
+		// Parents stored after their children are rejected and the tracks are left in local space
+		track_array_qvvf track_list = acl_test::make_test_track_list(allocator, num_tracks, num_samples, true);
+		track_list[0].get_description().parent_index = 1;
+		track_list[1].get_description().parent_index = k_invalid_track_index;
+		track_list[2].get_description().parent_index = 1;
+
+		compressed_tracks* tracks = acl_test::compress_test_track_list(allocator, track_list, rotation_format8::quatf_full, vector_format8::vector3f_full);
+		REQUIRE(tracks != nullptr);
+
+		decompression_context<debug_transform_decompression_settings> context;
+		REQUIRE(context.initialize(*tracks));
+
+		rtm::qvvf pose[num_tracks];
+		dense_qvvf_writer<> writer(pose);
+
+		rtm::matrix3x4f inverse_bind_pose[num_tracks];
+		rtm::matrix3x4f palette[num_tracks];
+		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+		{
+			inverse_bind_pose[track_index] = rtm::matrix_identity();
+			palette[track_index] = rtm::matrix_identity();
+		}
+
+		context.seek(0.0F, sample_rounding_policy::nearest);
+		CHECK(!context.decompress_tracks_object_space(writer));
+
+		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			CHECK(acl_test::qvvf_near_equal(pose[track_index], track_list[track_index][0], 1.0E-4F));
+
+		CHECK(!context.decompress_skinning_palette(inverse_bind_pose, writer, palette));
+
+		allocator.deallocate(tracks, tracks->get_size());
+	}
+}
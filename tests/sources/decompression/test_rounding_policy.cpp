@@ -0,0 +1,225 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch2/catch.hpp>
+
+#include "decompression_test_utils.h"
+
+#include <acl/core/ansi_allocator.h>
+#include <acl/core/interpolation_utils.h>
+#include <acl/core/sample_looping_policy.h>
+#include <acl/core/sample_rounding_policy.h>
+#include <acl/decompression/decompress.h>
+
+#include <rtm/qvvf.h>
+#include <rtm/quatf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+using namespace acl;
+
+namespace
+{
+	// Samples a raw track the same way compressed tracks are sampled
+	rtm::qvvf sample_raw_track(const track_array_qvvf& track_list, uint32_t track_index, float sample_time, sample_rounding_policy rounding_policy)
+	{
+		const track_qvvf& track = track_list[track_index];
+
+		uint32_t key_frame0;
+		uint32_t key_frame1;
+		float interpolation_alpha;
+		find_linear_interpolation_samples_with_sample_rate(track.get_num_samples(), track.get_sample_rate(), sample_time, rounding_policy, sample_looping_policy::clamp, key_frame0, key_frame1, interpolation_alpha);
+
+		const rtm::qvvf& raw_transform0 = track[key_frame0];
+		const rtm::qvvf& raw_transform1 = track[key_frame1];
+		return rtm::qvv_set(
+			rtm::quat_lerp(raw_transform0.rotation, raw_transform1.rotation, interpolation_alpha),
+			rtm::vector_lerp(raw_transform0.translation, raw_transform1.translation, interpolation_alpha),
+			rtm::vector_lerp(raw_transform0.scale, raw_transform1.scale, interpolation_alpha));
+	}
+
+	// Between two key frames below and above the midpoint, on a key frame, and on the last key frame
+	constexpr float k_test_sample_times[] =
+	{
+		2.3F / acl_test::k_test_sample_rate,
+		5.7F / acl_test::k_test_sample_rate,
+		7.0F / acl_test::k_test_sample_rate,
+		10.0F / acl_test::k_test_sample_rate,
+	};
+}
+
+TEST_CASE("rounding policies match the raw samples", "[decompression][rounding]")
+{
+	ansi_allocator allocator;
+
+	// Not a multiple of 4, the last group of animated sub-tracks is partial
+	const uint32_t num_tracks = 7;
+	const uint32_t num_samples = 11;
+
+	const track_array_qvvf track_list = acl_test::make_test_track_list(allocator, num_tracks, num_samples, true);
+
+	const rotation_format8 rotation_formats[] = { rotation_format8::quatf_full, rotation_format8::quatf_drop_w_variable };
+	const vector_format8 vector_formats[] = { vector_format8::vector3f_full, vector_format8::vector3f_variable };
+	for (uint32_t format_index = 0; format_index < 2; ++format_index)
+	{
+		compressed_tracks* tracks = acl_test::compress_test_track_list(allocator, track_list, rotation_formats[format_index], vector_formats[format_index]);
+		REQUIRE(tracks != nullptr);
+
+		decompression_context<debug_transform_decompression_settings> context;
+		REQUIRE(context.initialize(*tracks));
+
+		// Variable formats are lossy, our tracks have a precision of 1mm
+		const float threshold = format_index == 0 ? 1.0E-3F : 0.05F;
+
+		const sample_rounding_policy rounding_policies[] = { sample_rounding_policy::none, sample_rounding_policy::floor, sample_rounding_policy::ceil, sample_rounding_policy::nearest };
+		for (const sample_rounding_policy rounding_policy : rounding_policies)
+		{
+			for (const float sample_time : k_test_sample_times)
+			{
+				context.seek(sample_time, rounding_policy);
+
+				rtm::qvvf pose[num_tracks];
+				acl_test::qvvf_pose_writer writer(pose);
+				context.decompress_tracks(writer);
+
+				for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+				{
+					const rtm::qvvf expected = sample_raw_track(track_list, track_index, sample_time, rounding_policy);
+					CHECK(acl_test::qvvf_near_equal(pose[track_index], expected, threshold));
+				}
+
+				// The single track path returns the selected key frame directly, it must match the whole pose
+				if (rounding_policy != sample_rounding_policy::none)
+				{
+					rtm::qvvf single_track_pose[num_tracks];
+					acl_test::qvvf_pose_writer single_track_writer(single_track_pose);
+					for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+						context.decompress_track(track_index, single_track_writer);
+
+					for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+						CHECK(acl_test::qvvf_near_equal(single_track_pose[track_index], pose[track_index], 1.0E-6F));
+				}
+			}
+		}
+
+		allocator.deallocate(tracks, tracks->get_size());
+	}
+}
+
+namespace
+{
+	// Every group of 4 animated sub-tracks mixes every rounding policy
+	constexpr sample_rounding_policy k_per_track_rounding_policies[] = { sample_rounding_policy::floor, sample_rounding_policy::ceil, sample_rounding_policy::nearest, sample_rounding_policy::none };
+
+	sample_rounding_policy get_test_rounding_policy(uint32_t track_index)
+	{
+		return k_per_track_rounding_policies[track_index % 4];
+	}
+
+	struct per_track_rounding_writer final : public track_writer
+	{
+		explicit per_track_rounding_writer(rtm::qvvf* pose_) : pose(pose_) {}
+
+		sample_rounding_policy get_rounding_policy(sample_rounding_policy seek_policy, uint32_t track_index) const
+		{
+			return seek_policy == sample_rounding_policy::per_track ? get_test_rounding_policy(track_index) : seek_policy;
+		}
+
+		void RTM_SIMD_CALL write_rotation(uint32_t track_index, rtm::quatf_arg0 rotation) { pose[track_index].rotation = rotation; }
+		void RTM_SIMD_CALL write_translation(uint32_t track_index, rtm::vector4f_arg0 translation) { pose[track_index].translation = translation; }
+		void RTM_SIMD_CALL write_scale(uint32_t track_index, rtm::vector4f_arg0 scale) { pose[track_index].scale = scale; }
+
+		rtm::qvvf* pose;
+	};
+}
+
+TEST_CASE("per track rounding matches the raw samples", "[decompression][rounding]")
+{
+	ansi_allocator allocator;
+
+	const uint32_t num_tracks = 7;
+	const uint32_t num_samples = 11;
+
+	const track_array_qvvf track_list = acl_test::make_test_track_list(allocator, num_tracks, num_samples, true);
+
+	const rotation_format8 rotation_formats[] = { rotation_format8::quatf_full, rotation_format8::quatf_drop_w_variable };
+	const vector_format8 vector_formats[] = { vector_format8::vector3f_full, vector_format8::vector3f_variable };
+	for (uint32_t format_index = 0; format_index < 2; ++format_index)
+	{
+		compressed_tracks* tracks = acl_test::compress_test_track_list(allocator, track_list, rotation_formats[format_index], vector_formats[format_index]);
+		REQUIRE(tracks != nullptr);
+
+		decompression_context<debug_transform_decompression_settings> context;
+		REQUIRE(context.initialize(*tracks));
+
+		rtm::qvvf pose[num_tracks];
+		per_track_rounding_writer writer(pose);
+
+		track_rounding_table rounding_table;
+		REQUIRE(rounding_table.initialize(allocator, *tracks, writer));
+		CHECK(rounding_table.is_bound_to(*tracks));
+
+		// Every sub-track is animated, 2 groups each for rotations, translations, and scales
+		CHECK(rounding_table.get_size() == 6 * sizeof(uint16_t));
+
+		const float threshold = format_index == 0 ? 1.0E-3F : 0.05F;
+
+		for (const float sample_time : k_test_sample_times)
+		{
+			context.seek(sample_time, sample_rounding_policy::per_track);
+
+			// The track writer is queried as we decompress
+			context.decompress_tracks(writer);
+
+			rtm::qvvf table_pose[num_tracks];
+			per_track_rounding_writer table_writer(table_pose);
+			context.decompress_tracks(rounding_table, table_writer);
+
+			for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			{
+				const rtm::qvvf expected = sample_raw_track(track_list, track_index, sample_time, get_test_rounding_policy(track_index));
+				CHECK(acl_test::qvvf_near_equal(pose[track_index], expected, threshold));
+
+				// The table selects the same samples without querying the writer
+				CHECK(acl_test::qvvf_near_equal(table_pose[track_index], pose[track_index], 1.0E-6F));
+			}
+
+			// With any other policy, the table is ignored
+			context.seek(sample_time, sample_rounding_policy::floor);
+			context.decompress_tracks(rounding_table, table_writer);
+
+			for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			{
+				const rtm::qvvf expected = sample_raw_track(track_list, track_index, sample_time, sample_rounding_policy::floor);
+				CHECK(acl_test::qvvf_near_equal(table_pose[track_index], expected, threshold));
+			}
+		}
+
+		rounding_table.reset();
+		CHECK(!rounding_table.is_initialized());
+
+		allocator.deallocate(tracks, tracks->get_size());
+	}
+}
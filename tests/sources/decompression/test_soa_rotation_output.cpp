@@ -0,0 +1,143 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch2/catch.hpp>
+
+#include "decompression_test_utils.h"
+
+#include <acl/core/ansi_allocator.h>
+#include <acl/core/track_writer.h>
+#include <acl/decompression/decompress.h>
+
+#include <rtm/qvvf.h>
+#include <rtm/quatf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+using namespace acl;
+
+namespace
+{
+	// SOA output requires per track rounding to be disabled
+	struct soa_decompression_settings final : public debug_transform_decompression_settings
+	{
+		static constexpr bool is_per_track_rounding_supported() { return false; }
+	};
+
+	// Receives animated rotations in SOA form and transposes them back into the pose
+	struct soa_rotation_writer final : public track_writer
+	{
+		explicit soa_rotation_writer(rtm::qvvf* pose_) : pose(pose_) {}
+
+		static constexpr bool supports_soa_rotation_output() { return true; }
+
+		void RTM_SIMD_CALL write_rotations_soa(const uint32_t* track_indices, uint32_t num_tracks, rtm::vector4f_arg0 xxxx, rtm::vector4f_arg1 yyyy, rtm::vector4f_arg2 zzzz, rtm::vector4f_arg3 wwww)
+		{
+			float x[4];
+			float y[4];
+			float z[4];
+			float w[4];
+			rtm::vector_store(xxxx, &x[0]);
+			rtm::vector_store(yyyy, &y[0]);
+			rtm::vector_store(zzzz, &z[0]);
+			rtm::vector_store(wwww, &w[0]);
+
+			for (uint32_t lane_index = 0; lane_index < num_tracks; ++lane_index)
+			{
+				pose[track_indices[lane_index]].rotation = rtm::quat_set(x[lane_index], y[lane_index], z[lane_index], w[lane_index]);
+				num_soa_rotations++;
+			}
+		}
+
+		void RTM_SIMD_CALL write_rotation(uint32_t track_index, rtm::quatf_arg0 rotation) { pose[track_index].rotation = rotation; }
+		void RTM_SIMD_CALL write_translation(uint32_t track_index, rtm::vector4f_arg0 translation) { pose[track_index].translation = translation; }
+		void RTM_SIMD_CALL write_scale(uint32_t track_index, rtm::vector4f_arg0 scale) { pose[track_index].scale = scale; }
+
+		rtm::qvvf* pose;
+		uint32_t num_soa_rotations = 0;
+	};
+}
+
+TEST_CASE("soa rotation output", "[decompression][soa]")
+{
+	ansi_allocator allocator;
+
+	// Not a multiple of 4, the last group of animated rotations is partial
+	const uint32_t num_tracks = 7;
+	const uint32_t num_samples = 11;
+
+	const track_array_qvvf track_list = acl_test::make_test_track_list(allocator, num_tracks, num_samples, true);
+
+	const rotation_format8 rotation_formats[] = { rotation_format8::quatf_full, rotation_format8::quatf_drop_w_variable };
+	for (const rotation_format8 rotation_format : rotation_formats)
+	{
+		compressed_tracks* tracks = acl_test::compress_test_track_list(allocator, track_list, rotation_format, vector_format8::vector3f_full);
+		REQUIRE(tracks != nullptr);
+
+		decompression_context<soa_decompression_settings> context;
+		REQUIRE(context.initialize(*tracks));
+
+		// Variable formats are lossy, our tracks have a precision of 1mm
+		const float threshold = rotation_format == rotation_format8::quatf_full ? 1.0E-3F : 0.05F;
+
+		// Sample between two key frames to interpolate and on a key frame
+		const uint32_t sample_indices[] = { 2, 5 };
+		const float interpolation_alphas[] = { 0.4F, 0.0F };
+		for (uint32_t sample_time_index = 0; sample_time_index < 2; ++sample_time_index)
+		{
+			const uint32_t sample_index = sample_indices[sample_time_index];
+			const float interpolation_alpha = interpolation_alphas[sample_time_index];
+			context.seek((float(sample_index) + interpolation_alpha) / acl_test::k_test_sample_rate, sample_rounding_policy::none);
+
+			rtm::qvvf reference_pose[num_tracks];
+			acl_test::qvvf_pose_writer reference_writer(reference_pose);
+			context.decompress_tracks(reference_writer);
+
+			rtm::qvvf soa_pose[num_tracks];
+			soa_rotation_writer soa_writer(soa_pose);
+			context.decompress_tracks(soa_writer);
+
+			// Every rotation is animated and every one of them is written in SOA form
+			CHECK(soa_writer.num_soa_rotations == num_tracks);
+
+			for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			{
+				// Both writers receive the same interpolated values
+				CHECK(acl_test::qvvf_near_equal(soa_pose[track_index], reference_pose[track_index], 1.0E-6F));
+
+				const rtm::qvvf& raw_transform0 = track_list[track_index][sample_index];
+				const rtm::qvvf& raw_transform1 = track_list[track_index][sample_index + 1];
+				const rtm::qvvf expected = rtm::qvv_set(
+					rtm::quat_lerp(raw_transform0.rotation, raw_transform1.rotation, interpolation_alpha),
+					rtm::vector_lerp(raw_transform0.translation, raw_transform1.translation, interpolation_alpha),
+					rtm::vector_lerp(raw_transform0.scale, raw_transform1.scale, interpolation_alpha));
+
+				CHECK(acl_test::qvvf_near_equal(soa_pose[track_index], expected, threshold));
+			}
+		}
+
+		allocator.deallocate(tracks, tracks->get_size());
+	}
+}
@@ -0,0 +1,79 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch2/catch.hpp>
+
+#include "decompression_test_utils.h"
+
+#include <acl/core/ansi_allocator.h>
+#include <acl/decompression/decompress.h>
+#include <acl/decompression/dense_pose_writer.h>
+
+#include <rtm/qvvf.h>
+
+#include <cstdint>
+
+using namespace acl;
+
+static void check_decompressed_samples(iallocator& allocator, bool is_animated, rotation_format8 rotation_format, vector_format8 vector_format, float threshold)
+{
+	const uint32_t num_tracks = 4;
+	const uint32_t num_samples = 11;
+
+	const track_array_qvvf track_list = acl_test::make_test_track_list(allocator, num_tracks, num_samples, is_animated);
+
+	compressed_tracks* tracks = acl_test::compress_test_track_list(allocator, track_list, rotation_format, vector_format);
+	REQUIRE(tracks != nullptr);
+
+	decompression_context<debug_transform_decompression_settings> context;
+	REQUIRE(context.initialize(*tracks));
+
+	rtm::qvvf pose[num_tracks];
+	dense_qvvf_writer<> writer(pose);
+
+	for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+	{
+		context.seek(float(sample_index) / acl_test::k_test_sample_rate, sample_rounding_policy::nearest);
+		context.decompress_tracks(writer);
+
+		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			CHECK(acl_test::qvvf_near_equal(pose[track_index], track_list[track_index][sample_index], threshold));
+	}
+
+	allocator.deallocate(tracks, tracks->get_size());
+}
+
+TEST_CASE("static pose decompression", "[decompression][static_pose]")
+{
+	ansi_allocator allocator;
+
+	// A static pose only contains constant sub-tracks and takes the seek-free path
+	check_decompressed_samples(allocator, false, rotation_format8::quatf_full, vector_format8::vector3f_full, 1.0E-4F);
+	check_decompressed_samples(allocator, false, rotation_format8::quatf_drop_w_variable, vector_format8::vector3f_variable, 1.0E-4F);
+
+	// Full formats have no variable sub-tracks but are animated, they must not take the seek-free path
+	check_decompressed_samples(allocator, true, rotation_format8::quatf_full, vector_format8::vector3f_full, 1.0E-4F);
+	check_decompressed_samples(allocator, true, rotation_format8::quatf_drop_w_full, vector_format8::vector3f_full, 1.0E-4F);
+}
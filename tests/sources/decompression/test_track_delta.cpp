@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch2/catch.hpp>
+
+#include "decompression_test_utils.h"
+
+#include <acl/core/additive_utils.h>
+#include <acl/core/ansi_allocator.h>
+#include <acl/decompression/decompress.h>
+#include <acl/decompression/dense_pose_writer.h>
+
+#include <rtm/qvvf.h>
+
+#include <cstdint>
+
+using namespace acl;
+
+TEST_CASE("track delta decompression", "[decompression][delta]")
+{
+	ansi_allocator allocator;
+
+	const uint32_t num_tracks = 4;
+	const uint32_t num_samples = 11;
+
+	const track_array_qvvf track_list = acl_test::make_test_track_list(allocator, num_tracks, num_samples, true);
+
+	compressed_tracks* tracks = acl_test::compress_test_track_list(allocator, track_list, rotation_format8::quatf_full, vector_format8::vector3f_full);
+	REQUIRE(tracks != nullptr);
+
+	decompression_context<debug_transform_decompression_settings> context;
+	REQUIRE(context.initialize(*tracks));
+
+	rtm::qvvf pose[num_tracks];
+	dense_qvvf_writer<> writer(pose);
+
+	const uint32_t sample_pairs[][2] = { { 0, 0 }, { 0, 1 }, { 2, 9 }, { 10, 3 } };
+	for (const auto& sample_pair : sample_pairs)
+	{
+		const uint32_t sample_index0 = sample_pair[0];
+		const uint32_t sample_index1 = sample_pair[1];
+		const float sample_time0 = float(sample_index0) / acl_test::k_test_sample_rate;
+		const float sample_time1 = float(sample_index1) / acl_test::k_test_sample_rate;
+
+		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+		{
+			context.decompress_track_delta(track_index, sample_time0, sample_time1, sample_rounding_policy::nearest, writer);
+
+			const rtm::qvvf expected_delta = convert_to_relative(track_list[track_index][sample_index0], track_list[track_index][sample_index1]);
+			CHECK(acl_test::qvvf_near_equal(pose[track_index], expected_delta, 1.0E-3F));
+		}
+
+		// The context remains sought at the second sample time
+		context.decompress_tracks(writer);
+		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+			CHECK(acl_test::qvvf_near_equal(pose[track_index], track_list[track_index][sample_index1], 1.0E-4F));
+	}
+
+	allocator.deallocate(tracks, tracks->get_size());
+}
@@ -36,10 +36,13 @@
 #include <rtm/qvvd.h>
 #include <rtm/scalarf.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #if defined(_WIN32)
 	// The below excludes some other unused services from the windows headers -- see windows.h for details.
@@ -101,7 +104,7 @@ using namespace acl;
 	constexpr uint32_t k_max_filename_size = 1024;
 #endif
 
-static void get_temporary_filename(char* filename, uint32_t filename_size, const char* prefix)
+static void get_temporary_filename(char* filename, uint32_t filename_size, const char* prefix, const char* extension = ".acl.sjson")
 {
 #ifdef _WIN32
 	DWORD result = GetTempPathA(filename_size, filename);
@@ -112,7 +115,7 @@ static void get_temporary_filename(char* filename, uint32_t filename_size, const
 
 	strcat_s(filename, filename_size, prefix);
 	strcat_s(filename, filename_size, id);
-	strcat_s(filename, filename_size, ".acl.sjson");
+	strcat_s(filename, filename_size, extension);
 #else
 	(void)filename_size;
 	
@@ -122,11 +125,35 @@ static void get_temporary_filename(char* filename, uint32_t filename_size, const
 	std::strcat(filename, "/tmp/");
 	std::strcat(filename, prefix);
 	std::strcat(filename, id);
-	std::strcat(filename, ".acl.sjson");
+	std::strcat(filename, extension);
 #endif
 }
 #endif
 
+#if defined(RTM_SSE2_INTRINSICS) && defined(ACL_USE_SJSON)
+// Runs the jobs on a few threads, each thread processing every Nth job
+struct thread_clip_reader_scheduler final : public iclip_reader_scheduler
+{
+	virtual void execute(uint32_t num_jobs, job_function job, void* user_data) override
+	{
+		constexpr uint32_t k_num_threads = 4;
+
+		std::thread threads[k_num_threads];
+		for (uint32_t thread_index = 0; thread_index < k_num_threads; ++thread_index)
+		{
+			threads[thread_index] = std::thread([=]()
+				{
+					for (uint32_t job_index = thread_index; job_index < num_jobs; job_index += k_num_threads)
+						job(job_index, user_data);
+				});
+		}
+
+		for (std::thread& thread : threads)
+			thread.join();
+	}
+};
+#endif
+
 // Disable warning for implicit constructor using deprecated members in sjson_raw_clip and sjson_raw_track_list
 #if defined(RTM_COMPILER_MSVC_2015)
 	#pragma warning(push)
@@ -838,3 +865,350 @@ TEST_CASE("sjson_track_list_reader_writer vector4f", "[io]")
 	}
 #endif
 }
+
+TEST_CASE("sjson_track_list_reader parallel", "[io]")
+{
+	// Only test the reader/writer on non-mobile platforms
+#if defined(RTM_SSE2_INTRINSICS) && defined(ACL_USE_SJSON)
+	ansi_allocator allocator;
+
+	const uint32_t num_tracks = 7;
+	const uint32_t num_samples = 13;
+	track_array_qvvf track_list(allocator, num_tracks);
+
+	for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+	{
+		track_desc_transformf desc;
+		desc.output_index = track_index;
+		desc.parent_index = track_index == 0 ? k_invalid_track_index : (track_index - 1);
+
+		track_qvvf track = track_qvvf::make_reserve(desc, allocator, num_samples, 30.0F);
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		{
+			const float value = float(track_index * num_samples + sample_index);
+			track[sample_index].rotation = rtm::quat_from_euler(0.01F * value, 0.5F, 1.2F);
+			track[sample_index].translation = rtm::vector_set(value, 0.6F, -value);
+			track[sample_index].scale = rtm::vector_set(1.4F, 0.1F * value, 0.2F);
+		}
+		track_list[track_index] = std::move(track);
+	}
+
+	const uint32_t filename_size = k_max_filename_size;
+	char filename[filename_size] = { 0 };
+
+	error_result error;
+	for (uint32_t try_count = 0; try_count < 20; ++try_count)
+	{
+		get_temporary_filename(filename, filename_size, "list_parallel_");
+
+		// Write the clip to a temporary file
+		error = write_track_list(track_list, filename);
+
+		if (error.empty())
+			break;	// Everything worked, stop trying
+	}
+	REQUIRE(error.empty());
+
+	std::FILE* file = nullptr;
+	for (uint32_t try_count = 0; try_count < 20; ++try_count)
+	{
+#ifdef _WIN32
+		fopen_s(&file, filename, "rb");
+#else
+		file = fopen(filename, "rb");
+#endif
+
+		if (file != nullptr)
+			break;	// File is open, all good
+
+		// Sleep a bit before tring again
+		std::this_thread::sleep_for(std::chrono::seconds(1));
+	}
+	REQUIRE(file != nullptr);
+
+	char sjson_file_buffer[256 * 1024];
+	const size_t buffer_size = fread(sjson_file_buffer, 1, get_array_size(sjson_file_buffer), file);
+	fclose(file);
+
+	std::remove(filename);
+
+	// Read back the clip on multiple threads
+	clip_reader reader(allocator, sjson_file_buffer, buffer_size - 1);
+
+	REQUIRE(reader.get_file_type() == sjson_file_type::raw_track_list);
+
+	thread_clip_reader_scheduler scheduler;
+	sjson_raw_track_list file_track_list;
+	const bool success = reader.read_raw_track_list(file_track_list, scheduler);
+	REQUIRE(success);
+
+	CHECK(file_track_list.track_list.get_num_samples_per_track() == track_list.get_num_samples_per_track());
+	CHECK(file_track_list.track_list.get_num_tracks() == track_list.get_num_tracks());
+	CHECK(file_track_list.track_list.get_track_type() == track_list.get_track_type());
+
+	for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+	{
+		const track_qvvf& ref_track = track_list[track_index];
+		const track_qvvf& file_track = track_cast<track_qvvf>(file_track_list.track_list[track_index]);
+
+		CHECK(file_track.get_description().output_index == ref_track.get_description().output_index);
+		CHECK(file_track.get_description().parent_index == ref_track.get_description().parent_index);
+		CHECK(file_track.get_num_samples() == ref_track.get_num_samples());
+
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		{
+			const rtm::qvvf& ref_sample = ref_track[sample_index];
+			const rtm::qvvf& file_sample = file_track[sample_index];
+			CHECK(rtm::quat_near_equal(ref_sample.rotation, file_sample.rotation, 0.0F));
+			CHECK(rtm::vector_all_near_equal3(ref_sample.translation, file_sample.translation, 0.0F));
+			CHECK(rtm::vector_all_near_equal3(ref_sample.scale, file_sample.scale, 0.0F));
+		}
+	}
+#endif
+}
+
+TEST_CASE("binary_clip_reader_writer", "[io]")
+{
+	// Only test the reader/writer on non-mobile platforms
+#if defined(RTM_SSE2_INTRINSICS) && defined(ACL_USE_SJSON)
+	ansi_allocator allocator;
+
+	const uint32_t num_tracks = 2;
+	const uint32_t num_samples = 4;
+	track_array_qvvf track_list(allocator, num_tracks);
+	track_array_qvvf base_track_list(allocator, num_tracks);
+
+	track_desc_transformf desc;
+	desc.output_index = 0;
+	desc.precision = 0.001F;
+	desc.shell_distance = 0.1241F;
+	desc.default_value = rtm::qvv_set(rtm::quat_from_euler(0.1F, 0.5F, 1.2F), rtm::vector_set(1.0F, 2.0F, 3.0F), rtm::vector_set(1.0F));
+
+	for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+	{
+		desc.output_index = track_index;
+		desc.parent_index = track_index == 0 ? k_invalid_track_index : (track_index - 1);
+
+		track_qvvf track = track_qvvf::make_reserve(desc, allocator, num_samples, 32.0F);
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		{
+			const float value = float(track_index * num_samples + sample_index);
+			track[sample_index].rotation = rtm::quat_from_euler(0.1F * value, 0.5F, 1.2F);
+			track[sample_index].translation = rtm::vector_set(value, 0.6F, 2.3F);
+			track[sample_index].scale = rtm::vector_set(1.4F, value, 0.2F);
+		}
+		track.set_name(acl::string(allocator, track_index == 0 ? "root" : "child"));
+		track_list[track_index] = std::move(track);
+
+		track_qvvf base_track = track_qvvf::make_reserve(desc, allocator, 1, 30.0F);
+		base_track[0] = rtm::qvv_set(rtm::quat_identity(), rtm::vector_set(float(track_index)), rtm::vector_set(1.0F));
+		base_track_list[track_index] = std::move(base_track);
+	}
+
+	track_list.set_name(acl::string(allocator, "some clip"));
+	base_track_list.set_name(acl::string(allocator, "some base"));
+
+	compression_settings settings;
+	settings.level = compression_level8::high;
+	settings.rotation_format = rotation_format8::quatf_drop_w_variable;
+
+	const uint32_t filename_size = k_max_filename_size;
+	char filename[filename_size] = { 0 };
+
+	error_result error;
+	for (uint32_t try_count = 0; try_count < 20; ++try_count)
+	{
+		get_temporary_filename(filename, filename_size, "binary_clip_", ".acl.bin");
+
+		// Write the clip to a temporary file
+		error = write_binary_track_list(track_list, base_track_list, additive_clip_format8::additive1, &settings, filename);
+
+		if (error.empty())
+			break;	// Everything worked, stop trying
+	}
+	REQUIRE(error.empty());
+
+	std::FILE* file = nullptr;
+	for (uint32_t try_count = 0; try_count < 20; ++try_count)
+	{
+#ifdef _WIN32
+		fopen_s(&file, filename, "rb");
+#else
+		file = fopen(filename, "rb");
+#endif
+
+		if (file != nullptr)
+			break;	// File is open, all good
+
+		// Sleep a bit before tring again
+		std::this_thread::sleep_for(std::chrono::seconds(1));
+	}
+	REQUIRE(file != nullptr);
+
+	// Samples are referenced in place, the buffer must be aligned and outlive the tracks
+	const size_t max_file_size = 64 * 1024;
+	void* file_buffer = allocator.allocate(max_file_size, 16);
+	const size_t file_size = fread(file_buffer, 1, max_file_size, file);
+	fclose(file);
+
+	std::remove(filename);
+
+	{
+		// Read back the clip
+		binary_clip_reader reader(allocator, file_buffer, file_size);
+
+		REQUIRE(reader.get_file_type() == sjson_file_type::raw_clip);
+
+		sjson_raw_clip file_clip;
+		const bool success = reader.read_raw_clip(file_clip);
+		REQUIRE(success);
+
+		CHECK(file_clip.has_settings);
+		CHECK(file_clip.settings.get_hash() == settings.get_hash());
+		CHECK(file_clip.additive_format == additive_clip_format8::additive1);
+
+		CHECK(file_clip.track_list.get_num_samples_per_track() == track_list.get_num_samples_per_track());
+		CHECK(file_clip.track_list.get_sample_rate() == track_list.get_sample_rate());
+		CHECK(file_clip.track_list.get_num_tracks() == track_list.get_num_tracks());
+		CHECK(file_clip.track_list.get_name() == track_list.get_name());
+		CHECK(file_clip.additive_base_track_list.get_num_samples_per_track() == base_track_list.get_num_samples_per_track());
+		CHECK(file_clip.additive_base_track_list.get_sample_rate() == base_track_list.get_sample_rate());
+		CHECK(file_clip.additive_base_track_list.get_name() == base_track_list.get_name());
+
+		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+		{
+			const track_qvvf& ref_track = track_list[track_index];
+			const track_qvvf& file_track = file_clip.track_list[track_index];
+
+			CHECK(file_track.is_ref());
+			CHECK(file_track.get_description().output_index == ref_track.get_description().output_index);
+			CHECK(file_track.get_description().parent_index == ref_track.get_description().parent_index);
+			CHECK(rtm::scalar_near_equal(file_track.get_description().precision, ref_track.get_description().precision, 0.0F));
+			CHECK(rtm::scalar_near_equal(file_track.get_description().shell_distance, ref_track.get_description().shell_distance, 0.0F));
+			CHECK(rtm::quat_near_equal(file_track.get_description().default_value.rotation, ref_track.get_description().default_value.rotation, 0.0F));
+			CHECK(rtm::vector_all_near_equal3(file_track.get_description().default_value.translation, ref_track.get_description().default_value.translation, 0.0F));
+			CHECK(file_track.get_name() == ref_track.get_name());
+
+			for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			{
+				const rtm::qvvf& ref_sample = ref_track[sample_index];
+				const rtm::qvvf& file_sample = file_track[sample_index];
+				CHECK(rtm::quat_near_equal(ref_sample.rotation, file_sample.rotation, 0.0F));
+				CHECK(rtm::vector_all_near_equal3(ref_sample.translation, file_sample.translation, 0.0F));
+				CHECK(rtm::vector_all_near_equal3(ref_sample.scale, file_sample.scale, 0.0F));
+			}
+
+			const rtm::qvvf& ref_base_sample = base_track_list[track_index][0];
+			const rtm::qvvf& file_base_sample = file_clip.additive_base_track_list[track_index][0];
+			CHECK(rtm::vector_all_near_equal3(ref_base_sample.translation, file_base_sample.translation, 0.0F));
+		}
+
+		// A truncated buffer is rejected
+		binary_clip_reader truncated_reader(allocator, file_buffer, file_size - 1);
+		CHECK(truncated_reader.get_file_type() == sjson_file_type::unknown);
+		CHECK(truncated_reader.get_error().error == clip_reader_error::InvalidBinaryClip);
+	}
+
+	allocator.deallocate(file_buffer, max_file_size);
+#endif
+}
+
+TEST_CASE("sjson_track_list_stream_writer", "[io]")
+{
+	// Only test the reader/writer on non-mobile platforms
+#if defined(RTM_SSE2_INTRINSICS) && defined(ACL_USE_SJSON)
+	ansi_allocator allocator;
+
+	const uint32_t num_tracks = 3;
+	const uint32_t num_samples = 500;
+
+	std::vector<char> output;
+	const auto append_output = [](const char* buffer, size_t buffer_size, void* user_data)
+	{
+		std::vector<char>& output_ = *static_cast<std::vector<char>*>(user_data);
+		output_.insert(output_.end(), buffer, buffer + buffer_size);
+	};
+
+	{
+		track_list_stream_writer writer(append_output, &output);
+		writer.begin_track_list("stream", num_samples, 30.0F);
+
+		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+		{
+			track_desc_transformf desc;
+			desc.output_index = track_index;
+			desc.parent_index = track_index == 0 ? k_invalid_track_index : (track_index - 1);
+			desc.shell_distance = 3.5F;
+
+			writer.begin_track("bone", desc);
+
+			// Push the samples in small chunks like a streaming source would
+			for (uint32_t sample_index = 0; sample_index < num_samples; sample_index += 7)
+			{
+				rtm::qvvf samples[7];
+				const uint32_t num_chunk_samples = std::min<uint32_t>(7, num_samples - sample_index);
+
+				for (uint32_t chunk_sample_index = 0; chunk_sample_index < num_chunk_samples; ++chunk_sample_index)
+				{
+					const float value = float(track_index * num_samples + sample_index + chunk_sample_index);
+					samples[chunk_sample_index] = rtm::qvv_set(rtm::quat_from_euler(0.01F * value, 0.5F, 1.2F), rtm::vector_set(value, 0.6F, -value), rtm::vector_set(1.4F, 0.1F * value, 0.2F));
+				}
+
+				writer.write_samples(samples, num_chunk_samples);
+			}
+
+			writer.end_track();
+		}
+
+		const error_result error = writer.end_track_list();
+		REQUIRE(error.empty());
+	}
+
+	// Read back the track list
+	clip_reader reader(allocator, output.data(), output.size());
+
+	REQUIRE(reader.get_file_type() == sjson_file_type::raw_track_list);
+
+	sjson_raw_track_list file_track_list;
+	const bool success = reader.read_raw_track_list(file_track_list);
+	REQUIRE(success);
+
+	CHECK(file_track_list.track_list.get_num_samples_per_track() == num_samples);
+	CHECK(file_track_list.track_list.get_sample_rate() == 30.0F);
+	CHECK(file_track_list.track_list.get_num_tracks() == num_tracks);
+	CHECK(file_track_list.track_list.get_track_type() == track_type8::qvvf);
+
+	for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+	{
+		const track_qvvf& file_track = track_cast<track_qvvf>(file_track_list.track_list[track_index]);
+
+		CHECK(file_track.get_description().output_index == track_index);
+		CHECK(file_track.get_description().parent_index == (track_index == 0 ? k_invalid_track_index : (track_index - 1)));
+		CHECK(file_track.get_description().shell_distance == 3.5F);
+		CHECK(file_track.get_num_samples() == num_samples);
+
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		{
+			const float value = float(track_index * num_samples + sample_index);
+			const rtm::qvvf& file_sample = file_track[sample_index];
+			CHECK(rtm::quat_near_equal(rtm::quat_from_euler(0.01F * value, 0.5F, 1.2F), file_sample.rotation, 0.0F));
+			CHECK(rtm::vector_all_near_equal3(rtm::vector_set(value, 0.6F, -value), file_sample.translation, 0.0F));
+			CHECK(rtm::vector_all_near_equal3(rtm::vector_set(1.4F, 0.1F * value, 0.2F), file_sample.scale, 0.0F));
+		}
+	}
+
+	// Mismatched sample counts are reported
+	{
+		std::vector<char> bad_output;
+		track_list_stream_writer writer(append_output, &bad_output);
+		writer.begin_track_list("stream", num_samples, 30.0F);
+
+		const float sample = 1.0F;
+		writer.begin_track("scalar", track_type8::float1f, track_desc_scalarf());
+		writer.write_samples(&sample, 1);
+		writer.end_track();
+
+		CHECK(!writer.end_track_list().empty());
+	}
+#endif
+}
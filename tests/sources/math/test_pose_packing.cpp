@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch2/catch.hpp>
+
+#include <acl/math/pose_packing.h>
+
+#include <cmath>
+#include <limits>
+
+using namespace acl;
+using namespace rtm;
+
+TEST_CASE("half float conversion", "[math][packing]")
+{
+	CHECK(float_to_half(0.0F) == 0x0000);
+	CHECK(float_to_half(-0.0F) == 0x8000);
+	CHECK(float_to_half(1.0F) == 0x3C00);
+	CHECK(float_to_half(-2.0F) == 0xC000);
+	CHECK(float_to_half(65504.0F) == 0x7BFF);
+	CHECK(float_to_half(1.0E6F) == 0x7C00);
+	CHECK(float_to_half(std::numeric_limits<float>::infinity()) == 0x7C00);
+	CHECK(float_to_half(6.0E-8F) == 0x0001);
+
+	// Ties round to even
+	CHECK(float_to_half(1.0F + (1.0F / 2048.0F)) == 0x3C00);
+	CHECK(float_to_half(1.0F + (3.0F / 2048.0F)) == 0x3C02);
+
+	CHECK(std::isnan(half_to_float(float_to_half(std::numeric_limits<float>::quiet_NaN()))));
+
+	// Every finite half float converts back to itself
+	uint32_t num_mismatches = 0;
+	for (uint32_t value = 0; value < 0x10000; ++value)
+	{
+		const uint16_t half = static_cast<uint16_t>(value);
+		if ((half & 0x7C00) == 0x7C00)
+			continue;	// Infinity or NaN
+
+		if (float_to_half(half_to_float(half)) != half)
+			num_mismatches++;
+	}
+
+	CHECK(num_mismatches == 0);
+}
+
+TEST_CASE("pose packing math", "[math][packing]")
+{
+	{
+		const vector4f vec0 = vector_set(1.5F, -0.25F, 1024.0F, 0.0F);
+		uint16_t packed[3];
+		pack_vector3_half(vec0, &packed[0]);
+		const vector4f vec1 = unpack_vector3_half(&packed[0]);
+		CHECK(vector_all_near_equal3(vec0, vec1, 0.0F));
+	}
+
+	{
+		const quatf quat0 = quat_normalize(quat_set(0.39564531008956383F, 0.044254239301713752F, 0.22768840967675355F, 0.88863059760894492F));
+		int16_t packed[4];
+		pack_quat_snorm16(quat0, &packed[0]);
+		const quatf quat1 = unpack_quat_snorm16(&packed[0]);
+		CHECK(quat_near_equal(quat0, quat1, 1.0E-4F));
+	}
+
+	{
+		const qvvf transform0 = qvv_set(quat_from_euler(1.2F, -0.3F, 0.7F), vector_set(12.5F, -3.25F, 0.125F), vector_set(1.0F, 2.0F, 0.5F));
+		packed_qvvf16 packed;
+		pack_qvvf16(transform0, packed);
+		const qvvf transform1 = unpack_qvvf16(packed);
+		CHECK(quat_near_equal(transform0.rotation, transform1.rotation, 1.0E-4F));
+		CHECK(vector_all_near_equal3(transform0.translation, transform1.translation, 0.01F));
+		CHECK(vector_all_near_equal3(transform0.scale, transform1.scale, 0.0F));
+	}
+}
@@ -81,6 +81,18 @@ TEST_CASE("quat packing math", "[math][quat][packing]")
 		CHECK(scalar_near_equal((float)quat_get_w(quat0), (float)quat_get_w(quat1), 1.0E-3F));
 	}
 
+	{
+		// Our second rotation has a negative W and must be flipped
+		const quatf quats0[2] = { quat0, quat_set(0.5F, -0.5F, 0.5F, -0.5F) };
+		quatf quats1[2];
+
+		UnalignedBuffer tmp0;
+		pack_quat_sXX_array(&quats0[0], 2, 16, &tmp0.buffer[0], 5);
+		unpack_quat_sXX_array_unsafe(16, &tmp0.buffer[0], 5, 2, &quats1[0]);
+		CHECK(quat_near_equal(quats0[0], quats1[0], 1.0E-4F));
+		CHECK(quat_near_equal(quat_neg(quats0[1]), quats1[1], 1.0E-4F));
+	}
+
 	CHECK(get_packed_rotation_size(rotation_format8::quatf_full) == 16);
 	CHECK(get_packed_rotation_size(rotation_format8::quatf_drop_w_full) == 12);
 
@@ -0,0 +1,215 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch2/catch.hpp>
+
+#include <acl/compression/impl/convert_rotation_streams.h>
+#include <acl/core/impl/variable_bit_rates.h>
+#include <acl/math/quatf.h>
+
+#include <rtm/quatf.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+
+using namespace acl;
+using namespace rtm;
+
+TEST_CASE("quat logarithm math", "[math][quat]")
+{
+	const float threshold = 1.0E-6F;
+
+	{
+		const vector4f log_rotation = acl_impl::quat_to_log(quat_identity());
+		CHECK(vector_all_near_equal(log_rotation, vector_zero(), threshold));
+
+		const quatf rotation = acl_impl::quat_from_log(log_rotation);
+		CHECK(quat_near_equal(rotation, quat_identity(), threshold));
+	}
+
+	{
+		// The logarithm is the rotation axis scaled by half the rotation angle
+		const vector4f axis = vector_normalize3(vector_set(0.2F, -1.0F, 0.5F));
+		const float angle = 1.2F;
+		const quatf rotation = quat_from_axis_angle(axis, angle);
+
+		const vector4f log_rotation = acl_impl::quat_to_log(rotation);
+		CHECK(vector_all_near_equal3(log_rotation, vector_mul(axis, angle * 0.5F), threshold));
+		CHECK(scalar_near_equal(vector_get_w(log_rotation), 0.0F, threshold));
+
+		// Both rotations on the hypersphere have the same logarithm
+		CHECK(vector_all_near_equal(acl_impl::quat_to_log(quat_neg(rotation)), log_rotation, threshold));
+
+		CHECK(quat_near_equal(acl_impl::quat_from_log(log_rotation), rotation, threshold));
+	}
+
+	{
+		// Rotating by 180 degrees is the worst case, the half angle is PI/2
+		const vector4f axis = vector_set(0.0F, 0.0F, 1.0F);
+		const quatf rotation = quat_from_axis_angle(axis, 3.14159265F);
+		const quatf reconstructed = acl_impl::quat_from_log(acl_impl::quat_to_log(rotation));
+		CHECK(quat_near_equal(quat_ensure_positive_w(reconstructed), quat_ensure_positive_w(rotation), threshold));
+	}
+
+	{
+		const quatf rotations[4] =
+		{
+			quat_identity(),
+			quat_from_axis_angle(vector_set(1.0F, 0.0F, 0.0F), 0.5F),
+			quat_from_axis_angle(vector_normalize3(vector_set(1.0F, 1.0F, 0.0F)), 2.0F),
+			quat_from_axis_angle(vector_normalize3(vector_set(-0.3F, 0.4F, 0.8F)), 3.0F),
+		};
+
+		vector4f log_rotations[4];
+		for (uint32_t rotation_index = 0; rotation_index < 4; ++rotation_index)
+			log_rotations[rotation_index] = acl_impl::quat_to_log(rotations[rotation_index]);
+
+		vector4f xxxx = vector_set(vector_get_x(log_rotations[0]), vector_get_x(log_rotations[1]), vector_get_x(log_rotations[2]), vector_get_x(log_rotations[3]));
+		vector4f yyyy = vector_set(vector_get_y(log_rotations[0]), vector_get_y(log_rotations[1]), vector_get_y(log_rotations[2]), vector_get_y(log_rotations[3]));
+		vector4f zzzz = vector_set(vector_get_z(log_rotations[0]), vector_get_z(log_rotations[1]), vector_get_z(log_rotations[2]), vector_get_z(log_rotations[3]));
+		const vector4f wwww = acl_impl::quat_from_log4(xxxx, yyyy, zzzz);
+
+		float x[4];
+		float y[4];
+		float z[4];
+		float w[4];
+		vector_store(xxxx, &x[0]);
+		vector_store(yyyy, &y[0]);
+		vector_store(zzzz, &z[0]);
+		vector_store(wwww, &w[0]);
+
+		for (uint32_t rotation_index = 0; rotation_index < 4; ++rotation_index)
+		{
+			const quatf reconstructed = quat_set(x[rotation_index], y[rotation_index], z[rotation_index], w[rotation_index]);
+			CHECK(quat_near_equal(reconstructed, acl_impl::quat_from_log(log_rotations[rotation_index]), threshold));
+			CHECK(quat_near_equal(reconstructed, quat_ensure_positive_w(rotations[rotation_index]), threshold));
+		}
+	}
+}
+
+TEST_CASE("quat approximate normalization math", "[math][quat]")
+{
+	// Lerped rotations are shorter than 1.0, the further apart the shorter they are
+	const quatf rotation0 = quat_from_axis_angle(vector_set(1.0F, 0.0F, 0.0F), 0.5F);
+	const quatf rotation1 = quat_from_axis_angle(vector_normalize3(vector_set(-0.3F, 0.4F, 0.8F)), 2.5F);
+
+	const quatf rotations[4] =
+	{
+		quat_lerp_no_normalization(rotation0, rotation1, 0.5F),
+		quat_lerp_no_normalization(rotation0, rotation1, 0.25F),
+		quat_lerp_no_normalization(quat_identity(), rotation1, 0.75F),
+		quat_set(0.1F, -2.0F, 0.3F, 1.5F),
+	};
+
+	vector4f xxxx = vector_set(quat_get_x(rotations[0]), quat_get_x(rotations[1]), quat_get_x(rotations[2]), quat_get_x(rotations[3]));
+	vector4f yyyy = vector_set(quat_get_y(rotations[0]), quat_get_y(rotations[1]), quat_get_y(rotations[2]), quat_get_y(rotations[3]));
+	vector4f zzzz = vector_set(quat_get_z(rotations[0]), quat_get_z(rotations[1]), quat_get_z(rotations[2]), quat_get_z(rotations[3]));
+	vector4f wwww = vector_set(quat_get_w(rotations[0]), quat_get_w(rotations[1]), quat_get_w(rotations[2]), quat_get_w(rotations[3]));
+	acl_impl::quat_normalize_approx4(xxxx, yyyy, zzzz, wwww);
+
+	float x[4];
+	float y[4];
+	float z[4];
+	float w[4];
+	vector_store(xxxx, &x[0]);
+	vector_store(yyyy, &y[0]);
+	vector_store(zzzz, &z[0]);
+	vector_store(wwww, &w[0]);
+
+	// Matches the documented bound of the least accurate platform
+	const float threshold = 5.0E-5F;
+	for (uint32_t rotation_index = 0; rotation_index < 4; ++rotation_index)
+	{
+		const quatf normalized = quat_set(x[rotation_index], y[rotation_index], z[rotation_index], w[rotation_index]);
+		CHECK(scalar_near_equal(quat_length(normalized), 1.0F, threshold));
+		CHECK(quat_near_equal(normalized, quat_normalize(rotations[rotation_index]), threshold));
+	}
+}
+
+TEST_CASE("quat drop largest component math", "[math][quat]")
+{
+	// Each rotation has a different largest component: X, Y, Z, and W
+	const quatf rotations[4] =
+	{
+		quat_normalize(quat_set(0.9F, 0.2F, -0.3F, 0.1F)),
+		quat_normalize(quat_set(0.1F, -0.8F, 0.3F, 0.2F)),
+		quat_normalize(quat_set(0.2F, 0.1F, -0.95F, -0.1F)),
+		quat_normalize(quat_set(0.1F, 0.2F, 0.3F, 0.9F)),
+	};
+
+	// The dropped component is: 0 = W, 1 = X, 2 = Y, 3 = Z
+	const uint32_t dropped_components[4] = { 1, 2, 3, 0 };
+
+	uint8_t format_per_track_data[4];
+	float x[4];
+	float y[4];
+	float z[4];
+	for (uint32_t rotation_index = 0; rotation_index < 4; ++rotation_index)
+	{
+		// Encode: the dropped component is moved into W and made positive
+		const vector4f swizzled = acl_impl::swizzle_dropped_component(quat_to_vector(rotations[rotation_index]), dropped_components[rotation_index]);
+		CHECK(vector_get_w(swizzled) >= 0.0F);
+
+		x[rotation_index] = vector_get_x(swizzled);
+		y[rotation_index] = vector_get_y(swizzled);
+		z[rotation_index] = vector_get_z(swizzled);
+		format_per_track_data[rotation_index] = uint8_t(dropped_components[rotation_index] << acl_impl::k_dropped_component_metadata_shift);
+	}
+
+	// Decode: the W slot is reconstructed from the three stored components and the original order restored
+	vector4f xxxx = vector_load(&x[0]);
+	vector4f yyyy = vector_load(&y[0]);
+	vector4f zzzz = vector_load(&z[0]);
+	vector4f wwww = acl_impl::quat_from_positive_w4(xxxx, yyyy, zzzz);
+
+	float w[4];
+	vector_store(wwww, &w[0]);
+
+	acl_impl::quat_unswizzle_dropped_component4(&format_per_track_data[0], xxxx, yyyy, zzzz, wwww);
+
+	float out_x[4];
+	float out_y[4];
+	float out_z[4];
+	float out_w[4];
+	vector_store(xxxx, &out_x[0]);
+	vector_store(yyyy, &out_y[0]);
+	vector_store(zzzz, &out_z[0]);
+	vector_store(wwww, &out_w[0]);
+
+	const float threshold = 1.0E-5F;
+	for (uint32_t rotation_index = 0; rotation_index < 4; ++rotation_index)
+	{
+		// The rotation is negated during encoding when its dropped component is negative
+		float components[4];
+		vector_store(quat_to_vector(rotations[rotation_index]), &components[0]);
+		const uint32_t dropped_component = dropped_components[rotation_index];
+		const float dropped_value = components[dropped_component == 0 ? 3 : (dropped_component - 1)];
+		const quatf expected = dropped_value < 0.0F ? vector_to_quat(vector_neg(quat_to_vector(rotations[rotation_index]))) : rotations[rotation_index];
+
+		const quatf decoded4 = quat_set(out_x[rotation_index], out_y[rotation_index], out_z[rotation_index], out_w[rotation_index]);
+		CHECK(quat_near_equal(decoded4, expected, threshold));
+
+		const quatf decoded = acl_impl::quat_unswizzle_dropped_component(quat_set(x[rotation_index], y[rotation_index], z[rotation_index], w[rotation_index]), dropped_component);
+		CHECK(quat_near_equal(decoded, expected, threshold));
+	}
+}
@@ -30,6 +30,7 @@
 #include <rtm/scalarf.h>
 
 #include <cstring>
+#include <vector>
 
 using namespace acl;
 using namespace rtm;
@@ -503,6 +504,79 @@ TEST_CASE("decay_vector3_XX", "[math][vector4][decay]")
 	CHECK(num_errors == 0);
 }
 
+TEST_CASE("pack_vector3_XX array", "[math][vector4][packing]")
+{
+	const uint32_t offsets[] = { 0, 1, 5, 31, 32, 33, 63, 64, 65, 93 };
+	constexpr uint32_t k_num_vectors = 7;
+
+	const vector4f vzero = vector_set(0.0F);
+	const vector4f vone = vector_set(1.0F);
+	const vector4f vneg_one = vector_set(-1.0F);
+
+	alignas(16) uint8_t buffer[128];
+	vector4f vectors[k_num_vectors];
+	vector4f unpacked_vectors[k_num_vectors];
+
+	uint32_t num_errors = 0;
+
+	for (uint32_t bit_rate = 1; bit_rate < acl_impl::k_highest_bit_rate; ++bit_rate)
+	{
+		const uint32_t num_bits = acl_impl::get_num_bits_at_bit_rate(bit_rate);
+		const uint32_t max_value = (1 << num_bits) - 1;
+
+		for (size_t offset_idx = 0; offset_idx < get_array_size(offsets); ++offset_idx)
+		{
+			const uint32_t offset = offsets[offset_idx];
+
+			for (uint32_t vector_index = 0; vector_index < k_num_vectors; ++vector_index)
+			{
+				const uint32_t value = (vector_index * 7919) % (max_value + 1);
+				vectors[vector_index] = vector_clamp(vector_set(
+					unpack_scalar_unsigned(value, num_bits),
+					unpack_scalar_unsigned(max_value - value, num_bits),
+					unpack_scalar_unsigned(value / 2, num_bits)), vzero, vone);
+			}
+
+			// The bits before our offset must be retained
+			std::memset(&buffer[0], 0xFF, sizeof(buffer));
+			pack_vector3_uXX_array(&vectors[0], k_num_vectors, num_bits, &buffer[0], offset);
+			if (offset != 0 && (buffer[0] >> (8 - std::min<uint32_t>(offset, 8))) != (0xFFU >> (8 - std::min<uint32_t>(offset, 8))))
+				num_errors++;
+
+			unpack_vector3_uXX_array_unsafe(num_bits, &buffer[0], offset, k_num_vectors, &unpacked_vectors[0]);
+			for (uint32_t vector_index = 0; vector_index < k_num_vectors; ++vector_index)
+			{
+				if (!vector_all_near_equal3(vectors[vector_index], unpacked_vectors[vector_index], 1.0E-6F))
+					num_errors++;
+
+				// Every vector must match the single value version
+				const vector4f vec1 = unpack_vector3_uXX_unsafe(num_bits, &buffer[0], offset + (vector_index * num_bits * 3));
+				if (!vector_all_near_equal3(vectors[vector_index], vec1, 1.0E-6F))
+					num_errors++;
+			}
+
+			for (uint32_t vector_index = 0; vector_index < k_num_vectors; ++vector_index)
+			{
+				const uint32_t value = (vector_index * 7919) % (max_value + 1);
+				vectors[vector_index] = vector_clamp(vector_set(
+					unpack_scalar_signed(value, num_bits),
+					unpack_scalar_signed(max_value - value, num_bits),
+					unpack_scalar_signed(value / 2, num_bits)), vneg_one, vone);
+			}
+
+			pack_vector3_sXX_array(&vectors[0], k_num_vectors, num_bits, &buffer[0], offset);
+			unpack_vector3_sXX_array_unsafe(num_bits, &buffer[0], offset, k_num_vectors, &unpacked_vectors[0]);
+			for (uint32_t vector_index = 0; vector_index < k_num_vectors; ++vector_index)
+			{
+				if (!vector_all_near_equal3(vectors[vector_index], unpacked_vectors[vector_index], 1.0E-6F))
+					num_errors++;
+			}
+		}
+	}
+
+	CHECK(num_errors == 0);
+}
+
 TEST_CASE("pack_vector2_64", "[math][vector4][packing]")
 {
 	{
@@ -595,6 +669,58 @@ TEST_CASE("pack_vector2_XX part1", "[math][vector4][packing]")
 	CHECK(num_errors == 0);
 }
 
+TEST_CASE("unpack_vectorX_uXX end of buffer", "[math][vector4][packing]")
+{
+	// Unpacking can read up to 16 bytes starting at the byte that holds the first bit of a sample.
+	// We place our samples at the end of a buffer that provides exactly that much, the address
+	// sanitizer catches any read past it. Unused bits are set to make sure they are masked out.
+	const vector4f vzero = vector_set(0.0F);
+	const vector4f vone = vector_set(1.0F);
+
+	alignas(16) uint8_t packed_buffer[64];
+
+	uint32_t num_errors = 0;
+
+	for (uint32_t bit_rate = 1; bit_rate < acl_impl::k_highest_bit_rate; ++bit_rate)
+	{
+		const uint32_t num_bits = acl_impl::get_num_bits_at_bit_rate(bit_rate);
+		const uint32_t max_value = (1 << num_bits) - 1;
+
+		const vector4f vec0 = vector_clamp(vector_set(
+			unpack_scalar_unsigned(max_value, num_bits),
+			unpack_scalar_unsigned(max_value / 3, num_bits),
+			unpack_scalar_unsigned(max_value / 2, num_bits),
+			unpack_scalar_unsigned(max_value / 5, num_bits)), vzero, vone);
+
+		for (uint32_t offset = 0; offset < 16; ++offset)
+		{
+			std::vector<uint8_t> buffer((offset / 8) + 16, uint8_t(0xFF));
+
+			pack_vector4_uXX_unsafe(vec0, num_bits, &packed_buffer[0]);
+			memcpy_bits(buffer.data(), offset, &packed_buffer[0], 0, size_t(num_bits) * 4);
+			vector4f vec1 = unpack_vector4_uXX_unsafe(num_bits, buffer.data(), offset);
+			if (!vector_all_near_equal(vec0, vec1, 1.0E-6F))
+				num_errors++;
+
+			std::memset(buffer.data(), 0xFF, buffer.size());
+			pack_vector3_uXX_unsafe(vec0, num_bits, &packed_buffer[0]);
+			memcpy_bits(buffer.data(), offset, &packed_buffer[0], 0, size_t(num_bits) * 3);
+			vec1 = unpack_vector3_uXX_unsafe(num_bits, buffer.data(), offset);
+			if (!vector_all_near_equal3(vec0, vec1, 1.0E-6F))
+				num_errors++;
+
+			std::memset(buffer.data(), 0xFF, buffer.size());
+			pack_vector2_uXX_unsafe(vec0, num_bits, &packed_buffer[0]);
+			memcpy_bits(buffer.data(), offset, &packed_buffer[0], 0, size_t(num_bits) * 2);
+			vec1 = unpack_vector2_uXX_unsafe(num_bits, buffer.data(), offset);
+			if (!vector_all_near_equal2(vec0, vec1, 1.0E-6F))
+				num_errors++;
+		}
+	}
+
+	CHECK(num_errors == 0);
+}
+
 TEST_CASE("misc vector4 packing", "[math][vector4][packing]")
 {
 	CHECK(get_packed_vector_size(vector_format8::vector3f_full) == 12);
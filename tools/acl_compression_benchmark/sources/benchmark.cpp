@@ -0,0 +1,484 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "benchmark.h"
+
+#include <acl/core/ansi_allocator.h>
+#include <acl/core/compressed_database.h>
+#include <acl/core/compressed_tracks.h>
+#include <acl/core/memory_utils.h>
+#include <acl/compression/compress.h>
+#include <acl/compression/convert.h>
+#include <acl/compression/transform_error_metrics.h>
+#include <acl/io/clip_reader.h>
+
+#include <benchmark/benchmark.h>
+
+#include <sjson/parser.h>
+#include <sjson/writer.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////
+// Constants
+
+// The proportion of keyframes we strip when benchmarking keyframe stripping
+static constexpr float k_keyframe_stripping_proportion = 0.5F;
+
+//////////////////////////////////////////////////////////////////////////
+
+enum class CompressionMode
+{
+	Default,
+	Database,
+	KeyframeStripping,
+};
+
+static const char* get_compression_mode_name(CompressionMode mode)
+{
+	switch (mode)
+	{
+	case CompressionMode::Default:				return "default";
+	case CompressionMode::Database:				return "database";
+	case CompressionMode::KeyframeStripping:	return "keyframe_stripping";
+	default:									return "<unknown>";
+	}
+}
+
+static constexpr CompressionMode k_compression_modes[] = { CompressionMode::Default, CompressionMode::Database, CompressionMode::KeyframeStripping };
+
+static constexpr acl::compression_level8 k_compression_levels[] =
+{
+	acl::compression_level8::lowest,
+	acl::compression_level8::low,
+	acl::compression_level8::medium,
+	acl::compression_level8::high,
+	acl::compression_level8::highest,
+};
+
+struct benchmark_clip
+{
+	std::string name;
+
+	acl::track_array track_list;
+
+	acl::track_array_qvvf additive_base_track_list;
+	acl::additive_clip_format8 additive_format = acl::additive_clip_format8::none;
+
+	uint32_t raw_size = 0;
+};
+
+benchmark_allocator s_allocator;
+static std::vector<benchmark_clip> s_clips;
+
+static acl::qvvf_transform_error_metric s_error_metric;
+static acl::additive_qvvf_transform_error_metric<acl::additive_clip_format8::relative> s_relative_error_metric;
+static acl::additive_qvvf_transform_error_metric<acl::additive_clip_format8::additive0> s_additive0_error_metric;
+static acl::additive_qvvf_transform_error_metric<acl::additive_clip_format8::additive1> s_additive1_error_metric;
+
+void* benchmark_allocator::allocate(size_t size, size_t alignment)
+{
+	m_live_size += size;
+	m_peak_size = std::max(m_peak_size, m_live_size);
+	return m_allocator.allocate(size, alignment);
+}
+
+void benchmark_allocator::deallocate(void* ptr, size_t size)
+{
+	if (ptr == nullptr)
+		return;
+
+	m_live_size -= size;
+	m_allocator.deallocate(ptr, size);
+}
+
+void clear_benchmark_state()
+{
+	s_clips.clear();
+	s_clips.shrink_to_fit();
+}
+
+static acl::itransform_error_metric* get_error_metric(acl::additive_clip_format8 additive_format)
+{
+	switch (additive_format)
+	{
+	case acl::additive_clip_format8::relative:
+		return &s_relative_error_metric;
+	case acl::additive_clip_format8::additive0:
+		return &s_additive0_error_metric;
+	case acl::additive_clip_format8::additive1:
+		return &s_additive1_error_metric;
+	case acl::additive_clip_format8::none:
+	default:
+		return &s_error_metric;
+	}
+}
+
+static acl::compression_settings make_settings(const benchmark_clip& clip, acl::compression_level8 level, CompressionMode mode)
+{
+	acl::compression_settings settings = acl::get_default_compression_settings();
+	settings.level = level;
+
+	if (clip.track_list.get_track_type() == acl::track_type8::qvvf)
+		settings.error_metric = get_error_metric(clip.additive_format);
+
+	switch (mode)
+	{
+	case CompressionMode::Default:
+		break;
+	case CompressionMode::Database:
+		settings.enable_database_support = true;
+		break;
+	case CompressionMode::KeyframeStripping:
+		settings.keyframe_stripping.enable_stripping = true;
+		settings.keyframe_stripping.proportion = k_keyframe_stripping_proportion;
+		break;
+	}
+
+	return settings;
+}
+
+// Compresses a clip and builds its database if needed, returns the size of the output
+static acl::error_result compress_clip(const benchmark_clip& clip, const acl::compression_settings& settings, acl::output_stats& stats, uint32_t& out_output_size)
+{
+	out_output_size = 0;
+
+	acl::compressed_tracks* compressed_tracks = nullptr;
+	acl::error_result result;
+
+	if (clip.additive_format != acl::additive_clip_format8::none)
+	{
+		const acl::track_array_qvvf& track_list = acl::track_array_cast<acl::track_array_qvvf>(clip.track_list);
+		result = acl::compress_track_list(s_allocator, track_list, settings, clip.additive_base_track_list, clip.additive_format, compressed_tracks, stats);
+	}
+	else
+		result = acl::compress_track_list(s_allocator, clip.track_list, settings, compressed_tracks, stats);
+
+	if (result.any())
+		return result;
+
+	out_output_size = compressed_tracks->get_size();
+
+	if (settings.enable_database_support)
+	{
+		acl::compression_database_settings database_settings;
+
+		acl::compressed_tracks* database_tracks[1] = { nullptr };
+		acl::compressed_database* database = nullptr;
+		result = acl::build_database(s_allocator, database_settings, &compressed_tracks, 1, database_tracks, database);
+
+		if (result.empty())
+		{
+			out_output_size = database_tracks[0]->get_size() + database->get_total_size();
+
+			s_allocator.deallocate(database_tracks[0], database_tracks[0]->get_size());
+			s_allocator.deallocate(database, database->get_size());
+		}
+	}
+
+	s_allocator.deallocate(compressed_tracks, compressed_tracks->get_size());
+	return result;
+}
+
+static void benchmark_compression(benchmark::State& state)
+{
+	const benchmark_clip& clip = s_clips[static_cast<size_t>(state.range(0))];
+	const acl::compression_level8 level = static_cast<acl::compression_level8>(state.range(1));
+	const CompressionMode mode = static_cast<CompressionMode>(state.range(2));
+
+	const acl::compression_settings settings = make_settings(clip, level, mode);
+
+	uint32_t output_size = 0;
+	size_t peak_memory_size = 0;
+
+	for (auto _ : state)
+	{
+		const size_t live_size = s_allocator.get_live_size();
+		s_allocator.reset_peak_size();
+
+		acl::output_stats stats;
+		const acl::error_result result = compress_clip(clip, settings, stats, output_size);
+		if (result.any())
+		{
+			state.SkipWithError(result.c_str());
+			break;
+		}
+
+		peak_memory_size = std::max(peak_memory_size, s_allocator.get_peak_size() - live_size);
+	}
+
+	state.counters["Clips"] = benchmark::Counter(double(state.iterations()), benchmark::Counter::kIsRate);
+	state.counters["PeakMem"] = benchmark::Counter(double(peak_memory_size), benchmark::Counter::kDefaults, benchmark::Counter::OneK::kIs1024);
+	state.counters["Size"] = benchmark::Counter(double(output_size), benchmark::Counter::kDefaults, benchmark::Counter::OneK::kIs1024);
+	state.counters["Ratio"] = output_size != 0 ? double(clip.raw_size) / double(output_size) : 0.0;
+}
+
+bool parse_metadata(const char* buffer, size_t buffer_size, std::string& out_clip_dir, std::vector<std::string>& out_clips)
+{
+	sjson::Parser parser(buffer, buffer_size);
+
+	sjson::StringView clip_dir;
+	parser.try_read("clip_dir", clip_dir, "");
+	out_clip_dir = std::string(clip_dir.c_str(), clip_dir.size());
+
+	if (!parser.array_begins("clips"))
+		return false;
+
+	while (!parser.try_array_ends())
+	{
+		sjson::StringView clip_filename;
+		if (parser.read(&clip_filename, 1))
+			out_clips.push_back(std::string(clip_filename.c_str(), clip_filename.size()));
+	}
+
+	if (!parser.remainder_is_comments_and_whitespace())
+		return false;
+
+	return true;
+}
+
+bool read_file(const char* filename, char*& out_buffer, size_t& out_buffer_size)
+{
+	out_buffer = nullptr;
+	out_buffer_size = 0;
+
+	std::FILE* file = nullptr;
+
+#ifdef _WIN32
+	char path[64 * 1024] = { 0 };
+	snprintf(path, acl::get_array_size(path), "\\\\?\\%s", filename);
+	fopen_s(&file, path, "rb");
+#else
+	file = fopen(filename, "rb");
+#endif
+
+	if (file == nullptr)
+		return false;
+
+	const int fseek_result = fseek(file, 0, SEEK_END);
+	if (fseek_result != 0)
+	{
+		fclose(file);
+		return false;
+	}
+
+#ifdef _WIN32
+	const size_t file_size = static_cast<size_t>(_ftelli64(file));
+#else
+	const size_t file_size = static_cast<size_t>(ftello(file));
+#endif
+
+	if (file_size == static_cast<size_t>(-1L))
+	{
+		fclose(file);
+		return false;
+	}
+
+	rewind(file);
+
+	char* buffer = acl::allocate_type_array_aligned<char>(s_allocator, file_size, 64);
+	const size_t result = fread(buffer, 1, file_size, file);
+	fclose(file);
+
+	if (result != file_size)
+	{
+		acl::deallocate_type_array(s_allocator, buffer, file_size);
+		return false;
+	}
+
+	out_buffer = buffer;
+	out_buffer_size = file_size;
+	return true;
+}
+
+static bool is_acl_sjson_file(const std::string& filename)
+{
+	return filename.size() >= 10 && filename.compare(filename.size() - 10, 10, ".acl.sjson") == 0;
+}
+
+static bool is_acl_bin_file(const std::string& filename)
+{
+	return filename.size() >= 4 && filename.compare(filename.size() - 4, 4, ".acl") == 0;
+}
+
+static bool read_clip(const std::string& clip_filename, benchmark_clip& out_clip)
+{
+	char* buffer = nullptr;
+	size_t buffer_size = 0;
+	if (!read_file(clip_filename.c_str(), buffer, buffer_size))
+		return false;
+
+	bool success = false;
+
+	if (is_acl_bin_file(clip_filename))
+	{
+		const acl::compressed_tracks* raw_tracks = reinterpret_cast<const acl::compressed_tracks*>(buffer);
+		if (buffer_size == raw_tracks->get_size() && raw_tracks->is_valid(true).empty())
+			success = acl::convert_track_list(s_allocator, *raw_tracks, out_clip.track_list).empty();
+	}
+	else
+	{
+		acl::clip_reader reader(s_allocator, buffer, buffer_size - 1);
+
+		switch (reader.get_file_type())
+		{
+		case acl::sjson_file_type::raw_clip:
+		{
+			acl::sjson_raw_clip raw_clip;
+			success = reader.read_raw_clip(raw_clip);
+			if (success)
+			{
+				out_clip.track_list = std::move(raw_clip.track_list);
+				out_clip.additive_base_track_list = std::move(raw_clip.additive_base_track_list);
+				out_clip.additive_format = raw_clip.additive_format;
+			}
+			break;
+		}
+		case acl::sjson_file_type::raw_track_list:
+		{
+			acl::sjson_raw_track_list raw_track_list;
+			success = reader.read_raw_track_list(raw_track_list);
+			if (success)
+				out_clip.track_list = std::move(raw_track_list.track_list);
+			break;
+		}
+		case acl::sjson_file_type::unknown:
+		default:
+			break;
+		}
+	}
+
+	acl::deallocate_type_array(s_allocator, buffer, buffer_size);
+
+	if (success)
+		out_clip.raw_size = out_clip.track_list.get_raw_size();
+
+	return success;
+}
+
+bool prepare_clip(const std::string& clip_dir, const std::string& clip)
+{
+	printf("Preparing clip %s ...\n", clip.c_str());
+
+	if (!is_acl_sjson_file(clip) && !is_acl_bin_file(clip))
+	{
+		printf("    Clip must be an ACL file of the form: [*.acl.sjson|*.acl]\n");
+		return false;
+	}
+
+	std::string clip_filename = clip_dir;
+	if (!clip_filename.empty())
+	{
+#ifdef _WIN32
+		clip_filename += '\\';
+#else
+		clip_filename += '/';
+#endif
+	}
+
+	clip_filename += clip;
+
+	benchmark_clip new_clip;
+	new_clip.name = clip;
+
+	if (!read_clip(clip_filename, new_clip))
+	{
+		printf("    Failed to read clip!\n");
+		return false;
+	}
+
+	if (new_clip.track_list.is_empty())
+	{
+		printf("    Clip has no tracks!\n");
+		return false;
+	}
+
+	const size_t clip_index = s_clips.size();
+	s_clips.push_back(std::move(new_clip));
+
+	// Dynamically register our benchmark
+	benchmark::internal::Benchmark* bench = benchmark::internal::RegisterBenchmarkInternal(new benchmark::internal::FunctionBenchmark(clip.c_str(), benchmark_compression));
+
+	for (acl::compression_level8 level : k_compression_levels)
+	{
+		for (CompressionMode mode : k_compression_modes)
+			bench->Args({ int64_t(clip_index), int64_t(level), int64_t(mode) });
+	}
+
+	// Name our arguments
+	bench->ArgNames({ "", "Level", "Mode" });
+
+	// Compression is slow enough that a few iterations are representative
+	bench->Unit(benchmark::kMillisecond);
+	bench->Repetitions(3);
+
+	// Add min/max tracking
+	bench->ComputeStatistics("min", [](const std::vector<double>& v) { return *std::min_element(std::begin(v), std::end(v)); });
+	bench->ComputeStatistics("max", [](const std::vector<double>& v) { return *std::max_element(std::begin(v), std::end(v)); });
+
+	return true;
+}
+
+void write_stage_stats(std::FILE* file)
+{
+	sjson::FileStreamWriter stream_writer(file);
+	sjson::Writer writer(stream_writer);
+
+	writer["runs"] = [&](sjson::ArrayWriter& runs_writer)
+	{
+		for (const benchmark_clip& clip : s_clips)
+		{
+			for (acl::compression_level8 level : k_compression_levels)
+			{
+				for (CompressionMode mode : k_compression_modes)
+				{
+					runs_writer.push([&](sjson::ObjectWriter& run_writer)
+						{
+							run_writer["clip_name"] = clip.name.c_str();
+							run_writer["level"] = acl::get_compression_level_name(level);
+							run_writer["mode"] = get_compression_mode_name(mode);
+
+							const acl::compression_settings settings = make_settings(clip, level, mode);
+
+							run_writer["stats"] = [&](sjson::ObjectWriter& stats_writer)
+							{
+								acl::output_stats stats;
+								stats.logging = acl::stat_logging::detailed;
+								stats.writer = &stats_writer;
+
+								uint32_t output_size = 0;
+								const acl::error_result result = compress_clip(clip, settings, stats, output_size);
+								if (result.any())
+									stats_writer["error"] = result.c_str();
+							};
+						});
+				}
+			}
+		}
+	};
+}
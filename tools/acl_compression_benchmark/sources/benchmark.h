@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <acl/core/ansi_allocator.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////
+// An allocator that tracks how much memory is live and its peak
+// Compression runs on a single thread in this benchmark, no synchronization is required
+class benchmark_allocator final : public acl::iallocator
+{
+public:
+	virtual void* allocate(size_t size, size_t alignment = k_default_alignment) override;
+	virtual void deallocate(void* ptr, size_t size) override;
+
+	// Sets the peak to the current live size, the next peak is measured from there
+	void reset_peak_size() { m_peak_size = m_live_size; }
+
+	size_t get_live_size() const { return m_live_size; }
+	size_t get_peak_size() const { return m_peak_size; }
+
+private:
+	acl::ansi_allocator m_allocator;
+	size_t m_live_size = 0;
+	size_t m_peak_size = 0;
+};
+
+extern benchmark_allocator s_allocator;
+
+void clear_benchmark_state();
+
+bool parse_metadata(const char* buffer, size_t buffer_size, std::string& out_clip_dir, std::vector<std::string>& out_clips);
+
+bool read_file(const char* filename, char*& out_buffer, size_t& out_buffer_size);
+
+// Reads a raw clip in the '.acl.sjson' or '.acl' format and registers its benchmarks
+bool prepare_clip(const std::string& clip_dir, const std::string& clip);
+
+// Compresses every clip once with every configuration and writes their detailed stats, including the time
+// spent in every compression stage
+void write_stage_stats(std::FILE* file);
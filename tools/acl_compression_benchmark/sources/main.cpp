@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "benchmark.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct Options
+{
+	const char* metadata_filename = nullptr;
+	const char* input_filename = nullptr;
+	const char* stats_filename = nullptr;
+};
+
+static bool is_sjson_file(const char* filename)
+{
+	const size_t filename_len = std::strlen(filename);
+	return filename_len >= 6 && std::strncmp(filename + filename_len - 6, ".sjson", 6) == 0;
+}
+
+static bool parse_options(int argc, char* argv[], Options& out_options)
+{
+	for (int arg_index = 1; arg_index < argc; ++arg_index)
+	{
+		const char* argument = argv[arg_index];
+
+		static constexpr const char* k_metadata_input_file_option = "-metadata=";
+		size_t option_length = std::strlen(k_metadata_input_file_option);
+		if (std::strncmp(argument, k_metadata_input_file_option, option_length) == 0)
+		{
+			out_options.metadata_filename = argument + option_length;
+			if (!is_sjson_file(out_options.metadata_filename))
+			{
+				printf("Metadata file must be an SJSON file of the form: [*.sjson]\n");
+				return false;
+			}
+
+			continue;
+		}
+
+		static constexpr const char* k_input_file_option = "-input=";
+		option_length = std::strlen(k_input_file_option);
+		if (std::strncmp(argument, k_input_file_option, option_length) == 0)
+		{
+			out_options.input_filename = argument + option_length;
+			continue;
+		}
+
+		static constexpr const char* k_stats_output_file_option = "-stats=";
+		option_length = std::strlen(k_stats_output_file_option);
+		if (std::strncmp(argument, k_stats_output_file_option, option_length) == 0)
+		{
+			out_options.stats_filename = argument + option_length;
+			if (!is_sjson_file(out_options.stats_filename))
+			{
+				printf("Stats output file must be an SJSON file of the form: [*.sjson]\n");
+				return false;
+			}
+
+			continue;
+		}
+	}
+
+	if (out_options.metadata_filename == nullptr && out_options.input_filename == nullptr)
+	{
+		printf("An input clip or a metadata file must be provided: -input=<*.acl.sjson|*.acl> -metadata=<*.sjson>\n");
+		return false;
+	}
+
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	Options options;
+	if (!parse_options(argc, argv, options))
+		return -1;
+
+	std::string clip_dir;
+	std::vector<std::string> clips;
+
+	if (options.metadata_filename != nullptr)
+	{
+		char* metadata_buffer = nullptr;
+		size_t metadata_buffer_size = 0;
+		if (!read_file(options.metadata_filename, metadata_buffer, metadata_buffer_size))
+			return -2;
+
+		const bool is_metadata_valid = parse_metadata(metadata_buffer, metadata_buffer_size, clip_dir, clips);
+		acl::deallocate_type_array(s_allocator, metadata_buffer, metadata_buffer_size);
+
+		if (!is_metadata_valid)
+			return -3;
+	}
+	else
+		clips.push_back(options.input_filename);
+
+	uint32_t num_clips = 0;
+	for (const std::string& clip : clips)
+	{
+		if (prepare_clip(clip_dir, clip))
+			num_clips++;
+	}
+
+	if (num_clips == 0)
+		return -4;
+
+	if (options.stats_filename != nullptr)
+	{
+		std::FILE* stats_file = nullptr;
+
+#ifdef _WIN32
+		fopen_s(&stats_file, options.stats_filename, "w");
+#else
+		stats_file = fopen(options.stats_filename, "w");
+#endif
+
+		if (stats_file == nullptr)
+		{
+			printf("Failed to open stats output file: %s\n", options.stats_filename);
+			return -5;
+		}
+
+		printf("Writing compression stage stats ...\n");
+		write_stage_stats(stats_file);
+		fclose(stats_file);
+	}
+
+	benchmark::Initialize(&argc, argv);
+
+	// Run benchmarks
+	benchmark::RunSpecifiedBenchmarks();
+
+	// Clean up
+	clear_benchmark_state();
+
+	return 0;
+}
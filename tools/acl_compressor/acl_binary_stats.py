@@ -0,0 +1,48 @@
+import numpy
+import struct
+
+# Reads the exhaustive error records written by acl_compressor with -stat_binary=<path>.
+# See 'binary_stats_writer' in includes/acl/compression/output_stats.h for the format.
+
+EXHAUSTIVE_ERRORS_TAG = 0x454C4341	# 'ACLE'
+EXHAUSTIVE_ERRORS_VERSION = 1
+
+class ExhaustiveErrors:
+	def __init__(self, sample_rate, segment_sample_offsets, errors):
+		self.sample_rate = sample_rate
+		self.segment_sample_offsets = segment_sample_offsets
+
+		# Indexed as [bone_index, sample_index]
+		self.errors = errors
+
+	def get_num_bones(self):
+		return self.errors.shape[0]
+
+	def get_num_samples(self):
+		return self.errors.shape[1]
+
+	def get_segment_errors(self, segment_index):
+		"""Returns the errors of a segment indexed as [sample_index, bone_index]"""
+		start_offset = self.segment_sample_offsets[segment_index]
+		if segment_index + 1 < len(self.segment_sample_offsets):
+			end_offset = self.segment_sample_offsets[segment_index + 1]
+		else:
+			end_offset = self.get_num_samples()
+
+		return self.errors[:, start_offset:end_offset].transpose()
+
+def read_exhaustive_errors(filename, offset):
+	"""Reads the exhaustive errors record that begins at the provided offset"""
+	with open(filename, 'rb') as file:
+		file.seek(offset)
+
+		(tag, version, num_bones, num_samples, sample_rate, num_segments) = struct.unpack('<IIIIfI', file.read(24))
+		if tag != EXHAUSTIVE_ERRORS_TAG or version != EXHAUSTIVE_ERRORS_VERSION:
+			raise ValueError('Invalid exhaustive errors record in {} at offset {}'.format(filename, offset))
+
+		segment_sample_offsets = list(struct.unpack('<{}I'.format(num_segments), file.read(4 * num_segments)))
+
+		errors = numpy.fromfile(file, dtype='<f4', count = num_bones * num_samples)
+		errors = errors.reshape((num_bones, num_samples))
+
+	return ExhaustiveErrors(sample_rate, segment_sample_offsets, errors)
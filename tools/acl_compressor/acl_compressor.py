@@ -3,6 +3,7 @@ import numpy
 import os
 import platform
 import queue
+import subprocess
 import threading
 import time
 import signal
@@ -10,6 +11,8 @@ import sys
 
 from itertools import chain
 
+from acl_binary_stats import read_exhaustive_errors
+
 # This script depends on a SJSON parsing package:
 # https://pypi.python.org/pypi/SJSON/1.1.0
 # https://shelter13.net/projects/SJSON/
@@ -28,9 +31,12 @@ def parse_argv():
 	options['csv_error'] = False
 	options['refresh'] = False
 	options['num_threads'] = 1
+	options['num_clip_threads'] = 1
 	options['has_progress_bar'] = True
 	options['stat_detailed'] = False
 	options['stat_exhaustive'] = False
+	options['stat_size'] = False
+	options['stat_memory'] = False
 	options['level'] = 'Medium'
 	options['print_help'] = False
 
@@ -74,9 +80,18 @@ def parse_argv():
 		if value == '-stat_exhaustive':
 			options['stat_exhaustive'] = True
 
+		if value == '-stat_size':
+			options['stat_size'] = True
+
+		if value == '-stat_memory':
+			options['stat_memory'] = True
+
 		if value.startswith('-parallel='):
 			options['num_threads'] = int(value[len('-parallel='):].replace('"', ''))
 
+		if value.startswith('-clip_threads='):
+			options['num_clip_threads'] = int(value[len('-clip_threads='):].replace('"', ''))
+
 		if value.startswith('-level='):
 			options['level'] = value[len('-level='):].replace('"', '').capitalize()
 
@@ -102,6 +117,11 @@ def parse_argv():
 		print_usage()
 		sys.exit(1)
 
+	if options['num_clip_threads'] < 0:
+		print('-clip_threads switch argument must be positive')
+		print_usage()
+		sys.exit(1)
+
 	if not os.path.exists(options['acl']) or not os.path.isdir(options['acl']):
 		print('ACL input directory not found: {}'.format(options['acl']))
 		print_usage()
@@ -118,7 +138,7 @@ def parse_argv():
 	return options
 
 def print_usage():
-	print('Usage: python acl_compressor.py -acl=<path to directory containing ACL files> -stats=<path to output directory for stats> [-csv_summary] [-csv_bit_rate] [-csv_animated_size] [-csv_error] [-refresh] [-parallel={Num Threads}] [-help]')
+	print('Usage: python acl_compressor.py -acl=<path to directory containing ACL files> -stats=<path to output directory for stats> [-csv_summary] [-csv_bit_rate] [-csv_animated_size] [-csv_error] [-refresh] [-parallel={Num Threads}] [-clip_threads={Num Threads}] [-help]')
 
 def print_help():
 	print('Usage: python acl_compressor.py [arguments]')
@@ -134,9 +154,12 @@ def print_help():
 	print('  -csv_error: Generates a CSV with the error for every bone at every key frame. The executable must be compiled with exhaustive statistics enabled.')
 	print('  -refresh: If an output stat file already exists for a particular clip, it is recompressed anyway instead of being skipped.')
 	print('  -parallel=<Num Threads>: Allows multiple clips to be compressed and processed in parallel.')
+	print('  -clip_threads=<Num Threads>: Number of threads used to compress and validate each clip, 0 uses every hardware thread. Useful for large clips.')
 	print('  -no_progress_bar: Suppresses the progress bar output')
 	print('  -stat_detailed: Enables detailed stat logging')
 	print('  -stat_exhaustive: Enables exhaustive stat logging')
+	print('  -stat_size: Enables compressed size attribution stat logging')
+	print('  -stat_memory: Enables compression memory usage stat logging')
 	print('  -help: Prints this help message.')
 
 def print_stat(stat):
@@ -279,19 +302,51 @@ def print_progress(iteration, total, prefix='', suffix='', decimals = 1, bar_len
 	if iteration == total:
 		sys.stdout.write('\n')
 
-def run_acl_compressor(cmd_queue, result_queue):
+def start_acl_compressor_server(compressor_exe_path, num_clip_threads):
+	# The number of threads used per clip is set once when the server starts
+	cmd = [compressor_exe_path, '-server']
+	if num_clip_threads != 1:
+		cmd.append('-threads={}'.format(num_clip_threads))
+
+	return subprocess.Popen(cmd, stdin = subprocess.PIPE, stdout = subprocess.PIPE, universal_newlines = True)
+
+def run_acl_compressor(compressor_exe_path, cmd_queue, result_queue, num_clip_threads):
+	# Each thread keeps a compressor running in server mode and sends it one job per line
+	server = start_acl_compressor_server(compressor_exe_path, num_clip_threads)
+
 	while True:
 		entry = cmd_queue.get()
 		if entry is None:
-			return
+			break
 
 		(acl_filename, cmd) = entry
 
-		result = os.system(cmd)
+		server.stdin.write('{}\n'.format(cmd))
+		server.stdin.flush()
+
+		result = None
+		while True:
+			line = server.stdout.readline()
+			if len(line) == 0:
+				break	# The server exited
+
+			if line.startswith('job_done '):
+				result = int(line[len('job_done '):])
+				break
+
+			sys.stdout.write(line)
+
 		if result != 0:
 			print('Failed to execute cmd: {}'.format(cmd))
 		result_queue.put(acl_filename)
 
+		if result is None:
+			# The server crashed, start a new one for the remaining jobs
+			server = start_acl_compressor_server(compressor_exe_path, num_clip_threads)
+
+	server.stdin.close()
+	server.wait()
+
 def compress_clips(options):
 	acl_dir = options['acl']
 	stat_dir = options['stats']
@@ -343,7 +398,7 @@ def compress_clips(options):
 
 			stat_filename = stat_filename.replace('\\\\?\\', '')
 
-			cmd = '{} -acl="{}" -stats="{}" -level={}'.format(compressor_exe_path, acl_filename, stat_filename, options['level'])
+			cmd = '-acl="{}" -stats="{}" -level={}'.format(acl_filename, stat_filename, options['level'])
 
 			if out_dir:
 				if filename.endswith('.acl.sjson'):
@@ -356,7 +411,15 @@ def compress_clips(options):
 				cmd = '{} -stat_detailed'.format(cmd)
 
 			if options['stat_exhaustive']:
-				cmd = '{} -stat_exhaustive'.format(cmd)
+				# Exhaustive errors are too large for SJSON, they are written in binary next to the stats
+				binary_stat_filename = stat_filename.replace('_stats.sjson', '_stats.aclstats')
+				cmd = '{} -stat_exhaustive -stat_binary="{}"'.format(cmd, binary_stat_filename)
+
+			if options['stat_size']:
+				cmd = '{} -stat_size'.format(cmd)
+
+			if options['stat_memory']:
+				cmd = '{} -stat_memory'.format(cmd)
 
 			if platform.system() == 'Windows':
 				cmd = cmd.replace('/', '\\')
@@ -375,7 +438,7 @@ def compress_clips(options):
 		result_queue = queue.Queue()
 		compression_start_time = time.perf_counter()
 
-		threads = [ threading.Thread(target = run_acl_compressor, args = (cmd_queue, result_queue)) for _i in range(options['num_threads']) ]
+		threads = [ threading.Thread(target = run_acl_compressor, args = (compressor_exe_path, cmd_queue, result_queue, options['num_clip_threads'])) for _i in range(options['num_threads']) ]
 		for thread in threads:
 			thread.daemon = True
 			thread.start()
@@ -418,6 +481,10 @@ def shorten_rotation_format(format):
 		return 'R:QuatNoW32'
 	elif format == 'quatf_drop_w_variable':
 		return 'R:QuatNoWVar'
+	elif format == 'quatf_drop_largest_variable':
+		return 'R:QuatNoLargestVar'
+	elif format == 'quatf_log_variable':
+		return 'R:QuatLogVar'
 	else:
 		return 'R:???'
 
@@ -430,6 +497,8 @@ def shorten_translation_format(format):
 		return 'T:Vec3_32'
 	elif format == 'vector3f_variable':
 		return 'T:Vec3Var'
+	elif format == 'vector3f_variable_per_component':
+		return 'T:Vec3VarXYZ'
 	else:
 		return 'T:???'
 
@@ -442,6 +511,8 @@ def shorten_scale_format(format):
 		return 'S:Vec3_32'
 	elif format == 'vector3f_variable':
 		return 'S:Vec3Var'
+	elif format == 'vector3f_variable_per_component':
+		return 'S:Vec3VarXYZ'
 	else:
 		return 'S:???'
 
@@ -456,6 +527,7 @@ def aggregate_stats(agg_run_stats, run_stats):
 		agg_data['total_compression_time'] = 0.0
 		agg_data['total_duration'] = 0.0
 		agg_data['max_error'] = 0
+		agg_data['max_memory_peak_size'] = 0
 		agg_data['num_runs'] = 0
 		agg_data['bit_rates'] = [0] * 25
 		agg_data['compressed_size'] = []
@@ -499,6 +571,8 @@ def aggregate_stats(agg_run_stats, run_stats):
 	agg_data['total_compression_time'] += run_stats['compression_time']
 	agg_data['total_duration'] += run_stats['duration']
 	agg_data['max_error'] = max(agg_data['max_error'], run_stats['max_error'])
+	if 'memory' in run_stats:
+		agg_data['max_memory_peak_size'] = max(agg_data['max_memory_peak_size'], run_stats['memory']['peak_size'])
 	agg_data['num_runs'] += 1
 	agg_data['compressed_size'].append(run_stats['compressed_size'])
 	if 'segments' in run_stats and len(run_stats['segments']) > 0:
@@ -635,9 +709,16 @@ def run_stat_parsing(options, stat_queue, result_queue):
 								quantization_memory_usage, is_looping)
 							stats_summary_data.append(data)
 
+						exhaustive_errors = None
+						if 'exhaustive_errors_file' in run_stats:
+							exhaustive_errors = read_exhaustive_errors(run_stats['exhaustive_errors_file'], int(run_stats['exhaustive_errors_offset']))
+
 						if 'segments' in run_stats and len(run_stats['segments']) > 0:
 							segment_index = 0
 							for segment in run_stats['segments']:
+								if exhaustive_errors is not None:
+									segment['error_per_frame_and_bone'] = exhaustive_errors.get_segment_errors(segment_index).tolist()
+
 								num_animated_tracks = run_stats.get('num_animated_tracks', 0)
 								stats_animated_size.append((run_stats['clip_name'], segment_index, float(segment['animated_frame_size']), num_animated_tracks))
 
@@ -712,6 +793,7 @@ def aggregate_job_stats(agg_job_results, job_results):
 				agg_job_results['agg_run_stats'][key]['total_compression_time'] += job_results['agg_run_stats'][key]['total_compression_time']
 				agg_job_results['agg_run_stats'][key]['total_duration'] += job_results['agg_run_stats'][key]['total_duration']
 				agg_job_results['agg_run_stats'][key]['max_error'] = max(agg_job_results['agg_run_stats'][key]['max_error'], job_results['agg_run_stats'][key]['max_error'])
+				agg_job_results['agg_run_stats'][key]['max_memory_peak_size'] = max(agg_job_results['agg_run_stats'][key]['max_memory_peak_size'], job_results['agg_run_stats'][key]['max_memory_peak_size'])
 				agg_job_results['agg_run_stats'][key]['num_runs'] += job_results['agg_run_stats'][key]['num_runs']
 				agg_job_results['agg_run_stats'][key]['compressed_size'] += job_results['agg_run_stats'][key]['compressed_size']
 				for i in range(25):
@@ -961,6 +1043,8 @@ if __name__ == "__main__":
 	for run_stats in run_types_by_size:
 		ratio = float(run_stats['total_raw_size']) / float(run_stats['total_compressed_size'])
 		print('Compressed {:.2f} MB, Elapsed {}, Ratio [{:.2f} : 1], Max error [{:.4f}] Run type: {}'.format(bytes_to_mb(run_stats['total_compressed_size']), format_elapsed_time(run_stats['total_compression_time']), ratio, run_stats['max_error'], run_stats['name']))
+		if options['stat_memory']:
+			print('    Peak compression memory: {:.2f} MB'.format(bytes_to_mb(run_stats['max_memory_peak_size'])))
 	print()
 	print('Total:')
 	total_raw_size = sum([x['total_raw_size'] for x in agg_run_stats.values()])
@@ -38,20 +38,25 @@ int main_impl(int argc, char* argv[]);
 #include "acl/compression/transform_error_metrics.h"
 #include "acl/decompression/decompression_settings.h"
 
+// When a thread pool is provided, samples are validated concurrently
+class thread_pool;
+
 void validate_accuracy(acl::iallocator& allocator,
 	const acl::track_array_qvvf& raw_tracks, const acl::track_array_qvvf& additive_base_tracks,
 	const acl::itransform_error_metric& error_metric,
 	const acl::compressed_tracks& compressed_tracks_,
-	double regression_error_threshold);
+	double regression_error_threshold,
+	thread_pool* pool);
 
-void validate_accuracy(acl::iallocator& allocator, const acl::track_array& raw_tracks, const acl::compressed_tracks& tracks, double regression_error_threshold);
+void validate_accuracy(acl::iallocator& allocator, const acl::track_array& raw_tracks, const acl::compressed_tracks& tracks, double regression_error_threshold, thread_pool* pool);
 
 void validate_metadata(const acl::track_array& raw_tracks, const acl::compressed_tracks& tracks);
 void validate_convert(acl::iallocator& allocator, const acl::track_array& raw_tracks);
 
 void validate_db(acl::iallocator& allocator, const acl::track_array_qvvf& raw_tracks, const acl::track_array_qvvf& additive_base_tracks,
 	const acl::compression_database_settings& settings, const acl::itransform_error_metric& error_metric,
-	const acl::compressed_tracks& compressed_tracks0, const acl::compressed_tracks& compressed_tracks1);
+	const acl::compressed_tracks& compressed_tracks0, const acl::compressed_tracks& compressed_tracks1,
+	thread_pool* pool);
 
 struct debug_transform_decompression_settings_with_db final : public acl::debug_transform_decompression_settings
 {
@@ -0,0 +1,189 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "acl/compression/compression_settings.h"
+#include "acl/compression/compression_thread_pool.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////
+// A pool of worker threads used to compress, validate, and gather
+// statistics of a single clip concurrently.
+// Built on top of the work stealing acl::compression_thread_pool, jobs
+// execute in any order. Exceptions thrown by jobs (e.g. when asserts throw)
+// are forwarded to the thread waiting on them.
+//////////////////////////////////////////////////////////////////////////
+class thread_pool
+{
+public:
+	using job_function = acl::compression_job_scheduler::job_function;
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates the requested number of worker threads, zero means one per hardware thread.
+	explicit thread_pool(uint32_t num_threads)
+		: m_jobs()
+		, m_lock()
+		, m_exception()
+		, m_pool(num_threads)
+	{
+	}
+
+	thread_pool(const thread_pool&) = delete;
+	thread_pool& operator=(const thread_pool&) = delete;
+
+	uint32_t get_num_threads() const { return m_pool.get_num_threads(); }
+
+	void submit_job(job_function job, void* job_data)
+	{
+		pending_job* pending = nullptr;
+
+		{
+			// A deque keeps the address of our pending jobs stable as it grows
+			std::unique_lock<std::mutex> lock(m_lock);
+			m_jobs.push_back(pending_job{ job, job_data, this });
+			pending = &m_jobs.back();
+		}
+
+		m_pool.submit_job(&pending_job::execute, pending);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Waits for every submitted job to complete.
+	// If a job threw an exception, the first one is rethrown here.
+	void wait_for_jobs()
+	{
+		m_pool.wait_for_jobs();
+
+		std::exception_ptr exception;
+
+		{
+			std::unique_lock<std::mutex> lock(m_lock);
+			m_jobs.clear();
+			std::swap(exception, m_exception);
+		}
+
+		if (exception)
+			std::rethrow_exception(exception);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns a job scheduler that submits to this pool for use with compression.
+	acl::compression_job_scheduler get_job_scheduler()
+	{
+		acl::compression_job_scheduler job_scheduler;
+		job_scheduler.submit_job = [](void* user_data, job_function job, void* job_data) { static_cast<thread_pool*>(user_data)->submit_job(job, job_data); };
+		job_scheduler.wait_for_jobs = [](void* user_data) { static_cast<thread_pool*>(user_data)->wait_for_jobs(); };
+		job_scheduler.user_data = this;
+		job_scheduler.max_num_jobs = get_num_threads();
+		return job_scheduler;
+	}
+
+private:
+	struct pending_job
+	{
+		job_function job;
+		void* job_data;
+		thread_pool* pool;
+
+		static void execute(void* job_data)
+		{
+			const pending_job& pending = *static_cast<const pending_job*>(job_data);
+
+			try
+			{
+				pending.job(pending.job_data);
+			}
+			catch (...)
+			{
+				std::unique_lock<std::mutex> lock(pending.pool->m_lock);
+				if (!pending.pool->m_exception)
+					pending.pool->m_exception = std::current_exception();
+			}
+		}
+	};
+
+	std::deque<pending_job>			m_jobs;
+	std::mutex						m_lock;
+	std::exception_ptr				m_exception;
+
+	// Destroyed first, it waits on the jobs that reference the members above
+	acl::compression_thread_pool	m_pool;
+};
+
+namespace thread_pool_impl
+{
+	template<typename range_function_type>
+	struct range_job
+	{
+		const range_function_type* function;
+		uint32_t first_index;
+		uint32_t last_index;
+
+		static void execute(void* job_data)
+		{
+			const range_job& job = *static_cast<const range_job*>(job_data);
+			(*job.function)(job.first_index, job.last_index);
+		}
+	};
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Splits [0, num_items) into contiguous ranges and calls function(first_index, last_index)
+// for each of them, last_index being exclusive. Ranges execute concurrently when a pool
+// is provided and on the calling thread otherwise.
+//////////////////////////////////////////////////////////////////////////
+template<typename range_function_type>
+inline void parallel_for(thread_pool* pool, uint32_t num_items, const range_function_type& function)
+{
+	const uint32_t num_jobs = pool != nullptr ? std::min<uint32_t>(pool->get_num_threads(), num_items) : 0;
+	if (num_jobs <= 1)
+	{
+		if (num_items != 0)
+			function(0, num_items);
+		return;
+	}
+
+	using range_job = thread_pool_impl::range_job<range_function_type>;
+	std::vector<range_job> jobs(num_jobs);
+
+	for (uint32_t job_index = 0; job_index < num_jobs; ++job_index)
+	{
+		range_job& job = jobs[job_index];
+		job.function = &function;
+		job.first_index = uint32_t((uint64_t(num_items) * job_index) / num_jobs);
+		job.last_index = uint32_t((uint64_t(num_items) * (job_index + 1)) / num_jobs);
+
+		pool->submit_job(&range_job::execute, &job);
+	}
+
+	pool->wait_for_jobs();
+}
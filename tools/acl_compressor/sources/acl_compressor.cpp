@@ -23,6 +23,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "acl_compressor.h"
+#include "thread_pool.h"
 
 #define DEBUG_MEGA_LARGE_CLIP 0
 
@@ -47,21 +48,29 @@
 
 #include "acl/core/ansi_allocator.h"
 #include "acl/core/floating_point_exceptions.h"
+#include "acl/core/mapped_file.h"
 #include "acl/core/string.h"
 #include "acl/core/impl/debug_track_writer.h"
 #include "acl/compression/compress.h"
 #include "acl/compression/convert.h"
+#include "acl/compression/skeleton_context.h"
 #include "acl/compression/transform_pose_utils.h"	// Just to test compilation
 #include "acl/decompression/decompress.h"
 #include "acl/io/clip_reader.h"
 
+#include <cstdlib>
 #include <cstring>
 #include <cstdio>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <fstream>
+#include <iostream>
 #include <streambuf>
 #include <sstream>
 #include <string>
 #include <memory>
+#include <vector>
 
 #if defined(_WIN32)
 	// The below excludes some other unused services from the windows headers -- see windows.h for details.
@@ -112,11 +121,21 @@
 
 	#include <windows.h>
 	#include <conio.h>
-
+#else
+	#include <dirent.h>
+	#include <sys/stat.h>
 #endif    // _WIN32
 
 using namespace acl;
 
+// What the settings search of '-autotune=' optimizes, see run_autotune(..)
+enum class autotune_objective
+{
+	none,			// Disabled
+	size,			// Smallest compressed size
+	speed,			// Fastest decompression
+};
+
 struct Options
 {
 #if defined(__ANDROID__)
@@ -140,6 +159,17 @@ struct Options
 	compression_level8	compression_level			= compression_level8::lowest;
 	bool			compression_level_specified		= false;
 
+	uint32_t		bit_rate_search_budget			= 0;
+	bit_rate_search_strategy8	bit_rate_search_strategy	= bit_rate_search_strategy8::permutations;
+	uint32_t		bit_rate_database_max_size		= 0;
+
+	bool			adaptive_segmenting				= false;
+	bool			sample_rate_reduction			= false;
+	bool			constant_rotation_quantization	= false;
+	bool			clip_range_quantization			= false;
+	bool			proxy_error_rejection			= false;
+	bool			output_layout					= false;
+
 	bool			regression_testing				= false;
 	bool			exhaustive_compression			= false;
 
@@ -153,6 +183,31 @@ struct Options
 
 	bool			stat_detailed_output			= false;
 	bool			stat_exhaustive_output			= false;
+	bool			stat_size_output				= false;
+	bool			stat_memory_output				= false;
+
+	// When provided, exhaustive errors are written to this binary file instead of the SJSON stats
+	const char*		output_binary_stats_filename	= nullptr;
+	std::FILE*		output_binary_stats_file		= nullptr;
+
+	// When enabled, jobs are read from the standard input until it closes, see run_server(..)
+	bool			server_mode						= false;
+
+	// A directory or a list file of clips to compress concurrently, see run_batch(..)
+	const char*		batch_path						= nullptr;
+
+	// When enabled, the settings space below is searched for the best settings of the clip, see run_autotune(..)
+	// Empty lists use a default space
+	autotune_objective	autotune					= autotune_objective::none;
+	const char*		autotune_config_filename		= nullptr;
+	std::vector<compression_level8>	autotune_levels;
+	std::vector<rotation_format8>	autotune_rotation_formats;
+	std::vector<vector_format8>		autotune_vector_formats;
+	std::vector<float>				autotune_stripping_proportions;
+
+	// Number of threads used to compress and validate a single clip, zero means all hardware threads
+	uint32_t		num_threads						= 1;
+	thread_pool*	pool							= nullptr;
 
 	//////////////////////////////////////////////////////////////////////////
 
@@ -162,6 +217,9 @@ struct Options
 	{
 		if (output_stats_file != nullptr && output_stats_file != stdout)
 			std::fclose(output_stats_file);
+
+		if (output_binary_stats_file != nullptr)
+			std::fclose(output_binary_stats_file);
 	}
 
 	Options(const Options&) = delete;
@@ -184,6 +242,42 @@ struct Options
 
 		output_stats_file = file != nullptr ? file : stdout;
 	}
+
+	void open_output_binary_stats_file()
+	{
+#ifdef _WIN32
+		char path[1 * 1024] = { 0 };
+		snprintf(path, get_array_size(path), "\\\\?\\%s", output_binary_stats_filename);
+		fopen_s(&output_binary_stats_file, path, "wb");
+#else
+		output_binary_stats_file = fopen(output_binary_stats_filename, "wb");
+#endif
+		ACL_ASSERT(output_binary_stats_file != nullptr, "Failed to open output binary stats file: ", output_binary_stats_filename);
+	}
+};
+
+// Writes binary statistics to a file
+class file_binary_stats_writer final : public binary_stats_writer
+{
+public:
+	explicit file_binary_stats_writer(std::FILE* file) : m_file(file) {}
+
+	virtual uint64_t get_offset() const override
+	{
+#ifdef _WIN32
+		return static_cast<uint64_t>(_ftelli64(m_file));
+#else
+		return static_cast<uint64_t>(ftello(m_file));
+#endif
+	}
+
+	virtual void write(const void* data, size_t size) override
+	{
+		std::fwrite(data, 1, size, m_file);
+	}
+
+private:
+	std::FILE* m_file;
 };
 
 static constexpr const char* k_acl_input_file_option = "-acl=";
@@ -191,6 +285,15 @@ static constexpr const char* k_config_input_file_option = "-config=";
 static constexpr const char* k_stats_output_option = "-stats";
 static constexpr const char* k_bin_output_option = "-out=";
 static constexpr const char* k_compression_level_option = "-level=";
+static constexpr const char* k_bit_rate_search_budget_option = "-budget=";
+static constexpr const char* k_bit_rate_search_strategy_option = "-search=";
+static constexpr const char* k_bit_rate_database_max_size_option = "-bit_rate_cache=";
+static constexpr const char* k_adaptive_segmenting_option = "-adaptive_segments";
+static constexpr const char* k_sample_rate_reduction_option = "-reduce_rate";
+static constexpr const char* k_constant_rotation_quantization_option = "-quantize_constants";
+static constexpr const char* k_clip_range_quantization_option = "-quantize_ranges";
+static constexpr const char* k_proxy_error_rejection_option = "-proxy_error";
+static constexpr const char* k_layout_output_option = "-layout";
 static constexpr const char* k_regression_test_option = "-test";
 static constexpr const char* k_exhaustive_compression_option = "-exhaustive";
 static constexpr const char* k_bind_pose_relative_option = "-bind_rel";
@@ -200,6 +303,18 @@ static constexpr const char* k_matrix_error_metric_option = "-error_mtx";
 static constexpr const char* k_split_into_database_option = "-db";
 static constexpr const char* k_stat_detailed_output_option = "-stat_detailed";
 static constexpr const char* k_stat_exhaustive_output_option = "-stat_exhaustive";
+static constexpr const char* k_stat_size_output_option = "-stat_size";
+static constexpr const char* k_stat_memory_output_option = "-stat_memory";
+static constexpr const char* k_stat_binary_output_option = "-stat_binary=";
+static constexpr const char* k_num_threads_option = "-threads=";
+static constexpr const char* k_server_mode_option = "-server";
+static constexpr const char* k_batch_option = "-batch=";
+static constexpr const char* k_autotune_option = "-autotune=";
+static constexpr const char* k_autotune_output_option = "-autotune_out=";
+static constexpr const char* k_autotune_levels_option = "-autotune_levels=";
+static constexpr const char* k_autotune_rotations_option = "-autotune_rotations=";
+static constexpr const char* k_autotune_vectors_option = "-autotune_vectors=";
+static constexpr const char* k_autotune_stripping_option = "-autotune_stripping=";
 
 bool is_acl_sjson_file(const char* filename)
 {
@@ -213,6 +328,28 @@ bool is_acl_bin_file(const char* filename)
 	return filename_len >= 4 && strncmp(filename + filename_len - 4, ".acl", 4) == 0;
 }
 
+// Splits a comma separated list of values
+static void split_option_list(const char* value, std::vector<std::string>& out_values)
+{
+	out_values.clear();
+
+	std::string current;
+	for (const char* iter = value; ; ++iter)
+	{
+		if (*iter == ',' || *iter == '\0')
+		{
+			if (!current.empty())
+				out_values.push_back(current);
+			current.clear();
+
+			if (*iter == '\0')
+				break;
+		}
+		else
+			current += *iter;
+	}
+}
+
 static bool parse_options(int argc, char** argv, Options& options)
 {
 	for (int arg_index = 1; arg_index < argc; ++arg_index)
@@ -304,6 +441,105 @@ static bool parse_options(int argc, char** argv, Options& options)
 			continue;
 		}
 
+		option_length = std::strlen(k_bit_rate_search_budget_option);
+		if (std::strncmp(argument, k_bit_rate_search_budget_option, option_length) == 0)
+		{
+			const char* budget_value = argument + option_length;
+			char* budget_value_end = nullptr;
+			const unsigned long budget = std::strtoul(budget_value, &budget_value_end, 10);
+			if (budget_value_end == budget_value || *budget_value_end != '\0')
+			{
+				printf("Invalid bit rate search budget specified: %s\n", budget_value);
+				return false;
+			}
+			options.bit_rate_search_budget = uint32_t(budget);
+			continue;
+		}
+
+		option_length = std::strlen(k_bit_rate_search_strategy_option);
+		if (std::strncmp(argument, k_bit_rate_search_strategy_option, option_length) == 0)
+		{
+			const char* strategy_name = argument + option_length;
+			if (!get_bit_rate_search_strategy(strategy_name, options.bit_rate_search_strategy))
+			{
+				printf("Invalid bit rate search strategy specified: %s\n", strategy_name);
+				return false;
+			}
+			continue;
+		}
+
+		option_length = std::strlen(k_bit_rate_database_max_size_option);
+		if (std::strncmp(argument, k_bit_rate_database_max_size_option, option_length) == 0)
+		{
+			const char* size_value = argument + option_length;
+			char* size_value_end = nullptr;
+			const unsigned long max_size_mb = std::strtoul(size_value, &size_value_end, 10);
+			if (size_value_end == size_value || *size_value_end != '\0' || max_size_mb >= 4096)
+			{
+				printf("Invalid bit rate cache size specified: %s\n", size_value);
+				return false;
+			}
+			options.bit_rate_database_max_size = uint32_t(max_size_mb) * 1024 * 1024;
+			continue;
+		}
+
+		option_length = std::strlen(k_adaptive_segmenting_option);
+		if (std::strncmp(argument, k_adaptive_segmenting_option, option_length) == 0)
+		{
+			options.adaptive_segmenting = true;
+			continue;
+		}
+
+		option_length = std::strlen(k_sample_rate_reduction_option);
+		if (std::strncmp(argument, k_sample_rate_reduction_option, option_length) == 0)
+		{
+			options.sample_rate_reduction = true;
+			continue;
+		}
+
+		option_length = std::strlen(k_constant_rotation_quantization_option);
+		if (std::strncmp(argument, k_constant_rotation_quantization_option, option_length) == 0)
+		{
+			options.constant_rotation_quantization = true;
+			continue;
+		}
+
+		option_length = std::strlen(k_clip_range_quantization_option);
+		if (std::strncmp(argument, k_clip_range_quantization_option, option_length) == 0)
+		{
+			options.clip_range_quantization = true;
+			continue;
+		}
+
+		option_length = std::strlen(k_proxy_error_rejection_option);
+		if (std::strncmp(argument, k_proxy_error_rejection_option, option_length) == 0)
+		{
+			options.proxy_error_rejection = true;
+			continue;
+		}
+
+		option_length = std::strlen(k_layout_output_option);
+		if (std::strncmp(argument, k_layout_output_option, option_length) == 0)
+		{
+			options.output_layout = true;
+			continue;
+		}
+
+		option_length = std::strlen(k_num_threads_option);
+		if (std::strncmp(argument, k_num_threads_option, option_length) == 0)
+		{
+			const char* num_threads_value = argument + option_length;
+			char* num_threads_value_end = nullptr;
+			const unsigned long num_threads = std::strtoul(num_threads_value, &num_threads_value_end, 10);
+			if (num_threads_value_end == num_threads_value || *num_threads_value_end != '\0' || num_threads > 1024)
+			{
+				printf("Invalid number of threads specified: %s\n", num_threads_value);
+				return false;
+			}
+			options.num_threads = uint32_t(num_threads);
+			continue;
+		}
+
 		option_length = std::strlen(k_regression_test_option);
 		if (std::strncmp(argument, k_regression_test_option, option_length) == 0)
 		{
@@ -379,10 +615,166 @@ static bool parse_options(int argc, char** argv, Options& options)
 			continue;
 		}
 
+		option_length = std::strlen(k_stat_size_output_option);
+		if (std::strncmp(argument, k_stat_size_output_option, option_length) == 0)
+		{
+			options.stat_size_output = true;
+			continue;
+		}
+
+		option_length = std::strlen(k_stat_memory_output_option);
+		if (std::strncmp(argument, k_stat_memory_output_option, option_length) == 0)
+		{
+			options.stat_memory_output = true;
+			continue;
+		}
+
+		option_length = std::strlen(k_stat_binary_output_option);
+		if (std::strncmp(argument, k_stat_binary_output_option, option_length) == 0)
+		{
+			options.output_binary_stats_filename = argument + option_length;
+			const size_t filename_len = std::strlen(options.output_binary_stats_filename);
+			if (filename_len < 9 || strncmp(options.output_binary_stats_filename + filename_len - 9, ".aclstats", 9) != 0)
+			{
+				printf("Binary stats output file must be of the form: [*.aclstats]\n");
+				return false;
+			}
+
+			options.open_output_binary_stats_file();
+			continue;
+		}
+
+		option_length = std::strlen(k_server_mode_option);
+		if (std::strncmp(argument, k_server_mode_option, option_length) == 0 && argument[option_length] == '\0')
+		{
+			options.server_mode = true;
+			continue;
+		}
+
+		option_length = std::strlen(k_batch_option);
+		if (std::strncmp(argument, k_batch_option, option_length) == 0)
+		{
+			options.batch_path = argument + option_length;
+			continue;
+		}
+
+		option_length = std::strlen(k_autotune_output_option);
+		if (std::strncmp(argument, k_autotune_output_option, option_length) == 0)
+		{
+			options.autotune_config_filename = argument + option_length;
+			const size_t filename_len = std::strlen(options.autotune_config_filename);
+			if (filename_len < 13 || strncmp(options.autotune_config_filename + filename_len - 13, ".config.sjson", 13) != 0)
+			{
+				printf("Autotune output file must be a config SJSON file of the form: [*.config.sjson]\n");
+				return false;
+			}
+			continue;
+		}
+
+		option_length = std::strlen(k_autotune_levels_option);
+		if (std::strncmp(argument, k_autotune_levels_option, option_length) == 0)
+		{
+			std::vector<std::string> values;
+			split_option_list(argument + option_length, values);
+
+			options.autotune_levels.clear();
+			for (const std::string& value : values)
+			{
+				compression_level8 level;
+				if (!get_compression_level(value.c_str(), level))
+				{
+					printf("Invalid compression level name specified: %s\n", value.c_str());
+					return false;
+				}
+				options.autotune_levels.push_back(level);
+			}
+			continue;
+		}
+
+		option_length = std::strlen(k_autotune_rotations_option);
+		if (std::strncmp(argument, k_autotune_rotations_option, option_length) == 0)
+		{
+			std::vector<std::string> values;
+			split_option_list(argument + option_length, values);
+
+			options.autotune_rotation_formats.clear();
+			for (const std::string& value : values)
+			{
+				rotation_format8 format;
+				if (!get_rotation_format(value.c_str(), format))
+				{
+					printf("Invalid rotation format specified: %s\n", value.c_str());
+					return false;
+				}
+				options.autotune_rotation_formats.push_back(format);
+			}
+			continue;
+		}
+
+		option_length = std::strlen(k_autotune_vectors_option);
+		if (std::strncmp(argument, k_autotune_vectors_option, option_length) == 0)
+		{
+			std::vector<std::string> values;
+			split_option_list(argument + option_length, values);
+
+			options.autotune_vector_formats.clear();
+			for (const std::string& value : values)
+			{
+				vector_format8 format;
+				if (!get_vector_format(value.c_str(), format))
+				{
+					printf("Invalid vector format specified: %s\n", value.c_str());
+					return false;
+				}
+				options.autotune_vector_formats.push_back(format);
+			}
+			continue;
+		}
+
+		option_length = std::strlen(k_autotune_stripping_option);
+		if (std::strncmp(argument, k_autotune_stripping_option, option_length) == 0)
+		{
+			std::vector<std::string> values;
+			split_option_list(argument + option_length, values);
+
+			options.autotune_stripping_proportions.clear();
+			for (const std::string& value : values)
+			{
+				char* value_end = nullptr;
+				const float proportion = std::strtof(value.c_str(), &value_end);
+				if (value_end == value.c_str() || *value_end != '\0' || !(proportion >= 0.0F && proportion <= 1.0F))
+				{
+					printf("Invalid keyframe stripping proportion specified: %s\n", value.c_str());
+					return false;
+				}
+				options.autotune_stripping_proportions.push_back(proportion);
+			}
+			continue;
+		}
+
+		option_length = std::strlen(k_autotune_option);
+		if (std::strncmp(argument, k_autotune_option, option_length) == 0)
+		{
+			const char* objective_name = argument + option_length;
+			if (std::strcmp(objective_name, "size") == 0)
+				options.autotune = autotune_objective::size;
+			else if (std::strcmp(objective_name, "speed") == 0)
+				options.autotune = autotune_objective::speed;
+			else
+			{
+				printf("Invalid autotune objective specified: %s\n", objective_name);
+				return false;
+			}
+			continue;
+		}
+
 		printf("Unrecognized option %s\n", argument);
 		return false;
 	}
 
+	if (options.server_mode || options.batch_path != nullptr)
+		return true;	// Every job provides its own input file
+
 #if defined(__ANDROID__)
 	if (options.input_buffer == nullptr || options.input_buffer_size == 0)
 #else
@@ -398,10 +790,43 @@ static bool parse_options(int argc, char** argv, Options& options)
 
 #if defined(ACL_USE_SJSON)
 
+// Prints a transform layout to use as the 'transform_layout_type' of decompression settings
+static void print_transform_layout(const compressed_tracks& tracks)
+{
+	const uint32_t signature = get_transform_layout_signature(tracks);
+	if (signature == 0)
+		return;	// Not a transform track list or it is empty
+
+	const acl_impl::tracks_header& header = acl_impl::get_tracks_header(tracks);
+	const acl_impl::transform_tracks_header& transform_header = acl_impl::get_transform_tracks_header(tracks);
+
+	const uint32_t num_tracks = header.num_tracks;
+	const bool has_scale = header.get_has_scale();
+	const uint32_t num_sub_track_entries = (num_tracks + acl_impl::k_num_sub_tracks_per_packed_entry - 1) / acl_impl::k_num_sub_tracks_per_packed_entry;
+	const uint32_t num_packed_entries = num_sub_track_entries * (has_scale ? 3 : 2);
+	const acl_impl::packed_sub_track_types* sub_track_types = transform_header.get_sub_track_types();
+
+	printf("struct transform_layout_%08x final : public acl::null_transform_layout\n", signature);
+	printf("{\n");
+	printf("\tstatic constexpr bool is_enabled() { return true; }\n");
+	printf("\tstatic constexpr uint32_t get_signature() { return 0x%08xU; }\n", signature);
+	printf("\tstatic constexpr uint32_t get_num_tracks() { return %uU; }\n", num_tracks);
+	printf("\tstatic constexpr bool has_scale() { return %s; }\n", has_scale ? "true" : "false");
+	printf("\tstatic const uint32_t* get_packed_sub_track_types()\n");
+	printf("\t{\n");
+	printf("\t\tstatic constexpr uint32_t k_types[] = {");
+	for (uint32_t entry_index = 0; entry_index < num_packed_entries; ++entry_index)
+		printf("%s0x%08xU", entry_index != 0 ? ", " : " ", sub_track_types[entry_index].types);
+	printf(" };\n");
+	printf("\t\treturn &k_types[0];\n");
+	printf("\t}\n");
+	printf("};\n");
+}
+
 static void try_algorithm(const Options& options, iallocator& allocator, const track_array_qvvf& transform_tracks,
 	const track_array_qvvf& additive_base, additive_clip_format8 additive_format,
 	compression_settings settings, const compression_database_settings& database_settings,
-	stat_logging logging, sjson::ArrayWriter* runs_writer, double regression_error_threshold)
+	stat_logging logging, sjson::ArrayWriter* runs_writer, double regression_error_threshold, const prepared_clip_context* prepared_clip = nullptr)
 {
 	(void)runs_writer;
 	(void)regression_error_threshold;
@@ -413,19 +838,52 @@ static void try_algorithm(const Options& options, iallocator& allocator, const t
 		{
 			settings.metadata.include_track_list_name = true;
 			settings.metadata.include_track_names = true;
+			settings.metadata.include_track_name_table = true;
 			settings.metadata.include_parent_track_indices = true;
 			settings.metadata.include_track_descriptions = true;
 		}
 
 		settings.enable_database_support = options.split_into_database;
 
+		if (options.bit_rate_search_budget != 0)
+			settings.bit_rate_search_budget = options.bit_rate_search_budget;
+
+		settings.bit_rate_search_strategy = options.bit_rate_search_strategy;
+
+		if (options.bit_rate_database_max_size != 0)
+			settings.bit_rate_database_max_size = options.bit_rate_database_max_size;
+
+		settings.enable_adaptive_segmenting = options.adaptive_segmenting;
+		settings.enable_sample_rate_reduction = options.sample_rate_reduction;
+		settings.enable_constant_rotation_quantization = options.constant_rotation_quantization;
+		settings.enable_rotation_clip_range_quantization = options.clip_range_quantization;
+		settings.enable_proxy_error_rejection = options.proxy_error_rejection;
+
+		// Segments, permutations, and exhaustive statistics are processed on our pool
+		if (options.pool != nullptr)
+			settings.job_scheduler = options.pool->get_job_scheduler();
+
+		file_binary_stats_writer binary_stats_writer(options.output_binary_stats_file);
+
 		output_stats stats;
 		stats.logging = logging;
 		stats.writer = stats_writer;
 
+		if (options.output_binary_stats_file != nullptr)
+			stats.binary_writer = &binary_stats_writer;
+
 		compressed_tracks* compressed_tracks_ = nullptr;
 
-		error_result result = compress_track_list(allocator, transform_tracks, settings, additive_base, additive_format, compressed_tracks_, stats);
+		error_result result;
+		if (prepared_clip != nullptr)
+			result = compress_track_list(allocator, *prepared_clip, settings, compressed_tracks_, stats);
+		else
+			result = compress_track_list(allocator, transform_tracks, settings, additive_base, additive_format, compressed_tracks_, stats);
+
+#if defined(ACL_USE_SJSON)
+		if (stats_writer != nullptr && stats.binary_writer != nullptr && are_all_enum_flags_set(logging, stat_logging::exhaustive))
+			stats_writer->insert("exhaustive_errors_file", options.output_binary_stats_filename);
+#endif
 
 		ACL_ASSERT(result.empty(), result.c_str());
 		ACL_ASSERT(compressed_tracks_->is_valid(true).empty(), "Compressed tracks are invalid");
@@ -441,7 +899,7 @@ static void try_algorithm(const Options& options, iallocator& allocator, const t
 			const bool initialized = context.initialize(*compressed_tracks_);
 			ACL_ASSERT(initialized, "Failed to initialize decompression context"); (void)initialized;
 
-			const track_error error = calculate_compression_error(allocator, transform_tracks, context, *settings.error_metric);
+			const track_error error = calculate_compression_error(allocator, transform_tracks, context, *settings.error_metric, settings.job_scheduler);
 
 			stats_writer->insert("max_error", error.error);
 			stats_writer->insert("worst_track", error.index);
@@ -452,7 +910,7 @@ static void try_algorithm(const Options& options, iallocator& allocator, const t
 #if defined(ACL_HAS_ASSERT_CHECKS)
 		if (options.regression_testing)
 		{
-			validate_accuracy(allocator, transform_tracks, additive_base, *settings.error_metric, *compressed_tracks_, regression_error_threshold);
+			validate_accuracy(allocator, transform_tracks, additive_base, *settings.error_metric, *compressed_tracks_, regression_error_threshold, options.pool);
 			validate_metadata(transform_tracks, *compressed_tracks_);
 			validate_convert(allocator, transform_tracks);
 
@@ -462,6 +920,7 @@ static void try_algorithm(const Options& options, iallocator& allocator, const t
 				// This will ensure we have two clips with different hashes
 				settings.metadata.include_track_list_name = false;
 				settings.metadata.include_track_names = false;
+				settings.metadata.include_track_name_table = false;
 				settings.metadata.include_parent_track_indices = false;
 				settings.metadata.include_track_descriptions = false;
 
@@ -476,7 +935,7 @@ static void try_algorithm(const Options& options, iallocator& allocator, const t
 				ACL_ASSERT(compressed_tracks1->is_valid(true).empty(), "Compressed tracks are invalid");
 				ACL_ASSERT(compressed_tracks_->get_hash() != compressed_tracks1->get_hash(), "Hashes should not match");
 
-				validate_db(allocator, transform_tracks, additive_base, database_settings, *settings.error_metric, *compressed_tracks_, *compressed_tracks1);
+				validate_db(allocator, transform_tracks, additive_base, database_settings, *settings.error_metric, *compressed_tracks_, *compressed_tracks1, options.pool);
 
 				allocator.deallocate(compressed_tracks1, compressed_tracks1->get_size());
 			}
@@ -497,6 +956,9 @@ static void try_algorithm(const Options& options, iallocator& allocator, const t
 				output_file_stream.write(reinterpret_cast<const char*>(compressed_tracks_), compressed_tracks_->get_size());
 		}
 
+		if (options.output_layout)
+			print_transform_layout(*compressed_tracks_);
+
 		// TODO
 #if 0
 		if (options.split_into_database && options.output_db_filename != nullptr)
@@ -535,6 +997,7 @@ static void try_algorithm(const Options& options, iallocator& allocator, const t
 		{
 			settings.metadata.include_track_list_name = true;
 			settings.metadata.include_track_names = true;
+			settings.metadata.include_track_name_table = true;
 			settings.metadata.include_track_descriptions = true;
 		}
 
@@ -568,7 +1031,7 @@ static void try_algorithm(const Options& options, iallocator& allocator, const t
 #if defined(ACL_HAS_ASSERT_CHECKS)
 		if (options.regression_testing)
 		{
-			validate_accuracy(allocator, track_list, *compressed_tracks_, regression_error_threshold);
+			validate_accuracy(allocator, track_list, *compressed_tracks_, regression_error_threshold, options.pool);
 			validate_metadata(track_list, *compressed_tracks_);
 		}
 #endif
@@ -598,6 +1061,7 @@ static void try_algorithm(const Options& options, iallocator& allocator, const t
 		try_algorithm_impl(nullptr);
 }
 
+#if !defined(ACL_IMPL_HAS_MAPPED_FILE)
 static bool read_file(iallocator& allocator, const char* input_filename, char*& out_buffer, size_t& out_file_size)
 {
 	// Use the raw C API with a large buffer to ensure this is as fast as possible
@@ -662,27 +1126,97 @@ static bool read_file(iallocator& allocator, const char* input_filename, char*&
 
 	return true;
 }
+#endif
 
-static bool read_acl_bin_file(iallocator& allocator, const Options& options, acl::compressed_tracks*& out_tracks)
+// The content of an input file, memory mapped when supported and read in a buffer otherwise
+// With large data sets, reading and copying every input file dominates the validation runs
+class input_file
 {
-	char* tracks_data = nullptr;
-	size_t file_size = 0;
+public:
+	explicit input_file(iallocator& allocator) : m_allocator(allocator), m_buffer(nullptr), m_buffer_size(0) {}
+	~input_file() { deallocate_type_array(m_allocator, m_buffer, m_buffer_size); }
+
+	bool open(const char* input_filename)
+	{
+#if defined(ACL_IMPL_HAS_MAPPED_FILE)
+#ifdef _WIN32
+		char path[1 * 1024] = { 0 };
+		snprintf(path, get_array_size(path), "\\\\?\\%s", input_filename);
+#else
+		const char* path = input_filename;
+#endif
+
+		if (m_file.open(path).any())
+		{
+			printf("Failed to open input file\n");
+			return false;
+		}
+
+		return true;
+#else
+		return read_file(m_allocator, input_filename, m_buffer, m_buffer_size);
+#endif
+	}
+
+	// Copies the provided buffer, it is aligned like a file we read
+	void copy(const char* buffer, size_t buffer_size)
+	{
+		m_buffer = allocate_type_array_aligned<char>(m_allocator, buffer_size, 64);
+		m_buffer_size = buffer_size;
+		std::memcpy(m_buffer, buffer, buffer_size);
+	}
+
+	const char* get_data() const
+	{
+#if defined(ACL_IMPL_HAS_MAPPED_FILE)
+		if (m_file.is_open())
+			return static_cast<const char*>(m_file.get_data());
+#endif
 
+		return m_buffer;
+	}
+
+	size_t get_size() const
+	{
+#if defined(ACL_IMPL_HAS_MAPPED_FILE)
+		if (m_file.is_open())
+			return m_file.get_size();
+#endif
+
+		return m_buffer_size;
+	}
+
+private:
+	input_file(const input_file&) = delete;
+	input_file& operator=(const input_file&) = delete;
+
+	iallocator& m_allocator;
+
+#if defined(ACL_IMPL_HAS_MAPPED_FILE)
+	mapped_file m_file;
+#endif
+
+	char* m_buffer;
+	size_t m_buffer_size;
+};
+
+static bool read_acl_bin_file(const Options& options, input_file& tracks_file, const acl::compressed_tracks*& out_tracks)
+{
 #if defined(__ANDROID__)
-	// Duplicate the data on android so we can free it normally later
-	tracks_data = allocate_type_array_aligned<char>(allocator, options.input_buffer_size, 64);
-	file_size = options.input_buffer_size;
-	std::memcpy(tracks_data, options.input_buffer, options.input_buffer_size);
+	// Duplicate the data on android to align it
+	tracks_file.copy(options.input_buffer, options.input_buffer_size);
 #else
-	if (!read_file(allocator, options.input_filename, tracks_data, file_size))
+	if (!tracks_file.open(options.input_filename))
 		return false;
 #endif
 
-	out_tracks = reinterpret_cast<acl::compressed_tracks*>(tracks_data);
-	if (file_size != out_tracks->get_size() || out_tracks->is_valid(true).any())
+	// Make sure the tracks fit within the file before we read them
+	const size_t file_size = tracks_file.get_size();
+	out_tracks = reinterpret_cast<const acl::compressed_tracks*>(tracks_file.get_data());
+	if (file_size < sizeof(acl::compressed_tracks) || file_size != out_tracks->get_size() || out_tracks->is_valid(true).any())
 	{
 		printf("Invalid binary ACL file provided\n");
-		deallocate_type_array(allocator, tracks_data, file_size);
+		out_tracks = nullptr;
 		return false;
 	}
 
@@ -694,16 +1228,14 @@ static bool read_acl_sjson_file(iallocator& allocator, const Options& options,
 	sjson_raw_clip& out_raw_clip,
 	sjson_raw_track_list& out_raw_track_list)
 {
-	char* sjson_file_buffer = nullptr;
-	size_t file_size = 0;
-
 #if defined(__ANDROID__)
 	clip_reader reader(allocator, options.input_buffer, options.input_buffer_size - 1);
 #else
-	if (!read_file(allocator, options.input_filename, sjson_file_buffer, file_size))
+	input_file sjson_file(allocator);
+	if (!sjson_file.open(options.input_filename))
 		return false;
 
-	clip_reader reader(allocator, sjson_file_buffer, file_size - 1);
+	clip_reader reader(allocator, sjson_file.get_data(), sjson_file.get_size() - 1);
 #endif
 
 	const sjson_file_type ftype = reader.get_file_type();
@@ -731,7 +1263,6 @@ static bool read_acl_sjson_file(iallocator& allocator, const Options& options,
 			printf("\nError on line %d column %d: %s\n", err.line, err.column, err.get_description());
 	}
 
-	deallocate_type_array(allocator, sjson_file_buffer, file_size);
 	return success;
 }
 
@@ -838,6 +1369,10 @@ static bool read_config(iallocator& allocator, Options& options, compression_set
 	if (parser.try_read("split_into_database", split_into_database, false))
 		options.split_into_database = split_into_database;
 
+	bool adaptive_segmenting;
+	if (parser.try_read("adaptive_segmenting", adaptive_segmenting, false))
+		options.adaptive_segmenting = adaptive_segmenting;
+
 	compression_database_settings default_database_settings;
 
 	uint32_t database_max_chunk_size;
@@ -852,6 +1387,10 @@ static bool read_config(iallocator& allocator, Options& options, compression_set
 	if (parser.try_read("low_importance_tier", low_importance_tier, default_database_settings.low_importance_tier_proportion))
 		out_database_settings.low_importance_tier_proportion = low_importance_tier;
 
+	bool database_entropy_code_low_tier;
+	if (parser.try_read("database_entropy_code_low_tier", database_entropy_code_low_tier, default_database_settings.entropy_code_low_importance_tier))
+		out_database_settings.entropy_code_low_importance_tier = database_entropy_code_low_tier;
+
 	bool keyframe_stripping_enable;
 	if (parser.try_read("keyframe_stripping_enable", keyframe_stripping_enable, default_settings.keyframe_stripping.enable_stripping))
 		out_settings.keyframe_stripping.enable_stripping = keyframe_stripping_enable;
@@ -952,46 +1491,316 @@ static compression_settings make_settings(rotation_format8 rotation_format, vect
 	settings.scale_format = scale_format;
 	return settings;
 }
-#endif	// defined(ACL_USE_SJSON)
 
-// Disable warning for implicit constructor using deprecated members in sjson_raw_clip and sjson_raw_track_list
-#if defined(RTM_COMPILER_MSVC_2015)
-	#pragma warning(push)
-	#pragma warning(disable : 4996)
-#endif
+// A candidate of the settings search, see run_autotune(..)
+struct autotune_candidate
+{
+	compression_settings	settings;
+	uint32_t				compressed_size			= 0;
+	double					decompression_time_us	= 0.0;
+	float					max_error				= 0.0F;
+};
 
-static int safe_main_impl(int argc, char* argv[])
+// Returns the average time in microseconds to seek and decompress a whole pose
+// Every sample is decompressed a few times and the fastest pass is retained to reduce the noise
+static double measure_decompression_time_us(iallocator& allocator, const compressed_tracks& tracks)
 {
-	Options options;
+	// Disable floating point exceptions since decompression assumes it
+	scope_disable_fp_exceptions fp_off;
 
-	if (!parse_options(argc, argv, options))
-		return -1;
+	decompression_context<debug_transform_decompression_settings> context;
 
-#if defined(ACL_USE_SJSON)
-	ansi_allocator allocator;
-	track_array_qvvf transform_tracks;
-	track_array_qvvf base_clip;
-	additive_clip_format8 additive_format = additive_clip_format8::none;
-	track_array scalar_tracks;
+	const bool initialized = context.initialize(tracks);
+	ACL_ASSERT(initialized, "Failed to initialize decompression context"); (void)initialized;
 
-#if defined(__ANDROID__)
-	const bool is_input_acl_bin_file = options.input_buffer_binary;
-#else
-	const bool is_input_acl_bin_file = is_acl_bin_file(options.input_filename);
-#endif
+	acl_impl::debug_track_writer writer(allocator, track_type8::qvvf, tracks.get_num_tracks());
 
-	bool use_external_config = false;
-	compression_settings settings;
-	compression_database_settings database_settings;
+	const uint32_t num_samples = tracks.get_num_samples_per_track();
+	const float sample_rate = tracks.get_sample_rate();
+	const float duration = tracks.get_finite_duration();
+	const uint32_t num_passes = 5;
 
-	sjson_file_type sjson_type = sjson_file_type::unknown;
-	sjson_raw_clip sjson_clip;
-	sjson_raw_track_list sjson_track_list;
+	double best_time_us = 0.0;
+	for (uint32_t pass_index = 0; pass_index < num_passes; ++pass_index)
+	{
+		const auto start = std::chrono::high_resolution_clock::now();
+
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		{
+			const float sample_time = rtm::scalar_min(float(sample_index) / sample_rate, duration);
+
+			context.seek(sample_time, sample_rounding_policy::nearest);
+			context.decompress_tracks(writer);
+		}
+
+		const auto end = std::chrono::high_resolution_clock::now();
+		const double time_us = std::chrono::duration<double, std::micro>(end - start).count() / double(std::max<uint32_t>(num_samples, 1));
+
+		if (pass_index == 0 || time_us < best_time_us)
+			best_time_us = time_us;
+	}
+
+	return best_time_us;
+}
+
+// Writes the settings retained by the search as a config SJSON file that '-config=' can read back
+static bool write_autotune_config(const Options& options, const compression_settings& settings)
+{
+	std::FILE* file = stdout;
+	if (options.autotune_config_filename != nullptr)
+	{
+#ifdef _WIN32
+		char path[1 * 1024] = { 0 };
+		snprintf(path, get_array_size(path), "\\\\?\\%s", options.autotune_config_filename);
+		file = nullptr;
+		fopen_s(&file, path, "w");
+#else
+		file = fopen(options.autotune_config_filename, "w");
+#endif
+
+		if (file == nullptr)
+		{
+			printf("Failed to open autotune output file: %s\n", options.autotune_config_filename);
+			return false;
+		}
+	}
+
+	fprintf(file, "// Selected by acl_compressor with -autotune=%s\n", options.autotune == autotune_objective::speed ? "speed" : "size");
+	fprintf(file, "version = 2\n");
+	fprintf(file, "\n");
+	fprintf(file, "algorithm_name = \"%s\"\n", get_algorithm_name(algorithm_type8::uniformly_sampled));
+	fprintf(file, "level = \"%s\"\n", get_compression_level_name(settings.level));
+	fprintf(file, "rotation_format = \"%s\"\n", get_rotation_format_name(settings.rotation_format));
+	fprintf(file, "translation_format = \"%s\"\n", get_vector_format_name(settings.translation_format));
+	fprintf(file, "scale_format = \"%s\"\n", get_vector_format_name(settings.scale_format));
+	fprintf(file, "adaptive_segmenting = %s\n", settings.enable_adaptive_segmenting ? "true" : "false");
+	fprintf(file, "keyframe_stripping_enable = %s\n", settings.keyframe_stripping.enable_stripping ? "true" : "false");
+	fprintf(file, "keyframe_stripping_proportion = %.4f\n", double(settings.keyframe_stripping.proportion));
+
+	if (file != stdout)
+		std::fclose(file);
+
+	return true;
+}
+
+// Searches a space of compression settings for the ones that best fit a clip and writes them out, see write_autotune_config(..)
+// Depending on the objective, the smallest compressed size or the fastest decompression is retained
+// Candidates whose error exceeds the largest precision of the clip tracks are rejected
+// The hierarchy, the additive base, and the clip are prepared once and shared by every candidate
+static bool run_autotune(const Options& options, iallocator& allocator, const track_array_qvvf& transform_tracks,
+	const track_array_qvvf& additive_base, additive_clip_format8 additive_format, itransform_error_metric& error_metric,
+	sjson::ArrayWriter* runs_writer)
+{
+	std::vector<compression_level8> levels = options.autotune_levels;
+	if (levels.empty())
+		levels = { compression_level8::medium, compression_level8::high };
+
+	std::vector<rotation_format8> rotation_formats = options.autotune_rotation_formats;
+	if (rotation_formats.empty())
+		rotation_formats = { rotation_format8::quatf_drop_w_variable, rotation_format8::quatf_drop_largest_variable, rotation_format8::quatf_log_variable };
+
+	std::vector<vector_format8> vector_formats = options.autotune_vector_formats;
+	if (vector_formats.empty())
+		vector_formats = { vector_format8::vector3f_variable, vector_format8::vector3f_variable_per_component };
+
+	std::vector<float> stripping_proportions = options.autotune_stripping_proportions;
+	if (stripping_proportions.empty())
+		stripping_proportions = { 0.0F };
+
+	// Segment sizes are fixed, only their boundaries can adapt to the motion
+	const bool adaptive_segmenting_values[] = { false, true };
+
+	compression_settings base_settings = get_default_compression_settings();
+	base_settings.error_metric = &error_metric;
+
+	// Segments, permutations, and the error are processed on our pool
+	if (options.pool != nullptr)
+		base_settings.job_scheduler = options.pool->get_job_scheduler();
+
+	skeleton_context skeleton;
+	error_result result = skeleton.initialize(allocator, transform_tracks);
+	if (result.any())
+	{
+		printf("Failed to prepare the clip hierarchy: %s\n", result.c_str());
+		return false;
+	}
+
+	base_settings.skeleton = &skeleton;
+
+	additive_base_context base_context;
+	if (!additive_base.is_empty())
+	{
+		result = base_context.initialize(allocator, additive_base, base_settings, additive_format);
+		if (result.any())
+		{
+			printf("Failed to prepare the additive base: %s\n", result.c_str());
+			return false;
+		}
+	}
+
+	// Every candidate compresses the same clip, we prepare it once
+	prepared_clip_context prepared_clip;
+	if (base_context.is_initialized())
+		result = prepared_clip.initialize(allocator, transform_tracks, base_settings, base_context);
+	else
+		result = prepared_clip.initialize(allocator, transform_tracks, base_settings);
+
+	if (result.any())
+	{
+		printf("Failed to prepare the clip: %s\n", result.c_str());
+		return false;
+	}
+
+	float error_threshold = 0.0F;
+	for (const track_qvvf& track : transform_tracks)
+		error_threshold = std::max<float>(error_threshold, track.get_description().precision);
+
+	autotune_candidate best_candidate;
+	bool has_best_candidate = false;
+
+	for (compression_level8 level : levels)
+	{
+		for (rotation_format8 rotation_format : rotation_formats)
+		{
+			for (vector_format8 vector_format : vector_formats)
+			{
+				for (bool adaptive_segmenting : adaptive_segmenting_values)
+				{
+					for (float stripping_proportion : stripping_proportions)
+					{
+						autotune_candidate candidate;
+						candidate.settings = base_settings;
+						candidate.settings.level = level;
+						candidate.settings.rotation_format = rotation_format;
+						candidate.settings.translation_format = vector_format;
+						candidate.settings.scale_format = vector_format;
+						candidate.settings.enable_adaptive_segmenting = adaptive_segmenting;
+						candidate.settings.keyframe_stripping.enable_stripping = stripping_proportion > 0.0F;
+						candidate.settings.keyframe_stripping.proportion = stripping_proportion;
+
+						output_stats stats;
+						compressed_tracks* compressed_tracks_ = nullptr;
+
+						result = compress_track_list(allocator, prepared_clip, candidate.settings, compressed_tracks_, stats);
+
+						if (result.any())
+						{
+							printf("Skipping autotune candidate: %s\n", result.c_str());
+							continue;
+						}
+
+						candidate.compressed_size = compressed_tracks_->get_size();
+
+						{
+							// Disable floating point exceptions since decompression assumes it
+							scope_disable_fp_exceptions fp_off;
+
+							decompression_context<debug_transform_decompression_settings> context;
+
+							const bool initialized = context.initialize(*compressed_tracks_);
+							ACL_ASSERT(initialized, "Failed to initialize decompression context"); (void)initialized;
+
+							const track_error error = additive_base.is_empty()
+								? calculate_compression_error(allocator, transform_tracks, context, error_metric, candidate.settings.job_scheduler)
+								: calculate_compression_error(allocator, transform_tracks, context, error_metric, additive_base, candidate.settings.job_scheduler);
+
+							candidate.max_error = error.error;
+						}
+
+						if (options.autotune == autotune_objective::speed)
+							candidate.decompression_time_us = measure_decompression_time_us(allocator, *compressed_tracks_);
+
+						allocator.deallocate(compressed_tracks_, compressed_tracks_->get_size());
+
+						const bool is_within_threshold = candidate.max_error <= error_threshold;
+
+						if (runs_writer != nullptr)
+						{
+							runs_writer->push([&](sjson::ObjectWriter& writer)
+							{
+								writer["level"] = get_compression_level_name(level);
+								writer["rotation_format"] = get_rotation_format_name(rotation_format);
+								writer["translation_format"] = get_vector_format_name(vector_format);
+								writer["scale_format"] = get_vector_format_name(vector_format);
+								writer["adaptive_segmenting"] = adaptive_segmenting;
+								writer["keyframe_stripping_proportion"] = stripping_proportion;
+								writer["compressed_size"] = candidate.compressed_size;
+								writer["max_error"] = candidate.max_error;
+
+								if (options.autotune == autotune_objective::speed)
+									writer["decompression_time_us"] = candidate.decompression_time_us;
+
+								writer["is_within_threshold"] = is_within_threshold;
+							});
+						}
+
+						if (!is_within_threshold)
+							continue;
+
+						bool is_better = !has_best_candidate;
+						if (has_best_candidate)
+						{
+							if (options.autotune == autotune_objective::speed)
+								is_better = candidate.decompression_time_us < best_candidate.decompression_time_us;
+							else
+								is_better = candidate.compressed_size < best_candidate.compressed_size;
+						}
+
+						if (is_better)
+						{
+							best_candidate = candidate;
+							has_best_candidate = true;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	if (!has_best_candidate)
+	{
+		printf("No autotune candidate is within the error threshold of %f\n", double(error_threshold));
+		return false;
+	}
+
+	return write_autotune_config(options, best_candidate.settings);
+}
+#endif	// defined(ACL_USE_SJSON)
+
+// Disable warning for implicit constructor using deprecated members in sjson_raw_clip and sjson_raw_track_list
+#if defined(RTM_COMPILER_MSVC_2015)
+	#pragma warning(push)
+	#pragma warning(disable : 4996)
+#endif
+
+static int run_job(Options& options)
+{
+#if defined(ACL_USE_SJSON)
+	ansi_allocator allocator;
+	track_array_qvvf transform_tracks;
+	track_array_qvvf base_clip;
+	additive_clip_format8 additive_format = additive_clip_format8::none;
+	track_array scalar_tracks;
+
+#if defined(__ANDROID__)
+	const bool is_input_acl_bin_file = options.input_buffer_binary;
+#else
+	const bool is_input_acl_bin_file = is_acl_bin_file(options.input_filename);
+#endif
+
+	bool use_external_config = false;
+	compression_settings settings;
+	compression_database_settings database_settings;
+
+	sjson_file_type sjson_type = sjson_file_type::unknown;
+	sjson_raw_clip sjson_clip;
+	sjson_raw_track_list sjson_track_list;
 
 	if (is_input_acl_bin_file)
 	{
-		acl::compressed_tracks* bin_tracks = nullptr;
-		if (!read_acl_bin_file(allocator, options, bin_tracks))
+		input_file bin_file(allocator);
+		const acl::compressed_tracks* bin_tracks = nullptr;
+		if (!read_acl_bin_file(options, bin_file, bin_tracks))
 			return -1;
 
 		if (bin_tracks->get_track_type() == track_type8::qvvf)
@@ -1000,7 +1809,6 @@ static int safe_main_impl(int argc, char* argv[])
 			if (result.any())
 			{
 				printf("Failed to convert input binary track list\n");
-				deallocate_type_array(allocator, reinterpret_cast<char*>(bin_tracks), bin_tracks->get_size());
 				return -1;
 			}
 
@@ -1012,14 +1820,11 @@ static int safe_main_impl(int argc, char* argv[])
 			if (result.any())
 			{
 				printf("Failed to convert input binary track list\n");
-				deallocate_type_array(allocator, reinterpret_cast<char*>(bin_tracks), bin_tracks->get_size());
 				return -1;
 			}
 
 			sjson_type = sjson_file_type::raw_track_list;
 		}
-
-		deallocate_type_array(allocator, reinterpret_cast<char*>(bin_tracks), bin_tracks->get_size());
 	}
 	else
 	{
@@ -1111,6 +1916,8 @@ static int safe_main_impl(int argc, char* argv[])
 		}
 	}
 
+	int exit_code = 0;
+
 	// Compress & Decompress
 	auto exec_algos = [&](sjson::ArrayWriter* runs_writer)
 	{
@@ -1122,9 +1929,20 @@ static int safe_main_impl(int argc, char* argv[])
 		if (options.stat_exhaustive_output)
 			logging |= stat_logging::exhaustive;
 
+		if (options.stat_size_output)
+			logging |= stat_logging::size_attribution;
+
+		if (options.stat_memory_output)
+			logging |= stat_logging::memory;
+
 		if (sjson_type == sjson_file_type::raw_clip)
 		{
-			if (use_external_config)
+			if (options.autotune != autotune_objective::none)
+			{
+				if (!run_autotune(options, allocator, transform_tracks, base_clip, additive_format, *settings.error_metric, runs_writer))
+					exit_code = -1;
+			}
+			else if (use_external_config)
 			{
 				if (options.compression_level_specified)
 					settings.level = options.compression_level;
@@ -1133,6 +1951,26 @@ static int safe_main_impl(int argc, char* argv[])
 			}
 			else if (options.exhaustive_compression)
 			{
+				// Every permutation compresses the same clip with the same error metric, we prepare it once
+				compression_settings prepare_settings = get_default_compression_settings();
+				prepare_settings.error_metric = settings.error_metric;
+				prepare_settings.enable_sample_rate_reduction = options.sample_rate_reduction;
+
+				additive_base_context base_context;
+				prepared_clip_context prepared_clip;
+				error_result prepare_result;
+				if (!base_clip.is_empty())
+				{
+					prepare_result = base_context.initialize(allocator, base_clip, prepare_settings, additive_format);
+					if (prepare_result.empty())
+						prepare_result = prepared_clip.initialize(allocator, transform_tracks, prepare_settings, base_context);
+				}
+				else
+					prepare_result = prepared_clip.initialize(allocator, transform_tracks, prepare_settings);
+
+				// Invalid clips are compressed directly to report their error
+				const prepared_clip_context* prepared_clip_ptr = prepare_result.empty() ? &prepared_clip : nullptr;
+
 				{
 					compression_settings uniform_tests[] =
 					{
@@ -1141,13 +1979,16 @@ static int safe_main_impl(int argc, char* argv[])
 
 						make_settings(rotation_format8::quatf_drop_w_variable, vector_format8::vector3f_variable, vector_format8::vector3f_full),
 						make_settings(rotation_format8::quatf_drop_w_variable, vector_format8::vector3f_variable, vector_format8::vector3f_variable),
+						make_settings(rotation_format8::quatf_drop_largest_variable, vector_format8::vector3f_variable, vector_format8::vector3f_variable),
+						make_settings(rotation_format8::quatf_log_variable, vector_format8::vector3f_variable, vector_format8::vector3f_variable),
+						make_settings(rotation_format8::quatf_drop_w_variable, vector_format8::vector3f_variable_per_component, vector_format8::vector3f_variable_per_component),
 					};
 
 					for (compression_settings test_settings : uniform_tests)
 					{
 						test_settings.error_metric = settings.error_metric;
 
-						try_algorithm(options, allocator, transform_tracks, base_clip, additive_format, test_settings, database_settings, logging, runs_writer, regression_error_threshold);
+						try_algorithm(options, allocator, transform_tracks, base_clip, additive_format, test_settings, database_settings, logging, runs_writer, regression_error_threshold, prepared_clip_ptr);
 					}
 				}
 
@@ -1159,6 +2000,9 @@ static int safe_main_impl(int argc, char* argv[])
 
 						make_settings(rotation_format8::quatf_drop_w_variable, vector_format8::vector3f_variable, vector_format8::vector3f_full),
 						make_settings(rotation_format8::quatf_drop_w_variable, vector_format8::vector3f_variable, vector_format8::vector3f_variable),
+						make_settings(rotation_format8::quatf_drop_largest_variable, vector_format8::vector3f_variable, vector_format8::vector3f_variable),
+						make_settings(rotation_format8::quatf_log_variable, vector_format8::vector3f_variable, vector_format8::vector3f_variable),
+						make_settings(rotation_format8::quatf_drop_w_variable, vector_format8::vector3f_variable_per_component, vector_format8::vector3f_variable_per_component),
 					};
 
 					for (compression_settings test_settings : uniform_tests)
@@ -1168,7 +2012,7 @@ static int safe_main_impl(int argc, char* argv[])
 						if (options.compression_level_specified)
 							test_settings.level = options.compression_level;
 
-						try_algorithm(options, allocator, transform_tracks, base_clip, additive_format, test_settings, database_settings, logging, runs_writer, regression_error_threshold);
+						try_algorithm(options, allocator, transform_tracks, base_clip, additive_format, test_settings, database_settings, logging, runs_writer, regression_error_threshold, prepared_clip_ptr);
 					}
 				}
 			}
@@ -1187,6 +2031,13 @@ static int safe_main_impl(int argc, char* argv[])
 		}
 		else if (sjson_type == sjson_file_type::raw_track_list)
 		{
+			if (options.autotune != autotune_objective::none)
+			{
+				printf("Autotune only supports transform tracks\n");
+				exit_code = -1;
+				return;
+			}
+
 			try_algorithm(options, allocator, scalar_tracks, logging, runs_writer, regression_error_threshold);
 		}
 	};
@@ -1204,11 +2055,412 @@ static int safe_main_impl(int argc, char* argv[])
 		exec_algos(nullptr);
 
 	deallocate_type(allocator, settings.error_metric);
+
+	return exit_code;
+#else
+	(void)options;
+
+	return 0;
 #endif	// defined(ACL_USE_SJSON)
+}
+
+// Asserts are reported and turned into an error code, when they throw
+template<class function_type>
+static int run_and_catch_asserts(function_type&& function)
+{
+	int result = -1;
+#if defined(ACL_ON_ASSERT_THROW) || defined(SJSON_CPP_ON_ASSERT_THROW) || defined(RTM_ON_ASSERT_THROW)
+	try
+#endif
+	{
+		result = function();
+	}
+#if defined(ACL_ON_ASSERT_THROW)
+	catch (const runtime_assert& exception)
+	{
+		printf("ACL assert occurred: %s\n", exception.what());
+		result = -1;
+	}
+#endif
+#if defined(SJSON_CPP_ON_ASSERT_THROW)
+	catch (const sjson::runtime_assert& exception)
+	{
+		printf("sjson-cpp assert occurred: %s\n", exception.what());
+		result = -1;
+	}
+#endif
+#if defined(RTM_ON_ASSERT_THROW)
+	catch (const rtm::runtime_assert& exception)
+	{
+		printf("RTM assert occurred: %s\n", exception.what());
+		result = -1;
+	}
+#endif
+
+	return result;
+}
+
+// Splits a job line into its arguments, double quotes group arguments that contain spaces and are removed
+static void split_job_arguments(const std::string& line, std::vector<std::string>& out_arguments)
+{
+	out_arguments.clear();
+
+	std::string argument;
+	bool has_argument = false;
+	bool is_quoted = false;
+	for (const char character : line)
+	{
+		if (character == '"')
+		{
+			is_quoted = !is_quoted;
+			has_argument = true;
+		}
+		else if (!is_quoted && (character == ' ' || character == '\t' || character == '\r'))
+		{
+			if (has_argument)
+				out_arguments.push_back(argument);
+
+			argument.clear();
+			has_argument = false;
+		}
+		else
+		{
+			argument += character;
+			has_argument = true;
+		}
+	}
+
+	if (has_argument)
+		out_arguments.push_back(argument);
+}
+
+// Compressing many small clips is dominated by the process startup. In server mode, every line read from
+// the standard input is a job: the arguments of a regular invocation (e.g. '-acl="clip.acl.sjson" -stats="clip_stats.sjson"').
+// The thread pool is created once and shared by every job. Once a job completes, 'job_done <result>' is written
+// to the standard output where the result is the exit code of a regular invocation. An empty line or the
+// end of the standard input stops the server.
+static int run_server(const char* executable_name, thread_pool* pool)
+{
+	std::string line;
+	std::vector<std::string> arguments;
+	std::vector<char*> argv;
+
+	while (std::getline(std::cin, line))
+	{
+		split_job_arguments(line, arguments);
+		if (arguments.empty())
+			break;	// Empty line, we are done
+
+		argv.clear();
+		argv.push_back(const_cast<char*>(executable_name));
+		for (std::string& argument : arguments)
+			argv.push_back(&argument[0]);
+
+		const int result = run_and_catch_asserts([&]()
+		{
+			Options options;
+			if (!parse_options(int(argv.size()), argv.data(), options) || options.server_mode)
+				return -1;
+
+			// Jobs share the thread pool of the server, the number of threads is set when the server starts
+			options.pool = pool;
+			return run_job(options);
+		});
+
+		printf("job_done %d\n", result);
+		std::fflush(stdout);
+	}
 
 	return 0;
 }
 
+// Recursively finds every ACL file within a directory
+static void find_clips_in_directory(const std::string& directory, std::vector<std::string>& out_clips)
+{
+#ifdef _WIN32
+	const std::string pattern = directory + "\\*";
+
+	WIN32_FIND_DATAA find_data;
+	HANDLE find_handle = FindFirstFileA(pattern.c_str(), &find_data);
+	if (find_handle == INVALID_HANDLE_VALUE)
+		return;
+
+	do
+	{
+		if (std::strcmp(find_data.cFileName, ".") == 0 || std::strcmp(find_data.cFileName, "..") == 0)
+			continue;
+
+		const std::string path = directory + "\\" + find_data.cFileName;
+		if ((find_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0)
+			find_clips_in_directory(path, out_clips);
+		else if (is_acl_sjson_file(path.c_str()) || is_acl_bin_file(path.c_str()))
+			out_clips.push_back(path);
+	} while (FindNextFileA(find_handle, &find_data));
+
+	FindClose(find_handle);
+#else
+	DIR* dir = opendir(directory.c_str());
+	if (dir == nullptr)
+		return;
+
+	while (const dirent* entry = readdir(dir))
+	{
+		if (std::strcmp(entry->d_name, ".") == 0 || std::strcmp(entry->d_name, "..") == 0)
+			continue;
+
+		const std::string path = directory + "/" + entry->d_name;
+
+		struct stat path_stat;
+		if (stat(path.c_str(), &path_stat) != 0)
+			continue;
+
+		if (S_ISDIR(path_stat.st_mode))
+			find_clips_in_directory(path, out_clips);
+		else if (is_acl_sjson_file(path.c_str()) || is_acl_bin_file(path.c_str()))
+			out_clips.push_back(path);
+	}
+
+	closedir(dir);
+#endif
+}
+
+// The batch path is either a directory or a list file with one clip path per line
+static bool find_batch_clips(const char* batch_path, std::vector<std::string>& out_clips)
+{
+#ifdef _WIN32
+	const DWORD attributes = GetFileAttributesA(batch_path);
+	if (attributes == INVALID_FILE_ATTRIBUTES)
+		return false;
+
+	const bool is_directory = (attributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+#else
+	struct stat path_stat;
+	if (stat(batch_path, &path_stat) != 0)
+		return false;
+
+	const bool is_directory = S_ISDIR(path_stat.st_mode);
+#endif
+
+	if (is_directory)
+	{
+		find_clips_in_directory(batch_path, out_clips);
+
+		// Sort our clips to keep the aggregated statistics deterministic
+		std::sort(out_clips.begin(), out_clips.end());
+		return true;
+	}
+
+	std::ifstream list_file(batch_path);
+	if (!list_file.is_open())
+		return false;
+
+	std::string line;
+	while (std::getline(list_file, line))
+	{
+		while (!line.empty() && (line.back() == '\r' || line.back() == ' ' || line.back() == '\t'))
+			line.pop_back();
+
+		if (!line.empty())
+			out_clips.push_back(line);
+	}
+
+	return true;
+}
+
+// Writes a string as an SJSON string value
+static void write_sjson_string(std::FILE* file, const std::string& value)
+{
+	std::fputc('"', file);
+	for (const char character : value)
+	{
+		if (character == '"' || character == '\\')
+			std::fputc('\\', file);
+
+		std::fputc(character, file);
+	}
+	std::fputc('"', file);
+}
+
+struct batch_clip
+{
+	std::string path;
+	std::string stats;
+	int result = -1;
+};
+
+struct batch_job
+{
+	const std::vector<std::string>* arguments;
+	std::vector<batch_clip>* clips;
+	std::atomic<uint32_t>* next_clip_index;
+	bool output_stats;
+
+	static void execute(void* job_data)
+	{
+		const batch_job& job = *static_cast<const batch_job*>(job_data);
+		std::vector<batch_clip>& clips = *job.clips;
+
+		// Enable floating point exceptions on our worker threads as well
+		scope_enable_fp_exceptions fp_on;
+
+		std::vector<std::string> arguments;
+		std::vector<char*> argv;
+
+		// Clips vary wildly in size, every worker grabs the next clip as soon as it is done with the previous one
+		while (true)
+		{
+			const uint32_t clip_index = job.next_clip_index->fetch_add(1);
+			if (clip_index >= clips.size())
+				break;
+
+			batch_clip& clip = clips[clip_index];
+
+			arguments = *job.arguments;
+			arguments.push_back(std::string(k_acl_input_file_option) + clip.path);
+
+			argv.clear();
+			for (std::string& argument : arguments)
+				argv.push_back(&argument[0]);
+
+			clip.result = run_and_catch_asserts([&]()
+			{
+				Options options;
+				if (!parse_options(int(argv.size()), argv.data(), options))
+					return -1;
+
+				// Each clip writes its statistics into a temporary file that we aggregate once every clip is done
+				if (job.output_stats)
+				{
+					options.do_output_stats = true;
+					options.output_stats_file = std::tmpfile();
+					if (options.output_stats_file == nullptr)
+						return -1;
+				}
+
+				const int result = run_job(options);
+
+				if (options.output_stats_file != nullptr)
+				{
+					std::fflush(options.output_stats_file);
+					std::rewind(options.output_stats_file);
+
+					char buffer[16 * 1024];
+					size_t num_bytes_read;
+					while ((num_bytes_read = std::fread(buffer, 1, sizeof(buffer), options.output_stats_file)) != 0)
+						clip.stats.append(buffer, num_bytes_read);
+				}
+
+				return result;
+			});
+		}
+	}
+};
+
+// Compresses every clip of a directory or list file concurrently within this process, every clip
+// uses the other options provided (e.g. '-config='). The number of clips processed concurrently is set with
+// '-threads=' and every clip is compressed single threaded. With '-stats=', the statistics of every clip
+// are aggregated in a single file.
+static int run_batch(int argc, char* argv[], const Options& options, thread_pool* pool)
+{
+	if (options.output_bin_filename != nullptr || options.output_db_filename != nullptr || options.output_binary_stats_filename != nullptr)
+	{
+		printf("Binary, database, and binary stats outputs are not supported in batch mode\n");
+		return -1;
+	}
+
+	std::vector<std::string> clip_paths;
+	if (!find_batch_clips(options.batch_path, clip_paths))
+	{
+		printf("Failed to read the batch directory or list file: %s\n", options.batch_path);
+		return -1;
+	}
+
+	std::vector<batch_clip> clips(clip_paths.size());
+	for (size_t clip_index = 0; clip_index < clip_paths.size(); ++clip_index)
+		clips[clip_index].path = clip_paths[clip_index];
+
+	// Every clip is compressed with our options, except for the ones that only apply to the batch
+	std::vector<std::string> arguments;
+	for (int arg_index = 0; arg_index < argc; ++arg_index)
+	{
+		const char* argument = argv[arg_index];
+		if (std::strncmp(argument, k_batch_option, std::strlen(k_batch_option)) == 0
+			|| std::strncmp(argument, k_stats_output_option, std::strlen(k_stats_output_option)) == 0
+			|| std::strncmp(argument, k_num_threads_option, std::strlen(k_num_threads_option)) == 0)
+			continue;
+
+		arguments.push_back(argument);
+	}
+
+	std::atomic<uint32_t> next_clip_index(0);
+	batch_job job = { &arguments, &clips, &next_clip_index, options.do_output_stats };
+
+	if (pool != nullptr)
+	{
+		for (uint32_t thread_index = 0; thread_index < pool->get_num_threads(); ++thread_index)
+			pool->submit_job(&batch_job::execute, &job);
+
+		pool->wait_for_jobs();
+	}
+	else
+		batch_job::execute(&job);
+
+	uint32_t num_failed_clips = 0;
+	for (const batch_clip& clip : clips)
+	{
+		if (clip.result != 0)
+		{
+			printf("Failed to compress clip: %s\n", clip.path.c_str());
+			num_failed_clips++;
+		}
+	}
+
+	if (options.do_output_stats)
+	{
+		// Every clip entry contains the runs of its statistics as written by a regular invocation
+		std::FILE* file = options.output_stats_file;
+		std::fprintf(file, "clips = [\n");
+
+		for (const batch_clip& clip : clips)
+		{
+			std::fprintf(file, "\t{\n\t\tclip = ");
+			write_sjson_string(file, clip.path);
+			std::fprintf(file, "\n\t\tresult = %d\n", clip.result);
+			std::fwrite(clip.stats.data(), 1, clip.stats.size(), file);
+			std::fprintf(file, "\n\t}\n");
+		}
+
+		std::fprintf(file, "]\n");
+		std::fflush(file);
+	}
+
+	printf("Compressed %u clips, %u failed\n", uint32_t(clips.size()), num_failed_clips);
+	return num_failed_clips == 0 ? 0 : -1;
+}
+
+static int safe_main_impl(int argc, char* argv[])
+{
+	Options options;
+
+	if (!parse_options(argc, argv, options))
+		return -1;
+
+	std::unique_ptr<thread_pool> pool;
+	if (options.num_threads != 1)
+	{
+		pool.reset(new thread_pool(options.num_threads));
+		options.pool = pool.get();
+	}
+
+	if (options.server_mode)
+		return run_server(argv[0], options.pool);
+
+	if (options.batch_path != nullptr)
+		return run_batch(argc, argv, options, options.pool);
+
+	return run_job(options);
+}
+
 #if defined(RTM_COMPILER_MSVC_2015)
 	#pragma warning(pop)
 #endif
@@ -1237,34 +2489,7 @@ int main_impl(int argc, char* argv[])
 	// Enable floating point exceptions when possible to detect errors when regression testing
 	scope_enable_fp_exceptions fp_on;
 
-	int result = -1;
-#if defined(ACL_ON_ASSERT_THROW) || defined(SJSON_CPP_ON_ASSERT_THROW) || defined(RTM_ON_ASSERT_THROW)
-	try
-#endif
-	{
-		result = safe_main_impl(argc, argv);
-	}
-#if defined(ACL_ON_ASSERT_THROW)
-	catch (const runtime_assert& exception)
-	{
-		printf("ACL assert occurred: %s\n", exception.what());
-		result = -1;
-	}
-#endif
-#if defined(SJSON_CPP_ON_ASSERT_THROW)
-	catch (const sjson::runtime_assert& exception)
-	{
-		printf("sjson-cpp assert occurred: %s\n", exception.what());
-		result = -1;
-	}
-#endif
-#if defined(RTM_ON_ASSERT_THROW)
-	catch (const rtm::runtime_assert& exception)
-	{
-		printf("RTM assert occurred: %s\n", exception.what());
-		result = -1;
-	}
-#endif
+	const int result = run_and_catch_asserts([&]() { return safe_main_impl(argc, argv); });
 
 #ifdef _WIN32
 	if (IsDebuggerPresent())
@@ -23,6 +23,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "acl_compressor.h"
+#include "thread_pool.h"
 
 #include "acl/core/compressed_database.h"
 #include "acl/core/compressed_tracks.h"
@@ -497,7 +498,8 @@ static bool has_zero_scale(const track_array_qvvf& raw_tracks)
 
 void validate_db(iallocator& allocator, const track_array_qvvf& raw_tracks, const track_array_qvvf& additive_base_tracks,
 	const compression_database_settings& settings, const itransform_error_metric& error_metric,
-	const compressed_tracks& compressed_tracks0, const compressed_tracks& compressed_tracks1)
+	const compressed_tracks& compressed_tracks0, const compressed_tracks& compressed_tracks1,
+	thread_pool* pool)
 {
 	using namespace acl_impl;
 
@@ -660,9 +662,6 @@ void validate_db(iallocator& allocator, const track_array_qvvf& raw_tracks, cons
 		ACL_ASSERT(db_context0.relocated(*db0), "Relocation should succeed");
 	}
 
-	// Measure the tier error when stripping
-	validate_db_stripping(allocator, raw_tracks, additive_base_tracks, error_metric, *db_tracks01[0], *db_tracks01[1], *db01, db01->get_bulk_data(quality_tier::medium_importance), db01->get_bulk_data(quality_tier::lowest_importance));
-
 	// Split the database bulk data out
 	compressed_database* split_db = nullptr;
 	uint8_t* split_db_bulk_data_medium = nullptr;
@@ -674,11 +673,32 @@ void validate_db(iallocator& allocator, const track_array_qvvf& raw_tracks, cons
 	ACL_ASSERT(split_db->contains(*db_tracks01[0]), "Database should contain our clip");
 	ACL_ASSERT(split_db->contains(*db_tracks01[1]), "Database should contain our clip");
 
-	// Measure the tier error through simulated streaming
-	validate_db_streaming(allocator, raw_tracks, additive_base_tracks, error_metric, high_quality_tier_error_ref, *db_tracks01[0], *db_tracks01[1], *split_db, split_db_bulk_data_medium, split_db_bulk_data_low);
-
-	// Measure the tier error when stripping
-	validate_db_stripping(allocator, raw_tracks, additive_base_tracks, error_metric, *db_tracks01[0], *db_tracks01[1], *split_db, split_db_bulk_data_medium, split_db_bulk_data_low);
+	// The validations below each use their own contexts and only read the databases, they are independent
+	// and execute concurrently when we have a thread pool
+	parallel_for(pool, 3, [&](uint32_t first_validation_index, uint32_t last_validation_index)
+		{
+			// Floating point exception state is per thread, we might be running on a worker
+			scope_disable_fp_exceptions fp_off_;
+
+			for (uint32_t validation_index = first_validation_index; validation_index < last_validation_index; ++validation_index)
+			{
+				switch (validation_index)
+				{
+				case 0:
+					// Measure the tier error when stripping
+					validate_db_stripping(allocator, raw_tracks, additive_base_tracks, error_metric, *db_tracks01[0], *db_tracks01[1], *db01, db01->get_bulk_data(quality_tier::medium_importance), db01->get_bulk_data(quality_tier::lowest_importance));
+					break;
+				case 1:
+					// Measure the tier error through simulated streaming
+					validate_db_streaming(allocator, raw_tracks, additive_base_tracks, error_metric, high_quality_tier_error_ref, *db_tracks01[0], *db_tracks01[1], *split_db, split_db_bulk_data_medium, split_db_bulk_data_low);
+					break;
+				default:
+					// Measure the tier error when stripping
+					validate_db_stripping(allocator, raw_tracks, additive_base_tracks, error_metric, *db_tracks01[0], *db_tracks01[1], *split_db, split_db_bulk_data_medium, split_db_bulk_data_low);
+					break;
+				}
+			}
+		});
 
 	// Duplicate our clips so we can modify them
 	compressed_tracks* compressed_tracks_copy0 = safe_ptr_cast<compressed_tracks>(allocate_type_array_aligned<uint8_t>(allocator, db_tracks0[0]->get_size(), alignof(compressed_tracks)));
@@ -23,6 +23,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "acl_compressor.h"
+#include "thread_pool.h"
 
 #include "acl/core/compressed_tracks.h"
 #include "acl/core/floating_point_exceptions.h"
@@ -88,13 +89,94 @@ void validate_transform_tracks(const acl::acl_impl::debug_track_writer& referenc
 	}
 }
 
+static void validate_transform_samples(
+	iallocator& allocator,
+	const track_array_qvvf& raw_tracks,
+	const compressed_tracks& compressed_tracks_,
+	uint32_t first_sample_index, uint32_t last_sample_index,
+	float quat_error_threshold, float vec3_error_threshold)
+{
+	using namespace acl_impl;
+
+	// Floating point exception state is per thread, we might be running on a worker
+	scope_disable_fp_exceptions fp_off;
+
+	// We use the nearest sample to accurately measure the loss that happened, if any
+	const sample_rounding_policy rounding_policy = sample_rounding_policy::nearest;
+
+	// Every range has its own context and writers so that they can execute concurrently
+	acl::decompression_context<debug_transform_decompression_settings> context;
+
+	const bool initialized = context.initialize(compressed_tracks_);
+	ACL_ASSERT(initialized, "Failed to initialize decompression context"); (void)initialized;
+
+	const uint32_t num_tracks = compressed_tracks_.get_num_tracks();
+	const float duration = compressed_tracks_.get_finite_duration();
+	const float sample_rate = compressed_tracks_.get_sample_rate();
+
+	debug_track_writer track_writer(allocator, track_type8::qvvf, num_tracks);
+	track_writer.initialize_with_defaults(raw_tracks);
+
+	debug_track_writer_constant_defaults track_writer_constant(allocator, track_type8::qvvf, num_tracks);
+
+	debug_track_writer_variable_defaults track_writer_variable(allocator, track_type8::qvvf, num_tracks);
+	track_writer_variable.default_sub_tracks = track_writer.tracks_typed.qvvf;
+
+	for (uint32_t sample_index = first_sample_index; sample_index < last_sample_index; ++sample_index)
+	{
+		const float sample_time = rtm::scalar_min(float(sample_index) / sample_rate, duration);
+
+		// We use the nearest sample to accurately measure the loss that happened, if any
+		context.seek(sample_time, rounding_policy);
+		context.decompress_tracks(track_writer);
+		context.decompress_tracks(track_writer_constant);
+		context.decompress_tracks(track_writer_variable);
+
+		// Make sure constant default sub-tracks match the skipped sub-tracks
+		validate_transform_tracks(track_writer, track_writer_constant, sample_time, quat_error_threshold, vec3_error_threshold);
+
+		// Make sure variable default sub-tracks match the skipped sub-tracks
+		validate_transform_tracks(track_writer, track_writer_variable, sample_time, quat_error_threshold, vec3_error_threshold);
+
+		// Validate decompress_track against decompress_tracks
+		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+		{
+			const rtm::qvvf transform0 = track_writer.read_qvv(track_index);
+
+			// Make sure single track decompression matches
+			context.decompress_track(track_index, track_writer);
+			const rtm::qvvf transform1 = track_writer.read_qvv(track_index);
+
+			// Rotations can differ a bit due to how we normalize during interpolation
+			ACL_ASSERT(are_rotations_equal(transform0.rotation, transform1.rotation, quat_error_threshold),
+				"Failed to sample rotation with decompress_track for bone index %u at sample index %u. Expected [%.5f, %.5f, %.5f, %.5f], got [%.5f, %.5f, %.5f, %.5f].",
+				track_index, sample_index,
+				(float)rtm::quat_get_x(transform0.rotation), (float)rtm::quat_get_y(transform0.rotation), (float)rtm::quat_get_z(transform0.rotation), (float)rtm::quat_get_w(transform0.rotation),
+				(float)rtm::quat_get_x(transform1.rotation), (float)rtm::quat_get_y(transform1.rotation), (float)rtm::quat_get_z(transform1.rotation), (float)rtm::quat_get_w(transform1.rotation));
+
+			ACL_ASSERT(rtm::vector_all_near_equal3(transform0.translation, transform1.translation, vec3_error_threshold),
+				"Failed to sample translation with decompress_track for bone index %u at sample index %u. Expected [%.5f, %.5f, %.5f], got [%.5f, %.5f, %.5f].",
+				track_index, sample_index,
+				(float)rtm::vector_get_x(transform0.translation), (float)rtm::vector_get_y(transform0.translation), (float)rtm::vector_get_z(transform0.translation),
+				(float)rtm::vector_get_x(transform1.translation), (float)rtm::vector_get_y(transform1.translation), (float)rtm::vector_get_z(transform1.translation));
+
+			ACL_ASSERT(rtm::vector_all_near_equal3(transform0.scale, transform1.scale, vec3_error_threshold),
+				"Failed to sample scale with decompress_track for bone index %u at sample index %u. Expected [%.5f, %.5f, %.5f], got [%.5f, %.5f, %.5f].",
+				track_index, sample_index,
+				(float)rtm::vector_get_x(transform0.scale), (float)rtm::vector_get_y(transform0.scale), (float)rtm::vector_get_z(transform0.scale),
+				(float)rtm::vector_get_x(transform1.scale), (float)rtm::vector_get_y(transform1.scale), (float)rtm::vector_get_z(transform1.scale));
+		}
+	}
+}
+
 void validate_accuracy(
 	iallocator& allocator,
 	const track_array_qvvf& raw_tracks,
 	const track_array_qvvf& additive_base_tracks,
 	const itransform_error_metric& error_metric,
 	const compressed_tracks& compressed_tracks_,
-	double regression_error_threshold
+	double regression_error_threshold,
+	thread_pool* pool
 	)
 {
 	using namespace acl_impl;
@@ -127,7 +209,8 @@ void validate_accuracy(
 	const bool is_bound_to_tracks = context.is_bound_to(compressed_tracks_);
 	ACL_ASSERT(is_bound_to_tracks, "Failed to bind to correct compressed tracks instance"); (void)is_bound_to_tracks;
 
-	const track_error error = calculate_compression_error(allocator, raw_tracks, context, error_metric, additive_base_tracks);
+	const compression_job_scheduler job_scheduler = pool != nullptr ? pool->get_job_scheduler() : compression_job_scheduler();
+	const track_error error = calculate_compression_error(allocator, raw_tracks, context, error_metric, additive_base_tracks, job_scheduler);
 	ACL_ASSERT(rtm::scalar_is_finite(error.error), "Returned error is not a finite value"); (void)error;
 	ACL_ASSERT(error.error < regression_error_threshold, "Error too high for bone %u: %f at time %f", error.index, error.error, error.sample_time);
 
@@ -210,52 +293,11 @@ void validate_accuracy(
 		}
 	}
 
-	// Regression test
-	for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
-	{
-		const float sample_time = rtm::scalar_min(float(sample_index) / sample_rate, duration);
-
-		// We use the nearest sample to accurately measure the loss that happened, if any
-		context.seek(sample_time, rounding_policy);
-		context.decompress_tracks(track_writer);
-		context.decompress_tracks(track_writer_constant);
-		context.decompress_tracks(track_writer_variable);
-
-		// Make sure constant default sub-tracks match the skipped sub-tracks
-		validate_transform_tracks(track_writer, track_writer_constant, sample_time, quat_error_threshold, vec3_error_threshold);
-
-		// Make sure variable default sub-tracks match the skipped sub-tracks
-		validate_transform_tracks(track_writer, track_writer_variable, sample_time, quat_error_threshold, vec3_error_threshold);
-
-		// Validate decompress_track against decompress_tracks
-		for (uint32_t track_index = 0; track_index < num_tracks; ++track_index)
+	// Regression test, sample ranges are validated concurrently when we have a thread pool
+	parallel_for(pool, num_samples, [&](uint32_t first_sample_index, uint32_t last_sample_index)
 		{
-			const rtm::qvvf transform0 = track_writer.read_qvv(track_index);
-
-			// Make sure single track decompression matches
-			context.decompress_track(track_index, track_writer);
-			const rtm::qvvf transform1 = track_writer.read_qvv(track_index);
-
-			// Rotations can differ a bit due to how we normalize during interpolation
-			ACL_ASSERT(are_rotations_equal(transform0.rotation, transform1.rotation, quat_error_threshold),
-				"Failed to sample rotation with decompress_track for bone index %u at sample index %u. Expected [%.5f, %.5f, %.5f, %.5f], got [%.5f, %.5f, %.5f, %.5f].",
-				track_index, sample_index,
-				(float)rtm::quat_get_x(transform0.rotation), (float)rtm::quat_get_y(transform0.rotation), (float)rtm::quat_get_z(transform0.rotation), (float)rtm::quat_get_w(transform0.rotation),
-				(float)rtm::quat_get_x(transform1.rotation), (float)rtm::quat_get_y(transform1.rotation), (float)rtm::quat_get_z(transform1.rotation), (float)rtm::quat_get_w(transform1.rotation));
-
-			ACL_ASSERT(rtm::vector_all_near_equal3(transform0.translation, transform1.translation, vec3_error_threshold),
-				"Failed to sample translation with decompress_track for bone index %u at sample index %u. Expected [%.5f, %.5f, %.5f], got [%.5f, %.5f, %.5f].",
-				track_index, sample_index,
-				(float)rtm::vector_get_x(transform0.translation), (float)rtm::vector_get_y(transform0.translation), (float)rtm::vector_get_z(transform0.translation),
-				(float)rtm::vector_get_x(transform1.translation), (float)rtm::vector_get_y(transform1.translation), (float)rtm::vector_get_z(transform1.translation));
-
-			ACL_ASSERT(rtm::vector_all_near_equal3(transform0.scale, transform1.scale, vec3_error_threshold),
-				"Failed to sample scale with decompress_track for bone index %u at sample index %u. Expected [%.5f, %.5f, %.5f], got [%.5f, %.5f, %.5f].",
-				track_index, sample_index,
-				(float)rtm::vector_get_x(transform0.scale), (float)rtm::vector_get_y(transform0.scale), (float)rtm::vector_get_z(transform0.scale),
-				(float)rtm::vector_get_x(transform1.scale), (float)rtm::vector_get_y(transform1.scale), (float)rtm::vector_get_z(transform1.scale));
-		}
-	}
+			validate_transform_samples(allocator, raw_tracks, compressed_tracks_, first_sample_index, last_sample_index, quat_error_threshold, vec3_error_threshold);
+		});
 }
 
 void RTM_SIMD_CALL validate_scalar_tracks(const track_array& raw_tracks, const acl::acl_impl::debug_track_writer& reference, const acl::acl_impl::debug_track_writer& tracks, rtm::vector4f_arg0 regression_error_thresholdv, float sample_time)
@@ -323,19 +365,18 @@ void RTM_SIMD_CALL validate_scalar_tracks(const track_array& raw_tracks, const a
 	}
 }
 
-void validate_accuracy(
+static void validate_scalar_samples(
 	iallocator& allocator,
 	const track_array& raw_tracks,
 	const compressed_tracks& tracks,
-	double regression_error_threshold
-	)
+	uint32_t first_sample_index, uint32_t last_sample_index,
+	float regression_error_thresholdf)
 {
 	using namespace acl_impl;
 
-	// Disable floating point exceptions since decompression assumes it
+	// Floating point exception state is per thread, we might be running on a worker
 	scope_disable_fp_exceptions fp_off;
 
-	const float regression_error_thresholdf = static_cast<float>(regression_error_threshold);
 	const rtm::vector4f regression_error_thresholdv = rtm::vector_set(regression_error_thresholdf);
 
 	// We use the nearest sample to accurately measure the loss that happened, if any
@@ -346,80 +387,18 @@ void validate_accuracy(
 	const uint32_t num_tracks = tracks.get_num_tracks();
 	const track_type8 track_type = raw_tracks.get_track_type();
 
-	// Calculate the number of samples from the duration to account for the repeating
-	// first frame at the end when wrapping is used
-	const uint32_t num_samples = calculate_num_samples(duration, sample_rate);
-
-	ACL_ASSERT(rtm::scalar_near_equal(duration, raw_tracks.get_finite_duration(), 1.0E-7F), "Duration mismatch");
-	ACL_ASSERT(sample_rate == raw_tracks.get_sample_rate(), "Sample rate mismatch");
-	ACL_ASSERT(num_tracks <= raw_tracks.get_num_tracks(), "Num tracks mismatch");
-
+	// Every range has its own context and writers so that they can execute concurrently
 	decompression_context<debug_scalar_decompression_settings> context;
 
 	const bool initialized = context.initialize(tracks);
 	ACL_ASSERT(initialized, "Failed to initialize decompression context"); (void)initialized;
 
-	const bool is_bound_to_tracks = context.is_bound_to(tracks);
-	ACL_ASSERT(is_bound_to_tracks, "Failed to bind to correct compressed tracks instance"); (void)is_bound_to_tracks;
-
 	debug_track_writer raw_tracks_writer(allocator, track_type, num_tracks);
 	debug_track_writer raw_track_writer(allocator, track_type, num_tracks);
 	debug_track_writer lossy_tracks_writer(allocator, track_type, num_tracks);
 	debug_track_writer lossy_track_writer(allocator, track_type, num_tracks);
 
-	debug_track_writer_per_track_rounding track_writer_per_track_rounding(allocator, track_type, num_tracks);
-
-	{
-		// Try to decompress something at 0.0, if we have no tracks or samples, it should be handled
-		context.seek(0.0F, rounding_policy);
-		context.decompress_tracks(lossy_tracks_writer);
-	}
-
-	// Basic sanity checks
-	if (num_samples != 0)
-	{
-		debug_track_writer track_writer_clamped(allocator, track_type, num_tracks);
-
-		// Make sure clamping works properly at the start of the clip
-		raw_tracks.sample_tracks(0.0F, rounding_policy, raw_tracks_writer);
-
-		context.seek(-0.2F, rounding_policy);
-		context.decompress_tracks(track_writer_clamped);
-
-		validate_scalar_tracks(raw_tracks, raw_tracks_writer, track_writer_clamped, regression_error_thresholdv, -0.2F);
-
-		// Make sure clamping works properly at the end of the clip when we clamp
-		const float last_sample_time_clamp = rtm::scalar_min(float(num_samples - 1) / sample_rate, duration);
-
-		raw_tracks.sample_tracks(last_sample_time_clamp, rounding_policy, raw_tracks_writer);
-
-		context.seek(last_sample_time_clamp + 1.0F, rounding_policy);
-		context.decompress_tracks(track_writer_clamped);
-
-		validate_scalar_tracks(raw_tracks, raw_tracks_writer, track_writer_clamped, regression_error_thresholdv, last_sample_time_clamp + 1.0F);
-
-		// Test a few samples with all rounding modes per track
-		const float sample_times[] = { 0.0F, duration * 0.2F, duration * 0.5F, duration * 0.75F, duration };
-		const sample_rounding_policy rounding_policies[] = { sample_rounding_policy::none, sample_rounding_policy::floor, sample_rounding_policy::ceil, sample_rounding_policy::nearest };
-
-		for (float sample_time : make_iterator(sample_times))
-		{
-			for (sample_rounding_policy policy : make_iterator(rounding_policies))
-			{
-				context.seek(sample_time, policy);
-				context.decompress_tracks(lossy_tracks_writer);
-
-				track_writer_per_track_rounding.rounding_policy = policy;
-				context.seek(sample_time, sample_rounding_policy::per_track);
-				context.decompress_tracks(track_writer_per_track_rounding);
-
-				validate_scalar_tracks(raw_tracks, lossy_tracks_writer, track_writer_per_track_rounding, regression_error_thresholdv, sample_time);
-			}
-		}
-	}
-
-	// Regression test
-	for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+	for (uint32_t sample_index = first_sample_index; sample_index < last_sample_index; ++sample_index)
 	{
 		const float sample_time = rtm::scalar_min(float(sample_index) / sample_rate, duration);
 
@@ -507,6 +486,107 @@ void validate_accuracy(
 	}
 }
 
+void validate_accuracy(
+	iallocator& allocator,
+	const track_array& raw_tracks,
+	const compressed_tracks& tracks,
+	double regression_error_threshold,
+	thread_pool* pool
+	)
+{
+	using namespace acl_impl;
+
+	// Disable floating point exceptions since decompression assumes it
+	scope_disable_fp_exceptions fp_off;
+
+	const float regression_error_thresholdf = static_cast<float>(regression_error_threshold);
+	const rtm::vector4f regression_error_thresholdv = rtm::vector_set(regression_error_thresholdf);
+
+	// We use the nearest sample to accurately measure the loss that happened, if any
+	const sample_rounding_policy rounding_policy = sample_rounding_policy::nearest;
+
+	const float duration = tracks.get_finite_duration();
+	const float sample_rate = tracks.get_sample_rate();
+	const uint32_t num_tracks = tracks.get_num_tracks();
+	const track_type8 track_type = raw_tracks.get_track_type();
+
+	// Calculate the number of samples from the duration to account for the repeating
+	// first frame at the end when wrapping is used
+	const uint32_t num_samples = calculate_num_samples(duration, sample_rate);
+
+	ACL_ASSERT(rtm::scalar_near_equal(duration, raw_tracks.get_finite_duration(), 1.0E-7F), "Duration mismatch");
+	ACL_ASSERT(sample_rate == raw_tracks.get_sample_rate(), "Sample rate mismatch");
+	ACL_ASSERT(num_tracks <= raw_tracks.get_num_tracks(), "Num tracks mismatch");
+
+	decompression_context<debug_scalar_decompression_settings> context;
+
+	const bool initialized = context.initialize(tracks);
+	ACL_ASSERT(initialized, "Failed to initialize decompression context"); (void)initialized;
+
+	const bool is_bound_to_tracks = context.is_bound_to(tracks);
+	ACL_ASSERT(is_bound_to_tracks, "Failed to bind to correct compressed tracks instance"); (void)is_bound_to_tracks;
+
+	debug_track_writer raw_tracks_writer(allocator, track_type, num_tracks);
+	debug_track_writer lossy_tracks_writer(allocator, track_type, num_tracks);
+
+	debug_track_writer_per_track_rounding track_writer_per_track_rounding(allocator, track_type, num_tracks);
+
+	{
+		// Try to decompress something at 0.0, if we have no tracks or samples, it should be handled
+		context.seek(0.0F, rounding_policy);
+		context.decompress_tracks(lossy_tracks_writer);
+	}
+
+	// Basic sanity checks
+	if (num_samples != 0)
+	{
+		debug_track_writer track_writer_clamped(allocator, track_type, num_tracks);
+
+		// Make sure clamping works properly at the start of the clip
+		raw_tracks.sample_tracks(0.0F, rounding_policy, raw_tracks_writer);
+
+		context.seek(-0.2F, rounding_policy);
+		context.decompress_tracks(track_writer_clamped);
+
+		validate_scalar_tracks(raw_tracks, raw_tracks_writer, track_writer_clamped, regression_error_thresholdv, -0.2F);
+
+		// Make sure clamping works properly at the end of the clip when we clamp
+		const float last_sample_time_clamp = rtm::scalar_min(float(num_samples - 1) / sample_rate, duration);
+
+		raw_tracks.sample_tracks(last_sample_time_clamp, rounding_policy, raw_tracks_writer);
+
+		context.seek(last_sample_time_clamp + 1.0F, rounding_policy);
+		context.decompress_tracks(track_writer_clamped);
+
+		validate_scalar_tracks(raw_tracks, raw_tracks_writer, track_writer_clamped, regression_error_thresholdv, last_sample_time_clamp + 1.0F);
+
+		// Test a few samples with all rounding modes per track
+		const float sample_times[] = { 0.0F, duration * 0.2F, duration * 0.5F, duration * 0.75F, duration };
+		const sample_rounding_policy rounding_policies[] = { sample_rounding_policy::none, sample_rounding_policy::floor, sample_rounding_policy::ceil, sample_rounding_policy::nearest };
+
+		for (float sample_time : make_iterator(sample_times))
+		{
+			for (sample_rounding_policy policy : make_iterator(rounding_policies))
+			{
+				context.seek(sample_time, policy);
+				context.decompress_tracks(lossy_tracks_writer);
+
+				track_writer_per_track_rounding.rounding_policy = policy;
+				context.seek(sample_time, sample_rounding_policy::per_track);
+				context.decompress_tracks(track_writer_per_track_rounding);
+
+				validate_scalar_tracks(raw_tracks, lossy_tracks_writer, track_writer_per_track_rounding, regression_error_thresholdv, sample_time);
+			}
+		}
+	}
+
+	// Regression test, sample ranges are validated concurrently when we have a thread pool
+	parallel_for(pool, num_samples, [&](uint32_t first_sample_index, uint32_t last_sample_index)
+		{
+			validate_scalar_samples(allocator, raw_tracks, tracks, first_sample_index, last_sample_index, regression_error_thresholdf);
+		});
+}
+
 void validate_metadata(const track_array& raw_tracks, const compressed_tracks& tracks)
 {
 	const uint32_t num_tracks = raw_tracks.get_num_tracks();
@@ -527,6 +607,10 @@ void validate_metadata(const track_array& raw_tracks, const compressed_tracks& t
 		const string& raw_name = raw_track.get_name();
 		const char* compressed_name = tracks.get_track_name(output_index);
 		ACL_ASSERT(raw_name == compressed_name, "Unexpected track name");
+
+		// Duplicate names resolve to the first track that uses them
+		const uint32_t found_index = tracks.find_track_index(raw_name.c_str());
+		ACL_ASSERT(found_index <= output_index && raw_name == tracks.get_track_name(found_index), "Unexpected track index found by name"); (void)found_index;
 	}
 
 	if (raw_tracks.get_track_type() == track_type8::qvvf)
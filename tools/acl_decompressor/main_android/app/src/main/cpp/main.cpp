@@ -28,6 +28,10 @@
 #include <android/asset_manager_jni.h>
 #include <android/log.h>
 
+#if __ANDROID_API__ >= 30
+	#include <android/thermal.h>
+#endif
+
 #include <cstdint>
 #include <iostream>
 #include <memory>
@@ -39,6 +43,7 @@
 #include <sjson/parser.h>
 
 #include <benchmark.h>
+#include <sustained_benchmark.h>
 
 static int load_file(AAssetManager* asset_manager, const char* filename, void*& out_buffer, size_t& out_buffer_size)
 {
@@ -77,6 +82,23 @@ static int read_metadata(AAssetManager* asset_manager, std::string& out_clip_dir
 	return result;
 }
 
+// Returns the thermal status (0 none, 1 light, 2 moderate, 3 severe, 4 critical, 5 emergency, 6 shutdown), -1 if unknown
+static int query_thermal_state()
+{
+#if __ANDROID_API__ >= 30
+	AThermalManager* thermal_manager = AThermal_acquireManager();
+	if (thermal_manager == nullptr)
+		return -1;
+
+	const int thermal_status = int(AThermal_getCurrentThermalStatus(thermal_manager));
+	AThermal_releaseManager(thermal_manager);
+	return thermal_status >= 0 ? thermal_status : -1;
+#else
+	// The thermal API requires Android 11
+	return -1;
+#endif
+}
+
 // Inspired from https://stackoverflow.com/questions/8870174/is-stdcout-usable-in-android-ndk
 class androidbuf final : public std::streambuf
 {
@@ -116,7 +138,7 @@ private:
 	char buffer[bufsize];
 };
 
-extern "C" jint Java_com_acl_decompressor_MainActivity_nativeMain(JNIEnv* env, jobject caller, jobject java_asset_manager, jstring java_output_directory)
+extern "C" jint Java_com_acl_decompressor_MainActivity_nativeMain(JNIEnv* env, jobject caller, jobject java_asset_manager, jstring java_output_directory, jint sustained_duration_s)
 {
 	std::cout.rdbuf(new androidbuf());
 
@@ -157,22 +179,35 @@ extern "C" jint Java_com_acl_decompressor_MainActivity_nativeMain(JNIEnv* env, j
 
 	const int num_failed_decompression = clips.size() - compressed_clips.size();
 
-	char argv_0_executable_name[64];
-	snprintf(argv_0_executable_name, sizeof(argv_0_executable_name), "Android APK");
+	if (sustained_duration_s > 0)
+	{
+		// Sustained mode replaces the regular benchmarks
+		sustained_benchmark_options sustained_options;
+		sustained_options.duration_s = uint32_t(sustained_duration_s);
+		sustained_options.query_thermal_state = query_thermal_state;
 
-	char argv_1_benchmark_out[2048];
-	snprintf(argv_1_benchmark_out, sizeof(argv_1_benchmark_out), "--benchmark_out=%s", output_filename.c_str());
+		const std::string sustained_output_filename = std::string(output_directory) + "/sustained_results.csv";
+		run_sustained_benchmark(compressed_clips, sustained_options, sustained_output_filename.c_str());
+	}
+	else
+	{
+		char argv_0_executable_name[64];
+		snprintf(argv_0_executable_name, sizeof(argv_0_executable_name), "Android APK");
 
-	char argv_2_benchmark_out_format[64];
-	snprintf(argv_2_benchmark_out_format, sizeof(argv_2_benchmark_out_format), "--benchmark_out_format=json");
+		char argv_1_benchmark_out[2048];
+		snprintf(argv_1_benchmark_out, sizeof(argv_1_benchmark_out), "--benchmark_out=%s", output_filename.c_str());
 
-	int argc = 3;
-	char* argv[3] = { argv_0_executable_name, argv_1_benchmark_out, argv_2_benchmark_out_format };
+		char argv_2_benchmark_out_format[64];
+		snprintf(argv_2_benchmark_out_format, sizeof(argv_2_benchmark_out_format), "--benchmark_out_format=json");
 
-	benchmark::Initialize(&argc, argv);
+		int argc = 3;
+		char* argv[3] = { argv_0_executable_name, argv_1_benchmark_out, argv_2_benchmark_out_format };
 
-	// Run benchmarks
-	benchmark::RunSpecifiedBenchmarks();
+		benchmark::Initialize(&argc, argv);
+
+		// Run benchmarks
+		benchmark::RunSpecifiedBenchmarks();
+	}
 
 	// Clean up
 	clear_benchmark_state();
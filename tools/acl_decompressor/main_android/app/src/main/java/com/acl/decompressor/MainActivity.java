@@ -17,7 +17,10 @@ public class MainActivity extends Activity {
 		TextView resultTextView = new TextView(this);
 		String outputDirectory = getExternalFilesDir(null).getAbsolutePath();
 
-		int result = nativeMain(getAssets(), outputDirectory);
+		// Sustained mode runs for the provided number of seconds, e.g.: am start -n com.acl.decompressor/.MainActivity --ei sustained 600
+		int sustainedDurationS = getIntent().getIntExtra("sustained", 0);
+
+		int result = nativeMain(getAssets(), outputDirectory, sustainedDurationS);
 
 		if (result == 0)
 			resultTextView.setText("Success!");
@@ -27,5 +30,5 @@ public class MainActivity extends Activity {
 		setContentView(resultTextView);
 	}
 
-	public native int nativeMain(AssetManager assetManager, String outputDirectory);
+	public native int nativeMain(AssetManager assetManager, String outputDirectory, int sustainedDurationS);
 }
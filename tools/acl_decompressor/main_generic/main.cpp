@@ -23,9 +23,14 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <benchmark.h>
+#include <hardware_counters.h>
+#include <sustained_benchmark.h>
 
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <string>
 #include <vector>
 
@@ -88,9 +93,11 @@ static bool is_sjson_file(const char* filename)
 	return filename_len >= 6 && strncmp(filename + filename_len - 6, ".sjson", 6) == 0;
 }
 
-static bool parse_options(int argc, char* argv[], const char*& out_metadata_filename)
+static bool parse_options(int argc, char* argv[], const char*& out_metadata_filename, bool& out_benchmark_database, database_benchmark_options& out_database_options, float& out_stripped_proportion, sustained_benchmark_options& out_sustained_options)
 {
 	out_metadata_filename = nullptr;
+	out_benchmark_database = false;
+	out_stripped_proportion = 0.0F;
 
 	for (int arg_index = 1; arg_index < argc; ++arg_index)
 	{
@@ -109,6 +116,92 @@ static bool parse_options(int argc, char* argv[], const char*& out_metadata_file
 
 			continue;
 		}
+
+		static constexpr const char* k_database_option = "-database";
+		if (std::strcmp(argument, k_database_option) == 0)
+		{
+			out_benchmark_database = true;
+			continue;
+		}
+
+		static constexpr const char* k_perf_counters_option = "-perf_counters";
+		if (std::strcmp(argument, k_perf_counters_option) == 0)
+		{
+			set_hardware_counters_enabled(true);
+			continue;
+		}
+
+		static constexpr const char* k_huge_pages_option = "-huge_pages";
+		if (std::strcmp(argument, k_huge_pages_option) == 0)
+		{
+			set_huge_pages_enabled(true);
+			continue;
+		}
+
+		static constexpr const char* k_stripped_option = "-stripped=";
+		option_length = std::strlen(k_stripped_option);
+		if (std::strncmp(argument, k_stripped_option, option_length) == 0)
+		{
+			out_stripped_proportion = std::strtof(argument + option_length, nullptr);
+			if (out_stripped_proportion <= 0.0F || out_stripped_proportion > 1.0F)
+			{
+				printf("Stripped keyframe proportion must be between 0.0 and 1.0\n");
+				return false;
+			}
+
+			continue;
+		}
+
+		static constexpr const char* k_io_latency_option = "-io_latency=";
+		option_length = std::strlen(k_io_latency_option);
+		if (std::strncmp(argument, k_io_latency_option, option_length) == 0)
+		{
+			out_database_options.io_latency_us = uint32_t(std::strtoul(argument + option_length, nullptr, 10));
+			continue;
+		}
+
+		static constexpr const char* k_chunk_size_option = "-chunk_size=";
+		option_length = std::strlen(k_chunk_size_option);
+		if (std::strncmp(argument, k_chunk_size_option, option_length) == 0)
+		{
+			// In KB
+			out_database_options.max_chunk_size = uint32_t(std::strtoul(argument + option_length, nullptr, 10)) * 1024;
+			continue;
+		}
+
+		static constexpr const char* k_sustained_option = "-sustained=";
+		option_length = std::strlen(k_sustained_option);
+		if (std::strncmp(argument, k_sustained_option, option_length) == 0)
+		{
+			// In seconds
+			out_sustained_options.duration_s = uint32_t(std::strtoul(argument + option_length, nullptr, 10));
+			continue;
+		}
+
+		static constexpr const char* k_sustained_interval_option = "-sustained_interval=";
+		option_length = std::strlen(k_sustained_interval_option);
+		if (std::strncmp(argument, k_sustained_interval_option, option_length) == 0)
+		{
+			// In milliseconds
+			out_sustained_options.sample_interval_ms = std::max<uint32_t>(uint32_t(std::strtoul(argument + option_length, nullptr, 10)), 1);
+			continue;
+		}
+
+		static constexpr const char* k_sustained_threads_option = "-sustained_threads=";
+		option_length = std::strlen(k_sustained_threads_option);
+		if (std::strncmp(argument, k_sustained_threads_option, option_length) == 0)
+		{
+			out_sustained_options.num_threads = uint32_t(std::strtoul(argument + option_length, nullptr, 10));
+			continue;
+		}
+
+		static constexpr const char* k_bulk_data_dir_option = "-bulk_dir=";
+		option_length = std::strlen(k_bulk_data_dir_option);
+		if (std::strncmp(argument, k_bulk_data_dir_option, option_length) == 0)
+		{
+			out_database_options.bulk_data_dir = argument + option_length;
+			continue;
+		}
 	}
 
 	return out_metadata_filename != nullptr;
@@ -180,7 +273,11 @@ int main(int argc, char* argv[])
 #endif
 
 	const char* metadata_filename = nullptr;
-	if (!parse_options(argc, argv, metadata_filename))
+	bool benchmark_database = false;
+	database_benchmark_options database_options;
+	float stripped_proportion = 0.0F;
+	sustained_benchmark_options sustained_options;
+	if (!parse_options(argc, argv, metadata_filename, benchmark_database, database_options, stripped_proportion, sustained_options))
 		return -1;
 
 	const char* metadata_buffer = nullptr;
@@ -196,25 +293,53 @@ int main(int argc, char* argv[])
 	delete[] metadata_buffer;
 	metadata_buffer = nullptr;
 
+	std::vector<input_clip> input_clips(clips.size());
+	for (size_t clip_index = 0; clip_index < clips.size(); ++clip_index)
+	{
+		if (!read_clip(clip_dir, clips[clip_index], input_clips[clip_index]))
+			printf("Failed to read clip %s!\n", clips[clip_index].c_str());
+	}
+
+	validate_clips(input_clips);
+
 	std::vector<acl::compressed_tracks*> compressed_clips;
-	for (const std::string& clip : clips)
+	for (input_clip& clip : input_clips)
 	{
-		acl::compressed_tracks* raw_tracks = nullptr;
-		if (!read_clip(clip_dir, clip, s_allocator, raw_tracks))
+		if (clip.tracks == nullptr)
+			continue;	// Failed to read it
+
+		if (!clip.is_valid)
 		{
-			printf("Failed to read clip %s!\n", clip.c_str());
+			printf("Invalid clip %s!\n", clip.name.c_str());
+			release_clip(clip);
 			continue;
 		}
 
-		prepare_clip(clip, *raw_tracks, compressed_clips);
+		prepare_clip(clip.name, *clip.tracks, compressed_clips);
 
-		s_allocator.deallocate(raw_tracks, raw_tracks->get_size());
+		if (stripped_proportion > 0.0F)
+			prepare_stripped_clip(clip.name, *clip.tracks, stripped_proportion, compressed_clips);
+
+		if (benchmark_database)
+			prepare_database_clip(clip.name, *clip.tracks, database_options);
+
+		release_clip(clip);
 	}
 
-	benchmark::Initialize(&argc, argv);
+	if (sustained_options.duration_s != 0)
+	{
+		// Sustained mode replaces the regular benchmarks
+		run_sustained_benchmark(compressed_clips, sustained_options, "sustained_results.csv");
+	}
+	else
+	{
+		benchmark::Initialize(&argc, argv);
+
+		// Run benchmarks
+		benchmark::RunSpecifiedBenchmarks();
+	}
 
-	// Run benchmarks
-	benchmark::RunSpecifiedBenchmarks();
+	print_huge_page_stats();
 
 	// Clean up
 	clear_benchmark_state();
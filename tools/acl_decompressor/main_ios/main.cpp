@@ -25,6 +25,8 @@
 #include <CoreFoundation/CoreFoundation.h>
 
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <vector>
@@ -37,6 +39,26 @@
 #include <sjson/parser.h>
 
 #include <benchmark.h>
+#include <sustained_benchmark.h>
+
+#include <notify.h>
+
+// Returns the thermal pressure level (0 nominal, 10 moderate, 20 heavy, 30 trapping, 40 sleeping), -1 if unknown
+static int query_thermal_state()
+{
+	static int thermal_token = -1;
+	if (thermal_token == -1 && notify_register_check("com.apple.system.thermalpressurelevel", &thermal_token) != NOTIFY_STATUS_OK)
+	{
+		thermal_token = -1;
+		return -1;
+	}
+
+	uint64_t thermal_level = 0;
+	if (notify_get_state(thermal_token, &thermal_level) != NOTIFY_STATUS_OK)
+		return -1;
+
+	return int(thermal_level);
+}
 
 static int get_bundle_resource_path(const char* resource_filename, char* out_path, size_t path_max_size)
 {
@@ -117,22 +139,42 @@ int main(int argc, char* argv[])
 
 	const int num_failed_decompression = int(clips.size() - compressed_clips.size());
 
-	char argv_0_executable_name[64];
-	snprintf(argv_0_executable_name, sizeof(argv_0_executable_name), "iOS Bundle");
+	// Sustained mode runs for the provided number of seconds, passed as a launch argument: -sustained=600
+	sustained_benchmark_options sustained_options;
+	for (int arg_index = 1; arg_index < argc; ++arg_index)
+	{
+		static constexpr const char* k_sustained_option = "-sustained=";
+		const size_t option_length = std::strlen(k_sustained_option);
+		if (std::strncmp(argv[arg_index], k_sustained_option, option_length) == 0)
+			sustained_options.duration_s = uint32_t(std::strtoul(argv[arg_index] + option_length, nullptr, 10));
+	}
 
-	char argv_1_benchmark_out[2048];
-	snprintf(argv_1_benchmark_out, sizeof(argv_1_benchmark_out), "--benchmark_out=%s", output_filename.c_str());
+	if (sustained_options.duration_s != 0)
+	{
+		sustained_options.query_thermal_state = query_thermal_state;
 
-	char argv_2_benchmark_out_format[64];
-	snprintf(argv_2_benchmark_out_format, sizeof(argv_2_benchmark_out_format), "--benchmark_out_format=json");
+		const std::string sustained_output_filename = std::string(output_directory) + "/sustained_results.csv";
+		run_sustained_benchmark(compressed_clips, sustained_options, sustained_output_filename.c_str());
+	}
+	else
+	{
+		char argv_0_executable_name[64];
+		snprintf(argv_0_executable_name, sizeof(argv_0_executable_name), "iOS Bundle");
+
+		char argv_1_benchmark_out[2048];
+		snprintf(argv_1_benchmark_out, sizeof(argv_1_benchmark_out), "--benchmark_out=%s", output_filename.c_str());
 
-	int bench_argc = 3;
-	char* bench_argv[3] = { argv_0_executable_name, argv_1_benchmark_out, argv_2_benchmark_out_format };
+		char argv_2_benchmark_out_format[64];
+		snprintf(argv_2_benchmark_out_format, sizeof(argv_2_benchmark_out_format), "--benchmark_out_format=json");
 
-	benchmark::Initialize(&bench_argc, bench_argv);
+		int bench_argc = 3;
+		char* bench_argv[3] = { argv_0_executable_name, argv_1_benchmark_out, argv_2_benchmark_out_format };
 
-	// Run benchmarks
-	benchmark::RunSpecifiedBenchmarks();
+		benchmark::Initialize(&bench_argc, bench_argv);
+
+		// Run benchmarks
+		benchmark::RunSpecifiedBenchmarks();
+	}
 
 	// Clean up
 	clear_benchmark_state();
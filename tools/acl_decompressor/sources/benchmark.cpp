@@ -23,21 +23,29 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "benchmark.h"
+#include "hardware_counters.h"
 
 #include <acl/core/ansi_allocator.h>
 #include <acl/core/compressed_tracks.h>
+#include <acl/core/huge_page_allocator.h>
 #include <acl/core/memory_utils.h>
 #include <acl/compression/compress.h>
 #include <acl/compression/convert.h>
+#include <acl/decompression/database/database.h>
+#include <acl/decompression/database/file_database_streamer.h>
 
 #include <benchmark/benchmark.h>
 
 #include <sjson/parser.h>
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
 #include <cstring>
 #include <random>
 #include <string>
+#include <thread>
 #include <vector>
 
 //////////////////////////////////////////////////////////////////////////
@@ -73,6 +81,9 @@ static constexpr uint32_t k_num_copies = 220;
 // Align our clip copy buffer to a 2 MB boundary to reduce VMEM noise
 static constexpr uint32_t k_clip_buffer_alignment = 2 * 1024 * 1024;
 
+// The maximum number of contexts that the shared clip and working set cache modes rotate through
+static constexpr uint32_t k_num_shared_clip_contexts = 64;
+
 //////////////////////////////////////////////////////////////////////////
 
 enum class PlaybackDirection
@@ -89,6 +100,27 @@ enum class DecompressionFunction
 	Memcpy,
 };
 
+enum class CacheMode
+{
+	Cold,			// Every context has its own clip copy and the CPU cache is flushed once every context has been touched
+	Warm,			// A single context is decompressed over and over, everything remains in the CPU cache
+	SharedClip,		// A few contexts share the same clip copy at staggered sample times, nothing is flushed
+	WorkingSet,		// A few contexts each have their own clip copy, nothing is flushed and the CPU cache holds what fits
+};
+
+enum class RewindFunction
+{
+	SeekDecompressPose,		// Seek and decompress every track of one context at a time
+	SeekDecompressMasked,	// Seek and decompress the hitbox tracks of one context at a time
+	BatchDecompressMasked,	// Decompress the hitbox tracks of every context with decompress_tracks_batch, prefetching ahead
+};
+
+enum class InitializeFunction
+{
+	Initialize,				// One context at a time
+	InitializeBatch,		// Every context in a single call
+};
+
 struct benchmark_transform_decompression_settings final : public acl::default_transform_decompression_settings
 {
 	// Only support our latest version
@@ -98,12 +130,73 @@ struct benchmark_transform_decompression_settings final : public acl::default_tr
 	static constexpr bool skip_initialize_safety_checks() { return true; }
 };
 
+struct benchmark_scalar_decompression_settings final : public acl::default_scalar_decompression_settings
+{
+	static constexpr acl::compressed_tracks_version16 version_supported() { return acl::compressed_tracks_version16::latest; }
+	static constexpr bool skip_initialize_safety_checks() { return true; }
+};
+
+// Same as above but we accumulate how much compressed data is read, this is slower and never timed
+struct benchmark_stats_decompression_settings final : public acl::default_transform_decompression_settings
+{
+	static constexpr acl::compressed_tracks_version16 version_supported() { return acl::compressed_tracks_version16::latest; }
+	static constexpr bool skip_initialize_safety_checks() { return true; }
+	static constexpr bool is_stats_tracking_enabled() { return true; }
+};
+
+// The settings sweep strips one more feature at every step, from the most generic settings down to
+// what a shipping configuration that only uses the default compression settings needs
+struct sweep_generic_decompression_settings : public acl::decompression_settings
+{
+	static constexpr bool is_track_type_supported(acl::track_type8 type) { return type == acl::track_type8::qvvf; }
+	static constexpr bool skip_initialize_safety_checks() { return true; }
+};
+
+struct sweep_latest_version_decompression_settings : public sweep_generic_decompression_settings
+{
+	static constexpr acl::compressed_tracks_version16 version_supported() { return acl::compressed_tracks_version16::latest; }
+};
+
+struct sweep_variable_formats_decompression_settings : public sweep_latest_version_decompression_settings
+{
+	static constexpr bool is_rotation_format_supported(acl::rotation_format8 format) { return format == acl::rotation_format8::quatf_drop_w_variable; }
+	static constexpr bool is_translation_format_supported(acl::vector_format8 format) { return format == acl::vector_format8::vector3f_variable; }
+	static constexpr bool is_scale_format_supported(acl::vector_format8 format) { return format == acl::vector_format8::vector3f_variable; }
+};
+
+struct sweep_no_wrapping_decompression_settings : public sweep_variable_formats_decompression_settings
+{
+	static constexpr bool is_wrapping_supported() { return false; }
+	static constexpr bool is_per_track_rounding_supported() { return false; }
+};
+
+struct sweep_lerp_normalization_decompression_settings : public sweep_no_wrapping_decompression_settings
+{
+	static constexpr acl::rotation_normalization_policy_t get_rotation_normalization_policy() { return acl::rotation_normalization_policy_t::lerp_only; }
+};
+
+struct sweep_approximate_normalization_decompression_settings : public sweep_no_wrapping_decompression_settings
+{
+	static constexpr acl::rotation_normalization_policy_t get_rotation_normalization_policy() { return acl::rotation_normalization_policy_t::approximate; }
+};
+
+enum class SettingsVariant
+{
+	Generic,			// Every version, format, and feature is supported
+	LatestVersion,		// Only the latest version is supported
+	VariableFormats,	// Only the variable formats used by the default compression settings are supported
+	NoWrapping,			// Wrapping and per track rounding are stripped
+	LerpNormalization,	// Rotations are only normalized after interpolating
+	ApproximateNormalization,	// Rotations are only normalized after interpolating, with a reciprocal square root estimate
+};
+
 struct benchmark_state
 {
 	acl::compressed_tracks* compressed_tracks = nullptr;	// Original clip
 
 	acl::compressed_tracks** decompression_instances = nullptr;
 	acl::decompression_context<benchmark_transform_decompression_settings>* decompression_contexts = nullptr;
+	acl::decompression_context<benchmark_scalar_decompression_settings>* scalar_decompression_contexts = nullptr;
 	uint8_t* clip_copy_buffer = nullptr;
 	uint8_t* flush_buffer = nullptr;
 
@@ -112,16 +205,92 @@ struct benchmark_state
 };
 
 acl::ansi_allocator s_allocator;
+static acl::huge_page_allocator s_huge_page_allocator(s_allocator);
+static bool s_use_huge_pages = false;
 static benchmark_state s_benchmark_state;
 
+void set_huge_pages_enabled(bool enabled)
+{
+	s_use_huge_pages = enabled;
+}
+
+void print_huge_page_stats()
+{
+	if (!s_use_huge_pages)
+		return;
+
+	printf("Huge pages (%zu KB): %u allocations, %u fell back to regular pages\n",
+		s_huge_page_allocator.get_page_size() / 1024,
+		s_huge_page_allocator.get_num_huge_page_allocations() + s_huge_page_allocator.get_num_fallback_allocations(),
+		s_huge_page_allocator.get_num_fallback_allocations());
+}
+
+// Our clip copies and streamed bulk data span many pages, they are backed by huge pages when enabled
+static acl::iallocator& get_large_buffer_allocator()
+{
+	if (s_use_huge_pages)
+		return s_huge_page_allocator;
+
+	return s_allocator;
+}
+
+enum class DatabaseResidency
+{
+	HighestOnly,		// Nothing is streamed in, only the data within the compressed clip is used
+	MediumStreamedIn,	// The medium importance tier is streamed in
+	AllStreamedIn,		// Every tier is streamed in
+	StreamingInFlight,	// The medium importance tier streams in and out one chunk at a time while we decompress
+};
+
+struct benchmark_database_decompression_settings final : public acl::default_transform_decompression_settings
+{
+	using database_settings_type = acl::default_database_settings;
+
+	static constexpr acl::compressed_tracks_version16 version_supported() { return acl::compressed_tracks_version16::latest; }
+	static constexpr bool skip_initialize_safety_checks() { return true; }
+};
+
+struct database_benchmark_clip
+{
+	acl::compressed_tracks* compressed_tracks = nullptr;	// Bound to the database below
+	acl::compressed_database* database = nullptr;			// Split, its bulk data lives in the files below
+
+	std::string bulk_data_filenames[2];						// Medium, low
+	uint32_t bulk_data_sizes[2] = { 0, 0 };
+
+	uint32_t io_latency_us = 0;
+};
+
+static std::vector<database_benchmark_clip*> s_database_clips;
+
+static void clear_database_benchmark_state()
+{
+	for (database_benchmark_clip* clip : s_database_clips)
+	{
+		s_allocator.deallocate(clip->compressed_tracks, clip->compressed_tracks->get_size());
+		s_allocator.deallocate(clip->database, clip->database->get_size());
+
+		for (const std::string& filename : clip->bulk_data_filenames)
+			std::remove(filename.c_str());
+
+		delete clip;
+	}
+
+	s_database_clips.clear();
+}
+
+
 void clear_benchmark_state()
 {
 	acl::deallocate_type_array(s_allocator, s_benchmark_state.decompression_contexts, k_num_copies);
+	acl::deallocate_type_array(s_allocator, s_benchmark_state.scalar_decompression_contexts, k_num_copies);
 	acl::deallocate_type_array(s_allocator, s_benchmark_state.decompression_instances, k_num_copies);
-	acl::deallocate_type_array(s_allocator, s_benchmark_state.clip_copy_buffer, s_benchmark_state.clip_copy_buffer_size);
+	acl::deallocate_type_array(get_large_buffer_allocator(), s_benchmark_state.clip_copy_buffer, s_benchmark_state.clip_copy_buffer_size);
 	acl::deallocate_type_array(s_allocator, s_benchmark_state.flush_buffer, k_padded_flush_buffer_size);
 
 	s_benchmark_state = benchmark_state();
+
+	clear_database_benchmark_state();
 }
 
 static void allocate_static_buffers()
@@ -131,6 +300,7 @@ static void allocate_static_buffers()
 
 	s_benchmark_state.decompression_instances = acl::allocate_type_array<acl::compressed_tracks*>(s_allocator, k_num_copies);
 	s_benchmark_state.decompression_contexts = acl::allocate_type_array<acl::decompression_context<benchmark_transform_decompression_settings>>(s_allocator, k_num_copies);
+	s_benchmark_state.scalar_decompression_contexts = acl::allocate_type_array<acl::decompression_context<benchmark_scalar_decompression_settings>>(s_allocator, k_num_copies);
 	s_benchmark_state.flush_buffer = acl::allocate_type_array<uint8_t>(s_allocator, k_padded_flush_buffer_size);
 }
 
@@ -140,8 +310,14 @@ static void setup_benchmark_state(acl::compressed_tracks& compressed_tracks)
 
 	const uint32_t num_tracks = compressed_tracks.get_num_tracks();
 	const uint32_t compressed_size = compressed_tracks.get_size();
+	const acl::track_type8 track_type = compressed_tracks.get_track_type();
+
+	uint32_t num_bytes_per_track;
+	if (track_type == acl::track_type8::qvvf)
+		num_bytes_per_track = (4 + 3 + 3) * sizeof(float);	// Rotation, Translation, Scale
+	else
+		num_bytes_per_track = acl::get_track_num_sample_elements(track_type) * sizeof(float);
 
-	const uint32_t num_bytes_per_track = (4 + 3 + 3) * sizeof(float);	// Rotation, Translation, Scale
 	const uint32_t pose_size = num_tracks * num_bytes_per_track;
 
 	// Each clip is rounded up to a multiple of our VMEM padding
@@ -149,13 +325,12 @@ static void setup_benchmark_state(acl::compressed_tracks& compressed_tracks)
 	const uint32_t clip_buffer_size = padded_clip_size * k_num_copies;
 
 	acl::compressed_tracks** decompression_instances = s_benchmark_state.decompression_instances;
-	acl::decompression_context<benchmark_transform_decompression_settings>* decompression_contexts = s_benchmark_state.decompression_contexts;
 	uint8_t* clip_copy_buffer = s_benchmark_state.clip_copy_buffer;
 
 	if (clip_buffer_size > s_benchmark_state.clip_copy_buffer_size)
 	{
 		// Allocate our new clip copy buffer
-		clip_copy_buffer = acl::allocate_type_array_aligned<uint8_t>(s_allocator, clip_buffer_size, k_clip_buffer_alignment);
+		clip_copy_buffer = acl::allocate_type_array_aligned<uint8_t>(get_large_buffer_allocator(), clip_buffer_size, k_clip_buffer_alignment);
 
 		s_benchmark_state.clip_copy_buffer = clip_copy_buffer;
 		s_benchmark_state.clip_copy_buffer_size = clip_buffer_size;
@@ -174,7 +349,12 @@ static void setup_benchmark_state(acl::compressed_tracks& compressed_tracks)
 
 	// Create our decompression contexts
 	for (uint32_t instance_index = 0; instance_index < k_num_copies; ++instance_index)
-		decompression_contexts[instance_index].initialize(*decompression_instances[instance_index]);
+	{
+		if (track_type == acl::track_type8::qvvf)
+			s_benchmark_state.decompression_contexts[instance_index].initialize(*decompression_instances[instance_index]);
+		else
+			s_benchmark_state.scalar_decompression_contexts[instance_index].initialize(*decompression_instances[instance_index]);
+	}
 
 	s_benchmark_state.compressed_tracks = &compressed_tracks;
 	s_benchmark_state.pose_size = pose_size;
@@ -186,14 +366,40 @@ static void memset_impl(uint8_t* buffer, size_t buffer_size, uint8_t value)
 		*ptr = value;
 }
 
-static void benchmark_decompression(benchmark::State& state)
+// Decompresses every sample time once outside of the timed loop and reports how much compressed data
+// a pose reads on average. This allows us to correlate the memory bandwidth with the decompression speed.
+static void set_decompression_stats_counters(benchmark::State& state, const acl::compressed_tracks& compressed_tracks, const float* sample_times, uint32_t num_samples)
 {
-	acl::compressed_tracks& compressed_tracks = *reinterpret_cast<acl::compressed_tracks*>(state.range(0));
+	acl::decompression_context<benchmark_stats_decompression_settings> context;
+	context.initialize(compressed_tracks);
+
+	acl::acl_impl::debug_track_writer pose_writer(s_allocator, acl::track_type8::qvvf, compressed_tracks.get_num_tracks());
+
+	for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+	{
+		context.seek(sample_times[sample_index], acl::sample_rounding_policy::none);
+		context.decompress_tracks(pose_writer);
+	}
+
+	const acl::decompression_stats& stats = context.get_stats();
+	const double num_calls = double(std::max<uint64_t>(stats.num_decompress_calls, 1));
+
+	// Averaged per pose, in bytes
+	state.counters["SegmentBytes"] = benchmark::Counter(double(stats.segment_bytes_read) / num_calls);
+	state.counters["ConstantBytes"] = benchmark::Counter(double(stats.constant_bytes_read) / num_calls);
+	state.counters["DatabaseBytes"] = benchmark::Counter(double(stats.database_bytes_read) / num_calls);
+	state.counters["TotalBytes"] = benchmark::Counter(double(stats.get_total_bytes_read()) / num_calls);
+	state.counters["CacheLines"] = benchmark::Counter(double(stats.num_cache_lines_touched) / num_calls);
+}
+
+// Transform and scalar tracks use their own decompression contexts and share everything else
+template<class decompression_settings_type>
+static void benchmark_decompression_impl(benchmark::State& state, acl::decompression_context<decompression_settings_type>* decompression_contexts)
+{
+	acl::compressed_tracks& compressed_tracks = *s_benchmark_state.compressed_tracks;
 	const PlaybackDirection playback_direction = static_cast<PlaybackDirection>(state.range(1));
 	const DecompressionFunction decompression_function = static_cast<DecompressionFunction>(state.range(2));
-
-	if (s_benchmark_state.compressed_tracks != &compressed_tracks)
-		setup_benchmark_state(compressed_tracks);	// We have a new clip, setup everything
+	const CacheMode cache_mode = static_cast<CacheMode>(state.range(3));
 
 	// Use clamp policy as it is the most common
 	const float duration = compressed_tracks.get_finite_duration(acl::sample_looping_policy::non_looping);
@@ -220,12 +426,51 @@ static void benchmark_decompression(benchmark::State& state)
 	}
 
 	acl::compressed_tracks** decompression_instances = s_benchmark_state.decompression_instances;
-	acl::decompression_context<benchmark_transform_decompression_settings>* decompression_contexts = s_benchmark_state.decompression_contexts;
 	uint8_t* flush_buffer = s_benchmark_state.flush_buffer;
 	const uint32_t pose_size = s_benchmark_state.pose_size;
 
+	// Only the cold mode touches every clip copy and flushes the CPU cache
+	uint32_t num_contexts = k_num_copies;
+	bool flush_cache = true;
+	switch (cache_mode)
+	{
+	case CacheMode::Cold:
+	default:
+		break;
+	case CacheMode::Warm:
+		num_contexts = 1;
+		flush_cache = false;
+		break;
+	case CacheMode::SharedClip:
+	case CacheMode::WorkingSet:
+		num_contexts = std::min<uint32_t>(uint32_t(state.range(4)), k_num_shared_clip_contexts);
+		flush_cache = false;
+		break;
+	}
+
+	// Characters that play the same clip share its compressed data but have their own context
+	acl::decompression_context<decompression_settings_type>* shared_clip_contexts = nullptr;
+	if (cache_mode == CacheMode::SharedClip)
+	{
+		shared_clip_contexts = acl::allocate_type_array<acl::decompression_context<decompression_settings_type>>(s_allocator, num_contexts);
+
+		for (uint32_t context_index = 0; context_index < num_contexts; ++context_index)
+			shared_clip_contexts[context_index].initialize(*decompression_instances[0]);
+
+		decompression_contexts = shared_clip_contexts;
+	}
+
+	// Scalar tracks are written densely, one value per track
 	const uint32_t num_tracks = compressed_tracks.get_num_tracks();
-	acl::acl_impl::debug_track_writer pose_writer(s_allocator, acl::track_type8::qvvf, num_tracks);
+	const acl::track_type8 track_type = compressed_tracks.get_track_type();
+	acl::acl_impl::debug_track_writer pose_writer(s_allocator, track_type, num_tracks);
+
+	// When enabled, hardware counters are read around the timed region and accumulated
+	hardware_counters counters;
+	const bool use_hardware_counters = are_hardware_counters_enabled() && counters.open();
+	uint64_t counter_start_values[uint32_t(hardware_counter::count)] = { 0 };
+	uint64_t counter_end_values[uint32_t(hardware_counter::count)] = { 0 };
+	uint64_t counter_totals[uint32_t(hardware_counter::count)] = { 0 };
 
 	// Flush the CPU cache
 	memset_impl(flush_buffer + k_vmem_padding, k_flush_buffer_size, 1);
@@ -237,11 +482,16 @@ static void benchmark_decompression(benchmark::State& state)
 	{
 		(void)_;
 
+		if (use_hardware_counters)
+			counters.read(counter_start_values);
+
 		const auto start = std::chrono::high_resolution_clock::now();
 
-		const float sample_time = sample_times[current_sample_index];
+		// Contexts that share a clip play it at staggered sample times
+		const uint32_t sample_index = cache_mode == CacheMode::SharedClip ? ((current_sample_index + current_context_index) % k_num_decompression_samples) : current_sample_index;
+		const float sample_time = sample_times[sample_index];
 
-		acl::decompression_context<benchmark_transform_decompression_settings>& context = decompression_contexts[current_context_index];
+		acl::decompression_context<decompression_settings_type>& context = decompression_contexts[current_context_index];
 
 		// Interpolate as this is the most common scenario
 		context.seek(sample_time, acl::sample_rounding_policy::none);
@@ -256,18 +506,27 @@ static void benchmark_decompression(benchmark::State& state)
 				context.decompress_track(bone_index, pose_writer);
 			break;
 		case DecompressionFunction::Memcpy:
-			std::memcpy(pose_writer.tracks_typed.qvvf, decompression_instances[current_context_index], pose_size);
+			std::memcpy(pose_writer.tracks_typed.any, decompression_instances[current_context_index], pose_size);
 			break;
 		}
 
 		const auto end = std::chrono::high_resolution_clock::now();
+
+		if (use_hardware_counters)
+		{
+			counters.read(counter_end_values);
+
+			for (uint32_t counter_index = 0; counter_index < uint32_t(hardware_counter::count); ++counter_index)
+				counter_totals[counter_index] += counter_end_values[counter_index] - counter_start_values[counter_index];
+		}
+
 		const auto elapsed_seconds = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
 		state.SetIterationTime(elapsed_seconds.count());
 
 		// Move on to the next context and sample
 		// We only move on to the next sample once every context has been touched
 		current_context_index++;
-		if (current_context_index >= k_num_copies)
+		if (current_context_index >= num_contexts)
 		{
 			current_context_index = 0;
 			current_sample_index++;
@@ -276,130 +535,640 @@ static void benchmark_decompression(benchmark::State& state)
 				current_sample_index = 0;
 
 			// Flush the CPU cache
-			memset_impl(flush_buffer + k_vmem_padding, k_flush_buffer_size, flush_value++);
+			if (flush_cache)
+				memset_impl(flush_buffer + k_vmem_padding, k_flush_buffer_size, flush_value++);
 		}
 	}
 
-	state.counters["Speed"] = benchmark::Counter(s_benchmark_state.pose_size, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
-}
-
-bool parse_metadata(const char* buffer, size_t buffer_size, std::string& out_clip_dir, std::vector<std::string>& out_clips)
-{
-	sjson::Parser parser(buffer, buffer_size);
-
-	sjson::StringView clip_dir;
-	parser.try_read("clip_dir", clip_dir, "");
-	out_clip_dir = std::string(clip_dir.c_str(), clip_dir.size());
+	acl::deallocate_type_array(s_allocator, shared_clip_contexts, num_contexts);
 
-	if (!parser.array_begins("clips"))
-		return false;
+	state.counters["Speed"] = benchmark::Counter(s_benchmark_state.pose_size, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
 
-	while (!parser.try_array_ends())
+	if (use_hardware_counters)
 	{
-		sjson::StringView clip_filename;
-		if (parser.read(&clip_filename, 1))
-			out_clips.push_back(std::string(clip_filename.c_str(), clip_filename.size()));
+		// Hardware counters are averaged per decompression call
+		const double num_calls = double(state.iterations());
+		const double num_cycles = double(counter_totals[uint32_t(hardware_counter::cycles)]);
+		const double num_instructions = double(counter_totals[uint32_t(hardware_counter::instructions)]);
+
+		state.counters["Cycles"] = benchmark::Counter(num_cycles / num_calls);
+		state.counters["Instructions"] = benchmark::Counter(num_instructions / num_calls);
+		state.counters["IPC"] = benchmark::Counter(num_cycles > 0.0 ? (num_instructions / num_cycles) : 0.0);
+		state.counters["L1DMisses"] = benchmark::Counter(double(counter_totals[uint32_t(hardware_counter::l1d_read_misses)]) / num_calls);
+		state.counters["LLCMisses"] = benchmark::Counter(double(counter_totals[uint32_t(hardware_counter::llc_misses)]) / num_calls);
+		state.counters["BranchMisses"] = benchmark::Counter(double(counter_totals[uint32_t(hardware_counter::branch_misses)]) / num_calls);
 	}
 
-	if (!parser.remainder_is_comments_and_whitespace())
-		return false;
-
-	return true;
+	// Only transform decompression tracks how much compressed data is read
+	if (decompression_function == DecompressionFunction::DecompressPose && track_type == acl::track_type8::qvvf)
+		set_decompression_stats_counters(state, compressed_tracks, sample_times, k_num_decompression_samples);
 }
 
-bool read_clip(const std::string& clip_dir, const std::string& clip, acl::iallocator& allocator, acl::compressed_tracks*& out_compressed_tracks)
+static void benchmark_decompression(benchmark::State& state)
 {
-	out_compressed_tracks = nullptr;
-
-	std::string clip_filename;
-	clip_filename = clip_dir;
-
-#ifdef _WIN32
-	clip_filename += '\\';
-#else
-	clip_filename += '/';
-#endif
+	acl::compressed_tracks& compressed_tracks = *reinterpret_cast<acl::compressed_tracks*>(state.range(0));
 
-	clip_filename += clip;
+	if (s_benchmark_state.compressed_tracks != &compressed_tracks)
+		setup_benchmark_state(compressed_tracks);	// We have a new clip, setup everything
 
-	std::FILE* file = nullptr;
+	if (compressed_tracks.get_track_type() == acl::track_type8::qvvf)
+		benchmark_decompression_impl(state, s_benchmark_state.decompression_contexts);
+	else
+		benchmark_decompression_impl(state, s_benchmark_state.scalar_decompression_contexts);
+}
 
-#ifdef _WIN32
-	char path[64 * 1024] = { 0 };
-	snprintf(path, acl::get_array_size(path), "\\\\?\\%s", clip_filename.c_str());
-	fopen_s(&file, path, "rb");
+#if defined(_MSC_VER)
+	#define ACL_BENCHMARK_NOINLINE __declspec(noinline)
 #else
-	file = fopen(clip_filename.c_str(), "rb");
+	#define ACL_BENCHMARK_NOINLINE __attribute__((noinline))
 #endif
 
-	if (file == nullptr)
-		return false;
+// Each settings variant has its own out of line copy of the decompression code, its size can be
+// found with the symbol sizes of the executable (e.g. 'nm -C --size-sort acl_decompressor | grep sweep_')
+template<class decompression_settings_type>
+ACL_BENCHMARK_NOINLINE static void sweep_decompress_pose(acl::decompression_context<decompression_settings_type>& context, float sample_time, acl::acl_impl::debug_track_writer& pose_writer)
+{
+	// Interpolate as this is the most common scenario
+	context.seek(sample_time, acl::sample_rounding_policy::none);
+	context.decompress_tracks(pose_writer);
+}
 
-	// Make sure to enable buffering with a large buffer
-	const int setvbuf_result = setvbuf(file, NULL, _IOFBF, 1 * 1024 * 1024);
-	if (setvbuf_result != 0)
-		return false;
+// Same as benchmark_decompression but the decompression settings vary to measure how much
+// stripping unused features with the constexpr settings is worth
+template<class decompression_settings_type>
+static void benchmark_settings_sweep_impl(benchmark::State& state)
+{
+	acl::compressed_tracks& compressed_tracks = *s_benchmark_state.compressed_tracks;
 
-	const int fseek_result = fseek(file, 0, SEEK_END);
-	if (fseek_result != 0)
+	// Use clamp policy as it is the most common
+	const float duration = compressed_tracks.get_finite_duration(acl::sample_looping_policy::non_looping);
+
+	constexpr uint32_t k_num_decompression_samples = 100;
+	float sample_times[k_num_decompression_samples];
+	for (uint32_t sample_index = 0; sample_index < k_num_decompression_samples; ++sample_index)
 	{
-		fclose(file);
-		return false;
+		const float normalized_sample_time = float(sample_index) / float(k_num_decompression_samples - 1);
+		sample_times[sample_index] = rtm::scalar_clamp(normalized_sample_time, 0.0F, 1.0F) * duration;
 	}
 
-#ifdef _WIN32
-	const size_t file_size = static_cast<size_t>(_ftelli64(file));
-#else
-	const size_t file_size = static_cast<size_t>(ftello(file));
-#endif
+	// Our contexts are bound to the same clip copies as the other benchmarks
+	acl::decompression_context<decompression_settings_type>* contexts = acl::allocate_type_array<acl::decompression_context<decompression_settings_type>>(s_allocator, k_num_copies);
+	for (uint32_t context_index = 0; context_index < k_num_copies; ++context_index)
+		contexts[context_index].initialize(*s_benchmark_state.decompression_instances[context_index]);
 
-	if (file_size == static_cast<size_t>(-1L))
+	acl::acl_impl::debug_track_writer pose_writer(s_allocator, acl::track_type8::qvvf, compressed_tracks.get_num_tracks());
+	uint8_t* flush_buffer = s_benchmark_state.flush_buffer;
+
+	// Flush the CPU cache
+	memset_impl(flush_buffer + k_vmem_padding, k_flush_buffer_size, 1);
+
+	uint32_t current_context_index = 0;
+	uint32_t current_sample_index = 0;
+	uint8_t flush_value = 2;
+	for (auto _ : state)
 	{
-		fclose(file);
-		return false;
-	}
+		(void)_;
 
-	rewind(file);
+		const auto start = std::chrono::high_resolution_clock::now();
 
-	char* buffer = (char*)allocator.allocate(file_size);
-	const size_t result = fread(buffer, 1, file_size, file);
-	fclose(file);
+		sweep_decompress_pose(contexts[current_context_index], sample_times[current_sample_index], pose_writer);
 
-	if (result != file_size)
-	{
-		delete[] buffer;
-		return false;
+		const auto end = std::chrono::high_resolution_clock::now();
+		const auto elapsed_seconds = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+		state.SetIterationTime(elapsed_seconds.count());
+
+		// Move on to the next context and sample
+		// We only move on to the next sample once every context has been touched
+		current_context_index++;
+		if (current_context_index >= k_num_copies)
+		{
+			current_context_index = 0;
+			current_sample_index++;
+
+			if (current_sample_index >= k_num_decompression_samples)
+				current_sample_index = 0;
+
+			// Flush the CPU cache
+			memset_impl(flush_buffer + k_vmem_padding, k_flush_buffer_size, flush_value++);
+		}
 	}
 
-	out_compressed_tracks = reinterpret_cast<acl::compressed_tracks*>(buffer);
-	return true;
+	acl::deallocate_type_array(s_allocator, contexts, k_num_copies);
+
+	state.counters["Speed"] = benchmark::Counter(s_benchmark_state.pose_size, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+	state.counters["ContextSize"] = benchmark::Counter(double(sizeof(acl::decompression_context<decompression_settings_type>)));
 }
 
-bool prepare_clip(const std::string& clip_name, const acl::compressed_tracks& raw_tracks, std::vector<acl::compressed_tracks*>& out_compressed_clips)
+static void benchmark_settings_sweep(benchmark::State& state)
 {
-	printf("Preparing clip %s ...\n", clip_name.c_str());
+	acl::compressed_tracks& compressed_tracks = *reinterpret_cast<acl::compressed_tracks*>(state.range(0));
+	const SettingsVariant settings_variant = static_cast<SettingsVariant>(state.range(1));
 
-	acl::error_result result = raw_tracks.is_valid(false);
-	if (result.any())
-	{
-		printf("    Failed to validate clip!\n");
-		return false;
-	}
+	if (s_benchmark_state.compressed_tracks != &compressed_tracks)
+		setup_benchmark_state(compressed_tracks);	// We have a new clip, setup everything
 
-	// Compress our clip
-	acl::track_array track_list;
-	result = acl::convert_track_list(s_allocator, raw_tracks, track_list);
-	if (result.any())
+	switch (settings_variant)
 	{
-		printf("    Failed to convert clip!\n");
-		return false;
+	case SettingsVariant::Generic:
+	default:
+		benchmark_settings_sweep_impl<sweep_generic_decompression_settings>(state);
+		break;
+	case SettingsVariant::LatestVersion:
+		benchmark_settings_sweep_impl<sweep_latest_version_decompression_settings>(state);
+		break;
+	case SettingsVariant::VariableFormats:
+		benchmark_settings_sweep_impl<sweep_variable_formats_decompression_settings>(state);
+		break;
+	case SettingsVariant::NoWrapping:
+		benchmark_settings_sweep_impl<sweep_no_wrapping_decompression_settings>(state);
+		break;
+	case SettingsVariant::LerpNormalization:
+		benchmark_settings_sweep_impl<sweep_lerp_normalization_decompression_settings>(state);
+		break;
+	case SettingsVariant::ApproximateNormalization:
+		benchmark_settings_sweep_impl<sweep_approximate_normalization_decompression_settings>(state);
+		break;
 	}
+}
 
-	if (track_list.get_track_type() != acl::track_type8::qvvf)
-	{
-		printf("    Invalid clip track type!\n");
-		return false;
-	}
+static double compute_percentile(std::vector<double>& sorted_values, double percentile)
+{
+	if (sorted_values.empty())
+		return 0.0;
+
+	const size_t value_index = std::min<size_t>(size_t(percentile * double(sorted_values.size() - 1) + 0.5), sorted_values.size() - 1);
+	return sorted_values[value_index];
+}
+
+// Same as benchmark_decompression but every thread decompresses its own slice of the decompression contexts.
+// All threads share the LLC and the memory bandwidth which allows us to find where decompression stops scaling.
+static void benchmark_decompression_multi_threaded(benchmark::State& state)
+{
+	acl::compressed_tracks& compressed_tracks = *reinterpret_cast<acl::compressed_tracks*>(state.range(0));
+	const DecompressionFunction decompression_function = static_cast<DecompressionFunction>(state.range(1));
+
+	// Only the first thread sets up the shared state, the other threads wait on the benchmark barrier
+	// at the start of the loop below and we do not touch the shared state until then
+	if (state.thread_index() == 0 && s_benchmark_state.compressed_tracks != &compressed_tracks)
+		setup_benchmark_state(compressed_tracks);	// We have a new clip, setup everything
+
+	const uint32_t thread_index = uint32_t(state.thread_index());
+	const uint32_t num_threads = uint32_t(state.threads());
+
+	// Each thread owns a contiguous slice of the contexts and of the flush buffer
+	const uint32_t num_contexts_per_thread = std::max<uint32_t>(k_num_copies / num_threads, 1);
+	const uint32_t first_context_index = std::min<uint32_t>(thread_index * num_contexts_per_thread, k_num_copies - 1);
+	const uint32_t last_context_index = std::min<uint32_t>(first_context_index + num_contexts_per_thread, k_num_copies);
+	const uint32_t flush_slice_size = k_flush_buffer_size / num_threads;
+	const uint32_t flush_slice_offset = k_vmem_padding + (thread_index * flush_slice_size);
+
+	// Use clamp policy as it is the most common
+	const float duration = compressed_tracks.get_finite_duration(acl::sample_looping_policy::non_looping);
+
+	constexpr uint32_t k_num_decompression_samples = 100;
+	float sample_times[k_num_decompression_samples];
+	for (uint32_t sample_index = 0; sample_index < k_num_decompression_samples; ++sample_index)
+	{
+		const float normalized_sample_time = float(sample_index) / float(k_num_decompression_samples - 1);
+		sample_times[sample_index] = rtm::scalar_clamp(normalized_sample_time, 0.0F, 1.0F) * duration;
+	}
+
+	// The first thread might be setting up the shared state and allocating from the shared allocator,
+	// every thread allocates from its own allocator instead
+	acl::ansi_allocator thread_allocator;
+
+	const uint32_t num_tracks = compressed_tracks.get_num_tracks();
+	acl::acl_impl::debug_track_writer pose_writer(thread_allocator, acl::track_type8::qvvf, num_tracks);
+
+	// The shared state isn't safe to read until the benchmark loop starts, we compute the pose size ourselves
+	const uint32_t pose_size = num_tracks * uint32_t((4 + 3 + 3) * sizeof(float));	// Rotation, Translation, Scale
+
+	// Measure how much compressed data a pose reads on average outside of the timed loop, together with
+	// the pose we write, this is how many bytes an iteration touches. Decompressing every bone reads
+	// about as much as decompressing the whole pose.
+	double bytes_touched_per_iteration = 2.0 * double(pose_size);
+	if (decompression_function != DecompressionFunction::Memcpy)
+	{
+		acl::decompression_context<benchmark_stats_decompression_settings> stats_context;
+		stats_context.initialize(compressed_tracks);
+
+		for (uint32_t sample_index = 0; sample_index < k_num_decompression_samples; ++sample_index)
+		{
+			stats_context.seek(sample_times[sample_index], acl::sample_rounding_policy::none);
+			stats_context.decompress_tracks(pose_writer);
+		}
+
+		const acl::decompression_stats& stats = stats_context.get_stats();
+		const double num_calls = double(std::max<uint64_t>(stats.num_decompress_calls, 1));
+		bytes_touched_per_iteration = (double(stats.get_total_bytes_read()) / num_calls) + double(pose_size);
+	}
+
+	std::vector<double> latencies;
+	latencies.reserve(size_t(state.max_iterations));
+
+	uint32_t current_context_index = first_context_index;
+	uint32_t current_sample_index = 0;
+	uint8_t flush_value = 2;
+	for (auto _ : state)
+	{
+		(void)_;
+
+		const auto start = std::chrono::high_resolution_clock::now();
+
+		const float sample_time = sample_times[current_sample_index];
+
+		acl::decompression_context<benchmark_transform_decompression_settings>& context = s_benchmark_state.decompression_contexts[current_context_index];
+
+		// Interpolate as this is the most common scenario
+		context.seek(sample_time, acl::sample_rounding_policy::none);
+
+		switch (decompression_function)
+		{
+		case DecompressionFunction::DecompressPose:
+			context.decompress_tracks(pose_writer);
+			break;
+		case DecompressionFunction::DecompressBone:
+			for (uint32_t bone_index = 0; bone_index < num_tracks; ++bone_index)
+				context.decompress_track(bone_index, pose_writer);
+			break;
+		case DecompressionFunction::Memcpy:
+			std::memcpy(pose_writer.tracks_typed.qvvf, s_benchmark_state.decompression_instances[current_context_index], s_benchmark_state.pose_size);
+			break;
+		}
+
+		const auto end = std::chrono::high_resolution_clock::now();
+		const auto elapsed_seconds = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+		state.SetIterationTime(elapsed_seconds.count());
+		latencies.push_back(elapsed_seconds.count());
+
+		// Move on to the next context and sample
+		// We only move on to the next sample once every context in our slice has been touched
+		current_context_index++;
+		if (current_context_index >= last_context_index)
+		{
+			current_context_index = first_context_index;
+			current_sample_index++;
+
+			if (current_sample_index >= k_num_decompression_samples)
+				current_sample_index = 0;
+
+			// Flush our slice of the CPU cache, together the threads flush the whole buffer
+			memset_impl(s_benchmark_state.flush_buffer + flush_slice_offset, flush_slice_size, flush_value++);
+		}
+	}
+
+	std::sort(latencies.begin(), latencies.end());
+
+	// Rates are summed over every thread which gives us the aggregate throughput
+	state.counters["Speed"] = benchmark::Counter(s_benchmark_state.pose_size, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+	state.counters["Poses"] = benchmark::Counter(1.0, benchmark::Counter::kIsIterationInvariantRate);
+	state.counters["Bandwidth"] = benchmark::Counter(bytes_touched_per_iteration, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+
+	// Latencies are averaged over every thread, in microseconds
+	state.counters["P50"] = benchmark::Counter(compute_percentile(latencies, 0.50) * 1.0E6, benchmark::Counter::kAvgThreads);
+	state.counters["P90"] = benchmark::Counter(compute_percentile(latencies, 0.90) * 1.0E6, benchmark::Counter::kAvgThreads);
+	state.counters["P99"] = benchmark::Counter(compute_percentile(latencies, 0.99) * 1.0E6, benchmark::Counter::kAvgThreads);
+}
+
+// Server side rewind (lag compensation) samples every player at an unrelated time in the past on every tick.
+// Every context is sought at a random time and only a few hitbox bones are needed. This is the worst case
+// for seeking: every sample lands in a cold segment. Each iteration measures a full tick.
+static void benchmark_rewind_decompression(benchmark::State& state)
+{
+	acl::compressed_tracks& compressed_tracks = *reinterpret_cast<acl::compressed_tracks*>(state.range(0));
+	const RewindFunction rewind_function = static_cast<RewindFunction>(state.range(1));
+	const uint32_t hitbox_track_stride = uint32_t(state.range(2));
+
+	if (s_benchmark_state.compressed_tracks != &compressed_tracks)
+		setup_benchmark_state(compressed_tracks);	// We have a new clip, setup everything
+
+	// A tick rewinds a quarter of our contexts, the cache is flushed once every context has been touched
+	constexpr uint32_t k_num_rewind_contexts = k_num_copies / 4;
+	constexpr uint32_t k_num_rewind_ticks = 100;
+
+	// Use clamp policy as it is the most common
+	const float duration = compressed_tracks.get_finite_duration(acl::sample_looping_policy::non_looping);
+
+	// Every context of every tick has its own random sample time, generated ahead of time with a fixed seed
+	std::default_random_engine random_engine(0);
+	std::uniform_real_distribution<float> sample_time_distribution(0.0F, duration);
+
+	std::vector<float> sample_times(k_num_rewind_ticks * k_num_rewind_contexts);
+	for (float& sample_time : sample_times)
+		sample_time = sample_time_distribution(random_engine);
+
+	// Hitbox bones are sparse within the skeleton, we approximate them by keeping one track out of every N
+	const uint32_t num_tracks = compressed_tracks.get_num_tracks();
+	const acl::bitset_description hitbox_mask_desc = acl::bitset_description::make_from_num_bits(num_tracks);
+	std::vector<uint32_t> hitbox_mask(hitbox_mask_desc.get_size());
+	acl::bitset_reset(hitbox_mask.data(), hitbox_mask_desc, false);
+
+	for (uint32_t track_index = 0; track_index < num_tracks; track_index += hitbox_track_stride)
+		acl::bitset_set(hitbox_mask.data(), hitbox_mask_desc, track_index, true);
+
+	acl::acl_impl::debug_track_writer pose_writer(s_allocator, acl::track_type8::qvvf, num_tracks);
+
+	// Every context writes into the same pose, the server only reads it back to test its hitboxes
+	acl::decompression_context<benchmark_transform_decompression_settings>* contexts[k_num_rewind_contexts];
+	acl::acl_impl::debug_track_writer* writers[k_num_rewind_contexts];
+	for (uint32_t rewind_index = 0; rewind_index < k_num_rewind_contexts; ++rewind_index)
+		writers[rewind_index] = &pose_writer;
+
+	uint8_t* flush_buffer = s_benchmark_state.flush_buffer;
+
+	// Flush the CPU cache
+	memset_impl(flush_buffer + k_vmem_padding, k_flush_buffer_size, 1);
+
+	uint32_t first_context_index = 0;
+	uint32_t current_tick_index = 0;
+	uint8_t flush_value = 2;
+	for (auto _ : state)
+	{
+		(void)_;
+
+		for (uint32_t rewind_index = 0; rewind_index < k_num_rewind_contexts; ++rewind_index)
+			contexts[rewind_index] = &s_benchmark_state.decompression_contexts[first_context_index + rewind_index];
+
+		const float* tick_sample_times = sample_times.data() + (current_tick_index * k_num_rewind_contexts);
+
+		const auto start = std::chrono::high_resolution_clock::now();
+
+		switch (rewind_function)
+		{
+		case RewindFunction::SeekDecompressPose:
+		default:
+			for (uint32_t rewind_index = 0; rewind_index < k_num_rewind_contexts; ++rewind_index)
+			{
+				contexts[rewind_index]->seek(tick_sample_times[rewind_index], acl::sample_rounding_policy::none);
+				contexts[rewind_index]->decompress_tracks(pose_writer);
+			}
+			break;
+		case RewindFunction::SeekDecompressMasked:
+			for (uint32_t rewind_index = 0; rewind_index < k_num_rewind_contexts; ++rewind_index)
+			{
+				contexts[rewind_index]->seek(tick_sample_times[rewind_index], acl::sample_rounding_policy::none);
+				contexts[rewind_index]->decompress_tracks(hitbox_mask_desc, hitbox_mask.data(), pose_writer);
+			}
+			break;
+		case RewindFunction::BatchDecompressMasked:
+			acl::decompress_tracks_batch(contexts, tick_sample_times, acl::sample_rounding_policy::none, hitbox_mask_desc, hitbox_mask.data(), writers, k_num_rewind_contexts);
+			break;
+		}
+
+		const auto end = std::chrono::high_resolution_clock::now();
+		const auto elapsed_seconds = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+		state.SetIterationTime(elapsed_seconds.count());
+
+		// Move on to the next contexts and tick
+		current_tick_index++;
+		if (current_tick_index >= k_num_rewind_ticks)
+			current_tick_index = 0;
+
+		first_context_index += k_num_rewind_contexts;
+		if (first_context_index + k_num_rewind_contexts > k_num_copies)
+		{
+			first_context_index = 0;
+
+			// Flush the CPU cache
+			memset_impl(flush_buffer + k_vmem_padding, k_flush_buffer_size, flush_value++);
+		}
+	}
+
+	// The number of contexts rewound per second
+	state.counters["Contexts"] = benchmark::Counter(double(k_num_rewind_contexts), benchmark::Counter::kIsIterationInvariantRate);
+	state.counters["HitboxTracks"] = benchmark::Counter(double(acl::bitset_count_set_bits(hitbox_mask.data(), hitbox_mask_desc)));
+}
+
+// Level loads and crowd spawns initialize many contexts in a burst, the time it takes delays the first pose.
+// Each iteration initializes every context with the compressed tracks cold in the CPU cache. Contexts either
+// each have their own copy of the clip or they all share the same copy (e.g. a crowd playing the same clip).
+static void benchmark_initialization(benchmark::State& state)
+{
+	acl::compressed_tracks& compressed_tracks = *reinterpret_cast<acl::compressed_tracks*>(state.range(0));
+	const InitializeFunction initialize_function = static_cast<InitializeFunction>(state.range(1));
+	const bool is_shared_clip = state.range(2) != 0;
+
+	if (s_benchmark_state.compressed_tracks != &compressed_tracks)
+		setup_benchmark_state(compressed_tracks);	// We have a new clip, setup everything
+
+	// We use our own contexts to leave the ones from our benchmark state bound to their copy
+	using context_type = acl::decompression_context<benchmark_transform_decompression_settings>;
+	context_type* contexts = acl::allocate_type_array<context_type>(s_allocator, k_num_copies);
+
+	context_type* context_ptrs[k_num_copies];
+	const acl::compressed_tracks* tracks_list[k_num_copies];
+	for (uint32_t context_index = 0; context_index < k_num_copies; ++context_index)
+	{
+		context_ptrs[context_index] = &contexts[context_index];
+		tracks_list[context_index] = s_benchmark_state.decompression_instances[is_shared_clip ? 0 : context_index];
+	}
+
+	uint8_t* flush_buffer = s_benchmark_state.flush_buffer;
+	uint8_t flush_value = 1;
+	for (auto _ : state)
+	{
+		(void)_;
+
+		// Flush the CPU cache
+		memset_impl(flush_buffer + k_vmem_padding, k_flush_buffer_size, flush_value++);
+
+		for (uint32_t context_index = 0; context_index < k_num_copies; ++context_index)
+			contexts[context_index].reset();
+
+		const auto start = std::chrono::high_resolution_clock::now();
+
+		switch (initialize_function)
+		{
+		case InitializeFunction::Initialize:
+		default:
+			for (uint32_t context_index = 0; context_index < k_num_copies; ++context_index)
+				contexts[context_index].initialize(*tracks_list[context_index]);
+			break;
+		case InitializeFunction::InitializeBatch:
+			acl::initialize_batch(context_ptrs, tracks_list, k_num_copies);
+			break;
+		}
+
+		const auto end = std::chrono::high_resolution_clock::now();
+		const auto elapsed_seconds = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+		state.SetIterationTime(elapsed_seconds.count());
+	}
+
+	acl::deallocate_type_array(s_allocator, contexts, k_num_copies);
+
+	// The number of contexts initialized per second
+	state.counters["Contexts"] = benchmark::Counter(double(k_num_copies), benchmark::Counter::kIsIterationInvariantRate);
+}
+
+bool parse_metadata(const char* buffer, size_t buffer_size, std::string& out_clip_dir, std::vector<std::string>& out_clips)
+{
+	sjson::Parser parser(buffer, buffer_size);
+
+	sjson::StringView clip_dir;
+	parser.try_read("clip_dir", clip_dir, "");
+	out_clip_dir = std::string(clip_dir.c_str(), clip_dir.size());
+
+	if (!parser.array_begins("clips"))
+		return false;
+
+	while (!parser.try_array_ends())
+	{
+		sjson::StringView clip_filename;
+		if (parser.read(&clip_filename, 1))
+			out_clips.push_back(std::string(clip_filename.c_str(), clip_filename.size()));
+	}
+
+	if (!parser.remainder_is_comments_and_whitespace())
+		return false;
+
+	return true;
+}
+
+bool read_clip(const std::string& clip_dir, const std::string& clip, input_clip& out_clip)
+{
+	out_clip.name = clip;
+	out_clip.tracks = nullptr;
+	out_clip.size = 0;
+	out_clip.is_valid = false;
+
+	std::string clip_filename;
+	clip_filename = clip_dir;
+
+#ifdef _WIN32
+	clip_filename += '\\';
+#else
+	clip_filename += '/';
+#endif
+
+	clip_filename += clip;
+
+#if defined(ACL_IMPL_HAS_MAPPED_FILE)
+	// The clip is used in place, its pages are read as they are first touched
+#ifdef _WIN32
+	char path[64 * 1024] = { 0 };
+	snprintf(path, acl::get_array_size(path), "\\\\?\\%s", clip_filename.c_str());
+#else
+	const char* path = clip_filename.c_str();
+#endif
+
+	if (out_clip.file.open(path).any())
+		return false;
+
+	out_clip.tracks = static_cast<const acl::compressed_tracks*>(out_clip.file.get_data());
+	out_clip.size = out_clip.file.get_size();
+	return true;
+#else
+	std::FILE* file = fopen(clip_filename.c_str(), "rb");
+	if (file == nullptr)
+		return false;
+
+	// Make sure to enable buffering with a large buffer
+	const int setvbuf_result = setvbuf(file, NULL, _IOFBF, 1 * 1024 * 1024);
+	if (setvbuf_result != 0)
+	{
+		fclose(file);
+		return false;
+	}
+
+	const int fseek_result = fseek(file, 0, SEEK_END);
+	if (fseek_result != 0)
+	{
+		fclose(file);
+		return false;
+	}
+
+	const size_t file_size = static_cast<size_t>(ftello(file));
+	if (file_size == static_cast<size_t>(-1L))
+	{
+		fclose(file);
+		return false;
+	}
+
+	rewind(file);
+
+	char* buffer = acl::allocate_type_array_aligned<char>(s_allocator, file_size, 64);
+	const size_t result = fread(buffer, 1, file_size, file);
+	fclose(file);
+
+	if (result != file_size)
+	{
+		acl::deallocate_type_array(s_allocator, buffer, file_size);
+		return false;
+	}
+
+	out_clip.tracks = reinterpret_cast<const acl::compressed_tracks*>(buffer);
+	out_clip.size = file_size;
+	return true;
+#endif
+}
+
+void release_clip(input_clip& clip)
+{
+#if defined(ACL_IMPL_HAS_MAPPED_FILE)
+	clip.file.close();
+#else
+	if (clip.tracks != nullptr)
+		acl::deallocate_type_array(s_allocator, reinterpret_cast<char*>(const_cast<acl::compressed_tracks*>(clip.tracks)), clip.size);
+#endif
+
+	clip.tracks = nullptr;
+	clip.size = 0;
+	clip.is_valid = false;
+}
+
+void validate_clips(std::vector<input_clip>& clips)
+{
+	// Validating a clip hashes all of it, with large data sets it dominates the startup
+	// Every thread validates the next clip that remains until they all are
+	std::atomic<size_t> next_clip_index(0);
+
+	const auto validate_job = [&clips, &next_clip_index]()
+	{
+		for (size_t clip_index = next_clip_index++; clip_index < clips.size(); clip_index = next_clip_index++)
+		{
+			input_clip& clip = clips[clip_index];
+
+			// Make sure the clip fits within the file before we read it
+			clip.is_valid = clip.tracks != nullptr
+				&& clip.size >= sizeof(acl::compressed_tracks)
+				&& clip.tracks->get_size() == clip.size
+				&& clip.tracks->is_valid(true).empty();
+		}
+	};
+
+	const size_t num_threads = std::min<size_t>(std::max<size_t>(std::thread::hardware_concurrency(), 1), clips.size());
+
+	std::vector<std::thread> threads;
+	for (size_t thread_index = 1; thread_index < num_threads; ++thread_index)
+		threads.emplace_back(validate_job);
+
+	validate_job();
+
+	for (std::thread& thread : threads)
+		thread.join();
+}
+
+bool prepare_clip(const std::string& clip_name, const acl::compressed_tracks& raw_tracks, std::vector<acl::compressed_tracks*>& out_compressed_clips)
+{
+	printf("Preparing clip %s ...\n", clip_name.c_str());
+
+	acl::error_result result = raw_tracks.is_valid(false);
+	if (result.any())
+	{
+		printf("    Failed to validate clip!\n");
+		return false;
+	}
+
+	// Compress our clip
+	acl::track_array track_list;
+	result = acl::convert_track_list(s_allocator, raw_tracks, track_list);
+	if (result.any())
+	{
+		printf("    Failed to convert clip!\n");
+		return false;
+	}
+
+	const bool is_transform_clip = track_list.get_track_type() == acl::track_type8::qvvf;
 
 	acl::compression_settings settings = acl::get_default_compression_settings();
 
@@ -425,19 +1194,35 @@ bool prepare_clip(const std::string& clip_name, const acl::compressed_tracks& ra
 	// Dynamically register our benchmark
 	benchmark::internal::Benchmark* bench = benchmark::internal::RegisterBenchmarkInternal(new benchmark::internal::FunctionBenchmark(clip_name.c_str(), benchmark_decompression));
 
-	bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Forward, (int64_t)DecompressionFunction::DecompressPose });
-	bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Forward, (int64_t)DecompressionFunction::DecompressBone });
+	bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Forward, (int64_t)DecompressionFunction::DecompressPose, (int64_t)CacheMode::Cold, 0 });
+	bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Forward, (int64_t)DecompressionFunction::DecompressBone, (int64_t)CacheMode::Cold, 0 });
+
+	// The cold mode is the worst case, in production neighboring characters often play the same clip or
+	// the working set is small enough that some of it remains in the CPU cache from frame to frame
+	bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Forward, (int64_t)DecompressionFunction::DecompressPose, (int64_t)CacheMode::Warm, 1 });
+	bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Forward, (int64_t)DecompressionFunction::DecompressPose, (int64_t)CacheMode::SharedClip, 16 });
+	bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Forward, (int64_t)DecompressionFunction::DecompressPose, (int64_t)CacheMode::WorkingSet, 16 });
+	bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Forward, (int64_t)DecompressionFunction::DecompressPose, (int64_t)CacheMode::WorkingSet, 64 });
+
+	if (!is_transform_clip)
+	{
+		// Scalar tracks are cheap to decompress, we measure every playback direction
+		bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Backward, (int64_t)DecompressionFunction::DecompressPose, (int64_t)CacheMode::Cold, 0 });
+		bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Backward, (int64_t)DecompressionFunction::DecompressBone, (int64_t)CacheMode::Cold, 0 });
+		bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Random, (int64_t)DecompressionFunction::DecompressPose, (int64_t)CacheMode::Cold, 0 });
+		bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Random, (int64_t)DecompressionFunction::DecompressBone, (int64_t)CacheMode::Cold, 0 });
+	}
 
 	// These are for debugging purposes and aren't measured as often
 	// By design, ACL's performance should be consistent regardless of the playback direction
-	//bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Forward, (int64_t)DecompressionFunction::Memcpy });
-	//bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Backward, (int64_t)DecompressionFunction::DecompressPose });
-	//bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Backward, (int64_t)DecompressionFunction::DecompressBone });
-	//bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Random, (int64_t)DecompressionFunction::DecompressPose });
-	//bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Random, (int64_t)DecompressionFunction::DecompressBone });
+	//bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Forward, (int64_t)DecompressionFunction::Memcpy, (int64_t)CacheMode::Cold, 0 });
+	//bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Backward, (int64_t)DecompressionFunction::DecompressPose, (int64_t)CacheMode::Cold, 0 });
+	//bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Backward, (int64_t)DecompressionFunction::DecompressBone, (int64_t)CacheMode::Cold, 0 });
+	//bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Random, (int64_t)DecompressionFunction::DecompressPose, (int64_t)CacheMode::Cold, 0 });
+	//bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Random, (int64_t)DecompressionFunction::DecompressBone, (int64_t)CacheMode::Cold, 0 });
 
 	// Name our arguments
-	bench->ArgNames({ "", "Dir", "Func" });
+	bench->ArgNames({ "", "Dir", "Func", "Cache", "Contexts" });
 
 	// Sometimes the numbers are slightly different from run to run, we'll run a few times
 	bench->Repetitions(3);
@@ -452,6 +1237,427 @@ bool prepare_clip(const std::string& clip_name, const acl::compressed_tracks& ra
 	bench->ComputeStatistics("min", [](const std::vector<double>& v) { return *std::min_element(std::begin(v), std::end(v)); });
 	bench->ComputeStatistics("max", [](const std::vector<double>& v) { return *std::max_element(std::begin(v), std::end(v)); });
 
+	if (!is_transform_clip)
+	{
+		out_compressed_clips.push_back(compressed_tracks);
+		return true;
+	}
+
+	// Register our multi-threaded variant, every power of two up to the number of hardware threads
+	const std::string mt_bench_name = clip_name + "_mt";
+	benchmark::internal::Benchmark* mt_bench = benchmark::internal::RegisterBenchmarkInternal(new benchmark::internal::FunctionBenchmark(mt_bench_name.c_str(), benchmark_decompression_multi_threaded));
+
+	mt_bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)DecompressionFunction::DecompressPose });
+	mt_bench->ArgNames({ "", "Func" });
+	mt_bench->ThreadRange(1, std::max<int>(int(std::thread::hardware_concurrency()), 1));
+	mt_bench->Repetitions(3);
+	mt_bench->Iterations(10000);
+	mt_bench->UseManualTime();
+
+	// Register our settings sweep, one variant per step of stripping
+	const std::string settings_bench_name = clip_name + "_settings";
+	benchmark::internal::Benchmark* settings_bench = benchmark::internal::RegisterBenchmarkInternal(new benchmark::internal::FunctionBenchmark(settings_bench_name.c_str(), benchmark_settings_sweep));
+
+	settings_bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)SettingsVariant::Generic });
+	settings_bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)SettingsVariant::LatestVersion });
+	settings_bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)SettingsVariant::VariableFormats });
+	settings_bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)SettingsVariant::NoWrapping });
+	settings_bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)SettingsVariant::LerpNormalization });
+	settings_bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)SettingsVariant::ApproximateNormalization });
+	settings_bench->ArgNames({ "", "Settings" });
+	settings_bench->Repetitions(3);
+	settings_bench->Iterations(10000);
+	settings_bench->UseManualTime();
+
+	// Register our rewind variant, random sample times across many contexts with only the hitbox tracks
+	const std::string rewind_bench_name = clip_name + "_rewind";
+	benchmark::internal::Benchmark* rewind_bench = benchmark::internal::RegisterBenchmarkInternal(new benchmark::internal::FunctionBenchmark(rewind_bench_name.c_str(), benchmark_rewind_decompression));
+
+	rewind_bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)RewindFunction::SeekDecompressPose, 1 });
+	rewind_bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)RewindFunction::SeekDecompressMasked, 4 });
+	rewind_bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)RewindFunction::BatchDecompressMasked, 4 });
+	rewind_bench->ArgNames({ "", "Func", "Stride" });
+	rewind_bench->Repetitions(3);
+	rewind_bench->Iterations(1000);
+	rewind_bench->UseManualTime();
+
+	// Register our initialization variant, every context is initialized in a burst like when a crowd spawns
+	const std::string init_bench_name = clip_name + "_init";
+	benchmark::internal::Benchmark* init_bench = benchmark::internal::RegisterBenchmarkInternal(new benchmark::internal::FunctionBenchmark(init_bench_name.c_str(), benchmark_initialization));
+
+	init_bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)InitializeFunction::Initialize, 0 });
+	init_bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)InitializeFunction::InitializeBatch, 0 });
+	init_bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)InitializeFunction::Initialize, 1 });
+	init_bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)InitializeFunction::InitializeBatch, 1 });
+	init_bench->ArgNames({ "", "Func", "Shared" });
+	init_bench->Repetitions(3);
+	init_bench->Iterations(1000);
+	init_bench->UseManualTime();
+
+	out_compressed_clips.push_back(compressed_tracks);
+	return true;
+}
+
+bool prepare_stripped_clip(const std::string& clip_name, const acl::compressed_tracks& raw_tracks, float proportion, std::vector<acl::compressed_tracks*>& out_compressed_clips)
+{
+	printf("Preparing stripped clip %s ...\n", clip_name.c_str());
+
+	acl::track_array track_list;
+	acl::error_result result = acl::convert_track_list(s_allocator, raw_tracks, track_list);
+	if (result.any())
+	{
+		printf("    Failed to convert clip!\n");
+		return false;
+	}
+
+	if (track_list.get_track_type() != acl::track_type8::qvvf)
+	{
+		printf("    Only transform clips support keyframe stripping, skipping\n");
+		return false;
+	}
+
+	acl::compression_settings settings = acl::get_default_compression_settings();
+	settings.keyframe_stripping.enable_stripping = true;
+	settings.keyframe_stripping.proportion = proportion;
+
+	acl::qvvf_transform_error_metric error_metric;
+	settings.error_metric = &error_metric;
+
+	acl::output_stats stats;
+
+	acl::compressed_tracks* compressed_tracks = nullptr;
+	result = acl::compress_track_list(s_allocator, track_list, settings, compressed_tracks, stats);
+	if (result.any())
+	{
+		printf("    Failed to compress clip!\n");
+		return false;
+	}
+
+	if (compressed_tracks->is_valid(false).any())
+	{
+		printf("    Invalid compressed clip!\n");
+		return false;
+	}
+
+	// Seeking maps our sample times onto the retained keyframes, compare against the regular clip to see what it costs
+	const std::string bench_name = clip_name + "_stripped";
+	benchmark::internal::Benchmark* bench = benchmark::internal::RegisterBenchmarkInternal(new benchmark::internal::FunctionBenchmark(bench_name.c_str(), benchmark_decompression));
+
+	bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Forward, (int64_t)DecompressionFunction::DecompressPose, (int64_t)CacheMode::Cold, 0 });
+	bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Forward, (int64_t)DecompressionFunction::DecompressBone, (int64_t)CacheMode::Cold, 0 });
+	bench->Args({ reinterpret_cast<int64_t>(compressed_tracks), (int64_t)PlaybackDirection::Forward, (int64_t)DecompressionFunction::DecompressPose, (int64_t)CacheMode::Warm, 1 });
+	bench->ArgNames({ "", "Dir", "Func", "Cache", "Contexts" });
+	bench->Repetitions(3);
+	bench->Iterations(10000);
+	bench->UseManualTime();
+	bench->ComputeStatistics("min", [](const std::vector<double>& v) { return *std::min_element(std::begin(v), std::end(v)); });
+	bench->ComputeStatistics("max", [](const std::vector<double>& v) { return *std::max_element(std::begin(v), std::end(v)); });
+
 	out_compressed_clips.push_back(compressed_tracks);
 	return true;
 }
+
+static bool write_bulk_data(const std::string& filename, const uint8_t* bulk_data, uint32_t bulk_data_size)
+{
+	std::FILE* file = nullptr;
+
+#ifdef _WIN32
+	fopen_s(&file, filename.c_str(), "wb");
+#else
+	file = fopen(filename.c_str(), "wb");
+#endif
+
+	if (file == nullptr)
+		return false;
+
+	const size_t result = bulk_data_size != 0 ? fwrite(bulk_data, 1, bulk_data_size, file) : 0;
+	fclose(file);
+
+	return result == bulk_data_size;
+}
+
+// Streaming requests complete asynchronously, we wait for them from the benchmark thread
+static void wait_for_streaming(acl::database_context<acl::default_database_settings>& database_context, acl::quality_tier tier)
+{
+	while (database_context.is_streaming(tier))
+		std::this_thread::yield();
+}
+
+static void stream_in_tier(acl::database_context<acl::default_database_settings>& database_context, acl::quality_tier tier)
+{
+	while (true)
+	{
+		const acl::database_stream_request_result result = database_context.stream_in(tier);
+		if (result != acl::database_stream_request_result::dispatched && result != acl::database_stream_request_result::streaming_in_progress)
+			break;
+
+		wait_for_streaming(database_context, tier);
+	}
+}
+
+static void benchmark_database_decompression(benchmark::State& state)
+{
+	const database_benchmark_clip& clip = *reinterpret_cast<const database_benchmark_clip*>(state.range(0));
+	const DatabaseResidency residency = static_cast<DatabaseResidency>(state.range(1));
+
+	const uint32_t max_chunk_size = clip.database->get_max_chunk_size();
+	acl::file_database_streamer medium_streamer(get_large_buffer_allocator(), clip.bulk_data_filenames[0].c_str(), clip.bulk_data_sizes[0], max_chunk_size, clip.io_latency_us);
+	acl::file_database_streamer low_streamer(get_large_buffer_allocator(), clip.bulk_data_filenames[1].c_str(), clip.bulk_data_sizes[1], max_chunk_size, clip.io_latency_us);
+
+	acl::database_context<acl::default_database_settings> database_context;
+	if (!database_context.initialize(s_allocator, *clip.database, medium_streamer, low_streamer))
+	{
+		state.SkipWithError("Failed to initialize the database context");
+		return;
+	}
+
+	switch (residency)
+	{
+	case DatabaseResidency::HighestOnly:
+	case DatabaseResidency::StreamingInFlight:
+	default:
+		break;
+	case DatabaseResidency::MediumStreamedIn:
+		stream_in_tier(database_context, acl::quality_tier::medium_importance);
+		break;
+	case DatabaseResidency::AllStreamedIn:
+		stream_in_tier(database_context, acl::quality_tier::medium_importance);
+		stream_in_tier(database_context, acl::quality_tier::lowest_importance);
+		break;
+	}
+
+	acl::decompression_context<benchmark_database_decompression_settings> context;
+	context.initialize(*clip.compressed_tracks, database_context);
+
+	// Use clamp policy as it is the most common
+	const float duration = clip.compressed_tracks->get_finite_duration(acl::sample_looping_policy::non_looping);
+
+	constexpr uint32_t k_num_decompression_samples = 100;
+	float sample_times[k_num_decompression_samples];
+	for (uint32_t sample_index = 0; sample_index < k_num_decompression_samples; ++sample_index)
+	{
+		const float normalized_sample_time = float(sample_index) / float(k_num_decompression_samples - 1);
+		sample_times[sample_index] = rtm::scalar_clamp(normalized_sample_time, 0.0F, 1.0F) * duration;
+	}
+
+	const uint32_t num_tracks = clip.compressed_tracks->get_num_tracks();
+	acl::acl_impl::debug_track_writer pose_writer(s_allocator, acl::track_type8::qvvf, num_tracks);
+
+	std::vector<double> latencies;
+	latencies.reserve(size_t(state.max_iterations));
+
+	// Streaming costs, in seconds
+	double stream_in_dispatch_time = 0.0;
+	double stream_in_completion_time = 0.0;
+	double stream_out_time = 0.0;
+	uint32_t num_stream_in_requests = 0;
+	uint32_t num_stream_in_completions = 0;
+	uint32_t num_stream_out_requests = 0;
+
+	bool is_request_in_flight = false;
+	std::chrono::time_point<std::chrono::high_resolution_clock> dispatch_start;
+
+	uint32_t current_sample_index = 0;
+	for (auto _ : state)
+	{
+		(void)_;
+
+		if (residency == DatabaseResidency::StreamingInFlight)
+		{
+			// Streaming requests are issued from the decompression thread between poses, like a game would
+			const acl::quality_tier tier = acl::quality_tier::medium_importance;
+
+			if (is_request_in_flight && !database_context.is_streaming(tier))
+			{
+				// Completion is observed at the granularity of our poses
+				const auto end = std::chrono::high_resolution_clock::now();
+				stream_in_completion_time += std::chrono::duration_cast<std::chrono::duration<double>>(end - dispatch_start).count();
+				num_stream_in_completions++;
+				is_request_in_flight = false;
+			}
+
+			if (!is_request_in_flight)
+			{
+				if (database_context.is_streamed_in(tier))
+				{
+					// Everything streamed in, stream it out and start over
+					const auto start = std::chrono::high_resolution_clock::now();
+					database_context.stream_out(tier);
+					const auto end = std::chrono::high_resolution_clock::now();
+					stream_out_time += std::chrono::duration_cast<std::chrono::duration<double>>(end - start).count();
+					num_stream_out_requests++;
+
+					wait_for_streaming(database_context, tier);
+				}
+
+				dispatch_start = std::chrono::high_resolution_clock::now();
+				const acl::database_stream_request_result result = database_context.stream_in(tier, 1);
+				const auto end = std::chrono::high_resolution_clock::now();
+
+				if (result == acl::database_stream_request_result::dispatched)
+				{
+					stream_in_dispatch_time += std::chrono::duration_cast<std::chrono::duration<double>>(end - dispatch_start).count();
+					num_stream_in_requests++;
+					is_request_in_flight = true;
+				}
+			}
+		}
+
+		const auto start = std::chrono::high_resolution_clock::now();
+
+		// Interpolate as this is the most common scenario
+		context.seek(sample_times[current_sample_index], acl::sample_rounding_policy::none);
+		context.decompress_tracks(pose_writer);
+
+		const auto end = std::chrono::high_resolution_clock::now();
+		const auto elapsed_seconds = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+		state.SetIterationTime(elapsed_seconds.count());
+		latencies.push_back(elapsed_seconds.count());
+
+		current_sample_index++;
+		if (current_sample_index >= k_num_decompression_samples)
+			current_sample_index = 0;
+	}
+
+	// Requests still in flight must complete before our streamers are destroyed
+	wait_for_streaming(database_context, acl::quality_tier::medium_importance);
+	wait_for_streaming(database_context, acl::quality_tier::lowest_importance);
+
+	std::sort(latencies.begin(), latencies.end());
+
+	state.counters["Speed"] = benchmark::Counter(double(num_tracks * ((4 + 3 + 3) * sizeof(float))), benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1024);
+
+	// Decompression latencies, in microseconds
+	state.counters["P50"] = benchmark::Counter(compute_percentile(latencies, 0.50) * 1.0E6);
+	state.counters["P90"] = benchmark::Counter(compute_percentile(latencies, 0.90) * 1.0E6);
+	state.counters["P99"] = benchmark::Counter(compute_percentile(latencies, 0.99) * 1.0E6);
+	state.counters["Max"] = benchmark::Counter((latencies.empty() ? 0.0 : latencies.back()) * 1.0E6);
+
+	if (residency == DatabaseResidency::StreamingInFlight)
+	{
+		// Average streaming costs, in microseconds
+		// The completion overhead is the time it takes to observe a completed request beyond the IO latency
+		const double avg_completion_time = num_stream_in_completions != 0 ? (stream_in_completion_time / double(num_stream_in_completions)) : 0.0;
+		const double io_latency = double(clip.io_latency_us) * 1.0E-6;
+
+		state.counters["InDispatch"] = benchmark::Counter(num_stream_in_requests != 0 ? (stream_in_dispatch_time / double(num_stream_in_requests)) * 1.0E6 : 0.0);
+		state.counters["InComplete"] = benchmark::Counter(avg_completion_time * 1.0E6);
+		state.counters["InOverhead"] = benchmark::Counter(num_stream_in_completions != 0 ? std::max(avg_completion_time - io_latency, 0.0) * 1.0E6 : 0.0);
+		state.counters["OutTime"] = benchmark::Counter(num_stream_out_requests != 0 ? (stream_out_time / double(num_stream_out_requests)) * 1.0E6 : 0.0);
+		state.counters["Requests"] = benchmark::Counter(double(num_stream_in_requests));
+	}
+}
+
+bool prepare_database_clip(const std::string& clip_name, const acl::compressed_tracks& raw_tracks, const database_benchmark_options& options)
+{
+	printf("Preparing database clip %s ...\n", clip_name.c_str());
+
+	acl::track_array track_list;
+	acl::error_result result = acl::convert_track_list(s_allocator, raw_tracks, track_list);
+	if (result.any())
+	{
+		printf("    Failed to convert clip!\n");
+		return false;
+	}
+
+	if (track_list.get_track_type() != acl::track_type8::qvvf)
+	{
+		printf("    Only transform clips support database streaming, skipping\n");
+		return false;
+	}
+
+	acl::compression_settings settings = acl::get_default_compression_settings();
+	settings.enable_database_support = true;
+
+	acl::qvvf_transform_error_metric error_metric;
+	settings.error_metric = &error_metric;
+
+	acl::output_stats stats;
+
+	acl::compressed_tracks* compressed_tracks = nullptr;
+	result = acl::compress_track_list(s_allocator, track_list, settings, compressed_tracks, stats);
+	if (result.any())
+	{
+		printf("    Failed to compress clip!\n");
+		return false;
+	}
+
+	acl::compression_database_settings database_settings;
+	if (options.max_chunk_size != 0)
+		database_settings.max_chunk_size = options.max_chunk_size;
+
+	acl::compressed_tracks* database_tracks[1] = { nullptr };
+	acl::compressed_database* database = nullptr;
+	result = acl::build_database(s_allocator, database_settings, &compressed_tracks, 1, database_tracks, database);
+	s_allocator.deallocate(compressed_tracks, compressed_tracks->get_size());
+
+	if (result.any())
+	{
+		printf("    Failed to build database: %s\n", result.c_str());
+		return false;
+	}
+
+	acl::compressed_database* split_database = nullptr;
+	uint8_t* bulk_data_medium = nullptr;
+	uint8_t* bulk_data_low = nullptr;
+	result = acl::split_database_bulk_data(s_allocator, *database, split_database, bulk_data_medium, bulk_data_low);
+	s_allocator.deallocate(database, database->get_size());
+
+	if (result.any())
+	{
+		s_allocator.deallocate(database_tracks[0], database_tracks[0]->get_size());
+		printf("    Failed to split database: %s\n", result.c_str());
+		return false;
+	}
+
+	database_benchmark_clip* clip = new database_benchmark_clip();
+	clip->compressed_tracks = database_tracks[0];
+	clip->database = split_database;
+	clip->bulk_data_sizes[0] = split_database->get_bulk_data_size(acl::quality_tier::medium_importance);
+	clip->bulk_data_sizes[1] = split_database->get_bulk_data_size(acl::quality_tier::lowest_importance);
+	clip->io_latency_us = options.io_latency_us;
+
+	std::string bulk_data_path = options.bulk_data_dir;
+	if (!bulk_data_path.empty())
+	{
+#ifdef _WIN32
+		bulk_data_path += '\\';
+#else
+		bulk_data_path += '/';
+#endif
+	}
+
+	clip->bulk_data_filenames[0] = bulk_data_path + clip_name + ".medium.bulk";
+	clip->bulk_data_filenames[1] = bulk_data_path + clip_name + ".low.bulk";
+
+	const bool is_written = write_bulk_data(clip->bulk_data_filenames[0], bulk_data_medium, clip->bulk_data_sizes[0])
+		&& write_bulk_data(clip->bulk_data_filenames[1], bulk_data_low, clip->bulk_data_sizes[1]);
+
+	acl::deallocate_type_array(s_allocator, bulk_data_medium, clip->bulk_data_sizes[0]);
+	acl::deallocate_type_array(s_allocator, bulk_data_low, clip->bulk_data_sizes[1]);
+
+	s_database_clips.push_back(clip);
+
+	if (!is_written)
+	{
+		printf("    Failed to write the bulk data files!\n");
+		return false;
+	}
+
+	printf("    Max chunk size: %u KB, medium tier: %.2f KB, low tier: %.2f KB\n", split_database->get_max_chunk_size() / 1024, double(clip->bulk_data_sizes[0]) / 1024.0, double(clip->bulk_data_sizes[1]) / 1024.0);
+
+	// Dynamically register our benchmark
+	const std::string bench_name = clip_name + "_db";
+	benchmark::internal::Benchmark* bench = benchmark::internal::RegisterBenchmarkInternal(new benchmark::internal::FunctionBenchmark(bench_name.c_str(), benchmark_database_decompression));
+
+	bench->Args({ reinterpret_cast<int64_t>(clip), (int64_t)DatabaseResidency::HighestOnly });
+	bench->Args({ reinterpret_cast<int64_t>(clip), (int64_t)DatabaseResidency::MediumStreamedIn });
+	bench->Args({ reinterpret_cast<int64_t>(clip), (int64_t)DatabaseResidency::AllStreamedIn });
+	bench->Args({ reinterpret_cast<int64_t>(clip), (int64_t)DatabaseResidency::StreamingInFlight });
+	bench->ArgNames({ "", "Residency" });
+	bench->Repetitions(3);
+	bench->Iterations(10000);
+	bench->UseManualTime();
+
+	return true;
+}
@@ -24,6 +24,7 @@
 
 #include <acl/core/ansi_allocator.h>
 #include <acl/core/compressed_tracks.h>
+#include <acl/core/mapped_file.h>
 
 #include <benchmark/benchmark.h>
 
@@ -32,10 +33,42 @@
 
 extern acl::ansi_allocator s_allocator;
 
+struct database_benchmark_options
+{
+	std::string bulk_data_dir;		// Where the split bulk data files are written, the working directory if empty
+	uint32_t max_chunk_size = 0;	// In bytes, the database default if zero
+	uint32_t io_latency_us = 0;		// Simulated latency of every streaming read
+};
+
 void clear_benchmark_state();
 
+// Backs the clip copies and the streamed database bulk data with huge pages, must be set before any benchmark runs
+void set_huge_pages_enabled(bool enabled);
+void print_huge_page_stats();
+
 bool parse_metadata(const char* buffer, size_t buffer_size, std::string& out_clip_dir, std::vector<std::string>& out_clips);
 
-bool read_clip(const std::string& clip_dir, const std::string& clip, acl::iallocator& allocator, acl::compressed_tracks*& out_compressed_tracks);
+// A clip read from disk, memory mapped when supported and read in a buffer otherwise
+struct input_clip
+{
+	std::string name;
+#if defined(ACL_IMPL_HAS_MAPPED_FILE)
+	acl::mapped_file file;
+#endif
+	const acl::compressed_tracks* tracks = nullptr;
+	size_t size = 0;
+	bool is_valid = false;			// Set by validate_clips(..)
+};
+
+bool read_clip(const std::string& clip_dir, const std::string& clip, input_clip& out_clip);
+void release_clip(input_clip& clip);
+
+// Validates every clip read, in parallel on every hardware thread
+void validate_clips(std::vector<input_clip>& clips);
 
 bool prepare_clip(const std::string& clip_name, const acl::compressed_tracks& raw_tracks, std::vector<acl::compressed_tracks*>& out_compressed_clips);
+
+// Compresses the clip with the provided proportion of its keyframes stripped and registers it as '<clip>_stripped'
+bool prepare_stripped_clip(const std::string& clip_name, const acl::compressed_tracks& raw_tracks, float proportion, std::vector<acl::compressed_tracks*>& out_compressed_clips);
+
+bool prepare_database_clip(const std::string& clip_name, const acl::compressed_tracks& raw_tracks, const database_benchmark_options& options);
@@ -0,0 +1,167 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "hardware_counters.h"
+
+#if defined(__linux__)
+	#include <linux/perf_event.h>
+	#include <sys/ioctl.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+#endif
+
+#include <cstring>
+
+static bool s_are_hardware_counters_enabled = false;
+
+void set_hardware_counters_enabled(bool enabled)
+{
+	s_are_hardware_counters_enabled = enabled;
+}
+
+bool are_hardware_counters_enabled()
+{
+	return s_are_hardware_counters_enabled;
+}
+
+#if defined(__linux__)
+static int open_perf_event(uint32_t type, uint64_t config, int group_fd)
+{
+	perf_event_attr attr;
+	std::memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = type;
+	attr.config = config;
+	attr.read_format = PERF_FORMAT_GROUP;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+
+	// The group leader starts disabled, its events are enabled together once they are all open
+	attr.disabled = group_fd < 0 ? 1 : 0;
+
+	// Count on the calling thread, on any CPU
+	return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+
+static constexpr uint64_t make_cache_event(uint64_t cache, uint64_t op, uint64_t result)
+{
+	return cache | (op << 8) | (result << 16);
+}
+#endif
+
+hardware_counters::hardware_counters()
+	: m_group_fd(-1)
+{
+	for (int& event_fd : m_event_fds)
+		event_fd = -1;
+}
+
+hardware_counters::~hardware_counters()
+{
+	close();
+}
+
+bool hardware_counters::open()
+{
+	close();
+
+#if defined(__linux__)
+	// Events are read in this order, it must match the hardware_counter enum
+	const uint32_t event_types[uint32_t(hardware_counter::count)] =
+	{
+		PERF_TYPE_HARDWARE,
+		PERF_TYPE_HARDWARE,
+		PERF_TYPE_HW_CACHE,
+		PERF_TYPE_HARDWARE,
+		PERF_TYPE_HARDWARE,
+	};
+
+	const uint64_t event_configs[uint32_t(hardware_counter::count)] =
+	{
+		PERF_COUNT_HW_CPU_CYCLES,
+		PERF_COUNT_HW_INSTRUCTIONS,
+		make_cache_event(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS),
+		PERF_COUNT_HW_CACHE_MISSES,
+		PERF_COUNT_HW_BRANCH_MISSES,
+	};
+
+	for (uint32_t event_index = 0; event_index < uint32_t(hardware_counter::count); ++event_index)
+	{
+		const int event_fd = open_perf_event(event_types[event_index], event_configs[event_index], m_group_fd);
+		if (event_fd < 0)
+		{
+			// Not every CPU or kernel exposes every event, we need them all to report consistent numbers
+			close();
+			return false;
+		}
+
+		m_event_fds[event_index] = event_fd;
+		if (event_index == 0)
+			m_group_fd = event_fd;
+	}
+
+	ioctl(m_group_fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+	ioctl(m_group_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	return true;
+#else
+	return false;
+#endif
+}
+
+void hardware_counters::close()
+{
+#if defined(__linux__)
+	for (int& event_fd : m_event_fds)
+	{
+		if (event_fd >= 0)
+			::close(event_fd);
+
+		event_fd = -1;
+	}
+#endif
+
+	m_group_fd = -1;
+}
+
+bool hardware_counters::read(uint64_t (&out_values)[uint32_t(hardware_counter::count)]) const
+{
+#if defined(__linux__)
+	if (m_group_fd < 0)
+		return false;
+
+	// With PERF_FORMAT_GROUP, the number of events is followed by their values in the order they were opened
+	uint64_t buffer[1 + uint32_t(hardware_counter::count)];
+	const ssize_t num_bytes_read = ::read(m_group_fd, buffer, sizeof(buffer));
+	if (num_bytes_read != ssize_t(sizeof(buffer)) || buffer[0] != uint64_t(hardware_counter::count))
+		return false;
+
+	for (uint32_t event_index = 0; event_index < uint32_t(hardware_counter::count); ++event_index)
+		out_values[event_index] = buffer[1 + event_index];
+
+	return true;
+#else
+	(void)out_values;
+	return false;
+#endif
+}
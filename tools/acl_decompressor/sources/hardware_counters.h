@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+
+// The hardware events we sample around every timed decompression
+enum class hardware_counter
+{
+	cycles,
+	instructions,
+	l1d_read_misses,
+	llc_misses,
+	branch_misses,
+
+	count
+};
+
+// Reads the CPU performance monitoring counters of the calling thread.
+// Only supported on Linux through perf_event, everywhere else (and when perf_event
+// is restricted, e.g. within a VM or by perf_event_paranoid) is_open() returns false.
+// Only user space events are counted.
+class hardware_counters
+{
+public:
+	hardware_counters();
+	~hardware_counters();
+
+	hardware_counters(const hardware_counters&) = delete;
+	hardware_counters& operator=(const hardware_counters&) = delete;
+
+	// Opens every counter for the calling thread and starts counting
+	bool open();
+	void close();
+
+	bool is_open() const { return m_group_fd >= 0; }
+
+	// Reads the current value of every counter, they only ever increase
+	bool read(uint64_t (&out_values)[uint32_t(hardware_counter::count)]) const;
+
+private:
+	int m_group_fd;
+	int m_event_fds[uint32_t(hardware_counter::count)];
+};
+
+// Enabled with the -perf_counters command line option
+void set_hardware_counters_enabled(bool enabled);
+bool are_hardware_counters_enabled();
@@ -0,0 +1,263 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "sustained_benchmark.h"
+#include "benchmark.h"
+
+#include <acl/core/ansi_allocator.h>
+#include <acl/core/memory_utils.h>
+#include <acl/core/impl/debug_track_writer.h>
+#include <acl/decompression/decompress.h>
+
+#include <rtm/scalarf.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <vector>
+
+// Each thread decompresses its own copies of the clip, enough of them to exceed the CPU cache like a busy game would
+static constexpr uint32_t k_num_sustained_contexts_per_thread = 16;
+
+struct sustained_decompression_settings final : public acl::default_transform_decompression_settings
+{
+	// Only support our latest version
+	static constexpr acl::compressed_tracks_version16 version_supported() { return acl::compressed_tracks_version16::latest; }
+};
+
+// Every thread counts its own poses on its own cache line to avoid contention
+struct sustained_thread_state
+{
+	std::atomic<uint64_t> num_poses;
+	uint8_t padding[64 - sizeof(std::atomic<uint64_t>)];
+};
+
+struct sustained_sample
+{
+	double time_s;
+	double poses_per_s;
+	uint32_t min_cpu_mhz;
+	uint32_t avg_cpu_mhz;
+	uint32_t max_cpu_mhz;
+	int thermal_state;
+};
+
+// Returns the current frequency of a CPU core in MHz, 0 if unknown
+static uint32_t read_cpu_frequency_mhz(uint32_t cpu_index)
+{
+#if defined(__linux__)
+	// Also covers Android, the frequency is only exposed through sysfs
+	char path[128];
+	snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cpufreq/scaling_cur_freq", cpu_index);
+
+	std::FILE* file = std::fopen(path, "r");
+	if (file == nullptr)
+		return 0;
+
+	unsigned int frequency_khz = 0;
+	if (std::fscanf(file, "%u", &frequency_khz) != 1)
+		frequency_khz = 0;
+
+	std::fclose(file);
+	return frequency_khz / 1000;
+#else
+	// Not exposed on other platforms (e.g. iOS)
+	(void)cpu_index;
+	return 0;
+#endif
+}
+
+static void sustained_decompression_thread(const acl::compressed_tracks* const* tracks_list, uint32_t num_contexts, const std::atomic<bool>& is_done, sustained_thread_state& thread_state)
+{
+	acl::decompression_context<sustained_decompression_settings> contexts[k_num_sustained_contexts_per_thread];
+	for (uint32_t context_index = 0; context_index < num_contexts; ++context_index)
+		contexts[context_index].initialize(*tracks_list[context_index]);
+
+	const acl::compressed_tracks& compressed_tracks = *tracks_list[0];
+	const float duration = compressed_tracks.get_finite_duration(acl::sample_looping_policy::non_looping);
+	const uint32_t num_tracks = compressed_tracks.get_num_tracks();
+
+	acl::acl_impl::debug_track_writer pose_writer(s_allocator, acl::track_type8::qvvf, num_tracks);
+
+	constexpr uint32_t k_num_decompression_samples = 100;
+	uint32_t current_sample_index = 0;
+
+	while (!is_done.load(std::memory_order_relaxed))
+	{
+		// Every context is sampled at the same time before we move on to the next one
+		const float normalized_sample_time = float(current_sample_index) / float(k_num_decompression_samples - 1);
+		const float sample_time = rtm::scalar_clamp(normalized_sample_time, 0.0F, 1.0F) * duration;
+
+		for (uint32_t context_index = 0; context_index < num_contexts; ++context_index)
+		{
+			// Interpolate as this is the most common scenario
+			contexts[context_index].seek(sample_time, acl::sample_rounding_policy::none);
+			contexts[context_index].decompress_tracks(pose_writer);
+		}
+
+		thread_state.num_poses.fetch_add(num_contexts, std::memory_order_relaxed);
+
+		current_sample_index++;
+		if (current_sample_index >= k_num_decompression_samples)
+			current_sample_index = 0;
+	}
+}
+
+static bool write_sustained_samples(const char* output_filename, const std::vector<sustained_sample>& samples)
+{
+	std::FILE* file = std::fopen(output_filename, "w");
+	if (file == nullptr)
+		return false;
+
+	fprintf(file, "time_s,poses_per_s,min_cpu_mhz,avg_cpu_mhz,max_cpu_mhz,thermal_state\n");
+	for (const sustained_sample& sample : samples)
+		fprintf(file, "%.3f,%.1f,%u,%u,%u,%d\n", sample.time_s, sample.poses_per_s, sample.min_cpu_mhz, sample.avg_cpu_mhz, sample.max_cpu_mhz, sample.thermal_state);
+
+	std::fclose(file);
+	return true;
+}
+
+bool run_sustained_benchmark(const std::vector<acl::compressed_tracks*>& compressed_clips, const sustained_benchmark_options& options, const char* output_filename)
+{
+	const auto clip_it = std::find_if(compressed_clips.begin(), compressed_clips.end(), [](const acl::compressed_tracks* tracks) { return tracks->get_track_type() == acl::track_type8::qvvf; });
+	if (clip_it == compressed_clips.end())
+	{
+		printf("Sustained benchmark requires a transform clip!\n");
+		return false;
+	}
+
+	const acl::compressed_tracks& compressed_tracks = **clip_it;
+	const uint32_t compressed_size = compressed_tracks.get_size();
+
+	const uint32_t num_cpus = std::max<uint32_t>(std::thread::hardware_concurrency(), 1);
+	const uint32_t num_threads = options.num_threads != 0 ? options.num_threads : num_cpus;
+	const uint32_t num_copies = num_threads * k_num_sustained_contexts_per_thread;
+
+	// Every context has its own copy of the clip
+	const uint32_t padded_clip_size = acl::align_to(compressed_size, uint32_t(acl::k_compressed_tracks_preferred_alignment));
+	uint8_t* clip_copy_buffer = acl::allocate_type_array_aligned<uint8_t>(s_allocator, size_t(padded_clip_size) * num_copies, acl::k_compressed_tracks_preferred_alignment);
+
+	std::vector<const acl::compressed_tracks*> tracks_list(num_copies);
+	for (uint32_t copy_index = 0; copy_index < num_copies; ++copy_index)
+	{
+		uint8_t* buffer = clip_copy_buffer + (size_t(copy_index) * padded_clip_size);
+		std::memcpy(buffer, &compressed_tracks, compressed_size);
+		tracks_list[copy_index] = reinterpret_cast<const acl::compressed_tracks*>(buffer);
+	}
+
+	printf("Sustained benchmark: %u threads for %u seconds ...\n", num_threads, options.duration_s);
+
+	std::vector<sustained_thread_state> thread_states(num_threads);
+	for (sustained_thread_state& thread_state : thread_states)
+		thread_state.num_poses.store(0, std::memory_order_relaxed);
+
+	std::atomic<bool> is_done(false);
+
+	std::vector<std::thread> threads;
+	threads.reserve(num_threads);
+	for (uint32_t thread_index = 0; thread_index < num_threads; ++thread_index)
+		threads.emplace_back(sustained_decompression_thread, tracks_list.data() + (thread_index * k_num_sustained_contexts_per_thread), k_num_sustained_contexts_per_thread, std::cref(is_done), std::ref(thread_states[thread_index]));
+
+	std::vector<sustained_sample> samples;
+
+	const auto start = std::chrono::steady_clock::now();
+	const auto end = start + std::chrono::seconds(options.duration_s);
+
+	auto previous_sample_time = start;
+	uint64_t previous_num_poses = 0;
+	while (previous_sample_time < end)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(options.sample_interval_ms));
+
+		uint64_t num_poses = 0;
+		for (const sustained_thread_state& thread_state : thread_states)
+			num_poses += thread_state.num_poses.load(std::memory_order_relaxed);
+
+		const auto sample_time = std::chrono::steady_clock::now();
+		const double interval_s = std::chrono::duration_cast<std::chrono::duration<double>>(sample_time - previous_sample_time).count();
+
+		sustained_sample sample;
+		sample.time_s = std::chrono::duration_cast<std::chrono::duration<double>>(sample_time - start).count();
+		sample.poses_per_s = double(num_poses - previous_num_poses) / interval_s;
+		sample.thermal_state = options.query_thermal_state != nullptr ? options.query_thermal_state() : -1;
+
+		// Cores that don't expose their frequency are skipped
+		uint32_t min_cpu_mhz = ~0U;
+		uint32_t max_cpu_mhz = 0;
+		uint64_t sum_cpu_mhz = 0;
+		uint32_t num_known_cpus = 0;
+		for (uint32_t cpu_index = 0; cpu_index < num_cpus; ++cpu_index)
+		{
+			const uint32_t cpu_mhz = read_cpu_frequency_mhz(cpu_index);
+			if (cpu_mhz == 0)
+				continue;
+
+			min_cpu_mhz = std::min(min_cpu_mhz, cpu_mhz);
+			max_cpu_mhz = std::max(max_cpu_mhz, cpu_mhz);
+			sum_cpu_mhz += cpu_mhz;
+			num_known_cpus++;
+		}
+
+		sample.min_cpu_mhz = num_known_cpus != 0 ? min_cpu_mhz : 0;
+		sample.avg_cpu_mhz = num_known_cpus != 0 ? uint32_t(sum_cpu_mhz / num_known_cpus) : 0;
+		sample.max_cpu_mhz = max_cpu_mhz;
+
+		printf("%8.1f s: %10.0f poses/s, CPU %u-%u MHz, thermal state %d\n", sample.time_s, sample.poses_per_s, sample.min_cpu_mhz, sample.max_cpu_mhz, sample.thermal_state);
+
+		samples.push_back(sample);
+		previous_sample_time = sample_time;
+		previous_num_poses = num_poses;
+	}
+
+	is_done.store(true, std::memory_order_relaxed);
+	for (std::thread& thread : threads)
+		thread.join();
+
+	acl::deallocate_type_array(s_allocator, clip_copy_buffer, size_t(padded_clip_size) * num_copies);
+
+	// Peak is the best interval while sustained is the average over the last quarter of the run
+	double peak_poses_per_s = 0.0;
+	for (const sustained_sample& sample : samples)
+		peak_poses_per_s = std::max(peak_poses_per_s, sample.poses_per_s);
+
+	const size_t num_sustained_samples = std::max<size_t>(samples.size() / 4, 1);
+	double sustained_poses_per_s = 0.0;
+	for (size_t sample_index = samples.size() - num_sustained_samples; sample_index < samples.size(); ++sample_index)
+		sustained_poses_per_s += samples[sample_index].poses_per_s;
+	sustained_poses_per_s /= double(num_sustained_samples);
+
+	printf("Peak: %.0f poses/s, sustained: %.0f poses/s (%.1f%%)\n", peak_poses_per_s, sustained_poses_per_s, peak_poses_per_s > 0.0 ? (sustained_poses_per_s / peak_poses_per_s) * 100.0 : 0.0);
+
+	if (!write_sustained_samples(output_filename, samples))
+	{
+		printf("Failed to write sustained benchmark results to %s\n", output_filename);
+		return false;
+	}
+
+	return true;
+}
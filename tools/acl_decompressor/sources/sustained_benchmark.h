@@ -0,0 +1,49 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <acl/core/compressed_tracks.h>
+
+#include <cstdint>
+#include <vector>
+
+// Returns the thermal state of the device where 0 is nominal and higher values are more throttled, -1 if unknown.
+// The scale is platform specific, see the README.
+using query_thermal_state_func = int (*)();
+
+struct sustained_benchmark_options
+{
+	uint32_t duration_s = 0;			// How long to decompress for, disabled if zero
+	uint32_t sample_interval_ms = 1000;	// How often the throughput, CPU frequencies, and thermal state are recorded
+	uint32_t num_threads = 0;			// Every hardware thread if zero
+
+	query_thermal_state_func query_thermal_state = nullptr;	// Optional
+};
+
+// Decompresses the first transform clip continuously on every thread for the provided duration.
+// Short benchmarks measure peak performance, this measures what remains once the device throttles.
+// Every interval, the aggregate throughput is recorded along with the CPU frequencies and the thermal state.
+// Samples are printed as they are recorded and written as CSV to the output file.
+bool run_sustained_benchmark(const std::vector<acl::compressed_tracks*>& compressed_clips, const sustained_benchmark_options& options, const char* output_filename);
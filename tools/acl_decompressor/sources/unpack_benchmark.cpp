@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <acl/core/impl/variable_bit_rates.h>
+#include <acl/math/vector4_packing.h>
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////
+// Variable bit rate unpacking kernels used by animated rotations, translations, and scales
+// They are measured on their own so that their SIMD code paths can be compared on every platform
+// the decompression benchmark runs on, ARM64 devices included.
+
+static constexpr uint32_t k_num_unpack_samples = 1024;
+
+static std::vector<uint8_t> make_unpack_buffer(uint32_t num_bytes)
+{
+	// Every bit pattern is a valid sample, fill with random bits using a fixed seed
+	// We pad by 16 bytes since the kernels can read up to 16 bytes from the last sample
+	std::vector<uint8_t> buffer(num_bytes + 16);
+
+	std::default_random_engine engine(0);
+	std::uniform_int_distribution<uint32_t> distribution(0, 255);
+	for (uint8_t& value : buffer)
+		value = uint8_t(distribution(engine));
+
+	return buffer;
+}
+
+static void benchmark_unpack_vector3(benchmark::State& state)
+{
+	const uint32_t num_bits = acl::acl_impl::get_num_bits_at_bit_rate(uint32_t(state.range(0)));
+	const uint32_t num_bits_per_sample = num_bits * 3;
+	const std::vector<uint8_t> buffer = make_unpack_buffer(k_num_unpack_samples * 12);
+
+	for (auto _ : state)
+	{
+		(void)_;
+
+		uint32_t bit_offset = 0;
+		for (uint32_t sample_index = 0; sample_index < k_num_unpack_samples; ++sample_index, bit_offset += num_bits_per_sample)
+		{
+			const rtm::vector4f sample = acl::unpack_vector3_uXX_unsafe(num_bits, buffer.data(), bit_offset);
+			benchmark::DoNotOptimize(sample);
+		}
+	}
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * k_num_unpack_samples);
+	state.counters["Bits"] = double(num_bits);
+}
+
+static void benchmark_unpack_vector4(benchmark::State& state)
+{
+	const uint32_t num_bits = acl::acl_impl::get_num_bits_at_bit_rate(uint32_t(state.range(0)));
+	const uint32_t num_bits_per_sample = num_bits * 4;
+	const std::vector<uint8_t> buffer = make_unpack_buffer(k_num_unpack_samples * 16);
+
+	for (auto _ : state)
+	{
+		(void)_;
+
+		uint32_t bit_offset = 0;
+		for (uint32_t sample_index = 0; sample_index < k_num_unpack_samples; ++sample_index, bit_offset += num_bits_per_sample)
+		{
+			const rtm::vector4f sample = acl::unpack_vector4_uXX_unsafe(num_bits, buffer.data(), bit_offset);
+			benchmark::DoNotOptimize(sample);
+		}
+	}
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * k_num_unpack_samples);
+	state.counters["Bits"] = double(num_bits);
+}
+
+// The highest bit rate is raw and does not use these kernels
+BENCHMARK(benchmark_unpack_vector3)->DenseRange(acl::acl_impl::k_lowest_bit_rate, acl::acl_impl::k_highest_bit_rate - 1)->ArgName("BitRate");
+BENCHMARK(benchmark_unpack_vector4)->DenseRange(acl::acl_impl::k_lowest_bit_rate, acl::acl_impl::k_highest_bit_rate - 1)->ArgName("BitRate");
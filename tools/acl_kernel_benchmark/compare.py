@@ -0,0 +1,55 @@
+import os
+import platform
+import shutil
+import subprocess
+import sys
+
+# Compares kernel benchmark results with the baseline of the current architecture
+# Usage: python compare.py [-arch=<name>] [-update] <results.json>
+
+def get_arch_name():
+	machine = platform.machine().lower()
+	if machine in ['x86_64', 'amd64']:
+		return 'x64'
+	if machine in ['aarch64', 'arm64']:
+		return 'arm64'
+	return machine
+
+if __name__ == "__main__":
+	script_dir = os.path.dirname(os.path.realpath(__file__))
+	google_benchmark_dir = os.path.join(script_dir, '..', '..', 'external', 'benchmark', 'tools')
+	google_benchmark_compare_script = os.path.join(google_benchmark_dir, 'compare.py')
+
+	arch_name = get_arch_name()
+	update_baseline = False
+	results_filename = None
+
+	for arg in sys.argv[1:]:
+		if arg.startswith('-arch='):
+			arch_name = arg[len('-arch='):]
+		elif arg == '-update':
+			update_baseline = True
+		else:
+			results_filename = arg
+
+	if results_filename is None or not os.path.isfile(results_filename):
+		print('Usage: python compare.py [-arch=<name>] [-update] <results.json>')
+		sys.exit(1)
+
+	baseline_dir = os.path.join(script_dir, 'baselines')
+	baseline_filename = os.path.join(baseline_dir, '{}.json'.format(arch_name))
+
+	if update_baseline:
+		if not os.path.exists(baseline_dir):
+			os.makedirs(baseline_dir)
+
+		shutil.copyfile(results_filename, baseline_filename)
+		print('Updated baseline: {}'.format(baseline_filename))
+		sys.exit(0)
+
+	if not os.path.isfile(baseline_filename):
+		print('No baseline found for {}, create one with: python compare.py -update {}'.format(arch_name, results_filename))
+		sys.exit(1)
+
+	compare_cmd = [sys.executable, google_benchmark_compare_script, 'benchmarks', baseline_filename, results_filename]
+	sys.exit(subprocess.call(compare_cmd, stdout=sys.stdout, stderr=sys.stderr))
@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "kernel_benchmark.h"
+
+#include <acl/core/interpolation_utils.h>
+#include <acl/core/sample_looping_policy.h>
+#include <acl/core/sample_rounding_policy.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Interpolation sample lookup kernels, as used when seeking
+
+// A 2 second clip at 30 FPS
+constexpr uint32_t k_num_clip_samples = 61;
+constexpr float k_clip_sample_rate = 30.0F;
+constexpr float k_clip_duration = float(k_num_clip_samples - 1) / k_clip_sample_rate;
+
+static std::vector<float> make_sample_times()
+{
+	std::mt19937 generator(1337);
+	std::uniform_real_distribution<float> distribution(0.0F, k_clip_duration);
+
+	std::vector<float> sample_times;
+	sample_times.reserve(k_num_kernel_samples);
+	for (uint32_t sample_index = 0; sample_index < k_num_kernel_samples; ++sample_index)
+		sample_times.push_back(distribution(generator));
+
+	return sample_times;
+}
+
+static void interpolation_policy_args(benchmark::internal::Benchmark* bench)
+{
+	bench->ArgNames({ "Rounding", "Looping" });
+
+	const acl::sample_rounding_policy rounding_policies[] = { acl::sample_rounding_policy::none, acl::sample_rounding_policy::floor, acl::sample_rounding_policy::ceil, acl::sample_rounding_policy::nearest };
+	const acl::sample_looping_policy looping_policies[] = { acl::sample_looping_policy::clamp, acl::sample_looping_policy::wrap };
+
+	for (acl::sample_rounding_policy rounding_policy : rounding_policies)
+	{
+		for (acl::sample_looping_policy looping_policy : looping_policies)
+			bench->Args({ int64_t(rounding_policy), int64_t(looping_policy) });
+	}
+}
+
+static void find_interpolation_samples_with_sample_rate(benchmark::State& state)
+{
+	const acl::sample_rounding_policy rounding_policy = static_cast<acl::sample_rounding_policy>(state.range(0));
+	const acl::sample_looping_policy looping_policy = static_cast<acl::sample_looping_policy>(state.range(1));
+	const std::vector<float> sample_times = make_sample_times();
+
+	for (auto _ : state)
+	{
+		for (float sample_time : sample_times)
+		{
+			uint32_t sample_index0;
+			uint32_t sample_index1;
+			float interpolation_alpha;
+			acl::find_linear_interpolation_samples_with_sample_rate(k_num_clip_samples, k_clip_sample_rate, sample_time, rounding_policy, looping_policy, sample_index0, sample_index1, interpolation_alpha);
+
+			benchmark::DoNotOptimize(sample_index0);
+			benchmark::DoNotOptimize(sample_index1);
+			benchmark::DoNotOptimize(interpolation_alpha);
+		}
+	}
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * k_num_kernel_samples);
+}
+
+static void find_interpolation_samples_with_duration(benchmark::State& state)
+{
+	const acl::sample_rounding_policy rounding_policy = static_cast<acl::sample_rounding_policy>(state.range(0));
+	const acl::sample_looping_policy looping_policy = static_cast<acl::sample_looping_policy>(state.range(1));
+	const std::vector<float> sample_times = make_sample_times();
+
+	for (auto _ : state)
+	{
+		for (float sample_time : sample_times)
+		{
+			uint32_t sample_index0;
+			uint32_t sample_index1;
+			float interpolation_alpha;
+			acl::find_linear_interpolation_samples_with_duration(k_num_clip_samples, k_clip_duration, sample_time, rounding_policy, looping_policy, sample_index0, sample_index1, interpolation_alpha);
+
+			benchmark::DoNotOptimize(sample_index0);
+			benchmark::DoNotOptimize(sample_index1);
+			benchmark::DoNotOptimize(interpolation_alpha);
+		}
+	}
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * k_num_kernel_samples);
+}
+
+BENCHMARK(find_interpolation_samples_with_sample_rate)->Apply(interpolation_policy_args);
+BENCHMARK(find_interpolation_samples_with_duration)->Apply(interpolation_policy_args);
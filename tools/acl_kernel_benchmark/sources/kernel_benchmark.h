@@ -0,0 +1,95 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <acl/core/impl/variable_bit_rates.h>
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/quatf.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Every kernel processes this many samples per iteration, enough to amortize the loop overhead while remaining in the L1 cache
+constexpr uint32_t k_num_kernel_samples = 1024;
+
+// The unpacking functions can read up to 23 bytes past the last sample
+constexpr uint32_t k_kernel_buffer_padding = 32;
+
+// Registers every bit rate from the lowest to the raw one as the 'BitRate' argument
+inline void kernel_bit_rate_args(benchmark::internal::Benchmark* bench)
+{
+	bench->ArgName("BitRate");
+	for (uint32_t bit_rate = acl::acl_impl::k_lowest_bit_rate; bit_rate <= acl::acl_impl::k_highest_bit_rate; ++bit_rate)
+		bench->Arg(bit_rate);
+}
+
+// Returns random values in [0.0, 1.0] with a fixed seed to keep every run identical
+inline std::vector<rtm::vector4f> make_normalized_vectors(uint32_t num_vectors)
+{
+	std::mt19937 generator(1337);
+	std::uniform_real_distribution<float> distribution(0.0F, 1.0F);
+
+	std::vector<rtm::vector4f> vectors;
+	vectors.reserve(num_vectors);
+	for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+		vectors.push_back(rtm::vector_set(distribution(generator), distribution(generator), distribution(generator), distribution(generator)));
+
+	return vectors;
+}
+
+// Returns random normalized rotations with a fixed seed to keep every run identical
+inline std::vector<rtm::quatf> make_rotations(uint32_t num_rotations)
+{
+	std::mt19937 generator(1337);
+	std::uniform_real_distribution<float> distribution(-1.0F, 1.0F);
+
+	std::vector<rtm::quatf> rotations;
+	rotations.reserve(num_rotations);
+	for (uint32_t rotation_index = 0; rotation_index < num_rotations; ++rotation_index)
+	{
+		const rtm::quatf rotation = rtm::quat_set(distribution(generator), distribution(generator), distribution(generator), distribution(generator));
+		rotations.push_back(rtm::quat_normalize(rotation));
+	}
+
+	return rotations;
+}
+
+// Returns random bytes with a fixed seed, the content of a packed buffer doesn't impact the unpacking speed
+inline std::vector<uint8_t> make_packed_buffer(uint32_t buffer_size)
+{
+	std::mt19937 generator(1337);
+
+	std::vector<uint8_t> buffer;
+	buffer.reserve(buffer_size + k_kernel_buffer_padding);
+	for (uint32_t byte_index = 0; byte_index < buffer_size + k_kernel_buffer_padding; ++byte_index)
+		buffer.push_back(uint8_t(generator()));
+
+	return buffer;
+}
@@ -0,0 +1,242 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "kernel_benchmark.h"
+
+#include <acl/core/impl/variable_bit_rates.h>
+#include <acl/math/quat_packing.h>
+#include <acl/math/scalar_packing.h>
+#include <acl/math/vector4_packing.h>
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/quatf.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Packing and unpacking kernels at every bit rate
+// The raw bit rate uses the full precision functions, the others use the variable ones
+
+static uint32_t get_kernel_num_bits(const benchmark::State& state)
+{
+	return acl::acl_impl::get_num_bits_at_bit_rate(uint32_t(state.range(0)));
+}
+
+static void set_kernel_counters(benchmark::State& state, uint32_t num_bits)
+{
+	state.SetItemsProcessed(int64_t(state.iterations()) * k_num_kernel_samples);
+	state.counters["Bits"] = double(num_bits);
+}
+
+static void pack_vector3(benchmark::State& state)
+{
+	const uint32_t num_bits = get_kernel_num_bits(state);
+	const bool is_raw = num_bits == 32;
+	const std::vector<rtm::vector4f> vectors = make_normalized_vectors(k_num_kernel_samples);
+	std::vector<uint8_t> buffer = make_packed_buffer(k_num_kernel_samples * 12);
+
+	for (auto _ : state)
+	{
+		if (is_raw)
+		{
+			for (uint32_t sample_index = 0; sample_index < k_num_kernel_samples; ++sample_index)
+				acl::pack_vector3_96(vectors[sample_index], buffer.data() + sample_index * 12);
+		}
+		else
+			acl::pack_vector3_uXX_array(vectors.data(), k_num_kernel_samples, num_bits, buffer.data(), 0);
+
+		benchmark::ClobberMemory();
+	}
+
+	set_kernel_counters(state, num_bits);
+}
+
+static void unpack_vector3(benchmark::State& state)
+{
+	const uint32_t num_bits = get_kernel_num_bits(state);
+	const bool is_raw = num_bits == 32;
+	const uint32_t num_bits_per_sample = num_bits * 3;
+	const std::vector<uint8_t> buffer = make_packed_buffer(k_num_kernel_samples * 12);
+
+	for (auto _ : state)
+	{
+		uint32_t bit_offset = 0;
+		for (uint32_t sample_index = 0; sample_index < k_num_kernel_samples; ++sample_index, bit_offset += num_bits_per_sample)
+		{
+			const rtm::vector4f sample = is_raw ? acl::unpack_vector3_96_unsafe(buffer.data(), bit_offset) : acl::unpack_vector3_uXX_unsafe(num_bits, buffer.data(), bit_offset);
+			benchmark::DoNotOptimize(sample);
+		}
+	}
+
+	set_kernel_counters(state, num_bits);
+}
+
+static void pack_vector4(benchmark::State& state)
+{
+	const uint32_t num_bits = get_kernel_num_bits(state);
+	const bool is_raw = num_bits == 32;
+	const std::vector<rtm::vector4f> vectors = make_normalized_vectors(k_num_kernel_samples);
+	std::vector<uint8_t> buffer = make_packed_buffer(k_num_kernel_samples * 16);
+
+	for (auto _ : state)
+	{
+		// Every sample is written in its own 16 bytes, only whole bytes can be written to
+		for (uint32_t sample_index = 0; sample_index < k_num_kernel_samples; ++sample_index)
+		{
+			uint8_t* sample_data = buffer.data() + sample_index * 16;
+			if (is_raw)
+				acl::pack_vector4_128(vectors[sample_index], sample_data);
+			else
+				acl::pack_vector4_uXX_unsafe(vectors[sample_index], num_bits, sample_data);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	set_kernel_counters(state, num_bits);
+}
+
+static void unpack_vector4(benchmark::State& state)
+{
+	const uint32_t num_bits = get_kernel_num_bits(state);
+	const bool is_raw = num_bits == 32;
+	const uint32_t num_bits_per_sample = num_bits * 4;
+	const std::vector<uint8_t> buffer = make_packed_buffer(k_num_kernel_samples * 16);
+
+	for (auto _ : state)
+	{
+		uint32_t bit_offset = 0;
+		for (uint32_t sample_index = 0; sample_index < k_num_kernel_samples; ++sample_index, bit_offset += num_bits_per_sample)
+		{
+			const rtm::vector4f sample = is_raw ? acl::unpack_vector4_128_unsafe(buffer.data(), bit_offset) : acl::unpack_vector4_uXX_unsafe(num_bits, buffer.data(), bit_offset);
+			benchmark::DoNotOptimize(sample);
+		}
+	}
+
+	set_kernel_counters(state, num_bits);
+}
+
+static void pack_scalar(benchmark::State& state)
+{
+	const uint32_t num_bits = get_kernel_num_bits(state);
+	const bool is_raw = num_bits == 32;
+	const std::vector<rtm::vector4f> vectors = make_normalized_vectors(k_num_kernel_samples);
+	std::vector<uint32_t> packed_values(k_num_kernel_samples);
+
+	for (auto _ : state)
+	{
+		// The raw bit rate stores the value as is, only its quantization is measured otherwise
+		for (uint32_t sample_index = 0; sample_index < k_num_kernel_samples; ++sample_index)
+		{
+			const float value = rtm::vector_get_x(vectors[sample_index]);
+			if (is_raw)
+				std::memcpy(&packed_values[sample_index], &value, sizeof(float));
+			else
+				packed_values[sample_index] = acl::pack_scalar_unsigned(value, num_bits);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	set_kernel_counters(state, num_bits);
+}
+
+static void unpack_scalar(benchmark::State& state)
+{
+	const uint32_t num_bits = get_kernel_num_bits(state);
+	const bool is_raw = num_bits == 32;
+	const std::vector<uint8_t> buffer = make_packed_buffer(k_num_kernel_samples * 4);
+
+	for (auto _ : state)
+	{
+		uint32_t bit_offset = 0;
+		for (uint32_t sample_index = 0; sample_index < k_num_kernel_samples; ++sample_index, bit_offset += num_bits)
+		{
+			const rtm::scalarf sample = is_raw ? acl::unpack_scalarf_32_unsafe(buffer.data(), bit_offset) : acl::unpack_scalarf_uXX_unsafe(num_bits, buffer.data(), bit_offset);
+			benchmark::DoNotOptimize(sample);
+		}
+	}
+
+	set_kernel_counters(state, num_bits);
+}
+
+static void pack_quat(benchmark::State& state)
+{
+	const uint32_t num_bits = get_kernel_num_bits(state);
+	const bool is_raw = num_bits == 32;
+	const std::vector<rtm::quatf> rotations = make_rotations(k_num_kernel_samples);
+	std::vector<uint8_t> buffer = make_packed_buffer(k_num_kernel_samples * 12);
+
+	for (auto _ : state)
+	{
+		if (is_raw)
+		{
+			for (uint32_t sample_index = 0; sample_index < k_num_kernel_samples; ++sample_index)
+				acl::pack_quat_96(rotations[sample_index], buffer.data() + sample_index * 12);
+		}
+		else
+			acl::pack_quat_sXX_array(rotations.data(), k_num_kernel_samples, num_bits, buffer.data(), 0);
+
+		benchmark::ClobberMemory();
+	}
+
+	set_kernel_counters(state, num_bits);
+}
+
+static void unpack_quat(benchmark::State& state)
+{
+	const uint32_t num_bits = get_kernel_num_bits(state);
+	const bool is_raw = num_bits == 32;
+	const std::vector<uint8_t> buffer = make_packed_buffer(k_num_kernel_samples * 12);
+	std::vector<rtm::quatf> rotations(k_num_kernel_samples);
+
+	for (auto _ : state)
+	{
+		// W is reconstructed from the other components
+		if (is_raw)
+		{
+			for (uint32_t sample_index = 0; sample_index < k_num_kernel_samples; ++sample_index)
+				rotations[sample_index] = acl::unpack_quat_96_unsafe(buffer.data() + sample_index * 12);
+		}
+		else
+			acl::unpack_quat_sXX_array_unsafe(num_bits, buffer.data(), 0, k_num_kernel_samples, rotations.data());
+
+		benchmark::ClobberMemory();
+	}
+
+	set_kernel_counters(state, num_bits);
+}
+
+BENCHMARK(pack_vector3)->Apply(kernel_bit_rate_args);
+BENCHMARK(unpack_vector3)->Apply(kernel_bit_rate_args);
+BENCHMARK(pack_vector4)->Apply(kernel_bit_rate_args);
+BENCHMARK(unpack_vector4)->Apply(kernel_bit_rate_args);
+BENCHMARK(pack_scalar)->Apply(kernel_bit_rate_args);
+BENCHMARK(unpack_scalar)->Apply(kernel_bit_rate_args);
+BENCHMARK(pack_quat)->Apply(kernel_bit_rate_args);
+BENCHMARK(unpack_quat)->Apply(kernel_bit_rate_args);
@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "kernel_benchmark.h"
+
+#include <acl/decompression/decompression_settings.h>
+#include <acl/decompression/impl/transform_animated_track_cache.h>
+#include <acl/math/quat_packing.h>
+#include <acl/math/quatf.h>
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/quatf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+#include <vector>
+
+// Rotation W reconstruction and range reduction kernels, as used when decompressing
+
+// Reconstructs W one rotation at a time (AOS), like constant rotations
+static void quat_w_reconstruction(benchmark::State& state)
+{
+	const std::vector<rtm::quatf> rotations = make_rotations(k_num_kernel_samples);
+
+	std::vector<rtm::vector4f> rotations_xyz;
+	rotations_xyz.reserve(k_num_kernel_samples);
+	for (const rtm::quatf& rotation : rotations)
+		rotations_xyz.push_back(rtm::quat_to_vector(rtm::quat_ensure_positive_w(rotation)));
+
+	for (auto _ : state)
+	{
+		for (uint32_t sample_index = 0; sample_index < k_num_kernel_samples; ++sample_index)
+		{
+			const rtm::quatf rotation = rtm::quat_from_positive_w(rotations_xyz[sample_index]);
+			benchmark::DoNotOptimize(rotation);
+		}
+	}
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * k_num_kernel_samples);
+}
+
+// Reconstructs W four rotations at a time (SOA), like animated rotations
+static void quat_w_reconstruction4(benchmark::State& state)
+{
+	const std::vector<rtm::quatf> rotations = make_rotations(k_num_kernel_samples);
+
+	std::vector<rtm::vector4f> rotations_soa;
+	rotations_soa.reserve(k_num_kernel_samples / 4 * 3);
+	for (uint32_t sample_index = 0; sample_index < k_num_kernel_samples; sample_index += 4)
+	{
+		const rtm::vector4f rotation0 = rtm::quat_to_vector(rtm::quat_ensure_positive_w(rotations[sample_index + 0]));
+		const rtm::vector4f rotation1 = rtm::quat_to_vector(rtm::quat_ensure_positive_w(rotations[sample_index + 1]));
+		const rtm::vector4f rotation2 = rtm::quat_to_vector(rtm::quat_ensure_positive_w(rotations[sample_index + 2]));
+		const rtm::vector4f rotation3 = rtm::quat_to_vector(rtm::quat_ensure_positive_w(rotations[sample_index + 3]));
+
+		rtm::vector4f xxxx;
+		rtm::vector4f yyyy;
+		rtm::vector4f zzzz;
+		rtm::vector4f wwww;
+		RTM_MATRIXF_TRANSPOSE_4X4(rotation0, rotation1, rotation2, rotation3, xxxx, yyyy, zzzz, wwww);
+		(void)wwww;
+
+		rotations_soa.push_back(xxxx);
+		rotations_soa.push_back(yyyy);
+		rotations_soa.push_back(zzzz);
+	}
+
+	for (auto _ : state)
+	{
+		for (uint32_t group_index = 0; group_index < k_num_kernel_samples / 4; ++group_index)
+		{
+			const rtm::vector4f* xxxx_yyyy_zzzz = rotations_soa.data() + group_index * 3;
+			const rtm::vector4f wwww = acl::acl_impl::quat_from_positive_w4(xxxx_yyyy_zzzz[0], xxxx_yyyy_zzzz[1], xxxx_yyyy_zzzz[2]);
+			benchmark::DoNotOptimize(wwww);
+		}
+	}
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * k_num_kernel_samples);
+}
+
+// Unpacks the quantized segment range of four sub-tracks and applies it, followed by the clip range
+static void range_reduction_segment_and_clip(benchmark::State& state)
+{
+	// Segment ranges are stored on 8 bits per component: min.xxxx, min.yyyy, min.zzzz, extent.xxxx, extent.yyyy, extent.zzzz
+	const std::vector<uint8_t> segment_range_data = make_packed_buffer(k_num_kernel_samples / 4 * 24);
+	const std::vector<rtm::vector4f> samples = make_normalized_vectors(k_num_kernel_samples / 4 * 3);
+	const std::vector<rtm::vector4f> clip_ranges = make_normalized_vectors(k_num_kernel_samples / 4 * 6);
+
+	acl::acl_impl::segment_animated_scratch_v0 segment_scratch;
+
+	for (auto _ : state)
+	{
+		for (uint32_t group_index = 0; group_index < k_num_kernel_samples / 4; ++group_index)
+		{
+			acl::acl_impl::unpack_segment_range_data(segment_range_data.data() + group_index * 24, 0, segment_scratch);
+
+			const rtm::vector4f* sample = samples.data() + group_index * 3;
+			rtm::vector4f xxxx = rtm::vector_mul_add(sample[0], segment_scratch.segment_range_extent[0], segment_scratch.segment_range_min[0]);
+			rtm::vector4f yyyy = rtm::vector_mul_add(sample[1], segment_scratch.segment_range_extent[2], segment_scratch.segment_range_min[2]);
+			rtm::vector4f zzzz = rtm::vector_mul_add(sample[2], segment_scratch.segment_range_extent[4], segment_scratch.segment_range_min[4]);
+
+			const rtm::vector4f* clip_range = clip_ranges.data() + group_index * 6;
+			xxxx = rtm::vector_mul_add(xxxx, clip_range[3], clip_range[0]);
+			yyyy = rtm::vector_mul_add(yyyy, clip_range[4], clip_range[1]);
+			zzzz = rtm::vector_mul_add(zzzz, clip_range[5], clip_range[2]);
+
+			benchmark::DoNotOptimize(xxxx);
+			benchmark::DoNotOptimize(yyyy);
+			benchmark::DoNotOptimize(zzzz);
+		}
+	}
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * k_num_kernel_samples);
+}
+
+// Dequantizes the clip range of four rotation sub-tracks stored on 16 bits per component and applies it
+static void range_reduction_quantized_clip(benchmark::State& state)
+{
+	// Clip ranges are stored on 16 bits per component: min.xxxx, min.yyyy, min.zzzz, extent.xxxx, extent.yyyy, extent.zzzz
+	const std::vector<uint8_t> clip_range_data = make_packed_buffer(k_num_kernel_samples / 4 * 48);
+	const std::vector<rtm::vector4f> samples = make_normalized_vectors(k_num_kernel_samples / 4 * 3);
+
+	for (auto _ : state)
+	{
+		for (uint32_t group_index = 0; group_index < k_num_kernel_samples / 4; ++group_index)
+		{
+			const uint8_t* clip_range = clip_range_data.data() + group_index * 48;
+			const rtm::vector4f min_xxxx = acl::dequantize_rotation_clip_range_min(acl::load_vector4_u16x4_unsafe(clip_range + 0));
+			const rtm::vector4f min_yyyy = acl::dequantize_rotation_clip_range_min(acl::load_vector4_u16x4_unsafe(clip_range + 8));
+			const rtm::vector4f min_zzzz = acl::dequantize_rotation_clip_range_min(acl::load_vector4_u16x4_unsafe(clip_range + 16));
+			const rtm::vector4f extent_xxxx = acl::dequantize_rotation_clip_range_extent(acl::load_vector4_u16x4_unsafe(clip_range + 24));
+			const rtm::vector4f extent_yyyy = acl::dequantize_rotation_clip_range_extent(acl::load_vector4_u16x4_unsafe(clip_range + 32));
+			const rtm::vector4f extent_zzzz = acl::dequantize_rotation_clip_range_extent(acl::load_vector4_u16x4_unsafe(clip_range + 40));
+
+			const rtm::vector4f* sample = samples.data() + group_index * 3;
+			const rtm::vector4f xxxx = rtm::vector_mul_add(sample[0], extent_xxxx, min_xxxx);
+			const rtm::vector4f yyyy = rtm::vector_mul_add(sample[1], extent_yyyy, min_yyyy);
+			const rtm::vector4f zzzz = rtm::vector_mul_add(sample[2], extent_zzzz, min_zzzz);
+
+			benchmark::DoNotOptimize(xxxx);
+			benchmark::DoNotOptimize(yyyy);
+			benchmark::DoNotOptimize(zzzz);
+		}
+	}
+
+	state.SetItemsProcessed(int64_t(state.iterations()) * k_num_kernel_samples);
+}
+
+BENCHMARK(quat_w_reconstruction);
+BENCHMARK(quat_w_reconstruction4);
+BENCHMARK(range_reduction_segment_and_clip);
+BENCHMARK(range_reduction_quantized_clip);
@@ -29,12 +29,15 @@ def get_median_runs(clip_name, benchmarks):
 	pose = None
 	bone = None
 	for bench in benchmarks:
-		if bench['clip_name'] != clip_name:
+		if bench.get('clip_name') != clip_name:
 			continue	# Not our clip
 
 		if 'Dir:0' not in bench['name']:
 			continue	# Wrong direction
 
+		if 'Cache:' in bench['name'] and 'Cache:0' not in bench['name']:
+			continue	# Only the cold cache is measured
+
 		if bench['run_type'] != 'aggregate':
 			continue	# Not an aggregate value
 